@@ -47,6 +47,7 @@ SOFTWARE.
 
 #include <stdint.h>
 #include <string.h>
+#include <limits.h>
 
 #include "private/minmax_push.h"
 
@@ -82,6 +83,29 @@ namespace etl
 
   template <typename TIterator, typename TCompare>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare);
+
+  namespace private_algorithm
+  {
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort_dispatch(TIterator first, TIterator last, TCompare compare);
+
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort_dispatch(TIterator first, TIterator last, TCompare compare);
+  }
 }
 
 //*****************************************************************************
@@ -496,2566 +520,4334 @@ namespace etl
   }
 
   //***************************************************************************
-  // find_if
+  // Branchless binary search
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  TIterator find_if(TIterator first, TIterator last, TUnaryPredicate predicate)
+  namespace private_algorithm
   {
-    while (first != last)
+    //*************************************************************************
+    /// Hints that the element will be read soon.
+    /// Only pointers are prefetched, as other iterators may not address memory.
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<etl::is_pointer<TIterator>::value, void>::type
+      prefetch(TIterator itr)
     {
-      if (predicate(*first))
+#if ETL_USING_BUILTIN_PREFETCH
+      __builtin_prefetch(static_cast<const void*>(itr));
+#else
+      (void)itr;
+#endif
+    }
+
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<!etl::is_pointer<TIterator>::value, void>::type
+      prefetch(TIterator)
+    {
+    }
+
+    //*************************************************************************
+    /// Whether searches for keys are faster branchless.
+    /// True for arithmetic keys ordered by etl::less or etl::greater, where a
+    /// comparison is cheaper than a mispredicted branch.
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare>
+    struct is_branchless_key
+      : etl::integral_constant<bool, etl::is_arithmetic<TKey>::value &&
+                                     (etl::is_same<TKeyCompare, etl::less<TKey> >::value ||
+                                      etl::is_same<TKeyCompare, etl::greater<TKey> >::value)>
+    {
+    };
+
+    //*************************************************************************
+    /// Compares the element that the first argument points to.
+    //*************************************************************************
+    template <typename TCompare>
+    struct indirect_element_key_compare
+    {
+      indirect_element_key_compare(TCompare compare_)
+        : compare(compare_)
       {
-        return first;
       }
 
-      ++first;
-    }
+      template <typename TPointer, typename TKey>
+      bool operator ()(const TPointer& element, const TKey& key) const
+      {
+        return compare(*element, key);
+      }
 
-    return last;
-  }
+      TCompare compare;
+    };
 
-  //***************************************************************************
-  // find
-  //***************************************************************************
-  template <typename TIterator, typename T>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  TIterator find(TIterator first, TIterator last, const T& value)
-  {
-    while (first != last)
+    //*************************************************************************
+    /// Compares the element that the second argument points to.
+    //*************************************************************************
+    template <typename TCompare>
+    struct indirect_key_element_compare
     {
-      if (*first == value)
+      indirect_key_element_compare(TCompare compare_)
+        : compare(compare_)
       {
-        return first;
       }
 
-      ++first;
-    }
+      template <typename TKey, typename TPointer>
+      bool operator ()(const TKey& key, const TPointer& element) const
+      {
+        return compare(key, *element);
+      }
 
-    return last;
+      TCompare compare;
+    };
   }
 
   //***************************************************************************
-  // fill
-#if ETL_USING_STL && ETL_USING_CPP20
-  template<typename TIterator, typename TValue>
-  constexpr void fill(TIterator first, TIterator last, const TValue& value)
-  {
-    std::fill(first, last, value);
-  }
-#else
-  template<typename TIterator, typename TValue>
-  ETL_CONSTEXPR14 void fill(TIterator first, TIterator last, const TValue& value)
+  /// branchless_lower_bound
+  /// As lower_bound, for random access iterators, but the loop does not branch
+  /// on the comparisons, so its length only depends on the length of the range.
+  /// There are no mispredictions, and for pointers the two possible next
+  /// midpoints are prefetched.
+  //***************************************************************************
+  template <typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  TIterator branchless_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
   {
-    while (first != last)
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t length = last - first;
+
+    if (length == 0)
     {
-      *first = value;
-      ++first;
+      return first;
     }
-  }
-#endif
 
-  //***************************************************************************
-  // fill_n
-#if ETL_USING_STL && ETL_USING_CPP20
-  template<typename TIterator, typename TSize, typename TValue>
-  constexpr TIterator fill_n(TIterator first, TSize count, const TValue& value)
-  {
-    return std::fill_n(first, count, value);
-  }
-#else
-  template<typename TIterator, typename TSize, typename TValue>
-  ETL_CONSTEXPR14 TIterator fill_n(TIterator first, TSize count, const TValue& value)
-  {
-    while (count != 0)
+    while (length > 1)
     {
-      *first++ = value;
-      --count;
+      const difference_t half      = length / 2;
+      const difference_t next_half = (length - half) / 2;
+
+      private_algorithm::prefetch(first + next_half);
+      private_algorithm::prefetch(first + (half + next_half));
+
+      first   = compare(*(first + half), value) ? first + half : first;
+      length -= half;
     }
 
-    return first;
+    return compare(*first, value) ? first + 1 : first;
   }
-#endif
 
   //***************************************************************************
-  // count
-  //***************************************************************************
-  template <typename TIterator, typename T>
+  template <typename TIterator, typename TValue>
   ETL_NODISCARD
-  ETL_CONSTEXPR14
-  typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value)
+  TIterator branchless_lower_bound(TIterator first, TIterator last, const TValue& value)
   {
-    typename iterator_traits<TIterator>::difference_type n = 0;
-
-    while (first != last)
-    {
-      if (*first == value)
-      {
-        ++n;
-      }
-
-      ++first;
-    }
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
 
-    return n;
+    return etl::branchless_lower_bound(first, last, value, compare());
   }
 
   //***************************************************************************
-  // count_if
+  /// branchless_upper_bound
+  /// As upper_bound. See branchless_lower_bound.
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template <typename TIterator, typename TValue, typename TCompare>
   ETL_NODISCARD
-  ETL_CONSTEXPR14
-  typename etl::iterator_traits<TIterator>::difference_type 
-    count_if(TIterator first, TIterator last, TUnaryPredicate predicate)
+  TIterator branchless_upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
   {
-    typename iterator_traits<TIterator>::difference_type n = 0;
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
 
-    while (first != last)
+    difference_t length = last - first;
+
+    if (length == 0)
     {
-      if (predicate(*first))
-      {
-        ++n;
-      }
+      return first;
+    }
 
-      ++first;
+    while (length > 1)
+    {
+      const difference_t half      = length / 2;
+      const difference_t next_half = (length - half) / 2;
+
+      private_algorithm::prefetch(first + next_half);
+      private_algorithm::prefetch(first + (half + next_half));
+
+      first   = compare(value, *(first + half)) ? first : first + half;
+      length -= half;
     }
 
-    return n;
+    return compare(value, *first) ? first : first + 1;
   }
 
   //***************************************************************************
-  // equal
-#if ETL_USING_STL && ETL_USING_CPP20
-  // Three parameter
-  template <typename TIterator1, typename TIterator2>
-  [[nodiscard]]
-  constexpr
-  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+  template <typename TIterator, typename TValue>
+  ETL_NODISCARD
+  TIterator branchless_upper_bound(TIterator first, TIterator last, const TValue& value)
   {
-    return std::equal(first1, last1, first2);
-  }
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
 
-  // Three parameter + predicate
-  template <typename TIterator1, typename TIterator2, typename TPredicate>
-  [[nodiscard]]
-  constexpr
-  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TPredicate predicate)
-  {
-    return std::equal(first1, last1, first2, predicate);
+    return etl::branchless_upper_bound(first, last, value, compare());
   }
 
-  // Four parameter
-  template <typename TIterator1, typename TIterator2>
-  [[nodiscard]]
-  constexpr
-  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
-  {
-    return std::equal(first1, last1, first2, last2);
-  }
+  //***************************************************************************
+  /// lower_bound_batch
+  /// Finds the lower bound of each key in [keys_first, keys_last) and writes
+  /// the iterators to results, in the same order.
+  /// Up to Lower_Bound_Batch_Size searches are run in step, so the memory
+  /// reads of each level are issued together and their latencies overlap.
+  /// The searches are branchless, and for pointers the next reads are
+  /// prefetched.
+  /// TIterator must be random access, and TKeyIterator at least forward.
+  ///\return The end of the results.
+  //***************************************************************************
+  ETL_CONSTANT size_t Lower_Bound_Batch_Size = 8U;
 
-  // Four parameter + Predicate
-  template <typename TIterator1, typename TIterator2, typename TPredicate>
-  [[nodiscard]]
-  constexpr
-  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TPredicate predicate)
+  template <typename TIterator, typename TKeyIterator, typename TResultIterator, typename TCompare>
+  TResultIterator lower_bound_batch(TIterator       first,
+                                    TIterator       last,
+                                    TKeyIterator    keys_first,
+                                    TKeyIterator    keys_last,
+                                    TResultIterator results,
+                                    TCompare        compare)
   {
-    return std::equal(first1, last1, first2, last2, predicate);
-  }
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
 
-#else
+    const difference_t length = last - first;
 
-  template <typename TIterator1, typename TIterator2>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
-  {
-    while (first1 != last1)
+    TKeyIterator keys[Lower_Bound_Batch_Size];
+    TIterator    bases[Lower_Bound_Batch_Size];
+
+    while (keys_first != keys_last)
     {
-      if (*first1 != *first2)
+      size_t count = 0U;
+
+      while ((count < Lower_Bound_Batch_Size) && (keys_first != keys_last))
       {
-        return false;
+        keys[count]  = keys_first;
+        bases[count] = first;
+        ++count;
+        ++keys_first;
       }
 
-      ++first1;
-      ++first2;
-    }
+      if (length != 0)
+      {
+        difference_t remaining = length;
 
-    return true;
-  }
+        while (remaining > 1)
+        {
+          const difference_t half      = remaining / 2;
+          const difference_t next_half = (remaining - half) / 2;
 
-  // Predicate
-  template <typename TIterator1, typename TIterator2, typename TPredicate>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14 
-  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TPredicate predicate)
-  {
-    while (first1 != last1)
-    {
-      if (!predicate(*first1, *first2))
-      {
-        return false;
+          for (size_t i = 0U; i < count; ++i)
+          {
+            bases[i] = compare(*(bases[i] + half), *keys[i]) ? bases[i] + half : bases[i];
+            private_algorithm::prefetch(bases[i] + next_half);
+          }
+
+          remaining -= half;
+        }
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          bases[i] = compare(*bases[i], *keys[i]) ? bases[i] + 1 : bases[i];
+        }
       }
 
-      ++first1;
-      ++first2;
+      for (size_t i = 0U; i < count; ++i)
+      {
+        *results = bases[i];
+        ++results;
+      }
     }
 
-    return true;
+    return results;
   }
 
-  // Four parameter
-  template <typename TIterator1, typename TIterator2>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
+  //***************************************************************************
+  template <typename TIterator, typename TKeyIterator, typename TResultIterator>
+  TResultIterator lower_bound_batch(TIterator       first,
+                                    TIterator       last,
+                                    TKeyIterator    keys_first,
+                                    TKeyIterator    keys_last,
+                                    TResultIterator results)
   {
-    while ((first1 != last1) && (first2 != last2))
-    {
-      if (*first1 != *first2)
-      {
-        return false;
-      }
-
-      ++first1;
-      ++first2;
-    }
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
 
-    return (first1 == last1) && (first2 == last2);
+    return etl::lower_bound_batch(first, last, keys_first, keys_last, results, compare());
   }
 
-  // Four parameter, Predicate
-  template <typename TIterator1, typename TIterator2, typename TPredicate>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TPredicate predicate)
+  namespace private_algorithm
   {
-    while ((first1 != last1) && (first2 != last2))
+    //*************************************************************************
+    /// The lower bound of a key, in a sorted container's storage.
+    /// Branchless if the key and comparison suit it.
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare, typename TIterator, typename TValue, typename TCompare>
+    typename etl::enable_if<is_branchless_key<TKey, TKeyCompare>::value, TIterator>::type
+      key_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
     {
-      if (!predicate(*first1 , *first2))
-      {
-        return false;
-      }
+      return etl::branchless_lower_bound(first, last, value, compare);
+    }
 
-      ++first1;
-      ++first2;
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare, typename TIterator, typename TValue, typename TCompare>
+    typename etl::enable_if<!is_branchless_key<TKey, TKeyCompare>::value, TIterator>::type
+      key_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+    {
+      return etl::lower_bound(first, last, value, compare);
     }
 
-    return (first1 == last1) && (first2 == last2);
-  }
-#endif
+    //*************************************************************************
+    /// The upper bound of a key, in a sorted container's storage.
+    /// Branchless if the key and comparison suit it.
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare, typename TIterator, typename TValue, typename TCompare>
+    typename etl::enable_if<is_branchless_key<TKey, TKeyCompare>::value, TIterator>::type
+      key_upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+    {
+      return etl::branchless_upper_bound(first, last, value, compare);
+    }
 
-  //***************************************************************************
-  // lexicographical_compare
-  //***************************************************************************
-  template <typename TIterator1, typename TIterator2, typename TCompare>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool lexicographical_compare(TIterator1 first1, TIterator1 last1,
-                               TIterator2 first2, TIterator2 last2,
-                               TCompare compare)
-  {
-    while ((first1 != last1) && (first2 != last2))
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare, typename TIterator, typename TValue, typename TCompare>
+    typename etl::enable_if<!is_branchless_key<TKey, TKeyCompare>::value, TIterator>::type
+      key_upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
     {
-      if (compare(*first1, *first2))
-      {
-        return true;
-      }
-
-      if (compare(*first2, *first1))
-      {
-        return false;
-      }
-
-      ++first1;
-      ++first2;
+      return etl::upper_bound(first, last, value, compare);
     }
 
-    return (first1 == last1) && (first2 != last2);
-  }
-
-  // lexicographical_compare
-  template <typename TIterator1, typename TIterator2>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool lexicographical_compare(TIterator1 first1, TIterator1 last1,
-                               TIterator2 first2, TIterator2 last2)
-  {
-    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
-
-    return etl::lexicographical_compare(first1, last1, first2, last2, compare());
-  }
-
-  //***************************************************************************
-  // min
-  //***************************************************************************
-  template <typename T, typename TCompare>
-  ETL_NODISCARD
-  ETL_CONSTEXPR 
-  const T& min(const T& a, const T& b, TCompare compare)
-  {
-    return (compare(a, b)) ? a : b;
-  }
-
-  template <typename T>
-  ETL_NODISCARD
-  ETL_CONSTEXPR 
-  const T& min(const T& a, const T& b)
-  {
-    typedef etl::less<T> compare;
-
-    return etl::min(a, b, compare());
-  }
-
-  //***************************************************************************
-  // max
-  //***************************************************************************
-  template <typename T, typename TCompare>
-  ETL_NODISCARD
-  ETL_CONSTEXPR 
-  const T& max(const T& a, const T& b, TCompare compare)
-  {
-    return (compare(a, b)) ? b : a;
-  }
-
-  template <typename T>
-  ETL_NODISCARD
-  ETL_CONSTEXPR 
-  const T& max(const T& a, const T& b)
-  {
-    typedef etl::less<T> compare;
-
-    return etl::max(a, b, compare());
-  }
-
-  //***************************************************************************
-  // for_each
-  //***************************************************************************
-  template <typename TIterator, typename TUnaryOperation>
-  ETL_CONSTEXPR14 
-  TUnaryOperation for_each(TIterator first, TIterator last, TUnaryOperation unary_operation)
-  {
-    while (first != last)
+    //*************************************************************************
+    /// The lower bound of a key, in a sorted range of pointers to elements.
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare, typename TIterator, typename TValue, typename TCompare>
+    TIterator indirect_key_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
     {
-      unary_operation(*first);
-      ++first;
+      return key_lower_bound<TKey, TKeyCompare>(first, last, value, indirect_element_key_compare<TCompare>(compare));
     }
 
-    return unary_operation;
+    //*************************************************************************
+    /// The upper bound of a key, in a sorted range of pointers to elements.
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare, typename TIterator, typename TValue, typename TCompare>
+    TIterator indirect_key_upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+    {
+      return key_upper_bound<TKey, TKeyCompare>(first, last, value, indirect_key_element_compare<TCompare>(compare));
+    }
   }
 
   //***************************************************************************
-  // transform
+  // Block kernels for contiguous ranges of integral values.
+  // Each block of Block_Length elements is reduced by a fixed length loop with
+  // no early exit, which compilers turn into vector compares. Only then is the
+  // block searched element by element. They remain plain loops, so stay usable
+  // in constant expressions.
   //***************************************************************************
-  template <typename TIteratorIn, typename TIteratorOut, typename TUnaryOperation>
-  ETL_CONSTEXPR14
-  TIteratorOut transform(TIteratorIn first1, TIteratorIn last1, TIteratorOut d_first, TUnaryOperation unary_operation)
+  namespace private_algorithm
   {
-    while (first1 != last1)
+    /// Pointers to integral values use the block kernels.
+    template <typename TIterator>
+    struct is_block_range
+      : etl::integral_constant<bool, etl::is_pointer<TIterator>::value &&
+                                     etl::is_integral<typename etl::iterator_traits<TIterator>::value_type>::value>
     {
-      *d_first = unary_operation(*first1);
+    };
 
-      ++d_first;
-      ++first1;
-    }
+    /// Two ranges of the same integral type use the block kernels.
+    template <typename TIterator1, typename TIterator2>
+    struct is_block_range_pair
+      : etl::integral_constant<bool, is_block_range<TIterator1>::value &&
+                                     is_block_range<TIterator2>::value &&
+                                     etl::is_same<typename etl::iterator_traits<TIterator1>::value_type,
+                                                  typename etl::iterator_traits<TIterator2>::value_type>::value>
+    {
+    };
 
-    return d_first;
-  }
+    /// The number of elements reduced per block.
+    ETL_CONSTANT ptrdiff_t Block_Length = 16;
 
-  template <typename TIteratorIn1, typename TIteratorIn2, typename TIteratorOut, typename TBinaryOperation>
-  ETL_CONSTEXPR14
-  TIteratorOut transform(TIteratorIn1 first1, TIteratorIn1 last1, TIteratorIn2 first2, TIteratorOut d_first, TBinaryOperation binary_operation)
-  {
-    while (first1 != last1)
+    //*************************************************************************
+    template <typename TPointer, typename T>
+    ETL_CONSTEXPR14
+    TPointer find_blocks(TPointer first, TPointer last, const T& value)
     {
-      *d_first = binary_operation(*first1, *first2);
+      while ((last - first) >= Block_Length)
+      {
+        int found = 0;
 
-      ++d_first;
-      ++first1;
-      ++first2;
-    }
+        for (ptrdiff_t i = 0; i < Block_Length; ++i)
+        {
+          found |= (first[i] == value) ? 1 : 0;
+        }
 
-    return d_first;
-  }
+        if (found != 0)
+        {
+          break;
+        }
 
-  //***************************************************************************
-  // replace
-  //***************************************************************************
-  template <typename TIterator, typename T>
-  ETL_CONSTEXPR14 void replace(TIterator first, TIterator last, const T& old_value, const T& new_value)
-  {
-    while (first != last)
-    {
-      if (*first == old_value)
+        first += Block_Length;
+      }
+
+      while ((first != last) && !(*first == value))
       {
-        *first = new_value;
+        ++first;
       }
 
-      ++first;
+      return first;
     }
-  }
 
-  //***************************************************************************
-  // replace_if
-  //***************************************************************************
-  template <typename TIterator, typename TPredicate, typename T>
-  ETL_CONSTEXPR14 void replace_if(TIterator first, TIterator last, TPredicate predicate, const T& new_value)
-  {
-    while (first != last)
+    //*************************************************************************
+    /// The last element equal to value, which must be in the range.
+    //*************************************************************************
+    template <typename TPointer, typename T>
+    ETL_CONSTEXPR14
+    TPointer find_last_present_blocks(TPointer first, TPointer last, const T& value)
     {
-      if (predicate(*first))
+      while ((last - first) >= Block_Length)
       {
-        *first = new_value;
-      }
+        int found = 0;
 
-      ++first;
-    }
-  }
+        for (ptrdiff_t i = 1; i <= Block_Length; ++i)
+        {
+          found |= (*(last - i) == value) ? 1 : 0;
+        }
 
-  //***************************************************************************
-  // Heap
-  //***************************************************************************
-  namespace private_heap
-  {
-    // Push Heap Helper
-    template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
-    void push_heap(TIterator first, TDistance value_index, TDistance top_index, TValue value, TCompare compare)
-    {
-      TDistance parent = (value_index - 1) / 2;
+        if (found != 0)
+        {
+          break;
+        }
 
-      while ((value_index > top_index) && compare(first[parent], value))
+        last -= Block_Length;
+      }
+
+      --last;
+
+      while (!(*last == value))
       {
-        first[value_index] = etl::move(first[parent]);
-        value_index = parent;
-        parent = (value_index - 1) / 2;
+        --last;
       }
 
-      first[value_index] = etl::move(value);
+      return last;
     }
 
-    // Adjust Heap Helper
-    template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
-    void adjust_heap(TIterator first, TDistance value_index, TDistance length, TValue value, TCompare compare)
+    //*************************************************************************
+    template <typename TPointer, typename T>
+    ETL_CONSTEXPR14
+    ptrdiff_t count_blocks(TPointer first, TPointer last, const T& value)
     {
-      TDistance top_index = value_index;
-      TDistance child2nd = (2 * value_index) + 2;
+      ptrdiff_t n = 0;
 
-      while (child2nd < length)
+      while ((last - first) >= Block_Length)
       {
-        if (compare(first[child2nd], first[child2nd - 1]))
+        int block_count = 0;
+
+        for (ptrdiff_t i = 0; i < Block_Length; ++i)
         {
-          --child2nd;
+          block_count += (first[i] == value) ? 1 : 0;
         }
 
-        first[value_index] = etl::move(first[child2nd]);
-        value_index = child2nd;
-        child2nd = 2 * (child2nd + 1);
+        n     += block_count;
+        first += Block_Length;
       }
 
-      if (child2nd == length)
+      while (first != last)
       {
-        first[value_index] = etl::move(first[child2nd - 1]);
-        value_index = child2nd - 1;
+        n += (*first == value) ? 1 : 0;
+        ++first;
       }
 
-      push_heap(first, value_index, top_index, etl::move(value), compare);
+      return n;
     }
 
-    // Is Heap Helper
-    template <typename TIterator, typename TDistance, typename TCompare>
-    bool is_heap(const TIterator first, const TDistance n, TCompare compare)
+    //*************************************************************************
+    /// The first position at which the ranges differ.
+    //*************************************************************************
+    template <typename TPointer1, typename TPointer2>
+    ETL_CONSTEXPR14
+    ETL_OR_STD::pair<TPointer1, TPointer2> mismatch_blocks(TPointer1 first1, TPointer1 last1, TPointer2 first2)
     {
-      TDistance parent = 0;
+      typedef typename etl::iterator_traits<TPointer1>::value_type value_t;
 
-      for (TDistance child = 1; child < n; ++child)
+      while ((last1 - first1) >= Block_Length)
       {
-        if (compare(first[parent], first[child]))
+        value_t difference = value_t(0);
+
+        for (ptrdiff_t i = 0; i < Block_Length; ++i)
         {
-          return false;
+          difference |= value_t(first1[i] ^ first2[i]);
         }
 
-        if ((child & 1) == 0)
+        if (difference != value_t(0))
         {
-          ++parent;
+          break;
         }
+
+        first1 += Block_Length;
+        first2 += Block_Length;
       }
 
-      return true;
+      while ((first1 != last1) && (*first1 == *first2))
+      {
+        ++first1;
+        ++first2;
+      }
+
+      return ETL_OR_STD::pair<TPointer1, TPointer2>(first1, first2);
     }
-  }
 
-  // Pop Heap
-  template <typename TIterator, typename TCompare>
-  void pop_heap(TIterator first, TIterator last, TCompare compare)
-  {
-    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
-    typedef typename etl::iterator_traits<TIterator>::difference_type distance_t;
+    //*************************************************************************
+    /// The least value in a range that is not empty.
+    //*************************************************************************
+    template <typename TPointer>
+    ETL_CONSTEXPR14
+    typename etl::iterator_traits<TPointer>::value_type min_value_blocks(TPointer first, TPointer last)
+    {
+      typedef typename etl::iterator_traits<TPointer>::value_type value_t;
 
-    value_t value = etl::move(last[-1]);
-    last[-1] = etl::move(first[0]);
+      value_t minimum = *first;
 
-    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), etl::move(value), compare);
-  }
+      while ((last - first) >= Block_Length)
+      {
+        for (ptrdiff_t i = 0; i < Block_Length; ++i)
+        {
+          minimum = (first[i] < minimum) ? first[i] : minimum;
+        }
 
-  // Pop Heap
-  template <typename TIterator>
-  void pop_heap(TIterator first, TIterator last)
-  {
-    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+        first += Block_Length;
+      }
 
-    etl::pop_heap(first, last, compare());
-  }
+      while (first != last)
+      {
+        minimum = (*first < minimum) ? *first : minimum;
+        ++first;
+      }
 
-  // Push Heap
-  template <typename TIterator, typename TCompare>
-  void push_heap(TIterator first, TIterator last, TCompare compare)
-  {
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
-    typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+      return minimum;
+    }
 
-    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(etl::move(*(last - 1))), compare);
-  }
+    //*************************************************************************
+    /// The greatest value in a range that is not empty.
+    //*************************************************************************
+    template <typename TPointer>
+    ETL_CONSTEXPR14
+    typename etl::iterator_traits<TPointer>::value_type max_value_blocks(TPointer first, TPointer last)
+    {
+      typedef typename etl::iterator_traits<TPointer>::value_type value_t;
 
-  // Push Heap
-  template <typename TIterator>
-  void push_heap(TIterator first, TIterator last)
-  {
-    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+      value_t maximum = *first;
 
-    etl::push_heap(first, last, compare());
-  }
+      while ((last - first) >= Block_Length)
+      {
+        for (ptrdiff_t i = 0; i < Block_Length; ++i)
+        {
+          maximum = (maximum < first[i]) ? first[i] : maximum;
+        }
 
-  // Make Heap
-  template <typename TIterator, typename TCompare>
-  void make_heap(TIterator first, TIterator last, TCompare compare)
-  {
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
-
-    if ((last - first) < 2)
-    {
-      return;
-    }
-
-    difference_t length = last - first;
-    difference_t parent = (length - 2) / 2;
-
-    while (true)
-    {
-      private_heap::adjust_heap(first, parent, length, etl::move(*(first + parent)), compare);
+        first += Block_Length;
+      }
 
-      if (parent == 0)
+      while (first != last)
       {
-        return;
+        maximum = (maximum < *first) ? *first : maximum;
+        ++first;
       }
 
-      --parent;
+      return maximum;
+    }
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<is_block_range<TIterator>::value, TIterator>::type
+      find_dispatch(TIterator first, TIterator last, const T& value)
+    {
+      return find_blocks(first, last, value);
     }
-  }
-
-  // Make Heap
-  template <typename TIterator>
-  void make_heap(TIterator first, TIterator last)
-  {
-    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
-
-    etl::make_heap(first, last, compare());
-  }
-
-  // Is Heap
-  template <typename TIterator>
-  ETL_NODISCARD
-    bool is_heap(TIterator first, TIterator last)
-  {
-    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
 
-    return private_heap::is_heap(first, last - first, compare());
-  }
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<!is_block_range<TIterator>::value, TIterator>::type
+      find_dispatch(TIterator first, TIterator last, const T& value)
+    {
+      while (first != last)
+      {
+        if (*first == value)
+        {
+          return first;
+        }
 
-  // Is Heap
-  template <typename TIterator, typename TCompare>
-  ETL_NODISCARD
-  bool is_heap(TIterator first, TIterator last, TCompare compare)
-  {
-    return private_heap::is_heap(first, last - first, compare);
-  }
+        ++first;
+      }
 
-  // Sort Heap
-  template <typename TIterator>
-  void sort_heap(TIterator first, TIterator last)
-  {
-    while (first != last)
-    {
-      etl::pop_heap(first, last);
-      --last;
+      return last;
     }
-  }
 
-  // Sort Heap
-  template <typename TIterator, typename TCompare>
-  void sort_heap(TIterator first, TIterator last, TCompare compare)
-  {
-    while (first != last)
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<is_block_range<TIterator>::value, typename etl::iterator_traits<TIterator>::difference_type>::type
+      count_dispatch(TIterator first, TIterator last, const T& value)
     {
-      etl::pop_heap(first, last, compare);
-      --last;
+      return count_blocks(first, last, value);
     }
-  }
 
-  //***************************************************************************
-  // Search
-  //***************************************************************************
-  template<typename TIterator1, typename TIterator2, typename TCompare>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  TIterator1 search(TIterator1 first, TIterator1 last, TIterator2 search_first, TIterator2 search_last, TCompare compare)
-  {
-    while (true)
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<!is_block_range<TIterator>::value, typename etl::iterator_traits<TIterator>::difference_type>::type
+      count_dispatch(TIterator first, TIterator last, const T& value)
     {
-      TIterator1 itr = first;
-      TIterator2 search_itr = search_first;
+      typename iterator_traits<TIterator>::difference_type n = 0;
 
-      while (true)
+      while (first != last)
       {
-        if (search_itr == search_last)
-        {
-          return first;
-        }
-
-        if (itr == last)
-        {
-          return last;
-        }
-
-        if (!compare(*itr, *search_itr))
+        if (*first == value)
         {
-          break;
+          ++n;
         }
 
-        ++itr;
-        ++search_itr;
+        ++first;
       }
 
-      ++first;
+      return n;
     }
-  }
-
-  // Search
-  template<typename TIterator1, typename TIterator2>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  TIterator1 search(TIterator1 first, TIterator1 last, TIterator2 search_first, TIterator2 search_last)
-  {
-    typedef etl::equal_to<typename etl::iterator_traits<TIterator1>::value_type> compare;
 
-    return etl::search(first, last, search_first, search_last, compare());
-  }
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<is_block_range_pair<TIterator1, TIterator2>::value, ETL_OR_STD::pair<TIterator1, TIterator2> >::type
+      mismatch_dispatch(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+    {
+      return mismatch_blocks(first1, last1, first2);
+    }
 
-  //***************************************************************************
-  // Rotate
-  //***************************************************************************
-  namespace private_algorithm
-  {
-#if ETL_USING_CPP11
-    //*********************************
-    // For random access iterators
-    template <typename TIterator>
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
     ETL_CONSTEXPR14
-    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type
-      rotate_general(TIterator first, TIterator middle, TIterator last) 
+    typename etl::enable_if<!is_block_range_pair<TIterator1, TIterator2>::value, ETL_OR_STD::pair<TIterator1, TIterator2> >::type
+      mismatch_dispatch(TIterator1 first1, TIterator1 last1, TIterator2 first2)
     {
-      if (first == middle || middle == last)
+      while ((first1 != last1) && (*first1 == *first2))
       {
-        return first;
+        ++first1;
+        ++first2;
       }
 
-      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
-
-      int n = last - first;
-      int m = middle - first;
-      int gcd_nm = (n == 0 || m == 0) ? n + m : etl::gcd(n, m);
-
-      TIterator result = first + (last - middle);
+      return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+    }
 
-      for (int i = 0; i < gcd_nm; i++) 
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<is_block_range_pair<TIterator1, TIterator2>::value, ETL_OR_STD::pair<TIterator1, TIterator2> >::type
+      mismatch_dispatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
+    {
+      if ((last2 - first2) < (last1 - first1))
       {
-        value_type temp = etl::move(*(first + i));
-        int j = i;
-        
-        while (true) 
-        {
-          int k = j + m;
-          
-          if (k >= n)
-          {
-            k = k - n;
-          }
-          
-          if (k == i)
-          {
-            break;
-          }
-
-          *(first + j) = etl::move(*(first + k));
-          j = k;
-        }
-
-        *(first + j) = etl::move(temp);
+        last1 = first1 + (last2 - first2);
       }
 
-      return result;
+      return mismatch_blocks(first1, last1, first2);
     }
-#else
-    //*********************************
-    // For random access iterators
-    template <typename TIterator>
+
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
     ETL_CONSTEXPR14
-    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type
-      rotate_general(TIterator first, TIterator middle, TIterator last)
+    typename etl::enable_if<!is_block_range_pair<TIterator1, TIterator2>::value, ETL_OR_STD::pair<TIterator1, TIterator2> >::type
+      mismatch_dispatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
     {
-      if (first == middle || middle == last)
+      while ((first1 != last1) && (first2 != last2) && (*first1 == *first2))
       {
-        return first;
+        ++first1;
+        ++first2;
       }
 
-      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
-
-      int n = last - first;
-      int m = middle - first;
-      int gcd_nm = (n == 0 || m == 0) ? n + m : etl::gcd(n, m);
+      return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+    }
 
-      TIterator result = first + (last - middle);
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<is_block_range_pair<TIterator1, TIterator2>::value, bool>::type
+      equal_dispatch(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+    {
+      return mismatch_blocks(first1, last1, first2).first == last1;
+    }
 
-      for (int i = 0; i < gcd_nm; i++)
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<!is_block_range_pair<TIterator1, TIterator2>::value, bool>::type
+      equal_dispatch(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+    {
+      while (first1 != last1)
       {
-        value_type temp = *(first + i);
-        int j = i;
-
-        while (true)
+        if (*first1 != *first2)
         {
-          int k = j + m;
-
-          if (k >= n)
-          {
-            k = k - n;
-          }
-
-          if (k == i)
-          {
-            break;
-          }
-
-          *(first + j) = *(first + k);
-          j = k;
+          return false;
         }
 
-        *(first + j) = temp;
+        ++first1;
+        ++first2;
       }
 
-      return result;
+      return true;
     }
-#endif
 
-    //*********************************
-    // For bidirectional iterators
-    template <typename TIterator>
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
     ETL_CONSTEXPR14
-    typename etl::enable_if<etl::is_bidirectional_iterator<TIterator>::value, TIterator>::type
-      rotate_general(TIterator first, TIterator middle, TIterator last)
+    typename etl::enable_if<is_block_range_pair<TIterator1, TIterator2>::value, bool>::type
+      equal_dispatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
     {
-      if (first == middle || middle == last)
-      {
-        return first;
-      }
+      return ((last1 - first1) == (last2 - first2)) && (mismatch_blocks(first1, last1, first2).first == last1);
+    }
 
-      TIterator result = first;
-      etl::advance(result, etl::distance(middle, last));
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<!is_block_range_pair<TIterator1, TIterator2>::value, bool>::type
+      equal_dispatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
+    {
+      while ((first1 != last1) && (first2 != last2))
+      {
+        if (*first1 != *first2)
+        {
+          return false;
+        }
 
-      reverse(first, middle);
-      reverse(middle, last);
-      reverse(first, last);
+        ++first1;
+        ++first2;
+      }
 
-      return result;
+      return (first1 == last1) && (first2 == last2);
     }
+  }
 
-    //*********************************
-    // For forward iterators
-    template <typename TIterator>
-    ETL_CONSTEXPR14
-    typename etl::enable_if<etl::is_forward_iterator<TIterator>::value, TIterator>::type
-      rotate_general(TIterator first, TIterator middle, TIterator last)
+  //***************************************************************************
+  // find_if
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator find_if(TIterator first, TIterator last, TUnaryPredicate predicate)
+  {
+    while (first != last)
     {
-      if (first == middle || middle == last)
+      if (predicate(*first))
       {
         return first;
       }
 
-      TIterator next = middle;
-      TIterator result = first;
-      std::advance(result, std::distance(middle, last));
+      ++first;
+    }
 
-      while (first != next)
-      {
-        using ETL_OR_STD::swap;
-        swap(*first++, *next++);
+    return last;
+  }
 
-        if (next == last)
-        {
-          next = middle;
-        }
-        else if (first == middle)
-        {
-          middle = next;
-        }
-      }
-
-      return result;
-    }
+  //***************************************************************************
+  // find
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator find(TIterator first, TIterator last, const T& value)
+  {
+    return private_algorithm::find_dispatch(first, last, value);
+  }
 
-    //*********************************
-    // Simplified algorithm for rotate left by one
-    template <typename TIterator>
-    ETL_CONSTEXPR14
-    TIterator rotate_left_by_one(TIterator first, TIterator last)
+  //***************************************************************************
+  // fill
+#if ETL_USING_STL && ETL_USING_CPP20
+  template<typename TIterator, typename TValue>
+  constexpr void fill(TIterator first, TIterator last, const TValue& value)
+  {
+    std::fill(first, last, value);
+  }
+#else
+  template<typename TIterator, typename TValue>
+  ETL_CONSTEXPR14 void fill(TIterator first, TIterator last, const TValue& value)
+  {
+    while (first != last)
     {
-      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
-
-      // Save the first item.
-      value_type temp(etl::move(*first));
-
-      // Move the rest.
-      TIterator result = etl::move(etl::next(first), last, first);
-
-      // Restore the first item in its rotated position.
-      *result = etl::move(temp);
-
-      // The new position of the first item.
-      return result;
+      *first = value;
+      ++first;
     }
+  }
+#endif
 
-    //*********************************
-    // Simplified for algorithm rotate right by one
-    template <typename TIterator>
-    ETL_CONSTEXPR14
-    TIterator rotate_right_by_one(TIterator first, TIterator last)
+  //***************************************************************************
+  // fill_n
+#if ETL_USING_STL && ETL_USING_CPP20
+  template<typename TIterator, typename TSize, typename TValue>
+  constexpr TIterator fill_n(TIterator first, TSize count, const TValue& value)
+  {
+    return std::fill_n(first, count, value);
+  }
+#else
+  template<typename TIterator, typename TSize, typename TValue>
+  ETL_CONSTEXPR14 TIterator fill_n(TIterator first, TSize count, const TValue& value)
+  {
+    while (count != 0)
     {
-      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
-
-      // Save the last item.
-      TIterator previous = etl::prev(last);
-      value_type temp(etl::move(*previous));
-
-      // Move the rest.
-      TIterator result = etl::move_backward(first, previous, last);
+      *first++ = value;
+      --count;
+    }
 
-      // Restore the last item in its rotated position.
-      *first = etl::move(temp);
+    return first;
+  }
+#endif
 
-      // The new position of the first item.
-      return result;
-    }
+  //***************************************************************************
+  // count
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value)
+  {
+    return private_algorithm::count_dispatch(first, last, value);
   }
 
-  //*********************************
-  template<typename TIterator>
+  //***************************************************************************
+  // count_if
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator rotate(TIterator first, TIterator middle, TIterator last)
+  typename etl::iterator_traits<TIterator>::difference_type 
+    count_if(TIterator first, TIterator last, TUnaryPredicate predicate)
   {
-    if (etl::next(first) == middle)
-    {
-      return private_algorithm::rotate_left_by_one(first, last);
-    }
+    typename iterator_traits<TIterator>::difference_type n = 0;
 
-    if (etl::next(middle) == last)
+    while (first != last)
     {
-#if ETL_USING_CPP20
-      if ETL_IF_CONSTEXPR(etl::is_forward_iterator<TIterator>::value)
-      {
-        return private_algorithm::rotate_general(first, middle, last);
-      }
-      else
+      if (predicate(*first))
       {
-        return private_algorithm::rotate_right_by_one(first, last);
+        ++n;
       }
-#else
-      return private_algorithm::rotate_general(first, middle, last);
-#endif
+
+      ++first;
     }
 
-    return private_algorithm::rotate_general(first, middle, last);
+    return n;
   }
 
   //***************************************************************************
-  // find_end
-  //***************************************************************************
-  // Predicate
+  // equal
+#if ETL_USING_STL && ETL_USING_CPP20
+  // Three parameter
+  template <typename TIterator1, typename TIterator2>
+  [[nodiscard]]
+  constexpr
+  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+  {
+    return std::equal(first1, last1, first2);
+  }
+
+  // Three parameter + predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
+  [[nodiscard]]
+  constexpr
+  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TPredicate predicate)
+  {
+    return std::equal(first1, last1, first2, predicate);
+  }
+
+  // Four parameter
+  template <typename TIterator1, typename TIterator2>
+  [[nodiscard]]
+  constexpr
+  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
+  {
+    return std::equal(first1, last1, first2, last2);
+  }
+
+  // Four parameter + Predicate
   template <typename TIterator1, typename TIterator2, typename TPredicate>
+  [[nodiscard]]
+  constexpr
+  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TPredicate predicate)
+  {
+    return std::equal(first1, last1, first2, last2, predicate);
+  }
+
+#else
+
+  template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator1 find_end(TIterator1 b, TIterator1 e,
-                      TIterator2 sb, TIterator2 se,
-                      TPredicate predicate)
+  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
   {
-    if (sb == se)
-    {
-      return e;
-    }
-
-    TIterator1 result = e;
+    return private_algorithm::equal_dispatch(first1, last1, first2);
+  }
 
-    while (true)
+  // Predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14 
+  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TPredicate predicate)
+  {
+    while (first1 != last1)
     {
-      TIterator1 new_result = etl::search(b, e, sb, se, predicate);
-
-      if (new_result == e)
-      {
-        break;
-      }
-      else
+      if (!predicate(*first1, *first2))
       {
-        result = new_result;
-        b = result;
-        ++b;
+        return false;
       }
+
+      ++first1;
+      ++first2;
     }
-    return result;
+
+    return true;
   }
 
-  // Default
+  // Four parameter
   template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator1 find_end(TIterator1 b, TIterator1 e,
-                      TIterator2 sb, TIterator2 se)
+  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
   {
-    typedef etl::equal_to<typename etl::iterator_traits<TIterator1>::value_type> predicate;
-
-    return find_end(b, e, sb, se, predicate());
+    return private_algorithm::equal_dispatch(first1, last1, first2, last2);
   }
 
-  //***************************************************************************
-  /// Finds the iterator to the smallest element in the range (begin, end).<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
+  // Four parameter, Predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator min_element(TIterator begin,
-                        TIterator end,
-                        TCompare  compare)
+  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TPredicate predicate)
   {
-    TIterator minimum = begin;
-    ++begin;
-
-    while (begin != end)
+    while ((first1 != last1) && (first2 != last2))
     {
-      if (compare(*begin, *minimum))
+      if (!predicate(*first1 , *first2))
       {
-        minimum = begin;
+        return false;
       }
 
-      ++begin;
+      ++first1;
+      ++first2;
     }
 
-    return minimum;
+    return (first1 == last1) && (first2 == last2);
   }
+#endif
 
   //***************************************************************************
-  /// min_element
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
+  // mismatch
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/mismatch"></a>
   //***************************************************************************
-  template <typename TIterator>
+  template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator min_element(TIterator begin,
-                        TIterator end)
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2)
   {
-    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
-
-    return etl::min_element(begin, end, etl::less<value_t>());
+    return private_algorithm::mismatch_dispatch(first1, last1, first2);
   }
 
-  //***************************************************************************
-  /// Finds the iterator to the largest element in the range (begin, end).<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
+  // Predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator max_element(TIterator begin,
-                        TIterator end,
-                        TCompare  compare)
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TPredicate predicate)
   {
-    TIterator maximum = begin;
-    ++begin;
-
-    while (begin != end)
+    while ((first1 != last1) && predicate(*first1, *first2))
     {
-      if (!compare(*begin, *maximum))
-      {
-        maximum = begin;
-      }
-
-      ++begin;
+      ++first1;
+      ++first2;
     }
 
-    return maximum;
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
   }
 
-  //***************************************************************************
-  /// max_element
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
-  //***************************************************************************
-  template <typename TIterator>
+  // Four parameter
+  template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator max_element(TIterator begin,
-                        TIterator end)
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
   {
-    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+    return private_algorithm::mismatch_dispatch(first1, last1, first2, last2);
+  }
+
+  // Four parameter, Predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TPredicate predicate)
+  {
+    while ((first1 != last1) && (first2 != last2) && predicate(*first1, *first2))
+    {
+      ++first1;
+      ++first2;
+    }
 
-    return etl::max_element(begin, end, etl::less<value_t>());
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
   }
 
   //***************************************************************************
-  /// Finds the greatest and the smallest element in the range (begin, end).<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
-  ///\ingroup algorithm
+  // lexicographical_compare
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
+  template <typename TIterator1, typename TIterator2, typename TCompare>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin,
-                                                        TIterator end,
-                                                        TCompare  compare)
+  bool lexicographical_compare(TIterator1 first1, TIterator1 last1,
+                               TIterator2 first2, TIterator2 last2,
+                               TCompare compare)
   {
-    TIterator minimum = begin;
-    TIterator maximum = begin;
-    ++begin;
-
-    while (begin != end)
+    while ((first1 != last1) && (first2 != last2))
     {
-      if (compare(*begin, *minimum))
+      if (compare(*first1, *first2))
       {
-        minimum = begin;
+        return true;
       }
 
-      if (compare(*maximum, *begin))
+      if (compare(*first2, *first1))
       {
-        maximum = begin;
+        return false;
       }
 
-      ++begin;
+      ++first1;
+      ++first2;
     }
 
-    return ETL_OR_STD::pair<TIterator, TIterator>(minimum, maximum);
+    return (first1 == last1) && (first2 != last2);
   }
 
-  //***************************************************************************
-  /// minmax_element
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
-  //***************************************************************************
-  template <typename TIterator>
+  // lexicographical_compare
+  template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin,
-                                                        TIterator end)
+  bool lexicographical_compare(TIterator1 first1, TIterator1 last1,
+                               TIterator2 first2, TIterator2 last2)
   {
-    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
 
-    return etl::minmax_element(begin, end, etl::less<value_t>());
+    return etl::lexicographical_compare(first1, last1, first2, last2, compare());
   }
 
   //***************************************************************************
-  /// minmax
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
+  // min
   //***************************************************************************
+  template <typename T, typename TCompare>
+  ETL_NODISCARD
+  ETL_CONSTEXPR 
+  const T& min(const T& a, const T& b, TCompare compare)
+  {
+    return (compare(a, b)) ? a : b;
+  }
+
   template <typename T>
   ETL_NODISCARD
-  ETL_CONSTEXPR14
-  ETL_OR_STD::pair<const T&, const T&> minmax(const T& a,
-                                              const T& b)
+  ETL_CONSTEXPR 
+  const T& min(const T& a, const T& b)
   {
-    return (b < a) ? ETL_OR_STD::pair<const T&, const T&>(b, a) : ETL_OR_STD::pair<const T&, const T&>(a, b);
+    typedef etl::less<T> compare;
+
+    return etl::min(a, b, compare());
   }
 
   //***************************************************************************
-  /// minmax
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
+  // max
   //***************************************************************************
   template <typename T, typename TCompare>
   ETL_NODISCARD
-  ETL_CONSTEXPR14
-  ETL_OR_STD::pair<const T&, const T&> minmax(const T& a,
-                                              const T& b,
-                                              TCompare compare)
+  ETL_CONSTEXPR 
+  const T& max(const T& a, const T& b, TCompare compare)
   {
-    return compare(b, a) ? ETL_OR_STD::pair<const T&, const T&>(b, a) : ETL_OR_STD::pair<const T&, const T&>(a, b);
+    return (compare(a, b)) ? b : a;
   }
 
-  //***************************************************************************
-  /// is_sorted_until
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
-  //***************************************************************************
-  template <typename TIterator>
+  template <typename T>
   ETL_NODISCARD
-  ETL_CONSTEXPR14
-  TIterator is_sorted_until(TIterator begin,
-                            TIterator end)
+  ETL_CONSTEXPR 
+  const T& max(const T& a, const T& b)
   {
-    if (begin != end)
-    {
-      TIterator next = begin;
+    typedef etl::less<T> compare;
 
-      while (++next != end)
-      {
-        if (*next < *begin)
-        {
-          return next;
-        }
+    return etl::max(a, b, compare());
+  }
 
-        ++begin;
-      }
+  //***************************************************************************
+  // for_each
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryOperation>
+  ETL_CONSTEXPR14 
+  TUnaryOperation for_each(TIterator first, TIterator last, TUnaryOperation unary_operation)
+  {
+    while (first != last)
+    {
+      unary_operation(*first);
+      ++first;
     }
 
-    return end;
+    return unary_operation;
   }
 
   //***************************************************************************
-  /// is_sorted_until
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
+  // transform
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_NODISCARD
+  template <typename TIteratorIn, typename TIteratorOut, typename TUnaryOperation>
   ETL_CONSTEXPR14
-  TIterator is_sorted_until(TIterator begin,
-                            TIterator end,
-                            TCompare  compare)
+  TIteratorOut transform(TIteratorIn first1, TIteratorIn last1, TIteratorOut d_first, TUnaryOperation unary_operation)
   {
-    if (begin != end)
+    while (first1 != last1)
     {
-      TIterator next = begin;
-
-      while (++next != end)
-      {
-        if (compare(*next, *begin))
-        {
-          return next;
-        }
+      *d_first = unary_operation(*first1);
 
-        ++begin;
-      }
+      ++d_first;
+      ++first1;
     }
 
-    return end;
+    return d_first;
   }
 
-  //***************************************************************************
-  /// is_sorted
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
-  //***************************************************************************
-  template<typename TIterator>
-  ETL_NODISCARD
+  template <typename TIteratorIn1, typename TIteratorIn2, typename TIteratorOut, typename TBinaryOperation>
   ETL_CONSTEXPR14
-  bool is_sorted(TIterator begin,
-                 TIterator end)
+  TIteratorOut transform(TIteratorIn1 first1, TIteratorIn1 last1, TIteratorIn2 first2, TIteratorOut d_first, TBinaryOperation binary_operation)
   {
-    return etl::is_sorted_until(begin, end) == end;
+    while (first1 != last1)
+    {
+      *d_first = binary_operation(*first1, *first2);
+
+      ++d_first;
+      ++first1;
+      ++first2;
+    }
+
+    return d_first;
   }
 
   //***************************************************************************
-  /// is_sorted
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
+  // replace
   //***************************************************************************
-  template<typename TIterator, typename TCompare>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool is_sorted(TIterator begin,
-                 TIterator end,
-                 TCompare  compare)
+  template <typename TIterator, typename T>
+  ETL_CONSTEXPR14 void replace(TIterator first, TIterator last, const T& old_value, const T& new_value)
   {
-    return etl::is_sorted_until(begin, end, compare) == end;
+    while (first != last)
+    {
+      if (*first == old_value)
+      {
+        *first = new_value;
+      }
+
+      ++first;
+    }
   }
 
   //***************************************************************************
-  /// find_if_not
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/find"></a>
+  // replace_if
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  TIterator find_if_not(TIterator       begin,
-                        TIterator       end,
-                        TUnaryPredicate predicate)
+  template <typename TIterator, typename TPredicate, typename T>
+  ETL_CONSTEXPR14 void replace_if(TIterator first, TIterator last, TPredicate predicate, const T& new_value)
   {
-    while (begin != end)
+    while (first != last)
     {
-      if (!predicate(*begin))
+      if (predicate(*first))
       {
-        return begin;
+        *first = new_value;
       }
 
-      ++begin;
+      ++first;
     }
-
-    return end;
   }
 
   //***************************************************************************
-  /// is_permutation
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
+  // Heap
   //***************************************************************************
-  template <typename TIterator1, typename TIterator2>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool is_permutation(TIterator1 begin1,
-                      TIterator1 end1,
-                      TIterator2 begin2)
+  namespace private_heap
   {
-    if (begin1 != end1)
+    // Push Heap Helper
+    template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    void push_heap(TIterator first, TDistance value_index, TDistance top_index, TValue value, TCompare compare)
     {
-      TIterator2 end2 = begin2;
-
-      etl::advance(end2, etl::distance(begin1, end1));
+      TDistance parent = (value_index - 1) / 2;
 
-      for (TIterator1 i = begin1; i != end1; ++i)
+      while ((value_index > top_index) && compare(first[parent], value))
       {
-        if (i == etl::find(begin1, i, *i))
-        {
-          size_t n = etl::count(begin2, end2, *i);
-
-          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
-          {
-            return false;
-          }
-        }
+        first[value_index] = ETL_MOVE(first[parent]);
+        value_index = parent;
+        parent = (value_index - 1) / 2;
       }
-    }
 
-    return true;
-  }
+      first[value_index] = ETL_MOVE(value);
+    }
 
-  //***************************************************************************
-  /// is_permutation
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
-  //***************************************************************************
-  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool is_permutation(TIterator1       begin1,
-                      TIterator1       end1,
-                      TIterator2       begin2,
-                      TBinaryPredicate predicate)
-  {
-    if (begin1 != end1)
+    // Adjust Heap Helper
+    template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    void adjust_heap(TIterator first, TDistance value_index, TDistance length, TValue value, TCompare compare)
     {
-      TIterator2 end2 = begin2;
-
-      etl::advance(end2, etl::distance(begin1, end1));
+      TDistance top_index = value_index;
+      TDistance child2nd = (2 * value_index) + 2;
 
-      for (TIterator1 i = begin1; i != end1; ++i)
+      while (child2nd < length)
       {
-        if (i == etl::find_if(begin1, i, etl::bind1st(predicate, *i)))
+        if (compare(first[child2nd], first[child2nd - 1]))
         {
-          size_t n = etl::count(begin2, end2, *i);
-
-          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
-          {
-            return false;
-          }
+          --child2nd;
         }
+
+        first[value_index] = ETL_MOVE(first[child2nd]);
+        value_index = child2nd;
+        child2nd = 2 * (child2nd + 1);
       }
-    }
 
-    return true;
-  }
+      if (child2nd == length)
+      {
+        first[value_index] = ETL_MOVE(first[child2nd - 1]);
+        value_index = child2nd - 1;
+      }
 
-  //***************************************************************************
-  /// is_permutation
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
-  //***************************************************************************
-  template <typename TIterator1, typename TIterator2>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool is_permutation(TIterator1 begin1,
-                      TIterator1 end1,
-                      TIterator2 begin2,
-                      TIterator2 end2)
-  {
-    if (begin1 != end1)
+      push_heap(first, value_index, top_index, ETL_MOVE(value), compare);
+    }
+
+    // Is Heap Helper
+    template <typename TIterator, typename TDistance, typename TCompare>
+    bool is_heap(const TIterator first, const TDistance n, TCompare compare)
     {
-      for (TIterator1 i = begin1; i != end1; ++i)
+      TDistance parent = 0;
+
+      for (TDistance child = 1; child < n; ++child)
       {
-        if (i == etl::find(begin1, i, *i))
+        if (compare(first[parent], first[child]))
         {
-          size_t n = etl::count(begin2, end2, *i);
+          return false;
+        }
 
-          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
-          {
-            return false;
-          }
+        if ((child & 1) == 0)
+        {
+          ++parent;
         }
       }
+
+      return true;
     }
+  }
 
-    return true;
+  // Pop Heap
+  template <typename TIterator, typename TCompare>
+  void pop_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+    typedef typename etl::iterator_traits<TIterator>::difference_type distance_t;
+
+    value_t value = ETL_MOVE(last[-1]);
+    last[-1] = ETL_MOVE(first[0]);
+
+    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), ETL_MOVE(value), compare);
   }
 
-  //***************************************************************************
-  /// is_permutation
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
-  //***************************************************************************
-  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
-  ETL_NODISCARD
-  bool is_permutation(TIterator1       begin1,
-                      TIterator1       end1,
-                      TIterator2       begin2,
-                      TIterator2       end2,
-                      TBinaryPredicate predicate)
+  // Pop Heap
+  template <typename TIterator>
+  void pop_heap(TIterator first, TIterator last)
   {
-    if (begin1 != end1)
-    {
-      for (TIterator1 i = begin1; i != end1; ++i)
-      {
-        if (i == etl::find_if(begin1, i, etl::bind1st(predicate, *i)))
-        {
-          size_t n = etl::count(begin2, end2, *i);
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
 
-          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
-          {
-            return false;
-          }
-        }
-      }
-    }
+    etl::pop_heap(first, last, compare());
+  }
 
-    return true;
+  // Push Heap
+  template <typename TIterator, typename TCompare>
+  void push_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+    typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+
+    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(ETL_MOVE(*(last - 1))), compare);
   }
 
-  //***************************************************************************
-  /// is_partitioned
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_partitioned"></a>
-  //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool is_partitioned(TIterator       begin,
-                      TIterator       end,
-                      TUnaryPredicate predicate)
+  // Push Heap
+  template <typename TIterator>
+  void push_heap(TIterator first, TIterator last)
   {
-    while (begin != end)
-    {
-      if (!predicate(*begin))
-      {
-        break;
-      }
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
 
-      ++begin;
+    etl::push_heap(first, last, compare());
+  }
+
+  // Make Heap
+  template <typename TIterator, typename TCompare>
+  void make_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    if ((last - first) < 2)
+    {
+      return;
     }
 
-    while (begin != end)
+    difference_t length = last - first;
+    difference_t parent = (length - 2) / 2;
+
+    while (true)
     {
-      if (predicate(*begin))
+      private_heap::adjust_heap(first, parent, length, ETL_MOVE(*(first + parent)), compare);
+
+      if (parent == 0)
       {
-        return false;
+        return;
       }
 
-      ++begin;
+      --parent;
     }
+  }
 
-    return true;
+  // Make Heap
+  template <typename TIterator>
+  void make_heap(TIterator first, TIterator last)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    etl::make_heap(first, last, compare());
   }
 
-  //***************************************************************************
-  /// partition_point
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_point"></a>
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  // Is Heap
+  template <typename TIterator>
   ETL_NODISCARD
-  ETL_CONSTEXPR14
-  TIterator partition_point(TIterator       begin,
-                            TIterator       end,
-                            TUnaryPredicate predicate)
+    bool is_heap(TIterator first, TIterator last)
   {
-    while (begin != end)
-    {
-      if (!predicate(*begin))
-      {
-        return begin;
-      }
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
 
-      ++begin;
-    }
+    return private_heap::is_heap(first, last - first, compare());
+  }
 
-    return begin;
+  // Is Heap
+  template <typename TIterator, typename TCompare>
+  ETL_NODISCARD
+  bool is_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    return private_heap::is_heap(first, last - first, compare);
   }
 
-  //***************************************************************************
-  /// Copies the elements from the range (begin, end) to two different ranges
-  /// depending on the value returned by the predicate.<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_copy"></a>
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse, typename TUnaryPredicate>
-  ETL_CONSTEXPR14
-  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_copy(TSource           begin,
-                                                                       TSource           end,
-                                                                       TDestinationTrue  destination_true,
-                                                                       TDestinationFalse destination_false,
-                                                                       TUnaryPredicate   predicate)
+  // Sort Heap
+  template <typename TIterator>
+  void sort_heap(TIterator first, TIterator last)
   {
-    while (begin != end)
+    while (first != last)
     {
-      if (predicate(*begin))
-      {
-        *destination_true = *begin;
-        ++destination_true;
-      }
-      else
-      {
-        *destination_false = *begin;
-        ++destination_false;
-      }
-
-      ++begin;
+      etl::pop_heap(first, last);
+      --last;
     }
-
-    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
   }
 
-  //***************************************************************************
-  /// copy_if
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/copy"></a>
-  //***************************************************************************
-  template <typename TIterator, typename TOutputIterator, typename TUnaryPredicate>
-  ETL_CONSTEXPR14
-  TOutputIterator copy_if(TIterator       begin,
-                          TIterator       end,
-                          TOutputIterator out,
-                          TUnaryPredicate predicate)
+  // Sort Heap
+  template <typename TIterator, typename TCompare>
+  void sort_heap(TIterator first, TIterator last, TCompare compare)
   {
-    while (begin != end)
+    while (first != last)
     {
-      if (predicate(*begin))
-      {
-        *out = *begin;
-        ++out;
-      }
-
-      ++begin;
+      etl::pop_heap(first, last, compare);
+      --last;
     }
-
-    return out;
   }
 
   //***************************************************************************
-  /// all_of
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  // Search
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template<typename TIterator1, typename TIterator2, typename TCompare>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  bool all_of(TIterator       begin,
-              TIterator       end,
-              TUnaryPredicate predicate)
+  TIterator1 search(TIterator1 first, TIterator1 last, TIterator2 search_first, TIterator2 search_last, TCompare compare)
   {
-    return etl::find_if_not(begin, end, predicate) == end;
-  }
+    while (true)
+    {
+      TIterator1 itr = first;
+      TIterator2 search_itr = search_first;
 
-  //***************************************************************************
-  /// any_of
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
-  //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool any_of(TIterator       begin,
-              TIterator       end,
-              TUnaryPredicate predicate)
-  {
-    return etl::find_if(begin, end, predicate) != end;
+      while (true)
+      {
+        if (search_itr == search_last)
+        {
+          return first;
+        }
+
+        if (itr == last)
+        {
+          return last;
+        }
+
+        if (!compare(*itr, *search_itr))
+        {
+          break;
+        }
+
+        ++itr;
+        ++search_itr;
+      }
+
+      ++first;
+    }
   }
 
-  //***************************************************************************
-  /// none_of
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
-  //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  // Search
+  template<typename TIterator1, typename TIterator2>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  bool none_of(TIterator       begin,
-               TIterator       end,
-               TUnaryPredicate predicate)
+  TIterator1 search(TIterator1 first, TIterator1 last, TIterator2 search_first, TIterator2 search_last)
   {
-    return etl::find_if(begin, end, predicate) == end;
-  }
+    typedef etl::equal_to<typename etl::iterator_traits<TIterator1>::value_type> compare;
 
-#if ETL_NOT_USING_STL
-  //***************************************************************************
-  /// Sorts the elements.
-  /// Uses user defined comparison.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  void sort(TIterator first, TIterator last, TCompare compare)
-  {
-    etl::shell_sort(first, last, compare);
+    return etl::search(first, last, search_first, search_last, compare());
   }
 
   //***************************************************************************
-  /// Sorts the elements.
-  ///\ingroup algorithm
+  // Rotate
   //***************************************************************************
-  template <typename TIterator>
-  void sort(TIterator first, TIterator last)
+  namespace private_algorithm
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
-  }
+#if ETL_USING_CPP11
+    //*********************************
+    // For random access iterators
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type
+      rotate_general(TIterator first, TIterator middle, TIterator last) 
+    {
+      if (first == middle || middle == last)
+      {
+        return first;
+      }
 
-  //***************************************************************************
-  /// Sorts the elements.
-  /// Stable.
-  /// Uses user defined comparison.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  void stable_sort(TIterator first, TIterator last, TCompare compare)
-  {
-    etl::insertion_sort(first, last, compare);
-  }
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
 
-  //***************************************************************************
-  /// Sorts the elements.
-  /// Stable.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator>
-  void stable_sort(TIterator first, TIterator last)
-  {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
-  }
-#else
-  //***************************************************************************
-  /// Sorts the elements.
-  /// Uses user defined comparison.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  void sort(TIterator first, TIterator last, TCompare compare)
-  {
-    std::sort(first, last, compare);
-  }
+      int n = last - first;
+      int m = middle - first;
+      int gcd_nm = (n == 0 || m == 0) ? n + m : etl::gcd(n, m);
 
-  //***************************************************************************
-  /// Sorts the elements.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator>
-  void sort(TIterator first, TIterator last)
-  {
-    std::sort(first, last);
-  }
+      TIterator result = first + (last - middle);
 
-  //***************************************************************************
-  /// Sorts the elements.
-  /// Stable.
-  /// Uses user defined comparison.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  void stable_sort(TIterator first, TIterator last, TCompare compare)
-  {
-    std::stable_sort(first, last, compare);
-  }
+      for (int i = 0; i < gcd_nm; i++) 
+      {
+        value_type temp = ETL_MOVE(*(first + i));
+        int j = i;
+        
+        while (true) 
+        {
+          int k = j + m;
+          
+          if (k >= n)
+          {
+            k = k - n;
+          }
+          
+          if (k == i)
+          {
+            break;
+          }
 
-  //***************************************************************************
-  /// Sorts the elements.
-  /// Stable.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator>
-  void stable_sort(TIterator first, TIterator last)
-  {
-    std::stable_sort(first, last);
-  }
-#endif
+          *(first + j) = ETL_MOVE(*(first + k));
+          j = k;
+        }
 
-  //***************************************************************************
-  /// Accumulates values.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename T>
-  ETL_CONSTEXPR14 
-  T accumulate(TIterator first, TIterator last, T sum)
-  {
-    while (first != last)
-    {
-      sum = etl::move(sum) + *first;
-      ++first;
+        *(first + j) = ETL_MOVE(temp);
+      }
+
+      return result;
     }
-      
-    return sum;
-  }
-
-  //***************************************************************************
-  /// Accumulates values.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename T, typename TBinaryOperation>
-  ETL_CONSTEXPR14 
-  T accumulate(TIterator first, TIterator last, T sum, TBinaryOperation operation)
-  {
-    while (first != last)
+#else
+    //*********************************
+    // For random access iterators
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type
+      rotate_general(TIterator first, TIterator middle, TIterator last)
     {
-      sum = operation(etl::move(sum), *first);
-      ++first;
+      if (first == middle || middle == last)
+      {
+        return first;
+      }
+
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      int n = last - first;
+      int m = middle - first;
+      int gcd_nm = (n == 0 || m == 0) ? n + m : etl::gcd(n, m);
+
+      TIterator result = first + (last - middle);
+
+      for (int i = 0; i < gcd_nm; i++)
+      {
+        value_type temp = *(first + i);
+        int j = i;
+
+        while (true)
+        {
+          int k = j + m;
+
+          if (k >= n)
+          {
+            k = k - n;
+          }
+
+          if (k == i)
+          {
+            break;
+          }
+
+          *(first + j) = *(first + k);
+          j = k;
+        }
+
+        *(first + j) = temp;
+      }
+
+      return result;
     }
+#endif
 
-    return sum;
-  }
+    //*********************************
+    // For bidirectional iterators
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_bidirectional_iterator<TIterator>::value, TIterator>::type
+      rotate_general(TIterator first, TIterator middle, TIterator last)
+    {
+      if (first == middle || middle == last)
+      {
+        return first;
+      }
 
-  //***************************************************************************
-  /// Clamp values.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template<typename T, typename TCompare>
-  ETL_CONSTEXPR 
-  const T& clamp(const T& value, const T& low, const T& high, TCompare compare)
-  {
-    return compare(value, low) ? low : compare(high, value) ? high : value;
-  }
-  
-  template <typename T>
-  ETL_CONSTEXPR 
-  const T& clamp(const T& value, const T& low, const T& high )
-  {
-    return clamp(value, low, high, etl::less<T>());
-  }
+      TIterator result = first;
+      etl::advance(result, etl::distance(middle, last));
 
-  //***************************************************************************
-  /// Remove
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename T>
-  ETL_CONSTEXPR14
-  TIterator remove(TIterator first, TIterator last, const T& value)
-  {    
-    first = etl::find(first, last, value);
+      etl::reverse(first, middle);
+      etl::reverse(middle, last);
+      etl::reverse(first, last);
 
-    if (first != last)
+      return result;
+    }
+
+    //*********************************
+    // For forward iterators
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_forward_iterator<TIterator>::value, TIterator>::type
+      rotate_general(TIterator first, TIterator middle, TIterator last)
     {
-      TIterator itr = first;
+      if (first == middle || middle == last)
+      {
+        return first;
+      }
 
-      while (++itr != last)
+      TIterator next = middle;
+      TIterator result = first;
+      etl::advance(result, etl::distance(middle, last));
+
+      while (first != next)
       {
-        if (!(*itr == value))
+        using ETL_OR_STD::swap;
+        swap(*first++, *next++);
+
+        if (next == last)
         {
-          *first++ = etl::move(*itr);
+          next = middle;
+        }
+        else if (first == middle)
+        {
+          middle = next;
         }
       }
+
+      return result;
+    }
+
+    //*********************************
+    // Simplified algorithm for rotate left by one
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    TIterator rotate_left_by_one(TIterator first, TIterator last)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      // Save the first item.
+      value_type temp(ETL_MOVE(*first));
+
+      // Move the rest.
+      TIterator result = etl::move(etl::next(first), last, first);
+
+      // Restore the first item in its rotated position.
+      *result = ETL_MOVE(temp);
+
+      // The new position of the first item.
+      return result;
+    }
+
+    //*********************************
+    // Simplified for algorithm rotate right by one
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    TIterator rotate_right_by_one(TIterator first, TIterator last)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      // Save the last item.
+      TIterator previous = etl::prev(last);
+      value_type temp(ETL_MOVE(*previous));
+
+      // Move the rest.
+      TIterator result = etl::move_backward(first, previous, last);
+
+      // Restore the last item in its rotated position.
+      *first = ETL_MOVE(temp);
+
+      // The new position of the first item.
+      return result;
     }
-      
-    return first;
   }
 
-  //***************************************************************************
-  /// Remove If
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  //*********************************
+  template<typename TIterator>
   ETL_CONSTEXPR14
-  TIterator remove_if(TIterator first, TIterator last, TUnaryPredicate predicate)
+  TIterator rotate(TIterator first, TIterator middle, TIterator last)
   {
-    first = etl::find_if(first, last, predicate);
-
-    if (first != last)
+    if (etl::next(first) == middle)
     {
-      TIterator itr = first;
+      return private_algorithm::rotate_left_by_one(first, last);
+    }
 
-      while (++itr != last)
+    if (etl::next(middle) == last)
+    {
+#if ETL_USING_CPP20
+      if ETL_IF_CONSTEXPR(etl::is_forward_iterator<TIterator>::value)
       {
-        if (!predicate(*itr))
-        {
-          *first++ = etl::move(*itr);
-        }
+        return private_algorithm::rotate_general(first, middle, last);
+      }
+      else
+      {
+        return private_algorithm::rotate_right_by_one(first, last);
       }
+#else
+      return private_algorithm::rotate_general(first, middle, last);
+#endif
     }
 
-    return first; 
+    return private_algorithm::rotate_general(first, middle, last);
   }
-}
 
-//*****************************************************************************
-// ETL extensions to the STL algorithms.
-//*****************************************************************************
-namespace etl
-{
   //***************************************************************************
-  /// copy_s
-  /// A safer form of copy where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
-  ///\ingroup algorithm
+  // find_end
   //***************************************************************************
-  template <typename TInputIterator,
-            typename TOutputIterator>
+  // Predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  typename etl::enable_if<etl::is_random_iterator<TInputIterator>::value &&
-                          etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
-   copy_s(TInputIterator  i_begin,
-          TInputIterator  i_end,
-          TOutputIterator o_begin,
-          TOutputIterator o_end)
+  TIterator1 find_end(TIterator1 b, TIterator1 e,
+                      TIterator2 sb, TIterator2 se,
+                      TPredicate predicate)
   {
-      size_t s_size = etl::distance(i_begin, i_end);
-      size_t d_size = etl::distance(o_begin, o_end);
-      size_t size   = (s_size < d_size) ? s_size : d_size;
+    if (sb == se)
+    {
+      return e;
+    }
 
-      return etl::copy(i_begin, i_begin + size, o_begin);
-  }
+    TIterator1 result = e;
 
-  //***************************************************************************
-  /// copy
-  /// A safer form of copy where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for non random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator,
-            typename TOutputIterator>
-  ETL_CONSTEXPR14
-  typename etl::enable_if<!etl::is_random_iterator<TInputIterator>::value ||
-                          !etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
-   copy_s(TInputIterator  i_begin,
-          TInputIterator  i_end,
-          TOutputIterator o_begin,
-          TOutputIterator o_end)
-  {
-    while ((i_begin != i_end) && (o_begin != o_end))
+    while (true)
     {
-      *o_begin = *i_begin;
-      ++o_begin;
-      ++i_begin;
-    }
+      TIterator1 new_result = etl::search(b, e, sb, se, predicate);
 
-    return o_begin;
+      if (new_result == e)
+      {
+        break;
+      }
+      else
+      {
+        result = new_result;
+        b = result;
+        ++b;
+      }
+    }
+    return result;
   }
 
-  //***************************************************************************
-  /// copy_n
-  /// A safer form of copy_n where the smallest of the two ranges is used.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator,
-            typename TSize,
-            typename TOutputIterator>
+  // Default
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  TOutputIterator copy_n_s(TInputIterator  i_begin,
-                           TSize           n,
-                           TOutputIterator o_begin,
-                           TOutputIterator o_end)
+  TIterator1 find_end(TIterator1 b, TIterator1 e,
+                      TIterator2 sb, TIterator2 se)
   {
-    while ((n-- > 0) && (o_begin != o_end))
-    {
-      *o_begin = *i_begin;
-      ++o_begin;
-      ++i_begin;
-    }
+    typedef etl::equal_to<typename etl::iterator_traits<TIterator1>::value_type> predicate;
 
-    return o_begin;
+    return find_end(b, e, sb, se, predicate());
   }
 
   //***************************************************************************
-  /// copy_n
-  /// A safer form of copy_n where the smallest of the two ranges is used.
+  /// Finds the iterator to the smallest element in the range (begin, end).<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator,
-            typename TSize1,
-            typename TOutputIterator,
-            typename TSize2>
+  template <typename TIterator, typename TCompare>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  TOutputIterator copy_n_s(TInputIterator  i_begin,
-                           TSize1          n1,
-                           TOutputIterator o_begin,
-                           TSize2          n2)
+  TIterator min_element(TIterator begin,
+                        TIterator end,
+                        TCompare  compare)
   {
-    while ((n1-- > 0) && (n2-- > 0))
+    if (begin == end)
     {
-      *o_begin = *i_begin;
-      ++o_begin;
-      ++i_begin;
+      return end;
     }
 
-    return o_begin;
-  }
+    TIterator minimum = begin;
+    ++begin;
 
-  //***************************************************************************
-  /// copy_if
-  /// A safer form of copy_if where it terminates when the first end iterator is reached.
-  /// There is currently no STL equivalent.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator,
-            typename TOutputIterator,
-            typename TUnaryPredicate>
-  ETL_CONSTEXPR14
-  TOutputIterator copy_if_s(TInputIterator  i_begin,
-                            TInputIterator  i_end,
-                            TOutputIterator o_begin,
-                            TOutputIterator o_end,
-                            TUnaryPredicate predicate)
-  {
-    while ((i_begin != i_end) && (o_begin != o_end))
+    while (begin != end)
     {
-      if (predicate(*i_begin))
+      if (compare(*begin, *minimum))
       {
-        *o_begin = *i_begin;
-        ++o_begin;
+        minimum = begin;
       }
 
-      ++i_begin;
+      ++begin;
     }
 
-    return o_begin;
+    return minimum;
   }
 
-  //***************************************************************************
-  /// copy_n_if
-  /// Combination of copy_n and copy_if.
-  ///\ingroup algorithm
-    //***************************************************************************
-  template <typename TInputIterator,
-            typename TSize,
-            typename TOutputIterator,
-            typename TUnaryPredicate>
-  ETL_CONSTEXPR14
-  TOutputIterator copy_n_if(TInputIterator  i_begin,
-                            TSize           n,
-                            TOutputIterator o_begin,
-                            TUnaryPredicate predicate)
+  namespace private_algorithm
   {
-    while (n-- > 0)
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<is_block_range<TIterator>::value, TIterator>::type
+      min_element_dispatch(TIterator begin, TIterator end)
     {
-      if (predicate(*i_begin))
+      if (begin == end)
       {
-        *o_begin = *i_begin;
-        ++o_begin;
+        return end;
       }
 
-      ++i_begin;
+      return find_blocks(begin, end, min_value_blocks(begin, end));
     }
 
-    return o_begin;
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<!is_block_range<TIterator>::value, TIterator>::type
+      min_element_dispatch(TIterator begin, TIterator end)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      return etl::min_element(begin, end, etl::less<value_t>());
+    }
   }
 
-#if ETL_USING_CPP11
   //***************************************************************************
-  /// move_s
-  /// A safer form of move where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
+  /// min_element
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
   //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator>
+  template <typename TIterator>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  typename etl::enable_if<etl::is_random_iterator<TInputIterator>::value &&
-                          etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
-  move_s(TInputIterator  i_begin,
-         TInputIterator  i_end,
-         TOutputIterator o_begin,
-         TOutputIterator o_end)
+  TIterator min_element(TIterator begin,
+                        TIterator end)
   {
-    size_t s_size = etl::distance(i_begin, i_end);
-    size_t d_size = etl::distance(o_begin, o_end);
-    size_t size = (s_size < d_size) ? s_size : d_size;
-
-    return etl::move(i_begin, i_begin + size, o_begin);
+    return private_algorithm::min_element_dispatch(begin, end);
   }
 
   //***************************************************************************
-  /// move_s
-  /// A safer form of move where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for non random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
+  /// Finds the iterator to the largest element in the range (begin, end).<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator>
+  template <typename TIterator, typename TCompare>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  typename etl::enable_if<!etl::is_random_iterator<TInputIterator>::value ||
-                          !etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
-  move_s(TInputIterator  i_begin,
-         TInputIterator  i_end,
-         TOutputIterator o_begin,
-         TOutputIterator o_end)
+  TIterator max_element(TIterator begin,
+                        TIterator end,
+                        TCompare  compare)
   {
-    while ((i_begin != i_end) && (o_begin != o_end))
+    if (begin == end)
     {
-      *o_begin = etl::move(*i_begin);
-      ++i_begin;
-      ++o_begin;
+      return end;
     }
 
-    return o_begin;
+    TIterator maximum = begin;
+    ++begin;
+
+    while (begin != end)
+    {
+      if (!compare(*begin, *maximum))
+      {
+        maximum = begin;
+      }
+
+      ++begin;
+    }
+
+    return maximum;
   }
-#else
-  //***************************************************************************
-  /// move_s
-  /// C++03
-  /// A safer form of move where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for non random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator>
-  TOutputIterator move_s(TInputIterator  i_begin,
-                         TInputIterator  i_end,
-                         TOutputIterator o_begin,
-                         TOutputIterator o_end)
+
+  namespace private_algorithm
   {
-    // Move not supported. Defer to copy.
-    return etl::copy_s(i_begin, i_end, o_begin, o_end);
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<is_block_range<TIterator>::value, TIterator>::type
+      max_element_dispatch(TIterator begin, TIterator end)
+    {
+      if (begin == end)
+      {
+        return end;
+      }
+
+      // The last of the greatest, as for the generic version.
+      return find_last_present_blocks(begin, end, max_value_blocks(begin, end));
+    }
+
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<!is_block_range<TIterator>::value, TIterator>::type
+      max_element_dispatch(TIterator begin, TIterator end)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      return etl::max_element(begin, end, etl::less<value_t>());
+    }
   }
-#endif
 
   //***************************************************************************
-  /// binary_find
+  /// max_element
   ///\ingroup algorithm
-  /// Does a binary search and returns an iterator to the value or end if not found.
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
   //***************************************************************************
-  template <typename TIterator, typename TValue>
+  template <typename TIterator>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator binary_find(TIterator     begin,
-                        TIterator     end,
-                        const TValue& value)
+  TIterator max_element(TIterator begin,
+                        TIterator end)
   {
-    TIterator it = etl::lower_bound(begin, end, value);
+    return private_algorithm::max_element_dispatch(begin, end);
+  }
 
-    if ((it == end) || (*it != value))
+  //***************************************************************************
+  /// Finds the greatest and the smallest element in the range (begin, end).<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin,
+                                                        TIterator end,
+                                                        TCompare  compare)
+  {
+    if (begin == end)
     {
-      it = end;
+      return ETL_OR_STD::pair<TIterator, TIterator>(end, end);
     }
 
-    return it;
+    TIterator minimum = begin;
+    TIterator maximum = begin;
+    ++begin;
+
+    while (begin != end)
+    {
+      if (compare(*begin, *minimum))
+      {
+        minimum = begin;
+      }
+
+      if (compare(*maximum, *begin))
+      {
+        maximum = begin;
+      }
+
+      ++begin;
+    }
+
+    return ETL_OR_STD::pair<TIterator, TIterator>(minimum, maximum);
+  }
+
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<is_block_range<TIterator>::value, ETL_OR_STD::pair<TIterator, TIterator> >::type
+      minmax_element_dispatch(TIterator begin, TIterator end)
+    {
+      if (begin == end)
+      {
+        return ETL_OR_STD::pair<TIterator, TIterator>(end, end);
+      }
+
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      const value_t minimum = min_value_blocks(begin, end);
+      const value_t maximum = max_value_blocks(begin, end);
+
+      return ETL_OR_STD::pair<TIterator, TIterator>(find_blocks(begin, end, minimum), find_blocks(begin, end, maximum));
+    }
+
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<!is_block_range<TIterator>::value, ETL_OR_STD::pair<TIterator, TIterator> >::type
+      minmax_element_dispatch(TIterator begin, TIterator end)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      return etl::minmax_element(begin, end, etl::less<value_t>());
+    }
   }
 
   //***************************************************************************
-  /// binary_find
+  /// minmax_element
   ///\ingroup algorithm
-  /// Does a binary search and returns an iterator to the value or end if not found.
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
   //***************************************************************************
-  template <typename TIterator,
-            typename TValue,
-            typename TBinaryPredicate,
-            typename TBinaryEquality>
+  template <typename TIterator>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator binary_find(TIterator        begin,
-                        TIterator        end,
-                        const TValue&    value,
-                        TBinaryPredicate predicate,
-                        TBinaryEquality  equality)
+  ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin,
+                                                        TIterator end)
   {
-    TIterator it = etl::lower_bound(begin, end, value, predicate);
+    return private_algorithm::minmax_element_dispatch(begin, end);
+  }
 
-    if ((it == end) || !equality(*it, value))
-    {
-      it = end;
-    }
+  //***************************************************************************
+  /// minmax
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<const T&, const T&> minmax(const T& a,
+                                              const T& b)
+  {
+    return (b < a) ? ETL_OR_STD::pair<const T&, const T&>(b, a) : ETL_OR_STD::pair<const T&, const T&>(a, b);
+  }
 
-    return it;
+  //***************************************************************************
+  /// minmax
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
+  //***************************************************************************
+  template <typename T, typename TCompare>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<const T&, const T&> minmax(const T& a,
+                                              const T& b,
+                                              TCompare compare)
+  {
+    return compare(b, a) ? ETL_OR_STD::pair<const T&, const T&>(b, a) : ETL_OR_STD::pair<const T&, const T&>(a, b);
   }
 
   //***************************************************************************
-  /// Like std::for_each but applies a predicate before calling the function.
+  /// is_sorted_until
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
   //***************************************************************************
-  template <typename TIterator,
-            typename TUnaryFunction,
-            typename TUnaryPredicate>
+  template <typename TIterator>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  TUnaryFunction for_each_if(TIterator       begin,
-                             const TIterator end,
-                             TUnaryFunction  function,
-                             TUnaryPredicate predicate)
+  TIterator is_sorted_until(TIterator begin,
+                            TIterator end)
   {
-    while (begin != end)
+    if (begin != end)
     {
-      if (predicate(*begin))
+      TIterator next = begin;
+
+      while (++next != end)
       {
-        function(*begin);
-      }
+        if (*next < *begin)
+        {
+          return next;
+        }
 
-      ++begin;
+        ++begin;
+      }
     }
 
-    return function;
+    return end;
   }
 
   //***************************************************************************
-  /// Like std::for_each but for 'n' iterations.
+  /// is_sorted_until
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
   //***************************************************************************
-  template <typename TIterator,
-            typename TSize,
-            typename TUnaryFunction>
+  template <typename TIterator, typename TCompare>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator for_each_n(TIterator       begin,
-                       TSize           n,
-                       TUnaryFunction  function)
+  TIterator is_sorted_until(TIterator begin,
+                            TIterator end,
+                            TCompare  compare)
   {
-    while (n-- > 0)
+    if (begin != end)
     {
-      function(*begin);
-      ++begin;
+      TIterator next = begin;
+
+      while (++next != end)
+      {
+        if (compare(*next, *begin))
+        {
+          return next;
+        }
+
+        ++begin;
+      }
     }
 
-    return begin;
+    return end;
   }
 
   //***************************************************************************
-  /// Like std::for_each but applies a predicate before calling the function, for 'n' iterations
+  /// is_sorted
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
   //***************************************************************************
-  template <typename TIterator,
-            typename TSize,
-            typename TUnaryFunction,
-            typename TUnaryPredicate>
+  template<typename TIterator>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  TIterator for_each_n_if(TIterator       begin,
-                          TSize           n,
-                          TUnaryFunction  function,
-                          TUnaryPredicate predicate)
+  bool is_sorted(TIterator begin,
+                 TIterator end)
   {
-    while (n-- > 0)
-    {
-      if (predicate(*begin))
-      {
-        function(*begin);
-      }
-
-      ++begin;
-    }
+    return etl::is_sorted_until(begin, end) == end;
+  }
 
-    return begin;
+  //***************************************************************************
+  /// is_sorted
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
+  //***************************************************************************
+  template<typename TIterator, typename TCompare>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool is_sorted(TIterator begin,
+                 TIterator end,
+                 TCompare  compare)
+  {
+    return etl::is_sorted_until(begin, end, compare) == end;
   }
 
   //***************************************************************************
-  /// A safer form of std::transform where the transform returns when the first
-  /// range end is reached.
-  /// There is currently no STL equivalent.
+  /// find_if_not
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/find"></a>
   //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction>
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  TOutputIterator transform_s(TInputIterator  i_begin,
-                              TInputIterator  i_end,
-                              TOutputIterator o_begin,
-                              TOutputIterator o_end,
-                              TUnaryFunction  function)
+  TIterator find_if_not(TIterator       begin,
+                        TIterator       end,
+                        TUnaryPredicate predicate)
   {
-    while ((i_begin != i_end) && (o_begin != o_end))
+    while (begin != end)
     {
-      *o_begin = function(*i_begin);
-      ++i_begin;
-      ++o_begin;
+      if (!predicate(*begin))
+      {
+        return begin;
+      }
+
+      ++begin;
     }
 
-    return o_begin;
+    return end;
   }
 
   //***************************************************************************
-  /// Transform 'n' items.
-  /// Random iterators.
-  /// There is currently no STL equivalent.
+  /// is_permutation
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TInputIterator,
-            typename TSize,
-            typename TOutputIterator,
-            typename TUnaryFunction>
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
   ETL_CONSTEXPR14
-  void transform_n(TInputIterator  i_begin,
-                   TSize           n,
-                   TOutputIterator o_begin,
-                   TUnaryFunction  function)
-  {
-    TInputIterator i_end(i_begin);
+  bool is_permutation(TIterator1 begin1,
+                      TIterator1 end1,
+                      TIterator2 begin2)
+  {
+    if (begin1 != end1)
+    {
+      TIterator2 end2 = begin2;
+
+      etl::advance(end2, etl::distance(begin1, end1));
+
+      for (TIterator1 i = begin1; i != end1; ++i)
+      {
+        if (i == etl::find(begin1, i, *i))
+        {
+          size_t n = etl::count(begin2, end2, *i);
+
+          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// is_permutation
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool is_permutation(TIterator1       begin1,
+                      TIterator1       end1,
+                      TIterator2       begin2,
+                      TBinaryPredicate predicate)
+  {
+    if (begin1 != end1)
+    {
+      TIterator2 end2 = begin2;
+
+      etl::advance(end2, etl::distance(begin1, end1));
+
+      for (TIterator1 i = begin1; i != end1; ++i)
+      {
+        if (i == etl::find_if(begin1, i, etl::bind1st(predicate, *i)))
+        {
+          size_t n = etl::count(begin2, end2, *i);
+
+          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// is_permutation
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool is_permutation(TIterator1 begin1,
+                      TIterator1 end1,
+                      TIterator2 begin2,
+                      TIterator2 end2)
+  {
+    if (begin1 != end1)
+    {
+      for (TIterator1 i = begin1; i != end1; ++i)
+      {
+        if (i == etl::find(begin1, i, *i))
+        {
+          size_t n = etl::count(begin2, end2, *i);
+
+          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// is_permutation
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
+  ETL_NODISCARD
+  bool is_permutation(TIterator1       begin1,
+                      TIterator1       end1,
+                      TIterator2       begin2,
+                      TIterator2       end2,
+                      TBinaryPredicate predicate)
+  {
+    if (begin1 != end1)
+    {
+      for (TIterator1 i = begin1; i != end1; ++i)
+      {
+        if (i == etl::find_if(begin1, i, etl::bind1st(predicate, *i)))
+        {
+          size_t n = etl::count(begin2, end2, *i);
+
+          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// is_partitioned
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_partitioned"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool is_partitioned(TIterator       begin,
+                      TIterator       end,
+                      TUnaryPredicate predicate)
+  {
+    while (begin != end)
+    {
+      if (!predicate(*begin))
+      {
+        break;
+      }
+
+      ++begin;
+    }
+
+    while (begin != end)
+    {
+      if (predicate(*begin))
+      {
+        return false;
+      }
+
+      ++begin;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// partition_point
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_point"></a>
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator partition_point(TIterator       begin,
+                            TIterator       end,
+                            TUnaryPredicate predicate)
+  {
+    while (begin != end)
+    {
+      if (!predicate(*begin))
+      {
+        return begin;
+      }
+
+      ++begin;
+    }
+
+    return begin;
+  }
+
+  //***************************************************************************
+  /// Copies the elements from the range (begin, end) to two different ranges
+  /// depending on the value returned by the predicate.<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_copy"></a>
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse, typename TUnaryPredicate>
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_copy(TSource           begin,
+                                                                       TSource           end,
+                                                                       TDestinationTrue  destination_true,
+                                                                       TDestinationFalse destination_false,
+                                                                       TUnaryPredicate   predicate)
+  {
+    while (begin != end)
+    {
+      if (predicate(*begin))
+      {
+        *destination_true = *begin;
+        ++destination_true;
+      }
+      else
+      {
+        *destination_false = *begin;
+        ++destination_false;
+      }
+
+      ++begin;
+    }
+
+    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
+  }
+
+  //***************************************************************************
+  /// copy_if
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/copy"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TOutputIterator, typename TUnaryPredicate>
+  ETL_CONSTEXPR14
+  TOutputIterator copy_if(TIterator       begin,
+                          TIterator       end,
+                          TOutputIterator out,
+                          TUnaryPredicate predicate)
+  {
+    while (begin != end)
+    {
+      if (predicate(*begin))
+      {
+        *out = *begin;
+        ++out;
+      }
+
+      ++begin;
+    }
+
+    return out;
+  }
+
+  //***************************************************************************
+  /// all_of
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool all_of(TIterator       begin,
+              TIterator       end,
+              TUnaryPredicate predicate)
+  {
+    return etl::find_if_not(begin, end, predicate) == end;
+  }
+
+  //***************************************************************************
+  /// any_of
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool any_of(TIterator       begin,
+              TIterator       end,
+              TUnaryPredicate predicate)
+  {
+    return etl::find_if(begin, end, predicate) != end;
+  }
+
+  //***************************************************************************
+  /// none_of
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool none_of(TIterator       begin,
+               TIterator       end,
+               TUnaryPredicate predicate)
+  {
+    return etl::find_if(begin, end, predicate) == end;
+  }
+
+#if ETL_NOT_USING_STL
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(TIterator first, TIterator last, TCompare compare)
+  {
+    private_algorithm::sort_dispatch(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(TIterator first, TIterator last)
+  {
+    private_algorithm::sort_dispatch(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    etl::merge_sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void stable_sort(TIterator first, TIterator last)
+  {
+    etl::merge_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+#else
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(TIterator first, TIterator last, TCompare compare)
+  {
+    std::sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(TIterator first, TIterator last)
+  {
+    std::sort(first, last);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    std::stable_sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void stable_sort(TIterator first, TIterator last)
+  {
+    std::stable_sort(first, last);
+  }
+#endif
+
+  //***************************************************************************
+  /// Accumulates values.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  ETL_CONSTEXPR14 
+  T accumulate(TIterator first, TIterator last, T sum)
+  {
+    while (first != last)
+    {
+      sum = etl::move(sum) + *first;
+      ++first;
+    }
+      
+    return sum;
+  }
+
+  //***************************************************************************
+  /// Accumulates values.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  ETL_CONSTEXPR14 
+  T accumulate(TIterator first, TIterator last, T sum, TBinaryOperation operation)
+  {
+    while (first != last)
+    {
+      sum = operation(etl::move(sum), *first);
+      ++first;
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  /// Clamp values.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template<typename T, typename TCompare>
+  ETL_CONSTEXPR 
+  const T& clamp(const T& value, const T& low, const T& high, TCompare compare)
+  {
+    return compare(value, low) ? low : compare(high, value) ? high : value;
+  }
+  
+  template <typename T>
+  ETL_CONSTEXPR 
+  const T& clamp(const T& value, const T& low, const T& high )
+  {
+    return clamp(value, low, high, etl::less<T>());
+  }
+
+  //***************************************************************************
+  /// Remove
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  ETL_CONSTEXPR14
+  TIterator remove(TIterator first, TIterator last, const T& value)
+  {    
+    first = etl::find(first, last, value);
+
+    if (first != last)
+    {
+      TIterator itr = first;
+
+      while (++itr != last)
+      {
+        if (!(*itr == value))
+        {
+          *first++ = etl::move(*itr);
+        }
+      }
+    }
+      
+    return first;
+  }
+
+  //***************************************************************************
+  /// Remove If
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_CONSTEXPR14
+  TIterator remove_if(TIterator first, TIterator last, TUnaryPredicate predicate)
+  {
+    first = etl::find_if(first, last, predicate);
+
+    if (first != last)
+    {
+      TIterator itr = first;
+
+      while (++itr != last)
+      {
+        if (!predicate(*itr))
+        {
+          *first++ = etl::move(*itr);
+        }
+      }
+    }
+
+    return first; 
+  }
+}
+
+//*****************************************************************************
+// ETL extensions to the STL algorithms.
+//*****************************************************************************
+namespace etl
+{
+  //***************************************************************************
+  /// copy_s
+  /// A safer form of copy where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TOutputIterator>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_random_iterator<TInputIterator>::value &&
+                          etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
+   copy_s(TInputIterator  i_begin,
+          TInputIterator  i_end,
+          TOutputIterator o_begin,
+          TOutputIterator o_end)
+  {
+      size_t s_size = etl::distance(i_begin, i_end);
+      size_t d_size = etl::distance(o_begin, o_end);
+      size_t size   = (s_size < d_size) ? s_size : d_size;
+
+      return etl::copy(i_begin, i_begin + size, o_begin);
+  }
+
+  //***************************************************************************
+  /// copy
+  /// A safer form of copy where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for non random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TOutputIterator>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<!etl::is_random_iterator<TInputIterator>::value ||
+                          !etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
+   copy_s(TInputIterator  i_begin,
+          TInputIterator  i_end,
+          TOutputIterator o_begin,
+          TOutputIterator o_end)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      *o_begin = *i_begin;
+      ++o_begin;
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_n
+  /// A safer form of copy_n where the smallest of the two ranges is used.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TSize,
+            typename TOutputIterator>
+  ETL_CONSTEXPR14
+  TOutputIterator copy_n_s(TInputIterator  i_begin,
+                           TSize           n,
+                           TOutputIterator o_begin,
+                           TOutputIterator o_end)
+  {
+    while ((n-- > 0) && (o_begin != o_end))
+    {
+      *o_begin = *i_begin;
+      ++o_begin;
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_n
+  /// A safer form of copy_n where the smallest of the two ranges is used.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TSize1,
+            typename TOutputIterator,
+            typename TSize2>
+  ETL_CONSTEXPR14
+  TOutputIterator copy_n_s(TInputIterator  i_begin,
+                           TSize1          n1,
+                           TOutputIterator o_begin,
+                           TSize2          n2)
+  {
+    while ((n1-- > 0) && (n2-- > 0))
+    {
+      *o_begin = *i_begin;
+      ++o_begin;
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_if
+  /// A safer form of copy_if where it terminates when the first end iterator is reached.
+  /// There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TOutputIterator,
+            typename TUnaryPredicate>
+  ETL_CONSTEXPR14
+  TOutputIterator copy_if_s(TInputIterator  i_begin,
+                            TInputIterator  i_end,
+                            TOutputIterator o_begin,
+                            TOutputIterator o_end,
+                            TUnaryPredicate predicate)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      if (predicate(*i_begin))
+      {
+        *o_begin = *i_begin;
+        ++o_begin;
+      }
+
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_n_if
+  /// Combination of copy_n and copy_if.
+  ///\ingroup algorithm
+    //***************************************************************************
+  template <typename TInputIterator,
+            typename TSize,
+            typename TOutputIterator,
+            typename TUnaryPredicate>
+  ETL_CONSTEXPR14
+  TOutputIterator copy_n_if(TInputIterator  i_begin,
+                            TSize           n,
+                            TOutputIterator o_begin,
+                            TUnaryPredicate predicate)
+  {
+    while (n-- > 0)
+    {
+      if (predicate(*i_begin))
+      {
+        *o_begin = *i_begin;
+        ++o_begin;
+      }
+
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// move_s
+  /// A safer form of move where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_random_iterator<TInputIterator>::value &&
+                          etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
+  move_s(TInputIterator  i_begin,
+         TInputIterator  i_end,
+         TOutputIterator o_begin,
+         TOutputIterator o_end)
+  {
+    size_t s_size = etl::distance(i_begin, i_end);
+    size_t d_size = etl::distance(o_begin, o_end);
+    size_t size = (s_size < d_size) ? s_size : d_size;
+
+    return etl::move(i_begin, i_begin + size, o_begin);
+  }
+
+  //***************************************************************************
+  /// move_s
+  /// A safer form of move where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for non random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<!etl::is_random_iterator<TInputIterator>::value ||
+                          !etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
+  move_s(TInputIterator  i_begin,
+         TInputIterator  i_end,
+         TOutputIterator o_begin,
+         TOutputIterator o_end)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      *o_begin = etl::move(*i_begin);
+      ++i_begin;
+      ++o_begin;
+    }
+
+    return o_begin;
+  }
+#else
+  //***************************************************************************
+  /// move_s
+  /// C++03
+  /// A safer form of move where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for non random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  TOutputIterator move_s(TInputIterator  i_begin,
+                         TInputIterator  i_end,
+                         TOutputIterator o_begin,
+                         TOutputIterator o_end)
+  {
+    // Move not supported. Defer to copy.
+    return etl::copy_s(i_begin, i_end, o_begin, o_end);
+  }
+#endif
+
+  //***************************************************************************
+  /// binary_find
+  ///\ingroup algorithm
+  /// Does a binary search and returns an iterator to the value or end if not found.
+  //***************************************************************************
+  template <typename TIterator, typename TValue>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator binary_find(TIterator     begin,
+                        TIterator     end,
+                        const TValue& value)
+  {
+    TIterator it = etl::lower_bound(begin, end, value);
+
+    if ((it == end) || (*it != value))
+    {
+      it = end;
+    }
+
+    return it;
+  }
+
+  //***************************************************************************
+  /// binary_find
+  ///\ingroup algorithm
+  /// Does a binary search and returns an iterator to the value or end if not found.
+  //***************************************************************************
+  template <typename TIterator,
+            typename TValue,
+            typename TBinaryPredicate,
+            typename TBinaryEquality>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator binary_find(TIterator        begin,
+                        TIterator        end,
+                        const TValue&    value,
+                        TBinaryPredicate predicate,
+                        TBinaryEquality  equality)
+  {
+    TIterator it = etl::lower_bound(begin, end, value, predicate);
+
+    if ((it == end) || !equality(*it, value))
+    {
+      it = end;
+    }
+
+    return it;
+  }
+
+  //***************************************************************************
+  /// Like std::for_each but applies a predicate before calling the function.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator,
+            typename TUnaryFunction,
+            typename TUnaryPredicate>
+  ETL_CONSTEXPR14
+  TUnaryFunction for_each_if(TIterator       begin,
+                             const TIterator end,
+                             TUnaryFunction  function,
+                             TUnaryPredicate predicate)
+  {
+    while (begin != end)
+    {
+      if (predicate(*begin))
+      {
+        function(*begin);
+      }
+
+      ++begin;
+    }
+
+    return function;
+  }
+
+  //***************************************************************************
+  /// Like std::for_each but for 'n' iterations.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator,
+            typename TSize,
+            typename TUnaryFunction>
+  ETL_CONSTEXPR14
+  TIterator for_each_n(TIterator       begin,
+                       TSize           n,
+                       TUnaryFunction  function)
+  {
+    while (n-- > 0)
+    {
+      function(*begin);
+      ++begin;
+    }
+
+    return begin;
+  }
+
+  //***************************************************************************
+  /// Like std::for_each but applies a predicate before calling the function, for 'n' iterations
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator,
+            typename TSize,
+            typename TUnaryFunction,
+            typename TUnaryPredicate>
+  ETL_CONSTEXPR14
+  TIterator for_each_n_if(TIterator       begin,
+                          TSize           n,
+                          TUnaryFunction  function,
+                          TUnaryPredicate predicate)
+  {
+    while (n-- > 0)
+    {
+      if (predicate(*begin))
+      {
+        function(*begin);
+      }
+
+      ++begin;
+    }
+
+    return begin;
+  }
+
+  //***************************************************************************
+  /// A safer form of std::transform where the transform returns when the first
+  /// range end is reached.
+  /// There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction>
+  ETL_CONSTEXPR14
+  TOutputIterator transform_s(TInputIterator  i_begin,
+                              TInputIterator  i_end,
+                              TOutputIterator o_begin,
+                              TOutputIterator o_end,
+                              TUnaryFunction  function)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      *o_begin = function(*i_begin);
+      ++i_begin;
+      ++o_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Transform 'n' items.
+  /// Random iterators.
+  /// There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TSize,
+            typename TOutputIterator,
+            typename TUnaryFunction>
+  ETL_CONSTEXPR14
+  void transform_n(TInputIterator  i_begin,
+                   TSize           n,
+                   TOutputIterator o_begin,
+                   TUnaryFunction  function)
+  {
+    TInputIterator i_end(i_begin);
     etl::advance(i_end, n);
 
-    etl::transform(i_begin, i_end, o_begin, function);
+    etl::transform(i_begin, i_end, o_begin, function);
+  }
+
+  //***************************************************************************
+  /// Transform 'n' items from two ranges.
+  /// Random iterators.
+  /// There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1,
+            typename TInputIterator2,
+            typename TSize,
+            typename TOutputIterator,
+            typename TBinaryFunction>
+  ETL_CONSTEXPR14
+  void transform_n(TInputIterator1 i_begin1,
+                   TInputIterator2 i_begin2,
+                   TSize           n,
+                   TOutputIterator o_begin,
+                   TBinaryFunction function)
+  {
+    TInputIterator1 i_end1(i_begin1);
+    etl::advance(i_end1, n);
+
+    etl::transform(i_begin1, i_end1, i_begin2, o_begin, function);
+  }
+
+  //***************************************************************************
+  /// Like std::transform but applies a predicate before calling the function.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TOutputIterator,
+            typename TUnaryFunction,
+            typename TUnaryPredicate>
+  ETL_CONSTEXPR14
+  TOutputIterator transform_if(TInputIterator       i_begin,
+                               const TInputIterator i_end,
+                               TOutputIterator      o_begin,
+                               TUnaryFunction       function,
+                               TUnaryPredicate      predicate)
+  {
+    while (i_begin != i_end)
+    {
+      if (predicate(*i_begin))
+      {
+        *o_begin = function(*i_begin);
+        ++o_begin;
+      }
+
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Like etl::transform_if but inputs from two ranges.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1,
+            typename TInputIterator2,
+            typename TOutputIterator,
+            typename TBinaryFunction,
+            typename TBinaryPredicate>
+  ETL_CONSTEXPR14
+  TOutputIterator transform_if(TInputIterator1       i_begin1,
+                               const TInputIterator1 i_end1,
+                               TInputIterator2       i_begin2,
+                               TOutputIterator       o_begin,
+                               TBinaryFunction       function,
+                               TBinaryPredicate      predicate)
+  {
+    while (i_begin1 != i_end1)
+    {
+      if (predicate(*i_begin1, *i_begin2))
+      {
+        *o_begin = function(*i_begin1, *i_begin2);
+        ++o_begin;
+      }
+
+      ++i_begin1;
+      ++i_begin2;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Like std::transform_if, for 'n' items.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TSize,
+            typename TOutputIterator,
+            typename TUnaryFunction,
+            typename TUnaryPredicate>
+  ETL_CONSTEXPR14
+  TOutputIterator transform_n_if(TInputIterator  i_begin,
+                                 TSize           n,
+                                 TOutputIterator o_begin,
+                                 TUnaryFunction  function,
+                                 TUnaryPredicate predicate)
+  {
+    while (n-- > 0)
+    {
+      if (predicate(*i_begin))
+      {
+        *o_begin = function(*i_begin);
+        ++o_begin;
+      }
+
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Like etl::transform_if but inputs from two ranges for 'n' items.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1,
+            typename TInputIterator2,
+            typename TSize,
+            typename TOutputIterator,
+            typename TBinaryFunction,
+            typename TBinaryPredicate>
+  ETL_CONSTEXPR14
+  TOutputIterator transform_n_if(TInputIterator1  i_begin1,
+                                 TInputIterator2  i_begin2,
+                                 TSize            n,
+                                 TOutputIterator  o_begin,
+                                 TBinaryFunction  function,
+                                 TBinaryPredicate predicate)
+  {
+    while (n-- > 0)
+    {
+      if (predicate(*i_begin1, *i_begin2))
+      {
+        *o_begin++ = function(*i_begin1, *i_begin2);
+      }
+
+      ++i_begin1;
+      ++i_begin2;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Transforms the elements from the range (begin, end) to two different ranges
+  /// depending on the value returned by the predicate.<br>
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse,
+            typename TUnaryFunctionTrue, typename TUnaryFunctionFalse,
+            typename TUnaryPredicate>
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_transform(TSource             begin,
+                                                                            TSource             end,
+                                                                            TDestinationTrue    destination_true,
+                                                                            TDestinationFalse   destination_false,
+                                                                            TUnaryFunctionTrue  function_true,
+                                                                            TUnaryFunctionFalse function_false,
+                                                                            TUnaryPredicate     predicate)
+  {
+    while (begin != end)
+    {
+      if (predicate(*begin))
+      {
+        *destination_true = function_true(*begin);
+        ++destination_true;
+      }
+      else
+      {
+        *destination_false = function_false(*begin);
+        ++destination_false;
+      }
+
+      ++begin;
+    }
+
+    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
+  }
+
+  //***************************************************************************
+  /// Transforms the elements from the ranges (begin1, end1) & (begin2)
+  /// to two different ranges depending on the value returned by the predicate.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TSource1,
+            typename TSource2,
+            typename TDestinationTrue,
+            typename TDestinationFalse,
+            typename TBinaryFunctionTrue,
+            typename TBinaryFunctionFalse,
+            typename TBinaryPredicate>
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_transform(TSource1             begin1,
+                                                                            TSource1             end1,
+                                                                            TSource2             begin2,
+                                                                            TDestinationTrue     destination_true,
+                                                                            TDestinationFalse    destination_false,
+                                                                            TBinaryFunctionTrue  function_true,
+                                                                            TBinaryFunctionFalse function_false,
+                                                                            TBinaryPredicate     predicate)
+  {
+    while (begin1 != end1)
+    {
+      if (predicate(*begin1, *begin2))
+      {
+        *destination_true = function_true(*begin1, *begin2);
+        ++destination_true;
+      }
+      else
+      {
+        *destination_false = function_false(*begin1, *begin2);
+        ++destination_false;
+      }
+
+      ++begin1;
+      ++begin2;
+    }
+
+    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using shell sort.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void shell_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    if (first == last)
+    {
+      return;
+    }
+
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t n = etl::distance(first, last);
+
+    for (difference_t i = n / 2; i > 0; i /= 2)
+    {
+      for (difference_t j = i; j < n; ++j)
+      {
+        for (difference_t k = j - i; k >= 0; k -= i)
+        {
+          TIterator itr1 = first;
+          TIterator itr2 = first;
+
+          etl::advance(itr1, k);
+          etl::advance(itr2, k + i);
+
+          if (compare(*itr2, *itr1))
+          {
+            etl::iter_swap(itr1, itr2);
+          }
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using shell sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void shell_sort(TIterator first, TIterator last)
+  {
+    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using insertion sort.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  void insertion_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    for (TIterator itr = first; itr != last; ++itr)
+    {
+      etl::rotate(etl::upper_bound(first, itr, *itr, compare), itr, etl::next(itr));
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using insertion sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  ETL_CONSTEXPR14
+  void insertion_sort(TIterator first, TIterator last)
+  {
+    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_forward_iterator<TIterator>::value, TIterator>::type
+      get_before_last(TIterator first_, TIterator last_)
+    {
+      TIterator last      = first_;
+      TIterator lastplus1 = first_;
+      ++lastplus1;
+
+      while (lastplus1 != last_)
+      {
+        ++last;
+        ++lastplus1;
+      }
+
+      return last;
+    }
+
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_bidirectional_iterator<TIterator>::value, TIterator>::type
+      get_before_last(TIterator /*first_*/, TIterator last_)
+    {
+      TIterator last = last_;
+      --last;
+
+      return last;
+    }
+
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type
+      get_before_last(TIterator /*first_*/, TIterator last_)
+    {
+      return last_ - 1;
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using selection sort.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR20
+  void selection_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    TIterator min;
+    const TIterator ilast = private_algorithm::get_before_last(first, last);
+    const TIterator jlast = last;
+
+    for (TIterator i = first; i != ilast; ++i)
+    {
+      min = i;
+      
+      TIterator j = i;
+      ++j;
+
+      for (; j != jlast; ++j)
+      {
+        if (compare(*j, *min))
+        {
+          min = j;
+        }
+      }
+
+      using ETL_OR_STD::swap; // Allow ADL
+      swap(*i, *min);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using selection sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  ETL_CONSTEXPR20
+  void selection_sort(TIterator first, TIterator last)
+  {
+    selection_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using heap sort.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  void heap_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    if (!etl::is_heap(first, last, compare))
+    {
+      etl::make_heap(first, last, compare);
+    }
+
+    etl::sort_heap(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using heap sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  ETL_CONSTEXPR14
+  void heap_sort(TIterator first, TIterator last)
+  {
+    if (!etl::is_heap(first, last))
+    {
+      etl::make_heap(first, last);
+    }
+
+    etl::sort_heap(first, last);
+  }
+
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    /// Partitions smaller than this are sorted by insertion.
+    ETL_CONSTANT ptrdiff_t Intro_Sort_Insertion_Threshold = 24;
+
+    /// Partitions larger than this choose the pivot from a pseudo median of nine.
+    ETL_CONSTANT ptrdiff_t Intro_Sort_Ninther_Threshold = 128;
+
+    /// The number of moves allowed before an optimistic insertion sort gives up.
+    ETL_CONSTANT size_t Intro_Sort_Partial_Insertion_Limit = 8U;
+
+    /// The length of the runs that merge sort sorts by insertion.
+    ETL_CONSTANT ptrdiff_t Merge_Sort_Run_Length = 16;
+
+    //*************************************************************************
+    /// Insertion sort for random access iterators.
+    /// If Guarded is false, there must be an element before first that is not
+    /// greater than any element in the range.
+    //*************************************************************************
+    template <bool Guarded, typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14 void intro_sort_insertion(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        TIterator hole     = itr;
+        TIterator previous = itr - 1;
+
+        if (compare(*hole, *previous))
+        {
+          value_t value = ETL_MOVE(*hole);
+
+          do
+          {
+            *hole = ETL_MOVE(*previous);
+            --hole;
+          } while ((!Guarded || (hole != first)) && compare(value, *--previous));
+
+          *hole = ETL_MOVE(value);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Insertion sort that gives up after a few moves.
+    /// Returns <b>true</b> if the range was sorted.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    bool intro_sort_partial_insertion(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return true;
+      }
+
+      size_t moves = 0U;
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        TIterator hole     = itr;
+        TIterator previous = itr - 1;
+
+        if (compare(*hole, *previous))
+        {
+          value_t value = ETL_MOVE(*hole);
+
+          do
+          {
+            *hole = ETL_MOVE(*previous);
+            --hole;
+          } while ((hole != first) && compare(value, *--previous));
+
+          *hole = ETL_MOVE(value);
+          moves += static_cast<size_t>(itr - hole);
+        }
+
+        if (moves > Intro_Sort_Partial_Insertion_Limit)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Orders two elements.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_order2(TIterator a, TIterator b, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        etl::iter_swap(a, b);
+      }
+    }
+
+    //*************************************************************************
+    /// Orders three elements.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_order3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      intro_sort_order2(a, b, compare);
+      intro_sort_order2(b, c, compare);
+      intro_sort_order2(a, b, compare);
+    }
+
+    //*************************************************************************
+    /// Partitions around the pivot at first. Elements equal to the pivot go
+    /// to the right. Returns the final position of the pivot and whether the
+    /// range was already partitioned.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    ETL_OR_STD::pair<TIterator, bool> intro_sort_partition_right(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      value_t pivot = ETL_MOVE(*first);
+
+      TIterator i = first;
+      TIterator j = last;
+
+      // The median of three guarantees an element not less than the pivot on the right,
+      // so the first search needs no bounds check.
+      while (compare(*++i, pivot))
+      {
+      }
+
+      if ((i - 1) == first)
+      {
+        while ((i < j) && !compare(*--j, pivot))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(*--j, pivot))
+        {
+        }
+      }
+
+      const bool already_partitioned = (i >= j);
+
+      while (i < j)
+      {
+        etl::iter_swap(i, j);
+
+        while (compare(*++i, pivot))
+        {
+        }
+
+        while (!compare(*--j, pivot))
+        {
+        }
+      }
+
+      TIterator pivot_position = i - 1;
+      *first          = ETL_MOVE(*pivot_position);
+      *pivot_position = ETL_MOVE(pivot);
+
+      return ETL_OR_STD::pair<TIterator, bool>(pivot_position, already_partitioned);
+    }
+
+    //*************************************************************************
+    /// Partitions around the pivot at first. Elements equal to the pivot go
+    /// to the left. Used when the pivot equals the element before the range,
+    /// when all of the elements on the left are equal and need no more sorting.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator intro_sort_partition_left(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      value_t pivot = ETL_MOVE(*first);
+
+      TIterator i = first;
+      TIterator j = last;
+
+      while (compare(pivot, *--j))
+      {
+      }
+
+      if ((j + 1) == last)
+      {
+        while ((i < j) && !compare(pivot, *++i))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(pivot, *++i))
+        {
+        }
+      }
+
+      while (i < j)
+      {
+        etl::iter_swap(i, j);
+
+        while (compare(pivot, *--j))
+        {
+        }
+
+        while (!compare(pivot, *++i))
+        {
+        }
+      }
+
+      *first = ETL_MOVE(*j);
+      *j     = ETL_MOVE(pivot);
+
+      return j;
+    }
+
+    //*************************************************************************
+    /// Swaps a few elements of a badly partitioned range, to break up patterns
+    /// that defeat the pivot selection.
+    //*************************************************************************
+    template <typename TIterator>
+    void intro_sort_break_patterns(TIterator first, TIterator last)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = last - first;
+
+      if (length >= Intro_Sort_Insertion_Threshold)
+      {
+        const difference_t quarter = length / 4;
+
+        etl::iter_swap(first, first + quarter);
+        etl::iter_swap(last - 1, last - quarter);
+
+        if (length > Intro_Sort_Ninther_Threshold)
+        {
+          etl::iter_swap(first + 1, first + (quarter + 1));
+          etl::iter_swap(first + 2, first + (quarter + 2));
+          etl::iter_swap(last - 2, last - (quarter + 1));
+          etl::iter_swap(last - 3, last - (quarter + 2));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the pivot to first.
+    /// The median of three, or the pseudo median of nine for longer ranges.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_choose_pivot(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = last - first;
+      const difference_t half   = length / 2;
+
+      if (length > Intro_Sort_Ninther_Threshold)
+      {
+        intro_sort_order3(first,              first + half,       last - 1, compare);
+        intro_sort_order3(first + 1,          first + (half - 1), last - 2, compare);
+        intro_sort_order3(first + 2,          first + (half + 1), last - 3, compare);
+        intro_sort_order3(first + (half - 1), first + half,       first + (half + 1), compare);
+        etl::iter_swap(first, first + half);
+      }
+      else
+      {
+        intro_sort_order3(first + half, first, last - 1, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// The pattern defeating quicksort loop.
+    /// Recurses into the smaller partition, so the stack depth is O(log N).
+    /// Falls back to heap sort after too many unbalanced partitions.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_loop(TIterator first, TIterator last, TCompare compare, int bad_allowed, bool leftmost)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      while (true)
+      {
+        const difference_t length = last - first;
+
+        if (length < Intro_Sort_Insertion_Threshold)
+        {
+          if (leftmost)
+          {
+            intro_sort_insertion<true>(first, last, compare);
+          }
+          else
+          {
+            intro_sort_insertion<false>(first, last, compare);
+          }
+
+          return;
+        }
+
+        intro_sort_choose_pivot(first, last, compare);
+
+        // If the pivot equals the element before the range, then so do all of
+        // the elements not greater than it, and only the rest need sorting.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          first = intro_sort_partition_left(first, last, compare) + 1;
+          continue;
+        }
+
+        ETL_OR_STD::pair<TIterator, bool> partition = intro_sort_partition_right(first, last, compare);
+        TIterator pivot_position = partition.first;
+
+        const difference_t left_length  = pivot_position - first;
+        const difference_t right_length = last - (pivot_position + 1);
+
+        if ((left_length < (length / 8)) || (right_length < (length / 8)))
+        {
+          if (--bad_allowed == 0)
+          {
+            etl::make_heap(first, last, compare);
+            etl::sort_heap(first, last, compare);
+            return;
+          }
+
+          intro_sort_break_patterns(first, pivot_position);
+          intro_sort_break_patterns(pivot_position + 1, last);
+        }
+        else if (partition.second &&
+                 intro_sort_partial_insertion(first, pivot_position, compare) &&
+                 intro_sort_partial_insertion(pivot_position + 1, last, compare))
+        {
+          // The range was already, or nearly, sorted.
+          return;
+        }
+
+        if (left_length < right_length)
+        {
+          intro_sort_loop(first, pivot_position, compare, bad_allowed, leftmost);
+          first    = pivot_position + 1;
+          leftmost = false;
+        }
+        else
+        {
+          intro_sort_loop(pivot_position + 1, last, compare, bad_allowed, false);
+          last = pivot_position;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Merges two adjacent sorted ranges without a buffer, by rotation.
+    //*************************************************************************
+    template <typename TIterator, typename TDifference, typename TCompare>
+    void merge_without_buffer(TIterator first, TIterator middle, TIterator last, TDifference length1, TDifference length2, TCompare compare)
+    {
+      while ((length1 != 0) && (length2 != 0))
+      {
+        if ((length1 + length2) == 2)
+        {
+          if (compare(*middle, *first))
+          {
+            etl::iter_swap(first, middle);
+          }
+
+          return;
+        }
+
+        TIterator   first_cut;
+        TIterator   second_cut;
+        TDifference length11;
+        TDifference length22;
+
+        if (length1 > length2)
+        {
+          length11   = length1 / 2;
+          first_cut  = etl::next(first, length11);
+          second_cut = etl::lower_bound(middle, last, *first_cut, compare);
+          length22   = etl::distance(middle, second_cut);
+        }
+        else
+        {
+          length22   = length2 / 2;
+          second_cut = etl::next(middle, length22);
+          first_cut  = etl::upper_bound(first, middle, *second_cut, compare);
+          length11   = etl::distance(first, first_cut);
+        }
+
+        TIterator new_middle = first_cut;
+
+        if ((first_cut != middle) && (middle != second_cut))
+        {
+          new_middle = etl::rotate(first_cut, middle, second_cut);
+        }
+        else if (first_cut == middle)
+        {
+          new_middle = second_cut;
+        }
+
+        // Recurse into the smaller half.
+        if ((length11 + length22) < ((length1 - length11) + (length2 - length22)))
+        {
+          merge_without_buffer(first, first_cut, new_middle, length11, length22, compare);
+          first   = new_middle;
+          middle  = second_cut;
+          length1 = length1 - length11;
+          length2 = length2 - length22;
+        }
+        else
+        {
+          const TDifference length12 = length1 - length11;
+          const TDifference length21 = length2 - length22;
+
+          merge_without_buffer(new_middle, second_cut, last, length12, length21, compare);
+          middle  = first_cut;
+          last    = new_middle;
+          length1 = length11;
+          length2 = length22;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Merges two adjacent sorted ranges, using the buffer when the first
+    /// range fits in it.
+    //*************************************************************************
+    template <typename TIterator, typename TDifference, typename TBufferIterator, typename TCompare>
+    void merge_with_buffer(TIterator first, TIterator middle, TIterator last, TDifference length1, TDifference length2,
+                           TBufferIterator buffer, TDifference buffer_length, TCompare compare)
+    {
+      while ((length1 != 0) && (length2 != 0))
+      {
+        if (length1 <= buffer_length)
+        {
+          // Move the first range out of the way and merge forwards.
+          TBufferIterator buffer_end = etl::move(first, middle, buffer);
+          TBufferIterator itr        = buffer;
+
+          while ((itr != buffer_end) && (middle != last))
+          {
+            if (compare(*middle, *itr))
+            {
+              *first = ETL_MOVE(*middle);
+              ++middle;
+            }
+            else
+            {
+              *first = ETL_MOVE(*itr);
+              ++itr;
+            }
+
+            ++first;
+          }
+
+          etl::move(itr, buffer_end, first);
+          return;
+        }
+
+        TIterator   first_cut;
+        TIterator   second_cut;
+        TDifference length11;
+        TDifference length22;
+
+        if (length1 > length2)
+        {
+          length11   = length1 / 2;
+          first_cut  = etl::next(first, length11);
+          second_cut = etl::lower_bound(middle, last, *first_cut, compare);
+          length22   = etl::distance(middle, second_cut);
+        }
+        else
+        {
+          length22   = length2 / 2;
+          second_cut = etl::next(middle, length22);
+          first_cut  = etl::upper_bound(first, middle, *second_cut, compare);
+          length11   = etl::distance(first, first_cut);
+        }
+
+        TIterator new_middle = first_cut;
+
+        if ((first_cut != middle) && (middle != second_cut))
+        {
+          new_middle = etl::rotate(first_cut, middle, second_cut);
+        }
+        else if (first_cut == middle)
+        {
+          new_middle = second_cut;
+        }
+
+        merge_with_buffer(first, first_cut, new_middle, length11, length22, buffer, buffer_length, compare);
+
+        first   = new_middle;
+        middle  = second_cut;
+        length1 = length1 - length11;
+        length2 = length2 - length22;
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts a merge sort run.
+    /// The random access insertion sort is stable, as it only moves an element
+    /// past those that compare greater.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      merge_sort_run(TIterator first, TIterator last, TCompare compare)
+    {
+      intro_sort_insertion<true>(first, last, compare);
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      merge_sort_run(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::insertion_sort(first, last, compare);
+    }
+
+    //*************************************************************************
+    /// Bottom up merge sort.
+    /// Runs are sorted by insertion, then merged in passes of doubling width.
+    //*************************************************************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_sort(TIterator first, TIterator last, TBufferIterator buffer, typename etl::iterator_traits<TIterator>::difference_type buffer_length, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = etl::distance(first, last);
+
+      // Sort the runs.
+      TIterator    run       = first;
+      difference_t remaining = length;
+
+      while (remaining > Merge_Sort_Run_Length)
+      {
+        TIterator run_end = etl::next(run, Merge_Sort_Run_Length);
+        merge_sort_run(run, run_end, compare);
+        run        = run_end;
+        remaining -= Merge_Sort_Run_Length;
+      }
+
+      merge_sort_run(run, last, compare);
+
+      // Merge pairs of runs.
+      for (difference_t width = Merge_Sort_Run_Length; width < length; width *= 2)
+      {
+        TIterator    left = first;
+        difference_t left_remaining = length;
+
+        while (left_remaining > width)
+        {
+          const difference_t length1 = width;
+          const difference_t right_remaining = left_remaining - width;
+          const difference_t length2         = etl::min(width, right_remaining);
+
+          TIterator before_middle = etl::next(left, length1 - 1);
+          TIterator middle        = etl::next(before_middle);
+          TIterator right_end     = etl::next(middle, length2);
+
+          // Already in order?
+          if (compare(*middle, *before_middle))
+          {
+            if (buffer_length > 0)
+            {
+              merge_with_buffer(left, middle, right_end, length1, length2, buffer, buffer_length, compare);
+            }
+            else
+            {
+              merge_without_buffer(left, middle, right_end, length1, length2, compare);
+            }
+          }
+
+          left            = right_end;
+          left_remaining -= (length1 + length2);
+        }
+      }
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort_dispatch(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::intro_sort(first, last, compare);
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort_dispatch(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::shell_sort(first, last, compare);
+    }
   }
 
   //***************************************************************************
-  /// Transform 'n' items from two ranges.
-  /// Random iterators.
-  /// There is currently no STL equivalent.
+  /// Sorts the elements using a pattern defeating introsort.
+  /// Quicksort with a median of three, or nine, pivot. Falls back to heap sort
+  /// when the partitions are persistently unbalanced, so is O(N log N) in the
+  /// worst case. Sorted, reversed and many equal elements are O(N).
+  /// Not stable. Does not allocate. Requires random access iterators.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator1,
-            typename TInputIterator2,
-            typename TSize,
-            typename TOutputIterator,
-            typename TBinaryFunction>
-  ETL_CONSTEXPR14
-  void transform_n(TInputIterator1 i_begin1,
-                   TInputIterator2 i_begin2,
-                   TSize           n,
-                   TOutputIterator o_begin,
-                   TBinaryFunction function)
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare)
   {
-    TInputIterator1 i_end1(i_begin1);
-    etl::advance(i_end1, n);
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
 
-    etl::transform(i_begin1, i_end1, i_begin2, o_begin, function);
-  }
+    difference_t length = last - first;
 
-  //***************************************************************************
-  /// Like std::transform but applies a predicate before calling the function.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator,
-            typename TOutputIterator,
-            typename TUnaryFunction,
-            typename TUnaryPredicate>
-  ETL_CONSTEXPR14
-  TOutputIterator transform_if(TInputIterator       i_begin,
-                               const TInputIterator i_end,
-                               TOutputIterator      o_begin,
-                               TUnaryFunction       function,
-                               TUnaryPredicate      predicate)
-  {
-    while (i_begin != i_end)
+    if (length < 2)
     {
-      if (predicate(*i_begin))
-      {
-        *o_begin = function(*i_begin);
-        ++o_begin;
-      }
+      return;
+    }
 
-      ++i_begin;
+    // Allow log2(N) unbalanced partitions before falling back to heap sort.
+    int bad_allowed = 0;
+
+    while (length > 0)
+    {
+      ++bad_allowed;
+      length /= 2;
     }
 
-    return o_begin;
+    private_algorithm::intro_sort_loop(first, last, compare, bad_allowed, true);
   }
 
   //***************************************************************************
-  /// Like etl::transform_if but inputs from two ranges.
+  /// Sorts the elements using a pattern defeating introsort.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator1,
-            typename TInputIterator2,
-            typename TOutputIterator,
-            typename TBinaryFunction,
-            typename TBinaryPredicate>
-  ETL_CONSTEXPR14
-  TOutputIterator transform_if(TInputIterator1       i_begin1,
-                               const TInputIterator1 i_end1,
-                               TInputIterator2       i_begin2,
-                               TOutputIterator       o_begin,
-                               TBinaryFunction       function,
-                               TBinaryPredicate      predicate)
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last)
   {
-    while (i_begin1 != i_end1)
-    {
-      if (predicate(*i_begin1, *i_begin2))
-      {
-        *o_begin = function(*i_begin1, *i_begin2);
-        ++o_begin;
-      }
-
-      ++i_begin1;
-      ++i_begin2;
-    }
-
-    return o_begin;
+    etl::intro_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
-  /// Like std::transform_if, for 'n' items.
+  /// Sorts the elements using an in place merge sort.
+  /// Stable. Does not allocate. O(N log^2 N) in the worst case.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator,
-            typename TSize,
-            typename TOutputIterator,
-            typename TUnaryFunction,
-            typename TUnaryPredicate>
-  ETL_CONSTEXPR14
-  TOutputIterator transform_n_if(TInputIterator  i_begin,
-                                 TSize           n,
-                                 TOutputIterator o_begin,
-                                 TUnaryFunction  function,
-                                 TUnaryPredicate predicate)
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare)
   {
-    while (n-- > 0)
-    {
-      if (predicate(*i_begin))
-      {
-        *o_begin = function(*i_begin);
-        ++o_begin;
-      }
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
-      ++i_begin;
-    }
+    private_algorithm::merge_sort(first, last, static_cast<value_t*>(ETL_NULLPTR), 0, compare);
+  }
 
-    return o_begin;
+  //***************************************************************************
+  /// Sorts the elements using an in place merge sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last)
+  {
+    etl::merge_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
-  /// Like etl::transform_if but inputs from two ranges for 'n' items.
+  /// Sorts the elements using a merge sort, with a scratch buffer.
+  /// Stable. Merges whose first half fits in the buffer are linear, so a
+  /// buffer of half of the range gives O(N log N). Smaller buffers still help.
+  /// The buffer elements are overwritten.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator1,
-            typename TInputIterator2,
-            typename TSize,
-            typename TOutputIterator,
-            typename TBinaryFunction,
-            typename TBinaryPredicate>
-  ETL_CONSTEXPR14
-  TOutputIterator transform_n_if(TInputIterator1  i_begin1,
-                                 TInputIterator2  i_begin2,
-                                 TSize            n,
-                                 TOutputIterator  o_begin,
-                                 TBinaryFunction  function,
-                                 TBinaryPredicate predicate)
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_begin, TBufferIterator buffer_end, TCompare compare)
   {
-    while (n-- > 0)
-    {
-      if (predicate(*i_begin1, *i_begin2))
-      {
-        *o_begin++ = function(*i_begin1, *i_begin2);
-      }
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
 
-      ++i_begin1;
-      ++i_begin2;
-    }
+    const difference_t buffer_length = etl::distance(buffer_begin, buffer_end);
 
-    return o_begin;
+    private_algorithm::merge_sort(first, last, buffer_begin, buffer_length, compare);
   }
 
   //***************************************************************************
-  /// Transforms the elements from the range (begin, end) to two different ranges
-  /// depending on the value returned by the predicate.<br>
+  /// Sorts the elements using a merge sort, with a scratch buffer.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse,
-            typename TUnaryFunctionTrue, typename TUnaryFunctionFalse,
-            typename TUnaryPredicate>
-  ETL_CONSTEXPR14
-  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_transform(TSource             begin,
-                                                                            TSource             end,
-                                                                            TDestinationTrue    destination_true,
-                                                                            TDestinationFalse   destination_false,
-                                                                            TUnaryFunctionTrue  function_true,
-                                                                            TUnaryFunctionFalse function_false,
-                                                                            TUnaryPredicate     predicate)
+  template <typename TIterator, typename TBufferIterator>
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_begin, TBufferIterator buffer_end)
   {
-    while (begin != end)
+    etl::merge_sort(first, last, buffer_begin, buffer_end, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Maps a key to an unsigned integral value with the same ordering.
+    //*************************************************************************
+    template <typename TKey, typename TEnable = void>
+    struct radix_key;
+
+    //*********************************
+    // Unsigned keys are their own radix key.
+    template <typename TKey>
+    struct radix_key<TKey, typename etl::enable_if<etl::is_integral<TKey>::value && etl::is_unsigned<TKey>::value>::type>
     {
-      if (predicate(*begin))
+      typedef TKey type;
+
+      static type get(TKey key)
       {
-        *destination_true = function_true(*begin);
-        ++destination_true;
+        return key;
       }
-      else
+    };
+
+    //*********************************
+    // Signed keys have their sign bit flipped, so that negative values come first.
+    template <typename TKey>
+    struct radix_key<TKey, typename etl::enable_if<etl::is_integral<TKey>::value && etl::is_signed<TKey>::value>::type>
+    {
+      typedef typename etl::make_unsigned<TKey>::type type;
+
+      static type get(TKey key)
       {
-        *destination_false = function_false(*begin);
-        ++destination_false;
+        return static_cast<type>(static_cast<type>(key) ^ (static_cast<type>(1U) << ((CHAR_BIT * sizeof(type)) - 1U)));
       }
+    };
 
-      ++begin;
-    }
+    //*********************************
+    // Floating point keys have all of their bits flipped if negative, or their
+    // sign bit flipped if positive. -0.0 sorts before +0.0.
+    template <typename TKey>
+    struct radix_key<TKey, typename etl::enable_if<etl::is_floating_point<TKey>::value>::type>
+    {
+#if ETL_USING_64BIT_TYPES
+      ETL_STATIC_ASSERT((sizeof(TKey) == sizeof(uint32_t)) || (sizeof(TKey) == sizeof(uint64_t)), "Unsupported floating point size");
 
-    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
-  }
+      typedef typename etl::conditional<sizeof(TKey) == sizeof(uint32_t), uint32_t, uint64_t>::type type;
+#else
+      ETL_STATIC_ASSERT(sizeof(TKey) == sizeof(uint32_t), "Unsupported floating point size");
 
-  //***************************************************************************
-  /// Transforms the elements from the ranges (begin1, end1) & (begin2)
-  /// to two different ranges depending on the value returned by the predicate.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TSource1,
-            typename TSource2,
-            typename TDestinationTrue,
-            typename TDestinationFalse,
-            typename TBinaryFunctionTrue,
-            typename TBinaryFunctionFalse,
-            typename TBinaryPredicate>
-  ETL_CONSTEXPR14
-  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_transform(TSource1             begin1,
-                                                                            TSource1             end1,
-                                                                            TSource2             begin2,
-                                                                            TDestinationTrue     destination_true,
-                                                                            TDestinationFalse    destination_false,
-                                                                            TBinaryFunctionTrue  function_true,
-                                                                            TBinaryFunctionFalse function_false,
-                                                                            TBinaryPredicate     predicate)
-  {
-    while (begin1 != end1)
+      typedef uint32_t type;
+#endif
+
+      static type get(TKey key)
+      {
+        type bits;
+        memcpy(&bits, &key, sizeof(type));
+
+        const type sign = static_cast<type>(1U) << ((CHAR_BIT * sizeof(type)) - 1U);
+
+        return ((bits & sign) != 0U) ? static_cast<type>(~bits) : static_cast<type>(bits | sign);
+      }
+    };
+
+    //*************************************************************************
+    /// The default key projection is the value itself.
+    //*************************************************************************
+    template <typename T>
+    struct radix_identity
     {
-      if (predicate(*begin1, *begin2))
+      const T& operator()(const T& value) const
       {
-        *destination_true = function_true(*begin1, *begin2);
-        ++destination_true;
+        return value;
       }
-      else
+    };
+
+    //*************************************************************************
+    /// Compares projected keys, for when there is not enough scratch space.
+    //*************************************************************************
+    template <typename TKey, typename TProjection>
+    struct radix_key_compare
+    {
+      explicit radix_key_compare(TProjection projection_)
+        : projection(projection_)
       {
-        *destination_false = function_false(*begin1, *begin2);
-        ++destination_false;
       }
 
-      ++begin1;
-      ++begin2;
-    }
+      template <typename T>
+      bool operator()(const T& lhs, const T& rhs) const
+      {
+        return radix_key<TKey>::get(projection(lhs)) < radix_key<TKey>::get(projection(rhs));
+      }
 
-    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
-  }
+      TProjection projection;
+    };
 
-  //***************************************************************************
-  /// Sorts the elements using shell sort.
-  /// Uses user defined comparison.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
-#if ETL_USING_STD_NAMESPACE
-  ETL_CONSTEXPR20
-#else
-  ETL_CONSTEXPR14
-#endif
-  void shell_sort(TIterator first, TIterator last, TCompare compare)
-  {
-    if (first == last)
+    //*************************************************************************
+    /// Counts the digits and scatters the elements to the destination.
+    /// Returns <b>false</b>, having moved nothing, if every element has the same digit.
+    //*************************************************************************
+    template <size_t Digit_Bits, typename TKey, typename TSource, typename TDestination, typename TProjection>
+    bool radix_sort_pass(TSource first, TSource last, TDestination destination, size_t shift, TProjection projection)
     {
-      return;
-    }
+      typedef typename etl::iterator_traits<TDestination>::difference_type difference_t;
 
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+      const size_t Radix = static_cast<size_t>(1U) << Digit_Bits;
+      const size_t Mask  = Radix - 1U;
+      const size_t n     = static_cast<size_t>(last - first);
 
-    difference_t n = etl::distance(first, last);
+      size_t counts[Radix];
 
-    for (difference_t i = n / 2; i > 0; i /= 2)
-    {
-      for (difference_t j = i; j < n; ++j)
+      for (size_t i = 0U; i < Radix; ++i)
       {
-        for (difference_t k = j - i; k >= 0; k -= i)
+        counts[i] = 0U;
+      }
+
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        ++counts[static_cast<size_t>(radix_key<TKey>::get(projection(*itr)) >> shift) & Mask];
+      }
+
+      // Convert the counts to offsets.
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < Radix; ++i)
+      {
+        const size_t count = counts[i];
+
+        if (count == n)
         {
-          TIterator itr1 = first;
-          TIterator itr2 = first;
+          return false;
+        }
 
-          etl::advance(itr1, k);
-          etl::advance(itr2, k + i);
+        counts[i] = total;
+        total    += count;
+      }
 
-          if (compare(*itr2, *itr1))
-          {
-            etl::iter_swap(itr1, itr2);
-          }
-        }
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        const size_t digit = static_cast<size_t>(radix_key<TKey>::get(projection(*itr)) >> shift) & Mask;
+
+        *(destination + difference_t(counts[digit]++)) = ETL_MOVE(*itr);
       }
-    }
-  }
 
-  //***************************************************************************
-  /// Sorts the elements using shell sort.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator>
-#if ETL_USING_STD_NAMESPACE
-  ETL_CONSTEXPR20
-#else
-  ETL_CONSTEXPR14
-#endif
-  void shell_sort(TIterator first, TIterator last)
-  {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
-  }
+      return true;
+    }
 
-  //***************************************************************************
-  /// Sorts the elements using insertion sort.
-  /// Uses user defined comparison.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_CONSTEXPR14
-  void insertion_sort(TIterator first, TIterator last, TCompare compare)
-  {
-    for (TIterator itr = first; itr != last; ++itr)
+    //*************************************************************************
+    /// LSD radix sort, ping ponging between the range and the scratch space.
+    //*************************************************************************
+    template <size_t Digit_Bits, typename TKey, typename TIterator, typename TScratchIterator, typename TProjection>
+    void radix_sort(TIterator first, TIterator last, TScratchIterator scratch_begin, TScratchIterator scratch_end, TProjection projection)
     {
-      etl::rotate(etl::upper_bound(first, itr, *itr, compare), itr, etl::next(itr));
-    }
-  }
+      ETL_STATIC_ASSERT((Digit_Bits > 0U) && (Digit_Bits <= 16U), "Digit_Bits must be between 1 and 16");
 
-  //***************************************************************************
-  /// Sorts the elements using insertion sort.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator>
-  ETL_CONSTEXPR14
-  void insertion_sort(TIterator first, TIterator last)
-  {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
-  }
+      typedef typename radix_key<TKey>::type                                    key_t;
+      typedef typename etl::iterator_traits<TIterator>::difference_type        difference_t;
 
-  //***************************************************************************
-  namespace private_algorithm
-  {
-    template <typename TIterator>
-    ETL_CONSTEXPR14
-    typename etl::enable_if<etl::is_forward_iterator<TIterator>::value, TIterator>::type
-      get_before_last(TIterator first_, TIterator last_)
-    {
-      TIterator last      = first_;
-      TIterator lastplus1 = first_;
-      ++lastplus1;
+      const size_t Key_Bits = CHAR_BIT * sizeof(key_t);
+      const difference_t n  = last - first;
 
-      while (lastplus1 != last_)
+      if (n < 2)
       {
-        ++last;
-        ++lastplus1;
+        return;
       }
 
-      return last;
-    }
+      if ((scratch_end - scratch_begin) < n)
+      {
+        // Not enough scratch space. Fall back to a stable comparison sort.
+        etl::merge_sort(first, last, scratch_begin, scratch_end, radix_key_compare<TKey, TProjection>(projection));
+        return;
+      }
 
-    template <typename TIterator>
-    ETL_CONSTEXPR14
-    typename etl::enable_if<etl::is_bidirectional_iterator<TIterator>::value, TIterator>::type
-      get_before_last(TIterator /*first_*/, TIterator last_)
-    {
-      TIterator last = last_;
-      --last;
+      TScratchIterator scratch_last = scratch_begin + n;
+      bool in_scratch = false;
 
-      return last;
+      for (size_t shift = 0U; shift < Key_Bits; shift += Digit_Bits)
+      {
+        if (in_scratch)
+        {
+          if (radix_sort_pass<Digit_Bits, TKey>(scratch_begin, scratch_last, first, shift, projection))
+          {
+            in_scratch = false;
+          }
+        }
+        else
+        {
+          if (radix_sort_pass<Digit_Bits, TKey>(first, last, scratch_begin, shift, projection))
+          {
+            in_scratch = true;
+          }
+        }
+      }
+
+      if (in_scratch)
+      {
+        etl::move(scratch_begin, scratch_last, first);
+      }
     }
 
-    template <typename TIterator>
-    ETL_CONSTEXPR14
-    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type
-      get_before_last(TIterator /*first_*/, TIterator last_)
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// The key type returned by a projection.
+    //*************************************************************************
+    template <typename TIterator, typename TProjection>
+    struct radix_projected_key
     {
-      return last_ - 1;
-    }
+      typedef typename etl::decay<decltype(etl::declval<TProjection&>()(*etl::declval<TIterator&>()))>::type type;
+    };
+#endif
   }
 
   //***************************************************************************
-  /// Sorts the elements using selection sort.
-  /// Uses user defined comparison.
+  /// Sorts integral or floating point values using an LSD radix sort.
+  /// Stable. O(N) for a fixed key width. Does not allocate.
+  /// The scratch range must hold at least as many elements as the range, or a
+  /// stable comparison sort is used instead. Its elements are overwritten.
+  /// Each pass uses 2^Digit_Bits counts on the stack, and is skipped if every
+  /// element has the same digit. Requires random access iterators.
+  ///\tparam Digit_Bits The bits sorted per pass. e.g. 8 or 11.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_CONSTEXPR20
-  void selection_sort(TIterator first, TIterator last, TCompare compare)
+  template <size_t Digit_Bits, typename TIterator, typename TScratchIterator>
+  void radix_sort(TIterator first, TIterator last, TScratchIterator scratch_begin, TScratchIterator scratch_end)
   {
-    TIterator min;
-    const TIterator ilast = private_algorithm::get_before_last(first, last);
-    const TIterator jlast = last;
-
-    for (TIterator i = first; i != ilast; ++i)
-    {
-      min = i;
-      
-      TIterator j = i;
-      ++j;
-
-      for (; j != jlast; ++j)
-      {
-        if (compare(*j, *min))
-        {
-          min = j;
-        }
-      }
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
-      using ETL_OR_STD::swap; // Allow ADL
-      swap(*i, *min);
-    }
+    private_algorithm::radix_sort<Digit_Bits, value_t>(first, last, scratch_begin, scratch_end, private_algorithm::radix_identity<value_t>());
   }
 
   //***************************************************************************
-  /// Sorts the elements using selection sort.
+  /// Sorts integral or floating point values using an LSD radix sort with 8 bit digits.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator>
-  ETL_CONSTEXPR20
-  void selection_sort(TIterator first, TIterator last)
+  template <typename TIterator, typename TScratchIterator>
+  void radix_sort(TIterator first, TIterator last, TScratchIterator scratch_begin, TScratchIterator scratch_end)
   {
-    selection_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::radix_sort<8U>(first, last, scratch_begin, scratch_end);
   }
 
+#if ETL_USING_CPP11
   //***************************************************************************
-  /// Sorts the elements using heap sort.
-  /// Uses user defined comparison.
+  /// Sorts values by an integral or floating point key using an LSD radix sort.
+  /// The projection returns the key of a value. It is called once per value per pass.
+  ///\tparam Digit_Bits The bits sorted per pass. e.g. 8 or 11.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_CONSTEXPR14
-  void heap_sort(TIterator first, TIterator last, TCompare compare)
+  template <size_t Digit_Bits, typename TIterator, typename TScratchIterator, typename TProjection>
+  void radix_sort(TIterator first, TIterator last, TScratchIterator scratch_begin, TScratchIterator scratch_end, TProjection projection)
   {
-    if (!etl::is_heap(first, last, compare))
-    {
-      etl::make_heap(first, last, compare);
-    }
+    typedef typename private_algorithm::radix_projected_key<TIterator, TProjection>::type key_t;
 
-    etl::sort_heap(first, last, compare);
+    private_algorithm::radix_sort<Digit_Bits, key_t>(first, last, scratch_begin, scratch_end, projection);
   }
 
   //***************************************************************************
-  /// Sorts the elements using heap sort.
+  /// Sorts values by an integral or floating point key using an LSD radix sort with 8 bit digits.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator>
-  ETL_CONSTEXPR14
-  void heap_sort(TIterator first, TIterator last)
+  template <typename TIterator, typename TScratchIterator, typename TProjection>
+  void radix_sort(TIterator first, TIterator last, TScratchIterator scratch_begin, TScratchIterator scratch_end, TProjection projection)
   {
-    if (!etl::is_heap(first, last))
-    {
-      etl::make_heap(first, last);
-    }
-
-    etl::sort_heap(first, last);
+    etl::radix_sort<8U>(first, last, scratch_begin, scratch_end, projection);
   }
+#endif
 
   //***************************************************************************
   /// Returns the maximum value.
@@ -3283,45 +5075,114 @@ namespace etl
   //*********************************************************
   namespace private_algorithm
   {
-    using ETL_OR_STD::swap;
+    /// Selection ranges smaller than this are finished with an insertion sort.
+    ETL_CONSTANT ptrdiff_t Intro_Select_Insertion_Threshold = 16;
+
+    //*******************************************************
+    /// Moves the smallest (middle - first) elements to [first, middle), as a
+    /// heap with the greatest of them at first. O(N log K).
+    //*******************************************************
+    template <typename TIterator, typename TCompare>
+    void heap_select(TIterator first, TIterator middle, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+      typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+
+      etl::make_heap(first, middle, compare);
+
+      const difference_t length = middle - first;
 
+      for (TIterator itr = middle; itr < last; ++itr)
+      {
+        if (compare(*itr, *first))
+        {
+          value_t value = ETL_MOVE(*itr);
+          *itr = ETL_MOVE(*first);
+          private_heap::adjust_heap(first, difference_t(0), length, ETL_MOVE(value), compare);
+        }
+      }
+    }
+
+    //*******************************************************
+    /// Introselect.
+    /// Quickselect with the introsort pivot choice. Runs of elements equal to
+    /// the previous pivot are skipped in linear time. Falls back to heap
+    /// selection after 2 log2(N) partitions, so is O(N log N) in the worst case.
+    //*******************************************************
     template <typename TIterator, typename TCompare>
 #if (ETL_USING_CPP20 && ETL_USING_STL) || (ETL_USING_CPP14 && ETL_NOT_USING_STL && !defined(ETL_IN_UNIT_TEST))
     constexpr
 #endif
-    TIterator nth_partition(TIterator first, TIterator last, TCompare compare)
+    void intro_select(TIterator first, TIterator nth, TIterator last, TCompare compare)
     {
-      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      if ((first == last) || (nth == last))
+      {
+        return;
+      }
 
-      TIterator  pivot = last; // Maybe find a better pivot choice?
-      value_type pivot_value = *pivot;
+      int depth = 0;
 
-      // Swap the pivot with the last, if necessary.
-      if (pivot != last)
+      for (difference_t length = last - first; length > 0; length /= 2)
       {
-        swap(*pivot, *last);
+        depth += 2;
       }
 
-      TIterator i = first;
+      bool leftmost = true;
 
-      for (TIterator j = first; j < last; ++j)
+      while ((last - first) > Intro_Select_Insertion_Threshold)
       {
-        if (!compare(pivot_value, *j)) // Hack to get '*j <= pivot_value' in terms of 'pivot_value < *j'
+        if (depth-- == 0)
         {
-          swap(*i, *j);
-          ++i;
+          // Move the greatest of the smallest up to nth to nth.
+          heap_select(first, nth + 1, last, compare);
+          etl::iter_swap(first, nth);
+          return;
         }
-      }
 
-      swap(*i, *last);
+        intro_sort_choose_pivot(first, last, compare);
+
+        // If the pivot equals the element before the range, then so do all of
+        // the elements not greater than it.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          TIterator equal_last = intro_sort_partition_left(first, last, compare);
+
+          if (nth <= equal_last)
+          {
+            return;
+          }
+
+          first = equal_last + 1;
+          continue;
+        }
+
+        TIterator pivot = intro_sort_partition_right(first, last, compare).first;
+
+        if (pivot == nth)
+        {
+          return;
+        }
+        else if (nth < pivot)
+        {
+          last = pivot;
+        }
+        else
+        {
+          first    = pivot + 1;
+          leftmost = false;
+        }
+      }
 
-      return i;
+      intro_sort_insertion<true>(first, last, compare);
     }
   }
 
   //*********************************************************
   /// nth_element
   /// see https://en.cppreference.com/w/cpp/algorithm/nth_element
+  /// Introselect. O(N) on average, O(N log N) in the worst case.
   //*********************************************************
 #if ETL_USING_CPP11
   template <typename TIterator, typename TCompare = etl::less<typename etl::iterator_traits<TIterator>::value_type>>
@@ -3331,31 +5192,7 @@ namespace etl
   typename etl::enable_if<etl::is_random_access_iterator_concept<TIterator>::value, void>::type
     nth_element(TIterator first, TIterator nth, TIterator last, TCompare compare = TCompare())
   {
-    if (first == last)
-    {
-      return;
-    }
-
-    // 'last' must point to the actual last value.
-    --last;
-
-    while (first <= last)
-    {
-      TIterator p = private_algorithm::nth_partition(first, last, compare);
-
-      if (p == nth)
-      {
-        return;
-      }
-      else if (p > nth)
-      {
-        last = p - 1;
-      }
-      else
-      {
-        first = p + 1;
-      }
-    }
+    private_algorithm::intro_select(first, nth, last, compare);
   }
 
 #else
@@ -3365,43 +5202,102 @@ namespace etl
   typename etl::enable_if<etl::is_random_access_iterator_concept<TIterator>::value, void>::type
     nth_element(TIterator first, TIterator nth, TIterator last, TCompare compare)
   {
-    if (first == last)
+    private_algorithm::intro_select(first, nth, last, compare);
+  }
+
+  //*********************************************************
+  template <typename TIterator>
+  typename etl::enable_if<etl::is_random_access_iterator_concept<TIterator>::value, void>::type
+    nth_element(TIterator first, TIterator nth, TIterator last)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare_t;
+
+    private_algorithm::intro_select(first, nth, last, compare_t());
+  }
+#endif
+
+  //*********************************************************
+  /// partial_sort
+  /// Sorts the smallest (middle - first) elements into [first, middle).
+  /// The order of the rest is unspecified. O(N log K). Does not allocate.
+  /// see https://en.cppreference.com/w/cpp/algorithm/partial_sort
+  //*********************************************************
+  template <typename TIterator, typename TCompare>
+  void partial_sort(TIterator first, TIterator middle, TIterator last, TCompare compare)
+  {
+    if (first == middle)
     {
       return;
     }
 
-    // 'last' must point to the actual last value.
-    --last;
+    private_algorithm::heap_select(first, middle, last, compare);
+    etl::sort_heap(first, middle, compare);
+  }
+
+  //*********************************************************
+  template <typename TIterator>
+  void partial_sort(TIterator first, TIterator middle, TIterator last)
+  {
+    etl::partial_sort(first, middle, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //*********************************************************
+  /// partial_sort_copy
+  /// Copies the smallest elements of [first, last), sorted, to the
+  /// destination range, which may be smaller. Only one pass is made over the
+  /// input, so input iterators are allowed. O(N log K). Does not allocate.
+  /// Returns the end of the copied elements.
+  /// see https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy
+  //*********************************************************
+  template <typename TInputIterator, typename TRandomAccessIterator, typename TCompare>
+  TRandomAccessIterator partial_sort_copy(TInputIterator         first,
+                                          TInputIterator         last,
+                                          TRandomAccessIterator  d_first,
+                                          TRandomAccessIterator  d_last,
+                                          TCompare               compare)
+  {
+    typedef typename etl::iterator_traits<TRandomAccessIterator>::difference_type difference_t;
+
+    TRandomAccessIterator d_end = d_first;
 
-    while (first <= last)
+    while ((first != last) && (d_end != d_last))
     {
-      TIterator p = private_algorithm::nth_partition(first, last, compare);
+      *d_end = *first;
+      ++d_end;
+      ++first;
+    }
 
-      if (p == nth)
-      {
-        return;
-      }
-      else if (p > nth)
-      {
-        last = p - 1;
-      }
-      else
+    if (d_first == d_end)
+    {
+      return d_end;
+    }
+
+    etl::make_heap(d_first, d_end, compare);
+
+    const difference_t length = d_end - d_first;
+
+    for (; first != last; ++first)
+    {
+      if (compare(*first, *d_first))
       {
-        first = p + 1;
+        private_heap::adjust_heap(d_first, difference_t(0), length, *first, compare);
       }
     }
+
+    etl::sort_heap(d_first, d_end, compare);
+
+    return d_end;
   }
 
   //*********************************************************
-  template <typename TIterator>
-  typename etl::enable_if<etl::is_random_access_iterator_concept<TIterator>::value, void>::type
-    nth_element(TIterator first, TIterator nth, TIterator last)
+  template <typename TInputIterator, typename TRandomAccessIterator>
+  TRandomAccessIterator partial_sort_copy(TInputIterator        first,
+                                          TInputIterator        last,
+                                          TRandomAccessIterator d_first,
+                                          TRandomAccessIterator d_last)
   {
-    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare_t;
-
-    nth_element(first, last, compare_t());
+    return etl::partial_sort_copy(first, last, d_first, d_last, etl::less<typename etl::iterator_traits<TRandomAccessIterator>::value_type>());
   }
-#endif
 }
 
 #include "private/minmax_pop.h"
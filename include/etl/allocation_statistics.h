@@ -0,0 +1,257 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ALLOCATION_STATISTICS_INCLUDED
+#define ETL_ALLOCATION_STATISTICS_INCLUDED
+
+#include "platform.h"
+#include "delegate.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+///\defgroup allocation_statistics Allocation statistics
+/// Optional instrumentation for etl::ipool and etl::imemory_block_allocator.
+/// Enabled by defining ETL_ALLOCATION_STATISTICS_ENABLE in the profile.
+/// When disabled, the pools and allocators contain no statistics and have no
+/// instrumentation overhead.
+///\ingroup memory
+
+#if !defined(ETL_ALLOCATION_STATISTICS_TIMESTAMP_TYPE)
+  #define ETL_ALLOCATION_STATISTICS_TIMESTAMP_TYPE uint32_t
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Records the usage of a pool or memory block allocator.
+  /// Used to size fixed capacities from the actual load.
+  /// Timestamps are taken from an optional user supplied clock.
+  /// The statistics are not synchronised. If the owner is shared between
+  /// threads then the counts should only be read when it is quiescent.
+  ///\ingroup allocation_statistics
+  //***************************************************************************
+  class allocation_statistics
+  {
+  public:
+
+    typedef ETL_ALLOCATION_STATISTICS_TIMESTAMP_TYPE timestamp_type;
+    typedef etl::delegate<timestamp_type(void)>      clock_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    allocation_statistics()
+      : clock()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Sets the clock used to timestamp events.
+    //*************************************************************************
+    void set_clock(const clock_type& clock_)
+    {
+      clock = clock_;
+    }
+
+    //*************************************************************************
+    /// Removes the clock. Timestamps will be recorded as zero.
+    //*************************************************************************
+    void clear_clock()
+    {
+      clock = clock_type();
+    }
+
+    //*************************************************************************
+    /// Records a successful allocation.
+    //*************************************************************************
+    void on_allocate()
+    {
+      const timestamp_type now = time_now();
+
+      ++current_count;
+      ++allocations;
+      last_allocation_time = now;
+
+      if (current_count > peak_count)
+      {
+        peak_count = current_count;
+        peak_time  = now;
+      }
+    }
+
+    //*************************************************************************
+    /// Records a release.
+    //*************************************************************************
+    void on_release()
+    {
+      if (current_count > 0U)
+      {
+        --current_count;
+      }
+
+      ++releases;
+    }
+
+    //*************************************************************************
+    /// Records the release of all allocations.
+    //*************************************************************************
+    void on_release_all()
+    {
+      releases += current_count;
+      current_count = 0U;
+    }
+
+    //*************************************************************************
+    /// Records a failed allocation.
+    //*************************************************************************
+    void on_failure()
+    {
+      ++failures;
+      last_failure_time = time_now();
+    }
+
+    //*************************************************************************
+    /// The number of allocations currently outstanding.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_count;
+    }
+
+    //*************************************************************************
+    /// The highest number of outstanding allocations.
+    //*************************************************************************
+    size_t peak_size() const
+    {
+      return peak_count;
+    }
+
+    //*************************************************************************
+    /// The total number of successful allocations.
+    //*************************************************************************
+    size_t allocation_count() const
+    {
+      return allocations;
+    }
+
+    //*************************************************************************
+    /// The total number of releases.
+    //*************************************************************************
+    size_t release_count() const
+    {
+      return releases;
+    }
+
+    //*************************************************************************
+    /// The total number of failed allocations.
+    //*************************************************************************
+    size_t failure_count() const
+    {
+      return failures;
+    }
+
+    //*************************************************************************
+    /// The time that the peak was last reached.
+    //*************************************************************************
+    timestamp_type peak_timestamp() const
+    {
+      return peak_time;
+    }
+
+    //*************************************************************************
+    /// The time of the last successful allocation.
+    //*************************************************************************
+    timestamp_type last_allocation_timestamp() const
+    {
+      return last_allocation_time;
+    }
+
+    //*************************************************************************
+    /// The time of the last failed allocation.
+    //*************************************************************************
+    timestamp_type last_failure_timestamp() const
+    {
+      return last_failure_time;
+    }
+
+    //*************************************************************************
+    /// Resets the counts and timestamps.
+    /// The peak is set to the number currently outstanding.
+    //*************************************************************************
+    void reset()
+    {
+      const size_t outstanding = current_count;
+
+      clear();
+
+      current_count = outstanding;
+      peak_count    = outstanding;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Clears all of the counts and timestamps.
+    //*************************************************************************
+    void clear()
+    {
+      current_count        = 0U;
+      peak_count           = 0U;
+      allocations          = 0U;
+      releases             = 0U;
+      failures             = 0U;
+      peak_time            = timestamp_type();
+      last_allocation_time = timestamp_type();
+      last_failure_time    = timestamp_type();
+    }
+
+    //*************************************************************************
+    /// The current time, or zero if there is no clock.
+    //*************************************************************************
+    timestamp_type time_now() const
+    {
+      return clock.is_valid() ? clock() : timestamp_type();
+    }
+
+    clock_type     clock;
+    size_t         current_count;
+    size_t         peak_count;
+    size_t         allocations;
+    size_t         releases;
+    size_t         failures;
+    timestamp_type peak_time;
+    timestamp_type last_allocation_time;
+    timestamp_type last_failure_time;
+  };
+}
+
+#endif
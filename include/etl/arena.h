@@ -0,0 +1,472 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ARENA_INCLUDED
+#define ETL_ARENA_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "alignment.h"
+#include "largest.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup arena arena
+/// A monotonic, variable size allocator.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for arena exceptions.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_exception : public etl::exception
+  {
+  public:
+
+    arena_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the arena has no room for an object.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_no_allocation : public etl::arena_exception
+  {
+  public:
+
+    arena_no_allocation(string_type file_name_, numeric_type line_number_)
+      : arena_exception(ETL_ERROR_TEXT("arena:no allocation", ETL_ARENA_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when rewinding to a checkpoint that is not valid.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_invalid_checkpoint : public etl::arena_exception
+  {
+  public:
+
+    arena_invalid_checkpoint(string_type file_name_, numeric_type line_number_)
+      : arena_exception(ETL_ERROR_TEXT("arena:invalid checkpoint", ETL_ARENA_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for arenas.
+  /// Allocation bumps a pointer. Individual allocations are never freed;
+  /// instead the arena is rewound to a checkpoint, or reset, which frees
+  /// everything allocated since.
+  /// Destructors are not called when memory is rewound.
+  /// As an etl::imemory_block_allocator, it may be used by
+  /// etl::reference_counted_message_pool, or as a successor to another
+  /// allocator. release() succeeds for any block in the arena, but the
+  /// memory is only reclaimed by rewind() or reset().
+  ///\ingroup arena
+  //***************************************************************************
+  class iarena : public etl::imemory_block_allocator
+  {
+  public:
+
+    /// A position in the arena that may be rewound to.
+    typedef size_t checkpoint_type;
+
+    //*************************************************************************
+    /// Allocate storage for an object.
+    /// If asserts or exceptions are enabled and there is no room an
+    /// etl::arena_no_allocation is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      void* p = allocate_block(sizeof(T), etl::alignment_of<T>::value);
+
+      ETL_ASSERT(p != ETL_NULLPTR, ETL_ERROR(etl::arena_no_allocation));
+
+      return static_cast<T*>(p);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an array of objects.
+    /// If asserts or exceptions are enabled and there is no room an
+    /// etl::arena_no_allocation is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate(size_t n)
+    {
+      void* p = ETL_NULLPTR;
+
+      if (n <= (capacity() / sizeof(T)))
+      {
+        p = allocate_block(n * sizeof(T), etl::alignment_of<T>::value);
+      }
+
+      ETL_ASSERT(p != ETL_NULLPTR, ETL_ERROR(etl::arena_no_allocation));
+
+      return static_cast<T*>(p);
+    }
+
+    using imemory_block_allocator::allocate;
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object and create default.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 1 parameter.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets a checkpoint for the current position.
+    //*************************************************************************
+    checkpoint_type checkpoint() const
+    {
+      return used_size;
+    }
+
+    //*************************************************************************
+    /// Frees everything allocated since the checkpoint.
+    /// If asserts or exceptions are enabled and the checkpoint is beyond the
+    /// current position an etl::arena_invalid_checkpoint is thrown.
+    //*************************************************************************
+    void rewind(checkpoint_type position)
+    {
+      ETL_ASSERT_OR_RETURN(position <= used_size, ETL_ERROR(etl::arena_invalid_checkpoint));
+
+      used_size = position;
+    }
+
+    //*************************************************************************
+    /// Frees everything.
+    //*************************************************************************
+    void reset()
+    {
+      used_size = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of bytes used, including alignment padding.
+    //*************************************************************************
+    size_t size() const
+    {
+      return used_size;
+    }
+
+    //*************************************************************************
+    /// The number of bytes not yet used.
+    //*************************************************************************
+    size_t available() const
+    {
+      return buffer_size - used_size;
+    }
+
+    //*************************************************************************
+    /// The total number of bytes.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return buffer_size;
+    }
+
+    //*************************************************************************
+    /// The most bytes that have been in use at once.
+    //*************************************************************************
+    size_t peak_size() const
+    {
+      return peak_used_size;
+    }
+
+    //*************************************************************************
+    /// Has nothing been allocated?
+    //*************************************************************************
+    bool empty() const
+    {
+      return used_size == 0U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iarena(char* p_buffer_, size_t buffer_size_)
+      : p_buffer(p_buffer_)
+      , buffer_size(buffer_size_)
+      , used_size(0U)
+      , peak_used_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Bumps the position by the aligned size.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if (required_alignment == 0U)
+      {
+        required_alignment = 1U;
+      }
+
+      const uintptr_t current   = reinterpret_cast<uintptr_t>(p_buffer) + used_size;
+      const size_t    remainder = current % required_alignment;
+      const size_t    padding   = (remainder == 0U) ? 0U : (required_alignment - remainder);
+
+      if ((padding > available()) || (required_size > (available() - padding)))
+      {
+        return ETL_NULLPTR;
+      }
+
+      used_size += padding + required_size;
+
+      if (used_size > peak_used_size)
+      {
+        peak_used_size = used_size;
+      }
+
+      return p_buffer + (used_size - required_size);
+    }
+
+    //*************************************************************************
+    /// Blocks are not released individually.
+    /// Returns true if the block is in the arena.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      return is_owner_of_block(pblock);
+    }
+
+    //*************************************************************************
+    /// Returns true if the block is in the arena.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      const char* p = static_cast<const char*>(pblock);
+
+      return (p >= p_buffer) && (p < (p_buffer + buffer_size));
+    }
+
+  private:
+
+    // Should not be copied.
+    iarena(const iarena&) ETL_DELETE;
+    iarena& operator =(const iarena&) ETL_DELETE;
+
+    char*        p_buffer;
+    const size_t buffer_size;
+    size_t       used_size;
+    size_t       peak_used_size;
+  };
+
+  //***************************************************************************
+  /// Rewinds an arena to the position it had when the scope was created.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_scope
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit arena_scope(etl::iarena& arena_)
+      : arena(arena_)
+      , position(arena_.checkpoint())
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Frees everything allocated in the scope.
+    //*************************************************************************
+    ~arena_scope()
+    {
+      arena.rewind(position);
+    }
+
+  private:
+
+    // Should not be copied.
+    arena_scope(const arena_scope&) ETL_DELETE;
+    arena_scope& operator =(const arena_scope&) ETL_DELETE;
+
+    etl::iarena&                 arena;
+    etl::iarena::checkpoint_type position;
+  };
+
+  //***************************************************************************
+  /// An arena with internal storage.
+  ///\tparam VSize      The size of the arena in bytes.
+  ///\tparam VAlignment The alignment of the start of the arena.
+  ///\ingroup arena
+  //***************************************************************************
+  template <size_t VSize, size_t VAlignment = etl::largest_alignment<long long, double, void*>::value>
+  class arena : public etl::iarena
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSize > 0U, "Size must be greater than zero");
+
+    static ETL_CONSTANT size_t Size      = VSize;
+    static ETL_CONSTANT size_t Alignment = VAlignment;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    arena()
+      : iarena(reinterpret_cast<char*>(&buffer), VSize)
+    {
+    }
+
+  private:
+
+    typename etl::aligned_storage<VSize, VAlignment>::type buffer;
+  };
+
+  template <size_t VSize, size_t VAlignment>
+  ETL_CONSTANT size_t arena<VSize, VAlignment>::Size;
+
+  template <size_t VSize, size_t VAlignment>
+  ETL_CONSTANT size_t arena<VSize, VAlignment>::Alignment;
+
+  //***************************************************************************
+  /// An arena with external storage.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_ext : public etl::iarena
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    arena_ext(void* p_buffer_, size_t buffer_size_)
+      : iarena(static_cast<char*>(p_buffer_), buffer_size_)
+    {
+    }
+  };
+}
+
+#endif
@@ -42,6 +42,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "nth_type.h"
 #include "initializer_list.h"
+#include "hash.h"
 
 #include <stddef.h>
 
@@ -255,7 +256,7 @@ namespace etl
     ETL_CONSTEXPR14
     iterator end() ETL_NOEXCEPT
     {
-      return _buffer + SIZE;
+      return &_buffer[0] + SIZE;
     }
 
     //*************************************************************************
@@ -264,7 +265,7 @@ namespace etl
     ETL_NODISCARD
     ETL_CONSTEXPR const_iterator end() const ETL_NOEXCEPT
     {
-      return _buffer + SIZE;
+      return &_buffer[0] + SIZE;
     }
 
     //*************************************************************************
@@ -273,7 +274,7 @@ namespace etl
     ETL_NODISCARD
     ETL_CONSTEXPR const_iterator cend() const ETL_NOEXCEPT
     {
-      return _buffer + SIZE;
+      return &_buffer[0] + SIZE;
     }
 
     //*************************************************************************
@@ -736,6 +737,28 @@ namespace etl
     ETL_STATIC_ASSERT(I < MAXN, "Index out of bounds");
     return a[I];
   }
+
+#if ETL_USING_8BIT_TYPES
+  //*************************************************************************
+  /// Hash function.
+  /// Combines the hashes of the elements, in order.
+  //*************************************************************************
+  template <typename T, size_t SIZE>
+  struct hash<etl::array<T, SIZE> >
+  {
+    size_t operator()(const etl::array<T, SIZE>& a) const
+    {
+      size_t seed = 0U;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        etl::hash_combine(seed, a[i]);
+      }
+
+      return seed;
+    }
+  };
+#endif
 }
 
 #endif
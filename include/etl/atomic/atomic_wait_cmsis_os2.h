@@ -0,0 +1,194 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_WAIT_CMSIS_OS2_INCLUDED
+#define ETL_ATOMIC_WAIT_CMSIS_OS2_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmsis_os2.h>
+
+#if !defined(ETL_ATOMIC_WAIT_MAX_WAITERS)
+  #define ETL_ATOMIC_WAIT_MAX_WAITERS 8
+#endif
+
+#if !defined(ETL_ATOMIC_WAIT_THREAD_FLAG)
+  #define ETL_ATOMIC_WAIT_THREAD_FLAG 0x40000000UL
+#endif
+
+namespace etl
+{
+  namespace private_atomic_wait
+  {
+    //***************************************************************************
+    ///\ingroup atomic_wait
+    /// Atomic wait hooks using CMSIS-RTOS2 thread flags.
+    /// Waiting threads are listed, with the address they wait on, in a table of
+    /// ETL_ATOMIC_WAIT_MAX_WAITERS entries. A thread that finds the table full
+    /// polls every tick instead.
+    /// Notify from thread context only. Waiting uses ETL_ATOMIC_WAIT_THREAD_FLAG,
+    /// so it must not be used for anything else.
+    //***************************************************************************
+    class atomic_wait_cmsis_os2
+    {
+    public:
+
+      typedef size_t token_type;
+
+      //*************************************************************************
+      /// Registers a waiter for the address.
+      /// Called before the value is checked, so no notify can be missed.
+      //*************************************************************************
+      static token_type prepare(const volatile void* address)
+      {
+        // Discard any flag left from an earlier wait.
+        osThreadFlagsClear(ETL_ATOMIC_WAIT_THREAD_FLAG);
+
+        waiter* table = waiters();
+        size_t  slot  = ETL_ATOMIC_WAIT_MAX_WAITERS;
+
+        const int32_t lock = osKernelLock();
+
+        for (size_t i = 0U; i < ETL_ATOMIC_WAIT_MAX_WAITERS; ++i)
+        {
+          if (table[i].address == ETL_NULLPTR)
+          {
+            table[i].address = address;
+            table[i].thread  = osThreadGetId();
+            slot = i;
+            break;
+          }
+        }
+
+        osKernelRestoreLock(lock);
+
+        return slot;
+      }
+
+      //*************************************************************************
+      /// Deregisters a waiter that did not need to wait.
+      //*************************************************************************
+      static void cancel(token_type token)
+      {
+        if (token != ETL_ATOMIC_WAIT_MAX_WAITERS)
+        {
+          const int32_t lock = osKernelLock();
+          waiters()[token].address = ETL_NULLPTR;
+          osKernelRestoreLock(lock);
+        }
+      }
+
+      //*************************************************************************
+      /// Sleeps until notified, or for timeout_ms, then deregisters.
+      /// May return early.
+      //*************************************************************************
+      static void wait(token_type token, uint32_t timeout_ms)
+      {
+        if (token == ETL_ATOMIC_WAIT_MAX_WAITERS)
+        {
+          osDelay(1U);
+        }
+        else
+        {
+          osThreadFlagsWait(ETL_ATOMIC_WAIT_THREAD_FLAG, osFlagsWaitAny, to_ticks(timeout_ms));
+          cancel(token);
+        }
+      }
+
+      //*************************************************************************
+      /// Wakes the waiters for the address.
+      //*************************************************************************
+      static void notify_one(const volatile void* address)
+      {
+        notify_all(address);
+      }
+
+      //*************************************************************************
+      /// Wakes the waiters for the address.
+      //*************************************************************************
+      static void notify_all(const volatile void* address)
+      {
+        waiter* table = waiters();
+
+        const int32_t lock = osKernelLock();
+
+        for (size_t i = 0U; i < ETL_ATOMIC_WAIT_MAX_WAITERS; ++i)
+        {
+          if (table[i].address == address)
+          {
+            osThreadFlagsSet(table[i].thread, ETL_ATOMIC_WAIT_THREAD_FLAG);
+          }
+        }
+
+        osKernelRestoreLock(lock);
+      }
+
+      //*************************************************************************
+      /// A monotonic millisecond count, at the tick resolution.
+      //*************************************************************************
+      static uint32_t now_ms()
+      {
+        return uint32_t((uint64_t(osKernelGetTickCount()) * 1000U) / osKernelGetTickFreq());
+      }
+
+    private:
+
+      struct waiter
+      {
+        const volatile void* address;
+        osThreadId_t         thread;
+      };
+
+      //*************************************************************************
+      static waiter* waiters()
+      {
+        static waiter table[ETL_ATOMIC_WAIT_MAX_WAITERS];
+
+        return table;
+      }
+
+      //*************************************************************************
+      static uint32_t to_ticks(uint32_t timeout_ms)
+      {
+        if (timeout_ms == UINT32_MAX)
+        {
+          return osWaitForever;
+        }
+
+        return uint32_t(((uint64_t(timeout_ms) * osKernelGetTickFreq()) + 999U) / 1000U);
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,168 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_WAIT_FUTEX_INCLUDED
+#define ETL_ATOMIC_WAIT_FUTEX_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#if !defined(ETL_ATOMIC_WAIT_BUCKETS)
+  #define ETL_ATOMIC_WAIT_BUCKETS 16
+#endif
+
+namespace etl
+{
+  namespace private_atomic_wait
+  {
+    //***************************************************************************
+    ///\ingroup atomic_wait
+    /// Atomic wait hooks using Linux futexes.
+    /// Waiters sleep on the epoch of a bucket chosen by the address of the
+    /// atomic, so a notify wakes every waiter in the bucket.
+    //***************************************************************************
+    class atomic_wait_futex
+    {
+    private:
+
+      struct bucket
+      {
+        int epoch;
+        int waiters;
+      };
+
+    public:
+
+      struct token_type
+      {
+        bucket* p_bucket;
+        int     epoch;
+      };
+
+      //*************************************************************************
+      /// Registers a waiter for the address.
+      /// Called before the value is checked, so no notify can be missed.
+      //*************************************************************************
+      static token_type prepare(const volatile void* address)
+      {
+        bucket& b = get_bucket(address);
+
+        __atomic_fetch_add(&b.waiters, 1, __ATOMIC_SEQ_CST);
+
+        token_type token = { &b, __atomic_load_n(&b.epoch, __ATOMIC_SEQ_CST) };
+
+        return token;
+      }
+
+      //*************************************************************************
+      /// Deregisters a waiter that did not need to wait.
+      //*************************************************************************
+      static void cancel(const token_type& token)
+      {
+        __atomic_fetch_sub(&token.p_bucket->waiters, 1, __ATOMIC_SEQ_CST);
+      }
+
+      //*************************************************************************
+      /// Sleeps until notified, or for timeout_ms, then deregisters.
+      /// May return early.
+      //*************************************************************************
+      static void wait(const token_type& token, uint32_t timeout_ms)
+      {
+        if (timeout_ms == UINT32_MAX)
+        {
+          syscall(SYS_futex, &token.p_bucket->epoch, FUTEX_WAIT_PRIVATE, token.epoch, NULL, NULL, 0);
+        }
+        else
+        {
+          struct timespec timeout;
+          timeout.tv_sec  = time_t(timeout_ms / 1000U);
+          timeout.tv_nsec = long(timeout_ms % 1000U) * 1000000L;
+
+          syscall(SYS_futex, &token.p_bucket->epoch, FUTEX_WAIT_PRIVATE, token.epoch, &timeout, NULL, 0);
+        }
+
+        cancel(token);
+      }
+
+      //*************************************************************************
+      /// Wakes the waiters for the address.
+      //*************************************************************************
+      static void notify_one(const volatile void* address)
+      {
+        notify_all(address);
+      }
+
+      //*************************************************************************
+      /// Wakes the waiters for the address.
+      //*************************************************************************
+      static void notify_all(const volatile void* address)
+      {
+        bucket& b = get_bucket(address);
+
+        __atomic_fetch_add(&b.epoch, 1, __ATOMIC_SEQ_CST);
+
+        if (__atomic_load_n(&b.waiters, __ATOMIC_SEQ_CST) != 0)
+        {
+          syscall(SYS_futex, &b.epoch, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+        }
+      }
+
+      //*************************************************************************
+      /// A monotonic millisecond count.
+      //*************************************************************************
+      static uint32_t now_ms()
+      {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        return uint32_t((uint64_t(now.tv_sec) * 1000U) + (uint64_t(now.tv_nsec) / 1000000U));
+      }
+
+    private:
+
+      //*************************************************************************
+      static bucket& get_bucket(const volatile void* address)
+      {
+        static bucket buckets[ETL_ATOMIC_WAIT_BUCKETS];
+
+        return buckets[(reinterpret_cast<uintptr_t>(address) / sizeof(void*)) % ETL_ATOMIC_WAIT_BUCKETS];
+      }
+    };
+  }
+}
+
+#endif
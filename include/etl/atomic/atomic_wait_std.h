@@ -0,0 +1,177 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_WAIT_STD_INCLUDED
+#define ETL_ATOMIC_WAIT_STD_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#if !defined(ETL_ATOMIC_WAIT_BUCKETS)
+  #define ETL_ATOMIC_WAIT_BUCKETS 16
+#endif
+
+namespace etl
+{
+  namespace private_atomic_wait
+  {
+    //***************************************************************************
+    ///\ingroup atomic_wait
+    /// Atomic wait hooks using std::condition_variable.
+    /// Waiters sleep on the epoch of a bucket chosen by the address of the
+    /// atomic, so a notify wakes every waiter in the bucket.
+    //***************************************************************************
+    class atomic_wait_std
+    {
+    private:
+
+      struct bucket
+      {
+        std::mutex              access;
+        std::condition_variable condition;
+        uint32_t                epoch;
+        uint32_t                waiters;
+      };
+
+    public:
+
+      struct token_type
+      {
+        bucket*  p_bucket;
+        uint32_t epoch;
+      };
+
+      //*************************************************************************
+      /// Registers a waiter for the address.
+      /// Called before the value is checked, so no notify can be missed.
+      //*************************************************************************
+      static token_type prepare(const volatile void* address)
+      {
+        bucket& b = get_bucket(address);
+
+        std::lock_guard<std::mutex> lock(b.access);
+        ++b.waiters;
+
+        token_type token = { &b, b.epoch };
+
+        return token;
+      }
+
+      //*************************************************************************
+      /// Deregisters a waiter that did not need to wait.
+      //*************************************************************************
+      static void cancel(const token_type& token)
+      {
+        std::lock_guard<std::mutex> lock(token.p_bucket->access);
+        --token.p_bucket->waiters;
+      }
+
+      //*************************************************************************
+      /// Sleeps until notified, or for timeout_ms, then deregisters.
+      /// May return early.
+      //*************************************************************************
+      static void wait(const token_type& token, uint32_t timeout_ms)
+      {
+        bucket& b = *token.p_bucket;
+
+        std::unique_lock<std::mutex> lock(b.access);
+
+        if (b.epoch == token.epoch)
+        {
+          if (timeout_ms == UINT32_MAX)
+          {
+            b.condition.wait(lock);
+          }
+          else
+          {
+            b.condition.wait_for(lock, std::chrono::milliseconds(timeout_ms));
+          }
+        }
+
+        --b.waiters;
+      }
+
+      //*************************************************************************
+      /// Wakes the waiters for the address.
+      //*************************************************************************
+      static void notify_one(const volatile void* address)
+      {
+        notify_all(address);
+      }
+
+      //*************************************************************************
+      /// Wakes the waiters for the address.
+      //*************************************************************************
+      static void notify_all(const volatile void* address)
+      {
+        bucket& b = get_bucket(address);
+
+        bool waiting;
+
+        {
+          std::lock_guard<std::mutex> lock(b.access);
+          ++b.epoch;
+          waiting = (b.waiters != 0U);
+        }
+
+        if (waiting)
+        {
+          b.condition.notify_all();
+        }
+      }
+
+      //*************************************************************************
+      /// A monotonic millisecond count.
+      //*************************************************************************
+      static uint32_t now_ms()
+      {
+        return uint32_t(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+      }
+
+    private:
+
+      //*************************************************************************
+      static bucket& get_bucket(const volatile void* address)
+      {
+        static bucket buckets[ETL_ATOMIC_WAIT_BUCKETS];
+
+        return buckets[(reinterpret_cast<uintptr_t>(address) / sizeof(void*)) % ETL_ATOMIC_WAIT_BUCKETS];
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,330 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_ATOMIC_FLAGS_INCLUDED
+#define ETL_ATOMIC_FLAGS_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "atomic_wait.h"
+#include "flags.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup atomic_flags atomic_flags
+/// Flags based around an etl::atomic integral value, that may be shared
+/// between interrupts and threads without a critical section.
+/// Where atomic wait is available, threads may block until any or all of a
+/// set of bits are set, in the manner of an RTOS event group.
+///\ingroup atomic
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup atomic_flags
+  /// Atomic flags.
+  /// Modifiers return the value of the flags before the change.
+  //***************************************************************************
+  template <typename T, T MASK = etl::integral_limits<T>::max>
+  class atomic_flags
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value && etl::is_unsigned<T>::value, "Unsigned integral values only");
+
+    typedef T                   value_type;
+    typedef etl::flags<T, MASK> flags_type;
+
+    static ETL_CONSTANT value_type ALL_SET   = etl::integral_limits<value_type>::max & MASK;
+    static ETL_CONSTANT value_type ALL_CLEAR = 0;
+
+    static ETL_CONSTANT size_t NBITS = etl::integral_limits<value_type>::bits;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    atomic_flags() ETL_NOEXCEPT
+      : data(value_type(0))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    explicit atomic_flags(value_type pattern) ETL_NOEXCEPT
+      : data(value_type(pattern & MASK))
+    {
+    }
+
+    //*************************************************************************
+    /// The value of the flags.
+    //*************************************************************************
+    value_type value(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return data.load(order);
+    }
+
+    //*************************************************************************
+    /// A snapshot of the flags.
+    //*************************************************************************
+    flags_type load(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return flags_type(value(order));
+    }
+
+    //*************************************************************************
+    /// Sets the flags to the pattern.
+    //*************************************************************************
+    void store(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      data.store(value_type(pattern & MASK), order);
+    }
+
+    //*************************************************************************
+    /// Sets the flags to the pattern.
+    //*************************************************************************
+    value_type exchange(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return data.exchange(value_type(pattern & MASK), order);
+    }
+
+    //*************************************************************************
+    /// Are any of the bits in the pattern set?
+    //*************************************************************************
+    bool test(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return (value(order) & pattern) != value_type(0);
+    }
+
+    //*************************************************************************
+    /// Are all of the bits in the pattern set?
+    //*************************************************************************
+    bool all_of(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return (value(order) & (pattern & MASK)) == (pattern & MASK);
+    }
+
+    //*************************************************************************
+    /// Are any of the bits in the pattern set?
+    //*************************************************************************
+    bool any_of(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return (value(order) & (pattern & MASK)) != value_type(0);
+    }
+
+    //*************************************************************************
+    /// Are none of the bits in the pattern set?
+    //*************************************************************************
+    bool none_of(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return !any_of(pattern, order);
+    }
+
+    //*************************************************************************
+    /// Sets the bits in the pattern.
+    //*************************************************************************
+    value_type set(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return data.fetch_or(value_type(pattern & MASK), order);
+    }
+
+    //*************************************************************************
+    /// Clears the bits in the pattern.
+    //*************************************************************************
+    value_type reset(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return data.fetch_and(value_type(~pattern), order);
+    }
+
+    //*************************************************************************
+    /// Flips the bits in the pattern.
+    //*************************************************************************
+    value_type flip(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return data.fetch_xor(value_type(pattern & MASK), order);
+    }
+
+    //*************************************************************************
+    /// Clears all of the flags.
+    //*************************************************************************
+    value_type clear(etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return data.exchange(value_type(0), order);
+    }
+
+    //*************************************************************************
+    /// Sets the bits in the pattern.
+    /// Returns the bits of the pattern that were already set.
+    //*************************************************************************
+    value_type test_and_set(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return value_type(set(pattern, order) & pattern & MASK);
+    }
+
+    //*************************************************************************
+    /// Clears the bits in the pattern.
+    /// Returns the bits of the pattern that were set, and so were claimed by
+    /// this call. No other call can claim the same bits.
+    //*************************************************************************
+    value_type test_and_clear(value_type pattern, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return value_type(reset(pattern, order) & pattern & MASK);
+    }
+
+#if ETL_HAS_ATOMIC_WAIT
+    //*************************************************************************
+    /// Sets the bits in the pattern and wakes any waiting threads.
+    /// 'set' alone does not wake them.
+    //*************************************************************************
+    value_type set_and_notify(value_type pattern)
+    {
+      const value_type previous = set(pattern);
+
+      etl::atomic_notify_all(data);
+
+      return previous;
+    }
+
+    //*************************************************************************
+    /// Waits until any of the bits in the pattern are set.
+    /// If clear_on_exit is true then the bits are cleared as they are seen.
+    /// Returns the bits of the pattern that were set.
+    //*************************************************************************
+    value_type wait_any(value_type pattern, bool clear_on_exit = false)
+    {
+      return wait_any_for(pattern, etl::atomic_wait_forever, clear_on_exit);
+    }
+
+    //*************************************************************************
+    /// As wait_any, for up to timeout_ms.
+    /// Returns zero if timed out.
+    //*************************************************************************
+    value_type wait_any_for(value_type pattern, uint32_t timeout_ms, bool clear_on_exit = false)
+    {
+      return wait(pattern, false, timeout_ms, clear_on_exit);
+    }
+
+    //*************************************************************************
+    /// Waits until all of the bits in the pattern are set.
+    /// If clear_on_exit is true then the bits are cleared as they are seen.
+    /// Returns the pattern.
+    //*************************************************************************
+    value_type wait_all(value_type pattern, bool clear_on_exit = false)
+    {
+      return wait_all_for(pattern, etl::atomic_wait_forever, clear_on_exit);
+    }
+
+    //*************************************************************************
+    /// As wait_all, for up to timeout_ms.
+    /// Returns zero if timed out.
+    //*************************************************************************
+    value_type wait_all_for(value_type pattern, uint32_t timeout_ms, bool clear_on_exit = false)
+    {
+      return wait(pattern, true, timeout_ms, clear_on_exit);
+    }
+#endif
+
+  private:
+
+#if ETL_HAS_ATOMIC_WAIT
+    //*************************************************************************
+    /// True when the bits are set, having claimed them if clear_on_exit.
+    //*************************************************************************
+    struct bits_set
+    {
+      bool operator ()()
+      {
+        value_type current = p_data->load(etl::memory_order_acquire);
+
+        while (true)
+        {
+          const value_type matched = value_type(current & pattern);
+          const bool       ready   = wait_all ? (matched == pattern) : (matched != value_type(0));
+
+          if (!ready)
+          {
+            return false;
+          }
+
+          if (!clear_on_exit || p_data->compare_exchange_weak(current, value_type(current & ~pattern)))
+          {
+            result = matched;
+            return true;
+          }
+        }
+      }
+
+      etl::atomic<value_type>* p_data;
+      value_type               pattern;
+      bool                     wait_all;
+      bool                     clear_on_exit;
+      value_type               result;
+    };
+
+    //*************************************************************************
+    value_type wait(value_type pattern, bool wait_all, uint32_t timeout_ms, bool clear_on_exit)
+    {
+      bits_set predicate = { &data, value_type(pattern & MASK), wait_all, clear_on_exit, value_type(0) };
+
+      if (etl::private_atomic_wait::wait_until<etl::private_atomic_wait::platform>(&data, predicate, timeout_ms))
+      {
+        return predicate.result;
+      }
+
+      return value_type(0);
+    }
+#endif
+
+    // Disabled.
+    atomic_flags(const atomic_flags&) ETL_DELETE;
+    atomic_flags& operator =(const atomic_flags&) ETL_DELETE;
+
+    etl::atomic<value_type> data;
+  };
+
+  template <typename T, T MASK>
+  ETL_CONSTANT typename atomic_flags<T, MASK>::value_type atomic_flags<T, MASK>::ALL_SET;
+
+  template <typename T, T MASK>
+  ETL_CONSTANT typename atomic_flags<T, MASK>::value_type atomic_flags<T, MASK>::ALL_CLEAR;
+
+  template <typename T, T MASK>
+  ETL_CONSTANT size_t atomic_flags<T, MASK>::NBITS;
+}
+
+#endif
+#endif
@@ -0,0 +1,229 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_WAIT_INCLUDED
+#define ETL_ATOMIC_WAIT_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+
+#include <stdint.h>
+
+///\defgroup atomic_wait atomic_wait
+/// Blocking waits for a change of value of an etl::atomic, as the C++20
+/// std::atomic_wait and std::atomic_notify free functions, with timeouts.
+/// The sleep and wake are supplied by hooks for the target OS.
+/// CMSIS-RTOS2 uses thread flags, FreeRTOS uses task notifications and Linux
+/// uses futexes. Otherwise, with the STL, std::condition_variable is used.
+/// notify_one wakes every waiter for the address, as the one woken could be a
+/// waiter that had already seen the new value.
+///\ingroup atomic
+
+#if ETL_HAS_ATOMIC
+  #if defined(ETL_TARGET_OS_CMSIS_OS2)
+    #include "atomic/atomic_wait_cmsis_os2.h"
+    #define ETL_HAS_ATOMIC_WAIT 1
+  #elif defined(ETL_TARGET_OS_FREERTOS)
+    #include "atomic/atomic_wait_freertos.h"
+    #define ETL_HAS_ATOMIC_WAIT 1
+  #elif (defined(ETL_TARGET_OS_LINUX) || defined(__linux__)) && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG))
+    #include "atomic/atomic_wait_futex.h"
+    #define ETL_HAS_ATOMIC_WAIT 1
+  #elif ETL_USING_STL && ETL_USING_CPP11
+    #include "atomic/atomic_wait_std.h"
+    #define ETL_HAS_ATOMIC_WAIT 1
+  #else
+    #define ETL_HAS_ATOMIC_WAIT 0
+  #endif
+#else
+  #define ETL_HAS_ATOMIC_WAIT 0
+#endif
+
+namespace etl
+{
+  namespace traits
+  {
+    static ETL_CONSTANT bool has_atomic_wait = (ETL_HAS_ATOMIC_WAIT == 1);
+  }
+}
+
+#if ETL_HAS_ATOMIC_WAIT
+
+namespace etl
+{
+  /// The timeout that waits for ever.
+  static ETL_CONSTANT uint32_t atomic_wait_forever = UINT32_MAX;
+
+  namespace private_atomic_wait
+  {
+#if defined(ETL_TARGET_OS_CMSIS_OS2)
+    typedef atomic_wait_cmsis_os2 platform;
+#elif defined(ETL_TARGET_OS_FREERTOS)
+    typedef atomic_wait_freertos platform;
+#elif (defined(ETL_TARGET_OS_LINUX) || defined(__linux__)) && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG))
+    typedef atomic_wait_futex platform;
+#else
+    typedef atomic_wait_std platform;
+#endif
+
+    //*************************************************************************
+    /// Stops the old value taking part in deduction, as in std::atomic_wait.
+    //*************************************************************************
+    template <typename T>
+    struct value_of
+    {
+      typedef T type;
+    };
+
+    //*************************************************************************
+    /// Waits with the hooks in TPlatform until predicate() returns true.
+    /// The predicate is checked after each waiter is registered, so a notify
+    /// on the address between the check and the sleep is not missed.
+    /// The predicate may change the object, for example to claim a value.
+    //*************************************************************************
+    template <typename TPlatform, typename TPredicate>
+    bool wait_until(const volatile void* address, TPredicate& predicate, uint32_t timeout_ms)
+    {
+      if (predicate())
+      {
+        return true;
+      }
+
+      const uint32_t start = TPlatform::now_ms();
+
+      while (true)
+      {
+        typename TPlatform::token_type token = TPlatform::prepare(address);
+
+        if (predicate())
+        {
+          TPlatform::cancel(token);
+          return true;
+        }
+
+        uint32_t remaining = atomic_wait_forever;
+
+        if (timeout_ms != atomic_wait_forever)
+        {
+          const uint32_t elapsed = uint32_t(TPlatform::now_ms() - start);
+
+          if (elapsed >= timeout_ms)
+          {
+            TPlatform::cancel(token);
+            return false;
+          }
+
+          remaining = timeout_ms - elapsed;
+        }
+
+        TPlatform::wait(token, remaining);
+      }
+    }
+
+    //*************************************************************************
+    /// True when the value of the atomic is no longer old.
+    //*************************************************************************
+    template <typename T>
+    struct value_changed
+    {
+      value_changed(const etl::atomic<T>& object_, T old_, etl::memory_order order_)
+        : object(object_)
+        , old(old_)
+        , order(order_)
+      {
+      }
+
+      bool operator ()() const
+      {
+        return object.load(order) != old;
+      }
+
+      const etl::atomic<T>&   object;
+      const T                 old;
+      const etl::memory_order order;
+    };
+
+    //*************************************************************************
+    /// Waits with the hooks in TPlatform.
+    //*************************************************************************
+    template <typename TPlatform, typename T>
+    bool wait_for(const etl::atomic<T>& object, T old, uint32_t timeout_ms, etl::memory_order order)
+    {
+      value_changed<T> predicate(object, old, order);
+
+      return wait_until<TPlatform>(&object, predicate, timeout_ms);
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup atomic_wait
+  /// Blocks until the value of the atomic is no longer old and a notify has
+  /// been called, or the value was not old when called.
+  //***************************************************************************
+  template <typename T>
+  void atomic_wait(const etl::atomic<T>& object, typename private_atomic_wait::value_of<T>::type old, etl::memory_order order = etl::memory_order_seq_cst)
+  {
+    private_atomic_wait::wait_for<private_atomic_wait::platform>(object, old, atomic_wait_forever, order);
+  }
+
+  //***************************************************************************
+  ///\ingroup atomic_wait
+  /// As atomic_wait, for up to timeout_ms.
+  ///\return <b>true</b> if the value changed, <b>false</b> if timed out.
+  //***************************************************************************
+  template <typename T>
+  bool atomic_wait_for(const etl::atomic<T>& object, typename private_atomic_wait::value_of<T>::type old, uint32_t timeout_ms, etl::memory_order order = etl::memory_order_seq_cst)
+  {
+    return private_atomic_wait::wait_for<private_atomic_wait::platform>(object, old, timeout_ms, order);
+  }
+
+  //***************************************************************************
+  ///\ingroup atomic_wait
+  /// Wakes the waiters on the atomic. Call after changing its value.
+  //***************************************************************************
+  template <typename T>
+  void atomic_notify_one(const etl::atomic<T>& object)
+  {
+    private_atomic_wait::platform::notify_one(&object);
+  }
+
+  //***************************************************************************
+  ///\ingroup atomic_wait
+  /// Wakes the waiters on the atomic. Call after changing its value.
+  //***************************************************************************
+  template <typename T>
+  void atomic_notify_all(const etl::atomic<T>& object)
+  {
+    private_atomic_wait::platform::notify_all(&object);
+  }
+}
+
+#endif
+#endif
@@ -74,114 +74,261 @@ namespace etl
     }
   };
 
-  //*************************************************************************
-  /// Codec for Base64
-  //*************************************************************************
-  class base64
+  //***************************************************************************
+  /// Invalid character exception.
+  //***************************************************************************
+  class base64_invalid_data : public base64_exception
   {
   public:
 
+    base64_invalid_data(string_type file_name_, numeric_type line_number_)
+      : base64_exception(ETL_ERROR_TEXT("base64:invalid data", ETL_BASE64_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_base64
+  {
+    // Sextet lookup for decoding. Characters that are not in the alphabet map to Invalid_Sextet.
+#define ETL_BASE64_DECODE_TABLE \
+  { \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3E, 0x80, 0x80, 0x80, 0x3F, \
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, \
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, \
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, \
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80  \
+  }
+
     //*************************************************************************
-    /// Encode to Base64 from and to pointer/length
+    /// The block codec shared by etl::base64, etl::base64_encoder and etl::base64_decoder.
+    /// Encoding converts whole 3 byte groups to 4 characters and decoding converts
+    /// whole 4 character groups to 3 bytes, without any per-sextet state.
     //*************************************************************************
-    template <typename T>
-    ETL_CONSTEXPR14
-    static 
-    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type 
-      encode(const T* input, size_t input_length, char* output, size_t output_length)
+    template <typename TDummy = void>
+    struct codec
     {
-      if (input_length == 0U)
+      static ETL_CONSTANT uint8_t Invalid_Sextet = 0x80U;
+
+#if ETL_USING_CPP11
+      static ETL_CONSTANT uint8_t decode_table[256U] = ETL_BASE64_DECODE_TABLE;
+#else
+      static ETL_CONSTANT uint8_t decode_table[256U];
+#endif
+
+      //***********************************
+      /// Gets the padding character
+      //***********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR14
+      static char padding()
       {
-        return 0;
+        return '=';
       }
 
-      // Figure out if the output buffer is large enough.
-      size_t required_output_length = encode_size(input_length);
+      //***********************************
+      /// Translates an index into a sextet
+      //***********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR14
+      static char get_sextet_from_index(uint32_t index)
+      {
+        return "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"[index & 0x3FU];
+      }
 
-      ETL_ASSERT_OR_RETURN_VALUE(output_length >= required_output_length, ETL_ERROR(base64_overflow), 0U);
+      //***********************************
+      /// Translates a sextet into an index.
+      /// Returns Invalid_Sextet for characters outside of the alphabet.
+      //***********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR14
+      static uint8_t get_index_from_sextet(char sextet)
+      {
+        return decode_table[static_cast<uint8_t>(sextet)];
+      }
+
+      //***********************************
+      /// Encodes 3 bytes to 4 characters.
+      //***********************************
+      template <typename T>
+      ETL_CONSTEXPR14
+      static void encode_block(const T* p_in, char* p_out)
+      {
+        const uint32_t value = (static_cast<uint32_t>(static_cast<uint8_t>(p_in[0])) << 16) |
+                               (static_cast<uint32_t>(static_cast<uint8_t>(p_in[1])) << 8)  |
+                               (static_cast<uint32_t>(static_cast<uint8_t>(p_in[2])));
+
+        p_out[0] = get_sextet_from_index(value >> 18);
+        p_out[1] = get_sextet_from_index(value >> 12);
+        p_out[2] = get_sextet_from_index(value >> 6);
+        p_out[3] = get_sextet_from_index(value);
+      }
 
-      const T* p_in     = input;
-      const T* p_in_end = input + input_length;
+      //***********************************
+      /// Encodes the final 1 or 2 bytes to 4 characters, including padding.
+      //***********************************
+      template <typename T>
+      ETL_CONSTEXPR14
+      static void encode_tail(const T* p_in, size_t length, char* p_out)
+      {
+        uint32_t value = static_cast<uint32_t>(static_cast<uint8_t>(p_in[0])) << 16;
 
-      char* p_out     = output;
-      char* p_out_end = output + required_output_length;
+        if (length == 2U)
+        {
+          value |= static_cast<uint32_t>(static_cast<uint8_t>(p_in[1])) << 8;
+        }
 
-      int next_sextet = First_Sextet;
+        p_out[0] = get_sextet_from_index(value >> 18);
+        p_out[1] = get_sextet_from_index(value >> 12);
+        p_out[2] = (length == 2U) ? get_sextet_from_index(value >> 6) : padding();
+        p_out[3] = padding();
+      }
 
-      // Step through the input buffer, creating the output sextets.
-      while (p_in != p_in_end)
+      //***********************************
+      /// Encodes a whole buffer, padding the final group.
+      /// The output must have room for encode_size(length) characters.
+      //***********************************
+      template <typename T>
+      ETL_CONSTEXPR14
+      static char* encode(const T* p_in, size_t length, char* p_out)
       {
-        T c = *p_in;
-        char  index = 0;
+        const T* const p_in_end = p_in + (length - (length % 3U));
 
-        switch (next_sextet)
+        while (p_in != p_in_end)
         {
-          //**************************
-          case First_Sextet:
-          {
-            index = static_cast<char>((*p_in & b11111100) >> 2);
-            next_sextet = Second_Sextet;
-            break;
-          }
+          encode_block(p_in, p_out);
+          p_in  += 3;
+          p_out += 4;
+        }
 
-          //**************************
-          case Second_Sextet:
-          {
-            index = static_cast<char>((c & b00000011) << 4);
-            ++p_in;
+        if ((length % 3U) != 0U)
+        {
+          encode_tail(p_in, length % 3U, p_out);
+          p_out += 4;
+        }
 
-            // Next byte valid?
-            if (p_in != p_in_end)
-            {
-              index = index | ((*p_in & b11110000) >> 4);
-            }
-            next_sextet = Third_Sextet;
-            break;
-          }
+        return p_out;
+      }
 
-          //**************************
-          case Third_Sextet:
-          {
-            index = (c & b00001111) << 2;
-            ++p_in;
+      //***********************************
+      /// Decodes 4 characters to 3 bytes.
+      /// Returns false, without writing, if any of the characters are not in the alphabet.
+      //***********************************
+      template <typename T>
+      ETL_CONSTEXPR14
+      static bool decode_block(const char* p_in, T* p_out)
+      {
+        const uint8_t a = get_index_from_sextet(p_in[0]);
+        const uint8_t b = get_index_from_sextet(p_in[1]);
+        const uint8_t c = get_index_from_sextet(p_in[2]);
+        const uint8_t d = get_index_from_sextet(p_in[3]);
 
-            // Next byte valid?
-            if (p_in != p_in_end)
-            {
-              index = index | static_cast<char>((*p_in & b11000000) >> 6);
-            }
-            next_sextet = Fourth_Sextet;
-            break;
-          }
+        if (((a | b | c | d) & Invalid_Sextet) != 0U)
+        {
+          return false;
+        }
 
-          //**************************
-          case Fourth_Sextet:
-          {
-            index = static_cast<char>(c & b00111111);
-            ++p_in;
-            next_sextet = First_Sextet;
-            break;
-          }
+        const uint32_t value = (static_cast<uint32_t>(a) << 18) |
+                               (static_cast<uint32_t>(b) << 12) |
+                               (static_cast<uint32_t>(c) << 6)  |
+                               (static_cast<uint32_t>(d));
 
-          //**************************
-          default:
-          {
-            // Should never get here.
-            assert(false);
-            break;
-          }
+        p_out[0] = static_cast<T>(static_cast<uint8_t>(value >> 16));
+        p_out[1] = static_cast<T>(static_cast<uint8_t>(value >> 8));
+        p_out[2] = static_cast<T>(static_cast<uint8_t>(value));
+
+        return true;
+      }
+
+      //***********************************
+      /// Decodes the final 2 or 3 characters of a group to 1 or 2 bytes.
+      /// Returns false, without writing, if the group is not valid.
+      //***********************************
+      template <typename T>
+      ETL_CONSTEXPR14
+      static bool decode_tail(const char* p_in, size_t length, T* p_out)
+      {
+        if ((length < 2U) || (length > 3U))
+        {
+          return false;
+        }
+
+        const uint8_t a = get_index_from_sextet(p_in[0]);
+        const uint8_t b = get_index_from_sextet(p_in[1]);
+        const uint8_t c = (length == 3U) ? get_index_from_sextet(p_in[2]) : static_cast<uint8_t>(0U);
+
+        if (((a | b | c) & Invalid_Sextet) != 0U)
+        {
+          return false;
+        }
+
+        const uint32_t value = (static_cast<uint32_t>(a) << 18) |
+                               (static_cast<uint32_t>(b) << 12) |
+                               (static_cast<uint32_t>(c) << 6);
+
+        p_out[0] = static_cast<T>(static_cast<uint8_t>(value >> 16));
+
+        if (length == 3U)
+        {
+          p_out[1] = static_cast<T>(static_cast<uint8_t>(value >> 8));
         }
 
-        *p_out = get_sextet_from_index(index);
-        ++p_out;
+        return true;
       }
+    };
+
+    template <typename TDummy>
+    ETL_CONSTANT uint8_t codec<TDummy>::Invalid_Sextet;
+
+#if ETL_USING_CPP11
+    template <typename TDummy>
+    ETL_CONSTANT uint8_t codec<TDummy>::decode_table[256U];
+#else
+    template <typename TDummy>
+    ETL_CONSTANT uint8_t codec<TDummy>::decode_table[256U] = ETL_BASE64_DECODE_TABLE;
+#endif
 
-      // Pad out the end of the output buffer.
-      while (p_out != p_out_end)
+#undef ETL_BASE64_DECODE_TABLE
+  }
+
+  //*************************************************************************
+  /// Codec for Base64
+  //*************************************************************************
+  class base64
+  {
+  public:
+
+    //*************************************************************************
+    /// Encode to Base64 from and to pointer/length
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    static 
+    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type 
+      encode(const T* input, size_t input_length, char* output, size_t output_length)
+    {
+      if (input_length == 0U)
       {
-        *p_out++ = padding();
+        return 0;
       }
 
+      // Figure out if the output buffer is large enough.
+      size_t required_output_length = encode_size(input_length);
+
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= required_output_length, ETL_ERROR(base64_overflow), 0U);
+
+      char* p_out = private_base64::codec<>::encode(input, input_length, output);
+
       return static_cast<size_t>(etl::distance(output, p_out));
     }
 
@@ -254,7 +401,7 @@ namespace etl
       encode(const etl::span<const T, Length1>& input_span,
              etl::istring& output)
     {
-      output.resize(etl::base64::encode_size(Length1));
+      output.resize(etl::base64::encode_size(input_span.size()));
 
       return encode(input_span.begin(), input_span.size(),
                     output.data(),      output.size());
@@ -268,17 +415,7 @@ namespace etl
     static
     size_t encode_size(size_t input_length)
     {
-      size_t required_output_length = (input_length * 8U) / 6U;
-
-      if ((input_length % 3U) != 0U)
-      {
-        while ((required_output_length % 4U) != 0)
-        {
-          ++required_output_length;
-        }
-      }
-
-      return required_output_length;
+      return ((input_length + 2U) / 3U) * 4U;
     }
 
     //*************************************************************************
@@ -300,73 +437,32 @@ namespace etl
 
       ETL_ASSERT_OR_RETURN_VALUE(output_length >= required_output_length, ETL_ERROR(base64_overflow), 0U);
 
+      // Only the characters before any padding carry data.
       const char* p_in     = input;
-      const char* p_in_end = input + input_length;
+      const char* p_in_end = etl::find(input, input + input_length, padding());
 
-      T* p_out = output;
+      const size_t length = static_cast<size_t>(etl::distance(p_in, p_in_end));
+      const char* const p_blocks_end = p_in + (length - (length % 4U));
 
-      T c = 0;
-      int next_sextet = First_Sextet;
+      T* p_out = output;
 
-      // Step through the input buffer, creating the output binary.
-      while (p_in != p_in_end)
+      // Whole groups.
+      while (p_in != p_blocks_end)
       {
-        char sextet = *p_in++; // Get the sextet as a T.
-
-        if (sextet == padding())
-        {
-          break;
-        }
-
-        char index = get_index_from_sextet(sextet);
-
-        switch (next_sextet)
-        {
-          //**************************
-          case First_Sextet:
-          {
-            c = (index & b00111111) << 2;
-            next_sextet = Second_Sextet;
-            break;
-          }
-
-          //**************************
-          case Second_Sextet:
-          {
-            c |= (index & b00110000) >> 4;
-            *p_out++ = static_cast<T>(c);
-            c = (index & b00001111) << 4;
-            next_sextet = Third_Sextet;
-            break;
-          }
-
-          //**************************
-          case Third_Sextet:
-          {
-            c |= (index & b00111100) >> 2;
-            *p_out++ = static_cast<T>(c);
-            c = (index & b00000011) << 6;
-            next_sextet = Fourth_Sextet;
-            break;
-          }
+        ETL_ASSERT_OR_RETURN_VALUE(private_base64::codec<>::decode_block(p_in, p_out), ETL_ERROR(base64_invalid_data),
+                                   static_cast<size_t>(etl::distance(output, p_out)));
+        p_in  += 4;
+        p_out += 3;
+      }
 
-          //**************************
-          case Fourth_Sextet:
-          {
-            c |= (index & b00111111);
-            *p_out++ = static_cast<T>(c);
-            next_sextet = First_Sextet;
-            break;
-          }
+      // The final partial group.
+      if (p_in != p_in_end)
+      {
+        const size_t remaining = static_cast<size_t>(etl::distance(p_in, p_in_end));
 
-          //**************************
-          default:
-          {
-            // Should never get here.
-            assert(false);
-            break;
-          }
-        }
+        ETL_ASSERT_OR_RETURN_VALUE(private_base64::codec<>::decode_tail(p_in, remaining, p_out), ETL_ERROR(base64_invalid_data),
+                                   static_cast<size_t>(etl::distance(output, p_out)));
+        p_out += remaining - 1U;
       }
 
       return static_cast<size_t>(etl::distance(output, p_out));
@@ -411,112 +507,348 @@ namespace etl
         return 0U;
       }
 
-      // Figure out the minimum output buffer size.
-      size_t length = static_cast<size_t>(etl::distance(input, etl::find(input, input + input_length, padding())) - 1);
-      size_t required_output_length = length - (length / 4U);
+      // Every 4 characters before any padding carry 3 bytes.
+      size_t length = static_cast<size_t>(etl::distance(input, etl::find(input, input + input_length, padding())));
 
-      return required_output_length;
+      return (length * 3U) / 4U;
     }
 
   private:
 
     //*************************************************************************
-    /// Sextet index id.
-    enum
+    /// Gets the padding character
+    //*************************************************************************
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    static char padding()
     {
-      First_Sextet,
-      Second_Sextet,
-      Third_Sextet,
-      Fourth_Sextet
-    };
+      return private_base64::codec<>::padding();
+    }
+  };
 
-    // Sextets
-    // 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
-    // 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-    // 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
-    // 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
-    // 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
-    // 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
-    // 'w', 'x', 'y', 'z', '0', '1', '2', '3',
-    // '4', '5', '6', '7', '8', '9', '+', '/'
+  //*************************************************************************
+  /// Incremental encoder for Base64.
+  /// Input may be supplied in chunks of any size. Up to two bytes are held
+  /// between calls until a whole 3 byte group is available.
+  /// Call finish() after the last chunk to write the final group and padding.
+  //*************************************************************************
+  class base64_encoder
+  {
+  public:
 
     //*************************************************************************
-    // Translates an index into a sextet
+    /// Constructor
     //*************************************************************************
-    ETL_CONSTEXPR14 static char get_sextet_from_index(char index)
+    base64_encoder()
+      : n_pending(0U)
     {
-      if ((index >= 0) && (index < 26))
-      {
-        return 'A' + index;
-      }
-      else if ((index >= 26) && (index < 52))
-      {
-        index -= 26;
-        return 'a' + index;
-      }
-      else if ((index >= 52) && (index < 62))
-      {
-        index -= 52;
-        return '0' + index;
-      }
-      else if (index == 62)
-      {
-        return '+';
-      }
-      else if (index == 63)
-      {
-        return '/';
-      }
-      else
-      {
-        // Should never get here.
-        assert(false);
-        return padding();
-      }
     }
 
     //*************************************************************************
-    // Translates a sextet into an index 
+    /// Discards any held bytes, ready for a new stream.
     //*************************************************************************
-    ETL_CONSTEXPR14 static char get_index_from_sextet(char sextet)
+    void reset()
     {
-      if ((sextet >= 'A') && (sextet <= 'Z'))
-      {
-        return sextet - 'A';
-      }
-      else if ((sextet >= 'a') && (sextet <= 'z'))
+      n_pending = 0U;
+    }
+
+    //*************************************************************************
+    /// Encode the next chunk from and to pointer/length.
+    /// Returns the number of characters written.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type
+      encode(const T* input, size_t input_length, char* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= encode_size(input_length), ETL_ERROR(base64_overflow), 0U);
+
+      char* p_out = output;
+
+      // Complete a group with the bytes held from the last call.
+      if (n_pending != 0U)
       {
-        return sextet - 'a' + 26;
+        while ((n_pending < 3U) && (input_length != 0U))
+        {
+          pending[n_pending++] = static_cast<uint8_t>(*input++);
+          --input_length;
+        }
+
+        if (n_pending == 3U)
+        {
+          private_base64::codec<>::encode_block(pending, p_out);
+          p_out    += 4;
+          n_pending = 0U;
+        }
       }
-      else if ((sextet >= '0') && (sextet <= '9'))
+
+      // Whole groups directly from the input.
+      const size_t whole_length = input_length - (input_length % 3U);
+
+      p_out         = private_base64::codec<>::encode(input, whole_length, p_out);
+      input        += whole_length;
+      input_length -= whole_length;
+
+      // Hold the remainder for the next call.
+      while (input_length != 0U)
       {
-        return sextet - '0' + 52;
+        pending[n_pending++] = static_cast<uint8_t>(*input++);
+        --input_length;
       }
-      else if (sextet == '+')
+
+      return static_cast<size_t>(etl::distance(output, p_out));
+    }
+
+    //*************************************************************************
+    /// Encode the next chunk from and to span/span.
+    /// Returns the number of characters written.
+    //*************************************************************************
+    template <typename T, size_t Length1, size_t Length2>
+    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type
+      encode(const etl::span<const T, Length1>& input_span,
+             const etl::span<char, Length2>&    output_span)
+    {
+      return encode(input_span.data(),  input_span.size(),
+                    output_span.data(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// Writes the final group, with padding, to pointer/length.
+    /// Returns the number of characters written.
+    //*************************************************************************
+    size_t finish(char* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= finish_size(), ETL_ERROR(base64_overflow), 0U);
+
+      if (n_pending == 0U)
       {
-        return 62;
+        return 0U;
       }
-      else if (sextet == '/')
+
+      private_base64::codec<>::encode_tail(pending, n_pending, output);
+      n_pending = 0U;
+
+      return 4U;
+    }
+
+    //*************************************************************************
+    /// Writes the final group, with padding, to a span.
+    /// Returns the number of characters written.
+    //*************************************************************************
+    template <size_t Length>
+    size_t finish(const etl::span<char, Length>& output_span)
+    {
+      return finish(output_span.data(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// The number of characters that encode() will write for the next input_length bytes.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t encode_size(size_t input_length) const
+    {
+      return ((n_pending + input_length) / 3U) * 4U;
+    }
+
+    //*************************************************************************
+    /// The number of characters that finish() will write.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t finish_size() const
+    {
+      return (n_pending == 0U) ? 0U : 4U;
+    }
+
+  private:
+
+    uint8_t pending[3];
+    size_t  n_pending;
+  };
+
+  //*************************************************************************
+  /// Incremental decoder for Base64.
+  /// Input may be supplied in chunks of any size. Up to three characters are held
+  /// between calls until a whole 4 character group is available.
+  /// Call finish() after the last chunk to write the final partial group.
+  //*************************************************************************
+  class base64_decoder
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    base64_decoder()
+      : n_pending(0U)
+      , padded(false)
+      , invalid(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Discards any held characters and errors, ready for a new stream.
+    //*************************************************************************
+    void reset()
+    {
+      n_pending = 0U;
+      padded    = false;
+      invalid   = false;
+    }
+
+    //*************************************************************************
+    /// Decode the next chunk from and to pointer/length.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type
+      decode(const char* input, size_t input_length, T* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!invalid, ETL_ERROR(base64_invalid_data), 0U);
+      // Only the characters before any padding can complete a group.
+      const size_t data_length = static_cast<size_t>(etl::distance(input, etl::find(input, input + input_length, private_base64::codec<>::padding())));
+
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= decode_size(data_length), ETL_ERROR(base64_overflow), 0U);
+
+      const char*       p_in     = input;
+      const char* const p_in_end = input + input_length;
+
+      T* p_out = output;
+
+      while (p_in != p_in_end)
       {
-        return 63;
+        // Whole groups directly from the input.
+        if ((n_pending == 0U) && !padded)
+        {
+          while ((etl::distance(p_in, p_in_end) >= 4) && private_base64::codec<>::decode_block(p_in, p_out))
+          {
+            p_in  += 4;
+            p_out += 3;
+          }
+
+          if (p_in == p_in_end)
+          {
+            break;
+          }
+        }
+
+        // One character at a time for groups split across calls, padding and errors.
+        const char c = *p_in++;
+
+        if (c == private_base64::codec<>::padding())
+        {
+          // Padding may only follow two or three characters of a group.
+          invalid = !padded && (n_pending < 2U);
+          padded  = true;
+        }
+        else
+        {
+          // Nothing may follow padding.
+          invalid = padded || (private_base64::codec<>::get_index_from_sextet(c) == private_base64::codec<>::Invalid_Sextet);
+
+          if (!invalid)
+          {
+            pending[n_pending++] = c;
+
+            if (n_pending == 4U)
+            {
+              private_base64::codec<>::decode_block(pending, p_out);
+              p_out    += 3;
+              n_pending = 0U;
+            }
+          }
+        }
+
+        ETL_ASSERT_OR_RETURN_VALUE(!invalid, ETL_ERROR(base64_invalid_data), static_cast<size_t>(etl::distance(output, p_out)));
       }
-      else
+
+      return static_cast<size_t>(etl::distance(output, p_out));
+    }
+
+    //*************************************************************************
+    /// Decode the next chunk from and to span/span.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    template <typename T, size_t Length1, size_t Length2>
+    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type
+      decode(const etl::span<const char, Length1>& input_span,
+             const etl::span<T, Length2>&          output_span)
+    {
+      return decode(input_span.data(),  input_span.size(),
+                    output_span.data(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// Writes the final partial group to pointer/length, ready for a new stream.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type
+      finish(T* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!invalid, ETL_ERROR(base64_invalid_data), 0U);
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= finish_size(), ETL_ERROR(base64_overflow), 0U);
+
+      size_t length = 0U;
+
+      if (n_pending != 0U)
       {
-        // Should never get here.
-        assert(false);
-        return 0;
+        invalid = !private_base64::codec<>::decode_tail(pending, n_pending, output);
+
+        ETL_ASSERT_OR_RETURN_VALUE(!invalid, ETL_ERROR(base64_invalid_data), 0U);
+
+        length = n_pending - 1U;
       }
+
+      n_pending = 0U;
+      padded    = false;
+
+      return length;
     }
 
     //*************************************************************************
-    /// Gets the padding character
+    /// Writes the final partial group to a span, ready for a new stream.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    template <typename T, size_t Length>
+    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type
+      finish(const etl::span<T, Length>& output_span)
+    {
+      return finish(output_span.data(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// The maximum number of bytes that decode() will write for the next input_length characters.
+    /// Padding characters do not write, so this may be an overestimate for the final chunk.
     //*************************************************************************
     ETL_NODISCARD
-    ETL_CONSTEXPR14
-    static char padding()
+    size_t decode_size(size_t input_length) const
+    {
+      return ((n_pending + input_length) / 4U) * 3U;
+    }
+
+    //*************************************************************************
+    /// The number of bytes that finish() will write.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t finish_size() const
+    {
+      return (n_pending > 1U) ? (n_pending - 1U) : 0U;
+    }
+
+    //*************************************************************************
+    /// Returns true if invalid input has been found since the last reset.
+    //*************************************************************************
+    ETL_NODISCARD
+    bool error() const
     {
-      return '=';
+      return invalid;
     }
+
+  private:
+
+    char   pending[4];
+    size_t n_pending;
+    bool   padded;
+    bool   invalid;
   };
 }
 
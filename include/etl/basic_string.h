@@ -48,6 +48,8 @@ SOFTWARE.
 #include "binary.h"
 #include "flags.h"
 
+#include "private/string_search.h"
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -316,6 +318,9 @@ namespace etl
 #endif
   };
 
+  template <typename T>
+  class basic_string_builder;
+
   //***************************************************************************
   /// The base class for specifically sized strings.
   /// Can be used as a reference type for all strings containing a specific type.
@@ -340,6 +345,8 @@ namespace etl
 
     typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
 
+    friend class etl::basic_string_builder<T>;
+
     //*********************************************************************
     /// Returns an iterator to the beginning of the string.
     ///\return An iterator to the beginning of the string.
@@ -502,6 +509,41 @@ namespace etl
       p_buffer[new_size] = 0;
     }
 
+    //*********************************************************************
+    /// Resizes the string and lets 'operation' write the contents directly
+    /// into the buffer, in the style of std::basic_string::resize_and_overwrite.
+    /// 'operation' is called as operation(pointer, size_type) with the buffer
+    /// and the size, limited to the capacity, and returns the number of
+    /// characters it wrote. The characters up to the size are uninitialised
+    /// beyond the current contents.
+    ///\param new_size  The requested size.
+    ///\param operation The operation that writes the characters.
+    //*********************************************************************
+    template <typename TOperation>
+    void resize_and_overwrite(size_type new_size, TOperation operation)
+    {
+      if (new_size > CAPACITY)
+      {
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+        set_truncated(true);
+
+#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
+        ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
+#endif
+#endif
+      }
+
+      new_size = etl::min(new_size, CAPACITY);
+
+      const size_type written = static_cast<size_type>(operation(p_buffer, new_size));
+
+      ETL_ASSERT(written <= new_size, ETL_ERROR(string_out_of_bounds));
+
+      current_size = etl::min(written, new_size);
+      p_buffer[current_size] = 0;
+      cleanup();
+    }
+
     //*********************************************************************
     /// Fills the string with the specified character.
     /// Does not change the string length.
@@ -702,22 +744,7 @@ namespace etl
     //*********************************************************************
     void assign(const_pointer other)
     {
-      initialise();
-
-      while ((*other != 0) && (current_size < CAPACITY))
-      {
-        p_buffer[current_size++] = *other++;
-      }
-
-#if ETL_HAS_STRING_TRUNCATION_CHECKS
-      set_truncated(*other != 0);
-
-#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
-      ETL_ASSERT(flags.test<IS_TRUNCATED>() == false, ETL_ERROR(string_truncation));
-#endif
-#endif
-
-      p_buffer[current_size] = 0;
+      assign(other, etl::strlen(other));
     }
 
     //*********************************************************************
@@ -740,7 +767,10 @@ namespace etl
 
       length_ = etl::min(length_, CAPACITY);
 
-      etl::copy_n(other, length_, begin());
+      if (length_ != 0U)
+      {
+        memmove(p_buffer, other, length_ * sizeof(T));
+      }
 
       current_size = length_;
       p_buffer[current_size] = 0;
@@ -761,22 +791,7 @@ namespace etl
       ETL_ASSERT(d >= 0, ETL_ERROR(string_iterator));
 #endif
 
-      initialise();
-
-      while ((first != last) && (current_size != CAPACITY))
-      {
-        p_buffer[current_size++] = *first++;
-      }
-
-      p_buffer[current_size] = 0;
-
-#if ETL_HAS_STRING_TRUNCATION_CHECKS
-      set_truncated(first != last);
-
-#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
-      ETL_ASSERT(flags.test<IS_TRUNCATED>() == false, ETL_ERROR(string_truncation));
-#endif
-#endif
+      assign_range(first, last, etl::integral_constant<bool, is_character_pointer<TIterator>::value>());
     }
 
     //*********************************************************************
@@ -854,7 +869,7 @@ namespace etl
     //*********************************************************************
     ibasic_string& append(const ibasic_string& str)
     {
-      insert(end(), str.begin(), str.end());
+      append_characters(str.data(), str.size());
 
 #if ETL_HAS_STRING_TRUNCATION_CHECKS
       if (str.is_truncated())
@@ -891,7 +906,7 @@ namespace etl
     //*********************************************************************
     ibasic_string& append(const T* str)
     {
-      insert(size(), str);
+      append_characters(str, etl::strlen(str));
       return *this;
     }
 
@@ -902,7 +917,7 @@ namespace etl
     //*********************************************************************
     ibasic_string& append(const T* str, size_type n)
     {
-      insert(size(), str, n);
+      append_characters(str, n);
       return *this;
     }
 
@@ -1075,88 +1090,7 @@ namespace etl
     template <typename TIterator>
     iterator insert(const_iterator position, TIterator first, TIterator last)
     {
-      iterator position_ = to_iterator(position);
-
-      if (first == last)
-      {
-        return position_;
-      }
-
-      const size_type start = etl::distance(begin(), position_);
-      const size_type n = etl::distance(first, last);
-
-      // No effect.
-      if (start >= CAPACITY)
-      {
-#if ETL_HAS_STRING_TRUNCATION_CHECKS
-        set_truncated(true);
-
-#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
-        ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
-#endif
-#endif
-        return position_;
-      }
-
-      // Fills the string to the end?
-      if ((start + n) >= CAPACITY)
-      {
-        if (((current_size + n) > CAPACITY))
-        {
-#if ETL_HAS_STRING_TRUNCATION_CHECKS
-          set_truncated(true);
-
-#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
-          ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
-#endif
-#endif
-        }
-
-        current_size = CAPACITY;
-
-        while (position_ != end())
-        {
-          *position_++ = *first++;
-        }
-      }
-      else
-      {
-        // Lets do some shifting.
-        const size_type shift_amount = n;
-        const size_type to_position = start + shift_amount;
-        const size_type remaining_characters = current_size - start;
-        const size_type max_shift_characters = CAPACITY - start - shift_amount;
-        const size_type characters_to_shift = etl::min(max_shift_characters, remaining_characters);
-
-        // Will the string truncate?
-        if ((start + shift_amount + remaining_characters) > CAPACITY)
-        {
-          current_size = CAPACITY;
-
-#if ETL_HAS_STRING_TRUNCATION_CHECKS
-          set_truncated(true);
-
-#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
-          ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
-#endif
-#endif
-        }
-        else
-        {
-          current_size += shift_amount;
-        }
-
-        etl::copy_backward(position_, position_ + characters_to_shift, begin() + to_position + characters_to_shift);
-
-        while (first != last)
-        {
-          *position_++ = *first++;
-        }
-      }
-
-      p_buffer[current_size] = 0;
-
-      return position_;
+      return insert_range(to_iterator(position), first, last, etl::integral_constant<bool, is_character_pointer<TIterator>::value>());
     }
 
     //*********************************************************************
@@ -1374,21 +1308,7 @@ namespace etl
     //*********************************************************************
     size_type find(const ibasic_string<T>& str, size_type pos = 0) const
     {
-      if ((pos + str.size()) > size())
-      {
-        return npos;
-      }
-
-      const_iterator iposition = etl::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find_text(str.data(), pos, str.size());
     }
 
     //*********************************************************************
@@ -1398,23 +1318,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos = 0) const
     {
-#if ETL_IS_DEBUG_BUILD
-      if ((pos + etl::strlen(s)) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find_text(s, pos, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1425,23 +1329,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos, size_type n) const
     {
-#if ETL_IS_DEBUG_BUILD
-      if ((pos + etl::strlen(s) - n) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + n);
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find_text(s, pos, n);
     }
 
     //*********************************************************************
@@ -1451,16 +1339,14 @@ namespace etl
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return etl::distance(begin(), i);
-      }
-      else
+      if (position >= size())
       {
         return npos;
       }
+
+      const size_type i = private_string_search::find_char(p_buffer + position, size() - position, c);
+
+      return (i == private_string_search::npos) ? npos : position + i;
     }
 
     //*********************************************************************
@@ -1470,28 +1356,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const ibasic_string<T>& str, size_type position = npos) const
     {
-      if ((str.size()) > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator iposition = etl::search(rbegin() + position, rend(), str.rbegin(), str.rend());
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - str.size() - etl::distance(rbegin(), iposition);
-      }
+      return rfind_text(str.data(), position, str.size());
     }
 
     //*********************************************************************
@@ -1501,33 +1366,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const_pointer s, size_type position = npos) const
     {
-      size_type len = etl::strlen(s);
-
-      if (len > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + len);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = etl::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - len - etl::distance(rbegin(), iposition);
-      }
+      return rfind_text(s, position, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1537,31 +1376,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const_pointer s, size_type position, size_type length_) const
     {
-      if (length_ > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + length_);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = etl::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - length_ - etl::distance(rbegin(), iposition);
-      }
+      return rfind_text(s, position, length_);
     }
 
     //*********************************************************************
@@ -1571,23 +1386,10 @@ namespace etl
     //*********************************************************************
     size_type rfind(T c, size_type position = npos) const
     {
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
+      // Searches the characters before position.
+      const size_type i = private_string_search::rfind_char(p_buffer, etl::min(position, size()), c);
 
-      const_reverse_iterator i = etl::find(rbegin() + position, rend(), c);
-
-      if (i != rend())
-      {
-        return size() - etl::distance(rbegin(), i) - 1;
-      }
-      else
-      {
-        return npos;
-      }
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     //*********************************************************************
@@ -1603,16 +1405,23 @@ namespace etl
       // Limit the length.
       length_ = etl::min(length_, size() - position);
 
-      // Erase the bit we want to replace.
-      erase(position, length_);
-
-      // Insert the new stuff.
-      insert(position, str);
+      replace_characters(position, length_, str.data(), str.size());
 
-      return *this;
-    }
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+      if (str.is_truncated())
+      {
+        set_truncated(true);
 
-    //*********************************************************************
+#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
+        ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
+#endif
+      }
+#endif
+
+      return *this;
+    }
+
+    //*********************************************************************
     /// Replace characters from 'first' to one before 'last' with 'str'.
     ///\param first The position to start from.
     ///\param last  The one after the position to end at.
@@ -1624,11 +1433,7 @@ namespace etl
       iterator first_ = to_iterator(first);
       iterator last_ = to_iterator(last);
 
-      // Erase the bit we want to replace.
-      erase(first_, last_);
-
-      // Insert the new stuff.
-      insert(first_, str.begin(), str.end());
+      replace_characters(etl::distance(begin(), first_), etl::distance(first_, last_), str.data(), str.size());
 
 #if ETL_HAS_STRING_TRUNCATION_CHECKS
       if (str.is_truncated())
@@ -1656,11 +1461,7 @@ namespace etl
       length_ = etl::min(length_, size() - position);
       sublength = etl::min(sublength, str.size() - subposition);
 
-      // Erase the bit we want to replace.
-      erase(position, length_);
-
-      // Insert the new stuff.
-      insert(position, str, subposition, sublength);
+      replace_characters(position, length_, str.data() + subposition, sublength);
 
 #if ETL_HAS_STRING_TRUNCATION_CHECKS
       if (str.is_truncated())
@@ -1686,11 +1487,7 @@ namespace etl
       // Limit the length.
       length_ = etl::min(length_, size() - position);
 
-      // Erase the bit we want to replace.
-      erase(position, length_);
-
-      // Insert the new stuff.
-      insert(position, s, etl::strlen(s));
+      replace_characters(position, length_, s, etl::strlen(s));
 
       return *this;
     }
@@ -1704,11 +1501,7 @@ namespace etl
       iterator first_ = to_iterator(first);
       iterator last_ = to_iterator(last);
 
-      // Erase the bit we want to replace.
-      erase(first_, last_);
-
-      // Insert the new stuff.
-      insert(first_, s, s + etl::strlen(s));
+      replace_characters(etl::distance(begin(), first_), etl::distance(first_, last_), s, etl::strlen(s));
 
       return *this;
     }
@@ -1723,11 +1516,7 @@ namespace etl
       // Limit the length.
       length_ = etl::min(length_, size() - position);
 
-      // Erase the bit we want to replace.
-      erase(position, length_);
-
-      // Insert the new stuff.
-      insert(position, s, n);
+      replace_characters(position, length_, s, n);
 
       return *this;
     }
@@ -1741,11 +1530,7 @@ namespace etl
       iterator first_ = to_iterator(first);
       iterator last_ = to_iterator(last);
 
-      // Erase the bit we want to replace.
-      erase(first_, last_);
-
-      // Insert the new stuff.
-      insert(first_, s, s + n);
+      replace_characters(etl::distance(begin(), first_), etl::distance(first_, last_), s, n);
 
       return *this;
     }
@@ -1912,21 +1697,15 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
+      if (n == 1U)
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
+        return find(s[0], position);
       }
 
-      return npos;
+      const private_string_search::character_set<T> set(s, n);
+      const size_type i = private_string_search::find_first_of(p_buffer, position, size(), set, true);
+
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     //*********************************************************************
@@ -1936,18 +1715,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find(c, position);
     }
 
     //*********************************************************************
@@ -1978,30 +1746,15 @@ namespace etl
     //*********************************************************************
     size_type find_last_of(const_pointer s, size_type position, size_type n) const
     {
-      if (empty())
+      if (n == 1U)
       {
-        return npos;
+        return find_last_of(s[0], position);
       }
 
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
+      const private_string_search::character_set<T> set(s, n);
+      const size_type i = private_string_search::find_last_of(p_buffer, position, size(), set, true);
 
-      return npos;
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     //*********************************************************************
@@ -2011,27 +1764,11 @@ namespace etl
     //*********************************************************************
     size_type find_last_of(value_type c, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        if (p_buffer[position] == c)
-        {
-          return position;
-        }
+      // Searches the characters up to and including position.
+      const size_type length = (position < size()) ? position + 1U : size();
+      const size_type i      = private_string_search::rfind_char(p_buffer, length, c);
 
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     //*********************************************************************
@@ -2062,28 +1799,10 @@ namespace etl
     //*********************************************************************
     size_type find_first_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
+      const private_string_search::character_set<T> set(s, n);
+      const size_type i = private_string_search::find_first_of(p_buffer, position, size(), set, false);
 
-      return npos;
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     //*********************************************************************
@@ -2135,37 +1854,10 @@ namespace etl
     //*********************************************************************
     size_type find_last_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
+      const private_string_search::character_set<T> set(s, n);
+      const size_type i = private_string_search::find_last_of(p_buffer, position, size(), set, false);
 
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     //*********************************************************************
@@ -2316,6 +2008,254 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Is the iterator a pointer to characters of this string's type?
+    //*************************************************************************
+    template <typename TIterator>
+    struct is_character_pointer
+      : etl::integral_constant<bool, etl::is_pointer<TIterator>::value &&
+                                     etl::is_same<T, typename etl::remove_cv<typename etl::remove_pointer<TIterator>::type>::type>::value>
+    {
+    };
+
+    //*********************************************************************
+    /// Assigns a range of characters from a contiguous buffer.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_range(TIterator first, TIterator last, etl::true_type)
+    {
+      assign(first, static_cast<size_type>(last - first));
+    }
+
+    //*********************************************************************
+    /// Assigns a range of values, one at a time.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_range(TIterator first, TIterator last, etl::false_type)
+    {
+      initialise();
+
+      while ((first != last) && (current_size != CAPACITY))
+      {
+        p_buffer[current_size++] = *first++;
+      }
+
+      p_buffer[current_size] = 0;
+
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+      set_truncated(first != last);
+
+#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
+      ETL_ASSERT(flags.test<IS_TRUNCATED>() == false, ETL_ERROR(string_truncation));
+#endif
+#endif
+    }
+
+    //*********************************************************************
+    /// Inserts a range of characters from a contiguous buffer.
+    //*********************************************************************
+    template <typename TIterator>
+    iterator insert_range(iterator position_, TIterator first, TIterator last, etl::true_type)
+    {
+      const size_type start = etl::distance(begin(), position_);
+
+      return begin() + replace_characters(start, 0U, first, static_cast<size_type>(last - first));
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, one at a time.
+    //*********************************************************************
+    template <typename TIterator>
+    iterator insert_range(iterator position_, TIterator first, TIterator last, etl::false_type)
+    {
+      if (first == last)
+      {
+        return position_;
+      }
+
+      const size_type start = etl::distance(begin(), position_);
+      const size_type n = etl::distance(first, last);
+
+      // No effect.
+      if (start >= CAPACITY)
+      {
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+        set_truncated(true);
+
+#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
+        ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
+#endif
+#endif
+        return position_;
+      }
+
+      // Fills the string to the end?
+      if ((start + n) >= CAPACITY)
+      {
+        if (((current_size + n) > CAPACITY))
+        {
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+          set_truncated(true);
+
+#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
+          ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
+#endif
+#endif
+        }
+
+        current_size = CAPACITY;
+
+        while (position_ != end())
+        {
+          *position_++ = *first++;
+        }
+      }
+      else
+      {
+        // Lets do some shifting.
+        const size_type shift_amount = n;
+        const size_type to_position = start + shift_amount;
+        const size_type remaining_characters = current_size - start;
+        const size_type max_shift_characters = CAPACITY - start - shift_amount;
+        const size_type characters_to_shift = etl::min(max_shift_characters, remaining_characters);
+
+        // Will the string truncate?
+        if ((start + shift_amount + remaining_characters) > CAPACITY)
+        {
+          current_size = CAPACITY;
+
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+          set_truncated(true);
+
+#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
+          ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
+#endif
+#endif
+        }
+        else
+        {
+          current_size += shift_amount;
+        }
+
+        etl::copy_backward(position_, position_ + characters_to_shift, begin() + to_position + characters_to_shift);
+
+        while (first != last)
+        {
+          *position_++ = *first++;
+        }
+      }
+
+      p_buffer[current_size] = 0;
+
+      return position_;
+    }
+
+    //*********************************************************************
+    /// Appends 'n' characters from a contiguous buffer.
+    /// The number that fit is calculated once and copied as a block.
+    //*********************************************************************
+    void append_characters(const_pointer s, size_type n)
+    {
+      const size_type free_space = CAPACITY - current_size;
+
+      if (n > free_space)
+      {
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+        set_truncated(true);
+
+#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
+        ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
+#endif
+#endif
+        n = free_space;
+      }
+
+      if (n != 0U)
+      {
+        memcpy(p_buffer + current_size, s, n * sizeof(T));
+      }
+
+      current_size += n;
+      p_buffer[current_size] = 0;
+    }
+
+    //*********************************************************************
+    /// Replaces 'length_' characters at 'position' with 'n' characters from
+    /// a contiguous buffer. Inserts if 'length_' is zero.
+    /// The numbers that fit are calculated once, then the tail and the new
+    /// characters are each moved as a block.
+    ///\return The index after the last inserted character.
+    //*********************************************************************
+    size_type replace_characters(size_type position, size_type length_, const_pointer s, size_type n)
+    {
+      const size_type old_size      = current_size;
+      const size_type tail_length   = current_size - position - length_;
+      const size_type insert_length = etl::min(n, CAPACITY - position);
+      const size_type shift_length  = etl::min(tail_length, CAPACITY - position - insert_length);
+
+      if (((current_size - length_) + n) > CAPACITY)
+      {
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+        set_truncated(true);
+
+#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
+        ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
+#endif
+#endif
+      }
+
+      if ((shift_length != 0U) && (insert_length != length_))
+      {
+        memmove(p_buffer + position + insert_length, p_buffer + position + length_, shift_length * sizeof(T));
+      }
+
+      if (insert_length != 0U)
+      {
+        memmove(p_buffer + position, s, insert_length * sizeof(T));
+      }
+
+      current_size = position + insert_length + shift_length;
+      p_buffer[current_size] = 0;
+
+      if (current_size < old_size)
+      {
+        cleanup();
+      }
+
+      return position + insert_length;
+    }
+
+    //*************************************************************************
+    /// Find helper function
+    //*************************************************************************
+    size_type find_text(const_pointer s, size_type position, size_type n) const
+    {
+      if (position > size())
+      {
+        return npos;
+      }
+
+      const size_type i = private_string_search::find(p_buffer + position, size() - position, s, n);
+
+      return (i == private_string_search::npos) ? npos : position + i;
+    }
+
+    //*************************************************************************
+    /// Reverse find helper function.
+    /// Finds the last match that ends before position.
+    //*************************************************************************
+    size_type rfind_text(const_pointer s, size_type position, size_type n) const
+    {
+      if (n > size())
+      {
+        return npos;
+      }
+
+      const size_type i = private_string_search::rfind(p_buffer, etl::min(position, size()), s, n);
+
+      return (i == private_string_search::npos) ? npos : i;
+    }
+
     //*************************************************************************
     /// Compare helper function
     //*************************************************************************
@@ -0,0 +1,493 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "delegate.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_STL && ETL_USING_CPP11
+  #include <chrono>
+#endif
+
+#if defined(ETL_COMPILER_MICROSOFT) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+#endif
+
+///\defgroup benchmark benchmark
+/// A microbenchmark harness that needs no heap, no streams and no OS, for
+/// measuring on the target.
+/// Benchmarks are registered with ETL_BENCHMARK, in the style of the unit
+/// test TEST macro. The body is one operation.
+///\code
+/// ETL_BENCHMARK(crc32_256_bytes)
+/// {
+///   etl::benchmark_do_not_optimise(etl::crc32(data, data + 256).value());
+/// }
+///\endcode
+/// An etl::benchmark_runner times each call with a cycle counter, after
+/// warm up calls, and reports the minimum, median and maximum cycles per
+/// operation, less the measured overhead of an empty benchmark.
+/// A cycle counter is a class with a static 'uint32_t read()'. Differences
+/// are taken modulo 2^32, so a 32 bit counter may wrap.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Stops the compiler from optimising away a value.
+  ///\ingroup benchmark
+  //***************************************************************************
+  template <typename T>
+  inline void benchmark_do_not_optimise(const T& value)
+  {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    __asm__ __volatile__("" : : "r,m"(value) : "memory");
+#else
+    static const volatile void* volatile sink;
+    sink = &value;
+#endif
+  }
+
+  //***************************************************************************
+  /// Stops the compiler from assuming the contents of memory.
+  ///\ingroup benchmark
+  //***************************************************************************
+  inline void benchmark_clobber_memory()
+  {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    __asm__ __volatile__("" : : : "memory");
+#endif
+  }
+
+  //***************************************************************************
+  /// The ARM Cortex-M DWT cycle counter, on M3 and above.
+  /// Call enable() once before use.
+  ///\ingroup benchmark
+  //***************************************************************************
+  struct dwt_cycle_counter
+  {
+    static void enable()
+    {
+      demcr()    = demcr() | 0x01000000UL;    // TRCENA
+      dwt_lar()  = 0xC5ACCE55UL;              // Unlock, on the M7.
+      cyccnt()   = 0U;
+      dwt_ctrl() = dwt_ctrl() | 0x00000001UL; // CYCCNTENA
+    }
+
+    static uint32_t read()
+    {
+      return cyccnt();
+    }
+
+  private:
+
+    static volatile uint32_t& dwt_ctrl() { return *reinterpret_cast<volatile uint32_t*>(0xE0001000UL); }
+    static volatile uint32_t& cyccnt()   { return *reinterpret_cast<volatile uint32_t*>(0xE0001004UL); }
+    static volatile uint32_t& dwt_lar()  { return *reinterpret_cast<volatile uint32_t*>(0xE0001FB0UL); }
+    static volatile uint32_t& demcr()    { return *reinterpret_cast<volatile uint32_t*>(0xE000EDFCUL); }
+  };
+
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__aarch64__) || defined(__ARM_ARCH_7A__) || defined(__ARM_ARCH_7R__))
+  #define ETL_HAS_PMU_CYCLE_COUNTER 1
+
+  //***************************************************************************
+  /// The ARM PMU cycle counter, on Cortex-A and Cortex-R.
+  /// The counter must be enabled, and user access permitted, by privileged code.
+  ///\ingroup benchmark
+  //***************************************************************************
+  struct pmu_cycle_counter
+  {
+    static uint32_t read()
+    {
+  #if defined(__aarch64__)
+      uint64_t value;
+      __asm__ __volatile__("mrs %0, pmccntr_el0" : "=r"(value));
+      return static_cast<uint32_t>(value);
+  #else
+      uint32_t value;
+      __asm__ __volatile__("mrc p15, 0, %0, c9, c13, 0" : "=r"(value));
+      return value;
+  #endif
+    }
+  };
+#else
+  #define ETL_HAS_PMU_CYCLE_COUNTER 0
+#endif
+
+#if ((defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__x86_64__) || defined(__i386__))) || \
+    (defined(ETL_COMPILER_MICROSOFT) && (defined(_M_X64) || defined(_M_IX86)))
+  #define ETL_HAS_TSC_CYCLE_COUNTER 1
+
+  //***************************************************************************
+  /// The x86 time stamp counter.
+  ///\ingroup benchmark
+  //***************************************************************************
+  struct tsc_cycle_counter
+  {
+    static uint32_t read()
+    {
+  #if defined(ETL_COMPILER_MICROSOFT)
+      return static_cast<uint32_t>(__rdtsc());
+  #else
+      return static_cast<uint32_t>(__builtin_ia32_rdtsc());
+  #endif
+    }
+  };
+#else
+  #define ETL_HAS_TSC_CYCLE_COUNTER 0
+#endif
+
+#if ETL_USING_STL && ETL_USING_CPP11
+  #define ETL_HAS_CHRONO_CYCLE_COUNTER 1
+
+  //***************************************************************************
+  /// A fallback that counts nanoseconds of std::chrono::steady_clock.
+  ///\ingroup benchmark
+  //***************************************************************************
+  struct chrono_cycle_counter
+  {
+    static uint32_t read()
+    {
+      return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+  };
+#else
+  #define ETL_HAS_CHRONO_CYCLE_COUNTER 0
+#endif
+
+  //***************************************************************************
+  /// A registered benchmark.
+  /// Benchmarks link themselves into a list at static initialisation, in
+  /// declaration order within a translation unit.
+  ///\ingroup benchmark
+  //***************************************************************************
+  class benchmark
+  {
+  public:
+
+    typedef void (*function_type)();
+
+    //*************************************************************************
+    /// Constructor. Registers the benchmark.
+    //*************************************************************************
+    benchmark(const char* name_, function_type function_)
+      : name(name_)
+      , function(function_)
+      , p_next(ETL_NULLPTR)
+    {
+      if (tail() == ETL_NULLPTR)
+      {
+        head() = this;
+      }
+      else
+      {
+        tail()->p_next = this;
+      }
+
+      tail() = this;
+    }
+
+    //*************************************************************************
+    /// The name of the benchmark.
+    //*************************************************************************
+    const char* get_name() const
+    {
+      return name;
+    }
+
+    //*************************************************************************
+    /// The function that runs one operation.
+    //*************************************************************************
+    function_type get_function() const
+    {
+      return function;
+    }
+
+    //*************************************************************************
+    /// Runs one operation.
+    //*************************************************************************
+    void operator ()() const
+    {
+      function();
+    }
+
+    //*************************************************************************
+    /// The first registered benchmark, or null.
+    //*************************************************************************
+    static const benchmark* first()
+    {
+      return head();
+    }
+
+    //*************************************************************************
+    /// The next registered benchmark, or null.
+    //*************************************************************************
+    const benchmark* next() const
+    {
+      return p_next;
+    }
+
+    //*************************************************************************
+    /// Finds a benchmark by name, or returns null.
+    //*************************************************************************
+    static const benchmark* find(const char* name_)
+    {
+      for (const benchmark* p = first(); p != ETL_NULLPTR; p = p->next())
+      {
+        if (strcmp(p->name, name_) == 0)
+        {
+          return p;
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+  private:
+
+    static benchmark*& head()
+    {
+      static benchmark* p_head = ETL_NULLPTR;
+      return p_head;
+    }
+
+    static benchmark*& tail()
+    {
+      static benchmark* p_tail = ETL_NULLPTR;
+      return p_tail;
+    }
+
+    // Disable copy construction and assignment.
+    benchmark(const benchmark&) ETL_DELETE;
+    benchmark& operator =(const benchmark&) ETL_DELETE;
+
+    const char*   name;
+    function_type function;
+    benchmark*    p_next;
+  };
+
+  //***************************************************************************
+  /// The result of a benchmark, in cycles per operation.
+  ///\ingroup benchmark
+  //***************************************************************************
+  struct benchmark_result
+  {
+    const char* name;
+    uint32_t    min;
+    uint32_t    median;
+    uint32_t    max;
+    uint32_t    samples;  ///< The number of measured samples.
+    uint32_t    batch;    ///< The number of operations timed per sample.
+    uint32_t    overhead; ///< The cycles per sample subtracted as overhead.
+  };
+
+  namespace private_benchmark
+  {
+    //*************************************************************************
+    /// The empty benchmark, timed to find the measurement overhead.
+    //*************************************************************************
+    inline void empty()
+    {
+      etl::benchmark_clobber_memory();
+    }
+  }
+
+  //***************************************************************************
+  /// Runs benchmarks, timed with TCycleCounter.
+  /// Each sample times 'batch' operations; a batch larger than one gives a
+  /// finer resolution for very short operations.
+  ///\tparam TCycleCounter A class with a static 'uint32_t read()'.
+  ///\tparam Max_Samples   The maximum number of measured samples per benchmark.
+  ///\ingroup benchmark
+  //***************************************************************************
+  template <typename TCycleCounter, size_t Max_Samples = 31U>
+  class benchmark_runner
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Samples > 0U, "Max_Samples must be greater than zero");
+
+    typedef etl::delegate<void(const etl::benchmark_result&)> reporter_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit benchmark_runner(size_t warmup_ = 4U, size_t samples_ = Max_Samples, size_t batch_ = 1U)
+      : warmup(warmup_)
+      , n_samples(etl::min(etl::max(samples_, size_t(1U)), Max_Samples))
+      , batch(etl::max(batch_, size_t(1U)))
+      , overhead(0U)
+      , calibrated(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the function that receives each result.
+    //*************************************************************************
+    void set_reporter(reporter_type reporter_)
+    {
+      reporter = reporter_;
+    }
+
+    //*************************************************************************
+    /// Runs a benchmark, reports and returns the result.
+    //*************************************************************************
+    etl::benchmark_result run(const etl::benchmark& bm)
+    {
+      if (!calibrated)
+      {
+        calibrate();
+      }
+
+      sample(bm.get_function());
+
+      etl::benchmark_result result;
+
+      result.name     = bm.get_name();
+      result.min      = per_operation(samples[0]);
+      result.median   = per_operation(samples[n_samples / 2U]);
+      result.max      = per_operation(samples[n_samples - 1U]);
+      result.samples  = static_cast<uint32_t>(n_samples);
+      result.batch    = static_cast<uint32_t>(batch);
+      result.overhead = overhead;
+
+      if (reporter.is_valid())
+      {
+        reporter(result);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Runs every registered benchmark whose name contains 'filter', or all
+    /// of them if it is null. Returns the number run.
+    //*************************************************************************
+    size_t run_all(const char* filter = ETL_NULLPTR)
+    {
+      size_t count = 0U;
+
+      for (const etl::benchmark* p = etl::benchmark::first(); p != ETL_NULLPTR; p = p->next())
+      {
+        if ((filter == ETL_NULLPTR) || (strstr(p->get_name(), filter) != ETL_NULLPTR))
+        {
+          run(*p);
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Measures the overhead of timing an empty benchmark.
+    /// Called by the first run, or again if the clock changes.
+    //*************************************************************************
+    void calibrate()
+    {
+      sample(&private_benchmark::empty);
+
+      overhead   = samples[0];
+      calibrated = true;
+    }
+
+    //*************************************************************************
+    /// The cycles per sample subtracted as overhead.
+    //*************************************************************************
+    uint32_t get_overhead() const
+    {
+      return overhead;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Makes the warm up calls, then times the samples, in sorted order.
+    //*************************************************************************
+    void sample(etl::benchmark::function_type function_)
+    {
+      // Called through a volatile pointer, so that the empty benchmark is
+      // called in the same way as the others.
+      etl::benchmark::function_type volatile function = function_;
+
+      for (size_t i = 0U; i < warmup; ++i)
+      {
+        function();
+      }
+
+      for (size_t s = 0U; s < n_samples; ++s)
+      {
+        const uint32_t start = TCycleCounter::read();
+
+        for (size_t i = 0U; i < batch; ++i)
+        {
+          function();
+        }
+
+        samples[s] = static_cast<uint32_t>(TCycleCounter::read() - start);
+      }
+
+      etl::sort(samples, samples + n_samples);
+    }
+
+    //*************************************************************************
+    uint32_t per_operation(uint32_t cycles) const
+    {
+      return (cycles > overhead) ? (cycles - overhead) / static_cast<uint32_t>(batch) : 0U;
+    }
+
+    size_t        warmup;
+    size_t        n_samples;
+    size_t        batch;
+    uint32_t      overhead;
+    bool          calibrated;
+    reporter_type reporter;
+    uint32_t      samples[Max_Samples];
+  };
+}
+
+//*****************************************************************************
+/// Defines and registers a benchmark. The body that follows is one operation.
+///\ingroup benchmark
+//*****************************************************************************
+#define ETL_BENCHMARK(name)                                                                  \
+  static void etl_benchmark_function_##name();                                               \
+  static etl::benchmark etl_benchmark_##name(#name, &etl_benchmark_function_##name);         \
+  static void etl_benchmark_function_##name()
+
+#endif
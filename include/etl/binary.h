@@ -46,6 +46,10 @@ SOFTWARE.
 #include "exception.h"
 #include "error_handler.h"
 
+#if ETL_USING_BUILTIN_BMI2
+  #include <immintrin.h>
+#endif
+
 #if ETL_USING_CPP20 && ETL_USING_STL
   #include <bit>
 #endif
@@ -740,6 +744,8 @@ namespace etl
   {
 #if ETL_CPP23_SUPPORTED && ETL_USING_STL
     return std::byteswap(value);
+#elif ETL_USING_BUILTIN_BSWAP
+    return __builtin_bswap16(value);
 #else
     return (value >> 8U) | (value << 8U);
 #endif
@@ -756,6 +762,8 @@ namespace etl
   {
 #if ETL_CPP23_SUPPORTED && ETL_USING_STL
     return std::byteswap(value);
+#elif ETL_USING_BUILTIN_BSWAP
+    return __builtin_bswap32(value);
 #else
     value = ((value & 0xFF00FF00UL) >> 8U) | ((value & 0x00FF00FFUL) << 8U);
     value = (value >> 16U) | (value << 16U);
@@ -776,6 +784,8 @@ namespace etl
   {
 #if ETL_CPP23_SUPPORTED && ETL_USING_STL
     return std::byteswap(value);
+#elif ETL_USING_BUILTIN_BSWAP
+    return __builtin_bswap64(value);
 #else
     value = ((value & 0xFF00FF00FF00FF00ULL) >> 8U)  | ((value & 0x00FF00FF00FF00FFULL) << 8U);
     value = ((value & 0xFFFF0000FFFF0000ULL) >> 16U) | ((value & 0x0000FFFF0000FFFFULL) << 16U);
@@ -1754,7 +1764,7 @@ namespace etl
     {
       count = 1U;
 
-      if ((value & 0xFFFFFFFFF0000000ULL) == 0U)
+      if ((value & 0xFFFFFFFF00000000ULL) == 0U)
       {
         value <<= 32U;
         count += 32U;
@@ -2381,6 +2391,337 @@ namespace etl
     T parameter;
   };
 
+  namespace private_binary
+  {
+    //*************************************************************************
+    /// Returns true if the BMI2 instructions may be used.
+    /// They cannot be constant evaluated.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline bool use_bmi2()
+    {
+#if ETL_USING_BUILTIN_BMI2
+  #if ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+      return !__builtin_is_constant_evaluated();
+  #else
+      return !ETL_USING_CPP14;
+  #endif
+#else
+      return false;
+#endif
+    }
+
+    //*************************************************************************
+    /// Bit deposit, one mask bit at a time.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 T pdep_portable(T value, T mask)
+    {
+      T result = 0;
+
+      for (T bit = 1; mask != 0; bit = T(bit << 1U))
+      {
+        const T lowest = T(mask & T(~mask + 1U));
+
+        if ((value & bit) != 0)
+        {
+          result = T(result | lowest);
+        }
+
+        mask = T(mask & T(mask - 1U));
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Bit extract, one mask bit at a time.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 T pext_portable(T value, T mask)
+    {
+      T result = 0;
+
+      for (T bit = 1; mask != 0; bit = T(bit << 1U))
+      {
+        const T lowest = T(mask & T(~mask + 1U));
+
+        if ((value & lowest) != 0)
+        {
+          result = T(result | bit);
+        }
+
+        mask = T(mask & T(mask - 1U));
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Spreads the low 16 bits to the even bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint32_t morton_spread2(uint32_t value)
+    {
+      value &= 0x0000FFFFUL;
+      value = (value | (value << 8U)) & 0x00FF00FFUL;
+      value = (value | (value << 4U)) & 0x0F0F0F0FUL;
+      value = (value | (value << 2U)) & 0x33333333UL;
+      value = (value | (value << 1U)) & 0x55555555UL;
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Gathers the even bits to the low 16 bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint32_t morton_compact2(uint32_t value)
+    {
+      value &= 0x55555555UL;
+      value = (value ^ (value >> 1U)) & 0x33333333UL;
+      value = (value ^ (value >> 2U)) & 0x0F0F0F0FUL;
+      value = (value ^ (value >> 4U)) & 0x00FF00FFUL;
+      value = (value ^ (value >> 8U)) & 0x0000FFFFUL;
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Spreads the low 10 bits to every third bit.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint32_t morton_spread3(uint32_t value)
+    {
+      value &= 0x000003FFUL;
+      value = (value | (value << 16U)) & 0x030000FFUL;
+      value = (value | (value << 8U))  & 0x0300F00FUL;
+      value = (value | (value << 4U))  & 0x030C30C3UL;
+      value = (value | (value << 2U))  & 0x09249249UL;
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Gathers every third bit to the low 10 bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint32_t morton_compact3(uint32_t value)
+    {
+      value &= 0x09249249UL;
+      value = (value ^ (value >> 2U))  & 0x030C30C3UL;
+      value = (value ^ (value >> 4U))  & 0x0300F00FUL;
+      value = (value ^ (value >> 8U))  & 0xFF0000FFUL;
+      value = (value ^ (value >> 16U)) & 0x000003FFUL;
+
+      return value;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Spreads the low 32 bits to the even bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t morton_spread2(uint64_t value)
+    {
+      value &= 0x00000000FFFFFFFFULL;
+      value = (value | (value << 16U)) & 0x0000FFFF0000FFFFULL;
+      value = (value | (value << 8U))  & 0x00FF00FF00FF00FFULL;
+      value = (value | (value << 4U))  & 0x0F0F0F0F0F0F0F0FULL;
+      value = (value | (value << 2U))  & 0x3333333333333333ULL;
+      value = (value | (value << 1U))  & 0x5555555555555555ULL;
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Gathers the even bits to the low 32 bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t morton_compact2(uint64_t value)
+    {
+      value &= 0x5555555555555555ULL;
+      value = (value ^ (value >> 1U))  & 0x3333333333333333ULL;
+      value = (value ^ (value >> 2U))  & 0x0F0F0F0F0F0F0F0FULL;
+      value = (value ^ (value >> 4U))  & 0x00FF00FF00FF00FFULL;
+      value = (value ^ (value >> 8U))  & 0x0000FFFF0000FFFFULL;
+      value = (value ^ (value >> 16U)) & 0x00000000FFFFFFFFULL;
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Spreads the low 21 bits to every third bit.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t morton_spread3(uint64_t value)
+    {
+      value &= 0x00000000001FFFFFULL;
+      value = (value | (value << 32U)) & 0x001F00000000FFFFULL;
+      value = (value | (value << 16U)) & 0x001F0000FF0000FFULL;
+      value = (value | (value << 8U))  & 0x100F00F00F00F00FULL;
+      value = (value | (value << 4U))  & 0x10C30C30C30C30C3ULL;
+      value = (value | (value << 2U))  & 0x1249249249249249ULL;
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Gathers every third bit to the low 21 bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t morton_compact3(uint64_t value)
+    {
+      value &= 0x1249249249249249ULL;
+      value = (value ^ (value >> 2U))  & 0x10C30C30C30C30C3ULL;
+      value = (value ^ (value >> 4U))  & 0x100F00F00F00F00FULL;
+      value = (value ^ (value >> 8U))  & 0x001F0000FF0000FFULL;
+      value = (value ^ (value >> 16U)) & 0x001F00000000FFFFULL;
+      value = (value ^ (value >> 32U)) & 0x00000000001FFFFFULL;
+
+      return value;
+    }
+#endif
+
+    //*************************************************************************
+    /// The type that the Morton functions for T work in.
+    //*************************************************************************
+    template <typename T>
+    struct morton_work_type
+    {
+#if ETL_USING_64BIT_TYPES
+      typedef typename etl::conditional<(etl::integral_limits<T>::bits <= 32U), uint32_t, uint64_t>::type type;
+#else
+      typedef uint32_t type;
+#endif
+    };
+  }
+
+  //***************************************************************************
+  /// Parallel bit deposit.
+  /// Places the low bits of 'value', in order, at the positions of the set
+  /// bits of 'mask'. The other bits of the result are zero.
+  /// Uses the BMI2 PDEP instruction when ETL_USING_BUILTIN_BMI2 is set.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, T>::type
+    pdep(T value, T mask)
+  {
+#if ETL_USING_BUILTIN_BMI2
+    if (private_binary::use_bmi2())
+    {
+      if (etl::integral_limits<T>::bits <= 32U)
+      {
+        return T(_pdep_u32(uint32_t(value), uint32_t(mask)));
+      }
+      else
+      {
+        return T(_pdep_u64(uint64_t(value), uint64_t(mask)));
+      }
+    }
+#endif
+
+    return private_binary::pdep_portable(value, mask);
+  }
+
+  //***************************************************************************
+  /// Parallel bit extract.
+  /// Gathers the bits of 'value' at the positions of the set bits of 'mask'
+  /// into the low bits of the result, in order.
+  /// Uses the BMI2 PEXT instruction when ETL_USING_BUILTIN_BMI2 is set.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, T>::type
+    pext(T value, T mask)
+  {
+#if ETL_USING_BUILTIN_BMI2
+    if (private_binary::use_bmi2())
+    {
+      if (etl::integral_limits<T>::bits <= 32U)
+      {
+        return T(_pext_u32(uint32_t(value), uint32_t(mask)));
+      }
+      else
+      {
+        return T(_pext_u64(uint64_t(value), uint64_t(mask)));
+      }
+    }
+#endif
+
+    return private_binary::pext_portable(value, mask);
+  }
+
+  //***************************************************************************
+  /// Morton (Z-order) code of two coordinates.
+  /// The bits of x go to the even bits of the code and the bits of y to the
+  /// odd bits. Each coordinate uses the low half of the bits of T.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, T>::type
+    morton_encode2(T x, T y)
+  {
+    typedef typename private_binary::morton_work_type<T>::type work_t;
+
+    const work_t coordinate_mask = etl::max_value_for_nbits<etl::integral_limits<T>::bits / 2U>::value;
+
+    return T(private_binary::morton_spread2(work_t(x & coordinate_mask)) |
+             (private_binary::morton_spread2(work_t(y & coordinate_mask)) << 1U));
+  }
+
+  //***************************************************************************
+  /// Coordinates of a two dimensional Morton (Z-order) code.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, void>::type
+    morton_decode2(T code, T& x, T& y)
+  {
+    typedef typename private_binary::morton_work_type<T>::type work_t;
+
+    x = T(private_binary::morton_compact2(work_t(code)));
+    y = T(private_binary::morton_compact2(work_t(code) >> 1U));
+  }
+
+  //***************************************************************************
+  /// Morton (Z-order) code of three coordinates.
+  /// The bits of x, y and z go to bits 0, 1 and 2 of each group of three bits
+  /// of the code. Each coordinate uses the low third of the bits of T.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, T>::type
+    morton_encode3(T x, T y, T z)
+  {
+    typedef typename private_binary::morton_work_type<T>::type work_t;
+
+    const work_t coordinate_mask = etl::max_value_for_nbits<etl::integral_limits<T>::bits / 3U>::value;
+
+    return T(private_binary::morton_spread3(work_t(x & coordinate_mask)) |
+             (private_binary::morton_spread3(work_t(y & coordinate_mask)) << 1U) |
+             (private_binary::morton_spread3(work_t(z & coordinate_mask)) << 2U));
+  }
+
+  //***************************************************************************
+  /// Coordinates of a three dimensional Morton (Z-order) code.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, void>::type
+    morton_decode3(T code, T& x, T& y, T& z)
+  {
+    typedef typename private_binary::morton_work_type<T>::type work_t;
+
+    const work_t coordinate_mask = etl::max_value_for_nbits<etl::integral_limits<T>::bits / 3U>::value;
+
+    x = T(private_binary::morton_compact3(work_t(code)) & coordinate_mask);
+    y = T(private_binary::morton_compact3(work_t(code) >> 1U) & coordinate_mask);
+    z = T(private_binary::morton_compact3(work_t(code) >> 2U) & coordinate_mask);
+  }
+
   //***************************************************************************
   /// 8 bit binary byte constants.
   ///\ingroup binary
@@ -0,0 +1,239 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BIQUAD_CASCADE_INCLUDED
+#define ETL_BIQUAD_CASCADE_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "static_assert.h"
+#include "private/digital_filter_arithmetic.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_biquad_cascade
+  {
+    //*************************************************************************
+    /// The default number of fraction bits for fixed point biquads.
+    /// One fewer than for an FIR, as a1 may reach 2. Q14 for int16_t, Q30 for int32_t.
+    //*************************************************************************
+    template <typename T, bool Is_Integral = etl::is_integral<T>::value>
+    struct default_fraction_bits
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <typename T>
+    struct default_fraction_bits<T, true>
+    {
+      static ETL_CONSTANT size_t value = etl::private_digital_filter::default_fraction_bits<T>::value - 1U;
+    };
+
+    template <typename T, bool Is_Integral>
+    ETL_CONSTANT size_t default_fraction_bits<T, Is_Integral>::value;
+
+    template <typename T>
+    ETL_CONSTANT size_t default_fraction_bits<T, true>::value;
+  }
+
+  //***************************************************************************
+  /// The coefficients of one biquad stage, normalised so that a0 == 1.
+  /// y[n] = b0x[n] + b1x[n-1] + b2x[n-2] - a1y[n-1] - a2y[n-2]
+  //***************************************************************************
+  template <typename T>
+  struct biquad_coefficients
+  {
+    T b0;
+    T b1;
+    T b2;
+    T a1;
+    T a2;
+  };
+
+  //***************************************************************************
+  /// A cascade of second order IIR sections, each in direct form I.
+  /// Samples and coefficients may be floating point, or signed integral fixed
+  /// point with Fraction_Bits fraction bits, e.g. Q14 for int16_t. Each stage
+  /// accumulates at full precision and rounds and saturates its output, which
+  /// is the input of the next stage.
+  ///\tparam T             The sample and coefficient type.
+  ///\tparam Stages        The number of biquad stages.
+  ///\tparam Fraction_Bits The fixed point fraction bits. Ignored for floating point.
+  //***************************************************************************
+  template <typename T, size_t Stages_, size_t Fraction_Bits = etl::private_biquad_cascade::default_fraction_bits<T>::value>
+  class biquad_cascade
+  {
+  private:
+
+    typedef etl::private_digital_filter::arithmetic<T, Fraction_Bits> arithmetic;
+
+  public:
+
+    ETL_STATIC_ASSERT(Stages_ != 0U, "The number of stages must not be zero");
+
+    static ETL_CONSTANT size_t Stages = Stages_;
+
+    typedef T value_type;
+    typedef typename arithmetic::accumulator_type accumulator_type;
+    typedef etl::biquad_coefficients<T> coefficients_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param coefficients_ The coefficients of each stage, the first stage first.
+    //*************************************************************************
+    explicit biquad_cascade(const coefficients_type (&coefficients_)[Stages_])
+    {
+      set_coefficients(coefficients_);
+      reset();
+    }
+
+    //*************************************************************************
+    /// Sets the coefficients of each stage. The state is not changed.
+    //*************************************************************************
+    void set_coefficients(const coefficients_type (&coefficients_)[Stages_])
+    {
+      for (size_t i = 0U; i < Stages; ++i)
+      {
+        coefficients[i] = coefficients_[i];
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the state of every stage.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 0U; i < Stages; ++i)
+      {
+        state[i].x1 = T(0);
+        state[i].x2 = T(0);
+        state[i].y1 = T(0);
+        state[i].y2 = T(0);
+      }
+    }
+
+    //*************************************************************************
+    /// Filters one sample through every stage.
+    ///\return The filtered sample.
+    //*************************************************************************
+    T process(T sample)
+    {
+      for (size_t i = 0U; i < Stages; ++i)
+      {
+        sample = process_stage(coefficients[i], state[i], sample);
+      }
+
+      return sample;
+    }
+
+    //*************************************************************************
+    /// Filters a block of samples.
+    /// Runs the whole block through each stage in turn, so that a stage's
+    /// coefficients and state stay in registers for the length of the block.
+    /// Processes the smaller of the input and output sizes.
+    /// The input and output may be the same span.
+    ///\return The number of samples processed.
+    //*************************************************************************
+    size_t process(etl::span<const T> input, etl::span<T> output)
+    {
+      const size_t n = (input.size() < output.size()) ? input.size() : output.size();
+
+      const T* p_input = input.data();
+
+      for (size_t i = 0U; i < Stages; ++i)
+      {
+        const coefficients_type c = coefficients[i];
+        stage_state             s = state[i];
+
+        for (size_t j = 0U; j < n; ++j)
+        {
+          output[j] = process_stage(c, s, p_input[j]);
+        }
+
+        state[i] = s;
+        p_input  = output.data();
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Filters one sample.
+    //*************************************************************************
+    T operator ()(T sample)
+    {
+      return process(sample);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The direct form I state of a stage.
+    //*************************************************************************
+    struct stage_state
+    {
+      T x1;
+      T x2;
+      T y1;
+      T y2;
+    };
+
+    //*************************************************************************
+    /// Filters one sample through one stage.
+    //*************************************************************************
+    static T process_stage(const coefficients_type& c, stage_state& s, T sample)
+    {
+      accumulator_type accumulator = arithmetic::multiply(c.b0, sample);
+      accumulator += arithmetic::multiply(c.b1, s.x1);
+      accumulator += arithmetic::multiply(c.b2, s.x2);
+      accumulator -= arithmetic::multiply(c.a1, s.y1);
+      accumulator -= arithmetic::multiply(c.a2, s.y2);
+
+      const T output = arithmetic::to_sample(accumulator);
+
+      s.x2 = s.x1;
+      s.x1 = sample;
+      s.y2 = s.y1;
+      s.y1 = output;
+
+      return output;
+    }
+
+    coefficients_type coefficients[Stages_];
+    stage_state       state[Stages_];
+  };
+
+  template <typename T, size_t Stages_, size_t Fraction_Bits>
+  ETL_CONSTANT size_t biquad_cascade<T, Stages_, Fraction_Bits>::Stages;
+}
+
+#endif
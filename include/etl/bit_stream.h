@@ -43,6 +43,7 @@ SOFTWARE.
 
 #include <stdint.h>
 #include <limits.h>
+#include <string.h>
 
 #include "private/minmax_push.h"
 
@@ -676,6 +677,53 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// For spans of integral types, each written with the same number of bits.
+    //***************************************************************************
+    template <typename T, size_t Length>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type
+      write_unchecked(const etl::span<T, Length>& values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::unsigned_type<typename etl::remove_cv<T>::type>::type unsigned_t;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        write_data<unsigned_t>(static_cast<unsigned_t>(values[i]), nbits);
+      }
+    }
+
+    //***************************************************************************
+    /// For spans of integral types, each written with the same number of bits.
+    /// Returns <b>false</b>, having written nothing, if there is not room for all
+    /// of the values. With a callback, the room is checked before each value.
+    //***************************************************************************
+    template <typename T, size_t Length>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      write(const etl::span<T, Length>& values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      if (callback.is_valid())
+      {
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          if (!write(values[i], nbits))
+          {
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+      bool success = (available(nbits) >= values.size());
+
+      if (success)
+      {
+        write_unchecked(values, nbits);
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// Skip n bits, up to the maximum space available.
     /// Returns <b>true</b> if the skip was possible.
@@ -878,6 +926,18 @@ namespace etl
 
   private:
 
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t window_type;
+#else
+    typedef uint32_t window_type;
+#endif
+
+    /// The width of the window used to read or write many bits at once.
+    static ETL_CONSTANT uint_least8_t Window_Bits = CHAR_BIT * sizeof(window_type);
+
+    /// The most bits that one window can hold, whatever the bit offset in the current char.
+    static ETL_CONSTANT uint_least8_t Max_Window_Bits = Window_Bits - (CHAR_BIT - 1U);
+
     //***************************************************************************
     /// Write a value to the stream.
     /// It will be passed one of five unsigned types.
@@ -888,24 +948,26 @@ namespace etl
       // Make sure that we are not writing more bits than should be available.
       nbits = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
 
-      if (stream_endianness == etl::endian::little)
-      {
-        value = etl::reverse_bits(value);
-        value = value >> ((CHAR_BIT * sizeof(T)) - nbits);
-      }
-
-      // Send the bits to the stream.
-      while (nbits != 0)
+      if (nbits != 0U)
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-        nbits -= mask_width;
-        T mask = ((T(1U) << mask_width) - 1U) << nbits;
+        if (stream_endianness == etl::endian::little)
+        {
+          value = etl::reverse_bits(value);
+          value = value >> ((CHAR_BIT * sizeof(T)) - nbits);
+        }
 
-        // Move chunk to lowest char bits.
-        // Chunks are never larger than one char.
-        T chunk = ((value & mask) >> nbits) << (bits_available_in_char - mask_width);
+        const window_type w = static_cast<window_type>(value);
 
-        write_chunk(static_cast<char>(chunk), mask_width);
+        if (nbits <= Max_Window_Bits)
+        {
+          write_window(w, nbits);
+        }
+        else
+        {
+          // Too wide for one window at every bit offset, so write in two parts.
+          write_window(w >> (Window_Bits / 2U), static_cast<uint_least8_t>(nbits - (Window_Bits / 2U)));
+          write_window(w, Window_Bits / 2U);
+        }
       }
 
       if (callback.is_valid())
@@ -915,18 +977,41 @@ namespace etl
     }
 
     //***************************************************************************
-    /// Write a data chunk to the stream
+    /// Write the lower nbits of the value to the stream, up to Max_Window_Bits.
+    /// The bits are placed in a window after those already in the current char
+    /// and the chars spanning them are stored, rather than a char at a time.
     //***************************************************************************
-    void write_chunk(char chunk, unsigned char nbits)
+    void write_window(window_type value, uint_least8_t nbits)
     {
-      // Clear if new byte.
-      if (bits_available_in_char == CHAR_BIT)
+      const size_t offset  = CHAR_BIT - bits_available_in_char;
+      const size_t total   = offset + nbits;
+      const size_t n_chars = (total + CHAR_BIT - 1U) / CHAR_BIT;
+
+      window_type w = (value << (Window_Bits - nbits)) >> offset;
+
+      // Keep the bits already written to a partially filled char.
+      if (offset != 0U)
       {
-        pdata[char_index] = 0U;
+        w |= static_cast<window_type>(static_cast<unsigned char>(pdata[char_index])) << (Window_Bits - CHAR_BIT);
       }
 
-      pdata[char_index] |= chunk;
-      step(nbits);
+      if ((char_index + sizeof(window_type)) <= length_chars)
+      {
+        // The chars after the bits are unused, so store the whole window.
+        w = etl::hton(w);
+        memcpy(pdata + char_index, &w, sizeof(window_type));
+      }
+      else
+      {
+        for (size_t i = 0U; i < n_chars; ++i)
+        {
+          pdata[char_index + i] = static_cast<char>(w >> (Window_Bits - (CHAR_BIT * (i + 1U))));
+        }
+      }
+
+      char_index            += total / CHAR_BIT;
+      bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - (total % CHAR_BIT));
+      bits_available        -= nbits;
     }
 
     //***************************************************************************
@@ -1170,6 +1255,40 @@ namespace etl
       return result;
     }
 
+    //***************************************************************************
+    /// For spans of integral types, each read with the same number of bits.
+    //***************************************************************************
+    template <typename T, size_t Length>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, void>::type
+      read_unchecked(const etl::span<T, Length>& values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::unsigned_type<T>::type unsigned_t;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = static_cast<T>(read_value<unsigned_t>(nbits, etl::is_signed<T>::value));
+      }
+    }
+
+    //***************************************************************************
+    /// For spans of integral types, each read with the same number of bits.
+    /// Returns <b>false</b>, having read nothing, if the stream does not hold
+    /// all of the values.
+    //***************************************************************************
+    template <typename T, size_t Length>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, bool>::type
+      read(const etl::span<T, Length>& values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      bool success = (bits_available >= (values.size() * nbits));
+
+      if (success)
+      {
+        read_unchecked(values, nbits);
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// Returns the number of bytes in the stream buffer.
     //***************************************************************************
@@ -1254,6 +1373,18 @@ namespace etl
 
   private:
 
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t window_type;
+#else
+    typedef uint32_t window_type;
+#endif
+
+    /// The width of the window used to read or write many bits at once.
+    static ETL_CONSTANT uint_least8_t Window_Bits = CHAR_BIT * sizeof(window_type);
+
+    /// The most bits that one window can hold, whatever the bit offset in the current char.
+    static ETL_CONSTANT uint_least8_t Max_Window_Bits = Window_Bits - (CHAR_BIT - 1U);
+
     //***************************************************************************
     /// Read a value from the stream.
     /// It will be passed one of five unsigned types.
@@ -1265,57 +1396,71 @@ namespace etl
       nbits = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
 
       T value = 0;
-      uint_least8_t bits = nbits;
 
-      // Get the bits from the stream.
-      while (nbits != 0)
+      if (nbits != 0U)
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-
-        T chunk = get_chunk(mask_width);
-
-        nbits -= mask_width;
-        value |= static_cast<T>(chunk << nbits);
+        if (nbits <= Max_Window_Bits)
+        {
+          value = static_cast<T>(read_window(nbits));
+        }
+        else
+        {
+          // Too wide for one window at every bit offset, so read in two parts.
+          window_type w = read_window(static_cast<uint_least8_t>(nbits - (Window_Bits / 2U)));
+          w = (w << (Window_Bits / 2U)) | read_window(Window_Bits / 2U);
+          value = static_cast<T>(w);
+        }
       }
 
       if (stream_endianness == etl::endian::little)
       {
-        value = value << ((CHAR_BIT * sizeof(T)) - bits);
+        value = value << ((CHAR_BIT * sizeof(T)) - nbits);
         value = etl::reverse_bits(value);
       }
 
-      if (is_signed && (bits != (CHAR_BIT * sizeof(T))))
+      if (is_signed && (nbits != (CHAR_BIT * sizeof(T))))
       {
-        value = etl::sign_extend<T, T>(value, bits);
+        value = etl::sign_extend<T, T>(value, nbits);
       }
 
       return value;
     }
 
     //***************************************************************************
-    /// Get a data chunk from the stream
+    /// Read up to Max_Window_Bits from the stream.
+    /// Loads the chars spanning the bits into a window and extracts them with
+    /// one shift, rather than a char at a time.
     //***************************************************************************
-    unsigned char get_chunk(unsigned char nbits)
+    window_type read_window(uint_least8_t nbits)
     {
-      unsigned char value = pdata[char_index];
-      value >>= (bits_available_in_char - nbits);
+      const size_t offset = CHAR_BIT - bits_available_in_char;
+      const size_t total  = offset + nbits;
 
-      unsigned char mask;
+      window_type w = 0U;
 
-      if (nbits == CHAR_BIT)
+      if ((char_index + sizeof(window_type)) <= length_chars)
       {
-        mask = etl::integral_limits<unsigned char>::max;
+        memcpy(&w, pdata + char_index, sizeof(window_type));
+        w = etl::ntoh(w);
       }
       else
       {
-        mask = (1U << nbits) - 1;
+        // Near the end of the buffer, so only load the chars that hold the bits.
+        const size_t n_chars = (total + CHAR_BIT - 1U) / CHAR_BIT;
+
+        for (size_t i = 0U; i < n_chars; ++i)
+        {
+          w |= static_cast<window_type>(static_cast<unsigned char>(pdata[char_index + i])) << (Window_Bits - (CHAR_BIT * (i + 1U)));
+        }
       }
 
-      value &= mask;
+      w = (w << offset) >> (Window_Bits - nbits);
 
-      step(nbits);
+      char_index            += total / CHAR_BIT;
+      bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - (total % CHAR_BIT));
+      bits_available        -= nbits;
 
-      return value;
+      return w;
     }
 
     //***************************************************************************
@@ -0,0 +1,232 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BLOCKING_QUEUE_INCLUDED
+#define ETL_BLOCKING_QUEUE_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "atomic_wait.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC_WAIT
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue
+  /// A front end for a thread safe queue, such as etl::queue_spsc_atomic, that
+  /// adds a pop that sleeps while the queue is empty, using etl::atomic_wait.
+  /// Pushes only call the OS when a consumer is waiting.
+  /// All pushes must be made through the front end.
+  ///\tparam TQueue The queue type.
+  //***************************************************************************
+  template <typename TQueue>
+  class blocking_queue
+  {
+  public:
+
+    typedef TQueue                             queue_type;
+    typedef typename queue_type::value_type    value_type;
+    typedef typename queue_type::size_type     size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    blocking_queue()
+      : pushes(0U)
+      , waiting(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Pushes a value and wakes any waiting consumer.
+    ///\return <b>true</b> if there was room for the value.
+    //*************************************************************************
+    bool push(const value_type& value)
+    {
+      if (!queue.push(value))
+      {
+        return false;
+      }
+
+      notify();
+
+      return true;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Pushes a value and wakes any waiting consumer.
+    ///\return <b>true</b> if there was room for the value.
+    //*************************************************************************
+    bool push(value_type&& value)
+    {
+      if (!queue.push(etl::move(value)))
+      {
+        return false;
+      }
+
+      notify();
+
+      return true;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pops a value, if there is one.
+    ///\return <b>true</b> if a value was popped.
+    //*************************************************************************
+    bool pop(value_type& value)
+    {
+      return queue.pop(value);
+    }
+
+    //*************************************************************************
+    /// Pops a value, sleeping for up to timeout_ms while the queue is empty.
+    ///\return <b>true</b> if a value was popped, <b>false</b> if timed out.
+    //*************************************************************************
+    bool pop_wait(value_type& value, uint32_t timeout_ms = etl::atomic_wait_forever)
+    {
+      if (queue.pop(value))
+      {
+        return true;
+      }
+
+      const uint32_t start  = private_atomic_wait::platform::now_ms();
+      bool           popped = false;
+
+      waiting.fetch_add(1U);
+
+      while (true)
+      {
+        // Read before popping, so a push after a failed pop changes it.
+        const uint32_t seen = pushes.load();
+
+        if (queue.pop(value))
+        {
+          popped = true;
+          break;
+        }
+
+        uint32_t remaining = etl::atomic_wait_forever;
+
+        if (timeout_ms != etl::atomic_wait_forever)
+        {
+          const uint32_t elapsed = uint32_t(private_atomic_wait::platform::now_ms() - start);
+
+          if (elapsed >= timeout_ms)
+          {
+            break;
+          }
+
+          remaining = timeout_ms - elapsed;
+        }
+
+        etl::atomic_wait_for(pushes, seen, remaining);
+      }
+
+      waiting.fetch_sub(1U);
+
+      return popped;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the queue is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the queue is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return queue.full();
+    }
+
+    //*************************************************************************
+    /// Returns the number of values in the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      return queue.size();
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the queue.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return queue.capacity();
+    }
+
+    //*************************************************************************
+    /// Gets the queue, to read its state.
+    //*************************************************************************
+    const queue_type& get_queue() const
+    {
+      return queue;
+    }
+
+  private:
+
+    blocking_queue(const blocking_queue&) ETL_DELETE;
+    blocking_queue& operator=(const blocking_queue&) ETL_DELETE;
+
+    //*************************************************************************
+    /// Counts the push, then wakes the consumers, if any are waiting.
+    /// Both are sequentially consistent with the consumer's count of waiting
+    /// and read of pushes, so either the consumer sees the push or the
+    /// producer sees the consumer.
+    //*************************************************************************
+    void notify()
+    {
+      pushes.fetch_add(1U);
+
+      if (waiting.load() != 0U)
+      {
+        etl::atomic_notify_all(pushes);
+      }
+    }
+
+    queue_type              queue;
+    etl::atomic<uint32_t>   pushes;
+    etl::atomic<uint32_t>   waiting;
+  };
+}
+
+#endif
+#endif
@@ -38,6 +38,10 @@ SOFTWARE.
 #include "binary.h"
 #include "log.h"
 #include "power.h"
+#include "span.h"
+#include "static_assert.h"
+
+#include <stdint.h>
 
 ///\defgroup bloom_filter bloom_filter
 /// A Bloom filter
@@ -184,7 +188,537 @@ namespace etl
     /// The Bloom filter flags.
     etl::bitset<WIDTH> flags;
   };
-}
+  //***************************************************************************
+  /// A counting Bloom filter, that allows keys to be removed.
+  /// Each flag is a packed 4 bit counter. A counter that reaches 15 is
+  /// saturated, and is never decremented, so that removal never causes a
+  /// false negative.
+  /// Allows up to three hashes to be defined.
+  /// Hashes must support the () operator and define 'argument_type'.
+  ///\tparam Desired_Width The desired number of counters. Rounded up to a power of 2.
+  ///\tparam THash1        The first hash generator class.
+  ///\tparam THash2        The second hash generator class. If omitted, uses the null hash.
+  ///\tparam THash3        The third hash generator class.  If omitted, uses the null hash.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t   Desired_Width,
+            typename THash1,
+            typename THash2 = private_bloom_filter::null_hash,
+            typename THash3 = private_bloom_filter::null_hash>
+  class counting_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash1::argument_type>::type parameter_t;
+    typedef private_bloom_filter::null_hash null_hash;
+
+  public:
+
+    enum
+    {
+      WIDTH     = etl::power_of_2_round_up<Desired_Width>::value,
+      MAX_COUNT = 15
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    counting_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Storage_Size; ++i)
+      {
+        counters[i] = 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      increment(get_hash<THash1>(key));
+
+      if (!etl::is_same<THash2, null_hash>::value)
+      {
+        increment(get_hash<THash2>(key));
+      }
+
+      if (!etl::is_same<THash3, null_hash>::value)
+      {
+        increment(get_hash<THash3>(key));
+      }
+    }
+
+    //***************************************************************************
+    /// Removes a key from the filter.
+    /// Only keys that were previously added should be removed.
+    ///\param  key The key to remove.
+    ///\return <b>false</b> if the key did not exist in the filter.
+    //***************************************************************************
+    bool remove(parameter_t key)
+    {
+      if (!exists(key))
+      {
+        return false;
+      }
+
+      decrement(get_hash<THash1>(key));
+
+      if (!etl::is_same<THash2, null_hash>::value)
+      {
+        decrement(get_hash<THash2>(key));
+      }
+
+      if (!etl::is_same<THash3, null_hash>::value)
+      {
+        decrement(get_hash<THash3>(key));
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      bool exists1 = get_count(get_hash<THash1>(key)) != 0U;
+      bool exists2 = true;
+      bool exists3 = true;
+
+      // Do we have a second hash?
+      if (!etl::is_same<THash2, null_hash>::value)
+      {
+        exists2 = get_count(get_hash<THash2>(key)) != 0U;
+      }
 
+      // Do we have a third hash?
+      if (!etl::is_same<THash3, null_hash>::value)
+      {
+        exists3 = get_count(get_hash<THash3>(key)) != 0U;
+      }
+
+      return exists1 && exists2 && exists3;
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of non-zero counters.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < WIDTH; ++i)
+      {
+        n += (get_count(i) != 0U) ? 1U : 0U;
+      }
+
+      return n;
+    }
+
+    //***************************************************************************
+    /// Returns the number of saturated counters.
+    //***************************************************************************
+    size_t saturated() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < WIDTH; ++i)
+      {
+        n += (get_count(i) == MAX_COUNT) ? 1U : 0U;
+      }
+
+      return n;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Storage_Size = (WIDTH + 1U) / 2U;
+
+    //***************************************************************************
+    /// Gets the hash for the key.
+    ///\param  key The key.
+    ///\return The hash value.
+    //***************************************************************************
+    template <typename THash>
+    size_t get_hash(parameter_t key) const
+    {
+      size_t hash = THash()(key);
+
+      // Fold the hash down to fit the width.
+      return fold_bits<size_t, etl::log2<WIDTH>::value>(hash);
+    }
+
+    //***************************************************************************
+    /// Gets the counter at the index.
+    //***************************************************************************
+    uint8_t get_count(size_t index) const
+    {
+      const uint8_t pair = counters[index / 2U];
+
+      return ((index & 1U) == 0U) ? (pair & 0x0FU) : (pair >> 4U);
+    }
+
+    //***************************************************************************
+    /// Sets the counter at the index.
+    //***************************************************************************
+    void set_count(size_t index, uint8_t value)
+    {
+      uint8_t& pair = counters[index / 2U];
+
+      if ((index & 1U) == 0U)
+      {
+        pair = static_cast<uint8_t>((pair & 0xF0U) | value);
+      }
+      else
+      {
+        pair = static_cast<uint8_t>((pair & 0x0FU) | (value << 4U));
+      }
+    }
+
+    //***************************************************************************
+    /// Increments the counter at the index, unless saturated.
+    //***************************************************************************
+    void increment(size_t index)
+    {
+      const uint8_t value = get_count(index);
+
+      if (value != MAX_COUNT)
+      {
+        set_count(index, static_cast<uint8_t>(value + 1U));
+      }
+    }
+
+    //***************************************************************************
+    /// Decrements the counter at the index, unless saturated or zero.
+    //***************************************************************************
+    void decrement(size_t index)
+    {
+      const uint8_t value = get_count(index);
+
+      if ((value != MAX_COUNT) && (value != 0U))
+      {
+        set_count(index, static_cast<uint8_t>(value - 1U));
+      }
+    }
+
+    /// The packed counters. Two per byte.
+    uint8_t counters[Storage_Size];
+  };
+
+  template <size_t Desired_Width, typename THash1, typename THash2, typename THash3>
+  ETL_CONSTANT size_t counting_bloom_filter<Desired_Width, THash1, THash2, THash3>::Storage_Size;
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// A blocked Bloom filter.
+  /// Each key maps to a single 64 byte block, so that add and exists touch
+  /// one cache line. The K bits within the block are derived from a single
+  /// hash by double hashing, and are tested together as a set of word masks.
+  /// Hashes must support the () operator and define 'argument_type'.
+  ///\tparam Desired_Width The desired number of bits. Rounded up to a whole number of blocks.
+  ///\tparam THash         The hash generator class.
+  ///\tparam K             The number of bits set for each key. Default 8.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t   Desired_Width,
+            typename THash,
+            size_t   K = 8U>
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((K > 0U) && (K <= 16U), "K must be between 1 and 16");
+
+    typedef typename THash::argument_type key_type;
+
+    enum
+    {
+      WORDS_PER_BLOCK = 8,
+      BLOCK_BITS      = WORDS_PER_BLOCK * 64,
+      BLOCKS          = (Desired_Width == 0U) ? 1U : (Desired_Width + BLOCK_BITS - 1U) / BLOCK_BITS,
+      WIDTH           = BLOCKS * BLOCK_BITS,
+      HASH_COUNT      = K
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    blocked_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t b = 0U; b < BLOCKS; ++b)
+      {
+        for (size_t w = 0U; w < WORDS_PER_BLOCK; ++w)
+        {
+          blocks[b].word[w] = 0U;
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      const uint64_t hash = get_hash(key);
+
+      uint64_t mask[WORDS_PER_BLOCK];
+      make_mask(hash, mask);
+
+      block_t& block = blocks[block_index(hash)];
+
+      for (size_t w = 0U; w < WORDS_PER_BLOCK; ++w)
+      {
+        block.word[w] |= mask[w];
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a range of keys to the filter.
+    //***************************************************************************
+    template <typename TIterator>
+    void add(TIterator begin, TIterator end)
+    {
+      while (begin != end)
+      {
+        add(*begin);
+        ++begin;
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a span of keys to the filter.
+    //***************************************************************************
+    void add(const etl::span<const key_type>& keys)
+    {
+      add(keys.begin(), keys.end());
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      const uint64_t hash = get_hash(key);
+
+      uint64_t mask[WORDS_PER_BLOCK];
+      make_mask(hash, mask);
+
+      return test(blocks[block_index(hash)], mask);
+    }
+
+    //***************************************************************************
+    /// Tests a range of keys, writing a bool result for each to the output.
+    /// The keys are hashed in batches before their blocks are tested, so
+    /// that the block reads of a batch are independent of each other.
+    ///\return An iterator to one past the last result written.
+    //***************************************************************************
+    template <typename TIterator, typename TOutputIterator>
+    TOutputIterator exists(TIterator begin, TIterator end, TOutputIterator out) const
+    {
+      uint64_t hashes[Batch_Size];
+
+      while (begin != end)
+      {
+        size_t n = 0U;
+
+        while ((n < Batch_Size) && (begin != end))
+        {
+          hashes[n++] = get_hash(*begin);
+          ++begin;
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          uint64_t mask[WORDS_PER_BLOCK];
+          make_mask(hashes[i], mask);
+
+          *out = test(blocks[block_index(hashes[i])], mask);
+          ++out;
+        }
+      }
+
+      return out;
+    }
+
+    //***************************************************************************
+    /// Tests a span of keys, writing a bool result for each to the output.
+    ///\return An iterator to one past the last result written.
+    //***************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator exists(const etl::span<const key_type>& keys, TOutputIterator out) const
+    {
+      return exists(keys.begin(), keys.end(), out);
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of blocks.
+    //***************************************************************************
+    size_t block_count() const
+    {
+      return BLOCKS;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter flags set.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t b = 0U; b < BLOCKS; ++b)
+      {
+        for (size_t w = 0U; w < WORDS_PER_BLOCK; ++w)
+        {
+          n += etl::count_bits(blocks[b].word[w]);
+        }
+      }
+
+      return n;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Batch_Size = 8U;
+
+    //***************************************************************************
+    /// One cache line of flags.
+    //***************************************************************************
+    struct block_t
+    {
+#if ETL_USING_CPP11 && !defined(ETL_COMPILER_ARM5)
+      alignas(64) uint64_t word[WORDS_PER_BLOCK];
+#else
+      uint64_t word[WORDS_PER_BLOCK];
+#endif
+    };
+
+    //***************************************************************************
+    /// Gets the hash for the key, mixed to 64 bits.
+    //***************************************************************************
+    static uint64_t get_hash(parameter_t key)
+    {
+      uint64_t hash = static_cast<uint64_t>(THash()(key));
+
+      hash ^= hash >> 33U;
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= hash >> 33U;
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= hash >> 33U;
+
+      return hash;
+    }
+
+    //***************************************************************************
+    /// The block for a hash, from the upper 32 bits.
+    //***************************************************************************
+    static uint32_t block_index(uint64_t hash)
+    {
+      return static_cast<uint32_t>(((hash >> 32U) * static_cast<uint64_t>(BLOCKS)) >> 32U);
+    }
+
+    //***************************************************************************
+    /// The word masks for a hash, from the lower 32 bits.
+    /// The step is odd, so the K bit positions are distinct.
+    //***************************************************************************
+    static void make_mask(uint64_t hash, uint64_t (&mask)[WORDS_PER_BLOCK])
+    {
+      for (size_t w = 0U; w < WORDS_PER_BLOCK; ++w)
+      {
+        mask[w] = 0U;
+      }
+
+      uint32_t       bit  = static_cast<uint32_t>(hash);
+      const uint32_t step = static_cast<uint32_t>(hash >> 16U) | 1U;
+
+      for (size_t i = 0U; i < K; ++i)
+      {
+        const uint32_t position = bit % BLOCK_BITS;
+        mask[position / 64U] |= uint64_t(1U) << (position % 64U);
+        bit += step;
+      }
+    }
+
+    //***************************************************************************
+    /// Tests all of the mask bits in a block at once.
+    //***************************************************************************
+    static bool test(const block_t& block, const uint64_t (&mask)[WORDS_PER_BLOCK])
+    {
+      uint64_t missing = 0U;
+
+      for (size_t w = 0U; w < WORDS_PER_BLOCK; ++w)
+      {
+        missing |= mask[w] & ~block.word[w];
+      }
+
+      return missing == 0U;
+    }
+
+    /// The Bloom filter blocks.
+    block_t blocks[BLOCKS];
+  };
+
+  template <size_t Desired_Width, typename THash, size_t K>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, K>::Batch_Size;
 #endif
+}
 
+#endif
@@ -0,0 +1,365 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BROADCAST_RING_INCLUDED
+#define ETL_BROADCAST_RING_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "seqlock.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_SEQLOCK
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception for a broadcast ring.
+  //***************************************************************************
+  class broadcast_ring_exception : public exception
+  {
+  public:
+
+    broadcast_ring_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for a reader that is not subscribed.
+  //***************************************************************************
+  class broadcast_ring_invalid_reader : public broadcast_ring_exception
+  {
+  public:
+
+    broadcast_ring_invalid_reader(string_type file_name_, numeric_type line_number_)
+      : broadcast_ring_exception(ETL_ERROR_TEXT("broadcast_ring:invalid reader", ETL_BROADCAST_RING_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A single producer, multiple consumer ring where every reader sees every value.
+  /// Each reader has its own cursor, so values are stored once for all readers.
+  /// The writer never waits for the readers. It overwrites the oldest value,
+  /// and a reader that falls more than SIZE values behind detects it from the
+  /// position stored with the value, skips to the oldest value still held,
+  /// and counts the values it lost.
+  /// Each slot is an etl::seqlock, so T must be trivially copyable.
+  ///\tparam T           The type of the values.
+  ///\tparam SIZE        The number of values held. Must be a power of two.
+  ///\tparam MAX_READERS The maximum number of subscribed readers.
+  //***************************************************************************
+  template <typename T, size_t SIZE, size_t MAX_READERS>
+  class broadcast_ring
+  {
+  public:
+
+    ETL_STATIC_ASSERT((SIZE != 0U) && ((SIZE & (SIZE - 1U)) == 0U), "SIZE must be a power of two");
+    ETL_STATIC_ASSERT(SIZE <= 0x80000000UL, "SIZE too large");
+    ETL_STATIC_ASSERT(MAX_READERS != 0U, "MAX_READERS must not be zero");
+
+    typedef T      value_type;
+    typedef size_t reader_id;
+
+    static ETL_CONSTANT size_t    Size          = SIZE;
+    static ETL_CONSTANT size_t    Max_Readers   = MAX_READERS;
+    static ETL_CONSTANT reader_id No_Reader     = MAX_READERS;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    broadcast_ring()
+      : written(0U)
+      , position(0U)
+    {
+      initialise(0U);
+    }
+
+    //*************************************************************************
+    /// Writer: Adds a value, overwriting the oldest if the ring is full.
+    /// Never waits for the readers.
+    //*************************************************************************
+    void push(const T& value)
+    {
+      slot_value slot;
+      slot.position = position;
+      slot.value    = value;
+
+      slots[position & Index_Mask].write(slot);
+
+      ++position;
+      written.store(position, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Subscribes a new reader.
+    /// The reader sees values pushed from now on.
+    ///\return The reader's id, or No_Reader if MAX_READERS are subscribed.
+    //*************************************************************************
+    reader_id subscribe()
+    {
+      for (reader_id id = 0U; id < MAX_READERS; ++id)
+      {
+        uint_least8_t expected = 0U;
+
+        if (readers[id].subscribed.compare_exchange_strong(expected, 1U, etl::memory_order_acquire))
+        {
+          readers[id].cursor.store(written.load(etl::memory_order_acquire), etl::memory_order_relaxed);
+          readers[id].lost.store(0U, etl::memory_order_relaxed);
+
+          return id;
+        }
+      }
+
+      return No_Reader;
+    }
+
+    //*************************************************************************
+    /// Unsubscribes a reader, freeing its cursor.
+    //*************************************************************************
+    void unsubscribe(reader_id id)
+    {
+      ETL_ASSERT_OR_RETURN(is_subscribed(id), ETL_ERROR(broadcast_ring_invalid_reader));
+
+      readers[id].subscribed.store(0U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the id is a subscribed reader.
+    //*************************************************************************
+    bool is_subscribed(reader_id id) const
+    {
+      return (id < MAX_READERS) && (readers[id].subscribed.load(etl::memory_order_acquire) != 0U);
+    }
+
+    //*************************************************************************
+    /// Reader: Gets the reader's next value.
+    /// If the writer has overwritten it, skips to the oldest value still held.
+    ///\param id    The reader.
+    ///\param value Receives the value.
+    ///\return <b>true</b> if a value was read, <b>false</b> if there are no new values.
+    //*************************************************************************
+    bool pop(reader_id id, T& value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(is_subscribed(id), ETL_ERROR(broadcast_ring_invalid_reader), false);
+
+      reader& r = readers[id];
+
+      uint32_t next = r.cursor.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_value slot;
+        uint32_t   count;
+
+        if (!slots[next & Index_Mask].try_read(slot, count))
+        {
+          if ((count & 1U) != 0U)
+          {
+            // Being written now.
+            return false;
+          }
+
+          // Overwritten during the read.
+          continue;
+        }
+
+        // Compared in the same wrapping arithmetic as the positions.
+        const int32_t ahead = static_cast<int32_t>(slot.position - next);
+
+        if (ahead < 0)
+        {
+          // Not yet written.
+          return false;
+        }
+        else if (ahead > 0)
+        {
+          // Overwritten. Skip to the oldest value that the writer is not about to overwrite.
+          uint32_t oldest = written.load(etl::memory_order_acquire) - Ring_Size + 1U;
+
+          // The count of values written may lag the slot being overwritten.
+          if (static_cast<int32_t>(oldest - next) <= 0)
+          {
+            oldest = next + 1U;
+          }
+
+          r.lost.store(r.lost.load(etl::memory_order_relaxed) + (oldest - next), etl::memory_order_relaxed);
+          next = oldest;
+        }
+        else
+        {
+          value = slot.value;
+          r.cursor.store(next + 1U, etl::memory_order_release);
+          return true;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Reader: Gets the number of values waiting for the reader, at most SIZE.
+    //*************************************************************************
+    size_t size(reader_id id) const
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(is_subscribed(id), ETL_ERROR(broadcast_ring_invalid_reader), 0U);
+
+      const uint32_t waiting = written.load(etl::memory_order_acquire) - readers[id].cursor.load(etl::memory_order_acquire);
+
+      return (waiting > SIZE) ? SIZE : size_t(waiting);
+    }
+
+    //*************************************************************************
+    /// Reader: Returns <b>true</b> if there are no values waiting for the reader.
+    //*************************************************************************
+    bool empty(reader_id id) const
+    {
+      return size(id) == 0U;
+    }
+
+    //*************************************************************************
+    /// Reader: Gets the number of values the reader has lost to the writer.
+    //*************************************************************************
+    uint32_t lost(reader_id id) const
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(is_subscribed(id), ETL_ERROR(broadcast_ring_invalid_reader), 0U);
+
+      return readers[id].lost.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Gets the number of values held for each reader.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t capacity()
+    {
+      return SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of readers.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t max_readers()
+    {
+      return MAX_READERS;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor, with the counts starting as if 'initial_count' values had
+    /// been pushed. Used to test the wrap of the counts.
+    //*************************************************************************
+    explicit broadcast_ring(uint32_t initial_count)
+      : written(initial_count)
+      , position(initial_count)
+    {
+      initialise(initial_count);
+    }
+
+  private:
+
+    static ETL_CONSTANT uint32_t Ring_Size  = static_cast<uint32_t>(SIZE);
+    static ETL_CONSTANT uint32_t Index_Mask = static_cast<uint32_t>(SIZE - 1U);
+
+    //*************************************************************************
+    /// A value, with the position it was pushed at.
+    //*************************************************************************
+    struct slot_value
+    {
+      uint32_t position;
+      T        value;
+    };
+
+    //*************************************************************************
+    /// The state of one reader.
+    //*************************************************************************
+    struct reader
+    {
+      etl::atomic<uint_least8_t> subscribed;
+      etl::atomic_uint32_t       cursor; ///< The position of the next value to read.
+      etl::atomic_uint32_t       lost;
+    };
+
+    //*************************************************************************
+    /// Marks every slot as holding the value from the lap before
+    /// 'initial_count', so that none of them is read before it is pushed.
+    //*************************************************************************
+    void initialise(uint32_t initial_count)
+    {
+      for (uint32_t i = 0U; i < Ring_Size; ++i)
+      {
+        slot_value slot;
+        slot.position = initial_count - Ring_Size + i;
+        slot.value    = T();
+
+        slots[slot.position & Index_Mask].write(slot);
+      }
+
+      for (size_t i = 0U; i < MAX_READERS; ++i)
+      {
+        readers[i].subscribed.store(0U, etl::memory_order_relaxed);
+        readers[i].cursor.store(initial_count, etl::memory_order_relaxed);
+        readers[i].lost.store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    broadcast_ring(const broadcast_ring&) ETL_DELETE;
+    broadcast_ring& operator=(const broadcast_ring&) ETL_DELETE;
+
+    etl::seqlock<slot_value> slots[SIZE];
+    reader               readers[MAX_READERS];
+    etl::atomic_uint32_t written;  ///< The number of values pushed, for the readers.
+    uint32_t             position; ///< The number of values pushed, owned by the writer.
+  };
+
+  template <typename T, size_t SIZE, size_t MAX_READERS>
+  ETL_CONSTANT size_t broadcast_ring<T, SIZE, MAX_READERS>::Size;
+
+  template <typename T, size_t SIZE, size_t MAX_READERS>
+  ETL_CONSTANT size_t broadcast_ring<T, SIZE, MAX_READERS>::Max_Readers;
+
+  template <typename T, size_t SIZE, size_t MAX_READERS>
+  ETL_CONSTANT typename broadcast_ring<T, SIZE, MAX_READERS>::reader_id broadcast_ring<T, SIZE, MAX_READERS>::No_Reader;
+
+  template <typename T, size_t SIZE, size_t MAX_READERS>
+  ETL_CONSTANT uint32_t broadcast_ring<T, SIZE, MAX_READERS>::Ring_Size;
+
+  template <typename T, size_t SIZE, size_t MAX_READERS>
+  ETL_CONSTANT uint32_t broadcast_ring<T, SIZE, MAX_READERS>::Index_Mask;
+}
+
+#endif
+#endif
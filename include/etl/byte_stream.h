@@ -36,6 +36,7 @@ SOFTWARE.
 #include "nullptr.h"
 #include "endianness.h"
 #include "integral_limits.h"
+#include "binary.h"
 #include "algorithm.h"
 #include "iterator.h"
 #include "memory.h"
@@ -48,9 +49,217 @@ SOFTWARE.
 
 #include <stdint.h>
 #include <limits.h>
+#include <string.h>
+
+#if ETL_USING_BUILTIN_BMI2
+  #include <immintrin.h>
+#endif
 
 namespace etl
 {
+  namespace private_byte_stream
+  {
+    //*************************************************************************
+    /// Reverses the bytes of an integral value.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, T>::type
+      reverse_value(T value)
+    {
+      return etl::reverse_bytes(value);
+    }
+
+    //*************************************************************************
+    /// Reverses the bytes of a floating point value.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<!etl::is_integral<T>::value, T>::type
+      reverse_value(T value)
+    {
+      char* pv = reinterpret_cast<char*>(&value);
+      etl::reverse(pv, pv + sizeof(T));
+
+      return value;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// The maximum number of bytes in a varint of T.
+    //*************************************************************************
+    template <typename T>
+    struct varint_max_size
+    {
+      static ETL_CONSTANT size_t value = (etl::integral_limits<T>::bits + 6U) / 7U;
+    };
+
+    template <typename T>
+    ETL_CONSTANT size_t varint_max_size<T>::value;
+
+    //*************************************************************************
+    /// Maps an unsigned value to its varint value.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_unsigned<T>::value, uint64_t>::type
+      to_varint_value(T value)
+    {
+      return static_cast<uint64_t>(value);
+    }
+
+    //*************************************************************************
+    /// Maps a signed value to its varint value, with zigzag encoding.
+    /// 0, -1, 1, -2, 2 ... map to 0, 1, 2, 3, 4 ...
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_signed<T>::value, uint64_t>::type
+      to_varint_value(T value)
+    {
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      const unsigned_t u    = static_cast<unsigned_t>(value);
+      const unsigned_t sign = static_cast<unsigned_t>(unsigned_t(0) - (u >> (etl::integral_limits<T>::bits - 1U)));
+
+      return static_cast<uint64_t>(static_cast<unsigned_t>((u << 1U) ^ sign));
+    }
+
+    //*************************************************************************
+    /// Maps a varint value to an unsigned value.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_unsigned<T>::value, T>::type
+      from_varint_value(uint64_t value)
+    {
+      return static_cast<T>(value);
+    }
+
+    //*************************************************************************
+    /// Maps a zigzag encoded varint value to a signed value.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_signed<T>::value, T>::type
+      from_varint_value(uint64_t value)
+    {
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      const unsigned_t u = static_cast<unsigned_t>(value);
+
+      return static_cast<T>(static_cast<unsigned_t>((u >> 1U) ^ static_cast<unsigned_t>(unsigned_t(0) - (u & 1U))));
+    }
+
+    //*************************************************************************
+    /// The number of bytes in the varint of a varint value.
+    //*************************************************************************
+    inline size_t varint_size(uint64_t value)
+    {
+      size_t size = 1U;
+
+      while (value >= 0x80U)
+      {
+        value >>= 7U;
+        ++size;
+      }
+
+      return size;
+    }
+
+    //*************************************************************************
+    /// Encodes a varint value as LEB128.
+    /// Returns the position after it.
+    //*************************************************************************
+    inline char* encode_varint(char* destination, uint64_t value)
+    {
+      while (value >= 0x80U)
+      {
+        *destination++ = static_cast<char>((value & 0x7FU) | 0x80U);
+        value >>= 7U;
+      }
+
+      *destination++ = static_cast<char>(value);
+
+      return destination;
+    }
+
+    //*************************************************************************
+    /// Decodes an LEB128 varint of at most max_size bytes.
+    /// Returns the number of bytes decoded, or 0 if the varint is truncated,
+    /// longer than max_size, or overflows 64 bits.
+    /// If 8 bytes are available, a varint of up to 8 bytes is decoded without
+    /// a loop, by gathering the 7 bit groups of a 64 bit word.
+    //*************************************************************************
+    inline size_t decode_varint(const char* source, size_t available, size_t max_size, uint64_t& value)
+    {
+      if (available >= 8U)
+      {
+        uint64_t word;
+        memcpy(&word, source, sizeof(word));
+
+        if (etl::endianness::value() == etl::endian::big)
+        {
+          word = etl::reverse_bytes(word);
+        }
+
+        // The top bit of each byte that ends the varint.
+        const uint64_t stops = ~word & 0x8080808080808080ULL;
+
+        if (stops != 0U)
+        {
+          const size_t length = (etl::count_trailing_zeros(stops) + 1U) / 8U;
+
+          // Keep the bytes up to, and including, the last.
+          word &= stops ^ (stops - 1U);
+
+#if ETL_USING_BUILTIN_BMI2
+          value = _pext_u64(word, 0x7F7F7F7F7F7F7F7FULL);
+#else
+          word &= 0x7F7F7F7F7F7F7F7FULL;
+          word = ((word & 0x7F007F007F007F00ULL) >> 1U) | (word & 0x007F007F007F007FULL);
+          word = ((word & 0x3FFF00003FFF0000ULL) >> 2U) | (word & 0x00003FFF00003FFFULL);
+          word = ((word & 0x0FFFFFFF00000000ULL) >> 4U) | (word & 0x000000000FFFFFFFULL);
+          value = word;
+#endif
+
+          return (length <= max_size) ? length : 0U;
+        }
+      }
+
+      const size_t limit = (available < max_size) ? available : max_size;
+
+      value = 0U;
+
+      for (size_t i = 0U; i < limit; ++i)
+      {
+        const uint64_t byte = static_cast<uint8_t>(source[i]);
+
+        // The tenth byte may only hold the top bit of a 64 bit value.
+        if ((i == 9U) && (byte > 1U))
+        {
+          return 0U;
+        }
+
+        value |= (byte & 0x7FU) << (7U * i);
+
+        if ((byte & 0x80U) == 0U)
+        {
+          return i + 1U;
+        }
+      }
+
+      return 0U;
+    }
+#endif
+  }
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// The number of bytes that write_varint uses for a value.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_integral<T>::value, size_t>::type
+    varint_size(T value)
+  {
+    return private_byte_stream::varint_size(private_byte_stream::to_varint_value(value));
+  }
+#endif
+
   //***************************************************************************
   /// Encodes a byte stream.
   //***************************************************************************
@@ -181,13 +390,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const etl::span<T>& range)
     {
-      typename etl::span<T>::iterator itr = range.begin();
-
-      while (itr != range.end())
-      {
-        to_bytes(*itr);
-        ++itr;
-      }
+      write_unchecked(range.data(), range.size());
     }
 
     //***************************************************************************
@@ -214,10 +417,24 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const T* start, size_t length)
     {
-      while (length-- != 0U)
+      if (is_block_copyable<T>())
       {
-        to_bytes(*start);
-        ++start;
+        // The range has the stream's layout, so is copied, and passed to the callback, as one block.
+        if (length != 0U)
+        {
+          const size_t n = length * sizeof(T);
+
+          memcpy(pcurrent, start, n);
+          step(n);
+        }
+      }
+      else
+      {
+        while (length-- != 0U)
+        {
+          to_bytes(*start);
+          ++start;
+        }
       }
     }
 
@@ -238,6 +455,240 @@ namespace etl
       return success;
     }
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Writes a value to the stream as an LEB128 varint, without checking for space.
+    /// Signed values are zigzag encoded, so small magnitudes use few bytes.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type
+      write_varint_unchecked(T value)
+    {
+      char* pend = private_byte_stream::encode_varint(pcurrent, private_byte_stream::to_varint_value(value));
+
+      step(static_cast<size_t>(pend - pcurrent));
+    }
+
+    //***************************************************************************
+    /// Writes a value to the stream as an LEB128 varint.
+    /// Signed values are zigzag encoded, so small magnitudes use few bytes.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      write_varint(T value)
+    {
+      const uint64_t varint = private_byte_stream::to_varint_value(value);
+
+      bool success = (available_bytes() >= private_byte_stream::varint_max_size<T>::value) ||
+                     (available_bytes() >= private_byte_stream::varint_size(varint));
+
+      if (success)
+      {
+        char* pend = private_byte_stream::encode_varint(pcurrent, varint);
+
+        step(static_cast<size_t>(pend - pcurrent));
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Writes a range of T to the stream as varints, without checking for space.
+    /// The range is passed to the callback as one block.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type
+      write_varint_unchecked(const T* start, size_t length)
+    {
+      char* pend = pcurrent;
+
+      while (length-- != 0U)
+      {
+        pend = private_byte_stream::encode_varint(pend, private_byte_stream::to_varint_value(*start));
+        ++start;
+      }
+
+      step(static_cast<size_t>(pend - pcurrent));
+    }
+
+    //***************************************************************************
+    /// Writes a range of T to the stream as varints.
+    /// Nothing is written unless there is space for the whole range.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      write_varint(const T* start, size_t length)
+    {
+      size_t size = 0U;
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        size += private_byte_stream::varint_size(private_byte_stream::to_varint_value(start[i]));
+      }
+
+      bool success = (available_bytes() >= size);
+
+      if (success)
+      {
+        write_varint_unchecked(start, length);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Writes a range of T to the stream as varints, without checking for space.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type
+      write_varint_unchecked(const etl::span<T>& range)
+    {
+      write_varint_unchecked(range.data(), range.size());
+    }
+
+    //***************************************************************************
+    /// Writes a range of T to the stream as varints.
+    /// Nothing is written unless there is space for the whole range.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      write_varint(const etl::span<T>& range)
+    {
+      return write_varint(range.data(), range.size());
+    }
+#endif
+
+    //***************************************************************************
+    /// Reserves space in the stream for a sequence of writes, checking the
+    /// capacity once, so that the writes need no checks.
+    /// The bytes written are committed to the stream, and passed to the callback
+    /// as one block, when the reservation is destroyed.
+    /// The stream must not be written to while the reservation exists.
+    ///\code
+    /// etl::byte_stream_writer::reservation r(writer, 7U);
+    ///
+    /// if (r.is_valid())
+    /// {
+    ///   r.write_unchecked(uint8_t(1));
+    ///   r.write_unchecked(uint16_t(2));
+    ///   r.write_unchecked(uint32_t(3));
+    /// }
+    ///\endcode
+    //***************************************************************************
+    class reservation
+    {
+    public:
+
+      //*************************************************************************
+      /// Reserves n bytes. is_valid() is <b>false</b> if they are not available.
+      //*************************************************************************
+      reservation(byte_stream_writer& stream_, size_t n)
+        : stream(stream_)
+        , pbegin(stream_.pcurrent)
+        , pcurrent(stream_.pcurrent)
+        , pend(stream_.pcurrent + ((n <= stream_.available_bytes()) ? n : 0U))
+        , valid(n <= stream_.available_bytes())
+      {
+      }
+
+      //*************************************************************************
+      /// Commits the bytes written to the stream.
+      //*************************************************************************
+      ~reservation()
+      {
+        if (pcurrent != pbegin)
+        {
+          stream.step(size_bytes());
+        }
+      }
+
+      //*************************************************************************
+      /// Returns <b>true</b> if the space was reserved.
+      //*************************************************************************
+      bool is_valid() const
+      {
+        return valid;
+      }
+
+      //*************************************************************************
+      /// The number of bytes reserved.
+      //*************************************************************************
+      size_t capacity() const
+      {
+        return static_cast<size_t>(pend - pbegin);
+      }
+
+      //*************************************************************************
+      /// The number of bytes written.
+      //*************************************************************************
+      size_t size_bytes() const
+      {
+        return static_cast<size_t>(pcurrent - pbegin);
+      }
+
+      //*************************************************************************
+      /// The number of reserved bytes left.
+      //*************************************************************************
+      size_t available_bytes() const
+      {
+        return static_cast<size_t>(pend - pcurrent);
+      }
+
+      //*************************************************************************
+      /// Writes a boolean.
+      //*************************************************************************
+      void write_unchecked(bool value)
+      {
+        *pcurrent++ = value ? 1 : 0;
+      }
+
+      //*************************************************************************
+      /// Writes a value.
+      //*************************************************************************
+      template <typename T>
+      typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
+        write_unchecked(T value)
+      {
+        pcurrent = stream.store(pcurrent, value);
+      }
+
+      //*************************************************************************
+      /// Writes a range of T.
+      //*************************************************************************
+      template <typename T>
+      typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
+        write_unchecked(const etl::span<T>& range)
+      {
+        if (stream.is_block_copyable<T>())
+        {
+          if (!range.empty())
+          {
+            memcpy(pcurrent, range.data(), range.size_bytes());
+            pcurrent += range.size_bytes();
+          }
+        }
+        else
+        {
+          for (size_t i = 0U; i < range.size(); ++i)
+          {
+            pcurrent = stream.store(pcurrent, range[i]);
+          }
+        }
+      }
+
+    private:
+
+      // Disable copy construction and assignment.
+      reservation(const reservation&) ETL_DELETE;
+      reservation& operator =(const reservation&) ETL_DELETE;
+
+      byte_stream_writer& stream;
+      char* const         pbegin;
+      char*               pcurrent;
+      char* const         pend;
+      const bool          valid;
+    };
+
     //***************************************************************************
     /// Skip n items of T, if the total space is available.
     /// Returns <b>true</b> if the skip was possible.
@@ -439,20 +890,9 @@ namespace etl
     /// to_bytes
     //***************************************************************************
     template <typename T>
-    typename etl::enable_if<sizeof(T) == 1U, void>::type
-      to_bytes(const T value)
+    void to_bytes(const T value)
     {
-      *pcurrent = static_cast<char>(value);
-      step(1U);
-    }
-
-    //*********************************
-    template <typename T>
-    typename etl::enable_if<sizeof(T) != 1U, void>::type
-      to_bytes(const T value)
-    {
-      const char* pv = reinterpret_cast<const char*>(&value);
-      copy_value(pv, pcurrent, sizeof(T));
+      store(pcurrent, value);
       step(sizeof(T));
     }
 
@@ -465,18 +905,40 @@ namespace etl
     }
 
     //*********************************
-    void copy_value(const char* source, char* destination, size_t length) const
+    /// Stores a value at the destination, in the stream's endianness.
+    /// Returns the position after it.
+    //*********************************
+    template <typename T>
+    typename etl::enable_if<sizeof(T) == 1U, char*>::type
+      store(char* destination, const T value) const
     {
-      const etl::endian platform_endianness = etl::endianness::value();
+      *destination = static_cast<char>(value);
 
-      if (stream_endianness == platform_endianness)
-      {
-        etl::copy(source, source + length, destination);
-      }
-      else
+      return destination + 1U;
+    }
+
+    //*********************************
+    template <typename T>
+    typename etl::enable_if<sizeof(T) != 1U, char*>::type
+      store(char* destination, T value) const
+    {
+      if (stream_endianness != etl::endianness::value())
       {
-        etl::reverse_copy(source, source + length, destination);
+        value = private_byte_stream::reverse_value(value);
       }
+
+      memcpy(destination, &value, sizeof(T));
+
+      return destination + sizeof(T);
+    }
+
+    //*********************************
+    /// Returns <b>true</b> if a range of T has the same layout in the stream as in memory.
+    //*********************************
+    template <typename T>
+    bool is_block_copyable() const
+    {
+      return (sizeof(T) == 1U) || (stream_endianness == etl::endianness::value());
     }
 
     char* const       pdata;             ///< The start of the byte stream buffer.
@@ -635,14 +1097,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(etl::span<T> range)
     {
-      typename etl::span<T>::iterator destination = range.begin();
-
-      while (destination != range.end())
-      {
-        *destination++ = from_bytes<T>();
-      }
-
-      return etl::span<const T>(range.begin(), range.end());
+      return read_unchecked<T>(range.data(), range.size());
     }
 
     //***************************************************************************
@@ -668,16 +1123,62 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(T* start,  size_t length)
     {
-      T* destination = start;
-
-      for (size_t i = 0; i < length; ++i)
+      if (is_block_copyable<T>())
       {
-        *destination++ = from_bytes<T>();
+        // The range has the stream's layout, so is copied as one block.
+        if (length != 0U)
+        {
+          const size_t n = length * sizeof(T);
+
+          memcpy(start, pcurrent, n);
+          pcurrent += n;
+        }
+      }
+      else
+      {
+        T* destination = start;
+
+        for (size_t i = 0; i < length; ++i)
+        {
+          *destination++ = from_bytes<T>();
+        }
       }
 
       return etl::span<const T>(start, length);
     }
 
+    //***************************************************************************
+    /// Returns <b>true</b> if read_span<T> can return a view at the current position.
+    /// The stream must have the platform's endianness, unless T is one byte, and
+    /// the current position must be aligned for T.
+    //***************************************************************************
+    template <typename T>
+    bool is_span_readable() const
+    {
+      return is_block_copyable<T>() &&
+             ((reinterpret_cast<uintptr_t>(pcurrent) % etl::alignment_of<T>::value) == 0U);
+    }
+
+    //***************************************************************************
+    /// Reads a range of n T as a view of the stream, without copying.
+    /// Returns an empty optional, and reads nothing, if there are fewer than n T
+    /// left or is_span_readable<T>() is <b>false</b>. Use read(span<T>) then.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::optional<etl::span<const T> > >::type
+      read_span(size_t n)
+    {
+      etl::optional<etl::span<const T> > result;
+
+      if ((available<T>() >= n) && is_span_readable<T>())
+      {
+        result = etl::span<const T>(reinterpret_cast<const T*>(pcurrent), n);
+        pcurrent += (n * sizeof(T));
+      }
+
+      return result;
+    }
+
     //***************************************************************************
     /// Read a range of T from the stream.
     //***************************************************************************
@@ -694,6 +1195,75 @@ namespace etl
       return etl::optional<etl::span<const T> >();
     }
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Reads an LEB128 varint from the stream.
+    /// Signed values are zigzag decoded.
+    /// Returns an empty optional, and reads nothing, if the varint is truncated
+    /// or does not fit in T.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, etl::optional<T> >::type
+      read_varint()
+    {
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      etl::optional<T> result;
+
+      uint64_t value;
+
+      const size_t length = private_byte_stream::decode_varint(pcurrent, available_bytes(), private_byte_stream::varint_max_size<T>::value, value);
+
+      if ((length != 0U) && (value <= static_cast<uint64_t>(etl::integral_limits<unsigned_t>::max)))
+      {
+        pcurrent += length;
+        result = private_byte_stream::from_varint_value<T>(value);
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Reads a range of LEB128 varints from the stream.
+    /// Returns an empty optional, and reads nothing, if any varint is truncated
+    /// or does not fit in T.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, etl::optional<etl::span<const T> > >::type
+      read_varint(T* start, size_t length)
+    {
+      const char* const pstart = pcurrent;
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        etl::optional<T> value = read_varint<T>();
+
+        if (!value.has_value())
+        {
+          pcurrent = pstart;
+
+          return etl::optional<etl::span<const T> >();
+        }
+
+        start[i] = value.value();
+      }
+
+      return etl::optional<etl::span<const T> >(etl::span<const T>(start, length));
+    }
+
+    //***************************************************************************
+    /// Reads a range of LEB128 varints from the stream.
+    /// Returns an empty optional, and reads nothing, if any varint is truncated
+    /// or does not fit in T.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, etl::optional<etl::span<const T> > >::type
+      read_varint(etl::span<T> range)
+    {
+      return read_varint<T>(range.data(), range.size());
+    }
+#endif
+
     //***************************************************************************
     /// Skip n items of T, up to the maximum space available.
     /// Returns <b>true</b> if the skip was possible.
@@ -812,6 +1382,14 @@ namespace etl
       return available<char>();
     }
 
+    //***************************************************************************
+    /// Gets the endianness of the stream.
+    //***************************************************************************
+    etl::endian get_endianness() const
+    {
+      return stream_endianness;
+    }
+
   private:
 
     //***************************************************************************
@@ -831,26 +1409,24 @@ namespace etl
     {
       T value;
 
-      char* pv = reinterpret_cast<char*>(&value);
-      copy_value(pcurrent, pv, sizeof(T));
+      memcpy(&value, pcurrent, sizeof(T));
       pcurrent += sizeof(T);
 
+      if (stream_endianness != etl::endianness::value())
+      {
+        value = private_byte_stream::reverse_value(value);
+      }
+
       return value;
     }
 
     //*********************************
-    void copy_value(const char* source, char* destination, size_t length) const
+    /// Returns <b>true</b> if a range of T has the same layout in the stream as in memory.
+    //*********************************
+    template <typename T>
+    bool is_block_copyable() const
     {
-      const etl::endian platform_endianness = etl::endianness::value();
-
-      if (stream_endianness == platform_endianness)
-      {
-        etl::copy(source, source + length, destination);
-      }
-      else
-      {
-        etl::reverse_copy(source, source + length, destination);
-      }
+      return (sizeof(T) == 1U) || (stream_endianness == etl::endianness::value());
     }
 
     const char* const pdata;             ///< The start of the byte stream buffer.
@@ -0,0 +1,243 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BYTESWAP_INCLUDED
+#define ETL_BYTESWAP_INCLUDED
+
+#include "platform.h"
+#include "binary.h"
+#include "endianness.h"
+#include "span.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_BUILTIN_SSSE3
+  #include <tmmintrin.h>
+#elif ETL_USING_BUILTIN_NEON
+  #include <arm_neon.h>
+#endif
+
+///\defgroup byteswap byteswap
+/// Byte order conversion of arrays of integers.
+/// If ETL_USE_SIMD_INTRINSICS is defined, 16 bytes at a time are reversed with
+/// SSSE3 or NEON shuffles, where the target supports them.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_byteswap
+  {
+    //*************************************************************************
+    /// Reverses the bytes of each element of size ELEMENT_SIZE.
+    /// src and dst may be the same.
+    //*************************************************************************
+    template <size_t ELEMENT_SIZE>
+    struct reverser;
+
+    //*************************************************************************
+    template <>
+    struct reverser<1U>
+    {
+      static void reverse(const unsigned char* src, unsigned char* dst, size_t count)
+      {
+        if (src != dst)
+        {
+          memmove(dst, src, count);
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Reverses whole 16 byte blocks with a shuffle.
+    ///\return The number of bytes reversed.
+    //*************************************************************************
+    template <size_t ELEMENT_SIZE>
+    size_t reverse_blocks(const unsigned char* src, unsigned char* dst, size_t length)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_BUILTIN_SSSE3
+      const __m128i mask = (ELEMENT_SIZE == 2U) ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+                         : (ELEMENT_SIZE == 4U) ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+                         :                        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+      for (; (i + 16U) <= length; i += 16U)
+      {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(block, mask));
+      }
+#elif ETL_USING_BUILTIN_NEON
+      for (; (i + 16U) <= length; i += 16U)
+      {
+        const uint8x16_t block = vld1q_u8(src + i);
+
+        if (ELEMENT_SIZE == 2U)
+        {
+          vst1q_u8(dst + i, vrev16q_u8(block));
+        }
+        else if (ELEMENT_SIZE == 4U)
+        {
+          vst1q_u8(dst + i, vrev32q_u8(block));
+        }
+        else
+        {
+          vst1q_u8(dst + i, vrev64q_u8(block));
+        }
+      }
+#else
+      (void)src;
+      (void)dst;
+      (void)length;
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Reverses the elements left after the blocks, one at a time.
+    //*************************************************************************
+    template <typename TBits>
+    void reverse_each(const unsigned char* src, unsigned char* dst, size_t count)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        TBits bits;
+        memcpy(&bits, src + (i * sizeof(TBits)), sizeof(TBits));
+        bits = etl::reverse_bytes(bits);
+        memcpy(dst + (i * sizeof(TBits)), &bits, sizeof(TBits));
+      }
+    }
+
+    //*************************************************************************
+    template <>
+    struct reverser<2U>
+    {
+      static void reverse(const unsigned char* src, unsigned char* dst, size_t count)
+      {
+        const size_t done = reverse_blocks<2U>(src, dst, count * 2U);
+        reverse_each<uint16_t>(src + done, dst + done, count - (done / 2U));
+      }
+    };
+
+    //*************************************************************************
+    template <>
+    struct reverser<4U>
+    {
+      static void reverse(const unsigned char* src, unsigned char* dst, size_t count)
+      {
+        const size_t done = reverse_blocks<4U>(src, dst, count * 4U);
+        reverse_each<uint32_t>(src + done, dst + done, count - (done / 4U));
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    template <>
+    struct reverser<8U>
+    {
+      static void reverse(const unsigned char* src, unsigned char* dst, size_t count)
+      {
+        const size_t done = reverse_blocks<8U>(src, dst, count * 8U);
+        reverse_each<uint64_t>(src + done, dst + done, count - (done / 8U));
+      }
+    };
+#endif
+  }
+
+  //***************************************************************************
+  /// Reverses the bytes of each value, in place.
+  ///\ingroup byteswap
+  //***************************************************************************
+  template <typename T, size_t Extent>
+  void byteswap(etl::span<T, Extent> values)
+  {
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Only integral types are supported");
+
+    unsigned char* p = static_cast<unsigned char*>(static_cast<void*>(values.data()));
+
+    private_byteswap::reverser<sizeof(T)>::reverse(p, p, values.size());
+  }
+
+  //***************************************************************************
+  /// Copies the values from src to dst, reversing the bytes of each.
+  /// Copies as many as fit in dst. The spans may be the same, but must not
+  /// otherwise overlap.
+  ///\return The number of values copied.
+  ///\ingroup byteswap
+  //***************************************************************************
+  template <typename TSrc, size_t Src_Extent, typename T, size_t Dst_Extent>
+  size_t byteswap_copy(etl::span<TSrc, Src_Extent> src, etl::span<T, Dst_Extent> dst)
+  {
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Only integral types are supported");
+    ETL_STATIC_ASSERT((etl::is_same<typename etl::remove_const<TSrc>::type, T>::value), "Source and destination types differ");
+
+    const size_t count = (src.size() < dst.size()) ? src.size() : dst.size();
+
+    private_byteswap::reverser<sizeof(T)>::reverse(static_cast<const unsigned char*>(static_cast<const void*>(src.data())),
+                                                   static_cast<unsigned char*>(static_cast<void*>(dst.data())),
+                                                   count);
+
+    return count;
+  }
+
+  //***************************************************************************
+  /// Converts values from network (big endian) to host order, in place.
+  /// Does nothing on a big endian host.
+  ///\ingroup byteswap
+  //***************************************************************************
+  template <typename T, size_t Extent>
+  void ntoh(etl::span<T, Extent> values)
+  {
+    if (etl::endianness::value() == etl::endian::little)
+    {
+      etl::byteswap(values);
+    }
+  }
+
+  //***************************************************************************
+  /// Converts values from host to network (big endian) order, in place.
+  /// Does nothing on a big endian host.
+  ///\ingroup byteswap
+  //***************************************************************************
+  template <typename T, size_t Extent>
+  void hton(etl::span<T, Extent> values)
+  {
+    if (etl::endianness::value() == etl::endian::little)
+    {
+      etl::byteswap(values);
+    }
+  }
+}
+
+#endif
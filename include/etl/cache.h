@@ -0,0 +1,1015 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CACHE_INCLUDED
+#define ETL_CACHE_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "delegate.h"
+#include "functional.h"
+#include "hash.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "power.h"
+#include "static_assert.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup cache cache
+/// Fixed capacity caches in front of a slow backing store, such as flash.
+/// Values are read from the store through a delegate on a miss, and changed
+/// values are written back either immediately (write through) or when they
+/// are evicted, erased or flushed (write back).
+/// etl::lru_cache, etl::clock_cache and etl::lfu_cache differ only in how
+/// they choose the value to evict when full.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for all caches.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue>
+  class icache
+  {
+  public:
+
+    typedef TKey                            key_type;
+    typedef TValue                          mapped_type;
+    typedef ETL_OR_STD::pair<TKey, TValue>  key_value_type;
+    typedef size_t                          size_type;
+
+    /// Reads a value from the store. 'first' holds the key, 'second' receives the value.
+    /// Returns <b>true</b> if the store holds the key.
+    typedef etl::delegate<bool(key_value_type&)>       read_function_type;
+
+    /// Writes a value to the store.
+    typedef etl::delegate<void(const key_value_type&)> write_function_type;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    virtual ~icache()
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the function that reads from the store.
+    //*************************************************************************
+    void set_read_function(read_function_type reader_)
+    {
+      read_store = reader_;
+    }
+
+    //*************************************************************************
+    /// Sets the function that writes to the store.
+    //*************************************************************************
+    void set_write_function(write_function_type writer_)
+    {
+      write_store = writer_;
+    }
+
+    //*************************************************************************
+    /// Sets the 'write through' flag.
+    /// If false, changed values are only written to the store when they are
+    /// evicted, erased or flushed.
+    //*************************************************************************
+    void set_write_through(bool write_through_)
+    {
+      write_through = write_through_;
+    }
+
+    //*************************************************************************
+    /// Gets the 'write through' flag.
+    //*************************************************************************
+    bool is_write_through() const
+    {
+      return write_through;
+    }
+
+    //*************************************************************************
+    /// Checks if the cache is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the cache is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == max_size();
+    }
+
+    //*************************************************************************
+    /// Gets the number of values that may be added before one is evicted.
+    //*************************************************************************
+    size_type available() const
+    {
+      return max_size() - size();
+    }
+
+    virtual const TValue* read(const TKey& key) = 0;              ///< Reads from the cache, or from the store on a miss. Returns a null pointer if neither holds the key.
+    virtual const TValue* find(const TKey& key) = 0;              ///< Reads from the cache only. Returns a null pointer on a miss.
+    virtual void write(const TKey& key, const TValue& value) = 0; ///< Writes to the cache, and to the store if write through.
+    virtual void flush() = 0;                                     ///< Writes all changed values to the store.
+    virtual bool contains(const TKey& key) const = 0;             ///< Checks if the cache holds the key. Does not count as a use.
+    virtual bool erase(const TKey& key) = 0;                      ///< Removes a key from the cache, writing it to the store if changed.
+    virtual void clear() = 0;                                     ///< Removes all keys from the cache, writing changed values to the store.
+    virtual size_type size() const = 0;                           ///< The number of cached values.
+    virtual size_type max_size() const = 0;                       ///< The maximum number of cached values.
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    /// By default, 'write_through' is set to true.
+    //*************************************************************************
+    icache()
+      : write_through(true)
+      , read_store()
+      , write_store()
+    {
+    }
+
+    bool write_through; ///< If true, changed values are written to the store immediately. If false then a flush(), erase or eviction is required.
+
+    read_function_type  read_store;  ///< A function that will read a value from the store into the cache.
+    write_function_type write_store; ///< A function that will write a value from the cache into the store.
+
+  private:
+
+    // Disable copy construction and assignment.
+    icache(const icache&);
+    icache& operator =(const icache&);
+  };
+
+  namespace private_cache
+  {
+    //*************************************************************************
+    /// The storage and index shared by the caches.
+    /// The values live in a fixed array of slots, found through an open
+    /// addressed, linearly probed index of slot numbers.
+    /// The replacement policy is supplied by the derived class.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename THash, typename TKeyEqual>
+    class cache_table : public etl::icache<TKey, TValue>
+    {
+    public:
+
+      typedef etl::icache<TKey, TValue>              base_t;
+      typedef typename base_t::key_value_type        key_value_type;
+      typedef typename base_t::size_type             size_type;
+      typedef THash                                  hasher;
+      typedef TKeyEqual                              key_equal;
+
+      //***********************************************************************
+      /// Reads from the cache, or from the store on a miss.
+      /// A value read from the store is added to the cache, evicting another
+      /// if the cache is full.
+      ///\return A pointer to the value, or a null pointer if neither holds the key.
+      //***********************************************************************
+      const TValue* read(const TKey& key) ETL_OVERRIDE
+      {
+        const TValue* p_value = find(key);
+
+        if (p_value != ETL_NULLPTR)
+        {
+          return p_value;
+        }
+
+        if (!this->read_store.is_valid())
+        {
+          return ETL_NULLPTR;
+        }
+
+        key_value_type key_value(key, TValue());
+
+        if (!this->read_store(key_value))
+        {
+          return ETL_NULLPTR;
+        }
+
+        const size_type slot = add(key_value);
+
+        return &p_entries[slot].second;
+      }
+
+      //***********************************************************************
+      /// Reads from the cache only, never from the store.
+      /// A hit counts as a use of the value.
+      ///\return A pointer to the value, or a null pointer on a miss.
+      //***********************************************************************
+      const TValue* find(const TKey& key) ETL_OVERRIDE
+      {
+        const size_type slot = find_slot(key);
+
+        if (slot == npos)
+        {
+          return ETL_NULLPTR;
+        }
+
+        on_access(slot);
+
+        return &p_entries[slot].second;
+      }
+
+      //***********************************************************************
+      /// Writes to the cache, evicting another value if the cache is full.
+      /// If write through, the value is also written to the store.
+      //***********************************************************************
+      void write(const TKey& key, const TValue& value) ETL_OVERRIDE
+      {
+        size_type slot = find_slot(key);
+
+        if (slot != npos)
+        {
+          p_entries[slot].second = value;
+          on_access(slot);
+        }
+        else
+        {
+          slot = add(key_value_type(key, value));
+        }
+
+        if (this->write_through && this->write_store.is_valid())
+        {
+          this->write_store(p_entries[slot]);
+          p_slots[slot].dirty = false;
+        }
+        else
+        {
+          p_slots[slot].dirty = true;
+        }
+      }
+
+      //***********************************************************************
+      /// Writes all changed values to the store.
+      //***********************************************************************
+      void flush() ETL_OVERRIDE
+      {
+        for (size_type slot = 0U; slot < CAPACITY; ++slot)
+        {
+          if (p_slots[slot].occupied)
+          {
+            write_back(slot);
+          }
+        }
+      }
+
+      //***********************************************************************
+      /// Checks if the cache holds the key.
+      /// Does not count as a use of the value.
+      //***********************************************************************
+      bool contains(const TKey& key) const ETL_OVERRIDE
+      {
+        return find_slot(key) != npos;
+      }
+
+      //***********************************************************************
+      /// Removes a key from the cache, writing it to the store if changed.
+      ///\return <b>true</b> if the cache held the key.
+      //***********************************************************************
+      bool erase(const TKey& key) ETL_OVERRIDE
+      {
+        const size_type slot = find_slot(key);
+
+        if (slot == npos)
+        {
+          return false;
+        }
+
+        write_back(slot);
+        remove(slot);
+
+        return true;
+      }
+
+      //***********************************************************************
+      /// Removes all keys from the cache, writing changed values to the store.
+      //***********************************************************************
+      void clear() ETL_OVERRIDE
+      {
+        for (size_type slot = 0U; slot < CAPACITY; ++slot)
+        {
+          if (p_slots[slot].occupied)
+          {
+            write_back(slot);
+            on_erase(slot);
+            p_entries[slot].~key_value_type();
+          }
+        }
+
+        initialise();
+      }
+
+      //***********************************************************************
+      /// The number of cached values.
+      //***********************************************************************
+      size_type size() const ETL_OVERRIDE
+      {
+        return current_size;
+      }
+
+      //***********************************************************************
+      /// The maximum number of cached values.
+      //***********************************************************************
+      size_type max_size() const ETL_OVERRIDE
+      {
+        return CAPACITY;
+      }
+
+      //***********************************************************************
+      /// The maximum number of cached values.
+      //***********************************************************************
+      size_type capacity() const
+      {
+        return CAPACITY;
+      }
+
+    protected:
+
+      static ETL_CONSTANT size_type npos = ~size_type(0U);
+
+      //***********************************************************************
+      /// The bookkeeping for a slot.
+      //***********************************************************************
+      struct slot_t
+      {
+        size_t    hash;     ///< The hash of the key, kept to save rehashing when the index shifts.
+        size_type next;     ///< The next free slot.
+        bool      occupied;
+        bool      dirty;    ///< Changed since last written to the store.
+      };
+
+      //***********************************************************************
+      /// Constructor.
+      /// 'index_size_' must be a power of 2 greater than 'capacity_'.
+      //***********************************************************************
+      cache_table(key_value_type* p_entries_, slot_t* p_slots_, size_type* p_index_, size_type index_size_, size_type capacity_)
+        : p_entries(p_entries_)
+        , p_slots(p_slots_)
+        , p_index(p_index_)
+        , index_mask(index_size_ - 1U)
+        , current_size(0U)
+        , free_head(0U)
+        , CAPACITY(capacity_)
+      {
+        initialise();
+      }
+
+      virtual void      on_insert(size_type slot) = 0; ///< A slot has been filled.
+      virtual void      on_access(size_type slot) = 0; ///< A slot has been read or written.
+      virtual void      on_erase(size_type slot)  = 0; ///< A slot is about to be emptied.
+      virtual size_type select_victim()           = 0; ///< Chooses the slot to evict from a full cache.
+
+    private:
+
+      //***********************************************************************
+      /// Empties the slots and the index.
+      //***********************************************************************
+      void initialise()
+      {
+        for (size_type slot = 0U; slot < CAPACITY; ++slot)
+        {
+          p_slots[slot].next     = slot + 1U;
+          p_slots[slot].occupied = false;
+          p_slots[slot].dirty    = false;
+        }
+
+        for (size_type i = 0U; i <= index_mask; ++i)
+        {
+          p_index[i] = npos;
+        }
+
+        current_size = 0U;
+        free_head    = 0U;
+      }
+
+      //***********************************************************************
+      /// Finds the slot for a key, or npos.
+      //***********************************************************************
+      size_type find_slot(const TKey& key) const
+      {
+        size_type bucket = static_cast<size_type>(hash_function(key)) & index_mask;
+
+        while (p_index[bucket] != npos)
+        {
+          const size_type slot = p_index[bucket];
+
+          if (key_equal_function(p_entries[slot].first, key))
+          {
+            return slot;
+          }
+
+          bucket = (bucket + 1U) & index_mask;
+        }
+
+        return npos;
+      }
+
+      //***********************************************************************
+      /// Adds a key and value, evicting another if the cache is full.
+      //***********************************************************************
+      size_type add(const key_value_type& key_value)
+      {
+        if (current_size == CAPACITY)
+        {
+          const size_type victim = select_victim();
+
+          write_back(victim);
+          remove(victim);
+        }
+
+        const size_type slot = free_head;
+        slot_t&         s    = p_slots[slot];
+
+        free_head = s.next;
+
+        ::new (p_entries + slot) key_value_type(key_value);
+        s.hash     = hash_function(key_value.first);
+        s.occupied = true;
+        s.dirty    = false;
+
+        size_type bucket = static_cast<size_type>(s.hash) & index_mask;
+
+        while (p_index[bucket] != npos)
+        {
+          bucket = (bucket + 1U) & index_mask;
+        }
+
+        p_index[bucket] = slot;
+        ++current_size;
+
+        on_insert(slot);
+
+        return slot;
+      }
+
+      //***********************************************************************
+      /// Removes a slot from the index and frees it.
+      //***********************************************************************
+      void remove(size_type slot)
+      {
+        size_type bucket = static_cast<size_type>(p_slots[slot].hash) & index_mask;
+
+        while (p_index[bucket] != slot)
+        {
+          bucket = (bucket + 1U) & index_mask;
+        }
+
+        // Shift back any following entries that probed past this bucket, so no tombstones are needed.
+        size_type next = bucket;
+
+        while (true)
+        {
+          next = (next + 1U) & index_mask;
+
+          if (p_index[next] == npos)
+          {
+            break;
+          }
+
+          const size_type home = static_cast<size_type>(p_slots[p_index[next]].hash) & index_mask;
+
+          // Leave it if its home lies cyclically in (bucket, next].
+          const bool stays = (bucket <= next) ? ((bucket < home) && (home <= next))
+                                              : ((bucket < home) || (home <= next));
+
+          if (!stays)
+          {
+            p_index[bucket] = p_index[next];
+            bucket = next;
+          }
+        }
+
+        p_index[bucket] = npos;
+
+        on_erase(slot);
+
+        p_entries[slot].~key_value_type();
+        p_slots[slot].occupied = false;
+        p_slots[slot].dirty    = false;
+        p_slots[slot].next     = free_head;
+        free_head = slot;
+        --current_size;
+      }
+
+      //***********************************************************************
+      /// Writes a slot to the store if it has changed.
+      //***********************************************************************
+      void write_back(size_type slot)
+      {
+        if (p_slots[slot].dirty && this->write_store.is_valid())
+        {
+          this->write_store(p_entries[slot]);
+          p_slots[slot].dirty = false;
+        }
+      }
+
+      key_value_type* p_entries;
+      slot_t*         p_slots;
+      size_type*      p_index;
+      size_type       index_mask;
+      size_type       current_size;
+      size_type       free_head;
+      const size_type CAPACITY;
+      hasher          hash_function;
+      key_equal       key_equal_function;
+    };
+
+    template <typename TKey, typename TValue, typename THash, typename TKeyEqual>
+    ETL_CONSTANT typename cache_table<TKey, TValue, THash, TKeyEqual>::size_type cache_table<TKey, TValue, THash, TKeyEqual>::npos;
+  }
+
+  //***************************************************************************
+  /// The base class for least recently used caches.
+  /// The slots are threaded on a list in order of use, so every operation is O(1).
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class ilru_cache : public etl::private_cache::cache_table<TKey, TValue, THash, TKeyEqual>
+  {
+  protected:
+
+    typedef etl::private_cache::cache_table<TKey, TValue, THash, TKeyEqual> base_t;
+
+  public:
+
+    typedef typename base_t::key_value_type key_value_type;
+    typedef typename base_t::size_type      size_type;
+
+  protected:
+
+    typedef typename base_t::slot_t         slot_t;
+
+    //*************************************************************************
+    /// The links of the use list.
+    //*************************************************************************
+    struct link_t
+    {
+      size_type previous;
+      size_type next;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ilru_cache(key_value_type* p_entries_, slot_t* p_slots_, size_type* p_index_, size_type index_size_, link_t* p_links_, size_type capacity_)
+      : base_t(p_entries_, p_slots_, p_index_, index_size_, capacity_)
+      , p_links(p_links_)
+      , most_recent(base_t::npos)
+      , least_recent(base_t::npos)
+    {
+    }
+
+    //*************************************************************************
+    void on_insert(size_type slot) ETL_OVERRIDE
+    {
+      link_front(slot);
+    }
+
+    //*************************************************************************
+    void on_access(size_type slot) ETL_OVERRIDE
+    {
+      if (slot != most_recent)
+      {
+        unlink(slot);
+        link_front(slot);
+      }
+    }
+
+    //*************************************************************************
+    void on_erase(size_type slot) ETL_OVERRIDE
+    {
+      unlink(slot);
+    }
+
+    //*************************************************************************
+    size_type select_victim() ETL_OVERRIDE
+    {
+      return least_recent;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Links a slot as the most recently used.
+    //*************************************************************************
+    void link_front(size_type slot)
+    {
+      p_links[slot].previous = base_t::npos;
+      p_links[slot].next     = most_recent;
+
+      if (most_recent != base_t::npos)
+      {
+        p_links[most_recent].previous = slot;
+      }
+      else
+      {
+        least_recent = slot;
+      }
+
+      most_recent = slot;
+    }
+
+    //*************************************************************************
+    /// Unlinks a slot from the use list.
+    //*************************************************************************
+    void unlink(size_type slot)
+    {
+      const link_t& link = p_links[slot];
+
+      if (link.previous != base_t::npos)
+      {
+        p_links[link.previous].next = link.next;
+      }
+      else
+      {
+        most_recent = link.next;
+      }
+
+      if (link.next != base_t::npos)
+      {
+        p_links[link.next].previous = link.previous;
+      }
+      else
+      {
+        least_recent = link.previous;
+      }
+    }
+
+    link_t*   p_links;
+    size_type most_recent;
+    size_type least_recent;
+  };
+
+  //***************************************************************************
+  /// A least recently used cache with the capacity defined at compile time.
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The value type. Must be default constructible.
+  ///\tparam MAX_SIZE_ The maximum number of cached values.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class lru_cache : public etl::ilru_cache<TKey, TValue, THash, TKeyEqual>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity etl::lru_cache is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    typedef typename etl::ilru_cache<TKey, TValue, THash, TKeyEqual>::key_value_type key_value_type;
+    typedef typename etl::ilru_cache<TKey, TValue, THash, TKeyEqual>::size_type      size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    lru_cache()
+      : etl::ilru_cache<TKey, TValue, THash, TKeyEqual>(reinterpret_cast<key_value_type*>(&buffer), slots, index, Index_Size, links, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Writes any changed values to the store.
+    //*************************************************************************
+    ~lru_cache()
+    {
+      this->clear();
+    }
+
+  private:
+
+    typedef etl::ilru_cache<TKey, TValue, THash, TKeyEqual> base_t;
+    typedef typename base_t::slot_t         slot_t;
+    typedef typename base_t::link_t         link_t;
+
+    static ETL_CONSTANT size_t Index_Size = etl::power_of_2_round_up<2U * MAX_SIZE_>::value;
+
+    typename etl::aligned_storage<sizeof(key_value_type) * MAX_SIZE_, etl::alignment_of<key_value_type>::value>::type buffer;
+    slot_t    slots[MAX_SIZE_];
+    size_type index[Index_Size];
+    link_t    links[MAX_SIZE_];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t lru_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  //***************************************************************************
+  /// The base class for CLOCK (second chance) caches.
+  /// Each use sets a slot's reference bit. On eviction a hand sweeps the
+  /// slots, clearing set bits, and evicts the first slot found clear.
+  /// This approximates least recently used with no work on a hit.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iclock_cache : public etl::private_cache::cache_table<TKey, TValue, THash, TKeyEqual>
+  {
+  protected:
+
+    typedef etl::private_cache::cache_table<TKey, TValue, THash, TKeyEqual> base_t;
+
+  public:
+
+    typedef typename base_t::key_value_type key_value_type;
+    typedef typename base_t::size_type      size_type;
+
+  protected:
+
+    typedef typename base_t::slot_t         slot_t;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iclock_cache(key_value_type* p_entries_, slot_t* p_slots_, size_type* p_index_, size_type index_size_, bool* p_referenced_, size_type capacity_)
+      : base_t(p_entries_, p_slots_, p_index_, index_size_, capacity_)
+      , p_referenced(p_referenced_)
+      , hand(0U)
+    {
+    }
+
+    //*************************************************************************
+    void on_insert(size_type slot) ETL_OVERRIDE
+    {
+      p_referenced[slot] = false;
+    }
+
+    //*************************************************************************
+    void on_access(size_type slot) ETL_OVERRIDE
+    {
+      p_referenced[slot] = true;
+    }
+
+    //*************************************************************************
+    void on_erase(size_type slot) ETL_OVERRIDE
+    {
+      p_referenced[slot] = false;
+    }
+
+    //*************************************************************************
+    /// Only called when full, so every slot is occupied.
+    //*************************************************************************
+    size_type select_victim() ETL_OVERRIDE
+    {
+      while (p_referenced[hand])
+      {
+        p_referenced[hand] = false;
+        advance();
+      }
+
+      const size_type victim = hand;
+      advance();
+
+      return victim;
+    }
+
+  private:
+
+    //*************************************************************************
+    void advance()
+    {
+      hand = (hand + 1U == this->capacity()) ? 0U : hand + 1U;
+    }
+
+    bool*     p_referenced;
+    size_type hand;
+  };
+
+  //***************************************************************************
+  /// A CLOCK cache with the capacity defined at compile time.
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The value type. Must be default constructible.
+  ///\tparam MAX_SIZE_ The maximum number of cached values.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class clock_cache : public etl::iclock_cache<TKey, TValue, THash, TKeyEqual>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity etl::clock_cache is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    typedef typename etl::iclock_cache<TKey, TValue, THash, TKeyEqual>::key_value_type key_value_type;
+    typedef typename etl::iclock_cache<TKey, TValue, THash, TKeyEqual>::size_type      size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    clock_cache()
+      : etl::iclock_cache<TKey, TValue, THash, TKeyEqual>(reinterpret_cast<key_value_type*>(&buffer), slots, index, Index_Size, referenced, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Writes any changed values to the store.
+    //*************************************************************************
+    ~clock_cache()
+    {
+      this->clear();
+    }
+
+  private:
+
+    typedef etl::iclock_cache<TKey, TValue, THash, TKeyEqual> base_t;
+    typedef typename base_t::slot_t         slot_t;
+
+    static ETL_CONSTANT size_t Index_Size = etl::power_of_2_round_up<2U * MAX_SIZE_>::value;
+
+    typename etl::aligned_storage<sizeof(key_value_type) * MAX_SIZE_, etl::alignment_of<key_value_type>::value>::type buffer;
+    slot_t    slots[MAX_SIZE_];
+    size_type index[Index_Size];
+    bool      referenced[MAX_SIZE_];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t clock_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  //***************************************************************************
+  /// The base class for least frequently used caches.
+  /// Each slot counts its uses. On eviction the slot with the lowest count is
+  /// chosen, the oldest winning a tie. Choosing the victim is O(N), so this
+  /// suits small caches where keeping hot keys matters more than miss cost.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class ilfu_cache : public etl::private_cache::cache_table<TKey, TValue, THash, TKeyEqual>
+  {
+  protected:
+
+    typedef etl::private_cache::cache_table<TKey, TValue, THash, TKeyEqual> base_t;
+
+  public:
+
+    typedef typename base_t::key_value_type key_value_type;
+    typedef typename base_t::size_type      size_type;
+
+  protected:
+
+    typedef typename base_t::slot_t         slot_t;
+
+    //*************************************************************************
+    /// The use count and age of a slot.
+    //*************************************************************************
+    struct count_t
+    {
+      uint32_t uses;
+      uint32_t inserted; ///< The insertion sequence number, to break ties.
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ilfu_cache(key_value_type* p_entries_, slot_t* p_slots_, size_type* p_index_, size_type index_size_, count_t* p_counts_, size_type capacity_)
+      : base_t(p_entries_, p_slots_, p_index_, index_size_, capacity_)
+      , p_counts(p_counts_)
+      , sequence(0U)
+    {
+    }
+
+    //*************************************************************************
+    void on_insert(size_type slot) ETL_OVERRIDE
+    {
+      p_counts[slot].uses     = 1U;
+      p_counts[slot].inserted = sequence++;
+    }
+
+    //*************************************************************************
+    void on_access(size_type slot) ETL_OVERRIDE
+    {
+      // Saturate rather than wrap.
+      if (p_counts[slot].uses != etl::integral_limits<uint32_t>::max)
+      {
+        ++p_counts[slot].uses;
+      }
+    }
+
+    //*************************************************************************
+    void on_erase(size_type) ETL_OVERRIDE
+    {
+    }
+
+    //*************************************************************************
+    /// Only called when full, so every slot is occupied.
+    //*************************************************************************
+    size_type select_victim() ETL_OVERRIDE
+    {
+      size_type victim = 0U;
+
+      for (size_type slot = 1U; slot < this->capacity(); ++slot)
+      {
+        const count_t& candidate = p_counts[slot];
+        const count_t& current   = p_counts[victim];
+
+        // Compare ages relative to the current sequence so that wrapping is harmless.
+        if ((candidate.uses < current.uses) ||
+            ((candidate.uses == current.uses) && (uint32_t(sequence - candidate.inserted) > uint32_t(sequence - current.inserted))))
+        {
+          victim = slot;
+        }
+      }
+
+      return victim;
+    }
+
+  private:
+
+    count_t* p_counts;
+    uint32_t sequence;
+  };
+
+  //***************************************************************************
+  /// A least frequently used cache with the capacity defined at compile time.
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The value type. Must be default constructible.
+  ///\tparam MAX_SIZE_ The maximum number of cached values.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class lfu_cache : public etl::ilfu_cache<TKey, TValue, THash, TKeyEqual>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity etl::lfu_cache is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    typedef typename etl::ilfu_cache<TKey, TValue, THash, TKeyEqual>::key_value_type key_value_type;
+    typedef typename etl::ilfu_cache<TKey, TValue, THash, TKeyEqual>::size_type      size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    lfu_cache()
+      : etl::ilfu_cache<TKey, TValue, THash, TKeyEqual>(reinterpret_cast<key_value_type*>(&buffer), slots, index, Index_Size, counts, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Writes any changed values to the store.
+    //*************************************************************************
+    ~lfu_cache()
+    {
+      this->clear();
+    }
+
+  private:
+
+    typedef etl::ilfu_cache<TKey, TValue, THash, TKeyEqual> base_t;
+    typedef typename base_t::slot_t         slot_t;
+    typedef typename base_t::count_t        count_t;
+
+    static ETL_CONSTANT size_t Index_Size = etl::power_of_2_round_up<2U * MAX_SIZE_>::value;
+
+    typename etl::aligned_storage<sizeof(key_value_type) * MAX_SIZE_, etl::alignment_of<key_value_type>::value>::type buffer;
+    slot_t    slots[MAX_SIZE_];
+    size_type index[Index_Size];
+    count_t   counts[MAX_SIZE_];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t lfu_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+}
+
+#endif
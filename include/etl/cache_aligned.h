@@ -0,0 +1,321 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CACHE_ALIGNED_INCLUDED
+#define ETL_CACHE_ALIGNED_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "memory.h"
+#include "utility.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+///\defgroup cache_aligned cache_aligned
+/// Cache line aware storage, to keep data written by different threads or
+/// cores off each other's cache lines.
+/// The cache line size is set by ETL_CACHE_LINE_SIZE, which the profile may define.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The minimum offset between two objects to avoid false sharing.
+  ///\ingroup cache_aligned
+  //***************************************************************************
+  static ETL_CONSTANT size_t hardware_destructive_interference_size = ETL_CACHE_LINE_SIZE;
+
+  //***************************************************************************
+  /// The maximum size of contiguous memory to promote true sharing.
+  ///\ingroup cache_aligned
+  //***************************************************************************
+  static ETL_CONSTANT size_t hardware_constructive_interference_size = ETL_CACHE_LINE_SIZE;
+
+  ETL_STATIC_ASSERT((ETL_CACHE_LINE_SIZE != 0) && ((ETL_CACHE_LINE_SIZE & (ETL_CACHE_LINE_SIZE - 1)) == 0), "ETL_CACHE_LINE_SIZE must be a power of two");
+
+  //***************************************************************************
+  /// The size rounded up to a whole number of cache lines.
+  ///\ingroup cache_aligned
+  //***************************************************************************
+  template <size_t Size, size_t Line_Size = etl::hardware_destructive_interference_size>
+  struct cache_line_padded_size
+  {
+    ETL_STATIC_ASSERT(Line_Size != 0, "Line size must not be zero");
+
+    static ETL_CONSTANT size_t value = ((Size + Line_Size - 1U) / Line_Size) * Line_Size;
+  };
+
+  template <size_t Size, size_t Line_Size>
+  ETL_CONSTANT size_t cache_line_padded_size<Size, Line_Size>::value;
+
+#if ETL_USING_CPP17
+  template <size_t Size, size_t Line_Size = etl::hardware_destructive_interference_size>
+  inline constexpr size_t cache_line_padded_size_v = cache_line_padded_size<Size, Line_Size>::value;
+#endif
+
+  namespace private_cache_aligned
+  {
+    //*************************************************************************
+    /// A value followed by padding.
+    //*************************************************************************
+    template <typename T, size_t Padding>
+    struct padded_storage
+    {
+      padded_storage()
+        : value()
+      {
+      }
+
+      padded_storage(const T& value_)
+        : value(value_)
+      {
+      }
+
+#if ETL_USING_CPP11
+      padded_storage(T&& value_)
+        : value(etl::move(value_))
+      {
+      }
+
+      template <typename... TArgs>
+      padded_storage(etl::in_place_t, TArgs&&... args)
+        : value(etl::forward<TArgs>(args)...)
+      {
+      }
+#endif
+
+      T    value;
+      char padding[Padding];
+    };
+
+    //*************************************************************************
+    /// A value that already fills whole cache lines.
+    //*************************************************************************
+    template <typename T>
+    struct padded_storage<T, 0U>
+    {
+      padded_storage()
+        : value()
+      {
+      }
+
+      padded_storage(const T& value_)
+        : value(value_)
+      {
+      }
+
+#if ETL_USING_CPP11
+      padded_storage(T&& value_)
+        : value(etl::move(value_))
+      {
+      }
+
+      template <typename... TArgs>
+      padded_storage(etl::in_place_t, TArgs&&... args)
+        : value(etl::forward<TArgs>(args)...)
+      {
+      }
+#endif
+
+      T value;
+    };
+  }
+
+  //***************************************************************************
+  /// A value padded to a whole number of lines.
+  /// Adjacent padded objects never share a line when the first is line
+  /// aligned, as it is in an etl::cache_aligned or a cache aligned buffer.
+  /// The value is value initialised by the default constructor.
+  ///\ingroup cache_aligned
+  //***************************************************************************
+  template <typename T, size_t Line_Size = etl::hardware_destructive_interference_size>
+  class padded
+  {
+  public:
+
+    typedef T        value_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef T*       pointer;
+    typedef const T* const_pointer;
+
+    static ETL_CONSTANT size_t Padded_Size = etl::cache_line_padded_size<sizeof(T), Line_Size>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    padded()
+      : storage()
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a value.
+    //*************************************************************************
+    padded(const T& value)
+      : storage(value)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Construct from a moved value.
+    //*************************************************************************
+    padded(T&& value)
+      : storage(etl::move(value))
+    {
+    }
+
+    //*************************************************************************
+    /// Construct the value in place from the arguments.
+    //*************************************************************************
+    template <typename... TArgs>
+    explicit padded(etl::in_place_t, TArgs&&... args)
+      : storage(etl::in_place_t(), etl::forward<TArgs>(args)...)
+    {
+    }
+#endif
+
+    //*************************************************************************
+    /// Assign a value.
+    //*************************************************************************
+    padded& operator =(const T& value)
+    {
+      storage.value = value;
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Get the value.
+    //*************************************************************************
+    reference get()
+    {
+      return storage.value;
+    }
+
+    //*************************************************************************
+    /// Get the value.
+    //*************************************************************************
+    const_reference get() const
+    {
+      return storage.value;
+    }
+
+    //*************************************************************************
+    /// Get the value.
+    //*************************************************************************
+    reference operator *()
+    {
+      return storage.value;
+    }
+
+    //*************************************************************************
+    /// Get the value.
+    //*************************************************************************
+    const_reference operator *() const
+    {
+      return storage.value;
+    }
+
+    //*************************************************************************
+    /// Access the value's members.
+    //*************************************************************************
+    pointer operator ->()
+    {
+      return &storage.value;
+    }
+
+    //*************************************************************************
+    /// Access the value's members.
+    //*************************************************************************
+    const_pointer operator ->() const
+    {
+      return &storage.value;
+    }
+
+  private:
+
+    private_cache_aligned::padded_storage<T, Padded_Size - sizeof(T)> storage;
+  };
+
+  template <typename T, size_t Line_Size>
+  ETL_CONSTANT size_t padded<T, Line_Size>::Padded_Size;
+
+#if ETL_USING_CPP11 && !defined(ETL_COMPILER_ARM5)
+  //***************************************************************************
+  /// A value that starts on a cache line and is padded to a whole number of lines.
+  /// Use for data written by one thread or core and read by others, such as
+  /// indices, counters and per core statistics.
+  /// Dynamically allocated objects need an allocator that honours the alignment.
+  ///\ingroup cache_aligned
+  //***************************************************************************
+  template <typename T>
+  class alignas(ETL_CACHE_LINE_SIZE) cache_aligned : public etl::padded<T, ETL_CACHE_LINE_SIZE>
+  {
+  private:
+
+    typedef etl::padded<T, ETL_CACHE_LINE_SIZE> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::alignment_of<T>::value <= ETL_CACHE_LINE_SIZE, "Type is aligned to more than a cache line");
+
+    using base_t::base_t;
+    using base_t::operator =;
+
+    cache_aligned() = default;
+  };
+
+  //***************************************************************************
+  /// Aligned storage of a whole number of cache lines, starting on a line.
+  ///\ingroup cache_aligned
+  //***************************************************************************
+  template <size_t Length>
+  struct cache_aligned_storage : public etl::aligned_storage<etl::cache_line_padded_size<Length, ETL_CACHE_LINE_SIZE>::value, ETL_CACHE_LINE_SIZE>
+  {
+  };
+
+  template <size_t Length>
+  using cache_aligned_storage_t = typename cache_aligned_storage<Length>::type;
+
+  //***************************************************************************
+  /// An uninitialised buffer of VN_Objects of VObject_Size, starting on a cache line.
+  ///\ingroup cache_aligned
+  //***************************************************************************
+  template <size_t VObject_Size, size_t VN_Objects>
+  class cache_aligned_buffer : public etl::uninitialized_buffer<VObject_Size, VN_Objects, ETL_CACHE_LINE_SIZE>
+  {
+  };
+#endif
+}
+
+#endif
@@ -36,6 +36,7 @@ SOFTWARE.
 #include "static_assert.h"
 #include "function.h"
 #include "array.h"
+#include "private/sparse_id_table.h"
 
 namespace etl
 {
@@ -154,6 +155,133 @@ namespace etl
     /// Lookup table of callbacks.
     etl::array<etl::ifunction<size_t>*, RANGE> lookup;
   };
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// A callback service for a sparse set of ids.
+  /// Holds a callback for each id, rather than for each value in the range
+  /// of ids, and finds it with a binary search of the ids.
+  /// \tparam IDS The callback ids, unique and in ascending order.
+  //***************************************************************************
+  template <size_t... IDS>
+  class sparse_callback_service
+  {
+  private:
+
+    typedef etl::private_sparse_id_table::id_table<IDS...> id_table;
+
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(IDS) != 0U, "No ids");
+    ETL_STATIC_ASSERT(id_table::is_ascending(), "Ids must be unique and in ascending order");
+
+    //*************************************************************************
+    /// Reset the callback service.
+    /// Sets all callbacks to the internal default.
+    //*************************************************************************
+    sparse_callback_service()
+      : unhandled_callback(*this),
+        p_unhandled(ETL_NULLPTR)
+    {
+      lookup.fill(&unhandled_callback);
+    }
+
+    //*************************************************************************
+    /// Registers a callback for the specified id.
+    /// Compile time assert if the id is not in the list.
+    /// \tparam ID The id of the callback.
+    /// \param callback Reference to the callback.
+    //*************************************************************************
+    template <size_t ID>
+    void register_callback(etl::ifunction<size_t>& callback)
+    {
+      ETL_STATIC_ASSERT(id_table::index_of_id(ID) != id_table::Size, "Callback Id not in the list");
+
+      lookup[id_table::index_of_id(ID)] = &callback;
+    }
+
+    //*************************************************************************
+    /// Registers a callback for the specified id.
+    /// No action if the id is not in the list.
+    /// \param id       Id of the callback.
+    /// \param callback Reference to the callback.
+    //*************************************************************************
+    void register_callback(size_t id, etl::ifunction<size_t>& callback)
+    {
+      const size_t index = id_table::index_of(id);
+
+      if (index != id_table::Size)
+      {
+        lookup[index] = &callback;
+      }
+    }
+
+    //*************************************************************************
+    /// Registers an alternative callback for unhandled ids.
+    /// \param callback A reference to the user supplied 'unhandled' callback.
+    //*************************************************************************
+    void register_unhandled_callback(etl::ifunction<size_t>& callback)
+    {
+      p_unhandled = &callback;
+    }
+
+    //*************************************************************************
+    /// Executes the callback function for the index.
+    /// Compile time assert if the id is not in the list.
+    /// \tparam ID The id of the callback.
+    //*************************************************************************
+    template <size_t ID>
+    void callback()
+    {
+      ETL_STATIC_ASSERT(id_table::index_of_id(ID) != id_table::Size, "Callback Id not in the list");
+
+      (*lookup[id_table::index_of_id(ID)])(ID);
+    }
+
+    //*************************************************************************
+    /// Executes the callback function for the index.
+    /// \param id Id of the callback.
+    //*************************************************************************
+    void callback(size_t id)
+    {
+      const size_t index = id_table::index_of(id);
+
+      if (index != id_table::Size)
+      {
+        (*lookup[index])(id);
+      }
+      else
+      {
+        unhandled(id);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The default callback function.
+    /// Calls the user defined 'unhandled' callback if it exists.
+    //*************************************************************************
+    void unhandled(size_t id)
+    {
+      if (p_unhandled != ETL_NULLPTR)
+      {
+        (*p_unhandled)(id);
+      }
+    }
+
+    /// The default callback for unhandled ids.
+    etl::function_mp<sparse_callback_service<IDS...>,
+                     size_t,
+                     &sparse_callback_service<IDS...>::unhandled> unhandled_callback;
+
+    /// Pointer to the user defined 'unhandled' callback.
+    etl::ifunction<size_t>* p_unhandled;
+
+    /// Lookup table of callbacks, in the order of the ids.
+    etl::array<etl::ifunction<size_t>*, sizeof...(IDS)> lookup;
+  };
+#endif
 }
 
 #endif
@@ -39,6 +39,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "placement_new.h"
 #include "delegate.h"
+#include "trace.h"
 
 #include <stdint.h>
 
@@ -550,6 +551,9 @@ namespace etl
     //*******************************************
     // Called by the timer service to indicate the
     // amount of time that has elapsed since the last successful call to 'tick'.
+    // Every timer that expires within 'count' is processed in the one call,
+    // so a tickless caller may sleep for 'time_to_next()' and pass the
+    // actual time slept.
     // Returns true if the tick was processed,
     // false if not.
     //*******************************************
@@ -579,6 +583,8 @@ namespace etl
                 active_list.insert(timer.id);
               }
 
+              ETL_TRACE(etl::trace_id::Callback_Timer_Tick, timer.id);
+
               if (timer.p_callback != ETL_NULLPTR)
               {
                 if (timer.cbk_type == callback_timer_data::C_CALLBACK)
@@ -713,7 +719,11 @@ namespace etl
     //*******************************************
     bool has_active_timer() const
     {
-      return !active_list.empty();
+      ETL_DISABLE_TIMER_UPDATES;
+      bool result = !active_list.empty();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      return result;
     }
 
     //*******************************************
@@ -724,10 +734,12 @@ namespace etl
     {
       uint32_t delta = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
 
-      if (has_active_timer())
+      ETL_DISABLE_TIMER_UPDATES;
+      if (!active_list.empty())
       {
         delta = active_list.front().delta;
       }
+      ETL_ENABLE_TIMER_UPDATES;
 
       return delta;
     }
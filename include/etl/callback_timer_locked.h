@@ -153,6 +153,9 @@ namespace etl
     //*******************************************
     // Called by the timer service to indicate the
     // amount of time that has elapsed since the last successful call to 'tick'.
+    // Every timer that expires within 'count' is processed in the one call,
+    // so a tickless caller may sleep for 'time_to_next()' and pass the
+    // actual time slept.
     // Returns true if the tick was processed,
     // false if not.
     //*******************************************
@@ -162,6 +165,10 @@ namespace etl
       {
         if (try_lock())
         {
+#if ETL_HAS_ATOMIC
+          apply_posted_commands();
+#endif
+
           // We have something to do?
           bool has_active = !active_list.empty();       
 
@@ -271,6 +278,67 @@ namespace etl
       return result;
     }
 
+#if ETL_HAS_ATOMIC
+    //*******************************************
+    /// Posts a request to start a timer.
+    /// Unlike 'start', this never takes the lock. The request is
+    /// applied by the next call to 'tick', before any timers are expired.
+    /// If several requests are posted for a timer before then, the last wins.
+    /// May be called from any number of threads or interrupts.
+    //*******************************************
+    bool post_start(etl::timer::id::type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer with a valid period?
+        if ((timer.id != etl::timer::id::NO_TIMER) && (timer.period != etl::timer::state::Inactive))
+        {
+          post_command(timer, immediate_ ? etl::timer::command::Start_Immediate : etl::timer::command::Start);
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Posts a request to stop a timer.
+    /// Applied by the next call to 'tick', as for 'post_start'.
+    //*******************************************
+    bool post_stop(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          post_command(timer, etl::timer::command::Stop);
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Returns true if there are posted requests that 'tick' has not applied.
+    //*******************************************
+    bool has_posted_commands() const
+    {
+      return commands_posted.load(etl::memory_order_acquire);
+    }
+#endif
+
     //*******************************************
     /// Sets a timer's period.
     //*******************************************
@@ -354,6 +422,9 @@ namespace etl
         , previous(etl::timer::id::NO_TIMER)
         , next(etl::timer::id::NO_TIMER)
         , repeating(true)
+#if ETL_HAS_ATOMIC
+        , command(etl::timer::command::None)
+#endif
       {
       }
 
@@ -371,6 +442,9 @@ namespace etl
         , previous(etl::timer::id::NO_TIMER)
         , next(etl::timer::id::NO_TIMER)
         , repeating(repeating_)
+#if ETL_HAS_ATOMIC
+        , command(etl::timer::command::None)
+#endif
       {
       }
 
@@ -397,6 +471,9 @@ namespace etl
       uint_least8_t        previous;
       uint_least8_t        next;
       bool                 repeating;
+#if ETL_HAS_ATOMIC
+      etl::atomic<etl::timer::command::type> command;
+#endif
 
     private:
 
@@ -413,12 +490,58 @@ namespace etl
         active_list(timer_array_),
         enabled(false),
         number_of_registered_timers(0U),
+#if ETL_HAS_ATOMIC
+        commands_posted(false),
+#endif
         MAX_TIMERS(MAX_TIMERS_)
     {
     }
 
   private:
 
+#if ETL_HAS_ATOMIC
+    //*******************************************
+    /// Records the command for the timer, then flags that there is work for 'tick'.
+    //*******************************************
+    void post_command(timer_data& timer, etl::timer::command::type command)
+    {
+      timer.command.store(command, etl::memory_order_release);
+      commands_posted.store(true, etl::memory_order_release);
+    }
+
+    //*******************************************
+    /// Applies the posted commands, in timer id order.
+    /// A command posted during the scan is either applied by it, or is left
+    /// flagged for the next call.
+    //*******************************************
+    void apply_posted_commands()
+    {
+      if (commands_posted.exchange(false, etl::memory_order_acq_rel))
+      {
+        for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+        {
+          timer_data& timer = timer_array[i];
+
+          const etl::timer::command::type command = timer.command.exchange(etl::timer::command::None, etl::memory_order_acq_rel);
+
+          if ((command != etl::timer::command::None) && (timer.id != etl::timer::id::NO_TIMER))
+          {
+            if (timer.is_active())
+            {
+              active_list.remove(timer.id, false);
+            }
+
+            if (command != etl::timer::command::Stop)
+            {
+              timer.delta = (command == etl::timer::command::Start_Immediate) ? 0U : timer.period;
+              active_list.insert(timer.id);
+            }
+          }
+        }
+      }
+    }
+#endif
+
     //*************************************************************************
     /// A specialised intrusive linked list for timer data.
     //*************************************************************************
@@ -612,6 +735,11 @@ namespace etl
     bool enabled;
     uint_least8_t number_of_registered_timers;
 
+#if ETL_HAS_ATOMIC
+    // Set when a command has been posted.
+    etl::atomic<bool> commands_posted;
+#endif
+
     try_lock_type try_lock; ///< The callback that tries to lock.
     lock_type     lock;     ///< The callback that locks.
     unlock_type   unlock;   ///< The callback that unlocks.
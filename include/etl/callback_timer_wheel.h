@@ -0,0 +1,567 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+#define ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "function.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "atomic.h"
+#include "placement_new.h"
+#include "delegate.h"
+
+#include "private/timer_wheel.h"
+
+#include <stdint.h>
+
+#if defined(ETL_IN_UNIT_TEST) && ETL_NOT_USING_STL
+  #define ETL_DISABLE_TIMER_UPDATES
+  #define ETL_ENABLE_TIMER_UPDATES
+  #define ETL_TIMER_UPDATES_ENABLED true
+
+  #undef ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
+  #undef ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+#else
+  #if !defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && !defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK not defined
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error Only define one of ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+    #define ETL_DISABLE_TIMER_UPDATES (++process_semaphore)
+    #define ETL_ENABLE_TIMER_UPDATES  (--process_semaphore)
+    #define ETL_TIMER_UPDATES_ENABLED (process_semaphore.load() == 0)
+  #endif
+#endif
+
+#if defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+  #if !defined(ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS) || !defined(ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS)
+    #error ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS and/or ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS not defined
+  #endif
+
+  #define ETL_DISABLE_TIMER_UPDATES ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS
+  #define ETL_ENABLE_TIMER_UPDATES  ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS
+  #define ETL_TIMER_UPDATES_ENABLED true
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for the callback timer wheel.
+  /// Has the same interface as etl::icallback_timer, but keeps the active
+  /// timers in a hierarchical timing wheel rather than a sorted list.
+  /// start() and stop() are O(1) and tick() is amortised O(1) per tick.
+  /// Uses the same ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or
+  /// ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK configuration as etl::callback_timer.
+  //***************************************************************************
+  class icallback_timer_wheel
+  {
+  public:
+
+    typedef etl::delegate<void(void)> callback_type;
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(void     (*p_callback_)(),
+                                        uint32_t period_,
+                                        bool     repeating_)
+    {
+      etl::timer::id::type id = find_free_timer();
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data(id, reinterpret_cast<void*>(p_callback_), timer_data::C_CALLBACK, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(etl::ifunction<void>& callback_,
+                                        uint32_t              period_,
+                                        bool                  repeating_)
+    {
+      etl::timer::id::type id = find_free_timer();
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data(id, reinterpret_cast<void*>(&callback_), timer_data::IFUNCTION, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+
+#if ETL_USING_CPP11
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(callback_type& callback_,
+                                        uint32_t       period_,
+                                        bool           repeating_)
+    {
+      etl::timer::id::type id = find_free_timer();
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data(id, reinterpret_cast<void*>(&callback_), timer_data::DELEGATE, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+#endif
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            wheel.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          // Reset in-place.
+          new (&timer) timer_data();
+          --registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      wheel.clear();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      for (int i = 0; i < MAX_TIMERS; ++i)
+      {
+        ::new (&timer_array[i]) timer_data();
+      }
+
+      registered_timers = 0;
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Every timer that expires within 'count' is processed in the one call,
+    // so a tickless caller may sleep for 'time_to_next()' and pass the
+    // actual time slept.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (ETL_TIMER_UPDATES_ENABLED)
+        {
+          etl::timer::id::type id = wheel.next_expired(count);
+
+          while (id != etl::timer::id::NO_TIMER)
+          {
+            timer_data& timer = timer_array[id];
+
+            if (timer.repeating)
+            {
+              // Reinsert the timer.
+              wheel.insert(timer.id, timer.period);
+            }
+
+            if (timer.p_callback != ETL_NULLPTR)
+            {
+              if (timer.cbk_type == timer_data::C_CALLBACK)
+              {
+                // Call the C callback.
+                reinterpret_cast<void(*)()>(timer.p_callback)();
+              }
+              else if (timer.cbk_type == timer_data::IFUNCTION)
+              {
+                // Call the function wrapper callback.
+                (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
+              }
+              else if (timer.cbk_type == timer_data::DELEGATE)
+              {
+                // Call the delegate callback.
+                (*reinterpret_cast<callback_type*>(timer.p_callback))();
+              }
+            }
+
+            id = wheel.next_expired(count);
+          }
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(etl::timer::id::type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::Inactive)
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            if (timer.is_active())
+            {
+              wheel.remove(timer.id);
+            }
+
+            wheel.insert(timer.id, immediate_ ? 0U : timer.period);
+            ETL_ENABLE_TIMER_UPDATES;
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            wheel.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(etl::timer::id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Check if there is an active timer.
+    //*******************************************
+    bool has_active_timer() const
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      bool result = !wheel.empty();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      return result;
+    }
+
+    //*******************************************
+    /// Get the time to the next timer event.
+    /// Returns etl::timer::interval::No_Active_Interval if there is no active timer.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      uint32_t delta = wheel.time_to_next();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      return delta;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The configuration of a timer.
+    //*************************************************************************
+    struct timer_data
+    {
+      enum callback_type_id
+      {
+        C_CALLBACK,
+        IFUNCTION,
+        DELEGATE
+      };
+
+      //*******************************************
+      timer_data()
+        : p_callback(ETL_NULLPTR)
+        , period(0U)
+        , expiry(0U)
+        , id(etl::timer::id::NO_TIMER)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , bucket(private_timer_wheel::bucket::No_Bucket)
+        , repeating(true)
+        , cbk_type(IFUNCTION)
+      {
+      }
+
+      //*******************************************
+      timer_data(etl::timer::id::type id_,
+                 void*                p_callback_,
+                 callback_type_id     cbk_type_,
+                 uint32_t             period_,
+                 bool                 repeating_)
+        : p_callback(p_callback_)
+        , period(period_)
+        , expiry(0U)
+        , id(id_)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , bucket(private_timer_wheel::bucket::No_Bucket)
+        , repeating(repeating_)
+        , cbk_type(cbk_type_)
+      {
+      }
+
+      //*******************************************
+      /// Returns true if the timer is active.
+      //*******************************************
+      bool is_active() const
+      {
+        return bucket != private_timer_wheel::bucket::No_Bucket;
+      }
+
+      void*                             p_callback;
+      uint32_t                          period;
+      uint32_t                          expiry;
+      etl::timer::id::type              id;
+      etl::timer::id::type              previous;
+      etl::timer::id::type              next;
+      private_timer_wheel::bucket::type bucket;
+      bool                              repeating;
+      callback_type_id                  cbk_type;
+
+    private:
+
+      // Disabled.
+      timer_data(const timer_data& other) ETL_DELETE;
+      timer_data& operator =(const timer_data& other) ETL_DELETE;
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_wheel(timer_data* const           timer_array_,
+                          const uint_least8_t         MAX_TIMERS_,
+                          etl::timer::id::type* const bucket_array_,
+                          uint_least8_t               slot_bits_,
+                          uint_least8_t               levels_)
+      : timer_array(timer_array_),
+        wheel(timer_array_, bucket_array_, slot_bits_, levels_),
+        enabled(false),
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+        process_semaphore(0),
+#endif
+        registered_timers(0),
+        MAX_TIMERS(MAX_TIMERS_)
+    {
+    }
+
+  private:
+
+    //*******************************************
+    /// Finds an unregistered timer.
+    //*******************************************
+    etl::timer::id::type find_free_timer() const
+    {
+      if (registered_timers < MAX_TIMERS)
+      {
+        for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+        {
+          if (timer_array[i].id == etl::timer::id::NO_TIMER)
+          {
+            return i;
+          }
+        }
+      }
+
+      return etl::timer::id::NO_TIMER;
+    }
+
+    // The array of timer data structures.
+    timer_data* const timer_array;
+
+    // The wheel of active timers.
+    private_timer_wheel::timer_wheel<timer_data> wheel;
+
+    volatile bool enabled;
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+
+#if defined(ETL_TIMER_SEMAPHORE_TYPE)
+    typedef ETL_TIMER_SEMAPHORE_TYPE timer_semaphore_t;
+#else
+  #if ETL_HAS_ATOMIC
+    typedef etl::atomic_uint16_t timer_semaphore_t;
+  #else
+    #error No atomic type available
+  #endif
+#endif
+
+    mutable etl::timer_semaphore_t process_semaphore;
+#endif
+    uint_least8_t registered_timers;
+
+  public:
+
+    const uint_least8_t MAX_TIMERS;
+  };
+
+  //***************************************************************************
+  /// The callback timer wheel.
+  ///\tparam MAX_TIMERS_ The maximum number of timers.
+  ///\tparam SLOTS_      The number of slots per level of the wheel. A power of 2.
+  ///                    More slots use more RAM but cascade less often.
+  //***************************************************************************
+  template <const uint_least8_t MAX_TIMERS_, const uint_least16_t SLOTS_ = 16U>
+  class callback_timer_wheel : public etl::icallback_timer_wheel
+  {
+  private:
+
+    typedef private_timer_wheel::wheel_size<SLOTS_> wheel_size;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254, "No more than 254 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel()
+      : icallback_timer_wheel(timer_array, MAX_TIMERS_, bucket_array, wheel_size::Slot_Bits, wheel_size::Levels)
+    {
+    }
+
+  private:
+
+    timer_data           timer_array[MAX_TIMERS_];
+    etl::timer::id::type bucket_array[wheel_size::Buckets];
+  };
+}
+
+#undef ETL_DISABLE_TIMER_UPDATES
+#undef ETL_ENABLE_TIMER_UPDATES
+#undef ETL_TIMER_UPDATES_ENABLED
+
+#endif
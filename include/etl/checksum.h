@@ -38,6 +38,23 @@ SOFTWARE.
 
 namespace etl
 {
+#if ETL_USING_64BIT_TYPES
+  namespace private_checksum
+  {
+    //*************************************************************************
+    /// Loads 8 bytes as a little endian 64 bit word.
+    /// Compilers reduce this to a single load on little endian targets.
+    //*************************************************************************
+    inline uint64_t load_64(const uint8_t* p)
+    {
+      return  static_cast<uint64_t>(p[0])         | (static_cast<uint64_t>(p[1]) << 8U)  |
+             (static_cast<uint64_t>(p[2]) << 16U) | (static_cast<uint64_t>(p[3]) << 24U) |
+             (static_cast<uint64_t>(p[4]) << 32U) | (static_cast<uint64_t>(p[5]) << 40U) |
+             (static_cast<uint64_t>(p[6]) << 48U) | (static_cast<uint64_t>(p[7]) << 56U);
+    }
+  }
+#endif
+
   //***************************************************************************
   /// Standard addition checksum policy.
   //***************************************************************************
@@ -46,6 +63,11 @@ namespace etl
   {
     typedef T value_type;
 
+#if ETL_USING_64BIT_TYPES
+    /// The number of bytes processed by add_block.
+    static ETL_CONSTANT size_t Block_Size = 8U;
+#endif
+
     T initial() const
     {
       return 0;
@@ -56,12 +78,33 @@ namespace etl
       return sum + value;
     }
 
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Adds Block_Size bytes, summing the bytes of a 64 bit word in parallel.
+    //*************************************************************************
+    T add_block(T sum, const uint8_t* p) const
+    {
+      uint64_t word = private_checksum::load_64(p);
+
+      // Four 16 bit lanes, each the sum of two bytes.
+      word = (word & 0x00FF00FF00FF00FFULL) + ((word >> 8U) & 0x00FF00FF00FF00FFULL);
+
+      // The sum of the lanes accumulates in the top lane.
+      return sum + static_cast<T>((word * 0x0001000100010001ULL) >> 48U);
+    }
+#endif
+
     T final(T sum) const
     {
       return sum;
     }
   };
 
+#if ETL_USING_64BIT_TYPES
+  template <typename T>
+  ETL_CONSTANT size_t checksum_policy_sum<T>::Block_Size;
+#endif
+
   //***************************************************************************
   /// BSD checksum policy.
   //***************************************************************************
@@ -94,6 +137,11 @@ namespace etl
   {
     typedef T value_type;
 
+#if ETL_USING_64BIT_TYPES
+    /// The number of bytes processed by add_block.
+    static ETL_CONSTANT size_t Block_Size = 8U;
+#endif
+
     T initial() const
     {
       return 0;
@@ -104,12 +152,33 @@ namespace etl
       return sum ^ value;
     }
 
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Adds Block_Size bytes, folding a 64 bit word down to a byte.
+    //*************************************************************************
+    T add_block(T sum, const uint8_t* p) const
+    {
+      uint64_t word = private_checksum::load_64(p);
+
+      word ^= word >> 32U;
+      word ^= word >> 16U;
+      word ^= word >> 8U;
+
+      return sum ^ static_cast<uint8_t>(word);
+    }
+#endif
+
     T final(T sum) const
     {
       return sum;
     }
   };
 
+#if ETL_USING_64BIT_TYPES
+  template <typename T>
+  ETL_CONSTANT size_t checksum_policy_xor<T>::Block_Size;
+#endif
+
   //***************************************************************************
   /// XOR-rotate checksum policy.
   //***************************************************************************
@@ -142,6 +211,11 @@ namespace etl
   {
     typedef T value_type;
 
+#if ETL_USING_64BIT_TYPES
+    /// The number of bytes processed by add_block.
+    static ETL_CONSTANT size_t Block_Size = 8U;
+#endif
+
     T initial() const
     {
       return 0;
@@ -152,12 +226,312 @@ namespace etl
       return sum ^ etl::parity(value);
     }
 
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Adds Block_Size bytes. The parity of the bytes is the parity of the word.
+    //*************************************************************************
+    T add_block(T sum, const uint8_t* p) const
+    {
+      return sum ^ etl::parity(private_checksum::load_64(p));
+    }
+#endif
+
     T final(T sum) const
     {
       return sum;
     }
   };
 
+#if ETL_USING_64BIT_TYPES
+  template <typename T>
+  ETL_CONSTANT size_t checksum_policy_parity<T>::Block_Size;
+#endif
+
+  //***************************************************************************
+  /// Adler-32 checksum policy. RFC 1950.
+  /// Contiguous ranges defer the modulo to once per block.
+  //***************************************************************************
+  struct checksum_policy_adler32
+  {
+    typedef uint32_t value_type;
+
+    struct accumulator_type
+    {
+      uint32_t a;
+      uint32_t b;
+    };
+
+    static ETL_CONSTANT uint32_t Modulus = 65521UL;
+
+    /// The number of bytes processed by add_block.
+    /// a and b cannot overflow 32 bits within a block.
+    static ETL_CONSTANT size_t Block_Size = 64U;
+
+    accumulator_type initial() const
+    {
+      accumulator_type sum = { 1UL, 0UL };
+
+      return sum;
+    }
+
+    accumulator_type add(accumulator_type sum, uint8_t value) const
+    {
+      sum.a += value;
+      sum.a = (sum.a >= Modulus) ? sum.a - Modulus : sum.a;
+      sum.b += sum.a;
+      sum.b = (sum.b >= Modulus) ? sum.b - Modulus : sum.b;
+
+      return sum;
+    }
+
+    accumulator_type add_block(accumulator_type sum, const uint8_t* p) const
+    {
+      for (size_t i = 0U; i < Block_Size; ++i)
+      {
+        sum.a += p[i];
+        sum.b += sum.a;
+      }
+
+      sum.a %= Modulus;
+      sum.b %= Modulus;
+
+      return sum;
+    }
+
+    value_type final(accumulator_type sum) const
+    {
+      return (sum.b << 16U) | sum.a;
+    }
+  };
+
+  //***************************************************************************
+  /// Fletcher-16 checksum policy.
+  /// Contiguous ranges defer the modulo to once per block.
+  //***************************************************************************
+  struct checksum_policy_fletcher16
+  {
+    typedef uint16_t value_type;
+
+    struct accumulator_type
+    {
+      uint32_t sum1;
+      uint32_t sum2;
+    };
+
+    static ETL_CONSTANT uint32_t Modulus = 255UL;
+
+    /// The number of bytes processed by add_block.
+    /// sum1 and sum2 cannot overflow 32 bits within a block.
+    static ETL_CONSTANT size_t Block_Size = 64U;
+
+    accumulator_type initial() const
+    {
+      accumulator_type sum = { 0UL, 0UL };
+
+      return sum;
+    }
+
+    accumulator_type add(accumulator_type sum, uint8_t value) const
+    {
+      sum.sum1 += value;
+      sum.sum1 = (sum.sum1 >= Modulus) ? sum.sum1 - Modulus : sum.sum1;
+      sum.sum2 += sum.sum1;
+      sum.sum2 = (sum.sum2 >= Modulus) ? sum.sum2 - Modulus : sum.sum2;
+
+      return sum;
+    }
+
+    accumulator_type add_block(accumulator_type sum, const uint8_t* p) const
+    {
+      for (size_t i = 0U; i < Block_Size; ++i)
+      {
+        sum.sum1 += p[i];
+        sum.sum2 += sum.sum1;
+      }
+
+      sum.sum1 %= Modulus;
+      sum.sum2 %= Modulus;
+
+      return sum;
+    }
+
+    value_type final(accumulator_type sum) const
+    {
+      return static_cast<value_type>((sum.sum2 << 8U) | sum.sum1);
+    }
+  };
+
+  //***************************************************************************
+  /// Fletcher-32 checksum policy.
+  /// Sums little endian 16 bit words. An odd final byte is padded with zero.
+  /// Contiguous ranges defer the modulo to once per block.
+  //***************************************************************************
+  struct checksum_policy_fletcher32
+  {
+    typedef uint32_t value_type;
+
+    struct accumulator_type
+    {
+      uint32_t sum1;
+      uint32_t sum2;
+      uint8_t  pending;
+      bool     is_odd;
+    };
+
+    static ETL_CONSTANT uint32_t Modulus = 65535UL;
+
+    /// The number of bytes processed by add_block.
+    /// sum1 and sum2 cannot overflow 32 bits within a block.
+    static ETL_CONSTANT size_t Block_Size = 64U;
+
+    accumulator_type initial() const
+    {
+      accumulator_type sum = { 0UL, 0UL, 0U, false };
+
+      return sum;
+    }
+
+    accumulator_type add(accumulator_type sum, uint8_t value) const
+    {
+      if (sum.is_odd)
+      {
+        sum        = add_word(sum, static_cast<uint32_t>(sum.pending) | (static_cast<uint32_t>(value) << 8U));
+        sum.is_odd = false;
+      }
+      else
+      {
+        sum.pending = value;
+        sum.is_odd  = true;
+      }
+
+      return sum;
+    }
+
+    accumulator_type add_block(accumulator_type sum, const uint8_t* p) const
+    {
+      if (sum.is_odd)
+      {
+        // The words straddle the block, so add a byte at a time.
+        for (size_t i = 0U; i < Block_Size; ++i)
+        {
+          sum = add(sum, p[i]);
+        }
+      }
+      else
+      {
+        for (size_t i = 0U; i < Block_Size; i += 2U)
+        {
+          sum.sum1 += static_cast<uint32_t>(p[i]) | (static_cast<uint32_t>(p[i + 1U]) << 8U);
+          sum.sum2 += sum.sum1;
+        }
+
+        sum.sum1 %= Modulus;
+        sum.sum2 %= Modulus;
+      }
+
+      return sum;
+    }
+
+    value_type final(accumulator_type sum) const
+    {
+      if (sum.is_odd)
+      {
+        sum = add_word(sum, sum.pending);
+      }
+
+      return (sum.sum2 << 16U) | sum.sum1;
+    }
+
+  private:
+
+    static accumulator_type add_word(accumulator_type sum, uint32_t word)
+    {
+      sum.sum1 += word;
+      sum.sum1 = (sum.sum1 >= Modulus) ? sum.sum1 - Modulus : sum.sum1;
+      sum.sum2 += sum.sum1;
+      sum.sum2 = (sum.sum2 >= Modulus) ? sum.sum2 - Modulus : sum.sum2;
+
+      return sum;
+    }
+  };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Internet checksum policy. RFC 1071.
+  /// The one's complement of the one's complement sum of big endian 16 bit words.
+  /// An odd final byte is padded with zero.
+  /// Contiguous ranges add 32 bit words to a 64 bit accumulator, folding
+  /// the carries only at the end.
+  //***************************************************************************
+  struct checksum_policy_internet
+  {
+    typedef uint16_t value_type;
+
+    struct accumulator_type
+    {
+      uint64_t sum;
+      bool     is_odd;
+    };
+
+    /// The number of bytes processed by add_block.
+    static ETL_CONSTANT size_t Block_Size = 32U;
+
+    accumulator_type initial() const
+    {
+      accumulator_type sum = { 0ULL, false };
+
+      return sum;
+    }
+
+    accumulator_type add(accumulator_type sum, uint8_t value) const
+    {
+      sum.sum   += sum.is_odd ? static_cast<uint64_t>(value) : (static_cast<uint64_t>(value) << 8U);
+      sum.is_odd = !sum.is_odd;
+
+      return sum;
+    }
+
+    accumulator_type add_block(accumulator_type sum, const uint8_t* p) const
+    {
+      uint64_t block = 0U;
+
+      for (size_t i = 0U; i < Block_Size; i += 4U)
+      {
+        block += (static_cast<uint32_t>(p[i])      << 24U) | (static_cast<uint32_t>(p[i + 1U]) << 16U) |
+                 (static_cast<uint32_t>(p[i + 2U]) << 8U)  |  static_cast<uint32_t>(p[i + 3U]);
+      }
+
+      if (sum.is_odd)
+      {
+        // The block starts on the low byte of a word, so its sum is byte swapped.
+        uint16_t folded = fold(block);
+        block = static_cast<uint16_t>((folded << 8U) | (folded >> 8U));
+      }
+
+      sum.sum += block;
+
+      return sum;
+    }
+
+    value_type final(accumulator_type sum) const
+    {
+      return static_cast<value_type>(~fold(sum.sum));
+    }
+
+  private:
+
+    static uint16_t fold(uint64_t sum)
+    {
+      while ((sum >> 16U) != 0U)
+      {
+        sum = (sum & 0xFFFFU) + (sum >> 16U);
+      }
+
+      return static_cast<uint16_t>(sum);
+    }
+  };
+#endif
+
   //*************************************************************************
   /// Standard Checksum.
   //*************************************************************************
@@ -302,6 +676,119 @@ namespace etl
       this->add(begin, end);
     }
   };
+  //*************************************************************************
+  /// Adler-32 Checksum.
+  //*************************************************************************
+  class adler32 : public etl::frame_check_sequence<etl::checksum_policy_adler32>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    adler32()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    adler32(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+  //*************************************************************************
+  /// Fletcher-16 Checksum.
+  //*************************************************************************
+  class fletcher16 : public etl::frame_check_sequence<etl::checksum_policy_fletcher16>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    fletcher16()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    fletcher16(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+  //*************************************************************************
+  /// Fletcher-32 Checksum.
+  //*************************************************************************
+  class fletcher32 : public etl::frame_check_sequence<etl::checksum_policy_fletcher32>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    fletcher32()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    fletcher32(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+#if ETL_USING_64BIT_TYPES
+  //*************************************************************************
+  /// Internet Checksum. RFC 1071.
+  //*************************************************************************
+  class internet_checksum : public etl::frame_check_sequence<etl::checksum_policy_internet>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    internet_checksum()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    internet_checksum(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+#endif
 }
 
 #endif
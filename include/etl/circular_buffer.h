@@ -41,6 +41,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "static_assert.h"
 #include "initializer_list.h"
+#include "span.h"
 
 namespace etl
 {
@@ -192,6 +193,9 @@ namespace etl
 
     typedef typename etl::iterator_traits<pointer>::difference_type difference_type;
 
+    typedef etl::span<T>       span_type;
+    typedef etl::span<const T> const_span_type;
+
     //*************************************************************************
     /// Iterator iterating through the circular buffer.
     //*************************************************************************
@@ -954,11 +958,16 @@ namespace etl
     template <typename TIterator>
     void push(TIterator first, const TIterator& last)
     {
-      while (first != last)
-      {
-        push(*first);
-        ++first;
-      }
+      push_range(first, last);
+    }
+
+    //*************************************************************************
+    /// Push the items from a span.
+    /// Trivially copyable items are copied in at most two blocks.
+    //*************************************************************************
+    void push(const_span_type items)
+    {
+      push_range(items.data(), items.data() + items.size());
     }
 
     //*************************************************************************
@@ -977,10 +986,118 @@ namespace etl
     //*************************************************************************
     void pop(size_type n)
     {
-      while (n-- != 0U)
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
+      {
+        ETL_ASSERT_OR_RETURN(n <= size(), ETL_ERROR(circular_buffer_empty));
+
+        out += n;
+        out = (out >= buffer_size) ? out - buffer_size : out;
+        ETL_SUBTRACT_DEBUG_COUNT(n);
+      }
+      else
+      {
+        while (n-- != 0U)
+        {
+          pop();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous block of items, starting at the oldest.
+    /// Empty if the buffer is empty.
+    //*************************************************************************
+    span_type array_one()
+    {
+      return span_type(pbuffer + out, pbuffer + ((in >= out) ? in : buffer_size));
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous block of items, starting at the oldest.
+    /// Empty if the buffer is empty.
+    //*************************************************************************
+    const_span_type array_one() const
+    {
+      return const_span_type(pbuffer + out, pbuffer + ((in >= out) ? in : buffer_size));
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous block of items, that follows array_one().
+    /// Empty if the items are not wrapped around the end of the storage.
+    //*************************************************************************
+    span_type array_two()
+    {
+      return span_type(pbuffer, pbuffer + ((in >= out) ? 0U : in));
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous block of items, that follows array_one().
+    /// Empty if the items are not wrapped around the end of the storage.
+    //*************************************************************************
+    const_span_type array_two() const
+    {
+      return const_span_type(pbuffer, pbuffer + ((in >= out) ? 0U : in));
+    }
+
+    //*************************************************************************
+    /// Rearranges the items so that they are all in array_one().
+    /// Does nothing if they are already contiguous.
+    /// Invalidates all iterators.
+    ///\return A span of all of the items, oldest first.
+    //*************************************************************************
+    span_type linearize()
+    {
+      if (in < out)
       {
-        pop();
+        const size_type n = size();
+
+        // Rotate the whole storage left by 'out', one cycle at a time.
+        // Each item is relocated once; empty slots are skipped.
+        const size_type n_cycles = gcd(buffer_size, out);
+
+        for (size_type start = 0U; start < n_cycles; ++start)
+        {
+          typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type temp;
+          T* p_temp = reinterpret_cast<T*>(&temp);
+
+          const bool start_is_item = is_item_slot(start);
+
+          if (start_is_item)
+          {
+            etl::uninitialized_relocate(pbuffer + start, pbuffer + start + 1U, p_temp);
+          }
+
+          size_type to = start;
+
+          while (true)
+          {
+            size_type from = to + out;
+            from = (from >= buffer_size) ? from - buffer_size : from;
+
+            if (from == start)
+            {
+              break;
+            }
+
+            if (is_item_slot(from))
+            {
+              etl::uninitialized_relocate(pbuffer + from, pbuffer + from + 1U, pbuffer + to);
+            }
+
+            to = from;
+          }
+
+          if (start_is_item)
+          {
+            etl::uninitialized_relocate(p_temp, p_temp + 1U, pbuffer + to);
+          }
+        }
+
+        out = 0U;
+        in  = n;
       }
+
+      return array_one();
     }
 
     //*************************************************************************
@@ -1089,6 +1206,101 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Returns true if the storage slot holds an item.
+    //*************************************************************************
+    bool is_item_slot(size_type slot) const
+    {
+      return (in >= out) ? ((slot >= out) && (slot < in)) : ((slot >= out) || (slot < in));
+    }
+
+    //*************************************************************************
+    /// Greatest common divisor.
+    //*************************************************************************
+    static size_type gcd(size_type a, size_type b)
+    {
+      while (b != 0U)
+      {
+        const size_type t = a % b;
+        a = b;
+        b = t;
+      }
+
+      return a;
+    }
+
+    //*************************************************************************
+    /// Pushes a range one item at a time.
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<!etl::is_trivially_copyable<T>::value ||
+                            !(etl::is_same<TIterator, const T*>::value || etl::is_same<TIterator, T*>::value ||
+                              etl::is_same<TIterator, const_iterator>::value || etl::is_same<TIterator, iterator>::value), void>::type
+      push_range(TIterator first, const TIterator& last)
+    {
+      while (first != last)
+      {
+        push(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Pushes a contiguous range of trivially copyable items.
+    /// Only the newest 'capacity' items are copied, in at most two blocks.
+    //*************************************************************************
+    template <typename TPointer>
+    typename etl::enable_if<etl::is_trivially_copyable<T>::value &&
+                            (etl::is_same<TPointer, const T*>::value || etl::is_same<TPointer, T*>::value), void>::type
+      push_range(TPointer first, TPointer last)
+    {
+      size_type n = size_type(last - first);
+
+      // An empty range may be a pair of null pointers.
+      if (n == 0U)
+      {
+        return;
+      }
+
+      if (n > capacity())
+      {
+        first += (n - capacity());
+        n = capacity();
+      }
+
+      const size_type old_size = size();
+      const size_type new_size = etl::min(old_size + n, capacity());
+      const size_type run      = etl::min(n, buffer_size - in);
+
+      memmove(static_cast<void*>(pbuffer + in), static_cast<const void*>(first), run * sizeof(T));
+      memmove(static_cast<void*>(pbuffer), static_cast<const void*>(first + run), (n - run) * sizeof(T));
+
+      in += n;
+      in  = (in >= buffer_size) ? in - buffer_size : in;
+      out = (in >= new_size) ? in - new_size : in + buffer_size - new_size;
+
+      ETL_ADD_DEBUG_COUNT(new_size - old_size);
+    }
+
+    //*************************************************************************
+    /// Pushes a range of trivially copyable items from a circular buffer,
+    /// as the two contiguous blocks that it is stored in.
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<etl::is_trivially_copyable<T>::value &&
+                            (etl::is_same<TIterator, const_iterator>::value || etl::is_same<TIterator, iterator>::value), void>::type
+      push_range(TIterator first, const TIterator& last)
+    {
+      const icircular_buffer& other = first.container();
+
+      const size_type n     = size_type(distance(first, last));
+      const size_type index = size_type(first.get_index());
+      const size_type run   = etl::min(n, other.buffer_size - index);
+
+      push_range(other.pbuffer + index, other.pbuffer + index + run);
+      push_range(other.pbuffer, other.pbuffer + (n - run));
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -34,9 +34,17 @@ SOFTWARE.
 #include "platform.h"
 #include "permutations.h"
 #include "factorial.h"
+#include "iterator.h"
+#include "binary.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stdint.h>
 
 ///\defgroup combinations combinations
 /// combinations<N, K> : Calculates K combinations from N.
+/// combination_view<N, K> : Lazily steps through the K combinations from N as bitmasks.
 ///\ingroup maths
 
 namespace etl
@@ -58,6 +66,138 @@ namespace etl
   template <size_t NV, size_t KV>
   inline constexpr size_t combinations_v = combinations<NV, KV>::value;
 #endif
+
+  //***************************************************************************
+  ///\ingroup combinations
+  /// A lazy view of the K element subsets of N elements, each presented as a
+  /// bitmask with K of its low N bits set. Subsets are produced in increasing
+  /// numerical order by Gosper's hack, at constant cost per step.
+  //***************************************************************************
+  template <size_t NV, size_t KV>
+  class combination_view
+  {
+  public:
+
+    ETL_STATIC_ASSERT(NV <= 64U, "combination_view supports up to 64 elements");
+    ETL_STATIC_ASSERT(KV <= NV,  "K cannot be greater than N");
+
+    typedef typename etl::conditional<(NV <= 32U), uint32_t, uint64_t>::type value_type;
+
+    //*************************************************************************
+    /// Iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      const_iterator()
+        : mask(0U)
+        , done(true)
+      {
+      }
+
+      const_iterator(value_type mask_, bool done_)
+        : mask(mask_)
+        , done(done_)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        if (mask == combination_view::last())
+        {
+          done = true;
+        }
+        else
+        {
+          // Gosper's hack: move the lowest block of ones up by one place and
+          // return the rest of that block to the bottom.
+          const value_type lowest = mask & (~mask + 1U);
+          const value_type ripple = mask + lowest;
+
+          mask = ripple | (((ripple ^ mask) >> 2U) >> etl::count_trailing_zeros(mask));
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const value_type& operator *() const
+      {
+        return mask;
+      }
+
+      const value_type* operator ->() const
+      {
+        return &mask;
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.done == rhs.done) && (lhs.done || (lhs.mask == rhs.mask));
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      value_type mask;
+      bool       done;
+    };
+
+    typedef const_iterator iterator;
+
+    //*************************************************************************
+    /// The first subset; the lowest K bits.
+    //*************************************************************************
+    static ETL_CONSTEXPR value_type first()
+    {
+      return (KV == 0U) ? value_type(0U) : value_type(value_type(~value_type(0U)) >> ((Bits - KV) % Bits));
+    }
+
+    //*************************************************************************
+    /// The last subset; the highest K of the N bits.
+    //*************************************************************************
+    static ETL_CONSTEXPR value_type last()
+    {
+      return value_type(first() << ((NV - KV) % Bits));
+    }
+
+    const_iterator begin() const
+    {
+      return const_iterator(first(), false);
+    }
+
+    const_iterator end() const
+    {
+      return const_iterator(last(), true);
+    }
+
+    //*************************************************************************
+    /// The number of subsets visited.
+    /// As for etl::combinations, N!/(N-K)! must fit in a size_t.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t size()
+    {
+      return etl::combinations<NV, KV>::value;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Bits = etl::integral_limits<value_type>::bits;
+  };
+
+  template <size_t NV, size_t KV>
+  ETL_CONSTANT size_t combination_view<NV, KV>::Bits;
 }
 
 #endif
@@ -0,0 +1,1174 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_COMPRESSED_BITSET_INCLUDED
+#define ETL_COMPRESSED_BITSET_INCLUDED
+
+#include "platform.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "binary.h"
+
+#include <stdint.h>
+
+///\defgroup compressed_bitset compressed_bitset
+/// A set of 32 bit values in fixed storage, compressed in the style of a
+/// roaring bitmap. The value space is partitioned into chunks of 65536 values
+/// keyed by the upper 16 bits. Each chunk is held as a sorted array of the
+/// lower 16 bits while it is sparse, and as a dense bitmap once it is not.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for compressed_bitset
+  //***************************************************************************
+  class compressed_bitset_exception : public etl::exception
+  {
+  public:
+
+    compressed_bitset_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception.
+  /// Raised when there is no free chunk, or a chunk needs a bitmap and none is free.
+  //***************************************************************************
+  class compressed_bitset_full : public compressed_bitset_exception
+  {
+  public:
+
+    compressed_bitset_full(string_type file_name_, numeric_type line_number_)
+      : compressed_bitset_exception(ETL_ERROR_TEXT("compressed_bitset:full", ETL_COMPRESSED_BITSET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base of all compressed_bitsets.
+  /// Can be used as a reference type for all compressed_bitsets, whatever their size.
+  ///\ingroup compressed_bitset
+  //***************************************************************************
+  class icompressed_bitset
+  {
+  public:
+
+    typedef uint32_t value_type;
+    typedef size_t   size_type;
+
+    //*************************************************************************
+    /// Tests whether a value is in the set.
+    //*************************************************************************
+    ETL_NODISCARD
+    bool test(value_type value) const
+    {
+      const size_t index = find_chunk(high(value));
+
+      if (index == n_chunks)
+      {
+        return false;
+      }
+
+      const chunk& c = p_chunks[index];
+
+      if (is_bitmap(c))
+      {
+        return (bitmap_of(c)[word_index(low(value))] & bit_mask(low(value))) != 0U;
+      }
+      else
+      {
+        const uint16_t* p_array = array_of(c);
+        const size_t    pos     = lower_bound(p_array, c.cardinality, low(value));
+
+        return (pos != c.cardinality) && (p_array[pos] == low(value));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a value to the set.
+    /// Raises compressed_bitset_full if a new chunk or bitmap is needed and none is free.
+    //*************************************************************************
+    void set(value_type value)
+    {
+      const uint16_t key   = high(value);
+      const size_t   index = lower_bound_chunk(key);
+
+      if ((index == n_chunks) || (p_chunks[index].key != key))
+      {
+        if (n_chunks == n_max_chunks)
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(compressed_bitset_full));
+          return;
+        }
+
+        insert_chunk(index, key);
+      }
+
+      chunk&         c     = p_chunks[index];
+      const uint16_t lower = low(value);
+
+      if (!is_bitmap(c))
+      {
+        uint16_t*    p_array = array_of(c);
+        const size_t pos     = lower_bound(p_array, c.cardinality, lower);
+
+        if ((pos != c.cardinality) && (p_array[pos] == lower))
+        {
+          return;
+        }
+
+        if (c.cardinality != n_array_capacity)
+        {
+          for (size_t i = c.cardinality; i > pos; --i)
+          {
+            p_array[i] = p_array[i - 1U];
+          }
+
+          p_array[pos] = lower;
+          ++c.cardinality;
+
+          return;
+        }
+
+        if (!to_bitmap(c))
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(compressed_bitset_full));
+          return;
+        }
+      }
+
+      uint32_t& word = bitmap_of(c)[word_index(lower)];
+
+      if ((word & bit_mask(lower)) == 0U)
+      {
+        word |= bit_mask(lower);
+        ++c.cardinality;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes a value from the set.
+    //*************************************************************************
+    void reset(value_type value)
+    {
+      const size_t index = find_chunk(high(value));
+
+      if (index == n_chunks)
+      {
+        return;
+      }
+
+      chunk&         c     = p_chunks[index];
+      const uint16_t lower = low(value);
+
+      if (is_bitmap(c))
+      {
+        uint32_t& word = bitmap_of(c)[word_index(lower)];
+
+        if ((word & bit_mask(lower)) != 0U)
+        {
+          word &= ~bit_mask(lower);
+          --c.cardinality;
+        }
+      }
+      else
+      {
+        uint16_t*    p_array = array_of(c);
+        const size_t pos     = lower_bound(p_array, c.cardinality, lower);
+
+        if ((pos == c.cardinality) || (p_array[pos] != lower))
+        {
+          return;
+        }
+
+        --c.cardinality;
+
+        for (size_t i = pos; i < c.cardinality; ++i)
+        {
+          p_array[i] = p_array[i + 1U];
+        }
+      }
+
+      if (c.cardinality == 0U)
+      {
+        erase_chunk(index);
+      }
+      else
+      {
+        shrink(c);
+      }
+    }
+
+    //*************************************************************************
+    /// Removes all values from the set.
+    //*************************************************************************
+    void clear()
+    {
+      n_chunks = 0U;
+
+      for (size_t i = 0U; i < n_max_chunks; ++i)
+      {
+        p_free_slots[i] = static_cast<uint16_t>(n_max_chunks - 1U - i);
+      }
+
+      n_free_slots = n_max_chunks;
+
+      for (size_t i = 0U; i < n_max_bitmaps; ++i)
+      {
+        p_free_bitmaps[i] = static_cast<uint16_t>(n_max_bitmaps - 1U - i);
+      }
+
+      n_free_bitmaps = n_max_bitmaps;
+    }
+
+    //*************************************************************************
+    /// The number of values in the set.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t count() const
+    {
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < n_chunks; ++i)
+      {
+        total += p_chunks[i].cardinality;
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the set is empty.
+    //*************************************************************************
+    ETL_NODISCARD
+    bool empty() const
+    {
+      return n_chunks == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of chunks in use.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t chunk_count() const
+    {
+      return n_chunks;
+    }
+
+    //*************************************************************************
+    /// The maximum number of chunks.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t max_chunks() const
+    {
+      return n_max_chunks;
+    }
+
+    //*************************************************************************
+    /// The number of chunks held as bitmaps.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t bitmap_count() const
+    {
+      return n_max_bitmaps - n_free_bitmaps;
+    }
+
+    //*************************************************************************
+    /// The maximum number of bitmaps.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t max_bitmaps() const
+    {
+      return n_max_bitmaps;
+    }
+
+    //*************************************************************************
+    /// The maximum number of values that a chunk may hold as an array.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t array_capacity() const
+    {
+      return n_array_capacity;
+    }
+
+    //*************************************************************************
+    /// Calls f(value) for each value in the set, in ascending order.
+    //*************************************************************************
+    template <typename TFunction>
+    void for_each(TFunction f) const
+    {
+      for (size_t i = 0U; i < n_chunks; ++i)
+      {
+        const chunk&     c    = p_chunks[i];
+        const value_type base = static_cast<value_type>(c.key) << 16U;
+
+        if (is_bitmap(c))
+        {
+          const uint32_t* p_bitmap = bitmap_of(c);
+
+          for (size_t w = 0U; w < Bitmap_Words; ++w)
+          {
+            uint32_t word = p_bitmap[w];
+
+            while (word != 0U)
+            {
+              f(base + static_cast<value_type>(w * 32U) + etl::count_trailing_zeros(word));
+              word &= word - 1U;
+            }
+          }
+        }
+        else
+        {
+          const uint16_t* p_array = array_of(c);
+
+          for (size_t j = 0U; j < c.cardinality; ++j)
+          {
+            f(base + p_array[j]);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if this set and the other have any value in common.
+    //*************************************************************************
+    ETL_NODISCARD
+    bool intersects(const icompressed_bitset& other) const
+    {
+      size_t i = 0U;
+      size_t j = 0U;
+
+      while ((i != n_chunks) && (j != other.n_chunks))
+      {
+        const chunk& c  = p_chunks[i];
+        const chunk& oc = other.p_chunks[j];
+
+        if (c.key < oc.key)
+        {
+          ++i;
+        }
+        else if (oc.key < c.key)
+        {
+          ++j;
+        }
+        else
+        {
+          if (chunk_intersects(c, other, oc))
+          {
+            return true;
+          }
+
+          ++i;
+          ++j;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Intersection. Keeps only the values that are also in the other set.
+    //*************************************************************************
+    icompressed_bitset& operator &=(const icompressed_bitset& other)
+    {
+      if (&other == this)
+      {
+        return *this;
+      }
+
+      size_t kept = 0U;
+      size_t j    = 0U;
+
+      for (size_t i = 0U; i < n_chunks; ++i)
+      {
+        chunk& c = p_chunks[i];
+
+        while ((j != other.n_chunks) && (other.p_chunks[j].key < c.key))
+        {
+          ++j;
+        }
+
+        if ((j != other.n_chunks) && (other.p_chunks[j].key == c.key))
+        {
+          intersect(c, other, other.p_chunks[j]);
+        }
+        else
+        {
+          c.cardinality = 0U;
+        }
+
+        if (c.cardinality == 0U)
+        {
+          release(c);
+        }
+        else
+        {
+          shrink(c);
+          p_chunks[kept++] = c;
+        }
+      }
+
+      n_chunks = kept;
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Union. Adds the values that are in the other set.
+    /// Raises compressed_bitset_full if a new chunk or bitmap is needed and none is free.
+    //*************************************************************************
+    icompressed_bitset& operator |=(const icompressed_bitset& other)
+    {
+      if (&other == this)
+      {
+        return *this;
+      }
+
+      size_t index = 0U;
+
+      for (size_t j = 0U; j < other.n_chunks; ++j)
+      {
+        const chunk& oc = other.p_chunks[j];
+
+        while ((index != n_chunks) && (p_chunks[index].key < oc.key))
+        {
+          ++index;
+        }
+
+        if ((index == n_chunks) || (p_chunks[index].key != oc.key))
+        {
+          if (n_chunks == n_max_chunks)
+          {
+            ETL_ASSERT_FAIL(ETL_ERROR(compressed_bitset_full));
+            return *this;
+          }
+
+          insert_chunk(index, oc.key);
+        }
+
+        if (!unite(p_chunks[index], other, oc))
+        {
+          // Only a chunk inserted above is empty.
+          if (p_chunks[index].cardinality == 0U)
+          {
+            erase_chunk(index);
+          }
+
+          ETL_ASSERT_FAIL(ETL_ERROR(compressed_bitset_full));
+          return *this;
+        }
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The header of a chunk.
+    /// Each chunk owns an array slot. A chunk held as a bitmap also owns a bitmap.
+    //*************************************************************************
+    struct chunk
+    {
+      uint16_t key;
+      uint16_t slot;
+      uint16_t bitmap;
+      uint32_t cardinality;
+    };
+
+    /// The number of 32 bit words in a chunk's bitmap.
+    static ETL_CONSTANT size_t Bitmap_Words = 65536U / 32U;
+
+    /// Marks a chunk that is held as an array.
+    static ETL_CONSTANT uint16_t No_Bitmap = 0xFFFFU;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    icompressed_bitset(chunk*    p_chunks_,
+                       size_t    max_chunks_,
+                       uint16_t* p_arrays_,
+                       size_t    array_capacity_,
+                       uint32_t* p_bitmaps_,
+                       size_t    max_bitmaps_,
+                       uint16_t* p_free_slots_,
+                       uint16_t* p_free_bitmaps_)
+      : p_chunks(p_chunks_)
+      , n_max_chunks(max_chunks_)
+      , n_chunks(0U)
+      , p_arrays(p_arrays_)
+      , n_array_capacity(array_capacity_)
+      , p_bitmaps(p_bitmaps_)
+      , n_max_bitmaps(max_bitmaps_)
+      , p_free_slots(p_free_slots_)
+      , n_free_slots(0U)
+      , p_free_bitmaps(p_free_bitmaps_)
+      , n_free_bitmaps(0U)
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Makes this set a copy of the other.
+    //*************************************************************************
+    void assign(const icompressed_bitset& other)
+    {
+      if (&other != this)
+      {
+        clear();
+        *this |= other;
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    icompressed_bitset(const icompressed_bitset&) ETL_DELETE;
+    icompressed_bitset& operator =(const icompressed_bitset&) ETL_DELETE;
+
+    //*************************************************************************
+    static uint16_t high(value_type value)
+    {
+      return static_cast<uint16_t>(value >> 16U);
+    }
+
+    //*************************************************************************
+    static uint16_t low(value_type value)
+    {
+      return static_cast<uint16_t>(value & 0xFFFFU);
+    }
+
+    //*************************************************************************
+    static size_t word_index(uint16_t lower)
+    {
+      return lower >> 5U;
+    }
+
+    //*************************************************************************
+    static uint32_t bit_mask(uint16_t lower)
+    {
+      return static_cast<uint32_t>(1UL) << (lower & 31U);
+    }
+
+    //*************************************************************************
+    static bool is_bitmap(const chunk& c)
+    {
+      return c.bitmap != No_Bitmap;
+    }
+
+    //*************************************************************************
+    uint16_t* array_of(const chunk& c) const
+    {
+      return p_arrays + (c.slot * n_array_capacity);
+    }
+
+    //*************************************************************************
+    uint32_t* bitmap_of(const chunk& c) const
+    {
+      return p_bitmaps + (c.bitmap * Bitmap_Words);
+    }
+
+    //*************************************************************************
+    /// The index of the first value in a sorted array that is not less than 'lower'.
+    //*************************************************************************
+    static size_t lower_bound(const uint16_t* p_array, size_t size, uint16_t lower)
+    {
+      size_t first = 0U;
+
+      while (size != 0U)
+      {
+        const size_t half = size / 2U;
+
+        if (p_array[first + half] < lower)
+        {
+          first += half + 1U;
+          size  -= half + 1U;
+        }
+        else
+        {
+          size = half;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// The index of the first chunk with a key that is not less than 'key'.
+    //*************************************************************************
+    size_t lower_bound_chunk(uint16_t key) const
+    {
+      size_t first = 0U;
+      size_t size  = n_chunks;
+
+      while (size != 0U)
+      {
+        const size_t half = size / 2U;
+
+        if (p_chunks[first + half].key < key)
+        {
+          first += half + 1U;
+          size  -= half + 1U;
+        }
+        else
+        {
+          size = half;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// The index of the chunk with the key, or n_chunks if there is none.
+    //*************************************************************************
+    size_t find_chunk(uint16_t key) const
+    {
+      const size_t index = lower_bound_chunk(key);
+
+      return ((index != n_chunks) && (p_chunks[index].key == key)) ? index : n_chunks;
+    }
+
+    //*************************************************************************
+    /// Inserts an empty array chunk. There must be a free slot.
+    //*************************************************************************
+    void insert_chunk(size_t index, uint16_t key)
+    {
+      for (size_t i = n_chunks; i > index; --i)
+      {
+        p_chunks[i] = p_chunks[i - 1U];
+      }
+
+      chunk& c = p_chunks[index];
+
+      c.key         = key;
+      c.slot        = p_free_slots[--n_free_slots];
+      c.bitmap      = No_Bitmap;
+      c.cardinality = 0U;
+
+      ++n_chunks;
+    }
+
+    //*************************************************************************
+    /// Returns a chunk's storage to the free lists.
+    //*************************************************************************
+    void release(const chunk& c)
+    {
+      p_free_slots[n_free_slots++] = c.slot;
+
+      if (is_bitmap(c))
+      {
+        p_free_bitmaps[n_free_bitmaps++] = c.bitmap;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes a chunk.
+    //*************************************************************************
+    void erase_chunk(size_t index)
+    {
+      release(p_chunks[index]);
+
+      --n_chunks;
+
+      for (size_t i = index; i < n_chunks; ++i)
+      {
+        p_chunks[i] = p_chunks[i + 1U];
+      }
+    }
+
+    //*************************************************************************
+    /// Converts an array chunk to a bitmap.
+    /// Returns <b>false</b> if there is no free bitmap.
+    //*************************************************************************
+    bool to_bitmap(chunk& c)
+    {
+      if (n_free_bitmaps == 0U)
+      {
+        return false;
+      }
+
+      const uint16_t* p_array = array_of(c);
+
+      c.bitmap = p_free_bitmaps[--n_free_bitmaps];
+
+      uint32_t* p_bitmap = bitmap_of(c);
+
+      for (size_t w = 0U; w < Bitmap_Words; ++w)
+      {
+        p_bitmap[w] = 0U;
+      }
+
+      for (size_t i = 0U; i < c.cardinality; ++i)
+      {
+        p_bitmap[word_index(p_array[i])] |= bit_mask(p_array[i]);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Converts a bitmap chunk back to an array once it has fallen to half of
+    /// the array capacity. The gap stops a chunk on the boundary from
+    /// converting back and forth.
+    //*************************************************************************
+    void shrink(chunk& c)
+    {
+      if (!is_bitmap(c) || (c.cardinality > (n_array_capacity / 2U)))
+      {
+        return;
+      }
+
+      const uint32_t* p_bitmap = bitmap_of(c);
+      uint16_t*       p_array  = array_of(c);
+      size_t          n        = 0U;
+
+      for (size_t w = 0U; w < Bitmap_Words; ++w)
+      {
+        uint32_t word = p_bitmap[w];
+
+        while (word != 0U)
+        {
+          p_array[n++] = static_cast<uint16_t>((w * 32U) + etl::count_trailing_zeros(word));
+          word &= word - 1U;
+        }
+      }
+
+      p_free_bitmaps[n_free_bitmaps++] = c.bitmap;
+      c.bitmap = No_Bitmap;
+    }
+
+    //*************************************************************************
+    /// Counts the set bits in a bitmap.
+    //*************************************************************************
+    static uint32_t bitmap_cardinality(const uint32_t* p_bitmap)
+    {
+      uint32_t total = 0U;
+
+      for (size_t w = 0U; w < Bitmap_Words; ++w)
+      {
+        total += etl::count_bits(p_bitmap[w]);
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if two chunks with the same key share a value.
+    //*************************************************************************
+    bool chunk_intersects(const chunk& c, const icompressed_bitset& other, const chunk& oc) const
+    {
+      if (is_bitmap(c) && other.is_bitmap(oc))
+      {
+        const uint32_t* p_bitmap       = bitmap_of(c);
+        const uint32_t* p_other_bitmap = other.bitmap_of(oc);
+
+        for (size_t w = 0U; w < Bitmap_Words; ++w)
+        {
+          if ((p_bitmap[w] & p_other_bitmap[w]) != 0U)
+          {
+            return true;
+          }
+        }
+      }
+      else if (is_bitmap(c))
+      {
+        return array_intersects_bitmap(other.array_of(oc), oc.cardinality, bitmap_of(c));
+      }
+      else if (other.is_bitmap(oc))
+      {
+        return array_intersects_bitmap(array_of(c), c.cardinality, other.bitmap_of(oc));
+      }
+      else
+      {
+        const uint16_t* p_array       = array_of(c);
+        const uint16_t* p_other_array = other.array_of(oc);
+        size_t          i             = 0U;
+        size_t          j             = 0U;
+
+        while ((i != c.cardinality) && (j != oc.cardinality))
+        {
+          if (p_array[i] < p_other_array[j])
+          {
+            ++i;
+          }
+          else if (p_other_array[j] < p_array[i])
+          {
+            ++j;
+          }
+          else
+          {
+            return true;
+          }
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    static bool array_intersects_bitmap(const uint16_t* p_array, size_t size, const uint32_t* p_bitmap)
+    {
+      for (size_t i = 0U; i < size; ++i)
+      {
+        if ((p_bitmap[word_index(p_array[i])] & bit_mask(p_array[i])) != 0U)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Intersects a chunk with the other set's chunk with the same key.
+    //*************************************************************************
+    void intersect(chunk& c, const icompressed_bitset& other, const chunk& oc)
+    {
+      if (is_bitmap(c) && other.is_bitmap(oc))
+      {
+        uint32_t*       p_bitmap       = bitmap_of(c);
+        const uint32_t* p_other_bitmap = other.bitmap_of(oc);
+
+        for (size_t w = 0U; w < Bitmap_Words; ++w)
+        {
+          p_bitmap[w] &= p_other_bitmap[w];
+        }
+
+        c.cardinality = bitmap_cardinality(p_bitmap);
+      }
+      else if (is_bitmap(c))
+      {
+        // The result is a subset of the other's array.
+        uint32_t*       p_bitmap      = bitmap_of(c);
+        const uint16_t* p_other_array = other.array_of(oc);
+        uint32_t        n             = 0U;
+
+        for (size_t j = 0U; j < oc.cardinality; ++j)
+        {
+          n += ((p_bitmap[word_index(p_other_array[j])] & bit_mask(p_other_array[j])) != 0U) ? 1U : 0U;
+        }
+
+        if (n <= n_array_capacity)
+        {
+          uint16_t* p_array = array_of(c);
+          size_t    k       = 0U;
+
+          for (size_t j = 0U; j < oc.cardinality; ++j)
+          {
+            if ((p_bitmap[word_index(p_other_array[j])] & bit_mask(p_other_array[j])) != 0U)
+            {
+              p_array[k++] = p_other_array[j];
+            }
+          }
+
+          p_free_bitmaps[n_free_bitmaps++] = c.bitmap;
+          c.bitmap = No_Bitmap;
+        }
+        else
+        {
+          // Only possible when the other's array capacity is larger than ours.
+          size_t j = 0U;
+
+          for (size_t w = 0U; w < Bitmap_Words; ++w)
+          {
+            uint32_t mask = 0U;
+
+            while ((j != oc.cardinality) && (word_index(p_other_array[j]) == w))
+            {
+              mask |= bit_mask(p_other_array[j]);
+              ++j;
+            }
+
+            p_bitmap[w] &= mask;
+          }
+        }
+
+        c.cardinality = n;
+      }
+      else
+      {
+        uint16_t* p_array = array_of(c);
+        size_t    k       = 0U;
+
+        if (other.is_bitmap(oc))
+        {
+          const uint32_t* p_other_bitmap = other.bitmap_of(oc);
+
+          for (size_t i = 0U; i < c.cardinality; ++i)
+          {
+            if ((p_other_bitmap[word_index(p_array[i])] & bit_mask(p_array[i])) != 0U)
+            {
+              p_array[k++] = p_array[i];
+            }
+          }
+        }
+        else
+        {
+          const uint16_t* p_other_array = other.array_of(oc);
+          size_t          i             = 0U;
+          size_t          j             = 0U;
+
+          while ((i != c.cardinality) && (j != oc.cardinality))
+          {
+            if (p_array[i] < p_other_array[j])
+            {
+              ++i;
+            }
+            else if (p_other_array[j] < p_array[i])
+            {
+              ++j;
+            }
+            else
+            {
+              p_array[k++] = p_array[i];
+              ++i;
+              ++j;
+            }
+          }
+        }
+
+        c.cardinality = static_cast<uint32_t>(k);
+      }
+    }
+
+    //*************************************************************************
+    /// Unites a chunk with the other set's chunk with the same key.
+    /// Returns <b>false</b> if a bitmap was needed and none was free.
+    //*************************************************************************
+    bool unite(chunk& c, const icompressed_bitset& other, const chunk& oc)
+    {
+      if (!is_bitmap(c))
+      {
+        if (!other.is_bitmap(oc))
+        {
+          const uint16_t* p_other_array = other.array_of(oc);
+          const size_t    n             = union_size(array_of(c), c.cardinality, p_other_array, oc.cardinality);
+
+          if (n <= n_array_capacity)
+          {
+            merge(array_of(c), c.cardinality, p_other_array, oc.cardinality, n);
+            c.cardinality = static_cast<uint32_t>(n);
+
+            return true;
+          }
+        }
+
+        if (!to_bitmap(c))
+        {
+          return false;
+        }
+      }
+
+      uint32_t* p_bitmap = bitmap_of(c);
+
+      if (other.is_bitmap(oc))
+      {
+        const uint32_t* p_other_bitmap = other.bitmap_of(oc);
+
+        for (size_t w = 0U; w < Bitmap_Words; ++w)
+        {
+          p_bitmap[w] |= p_other_bitmap[w];
+        }
+
+        c.cardinality = bitmap_cardinality(p_bitmap);
+      }
+      else
+      {
+        const uint16_t* p_other_array = other.array_of(oc);
+
+        for (size_t j = 0U; j < oc.cardinality; ++j)
+        {
+          uint32_t&      word = p_bitmap[word_index(p_other_array[j])];
+          const uint32_t mask = bit_mask(p_other_array[j]);
+
+          c.cardinality += ((word & mask) == 0U) ? 1U : 0U;
+          word |= mask;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The number of values in the union of two sorted arrays.
+    //*************************************************************************
+    static size_t union_size(const uint16_t* p_a, size_t size_a, const uint16_t* p_b, size_t size_b)
+    {
+      size_t i      = 0U;
+      size_t j      = 0U;
+      size_t common = 0U;
+
+      while ((i != size_a) && (j != size_b))
+      {
+        if (p_a[i] < p_b[j])
+        {
+          ++i;
+        }
+        else if (p_b[j] < p_a[i])
+        {
+          ++j;
+        }
+        else
+        {
+          ++common;
+          ++i;
+          ++j;
+        }
+      }
+
+      return size_a + size_b - common;
+    }
+
+    //*************************************************************************
+    /// Merges the sorted array 'b' into the sorted array 'a', in place from the
+    /// back. 'a' must have room for 'size' values, the size of the union.
+    //*************************************************************************
+    static void merge(uint16_t* p_a, size_t size_a, const uint16_t* p_b, size_t size_b, size_t size)
+    {
+      while (size_b != 0U)
+      {
+        if ((size_a != 0U) && (p_b[size_b - 1U] < p_a[size_a - 1U]))
+        {
+          p_a[--size] = p_a[--size_a];
+        }
+        else
+        {
+          if ((size_a != 0U) && (p_b[size_b - 1U] == p_a[size_a - 1U]))
+          {
+            --size_a;
+          }
+
+          p_a[--size] = p_b[--size_b];
+        }
+      }
+    }
+
+    chunk*    p_chunks;
+    size_t    n_max_chunks;
+    size_t    n_chunks;
+    uint16_t* p_arrays;
+    size_t    n_array_capacity;
+    uint32_t* p_bitmaps;
+    size_t    n_max_bitmaps;
+    uint16_t* p_free_slots;
+    size_t    n_free_slots;
+    uint16_t* p_free_bitmaps;
+    size_t    n_free_bitmaps;
+  };
+
+  //***************************************************************************
+  /// A compressed set of 32 bit values in fixed storage.
+  /// A set of one million sparse values over, say, 16 chunks with 512 value
+  /// arrays and 4 bitmaps needs 48K rather than the 128K of a dense bitset.
+  ///\tparam Max_Chunks     The maximum number of distinct upper 16 bit keys.
+  ///\tparam Array_Capacity The number of values a chunk holds as a sorted array
+  ///                       before converting to a bitmap. At most 4096, where the
+  ///                       array is the same size as the bitmap.
+  ///\tparam Max_Bitmaps    The maximum number of chunks held as 8K bitmaps.
+  ///\ingroup compressed_bitset
+  //***************************************************************************
+  template <size_t Max_Chunks, size_t Array_Capacity, size_t Max_Bitmaps>
+  class compressed_bitset : public icompressed_bitset
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Chunks > 0U, "Max_Chunks must be greater than zero");
+    ETL_STATIC_ASSERT(Max_Chunks <= 65536U, "Max_Chunks must be no more than 65536");
+    ETL_STATIC_ASSERT(Array_Capacity > 0U, "Array_Capacity must be greater than zero");
+    ETL_STATIC_ASSERT(Array_Capacity <= 4096U, "Array_Capacity must be no more than 4096");
+    ETL_STATIC_ASSERT(Max_Bitmaps < 65535U, "Max_Bitmaps must be less than 65535");
+
+    static ETL_CONSTANT size_t MAX_CHUNKS     = Max_Chunks;
+    static ETL_CONSTANT size_t ARRAY_CAPACITY = Array_Capacity;
+    static ETL_CONSTANT size_t MAX_BITMAPS    = Max_Bitmaps;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    compressed_bitset()
+      : icompressed_bitset(chunks, Max_Chunks, arrays, Array_Capacity, bitmaps, Max_Bitmaps, free_slots, free_bitmaps)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    compressed_bitset(const compressed_bitset& other)
+      : icompressed_bitset(chunks, Max_Chunks, arrays, Array_Capacity, bitmaps, Max_Bitmaps, free_slots, free_bitmaps)
+    {
+      assign(other);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    compressed_bitset& operator =(const compressed_bitset& other)
+    {
+      assign(other);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment from any compressed_bitset.
+    //*************************************************************************
+    compressed_bitset& operator =(const icompressed_bitset& other)
+    {
+      assign(other);
+
+      return *this;
+    }
+
+  private:
+
+    chunk    chunks[Max_Chunks];
+    uint16_t arrays[Max_Chunks * Array_Capacity];
+    uint32_t bitmaps[(Max_Bitmaps == 0U) ? 1U : (Max_Bitmaps * Bitmap_Words)];
+    uint16_t free_slots[Max_Chunks];
+    uint16_t free_bitmaps[(Max_Bitmaps == 0U) ? 1U : Max_Bitmaps];
+  };
+
+  template <size_t Max_Chunks, size_t Array_Capacity, size_t Max_Bitmaps>
+  ETL_CONSTANT size_t compressed_bitset<Max_Chunks, Array_Capacity, Max_Bitmaps>::MAX_CHUNKS;
+
+  template <size_t Max_Chunks, size_t Array_Capacity, size_t Max_Bitmaps>
+  ETL_CONSTANT size_t compressed_bitset<Max_Chunks, Array_Capacity, Max_Bitmaps>::ARRAY_CAPACITY;
+
+  template <size_t Max_Chunks, size_t Array_Capacity, size_t Max_Bitmaps>
+  ETL_CONSTANT size_t compressed_bitset<Max_Chunks, Array_Capacity, Max_Bitmaps>::MAX_BITMAPS;
+}
+
+#endif
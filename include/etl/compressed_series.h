@@ -0,0 +1,637 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COMPRESSED_SERIES_INCLUDED
+#define ETL_COMPRESSED_SERIES_INCLUDED
+
+#include "platform.h"
+#include "bit_stream.h"
+#include "binary.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_64BIT_TYPES
+
+///\defgroup compressed_series compressed_series
+/// A fixed size history of timestamped samples, compressed as in Facebook's
+/// Gorilla time series database.
+/// Timestamps are stored as the difference between successive deltas, which
+/// is zero for regularly sampled data, and values as the XOR with the
+/// previous value, which has few meaningful bits for slowly changing data.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A history of timestamped samples, compressed into a fixed number of bytes.
+  /// The bytes are divided into blocks, each compressed independently.
+  /// When the blocks are full, the oldest block is evicted, as in a ring.
+  /// Iterators are invalidated by push_back and clear.
+  ///\tparam T           The sample type. Floating point or integral, up to 64 bits.
+  ///\tparam Bytes_      The number of bytes of compressed storage.
+  ///\tparam Block_Bytes_ The size of each block. The oldest Block_Bytes are evicted at a time.
+  ///\ingroup compressed_series
+  //***************************************************************************
+  template <typename T, size_t Bytes_, size_t Block_Bytes_ = 64U>
+  class compressed_series
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_arithmetic<T>::value && (sizeof(T) <= 8U), "Only arithmetic types of up to 64 bits allowed");
+    ETL_STATIC_ASSERT(Block_Bytes_ >= 16U, "A block must be at least 16 bytes");
+    ETL_STATIC_ASSERT(Block_Bytes_ <= 8192U, "A block must be at most 8192 bytes");
+    ETL_STATIC_ASSERT((Bytes_ / Block_Bytes_) >= 2U, "There must be at least two blocks");
+
+    static ETL_CONSTANT size_t Bytes        = Bytes_;
+    static ETL_CONSTANT size_t Block_Bytes  = Block_Bytes_;
+    static ETL_CONSTANT size_t Block_Count  = Bytes_ / Block_Bytes_;
+
+    typedef uint32_t time_type;
+
+    //*************************************************************************
+    /// A timestamped sample.
+    //*************************************************************************
+    struct sample
+    {
+      time_type time;
+      T         value;
+    };
+
+    typedef sample value_type;
+    typedef size_t size_type;
+
+  private:
+
+    typedef typename etl::conditional<(sizeof(T) <= 4U), uint32_t, uint64_t>::type bits_type;
+
+    static ETL_CONSTANT uint_least8_t Value_Bits  = CHAR_BIT * sizeof(bits_type);
+    static ETL_CONSTANT size_t        Header_Bits = (CHAR_BIT * sizeof(time_type)) + (CHAR_BIT * sizeof(bits_type));
+    static ETL_CONSTANT size_t        Block_Bits  = CHAR_BIT * Block_Bytes_;
+    static ETL_CONSTANT uint_least8_t No_Window   = 0xFFU;
+
+    //*************************************************************************
+    /// The state carried from one sample to the next in a block.
+    //*************************************************************************
+    struct state
+    {
+      time_type     time;
+      uint32_t      delta;
+      bits_type     bits;
+      uint_least8_t lead;
+      uint_least8_t trail;
+    };
+
+  public:
+
+    //*************************************************************************
+    /// Iterates the samples, from the oldest to the newest.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class compressed_series;
+
+      //*******************************************
+      const_iterator()
+        : p_series(ETL_NULLPTR)
+        , block(0U)
+        , index(0U)
+        , position(0U)
+        , last()
+        , current()
+      {
+      }
+
+      //*******************************************
+      const_iterator& operator ++()
+      {
+        ++index;
+
+        if (index == p_series->counts[p_series->block_of(block)])
+        {
+          ++block;
+          index = 0U;
+
+          if (block != p_series->n_blocks)
+          {
+            position = p_series->decode_header(p_series->block_of(block), last);
+            load();
+          }
+        }
+        else
+        {
+          position = p_series->decode(p_series->block_of(block), position, last);
+          load();
+        }
+
+        return *this;
+      }
+
+      //*******************************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+
+        return temp;
+      }
+
+      //*******************************************
+      const value_type& operator *() const
+      {
+        return current;
+      }
+
+      //*******************************************
+      const value_type* operator ->() const
+      {
+        return &current;
+      }
+
+      //*******************************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.block == rhs.block) && (lhs.index == rhs.index);
+      }
+
+      //*******************************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*******************************************
+      const_iterator(const compressed_series& series, size_t block_)
+        : p_series(&series)
+        , block(block_)
+        , index(0U)
+        , position(0U)
+        , last()
+        , current()
+      {
+        if (block != p_series->n_blocks)
+        {
+          position = p_series->decode_header(p_series->block_of(block), last);
+          load();
+        }
+      }
+
+      //*******************************************
+      void load()
+      {
+        current.time  = last.time;
+        current.value = from_bits(last.bits);
+      }
+
+      const compressed_series* p_series;
+      size_t                   block;    ///< The block, counting from the oldest.
+      size_t                   index;    ///< The sample in the block.
+      size_t                   position; ///< The bit position of the next sample in the block.
+      state                    last;
+      value_type               current;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    compressed_series()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Appends a sample.
+    /// Timestamps normally increase, but any sequence is stored exactly.
+    /// If the blocks are full, the oldest block of samples is evicted.
+    //*************************************************************************
+    void push_back(time_type time, T value)
+    {
+      const bits_type bits = to_bits(value);
+
+      if (n_blocks != 0U)
+      {
+        size_t bits_used = encode(block_of(n_blocks - 1U), head_position, time, bits, last);
+
+        if (bits_used != 0U)
+        {
+          head_position += bits_used;
+          ++counts[block_of(n_blocks - 1U)];
+          ++n_samples;
+
+          return;
+        }
+      }
+
+      start_block(time, bits);
+    }
+
+    //*************************************************************************
+    /// Appends a sample.
+    //*************************************************************************
+    void push_back(const value_type& sample_)
+    {
+      push_back(sample_.time, sample_.value);
+    }
+
+    //*************************************************************************
+    /// The newest sample.
+    /// Undefined if empty.
+    //*************************************************************************
+    value_type back() const
+    {
+      value_type result;
+
+      result.time  = last.time;
+      result.value = from_bits(last.bits);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Removes all of the samples.
+    //*************************************************************************
+    void clear()
+    {
+      first_block   = 0U;
+      n_blocks      = 0U;
+      n_samples     = 0U;
+      head_position = 0U;
+
+      last.time  = 0U;
+      last.delta = 0U;
+      last.bits  = 0U;
+      last.lead  = No_Window;
+      last.trail = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of samples held.
+    //*************************************************************************
+    size_type size() const
+    {
+      return n_samples;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no samples.
+    //*************************************************************************
+    bool empty() const
+    {
+      return n_samples == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of compressed bytes in use.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      return (n_blocks == 0U) ? 0U : ((n_blocks - 1U) * Block_Bytes_) + ((head_position + CHAR_BIT - 1U) / CHAR_BIT);
+    }
+
+    //*************************************************************************
+    /// The number of blocks in use.
+    //*************************************************************************
+    size_t block_count() const
+    {
+      return n_blocks;
+    }
+
+    //*************************************************************************
+    /// The oldest sample.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, 0U);
+    }
+
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// After the newest sample.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, n_blocks);
+    }
+
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+  private:
+
+    //*************************************************************************
+    static bits_type to_bits(T value)
+    {
+      bits_type bits = 0U;
+      memcpy(&bits, &value, sizeof(T));
+
+      return bits;
+    }
+
+    //*************************************************************************
+    static T from_bits(bits_type bits)
+    {
+      T value;
+      memcpy(&value, &bits, sizeof(T));
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// The storage index of a block, counting from the oldest.
+    //*************************************************************************
+    size_t block_of(size_t block) const
+    {
+      return (first_block + block) % Block_Count;
+    }
+
+    //*************************************************************************
+    /// Starts a new block with a sample, evicting the oldest if full.
+    //*************************************************************************
+    void start_block(time_type time, bits_type bits)
+    {
+      if (n_blocks == Block_Count)
+      {
+        n_samples  -= counts[first_block];
+        first_block = (first_block + 1U) % Block_Count;
+        --n_blocks;
+      }
+
+      const size_t head = block_of(n_blocks);
+      ++n_blocks;
+
+      etl::bit_stream_writer writer(buffer + (head * Block_Bytes_), Block_Bytes_, etl::endian::big);
+      writer.write_unchecked(time);
+      writer.write_unchecked(bits);
+
+      last.time  = time;
+      last.delta = 0U;
+      last.bits  = bits;
+      last.lead  = No_Window;
+      last.trail = 0U;
+
+      counts[head]  = 1U;
+      head_position = Header_Bits;
+      ++n_samples;
+    }
+
+    //*************************************************************************
+    /// Reads the first sample of a block.
+    /// Returns the bit position of the next sample.
+    //*************************************************************************
+    size_t decode_header(size_t block, state& s) const
+    {
+      etl::bit_stream_reader reader(etl::span<const unsigned char>(buffer + (block * Block_Bytes_), Block_Bytes_), etl::endian::big);
+
+      s.time  = reader.read_unchecked<time_type>();
+      s.bits  = reader.read_unchecked<bits_type>();
+      s.delta = 0U;
+      s.lead  = No_Window;
+      s.trail = 0U;
+
+      return Header_Bits;
+    }
+
+    //*************************************************************************
+    /// Encodes a sample at the bit position in the block.
+    /// Returns the number of bits written, or zero if the sample does not fit.
+    //*************************************************************************
+    size_t encode(size_t block, size_t position, time_type time, bits_type bits, state& s)
+    {
+      // The timestamp, as the difference from the previous delta.
+      const uint32_t delta = static_cast<uint32_t>(time - s.time);
+      const int32_t  dod   = static_cast<int32_t>(delta - s.delta);
+
+      uint32_t      time_prefix;
+      uint_least8_t time_prefix_bits;
+      uint_least8_t time_bits;
+
+      if (dod == 0)
+      {
+        time_prefix = 0x0U; time_prefix_bits = 1U; time_bits = 0U;
+      }
+      else if ((dod >= -64) && (dod <= 63))
+      {
+        time_prefix = 0x2U; time_prefix_bits = 2U; time_bits = 7U;
+      }
+      else if ((dod >= -256) && (dod <= 255))
+      {
+        time_prefix = 0x6U; time_prefix_bits = 3U; time_bits = 9U;
+      }
+      else if ((dod >= -2048) && (dod <= 2047))
+      {
+        time_prefix = 0xEU; time_prefix_bits = 4U; time_bits = 12U;
+      }
+      else
+      {
+        time_prefix = 0xFU; time_prefix_bits = 4U; time_bits = 32U;
+      }
+
+      // The value, as the meaningful bits of the XOR with the previous value.
+      const bits_type x = bits ^ s.bits;
+
+      uint_least8_t lead  = s.lead;
+      uint_least8_t trail = s.trail;
+      bool          reuse = false;
+      size_t        value_bits;
+
+      if (x == 0U)
+      {
+        value_bits = 1U;
+      }
+      else
+      {
+        uint_least8_t x_lead  = etl::count_leading_zeros(x);
+        uint_least8_t x_trail = etl::count_trailing_zeros(x);
+
+        x_lead = (x_lead > 31U) ? uint_least8_t(31U) : x_lead;
+
+        if ((s.lead != No_Window) && (x_lead >= s.lead) && (x_trail >= s.trail))
+        {
+          // Within the previous window.
+          reuse      = true;
+          value_bits = 2U + (Value_Bits - s.lead - s.trail);
+        }
+        else
+        {
+          lead       = x_lead;
+          trail      = x_trail;
+          value_bits = 2U + 5U + 6U + (Value_Bits - lead - trail);
+        }
+      }
+
+      const size_t total = time_prefix_bits + time_bits + value_bits;
+
+      if ((position + total) > Block_Bits)
+      {
+        return 0U;
+      }
+
+      const size_t byte_offset = position / CHAR_BIT;
+
+      etl::bit_stream_writer writer(buffer + (block * Block_Bytes_) + byte_offset, Block_Bytes_ - byte_offset, etl::endian::big);
+      writer.skip(position % CHAR_BIT);
+
+      writer.write_unchecked(time_prefix, time_prefix_bits);
+
+      if (time_bits != 0U)
+      {
+        writer.write_unchecked(static_cast<uint32_t>(dod), time_bits);
+      }
+
+      if (x == 0U)
+      {
+        writer.write_unchecked(false);
+      }
+      else if (reuse)
+      {
+        writer.write_unchecked(uint32_t(0x2U), 2U);
+        writer.write_unchecked(static_cast<bits_type>(x >> trail), static_cast<uint_least8_t>(Value_Bits - lead - trail));
+      }
+      else
+      {
+        const uint_least8_t length = static_cast<uint_least8_t>(Value_Bits - lead - trail);
+
+        writer.write_unchecked(uint32_t(0x3U), 2U);
+        writer.write_unchecked(uint32_t(lead), 5U);
+        writer.write_unchecked(uint32_t(length - 1U), 6U);
+        writer.write_unchecked(static_cast<bits_type>(x >> trail), length);
+      }
+
+      s.time  = time;
+      s.delta = delta;
+      s.bits  = bits;
+      s.lead  = lead;
+      s.trail = trail;
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Decodes the sample at the bit position in the block.
+    /// Returns the bit position of the next sample.
+    //*************************************************************************
+    size_t decode(size_t block, size_t position, state& s) const
+    {
+      const size_t byte_offset = position / CHAR_BIT;
+
+      etl::bit_stream_reader reader(etl::span<const unsigned char>(buffer + (block * Block_Bytes_) + byte_offset, Block_Bytes_ - byte_offset), etl::endian::big);
+      reader.skip(position % CHAR_BIT);
+
+      // The timestamp.
+      uint_least8_t prefix_bits = 0U;
+
+      while ((prefix_bits < 4U) && reader.read_unchecked<bool>())
+      {
+        ++prefix_bits;
+      }
+
+      static const uint_least8_t dod_bits[] = { 0U, 7U, 9U, 12U, 32U };
+
+      const uint_least8_t time_bits = dod_bits[prefix_bits];
+
+      position += (prefix_bits == 4U) ? prefix_bits : prefix_bits + 1U;
+      position += time_bits;
+
+      const int32_t dod = (time_bits == 0U) ? 0 : reader.read_unchecked<int32_t>(time_bits);
+
+      s.delta = static_cast<uint32_t>(s.delta + static_cast<uint32_t>(dod));
+      s.time  = static_cast<time_type>(s.time + s.delta);
+
+      // The value.
+      ++position;
+
+      if (reader.read_unchecked<bool>())
+      {
+        ++position;
+
+        if (reader.read_unchecked<bool>())
+        {
+          s.lead  = reader.read_unchecked<uint_least8_t>(5U);
+          s.trail = static_cast<uint_least8_t>(Value_Bits - s.lead - (reader.read_unchecked<uint_least8_t>(6U) + 1U));
+          position += 5U + 6U;
+        }
+
+        const uint_least8_t length = static_cast<uint_least8_t>(Value_Bits - s.lead - s.trail);
+
+        s.bits   ^= static_cast<bits_type>(reader.read_unchecked<bits_type>(length) << s.trail);
+        position += length;
+      }
+
+      return position;
+    }
+
+    uint8_t   buffer[Block_Count * Block_Bytes_];
+    uint16_t  counts[Block_Count]; ///< The number of samples in each block.
+    size_t    first_block;         ///< The storage index of the oldest block.
+    size_t    n_blocks;
+    size_t    n_samples;
+    size_t    head_position;       ///< The bit position of the next sample in the newest block.
+    state     last;                ///< The newest sample.
+  };
+
+  template <typename T, size_t Bytes_, size_t Block_Bytes_>
+  ETL_CONSTANT size_t compressed_series<T, Bytes_, Block_Bytes_>::Bytes;
+
+  template <typename T, size_t Bytes_, size_t Block_Bytes_>
+  ETL_CONSTANT size_t compressed_series<T, Bytes_, Block_Bytes_>::Block_Bytes;
+
+  template <typename T, size_t Bytes_, size_t Block_Bytes_>
+  ETL_CONSTANT size_t compressed_series<T, Bytes_, Block_Bytes_>::Block_Count;
+
+  template <typename T, size_t Bytes_, size_t Block_Bytes_>
+  ETL_CONSTANT uint_least8_t compressed_series<T, Bytes_, Block_Bytes_>::Value_Bits;
+
+  template <typename T, size_t Bytes_, size_t Block_Bytes_>
+  ETL_CONSTANT size_t compressed_series<T, Bytes_, Block_Bytes_>::Header_Bits;
+
+  template <typename T, size_t Bytes_, size_t Block_Bytes_>
+  ETL_CONSTANT size_t compressed_series<T, Bytes_, Block_Bytes_>::Block_Bits;
+
+  template <typename T, size_t Bytes_, size_t Block_Bytes_>
+  ETL_CONSTANT uint_least8_t compressed_series<T, Bytes_, Block_Bytes_>::No_Window;
+}
+
+#endif
+#endif
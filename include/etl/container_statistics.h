@@ -0,0 +1,369 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONTAINER_STATISTICS_INCLUDED
+#define ETL_CONTAINER_STATISTICS_INCLUDED
+
+#include "platform.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+///\defgroup container_statistics Container statistics
+/// Optional instrumentation for etl::ivector, etl::ideque, etl::iqueue,
+/// etl::imap and etl::iunordered_map.
+/// Enabled by defining ETL_CONTAINER_STATISTICS_ENABLE in the profile.
+/// When disabled, the containers contain no statistics and have no
+/// instrumentation overhead.
+///\ingroup containers
+
+#if !defined(ETL_CONTAINER_STATISTICS_TIMESTAMP_TYPE)
+  #define ETL_CONTAINER_STATISTICS_TIMESTAMP_TYPE uint32_t
+#endif
+
+#if !defined(ETL_CONTAINER_STATISTICS_LATENCY_BUCKETS)
+  #define ETL_CONTAINER_STATISTICS_LATENCY_BUCKETS 16
+#endif
+
+#if !defined(ETL_CONTAINER_STATISTICS_PROBE_BUCKETS)
+  #define ETL_CONTAINER_STATISTICS_PROBE_BUCKETS 8
+#endif
+
+#if ETL_HAS_CONTAINER_STATISTICS
+  #define ETL_CONTAINER_STATISTICS_SCOPE(operation)        etl::container_statistics::scope etl_statistics_scope(this->statistics, etl::container_statistics::operation, this, false)
+  #define ETL_CONTAINER_STATISTICS_PROBED_SCOPE(operation) etl::container_statistics::scope etl_statistics_scope(this->statistics, etl::container_statistics::operation, this, true)
+  #define ETL_CONTAINER_STATISTICS_PROBE                   etl_statistics_scope.probe()
+#else
+  #define ETL_CONTAINER_STATISTICS_SCOPE(operation)        ETL_DO_NOTHING
+  #define ETL_CONTAINER_STATISTICS_PROBED_SCOPE(operation) ETL_DO_NOTHING
+  #define ETL_CONTAINER_STATISTICS_PROBE                   ETL_DO_NOTHING
+#endif
+
+#if ETL_HAS_CONTAINER_STATISTICS
+
+#include "delegate.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// Records the operations made on a container.
+  /// Used to find pathological usage, such as long hash chains or a container
+  /// that is slow or nearly full, under the real load.
+  /// Counts operations, not elements; erasing a range is one erase.
+  /// Latencies are taken from an optional user supplied clock and are kept as
+  /// histograms, where bucket 0 counts zero ticks and bucket n counts 2^(n-1) to
+  /// 2^n - 1 ticks. The last bucket also counts everything longer.
+  /// Probe lengths are the number of keys compared by a hashed container.
+  /// The statistics are not synchronised. If the owner is shared between
+  /// threads then the counts should only be read when it is quiescent.
+  ///\ingroup container_statistics
+  //***************************************************************************
+  class container_statistics
+  {
+  public:
+
+    typedef ETL_CONTAINER_STATISTICS_TIMESTAMP_TYPE timestamp_type;
+    typedef etl::delegate<timestamp_type(void)>     clock_type;
+
+    static ETL_CONSTANT size_t Latency_Buckets = ETL_CONTAINER_STATISTICS_LATENCY_BUCKETS;
+    static ETL_CONSTANT size_t Probe_Buckets   = ETL_CONTAINER_STATISTICS_PROBE_BUCKETS;
+
+    //*************************************************************************
+    /// The instrumented operations.
+    //*************************************************************************
+    enum operation
+    {
+      Insert,
+      Erase,
+      Find,
+      Number_Of_Operations
+    };
+
+    //*************************************************************************
+    /// Records one operation for the duration of its scope.
+    /// Created by the ETL_CONTAINER_STATISTICS_SCOPE macros.
+    //*************************************************************************
+    class scope
+    {
+    public:
+
+      //***********************************
+      template <typename TContainer>
+      scope(container_statistics& statistics_, operation op_, const TContainer* p_container_, bool probed_)
+        : statistics(statistics_)
+        , p_container(p_container_)
+        , size_function(&container_size<TContainer>)
+        , start(statistics_.time_now())
+        , probes(0U)
+        , op(op_)
+        , probed(probed_)
+      {
+      }
+
+      //***********************************
+      ~scope()
+      {
+        statistics.on_operation(op, size_function(p_container), start);
+
+        if (probed)
+        {
+          statistics.on_probe(probes);
+        }
+      }
+
+      //***********************************
+      /// Records that a key was compared.
+      //***********************************
+      void probe()
+      {
+        ++probes;
+      }
+
+    private:
+
+      //***********************************
+      template <typename TContainer>
+      static size_t container_size(const void* p)
+      {
+        return static_cast<const TContainer*>(p)->size();
+      }
+
+      // Disable copy construction and assignment.
+      scope(const scope&);
+      scope& operator =(const scope&);
+
+      container_statistics& statistics;
+      const void*           p_container;
+      size_t                (*size_function)(const void*);
+      timestamp_type        start;
+      size_t                probes;
+      operation             op;
+      bool                  probed;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    container_statistics()
+      : clock()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Sets the clock used to time operations.
+    //*************************************************************************
+    void set_clock(const clock_type& clock_)
+    {
+      clock = clock_;
+    }
+
+    //*************************************************************************
+    /// Removes the clock. Latencies will not be recorded.
+    //*************************************************************************
+    void clear_clock()
+    {
+      clock = clock_type();
+    }
+
+    //*************************************************************************
+    /// Records an operation that started at 'start_time' and left the
+    /// container holding 'size' elements.
+    //*************************************************************************
+    void on_operation(operation op, size_t size, timestamp_type start_time)
+    {
+      ++counts[op];
+
+      current_size = size;
+
+      if (current_size > peak_count)
+      {
+        peak_count = current_size;
+      }
+
+      if (clock.is_valid())
+      {
+        const timestamp_type elapsed = clock() - start_time;
+
+        ++latencies[op][latency_bucket(elapsed)];
+      }
+    }
+
+    //*************************************************************************
+    /// Records the number of keys compared by a hashed operation.
+    //*************************************************************************
+    void on_probe(size_t length)
+    {
+      ++probe_lengths[(length < Probe_Buckets) ? length : (Probe_Buckets - 1U)];
+      probe_total += length;
+
+      if (length > probe_max)
+      {
+        probe_max = length;
+      }
+    }
+
+    //*************************************************************************
+    /// The number of times an operation was made.
+    //*************************************************************************
+    size_t operation_count(operation op) const
+    {
+      return counts[op];
+    }
+
+    //*************************************************************************
+    /// The number of times an operation took a latency in the bucket.
+    /// Always zero if there is no clock.
+    //*************************************************************************
+    size_t latency_count(operation op, size_t bucket) const
+    {
+      return latencies[op][bucket];
+    }
+
+    //*************************************************************************
+    /// The number of hashed operations that compared 'length' keys.
+    /// The last bucket also holds the longer probes.
+    //*************************************************************************
+    size_t probe_count(size_t length) const
+    {
+      return probe_lengths[length];
+    }
+
+    //*************************************************************************
+    /// The total number of keys compared by the hashed operations.
+    //*************************************************************************
+    size_t total_probe_length() const
+    {
+      return probe_total;
+    }
+
+    //*************************************************************************
+    /// The most keys compared by one hashed operation.
+    //*************************************************************************
+    size_t max_probe_length() const
+    {
+      return probe_max;
+    }
+
+    //*************************************************************************
+    /// The size after the last recorded operation.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// The highest size seen after an operation.
+    //*************************************************************************
+    size_t peak_size() const
+    {
+      return peak_count;
+    }
+
+    //*************************************************************************
+    /// Resets the counts and histograms.
+    /// The peak is set to the current size.
+    //*************************************************************************
+    void reset()
+    {
+      const size_t current = current_size;
+
+      clear();
+
+      current_size = current;
+      peak_count   = current;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Clears all of the counts and histograms.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t op = 0U; op < Number_Of_Operations; ++op)
+      {
+        counts[op] = 0U;
+
+        for (size_t bucket = 0U; bucket < Latency_Buckets; ++bucket)
+        {
+          latencies[op][bucket] = 0U;
+        }
+      }
+
+      for (size_t length = 0U; length < Probe_Buckets; ++length)
+      {
+        probe_lengths[length] = 0U;
+      }
+
+      probe_total  = 0U;
+      probe_max    = 0U;
+      current_size = 0U;
+      peak_count   = 0U;
+    }
+
+    //*************************************************************************
+    /// The current time, or zero if there is no clock.
+    //*************************************************************************
+    timestamp_type time_now() const
+    {
+      return clock.is_valid() ? clock() : timestamp_type();
+    }
+
+    //*************************************************************************
+    /// The histogram bucket for a duration.
+    //*************************************************************************
+    static size_t latency_bucket(timestamp_type duration)
+    {
+      size_t bucket = 0U;
+
+      while ((duration != 0U) && (bucket < (Latency_Buckets - 1U)))
+      {
+        duration >>= 1U;
+        ++bucket;
+      }
+
+      return bucket;
+    }
+
+    clock_type clock;
+    size_t     counts[Number_Of_Operations];
+    uint32_t   latencies[Number_Of_Operations][Latency_Buckets];
+    uint32_t   probe_lengths[Probe_Buckets];
+    size_t     probe_total;
+    size_t     probe_max;
+    size_t     current_size;
+    size_t     peak_count;
+  };
+}
+
+#endif
+#endif
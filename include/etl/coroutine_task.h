@@ -0,0 +1,716 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COROUTINE_TASK_INCLUDED
+#define ETL_COROUTINE_TASK_INCLUDED
+
+#include "platform.h"
+#include "task.h"
+#include "ipool.h"
+#include "generic_pool.h"
+#include "timer.h"
+#include "delegate.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_CPP20 && defined(__cpp_impl_coroutine)
+  #define ETL_HAS_COROUTINE 1
+  // The compiler requires std::coroutine_traits and std::coroutine_handle.
+  #include <coroutine>
+#else
+  #define ETL_HAS_COROUTINE 0
+#endif
+
+#if ETL_HAS_COROUTINE
+
+///\defgroup coroutine_task coroutine_task
+/// C++20 stackless coroutines run as etl::scheduler tasks.
+/// Coroutine frames are allocated from an etl::ipool, never from the heap.
+/// The frame is allocated from the first parameter of the coroutine that is
+/// an etl::ipool.
+///\code
+/// etl::coroutine blink(etl::ipool& frames, Led& led)
+/// {
+///   while (true)
+///   {
+///     led.toggle();
+///     co_await etl::delay(500);
+///   }
+/// }
+///
+/// etl::coroutine_frame_pool<256, 4> frames;
+/// etl::coroutine_task task(1);
+/// task.start(blink(frames, led));
+///\endcode
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for coroutine_task.
+  //***************************************************************************
+  class coroutine_task_exception : public etl::exception
+  {
+  public:
+
+    coroutine_task_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The coroutine frame could not be allocated, as the pool was full or its
+  /// items are too small.
+  //***************************************************************************
+  class coroutine_task_no_frame : public etl::coroutine_task_exception
+  {
+  public:
+
+    coroutine_task_no_frame(string_type file_name_, numeric_type line_number_)
+      : etl::coroutine_task_exception(ETL_ERROR_TEXT("coroutine_task:no frame", ETL_COROUTINE_TASK_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A pool for coroutine frames.
+  /// Each frame needs FRAME_SIZE bytes, including a pointer to the pool.
+  ///\ingroup coroutine_task
+  //***************************************************************************
+  template <size_t FRAME_SIZE, size_t SIZE>
+  using coroutine_frame_pool = etl::generic_pool<FRAME_SIZE, alignof(max_align_t), SIZE>;
+
+  class coroutine_task;
+  class coroutine;
+
+  namespace private_coroutine_task
+  {
+    //*************************************************************************
+    /// Is T a non const etl::ipool, or derived from one?
+    //*************************************************************************
+    template <typename T>
+    struct is_pool : etl::integral_constant<bool, etl::is_base_of<etl::ipool, typename etl::remove_reference<T>::type>::value &&
+                                                  !etl::is_const<typename etl::remove_reference<T>::type>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Do any of the types satisfy is_pool?
+    //*************************************************************************
+    template <typename... TArgs>
+    struct has_pool : etl::integral_constant<bool, false>
+    {
+    };
+
+    template <typename T, typename... TArgs>
+    struct has_pool<T, TArgs...> : etl::integral_constant<bool, is_pool<T>::value || has_pool<TArgs...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Returns the first argument that is a pool.
+    //*************************************************************************
+    template <typename T, typename... TArgs>
+    etl::ipool& find_pool(T& first, TArgs&... rest)
+    {
+      if constexpr (is_pool<T>::value)
+      {
+        return first;
+      }
+      else
+      {
+        return find_pool(rest...);
+      }
+    }
+
+    //*************************************************************************
+    /// The part of the promise that does not depend on the parameters.
+    //*************************************************************************
+    class promise_base
+    {
+    public:
+
+      promise_base()
+        : p_task(ETL_NULLPTR)
+      {
+      }
+
+      // Does not run until scheduled.
+      std::suspend_always initial_suspend() const noexcept
+      {
+        return std::suspend_always();
+      }
+
+      // The task destroys the frame.
+      std::suspend_always final_suspend() const noexcept
+      {
+        return std::suspend_always();
+      }
+
+      void return_void()
+      {
+      }
+
+      void unhandled_exception()
+      {
+#if ETL_USING_EXCEPTIONS
+        throw;
+#endif
+      }
+
+      coroutine_task* get_task() const
+      {
+        return p_task;
+      }
+
+      void set_task(coroutine_task* p_task_)
+      {
+        p_task = p_task_;
+      }
+
+    protected:
+
+      // Room for the pool pointer, keeping the frame aligned.
+      static constexpr size_t Header_Size = (sizeof(etl::ipool*) > alignof(max_align_t)) ? sizeof(etl::ipool*) : alignof(max_align_t);
+
+      //***********************************************************************
+      /// Returns null on failure, which makes the coroutine invalid.
+      /// etl::coroutine_task::start() reports the error.
+      //***********************************************************************
+      static void* allocate_frame(size_t size, etl::ipool& pool) noexcept
+      {
+        if (((size + Header_Size) > pool.item_size()) || pool.full())
+        {
+          return ETL_NULLPTR;
+        }
+
+        char* p_item = pool.allocate<char>();
+        *reinterpret_cast<etl::ipool**>(p_item) = &pool;
+
+        return p_item + Header_Size;
+      }
+
+      //***********************************************************************
+      /// Returns the frame to its pool.
+      //***********************************************************************
+      static void release_frame(void* p_frame) noexcept
+      {
+        char* p_item = static_cast<char*>(p_frame) - Header_Size;
+
+        etl::ipool* p_pool = *reinterpret_cast<etl::ipool**>(p_item);
+        p_pool->release(p_item);
+      }
+
+    private:
+
+      coroutine_task* p_task;
+    };
+
+    //*************************************************************************
+    /// The promise of a coroutine with parameters TArgs.
+    /// The frame is allocated from the first parameter that is an etl::ipool.
+    //*************************************************************************
+    template <typename... TArgs>
+    class promise : public promise_base
+    {
+    public:
+
+      ETL_STATIC_ASSERT(has_pool<TArgs...>::value, "An etl::coroutine must have an etl::ipool& parameter");
+
+      etl::coroutine get_return_object();
+
+      static etl::coroutine get_return_object_on_allocation_failure();
+
+      static void* operator new(size_t size, TArgs&... args) noexcept
+      {
+        return allocate_frame(size, find_pool(args...));
+      }
+
+      static void operator delete(void* p_frame, size_t) noexcept
+      {
+        release_frame(p_frame);
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// The return type of a coroutine that is run by an etl::coroutine_task.
+  /// Owns the coroutine frame until it is given to a task.
+  /// If the frame could not be allocated the coroutine is not valid.
+  ///\ingroup coroutine_task
+  //***************************************************************************
+  class coroutine
+  {
+  public:
+
+    //*************************************************************************
+    /// An invalid coroutine.
+    //*************************************************************************
+    coroutine() noexcept
+      : handle()
+      , p_promise(ETL_NULLPTR)
+    {
+    }
+
+    coroutine(coroutine&& other) noexcept
+      : handle(other.handle)
+      , p_promise(other.p_promise)
+    {
+      other.handle    = std::coroutine_handle<>();
+      other.p_promise = ETL_NULLPTR;
+    }
+
+    coroutine& operator =(coroutine&& other) noexcept
+    {
+      if (this != &other)
+      {
+        destroy();
+        handle          = other.handle;
+        p_promise       = other.p_promise;
+        other.handle    = std::coroutine_handle<>();
+        other.p_promise = ETL_NULLPTR;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destroys the frame if it was not given to a task.
+    //*************************************************************************
+    ~coroutine()
+    {
+      destroy();
+    }
+
+    //*************************************************************************
+    /// Was the frame allocated?
+    //*************************************************************************
+    bool is_valid() const
+    {
+      return static_cast<bool>(handle);
+    }
+
+  private:
+
+    template <typename... TArgs>
+    friend class private_coroutine_task::promise;
+
+    friend class coroutine_task;
+
+    coroutine(std::coroutine_handle<> handle_, private_coroutine_task::promise_base* p_promise_)
+      : handle(handle_)
+      , p_promise(p_promise_)
+    {
+    }
+
+    void destroy()
+    {
+      if (handle)
+      {
+        handle.destroy();
+        handle    = std::coroutine_handle<>();
+        p_promise = ETL_NULLPTR;
+      }
+    }
+
+    coroutine(const coroutine&) ETL_DELETE;
+    coroutine& operator =(const coroutine&) ETL_DELETE;
+
+    std::coroutine_handle<>               handle;
+    private_coroutine_task::promise_base* p_promise;
+  };
+
+  namespace private_coroutine_task
+  {
+    //*************************************************************************
+    template <typename... TArgs>
+    etl::coroutine promise<TArgs...>::get_return_object()
+    {
+      return etl::coroutine(std::coroutine_handle<promise>::from_promise(*this), this);
+    }
+
+    //*************************************************************************
+    template <typename... TArgs>
+    etl::coroutine promise<TArgs...>::get_return_object_on_allocation_failure()
+    {
+      return etl::coroutine();
+    }
+  }
+
+  //***************************************************************************
+  /// A task that runs a coroutine.
+  /// The coroutine is resumed by the scheduler when it is not waiting.
+  /// Delays count down in the units passed to tick(), which may be called
+  /// with the same count as the timer controllers' tick(). tick() and the
+  /// scheduler must run in the same context.
+  /// The task calls its ready callback, if set, whenever it may continue.
+  /// For scheduler_policy_ready_bitmap, set it to the policy's
+  /// set_task_ready(). Code that pushes to a queue that a task is waiting on
+  /// should call the policy's set_task_ready() too.
+  ///\ingroup coroutine_task
+  //***************************************************************************
+  class coroutine_task : public etl::task
+  {
+  public:
+
+    typedef bool (*condition_t)(const void* p_context);
+    typedef etl::delegate<void(const etl::task&)> ready_callback_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit coroutine_task(etl::task_priority_t priority)
+      : task(priority)
+      , handle()
+      , delay_remaining(0U)
+      , delaying(false)
+      , p_condition(ETL_NULLPTR)
+      , p_condition_context(ETL_NULLPTR)
+      , ready_callback()
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor. Destroys an unfinished coroutine.
+    //*************************************************************************
+    ~coroutine_task()
+    {
+      destroy();
+    }
+
+    //*************************************************************************
+    /// Starts a coroutine, destroying any that is unfinished.
+    /// Returns false if the coroutine frame could not be allocated.
+    //*************************************************************************
+    bool start(etl::coroutine&& c)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(c.is_valid(), ETL_ERROR(etl::coroutine_task_no_frame), false);
+
+      destroy();
+
+      handle          = c.handle;
+      c.handle        = std::coroutine_handle<>();
+      c.p_promise->set_task(this);
+      c.p_promise     = ETL_NULLPTR;
+
+      ready_callback.call_if(*this);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Destroys an unfinished coroutine.
+    //*************************************************************************
+    void stop()
+    {
+      destroy();
+    }
+
+    //*************************************************************************
+    /// Sets the callback that is called when the task may continue.
+    //*************************************************************************
+    void set_ready_callback(ready_callback_type callback)
+    {
+      ready_callback = callback;
+    }
+
+    //*************************************************************************
+    /// Is there an unfinished coroutine?
+    //*************************************************************************
+    bool is_active() const
+    {
+      return static_cast<bool>(handle);
+    }
+
+    //*************************************************************************
+    /// Is the coroutine waiting for a delay or a condition?
+    //*************************************************************************
+    bool is_waiting() const
+    {
+      return delaying || ((p_condition != ETL_NULLPTR) && !p_condition(p_condition_context));
+    }
+
+    //*************************************************************************
+    /// Counts down a delay.
+    /// Returns true if the delay ended.
+    //*************************************************************************
+    bool tick(uint32_t count)
+    {
+      if (!delaying)
+      {
+        return false;
+      }
+
+      if (count < delay_remaining)
+      {
+        delay_remaining -= count;
+
+        return false;
+      }
+
+      delay_remaining = 0U;
+      delaying        = false;
+
+      ready_callback.call_if(*this);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Get the time to the end of the delay.
+    /// Returns etl::timer::interval::No_Active_Interval if there is no delay.
+    //*************************************************************************
+    uint32_t time_to_next() const
+    {
+      return delaying ? delay_remaining : static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+    }
+
+    //*************************************************************************
+    /// The task has work if the coroutine is not waiting.
+    //*************************************************************************
+    virtual uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return (is_active() && !is_waiting()) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Resumes the coroutine to its next suspension point.
+    //*************************************************************************
+    virtual void task_process_work() ETL_OVERRIDE
+    {
+      if (is_active())
+      {
+        p_condition         = ETL_NULLPTR;
+        p_condition_context = ETL_NULLPTR;
+
+        handle.resume();
+
+        if (handle.done())
+        {
+          destroy();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Suspends the coroutine for 'count' ticks. Used by etl::delay.
+    //*************************************************************************
+    void wait_for(uint32_t count)
+    {
+      delay_remaining = count;
+      delaying        = true;
+    }
+
+    //*************************************************************************
+    /// Suspends the coroutine until the condition is true. Used by etl::await_pop.
+    //*************************************************************************
+    void wait_until(condition_t p_condition_, const void* p_context)
+    {
+      p_condition         = p_condition_;
+      p_condition_context = p_context;
+    }
+
+  private:
+
+    void destroy()
+    {
+      if (handle)
+      {
+        handle.destroy();
+        handle = std::coroutine_handle<>();
+      }
+
+      delaying    = false;
+      p_condition = ETL_NULLPTR;
+    }
+
+    coroutine_task(const coroutine_task&) ETL_DELETE;
+    coroutine_task& operator =(const coroutine_task&) ETL_DELETE;
+
+    std::coroutine_handle<>     handle;
+    uint32_t                    delay_remaining;
+    bool                        delaying;
+    condition_t                 p_condition;
+    const void*                 p_condition_context;
+    ready_callback_type         ready_callback;
+  };
+
+  namespace private_coroutine_task
+  {
+    //*************************************************************************
+    /// Suspends the coroutine for a number of ticks.
+    //*************************************************************************
+    class delay_awaiter
+    {
+    public:
+
+      explicit delay_awaiter(uint32_t count_)
+        : count(count_)
+      {
+      }
+
+      bool await_ready() const noexcept
+      {
+        return count == 0U;
+      }
+
+      template <typename TPromise>
+      void await_suspend(std::coroutine_handle<TPromise> h) const
+      {
+        h.promise().get_task()->wait_for(count);
+      }
+
+      void await_resume() const noexcept
+      {
+      }
+
+    private:
+
+      uint32_t count;
+    };
+
+    //*************************************************************************
+    /// Suspends the coroutine until the next time the scheduler chooses it.
+    //*************************************************************************
+    class yield_awaiter
+    {
+    public:
+
+      bool await_ready() const noexcept
+      {
+        return false;
+      }
+
+      void await_suspend(std::coroutine_handle<>) const noexcept
+      {
+      }
+
+      void await_resume() const noexcept
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Suspends the coroutine until the queue is not empty, then pops the
+    /// front value.
+    //*************************************************************************
+    template <typename TQueue>
+    class pop_awaiter
+    {
+    public:
+
+      typedef typename TQueue::value_type value_type;
+
+      explicit pop_awaiter(TQueue& queue_)
+        : queue(queue_)
+      {
+      }
+
+      bool await_ready() const noexcept
+      {
+        return !queue.empty();
+      }
+
+      template <typename TPromise>
+      void await_suspend(std::coroutine_handle<TPromise> h) const
+      {
+        h.promise().get_task()->wait_until(&not_empty, &queue);
+      }
+
+      value_type await_resume()
+      {
+        value_type value = etl::move(queue.front());
+        queue.pop();
+
+        return value;
+      }
+
+    private:
+
+      static bool not_empty(const void* p_queue)
+      {
+        return !static_cast<const TQueue*>(p_queue)->empty();
+      }
+
+      TQueue& queue;
+    };
+  }
+
+  //***************************************************************************
+  /// co_await etl::delay(count) suspends the coroutine for 'count' ticks of
+  /// its task.
+  ///\ingroup coroutine_task
+  //***************************************************************************
+  inline private_coroutine_task::delay_awaiter delay(uint32_t count)
+  {
+    return private_coroutine_task::delay_awaiter(count);
+  }
+
+  //***************************************************************************
+  /// co_await etl::yield() lets the scheduler run other tasks.
+  ///\ingroup coroutine_task
+  //***************************************************************************
+  inline private_coroutine_task::yield_awaiter yield()
+  {
+    return private_coroutine_task::yield_awaiter();
+  }
+
+  //***************************************************************************
+  /// co_await etl::await_pop(queue) waits until the queue is not empty, then
+  /// pops and returns the front value. Works with queues that have empty(),
+  /// front() and pop(), such as etl::queue and etl::queue_spsc_atomic.
+  ///\ingroup coroutine_task
+  //***************************************************************************
+  template <typename TQueue>
+  private_coroutine_task::pop_awaiter<TQueue> await_pop(TQueue& queue)
+  {
+    return private_coroutine_task::pop_awaiter<TQueue>(queue);
+  }
+}
+
+//*****************************************************************************
+/// Selects the promise for the parameters of an etl::coroutine.
+//*****************************************************************************
+template <typename... TArgs>
+struct std::coroutine_traits<etl::coroutine, TArgs...>
+{
+  typedef etl::private_coroutine_task::promise<TArgs...> promise_type;
+};
+
+#endif
+#endif
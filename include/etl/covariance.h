@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_moments.h"
 
 #include <stdint.h>
 
@@ -131,10 +133,7 @@ namespace etl
     //*********************************
     void add(TInput value1, TInput value2)
     {
-      inner_product += TCalc(value1 * value2);
-      sum1          += TCalc(value1);
-      sum2          += TCalc(value2);
-      ++counter;
+      moments.add(value1, value2);
       recalculate = true;
     }
 
@@ -152,6 +151,27 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add contiguous batches of pairs of values.
+    /// Values beyond the end of the shorter span are ignored.
+    //*********************************
+    void add(etl::span<const TInput> values1, etl::span<const TInput> values2)
+    {
+      const size_t n = (values1.size() < values2.size()) ? values1.size() : values2.size();
+
+      moments.add(values1.data(), values2.data(), n);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Merge the values added to another covariance.
+    //*********************************
+    void merge(const covariance& other)
+    {
+      moments.merge(other.moments);
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -180,12 +200,11 @@ namespace etl
       {
         covariance_value = 0.0;
 
-        if (counter != 0)
+        if (moments.count() != 0U)
         {
-          double n = double(counter);
-          double adjustment = 1.0 / (n * (n - Adjustment));
+          double n = double(moments.count());
 
-          covariance_value = ((n * inner_product) - (sum1 * sum2)) * adjustment;
+          covariance_value = moments.co_deviations() / (n - Adjustment);
 
           recalculate = false;
         }
@@ -207,7 +226,7 @@ namespace etl
     //*********************************
     size_t count() const
     {
-      return size_t(counter);
+      return size_t(moments.count());
     }
 
     //*********************************
@@ -215,20 +234,14 @@ namespace etl
     //*********************************
     void clear()
     {
-      inner_product    = calc_t(0);
-      sum1             = calc_t(0);
-      sum2             = calc_t(0);
-      counter          = 0U;
+      moments.clear();
       covariance_value = 0.0;
       recalculate      = true;
     }
 
   private:
   
-    calc_t   inner_product;
-    calc_t   sum1;
-    calc_t   sum2;
-    uint32_t counter;
+    private_statistics::co_moments<calc_t> moments;
     mutable double covariance_value;
     mutable bool   recalculate;
   };
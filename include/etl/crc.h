@@ -85,4 +85,6 @@ SOFTWARE.
 
 #include "crc64_ecma.h"
 
+#include "crc_chunks.h"
+
 #endif
@@ -0,0 +1,283 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_CHUNKS_INCLUDED
+#define ETL_CRC_CHUNKS_INCLUDED
+
+#include "platform.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+
+///\defgroup crc_chunks Chunked CRC calculation
+/// Splits a block into chunks that may be calculated independently,
+/// for example on other cores or from DMA completion callbacks,
+/// and combines the results.
+///\ingroup crc
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for crc_chunks
+  //***************************************************************************
+  class crc_chunks_exception : public etl::exception
+  {
+  public:
+
+    crc_chunks_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Chunk count exception.
+  //***************************************************************************
+  class crc_chunks_count : public crc_chunks_exception
+  {
+  public:
+
+    crc_chunks_count(string_type file_name_, numeric_type line_number_)
+      : crc_chunks_exception(ETL_ERROR_TEXT("crc_chunks:count", ETL_CRC_CHUNKS_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Chunk index exception.
+  //***************************************************************************
+  class crc_chunks_index : public crc_chunks_exception
+  {
+  public:
+
+    crc_chunks_index(string_type file_name_, numeric_type line_number_)
+      : crc_chunks_exception(ETL_ERROR_TEXT("crc_chunks:index", ETL_CRC_CHUNKS_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Splits a block into up to Max_Chunks chunks of near equal size.
+  /// Each chunk's CRC is calculated independently and set, in any order.
+  /// value() combines the chunk CRCs into the CRC of the whole block.
+  /// Setting different chunks from different threads is safe, as long as
+  /// value() is called after all of them have completed.
+  ///\tparam TCrc       The CRC type. e.g. etl::crc32
+  ///\tparam Max_Chunks The maximum number of chunks.
+  ///\ingroup crc_chunks
+  //***************************************************************************
+  template <typename TCrc, size_t Max_Chunks>
+  class crc_chunks
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Chunks > 0U, "Max_Chunks must be greater than zero");
+
+    typedef TCrc                      crc_type;
+    typedef typename TCrc::value_type value_type;
+
+    static ETL_CONSTANT size_t MAX_CHUNKS = Max_Chunks;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc_chunks()
+      : p_begin(ETL_NULLPTR)
+      , length(0U)
+      , n_chunks(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from a block.
+    /// \param begin     The start of the block.
+    /// \param end       The end of the block.
+    /// \param n_chunks_ The number of chunks. Must be between 1 and Max_Chunks.
+    //*************************************************************************
+    crc_chunks(const uint8_t* begin, const uint8_t* end, size_t n_chunks_)
+      : p_begin(ETL_NULLPTR)
+      , length(0U)
+      , n_chunks(0U)
+    {
+      assign(begin, end, n_chunks_);
+    }
+
+    //*************************************************************************
+    /// Sets the block to split.
+    /// \param begin     The start of the block.
+    /// \param end       The end of the block.
+    /// \param n_chunks_ The number of chunks. Must be between 1 and Max_Chunks.
+    //*************************************************************************
+    void assign(const uint8_t* begin, const uint8_t* end, size_t n_chunks_)
+    {
+      ETL_ASSERT_OR_RETURN((n_chunks_ != 0U) && (n_chunks_ <= Max_Chunks), ETL_ERROR(crc_chunks_count));
+
+      p_begin  = begin;
+      length   = static_cast<size_t>(end - begin);
+      n_chunks = n_chunks_;
+
+      for (size_t i = 0U; i < n_chunks; ++i)
+      {
+        results[i] = TCrc().value();
+      }
+    }
+
+    //*************************************************************************
+    /// The number of chunks.
+    //*************************************************************************
+    size_t size() const
+    {
+      return n_chunks;
+    }
+
+    //*************************************************************************
+    /// The maximum number of chunks.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t max_size() const
+    {
+      return Max_Chunks;
+    }
+
+    //*************************************************************************
+    /// The start of a chunk.
+    //*************************************************************************
+    const uint8_t* chunk_begin(size_t index) const
+    {
+      ETL_ASSERT(index < n_chunks, ETL_ERROR(crc_chunks_index));
+
+      return p_begin + offset(index);
+    }
+
+    //*************************************************************************
+    /// The end of a chunk.
+    //*************************************************************************
+    const uint8_t* chunk_end(size_t index) const
+    {
+      ETL_ASSERT(index < n_chunks, ETL_ERROR(crc_chunks_index));
+
+      return p_begin + offset(index + 1U);
+    }
+
+    //*************************************************************************
+    /// The length of a chunk.
+    //*************************************************************************
+    size_t chunk_length(size_t index) const
+    {
+      ETL_ASSERT(index < n_chunks, ETL_ERROR(crc_chunks_index));
+
+      return offset(index + 1U) - offset(index);
+    }
+
+    //*************************************************************************
+    /// Calculates and sets the CRC of a chunk.
+    /// May be called from any thread.
+    //*************************************************************************
+    void calculate(size_t index)
+    {
+      ETL_ASSERT_OR_RETURN(index < n_chunks, ETL_ERROR(crc_chunks_index));
+
+      results[index] = TCrc(chunk_begin(index), chunk_end(index)).value();
+    }
+
+    //*************************************************************************
+    /// Calculates and sets the CRCs of all of the chunks.
+    //*************************************************************************
+    void calculate()
+    {
+      for (size_t i = 0U; i < n_chunks; ++i)
+      {
+        calculate(i);
+      }
+    }
+
+    //*************************************************************************
+    /// Sets the CRC of a chunk that has been calculated elsewhere.
+    /// \param index The chunk index.
+    /// \param crc   The final CRC value of the chunk.
+    //*************************************************************************
+    void set(size_t index, value_type crc)
+    {
+      ETL_ASSERT_OR_RETURN(index < n_chunks, ETL_ERROR(crc_chunks_index));
+
+      results[index] = crc;
+    }
+
+    //*************************************************************************
+    /// Gets the CRC of a chunk.
+    //*************************************************************************
+    value_type get(size_t index) const
+    {
+      ETL_ASSERT(index < n_chunks, ETL_ERROR(crc_chunks_index));
+
+      return results[index];
+    }
+
+    //*************************************************************************
+    /// Combines the chunk CRCs into the CRC of the whole block.
+    //*************************************************************************
+    value_type value() const
+    {
+      value_type crc = TCrc().value();
+
+      for (size_t i = 0U; i < n_chunks; ++i)
+      {
+        crc = TCrc::combine(crc, results[i], chunk_length(i));
+      }
+
+      return crc;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The offset of the start of a chunk.
+    /// The first (length % n_chunks) chunks are one byte longer.
+    //*************************************************************************
+    size_t offset(size_t index) const
+    {
+      const size_t base      = length / n_chunks;
+      const size_t remainder = length % n_chunks;
+
+      return (index * base) + ((index < remainder) ? index : remainder);
+    }
+
+    const uint8_t* p_begin;
+    size_t         length;
+    size_t         n_chunks;
+    value_type     results[Max_Chunks];
+  };
+
+  template <typename TCrc, size_t Max_Chunks>
+  ETL_CONSTANT size_t crc_chunks<TCrc, Max_Chunks>::MAX_CHUNKS;
+}
+
+#endif
@@ -0,0 +1,409 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_CUCKOO_FILTER_INCLUDED
+#define ETL_CUCKOO_FILTER_INCLUDED
+
+#include "platform.h"
+#include "parameter_type.h"
+#include "type_traits.h"
+#include "power.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+
+///\defgroup cuckoo_filter cuckoo_filter
+/// A cuckoo filter
+///\ingroup containers
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  //***************************************************************************
+  /// An implementation of a cuckoo filter.
+  /// Stores a fingerprint of each key in one of two buckets, which allows
+  /// keys to be removed, unlike a Bloom filter.
+  /// Fixed size. Does not use the heap.
+  /// The hash must support the () operator and define 'argument_type'.
+  ///\tparam TFingerprint The unsigned integral fingerprint type. Wider types give fewer false positives.
+  ///\tparam Buckets      The desired number of buckets. Rounded up to a power of 2.
+  ///\tparam THash        The hash generator class.
+  ///\tparam Bucket_Size  The number of fingerprints per bucket. Default 4.
+  ///\tparam Max_Kicks    The maximum number of relocations when adding. Default 500.
+  ///\ingroup cuckoo_filter
+  //***************************************************************************
+  template <typename TFingerprint,
+            size_t   Buckets,
+            typename THash,
+            size_t   Bucket_Size = 4U,
+            size_t   Max_Kicks   = 500U>
+  class cuckoo_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<TFingerprint>::value && etl::is_unsigned<TFingerprint>::value, "TFingerprint must be an unsigned integral type");
+    ETL_STATIC_ASSERT(sizeof(TFingerprint) <= sizeof(uint32_t), "TFingerprint must be no more than 32 bits");
+    ETL_STATIC_ASSERT(Bucket_Size > 0U, "Bucket_Size must be greater than zero");
+
+    typedef TFingerprint fingerprint_type;
+
+    enum
+    {
+      BUCKETS     = etl::power_of_2_round_up<Buckets>::value,
+      BUCKET_SIZE = Bucket_Size,
+      CAPACITY    = BUCKETS * Bucket_Size
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    cuckoo_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t b = 0U; b < BUCKETS; ++b)
+      {
+        for (size_t s = 0U; s < Bucket_Size; ++s)
+        {
+          table[b][s] = Empty;
+        }
+      }
+
+      n_items            = 0U;
+      has_victim         = false;
+      victim_fingerprint = Empty;
+      victim_index       = 0U;
+      random_state       = Random_Seed;
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    /// When both of the key's buckets are full, fingerprints are relocated to
+    /// their alternate buckets. If that fails the last displaced fingerprint
+    /// is held aside and the filter is full.
+    ///\param  key The key to add.
+    ///\return <b>false</b> if the filter was full and the key was not added.
+    //***************************************************************************
+    bool add(parameter_t key)
+    {
+      if (has_victim)
+      {
+        return false;
+      }
+
+      const uint64_t hash = get_hash(key);
+
+      fingerprint_type fp = get_fingerprint(hash);
+      const size_t     i1 = get_index(hash);
+      const size_t     i2 = alternate_index(i1, fp);
+
+      if (insert(i1, fp) || insert(i2, fp))
+      {
+        ++n_items;
+        return true;
+      }
+
+      // Relocate existing fingerprints.
+      size_t index = ((next_random() & 1U) == 0U) ? i1 : i2;
+
+      for (size_t kick = 0U; kick < Max_Kicks; ++kick)
+      {
+        const size_t slot = next_random() % Bucket_Size;
+
+        const fingerprint_type displaced = table[index][slot];
+        table[index][slot] = fp;
+        fp = displaced;
+
+        index = alternate_index(index, fp);
+
+        if (insert(index, fp))
+        {
+          ++n_items;
+          return true;
+        }
+      }
+
+      // Keep the last displaced fingerprint, so that nothing is lost.
+      has_victim         = true;
+      victim_fingerprint = fp;
+      victim_index       = index;
+      ++n_items;
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Removes a key from the filter.
+    /// Only keys that were previously added should be removed.
+    ///\param  key The key to remove.
+    ///\return <b>false</b> if the key did not exist in the filter.
+    //***************************************************************************
+    bool remove(parameter_t key)
+    {
+      const uint64_t hash = get_hash(key);
+
+      const fingerprint_type fp = get_fingerprint(hash);
+      const size_t           i1 = get_index(hash);
+      const size_t           i2 = alternate_index(i1, fp);
+
+      if (has_victim && (victim_fingerprint == fp) && ((victim_index == i1) || (victim_index == i2)))
+      {
+        has_victim = false;
+        --n_items;
+        return true;
+      }
+
+      if (erase(i1, fp) || erase(i2, fp))
+      {
+        --n_items;
+
+        // There is now room for the held aside fingerprint.
+        if (has_victim)
+        {
+          if (insert(victim_index, victim_fingerprint) || insert(alternate_index(victim_index, victim_fingerprint), victim_fingerprint))
+          {
+            has_victim = false;
+          }
+        }
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      const uint64_t hash = get_hash(key);
+
+      const fingerprint_type fp = get_fingerprint(hash);
+      const size_t           i1 = get_index(hash);
+      const size_t           i2 = alternate_index(i1, fp);
+
+      if (has_victim && (victim_fingerprint == fp) && ((victim_index == i1) || (victim_index == i2)))
+      {
+        return true;
+      }
+
+      return contains(i1, fp) || contains(i2, fp);
+    }
+
+    //***************************************************************************
+    /// Returns the number of keys in the filter.
+    //***************************************************************************
+    size_t size() const
+    {
+      return n_items;
+    }
+
+    //***************************************************************************
+    /// Returns the maximum number of fingerprints that the buckets can hold.
+    //***************************************************************************
+    size_t capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if the filter is empty.
+    //***************************************************************************
+    bool empty() const
+    {
+      return n_items == 0U;
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if the filter is full and no more keys may be added.
+    //***************************************************************************
+    bool full() const
+    {
+      return has_victim;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * n_items) / CAPACITY;
+    }
+
+  private:
+
+    static ETL_CONSTANT fingerprint_type Empty       = 0U;
+    static ETL_CONSTANT fingerprint_type Non_Empty   = 1U;
+    static ETL_CONSTANT uint32_t         Random_Seed = 0x9E3779B9UL;
+
+    //***************************************************************************
+    /// Gets the hash for the key, mixed to 64 bits.
+    //***************************************************************************
+    static uint64_t get_hash(parameter_t key)
+    {
+      uint64_t hash = static_cast<uint64_t>(THash()(key));
+
+      hash ^= hash >> 33U;
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= hash >> 33U;
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= hash >> 33U;
+
+      return hash;
+    }
+
+    //***************************************************************************
+    /// The fingerprint for a hash, from the upper bits. Never empty.
+    //***************************************************************************
+    static fingerprint_type get_fingerprint(uint64_t hash)
+    {
+      const fingerprint_type fp = static_cast<fingerprint_type>(hash >> 32U);
+
+      return (fp == Empty) ? Non_Empty : fp;
+    }
+
+    //***************************************************************************
+    /// The primary bucket for a hash, from the lower bits.
+    //***************************************************************************
+    static size_t get_index(uint64_t hash)
+    {
+      return static_cast<uint32_t>(hash) & (BUCKETS - 1U);
+    }
+
+    //***************************************************************************
+    /// The other bucket for a fingerprint.
+    /// Applying this twice returns the original bucket.
+    //***************************************************************************
+    static size_t alternate_index(size_t index, fingerprint_type fp)
+    {
+      uint32_t fp_hash = fp;
+      fp_hash *= 0x5BD1E995UL;
+
+      return (index ^ fp_hash) & (BUCKETS - 1U);
+    }
+
+    //***************************************************************************
+    /// Inserts a fingerprint into a free slot in the bucket.
+    //***************************************************************************
+    bool insert(size_t index, fingerprint_type fp)
+    {
+      for (size_t s = 0U; s < Bucket_Size; ++s)
+      {
+        if (table[index][s] == Empty)
+        {
+          table[index][s] = fp;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    /// Erases one copy of a fingerprint from the bucket.
+    //***************************************************************************
+    bool erase(size_t index, fingerprint_type fp)
+    {
+      for (size_t s = 0U; s < Bucket_Size; ++s)
+      {
+        if (table[index][s] == fp)
+        {
+          table[index][s] = Empty;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    /// Checks if the bucket contains the fingerprint.
+    //***************************************************************************
+    bool contains(size_t index, fingerprint_type fp) const
+    {
+      for (size_t s = 0U; s < Bucket_Size; ++s)
+      {
+        if (table[index][s] == fp)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    /// Xorshift generator for choosing fingerprints to relocate.
+    //***************************************************************************
+    uint32_t next_random()
+    {
+      random_state ^= random_state << 13U;
+      random_state ^= random_state >> 17U;
+      random_state ^= random_state << 5U;
+
+      return random_state;
+    }
+
+    fingerprint_type table[BUCKETS][Bucket_Size];
+    size_t           n_items;
+    bool             has_victim;
+    fingerprint_type victim_fingerprint;
+    size_t           victim_index;
+    uint32_t         random_state;
+  };
+
+  template <typename TFingerprint, size_t Buckets, typename THash, size_t Bucket_Size, size_t Max_Kicks>
+  ETL_CONSTANT TFingerprint cuckoo_filter<TFingerprint, Buckets, THash, Bucket_Size, Max_Kicks>::Empty;
+
+  template <typename TFingerprint, size_t Buckets, typename THash, size_t Bucket_Size, size_t Max_Kicks>
+  ETL_CONSTANT TFingerprint cuckoo_filter<TFingerprint, Buckets, THash, Bucket_Size, Max_Kicks>::Non_Empty;
+
+  template <typename TFingerprint, size_t Buckets, typename THash, size_t Bucket_Size, size_t Max_Kicks>
+  ETL_CONSTANT uint32_t cuckoo_filter<TFingerprint, Buckets, THash, Bucket_Size, Max_Kicks>::Random_Seed;
+}
+
+#endif
+
+#endif
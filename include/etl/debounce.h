@@ -33,7 +33,12 @@ SOFTWARE.
 
 #include "platform.h"
 #include "static_assert.h"
+#include "binary.h"
+#include "log.h"
+#include "smallest.h"
+#include "integral_limits.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace etl
@@ -582,6 +587,162 @@ namespace etl
     count_t hold_count;
     count_t repeat_count;
   };
+
+  //***************************************************************************
+  /// A bank of debouncers for up to 64 inputs packed into one word.
+  /// Each input changes state when it has sampled the opposite state
+  /// SAMPLES times in a row, as etl::debounce<SAMPLES>.
+  /// The per input counters are vertical, one word per counter bit, so
+  /// every input is updated with a constant number of bitwise operations.
+  ///\tparam CHANNELS The number of inputs.
+  ///\tparam SAMPLES  The number of consecutive samples for a valid change.
+  //***************************************************************************
+  template <size_t CHANNELS, uint16_t SAMPLES>
+  class debounce_bank
+  {
+  public:
+
+    ETL_STATIC_ASSERT(CHANNELS > 0U, "A debounce bank needs at least one channel");
+    ETL_STATIC_ASSERT(CHANNELS <= etl::integral_limits<uintmax_t>::bits, "Too many channels for one word");
+    ETL_STATIC_ASSERT(SAMPLES > 0U, "A debounce bank needs at least one sample");
+
+    typedef typename etl::smallest_uint_for_bits<CHANNELS>::type mask_type;
+
+    static ETL_CONSTANT size_t   Channels = CHANNELS;
+    static ETL_CONSTANT uint16_t Samples  = SAMPLES;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param initial_state The initial state of each input, one bit per input. Default = 0.
+    //*************************************************************************
+    debounce_bank(mask_type initial_state = 0U)
+    {
+      clear(initial_state);
+    }
+
+    //*************************************************************************
+    /// Restarts every input in the supplied state.
+    ///\param initial_state The state of each input, one bit per input. Default = 0.
+    //*************************************************************************
+    void clear(mask_type initial_state = 0U)
+    {
+      debounced = initial_state & Channel_Mask;
+      changes   = 0U;
+
+      for (size_t i = 0U; i < Counter_Bits; ++i)
+      {
+        counter[i] = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a new sample for every input.
+    ///\param samples The new samples, one bit per input.
+    ///\return The mask of inputs that changed state.
+    //*************************************************************************
+    mask_type add(mask_type samples)
+    {
+      // Inputs that differ from their debounced state count up. The rest restart.
+      const mask_type differs = (samples ^ debounced) & Channel_Mask;
+
+      mask_type carry   = differs;
+      mask_type reached = differs;
+
+      for (size_t i = 0U; i < Counter_Bits; ++i)
+      {
+        const mask_type bit = counter[i] & differs;
+
+        counter[i] = bit ^ carry;
+        carry      = bit & carry;
+
+        // Compare each counter with SAMPLES, a bit at a time.
+        reached &= ((SAMPLES >> i) & 1U) ? counter[i] : mask_type(~counter[i]);
+      }
+
+      // Inputs that reached SAMPLES change state and restart.
+      for (size_t i = 0U; i < Counter_Bits; ++i)
+      {
+        counter[i] &= mask_type(~reached);
+      }
+
+      debounced ^= reached;
+      changes    = reached;
+
+      return changes;
+    }
+
+    //*************************************************************************
+    /// Gets the debounced state of every input.
+    ///\return One bit per input, set if the input is in the true state.
+    //*************************************************************************
+    mask_type state() const
+    {
+      return debounced;
+    }
+
+    //*************************************************************************
+    /// Gets the inputs that changed state on the last sample.
+    //*************************************************************************
+    mask_type changed() const
+    {
+      return changes;
+    }
+
+    //*************************************************************************
+    /// Gets the inputs that changed to the true state on the last sample.
+    //*************************************************************************
+    mask_type rising() const
+    {
+      return changes & debounced;
+    }
+
+    //*************************************************************************
+    /// Gets the inputs that changed to the false state on the last sample.
+    //*************************************************************************
+    mask_type falling() const
+    {
+      return changes & mask_type(~debounced);
+    }
+
+    //*************************************************************************
+    /// Gets the debounced state of one input.
+    ///\return 'true' if the input is in the true state.
+    //*************************************************************************
+    bool is_set(size_t channel) const
+    {
+      return ((debounced >> channel) & 1U) != 0U;
+    }
+
+    //*************************************************************************
+    /// Gets whether one input changed state on the last sample.
+    ///\return 'true' if the input changed state.
+    //*************************************************************************
+    bool has_changed(size_t channel) const
+    {
+      return ((changes >> channel) & 1U) != 0U;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t    Counter_Bits = etl::log2<SAMPLES>::value + 1U;
+    static ETL_CONSTANT mask_type Channel_Mask = etl::lsb_mask<mask_type, CHANNELS>::value;
+
+    mask_type counter[Counter_Bits]; ///< Bit N of each input's count.
+    mask_type debounced;
+    mask_type changes;
+  };
+
+  template <size_t CHANNELS, uint16_t SAMPLES>
+  ETL_CONSTANT size_t debounce_bank<CHANNELS, SAMPLES>::Channels;
+
+  template <size_t CHANNELS, uint16_t SAMPLES>
+  ETL_CONSTANT uint16_t debounce_bank<CHANNELS, SAMPLES>::Samples;
+
+  template <size_t CHANNELS, uint16_t SAMPLES>
+  ETL_CONSTANT size_t debounce_bank<CHANNELS, SAMPLES>::Counter_Bits;
+
+  template <size_t CHANNELS, uint16_t SAMPLES>
+  ETL_CONSTANT typename debounce_bank<CHANNELS, SAMPLES>::mask_type debounce_bank<CHANNELS, SAMPLES>::Channel_Mask;
 }
 
 #endif
@@ -36,6 +36,7 @@ SOFTWARE.
 #include "static_assert.h"
 #include "delegate.h"
 #include "array.h"
+#include "private/sparse_id_table.h"
 
 namespace etl
 {
@@ -209,6 +210,132 @@ namespace etl
     /// Lookup table of delegates.
     etl::array<delegate_type, Range> lookup;
   };
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// A delegate service for a sparse set of ids.
+  /// Holds a delegate for each id, rather than for each value in the range
+  /// of ids, and finds it with a binary search of the ids.
+  /// \tparam Ids The delegate ids, unique and in ascending order.
+  //***************************************************************************
+  template <size_t... Ids>
+  class sparse_delegate_service
+  {
+  private:
+
+    typedef etl::private_sparse_id_table::id_table<Ids...> id_table;
+
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(Ids) != 0U, "No ids");
+    ETL_STATIC_ASSERT(id_table::is_ascending(), "Ids must be unique and in ascending order");
+
+    typedef etl::delegate<void(size_t)> delegate_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// Sets all delegates to the internal default.
+    //*************************************************************************
+    sparse_delegate_service()
+    {
+      delegate_type default_delegate = delegate_type::create<sparse_delegate_service, &sparse_delegate_service::unhandled>(*this);
+
+      lookup.fill(default_delegate);
+    }
+
+    //*************************************************************************
+    /// Registers a delegate for the specified id.
+    /// Compile time assert if the id is not in the list.
+    /// \tparam Id The id of the delegate.
+    /// \param delegate Reference to the delegate.
+    //*************************************************************************
+    template <size_t Id>
+    void register_delegate(delegate_type callback)
+    {
+      ETL_STATIC_ASSERT(id_table::index_of_id(Id) != id_table::Size, "Callback Id not in the list");
+
+      lookup[id_table::index_of_id(Id)] = callback;
+    }
+
+    //*************************************************************************
+    /// Registers a delegate for the specified id.
+    /// No action if the id is not in the list.
+    /// \param id       Id of the delegate.
+    /// \param delegate Reference to the delegate.
+    //*************************************************************************
+    void register_delegate(size_t id, delegate_type callback)
+    {
+      const size_t index = id_table::index_of(id);
+
+      if (index != id_table::Size)
+      {
+        lookup[index] = callback;
+      }
+    }
+
+    //*************************************************************************
+    /// Registers an alternative delegate for unhandled ids.
+    /// \param delegate A reference to the user supplied 'unhandled' delegate.
+    //*************************************************************************
+    void register_unhandled_delegate(delegate_type callback)
+    {
+      unhandled_delegate = callback;
+    }
+
+    //*************************************************************************
+    /// Executes the delegate function for the index.
+    /// Compile time assert if the id is not in the list.
+    /// \tparam Id The id of the delegate.
+    //*************************************************************************
+    template <size_t Id>
+    void call() const
+    {
+      ETL_STATIC_ASSERT(id_table::index_of_id(Id) != id_table::Size, "Callback Id not in the list");
+
+      lookup[id_table::index_of_id(Id)](Id);
+    }
+
+    //*************************************************************************
+    /// Executes the delegate function for the index.
+    /// \param id Id of the delegate.
+    //*************************************************************************
+    void call(const size_t id) const
+    {
+      const size_t index = id_table::index_of(id);
+
+      if (index != id_table::Size)
+      {
+        // Call the delegate with the specified Id.
+        lookup[index](id);
+      }
+      else
+      {
+        // Call the 'unhandled' delegate.
+        unhandled(id);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The default callback function.
+    /// Calls the user defined 'unhandled' callback if it exists.
+    //*************************************************************************
+    void unhandled(size_t id) const
+    {
+      if (unhandled_delegate.is_valid())
+      {
+        unhandled_delegate(id);
+      }
+    }
+
+    /// The default delegate for unhandled ids.
+    delegate_type unhandled_delegate;
+
+    /// Lookup table of delegates, in the order of the ids.
+    etl::array<delegate_type, sizeof...(Ids)> lookup;
+  };
+#endif
 }
 
 #endif
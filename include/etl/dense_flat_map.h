@@ -0,0 +1,1251 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DENSE_FLAT_MAP_INCLUDED
+#define ETL_DENSE_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "vector.h"
+#include "functional.h"
+#include "iterator.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "initializer_list.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup dense_flat_map dense_flat_map
+/// A flat_map with the capacity defined at compile time, that stores the keys
+/// and mapped values in two parallel sorted arrays.
+/// Searches only touch the contiguous key array, with no indirection.
+/// Insertion and erasure move the elements that follow.
+/// Has insertion of O(N) and find of O(logN)
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup dense_flat_map
+  /// Exception base for dense_flat_map
+  //***************************************************************************
+  class dense_flat_map_exception : public etl::exception
+  {
+  public:
+
+    dense_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup dense_flat_map
+  /// Full exception.
+  //***************************************************************************
+  class dense_flat_map_full : public dense_flat_map_exception
+  {
+  public:
+
+    dense_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : dense_flat_map_exception(ETL_ERROR_TEXT("dense_flat_map:full", ETL_DENSE_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup dense_flat_map
+  /// Out of bounds exception.
+  //***************************************************************************
+  class dense_flat_map_out_of_bounds : public dense_flat_map_exception
+  {
+  public:
+
+    dense_flat_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : dense_flat_map_exception(ETL_ERROR_TEXT("dense_flat_map:bounds", ETL_DENSE_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized dense_flat_maps.
+  /// Can be used as a reference type for all dense_flat_maps containing a specific type.
+  /// As the keys and mapped values are stored separately, iterators dereference
+  /// to a pair like object of references.
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class idense_flat_map
+  {
+  public:
+
+    typedef TKey                                    key_type;
+    typedef TMapped                                 mapped_type;
+    typedef ETL_OR_STD::pair<key_type, mapped_type> value_type;
+    typedef TKeyCompare                             key_compare;
+    typedef size_t                                  size_type;
+    typedef ptrdiff_t                               difference_type;
+
+    //*************************************************************************
+    /// The result of dereferencing an iterator.
+    //*************************************************************************
+    struct reference
+    {
+      reference(const key_type& first_, mapped_type& second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      const key_type& first;
+      mapped_type&    second;
+    };
+
+    //*************************************************************************
+    /// The result of dereferencing a const_iterator.
+    //*************************************************************************
+    struct const_reference
+    {
+      const_reference(const key_type& first_, const mapped_type& second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      const_reference(const reference& other)
+        : first(other.first)
+        , second(other.second)
+      {
+      }
+
+      const key_type&    first;
+      const mapped_type& second;
+    };
+
+    //*************************************************************************
+    /// Allows operator -> to be used on an iterator.
+    //*************************************************************************
+    class pointer
+    {
+    public:
+
+      explicit pointer(const reference& reference_)
+        : ref(reference_)
+      {
+      }
+
+      const reference* operator ->() const
+      {
+        return &ref;
+      }
+
+    private:
+
+      reference ref;
+    };
+
+    //*************************************************************************
+    /// Allows operator -> to be used on a const_iterator.
+    //*************************************************************************
+    class const_pointer
+    {
+    public:
+
+      explicit const_pointer(const const_reference& reference_)
+        : ref(reference_)
+      {
+      }
+
+      const const_reference* operator ->() const
+      {
+        return &ref;
+      }
+
+    private:
+
+      const_reference ref;
+    };
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, value_type, ptrdiff_t, pointer, reference>
+    {
+    public:
+
+      friend class idense_flat_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_key(ETL_NULLPTR)
+        , p_mapped(ETL_NULLPTR)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        ++p_key;
+        ++p_mapped;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        --p_key;
+        --p_mapped;
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      iterator& operator +=(difference_type n)
+      {
+        p_key    += n;
+        p_mapped += n;
+        return *this;
+      }
+
+      iterator& operator -=(difference_type n)
+      {
+        p_key    -= n;
+        p_mapped -= n;
+        return *this;
+      }
+
+      reference operator *() const
+      {
+        return reference(*p_key, *p_mapped);
+      }
+
+      pointer operator ->() const
+      {
+        return pointer(**this);
+      }
+
+      reference operator [](difference_type n) const
+      {
+        return reference(p_key[n], p_mapped[n]);
+      }
+
+      /// The key of the element.
+      const key_type& key() const
+      {
+        return *p_key;
+      }
+
+      /// The mapped value of the element.
+      mapped_type& mapped() const
+      {
+        return *p_mapped;
+      }
+
+      friend iterator operator +(const iterator& lhs, difference_type n)
+      {
+        iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend iterator operator +(difference_type n, const iterator& rhs)
+      {
+        return rhs + n;
+      }
+
+      friend iterator operator -(const iterator& lhs, difference_type n)
+      {
+        iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend difference_type operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key - rhs.p_key;
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key == rhs.p_key;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key < rhs.p_key;
+      }
+
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      iterator(const key_type* p_key_, mapped_type* p_mapped_)
+        : p_key(p_key_)
+        , p_mapped(p_mapped_)
+      {
+      }
+
+      const key_type* p_key;
+      mapped_type*    p_mapped;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, value_type, ptrdiff_t, const_pointer, const_reference>
+    {
+    public:
+
+      friend class idense_flat_map;
+
+      const_iterator()
+        : p_key(ETL_NULLPTR)
+        , p_mapped(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const iterator& other)
+        : p_key(other.p_key)
+        , p_mapped(other.p_mapped)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        ++p_key;
+        ++p_mapped;
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        --p_key;
+        --p_mapped;
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_iterator& operator +=(difference_type n)
+      {
+        p_key    += n;
+        p_mapped += n;
+        return *this;
+      }
+
+      const_iterator& operator -=(difference_type n)
+      {
+        p_key    -= n;
+        p_mapped -= n;
+        return *this;
+      }
+
+      const_reference operator *() const
+      {
+        return const_reference(*p_key, *p_mapped);
+      }
+
+      const_pointer operator ->() const
+      {
+        return const_pointer(**this);
+      }
+
+      const_reference operator [](difference_type n) const
+      {
+        return const_reference(p_key[n], p_mapped[n]);
+      }
+
+      /// The key of the element.
+      const key_type& key() const
+      {
+        return *p_key;
+      }
+
+      /// The mapped value of the element.
+      const mapped_type& mapped() const
+      {
+        return *p_mapped;
+      }
+
+      friend const_iterator operator +(const const_iterator& lhs, difference_type n)
+      {
+        const_iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend const_iterator operator +(difference_type n, const const_iterator& rhs)
+      {
+        return rhs + n;
+      }
+
+      friend const_iterator operator -(const const_iterator& lhs, difference_type n)
+      {
+        const_iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend difference_type operator -(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key - rhs.p_key;
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key == rhs.p_key;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      friend bool operator <(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key < rhs.p_key;
+      }
+
+      friend bool operator >(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      friend bool operator <=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      friend bool operator >=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      const_iterator(const key_type* p_key_, const mapped_type* p_mapped_)
+        : p_key(p_key_)
+        , p_mapped(p_mapped_)
+      {
+      }
+
+      const key_type*    p_key;
+      const mapped_type* p_mapped;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the map.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(keys.data(), values.data());
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the map.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(keys.data(), values.data());
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the map.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(keys.data() + keys.size(), values.data() + values.size());
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the map.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(keys.data() + keys.size(), values.data() + values.size());
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the map.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the map.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the reverse beginning of the map.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the map.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the end + 1 of the map.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the end + 1 of the map.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the map.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return rbegin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the end + 1 of the map.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return rend();
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at the key.
+    /// Inserts a default constructed value if the key does not exist.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the key is new and the map is full.
+    ///\param key The key.
+    //*************************************************************************
+    mapped_type& operator [](const key_type& key)
+    {
+      iterator i_element = lower_bound(key);
+
+      if ((i_element == end()) || compare(key, i_element.key()))
+      {
+        i_element = insert_value(i_element, key, mapped_type());
+      }
+
+      return i_element.mapped();
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at the key.
+    /// If asserts or exceptions are enabled, emits an etl::dense_flat_map_out_of_bounds if the key is not in the map.
+    ///\param key The key.
+    //*************************************************************************
+    mapped_type& at(const key_type& key)
+    {
+      iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(dense_flat_map_out_of_bounds));
+
+      return i_element.mapped();
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at the key.
+    /// If asserts or exceptions are enabled, emits an etl::dense_flat_map_out_of_bounds if the key is not in the map.
+    ///\param key The key.
+    //*************************************************************************
+    const mapped_type& at(const key_type& key) const
+    {
+      const_iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(dense_flat_map_out_of_bounds));
+
+      return i_element.mapped();
+    }
+
+    //*********************************************************************
+    /// Assigns values to the map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const value_type& value)
+    {
+      iterator i_element = lower_bound(value.first);
+
+      if ((i_element == end()) || compare(value.first, i_element.key()))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(insert_value(i_element, value.first, value.second), true);
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves a value to the map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& value)
+    {
+      iterator i_element = lower_bound(value.first);
+
+      if ((i_element == end()) || compare(value.first, i_element.key()))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(insert_value(i_element, etl::move(value.first), etl::move(value.second)), true);
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the map is already full.
+    ///\param position The position hint. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const value_type& value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is only constructed if the key does not already exist.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the map is already full.
+    //*************************************************************************
+    template <typename... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(const key_type& key, Args&&... args)
+    {
+      iterator i_element = lower_bound(key);
+
+      if ((i_element == end()) || compare(key, i_element.key()))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(insert_value(i_element, key, etl::forward<Args>(args)...), true);
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const key_type& key)
+    {
+      iterator i_element = find(key);
+
+      if (i_element == end())
+      {
+        return 0U;
+      }
+
+      erase(i_element);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the next element.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      return erase(i_element, i_element + 1);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element following the last erased.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      const size_t index = static_cast<size_t>(first - cbegin());
+      const size_t count = static_cast<size_t>(last - first);
+
+      keys.erase(keys.begin() + index, keys.begin() + index + count);
+      values.erase(values.begin() + index, values.begin() + index + count);
+
+      return begin() + difference_type(index);
+    }
+
+    //*************************************************************************
+    /// Clears the map.
+    //*************************************************************************
+    void clear()
+    {
+      keys.clear();
+      values.clear();
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(const key_type& key)
+    {
+      iterator i_element = lower_bound(key);
+
+      if ((i_element != end()) && !compare(key, i_element.key()))
+      {
+        return i_element;
+      }
+
+      return end();
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      const_iterator i_element = lower_bound(key);
+
+      if ((i_element != end()) && !compare(key, i_element.key()))
+      {
+        return i_element;
+      }
+
+      return end();
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains an element with key.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return find(key) != end();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(const key_type& key)
+    {
+      return begin() + key_lower_bound(key);
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(const key_type& key) const
+    {
+      return begin() + key_lower_bound(key);
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(const key_type& key)
+    {
+      return begin() + key_upper_bound(key);
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(const key_type& key) const
+    {
+      return begin() + key_upper_bound(key);
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const key_type& key)
+    {
+      return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Gets the size of the map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return keys.size();
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the map.
+    //*************************************************************************
+    bool empty() const
+    {
+      return keys.empty();
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the map.
+    //*************************************************************************
+    bool full() const
+    {
+      return keys.full();
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return keys.capacity();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return keys.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return keys.available();
+    }
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous array of sorted keys.
+    //*************************************************************************
+    const key_type* key_data() const
+    {
+      return keys.data();
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    idense_flat_map(etl::ivector<key_type>& keys_, etl::ivector<mapped_type>& values_)
+      : keys(keys_)
+      , values(values_)
+    {
+    }
+
+    //*************************************************************************
+    /// Moves the elements of another map.
+    //*************************************************************************
+#if ETL_USING_CPP11
+    void move_container(idense_flat_map&& other)
+    {
+      clear();
+
+      for (size_t i = 0U; i < other.size(); ++i)
+      {
+        keys.push_back(etl::move(other.keys[i]));
+        values.push_back(etl::move(other.values[i]));
+      }
+
+      other.clear();
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// The index of the first key not less than the key.
+    /// Only the key array is searched.
+    //*********************************************************************
+    difference_type key_lower_bound(const key_type& key) const
+    {
+      return private_algorithm::key_lower_bound<key_type, key_compare>(keys.begin(), keys.end(), key, compare) - keys.begin();
+    }
+
+    //*********************************************************************
+    /// The index of the first key greater than the key.
+    /// Only the key array is searched.
+    //*********************************************************************
+    difference_type key_upper_bound(const key_type& key) const
+    {
+      return private_algorithm::key_upper_bound<key_type, key_compare>(keys.begin(), keys.end(), key, compare) - keys.begin();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a new element at the position.
+    //*********************************************************************
+    template <typename TKeyParameter, typename... TArgs>
+    iterator insert_value(iterator position, TKeyParameter&& key, TArgs&&... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(dense_flat_map_full));
+
+      const difference_type index = position - begin();
+
+      keys.emplace(keys.begin() + index, etl::forward<TKeyParameter>(key));
+      values.emplace(values.begin() + index, etl::forward<TArgs>(args)...);
+
+      return begin() + index;
+    }
+#else
+    //*********************************************************************
+    /// Inserts a new element at the position.
+    //*********************************************************************
+    iterator insert_value(iterator position, const key_type& key, const mapped_type& value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(dense_flat_map_full));
+
+      const difference_type index = position - begin();
+
+      keys.insert(keys.begin() + index, key);
+      values.insert(values.begin() + index, value);
+
+      return begin() + index;
+    }
+#endif
+
+    // Disable copy construction.
+    idense_flat_map(const idense_flat_map&);
+
+    etl::ivector<key_type>&    keys;   ///< The sorted keys.
+    etl::ivector<mapped_type>& values; ///< The mapped values, in the same order as the keys.
+    key_compare                compare;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_DENSE_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~idense_flat_map()
+    {
+    }
+#else
+  protected:
+    ~idense_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first map.
+  ///\param rhs Reference to the second map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::idense_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::idense_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typename etl::idense_flat_map<TKey, TMapped, TKeyCompare>::const_iterator l = lhs.begin();
+    typename etl::idense_flat_map<TKey, TMapped, TKeyCompare>::const_iterator r = rhs.begin();
+
+    while (l != lhs.end())
+    {
+      if (!(l.key() == r.key()) || !(l.mapped() == r.mapped()))
+      {
+        return false;
+      }
+
+      ++l;
+      ++r;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first map.
+  ///\param rhs Reference to the second map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::idense_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::idense_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A dense_flat_map implementation that uses a fixed size buffer.
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The mapped type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class dense_flat_map : public etl::idense_flat_map<TKey, TValue, TCompare>
+  {
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    dense_flat_map()
+      : etl::idense_flat_map<TKey, TValue, TCompare>(key_storage, value_storage)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    dense_flat_map(const dense_flat_map& other)
+      : etl::idense_flat_map<TKey, TValue, TCompare>(key_storage, value_storage)
+      , key_storage(other.key_storage)
+      , value_storage(other.value_storage)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    dense_flat_map(dense_flat_map&& other)
+      : etl::idense_flat_map<TKey, TValue, TCompare>(key_storage, value_storage)
+    {
+      this->move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    dense_flat_map(TIterator first, TIterator last)
+      : etl::idense_flat_map<TKey, TValue, TCompare>(key_storage, value_storage)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    dense_flat_map(std::initializer_list<typename etl::idense_flat_map<TKey, TValue, TCompare>::value_type> init)
+      : etl::idense_flat_map<TKey, TValue, TCompare>(key_storage, value_storage)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~dense_flat_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    dense_flat_map& operator = (const dense_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        key_storage   = rhs.key_storage;
+        value_storage = rhs.value_storage;
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    dense_flat_map& operator = (dense_flat_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The sorted keys.
+    etl::vector<TKey, MAX_SIZE> key_storage;
+
+    /// The mapped values.
+    etl::vector<TValue, MAX_SIZE> value_storage;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t dense_flat_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+}
+
+#endif
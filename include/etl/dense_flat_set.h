@@ -0,0 +1,642 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DENSE_FLAT_SET_INCLUDED
+#define ETL_DENSE_FLAT_SET_INCLUDED
+
+#include "platform.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "vector.h"
+#include "functional.h"
+#include "iterator.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "initializer_list.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup dense_flat_set dense_flat_set
+/// A flat_set with the capacity defined at compile time, that stores the
+/// values directly in a sorted contiguous array.
+/// Searches touch only the value array, with no indirection.
+/// Insertion and erasure move the elements that follow.
+/// Has insertion of O(N) and find of O(logN)
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup dense_flat_set
+  /// Exception base for dense_flat_set
+  //***************************************************************************
+  class dense_flat_set_exception : public etl::exception
+  {
+  public:
+
+    dense_flat_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup dense_flat_set
+  /// Full exception.
+  //***************************************************************************
+  class dense_flat_set_full : public dense_flat_set_exception
+  {
+  public:
+
+    dense_flat_set_full(string_type file_name_, numeric_type line_number_)
+      : dense_flat_set_exception(ETL_ERROR_TEXT("dense_flat_set:full", ETL_DENSE_FLAT_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized dense_flat_sets.
+  /// Can be used as a reference type for all dense_flat_sets containing a specific type.
+  ///\ingroup dense_flat_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare = etl::less<T> >
+  class idense_flat_set
+  {
+  public:
+
+    typedef T                 key_type;
+    typedef T                 value_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    /// The values may not be modified in place, as that would break the ordering.
+    typedef const value_type*                            iterator;
+    typedef const value_type*                            const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the set.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return storage.data();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the set.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return storage.data() + storage.size();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the set.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the set.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the set.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the set.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the set.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return rbegin();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the set.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return rend();
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous array of sorted values.
+    //*************************************************************************
+    const value_type* data() const
+    {
+      return storage.data();
+    }
+
+    //*********************************************************************
+    /// Assigns values to the set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      iterator i_element = lower_bound(value);
+
+      if ((i_element == end()) || compare(value, *i_element))
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(dense_flat_set_full));
+
+        const difference_type index = i_element - begin();
+        storage.insert(storage.begin() + index, value);
+
+        return ETL_OR_STD::pair<iterator, bool>(begin() + index, true);
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves a value to the set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& value)
+    {
+      iterator i_element = lower_bound(value);
+
+      if ((i_element == end()) || compare(value, *i_element))
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(dense_flat_set_full));
+
+        const difference_type index = i_element - begin();
+        storage.insert(storage.begin() + index, etl::move(value));
+
+        return ETL_OR_STD::pair<iterator, bool>(begin() + index, true);
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(i_element, false);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the set is already full.
+    ///\param position The position hint. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the set is already full.
+    //*************************************************************************
+    template <typename... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(Args&&... args)
+    {
+      return insert(value_type(etl::forward<Args>(args)...));
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_reference key)
+    {
+      iterator i_element = find(key);
+
+      if (i_element == end())
+      {
+        return 0U;
+      }
+
+      erase(i_element);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the next element.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      return erase(i_element, i_element + 1);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element following the last erased.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      const difference_type index = first - begin();
+      const difference_type count = last - first;
+
+      storage.erase(storage.begin() + index, storage.begin() + index + count);
+
+      return begin() + index;
+    }
+
+    //*************************************************************************
+    /// Clears the set.
+    //*************************************************************************
+    void clear()
+    {
+      storage.clear();
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_reference key) const
+    {
+      const_iterator i_element = lower_bound(key);
+
+      if ((i_element != end()) && !compare(key, *i_element))
+      {
+        return i_element;
+      }
+
+      return end();
+    }
+
+    //*************************************************************************
+    /// Checks if the set contains an element with key.
+    //*************************************************************************
+    bool contains(const_reference key) const
+    {
+      return find(key) != end();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_reference key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(const_reference key) const
+    {
+      return private_algorithm::key_lower_bound<key_type, key_compare>(begin(), end(), key, compare);
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(const_reference key) const
+    {
+      return private_algorithm::key_upper_bound<key_type, key_compare>(begin(), end(), key, compare);
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_reference key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Gets the size of the set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return storage.size();
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the set.
+    //*************************************************************************
+    bool empty() const
+    {
+      return storage.empty();
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the set.
+    //*************************************************************************
+    bool full() const
+    {
+      return storage.full();
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the set.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return storage.capacity();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return storage.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return storage.available();
+    }
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return compare;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    idense_flat_set(etl::ivector<value_type>& storage_)
+      : storage(storage_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    idense_flat_set(const idense_flat_set&);
+
+    etl::ivector<value_type>& storage; ///< The sorted values.
+    key_compare               compare;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_DENSE_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~idense_flat_set()
+    {
+    }
+#else
+  protected:
+    ~idense_flat_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first set.
+  ///\param rhs Reference to the second set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup dense_flat_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator ==(const etl::idense_flat_set<T, TKeyCompare>& lhs, const etl::idense_flat_set<T, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first set.
+  ///\param rhs Reference to the second set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup dense_flat_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator !=(const etl::idense_flat_set<T, TKeyCompare>& lhs, const etl::idense_flat_set<T, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A dense_flat_set implementation that uses a fixed size buffer.
+  ///\tparam T         The value type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<T>
+  ///\ingroup dense_flat_set
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = etl::less<T> >
+  class dense_flat_set : public etl::idense_flat_set<T, TCompare>
+  {
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    dense_flat_set()
+      : etl::idense_flat_set<T, TCompare>(storage)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    dense_flat_set(const dense_flat_set& other)
+      : etl::idense_flat_set<T, TCompare>(storage)
+      , storage(other.storage)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    dense_flat_set(dense_flat_set&& other)
+      : etl::idense_flat_set<T, TCompare>(storage)
+      , storage(etl::move(other.storage))
+    {
+      other.clear();
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    dense_flat_set(TIterator first, TIterator last)
+      : etl::idense_flat_set<T, TCompare>(storage)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    dense_flat_set(std::initializer_list<T> init)
+      : etl::idense_flat_set<T, TCompare>(storage)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~dense_flat_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    dense_flat_set& operator = (const dense_flat_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        storage = rhs.storage;
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    dense_flat_set& operator = (dense_flat_set&& rhs)
+    {
+      if (&rhs != this)
+      {
+        storage = etl::move(rhs.storage);
+        rhs.clear();
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The sorted values.
+    etl::vector<T, MAX_SIZE> storage;
+  };
+
+  template <typename T, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t dense_flat_set<T, MAX_SIZE_, TCompare>::MAX_SIZE;
+}
+
+#endif
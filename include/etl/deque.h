@@ -39,6 +39,7 @@ SOFTWARE.
 #include "exception.h"
 #include "error_handler.h"
 #include "debug_count.h"
+#include "container_statistics.h"
 #include "algorithm.h"
 #include "type_traits.h"
 #include "placement_new.h"
@@ -998,6 +999,8 @@ namespace etl
     //*************************************************************************
     iterator insert(const_iterator insert_position, const value_type& value)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       iterator position(to_iterator(insert_position));
 
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1012,6 +1015,11 @@ namespace etl
         create_element_back(value);
         position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        ::new (etl::addressof(*position)) T(value);
+      }
       else
       {
         // Are we closer to the front?
@@ -1051,6 +1059,8 @@ namespace etl
     //*************************************************************************
     iterator insert(const_iterator insert_position, value_type&& value)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       iterator position(insert_position.index, *this, p_buffer);
 
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1065,6 +1075,11 @@ namespace etl
         create_element_back(etl::move(value));
         position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        ::new (etl::addressof(*position)) T(etl::move(value));
+      }
       else
       {
         // Are we closer to the front?
@@ -1105,6 +1120,8 @@ namespace etl
     template <typename ... Args>
     iterator emplace(const_iterator insert_position, Args && ... args)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       iterator position(insert_position.index, *this, p_buffer);
 
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1127,6 +1144,11 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
           position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        p = etl::addressof(*position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1172,6 +1194,8 @@ namespace etl
     template <typename T1>
     iterator emplace(const_iterator insert_position, const T1& value1)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       iterator position(insert_position.index, *this, p_buffer);
 
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1194,6 +1218,11 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
           position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        p = etl::addressof(*position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1237,6 +1266,8 @@ namespace etl
     template <typename T1, typename T2>
     iterator emplace(const_iterator insert_position, const T1& value1, const T2& value2)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       iterator position(insert_position.index, *this, p_buffer);
 
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1259,6 +1290,11 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
           position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        p = etl::addressof(*position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1302,6 +1338,8 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     iterator emplace(const_iterator insert_position, const T1& value1, const T2& value2, const T3& value3)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       iterator position(insert_position.index, *this, p_buffer);
 
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1324,6 +1362,11 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
           position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        p = etl::addressof(*position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1367,6 +1410,8 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     iterator emplace(const_iterator insert_position, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       iterator position(insert_position.index, *this, p_buffer);
 
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1389,6 +1434,11 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
           position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        p = etl::addressof(*position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1434,6 +1484,8 @@ namespace etl
     //*************************************************************************
     iterator insert(const_iterator insert_position, size_type n, const value_type& value)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       iterator position;
 
       ETL_ASSERT((current_size + n) <= CAPACITY, ETL_ERROR(deque_full));
@@ -1456,6 +1508,18 @@ namespace etl
 
         position = _end - n;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(iterator(insert_position.index, *this, p_buffer), n);
+
+        iterator item = position;
+
+        for (size_t i = 0UL; i < n; ++i)
+        {
+          ::new (etl::addressof(*item)) T(value);
+          ++item;
+        }
+      }
       else
       {
         // Non-const insert iterator.
@@ -1553,6 +1617,8 @@ namespace etl
 
       if (insert_position == begin())
       {
+        ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
         create_element_front(n, range_begin);
 
         position = _begin;
@@ -1567,6 +1633,19 @@ namespace etl
 
         position = _end - n;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(iterator(insert_position.index, *this, p_buffer), size_type(n));
+
+        iterator item = position;
+
+        while (range_begin != range_end)
+        {
+          ::new (etl::addressof(*item)) T(*range_begin);
+          ++item;
+          ++range_begin;
+        }
+      }
       else
       {
         // Non-const insert iterator.
@@ -1649,6 +1728,8 @@ namespace etl
     //*************************************************************************
     iterator erase(const_iterator erase_position)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
       iterator position(to_iterator(erase_position));
       //iterator position(erase_position.index, *this, p_buffer);
 
@@ -1664,6 +1745,11 @@ namespace etl
         destroy_element_back();
         position = end();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        (*position).~T();
+        position = close_gap(position, 1U);
+      }
       else
       {
         // Are we closer to the front?
@@ -1691,6 +1777,8 @@ namespace etl
     //*************************************************************************
     iterator erase(const_iterator range_begin, const_iterator range_end)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
       iterator position(to_iterator(range_begin));
 
       ETL_ASSERT((distance(range_begin) <= difference_type(current_size)) && (distance(range_end) <= difference_type(current_size)), ETL_ERROR(deque_out_of_bounds));
@@ -1718,6 +1806,18 @@ namespace etl
 
         position = end();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        iterator item = position;
+
+        for (size_t i = 0UL; i < length; ++i)
+        {
+          (*item).~T();
+          ++item;
+        }
+
+        position = close_gap(position, length);
+      }
       else
       {
         // Copy the smallest number of items.
@@ -1757,6 +1857,8 @@ namespace etl
     //*************************************************************************
     void push_back(const_reference item)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1771,6 +1873,8 @@ namespace etl
     //*************************************************************************
     void push_back(rvalue_reference item)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1786,6 +1890,8 @@ namespace etl
     template <typename ... Args>
     reference emplace_back(Args && ... args)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1805,6 +1911,8 @@ namespace etl
     //*************************************************************************
     reference emplace_back()
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1823,6 +1931,8 @@ namespace etl
     template <typename T1>
     reference emplace_back(const T1& value1)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1841,6 +1951,8 @@ namespace etl
     template <typename T1, typename T2>
     reference emplace_back(const T1& value1, const T2& value2)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1859,6 +1971,8 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     reference emplace_back(const T1& value1, const T2& value2, const T3& value3)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1877,6 +1991,8 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     reference emplace_back(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1894,6 +2010,8 @@ namespace etl
     //*************************************************************************
     void pop_back()
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!empty(), ETL_ERROR(deque_empty));
 #endif
@@ -1907,6 +2025,8 @@ namespace etl
     //*************************************************************************
     void push_front(const_reference item)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1921,6 +2041,8 @@ namespace etl
     //*************************************************************************
     void push_front(rvalue_reference item)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1936,6 +2058,8 @@ namespace etl
     template <typename ... Args>
     reference emplace_front(Args && ... args)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1955,6 +2079,8 @@ namespace etl
     //*************************************************************************
     reference emplace_front()
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1973,6 +2099,8 @@ namespace etl
     template <typename T1>
     reference emplace_front(const T1& value1)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -1991,6 +2119,8 @@ namespace etl
     template <typename T1, typename T2>
     reference emplace_front(const T1& value1, const T2& value2)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -2009,6 +2139,8 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     reference emplace_front(const T1& value1, const T2& value2, const T3& value3)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -2027,6 +2159,8 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     reference emplace_front(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
 #endif
@@ -2044,6 +2178,8 @@ namespace etl
     //*************************************************************************
     void pop_front()
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!empty(), ETL_ERROR(deque_empty));
 #endif
@@ -2139,6 +2275,24 @@ namespace etl
     virtual void repair() = 0;
 #endif
 
+#if ETL_HAS_CONTAINER_STATISTICS
+    //*************************************************************************
+    /// Gets the operation statistics.
+    //*************************************************************************
+    etl::container_statistics& get_statistics()
+    {
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Gets the operation statistics.
+    //*************************************************************************
+    const etl::container_statistics& get_statistics() const
+    {
+      return statistics;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -2304,6 +2458,105 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+    //*********************************************************************
+    /// Opens an uninitialised gap of n elements before position, by
+    /// relocating the elements on the shorter side of it.
+    /// For trivially relocatable types.
+    ///\return An iterator to the start of the gap.
+    //*********************************************************************
+    iterator open_gap(iterator position, size_type n)
+    {
+      const size_type n_front = size_type(distance(_begin, position));
+      const size_type n_back  = current_size - n_front;
+
+      if (n_front < n_back)
+      {
+        iterator from = _begin;
+        _begin -= difference_type(n);
+        relocate_forward(from, _begin, n_front);
+        position -= difference_type(n);
+      }
+      else
+      {
+        relocate_backward(_end, _end + difference_type(n), n_back);
+        _end += difference_type(n);
+      }
+
+      current_size += n;
+      ETL_ADD_DEBUG_COUNT(n);
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Closes a gap of n destroyed elements at position, by relocating
+    /// the elements on the shorter side of it.
+    /// For trivially relocatable types.
+    ///\return An iterator to the element that followed the gap.
+    //*********************************************************************
+    iterator close_gap(iterator position, size_type n)
+    {
+      const size_type n_front = size_type(distance(_begin, position));
+      const size_type n_back  = current_size - n_front - n;
+
+      current_size -= n;
+      ETL_SUBTRACT_DEBUG_COUNT(n);
+
+      if (n_front < n_back)
+      {
+        relocate_backward(position, position + difference_type(n), n_front);
+        _begin += difference_type(n);
+
+        return position + difference_type(n);
+      }
+      else
+      {
+        relocate_forward(position + difference_type(n), position, n_back);
+        _end -= difference_type(n);
+
+        return position;
+      }
+    }
+
+    //*********************************************************************
+    /// Relocates n elements from 'from' to the lower position 'to'.
+    /// Each run that is contiguous in both ranges is relocated in one step.
+    //*********************************************************************
+    void relocate_forward(iterator from, iterator to, size_type n)
+    {
+      while (n != 0U)
+      {
+        size_type run = etl::min(n, BUFFER_SIZE - size_type(from.index));
+        run = etl::min(run, BUFFER_SIZE - size_type(to.index));
+
+        etl::uninitialized_relocate(p_buffer + from.index, p_buffer + from.index + run, p_buffer + to.index);
+
+        from += difference_type(run);
+        to   += difference_type(run);
+        n    -= run;
+      }
+    }
+
+    //*********************************************************************
+    /// Relocates the n elements that end at 'from_end' to end at the higher position 'to_end'.
+    /// Each run that is contiguous in both ranges is relocated in one step.
+    //*********************************************************************
+    void relocate_backward(iterator from_end, iterator to_end, size_type n)
+    {
+      while (n != 0U)
+      {
+        size_type run = etl::min(n, (from_end.index == 0) ? BUFFER_SIZE : size_type(from_end.index));
+        run = etl::min(run, (to_end.index == 0) ? BUFFER_SIZE : size_type(to_end.index));
+
+        from_end -= difference_type(run);
+        to_end   -= difference_type(run);
+
+        etl::uninitialized_relocate(p_buffer + from_end.index, p_buffer + from_end.index + run, p_buffer + to_end.index);
+
+        n -= run;
+      }
+    }
+
     //*************************************************************************
     /// Measures the distance between two iterators.
     //*************************************************************************
@@ -2347,6 +2600,10 @@ namespace etl
     // Disable copy construction.
     ideque(const ideque&);
 
+#if ETL_HAS_CONTAINER_STATISTICS
+    etl::container_statistics statistics; ///< The operation statistics.
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -0,0 +1,412 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EPOCH_RECLAIMER_INCLUDED
+#define ETL_EPOCH_RECLAIMER_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "ipool.h"
+#include "imemory_block_allocator.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "cache_aligned.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception for an epoch reclaimer.
+  //***************************************************************************
+  class epoch_reclaimer_exception : public exception
+  {
+  public:
+
+    epoch_reclaimer_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for a thread that is not registered.
+  //***************************************************************************
+  class epoch_reclaimer_invalid_thread : public epoch_reclaimer_exception
+  {
+  public:
+
+    epoch_reclaimer_invalid_thread(string_type file_name_, numeric_type line_number_)
+      : epoch_reclaimer_exception(ETL_ERROR_TEXT("epoch_reclaimer:invalid thread", ETL_EPOCH_RECLAIMER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Epoch based reclamation of the nodes of lock free structures.
+  /// A thread reads shared nodes only between enter() and exit(). A node that
+  /// has been unlinked is retired, tagged with the global epoch, and released
+  /// once the epoch has advanced twice since, as by then every thread that
+  /// could have read it has exited.
+  /// The epoch advances when every thread inside has entered at the current
+  /// epoch, so a thread that stays inside holds back all reclamation.
+  /// Each thread has its own list of retired nodes, so retiring and reclaiming
+  /// never lock. Nodes are released from the thread that retired them, so the
+  /// pool or allocator must be safe to release to from that thread.
+  ///\tparam MAX_THREADS The maximum number of registered threads.
+  ///\tparam MAX_RETIRED The number of retired nodes each thread may hold.
+  //***************************************************************************
+  template <size_t MAX_THREADS, size_t MAX_RETIRED>
+  class epoch_reclaimer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_THREADS != 0U, "MAX_THREADS must not be zero");
+    ETL_STATIC_ASSERT(MAX_RETIRED != 0U, "MAX_RETIRED must not be zero");
+
+    typedef size_t thread_id;
+
+    /// Releases a retired object.
+    typedef void (*release_function)(void* p_context, void* p_object);
+
+    static ETL_CONSTANT size_t    Max_Threads = MAX_THREADS;
+    static ETL_CONSTANT size_t    Max_Retired = MAX_RETIRED;
+    static ETL_CONSTANT thread_id No_Thread   = MAX_THREADS;
+
+    //*************************************************************************
+    /// Enters on construction and exits on destruction.
+    //*************************************************************************
+    class guard
+    {
+    public:
+
+      guard(epoch_reclaimer& reclaimer_, thread_id id_)
+        : reclaimer(reclaimer_)
+        , id(id_)
+      {
+        reclaimer.enter(id);
+      }
+
+      ~guard()
+      {
+        reclaimer.exit(id);
+      }
+
+    private:
+
+      guard(const guard&) ETL_DELETE;
+      guard& operator=(const guard&) ETL_DELETE;
+
+      epoch_reclaimer& reclaimer;
+      thread_id        id;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    epoch_reclaimer()
+      : global_epoch(0U)
+    {
+      for (size_t i = 0U; i < MAX_THREADS; ++i)
+      {
+        threads[i]->registered.store(0U, etl::memory_order_relaxed);
+        threads[i]->state.store(0U, etl::memory_order_relaxed);
+        threads[i]->count = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Registers a thread.
+    /// Nodes retired by an earlier thread with the same id, and not yet
+    /// released, are taken over.
+    ///\return The thread's id, or No_Thread if MAX_THREADS are registered.
+    //*************************************************************************
+    thread_id register_thread()
+    {
+      for (thread_id id = 0U; id < MAX_THREADS; ++id)
+      {
+        uint_least8_t expected = 0U;
+
+        if (threads[id]->registered.compare_exchange_strong(expected, 1U, etl::memory_order_acquire))
+        {
+          return id;
+        }
+      }
+
+      return No_Thread;
+    }
+
+    //*************************************************************************
+    /// Unregisters a thread, which must be outside.
+    /// Its retired nodes are kept for the next thread with the id.
+    //*************************************************************************
+    void unregister_thread(thread_id id)
+    {
+      ETL_ASSERT_OR_RETURN(is_registered(id), ETL_ERROR(epoch_reclaimer_invalid_thread));
+
+      threads[id]->state.store(0U, etl::memory_order_release);
+      threads[id]->registered.store(0U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the id is a registered thread.
+    //*************************************************************************
+    bool is_registered(thread_id id) const
+    {
+      return (id < MAX_THREADS) && (threads[id]->registered.load(etl::memory_order_acquire) != 0U);
+    }
+
+    //*************************************************************************
+    /// Enters, before reading shared nodes. Must not be nested.
+    //*************************************************************************
+    void enter(thread_id id)
+    {
+      ETL_ASSERT_OR_RETURN(is_registered(id), ETL_ERROR(epoch_reclaimer_invalid_thread));
+
+      // Sequentially consistent, so the thread is seen inside before any of
+      // its reads of shared nodes.
+      threads[id]->state.store(global_epoch.load(etl::memory_order_seq_cst) | Inside, etl::memory_order_seq_cst);
+    }
+
+    //*************************************************************************
+    /// Exits, after the last read of shared nodes.
+    //*************************************************************************
+    void exit(thread_id id)
+    {
+      ETL_ASSERT_OR_RETURN(is_registered(id), ETL_ERROR(epoch_reclaimer_invalid_thread));
+
+      threads[id]->state.store(0U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Retires an unlinked object, to be released by calling release.
+    /// If the thread's list is full, reclaims first.
+    ///\return <b>false</b> if the list is still full. The object is not retired.
+    //*************************************************************************
+    bool retire(thread_id id, void* p_object, release_function release, void* p_context)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(is_registered(id), ETL_ERROR(epoch_reclaimer_invalid_thread), false);
+
+      thread_data& thread = *threads[id];
+
+      if (thread.count == MAX_RETIRED)
+      {
+        reclaim(id);
+
+        if (thread.count == MAX_RETIRED)
+        {
+          return false;
+        }
+      }
+
+      retired& item = thread.retired_list[thread.count];
+      item.p_object  = p_object;
+      item.release   = release;
+      item.p_context = p_context;
+      item.epoch     = global_epoch.load(etl::memory_order_seq_cst);
+
+      ++thread.count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Retires an unlinked object, to be destroyed and released to its pool.
+    ///\return <b>false</b> if the list is full. The object is not retired.
+    //*************************************************************************
+    template <typename T>
+    bool retire(thread_id id, T* p_object, etl::ipool& pool)
+    {
+      return retire(id, static_cast<void*>(p_object), &destroy_in_pool<T>, &pool);
+    }
+
+    //*************************************************************************
+    /// Retires an unlinked block, to be released to its allocator.
+    ///\return <b>false</b> if the list is full. The block is not retired.
+    //*************************************************************************
+    bool retire(thread_id id, void* p_block, etl::imemory_block_allocator& allocator)
+    {
+      return retire(id, p_block, &release_to_allocator, &allocator);
+    }
+
+    //*************************************************************************
+    /// Tries to advance the epoch, then releases the thread's retired objects
+    /// that no thread can still be reading.
+    ///\return The number of objects released.
+    //*************************************************************************
+    size_t reclaim(thread_id id)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(is_registered(id), ETL_ERROR(epoch_reclaimer_invalid_thread), 0U);
+
+      try_advance();
+
+      const uint32_t current = global_epoch.load(etl::memory_order_acquire);
+
+      thread_data& thread   = *threads[id];
+      size_t       kept     = 0U;
+      size_t       released = 0U;
+
+      for (size_t i = 0U; i < thread.count; ++i)
+      {
+        retired& item = thread.retired_list[i];
+
+        if (((current - item.epoch) & Epoch_Mask) >= 2U)
+        {
+          item.release(item.p_context, item.p_object);
+          ++released;
+        }
+        else
+        {
+          thread.retired_list[kept++] = item;
+        }
+      }
+
+      thread.count = kept;
+
+      return released;
+    }
+
+    //*************************************************************************
+    /// Gets the number of objects the thread has retired and not yet released.
+    //*************************************************************************
+    size_t retired_count(thread_id id) const
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(is_registered(id), ETL_ERROR(epoch_reclaimer_invalid_thread), 0U);
+
+      return threads[id]->count;
+    }
+
+    //*************************************************************************
+    /// Gets the global epoch.
+    //*************************************************************************
+    uint32_t epoch() const
+    {
+      return global_epoch.load(etl::memory_order_acquire);
+    }
+
+  private:
+
+    static ETL_CONSTANT uint32_t Inside     = 0x80000000UL;
+    static ETL_CONSTANT uint32_t Epoch_Mask = 0x7FFFFFFFUL;
+
+    //*************************************************************************
+    /// A retired object.
+    //*************************************************************************
+    struct retired
+    {
+      void*            p_object;
+      release_function release;
+      void*            p_context;
+      uint32_t         epoch;
+    };
+
+    //*************************************************************************
+    /// The state of a thread.
+    //*************************************************************************
+    struct thread_data
+    {
+      etl::atomic<uint_least8_t> registered;
+      etl::atomic<uint32_t>      state;                     ///< Inside | epoch, or zero when outside.
+      size_t                     count;                     ///< Owned by the thread.
+      retired                    retired_list[MAX_RETIRED]; ///< Owned by the thread.
+    };
+
+    //*************************************************************************
+    /// Each thread's state is on its own cache lines.
+    //*************************************************************************
+#if ETL_USING_CPP11 && !defined(ETL_COMPILER_ARM5)
+    typedef etl::cache_aligned<thread_data> thread_slot;
+#else
+    typedef etl::padded<thread_data> thread_slot;
+#endif
+
+    //*************************************************************************
+    /// Advances the epoch if every thread inside entered at the current epoch.
+    //*************************************************************************
+    void try_advance()
+    {
+      uint32_t current = global_epoch.load(etl::memory_order_seq_cst);
+
+      for (size_t i = 0U; i < MAX_THREADS; ++i)
+      {
+        const uint32_t state = threads[i]->state.load(etl::memory_order_seq_cst);
+
+        if (((state & Inside) != 0U) && ((state & Epoch_Mask) != current))
+        {
+          return;
+        }
+      }
+
+      global_epoch.compare_exchange_strong(current, (current + 1U) & Epoch_Mask, etl::memory_order_seq_cst);
+    }
+
+    //*************************************************************************
+    template <typename T>
+    static void destroy_in_pool(void* p_context, void* p_object)
+    {
+      static_cast<etl::ipool*>(p_context)->destroy(static_cast<T*>(p_object));
+    }
+
+    //*************************************************************************
+    static void release_to_allocator(void* p_context, void* p_object)
+    {
+      static_cast<etl::imemory_block_allocator*>(p_context)->release(p_object);
+    }
+
+    epoch_reclaimer(const epoch_reclaimer&) ETL_DELETE;
+    epoch_reclaimer& operator=(const epoch_reclaimer&) ETL_DELETE;
+
+    etl::atomic<uint32_t> global_epoch;
+    thread_slot           threads[MAX_THREADS];
+  };
+
+  template <size_t MAX_THREADS, size_t MAX_RETIRED>
+  ETL_CONSTANT size_t epoch_reclaimer<MAX_THREADS, MAX_RETIRED>::Max_Threads;
+
+  template <size_t MAX_THREADS, size_t MAX_RETIRED>
+  ETL_CONSTANT size_t epoch_reclaimer<MAX_THREADS, MAX_RETIRED>::Max_Retired;
+
+  template <size_t MAX_THREADS, size_t MAX_RETIRED>
+  ETL_CONSTANT typename epoch_reclaimer<MAX_THREADS, MAX_RETIRED>::thread_id epoch_reclaimer<MAX_THREADS, MAX_RETIRED>::No_Thread;
+
+  template <size_t MAX_THREADS, size_t MAX_RETIRED>
+  ETL_CONSTANT uint32_t epoch_reclaimer<MAX_THREADS, MAX_RETIRED>::Inside;
+
+  template <size_t MAX_THREADS, size_t MAX_RETIRED>
+  ETL_CONSTANT uint32_t epoch_reclaimer<MAX_THREADS, MAX_RETIRED>::Epoch_Mask;
+}
+
+#endif
+#endif
@@ -257,6 +257,31 @@ namespace etl
 }
 #endif
 
+#if defined(ETL_LOG_ERRORS)
+namespace etl
+{
+  namespace private_error_handler
+  {
+    //*************************************************************************
+    /// Passes an error to the handler.
+    /// Out of line and cold, so that each check costs only a compare and a
+    /// branch predicted not taken.
+    /// If the profile defines ETL_ERROR_HANDLER_TRAITS as a type with a static
+    /// 'void error(const etl::exception&)', that is called directly instead of
+    /// the run time callback set in etl::error_handler.
+    //*************************************************************************
+    ETL_COLD inline void log_error(const etl::exception& e)
+    {
+  #if defined(ETL_ERROR_HANDLER_TRAITS)
+      ETL_ERROR_HANDLER_TRAITS::error(e);
+  #else
+      etl::error_handler::error(e);
+  #endif
+    }
+  }
+}
+#endif
+
 //***************************************************************************
 /// Asserts a condition.
 /// Versions of the macro that return a constant value of 'true' will allow the compiler to optimise away
@@ -264,6 +289,7 @@ namespace etl
 /// If ETL_NO_CHECKS is defined then no runtime checks are executed at all.
 /// If asserts or exceptions are enabled then the error is thrown if the assert fails. The return value is always 'true'.
 /// If ETL_LOG_ERRORS is defined then the error is logged if the assert fails. The return value is the value of the boolean test.
+/// Failing checks are hinted as unlikely, and errors are logged through a cold, out of line function.
 /// Otherwise 'assert' is called. The return value is always 'true'.
 ///\ingroup error_handler
 //***************************************************************************
@@ -277,49 +303,49 @@ namespace etl
   #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) ETL_DO_NOTHING // Does nothing.
 #elif ETL_USING_EXCEPTIONS
   #if defined(ETL_LOG_ERRORS)
-    #define ETL_ASSERT(b, e) {if (!(b)) {etl::error_handler::error((e)); throw((e));}}                                // If the condition fails, calls the error handler then throws an exception.
-    #define ETL_ASSERT_OR_RETURN(b, e) {if (!(b)) {etl::error_handler::error((e)); throw((e)); return;}}              // If the condition fails, calls the error handler then throws an exception.
-    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (!(b)) {etl::error_handler::error((e)); throw((e)); return(v);}}  // If the condition fails, calls the error handler then throws an exception.
+    #define ETL_ASSERT(b, e) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {etl::private_error_handler::log_error((e)); throw((e));}}                               // If the condition fails, calls the error handler then throws an exception.
+    #define ETL_ASSERT_OR_RETURN(b, e) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {etl::private_error_handler::log_error((e)); throw((e)); return;}}             // If the condition fails, calls the error handler then throws an exception.
+    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {etl::private_error_handler::log_error((e)); throw((e)); return(v);}} // If the condition fails, calls the error handler then throws an exception.
     
-    #define ETL_ASSERT_FAIL(e) {etl::error_handler::error((e)); throw((e));}                                          // Calls the error handler then throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN(e) {etl::error_handler::error((e)); throw((e)); return;}                       // Calls the error handler then throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {etl::error_handler::error((e)); throw((e)); return(v);}           // Calls the error handler then throws an exception.
+    #define ETL_ASSERT_FAIL(e) {etl::private_error_handler::log_error((e)); throw((e));}                                                                        // Calls the error handler then throws an exception.
+    #define ETL_ASSERT_FAIL_AND_RETURN(e) {etl::private_error_handler::log_error((e)); throw((e)); return;}                                                     // Calls the error handler then throws an exception.
+    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {etl::private_error_handler::log_error((e)); throw((e)); return(v);}                                         // Calls the error handler then throws an exception.
   #else
-    #define ETL_ASSERT(b, e) {if (!(b)) {throw((e));}}                    // If the condition fails, throws an exception.
-    #define ETL_ASSERT_OR_RETURN(b, e) {if (!(b)) {throw((e));}}          // If the condition fails, throws an exception.
-    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (!(b)) {throw((e));}} // If the condition fails, throws an exception.
+    #define ETL_ASSERT(b, e) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {throw((e));}}                    // If the condition fails, throws an exception.
+    #define ETL_ASSERT_OR_RETURN(b, e) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {throw((e));}}          // If the condition fails, throws an exception.
+    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {throw((e));}} // If the condition fails, throws an exception.
     
-    #define ETL_ASSERT_FAIL(e) {throw((e));}                              // Throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN(e) {throw((e));}                   // Throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {throw((e));}          // Throws an exception.
+    #define ETL_ASSERT_FAIL(e) {throw((e));}                                                             // Throws an exception.
+    #define ETL_ASSERT_FAIL_AND_RETURN(e) {throw((e));}                                                  // Throws an exception.
+    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {throw((e));}                                         // Throws an exception.
 
   #endif
 #else
   #if defined(ETL_LOG_ERRORS)
-    #define ETL_ASSERT(b, e) {if(!(b)) {etl::error_handler::error((e));}}                                 // If the condition fails, calls the error handler
-    #define ETL_ASSERT_OR_RETURN(b, e) {if(!(b)) {etl::error_handler::error((e)); return;}}               // If the condition fails, calls the error handler and return
-    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if(!(b)) {etl::error_handler::error((e)); return (v);}}  // If the condition fails, calls the error handler and return a value
+    #define ETL_ASSERT(b, e) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {etl::private_error_handler::log_error((e));}}                                // If the condition fails, calls the error handler
+    #define ETL_ASSERT_OR_RETURN(b, e) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {etl::private_error_handler::log_error((e)); return;}}              // If the condition fails, calls the error handler and return
+    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {etl::private_error_handler::log_error((e)); return (v);}} // If the condition fails, calls the error handler and return a value
     
-    #define ETL_ASSERT_FAIL(e) {etl::error_handler::error((e));}                                          // Calls the error handler
-    #define ETL_ASSERT_FAIL_AND_RETURN(e) {etl::error_handler::error((e)); return;}                       // Calls the error handler and return
-    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {etl::error_handler::error((e)); return (v);}          // Calls the error handler and return a value
+    #define ETL_ASSERT_FAIL(e) {etl::private_error_handler::log_error((e));}                                                                         // Calls the error handler
+    #define ETL_ASSERT_FAIL_AND_RETURN(e) {etl::private_error_handler::log_error((e)); return;}                                                      // Calls the error handler and return
+    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {etl::private_error_handler::log_error((e)); return (v);}                                         // Calls the error handler and return a value
   #else
     #if ETL_IS_DEBUG_BUILD
-      #define ETL_ASSERT(b, e) assert((b))                                                                // If the condition fails, asserts.
-      #define ETL_ASSERT_OR_RETURN(b, e) {if (!(b)) {assert(false); return;}}                             // If the condition fails, asserts and return.
-      #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (!(b)) {assert(false); return(v);}}                 // If the condition fails, asserts and return a value.
+      #define ETL_ASSERT(b, e) assert((b))                                                                               // If the condition fails, asserts.
+      #define ETL_ASSERT_OR_RETURN(b, e) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {assert(false); return;}}             // If the condition fails, asserts and return.
+      #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (ETL_EXPECT_FALSE(!(b))) ETL_UNLIKELY {assert(false); return(v);}} // If the condition fails, asserts and return a value.
     
-      #define ETL_ASSERT_FAIL(e) assert(false)                                    // Asserts.
-      #define ETL_ASSERT_FAIL_AND_RETURN(e) {assert(false);  return;}             // Asserts.
-      #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {assert(false);  return(v);} // Asserts.
+      #define ETL_ASSERT_FAIL(e) assert(false)                                                                           // Asserts.
+      #define ETL_ASSERT_FAIL_AND_RETURN(e) {assert(false);  return;}                                                    // Asserts.
+      #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {assert(false);  return(v);}                                        // Asserts.
     #else
-      #define ETL_ASSERT(b, e)                                                    // Does nothing.
-      #define ETL_ASSERT_OR_RETURN(b, e) {if (!(b)) return;}                     // Returns.
-      #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (!(b)) return(v);}         // Returns a value.
+      #define ETL_ASSERT(b, e)                                                             // Does nothing.
+      #define ETL_ASSERT_OR_RETURN(b, e) {if (ETL_EXPECT_FALSE(!(b))) return;}             // Returns.
+      #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (ETL_EXPECT_FALSE(!(b))) return(v);} // Returns a value.
       
-      #define ETL_ASSERT_FAIL(e)                                                  // Does nothing.
-      #define ETL_ASSERT_FAIL_AND_RETURN(e) {return;}                             // Returns.
-      #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {return(v);}                 // Returns a value.
+      #define ETL_ASSERT_FAIL(e)                                                           // Does nothing.
+      #define ETL_ASSERT_FAIL_AND_RETURN(e) {return;}                                      // Returns.
+      #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {return(v);}                          // Returns a value.
     #endif
   #endif
 #endif
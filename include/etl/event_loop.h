@@ -0,0 +1,508 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EVENT_LOOP_INCLUDED
+#define ETL_EVENT_LOOP_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "bit.h"
+#include "delegate.h"
+#include "task.h"
+#include "timer.h"
+#include "callback_timer_wheel.h"
+#include "queue_spsc_atomic.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup event_loop event_loop
+/// A single integration point for event driven work.
+/// Owns a callback timer wheel and up to 32 sources, each either a handler
+/// or an etl::task. Sources are signalled from interrupts or other threads,
+/// and only signalled sources and expired timers are dispatched.
+/// When there is nothing to do the loop calls a platform 'wait' hook with the
+/// time to the next timer, so that it may sleep.
+///\code
+/// etl::event_loop<8, 4> loop(clock, wait);
+///
+/// etl::event_loop_source_t rx = loop.add_handler(on_rx);
+///
+/// void UART_IRQHandler() { loop.signal(rx); }
+///
+/// loop.run();
+///\endcode
+///\ingroup utilities
+
+namespace etl
+{
+  typedef uint_least8_t event_loop_source_t;
+
+  //***************************************************************************
+  /// The interface for event loops.
+  ///\ingroup event_loop
+  //***************************************************************************
+  class ievent_loop
+  {
+  public:
+
+    typedef etl::delegate<void(void)>     handler_type; ///< Handles a signalled source.
+    typedef etl::delegate<uint32_t(void)> clock_type;   ///< Returns a free running time, in timer ticks.
+    typedef etl::delegate<void(uint32_t)> wait_type;    ///< Sleeps until woken, or for up to the time given.
+    typedef etl::delegate<void(void)>     wake_type;    ///< Ends a wait early. May be called from an interrupt.
+
+    enum
+    {
+      No_Source = 255U ///< Returned when there are no free sources.
+    };
+
+    //*************************************************************************
+    /// Adds a source that calls the handler when signalled.
+    /// Returns its id, or No_Source if there are no free sources.
+    //*************************************************************************
+    event_loop_source_t add_handler(handler_type handler)
+    {
+      event_loop_source_t id = find_free_source();
+
+      if (id != No_Source)
+      {
+        p_sources[id].handler = handler;
+      }
+
+      return id;
+    }
+
+    //*************************************************************************
+    /// Adds a source that runs the task.
+    /// Call signal() with the returned id when the task is given work.
+    /// Each dispatch runs one task_process_work(), and the source stays
+    /// signalled while task_request_work() reports more.
+    /// Returns its id, or No_Source if there are no free sources.
+    //*************************************************************************
+    event_loop_source_t add_task(etl::task& task)
+    {
+      event_loop_source_t id = find_free_source();
+
+      if (id != No_Source)
+      {
+        p_sources[id].p_task = &task;
+        task.on_task_added();
+
+        // Give it a chance to report any work it already has.
+        pending.fetch_or(mask_of(id));
+      }
+
+      return id;
+    }
+
+    //*************************************************************************
+    /// Removes a source.
+    //*************************************************************************
+    void remove(event_loop_source_t id)
+    {
+      if (id < max_sources)
+      {
+        pending.fetch_and(~mask_of(id));
+        p_sources[id] = source();
+        used &= ~mask_of(id);
+      }
+    }
+
+    //*************************************************************************
+    /// Marks the source as ready and wakes the loop.
+    /// May be called from an interrupt or another thread.
+    //*************************************************************************
+    void signal(event_loop_source_t id)
+    {
+      if (id < max_sources)
+      {
+        pending.fetch_or(mask_of(id));
+        wake();
+      }
+    }
+
+    //*************************************************************************
+    /// Sets the hook that ends a wait early.
+    /// Not needed if the wait hook is ended by the signalling interrupt itself.
+    //*************************************************************************
+    void set_wake(wake_type wake_)
+    {
+      wake_hook = wake_;
+    }
+
+    //*************************************************************************
+    /// Gets the timer wheel, to register and start timers.
+    /// Timer callbacks are called from dispatch().
+    //*************************************************************************
+    etl::icallback_timer_wheel& timers()
+    {
+      return timer_wheel;
+    }
+
+    //*************************************************************************
+    /// Advances the timers to the clock, then handles the signalled sources,
+    /// in order of id. Does not wait.
+    /// Returns the number of sources dispatched.
+    //*************************************************************************
+    size_t dispatch()
+    {
+      tick_timers();
+
+      size_t count = 0U;
+
+      uint32_t ready = pending.exchange(0U);
+
+      while (ready != 0U)
+      {
+        const event_loop_source_t id   = event_loop_source_t(etl::countr_zero(ready));
+        const uint32_t            mask = mask_of(id);
+
+        ready &= ~mask;
+
+        source& s = p_sources[id];
+
+        if (s.p_task != ETL_NULLPTR)
+        {
+          if (s.p_task->task_is_running() && (s.p_task->task_request_work() > 0U))
+          {
+            s.p_task->task_process_work();
+            ++count;
+
+            if (s.p_task->task_request_work() > 0U)
+            {
+              // More to do, but let the others have a turn first.
+              pending.fetch_or(mask);
+            }
+          }
+        }
+        else if (s.handler.is_valid())
+        {
+          s.handler();
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Calls the wait hook, with the time to the next timer, if there are no
+    /// signalled sources and the loop has not been stopped.
+    //*************************************************************************
+    void wait()
+    {
+      if ((pending.load() == 0U) && !stopped.load() && wait_hook.is_valid())
+      {
+        wait_hook(time_to_next());
+      }
+    }
+
+    //*************************************************************************
+    /// Dispatches and waits until stop() is called.
+    //*************************************************************************
+    void run()
+    {
+      stopped.store(false);
+
+      while (!stopped.load())
+      {
+        dispatch();
+        wait();
+      }
+    }
+
+    //*************************************************************************
+    /// Ends run() after the current dispatch.
+    /// May be called from an interrupt or another thread.
+    //*************************************************************************
+    void stop()
+    {
+      stopped.store(true);
+      wake();
+    }
+
+    //*************************************************************************
+    /// Gets the time until the next timer is due, or
+    /// etl::timer::interval::No_Active_Interval if there is none.
+    //*************************************************************************
+    uint32_t time_to_next() const
+    {
+      if (!timer_wheel.has_active_timer())
+      {
+        return etl::timer::interval::No_Active_Interval;
+      }
+
+      uint32_t next    = timer_wheel.time_to_next();
+      uint32_t elapsed = clock.is_valid() ? (clock() - last_time) : 0U;
+
+      return (next > elapsed) ? (next - elapsed) : 0U;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if any source is signalled.
+    //*************************************************************************
+    bool has_pending() const
+    {
+      return pending.load() != 0U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A source of events.
+    //*************************************************************************
+    struct source
+    {
+      source()
+        : handler()
+        , p_task(ETL_NULLPTR)
+      {
+      }
+
+      handler_type handler;
+      etl::task*   p_task;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param clock_ Returns a free running time, in the units of the timers.
+    /// \param wait_  Sleeps until woken, or until the time given has passed.
+    ///               Must not miss a signal made just before it is called,
+    ///               such as by waiting on a counting semaphore, or checking a
+    ///               flag with interrupts disabled before sleeping.
+    //*************************************************************************
+    ievent_loop(source* p_sources_, size_t max_sources_, etl::icallback_timer_wheel& timer_wheel_, clock_type clock_, wait_type wait_)
+      : p_sources(p_sources_)
+      , max_sources(max_sources_)
+      , timer_wheel(timer_wheel_)
+      , clock(clock_)
+      , wait_hook(wait_)
+      , wake_hook()
+      , used(0U)
+      , last_time(clock_.is_valid() ? clock_() : 0U)
+    {
+      pending.store(0U);
+      stopped.store(false);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Advances the timers by the time since the last call.
+    //*************************************************************************
+    void tick_timers()
+    {
+      if (clock.is_valid())
+      {
+        const uint32_t now     = clock();
+        const uint32_t elapsed = now - last_time;
+
+        // Time passed while the timers are disabled is not carried over.
+        // If the tick could not be processed now, it is carried to the next.
+        if (!timer_wheel.is_running() || ((elapsed != 0U) && timer_wheel.tick(elapsed)))
+        {
+          last_time = now;
+        }
+      }
+    }
+
+    //*************************************************************************
+    void wake()
+    {
+      if (wake_hook.is_valid())
+      {
+        wake_hook();
+      }
+    }
+
+    //*************************************************************************
+    event_loop_source_t find_free_source()
+    {
+      for (size_t i = 0U; i < max_sources; ++i)
+      {
+        if ((used & mask_of(event_loop_source_t(i))) == 0U)
+        {
+          used |= mask_of(event_loop_source_t(i));
+          return event_loop_source_t(i);
+        }
+      }
+
+      return No_Source;
+    }
+
+    //*************************************************************************
+    static uint32_t mask_of(event_loop_source_t id)
+    {
+      return 1UL << id;
+    }
+
+    // Disable copy construction and assignment.
+    ievent_loop(const ievent_loop&) ETL_DELETE;
+    ievent_loop& operator =(const ievent_loop&) ETL_DELETE;
+
+    source* const               p_sources;
+    const size_t                max_sources;
+    etl::icallback_timer_wheel& timer_wheel;
+    clock_type                  clock;
+    wait_type                   wait_hook;
+    wake_type                   wake_hook;
+    uint32_t                    used;      ///< A bit for each source that is in use.
+    uint32_t                    last_time; ///< The clock when the timers were last advanced.
+    etl::atomic<uint32_t>       pending;   ///< A bit for each signalled source.
+    etl::atomic<bool>           stopped;
+  };
+
+  //***************************************************************************
+  /// An event loop.
+  ///\tparam Max_Sources The maximum number of handlers and tasks. No more than 32.
+  ///\tparam Max_Timers  The maximum number of timers.
+  ///\tparam Slots       The number of slots per level of the timer wheel.
+  ///\ingroup event_loop
+  //***************************************************************************
+  template <size_t Max_Sources, uint_least8_t Max_Timers, uint_least16_t Slots = 16U>
+  class event_loop : public etl::ievent_loop
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Sources <= 32U, "No more than 32 sources are allowed");
+    ETL_STATIC_ASSERT(Max_Sources > 0U, "At least one source is needed");
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param clock_ Returns a free running time, in the units of the timers.
+    /// \param wait_  Sleeps until woken, or until the time given has passed.
+    //*************************************************************************
+    event_loop(clock_type clock_, wait_type wait_)
+      : ievent_loop(source_array, Max_Sources, wheel, clock_, wait_)
+    {
+      wheel.enable(true);
+    }
+
+  private:
+
+    source                                       source_array[Max_Sources];
+    etl::callback_timer_wheel<Max_Timers, Slots> wheel;
+  };
+
+  //***************************************************************************
+  /// A single producer queue that signals an event loop source when pushed,
+  /// and passes each value to a handler when the source is dispatched.
+  ///\tparam T    The type of value.
+  ///\tparam Size The maximum number of values.
+  ///\ingroup event_loop
+  //***************************************************************************
+  template <typename T, size_t Size>
+  class event_loop_queue
+  {
+  public:
+
+    typedef etl::delegate<void(const T&)> handler_type;
+
+    //*************************************************************************
+    /// Adds itself to the loop as a source.
+    //*************************************************************************
+    event_loop_queue(etl::ievent_loop& loop_, handler_type handler_)
+      : loop(loop_)
+      , handler(handler_)
+      , id(loop_.add_handler(etl::ievent_loop::handler_type::template create<event_loop_queue, &event_loop_queue::drain>(*this)))
+    {
+    }
+
+    //*************************************************************************
+    /// Removes itself from the loop.
+    //*************************************************************************
+    ~event_loop_queue()
+    {
+      loop.remove(id);
+    }
+
+    //*************************************************************************
+    /// Pushes a value and signals the loop.
+    /// May be called from an interrupt or another thread.
+    /// Returns <b>false</b> if the queue is full.
+    //*************************************************************************
+    bool push(const T& value)
+    {
+      if (queue.push(value))
+      {
+        loop.signal(id);
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Gets the source id, or etl::ievent_loop::No_Source if the loop was full.
+    //*************************************************************************
+    event_loop_source_t get_source() const
+    {
+      return id;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no values queued.
+    //*************************************************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Passes each queued value to the handler.
+    //*************************************************************************
+    void drain()
+    {
+      T value;
+
+      while (queue.pop(value))
+      {
+        handler(value);
+      }
+    }
+
+    // Disable copy construction and assignment.
+    event_loop_queue(const event_loop_queue&) ETL_DELETE;
+    event_loop_queue& operator =(const event_loop_queue&) ETL_DELETE;
+
+    etl::ievent_loop&               loop;
+    handler_type                    handler;
+    etl::queue_spsc_atomic<T, Size> queue;
+    const event_loop_source_t       id;
+  };
+}
+
+#endif
+#endif
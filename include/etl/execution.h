@@ -0,0 +1,693 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EXECUTION_INCLUDED
+#define ETL_EXECUTION_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "numeric.h"
+#include "iterator.h"
+#include "functional.h"
+#include "memory.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "worker_pool.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup execution execution
+/// Execution policies for for_each, transform, fill, copy, sort and reduce.
+/// etl::execution::seq runs the algorithm on the calling thread.
+/// etl::execution::par(pool) splits the range into chunks that are executed
+/// by an etl::worker_pool. Parallel overloads require random access iterators.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace execution
+  {
+    //*************************************************************************
+    /// Runs the algorithm on the calling thread.
+    ///\ingroup execution
+    //*************************************************************************
+    struct sequenced_policy
+    {
+    };
+
+    static ETL_CONSTANT sequenced_policy seq = sequenced_policy();
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    /// Runs the algorithm on a worker pool.
+    /// By default the range is split into four chunks per thread, each at
+    /// least Minimum_Chunk_Size long. with_chunk_size() fixes the chunk size.
+    /// deterministic() makes the split depend on the length of the range
+    /// only, so that reduce gives the same result whatever the number of
+    /// workers. Partial results are always combined in chunk order.
+    /// A range is never split into more than Max_Chunks chunks.
+    ///\ingroup execution
+    //*************************************************************************
+    class parallel_policy
+    {
+    public:
+
+      static ETL_CONSTANT size_t Max_Chunks         = 64U;
+      static ETL_CONSTANT size_t Chunks_Per_Thread  = 4U;
+      static ETL_CONSTANT size_t Minimum_Chunk_Size = 256U;
+
+      //***********************************************************************
+      /// Constructor.
+      //***********************************************************************
+      explicit parallel_policy(etl::worker_pool& pool_)
+        : p_pool(&pool_)
+        , fixed_chunk_size(0U)
+        , is_deterministic(false)
+      {
+      }
+
+      //***********************************************************************
+      /// Returns a copy of the policy that splits ranges into chunks of
+      /// chunk_size_ elements, or as few more as Max_Chunks requires.
+      //***********************************************************************
+      parallel_policy with_chunk_size(size_t chunk_size_) const
+      {
+        parallel_policy policy(*this);
+        policy.fixed_chunk_size = chunk_size_;
+
+        return policy;
+      }
+
+      //***********************************************************************
+      /// Returns a copy of the policy whose split does not depend on the
+      /// number of workers.
+      //***********************************************************************
+      parallel_policy deterministic() const
+      {
+        parallel_policy policy(*this);
+        policy.is_deterministic = true;
+
+        return policy;
+      }
+
+      //***********************************************************************
+      /// The pool that executes the chunks.
+      //***********************************************************************
+      etl::worker_pool& pool() const
+      {
+        return *p_pool;
+      }
+
+      //***********************************************************************
+      /// Is the split independent of the number of workers?
+      //***********************************************************************
+      bool is_deterministic_split() const
+      {
+        return is_deterministic || (fixed_chunk_size != 0U);
+      }
+
+      //***********************************************************************
+      /// The chunk size for a range of the length.
+      //***********************************************************************
+      size_t chunk_size(size_t length) const
+      {
+        size_t size = fixed_chunk_size;
+
+        if (size == 0U)
+        {
+          const size_t max_chunks     = Max_Chunks;
+          const size_t minimum_length = Minimum_Chunk_Size;
+          const size_t chunks         = is_deterministic ? max_chunks : (p_pool->concurrency() * Chunks_Per_Thread);
+
+          size = round_up_divide(length, chunks);
+          size = (size < minimum_length) ? minimum_length : size;
+        }
+
+        const size_t minimum_size = round_up_divide(length, Max_Chunks);
+
+        return (size < minimum_size) ? minimum_size : size;
+      }
+
+      //***********************************************************************
+      /// The number of chunks for a range of the length.
+      //***********************************************************************
+      size_t chunk_count(size_t length) const
+      {
+        return (length == 0U) ? 0U : round_up_divide(length, chunk_size(length));
+      }
+
+    private:
+
+      static size_t round_up_divide(size_t numerator, size_t denominator)
+      {
+        return (numerator + denominator - 1U) / denominator;
+      }
+
+      etl::worker_pool* p_pool;
+      size_t            fixed_chunk_size;
+      bool              is_deterministic;
+    };
+
+    //*************************************************************************
+    /// Makes a parallel policy for the pool.
+    ///\ingroup execution
+    //*************************************************************************
+    inline parallel_policy par(etl::worker_pool& pool)
+    {
+      return parallel_policy(pool);
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// Sequenced overloads.
+  //***************************************************************************
+  template <typename TIterator, typename TFunction>
+  void for_each(const etl::execution::sequenced_policy&, TIterator first, TIterator last, TFunction function)
+  {
+    etl::for_each(first, last, function);
+  }
+
+  //***************************************************************************
+  template <typename TIterator, typename TIteratorOut, typename TUnaryOperation>
+  TIteratorOut transform(const etl::execution::sequenced_policy&, TIterator first, TIterator last, TIteratorOut d_first, TUnaryOperation operation)
+  {
+    return etl::transform(first, last, d_first, operation);
+  }
+
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TIteratorOut, typename TBinaryOperation>
+  TIteratorOut transform(const etl::execution::sequenced_policy&, TIterator1 first1, TIterator1 last1, TIterator2 first2, TIteratorOut d_first, TBinaryOperation operation)
+  {
+    return etl::transform(first1, last1, first2, d_first, operation);
+  }
+
+  //***************************************************************************
+  template <typename TIterator, typename TValue>
+  void fill(const etl::execution::sequenced_policy&, TIterator first, TIterator last, const TValue& value)
+  {
+    etl::fill(first, last, value);
+  }
+
+  //***************************************************************************
+  template <typename TIterator, typename TIteratorOut>
+  TIteratorOut copy(const etl::execution::sequenced_policy&, TIterator first, TIterator last, TIteratorOut d_first)
+  {
+    return etl::copy(first, last, d_first);
+  }
+
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(const etl::execution::sequenced_policy&, TIterator first, TIterator last, TCompare compare)
+  {
+    etl::sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(const etl::execution::sequenced_policy&, TIterator first, TIterator last)
+  {
+    etl::sort(first, last);
+  }
+
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  T reduce(const etl::execution::sequenced_policy&, TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    return etl::reduce(first, last, init, operation);
+  }
+
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  T reduce(const etl::execution::sequenced_policy&, TIterator first, TIterator last, T init)
+  {
+    return etl::reduce(first, last, init);
+  }
+
+#if ETL_HAS_ATOMIC
+  namespace private_execution
+  {
+    //*************************************************************************
+    /// A range split into chunks.
+    //*************************************************************************
+    template <typename TIterator>
+    struct chunked_range
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      chunked_range(const etl::execution::parallel_policy& policy, TIterator first_, TIterator last_)
+        : first(first_)
+        , length(size_t(etl::distance(first_, last_)))
+        , chunk_size(policy.chunk_size(length))
+        , chunk_count(policy.chunk_count(length))
+      {
+      }
+
+      size_t begin_index(size_t chunk) const
+      {
+        return chunk * chunk_size;
+      }
+
+      size_t end_index(size_t chunk) const
+      {
+        const size_t index = begin_index(chunk) + chunk_size;
+
+        return (index < length) ? index : length;
+      }
+
+      TIterator begin(size_t chunk) const
+      {
+        return first + difference_type(begin_index(chunk));
+      }
+
+      TIterator end(size_t chunk) const
+      {
+        return first + difference_type(end_index(chunk));
+      }
+
+      TIterator first;
+      size_t    length;
+      size_t    chunk_size;
+      size_t    chunk_count;
+    };
+
+    //*************************************************************************
+    /// Executes the job's chunks on the policy's pool.
+    //*************************************************************************
+    template <typename TJob>
+    void execute(const etl::execution::parallel_policy& policy, TJob& job)
+    {
+      policy.pool().execute(&TJob::execute_chunk, &job, job.range.chunk_count);
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TFunction>
+    struct for_each_job
+    {
+      for_each_job(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TFunction function_)
+        : range(policy, first, last)
+        , function(function_)
+      {
+      }
+
+      static void execute_chunk(void* context, size_t chunk)
+      {
+        const for_each_job& job = *static_cast<const for_each_job*>(context);
+
+        etl::for_each(job.range.begin(chunk), job.range.end(chunk), job.function);
+      }
+
+      chunked_range<TIterator> range;
+      TFunction                function;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TIteratorOut, typename TUnaryOperation>
+    struct transform_job
+    {
+      typedef typename etl::iterator_traits<TIteratorOut>::difference_type difference_type;
+
+      transform_job(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TIteratorOut d_first_, TUnaryOperation operation_)
+        : range(policy, first, last)
+        , d_first(d_first_)
+        , operation(operation_)
+      {
+      }
+
+      static void execute_chunk(void* context, size_t chunk)
+      {
+        const transform_job& job = *static_cast<const transform_job*>(context);
+
+        etl::transform(job.range.begin(chunk), job.range.end(chunk), job.d_first + difference_type(job.range.begin_index(chunk)), job.operation);
+      }
+
+      chunked_range<TIterator> range;
+      TIteratorOut             d_first;
+      TUnaryOperation          operation;
+    };
+
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename TIteratorOut, typename TBinaryOperation>
+    struct binary_transform_job
+    {
+      typedef typename etl::iterator_traits<TIterator2>::difference_type   difference_type2;
+      typedef typename etl::iterator_traits<TIteratorOut>::difference_type difference_type_out;
+
+      binary_transform_job(const etl::execution::parallel_policy& policy, TIterator1 first1, TIterator1 last1, TIterator2 first2_, TIteratorOut d_first_, TBinaryOperation operation_)
+        : range(policy, first1, last1)
+        , first2(first2_)
+        , d_first(d_first_)
+        , operation(operation_)
+      {
+      }
+
+      static void execute_chunk(void* context, size_t chunk)
+      {
+        const binary_transform_job& job = *static_cast<const binary_transform_job*>(context);
+
+        const size_t index = job.range.begin_index(chunk);
+
+        etl::transform(job.range.begin(chunk), job.range.end(chunk),
+                       job.first2 + difference_type2(index),
+                       job.d_first + difference_type_out(index),
+                       job.operation);
+      }
+
+      chunked_range<TIterator1> range;
+      TIterator2                first2;
+      TIteratorOut              d_first;
+      TBinaryOperation          operation;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TValue>
+    struct fill_job
+    {
+      fill_job(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, const TValue& value_)
+        : range(policy, first, last)
+        , value(value_)
+      {
+      }
+
+      static void execute_chunk(void* context, size_t chunk)
+      {
+        const fill_job& job = *static_cast<const fill_job*>(context);
+
+        etl::fill(job.range.begin(chunk), job.range.end(chunk), job.value);
+      }
+
+      chunked_range<TIterator> range;
+      const TValue&            value;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TIteratorOut>
+    struct copy_job
+    {
+      typedef typename etl::iterator_traits<TIteratorOut>::difference_type difference_type;
+
+      copy_job(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TIteratorOut d_first_)
+        : range(policy, first, last)
+        , d_first(d_first_)
+      {
+      }
+
+      static void execute_chunk(void* context, size_t chunk)
+      {
+        const copy_job& job = *static_cast<const copy_job*>(context);
+
+        etl::copy(job.range.begin(chunk), job.range.end(chunk), job.d_first + difference_type(job.range.begin_index(chunk)));
+      }
+
+      chunked_range<TIterator> range;
+      TIteratorOut             d_first;
+    };
+
+    //*************************************************************************
+    /// Sorts each chunk.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    struct sort_job
+    {
+      sort_job(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TCompare compare_)
+        : range(policy, first, last)
+        , compare(compare_)
+      {
+      }
+
+      static void execute_chunk(void* context, size_t chunk)
+      {
+        const sort_job& job = *static_cast<const sort_job*>(context);
+
+        etl::sort(job.range.begin(chunk), job.range.end(chunk), job.compare);
+      }
+
+      chunked_range<TIterator> range;
+      TCompare                 compare;
+    };
+
+    //*************************************************************************
+    /// Merges pairs of adjacent sorted runs of 'width' elements, in place.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    struct merge_job
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      merge_job(TIterator first_, size_t length_, size_t width_, TCompare compare_)
+        : first(first_)
+        , length(length_)
+        , width(width_)
+        , compare(compare_)
+      {
+      }
+
+      size_t merge_count() const
+      {
+        // Pairs whose second run is not empty.
+        return (length - width + (2U * width) - 1U) / (2U * width);
+      }
+
+      static void execute_chunk(void* context, size_t chunk)
+      {
+        const merge_job& job = *static_cast<const merge_job*>(context);
+
+        const size_t left   = chunk * 2U * job.width;
+        const size_t middle = left + job.width;
+        const size_t right  = ((middle + job.width) < job.length) ? (middle + job.width) : job.length;
+
+        etl::private_algorithm::merge_without_buffer(job.first + difference_type(left),
+                                                     job.first + difference_type(middle),
+                                                     job.first + difference_type(right),
+                                                     difference_type(middle - left),
+                                                     difference_type(right - middle),
+                                                     job.compare);
+      }
+
+      TIterator first;
+      size_t    length;
+      size_t    width;
+      TCompare  compare;
+    };
+
+    //*************************************************************************
+    /// Reduces each chunk to a partial result.
+    /// The first chunk starts from the initial value, the others from their
+    /// first element.
+    //*************************************************************************
+    template <typename TIterator, typename T, typename TBinaryOperation>
+    struct reduce_job
+    {
+      reduce_job(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, const T& init_, TBinaryOperation operation_)
+        : range(policy, first, last)
+        , init(init_)
+        , operation(operation_)
+      {
+      }
+
+      static void execute_chunk(void* context, size_t chunk)
+      {
+        reduce_job& job = *static_cast<reduce_job*>(context);
+
+        TIterator itr = job.range.begin(chunk);
+        TIterator end = job.range.end(chunk);
+
+        if (chunk == 0U)
+        {
+          ::new (&job.partials[0]) T(etl::reduce(itr, end, job.init, job.operation));
+        }
+        else
+        {
+          T sum = *itr;
+          ++itr;
+
+          ::new (&job.partials[int(chunk)]) T(etl::reduce(itr, end, sum, job.operation));
+        }
+      }
+
+      //***********************************************************************
+      /// Combines the partial results in chunk order.
+      //***********************************************************************
+      T combine()
+      {
+        T sum = partials[0];
+        partials[0].~T();
+
+        for (size_t chunk = 1U; chunk < range.chunk_count; ++chunk)
+        {
+          sum = operation(sum, partials[int(chunk)]);
+          partials[int(chunk)].~T();
+        }
+
+        return sum;
+      }
+
+      chunked_range<TIterator> range;
+      const T&                 init;
+      TBinaryOperation         operation;
+      etl::uninitialized_buffer_of<T, etl::execution::parallel_policy::Max_Chunks> partials;
+    };
+  }
+
+  //***************************************************************************
+  /// Parallel for_each.
+  /// Each chunk is given a copy of the function.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TFunction>
+  void for_each(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TFunction function)
+  {
+    private_execution::for_each_job<TIterator, TFunction> job(policy, first, last, function);
+    private_execution::execute(policy, job);
+  }
+
+  //***************************************************************************
+  /// Parallel unary transform.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TIteratorOut, typename TUnaryOperation>
+  TIteratorOut transform(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TIteratorOut d_first, TUnaryOperation operation)
+  {
+    private_execution::transform_job<TIterator, TIteratorOut, TUnaryOperation> job(policy, first, last, d_first, operation);
+    private_execution::execute(policy, job);
+
+    return d_first + etl::distance(first, last);
+  }
+
+  //***************************************************************************
+  /// Parallel binary transform.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TIteratorOut, typename TBinaryOperation>
+  TIteratorOut transform(const etl::execution::parallel_policy& policy, TIterator1 first1, TIterator1 last1, TIterator2 first2, TIteratorOut d_first, TBinaryOperation operation)
+  {
+    private_execution::binary_transform_job<TIterator1, TIterator2, TIteratorOut, TBinaryOperation> job(policy, first1, last1, first2, d_first, operation);
+    private_execution::execute(policy, job);
+
+    return d_first + etl::distance(first1, last1);
+  }
+
+  //***************************************************************************
+  /// Parallel fill.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TValue>
+  void fill(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, const TValue& value)
+  {
+    private_execution::fill_job<TIterator, TValue> job(policy, first, last, value);
+    private_execution::execute(policy, job);
+  }
+
+  //***************************************************************************
+  /// Parallel copy. The ranges must not overlap.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TIteratorOut>
+  TIteratorOut copy(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TIteratorOut d_first)
+  {
+    private_execution::copy_job<TIterator, TIteratorOut> job(policy, first, last, d_first);
+    private_execution::execute(policy, job);
+
+    return d_first + etl::distance(first, last);
+  }
+
+  //***************************************************************************
+  /// Parallel sort.
+  /// The chunks are sorted in parallel, then merged in place in passes of
+  /// doubling width, the merges of each pass in parallel. Does not allocate.
+  /// Not stable. A pool without workers sorts the range as a whole.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TCompare compare)
+  {
+    if (policy.pool().worker_count() == 0U)
+    {
+      etl::sort(first, last, compare);
+      return;
+    }
+
+    private_execution::sort_job<TIterator, TCompare> job(policy, first, last, compare);
+    private_execution::execute(policy, job);
+
+    const size_t length = job.range.length;
+
+    for (size_t width = job.range.chunk_size; width < length; width *= 2U)
+    {
+      private_execution::merge_job<TIterator, TCompare> merge(first, length, width, compare);
+      policy.pool().execute(&merge.execute_chunk, &merge, merge.merge_count());
+    }
+  }
+
+  //***************************************************************************
+  /// Parallel sort.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last)
+  {
+    etl::sort(policy, first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Parallel reduce.
+  /// The operation must be associative. Each chunk is reduced in order, and
+  /// the partial results are combined in chunk order, so the result depends
+  /// only on the split. See etl::execution::parallel_policy::deterministic().
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  T reduce(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    if (first == last)
+    {
+      return init;
+    }
+
+    private_execution::reduce_job<TIterator, T, TBinaryOperation> job(policy, first, last, init, operation);
+    private_execution::execute(policy, job);
+
+    return job.combine();
+  }
+
+  //***************************************************************************
+  /// Parallel reduce, with addition.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  T reduce(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, T init)
+  {
+    return etl::reduce(policy, first, last, init, etl::plus<T>());
+  }
+#endif
+}
+
+#endif
@@ -0,0 +1,489 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FAST_MATH_INCLUDED
+#define ETL_FAST_MATH_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "bit.h"
+#include "static_assert.h"
+#include "lut.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup fast_math fast_math
+/// Runtime integer and fixed point kernels, for targets without an FPU.
+/// isqrt, ilog2, ilog10 and reciprocal_q31 are available for all standards.
+/// The trigonometry and square root from compile time lookup tables need C++14.
+/// Angles are binary angles, where 65536 is a full turn.
+///\ingroup maths
+
+#if ETL_USING_64BIT_TYPES
+  #define ETL_FAST_MATH_POWERS_OF_TEN                                                    \
+  {                                                                                      \
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,         \
+    100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,     \
+    10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,  \
+    100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL              \
+  }
+#else
+  #define ETL_FAST_MATH_POWERS_OF_TEN                                                    \
+  {                                                                                      \
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL,                 \
+    100000000UL, 1000000000UL                                                            \
+  }
+#endif
+
+namespace etl
+{
+  namespace private_fast_math
+  {
+    //*************************************************************************
+    /// The powers of ten that fit in the largest supported unsigned type.
+    //*************************************************************************
+    template <typename TDummy = void>
+    struct powers_of_ten
+    {
+#if ETL_USING_64BIT_TYPES
+      typedef uint64_t value_type;
+      static ETL_CONSTANT size_t Size = 20U;
+#else
+      typedef uint32_t value_type;
+      static ETL_CONSTANT size_t Size = 10U;
+#endif
+
+#if ETL_USING_CPP11
+      static ETL_CONSTANT value_type values[Size] = ETL_FAST_MATH_POWERS_OF_TEN;
+#else
+      static ETL_CONSTANT value_type values[Size];
+#endif
+    };
+
+    template <typename TDummy>
+    ETL_CONSTANT size_t powers_of_ten<TDummy>::Size;
+
+#if ETL_USING_CPP11
+    template <typename TDummy>
+    ETL_CONSTANT typename powers_of_ten<TDummy>::value_type powers_of_ten<TDummy>::values[powers_of_ten<TDummy>::Size];
+#else
+    template <typename TDummy>
+    ETL_CONSTANT typename powers_of_ten<TDummy>::value_type powers_of_ten<TDummy>::values[powers_of_ten<TDummy>::Size] = ETL_FAST_MATH_POWERS_OF_TEN;
+#endif
+  }
+
+  //***************************************************************************
+  ///\ingroup fast_math
+  /// The integer square root of value, rounded down.
+  /// Calculates a bit of the root per step, starting from the highest power
+  /// of four not greater than value. No multiplications or divisions.
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_unsigned<T>::value, T>::type
+    isqrt(T value) ETL_NOEXCEPT
+  {
+    if (value == 0U)
+    {
+      return 0U;
+    }
+
+    const int top_bit = int(etl::integral_limits<T>::bits) - 1 - etl::countl_zero(value);
+
+    T bit  = static_cast<T>(T(1U) << (top_bit & ~1));
+    T root = 0U;
+
+    while (bit != 0U)
+    {
+      if (value >= static_cast<T>(root + bit))
+      {
+        value = static_cast<T>(value - (root + bit));
+        root  = static_cast<T>((root >> 1U) + bit);
+      }
+      else
+      {
+        root = static_cast<T>(root >> 1U);
+      }
+
+      bit = static_cast<T>(bit >> 2U);
+    }
+
+    return root;
+  }
+
+  //***************************************************************************
+  ///\ingroup fast_math
+  /// The base 2 log of value, rounded down.
+  /// As etl::log2, the log of 0 is 0.
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_unsigned<T>::value, int>::type
+    ilog2(T value) ETL_NOEXCEPT
+  {
+    return (value == 0U) ? 0 : (int(etl::integral_limits<T>::bits) - 1 - etl::countl_zero(value));
+  }
+
+  //***************************************************************************
+  ///\ingroup fast_math
+  /// The base 10 log of value, rounded down.
+  /// As etl::log10, the log of 0 is 0. The number of decimal digits is ilog10 + 1.
+  /// Estimates from the base 2 log, as log10(2) ~= 1233 / 4096, then corrects
+  /// the estimate with one comparison against a power of ten.
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_unsigned<T>::value, int>::type
+    ilog10(T value) ETL_NOEXCEPT
+  {
+    typedef private_fast_math::powers_of_ten<> powers;
+
+    ETL_STATIC_ASSERT(sizeof(T) <= sizeof(typename powers::value_type), "Type too large for ilog10");
+
+    if (value == 0U)
+    {
+      return 0;
+    }
+
+    const int estimate = ((etl::ilog2(value) + 1) * 1233) >> 12;
+
+    return (static_cast<typename powers::value_type>(value) < powers::values[estimate]) ? (estimate - 1) : estimate;
+  }
+
+  //***************************************************************************
+  ///\ingroup fast_math
+  /// The reciprocal of a Q31 value, by Newton-Raphson.
+  /// Returns a Q31 mantissa and sets exponent, so that 1 / value = mantissa * 2^exponent.
+  /// The mantissa has the sign of value and a magnitude in [0.5, 1), accurate
+  /// to within a few LSB. Uses multiplications only.
+  /// The reciprocal of 0 saturates to the largest mantissa, with an exponent of 31.
+  //***************************************************************************
+  inline int32_t reciprocal_q31(int32_t value, int& exponent)
+  {
+    if (value == 0)
+    {
+      exponent = 31;
+      return INT32_MAX;
+    }
+
+    const bool     negative  = (value < 0);
+    const uint32_t magnitude = negative ? (0U - static_cast<uint32_t>(value)) : static_cast<uint32_t>(value);
+
+    // Normalise to x in [0.5, 1) in Q32, so that 1 / x is in (1, 2].
+    const int      shift = etl::countl_zero(magnitude);
+    const uint64_t x     = uint64_t(magnitude << shift);
+
+    // The linear estimate 48/17 - 32/17 x in Q30 has a relative error of at most 1/17.
+    // Each iteration y = y (2 - x y) squares the error, so three give 32 bits.
+    uint64_t y = 3031741621ULL - ((2021161081ULL * x) >> 32U);
+
+    for (int i = 0; i < 3; ++i)
+    {
+      const uint64_t xy = (x * y) >> 32U;
+
+      y = (y * (0x80000000ULL - xy)) >> 30U;
+    }
+
+    // y in Q30 is the mantissa of 1 / (2 x) in Q31.
+    exponent = shift;
+
+    if (y >= 0x80000000ULL)
+    {
+      y = 0x40000000ULL;
+      ++exponent;
+    }
+
+    return negative ? -static_cast<int32_t>(y) : static_cast<int32_t>(y);
+  }
+}
+
+#if ETL_USING_CPP14
+
+namespace etl
+{
+  namespace private_fast_math
+  {
+    static constexpr double Pi = 3.14159265358979323846;
+
+    //*************************************************************************
+    /// Compile time square root, by Newton's method.
+    //*************************************************************************
+    constexpr double sqrt(double x)
+    {
+      if (!(x > 0.0))
+      {
+        return 0.0;
+      }
+
+      double guess = (x > 1.0) ? x : 1.0;
+
+      for (int i = 0; i < 64; ++i)
+      {
+        guess = 0.5 * (guess + (x / guess));
+      }
+
+      return guess;
+    }
+
+    //*************************************************************************
+    /// Compile time sine, by a Taylor series after reduction to [-pi, pi].
+    //*************************************************************************
+    constexpr double sin(double x)
+    {
+      const double turns = x / (2.0 * Pi);
+      const long   whole = long((turns >= 0.0) ? (turns + 0.5) : (turns - 0.5));
+
+      x -= double(whole) * (2.0 * Pi);
+
+      double term   = x;
+      double result = x;
+
+      for (int n = 1; n < 20; ++n)
+      {
+        term   *= -(x * x) / double((2 * n) * ((2 * n) + 1));
+        result += term;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Compile time arctangent for x in [0, 1].
+    /// Halves the angle twice, then uses the Taylor series.
+    //*************************************************************************
+    constexpr double atan(double x)
+    {
+      for (int i = 0; i < 2; ++i)
+      {
+        x = x / (1.0 + sqrt(1.0 + (x * x)));
+      }
+
+      double power  = x;
+      double result = x;
+
+      for (int n = 1; n < 20; ++n)
+      {
+        power  *= -(x * x);
+        result += power / double((2 * n) + 1);
+      }
+
+      return 4.0 * result;
+    }
+
+    //*************************************************************************
+    /// A quarter turn of sine in Q15, indexed by binary angle.
+    //*************************************************************************
+    struct sine_q15
+    {
+      static constexpr double lower = 0.0;
+      static constexpr double upper = 16384.0;
+
+      constexpr double operator()(double angle) const
+      {
+        return 32767.0 * private_fast_math::sin((angle / 65536.0) * 2.0 * Pi);
+      }
+    };
+
+    //*************************************************************************
+    /// The arctangent of a ratio in [0, 1], as a binary angle.
+    //*************************************************************************
+    struct atan_binary_angle
+    {
+      static constexpr double lower = 0.0;
+      static constexpr double upper = 1.0;
+
+      constexpr double operator()(double ratio) const
+      {
+        return (private_fast_math::atan(ratio) / (2.0 * Pi)) * 65536.0;
+      }
+    };
+
+    //*************************************************************************
+    /// The square root of a normalised mantissa in [0.25, 1], scaled by 2^20.
+    //*************************************************************************
+    struct sqrt_mantissa
+    {
+      static constexpr double lower = 0.25;
+      static constexpr double upper = 1.0;
+
+      constexpr double operator()(double x) const
+      {
+        return private_fast_math::sqrt(x) * 1048576.0;
+      }
+    };
+
+    typedef etl::lut<sine_q15,          257U, etl::lut_interpolation::Linear, int16_t>  sine_table;
+    typedef etl::lut<atan_binary_angle, 257U, etl::lut_interpolation::Linear, uint16_t> atan_table;
+    typedef etl::lut<sqrt_mantissa,     193U, etl::lut_interpolation::Linear, uint32_t> sqrt_table;
+
+    //*************************************************************************
+    /// Linear interpolation between two entries, with a Fraction_Bits fraction.
+    //*************************************************************************
+    template <uint32_t Fraction_Bits>
+    int32_t interpolate(int32_t y0, int32_t y1, uint32_t fraction)
+    {
+      return y0 + (((y1 - y0) * int32_t(fraction)) / (int32_t(1) << Fraction_Bits));
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup fast_math
+  /// Sine of a binary angle, in Q15.
+  /// A 257 entry quarter wave table with linear interpolation, accurate to
+  /// within 1 LSB.
+  //***************************************************************************
+  inline int16_t fast_sin(uint16_t angle)
+  {
+    static constexpr private_fast_math::sine_table table{};
+
+    const uint32_t quadrant = uint32_t(angle) >> 14U;
+    uint32_t       offset   = uint32_t(angle) & 0x3FFFU;
+
+    // The second and fourth quadrants mirror the first and third.
+    if ((quadrant & 1U) != 0U)
+    {
+      offset = 16384U - offset;
+    }
+
+    const uint32_t index    = offset >> 6U;
+    const uint32_t fraction = offset & 0x3FU;
+
+    const int32_t value = (index >= 256U) ? int32_t(table[256U])
+                                          : private_fast_math::interpolate<6U>(table[index], table[index + 1U], fraction);
+
+    // The third and fourth quadrants are negative.
+    return int16_t(((quadrant & 2U) != 0U) ? -value : value);
+  }
+
+  //***************************************************************************
+  ///\ingroup fast_math
+  /// Cosine of a binary angle, in Q15.
+  //***************************************************************************
+  inline int16_t fast_cos(uint16_t angle)
+  {
+    return fast_sin(uint16_t(angle + 16384U));
+  }
+
+  //***************************************************************************
+  ///\ingroup fast_math
+  /// The angle of the point (x, y), as a binary angle.
+  /// Reduces to the first octant, where a 257 entry table of the arctangent
+  /// of y / x is interpolated. Uses one division. Returns 0 for (0, 0).
+  //***************************************************************************
+  inline uint16_t fast_atan2(int32_t y, int32_t x)
+  {
+    static constexpr private_fast_math::atan_table table{};
+
+    const uint32_t ax = (x < 0) ? (0U - uint32_t(x)) : uint32_t(x);
+    const uint32_t ay = (y < 0) ? (0U - uint32_t(y)) : uint32_t(y);
+
+    if ((ax == 0U) && (ay == 0U))
+    {
+      return 0U;
+    }
+
+    const bool     steep = ay > ax;
+    const uint32_t minor = steep ? ax : ay;
+    const uint32_t major = steep ? ay : ax;
+
+    // The ratio minor / major in Q16, from 0 to 65536.
+    const uint32_t ratio    = uint32_t((uint64_t(minor) << 16U) / major);
+    const uint32_t index    = ratio >> 8U;
+    const uint32_t fraction = ratio & 0xFFU;
+
+    uint32_t angle = (index >= 256U) ? uint32_t(table[256U])
+                                     : uint32_t(private_fast_math::interpolate<8U>(table[index], table[index + 1U], fraction));
+
+    if (steep)
+    {
+      angle = 16384U - angle;
+    }
+
+    if (x < 0)
+    {
+      angle = 32768U - angle;
+    }
+
+    if (y < 0)
+    {
+      angle = 65536U - angle;
+    }
+
+    return uint16_t(angle);
+  }
+
+  //***************************************************************************
+  ///\ingroup fast_math
+  /// The approximate square root of x.
+  /// Normalises x to a mantissa in [0.25, 1) and an even shift, then
+  /// interpolates a 193 entry table. Accurate to within about 1 for all x.
+  //***************************************************************************
+  inline uint16_t fast_sqrt(uint32_t x)
+  {
+    static constexpr private_fast_math::sqrt_table table{};
+
+    if (x == 0U)
+    {
+      return 0U;
+    }
+
+    // Shift left by an even amount so that one of the top two bits is set.
+    uint32_t shift    = 0U;
+    uint32_t mantissa = x;
+
+    while ((mantissa & 0xC0000000UL) == 0U)
+    {
+      mantissa <<= 2U;
+      shift     += 1U;
+    }
+
+    // The mantissa is in [2^30, 2^32), i.e. [0.25, 1) of 2^32.
+    const uint32_t index    = (mantissa >> 24U) - 64U;
+    const uint32_t fraction = (mantissa >> 8U) & 0xFFFFU;
+
+    const uint32_t y0 = table[index];
+    const uint32_t y1 = table[index + 1U];
+
+    // The square root of the mantissa, scaled by 2^20.
+    // Adjacent entries differ by at most 4096, so the product fits in 32 bits.
+    uint32_t root = y0 + ((((y1 - y0) * fraction) + 0x8000UL) >> 16U);
+
+    // Drop the four guard bits and undo the normalisation, rounding to nearest.
+    shift += 4U;
+    root   = (root + (1UL << (shift - 1U))) >> shift;
+
+    return (root > 0xFFFFUL) ? uint16_t(0xFFFFU) : uint16_t(root);
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,587 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FFT_INCLUDED
+#define ETL_FFT_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "log.h"
+#include "fixed.h"
+#include "fast_math.h"
+
+#include <stddef.h>
+
+///\defgroup fft fft
+/// Fixed size, in place, fast Fourier transforms for floating point and
+/// etl::fixed values, with no heap.
+/// The twiddle factors are calculated by the constexpr constructor, so a
+/// constexpr transform object places its tables in read only memory.
+/// Each pass combines two radix-2 stages into a radix-4 butterfly group,
+/// halving the number of passes over the data. When log2(N) is odd, a
+/// single radix-2 stage is done first.
+///
+/// Floating point transforms are unscaled and the inverse divides by N.
+/// Fixed point transforms halve the values at every radix-2 stage, so that
+/// they cannot overflow; the forward transform returns DFT / N and the
+/// inverse returns the unscaled inverse, so inverse(forward(x)) = x / N.
+/// For fixed point, the modulus of each input must be less than 1.
+///
+/// Requires C++14.
+///\ingroup maths
+
+#if ETL_USING_CPP14
+
+namespace etl
+{
+  //***************************************************************************
+  /// A complex value for the transforms.
+  ///\ingroup fft
+  //***************************************************************************
+  template <typename T>
+  struct fft_complex
+  {
+    T real;
+    T imag;
+  };
+
+  namespace private_fft
+  {
+    //*************************************************************************
+    /// Arithmetic for floating point transforms.
+    //*************************************************************************
+    template <typename T, bool Is_Fixed = etl::is_fixed<T>::value>
+    struct traits
+    {
+      typedef etl::fft_complex<T> complex_type;
+
+      static constexpr T from_double(double value)
+      {
+        return T(value);
+      }
+
+      static constexpr complex_type multiply(const complex_type& a, const complex_type& b)
+      {
+        return complex_type{ (a.real * b.real) - (a.imag * b.imag), (a.real * b.imag) + (a.imag * b.real) };
+      }
+
+      //*********************************
+      /// a = a + (w * b), b = a - (w * b)
+      //*********************************
+      static constexpr void butterfly(complex_type& a, complex_type& b, const complex_type& w)
+      {
+        const complex_type t = multiply(w, b);
+
+        b.real = a.real - t.real;
+        b.imag = a.imag - t.imag;
+        a.real = a.real + t.real;
+        a.imag = a.imag + t.imag;
+      }
+
+      static constexpr T half(T value)
+      {
+        return value * T(0.5);
+      }
+
+      static constexpr void scale_inverse(complex_type& value, size_t n)
+      {
+        value.real /= T(n);
+        value.imag /= T(n);
+      }
+    };
+
+    //*************************************************************************
+    /// Arithmetic for fixed point transforms.
+    /// Intermediate values are kept in the wide type until the butterfly
+    /// halves them.
+    //*************************************************************************
+    template <typename T>
+    struct traits<T, true>
+    {
+      typedef etl::fft_complex<T>           complex_type;
+      typedef typename T::wide_type        wide_type;
+      typedef typename T::storage_type     storage_type;
+      typedef typename T::rounding_policy  rounding_policy;
+      typedef typename T::overflow_policy  overflow_policy;
+
+      static constexpr T from_double(double value)
+      {
+        // Symmetric, so that twiddle factors may be negated.
+        const double    one     = double(wide_type(1) << T::FRACTION_BITS);
+        const wide_type maximum = T::max().raw();
+
+        wide_type raw = wide_type((value >= 0.0) ? ((value * one) + 0.5) : ((value * one) - 0.5));
+
+        raw = (raw > maximum) ? maximum : ((raw < -maximum) ? wide_type(-maximum) : raw);
+
+        return T::from_raw(storage_type(raw));
+      }
+
+      static constexpr T narrow(wide_type value)
+      {
+        return T::from_raw(overflow_policy::template apply<storage_type, T::TOTAL_BITS>(value));
+      }
+
+      static constexpr wide_type multiply_real(const complex_type& a, const complex_type& b)
+      {
+        return rounding_policy::shift_right(wide_type((wide_type(a.real.raw()) * b.real.raw()) - (wide_type(a.imag.raw()) * b.imag.raw())), T::FRACTION_BITS);
+      }
+
+      static constexpr wide_type multiply_imag(const complex_type& a, const complex_type& b)
+      {
+        return rounding_policy::shift_right(wide_type((wide_type(a.real.raw()) * b.imag.raw()) + (wide_type(a.imag.raw()) * b.real.raw())), T::FRACTION_BITS);
+      }
+
+      static constexpr complex_type multiply(const complex_type& a, const complex_type& b)
+      {
+        return complex_type{ narrow(multiply_real(a, b)), narrow(multiply_imag(a, b)) };
+      }
+
+      //*********************************
+      /// a = (a + (w * b)) / 2, b = (a - (w * b)) / 2
+      //*********************************
+      static constexpr void butterfly(complex_type& a, complex_type& b, const complex_type& w)
+      {
+        const wide_type t_real = multiply_real(w, b);
+        const wide_type t_imag = multiply_imag(w, b);
+        const wide_type a_real = a.real.raw();
+        const wide_type a_imag = a.imag.raw();
+
+        b.real = narrow(rounding_policy::shift_right(wide_type(a_real - t_real), 1U));
+        b.imag = narrow(rounding_policy::shift_right(wide_type(a_imag - t_imag), 1U));
+        a.real = narrow(rounding_policy::shift_right(wide_type(a_real + t_real), 1U));
+        a.imag = narrow(rounding_policy::shift_right(wide_type(a_imag + t_imag), 1U));
+      }
+
+      static constexpr T half(T value)
+      {
+        return T::from_raw(storage_type(rounding_policy::shift_right(wide_type(value.raw()), 1U)));
+      }
+
+      static constexpr void scale_inverse(complex_type&, size_t)
+      {
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// An N point complex FFT.
+  ///\tparam N The number of points. A power of 2, at least 2.
+  ///\tparam T float, double, long double or an etl::fixed, such as etl::fixed<0, 15> (Q15) or etl::fixed<0, 31> (Q31).
+  ///\ingroup fft
+  //***************************************************************************
+  template <size_t N, typename T>
+  class fft
+  {
+  public:
+
+    ETL_STATIC_ASSERT((N >= 2U) && ((N & (N - 1U)) == 0U), "N must be a power of 2, at least 2");
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value || etl::is_fixed<T>::value, "T must be floating point or etl::fixed");
+
+    typedef T                   value_type;
+    typedef etl::fft_complex<T> complex_type;
+
+    static constexpr size_t SIZE = N;
+
+    //*************************************************************************
+    /// Constructor. Calculates the twiddle factors, W^m = e^(-2.pi.i.m / N).
+    //*************************************************************************
+    constexpr fft()
+      : twiddles()
+    {
+      for (size_t m = 0U; m < (N / 2U); ++m)
+      {
+        const double angle = (2.0 * etl::private_fast_math::Pi * double(m)) / double(N);
+
+        twiddles[m].real = traits::from_double(etl::private_fast_math::sin(angle + (etl::private_fast_math::Pi / 2.0)));
+        twiddles[m].imag = traits::from_double(-etl::private_fast_math::sin(angle));
+      }
+    }
+
+    //*************************************************************************
+    /// The forward transform of the N values in data, in place.
+    //*************************************************************************
+    constexpr void transform(complex_type* data) const
+    {
+      run<false>(data);
+    }
+
+    //*************************************************************************
+    /// The inverse transform of the N values in data, in place.
+    //*************************************************************************
+    constexpr void inverse(complex_type* data) const
+    {
+      run<true>(data);
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        traits::scale_inverse(data[i], N);
+      }
+    }
+
+    //*************************************************************************
+    /// The circular convolution of the N values in a and b. The result is in a.
+    /// b is replaced by its transform.
+    /// For fixed point, the result is scaled by 1 / N^2.
+    //*************************************************************************
+    constexpr void circular_convolve(complex_type* a, complex_type* b) const
+    {
+      transform(a);
+      transform(b);
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        a[i] = traits::multiply(a[i], b[i]);
+      }
+
+      inverse(a);
+    }
+
+    //*************************************************************************
+    /// The circular cross correlation, r[m] = sum(conj(a[n]) * b[n + m]), of
+    /// the N values in a and b. The result is in a.
+    /// b is replaced by its transform.
+    /// For fixed point, the result is scaled by 1 / N^2.
+    //*************************************************************************
+    constexpr void circular_correlate(complex_type* a, complex_type* b) const
+    {
+      transform(a);
+      transform(b);
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        a[i].imag = -a[i].imag;
+        a[i]      = traits::multiply(a[i], b[i]);
+      }
+
+      inverse(a);
+    }
+
+    //*************************************************************************
+    /// The twiddle factor W^m, for m < N / 2.
+    //*************************************************************************
+    constexpr const complex_type& twiddle(size_t m) const
+    {
+      return twiddles[m];
+    }
+
+  private:
+
+    typedef etl::private_fft::traits<T> traits;
+
+    static constexpr size_t Log2_N = etl::log2<N>::value;
+
+    //*************************************************************************
+    /// Reorders the data by bit reversed index.
+    //*************************************************************************
+    static constexpr void bit_reverse(complex_type* data)
+    {
+      size_t j = 0U;
+
+      for (size_t i = 1U; i < N; ++i)
+      {
+        size_t bit = N >> 1U;
+
+        while ((j & bit) != 0U)
+        {
+          j ^= bit;
+          bit >>= 1U;
+        }
+
+        j ^= bit;
+
+        if (i < j)
+        {
+          const complex_type temp = data[i];
+          data[i] = data[j];
+          data[j] = temp;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// The twiddle factor, conjugated for the inverse.
+    //*************************************************************************
+    template <bool Inverse>
+    constexpr complex_type get_twiddle(size_t m) const
+    {
+      return Inverse ? complex_type{ twiddles[m].real, -twiddles[m].imag } : twiddles[m];
+    }
+
+    //*************************************************************************
+    /// Decimation in time, on bit reversed data.
+    //*************************************************************************
+    template <bool Inverse>
+    constexpr void run(complex_type* data) const
+    {
+      bit_reverse(data);
+
+      size_t h = 1U;
+
+      // An odd number of stages. Do one radix-2 stage, where W = 1.
+      if ((Log2_N & 1U) != 0U)
+      {
+        const complex_type one = twiddles[0];
+
+        for (size_t j = 0U; j < N; j += 2U)
+        {
+          traits::butterfly(data[j], data[j + 1U], one);
+        }
+
+        h = 2U;
+      }
+
+      // Two radix-2 stages, spans h and 2h, per pass.
+      while (h < N)
+      {
+        const size_t stride1 = N / (2U * h);
+        const size_t stride2 = N / (4U * h);
+
+        for (size_t k = 0U; k < h; ++k)
+        {
+          const complex_type w1 = get_twiddle<Inverse>(k * stride1);
+          const complex_type w2 = get_twiddle<Inverse>(k * stride2);
+
+          // W(4h)^(k + h) = W(4h)^k * -i, or * i for the inverse.
+          const complex_type w3 = Inverse ? complex_type{ -w2.imag, w2.real } : complex_type{ w2.imag, -w2.real };
+
+          for (size_t j = 0U; j < N; j += (4U * h))
+          {
+            const size_t a = j + k;
+            const size_t b = a + h;
+            const size_t c = b + h;
+            const size_t d = c + h;
+
+            traits::butterfly(data[a], data[b], w1);
+            traits::butterfly(data[c], data[d], w1);
+            traits::butterfly(data[a], data[c], w2);
+            traits::butterfly(data[b], data[d], w3);
+          }
+        }
+
+        h *= 4U;
+      }
+    }
+
+    complex_type twiddles[N / 2U];
+  };
+
+  template <size_t N, typename T>
+  constexpr size_t fft<N, T>::SIZE;
+
+  template <size_t N, typename T>
+  constexpr size_t fft<N, T>::Log2_N;
+
+  //***************************************************************************
+  /// An N point FFT of real values.
+  /// Transforms the N real values as N / 2 complex values, then separates the
+  /// result, so that it takes about half of the time of a complex transform.
+  /// Returns the N / 2 + 1 non-negative frequency bins. The others are the
+  /// complex conjugates of these.
+  /// Scaled as etl::fft.
+  ///\tparam N The number of points. A power of 2, at least 4.
+  ///\ingroup fft
+  //***************************************************************************
+  template <size_t N, typename T>
+  class real_fft
+  {
+  public:
+
+    ETL_STATIC_ASSERT((N >= 4U) && ((N & (N - 1U)) == 0U), "N must be a power of 2, at least 4");
+
+    typedef T                   value_type;
+    typedef etl::fft_complex<T> complex_type;
+
+    static constexpr size_t SIZE        = N;
+    static constexpr size_t OUTPUT_SIZE = (N / 2U) + 1U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    constexpr real_fft()
+      : half_fft()
+      , twiddles()
+    {
+      for (size_t k = 0U; k < (N / 2U); ++k)
+      {
+        const double angle = (2.0 * etl::private_fast_math::Pi * double(k)) / double(N);
+
+        twiddles[k].real = traits::from_double(etl::private_fast_math::sin(angle + (etl::private_fast_math::Pi / 2.0)));
+        twiddles[k].imag = traits::from_double(-etl::private_fast_math::sin(angle));
+      }
+    }
+
+    //*************************************************************************
+    /// Transforms N real values in input to N / 2 + 1 complex values in output.
+    //*************************************************************************
+    constexpr void transform(const T* input, complex_type* output) const
+    {
+      const size_t M = N / 2U;
+
+      // Pack even samples as real, odd as imaginary.
+      for (size_t n = 0U; n < M; ++n)
+      {
+        output[n].real = input[2U * n];
+        output[n].imag = input[(2U * n) + 1U];
+      }
+
+      half_fft.transform(output);
+
+      // X[k]     = E[k] + W^k.O[k]
+      // X[M - k] = conj(E[k] - W^k.O[k])
+      // where E[k] = (Z[k] + conj(Z[M - k])) / 2 and O[k] = -i.(Z[k] - conj(Z[M - k])) / 2.
+      for (size_t k = 0U; k <= (M / 2U); ++k)
+      {
+        const complex_type z1 = output[k];
+        const complex_type z2 = output[(M - k) % M];
+
+        complex_type e{ traits::half(z1.real) + traits::half(z2.real), traits::half(z1.imag) - traits::half(z2.imag) };
+        complex_type o{ traits::half(z1.imag) + traits::half(z2.imag), traits::half(z2.real) - traits::half(z1.real) };
+
+        traits::butterfly(e, o, twiddles[k]);
+
+        output[k]          = e;
+        output[M - k].real = o.real;
+        output[M - k].imag = -o.imag;
+      }
+    }
+
+  private:
+
+    typedef etl::private_fft::traits<T> traits;
+
+    etl::fft<N / 2U, T> half_fft;
+    complex_type        twiddles[N / 2U];
+  };
+
+  template <size_t N, typename T>
+  constexpr size_t real_fft<N, T>::SIZE;
+
+  template <size_t N, typename T>
+  constexpr size_t real_fft<N, T>::OUTPUT_SIZE;
+
+  //***************************************************************************
+  /// Block convolution, by overlap-add.
+  /// Convolves a stream of blocks of N / 2 samples with a kernel of up to
+  /// N / 2 + 1 samples. Each block costs two N point transforms.
+  ///\tparam N The transform size. A power of 2, at least 2.
+  ///\tparam T A floating point type.
+  ///\ingroup fft
+  //***************************************************************************
+  template <size_t N, typename T>
+  class fft_convolver
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "T must be floating point");
+
+    typedef T                   value_type;
+    typedef etl::fft_complex<T> complex_type;
+
+    static constexpr size_t BLOCK_SIZE      = N / 2U;
+    static constexpr size_t MAX_KERNEL_SIZE = (N / 2U) + 1U;
+
+    //*************************************************************************
+    /// Constructor.
+    /// kernel_size must be no more than MAX_KERNEL_SIZE.
+    //*************************************************************************
+    constexpr fft_convolver(const T* kernel, size_t kernel_size)
+      : engine()
+      , kernel_spectrum()
+      , work()
+      , overlap()
+    {
+      for (size_t i = 0U; (i < kernel_size) && (i < MAX_KERNEL_SIZE); ++i)
+      {
+        kernel_spectrum[i].real = kernel[i];
+      }
+
+      engine.transform(kernel_spectrum);
+    }
+
+    //*************************************************************************
+    /// Convolves the next BLOCK_SIZE samples of input into output.
+    /// output may be the same as input.
+    //*************************************************************************
+    constexpr void process(const T* input, T* output)
+    {
+      for (size_t i = 0U; i < N; ++i)
+      {
+        work[i].real = (i < BLOCK_SIZE) ? input[i] : T(0);
+        work[i].imag = T(0);
+      }
+
+      engine.transform(work);
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        work[i] = traits::multiply(work[i], kernel_spectrum[i]);
+      }
+
+      engine.inverse(work);
+
+      for (size_t i = 0U; i < BLOCK_SIZE; ++i)
+      {
+        output[i]  = work[i].real + overlap[i];
+        overlap[i] = work[i + BLOCK_SIZE].real;
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the overlap from previous blocks.
+    //*************************************************************************
+    constexpr void reset()
+    {
+      for (size_t i = 0U; i < BLOCK_SIZE; ++i)
+      {
+        overlap[i] = T(0);
+      }
+    }
+
+  private:
+
+    typedef etl::private_fft::traits<T> traits;
+
+    etl::fft<N, T> engine;
+    complex_type   kernel_spectrum[N];
+    complex_type   work[N];
+    T              overlap[N / 2U];
+  };
+
+  template <size_t N, typename T>
+  constexpr size_t fft_convolver<N, T>::BLOCK_SIZE;
+
+  template <size_t N, typename T>
+  constexpr size_t fft_convolver<N, T>::MAX_KERNEL_SIZE;
+}
+
+#endif
+#endif
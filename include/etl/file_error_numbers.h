@@ -103,5 +103,46 @@ SOFTWARE.
 #define ETL_EXPECTED_FILE_ID "70"
 #define ETL_ALIGNMENT_FILE_ID "71"
 #define ETL_BASE64_FILE_ID "72"
+#define ETL_CRC_CHUNKS_FILE_ID "73"
+#define ETL_UNORDERED_FLAT_MAP_FILE_ID "74"
+#define ETL_MESSAGE_BROKER_FILE_ID "75"
+#define ETL_ARENA_FILE_ID "76"
+#define ETL_STATIC_FLAT_SET_FILE_ID "77"
+#define ETL_STATIC_FLAT_MAP_FILE_ID "78"
+#define ETL_DENSE_FLAT_MAP_FILE_ID "79"
+#define ETL_DENSE_FLAT_SET_FILE_ID "80"
+#define ETL_SMALL_VECTOR_FILE_ID "81"
+#define ETL_SEGMENTED_DEQUE_FILE_ID "82"
+#define ETL_INTRUSIVE_SET_FILE_ID "83"
+#define ETL_INTRUSIVE_MAP_FILE_ID "84"
+#define ETL_INTRUSIVE_UNORDERED_SET_FILE_ID "85"
+#define ETL_FORMAT_FILE_ID "86"
+#define ETL_STRING_INTERN_POOL_FILE_ID "87"
+#define ETL_COMPRESSED_BITSET_FILE_ID "88"
+#define ETL_COROUTINE_TASK_FILE_ID "89"
+#define ETL_INPLACE_FUNCTION_FILE_ID "90"
+#define ETL_SOA_VECTOR_FILE_ID "91"
+#define ETL_QUANTILE_SKETCH_FILE_ID "92"
+#define ETL_BROADCAST_RING_FILE_ID "93"
+#define ETL_EPOCH_RECLAIMER_FILE_ID "94"
+#define ETL_UNROLLED_LIST_FILE_ID "95"
+#define ETL_IOVEC_ARRAY_FILE_ID "96"
+#define ETL_SLOT_MAP_FILE_ID "97"
+#define ETL_FROZEN_MAP_FILE_ID "98"
+#define ETL_STATIC_VECTOR_FILE_ID "99"
+#define ETL_FRAMING_FILE_ID "100"
+#define ETL_LZ_COMPRESSION_FILE_ID "101"
+#define ETL_MSGPACK_FILE_ID "102"
+#define ETL_FUTURE_FILE_ID "103"
+#define ETL_TOKEN_BUCKET_FILE_ID "104"
+#define ETL_PACKET_BUFFER_FILE_ID "105"
+#define ETL_FLASH_LOG_FILE_ID "106"
+#define ETL_IMAGE_VIEW_FILE_ID "107"
+#define ETL_KWAY_MERGE_FILE_ID "108"
+#define ETL_TOPIC_TRIE_FILE_ID "109"
+#define ETL_RADIX_MAP_FILE_ID "110"
+#define ETL_INTERVAL_MAP_FILE_ID "111"
+#define ETL_INTERVAL_TREE_FILE_ID "112"
+#define ETL_PACKED_VECTOR_FILE_ID "113"
 
 #endif
@@ -0,0 +1,166 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIR_FILTER_INCLUDED
+#define ETL_FIR_FILTER_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "static_assert.h"
+#include "private/digital_filter_arithmetic.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// A finite impulse response filter.
+  /// y[n] = h[0]x[n] + h[1]x[n-1] + ... + h[Taps-1]x[n-Taps+1]
+  /// Samples and coefficients may be floating point, or signed integral fixed
+  /// point with Fraction_Bits fraction bits, e.g. Q15 for int16_t and Q31 for
+  /// int32_t. Fixed point products are accumulated at full precision and the
+  /// output is rounded and saturated.
+  /// The delay line is stored twice over, so the taps for every sample are
+  /// one contiguous run that the compiler can unroll and vectorise.
+  ///\tparam T             The sample and coefficient type.
+  ///\tparam Taps          The number of coefficients.
+  ///\tparam Fraction_Bits The fixed point fraction bits. Ignored for floating point.
+  //***************************************************************************
+  template <typename T, size_t Taps_, size_t Fraction_Bits = etl::private_digital_filter::default_fraction_bits<T>::value>
+  class fir_filter
+  {
+  private:
+
+    typedef etl::private_digital_filter::arithmetic<T, Fraction_Bits> arithmetic;
+
+  public:
+
+    ETL_STATIC_ASSERT(Taps_ != 0U, "The number of taps must not be zero");
+
+    static ETL_CONSTANT size_t Taps = Taps_;
+
+    typedef T value_type;
+    typedef typename arithmetic::accumulator_type accumulator_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param coefficients_ The coefficients, h[0] first.
+    //*************************************************************************
+    explicit fir_filter(const T (&coefficients_)[Taps_])
+    {
+      set_coefficients(coefficients_);
+      reset();
+    }
+
+    //*************************************************************************
+    /// Sets the coefficients, h[0] first. The delay line is not changed.
+    //*************************************************************************
+    void set_coefficients(const T (&coefficients_)[Taps_])
+    {
+      for (size_t i = 0U; i < Taps; ++i)
+      {
+        coefficients[i] = coefficients_[i];
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the delay line.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 0U; i < (2U * Taps); ++i)
+      {
+        delay_line[i] = T(0);
+      }
+
+      position = 0U;
+    }
+
+    //*************************************************************************
+    /// Filters one sample.
+    ///\return The filtered sample.
+    //*************************************************************************
+    T process(T sample)
+    {
+      position = (position == 0U) ? (Taps - 1U) : (position - 1U);
+
+      delay_line[position]        = sample;
+      delay_line[position + Taps] = sample;
+
+      const T* p_samples = delay_line + position;
+
+      accumulator_type accumulator = accumulator_type(0);
+
+      for (size_t i = 0U; i < Taps; ++i)
+      {
+        accumulator += arithmetic::multiply(coefficients[i], p_samples[i]);
+      }
+
+      return arithmetic::to_sample(accumulator);
+    }
+
+    //*************************************************************************
+    /// Filters a block of samples.
+    /// Processes the smaller of the input and output sizes.
+    /// The input and output may be the same span.
+    ///\return The number of samples processed.
+    //*************************************************************************
+    size_t process(etl::span<const T> input, etl::span<T> output)
+    {
+      const size_t n = (input.size() < output.size()) ? input.size() : output.size();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = process(input[i]);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Filters one sample.
+    //*************************************************************************
+    T operator ()(T sample)
+    {
+      return process(sample);
+    }
+
+  private:
+
+    T      coefficients[Taps_];    ///< h[0] to h[Taps - 1].
+    T      delay_line[2U * Taps_]; ///< The delay line, newest first from 'position', stored twice.
+    size_t position;               ///< The index of the newest sample.
+  };
+
+  template <typename T, size_t Taps_, size_t Fraction_Bits>
+  ETL_CONSTANT size_t fir_filter<T, Taps_, Fraction_Bits>::Taps;
+}
+
+#endif
@@ -0,0 +1,774 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_INCLUDED
+#define ETL_FIXED_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "integral_limits.h"
+#include "smallest.h"
+#include "to_string.h"
+#include "to_arithmetic.h"
+
+#include <stdint.h>
+
+///\defgroup fixed fixed
+/// A binary fixed point number, Q(Integer_Bits).(Fraction_Bits), with a sign bit.
+/// Arithmetic uses an integral type of twice the width of the storage for
+/// intermediate results, followed by a rounding policy and an overflow policy.
+/// The storage may be at most 32 bits wide, so that the intermediate type is at
+/// most 64 bits.
+/// The rounding policies are the binary equivalents of those in scaled_rounding.h.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// Rounds to the more negative value. An arithmetic right shift.
+  /// The fastest rounding policy.
+  ///\ingroup fixed
+  //***************************************************************************
+  struct fixed_round_floor
+  {
+    template <typename T>
+    static ETL_CONSTEXPR14 T shift_right(T value, size_t shift)
+    {
+      return value >> shift;
+    }
+
+    template <typename T>
+    static ETL_CONSTEXPR14 T divide(T numerator, T denominator)
+    {
+      T quotient  = numerator / denominator;
+      T remainder = numerator % denominator;
+
+      if ((remainder != 0) && ((remainder < 0) != (denominator < 0)))
+      {
+        --quotient;
+      }
+
+      return quotient;
+    }
+  };
+
+  //***************************************************************************
+  /// Rounds towards zero.
+  ///\ingroup fixed
+  //***************************************************************************
+  struct fixed_round_zero
+  {
+    template <typename T>
+    static ETL_CONSTEXPR14 T shift_right(T value, size_t shift)
+    {
+      return (value >= 0) ? T(value >> shift) : T(-((-value) >> shift));
+    }
+
+    template <typename T>
+    static ETL_CONSTEXPR14 T divide(T numerator, T denominator)
+    {
+      return numerator / denominator;
+    }
+  };
+
+  //***************************************************************************
+  /// Rounds to the nearest value. 'Half' values are rounded away from zero.
+  /// Uses 'symmetric up' rounding.
+  ///\ingroup fixed
+  //***************************************************************************
+  struct fixed_round_half_up
+  {
+    template <typename T>
+    static ETL_CONSTEXPR14 T shift_right(T value, size_t shift)
+    {
+      if (shift == 0U)
+      {
+        return value;
+      }
+
+      const T half = T(T(1) << (shift - 1U));
+
+      return (value >= 0) ? T((value + half) >> shift) : T(-((half - value) >> shift));
+    }
+
+    template <typename T>
+    static ETL_CONSTEXPR14 T divide(T numerator, T denominator)
+    {
+      T quotient  = numerator / denominator;
+      T remainder = numerator % denominator;
+
+      const T abs_remainder   = (remainder < 0) ? T(-remainder) : remainder;
+      const T abs_denominator = (denominator < 0) ? T(-denominator) : denominator;
+
+      if ((abs_remainder * 2) >= abs_denominator)
+      {
+        quotient += ((numerator < 0) != (denominator < 0)) ? T(-1) : T(1);
+      }
+
+      return quotient;
+    }
+  };
+
+  //***************************************************************************
+  /// Rounds to the nearest value. 'Half' values are rounded to the even value.
+  /// Uses 'Banker's Rounding'.
+  ///\ingroup fixed
+  //***************************************************************************
+  struct fixed_round_half_even
+  {
+    template <typename T>
+    static ETL_CONSTEXPR14 T shift_right(T value, size_t shift)
+    {
+      if (shift == 0U)
+      {
+        return value;
+      }
+
+      const T one       = T(T(1) << shift);
+      const T half      = T(one >> 1U);
+      T       quotient  = T(value >> shift);
+      const T remainder = T(value - (quotient * one));
+
+      if ((remainder > half) || ((remainder == half) && ((quotient & 1) != 0)))
+      {
+        ++quotient;
+      }
+
+      return quotient;
+    }
+
+    template <typename T>
+    static ETL_CONSTEXPR14 T divide(T numerator, T denominator)
+    {
+      T quotient  = numerator / denominator;
+      T remainder = numerator % denominator;
+
+      const T abs_remainder   = (remainder < 0) ? T(-remainder) : remainder;
+      const T abs_denominator = (denominator < 0) ? T(-denominator) : denominator;
+
+      if (((abs_remainder * 2) > abs_denominator) || (((abs_remainder * 2) == abs_denominator) && ((quotient & 1) != 0)))
+      {
+        quotient += ((numerator < 0) != (denominator < 0)) ? T(-1) : T(1);
+      }
+
+      return quotient;
+    }
+  };
+
+  //***************************************************************************
+  /// Results that do not fit wrap around, as two's complement integers do.
+  /// The fastest overflow policy.
+  ///\ingroup fixed
+  //***************************************************************************
+  struct fixed_wrap
+  {
+    template <typename TStorage, size_t Total_Bits, typename TWide>
+    static ETL_CONSTEXPR14 TStorage apply(TWide value)
+    {
+      typedef typename etl::make_unsigned<TWide>::type uwide_t;
+
+      const uwide_t mask     = uwide_t((uwide_t(1) << (Total_Bits - 1U)) << 1U) - 1U;
+      const uwide_t sign_bit = uwide_t(1) << (Total_Bits - 1U);
+
+      uwide_t bits = uwide_t(value) & mask;
+
+      if ((bits & sign_bit) != 0U)
+      {
+        bits |= uwide_t(~mask);
+      }
+
+      return TStorage(TWide(bits));
+    }
+  };
+
+  //***************************************************************************
+  /// Results that do not fit are clamped to the minimum or maximum.
+  ///\ingroup fixed
+  //***************************************************************************
+  struct fixed_saturate
+  {
+    template <typename TStorage, size_t Total_Bits, typename TWide>
+    static ETL_CONSTEXPR14 TStorage apply(TWide value)
+    {
+      const TWide maximum = TWide((TWide(1) << (Total_Bits - 1U)) - 1);
+      const TWide minimum = TWide(-maximum - 1);
+
+      return TStorage((value > maximum) ? maximum : ((value < minimum) ? minimum : value));
+    }
+  };
+
+  //***************************************************************************
+  /// A binary fixed point number.
+  ///\tparam Integer_Bits  The number of integral bits, excluding the sign bit.
+  ///\tparam Fraction_Bits The number of fractional bits.
+  ///\tparam TStorage      The signed integral type that holds the value. Default is the smallest that fits.
+  ///\tparam TRounding     The rounding policy. Default etl::fixed_round_floor.
+  ///\tparam TOverflow     The overflow policy. Default etl::fixed_wrap.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t Integer_Bits,
+            size_t Fraction_Bits,
+            typename TStorage  = typename etl::smallest_int_for_bits<Integer_Bits + Fraction_Bits + 1U>::type,
+            typename TRounding = etl::fixed_round_floor,
+            typename TOverflow = etl::fixed_wrap>
+  class fixed
+  {
+  public:
+
+    typedef TStorage  storage_type;
+    typedef TRounding rounding_policy;
+    typedef TOverflow overflow_policy;
+
+    /// The type used for intermediate results.
+    typedef typename etl::smallest_int_for_bits<2U * etl::integral_limits<TStorage>::bits>::type wide_type;
+
+    static ETL_CONSTANT size_t INTEGER_BITS  = Integer_Bits;
+    static ETL_CONSTANT size_t FRACTION_BITS = Fraction_Bits;
+    static ETL_CONSTANT size_t TOTAL_BITS    = Integer_Bits + Fraction_Bits + 1U;
+
+    ETL_STATIC_ASSERT(etl::is_integral<TStorage>::value && etl::is_signed<TStorage>::value, "The storage type must be a signed integral");
+    ETL_STATIC_ASSERT(TOTAL_BITS <= size_t(etl::integral_limits<TStorage>::bits), "The storage type is too small");
+#if ETL_USING_64BIT_TYPES
+    ETL_STATIC_ASSERT(etl::integral_limits<TStorage>::bits <= 32, "The storage type must be at most 32 bits");
+#else
+    ETL_STATIC_ASSERT(etl::integral_limits<TStorage>::bits <= 16, "The storage type must be at most 16 bits");
+#endif
+
+    //*************************************************************************
+    /// Default constructor. Zero.
+    //*************************************************************************
+    ETL_CONSTEXPR fixed()
+      : value(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from an integral value.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 explicit fixed(T integral, typename etl::enable_if<etl::is_integral<T>::value, int>::type = 0)
+      : value(TOverflow::template apply<TStorage, TOTAL_BITS>(wide_type(wide_type(integral) * One)))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a floating point value, rounding to the nearest.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 explicit fixed(T floating, typename etl::enable_if<etl::is_floating_point<T>::value, int>::type = 0)
+      : value(TOverflow::template apply<TStorage, TOTAL_BITS>(from_floating(floating)))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a raw, scaled, value.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 fixed from_raw(storage_type raw_value)
+    {
+      fixed f;
+      f.value = raw_value;
+
+      return f;
+    }
+
+    //*************************************************************************
+    /// The raw, scaled, value.
+    //*************************************************************************
+    ETL_CONSTEXPR14 storage_type raw() const
+    {
+      return value;
+    }
+
+    //*************************************************************************
+    /// Converts to an integral, using the rounding policy.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 typename etl::enable_if<etl::is_integral<T>::value, T>::type
+      to_integral() const
+    {
+      return T(TRounding::shift_right(wide_type(value), Fraction_Bits));
+    }
+
+    //*************************************************************************
+    /// Converts to a floating point value.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 typename etl::enable_if<etl::is_floating_point<T>::value, T>::type
+      to_floating() const
+    {
+      return T(value) / T(One);
+    }
+
+    //*************************************************************************
+    /// The largest value.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 fixed max()
+    {
+      return from_raw(storage_type((wide_type(1) << (TOTAL_BITS - 1U)) - 1));
+    }
+
+    //*************************************************************************
+    /// The most negative value.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 fixed min()
+    {
+      return from_raw(storage_type(-((wide_type(1) << (TOTAL_BITS - 1U)) - 1) - 1));
+    }
+
+    //*************************************************************************
+    /// The smallest positive value.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 fixed epsilon()
+    {
+      return from_raw(storage_type(1));
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 fixed operator +() const
+    {
+      return *this;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 fixed operator -() const
+    {
+      return from_raw(TOverflow::template apply<TStorage, TOTAL_BITS>(wide_type(-wide_type(value))));
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 fixed& operator +=(const fixed& rhs)
+    {
+      value = TOverflow::template apply<TStorage, TOTAL_BITS>(wide_type(wide_type(value) + wide_type(rhs.value)));
+      return *this;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 fixed& operator -=(const fixed& rhs)
+    {
+      value = TOverflow::template apply<TStorage, TOTAL_BITS>(wide_type(wide_type(value) - wide_type(rhs.value)));
+      return *this;
+    }
+
+    //*************************************************************************
+    /// One widening multiply, then a rounding shift by the number of fractional bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 fixed& operator *=(const fixed& rhs)
+    {
+      const wide_type product = wide_type(wide_type(value) * wide_type(rhs.value));
+
+      value = TOverflow::template apply<TStorage, TOTAL_BITS>(TRounding::shift_right(product, Fraction_Bits));
+      return *this;
+    }
+
+    //*************************************************************************
+    /// The divisor must not be zero.
+    /// To divide many values by the same divisor, see etl::fixed_reciprocal.
+    //*************************************************************************
+    ETL_CONSTEXPR14 fixed& operator /=(const fixed& rhs)
+    {
+      const wide_type numerator = wide_type(wide_type(value) * One);
+
+      value = TOverflow::template apply<TStorage, TOTAL_BITS>(TRounding::divide(numerator, wide_type(rhs.value)));
+      return *this;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR14 fixed operator +(fixed lhs, const fixed& rhs)
+    {
+      return lhs += rhs;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR14 fixed operator -(fixed lhs, const fixed& rhs)
+    {
+      return lhs -= rhs;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR14 fixed operator *(fixed lhs, const fixed& rhs)
+    {
+      return lhs *= rhs;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR14 fixed operator /(fixed lhs, const fixed& rhs)
+    {
+      return lhs /= rhs;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR14 bool operator ==(const fixed& lhs, const fixed& rhs)
+    {
+      return lhs.value == rhs.value;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR14 bool operator !=(const fixed& lhs, const fixed& rhs)
+    {
+      return lhs.value != rhs.value;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR14 bool operator <(const fixed& lhs, const fixed& rhs)
+    {
+      return lhs.value < rhs.value;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR14 bool operator <=(const fixed& lhs, const fixed& rhs)
+    {
+      return lhs.value <= rhs.value;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR14 bool operator >(const fixed& lhs, const fixed& rhs)
+    {
+      return lhs.value > rhs.value;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR14 bool operator >=(const fixed& lhs, const fixed& rhs)
+    {
+      return lhs.value >= rhs.value;
+    }
+
+  private:
+
+    static ETL_CONSTANT wide_type One = wide_type(1) << Fraction_Bits;
+
+    //*************************************************************************
+    template <typename T>
+    static ETL_CONSTEXPR14 wide_type from_floating(T floating)
+    {
+      const T scaled = floating * T(One);
+
+      return wide_type((scaled >= T(0)) ? (scaled + T(0.5)) : (scaled - T(0.5)));
+    }
+
+    storage_type value;
+  };
+
+  template <size_t Integer_Bits, size_t Fraction_Bits, typename TStorage, typename TRounding, typename TOverflow>
+  ETL_CONSTANT size_t fixed<Integer_Bits, Fraction_Bits, TStorage, TRounding, TOverflow>::INTEGER_BITS;
+
+  template <size_t Integer_Bits, size_t Fraction_Bits, typename TStorage, typename TRounding, typename TOverflow>
+  ETL_CONSTANT size_t fixed<Integer_Bits, Fraction_Bits, TStorage, TRounding, TOverflow>::FRACTION_BITS;
+
+  template <size_t Integer_Bits, size_t Fraction_Bits, typename TStorage, typename TRounding, typename TOverflow>
+  ETL_CONSTANT size_t fixed<Integer_Bits, Fraction_Bits, TStorage, TRounding, TOverflow>::TOTAL_BITS;
+
+  template <size_t Integer_Bits, size_t Fraction_Bits, typename TStorage, typename TRounding, typename TOverflow>
+  ETL_CONSTANT typename fixed<Integer_Bits, Fraction_Bits, TStorage, TRounding, TOverflow>::wide_type fixed<Integer_Bits, Fraction_Bits, TStorage, TRounding, TOverflow>::One;
+
+  //***************************************************************************
+  /// Is T an etl::fixed?
+  ///\ingroup fixed
+  //***************************************************************************
+  template <typename T>
+  struct is_fixed : public etl::false_type
+  {
+  };
+
+  template <size_t Integer_Bits, size_t Fraction_Bits, typename TStorage, typename TRounding, typename TOverflow>
+  struct is_fixed<etl::fixed<Integer_Bits, Fraction_Bits, TStorage, TRounding, TOverflow> > : public etl::true_type
+  {
+  };
+
+  //***************************************************************************
+  /// Divides by a fixed divisor using a multiply and a shift.
+  /// The reciprocal of the divisor is calculated once, normalised to use all of
+  /// the bits of the storage type. The result may differ from that of
+  /// operator / in the least significant bit.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <typename TFixed>
+  class fixed_reciprocal
+  {
+  public:
+
+    typedef typename TFixed::storage_type storage_type;
+    typedef typename TFixed::wide_type    wide_type;
+
+    //*************************************************************************
+    /// Constructor. The divisor must not be zero.
+    //*************************************************************************
+    ETL_CONSTEXPR14 explicit fixed_reciprocal(const TFixed& divisor)
+      : multiplier(0)
+      , shift(0)
+    {
+      typedef typename etl::make_unsigned<wide_type>::type uwide_t;
+
+      const bool    is_negative = divisor.raw() < 0;
+      const uwide_t abs_divisor = is_negative ? uwide_t(-wide_type(divisor.raw())) : uwide_t(divisor.raw());
+
+      // The reciprocal, 2^k / |divisor|, is scaled so that it has one less bit than the storage.
+      const int storage_bits = etl::integral_limits<storage_type>::bits;
+
+      int k = storage_bits - 1;
+      uwide_t d = abs_divisor;
+
+      while (d > 1U)
+      {
+        d >>= 1U;
+        ++k;
+      }
+
+      const uwide_t reciprocal = (uwide_t(1) << k) / abs_divisor;
+
+      multiplier = is_negative ? -wide_type(reciprocal) : wide_type(reciprocal);
+      shift      = k - int(TFixed::FRACTION_BITS);
+    }
+
+    //*************************************************************************
+    /// Returns numerator / divisor.
+    //*************************************************************************
+    ETL_CONSTEXPR14 TFixed operator ()(const TFixed& numerator) const
+    {
+      typedef typename TFixed::rounding_policy rounding_policy;
+      typedef typename TFixed::overflow_policy overflow_policy;
+
+      wide_type product = wide_type(wide_type(numerator.raw()) * multiplier);
+
+      if (shift >= 0)
+      {
+        product = rounding_policy::shift_right(product, size_t(shift));
+      }
+      else
+      {
+        product = wide_type(product * (wide_type(1) << -shift));
+      }
+
+      return TFixed::from_raw(overflow_policy::template apply<storage_type, TFixed::TOTAL_BITS>(product));
+    }
+
+  private:
+
+    wide_type multiplier;
+    int       shift;
+  };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Converts an etl::fixed to a string, with format.precision() decimal places.
+  /// At most 9 decimal places are shown.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t Integer_Bits, size_t Fraction_Bits, typename TStorage, typename TRounding, typename TOverflow>
+  const etl::istring& to_string(const etl::fixed<Integer_Bits, Fraction_Bits, TStorage, TRounding, TOverflow>& value,
+                                etl::istring& str,
+                                const etl::format_spec& format,
+                                bool append = false)
+  {
+    const uint32_t decimal_places = (format.get_precision() > 9U) ? 9U : uint32_t(format.get_precision());
+
+    uint64_t denominator = 1U;
+
+    for (uint32_t i = 0U; i < decimal_places; ++i)
+    {
+      denominator *= 10U;
+    }
+
+    // Scale to a decimal, rounding the half away from zero.
+    const bool     is_negative = value.raw() < 0;
+    const uint64_t abs_raw     = is_negative ? uint64_t(-int64_t(value.raw())) : uint64_t(value.raw());
+    const uint64_t half        = (Fraction_Bits == 0U) ? 0U : (uint64_t(1U) << Fraction_Bits) >> 1U;
+    const uint64_t scaled      = ((abs_raw * denominator) + half) >> Fraction_Bits;
+
+    const uint64_t integral   = scaled / denominator;
+    const uint64_t fractional = scaled % denominator;
+    const bool     negative   = is_negative && (scaled != 0U);
+
+    // Format for the integral part.
+    etl::format_spec integral_format = format;
+    integral_format.decimal().width(0U);
+
+    // Format for the fractional part.
+    etl::format_spec fractional_format = integral_format;
+    fractional_format.precision(decimal_places).width(decimal_places).fill('0').right();
+
+    if (!append)
+    {
+      str.clear();
+    }
+
+    // The length is only needed, and found, when there is a width.
+    size_t length = 0U;
+
+    if (format.get_width() != 0U)
+    {
+      etl::private_to_string::counting_sink<char> counter;
+      etl::private_to_string::add_integral_and_fractional(integral, fractional, counter, integral_format, fractional_format, negative);
+      length = counter.size();
+    }
+
+    etl::private_to_string::add_alignment(str, length, format, true);
+    etl::private_to_string::add_integral_and_fractional(integral, fractional, str, integral_format, fractional_format, negative);
+    etl::private_to_string::add_alignment(str, length, format, false);
+
+    return str;
+  }
+
+  //***************************************************************************
+  /// Converts an etl::fixed to a string, with the default format.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t Integer_Bits, size_t Fraction_Bits, typename TStorage, typename TRounding, typename TOverflow>
+  const etl::istring& to_string(const etl::fixed<Integer_Bits, Fraction_Bits, TStorage, TRounding, TOverflow>& value,
+                                etl::istring& str,
+                                bool append = false)
+  {
+    etl::format_spec format;
+
+    return etl::to_string(value, str, format, append);
+  }
+
+  //***************************************************************************
+  /// Converts decimal text, [+-]digits[.digits], to an etl::fixed.
+  /// The fractional digits are rounded to the nearest, from at most 9 digits.
+  /// No floating point arithmetic is used.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <typename TValue, typename TChar>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_fixed<TValue>::value, etl::to_arithmetic_result<TValue> >::type
+    to_arithmetic(etl::basic_string_view<TChar> view)
+  {
+    typedef etl::to_arithmetic_result<TValue>     result_type;
+    typedef typename result_type::unexpected_type unexpected_type;
+
+    result_type result;
+
+    const bool is_negative = etl::private_to_arithmetic::check_and_remove_sign_prefix(view);
+
+    if (view.empty())
+    {
+      result = unexpected_type(to_arithmetic_status::Invalid_Format);
+      return result;
+    }
+
+    // The largest magnitude, in raw units.
+    const uint64_t limit = uint64_t(1U) << (TValue::TOTAL_BITS - 1U);
+
+    uint64_t integral    = 0U;
+    uint64_t fractional  = 0U;
+    uint64_t denominator = 1U;
+    bool     in_fraction = false;
+    bool     has_digits  = false;
+
+    for (size_t i = 0U; i < view.size(); ++i)
+    {
+      const char c = etl::private_to_arithmetic::convert(view[i]);
+
+      if ((c == '.') && !in_fraction)
+      {
+        in_fraction = true;
+      }
+      else if ((c >= '0') && (c <= '9'))
+      {
+        has_digits = true;
+
+        if (in_fraction)
+        {
+          if (denominator < 1000000000U)
+          {
+            fractional  = (fractional * 10U) + uint64_t(c - '0');
+            denominator *= 10U;
+          }
+        }
+        else
+        {
+          integral = (integral * 10U) + uint64_t(c - '0');
+
+          if (integral > (limit >> TValue::FRACTION_BITS))
+          {
+            result = unexpected_type(to_arithmetic_status::Overflow);
+            return result;
+          }
+        }
+      }
+      else
+      {
+        result = unexpected_type(to_arithmetic_status::Invalid_Format);
+        return result;
+      }
+    }
+
+    if (!has_digits)
+    {
+      result = unexpected_type(to_arithmetic_status::Invalid_Format);
+      return result;
+    }
+
+    const uint64_t raw = (integral << TValue::FRACTION_BITS) + (((fractional << TValue::FRACTION_BITS) + (denominator / 2U)) / denominator);
+
+    if ((raw > limit) || ((raw == limit) && !is_negative))
+    {
+      result = unexpected_type(to_arithmetic_status::Overflow);
+      return result;
+    }
+
+    typedef typename TValue::storage_type storage_type;
+
+    result = TValue::from_raw(is_negative ? storage_type(-int64_t(raw)) : storage_type(raw));
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Converts decimal text to an etl::fixed.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <typename TValue, typename TChar>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_fixed<TValue>::value, etl::to_arithmetic_result<TValue> >::type
+    to_arithmetic(const TChar* cp, size_t length)
+  {
+    return etl::to_arithmetic<TValue, TChar>(etl::basic_string_view<TChar>(cp, length));
+  }
+
+  //***************************************************************************
+  /// Converts decimal text to an etl::fixed.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <typename TValue, typename TChar>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_fixed<TValue>::value, etl::to_arithmetic_result<TValue> >::type
+    to_arithmetic(const etl::ibasic_string<TChar>& str)
+  {
+    return etl::to_arithmetic<TValue, TChar>(etl::basic_string_view<TChar>(str));
+  }
+#endif
+}
+
+#endif
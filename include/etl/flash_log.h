@@ -0,0 +1,990 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLASH_LOG_INCLUDED
+#define ETL_FLASH_LOG_INCLUDED
+
+#include "platform.h"
+#include "delegate.h"
+#include "flat_map.h"
+#include "span.h"
+#include "crc32.h"
+#include "algorithm.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup flash_log flash_log
+/// An append only key/value store for NOR flash.
+/// Records are written sequentially, each framed with a CRC32, into a ring of
+/// erase sectors. An index in RAM maps each key to its latest record, and is
+/// rebuilt by a single scan of the log when mounted. A record damaged by a
+/// power failure is detected by its CRC and ignored.
+/// Space is reclaimed by compaction, which copies the live records out of the
+/// oldest sector and erases it, so sectors are erased in turn and only when
+/// full. One sector is always kept free for compaction.
+/// Not thread safe.
+///\ingroup containers
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flash_log.
+  ///\ingroup flash_log
+  //***************************************************************************
+  class flash_log_exception : public exception
+  {
+  public:
+
+    flash_log_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The geometry of the device cannot be used.
+  ///\ingroup flash_log
+  //***************************************************************************
+  class flash_log_invalid_geometry : public flash_log_exception
+  {
+  public:
+
+    flash_log_invalid_geometry(string_type file_name_, numeric_type line_number_)
+      : flash_log_exception(ETL_ERROR_TEXT("flash_log:invalid geometry", ETL_FLASH_LOG_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The key is reserved.
+  ///\ingroup flash_log
+  //***************************************************************************
+  class flash_log_invalid_key : public flash_log_exception
+  {
+  public:
+
+    flash_log_invalid_key(string_type file_name_, numeric_type line_number_)
+      : flash_log_exception(ETL_ERROR_TEXT("flash_log:invalid key", ETL_FLASH_LOG_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The index has no room for another key.
+  ///\ingroup flash_log
+  //***************************************************************************
+  class flash_log_index_full : public flash_log_exception
+  {
+  public:
+
+    flash_log_index_full(string_type file_name_, numeric_type line_number_)
+      : flash_log_exception(ETL_ERROR_TEXT("flash_log:index full", ETL_FLASH_LOG_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The value does not fit in a sector.
+  ///\ingroup flash_log
+  //***************************************************************************
+  class flash_log_value_too_large : public flash_log_exception
+  {
+  public:
+
+    flash_log_value_too_large(string_type file_name_, numeric_type line_number_)
+      : flash_log_exception(ETL_ERROR_TEXT("flash_log:value too large", ETL_FLASH_LOG_FILE_ID"D"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The block device used by the flash_log.
+  /// Addresses are byte offsets from the start of the region.
+  /// Erased bytes read as 0xFF. Each function returns <b>false</b> on failure.
+  ///\ingroup flash_log
+  //***************************************************************************
+  struct flash_log_device
+  {
+    typedef etl::delegate<bool(uint32_t address, etl::span<uint8_t> data)>       read_type;
+    typedef etl::delegate<bool(uint32_t address, etl::span<const uint8_t> data)> program_type;
+    typedef etl::delegate<bool(uint32_t sector)>                                  erase_type;
+
+    read_type    read;         ///< Reads bytes.
+    program_type program;      ///< Programs bytes. Address and size are multiples of program_size.
+    erase_type   erase;        ///< Erases a sector.
+    uint32_t     sector_size;  ///< The size of an erase sector.
+    uint32_t     sector_count; ///< The number of sectors in the region. At least 2.
+    uint32_t     program_size; ///< The program granularity. A power of 2, no larger than 32.
+  };
+
+  //***************************************************************************
+  /// The interface for flash logs.
+  ///\ingroup flash_log
+  //***************************************************************************
+  class iflash_log
+  {
+  public:
+
+    typedef uint16_t key_type;
+    typedef size_t   size_type;
+
+    enum
+    {
+      Erased_Key       = 0xFFFFU, ///< Reserved, as it is indistinguishable from erased flash.
+      Max_Value_Length = 0x7FFFU
+    };
+
+    //*************************************************************************
+    /// Scans the log and rebuilds the index.
+    /// Starts a new log if the region holds none.
+    /// Returns <b>false</b> if the device fails, the log is inconsistent, or
+    /// it holds more keys than the index can.
+    //*************************************************************************
+    bool mount()
+    {
+      mounted = false;
+      index.clear();
+
+      if (!is_valid_geometry())
+      {
+        return false;
+      }
+
+      used_sectors = 0U;
+
+      uint32_t min_sequence = 0U;
+      uint32_t max_sequence = 0U;
+
+      for (uint32_t sector = 0U; sector < device.sector_count; ++sector)
+      {
+        uint32_t sector_sequence;
+
+        if (read_sector_header(sector, sector_sequence))
+        {
+          if ((used_sectors == 0U) || (sector_sequence < min_sequence))
+          {
+            min_sequence = sector_sequence;
+            tail_sector  = sector;
+          }
+
+          if ((used_sectors == 0U) || (sector_sequence > max_sequence))
+          {
+            max_sequence = sector_sequence;
+            head_sector  = sector;
+          }
+
+          ++used_sectors;
+        }
+      }
+
+      if (used_sectors == 0U)
+      {
+        return start();
+      }
+
+      // The sectors in use are always consecutive in the ring.
+      if (head_sector != ((tail_sector + used_sectors - 1U) % device.sector_count))
+      {
+        return false;
+      }
+
+      sequence = max_sequence;
+
+      uint32_t sector = tail_sector;
+
+      for (uint32_t i = 0U; i < used_sectors; ++i)
+      {
+        uint32_t offset = sector_header_size();
+
+        record_header header;
+        uint32_t      size;
+        scan_result   result;
+
+        while ((result = next_record(sector, offset, header, size)) == Scan_Record)
+        {
+          if (is_tombstone(header))
+          {
+            index.erase(header.key);
+          }
+          else
+          {
+            if (!index.contains(header.key) && index.full())
+            {
+              index.clear();
+              return false;
+            }
+
+            index[header.key] = sector_address(sector) + offset;
+          }
+
+          offset += size;
+        }
+
+        if (result == Scan_Damaged)
+        {
+          // Nothing more may be programmed after a damaged record.
+          offset = device.sector_size;
+        }
+
+        if (sector == head_sector)
+        {
+          write_offset = offset;
+        }
+
+        sector = next_sector(sector);
+      }
+
+      mounted = true;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases the region and starts a new, empty log.
+    //*************************************************************************
+    bool format()
+    {
+      mounted = false;
+      index.clear();
+
+      if (!is_valid_geometry())
+      {
+        return false;
+      }
+
+      for (uint32_t sector = 0U; sector < device.sector_count; ++sector)
+      {
+        if (!device.erase(sector))
+        {
+          return false;
+        }
+      }
+
+      sequence = 0U;
+
+      return start();
+    }
+
+    //*************************************************************************
+    /// Writes a value for the key, replacing any previous one.
+    /// Compacts the log first if only the reserve sector is free.
+    /// Returns <b>false</b> if the log is not mounted, the device fails, or
+    /// the live records leave no room for the new one outside the reserve.
+    //*************************************************************************
+    bool write(key_type key, etl::span<const uint8_t> value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(key != key_type(Erased_Key), ETL_ERROR(flash_log_invalid_key), false);
+      ETL_ASSERT_OR_RETURN_VALUE(value.size() <= max_value_size(), ETL_ERROR(flash_log_value_too_large), false);
+      ETL_ASSERT_OR_RETURN_VALUE(index.contains(key) || !index.full(), ETL_ERROR(flash_log_index_full), false);
+
+      if (!mounted)
+      {
+        return false;
+      }
+
+      uint32_t length = static_cast<uint32_t>(value.size());
+      uint32_t address;
+
+      if (!make_room(record_size(length)) || !append(key, static_cast<uint16_t>(length), value.data(), 0U, address))
+      {
+        return false;
+      }
+
+      index[key] = address;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Removes the key by writing a tombstone record.
+    /// Returns <b>true</b> if the key is absent afterwards.
+    //*************************************************************************
+    bool remove(key_type key)
+    {
+      if (!mounted)
+      {
+        return false;
+      }
+
+      if (!index.contains(key))
+      {
+        return true;
+      }
+
+      uint32_t address;
+
+      if (!make_room(record_size(0U)) || !append(key, static_cast<uint16_t>(Tombstone), ETL_NULLPTR, 0U, address))
+      {
+        return false;
+      }
+
+      index.erase(key);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reads the value of the key into 'destination'.
+    /// Returns the number of bytes read, which is less than the size of the
+    /// value if the destination is too small, or 0 if the key is absent.
+    //*************************************************************************
+    size_t read(key_type key, etl::span<uint8_t> destination) const
+    {
+      uint32_t address;
+      uint32_t length;
+
+      if (!find_value(key, address, length))
+      {
+        return 0U;
+      }
+
+      length = etl::min(length, static_cast<uint32_t>(destination.size()));
+
+      if ((length != 0U) && !device.read(address + Record_Header_Size, destination.first(length)))
+      {
+        return 0U;
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the value of the key, or 0 if the key is absent.
+    //*************************************************************************
+    size_t value_size(key_type key) const
+    {
+      uint32_t address;
+      uint32_t length;
+
+      return find_value(key, address, length) ? length : 0U;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the log holds a value for the key.
+    //*************************************************************************
+    bool contains(key_type key) const
+    {
+      return index.contains(key);
+    }
+
+    //*************************************************************************
+    /// Reclaims the oldest sector by copying its live records to the head of
+    /// the log and erasing it. May be called from a background task.
+    /// Returns <b>true</b> if a sector was erased.
+    //*************************************************************************
+    bool compact()
+    {
+      if (!mounted)
+      {
+        return false;
+      }
+
+      if (used_sectors == 1U)
+      {
+        // Move the head on, so that the only sector becomes the oldest.
+        if (!open_sector(next_sector(head_sector)))
+        {
+          return false;
+        }
+      }
+
+      uint32_t      offset = sector_header_size();
+      record_header header;
+      uint32_t      size;
+
+      while (next_record(tail_sector, offset, header, size) == Scan_Record)
+      {
+        // Tombstones are dropped, as the oldest sector is the last that could
+        // hold a value that they hide.
+        if (!is_tombstone(header))
+        {
+          const uint32_t address = sector_address(tail_sector) + offset;
+
+          index_type::iterator itr = index.find(header.key);
+
+          if ((itr != index.end()) && (itr->second == address))
+          {
+            uint32_t new_address;
+
+            if (!append(header.key, header.length, ETL_NULLPTR, address + Record_Header_Size, new_address))
+            {
+              return false;
+            }
+
+            itr->second = new_address;
+          }
+        }
+
+        offset += size;
+      }
+
+      if (!device.erase(tail_sector))
+      {
+        return false;
+      }
+
+      tail_sector = next_sector(tail_sector);
+      --used_sectors;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if only the reserve sector is free, so that the next
+    /// write to need a new sector will compact first.
+    //*************************************************************************
+    bool needs_compaction() const
+    {
+      return mounted && (free_sectors() <= 1U);
+    }
+
+    //*************************************************************************
+    /// Returns the number of keys.
+    //*************************************************************************
+    size_type size() const
+    {
+      return index.size();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the log holds no keys.
+    //*************************************************************************
+    bool empty() const
+    {
+      return index.empty();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of keys.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return index.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the log has been mounted or formatted.
+    //*************************************************************************
+    bool is_mounted() const
+    {
+      return mounted;
+    }
+
+    //*************************************************************************
+    /// Returns the number of erased sectors, including the reserve.
+    //*************************************************************************
+    size_type free_sectors() const
+    {
+      return device.sector_count - used_sectors;
+    }
+
+    //*************************************************************************
+    /// Returns the largest value that fits in a sector.
+    //*************************************************************************
+    size_type max_value_size() const
+    {
+      const uint32_t space = (device.sector_size - sector_header_size()) & ~(device.program_size - 1U);
+
+      return etl::min(space - Record_Header_Size, static_cast<uint32_t>(Max_Value_Length));
+    }
+
+  protected:
+
+    typedef etl::iflat_map<key_type, uint32_t> index_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iflash_log(const flash_log_device& device_, index_type& index_)
+      : device(device_)
+      , index(index_)
+      , tail_sector(0U)
+      , head_sector(0U)
+      , used_sectors(0U)
+      , write_offset(0U)
+      , sequence(0U)
+      , mounted(false)
+    {
+      ETL_ASSERT(is_valid_geometry(), ETL_ERROR(flash_log_invalid_geometry));
+    }
+
+  private:
+
+    enum
+    {
+      Magic              = 0x464C4F47, // "FLOG"
+      Record_Header_Size = 8U,         // CRC32, key, length.
+      Sector_Header_Size = 8U,         // Magic, sequence.
+      Tombstone          = 0x8000U,    // Length flag.
+      Buffer_Size        = 32U
+    };
+
+    enum scan_result
+    {
+      Scan_Record,
+      Scan_End,
+      Scan_Damaged
+    };
+
+    //*************************************************************************
+    /// A decoded record header.
+    //*************************************************************************
+    struct record_header
+    {
+      uint32_t crc;
+      uint16_t key;
+      uint16_t length;
+    };
+
+    //*************************************************************************
+    static void put_u16(uint8_t* p, uint16_t value)
+    {
+      p[0] = static_cast<uint8_t>(value);
+      p[1] = static_cast<uint8_t>(value >> 8U);
+    }
+
+    //*************************************************************************
+    static void put_u32(uint8_t* p, uint32_t value)
+    {
+      put_u16(p,      static_cast<uint16_t>(value));
+      put_u16(p + 2U, static_cast<uint16_t>(value >> 16U));
+    }
+
+    //*************************************************************************
+    static uint16_t get_u16(const uint8_t* p)
+    {
+      return static_cast<uint16_t>(p[0] | (p[1] << 8U));
+    }
+
+    //*************************************************************************
+    static uint32_t get_u32(const uint8_t* p)
+    {
+      return static_cast<uint32_t>(get_u16(p)) | (static_cast<uint32_t>(get_u16(p + 2U)) << 16U);
+    }
+
+    //*************************************************************************
+    static bool is_tombstone(const record_header& header)
+    {
+      return (header.length & Tombstone) != 0U;
+    }
+
+    //*************************************************************************
+    static uint32_t value_length(const record_header& header)
+    {
+      return header.length & ~static_cast<uint32_t>(Tombstone);
+    }
+
+    //*************************************************************************
+    bool is_valid_geometry() const
+    {
+      const uint32_t program_size = device.program_size;
+
+      return (program_size != 0U) &&
+             ((program_size & (program_size - 1U)) == 0U) &&
+             (program_size <= Buffer_Size) &&
+             (device.sector_count >= 2U) &&
+             ((device.sector_size % program_size) == 0U) &&
+             (device.sector_size >= (align(Sector_Header_Size) + align(Record_Header_Size + 1U)));
+    }
+
+    //*************************************************************************
+    uint32_t align(uint32_t size) const
+    {
+      return (size + device.program_size - 1U) & ~(device.program_size - 1U);
+    }
+
+    //*************************************************************************
+    uint32_t sector_header_size() const
+    {
+      return align(Sector_Header_Size);
+    }
+
+    //*************************************************************************
+    uint32_t record_size(uint32_t length) const
+    {
+      return align(Record_Header_Size + length);
+    }
+
+    //*************************************************************************
+    uint32_t sector_address(uint32_t sector) const
+    {
+      return sector * device.sector_size;
+    }
+
+    //*************************************************************************
+    uint32_t next_sector(uint32_t sector) const
+    {
+      return (sector + 1U) % device.sector_count;
+    }
+
+    //*************************************************************************
+    /// Reads the sequence number of a sector in use.
+    //*************************************************************************
+    bool read_sector_header(uint32_t sector, uint32_t& sector_sequence)
+    {
+      uint8_t header[Sector_Header_Size];
+
+      if (!device.read(sector_address(sector), etl::span<uint8_t>(header, Sector_Header_Size)) ||
+          (get_u32(header) != static_cast<uint32_t>(Magic)))
+      {
+        return false;
+      }
+
+      sector_sequence = get_u32(header + 4U);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases a sector and makes it the head of the log.
+    //*************************************************************************
+    bool open_sector(uint32_t sector)
+    {
+      if (!device.erase(sector))
+      {
+        return false;
+      }
+
+      const uint32_t size = sector_header_size();
+
+      memset(buffer, 0xFF, size);
+      put_u32(buffer,      static_cast<uint32_t>(Magic));
+      put_u32(buffer + 4U, sequence + 1U);
+
+      if (!device.program(sector_address(sector), etl::span<const uint8_t>(buffer, size)))
+      {
+        return false;
+      }
+
+      ++sequence;
+      head_sector  = sector;
+      write_offset = size;
+      ++used_sectors;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Starts a log in the first sector.
+    //*************************************************************************
+    bool start()
+    {
+      used_sectors = 0U;
+      tail_sector  = 0U;
+
+      mounted = open_sector(0U);
+
+      return mounted;
+    }
+
+    //*************************************************************************
+    /// Decodes and verifies the record at 'offset' in the sector.
+    //*************************************************************************
+    scan_result next_record(uint32_t sector, uint32_t offset, record_header& header, uint32_t& size)
+    {
+      if ((offset + Record_Header_Size) > device.sector_size)
+      {
+        return Scan_End;
+      }
+
+      const uint32_t address = sector_address(sector) + offset;
+
+      uint8_t raw[Record_Header_Size];
+
+      if (!device.read(address, etl::span<uint8_t>(raw, Record_Header_Size)))
+      {
+        return Scan_Damaged;
+      }
+
+      bool erased = true;
+
+      for (uint32_t i = 0U; i < Record_Header_Size; ++i)
+      {
+        erased = erased && (raw[i] == 0xFFU);
+      }
+
+      if (erased)
+      {
+        return Scan_End;
+      }
+
+      header.crc    = get_u32(raw);
+      header.key    = get_u16(raw + 4U);
+      header.length = get_u16(raw + 6U);
+
+      const uint32_t length = value_length(header);
+
+      size = record_size(length);
+
+      if ((size > (device.sector_size - offset)) || (is_tombstone(header) && (length != 0U)))
+      {
+        return Scan_Damaged;
+      }
+
+      uint32_t crc;
+
+      if (!calculate_crc(raw + 4U, ETL_NULLPTR, address + Record_Header_Size, length, crc) || (crc != header.crc))
+      {
+        return Scan_Damaged;
+      }
+
+      return Scan_Record;
+    }
+
+    //*************************************************************************
+    /// Copies part of a value from RAM, or from flash if 'p_value' is null.
+    //*************************************************************************
+    bool read_value(const uint8_t* p_value, uint32_t value_address, uint32_t offset, uint8_t* p_destination, uint32_t length)
+    {
+      if (p_value != ETL_NULLPTR)
+      {
+        memcpy(p_destination, p_value + offset, length);
+        return true;
+      }
+
+      return device.read(value_address + offset, etl::span<uint8_t>(p_destination, length));
+    }
+
+    //*************************************************************************
+    /// The CRC covers the key, the length and the value.
+    //*************************************************************************
+    bool calculate_crc(const uint8_t* p_key_length, const uint8_t* p_value, uint32_t value_address, uint32_t length, uint32_t& crc)
+    {
+      etl::crc32 calculator;
+
+      calculator.add(p_key_length, p_key_length + 4U);
+
+      uint32_t offset = 0U;
+
+      while (offset < length)
+      {
+        const uint32_t n = etl::min(length - offset, static_cast<uint32_t>(Buffer_Size));
+
+        if (!read_value(p_value, value_address, offset, buffer, n))
+        {
+          return false;
+        }
+
+        calculator.add(buffer, buffer + n);
+        offset += n;
+      }
+
+      crc = calculator.value();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Ensures that the head sector has room for a record, compacting or
+    /// opening a new sector as needed.
+    //*************************************************************************
+    bool make_room(uint32_t size)
+    {
+      for (uint32_t attempt = 0U; (write_offset + size) > device.sector_size; ++attempt)
+      {
+        if (free_sectors() > 1U)
+        {
+          return open_sector(next_sector(head_sector));
+        }
+
+        // Every sector has been compacted without freeing enough space.
+        if ((attempt == device.sector_count) || !compact())
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Appends a record at the head of the log, opening a new sector if the
+    /// head is full. The value is in RAM, or in flash if 'p_value' is null.
+    //*************************************************************************
+    bool append(key_type key, uint16_t length_field, const uint8_t* p_value, uint32_t value_address, uint32_t& address)
+    {
+      const uint32_t length = length_field & ~static_cast<uint32_t>(Tombstone);
+      const uint32_t size   = record_size(length);
+
+      if ((write_offset + size) > device.sector_size)
+      {
+        if ((free_sectors() == 0U) || !open_sector(next_sector(head_sector)))
+        {
+          return false;
+        }
+      }
+
+      uint8_t header[Record_Header_Size];
+      uint32_t crc;
+
+      put_u16(header + 4U, key);
+      put_u16(header + 6U, length_field);
+
+      if (!calculate_crc(header + 4U, p_value, value_address, length, crc))
+      {
+        return false;
+      }
+
+      put_u32(header, crc);
+
+      address = sector_address(head_sector) + write_offset;
+
+      // Program in chunks of the buffer size, which is a multiple of the
+      // program size, padding the last with erased bytes.
+      uint32_t position = 0U;
+
+      while (position < size)
+      {
+        const uint32_t chunk = etl::min(size - position, static_cast<uint32_t>(Buffer_Size));
+
+        uint32_t i = 0U;
+
+        while (i < chunk)
+        {
+          const uint32_t p = position + i;
+
+          if (p < Record_Header_Size)
+          {
+            buffer[i++] = header[p];
+          }
+          else if (p < (Record_Header_Size + length))
+          {
+            const uint32_t n = etl::min(chunk - i, Record_Header_Size + length - p);
+
+            if (!read_value(p_value, value_address, p - Record_Header_Size, buffer + i, n))
+            {
+              return false;
+            }
+
+            i += n;
+          }
+          else
+          {
+            buffer[i++] = 0xFFU;
+          }
+        }
+
+        if (!device.program(address + position, etl::span<const uint8_t>(buffer, chunk)))
+        {
+          // The partial record will fail its CRC; nothing more may go in this sector.
+          write_offset = device.sector_size;
+          return false;
+        }
+
+        position += chunk;
+      }
+
+      write_offset += size;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Finds the record address and value length for the key.
+    //*************************************************************************
+    bool find_value(key_type key, uint32_t& address, uint32_t& length) const
+    {
+      index_type::const_iterator itr = index.find(key);
+
+      if (itr == index.end())
+      {
+        return false;
+      }
+
+      address = itr->second;
+
+      uint8_t raw[Record_Header_Size];
+
+      if (!device.read(address, etl::span<uint8_t>(raw, Record_Header_Size)))
+      {
+        return false;
+      }
+
+      length = get_u16(raw + 6U) & ~static_cast<uint32_t>(Tombstone);
+
+      return true;
+    }
+
+    // Disable copy construction and assignment.
+    iflash_log(const iflash_log&) ETL_DELETE;
+    iflash_log& operator =(const iflash_log&) ETL_DELETE;
+
+    flash_log_device device;
+    index_type&      index;
+    uint32_t         tail_sector;  ///< The oldest sector in use.
+    uint32_t         head_sector;  ///< The sector being written.
+    uint32_t         used_sectors;
+    uint32_t         write_offset; ///< The next free byte in the head sector.
+    uint32_t         sequence;     ///< The sequence number of the head sector.
+    bool             mounted;
+    uint8_t          buffer[Buffer_Size];
+  };
+
+  //***************************************************************************
+  /// A flash log with an index of up to Max_Keys keys.
+  ///\ingroup flash_log
+  //***************************************************************************
+  template <size_t Max_Keys>
+  class flash_log : public iflash_log
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Keys > 0U, "Max_Keys must be greater than zero");
+
+    static ETL_CONSTANT size_t MAX_KEYS = Max_Keys;
+
+    //*************************************************************************
+    /// Constructor. Call mount() or format() before use.
+    //*************************************************************************
+    explicit flash_log(const flash_log_device& device_)
+      : iflash_log(device_, index_map)
+    {
+    }
+
+  private:
+
+    etl::flat_map<key_type, uint32_t, Max_Keys> index_map;
+  };
+
+  template <size_t Max_Keys>
+  ETL_CONSTANT size_t flash_log<Max_Keys>::MAX_KEYS;
+}
+
+#endif
+
+#endif
@@ -324,11 +324,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
     }
 
     //*********************************************************************
@@ -408,11 +404,20 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values with unique keys to the flat_map.
+    /// The range is appended and merged in, without being sorted first.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      append_and_merge(first, last, true);
     }
 
     //*************************************************************************
@@ -1011,6 +1016,45 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Appends the range and merges it in.
+    //*********************************************************************
+    template <class TIterator>
+    void append_and_merge(TIterator first, TIterator last, bool is_sorted)
+    {
+      size_t n_sorted = size();
+
+      while (first != last)
+      {
+        if (full())
+        {
+          // Drop any duplicates to make room.
+          erase(refmap_t::merge_appended(n_sorted, is_sorted), end());
+          n_sorted = size();
+
+          if (full())
+          {
+            // Only values with existing keys can still be inserted.
+            while (first != last)
+            {
+              insert(*first);
+              ++first;
+            }
+
+            return;
+          }
+        }
+
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refmap_t::append(*pvalue);
+        ++first;
+      }
+
+      erase(refmap_t::merge_appended(n_sorted, is_sorted), end());
+    }
+
     // Disable copy construction.
     iflat_map(const iflat_map&);
 
@@ -1175,6 +1219,19 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from a sorted iterator range with unique keys.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_map(etl::sorted_unique_t, TIterator first, TIterator last)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_unique_t(), first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
@@ -1184,6 +1241,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Construct from a sorted initializer_list with unique keys.
+    //*************************************************************************
+    flat_map(etl::sorted_unique_t, std::initializer_list<typename etl::iflat_map<TKey, TValue, TCompare>::value_type> init)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_unique_t(), init.begin(), init.end());
+    }
 #endif
 
     //*************************************************************************
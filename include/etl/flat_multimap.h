@@ -245,11 +245,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
     }
 
     //*********************************************************************
@@ -330,11 +326,20 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values to the flat_multimap.
+    /// The range is appended and merged in, without being sorted first.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_equivalent_t, TIterator first, TIterator last)
+    {
+      append_and_merge(first, last, true);
     }
 
     //*************************************************************************
@@ -875,6 +880,28 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Appends the range and merges it in.
+    //*********************************************************************
+    template <class TIterator>
+    void append_and_merge(TIterator first, TIterator last, bool is_sorted)
+    {
+      const size_t n_sorted = size();
+
+      while ((first != last) && !full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refmap_t::append(*pvalue);
+        ++first;
+      }
+
+      refmap_t::merge_appended(n_sorted, is_sorted);
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_multimap_full));
+    }
+
     // Disable copy construction.
     iflat_multimap(const iflat_multimap&);
 
@@ -984,6 +1011,19 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from a sorted iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_multimap(etl::sorted_equivalent_t, TIterator first, TIterator last)
+      : etl::iflat_multimap<TKey, TValue, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_equivalent_t(), first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
@@ -993,6 +1033,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Construct from a sorted initializer_list.
+    //*************************************************************************
+    flat_multimap(etl::sorted_equivalent_t, std::initializer_list<typename etl::iflat_multimap<TKey, TValue, TCompare>::value_type> init)
+      : etl::iflat_multimap<TKey, TValue, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_equivalent_t(), init.begin(), init.end());
+    }
 #endif
 
     //*************************************************************************
@@ -215,11 +215,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
     }
 
     //*********************************************************************
@@ -233,7 +229,7 @@ namespace etl
 
       ETL_ASSERT(!full(), ETL_ERROR(flat_multiset_full));
 
-      iterator i_element = etl::upper_bound(begin(), end(), value, compare);
+      iterator i_element = upper_bound(value);
 
       value_type* pvalue = storage.allocate<value_type>();
       ::new (pvalue) value_type(value);
@@ -255,7 +251,7 @@ namespace etl
 
       ETL_ASSERT(!full(), ETL_ERROR(flat_multiset_full));
 
-      iterator i_element = etl::upper_bound(begin(), end(), value, compare);
+      iterator i_element = upper_bound(value);
 
       value_type* pvalue = storage.allocate<value_type>();
       ::new (pvalue) value_type(etl::move(value));
@@ -300,11 +296,20 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values to the flat_multiset.
+    /// The range is appended and merged in, without being sorted first.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_equivalent_t, TIterator first, TIterator last)
+    {
+      append_and_merge(first, last, true);
     }
 
     //*************************************************************************
@@ -844,6 +849,28 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Appends the range and merges it in.
+    //*********************************************************************
+    template <class TIterator>
+    void append_and_merge(TIterator first, TIterator last, bool is_sorted)
+    {
+      const size_t n_sorted = size();
+
+      while ((first != last) && !full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refset_t::append(*pvalue);
+        ++first;
+      }
+
+      refset_t::merge_appended(n_sorted, is_sorted);
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_multiset_full));
+    }
+
     // Disable copy construction.
     iflat_multiset(const iflat_multiset&);
 
@@ -954,6 +981,19 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from a sorted iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_multiset(etl::sorted_equivalent_t, TIterator first, TIterator last)
+      : iflat_multiset<T, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_equivalent_t(), first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
@@ -963,6 +1003,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Construct from a sorted initializer_list.
+    //*************************************************************************
+    flat_multiset(etl::sorted_equivalent_t, std::initializer_list<T> init)
+      : iflat_multiset<T, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_equivalent_t(), init.begin(), init.end());
+    }
 #endif
 
     //*************************************************************************
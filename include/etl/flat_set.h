@@ -215,11 +215,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
     }
 
     //*********************************************************************
@@ -308,11 +304,20 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values with unique keys to the flat_set.
+    /// The range is appended and merged in, without being sorted first.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      append_and_merge(first, last, true);
     }
 
     //*************************************************************************
@@ -946,6 +951,45 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Appends the range and merges it in.
+    //*********************************************************************
+    template <class TIterator>
+    void append_and_merge(TIterator first, TIterator last, bool is_sorted)
+    {
+      size_t n_sorted = size();
+
+      while (first != last)
+      {
+        if (full())
+        {
+          // Drop any duplicates to make room.
+          erase(refset_t::merge_appended(n_sorted, is_sorted), end());
+          n_sorted = size();
+
+          if (full())
+          {
+            // Only values with existing keys can still be inserted.
+            while (first != last)
+            {
+              insert(*first);
+              ++first;
+            }
+
+            return;
+          }
+        }
+
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refset_t::append(*pvalue);
+        ++first;
+      }
+
+      erase(refset_t::merge_appended(n_sorted, is_sorted), end());
+    }
+
     // Disable copy construction.
     iflat_set(const iflat_set&);
 
@@ -1056,6 +1100,19 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from a sorted iterator range with unique keys.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_set(etl::sorted_unique_t, TIterator first, TIterator last)
+      : etl::iflat_set<T, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_unique_t(), first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
@@ -1065,6 +1122,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Construct from a sorted initializer_list with unique keys.
+    //*************************************************************************
+    flat_set(etl::sorted_unique_t, std::initializer_list<T> init)
+      : etl::iflat_set<T, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_unique_t(), init.begin(), init.end());
+    }
 #endif
 
     //*************************************************************************
@@ -69,6 +69,20 @@ namespace etl
       return  hash;
     }
 
+    uint64_t add_block(uint64_t hash, const uint8_t* p) const
+    {
+      hash = add(hash, p[0]);
+      hash = add(hash, p[1]);
+      hash = add(hash, p[2]);
+      hash = add(hash, p[3]);
+      hash = add(hash, p[4]);
+      hash = add(hash, p[5]);
+      hash = add(hash, p[6]);
+      hash = add(hash, p[7]);
+
+      return hash;
+    }
+
     uint64_t final(uint64_t hash) const
     {
       return hash;
@@ -76,6 +90,7 @@ namespace etl
 
     static ETL_CONSTANT uint64_t OFFSET_BASIS = 0xCBF29CE484222325ull;
     static ETL_CONSTANT uint64_t PRIME        = 0x00000100000001b3ull;
+    static ETL_CONSTANT size_t   Block_Size   = 8U;
   };
 
   //***************************************************************************
@@ -127,6 +142,20 @@ namespace etl
       return hash;
     }
 
+    uint64_t add_block(uint64_t hash, const uint8_t* p) const
+    {
+      hash = add(hash, p[0]);
+      hash = add(hash, p[1]);
+      hash = add(hash, p[2]);
+      hash = add(hash, p[3]);
+      hash = add(hash, p[4]);
+      hash = add(hash, p[5]);
+      hash = add(hash, p[6]);
+      hash = add(hash, p[7]);
+
+      return hash;
+    }
+
     uint64_t final(uint64_t hash) const
     {
       return hash;
@@ -134,6 +163,7 @@ namespace etl
 
     static ETL_CONSTANT uint64_t OFFSET_BASIS = 0xCBF29CE484222325ull;
     static ETL_CONSTANT uint64_t PRIME        = 0x00000100000001b3ull;
+    static ETL_CONSTANT size_t   Block_Size   = 8U;
   };
 
   //***************************************************************************
@@ -186,6 +216,20 @@ namespace etl
       return hash;
     }
 
+    uint32_t add_block(uint32_t hash, const uint8_t* p) const
+    {
+      hash = add(hash, p[0]);
+      hash = add(hash, p[1]);
+      hash = add(hash, p[2]);
+      hash = add(hash, p[3]);
+      hash = add(hash, p[4]);
+      hash = add(hash, p[5]);
+      hash = add(hash, p[6]);
+      hash = add(hash, p[7]);
+
+      return hash;
+    }
+
     uint32_t final(uint32_t hash) const
     {
       return hash;
@@ -193,6 +237,7 @@ namespace etl
 
     static ETL_CONSTANT uint32_t OFFSET_BASIS = 0x811C9DC5UL;
     static ETL_CONSTANT uint32_t PRIME        = 0x01000193UL;
+    static ETL_CONSTANT size_t   Block_Size   = 8U;
   };
 
   //***************************************************************************
@@ -244,6 +289,20 @@ namespace etl
       return hash;
     }
 
+    uint32_t add_block(uint32_t hash, const uint8_t* p) const
+    {
+      hash = add(hash, p[0]);
+      hash = add(hash, p[1]);
+      hash = add(hash, p[2]);
+      hash = add(hash, p[3]);
+      hash = add(hash, p[4]);
+      hash = add(hash, p[5]);
+      hash = add(hash, p[6]);
+      hash = add(hash, p[7]);
+
+      return hash;
+    }
+
     uint32_t final(uint32_t hash) const
     {
       return hash;
@@ -251,6 +310,7 @@ namespace etl
 
     static ETL_CONSTANT uint32_t OFFSET_BASIS = 0x811C9DC5UL;
     static ETL_CONSTANT uint32_t PRIME        = 0x01000193UL;
+    static ETL_CONSTANT size_t   Block_Size   = 8U;
   };
 
   //***************************************************************************
@@ -0,0 +1,1182 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_FORMAT_INCLUDED
+#define ETL_FORMAT_INCLUDED
+
+#include "platform.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "limits.h"
+#include "iterator.h"
+#include "string.h"
+#include "string_view.h"
+#include "format_spec.h"
+#include "to_string.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_CPP11
+
+///\defgroup format format
+/// A subset of std::format for char strings.
+/// The format string is parsed, and checked against the argument types, when
+/// the etl::format_string is constructed. This happens at compile time in
+/// C++20, or in C++14 and C++17 when the format string is declared constexpr.
+/// Formatting then only writes the parsed fields.
+///
+/// Replacement fields are <b>{[index][:[[fill]align][sign][#][0][width][.precision][type]]}</b>
+/// - Integers, bool and char: types d x X o b B c. bool and char also s and c respectively.
+/// - Floating point: no type gives the shortest round trip representation, f and F fixed,
+///   with the precision and range of etl::to_string.
+/// - Strings (const char*, char arrays, etl::string_view, etl::istring): type s. The precision is the maximum length.
+/// - Pointers (void*, const void*, nullptr): type p.
+/// Nested width and precision fields, e, g and a are not supported. The width is in characters.
+/// The number of replacement fields may not exceed the number of arguments.
+///\ingroup string
+
+#if ETL_USING_CPP20
+  #define ETL_FORMAT_CONSTEVAL ETL_CONSTEVAL
+#else
+  #define ETL_FORMAT_CONSTEVAL ETL_CONSTEXPR14
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for format
+  //***************************************************************************
+  class format_exception : public etl::exception
+  {
+  public:
+
+    format_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid format string exception.
+  //***************************************************************************
+  class format_error : public format_exception
+  {
+  public:
+
+    format_error(string_type file_name_, numeric_type line_number_)
+      : format_exception(ETL_ERROR_TEXT("format:error", ETL_FORMAT_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_format
+  {
+    //*************************************************************************
+    /// The categories of argument.
+    //*************************************************************************
+    struct argument_kind
+    {
+      enum enum_type
+      {
+        Unsupported,
+        Boolean,
+        Character,
+        Signed,
+        Unsigned,
+        Floating_Point,
+        String,
+        Pointer
+      };
+    };
+
+    //*************************************************************************
+    /// The presentation types.
+    //*************************************************************************
+    struct presentation
+    {
+      enum enum_type
+      {
+        Default,
+        Decimal,
+        Hex,
+        Upper_Hex,
+        Octal,
+        Binary,
+        Upper_Binary,
+        Character,
+        Fixed,
+        Upper_Fixed,
+        String,
+        Pointer
+      };
+    };
+
+    //*************************************************************************
+    /// The alignments.
+    //*************************************************************************
+    struct alignment
+    {
+      enum enum_type
+      {
+        Default,
+        Left,
+        Right,
+        Centre
+      };
+    };
+
+    //*************************************************************************
+    /// The sign options.
+    //*************************************************************************
+    struct sign_option
+    {
+      enum enum_type
+      {
+        Negative,
+        Always,
+        Space
+      };
+    };
+
+    //*************************************************************************
+    /// A parsed replacement field and the literal text that precedes it.
+    //*************************************************************************
+    struct field
+    {
+      size_t         literal_begin;
+      size_t         literal_length;
+      size_t         argument;
+      uint_least16_t width;
+      uint_least16_t precision;
+      bool           has_precision;
+      bool           alternate;
+      bool           zero_pad;
+      char           fill;
+      uint_least8_t  align;
+      uint_least8_t  sign;
+      uint_least8_t  type;
+    };
+
+    //*************************************************************************
+    /// Character types other than char, which may not be formatted.
+    //*************************************************************************
+    template <typename T>
+    struct is_other_character : etl::bool_constant<etl::is_same<T, wchar_t>::value ||
+#if ETL_HAS_NATIVE_CHAR8_T
+                                                   etl::is_same<T, char8_t>::value ||
+#endif
+                                                   etl::is_same<T, char16_t>::value ||
+                                                   etl::is_same<T, char32_t>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Is T etl::istring or derived from it?
+    /// is_base_of is only evaluated for classes, as it does not compile for
+    /// other types without the STL or the compiler built-ins.
+    //*************************************************************************
+    template <typename T>
+    struct is_istring : etl::conditional<etl::is_class<T>::value, etl::is_base_of<etl::istring, T>, etl::false_type>::type
+    {
+    };
+
+    //*************************************************************************
+    /// Types that are formatted as strings.
+    //*************************************************************************
+    template <typename T>
+    struct is_string_argument : etl::bool_constant<etl::is_same<T, char*>::value ||
+                                                   etl::is_same<T, const char*>::value ||
+                                                   (etl::is_array<T>::value && etl::is_same<typename etl::remove_cv<typename etl::remove_extent<T>::type>::type, char>::value) ||
+                                                   etl::is_same<T, etl::string_view>::value ||
+                                                   is_istring<T>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Types that are formatted as pointers.
+    //*************************************************************************
+    template <typename T>
+    struct is_pointer_argument : etl::bool_constant<etl::is_same<T, void*>::value ||
+                                                    etl::is_same<T, const void*>::value ||
+                                                    etl::is_same<T, decltype(nullptr)>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// The category of an argument type.
+    //*************************************************************************
+    template <typename T>
+    struct argument_kind_of
+      : etl::integral_constant<int, etl::is_same<T, bool>::value                                       ? argument_kind::Boolean :
+                                    etl::is_same<T, char>::value                                       ? argument_kind::Character :
+                                    (etl::is_integral<T>::value && !is_other_character<T>::value)      ? (etl::is_signed<T>::value ? argument_kind::Signed : argument_kind::Unsigned) :
+                                    etl::is_floating_point<T>::value                                   ? argument_kind::Floating_Point :
+                                    is_string_argument<T>::value                                       ? argument_kind::String :
+                                    is_pointer_argument<T>::value                                      ? argument_kind::Pointer :
+                                                                                                         argument_kind::Unsupported>
+    {
+    };
+
+    //*************************************************************************
+    /// Are all of the argument types supported?
+    //*************************************************************************
+    template <typename... TArgs>
+    struct are_supported : etl::true_type
+    {
+    };
+
+    template <typename T, typename... TRest>
+    struct are_supported<T, TRest...> : etl::bool_constant<(argument_kind_of<T>::value != argument_kind::Unsupported) && are_supported<TRest...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// The argument type used by the format string.
+    /// Arrays decay to pointers. Also stops the argument types being deduced
+    /// from the format string.
+    //*************************************************************************
+    template <typename T>
+    struct argument_type
+    {
+      typedef typename etl::decay<const T>::type type;
+    };
+
+    //*************************************************************************
+    /// Output iterator that counts the characters written to it.
+    //*************************************************************************
+    class counting_iterator
+    {
+    public:
+
+      typedef ETL_OR_STD::output_iterator_tag iterator_category;
+      typedef void                            value_type;
+      typedef void                            difference_type;
+      typedef void                            pointer;
+      typedef void                            reference;
+
+      counting_iterator()
+        : count(0U)
+      {
+      }
+
+      counting_iterator& operator *()
+      {
+        return *this;
+      }
+
+      counting_iterator& operator =(char)
+      {
+        ++count;
+        return *this;
+      }
+
+      counting_iterator& operator ++()
+      {
+        return *this;
+      }
+
+      counting_iterator operator ++(int)
+      {
+        return *this;
+      }
+
+      size_t size() const
+      {
+        return count;
+      }
+
+    private:
+
+      size_t count;
+    };
+
+    //*************************************************************************
+    /// Called for an invalid format string.
+    /// Not constexpr, so that it is a compile time error in a constant expression,
+    /// whatever the error handling configuration.
+    //*************************************************************************
+    inline void invalid_format_string()
+    {
+    }
+
+    //*************************************************************************
+    /// Writes count copies of a character.
+    //*************************************************************************
+    template <typename TIterator>
+    void write_fill(TIterator& out, char c, size_t count)
+    {
+      while (count-- != 0U)
+      {
+        *out = c;
+        ++out;
+      }
+    }
+
+    //*************************************************************************
+    /// Writes characters.
+    //*************************************************************************
+    template <typename TIterator>
+    void write_text(TIterator& out, const char* p, size_t length)
+    {
+      const char* p_end = p + length;
+
+      while (p != p_end)
+      {
+        *out = *p++;
+        ++out;
+      }
+    }
+
+    //*************************************************************************
+    /// Writes literal text, replacing "{{" and "}}" with single braces.
+    /// The format string has already been checked.
+    //*************************************************************************
+    template <typename TIterator>
+    void write_literal(TIterator& out, const char* p, size_t length)
+    {
+      const char* p_end = p + length;
+
+      while (p != p_end)
+      {
+        const char c = *p++;
+
+        *out = c;
+        ++out;
+
+        if ((c == '{') || (c == '}'))
+        {
+          ++p;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Writes a prefix and body, aligned and padded to the field width.
+    /// The prefix holds any sign and base prefix. Zero padding is inserted
+    /// between the two when requested without an alignment.
+    //*************************************************************************
+    template <typename TIterator>
+    void write_padded(TIterator& out,
+                      const field& f,
+                      const char* p_prefix, size_t prefix_length,
+                      const char* p_body, size_t body_length,
+                      alignment::enum_type default_align,
+                      bool allow_zero_pad)
+    {
+      const size_t length  = prefix_length + body_length;
+      const size_t padding = (f.width > length) ? (f.width - length) : 0U;
+
+      if (f.zero_pad && allow_zero_pad && (f.align == alignment::Default))
+      {
+        write_text(out, p_prefix, prefix_length);
+        write_fill(out, '0', padding);
+        write_text(out, p_body, body_length);
+        return;
+      }
+
+      const uint_least8_t align = (f.align == alignment::Default) ? static_cast<uint_least8_t>(default_align) : f.align;
+
+      size_t before = 0U;
+
+      switch (align)
+      {
+        case alignment::Right:  { before = padding;      break; }
+        case alignment::Centre: { before = padding / 2U; break; }
+        default:                {                        break; }
+      }
+
+      write_fill(out, f.fill, before);
+      write_text(out, p_prefix, prefix_length);
+      write_text(out, p_body, body_length);
+      write_fill(out, f.fill, padding - before);
+    }
+
+    //*************************************************************************
+    /// Writes text aligned to the left by default.
+    //*************************************************************************
+    template <typename TIterator>
+    void write_string(TIterator& out, const field& f, const char* p, size_t length)
+    {
+      if (f.has_precision && (f.precision < length))
+      {
+        length = f.precision;
+      }
+
+      write_padded(out, f, ETL_NULLPTR, 0U, p, length, alignment::Left, false);
+    }
+
+    //*************************************************************************
+    /// Writes the sign character, if any, to the prefix.
+    //*************************************************************************
+    inline size_t add_sign(char* p_prefix, const field& f, bool is_negative)
+    {
+      if (is_negative)
+      {
+        *p_prefix = '-';
+      }
+      else if (f.sign == sign_option::Always)
+      {
+        *p_prefix = '+';
+      }
+      else if (f.sign == sign_option::Space)
+      {
+        *p_prefix = ' ';
+      }
+      else
+      {
+        return 0U;
+      }
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Writes an integer from its magnitude and sign.
+    //*************************************************************************
+    template <typename TIterator, typename TUnsigned>
+    void write_integer(TIterator& out, const field& f, TUnsigned magnitude, bool is_negative)
+    {
+      char  buffer[etl::numeric_limits<TUnsigned>::digits];
+      char* p_end   = buffer + sizeof(buffer);
+      char* p_first = p_end;
+
+      if (magnitude == 0U)
+      {
+        *--p_first = '0';
+      }
+      else
+      {
+        switch (f.type)
+        {
+          case presentation::Hex:          { p_first = etl::private_to_string::write_power_of_2_digits(magnitude, p_first, 4U, false); break; }
+          case presentation::Upper_Hex:    { p_first = etl::private_to_string::write_power_of_2_digits(magnitude, p_first, 4U, true);  break; }
+          case presentation::Octal:        { p_first = etl::private_to_string::write_power_of_2_digits(magnitude, p_first, 3U, false); break; }
+          case presentation::Binary:
+          case presentation::Upper_Binary: { p_first = etl::private_to_string::write_power_of_2_digits(magnitude, p_first, 1U, false); break; }
+          default:                         { p_first = etl::private_to_string::write_decimal_digits(magnitude, p_first);              break; }
+        }
+      }
+
+      char   prefix[3];
+      size_t prefix_length = add_sign(prefix, f, is_negative);
+
+      if (f.alternate)
+      {
+        switch (f.type)
+        {
+          case presentation::Hex:          { prefix[prefix_length++] = '0'; prefix[prefix_length++] = 'x'; break; }
+          case presentation::Upper_Hex:    { prefix[prefix_length++] = '0'; prefix[prefix_length++] = 'X'; break; }
+          case presentation::Binary:       { prefix[prefix_length++] = '0'; prefix[prefix_length++] = 'b'; break; }
+          case presentation::Upper_Binary: { prefix[prefix_length++] = '0'; prefix[prefix_length++] = 'B'; break; }
+          case presentation::Octal:        { if (magnitude != 0U) { prefix[prefix_length++] = '0'; }        break; }
+          default:                         {                                                                break; }
+        }
+      }
+
+      write_padded(out, f, prefix, prefix_length, p_first, static_cast<size_t>(p_end - p_first), alignment::Right, true);
+    }
+
+    //*************************************************************************
+    /// Writes a character.
+    //*************************************************************************
+    template <typename TIterator>
+    void write_character(TIterator& out, const field& f, char c)
+    {
+      write_padded(out, f, ETL_NULLPTR, 0U, &c, 1U, alignment::Left, false);
+    }
+
+    //*************************************************************************
+    /// Formats a bool.
+    //*************************************************************************
+    template <typename TIterator>
+    void format_value(TIterator& out, const field& f, bool value, etl::integral_constant<int, argument_kind::Boolean>)
+    {
+      if ((f.type == presentation::Default) || (f.type == presentation::String))
+      {
+        if (value)
+        {
+          write_string(out, f, "true", 4U);
+        }
+        else
+        {
+          write_string(out, f, "false", 5U);
+        }
+      }
+      else
+      {
+        write_integer(out, f, value ? 1U : 0U, false);
+      }
+    }
+
+    //*************************************************************************
+    /// Formats a signed integer.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    void format_value(TIterator& out, const field& f, T value, etl::integral_constant<int, argument_kind::Signed>)
+    {
+      typedef typename etl::make_unsigned<T>::type utype;
+
+      if (f.type == presentation::Character)
+      {
+        write_character(out, f, static_cast<char>(value));
+      }
+      else
+      {
+        const utype magnitude = static_cast<utype>(value);
+
+        write_integer(out, f, (value < 0) ? static_cast<utype>(0U - magnitude) : magnitude, value < 0);
+      }
+    }
+
+    //*************************************************************************
+    /// Formats an unsigned integer.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    void format_value(TIterator& out, const field& f, T value, etl::integral_constant<int, argument_kind::Unsigned>)
+    {
+      if (f.type == presentation::Character)
+      {
+        write_character(out, f, static_cast<char>(value));
+      }
+      else
+      {
+        write_integer(out, f, value, false);
+      }
+    }
+
+    //*************************************************************************
+    /// Formats a char.
+    //*************************************************************************
+    template <typename TIterator>
+    void format_value(TIterator& out, const field& f, char value, etl::integral_constant<int, argument_kind::Character>)
+    {
+      if ((f.type == presentation::Default) || (f.type == presentation::Character))
+      {
+        write_character(out, f, value);
+      }
+      else
+      {
+        format_value(out, f, static_cast<int>(value), etl::integral_constant<int, argument_kind::Signed>());
+      }
+    }
+
+    //*************************************************************************
+    /// Formats a floating point value with etl::to_string.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    void format_value(TIterator& out, const field& f, T value, etl::integral_constant<int, argument_kind::Floating_Point>)
+    {
+      etl::string<64U> buffer;
+      etl::format_spec spec;
+
+      if (f.type == presentation::Default)
+      {
+        spec.shortest(true);
+      }
+      else
+      {
+        spec.precision(f.has_precision ? f.precision : 6U).upper_case(f.type == presentation::Upper_Fixed);
+      }
+
+      etl::to_string(value, buffer, spec);
+
+      const char* p_body      = buffer.data();
+      size_t      body_length = buffer.size();
+      char        prefix[1];
+      size_t      prefix_length;
+
+      if ((body_length != 0U) && (*p_body == '-'))
+      {
+        prefix_length = add_sign(prefix, f, true);
+        ++p_body;
+        --body_length;
+      }
+      else
+      {
+        prefix_length = add_sign(prefix, f, false);
+      }
+
+      // Infinity and NaN are not zero padded.
+      const bool is_finite = (body_length != 0U) && (*p_body >= '0') && (*p_body <= '9');
+
+      write_padded(out, f, prefix, prefix_length, p_body, body_length, alignment::Right, is_finite);
+    }
+
+    //*************************************************************************
+    /// Formats a string.
+    //*************************************************************************
+    template <typename TIterator>
+    void format_value(TIterator& out, const field& f, etl::string_view value, etl::integral_constant<int, argument_kind::String>)
+    {
+      write_string(out, f, value.data(), value.size());
+    }
+
+    template <typename TIterator>
+    void format_value(TIterator& out, const field& f, const char* value, etl::integral_constant<int, argument_kind::String>)
+    {
+      write_string(out, f, value, (value == ETL_NULLPTR) ? 0U : etl::char_traits<char>::length(value));
+    }
+
+    template <typename TIterator>
+    void format_value(TIterator& out, const field& f, const etl::istring& value, etl::integral_constant<int, argument_kind::String>)
+    {
+      write_string(out, f, value.data(), value.size());
+    }
+
+    //*************************************************************************
+    /// Formats a pointer.
+    //*************************************************************************
+    template <typename TIterator>
+    void format_value(TIterator& out, const field& f, const volatile void* value, etl::integral_constant<int, argument_kind::Pointer>)
+    {
+      char  buffer[etl::numeric_limits<uintptr_t>::digits / 4];
+      char* p_end   = buffer + sizeof(buffer);
+      char* p_first = p_end;
+
+      const uintptr_t address = reinterpret_cast<uintptr_t>(value);
+
+      if (address == 0U)
+      {
+        *--p_first = '0';
+      }
+      else
+      {
+        p_first = etl::private_to_string::write_power_of_2_digits(address, p_first, 4U, false);
+      }
+
+      write_padded(out, f, "0x", 2U, p_first, static_cast<size_t>(p_end - p_first), alignment::Right, false);
+    }
+
+    //*************************************************************************
+    /// Formats the argument selected by the field.
+    //*************************************************************************
+    template <typename TIterator>
+    void format_argument(TIterator&, const field&, size_t)
+    {
+    }
+
+    template <typename TIterator, typename T, typename... TRest>
+    void format_argument(TIterator& out, const field& f, size_t index, const T& arg, const TRest&... rest)
+    {
+      if (index == 0U)
+      {
+        format_value(out, f, arg, etl::integral_constant<int, argument_kind_of<T>::value>());
+      }
+      else
+      {
+        format_argument(out, f, index - 1U, rest...);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// A format string, parsed and checked against the argument types.
+  /// Use etl::format_string, which does not take part in argument deduction.
+  ///\ingroup format
+  //***************************************************************************
+  template <typename... TArgs>
+  class basic_format_string
+  {
+  public:
+
+    ETL_STATIC_ASSERT(private_format::are_supported<TArgs...>::value, "Unsupported format argument type");
+
+    /// The maximum number of replacement fields.
+    static ETL_CONSTANT size_t Max_Fields = (sizeof...(TArgs) != 0U) ? sizeof...(TArgs) : 1U;
+
+    //*************************************************************************
+    /// Constructs from a zero terminated format string.
+    //*************************************************************************
+    ETL_FORMAT_CONSTEVAL basic_format_string(const char* text_)
+      : text(text_)
+      , fields()
+      , n_fields(0U)
+      , trailing_begin(0U)
+      , valid(false)
+    {
+      parse();
+    }
+
+    //*************************************************************************
+    /// Constructs from a format string view.
+    //*************************************************************************
+    ETL_FORMAT_CONSTEVAL basic_format_string(etl::string_view text_)
+      : text(text_)
+      , fields()
+      , n_fields(0U)
+      , trailing_begin(0U)
+      , valid(false)
+    {
+      parse();
+    }
+
+    //*************************************************************************
+    /// The format string.
+    //*************************************************************************
+    ETL_CONSTEXPR14 etl::string_view get() const
+    {
+      return text;
+    }
+
+    //*************************************************************************
+    /// Was the format string valid?
+    /// An invalid format string formats nothing.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool is_valid() const
+    {
+      return valid;
+    }
+
+    //*************************************************************************
+    /// Writes the formatted arguments to the output iterator.
+    /// Used by etl::format_to.
+    //*************************************************************************
+    template <typename TIterator>
+    TIterator format_to(TIterator out, const TArgs&... args) const
+    {
+      if (valid)
+      {
+        const char* p_text = text.data();
+
+        for (size_t i = 0U; i < n_fields; ++i)
+        {
+          const private_format::field& f = fields[i];
+
+          private_format::write_literal(out, p_text + f.literal_begin, f.literal_length);
+          private_format::format_argument(out, f, f.argument, args...);
+        }
+
+        private_format::write_literal(out, p_text + trailing_begin, text.size() - trailing_begin);
+      }
+
+      return out;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The kind of the argument at index.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 int kind_at(size_t index)
+    {
+      const int kinds[] = { private_format::argument_kind_of<TArgs>::value..., private_format::argument_kind::Unsupported };
+
+      return kinds[index];
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR14 bool is_digit(char c)
+    {
+      return (c >= '0') && (c <= '9');
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR14 bool is_integer_presentation(uint_least8_t type)
+    {
+      return (type >= private_format::presentation::Decimal) && (type <= private_format::presentation::Upper_Binary);
+    }
+
+    //*************************************************************************
+    /// Reports an invalid format string.
+    /// In a constant expression this is a compile time error.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void error()
+    {
+      valid = false;
+      private_format::invalid_format_string();
+      ETL_ASSERT_FAIL(ETL_ERROR(format_error));
+    }
+
+    //*************************************************************************
+    /// Parses a decimal number of up to 16 bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool parse_number(size_t& i, size_t& value) const
+    {
+      value = 0U;
+
+      while ((i < text.size()) && is_digit(text[i]))
+      {
+        value = (value * 10U) + static_cast<size_t>(text[i] - '0');
+
+        if (value > 0xFFFFU)
+        {
+          return false;
+        }
+
+        ++i;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Parses [[fill]align][sign][#][0][width][.precision][type]
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool parse_spec(size_t& i, private_format::field& f) const
+    {
+      const size_t length = text.size();
+
+      // Fill and alignment.
+      size_t align_position = length;
+
+      if (((i + 1U) < length) && (text[i] != '{') && (text[i] != '}') && to_alignment(text[i + 1U]) != private_format::alignment::Default)
+      {
+        f.fill         = text[i];
+        align_position = i + 1U;
+      }
+      else if ((i < length) && (to_alignment(text[i]) != private_format::alignment::Default))
+      {
+        align_position = i;
+      }
+
+      if (align_position != length)
+      {
+        f.align = to_alignment(text[align_position]);
+        i = align_position + 1U;
+      }
+
+      // Sign.
+      if (i < length)
+      {
+        switch (text[i])
+        {
+          case '+': { f.sign = private_format::sign_option::Always;   ++i; break; }
+          case '-': { f.sign = private_format::sign_option::Negative; ++i; break; }
+          case ' ': { f.sign = private_format::sign_option::Space;    ++i; break; }
+          default:  {                                                      break; }
+        }
+      }
+
+      if ((i < length) && (text[i] == '#'))
+      {
+        f.alternate = true;
+        ++i;
+      }
+
+      if ((i < length) && (text[i] == '0'))
+      {
+        f.zero_pad = true;
+        ++i;
+      }
+
+      size_t value = 0U;
+
+      // Width.
+      if (!parse_number(i, value))
+      {
+        return false;
+      }
+
+      f.width = static_cast<uint_least16_t>(value);
+
+      // Precision.
+      if ((i < length) && (text[i] == '.'))
+      {
+        ++i;
+
+        if ((i == length) || !is_digit(text[i]) || !parse_number(i, value))
+        {
+          return false;
+        }
+
+        f.has_precision = true;
+        f.precision     = static_cast<uint_least16_t>(value);
+      }
+
+      // Type.
+      if ((i < length) && (text[i] != '}'))
+      {
+        switch (text[i])
+        {
+          case 'd': { f.type = private_format::presentation::Decimal;      break; }
+          case 'x': { f.type = private_format::presentation::Hex;          break; }
+          case 'X': { f.type = private_format::presentation::Upper_Hex;    break; }
+          case 'o': { f.type = private_format::presentation::Octal;        break; }
+          case 'b': { f.type = private_format::presentation::Binary;       break; }
+          case 'B': { f.type = private_format::presentation::Upper_Binary; break; }
+          case 'c': { f.type = private_format::presentation::Character;    break; }
+          case 'f': { f.type = private_format::presentation::Fixed;        break; }
+          case 'F': { f.type = private_format::presentation::Upper_Fixed;  break; }
+          case 's': { f.type = private_format::presentation::String;       break; }
+          case 'p': { f.type = private_format::presentation::Pointer;      break; }
+          default:  { return false; }
+        }
+
+        ++i;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR14 uint_least8_t to_alignment(char c)
+    {
+      switch (c)
+      {
+        case '<': { return private_format::alignment::Left; }
+        case '>': { return private_format::alignment::Right; }
+        case '^': { return private_format::alignment::Centre; }
+        default:  { return private_format::alignment::Default; }
+      }
+    }
+
+    //*************************************************************************
+    /// Checks that the field's options suit the argument.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 bool is_valid_for(const private_format::field& f, int kind)
+    {
+      const uint_least8_t type            = f.type;
+      const bool          has_numeric     = (f.sign != private_format::sign_option::Negative) || f.alternate || f.zero_pad;
+      const bool          is_integer_type = is_integer_presentation(type);
+
+      switch (kind)
+      {
+        case private_format::argument_kind::Boolean:
+        {
+          return !f.has_precision &&
+                 (is_integer_type || (((type == private_format::presentation::Default) || (type == private_format::presentation::String)) && !has_numeric));
+        }
+
+        case private_format::argument_kind::Character:
+        {
+          return !f.has_precision &&
+                 (is_integer_type || (((type == private_format::presentation::Default) || (type == private_format::presentation::Character)) && !has_numeric));
+        }
+
+        case private_format::argument_kind::Signed:
+        case private_format::argument_kind::Unsigned:
+        {
+          return !f.has_precision &&
+                 (is_integer_type || (type == private_format::presentation::Default) || ((type == private_format::presentation::Character) && !has_numeric));
+        }
+
+        case private_format::argument_kind::Floating_Point:
+        {
+          return !f.alternate &&
+                 (((type == private_format::presentation::Default) && !f.has_precision) ||
+                  (type == private_format::presentation::Fixed) ||
+                  (type == private_format::presentation::Upper_Fixed));
+        }
+
+        case private_format::argument_kind::String:
+        {
+          return !has_numeric && ((type == private_format::presentation::Default) || (type == private_format::presentation::String));
+        }
+
+        case private_format::argument_kind::Pointer:
+        {
+          return !has_numeric && !f.has_precision &&
+                 ((type == private_format::presentation::Default) || (type == private_format::presentation::Pointer));
+        }
+
+        default:
+        {
+          return false;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Parses the format string into fields.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void parse()
+    {
+      const size_t length = text.size();
+
+      size_t i             = 0U;
+      size_t literal_begin = 0U;
+      size_t next_argument = 0U;
+      bool   is_automatic  = false;
+      bool   is_manual     = false;
+
+      while (i < length)
+      {
+        const char c = text[i];
+
+        if (c == '{')
+        {
+          if (((i + 1U) < length) && (text[i + 1U] == '{'))
+          {
+            i += 2U;
+          }
+          else
+          {
+            if (n_fields == Max_Fields)
+            {
+              error();
+              return;
+            }
+
+            private_format::field& f = fields[n_fields];
+
+            f.literal_begin  = literal_begin;
+            f.literal_length = i - literal_begin;
+            f.argument       = 0U;
+            f.width          = 0U;
+            f.precision      = 0U;
+            f.has_precision  = false;
+            f.alternate      = false;
+            f.zero_pad       = false;
+            f.fill           = ' ';
+            f.align          = private_format::alignment::Default;
+            f.sign           = private_format::sign_option::Negative;
+            f.type           = private_format::presentation::Default;
+            ++i;
+
+            // The argument index.
+            if ((i < length) && is_digit(text[i]))
+            {
+              is_manual = true;
+
+              if (!parse_number(i, f.argument))
+              {
+                error();
+                return;
+              }
+            }
+            else
+            {
+              is_automatic = true;
+              f.argument   = next_argument++;
+            }
+
+            if ((is_manual && is_automatic) || (f.argument >= sizeof...(TArgs)))
+            {
+              error();
+              return;
+            }
+
+            if ((i < length) && (text[i] == ':'))
+            {
+              ++i;
+
+              if (!parse_spec(i, f))
+              {
+                error();
+                return;
+              }
+            }
+
+            if ((i == length) || (text[i] != '}') || !is_valid_for(f, kind_at(f.argument)))
+            {
+              error();
+              return;
+            }
+
+            ++i;
+            ++n_fields;
+            literal_begin = i;
+          }
+        }
+        else if (c == '}')
+        {
+          if (((i + 1U) < length) && (text[i + 1U] == '}'))
+          {
+            i += 2U;
+          }
+          else
+          {
+            error();
+            return;
+          }
+        }
+        else
+        {
+          ++i;
+        }
+      }
+
+      trailing_begin = literal_begin;
+      valid          = true;
+    }
+
+    etl::string_view      text;
+    private_format::field fields[Max_Fields];
+    size_t                n_fields;
+    size_t                trailing_begin;
+    bool                  valid;
+  };
+
+  template <typename... TArgs>
+  ETL_CONSTANT size_t basic_format_string<TArgs...>::Max_Fields;
+
+  //***************************************************************************
+  /// The format string type for the arguments.
+  ///\ingroup format
+  //***************************************************************************
+  template <typename... TArgs>
+  using format_string = etl::basic_format_string<typename private_format::argument_type<TArgs>::type...>;
+
+  //***************************************************************************
+  /// Writes the formatted arguments to an output iterator.
+  ///\return The iterator past the last character written.
+  ///\ingroup format
+  //***************************************************************************
+  template <typename TIterator, typename... TArgs>
+  TIterator format_to(TIterator out, etl::format_string<TArgs...> fmt, const TArgs&... args)
+  {
+    return fmt.format_to(out, args...);
+  }
+
+  //***************************************************************************
+  /// Replaces the contents of a string with the formatted arguments.
+  /// The output is truncated to the capacity of the string.
+  ///\ingroup format
+  //***************************************************************************
+  template <typename... TArgs>
+  etl::istring& format(etl::istring& str, etl::format_string<TArgs...> fmt, const TArgs&... args)
+  {
+    str.clear();
+    fmt.format_to(etl::back_inserter(str), args...);
+
+    return str;
+  }
+
+  //***************************************************************************
+  /// The number of characters that the formatted arguments would occupy.
+  ///\ingroup format
+  //***************************************************************************
+  template <typename... TArgs>
+  size_t formatted_size(etl::format_string<TArgs...> fmt, const TArgs&... args)
+  {
+    return fmt.format_to(private_format::counting_iterator(), args...).size();
+  }
+}
+
+#undef ETL_FORMAT_CONSTEVAL
+
+#endif
+
+#endif
@@ -1217,6 +1217,65 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Compacts the forward_list, so that iteration visits the nodes in
+    /// ascending address order within the pool. The order of the elements is
+    /// unchanged. Elements are swapped between nodes, so iterators and
+    /// references are invalidated. Makes O(N^2) comparisons and O(N) swaps.
+    //*************************************************************************
+    void compact()
+    {
+      using ETL_OR_STD::swap; // Allow ADL
+
+      node_t* p_before = &start_node;
+
+      while (p_before->next != ETL_NULLPTR)
+      {
+        node_t* p_position = p_before->next;
+
+        // Find the lowest addressed node from this position to the end.
+        node_t* p_lowest_before = p_before;
+        node_t* p_node_before   = p_position;
+
+        while (p_node_before->next != ETL_NULLPTR)
+        {
+          if (p_node_before->next < p_lowest_before->next)
+          {
+            p_lowest_before = p_node_before;
+          }
+
+          p_node_before = p_node_before->next;
+        }
+
+        node_t* p_lowest = p_lowest_before->next;
+
+        if (p_lowest != p_position)
+        {
+          // Exchange the positions of the two nodes.
+          node_t* p_lowest_next = p_lowest->next;
+
+          if (p_lowest_before == p_position)
+          {
+            p_position->next = p_lowest_next;
+            p_lowest->next   = p_position;
+          }
+          else
+          {
+            p_lowest->next        = p_position->next;
+            p_lowest_before->next = p_position;
+            p_position->next      = p_lowest_next;
+          }
+
+          p_before->next = p_lowest;
+
+          // Restore the order of the elements.
+          swap(data_cast(p_lowest)->value, data_cast(p_position)->value);
+        }
+
+        p_before = p_lowest;
+      }
+    }
+
     //*************************************************************************
     /// Sort using in-place merge sort algorithm.
     /// Uses 'less-than operator as the predicate.
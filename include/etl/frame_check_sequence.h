@@ -86,11 +86,61 @@ namespace etl
 
       TFrame_Check_Sequence* p_fcs;
     };
+
+    //***************************************************
+    /// Detects whether a policy can add a block of bytes at a time.
+    /// Such a policy defines Block_Size and add_block(value, const uint8_t*).
+    //***************************************************
+    template <typename TPolicy>
+    struct has_block_add
+    {
+    private:
+
+      typedef char yes;
+      struct no { char dummy[2]; };
+
+      template <typename U>
+      static yes test(etl::integral_constant<size_t, U::Block_Size>*);
+
+      template <typename U>
+      static no test(...);
+
+    public:
+
+      static ETL_CONSTANT bool value = (sizeof(test<TPolicy>(0)) == sizeof(yes));
+    };
+
+    template <typename TPolicy>
+    ETL_CONSTANT bool has_block_add<TPolicy>::value;
+
+    //***************************************************
+    /// The type that a policy accumulates in.
+    /// TPolicy::accumulator_type if defined, otherwise TPolicy::value_type.
+    //***************************************************
+    template <typename T>
+    struct void_if_type
+    {
+      typedef void type;
+    };
+
+    template <typename TPolicy, typename TEnable = void>
+    struct policy_accumulator
+    {
+      typedef typename TPolicy::value_type type;
+    };
+
+    template <typename TPolicy>
+    struct policy_accumulator<TPolicy, typename void_if_type<typename TPolicy::accumulator_type>::type>
+    {
+      typedef typename TPolicy::accumulator_type type;
+    };
   }
 
   //***************************************************************************
   /// Calculates a frame check sequence according to the specified policy.
   ///\tparam TPolicy The type used to enact the policy.
+  /// The policy may define accumulator_type, if the running state differs
+  /// from the final value_type.
   ///\ingroup frame_check_sequence
   //***************************************************************************
   template <typename TPolicy>
@@ -100,6 +150,7 @@ namespace etl
 
     typedef TPolicy policy_type;
     typedef typename policy_type::value_type value_type;
+    typedef typename private_frame_check_sequence::policy_accumulator<TPolicy>::type accumulator_type;
     typedef private_frame_check_sequence::add_insert_iterator<frame_check_sequence<TPolicy> > add_insert_iterator;
 
     ETL_STATIC_ASSERT(etl::is_unsigned<value_type>::value, "Signed frame check type not supported");
@@ -144,11 +195,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin);
-        ++begin;
-      }
+      add_range(begin, end, etl::integral_constant<bool, private_frame_check_sequence::has_block_add<TPolicy>::value && etl::is_pointer<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -185,8 +232,45 @@ namespace etl
 
   private:
 
-    value_type  frame_check;
-    policy_type policy;
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin);
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a block at a time where possible.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      const uint8_t* p      = static_cast<const uint8_t*>(static_cast<const void*>(begin));
+      size_t         length = static_cast<size_t>(end - begin);
+
+      while (length >= policy_type::Block_Size)
+      {
+        frame_check = policy.add_block(frame_check, p);
+        p      += policy_type::Block_Size;
+        length -= policy_type::Block_Size;
+      }
+
+      while (length != 0U)
+      {
+        frame_check = policy.add(frame_check, *p);
+        ++p;
+        --length;
+      }
+    }
+
+    accumulator_type frame_check;
+    policy_type      policy;
   };
 }
 
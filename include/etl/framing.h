@@ -0,0 +1,1242 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FRAMING_INCLUDED
+#define ETL_FRAMING_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "delegate.h"
+#include "span.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "crc16_x25.h"
+
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup framing framing
+/// Streaming byte stuffing codecs for serial links: COBS, SLIP (RFC 1055)
+/// and asynchronous HDLC (RFC 1662) with a frame check sequence.
+/// Encoders take the payload in chunks and write to a caller supplied buffer.
+/// Decoders take the received bytes in chunks, of any size, and pass each
+/// complete, valid frame to a callback.
+/// Unstuffed runs are found a word at a time and copied as blocks.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for framing.
+  ///\ingroup framing
+  //***************************************************************************
+  class framing_exception : public etl::exception
+  {
+  public:
+
+    framing_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The output buffer is too small.
+  ///\ingroup framing
+  //***************************************************************************
+  class framing_overflow : public framing_exception
+  {
+  public:
+
+    framing_overflow(string_type file_name_, numeric_type line_number_)
+      : framing_exception(ETL_ERROR_TEXT("framing:overflow", ETL_FRAMING_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_framing
+  {
+    //*************************************************************************
+    /// Finds the first of either a or b in the range.
+    /// Eight bytes at a time are tested while there are enough left.
+    //*************************************************************************
+    inline const uint8_t* find_either(const uint8_t* first, const uint8_t* last, uint8_t a, uint8_t b)
+    {
+#if ETL_USING_64BIT_TYPES
+      const uint64_t ones  = 0x0101010101010101ULL;
+      const uint64_t highs = 0x8080808080808080ULL;
+      const uint64_t all_a = ones * a;
+      const uint64_t all_b = ones * b;
+
+      while ((last - first) >= 8)
+      {
+        uint64_t word;
+        memcpy(&word, first, sizeof(word));
+
+        const uint64_t xa = word ^ all_a;
+        const uint64_t xb = word ^ all_b;
+
+        // A zero byte in xa or xb is a match.
+        if ((((xa - ones) & ~xa) | ((xb - ones) & ~xb)) & highs)
+        {
+          break;
+        }
+
+        first += 8;
+      }
+#endif
+
+      while ((first != last) && (*first != a) && (*first != b))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the first of value in the range.
+    //*************************************************************************
+    inline const uint8_t* find(const uint8_t* first, const uint8_t* last, uint8_t value)
+    {
+      const void* p = memchr(first, value, static_cast<size_t>(last - first));
+
+      return (p == ETL_NULLPTR) ? last : static_cast<const uint8_t*>(p);
+    }
+
+    //*************************************************************************
+    /// Collects a frame in a buffer, and passes it to a callback when complete.
+    //*************************************************************************
+    class frame_decoder
+    {
+    public:
+
+      typedef etl::delegate<void(etl::span<const uint8_t>)> callback_type;
+
+      //*********************************
+      /// Sets the function to call for each complete frame.
+      //*********************************
+      void set_callback(callback_type callback_)
+      {
+        callback = callback_;
+      }
+
+      //*********************************
+      /// Gets the function to call for each complete frame.
+      //*********************************
+      callback_type get_callback() const
+      {
+        return callback;
+      }
+
+      //*********************************
+      /// The number of frames dropped as invalid or too large.
+      //*********************************
+      size_t error_count() const
+      {
+        return errors;
+      }
+
+      //*********************************
+      /// The maximum number of bytes in a decoded frame.
+      //*********************************
+      size_t max_frame_size() const
+      {
+        return capacity;
+      }
+
+    protected:
+
+      //*********************************
+      frame_decoder(uint8_t* p_buffer_, size_t capacity_, callback_type callback_)
+        : p_buffer(p_buffer_)
+        , capacity(capacity_)
+        , size(0U)
+        , errors(0U)
+        , discarding(false)
+        , callback(callback_)
+      {
+      }
+
+      //*********************************
+      /// Appends decoded bytes to the frame.
+      //*********************************
+      void append(const uint8_t* p, size_t n)
+      {
+        if (!discarding)
+        {
+          if (n > (capacity - size))
+          {
+            discarding = true;
+          }
+          else
+          {
+            memcpy(p_buffer + size, p, n);
+            size += n;
+          }
+        }
+      }
+
+      //*********************************
+      void append(uint8_t value)
+      {
+        append(&value, 1U);
+      }
+
+      //*********************************
+      /// Ends the frame, passing the first length bytes to the callback if valid.
+      /// Returns true if the frame was passed.
+      //*********************************
+      bool deliver(size_t length, bool valid)
+      {
+        bool delivered = false;
+
+        if (discarding || !valid)
+        {
+          ++errors;
+        }
+        else
+        {
+          callback.call_if(etl::span<const uint8_t>(p_buffer, length));
+          delivered = true;
+        }
+
+        clear();
+
+        return delivered;
+      }
+
+      //*********************************
+      /// Drops the frame.
+      //*********************************
+      void drop()
+      {
+        ++errors;
+        clear();
+      }
+
+      //*********************************
+      /// Starts a new frame.
+      //*********************************
+      void clear()
+      {
+        size       = 0U;
+        discarding = false;
+      }
+
+      //*********************************
+      void clear_errors()
+      {
+        errors = 0U;
+      }
+
+      uint8_t* const p_buffer;
+      const size_t   capacity;
+      size_t         size;
+      size_t         errors;
+      bool           discarding;
+      callback_type  callback;
+
+    private:
+
+      frame_decoder(const frame_decoder&) ETL_DELETE;
+      frame_decoder& operator =(const frame_decoder&) ETL_DELETE;
+    };
+  }
+
+  //***************************************************************************
+  /// Streaming COBS encoder.
+  /// Consistent Overhead Byte Stuffing removes every zero from the payload,
+  /// so that zero can delimit frames, at a cost of one byte in 254.
+  /// Up to 254 bytes are held between calls, until a block is complete.
+  /// Call finish() after the last chunk of a frame to write the final block
+  /// and the zero delimiter.
+  ///\ingroup framing
+  //***************************************************************************
+  class cobs_encoder
+  {
+  public:
+
+    static ETL_CONSTANT size_t  Max_Block_Size = 254U;
+    static ETL_CONSTANT uint8_t Delimiter      = 0U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    cobs_encoder()
+      : block_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Discards any held bytes, ready for a new frame.
+    //*************************************************************************
+    void reset()
+    {
+      block_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Encodes the next chunk of the frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    size_t encode(const uint8_t* input, size_t input_length, uint8_t* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= encode_size(input_length), ETL_ERROR(framing_overflow), 0U);
+
+      const uint8_t* const input_end = input + input_length;
+
+      uint8_t* p_out = output;
+
+      while (input != input_end)
+      {
+        if (block_size == Max_Block_Size)
+        {
+          // A full block has no implied zero.
+          p_out = write_block(p_out, 0xFFU);
+        }
+
+        const size_t         space     = Max_Block_Size - block_size;
+        const uint8_t*       run_end   = (static_cast<size_t>(input_end - input) > space) ? input + space : input_end;
+        const uint8_t* const zero      = private_framing::find(input, run_end, Delimiter);
+        const size_t         run_size  = static_cast<size_t>(zero - input);
+
+        memcpy(block + block_size, input, run_size);
+        block_size += run_size;
+        input       = zero;
+
+        if (zero != run_end)
+        {
+          // The zero is replaced by the block's code.
+          p_out = write_block(p_out, static_cast<uint8_t>(block_size + 1U));
+          ++input;
+        }
+      }
+
+      return static_cast<size_t>(p_out - output);
+    }
+
+    //*************************************************************************
+    /// Encodes the next chunk of the frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    template <size_t Length1, size_t Length2>
+    size_t encode(const etl::span<const uint8_t, Length1>& input_span, const etl::span<uint8_t, Length2>& output_span)
+    {
+      return encode(input_span.data(), input_span.size(), output_span.data(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// Writes the final block and the delimiter, ready for a new frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    size_t finish(uint8_t* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= finish_size(), ETL_ERROR(framing_overflow), 0U);
+
+      uint8_t* p_out = write_block(output, (block_size == Max_Block_Size) ? 0xFFU : static_cast<uint8_t>(block_size + 1U));
+
+      *p_out++ = Delimiter;
+
+      return static_cast<size_t>(p_out - output);
+    }
+
+    //*************************************************************************
+    /// Writes the final block and the delimiter, ready for a new frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    template <size_t Length>
+    size_t finish(const etl::span<uint8_t, Length>& output_span)
+    {
+      return finish(output_span.data(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// The maximum number of bytes that encode() will write for the next input_length bytes.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t encode_size(size_t input_length) const
+    {
+      const size_t total = block_size + input_length;
+
+      return total + (total / Max_Block_Size);
+    }
+
+    //*************************************************************************
+    /// The number of bytes that finish() will write.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t finish_size() const
+    {
+      return block_size + 2U;
+    }
+
+    //*************************************************************************
+    /// The maximum size of a whole encoded frame, including the delimiter.
+    //*************************************************************************
+    ETL_NODISCARD
+    static ETL_CONSTEXPR size_t max_frame_size(size_t payload_size)
+    {
+      return payload_size + (payload_size / Max_Block_Size) + 2U;
+    }
+
+  private:
+
+    //*************************************************************************
+    uint8_t* write_block(uint8_t* p_out, uint8_t code)
+    {
+      *p_out++ = code;
+      memcpy(p_out, block, block_size);
+      p_out += block_size;
+      block_size = 0U;
+
+      return p_out;
+    }
+
+    uint8_t block[Max_Block_Size];
+    size_t  block_size;
+  };
+
+  //***************************************************************************
+  /// Streaming COBS decoder.
+  /// Complete frames are passed to the callback. Frames that are malformed,
+  /// or too large for the buffer, are dropped and counted.
+  ///\ingroup framing
+  //***************************************************************************
+  class icobs_decoder : public private_framing::frame_decoder
+  {
+  public:
+
+    //*************************************************************************
+    /// Decodes the next chunk of received bytes.
+    /// Returns the number of frames passed to the callback.
+    //*************************************************************************
+    size_t decode(const uint8_t* input, size_t input_length)
+    {
+      const uint8_t* const input_end = input + input_length;
+
+      size_t frames = 0U;
+
+      while (input != input_end)
+      {
+        if (remaining == 0U)
+        {
+          const uint8_t code = *input++;
+
+          if (code == cobs_encoder::Delimiter)
+          {
+            if (started)
+            {
+              frames += deliver(size, true) ? 1U : 0U;
+            }
+
+            zero_pending = false;
+            started      = false;
+          }
+          else
+          {
+            if (zero_pending)
+            {
+              append(uint8_t(0U));
+            }
+
+            remaining    = code - 1U;
+            zero_pending = (code != 0xFFU);
+            started      = true;
+          }
+        }
+        else
+        {
+          const uint8_t*       run_end = (static_cast<size_t>(input_end - input) > remaining) ? input + remaining : input_end;
+          const uint8_t* const zero    = private_framing::find(input, run_end, cobs_encoder::Delimiter);
+
+          append(input, static_cast<size_t>(zero - input));
+          remaining -= static_cast<size_t>(zero - input);
+          input      = zero;
+
+          if (zero != run_end)
+          {
+            // A delimiter within a block. Drop the frame and resynchronise.
+            drop();
+            ++input;
+            remaining    = 0U;
+            zero_pending = false;
+            started      = false;
+          }
+        }
+      }
+
+      return frames;
+    }
+
+    //*************************************************************************
+    /// Decodes the next chunk of received bytes.
+    /// Returns the number of frames passed to the callback.
+    //*************************************************************************
+    template <size_t Length>
+    size_t decode(const etl::span<const uint8_t, Length>& input_span)
+    {
+      return decode(input_span.data(), input_span.size());
+    }
+
+    //*************************************************************************
+    /// Discards any partial frame and the error count.
+    //*************************************************************************
+    void reset()
+    {
+      clear();
+      clear_errors();
+      remaining    = 0U;
+      zero_pending = false;
+      started      = false;
+    }
+
+  protected:
+
+    //*************************************************************************
+    icobs_decoder(uint8_t* p_buffer_, size_t capacity_, callback_type callback_)
+      : frame_decoder(p_buffer_, capacity_, callback_)
+      , remaining(0U)
+      , zero_pending(false)
+      , started(false)
+    {
+    }
+
+  private:
+
+    size_t remaining;    ///< The bytes left in the current block.
+    bool   zero_pending; ///< The current block ends with an implied zero, unless it is the last.
+    bool   started;      ///< A code byte has been received since the last delimiter.
+  };
+
+  //***************************************************************************
+  /// Streaming COBS decoder, for frames of up to Max_Frame_Size bytes.
+  ///\ingroup framing
+  //***************************************************************************
+  template <size_t Max_Frame_Size>
+  class cobs_decoder : public etl::icobs_decoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Frame_Size > 0U, "Max_Frame_Size must be greater than zero");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit cobs_decoder(callback_type callback_ = callback_type())
+      : icobs_decoder(buffer, Max_Frame_Size, callback_)
+    {
+    }
+
+  private:
+
+    uint8_t buffer[Max_Frame_Size];
+  };
+
+  //***************************************************************************
+  /// Streaming SLIP encoder. RFC 1055.
+  /// A frame starts with END, to flush any line noise, and ends with END.
+  /// END and ESC in the payload are replaced by ESC ESC_END and ESC ESC_ESC.
+  ///\ingroup framing
+  //***************************************************************************
+  class slip_encoder
+  {
+  public:
+
+    static ETL_CONSTANT uint8_t End     = 0xC0U;
+    static ETL_CONSTANT uint8_t Esc     = 0xDBU;
+    static ETL_CONSTANT uint8_t Esc_End = 0xDCU;
+    static ETL_CONSTANT uint8_t Esc_Esc = 0xDDU;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    slip_encoder()
+      : in_frame(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Ready for a new frame.
+    //*************************************************************************
+    void reset()
+    {
+      in_frame = false;
+    }
+
+    //*************************************************************************
+    /// Encodes the next chunk of the frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    size_t encode(const uint8_t* input, size_t input_length, uint8_t* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= encode_size(input_length), ETL_ERROR(framing_overflow), 0U);
+
+      const uint8_t* const input_end = input + input_length;
+
+      uint8_t* p_out = output;
+
+      if (!in_frame)
+      {
+        *p_out++ = End;
+        in_frame = true;
+      }
+
+      while (input != input_end)
+      {
+        const uint8_t* const special = private_framing::find_either(input, input_end, End, Esc);
+        const size_t         run     = static_cast<size_t>(special - input);
+
+        memcpy(p_out, input, run);
+        p_out += run;
+        input  = special;
+
+        if (special != input_end)
+        {
+          *p_out++ = Esc;
+
+          if (*input++ == End)
+          {
+            *p_out++ = Esc_End;
+          }
+          else
+          {
+            *p_out++ = Esc_Esc;
+          }
+        }
+      }
+
+      return static_cast<size_t>(p_out - output);
+    }
+
+    //*************************************************************************
+    /// Encodes the next chunk of the frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    template <size_t Length1, size_t Length2>
+    size_t encode(const etl::span<const uint8_t, Length1>& input_span, const etl::span<uint8_t, Length2>& output_span)
+    {
+      return encode(input_span.data(), input_span.size(), output_span.data(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// Ends the frame, ready for a new frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    size_t finish(uint8_t* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= finish_size(), ETL_ERROR(framing_overflow), 0U);
+
+      uint8_t* p_out = output;
+
+      if (!in_frame)
+      {
+        *p_out++ = End;
+      }
+
+      *p_out++ = End;
+      in_frame = false;
+
+      return static_cast<size_t>(p_out - output);
+    }
+
+    //*************************************************************************
+    /// Ends the frame, ready for a new frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    template <size_t Length>
+    size_t finish(const etl::span<uint8_t, Length>& output_span)
+    {
+      return finish(output_span.data(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// The maximum number of bytes that encode() will write for the next input_length bytes.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t encode_size(size_t input_length) const
+    {
+      return (in_frame ? 0U : 1U) + (2U * input_length);
+    }
+
+    //*************************************************************************
+    /// The number of bytes that finish() will write.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t finish_size() const
+    {
+      return in_frame ? 1U : 2U;
+    }
+
+    //*************************************************************************
+    /// The maximum size of a whole encoded frame.
+    //*************************************************************************
+    ETL_NODISCARD
+    static ETL_CONSTEXPR size_t max_frame_size(size_t payload_size)
+    {
+      return (2U * payload_size) + 2U;
+    }
+
+  private:
+
+    bool in_frame;
+  };
+
+  //***************************************************************************
+  /// Streaming SLIP decoder. RFC 1055.
+  /// Complete frames are passed to the callback. Empty frames are ignored.
+  /// Frames with invalid escapes, or too large for the buffer, are dropped and counted.
+  ///\ingroup framing
+  //***************************************************************************
+  class islip_decoder : public private_framing::frame_decoder
+  {
+  public:
+
+    //*************************************************************************
+    /// Decodes the next chunk of received bytes.
+    /// Returns the number of frames passed to the callback.
+    //*************************************************************************
+    size_t decode(const uint8_t* input, size_t input_length)
+    {
+      const uint8_t* const input_end = input + input_length;
+
+      size_t frames = 0U;
+
+      while (input != input_end)
+      {
+        if (escaped)
+        {
+          const uint8_t value = *input++;
+
+          escaped = false;
+
+          if (value == slip_encoder::Esc_End)
+          {
+            append(slip_encoder::End);
+          }
+          else if (value == slip_encoder::Esc_Esc)
+          {
+            append(slip_encoder::Esc);
+          }
+          else
+          {
+            invalid = true;
+
+            if (value == slip_encoder::End)
+            {
+              frames += end_frame() ? 1U : 0U;
+            }
+          }
+        }
+        else
+        {
+          const uint8_t* const special = private_framing::find_either(input, input_end, slip_encoder::End, slip_encoder::Esc);
+
+          append(input, static_cast<size_t>(special - input));
+          input = special;
+
+          if (special != input_end)
+          {
+            if (*input++ == slip_encoder::End)
+            {
+              frames += end_frame() ? 1U : 0U;
+            }
+            else
+            {
+              escaped = true;
+            }
+          }
+        }
+      }
+
+      return frames;
+    }
+
+    //*************************************************************************
+    /// Decodes the next chunk of received bytes.
+    /// Returns the number of frames passed to the callback.
+    //*************************************************************************
+    template <size_t Length>
+    size_t decode(const etl::span<const uint8_t, Length>& input_span)
+    {
+      return decode(input_span.data(), input_span.size());
+    }
+
+    //*************************************************************************
+    /// Discards any partial frame and the error count.
+    //*************************************************************************
+    void reset()
+    {
+      clear();
+      clear_errors();
+      escaped = false;
+      invalid = false;
+    }
+
+  protected:
+
+    //*************************************************************************
+    islip_decoder(uint8_t* p_buffer_, size_t capacity_, callback_type callback_)
+      : frame_decoder(p_buffer_, capacity_, callback_)
+      , escaped(false)
+      , invalid(false)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    bool end_frame()
+    {
+      bool delivered = false;
+
+      if ((size != 0U) || discarding || invalid)
+      {
+        delivered = deliver(size, !invalid);
+      }
+
+      invalid = false;
+
+      return delivered;
+    }
+
+    bool escaped; ///< The last byte was ESC.
+    bool invalid; ///< The frame has an invalid escape.
+  };
+
+  //***************************************************************************
+  /// Streaming SLIP decoder, for frames of up to Max_Frame_Size bytes.
+  ///\ingroup framing
+  //***************************************************************************
+  template <size_t Max_Frame_Size>
+  class slip_decoder : public etl::islip_decoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Frame_Size > 0U, "Max_Frame_Size must be greater than zero");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit slip_decoder(callback_type callback_ = callback_type())
+      : islip_decoder(buffer, Max_Frame_Size, callback_)
+    {
+    }
+
+  private:
+
+    uint8_t buffer[Max_Frame_Size];
+  };
+
+  //***************************************************************************
+  /// Streaming asynchronous HDLC encoder. RFC 1662.
+  /// A frame is Flag, payload, FCS, Flag, with Flag and Control_Escape in the
+  /// payload and FCS replaced by Control_Escape and the byte XOR 0x20.
+  /// The FCS is calculated in the same pass as the stuffing, and sent least
+  /// significant byte first.
+  ///\tparam TCrc The FCS. Default etl::crc16_x25, the 16 bit HDLC FCS.
+  ///\ingroup framing
+  //***************************************************************************
+  template <typename TCrc = etl::crc16_x25>
+  class hdlc_encoder
+  {
+  public:
+
+    typedef TCrc                       crc_type;
+    typedef typename TCrc::value_type  fcs_type;
+
+    static ETL_CONSTANT uint8_t Flag           = 0x7EU;
+    static ETL_CONSTANT uint8_t Control_Escape = 0x7DU;
+    static ETL_CONSTANT uint8_t Escape_Xor     = 0x20U;
+    static ETL_CONSTANT size_t  Fcs_Size       = sizeof(fcs_type);
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    hdlc_encoder()
+      : in_frame(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Ready for a new frame.
+    //*************************************************************************
+    void reset()
+    {
+      in_frame = false;
+    }
+
+    //*************************************************************************
+    /// Encodes the next chunk of the frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    size_t encode(const uint8_t* input, size_t input_length, uint8_t* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= encode_size(input_length), ETL_ERROR(framing_overflow), 0U);
+
+      uint8_t* p_out = start(output);
+
+      p_out = stuff(input, input + input_length, p_out);
+
+      return static_cast<size_t>(p_out - output);
+    }
+
+    //*************************************************************************
+    /// Encodes the next chunk of the frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    template <size_t Length1, size_t Length2>
+    size_t encode(const etl::span<const uint8_t, Length1>& input_span, const etl::span<uint8_t, Length2>& output_span)
+    {
+      return encode(input_span.data(), input_span.size(), output_span.data(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// Writes the FCS and the closing flag, ready for a new frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    size_t finish(uint8_t* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= finish_size(), ETL_ERROR(framing_overflow), 0U);
+
+      uint8_t* p_out = start(output);
+
+      fcs_type fcs = crc.value();
+
+      uint8_t fcs_bytes[Fcs_Size];
+
+      for (size_t i = 0U; i < Fcs_Size; ++i)
+      {
+        fcs_bytes[i] = static_cast<uint8_t>(fcs);
+        fcs = static_cast<fcs_type>(fcs >> 8U);
+      }
+
+      p_out = stuff(fcs_bytes, fcs_bytes + Fcs_Size, p_out);
+
+      *p_out++ = Flag;
+      in_frame = false;
+
+      return static_cast<size_t>(p_out - output);
+    }
+
+    //*************************************************************************
+    /// Writes the FCS and the closing flag, ready for a new frame.
+    /// Returns the number of bytes written.
+    //*************************************************************************
+    template <size_t Length>
+    size_t finish(const etl::span<uint8_t, Length>& output_span)
+    {
+      return finish(output_span.data(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// The maximum number of bytes that encode() will write for the next input_length bytes.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t encode_size(size_t input_length) const
+    {
+      return (in_frame ? 0U : 1U) + (2U * input_length);
+    }
+
+    //*************************************************************************
+    /// The maximum number of bytes that finish() will write.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t finish_size() const
+    {
+      return (in_frame ? 0U : 1U) + (2U * Fcs_Size) + 1U;
+    }
+
+    //*************************************************************************
+    /// The maximum size of a whole encoded frame.
+    //*************************************************************************
+    ETL_NODISCARD
+    static ETL_CONSTEXPR size_t max_frame_size(size_t payload_size)
+    {
+      return (2U * (payload_size + Fcs_Size)) + 2U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Writes the opening flag, if the frame has not started.
+    //*************************************************************************
+    uint8_t* start(uint8_t* p_out)
+    {
+      if (!in_frame)
+      {
+        *p_out++ = Flag;
+        crc.reset();
+        in_frame = true;
+      }
+
+      return p_out;
+    }
+
+    //*************************************************************************
+    /// Adds the bytes to the FCS, and writes them stuffed.
+    //*************************************************************************
+    uint8_t* stuff(const uint8_t* input, const uint8_t* input_end, uint8_t* p_out)
+    {
+      while (input != input_end)
+      {
+        const uint8_t* const special = private_framing::find_either(input, input_end, Flag, Control_Escape);
+        const size_t         run     = static_cast<size_t>(special - input);
+
+        crc.add(input, special);
+        memcpy(p_out, input, run);
+        p_out += run;
+        input  = special;
+
+        if (special != input_end)
+        {
+          crc.add(*input);
+          *p_out++ = Control_Escape;
+          *p_out++ = static_cast<uint8_t>(*input++ ^ Escape_Xor);
+        }
+      }
+
+      return p_out;
+    }
+
+    TCrc crc;
+    bool in_frame;
+  };
+
+  template <typename TCrc>
+  ETL_CONSTANT size_t hdlc_encoder<TCrc>::Fcs_Size;
+
+  //***************************************************************************
+  /// Streaming asynchronous HDLC decoder. RFC 1662.
+  /// Frames with a valid FCS are passed to the callback, without the FCS.
+  /// Back to back flags are ignored. Frames that are aborted, have a bad FCS,
+  /// or are too large for the buffer, are dropped and counted.
+  /// The FCS is calculated in the same pass as the unstuffing, trailing the
+  /// received bytes by the size of the FCS.
+  ///\tparam TCrc The FCS. Default etl::crc16_x25, the 16 bit HDLC FCS.
+  ///\ingroup framing
+  //***************************************************************************
+  template <typename TCrc = etl::crc16_x25>
+  class ihdlc_decoder : public private_framing::frame_decoder
+  {
+  public:
+
+    typedef TCrc                      crc_type;
+    typedef typename TCrc::value_type fcs_type;
+
+    static ETL_CONSTANT size_t Fcs_Size = sizeof(fcs_type);
+
+    //*************************************************************************
+    /// Decodes the next chunk of received bytes.
+    /// Returns the number of frames passed to the callback.
+    //*************************************************************************
+    size_t decode(const uint8_t* input, size_t input_length)
+    {
+      typedef etl::hdlc_encoder<TCrc> encoder;
+
+      const uint8_t* const input_end = input + input_length;
+
+      size_t frames = 0U;
+
+      while (input != input_end)
+      {
+        if (escaped)
+        {
+          const uint8_t value = *input++;
+
+          escaped = false;
+
+          if (value == encoder::Flag)
+          {
+            // Control_Escape then Flag aborts the frame.
+            drop();
+            restart();
+          }
+          else
+          {
+            append(static_cast<uint8_t>(value ^ encoder::Escape_Xor));
+            update_fcs();
+          }
+        }
+        else
+        {
+          const uint8_t* const special = private_framing::find_either(input, input_end, encoder::Flag, encoder::Control_Escape);
+
+          append(input, static_cast<size_t>(special - input));
+          update_fcs();
+          input = special;
+
+          if (special != input_end)
+          {
+            if (*input++ == encoder::Flag)
+            {
+              frames += end_frame() ? 1U : 0U;
+            }
+            else
+            {
+              escaped = true;
+            }
+          }
+        }
+      }
+
+      return frames;
+    }
+
+    //*************************************************************************
+    /// Decodes the next chunk of received bytes.
+    /// Returns the number of frames passed to the callback.
+    //*************************************************************************
+    template <size_t Length>
+    size_t decode(const etl::span<const uint8_t, Length>& input_span)
+    {
+      return decode(input_span.data(), input_span.size());
+    }
+
+    //*************************************************************************
+    /// Discards any partial frame and the error count.
+    //*************************************************************************
+    void reset()
+    {
+      clear_errors();
+      restart();
+    }
+
+    //*************************************************************************
+    /// The maximum number of bytes in a decoded payload.
+    //*************************************************************************
+    size_t max_frame_size() const
+    {
+      return capacity - Fcs_Size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    ihdlc_decoder(uint8_t* p_buffer_, size_t capacity_, callback_type callback_)
+      : frame_decoder(p_buffer_, capacity_, callback_)
+      , fcs_count(0U)
+      , escaped(false)
+    {
+      crc.reset();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds the bytes that cannot be part of the FCS to the running FCS.
+    //*************************************************************************
+    void update_fcs()
+    {
+      if (!discarding && (size > (fcs_count + Fcs_Size)))
+      {
+        crc.add(p_buffer + fcs_count, p_buffer + size - Fcs_Size);
+        fcs_count = size - Fcs_Size;
+      }
+    }
+
+    //*************************************************************************
+    /// Checks the FCS at the end of the received bytes.
+    //*************************************************************************
+    bool fcs_valid() const
+    {
+      fcs_type fcs = 0U;
+
+      for (size_t i = 0U; i < Fcs_Size; ++i)
+      {
+        fcs = static_cast<fcs_type>((fcs << 8U) | p_buffer[size - 1U - i]);
+      }
+
+      return fcs == crc.value();
+    }
+
+    //*************************************************************************
+    bool end_frame()
+    {
+      bool delivered = false;
+
+      if ((size != 0U) || discarding)
+      {
+        const bool valid = !discarding && (size >= Fcs_Size) && fcs_valid();
+
+        delivered = deliver(valid ? size - Fcs_Size : 0U, valid);
+      }
+
+      restart();
+
+      return delivered;
+    }
+
+    //*************************************************************************
+    void restart()
+    {
+      clear();
+      crc.reset();
+      fcs_count = 0U;
+      escaped   = false;
+    }
+
+    TCrc   crc;
+    size_t fcs_count; ///< The number of received bytes in the FCS.
+    bool   escaped;   ///< The last byte was Control_Escape.
+  };
+
+  template <typename TCrc>
+  ETL_CONSTANT size_t ihdlc_decoder<TCrc>::Fcs_Size;
+
+  //***************************************************************************
+  /// Streaming asynchronous HDLC decoder, for payloads of up to Max_Frame_Size bytes.
+  ///\ingroup framing
+  //***************************************************************************
+  template <size_t Max_Frame_Size, typename TCrc = etl::crc16_x25>
+  class hdlc_decoder : public etl::ihdlc_decoder<TCrc>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Frame_Size > 0U, "Max_Frame_Size must be greater than zero");
+
+    typedef typename etl::ihdlc_decoder<TCrc>::callback_type callback_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit hdlc_decoder(callback_type callback_ = callback_type())
+      : etl::ihdlc_decoder<TCrc>(buffer, Max_Frame_Size + etl::ihdlc_decoder<TCrc>::Fcs_Size, callback_)
+    {
+    }
+
+  private:
+
+    uint8_t buffer[Max_Frame_Size + sizeof(typename TCrc::value_type)];
+  };
+}
+
+#endif
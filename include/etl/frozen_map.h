@@ -0,0 +1,519 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FROZEN_MAP_INCLUDED
+#define ETL_FROZEN_MAP_INCLUDED
+
+#include "platform.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "functional.h"
+#include "static_assert.h"
+#include "string_view.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup frozen_map frozen_map
+/// A read only map whose layout is fixed by a minimal perfect hash.
+/// From C++14 the hash is found, and the table built, at compile time.
+/// A lookup is one hash of the key, one table index and one key compare.
+///\ingroup containers
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for frozen maps.
+  ///\ingroup frozen_map
+  //***************************************************************************
+  class frozen_map_exception : public etl::exception
+  {
+  public:
+
+    frozen_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for frozen maps.
+  ///\ingroup frozen_map
+  //***************************************************************************
+  class frozen_map_out_of_range : public etl::frozen_map_exception
+  {
+  public:
+
+    frozen_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : frozen_map_exception(ETL_ERROR_TEXT("frozen_map:range", ETL_FROZEN_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Build failure exception for frozen maps.
+  /// The keys are duplicated, or no perfect hash was found for them.
+  ///\ingroup frozen_map
+  //***************************************************************************
+  class frozen_map_build_failed : public etl::frozen_map_exception
+  {
+  public:
+
+    frozen_map_build_failed(string_type file_name_, numeric_type line_number_)
+      : frozen_map_exception(ETL_ERROR_TEXT("frozen_map:build failed", ETL_FROZEN_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_frozen_map
+  {
+    //*************************************************************************
+    /// The 32 bit finaliser from MurmurHash3.
+    //*************************************************************************
+    ETL_CONSTEXPR14 uint32_t mix(uint32_t h)
+    {
+      h ^= h >> 16U;
+      h *= 0x85EBCA6BUL;
+      h ^= h >> 13U;
+      h *= 0xC2B2AE35UL;
+      h ^= h >> 16U;
+
+      return h;
+    }
+
+    //*************************************************************************
+    /// Not constexpr, so that a map that cannot be built at compile time
+    /// is a compile error at the point of construction.
+    //*************************************************************************
+    inline void frozen_map_keys_are_duplicated_or_have_no_perfect_hash()
+    {
+    }
+  }
+
+  //***************************************************************************
+  /// The seeded hashes used by etl::frozen_map.
+  /// A user supplied hash must provide the same seeded call operator.
+  /// Defined for integral, enum and string view keys.
+  ///\ingroup frozen_map
+  //***************************************************************************
+  template <typename TKey, typename TEnable = void>
+  struct frozen_hash;
+
+  //***************************************************************************
+  /// Integral and enum keys.
+  ///\ingroup frozen_map
+  //***************************************************************************
+  template <typename TKey>
+  struct frozen_hash<TKey, typename etl::enable_if<etl::is_integral<TKey>::value || etl::is_enum<TKey>::value>::type>
+  {
+    ETL_CONSTEXPR14 uint32_t operator ()(const TKey& key, uint32_t seed) const
+    {
+      const uint64_t value = static_cast<uint64_t>(key);
+
+      uint32_t h = private_frozen_map::mix(static_cast<uint32_t>(value) ^ seed);
+
+      if (sizeof(TKey) > sizeof(uint32_t))
+      {
+        h = private_frozen_map::mix(h ^ static_cast<uint32_t>(value >> 32U));
+      }
+
+      return h;
+    }
+  };
+
+  //***************************************************************************
+  /// String view keys. A seeded FNV-1a, then finalised.
+  ///\ingroup frozen_map
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  struct frozen_hash<etl::basic_string_view<T, TTraits>, void>
+  {
+    ETL_CONSTEXPR14 uint32_t operator ()(const etl::basic_string_view<T, TTraits>& key, uint32_t seed) const
+    {
+      uint32_t h = 2166136261UL ^ seed;
+
+      const T* p = key.data();
+
+      for (size_t i = 0U; i < key.size(); ++i)
+      {
+        h ^= static_cast<uint32_t>(p[i]);
+        h *= 16777619UL;
+      }
+
+      return private_frozen_map::mix(h);
+    }
+  };
+
+  //***************************************************************************
+  /// A read only map of Size_ elements, laid out by a minimal perfect hash.
+  /// Uses a PTHash style displacement. Each key hashes once; the high bits
+  /// of the hash choose a bucket, and the bucket's pilot value moves the key
+  /// to its own slot. Every slot holds an element, so there are no empty slots
+  /// and no chains.
+  /// From C++14, a constexpr map is built entirely at compile time. Duplicate
+  /// keys are then a compile error. In C++11 the map is built when constructed
+  /// and duplicate keys raise etl::frozen_map_build_failed.
+  ///\tparam TKey      The key type.
+  ///\tparam TMapped   The mapped type.
+  ///\tparam Size_     The number of elements.
+  ///\tparam THash     The seeded hash. See etl::frozen_hash.
+  ///\tparam TKeyEqual The key compare.
+  ///\ingroup frozen_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t Size_, typename THash = etl::frozen_hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class frozen_map
+  {
+  public:
+
+    typedef TKey                          key_type;
+    typedef TMapped                       mapped_type;
+    typedef etl::pair<TKey, TMapped>      value_type;
+    typedef const value_type&             const_reference;
+    typedef const value_type*             const_pointer;
+    typedef const value_type*             const_iterator;
+    typedef size_t                        size_type;
+    typedef THash                         hasher;
+    typedef TKeyEqual                     key_equal;
+
+    ETL_STATIC_ASSERT((Size_ > 0U), "etl::frozen_map must have at least one element");
+    ETL_STATIC_ASSERT((Size_ <= 0xFFFFFFFFUL), "etl::frozen_map is too large");
+
+    static ETL_CONSTANT size_t   SIZE      = Size_;
+    static ETL_CONSTANT uint32_t Max_Seeds = 64U;
+    static ETL_CONSTANT uint32_t Max_Pilot = 0xFFFFU;
+
+    //*************************************************************************
+    /// Builds the map from the elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 explicit frozen_map(const value_type (&elements)[Size_])
+      : values()
+      , pilots()
+      , seed(0U)
+    {
+      build(elements);
+    }
+
+    //*************************************************************************
+    /// Finds the element for a key.
+    /// Returns end() if the key is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator find(const key_type& key) const
+    {
+      const size_t slot = slot_of(hasher()(key, seed));
+
+      return key_equal()(values[slot].first, key) ? &values[slot] : end();
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(const key_type& key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Counts the elements with the key. Zero or one.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the mapped value for a key.
+    /// If asserts or exceptions are enabled, emits etl::frozen_map_out_of_range
+    /// if the key is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const mapped_type& at(const key_type& key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(frozen_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// The elements, in slot order.
+    //*************************************************************************
+    ETL_CONSTEXPR const_iterator begin() const
+    {
+      return values;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR const_iterator end() const
+    {
+      return values + Size_;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR const_iterator cbegin() const
+    {
+      return values;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR const_iterator cend() const
+    {
+      return values + Size_;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR size_type size() const
+    {
+      return Size_;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return Size_;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR bool empty() const
+    {
+      return false;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The bucket for a hash, from its high bits.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t bucket_of(uint32_t h)
+    {
+      return (static_cast<uint64_t>(h) * Size_) >> 32U;
+    }
+
+    //*************************************************************************
+    /// The slot for a hash, moved by a pilot.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t slot_of(uint32_t h, uint32_t pilot)
+    {
+      return (h ^ private_frozen_map::mix((pilot * 0x9E3779B9UL) + 0x7F4A7C15UL)) % Size_;
+    }
+
+    //*************************************************************************
+    /// The slot for a hash.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t slot_of(uint32_t h) const
+    {
+      return slot_of(h, pilots[bucket_of(h)]);
+    }
+
+    //*************************************************************************
+    /// Finds a seed for which every bucket can be given a pilot.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void build(const value_type (&elements)[Size_])
+    {
+      bool built = !has_duplicate_keys(elements);
+
+      if (built)
+      {
+        built = false;
+
+        for (uint32_t s = 0U; (s < Max_Seeds) && !built; ++s)
+        {
+          seed  = private_frozen_map::mix(s + 1U);
+          built = try_build(elements);
+        }
+      }
+
+      if (!built)
+      {
+        private_frozen_map::frozen_map_keys_are_duplicated_or_have_no_perfect_hash();
+        ETL_ASSERT_FAIL(ETL_ERROR(frozen_map_build_failed));
+      }
+    }
+
+    //*************************************************************************
+    /// Checks for keys that appear more than once.
+    /// Only keys with equal hashes are compared.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 bool has_duplicate_keys(const value_type (&elements)[Size_])
+    {
+      uint32_t hashes[Size_] = {};
+
+      for (size_t i = 0U; i < Size_; ++i)
+      {
+        hashes[i] = hasher()(elements[i].first, 0U);
+
+        for (size_t j = 0U; j < i; ++j)
+        {
+          if ((hashes[j] == hashes[i]) && key_equal()(elements[j].first, elements[i].first))
+          {
+            return true;
+          }
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Tries to place every key with the current seed.
+    /// The largest buckets are placed first, while the table is empty.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool try_build(const value_type (&elements)[Size_])
+    {
+      uint32_t hashes[Size_]        = {};
+      size_t   bucket_size[Size_]   = {};
+      size_t   bucket_start[Size_]  = {};
+      size_t   bucket_fill[Size_]   = {};
+      size_t   ordered[Size_]       = {}; // Element indexes, grouped by bucket.
+      bool     taken[Size_]         = {};
+      size_t   largest              = 0U;
+
+      for (size_t i = 0U; i < Size_; ++i)
+      {
+        hashes[i] = hasher()(elements[i].first, seed);
+
+        const size_t b = bucket_of(hashes[i]);
+
+        ++bucket_size[b];
+        largest = (bucket_size[b] > largest) ? bucket_size[b] : largest;
+      }
+
+      size_t start = 0U;
+
+      for (size_t b = 0U; b < Size_; ++b)
+      {
+        bucket_start[b] = start;
+        start += bucket_size[b];
+        pilots[b] = 0U;
+      }
+
+      for (size_t i = 0U; i < Size_; ++i)
+      {
+        const size_t b = bucket_of(hashes[i]);
+
+        ordered[bucket_start[b] + bucket_fill[b]] = i;
+        ++bucket_fill[b];
+      }
+
+      for (size_t n = largest; n != 0U; --n)
+      {
+        for (size_t b = 0U; b < Size_; ++b)
+        {
+          if (bucket_size[b] == n)
+          {
+            if (!place_bucket(hashes, ordered + bucket_start[b], n, taken, pilots[b]))
+            {
+              return false;
+            }
+          }
+        }
+      }
+
+      for (size_t i = 0U; i < Size_; ++i)
+      {
+        const size_t slot = slot_of(hashes[i]);
+
+        values[slot].first  = elements[i].first;
+        values[slot].second = elements[i].second;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Finds the first pilot that moves all of a bucket's keys to free slots.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 bool place_bucket(const uint32_t (&hashes)[Size_], const size_t* indexes, size_t n, bool (&taken)[Size_], uint16_t& pilot)
+    {
+      for (uint32_t p = 0U; p <= Max_Pilot; ++p)
+      {
+        bool fits = true;
+
+        for (size_t k = 0U; (k < n) && fits; ++k)
+        {
+          const size_t slot = slot_of(hashes[indexes[k]], p);
+
+          fits = !taken[slot];
+
+          // Keys in the same bucket must not share a slot either.
+          for (size_t j = 0U; (j < k) && fits; ++j)
+          {
+            fits = (slot_of(hashes[indexes[j]], p) != slot);
+          }
+        }
+
+        if (fits)
+        {
+          for (size_t k = 0U; k < n; ++k)
+          {
+            taken[slot_of(hashes[indexes[k]], p)] = true;
+          }
+
+          pilot = static_cast<uint16_t>(p);
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    value_type values[Size_];
+    uint16_t   pilots[Size_];
+    uint32_t   seed;
+  };
+
+  template <typename TKey, typename TMapped, size_t Size_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t frozen_map<TKey, TMapped, Size_, THash, TKeyEqual>::SIZE;
+
+  template <typename TKey, typename TMapped, size_t Size_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT uint32_t frozen_map<TKey, TMapped, Size_, THash, TKeyEqual>::Max_Seeds;
+
+  template <typename TKey, typename TMapped, size_t Size_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT uint32_t frozen_map<TKey, TMapped, Size_, THash, TKeyEqual>::Max_Pilot;
+
+  //***************************************************************************
+  /// Makes a frozen map, deducing its size from the elements.
+  /// constexpr auto commands = etl::make_frozen_map<int, handler_t>({ { 1, &on_start }, { 2, &on_stop } });
+  ///\ingroup frozen_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t Size_>
+  ETL_CONSTEXPR14 etl::frozen_map<TKey, TMapped, Size_> make_frozen_map(const etl::pair<TKey, TMapped> (&elements)[Size_])
+  {
+    return etl::frozen_map<TKey, TMapped, Size_>(elements);
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,469 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FSM_CT_INCLUDED
+#define ETL_FSM_CT_INCLUDED
+
+#include "platform.h"
+#include "fsm.h"
+#include "message.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+
+///\defgroup fsm_ct Compile time FSM
+/// A finite state machine with the states fixed at compile time.
+/// There are no virtual functions. The current state is an index, and events
+/// and state changes are dispatched through tables of direct calls.
+///\code
+/// class Idle : public etl::fsm_ct_state<Motor, Idle, StateId::Idle, Start>
+/// {
+/// public:
+///   etl::fsm_state_id_t on_event(const Start&) { return StateId::Running; }
+/// };
+///
+/// etl::fsm_ct<Motor, Idle, Running> fsm(motor);
+/// fsm.start();
+/// fsm.receive(Start()); // One indirect call to Idle::on_event(const Start&).
+///\endcode
+///\ingroup fsm
+
+#if ETL_USING_CPP17
+
+namespace etl
+{
+  template <typename TContext, typename... TStates>
+  class fsm_ct;
+
+  //***************************************************************************
+  /// The base for the states of an etl::fsm_ct.
+  /// The derived state defines on_event(const TMessage&) for each of the
+  /// message types, and may define on_event_unknown(const etl::imessage&),
+  /// on_enter_state() and on_exit_state(), as for etl::fsm_state. None of
+  /// them are virtual.
+  ///\tparam TContext     The type passed to the fsm_ct.
+  ///\tparam TDerived     The derived state type.
+  ///\tparam STATE_ID_    The state id. Must match its position in the fsm_ct.
+  ///\tparam TMessageTypes The message types handled by the state.
+  ///\ingroup fsm_ct
+  //***************************************************************************
+  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_, typename... TMessageTypes>
+  class fsm_ct_state : public private_fsm::ifsm_state_helper<>
+  {
+  public:
+
+    template <typename, typename...>
+    friend class etl::fsm_ct;
+
+    static constexpr etl::fsm_state_id_t STATE_ID = STATE_ID_;
+
+    //*******************************************
+    /// Gets the id for this state.
+    //*******************************************
+    static constexpr etl::fsm_state_id_t get_state_id()
+    {
+      return STATE_ID;
+    }
+
+    //*******************************************
+    /// By default, no state change on entry.
+    //*******************************************
+    etl::fsm_state_id_t on_enter_state()
+    {
+      return No_State_Change;
+    }
+
+    //*******************************************
+    /// By default, nothing on exit.
+    //*******************************************
+    void on_exit_state()
+    {
+    }
+
+    //*******************************************
+    /// By default, unknown messages are ignored.
+    //*******************************************
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+
+  protected:
+
+    fsm_ct_state()
+      : p_context(ETL_NULLPTR)
+    {
+    }
+
+    ~fsm_ct_state()
+    {
+    }
+
+    TContext& get_fsm_context() const
+    {
+      return *p_context;
+    }
+
+  private:
+
+    //********************************************
+    /// A message of a type known at compile time.
+    //********************************************
+    template <typename TMessage>
+    etl::fsm_state_id_t process_event(const TMessage& message)
+    {
+      if constexpr ((etl::is_same<TMessage, TMessageTypes>::value || ...))
+      {
+        return static_cast<TDerived*>(this)->on_event(message);
+      }
+      else
+      {
+        return static_cast<TDerived*>(this)->on_event_unknown(message);
+      }
+    }
+
+    //********************************************
+    /// A message known only by its id.
+    //********************************************
+    etl::fsm_state_id_t process_event(const etl::imessage& message)
+    {
+      etl::fsm_state_id_t new_state_id = No_State_Change;
+
+      const bool was_handled = (process_event_type<TMessageTypes>(message, new_state_id) || ...);
+
+      if (!was_handled)
+      {
+        new_state_id = static_cast<TDerived*>(this)->on_event_unknown(message);
+      }
+
+      return new_state_id;
+    }
+
+    //********************************************
+    template <typename TMessage>
+    bool process_event_type(const etl::imessage& message, etl::fsm_state_id_t& new_state_id)
+    {
+      if (TMessage::ID == message.get_message_id())
+      {
+        new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const TMessage&>(message));
+        return true;
+      }
+
+      return false;
+    }
+
+    TContext* p_context;
+
+    // Disabled.
+    fsm_ct_state(const fsm_ct_state&) ETL_DELETE;
+    fsm_ct_state& operator =(const fsm_ct_state&) ETL_DELETE;
+  };
+
+  namespace private_fsm_ct
+  {
+    //*************************************************************************
+    /// Holds one state, tagged with its index.
+    //*************************************************************************
+    template <size_t Index, typename TState>
+    struct state_holder
+    {
+      TState state;
+    };
+
+    //*************************************************************************
+    /// Holds all of the states.
+    //*************************************************************************
+    template <typename TIndices, typename... TStates>
+    struct state_storage;
+
+    template <size_t... Indices, typename... TStates>
+    struct state_storage<etl::index_sequence<Indices...>, TStates...> : state_holder<Indices, TStates>...
+    {
+    };
+
+    //*************************************************************************
+    /// Gets the state at an index.
+    //*************************************************************************
+    template <size_t Index, typename TState>
+    TState& get_state(state_holder<Index, TState>& holder)
+    {
+      return holder.state;
+    }
+
+    template <size_t Index, typename TState>
+    const TState& get_state(const state_holder<Index, TState>& holder)
+    {
+      return holder.state;
+    }
+
+    //*************************************************************************
+    /// Checks that the state ids match their positions.
+    //*************************************************************************
+    template <typename TIndices, typename... TStates>
+    struct ids_in_order;
+
+    template <size_t... Indices, typename... TStates>
+    struct ids_in_order<etl::index_sequence<Indices...>, TStates...>
+    {
+      static constexpr bool value = ((size_t(TStates::STATE_ID) == Indices) && ...);
+    };
+  }
+
+  //***************************************************************************
+  /// A finite state machine with states fixed at compile time.
+  /// The states are held by the FSM and are listed in order of state id.
+  /// Handlers may return a state id, No_State_Change or Self_Transition.
+  ///\tparam TContext The type returned by get_fsm_context() in the states.
+  ///\tparam TStates  The state types, derived from etl::fsm_ct_state.
+  ///\ingroup fsm_ct
+  //***************************************************************************
+  template <typename TContext, typename... TStates>
+  class fsm_ct : public private_fsm::ifsm_state_helper<>
+  {
+  public:
+
+    static constexpr size_t Number_Of_States = sizeof...(TStates);
+
+    ETL_STATIC_ASSERT(Number_Of_States > 0U, "No states");
+    ETL_STATIC_ASSERT(Number_Of_States < size_t(Self_Transition), "Too many states");
+    ETL_STATIC_ASSERT((private_fsm_ct::ids_in_order<etl::make_index_sequence<sizeof...(TStates)>, TStates...>::value), "State ids must match their positions");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    explicit fsm_ct(TContext& context)
+      : state_id(0U)
+      , started(false)
+    {
+      ((get_state<TStates>().p_context = &context), ...);
+    }
+
+    //*******************************************
+    /// Starts the FSM.
+    /// Can only be called once, until reset.
+    ///\param call_on_enter_state If true will call on_enter_state() for the first state. Default = true.
+    //*******************************************
+    void start(bool call_on_enter_state = true)
+    {
+      if (!started)
+      {
+        started  = true;
+        state_id = 0U;
+
+        if (call_on_enter_state)
+        {
+          etl::fsm_state_id_t next_state_id = enter_state(state_id);
+
+          // Follow any state changes made on entry.
+          while (have_changed_state(next_state_id))
+          {
+            ETL_ASSERT_OR_RETURN(next_state_id < Number_Of_States, ETL_ERROR(etl::fsm_state_id_exception));
+
+            state_id      = next_state_id;
+            next_state_id = enter_state(state_id);
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    /// Reset the FSM to pre-started state.
+    ///\param call_on_exit_state If true will call on_exit_state() for the current state. Default = false.
+    //*******************************************
+    void reset(bool call_on_exit_state = false)
+    {
+      if (started && call_on_exit_state)
+      {
+        exit_state(state_id);
+      }
+
+      started = false;
+    }
+
+    //*******************************************
+    /// Handles a message of a type known at compile time.
+    /// Calls the current state's handler through a table indexed by state.
+    //*******************************************
+    template <typename TMessage>
+    void receive(const TMessage& message)
+    {
+      if (started)
+      {
+        const etl::fsm_state_id_t next_state_id = tables::template event<TMessage>[state_id](*this, message);
+
+        if (have_changed_state(next_state_id))
+        {
+          change_state(next_state_id);
+        }
+        else if (next_state_id == Self_Transition)
+        {
+          exit_state(state_id);
+          enter_state(state_id);
+        }
+      }
+      else
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::fsm_not_started));
+      }
+    }
+
+    //*******************************************
+    /// Checks if the FSM has been started.
+    //*******************************************
+    bool is_started() const
+    {
+      return started;
+    }
+
+    //*******************************************
+    /// Gets the current state id.
+    //*******************************************
+    etl::fsm_state_id_t get_state_id() const
+    {
+      return state_id;
+    }
+
+    //*******************************************
+    /// Gets a state by type.
+    //*******************************************
+    template <typename TState>
+    TState& get_state()
+    {
+      return private_fsm_ct::get_state<TState::STATE_ID>(states);
+    }
+
+    //*******************************************
+    /// Gets a state by type.
+    //*******************************************
+    template <typename TState>
+    const TState& get_state() const
+    {
+      return private_fsm_ct::get_state<TState::STATE_ID>(states);
+    }
+
+  private:
+
+    typedef private_fsm_ct::state_storage<etl::make_index_sequence<sizeof...(TStates)>, TStates...> storage_t;
+
+    template <typename TMessage>
+    using event_function_t = etl::fsm_state_id_t(*)(fsm_ct&, const TMessage&);
+
+    typedef etl::fsm_state_id_t(*enter_function_t)(fsm_ct&);
+    typedef void(*exit_function_t)(fsm_ct&);
+
+    //*******************************************
+    template <size_t Index, typename TMessage>
+    static etl::fsm_state_id_t process_event_at(fsm_ct& fsm, const TMessage& message)
+    {
+      return private_fsm_ct::get_state<Index>(fsm.states).process_event(message);
+    }
+
+    //*******************************************
+    template <size_t Index>
+    static etl::fsm_state_id_t enter_state_at(fsm_ct& fsm)
+    {
+      return private_fsm_ct::get_state<Index>(fsm.states).on_enter_state();
+    }
+
+    //*******************************************
+    template <size_t Index>
+    static void exit_state_at(fsm_ct& fsm)
+    {
+      private_fsm_ct::get_state<Index>(fsm.states).on_exit_state();
+    }
+
+    //*******************************************
+    /// The tables of calls, indexed by state id.
+    //*******************************************
+    template <typename TIndices>
+    struct jump_tables;
+
+    template <size_t... Indices>
+    struct jump_tables<etl::index_sequence<Indices...>>
+    {
+      static constexpr enter_function_t enter[sizeof...(Indices)] = { &fsm_ct::template enter_state_at<Indices>... };
+      static constexpr exit_function_t  exit[sizeof...(Indices)]  = { &fsm_ct::template exit_state_at<Indices>... };
+
+      template <typename TMessage>
+      static constexpr event_function_t<TMessage> event[sizeof...(Indices)] = { &fsm_ct::template process_event_at<Indices, TMessage>... };
+    };
+
+    typedef jump_tables<etl::make_index_sequence<sizeof...(TStates)>> tables;
+
+    //*******************************************
+    etl::fsm_state_id_t enter_state(etl::fsm_state_id_t id)
+    {
+      return tables::enter[id](*this);
+    }
+
+    //*******************************************
+    void exit_state(etl::fsm_state_id_t id)
+    {
+      tables::exit[id](*this);
+    }
+
+    //*******************************************
+    /// Changes state, following any changes made on entry.
+    //*******************************************
+    void change_state(etl::fsm_state_id_t next_state_id)
+    {
+      do
+      {
+        ETL_ASSERT_OR_RETURN(next_state_id < Number_Of_States, ETL_ERROR(etl::fsm_state_id_exception));
+
+        exit_state(state_id);
+
+        state_id      = next_state_id;
+        next_state_id = enter_state(state_id);
+      } while (have_changed_state(next_state_id));
+    }
+
+    //*******************************************
+    bool have_changed_state(etl::fsm_state_id_t next_state_id) const
+    {
+      return (next_state_id != state_id) &&
+             (next_state_id != No_State_Change) &&
+             (next_state_id != Self_Transition);
+    }
+
+    storage_t           states;   ///< The states.
+    etl::fsm_state_id_t state_id; ///< The current state id.
+    bool                started;  ///< Set when started.
+
+    // Disabled.
+    fsm_ct(const fsm_ct&) ETL_DELETE;
+    fsm_ct& operator =(const fsm_ct&) ETL_DELETE;
+  };
+}
+
+#endif
+#endif
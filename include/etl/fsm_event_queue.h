@@ -0,0 +1,199 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FSM_EVENT_QUEUE_INCLUDED
+#define ETL_FSM_EVENT_QUEUE_INCLUDED
+
+#include "platform.h"
+#include "fsm.h"
+#include "queue.h"
+#include "queue_spsc_atomic.h"
+
+#include <stddef.h>
+
+///\defgroup fsm_event_queue FSM event queue
+/// Queues for the deferred messages of an etl::fsm or etl::hfsm.
+///\code
+/// typedef etl::message_packet<Start, Stop, Tick> Packet;
+/// etl::fsm_event_queue_spsc_atomic<Packet, 8> events;
+/// motor.set_event_queue(events);
+///
+/// void tick_isr() { motor.post(Tick()); }
+/// void main_loop() { motor.process_queue(4); }
+///\endcode
+///\ingroup fsm
+
+namespace etl
+{
+  //***************************************************************************
+  /// A queue of deferred messages, held in message packets.
+  /// Not safe for use from an interrupt.
+  ///\tparam TPacket The etl::message_packet type for the messages.
+  ///\tparam SIZE    The maximum number of messages.
+  ///\ingroup fsm_event_queue
+  //***************************************************************************
+  template <typename TPacket, size_t SIZE>
+  class fsm_event_queue : public etl::ifsm_event_queue
+  {
+  public:
+
+    typedef TPacket packet_type;
+
+    //*************************************************************************
+    /// Copies a message to the queue.
+    ///\return <b>false</b> if the queue is full or the packet cannot hold the message.
+    //*************************************************************************
+    bool push(const etl::imessage& message) ETL_OVERRIDE
+    {
+      if (queue.full() || !TPacket::accepts(message))
+      {
+        return false;
+      }
+
+      queue.emplace(message);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The oldest message.
+    //*************************************************************************
+    const etl::imessage& front() const ETL_OVERRIDE
+    {
+      return queue.front().get();
+    }
+
+    //*************************************************************************
+    /// Removes the oldest message.
+    //*************************************************************************
+    void pop() ETL_OVERRIDE
+    {
+      queue.pop();
+    }
+
+    //*************************************************************************
+    /// Is the queue empty?
+    //*************************************************************************
+    bool empty() const ETL_OVERRIDE
+    {
+      return queue.empty();
+    }
+
+    //*************************************************************************
+    /// The number of queued messages.
+    //*************************************************************************
+    size_t size() const
+    {
+      return queue.size();
+    }
+
+    //*************************************************************************
+    /// Removes all of the messages.
+    //*************************************************************************
+    void clear()
+    {
+      queue.clear();
+    }
+
+  private:
+
+    etl::queue<TPacket, SIZE> queue;
+  };
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// A queue of deferred messages, held in message packets.
+  /// Messages may be posted from one interrupt or thread, while another
+  /// handles them.
+  ///\tparam TPacket The etl::message_packet type for the messages.
+  ///\tparam SIZE    The maximum number of messages.
+  ///\ingroup fsm_event_queue
+  //***************************************************************************
+  template <typename TPacket, size_t SIZE>
+  class fsm_event_queue_spsc_atomic : public etl::ifsm_event_queue
+  {
+  public:
+
+    typedef TPacket packet_type;
+
+    //*************************************************************************
+    /// Copies a message to the queue.
+    ///\return <b>false</b> if the queue is full or the packet cannot hold the message.
+    //*************************************************************************
+    bool push(const etl::imessage& message) ETL_OVERRIDE
+    {
+      if (!TPacket::accepts(message))
+      {
+        return false;
+      }
+
+      return queue.emplace(message);
+    }
+
+    //*************************************************************************
+    /// The oldest message.
+    //*************************************************************************
+    const etl::imessage& front() const ETL_OVERRIDE
+    {
+      return queue.front().get();
+    }
+
+    //*************************************************************************
+    /// Removes the oldest message.
+    //*************************************************************************
+    void pop() ETL_OVERRIDE
+    {
+      queue.pop();
+    }
+
+    //*************************************************************************
+    /// Is the queue empty?
+    //*************************************************************************
+    bool empty() const ETL_OVERRIDE
+    {
+      return queue.empty();
+    }
+
+    //*************************************************************************
+    /// The number of queued messages.
+    //*************************************************************************
+    size_t size() const
+    {
+      return queue.size();
+    }
+
+  private:
+
+    etl::queue_spsc_atomic<TPacket, SIZE> queue;
+  };
+#endif
+}
+
+#endif
@@ -0,0 +1,956 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FUTURE_INCLUDED
+#define ETL_FUTURE_INCLUDED
+
+#include "platform.h"
+#include "ipool.h"
+#include "pool.h"
+#include "queue.h"
+#include "inplace_function.h"
+#include "alignment.h"
+#include "placement_new.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_CPP11
+
+///\defgroup future future
+/// Heap free promises and futures with continuations.
+/// Shared states are created in a user supplied etl::ipool.
+/// A continuation runs inline when the value is set, or is posted to an
+/// etl::ifuture_executor to be run later.
+/// The promises, futures and executors of a chain are not thread safe and
+/// must all be used from the same thread of execution.
+///\code
+/// etl::future_pool<int, 4> pool;
+///
+/// etl::promise<int> promise(pool);
+///
+/// etl::future<int> result = promise.get_future().then(pool, [](int& value) { return value * 2; });
+///
+/// promise.set_value(21); // result.get() == 42
+///\endcode
+///\ingroup utilities
+
+#if !defined(ETL_FUTURE_CONTINUATION_CAPACITY)
+  /// The space for each continuation's callable and captures.
+  #define ETL_FUTURE_CONTINUATION_CAPACITY (6U * sizeof(void*))
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for promise and future.
+  ///\ingroup future
+  //***************************************************************************
+  class future_exception : public etl::exception
+  {
+  public:
+
+    future_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The shared state could not be created, or there is none.
+  ///\ingroup future
+  //***************************************************************************
+  class future_no_state : public etl::future_exception
+  {
+  public:
+
+    future_no_state(string_type file_name_, numeric_type line_number_)
+      : etl::future_exception(ETL_ERROR_TEXT("future:no state", ETL_FUTURE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The future has already been retrieved from the promise.
+  ///\ingroup future
+  //***************************************************************************
+  class future_already_retrieved : public etl::future_exception
+  {
+  public:
+
+    future_already_retrieved(string_type file_name_, numeric_type line_number_)
+      : etl::future_exception(ETL_ERROR_TEXT("future:already retrieved", ETL_FUTURE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The promise already has a value.
+  ///\ingroup future
+  //***************************************************************************
+  class future_already_satisfied : public etl::future_exception
+  {
+  public:
+
+    future_already_satisfied(string_type file_name_, numeric_type line_number_)
+      : etl::future_exception(ETL_ERROR_TEXT("future:already satisfied", ETL_FUTURE_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The future does not have a value yet.
+  ///\ingroup future
+  //***************************************************************************
+  class future_not_ready : public etl::future_exception
+  {
+  public:
+
+    future_not_ready(string_type file_name_, numeric_type line_number_)
+      : etl::future_exception(ETL_ERROR_TEXT("future:not ready", ETL_FUTURE_FILE_ID"D"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The future already has a continuation.
+  ///\ingroup future
+  //***************************************************************************
+  class future_continuation_exists : public etl::future_exception
+  {
+  public:
+
+    future_continuation_exists(string_type file_name_, numeric_type line_number_)
+      : etl::future_exception(ETL_ERROR_TEXT("future:continuation exists", ETL_FUTURE_FILE_ID"E"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The executor's queue is full.
+  ///\ingroup future
+  //***************************************************************************
+  class future_executor_full : public etl::future_exception
+  {
+  public:
+
+    future_executor_full(string_type file_name_, numeric_type line_number_)
+      : etl::future_exception(ETL_ERROR_TEXT("future:executor full", ETL_FUTURE_FILE_ID"F"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The interface for executors that run posted continuations.
+  ///\ingroup future
+  //***************************************************************************
+  class ifuture_executor
+  {
+  public:
+
+    typedef void (*function_type)(void*);
+
+    virtual ~ifuture_executor() {}
+
+    //*************************************************************************
+    /// Queues function(context) to be called later.
+    //*************************************************************************
+    virtual void post(function_type function, void* context) = 0;
+  };
+
+  //***************************************************************************
+  /// An executor that queues up to Size continuations, to be run by a call to
+  /// run(), such as from an event loop.
+  ///\ingroup future
+  //***************************************************************************
+  template <size_t Size>
+  class future_queue_executor : public etl::ifuture_executor
+  {
+  public:
+
+    //*************************************************************************
+    /// Queues function(context) to be called by run().
+    //*************************************************************************
+    virtual void post(function_type function, void* context) ETL_OVERRIDE
+    {
+      ETL_ASSERT_OR_RETURN(!items.full(), ETL_ERROR(etl::future_executor_full));
+
+      item i = { function, context };
+      items.push(i);
+    }
+
+    //*************************************************************************
+    /// Runs the queued continuations, including any that they post.
+    /// Returns the number that were run.
+    //*************************************************************************
+    size_t run()
+    {
+      size_t count = 0U;
+
+      while (!items.empty())
+      {
+        item i = items.front();
+        items.pop();
+
+        i.function(i.context);
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there is nothing queued.
+    //*************************************************************************
+    bool empty() const
+    {
+      return items.empty();
+    }
+
+    //*************************************************************************
+    /// Returns the number of queued continuations.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items.size();
+    }
+
+  private:
+
+    struct item
+    {
+      function_type function;
+      void*         context;
+    };
+
+    etl::queue<item, Size> items;
+  };
+
+  template <typename T>
+  class promise;
+
+  template <typename T>
+  class future;
+
+  namespace private_future
+  {
+    //*************************************************************************
+    /// The part of the shared state that does not depend on the value type.
+    //*************************************************************************
+    class state_base
+    {
+    public:
+
+      typedef etl::inplace_function<void(), ETL_FUTURE_CONTINUATION_CAPACITY> continuation_type;
+      typedef void (*destroy_type)(state_base*);
+
+      //***********************************
+      state_base(etl::ipool& pool_, destroy_type destroy_)
+        : pool(pool_)
+        , destroy(destroy_)
+        , p_executor(ETL_NULLPTR)
+        , references(1U)
+        , pending(0U)
+        , ready(false)
+        , retrieved(false)
+        , continued(false)
+      {
+      }
+
+      //***********************************
+      void add_ref()
+      {
+        ++references;
+      }
+
+      //***********************************
+      void release()
+      {
+        if (--references == 0U)
+        {
+          destroy(this);
+        }
+      }
+
+      //***********************************
+      bool is_ready() const
+      {
+        return ready;
+      }
+
+      //***********************************
+      bool has_continuation() const
+      {
+        return continued;
+      }
+
+      //***********************************
+      /// Sets the continuation, running it now if the value is already set.
+      //***********************************
+      void set_continuation(continuation_type&& continuation_, etl::ifuture_executor* p_executor_)
+      {
+        continuation = etl::move(continuation_);
+        p_executor   = p_executor_;
+        continued    = true;
+
+        if (ready)
+        {
+          run_continuation();
+        }
+      }
+
+      //***********************************
+      /// Marks the value as set and runs any continuation.
+      //***********************************
+      void make_ready()
+      {
+        ready = true;
+
+        if (continuation.is_valid())
+        {
+          run_continuation();
+        }
+      }
+
+      etl::ipool&  pool;
+      destroy_type destroy;
+
+    private:
+
+      //***********************************
+      void run_continuation()
+      {
+        if (p_executor != ETL_NULLPTR)
+        {
+          // Keep the state until the executor runs the continuation.
+          add_ref();
+          p_executor->post(&state_base::run_posted, this);
+        }
+        else
+        {
+          invoke();
+        }
+      }
+
+      //***********************************
+      static void run_posted(void* context)
+      {
+        state_base* p_state = static_cast<state_base*>(context);
+
+        p_state->invoke();
+        p_state->release();
+      }
+
+      //***********************************
+      /// Runs the continuation once, releasing its captures afterwards.
+      //***********************************
+      void invoke()
+      {
+        continuation_type function(etl::move(continuation));
+
+        function();
+      }
+
+      continuation_type      continuation; ///< Run when the value is set.
+      etl::ifuture_executor* p_executor;   ///< Where the continuation runs, or null for inline.
+
+    public:
+
+      uint16_t references; ///< The promise, future and continuations that hold the state.
+      uint16_t pending;    ///< The number of sources that when_all is waiting for.
+      bool     ready;      ///< The value has been set.
+      bool     retrieved;  ///< The future has been taken from the promise.
+      bool     continued;  ///< A continuation has been attached.
+    };
+
+    //*************************************************************************
+    /// The shared state for a value of type T.
+    //*************************************************************************
+    template <typename T>
+    class state : public state_base
+    {
+    public:
+
+      typedef T& reference;
+
+      //***********************************
+      explicit state(etl::ipool& pool_)
+        : state_base(pool_, &state::destroy_state)
+      {
+      }
+
+      //***********************************
+      ~state()
+      {
+        if (ready)
+        {
+          get().~T();
+        }
+      }
+
+      //***********************************
+      template <typename... TArgs>
+      void set(TArgs&&... args)
+      {
+        ::new (static_cast<void*>(&storage)) T(etl::forward<TArgs>(args)...);
+        make_ready();
+      }
+
+      //***********************************
+      reference get()
+      {
+        return *reinterpret_cast<T*>(&storage);
+      }
+
+    private:
+
+      //***********************************
+      static void destroy_state(state_base* p_base)
+      {
+        state* p_state = static_cast<state*>(p_base);
+        p_state->pool.destroy(p_state);
+      }
+
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage;
+    };
+
+    //*************************************************************************
+    /// The shared state for a future with no value.
+    //*************************************************************************
+    template <>
+    class state<void> : public state_base
+    {
+    public:
+
+      typedef void reference;
+
+      //***********************************
+      explicit state(etl::ipool& pool_)
+        : state_base(pool_, &state::destroy_state)
+      {
+      }
+
+      //***********************************
+      void set()
+      {
+        make_ready();
+      }
+
+      //***********************************
+      void get()
+      {
+      }
+
+    private:
+
+      //***********************************
+      static void destroy_state(state_base* p_base)
+      {
+        state* p_state = static_cast<state*>(p_base);
+        p_state->pool.destroy(p_state);
+      }
+    };
+
+    //*************************************************************************
+    /// A counted reference to a shared state, for continuation captures.
+    //*************************************************************************
+    template <typename T>
+    class state_ref
+    {
+    public:
+
+      //***********************************
+      explicit state_ref(state<T>* p_state_)
+        : p_state(p_state_)
+      {
+        p_state->add_ref();
+      }
+
+      //***********************************
+      state_ref(const state_ref& other)
+        : p_state(other.p_state)
+      {
+        p_state->add_ref();
+      }
+
+      //***********************************
+      ~state_ref()
+      {
+        p_state->release();
+      }
+
+      //***********************************
+      state<T>& operator *() const
+      {
+        return *p_state;
+      }
+
+      //***********************************
+      state<T>* operator ->() const
+      {
+        return p_state;
+      }
+
+    private:
+
+      state_ref& operator =(const state_ref&) ETL_DELETE;
+
+      state<T>* p_state;
+    };
+
+    //*************************************************************************
+    /// The result of calling a continuation with the value of a state<T>.
+    //*************************************************************************
+    template <typename T, typename TFunction>
+    struct result_of
+    {
+      typedef decltype(etl::declval<TFunction&>()(etl::declval<T&>())) type;
+    };
+
+    template <typename TFunction>
+    struct result_of<void, TFunction>
+    {
+      typedef decltype(etl::declval<TFunction&>()()) type;
+    };
+
+    //*************************************************************************
+    /// Calls a continuation with the value of a state<T>.
+    //*************************************************************************
+    template <typename T, typename TFunction>
+    typename etl::enable_if<!etl::is_void<T>::value, typename result_of<T, TFunction>::type>::type
+      call(state<T>& source, TFunction& function)
+    {
+      return function(source.get());
+    }
+
+    template <typename T, typename TFunction>
+    typename etl::enable_if<etl::is_void<T>::value, typename result_of<T, TFunction>::type>::type
+      call(state<T>&, TFunction& function)
+    {
+      return function();
+    }
+
+    //*************************************************************************
+    /// Calls a continuation and sets its result in the target state.
+    //*************************************************************************
+    template <typename TResult>
+    struct completer
+    {
+      template <typename T, typename TFunction>
+      static void complete(state<T>& source, TFunction& function, state<TResult>& target)
+      {
+        target.set(call(source, function));
+      }
+    };
+
+    template <>
+    struct completer<void>
+    {
+      template <typename T, typename TFunction>
+      static void complete(state<T>& source, TFunction& function, state<void>& target)
+      {
+        call(source, function);
+        target.set();
+      }
+    };
+
+    //*************************************************************************
+    /// Creates a shared state in the pool.
+    //*************************************************************************
+    template <typename T>
+    state<T>* create_state(etl::ipool& pool)
+    {
+      state<T>* p_state = pool.create<state<T> >(pool);
+
+      ETL_ASSERT(p_state != ETL_NULLPTR, ETL_ERROR(etl::future_no_state));
+
+      return p_state;
+    }
+  }
+
+  //***************************************************************************
+  /// A pool with space for Size shared states of type T.
+  /// Each state in a chain may come from the same or different pools.
+  ///\ingroup future
+  //***************************************************************************
+  template <typename T, size_t Size>
+  using future_pool = etl::pool<private_future::state<T>, Size>;
+
+  //***************************************************************************
+  /// The result of an asynchronous operation.
+  /// Move only. Obtained from a promise, a continuation, when_all or when_any.
+  ///\ingroup future
+  //***************************************************************************
+  template <typename T>
+  class future
+  {
+  public:
+
+    typedef T value_type;
+    typedef typename private_future::state<T>::reference reference;
+
+    //*************************************************************************
+    /// Default constructor. Has no state.
+    //*************************************************************************
+    future() ETL_NOEXCEPT
+      : p_state(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    future(future&& other) ETL_NOEXCEPT
+      : p_state(other.p_state)
+    {
+      other.p_state = ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Move assignment.
+    //*************************************************************************
+    future& operator =(future&& other) ETL_NOEXCEPT
+    {
+      if (&other != this)
+      {
+        release();
+        p_state       = other.p_state;
+        other.p_state = ETL_NULLPTR;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~future()
+    {
+      release();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the future has a shared state.
+    //*************************************************************************
+    bool valid() const ETL_NOEXCEPT
+    {
+      return p_state != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the value has been set.
+    //*************************************************************************
+    bool is_ready() const ETL_NOEXCEPT
+    {
+      return (p_state != ETL_NULLPTR) && p_state->is_ready();
+    }
+
+    //*************************************************************************
+    /// Gets the value.
+    /// The future must be ready.
+    //*************************************************************************
+    reference get() const
+    {
+      ETL_ASSERT(is_ready(), ETL_ERROR(etl::future_not_ready));
+
+      return p_state->get();
+    }
+
+    //*************************************************************************
+    /// Attaches a continuation, called inline with the value when it is set,
+    /// or straight away if it is already set.
+    /// The continuation's result sets the returned future, whose state is
+    /// created in 'pool'. A future may have only one continuation.
+    //*************************************************************************
+    template <typename TFunction>
+    etl::future<typename private_future::result_of<T, TFunction>::type> then(etl::ipool& pool, TFunction function)
+    {
+      return attach(pool, ETL_NULLPTR, etl::move(function));
+    }
+
+    //*************************************************************************
+    /// Attaches a continuation, posted to the executor when the value is set.
+    //*************************************************************************
+    template <typename TFunction>
+    etl::future<typename private_future::result_of<T, TFunction>::type> then(etl::ipool& pool, etl::ifuture_executor& executor, TFunction function)
+    {
+      return attach(pool, &executor, etl::move(function));
+    }
+
+  private:
+
+    template <typename U>
+    friend class etl::promise;
+
+    template <typename U>
+    friend class etl::future;
+
+    template <typename U, size_t Size>
+    friend etl::future<void> when_all(etl::ipool& pool, etl::future<U> (&futures)[Size]);
+
+    template <typename U, size_t Size>
+    friend etl::future<size_t> when_any(etl::ipool& pool, etl::future<U> (&futures)[Size]);
+
+    //*************************************************************************
+    /// Adopts a reference to the state.
+    //*************************************************************************
+    explicit future(private_future::state<T>* p_state_) ETL_NOEXCEPT
+      : p_state(p_state_)
+    {
+    }
+
+    //*************************************************************************
+    template <typename TFunction>
+    etl::future<typename private_future::result_of<T, TFunction>::type> attach(etl::ipool& pool, etl::ifuture_executor* p_executor, TFunction&& function)
+    {
+      typedef typename private_future::result_of<T, TFunction>::type result_type;
+
+      ETL_ASSERT(valid(), ETL_ERROR(etl::future_no_state));
+      ETL_ASSERT(!p_state->has_continuation(), ETL_ERROR(etl::future_continuation_exists));
+
+      private_future::state<result_type>* p_target = private_future::create_state<result_type>(pool);
+
+      // The continuation shares the target with the returned future.
+      private_future::state_ref<result_type> target(p_target);
+      private_future::state<T>*              p_source = p_state;
+
+      etl::future<result_type> result(p_target);
+
+      p_state->set_continuation([p_source, function, target]() mutable
+                                {
+                                  private_future::completer<result_type>::complete(*p_source, function, *target);
+                                },
+                                p_executor);
+
+      return result;
+    }
+
+    //*************************************************************************
+    void release()
+    {
+      if (p_state != ETL_NULLPTR)
+      {
+        p_state->release();
+        p_state = ETL_NULLPTR;
+      }
+    }
+
+    future(const future&) ETL_DELETE;
+    future& operator =(const future&) ETL_DELETE;
+
+    private_future::state<T>* p_state;
+  };
+
+  //***************************************************************************
+  /// Sets the value of an asynchronous operation.
+  /// Move only. Its shared state is created in the pool given on construction.
+  /// If the promise is destroyed without a value its future never becomes ready.
+  ///\ingroup future
+  //***************************************************************************
+  template <typename T>
+  class promise
+  {
+  public:
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Creates the shared state in the pool.
+    //*************************************************************************
+    explicit promise(etl::ipool& pool)
+      : p_state(private_future::create_state<T>(pool))
+    {
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    promise(promise&& other) ETL_NOEXCEPT
+      : p_state(other.p_state)
+    {
+      other.p_state = ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Move assignment.
+    //*************************************************************************
+    promise& operator =(promise&& other) ETL_NOEXCEPT
+    {
+      if (&other != this)
+      {
+        release();
+        p_state       = other.p_state;
+        other.p_state = ETL_NULLPTR;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~promise()
+    {
+      release();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the promise has a shared state.
+    //*************************************************************************
+    bool valid() const ETL_NOEXCEPT
+    {
+      return p_state != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Gets the future for the value. May be called once.
+    //*************************************************************************
+    etl::future<T> get_future()
+    {
+      ETL_ASSERT(valid(), ETL_ERROR(etl::future_no_state));
+      ETL_ASSERT(!p_state->retrieved, ETL_ERROR(etl::future_already_retrieved));
+
+      p_state->retrieved = true;
+      p_state->add_ref();
+
+      return etl::future<T>(p_state);
+    }
+
+    //*************************************************************************
+    /// Sets the value, constructed from the arguments, and runs any continuation.
+    /// For promise<void> there are no arguments.
+    //*************************************************************************
+    template <typename... TArgs>
+    void set_value(TArgs&&... args)
+    {
+      ETL_ASSERT_OR_RETURN(valid(), ETL_ERROR(etl::future_no_state));
+      ETL_ASSERT_OR_RETURN(!p_state->is_ready(), ETL_ERROR(etl::future_already_satisfied));
+
+      p_state->set(etl::forward<TArgs>(args)...);
+    }
+
+  private:
+
+    //*************************************************************************
+    void release()
+    {
+      if (p_state != ETL_NULLPTR)
+      {
+        p_state->release();
+        p_state = ETL_NULLPTR;
+      }
+    }
+
+    promise(const promise&) ETL_DELETE;
+    promise& operator =(const promise&) ETL_DELETE;
+
+    private_future::state<T>* p_state;
+  };
+
+  //***************************************************************************
+  /// Returns a future that becomes ready when all of the futures are ready.
+  /// Uses the continuation of each future, which stay valid for reading the values.
+  ///\ingroup future
+  //***************************************************************************
+  template <typename T, size_t Size>
+  etl::future<void> when_all(etl::ipool& pool, etl::future<T> (&futures)[Size])
+  {
+    ETL_STATIC_ASSERT(Size <= 65535U, "Too many futures");
+
+    private_future::state<void>* p_target = private_future::create_state<void>(pool);
+
+    etl::future<void> result(p_target);
+
+    p_target->pending = uint16_t(Size);
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      ETL_ASSERT(futures[i].valid(), ETL_ERROR(etl::future_no_state));
+      ETL_ASSERT(!futures[i].p_state->has_continuation(), ETL_ERROR(etl::future_continuation_exists));
+
+      private_future::state_ref<void> target(p_target);
+
+      futures[i].p_state->set_continuation([target]()
+                                           {
+                                             if (--target->pending == 0U)
+                                             {
+                                               target->set();
+                                             }
+                                           },
+                                           ETL_NULLPTR);
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Returns a future that becomes ready, with the index of the future, when
+  /// the first of the futures is ready.
+  /// Uses the continuation of each future, which stay valid for reading the values.
+  ///\ingroup future
+  //***************************************************************************
+  template <typename T, size_t Size>
+  etl::future<size_t> when_any(etl::ipool& pool, etl::future<T> (&futures)[Size])
+  {
+    ETL_STATIC_ASSERT(Size <= 65535U, "Too many futures");
+
+    private_future::state<size_t>* p_target = private_future::create_state<size_t>(pool);
+
+    etl::future<size_t> result(p_target);
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      ETL_ASSERT(futures[i].valid(), ETL_ERROR(etl::future_no_state));
+      ETL_ASSERT(!futures[i].p_state->has_continuation(), ETL_ERROR(etl::future_continuation_exists));
+
+      private_future::state_ref<size_t> target(p_target);
+
+      futures[i].p_state->set_continuation([target, i]()
+                                           {
+                                             if (!target->is_ready())
+                                             {
+                                               target->set(i);
+                                             }
+                                           },
+                                           ETL_NULLPTR);
+    }
+
+    return result;
+  }
+}
+
+#endif
+#endif
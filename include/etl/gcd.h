@@ -78,8 +78,8 @@ namespace etl
 
     typedef typename etl::make_unsigned<T>::type utype;
 
-    utype ua = etl::absolute_unsigned(a);
-    utype ub = etl::absolute_unsigned(b);
+    utype ua = etl::absolute_unsigned<T, utype>(a);
+    utype ub = etl::absolute_unsigned<T, utype>(b);
 
     return static_cast<T>(gcd(ua, ub));
   }
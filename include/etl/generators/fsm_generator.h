@@ -72,6 +72,7 @@ cog.outl("//********************************************************************
 #include "message_router.h"
 #include "integral_limits.h"
 #include "largest.h"
+#include "trace.h"
 
 #include <stdint.h>
 
@@ -200,6 +201,43 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Exception for a message that could not be deferred.
+  //***************************************************************************
+  class fsm_event_queue_full : public etl::fsm_exception
+  {
+  public:
+    fsm_event_queue_full(string_type file_name_, numeric_type line_number_)
+      : etl::fsm_exception(ETL_ERROR_TEXT("fsm:event queue full", ETL_FSM_FILE_ID"G"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Interface for the queue of deferred messages of an FSM.
+  /// See fsm_event_queue.h for implementations.
+  //***************************************************************************
+  class ifsm_event_queue
+  {
+  public:
+
+    virtual ~ifsm_event_queue()
+    {
+    }
+
+    /// Copies the message to the queue. Returns false if it is full or cannot hold the message.
+    virtual bool push(const etl::imessage& message) = 0;
+
+    /// The oldest message.
+    virtual const etl::imessage& front() const = 0;
+
+    /// Removes the oldest message.
+    virtual void pop() = 0;
+
+    /// Is the queue empty?
+    virtual bool empty() const = 0;
+  };
+
   namespace private_fsm
   {
     template <typename T = void>
@@ -313,7 +351,8 @@ namespace etl
       p_context(ETL_NULLPTR),
       p_parent(ETL_NULLPTR),
       p_active_child(ETL_NULLPTR),
-      p_default_child(ETL_NULLPTR)
+      p_default_child(ETL_NULLPTR),
+      depth(0U)
     {
     }
 
@@ -358,6 +397,9 @@ namespace etl
     // A pointer to the default active child.
     ifsm_state* p_default_child;
 
+    // The number of ancestors. Set by the HFSM when it starts.
+    etl::fsm_state_id_t depth;
+
     // Disabled.
     ifsm_state(const ifsm_state&);
     ifsm_state& operator =(const ifsm_state&);
@@ -381,6 +423,8 @@ namespace etl
       , p_state(ETL_NULLPTR)
       , state_list(ETL_NULLPTR)
       , number_of_states(0U)
+      , p_event_queue(ETL_NULLPTR)
+      , dispatching(false)
     {
     }
 
@@ -437,38 +481,53 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Sets the queue for deferred messages, and selects run to completion.
+    /// A message received while another is being handled is queued, and is
+    /// handled after it, rather than from within the handler.
+    //*******************************************
+    void set_event_queue(etl::ifsm_event_queue& event_queue)
+    {
+      p_event_queue = &event_queue;
+    }
+
+    //*******************************************
+    /// Removes the queue for deferred messages.
+    /// Messages are handled as soon as they are received.
+    //*******************************************
+    void clear_event_queue()
+    {
+      p_event_queue = ETL_NULLPTR;
+    }
+
     //*******************************************
     /// Top level message handler for the FSM.
+    /// With an event queue, a message received by a handler is deferred
+    /// until the current one has been handled, and any that are queued are
+    /// handled before returning.
     //*******************************************
     void receive(const etl::imessage& message) ETL_OVERRIDE
     {
       if (is_started())
       {
-        etl::fsm_state_id_t next_state_id = p_state->process_event(message);
-
-        if (have_changed_state(next_state_id))
+        if (p_event_queue == ETL_NULLPTR)
         {
-          ETL_ASSERT_OR_RETURN(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
-          etl::ifsm_state* p_next_state = state_list[next_state_id];
-
-          do
+          process_message(message);
+        }
+        else if (dispatching)
+        {
+          if (!p_event_queue->push(message))
           {
-            p_state->on_exit_state();
-            p_state = p_next_state;
-
-            next_state_id = p_state->on_enter_state();
-
-            if (have_changed_state(next_state_id))
-            {
-              ETL_ASSERT_OR_RETURN(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
-              p_next_state = state_list[next_state_id];
-            }
-          } while (p_next_state != p_state); // Have we changed state again?
+            ETL_ASSERT_FAIL(ETL_ERROR(etl::fsm_event_queue_full));
+          }
         }
-        else if (is_self_transition(next_state_id))
+        else
         {
-          p_state->on_exit_state();
-          p_state->on_enter_state();
+          dispatching = true;
+          process_message(message);
+          dispatching = false;
+
+          process_queue();
         }
       }
       else
@@ -477,6 +536,43 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Queues a message, to be handled by process_queue().
+    /// Safe to call from an interrupt if the event queue is.
+    ///\return <b>true</b> if the message was queued.
+    //*******************************************
+    bool post(const etl::imessage& message)
+    {
+      return (p_event_queue != ETL_NULLPTR) && p_event_queue->push(message);
+    }
+
+    //*******************************************
+    /// Handles queued messages, including those queued as they are handled.
+    /// Does nothing if called from a handler.
+    ///\param max_messages The maximum number of messages to handle.
+    ///\return The number of messages handled.
+    //*******************************************
+    size_t process_queue(size_t max_messages = etl::integral_limits<size_t>::max)
+    {
+      size_t count = 0U;
+
+      if (is_started() && (p_event_queue != ETL_NULLPTR) && !dispatching)
+      {
+        dispatching = true;
+
+        while ((count < max_messages) && !p_event_queue->empty())
+        {
+          process_message(p_event_queue->front());
+          p_event_queue->pop();
+          ++count;
+        }
+
+        dispatching = false;
+      }
+
+      return count;
+    }
+
     using imessage_router::accepts;
 
     //*******************************************
@@ -555,6 +651,44 @@ namespace etl
       return true;
     }
 
+  protected:
+
+    //*******************************************
+    /// Passes a message to the current state and follows the state changes.
+    //*******************************************
+    virtual void process_message(const etl::imessage& message)
+    {
+      etl::fsm_state_id_t next_state_id = p_state->process_event(message);
+
+      if (have_changed_state(next_state_id))
+      {
+        ETL_ASSERT_OR_RETURN(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+        etl::ifsm_state* p_next_state = state_list[next_state_id];
+
+        do
+        {
+          p_state->on_exit_state();
+          p_state = p_next_state;
+
+          ETL_TRACE(etl::trace_id::Fsm_Transition, etl::trace_payload(get_message_router_id(), p_state->get_state_id()));
+
+          next_state_id = p_state->on_enter_state();
+
+          if (have_changed_state(next_state_id))
+          {
+            ETL_ASSERT_OR_RETURN(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+            p_next_state = state_list[next_state_id];
+          }
+        } while (p_next_state != p_state); // Have we changed state again?
+      }
+      else if (is_self_transition(next_state_id))
+      {
+        p_state->on_exit_state();
+        ETL_TRACE(etl::trace_id::Fsm_Transition, etl::trace_payload(get_message_router_id(), p_state->get_state_id()));
+        p_state->on_enter_state();
+      }
+    }
+
   private:
 
     //********************************************
@@ -574,6 +708,8 @@ namespace etl
     etl::ifsm_state*    p_state;          ///< A pointer to the current state.
     etl::ifsm_state**   state_list;       ///< The list of added states.
     etl::fsm_state_id_t number_of_states; ///< The number of states.
+    etl::ifsm_event_queue* p_event_queue; ///< The queue of deferred messages, if any.
+    bool                  dispatching;   ///< Set while a message is being handled.
   };
 
   //*************************************************************************************************
@@ -78,9 +78,38 @@ cog.outl("//********************************************************************
 
 namespace etl
 {
-#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
+#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
+  namespace private_message_packet
+  {
+    //***************************************************************************
+    /// Checks if an id belongs to one of the message types.
+    //***************************************************************************
+    template <typename... TMessageTypes>
+    struct message_id_list;
+
+    template <>
+    struct message_id_list<>
+    {
+      static ETL_CONSTEXPR bool contains(etl::message_id_t)
+      {
+        return false;
+      }
+    };
+
+    template <typename TMessage, typename... TRest>
+    struct message_id_list<TMessage, TRest...>
+    {
+      static ETL_CONSTEXPR bool contains(etl::message_id_t id)
+      {
+        return (TMessage::ID == id) || etl::private_message_packet::message_id_list<TRest...>::contains(id);
+      }
+    };
+  }
+
   //***************************************************************************
   // The definition for all message types.
+  // Used from C++11, so that the packet does not expand a fixed number of
+  // overloads for every message type.
   //***************************************************************************
   template <typename... TMessageTypes>
   class message_packet
@@ -89,13 +118,21 @@ namespace etl
   private:
 
     template <typename T>
-    static constexpr bool IsMessagePacket = etl::is_same_v< etl::remove_const_t<etl::remove_reference_t<T>>, etl::message_packet<TMessageTypes...>>;
+    struct is_message_packet : etl::bool_constant<etl::is_same<typename etl::remove_cvref<T>::type, etl::message_packet<TMessageTypes...> >::value>
+    {
+    };
 
     template <typename T>
-    static constexpr bool IsInMessageList = etl::is_one_of_v<etl::remove_const_t<etl::remove_reference_t<T>>, TMessageTypes...>;
+    struct is_in_message_list : etl::bool_constant<etl::is_one_of<typename etl::remove_cvref<T>::type, TMessageTypes...>::value>
+    {
+    };
 
     template <typename T>
-    static constexpr bool IsIMessage = etl::is_same_v<remove_const_t<etl::remove_reference_t<T>>, etl::imessage>;
+    struct is_imessage : etl::bool_constant<etl::is_same<typename etl::remove_cvref<T>::type, etl::imessage>::value>
+    {
+    };
+
+    typedef etl::private_message_packet::message_id_list<TMessageTypes...> id_list;
 
   public:
 
@@ -108,39 +145,56 @@ namespace etl
 #include "private/diagnostic_pop.h"
 
     //********************************************
-    ///
+    /// Constructs from an etl::imessage.
     //********************************************
 #include "private/diagnostic_uninitialized_push.h"
-    template <typename T, typename = typename etl::enable_if<IsIMessage<T> || IsInMessageList<T>, int>::type>
+    template <typename T, typename etl::enable_if<is_imessage<T>::value, int>::type = 0>
     explicit message_packet(T&& msg)
       : valid(true)
     {
-      if constexpr (IsIMessage<T>)
+      if (accepts(msg))
       {
-        if (accepts(msg))
-        {
-          add_new_message(etl::forward<T>(msg));
-          valid = true;
-        }
-        else
-        {
-          valid = false;
-        }
-
-        ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-      }
-      else if constexpr (IsInMessageList<T>)
-      {
-        add_new_message_type<T>(etl::forward<T>(msg));
+        add_new_message(etl::forward<T>(msg));
+        valid = true;
       }
       else
       {
-        ETL_STATIC_ASSERT(IsInMessageList<T>, "Message not in packet type list");
+        valid = false;
       }
+
+      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
+    }
+#include "private/diagnostic_pop.h"
+
+    //********************************************
+    /// Constructs from one of the message types.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    template <typename T, typename etl::enable_if<is_in_message_list<T>::value, int>::type = 0>
+    explicit message_packet(T&& msg)
+      : valid(true)
+    {
+      add_new_message_type<T>(etl::forward<T>(msg));
+    }
+#include "private/diagnostic_pop.h"
+
+    //********************************************
+    /// Constructs the message directly in the packet.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    template <typename TMessage, typename... TArgs>
+    explicit message_packet(etl::in_place_type_t<TMessage>, TArgs&&... args)
+      : valid(true)
+    {
+      ETL_STATIC_ASSERT(is_in_message_list<TMessage>::value, "Message not in packet type list");
+
+      void* p = data;
+      new (p) TMessage(etl::forward<TArgs>(args)...);
     }
 #include "private/diagnostic_pop.h"
 
     //**********************************************
+#include "private/diagnostic_uninitialized_push.h"
     message_packet(const message_packet& other)
     {
       valid = other.is_valid();
@@ -150,9 +204,10 @@ namespace etl
         add_new_message(other.get());
       }
     }
+#include "private/diagnostic_pop.h"
 
-#if ETL_USING_CPP11
     //**********************************************
+#include "private/diagnostic_uninitialized_push.h"
     message_packet(message_packet&& other)
     {
       valid = other.is_valid();
@@ -162,9 +217,10 @@ namespace etl
         add_new_message(etl::move(other.get()));
       }
     }
-#endif
+#include "private/diagnostic_pop.h"
 
     //**********************************************
+#include "private/diagnostic_uninitialized_push.h"
     void copy(const message_packet& other)
     {
       valid = other.is_valid();
@@ -174,8 +230,10 @@ namespace etl
         add_new_message(other.get());
       }
     }
+#include "private/diagnostic_pop.h"
 
     //**********************************************
+#include "private/diagnostic_uninitialized_push.h"
     void copy(message_packet&& other)
     {
       valid = other.is_valid();
@@ -185,6 +243,7 @@ namespace etl
         add_new_message(etl::move(other.get()));
       }
     }
+#include "private/diagnostic_pop.h"
 
     //**********************************************
 #include "private/diagnostic_uninitialized_push.h"
@@ -222,6 +281,26 @@ namespace etl
       delete_current_message();
     }
 
+    //********************************************
+    /// Replaces the current message with one constructed directly in the packet.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT(is_in_message_list<TMessage>::value, "Message not in packet type list");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* p_msg = new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *p_msg;
+    }
+#include "private/diagnostic_pop.h"
+
     //********************************************
     etl::imessage& get() ETL_NOEXCEPT
     {
@@ -243,7 +322,7 @@ namespace etl
     //**********************************************
     static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
     {
-      return (accepts_message<TMessageTypes::ID>(id) || ...);
+      return id_list::contains(id);
     }
 
     //**********************************************
@@ -256,7 +335,7 @@ namespace etl
     template <etl::message_id_t Id>
     static ETL_CONSTEXPR bool accepts()
     {
-      return (accepts_message<TMessageTypes::ID, Id>() || ...);
+      return id_list::contains(Id);
     }
 
     //**********************************************
@@ -276,20 +355,6 @@ namespace etl
 
   private:
 
-    //**********************************************
-    template <etl::message_id_t Id1, etl::message_id_t Id2>
-    static bool accepts_message()
-    {
-      return Id1 == Id2;
-    }
-
-    //**********************************************
-    template <etl::message_id_t Id1>
-    static bool accepts_message(etl::message_id_t id2)
-    {
-      return Id1 == id2;
-    }
-
     //********************************************
 #include "private/diagnostic_uninitialized_push.h"
     void delete_current_message()
@@ -303,16 +368,22 @@ namespace etl
     }
 #include "private/diagnostic_pop.h"
 
+    //********************************************
+    /// Constructs the message type that matches the id.
     //********************************************
     void add_new_message(const etl::imessage& msg)
     {
-      (add_new_message_type<TMessageTypes>(msg) || ...);
+      bool added = false;
+      int dummy[] = { 0, (added = added || add_new_message_type<TMessageTypes>(msg), 0)... };
+      (void)dummy;
     }
 
     //********************************************
     void add_new_message(etl::imessage&& msg)
     {
-      (add_new_message_type<TMessageTypes>(etl::move(msg)) || ...);
+      bool added = false;
+      int dummy[] = { 0, (added = added || add_new_message_type<TMessageTypes>(etl::move(msg)), 0)... };
+      (void)dummy;
     }
 
 #include "private/diagnostic_uninitialized_push.h"
@@ -320,11 +391,11 @@ namespace etl
     /// Only enabled for types that are in the typelist.
     //********************************************
     template <typename TMessage>
-    etl::enable_if_t<etl::is_one_of_v<etl::remove_const_t<etl::remove_reference_t<TMessage>>, TMessageTypes...>, void>
+    typename etl::enable_if<is_in_message_list<TMessage>::value, void>::type
       add_new_message_type(TMessage&& msg)
     {
       void* p = data;
-      new (p) etl::remove_reference_t<TMessage>((etl::forward<TMessage>(msg)));
+      new (p) typename etl::remove_reference<TMessage>::type((etl::forward<TMessage>(msg)));
     }
 #include "private/diagnostic_pop.h"
 
@@ -481,45 +552,6 @@ namespace etl
     cog.outl("  }")
     cog.outl("#include \"private/diagnostic_pop.h\"")
     cog.outl("")
-    cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-    cog.outl("  //********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  explicit message_packet(etl::imessage&& msg)")
-    cog.outl("  {")
-    cog.outl("    if (accepts(msg))")
-    cog.outl("    {")
-    cog.outl("      add_new_message(etl::move(msg));")
-    cog.outl("      valid = true;")
-    cog.outl("    }")
-    cog.outl("    else")
-    cog.outl("    {")
-    cog.outl("      valid = false;")
-    cog.outl("    }")
-    cog.outl("")
-    cog.outl("    ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));")
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("#endif")
-    cog.outl("")
-    cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)")
-    cog.outl("  //********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.out("  template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<")
-    for n in range(1, int(Handlers)):
-        cog.out("T%s, " % n)
-    cog.outl("T%s> >::value &&" % int(Handlers))
-    cog.outl("                                                                  !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&")
-    cog.out("                                                                  !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, ")
-    for n in range(1, int(Handlers)):
-        cog.out("T%s, " % n)
-    cog.outl("T%s>::value, int>::type>" % int(Handlers))
-    cog.outl("  explicit message_packet(TMessage&& /*msg*/)")
-    cog.outl("    : valid(true)")
-    cog.outl("  {")
-    generate_static_assert_cpp11(int(Handlers))
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("#else")
     cog.outl("  //********************************************")
     cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
     cog.outl("  template <typename TMessage>")
@@ -537,7 +569,6 @@ namespace etl
     generate_static_assert_cpp03(int(Handlers))
     cog.outl("  }")
     cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("#endif")
     cog.outl("")
     cog.outl("  //**********************************************")
     cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
@@ -551,20 +582,6 @@ namespace etl
     cog.outl("  }")
     cog.outl("#include \"private/diagnostic_pop.h\"")
     cog.outl("")
-    cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-    cog.outl("  //**********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  message_packet(message_packet&& other)")
-    cog.outl("    : valid(other.is_valid())")
-    cog.outl("  {")
-    cog.outl("    if (valid)")
-    cog.outl("    {")
-    cog.outl("      add_new_message(etl::move(other.get()));")
-    cog.outl("    }")
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("#endif")
-    cog.outl("")
     cog.outl("  //**********************************************")
     cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
     cog.outl("  message_packet& operator =(const message_packet& rhs)")
@@ -580,23 +597,6 @@ namespace etl
     cog.outl("  }")
     cog.outl("#include \"private/diagnostic_pop.h\"")
     cog.outl("")
-    cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-    cog.outl("  //**********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  message_packet& operator =(message_packet&& rhs)")
-    cog.outl("  {")
-    cog.outl("    delete_current_message();")
-    cog.outl("    valid = rhs.is_valid();")
-    cog.outl("    if (valid)")
-    cog.outl("    {")
-    cog.outl("      add_new_message(etl::move(rhs.get()));")
-    cog.outl("    }")
-    cog.outl("")
-    cog.outl("    return *this;")
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("#endif")
-    cog.outl("")
     cog.outl("  //********************************************")
     cog.outl("  ~message_packet()")
     cog.outl("  {")
@@ -690,22 +690,6 @@ namespace etl
     cog.outl("    }")
     cog.outl("  }")
     cog.outl("")
-    cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-    cog.outl("  //********************************************")
-    cog.outl("  void add_new_message(etl::imessage&& msg)")
-    cog.outl("  {")
-    cog.outl("    const size_t id = msg.get_message_id();")
-    cog.outl("    void* p = data;")
-    cog.outl("")
-    cog.outl("    switch (id)")
-    cog.outl("    {")
-    for n in range(1, int(Handlers) + 1):
-        cog.outl("      case T%d::ID: ::new (p) T%d(static_cast<T%d&&>(msg)); break;" %(n, n, n))
-    cog.outl("      default: ETL_ASSERT(false, ETL_ERROR(unhandled_message_exception)); break;")
-    cog.outl("    }")
-    cog.outl("  }")
-    cog.outl("#endif")
-    cog.outl("")
     cog.outl("  typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;")
     cog.outl("  bool valid;")
     cog.outl("};")
@@ -769,45 +753,6 @@ namespace etl
         cog.outl("  }")
         cog.outl("#include \"private/diagnostic_pop.h\"")
         cog.outl("")
-        cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-        cog.outl("  //********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  explicit message_packet(etl::imessage&& msg)")
-        cog.outl("  {")
-        cog.outl("    if (accepts(msg))")
-        cog.outl("    {")
-        cog.outl("      add_new_message(etl::move(msg));")
-        cog.outl("      valid = true;")
-        cog.outl("    }")
-        cog.outl("    else")
-        cog.outl("    {")
-        cog.outl("      valid = false;")
-        cog.outl("    }")
-        cog.outl("")
-        cog.outl("    ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));")
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("#endif")
-        cog.outl("")
-        cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)")
-        cog.outl("  //********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.out("  template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<")
-        for t in range(1, n):
-            cog.out("T%s, " % t)
-        cog.outl("T%s> >::value &&" % n)
-        cog.outl("                                                                  !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&")
-        cog.out("                                                                  !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, ")
-        for t in range(1, n):
-            cog.out("T%s, " % t)
-        cog.outl("T%s>::value, int>::type>" % n)
-        cog.outl("  explicit message_packet(TMessage&& /*msg*/)")
-        cog.outl("    : valid(true)")
-        cog.outl("  {")
-        generate_static_assert_cpp11(n)
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("#else")
         cog.outl("  //********************************************")
         cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
         cog.outl("  template <typename TMessage>")
@@ -825,7 +770,6 @@ namespace etl
         generate_static_assert_cpp03(n)
         cog.outl("  }")
         cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("#endif")
         cog.outl("")
         cog.outl("  //**********************************************")
         cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
@@ -839,20 +783,6 @@ namespace etl
         cog.outl("  }")
         cog.outl("#include \"private/diagnostic_pop.h\"")
         cog.outl("")
-        cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-        cog.outl("  //**********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  message_packet(message_packet&& other)")
-        cog.outl("    : valid(other.is_valid())")
-        cog.outl("  {")
-        cog.outl("    if (valid)")
-        cog.outl("    {")
-        cog.outl("      add_new_message(etl::move(other.get()));")
-        cog.outl("    }")
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("#endif")
-        cog.outl("")
         cog.outl("  //**********************************************")
         cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
         cog.outl("  message_packet& operator =(const message_packet& rhs)")
@@ -868,23 +798,6 @@ namespace etl
         cog.outl("  }")
         cog.outl("#include \"private/diagnostic_pop.h\"")
         cog.outl("")
-        cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-        cog.outl("  //**********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  message_packet& operator =(message_packet&& rhs)")
-        cog.outl("  {")
-        cog.outl("    delete_current_message();")
-        cog.outl("    valid = rhs.is_valid();")
-        cog.outl("    if (valid)")
-        cog.outl("    {")
-        cog.outl("      add_new_message(etl::move(rhs.get()));")
-        cog.outl("    }")
-        cog.outl("")
-        cog.outl("    return *this;")
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("#endif")
-        cog.outl("")
         cog.outl("  //********************************************")
         cog.outl("  ~message_packet()")
         cog.outl("  {")
@@ -978,22 +891,6 @@ namespace etl
         cog.outl("    }")
         cog.outl("  }")
         cog.outl("")
-        cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-        cog.outl("  //********************************************")
-        cog.outl("  void add_new_message(etl::imessage&& msg)")
-        cog.outl("  {")
-        cog.outl("    const size_t id = msg.get_message_id();")
-        cog.outl("    void* p = data;")
-        cog.outl("")
-        cog.outl("    switch (id)")
-        cog.outl("    {")
-        for t in range(1, n + 1):
-            cog.outl("      case T%d::ID: ::new (p) T%d(static_cast<T%d&&>(msg)); break;" %(t, t, t))
-        cog.outl("      default: break;")
-        cog.outl("    }")
-        cog.outl("  }")
-        cog.outl("#endif")
-        cog.outl("")
         cog.outl("  typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;")
         cog.outl("  bool valid;")
         cog.outl("};")
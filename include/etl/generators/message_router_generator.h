@@ -77,6 +77,7 @@ cog.outl("//********************************************************************
 #include "nullptr.h"
 #include "placement_new.h"
 #include "successor.h"
+#include "trace.h"
 #include "type_traits.h"
 
 #include <stdint.h>
@@ -416,8 +417,167 @@ namespace etl
 // For C++17 and above.
 //*************************************************************************************************
 #if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+  namespace private_message_router
+  {
+    //***************************************************************************
+    /// A compile time table that maps message ids to handlers in constant time.
+    /// If the ids are dense enough, a jump table indexed by 'id - Min_Id' is used.
+    /// Otherwise the ids are sorted and binary searched.
+    /// Where an id appears more than once, the first handler is used.
+    ///\tparam THandler The handler function pointer type.
+    ///\tparam Ids      The message ids, in the same order as the handlers.
+    //***************************************************************************
+    template <typename THandler, etl::message_id_t... Ids>
+    class dispatch_table
+    {
+    public:
+
+      static constexpr size_t Count = sizeof...(Ids);
+
+      static_assert(Count != 0U, "dispatch_table requires at least one id");
+
+      //*********************************
+      static constexpr etl::message_id_t min_id()
+      {
+        const etl::message_id_t ids[Count] = { Ids... };
+        etl::message_id_t result = ids[0];
+
+        for (size_t i = 1U; i < Count; ++i)
+        {
+          result = (ids[i] < result) ? ids[i] : result;
+        }
+
+        return result;
+      }
+
+      //*********************************
+      static constexpr etl::message_id_t max_id()
+      {
+        const etl::message_id_t ids[Count] = { Ids... };
+        etl::message_id_t result = ids[0];
+
+        for (size_t i = 1U; i < Count; ++i)
+        {
+          result = (ids[i] > result) ? ids[i] : result;
+        }
+
+        return result;
+      }
+
+      static constexpr etl::message_id_t Min_Id = min_id();
+      static constexpr etl::message_id_t Max_Id = max_id();
+      static constexpr size_t            Range  = static_cast<size_t>(Max_Id - Min_Id) + 1U;
+
+      /// Use a jump table if at least a quarter of its entries would be used.
+      static constexpr bool Is_Jump_Table = (Range <= (Count * 4U));
+
+      //*********************************
+      template <typename... THandlers>
+      constexpr dispatch_table(THandlers... handlers_)
+        : jump_table{}
+        , sorted_ids{}
+        , sorted_handlers{}
+      {
+        static_assert(sizeof...(THandlers) == Count, "There must be a handler for each id");
+
+        const etl::message_id_t ids[Count]      = { Ids... };
+        const THandler          handlers[Count] = { handlers_... };
+
+        if constexpr (Is_Jump_Table)
+        {
+          // Fill from the back, so that the first handler for an id wins.
+          for (size_t i = Count; i-- != 0U;)
+          {
+            jump_table[ids[i] - Min_Id] = handlers[i];
+          }
+        }
+        else
+        {
+          // Insertion sort, keeping the first handler for an id.
+          size_t n = 0U;
+
+          for (size_t i = 0U; i < Count; ++i)
+          {
+            size_t j = n;
+
+            while ((j != 0U) && (sorted_ids[j - 1U] > ids[i]))
+            {
+              --j;
+            }
+
+            if ((j != 0U) && (sorted_ids[j - 1U] == ids[i]))
+            {
+              continue;
+            }
+
+            for (size_t k = n; k != j; --k)
+            {
+              sorted_ids[k]      = sorted_ids[k - 1U];
+              sorted_handlers[k] = sorted_handlers[k - 1U];
+            }
+
+            sorted_ids[j]      = ids[i];
+            sorted_handlers[j] = handlers[i];
+            ++n;
+          }
+
+          // Pad any duplicate entries with the largest id, so the search range stays sorted.
+          for (size_t i = n; i < Count; ++i)
+          {
+            sorted_ids[i]      = sorted_ids[n - 1U];
+            sorted_handlers[i] = sorted_handlers[n - 1U];
+          }
+        }
+      }
+
+      //*********************************
+      /// Gets the handler for the id, or ETL_NULLPTR if there is none.
+      //*********************************
+      THandler find(etl::message_id_t id) const
+      {
+        if constexpr (Is_Jump_Table)
+        {
+          const size_t index = static_cast<size_t>(id - Min_Id);
+
+          // Ids below Min_Id wrap to a large index.
+          return (index < Range) ? jump_table[index] : ETL_NULLPTR;
+        }
+        else
+        {
+          size_t first = 0U;
+          size_t count = Count;
+
+          while (count != 0U)
+          {
+            const size_t step = count / 2U;
+
+            if (sorted_ids[first + step] < id)
+            {
+              first += step + 1U;
+              count -= step + 1U;
+            }
+            else
+            {
+              count = step;
+            }
+          }
+
+          return ((first < Count) && (sorted_ids[first] == id)) ? sorted_handlers[first] : ETL_NULLPTR;
+        }
+      }
+
+    private:
+
+      THandler          jump_table[Is_Jump_Table ? Range : 1U];
+      etl::message_id_t sorted_ids[Is_Jump_Table ? 1U : Count];
+      THandler          sorted_handlers[Is_Jump_Table ? 1U : Count];
+    };
+  }
+
   //***************************************************************************
   // The definition for all message types.
+  // Messages are dispatched through a compile time table of the message ids,
+  // so receive and accepts take constant time, whatever the number of types.
   //***************************************************************************
   template <typename TDerived, typename... TMessageTypes>
   class message_router : public imessage_router
@@ -459,9 +619,15 @@ namespace etl
 
     void receive(const etl::imessage& msg) ETL_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
 
-      if (!was_handled)
+      const handler_type handler = find_handler(msg.get_message_id());
+
+      if (handler != ETL_NULLPTR)
+      {
+        handler(*this, msg);
+      }
+      else
       {
         if (has_successor())
         {
@@ -477,6 +643,8 @@ namespace etl
     template <typename TMessage, typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value, int>::type = 0>
     void receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if constexpr (etl::is_one_of<TMessage, TMessageTypes...>::value)
       {
         static_cast<TDerived*>(this)->on_receive(msg);
@@ -499,7 +667,21 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      if (find_handler(id) != ETL_NULLPTR)
+      {
+        return true;
+      }
+      else
+      {
+        if (has_successor())
+        {
+          return get_successor().accepts(id);
+        }
+        else
+        {
+          return false;
+        }
+      }
     }
 
     //********************************************
@@ -522,39 +704,29 @@ namespace etl
 
   private:
 
+    typedef void (*handler_type)(message_router&, const etl::imessage&);
+
     //********************************************
     template <typename TMessage>
-    bool receive_message_type(const etl::imessage& msg)
+    static void receive_message_type(message_router& router, const etl::imessage& msg)
     {
-      if (TMessage::ID == msg.get_message_id())
-      {
-        static_cast<TDerived*>(this)->on_receive(static_cast<const TMessage&>(msg));
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      static_cast<TDerived&>(router).on_receive(static_cast<const TMessage&>(msg));
     }
 
     //********************************************
-    template <typename TMessage>
-    bool accepts_type(etl::message_id_t id) const
+    static handler_type find_handler(etl::message_id_t id)
     {
-      if (TMessage::ID == id)
+      if constexpr (sizeof...(TMessageTypes) == 0U)
       {
-        return true;
+        (void)id;
+        return ETL_NULLPTR;
       }
       else
       {
-        if (has_successor())
-        {
-          return get_successor().accepts(id);
-        }
-        else
-        {
-          return false;
-        }
+        static constexpr etl::private_message_router::dispatch_table<handler_type, TMessageTypes::ID...>
+          table(&message_router::template receive_message_type<TMessageTypes>...);
+
+        return table.find(id);
       }
     }
   };
@@ -624,6 +796,8 @@ namespace etl
       cog.outl("  {")
       cog.outl("    const etl::message_id_t id = msg.get_message_id();")
       cog.outl("")
+      cog.outl("    ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));")
+      cog.outl("")
       cog.outl("    switch (id)")
       cog.outl("    {")
       for n in range(1, int(Handlers) + 1):
@@ -652,6 +826,8 @@ namespace etl
       cog.outl("T%s>::value, void>::type" % int(Handlers))
       cog.outl("    receive(const TMessage& msg)")
       cog.outl("  {")
+      cog.outl("    ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));")
+      cog.outl("")
       cog.outl("    static_cast<TDerived*>(this)->on_receive(msg);")
       cog.outl("  }")
       cog.outl("")
@@ -662,6 +838,8 @@ namespace etl
       cog.outl("T%s>::value, void>::type" % int(Handlers))
       cog.outl("    receive(const TMessage& msg)")
       cog.outl("  {")
+      cog.outl("    ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));")
+      cog.outl("")
       cog.outl("    if (has_successor())")
       cog.outl("    {")
       cog.outl("      get_successor().receive(msg);")
@@ -794,6 +972,8 @@ namespace etl
           cog.outl("  {")
           cog.outl("    const size_t id = msg.get_message_id();")
           cog.outl("")
+          cog.outl("    ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));")
+          cog.outl("")
           cog.outl("    switch (id)")
           cog.outl("    {")
           for t in range(1, n + 1):
@@ -822,6 +1002,8 @@ namespace etl
           cog.outl("T%s>::value, void>::type" % n)
           cog.outl("    receive(const TMessage& msg)")
           cog.outl("  {")
+          cog.outl("    ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));")
+          cog.outl("")
           cog.outl("    static_cast<TDerived*>(this)->on_receive(msg);")
           cog.outl("  }")
           cog.outl("")
@@ -832,6 +1014,8 @@ namespace etl
           cog.outl("T%s>::value, void>::type" % n)
           cog.outl("    receive(const TMessage& msg)")
           cog.outl("  {")
+          cog.outl("    ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));")
+          cog.outl("")
           cog.outl("    if (has_successor())")
           cog.outl("    {")
           cog.outl("      get_successor().receive(msg);")
@@ -2138,6 +2138,18 @@ typedef integral_constant<bool, true>  true_type;
   };
 #endif
 
+  //*********************************************
+  // is_trivially_relocatable
+  // A type whose objects may be moved to a new address by copying their bytes,
+  // without calling the move constructor for the new object and the destructor
+  // for the old one. True for trivially copyable types.
+  // May be specialised for other types, such as those that only hold pointers
+  // to objects outside of themselves.
+  template <typename T>
+  struct is_trivially_relocatable : public etl::bool_constant<etl::is_trivially_copyable<T>::value>
+  {
+  };
+
 #if ETL_USING_CPP17
 
   template <typename T1, typename T2>
@@ -2173,6 +2185,9 @@ typedef integral_constant<bool, true>  true_type;
   template <typename T>
   inline constexpr bool is_trivially_copyable_v = etl::is_trivially_copyable<T>::value;
 
+  template <typename T>
+  inline constexpr bool is_trivially_relocatable_v = etl::is_trivially_relocatable<T>::value;
+
 #endif
 
 #if ETL_USING_CPP11
@@ -37,6 +37,11 @@ SOFTWARE.
 
 // The default hash calculation.
 #include "fnv_1.h"
+
+#if defined(ETL_USE_XXHASH)
+  #include "xxhash.h"
+#endif
+
 #include "type_traits.h"
 #include "static_assert.h"
 #include "math.h"
@@ -61,7 +66,11 @@ namespace etl
     typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if defined(ETL_USE_XXHASH)
+      uint32_t h = xxhash32_calculate(begin, static_cast<size_t>(end - begin));
+#else
       uint32_t h = fnv_1a_32(begin, end);
+#endif
 
       return static_cast<size_t>(h ^ (h >> 16U));
     }
@@ -74,7 +83,11 @@ namespace etl
     typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if defined(ETL_USE_XXHASH)
+      return xxhash32_calculate(begin, static_cast<size_t>(end - begin));
+#else
       return fnv_1a_32(begin, end);
+#endif
     }
 
 #if ETL_USING_64BIT_TYPES
@@ -86,7 +99,11 @@ namespace etl
     typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if defined(ETL_USE_XXHASH)
+      return xxhash64_calculate(begin, static_cast<size_t>(end - begin));
+#else
       return fnv_1a_64(begin, end);
+#endif
     }
 #endif
 
@@ -536,6 +553,118 @@ namespace etl
       }
     };
   }
+
+  namespace private_hash
+  {
+    //*************************************************************************
+    /// Combines a hash into a seed, when size_t is 32 bits or less.
+    /// The sum is passed through the MurmurHash3 32 bit finaliser, so that
+    /// every bit of both inputs affects every bit of the result.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) <= sizeof(uint32_t), size_t>::type
+    combine(size_t seed, size_t value)
+    {
+      uint32_t h = static_cast<uint32_t>(seed) + 0x9E3779B9UL + static_cast<uint32_t>(value);
+
+      h ^= h >> 16U;
+      h *= 0x85EBCA6BUL;
+      h ^= h >> 13U;
+      h *= 0xC2B2AE35UL;
+      h ^= h >> 16U;
+
+      return static_cast<size_t>(h);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Combines a hash into a seed, when size_t is 64 bits.
+    /// The sum is passed through the MurmurHash3 64 bit finaliser.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
+    combine(size_t seed, size_t value)
+    {
+      uint64_t h = static_cast<uint64_t>(seed) + 0x9E3779B97F4A7C15ULL + static_cast<uint64_t>(value);
+
+      h ^= h >> 33U;
+      h *= 0xFF51AFD7ED558CCDULL;
+      h ^= h >> 33U;
+      h *= 0xC4CEB9FE1A85EC53ULL;
+      h ^= h >> 33U;
+
+      return static_cast<size_t>(h);
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// Mixes the hash of the value into the seed.
+  /// Unlike XOR, the result depends on the order of the values, and is
+  /// spread over all of the bits of size_t.
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename T>
+  void hash_combine(size_t& seed, const T& value)
+  {
+    seed = private_hash::combine<size_t>(seed, etl::hash<T>()(value));
+  }
+
+#if ETL_USING_CPP11
+  namespace private_hash
+  {
+    //*************************************************************************
+    inline void hash_values(size_t&)
+    {
+    }
+
+    //*************************************************************************
+    template <typename T, typename... TRest>
+    void hash_values(size_t& seed, const T& value, const TRest&... rest)
+    {
+      etl::hash_combine(seed, value);
+      hash_values(seed, rest...);
+    }
+  }
+
+  //***************************************************************************
+  /// The combined hash of the values, in order.
+  /// For hashing the members of a struct used as a key.
+  ///\code
+  /// struct key_hash
+  /// {
+  ///   size_t operator()(const key& k) const
+  ///   {
+  ///     return etl::hash_values(k.node, k.port, k.flags);
+  ///   }
+  /// };
+  ///\endcode
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename... TValues>
+  size_t hash_values(const TValues&... values)
+  {
+    size_t seed = 0U;
+    private_hash::hash_values(seed, values...);
+    return seed;
+  }
+#endif
+
+  //***************************************************************************
+  /// Specialisation for etl::pair.
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename T1, typename T2>
+  struct hash<etl::pair<T1, T2> >
+  {
+    size_t operator ()(const etl::pair<T1, T2>& p) const
+    {
+      size_t seed = 0U;
+      etl::hash_combine(seed, p.first);
+      etl::hash_combine(seed, p.second);
+      return seed;
+    }
+  };
 }
 
 #include "private/diagnostic_pop.h"
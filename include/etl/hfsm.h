@@ -35,7 +35,7 @@ namespace etl
 {
   //***************************************************************************
   /// The HFSM class.
-  /// Builds on the FSM class by overriding the receive function and adding
+  /// Builds on the FSM class by overriding the message processing and adding
   /// state hierarchy walking functions.
   //***************************************************************************
   class hfsm : public etl::fsm
@@ -56,12 +56,16 @@ namespace etl
     /// Subsequent calls will do nothing.
     ///\param call_on_enter_state If true will call on_enter_state() for the first state. Default = true.
     /// If the first state has child states then they will be recursively entered.
+    /// The depth of each state in the hierarchy is found here, so child states
+    /// must be set before starting.
     //*******************************************
     void start(bool call_on_enter_state = true) ETL_OVERRIDE
     {
       // Can only be started once.
       if (p_state == ETL_NULLPTR)
       {
+        set_depths();
+
         p_state = state_list[0];
         ETL_ASSERT(p_state != ETL_NULLPTR, ETL_ERROR(etl::fsm_null_state_exception));
 
@@ -91,55 +95,62 @@ namespace etl
       p_state = ETL_NULLPTR;
     }
 
-    using fsm::receive;
+  protected:
 
     //*******************************************
-    /// Top level message handler for the HFSM.
+    /// Passes a message to the current state and follows the state changes
+    /// through the hierarchy.
     //*******************************************
-    void receive(const etl::imessage& message) ETL_OVERRIDE
+    void process_message(const etl::imessage& message) ETL_OVERRIDE
     {
-      if (is_started())
+      etl::fsm_state_id_t next_state_id = p_state->process_event(message);
+
+      if (next_state_id != ifsm_state::No_State_Change)
       {
-        etl::fsm_state_id_t next_state_id = p_state->process_event(message);
+        ETL_ASSERT_OR_RETURN(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+        etl::ifsm_state* p_next_state = state_list[next_state_id];
 
-        if (next_state_id != ifsm_state::No_State_Change)
+        // Have we changed state?
+        if (p_next_state != p_state)
         {
-          ETL_ASSERT_OR_RETURN(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
-          etl::ifsm_state* p_next_state = state_list[next_state_id];
+          etl::ifsm_state* p_root = common_ancestor(p_state, p_next_state);
+          do_exits(p_root, p_state);
 
-          // Have we changed state?
-          if (p_next_state != p_state)
-          {
-            etl::ifsm_state* p_root = common_ancestor(p_state, p_next_state);
-            do_exits(p_root, p_state);
+          p_state = p_next_state;
 
-            p_state = p_next_state;
+          ETL_TRACE(etl::trace_id::Fsm_Transition, etl::trace_payload(get_message_router_id(), p_state->get_state_id()));
 
-            next_state_id = do_enters(p_root, p_next_state, true);
+          next_state_id = do_enters(p_root, p_next_state, true);
 
-            if (next_state_id != ifsm_state::No_State_Change)
-            {
-              ETL_ASSERT_OR_RETURN(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
-              p_state = state_list[next_state_id];
-            }
+          if (next_state_id != ifsm_state::No_State_Change)
+          {
+            ETL_ASSERT_OR_RETURN(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+            p_state = state_list[next_state_id];
           }
         }
       }
-      else
-      {
-        ETL_ASSERT_FAIL(ETL_ERROR(etl::fsm_not_started));
-      }
     }
 
   private:
 
+    //*******************************************
+    /// Finds the depth of each state, so that transitions do not have to.
+    //*******************************************
+    void set_depths()
+    {
+      for (etl::fsm_state_id_t i = 0U; i < number_of_states; ++i)
+      {
+        state_list[i]->depth = etl::fsm_state_id_t(get_depth(state_list[i]));
+      }
+    }
+
     //*******************************************
     /// Return the first common ancestor of the two states.
     //*******************************************
     static etl::ifsm_state* common_ancestor(etl::ifsm_state* s1, etl::ifsm_state* s2)
     {
-      size_t depth1 = get_depth(s1);
-      size_t depth2 = get_depth(s2);
+      const size_t depth1 = s1->depth;
+      const size_t depth2 = s2->depth;
 
       // Adjust s1 and s2 to the same depth.
       if (depth1 > depth2)
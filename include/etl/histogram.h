@@ -122,13 +122,78 @@ namespace etl
         return etl::accumulate(accumulator.begin(), accumulator.end(), size_t(0));
       }
 
+      static ETL_CONSTANT size_t Bulk_Lanes = 4U; ///< The number of count lanes used by add_bulk.
+
     protected:
 
+      //*********************************
+      /// Adds the keys in a range, four at a time, into separate lanes
+      /// that are summed at the end. Consecutive equal keys then increment
+      /// different counters, so no increment waits on the one before.
+      //*********************************
+      template <typename TIterator, typename TStart>
+      void add_lanes(TIterator first, TIterator last, TStart start)
+      {
+        TCount lanes[Bulk_Lanes - 1U][Max_Size];
+
+        for (size_t lane = 0U; lane < (Bulk_Lanes - 1U); ++lane)
+        {
+          for (size_t i = 0U; i < Max_Size; ++i)
+          {
+            lanes[lane][i] = TCount(0);
+          }
+        }
+
+        size_t n = size_t(etl::distance(first, last));
+
+        while (n >= Bulk_Lanes)
+        {
+          ++accumulator[*first - start];
+          ++first;
+          ++lanes[0][*first - start];
+          ++first;
+          ++lanes[1][*first - start];
+          ++first;
+          ++lanes[2][*first - start];
+          ++first;
+
+          n -= Bulk_Lanes;
+        }
+
+        while (n != 0U)
+        {
+          ++accumulator[*first - start];
+          ++first;
+          --n;
+        }
+
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          accumulator[i] += lanes[0][i];
+          accumulator[i] += lanes[1][i];
+          accumulator[i] += lanes[2][i];
+        }
+      }
+
+      //*********************************
+      /// Adds the counts of another histogram.
+      //*********************************
+      void merge_counts(const histogram_common& other)
+      {
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          accumulator[i] += other.accumulator[i];
+        }
+      }
+
       etl::array<TCount, Max_Size> accumulator;
     };
 
     template <typename TCount, size_t Max_Size_>   
     ETL_CONSTANT size_t histogram_common<TCount, Max_Size_>::Max_Size;
+
+    template <typename TCount, size_t Max_Size_>
+    ETL_CONSTANT size_t histogram_common<TCount, Max_Size_>::Bulk_Lanes;
   }
 
   //***************************************************************************
@@ -227,6 +292,25 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a range using several count lanes.
+    /// Faster than add(first, last) when many samples share a key, as with
+    /// image and ADC data. Uses (Bulk_Lanes - 1) * Max_Size counts of stack.
+    //*********************************
+    template <typename TIterator>
+    void add_bulk(TIterator first, TIterator last)
+    {
+      this->add_lanes(first, last, Start_Index);
+    }
+
+    //*********************************
+    /// Add the counts of another histogram.
+    //*********************************
+    void merge(const histogram& other)
+    {
+      this->merge_counts(other);
+    }
+
     //*********************************
     /// operator ()
     //*********************************
@@ -351,6 +435,26 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a range using several count lanes.
+    /// Faster than add(first, last) when many samples share a key, as with
+    /// image and ADC data. Uses (Bulk_Lanes - 1) * Max_Size counts of stack.
+    //*********************************
+    template <typename TIterator>
+    void add_bulk(TIterator first, TIterator last)
+    {
+      this->add_lanes(first, last, start_index);
+    }
+
+    //*********************************
+    /// Add the counts of another histogram.
+    /// Both histograms must have the same start index.
+    //*********************************
+    void merge(const histogram& other)
+    {
+      this->merge_counts(other);
+    }
+
     //*********************************
     /// operator ()
     //*********************************
@@ -521,6 +625,17 @@ namespace etl
       add(key);
     }
 
+    //*********************************
+    /// Add the counts of another histogram.
+    //*********************************
+    void merge(const sparse_histogram& other)
+    {
+      for (const_iterator itr = other.accumulator.begin(); itr != other.accumulator.end(); ++itr)
+      {
+        accumulator[itr->first] += itr->second;
+      }
+    }
+
     //*********************************
     /// operator ()
     //*********************************
@@ -0,0 +1,923 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_IMAGE_VIEW_INCLUDED
+#define ETL_IMAGE_VIEW_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "utility.h"
+#include "span.h"
+#include "string_view.h"
+#include "crc32.h"
+#include "alignment.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup image_view image_view
+/// Read only, zero copy containers over binary images, such as tables in
+/// flash or in a memory mapped file.
+/// An image is a header followed by a payload. The header records the kind
+/// of container, the element size and count, and a CRC32 of the payload.
+/// A view validates the header, the CRC and the ordering when it is opened,
+/// then serves lookups directly from the image.
+/// Each view has a static build() function that emits a compatible image,
+/// for use by a host side tool or at run time.
+/// The elements are stored in their in-memory representation, so the image
+/// must be built for the same byte order and layout as the target. A byte
+/// order mismatch is detected by the magic number.
+/// The image must be aligned for the element type.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the image views.
+  ///\ingroup image_view
+  //***************************************************************************
+  class image_view_exception : public exception
+  {
+  public:
+
+    image_view_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The key or index is not in the view.
+  ///\ingroup image_view
+  //***************************************************************************
+  class image_view_out_of_range : public image_view_exception
+  {
+  public:
+
+    image_view_out_of_range(string_type file_name_, numeric_type line_number_)
+      : image_view_exception(ETL_ERROR_TEXT("image_view:out of range", ETL_IMAGE_VIEW_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The header at the start of an image.
+  ///\ingroup image_view
+  //***************************************************************************
+  struct image_header
+  {
+    enum
+    {
+      Magic   = 0x474D4945, // "EIMG" in little endian order.
+      Version = 1
+    };
+
+    enum kind_type
+    {
+      Sorted_Array = 1,
+      Flat_Map     = 2,
+      String_Table = 3
+    };
+
+    enum flag_type
+    {
+      Sorted = 0x01
+    };
+
+    uint32_t magic;
+    uint16_t version;
+    uint8_t  kind;
+    uint8_t  flags;
+    uint32_t element_size;
+    uint32_t count;
+    uint32_t payload_size; ///< The size of the payload that follows the header.
+    uint32_t crc;          ///< The CRC32 of the payload.
+  };
+
+  ETL_STATIC_ASSERT(sizeof(image_header) == 24U, "Unexpected image_header size");
+
+  namespace private_image_view
+  {
+    //*************************************************************************
+    /// Validates an image and returns its payload, or null if it is invalid.
+    //*************************************************************************
+    inline const uint8_t* open(const void* p_image, size_t image_size, uint8_t kind, uint32_t element_size, size_t alignment, image_header& header)
+    {
+      if ((p_image == ETL_NULLPTR) || (image_size < sizeof(image_header)))
+      {
+        return ETL_NULLPTR;
+      }
+
+      const uint8_t* p_payload = static_cast<const uint8_t*>(p_image) + sizeof(image_header);
+
+      memcpy(&header, p_image, sizeof(image_header));
+
+      if ((header.magic        != static_cast<uint32_t>(image_header::Magic))   ||
+          (header.version      != static_cast<uint16_t>(image_header::Version)) ||
+          (header.kind         != kind)                                         ||
+          (header.element_size != element_size)                                 ||
+          (header.payload_size >  (image_size - sizeof(image_header)))          ||
+          ((reinterpret_cast<uintptr_t>(p_payload) % alignment) != 0U))
+      {
+        return ETL_NULLPTR;
+      }
+
+      etl::crc32 crc(p_payload, p_payload + header.payload_size);
+
+      return (crc.value() == header.crc) ? p_payload : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Writes the header for the payload already in the image.
+    /// Returns the size of the image.
+    //*************************************************************************
+    inline size_t finish(etl::span<uint8_t> image, uint8_t kind, uint8_t flags, uint32_t element_size, uint32_t count, uint32_t payload_size)
+    {
+      const uint8_t* p_payload = image.data() + sizeof(image_header);
+
+      image_header header;
+
+      header.magic        = static_cast<uint32_t>(image_header::Magic);
+      header.version      = static_cast<uint16_t>(image_header::Version);
+      header.kind         = kind;
+      header.flags        = flags;
+      header.element_size = element_size;
+      header.count        = count;
+      header.payload_size = payload_size;
+      header.crc          = etl::crc32(p_payload, p_payload + payload_size).value();
+
+      memcpy(image.data(), &header, sizeof(image_header));
+
+      return sizeof(image_header) + payload_size;
+    }
+  }
+
+  //***************************************************************************
+  /// A read only view of a sorted array in an image.
+  /// T must be trivially copyable.
+  ///\ingroup image_view
+  //***************************************************************************
+  template <typename T, typename TCompare = etl::less<T> >
+  class sorted_array_view
+  {
+  public:
+
+    typedef T         value_type;
+    typedef const T&  const_reference;
+    typedef const T*  const_pointer;
+    typedef const T*  const_iterator;
+    typedef size_t    size_type;
+    typedef TCompare  value_compare;
+
+    //*************************************************************************
+    /// Constructs an invalid view.
+    //*************************************************************************
+    sorted_array_view()
+      : p_begin(ETL_NULLPTR)
+      , p_end(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs a view of an image. Check is_valid() before use.
+    //*************************************************************************
+    sorted_array_view(const void* p_image, size_t image_size)
+      : p_begin(ETL_NULLPTR)
+      , p_end(ETL_NULLPTR)
+    {
+      open(p_image, image_size);
+    }
+
+    //*************************************************************************
+    /// Validates an image and views it.
+    /// Returns <b>false</b>, and leaves the view invalid, if the image is
+    /// damaged, of another kind or element type, misaligned, or unsorted.
+    //*************************************************************************
+    bool open(const void* p_image, size_t image_size)
+    {
+      close();
+
+      image_header header;
+
+      const uint8_t* p_payload = private_image_view::open(p_image, image_size, image_header::Sorted_Array, sizeof(T), etl::alignment_of<T>::value, header);
+
+      if ((p_payload == ETL_NULLPTR) || (header.payload_size != (static_cast<size_t>(header.count) * sizeof(T))))
+      {
+        return false;
+      }
+
+      const_iterator first = reinterpret_cast<const_iterator>(p_payload);
+      const_iterator last  = first + header.count;
+
+      if (!etl::is_sorted(first, last, value_compare()))
+      {
+        return false;
+      }
+
+      p_begin = first;
+      p_end   = last;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Makes the view invalid.
+    //*************************************************************************
+    void close()
+    {
+      p_begin = ETL_NULLPTR;
+      p_end   = ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the view is of a valid image.
+    //*************************************************************************
+    bool is_valid() const
+    {
+      return p_begin != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_begin;
+    }
+
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_end;
+    }
+
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return p_begin;
+    }
+
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return p_end;
+    }
+
+    //*************************************************************************
+    const_pointer data() const
+    {
+      return p_begin;
+    }
+
+    //*************************************************************************
+    size_type size() const
+    {
+      return static_cast<size_type>(p_end - p_begin);
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return p_begin == p_end;
+    }
+
+    //*************************************************************************
+    const_reference operator [](size_type i) const
+    {
+      return p_begin[i];
+    }
+
+    //*************************************************************************
+    /// Returns the element at index 'i'.
+    /// Emits an etl::image_view_out_of_range if the index is out of range.
+    //*************************************************************************
+    const_reference at(size_type i) const
+    {
+      ETL_ASSERT(i < size(), ETL_ERROR(image_view_out_of_range));
+
+      return p_begin[i];
+    }
+
+    //*************************************************************************
+    const_iterator lower_bound(const T& value) const
+    {
+      return etl::lower_bound(p_begin, p_end, value, value_compare());
+    }
+
+    //*************************************************************************
+    const_iterator upper_bound(const T& value) const
+    {
+      return etl::upper_bound(p_begin, p_end, value, value_compare());
+    }
+
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const T& value) const
+    {
+      return etl::equal_range(p_begin, p_end, value, value_compare());
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element equivalent to 'value', or end().
+    //*************************************************************************
+    const_iterator find(const T& value) const
+    {
+      const_iterator itr = lower_bound(value);
+
+      return ((itr != p_end) && !value_compare()(value, *itr)) ? itr : p_end;
+    }
+
+    //*************************************************************************
+    bool contains(const T& value) const
+    {
+      return find(value) != p_end;
+    }
+
+    //*************************************************************************
+    size_type count(const T& value) const
+    {
+      ETL_OR_STD::pair<const_iterator, const_iterator> range = equal_range(value);
+
+      return static_cast<size_type>(range.second - range.first);
+    }
+
+    //*************************************************************************
+    /// Returns the size of an image of 'n' elements.
+    //*************************************************************************
+    static size_t image_size(size_t n)
+    {
+      return sizeof(image_header) + (n * sizeof(T));
+    }
+
+    //*************************************************************************
+    /// Sorts the elements in place and writes an image of them.
+    /// Returns the size of the image, or 0 if it does not fit.
+    //*************************************************************************
+    static size_t build(T* p_elements, size_t n, etl::span<uint8_t> image)
+    {
+      if (image.size() < image_size(n))
+      {
+        return 0U;
+      }
+
+      etl::sort(p_elements, p_elements + n, value_compare());
+
+      if (n != 0U)
+      {
+        memcpy(image.data() + sizeof(image_header), p_elements, n * sizeof(T));
+      }
+
+      return private_image_view::finish(image, image_header::Sorted_Array, image_header::Sorted, sizeof(T), static_cast<uint32_t>(n), static_cast<uint32_t>(n * sizeof(T)));
+    }
+
+  private:
+
+    const_iterator p_begin;
+    const_iterator p_end;
+  };
+
+  //***************************************************************************
+  /// A read only view of a map, stored as a sorted array of key/value pairs.
+  /// The key and mapped types must be trivially copyable.
+  ///\ingroup image_view
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class flat_map_view
+  {
+  public:
+
+    typedef TKey        key_type;
+    typedef TMapped     mapped_type;
+    typedef TKeyCompare key_compare;
+    typedef size_t      size_type;
+
+    //*************************************************************************
+    /// The stored element. A trivially copyable equivalent of a pair.
+    //*************************************************************************
+    struct value_type
+    {
+      TKey    first;
+      TMapped second;
+    };
+
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef const value_type* const_iterator;
+
+    //*************************************************************************
+    /// Constructs an invalid view.
+    //*************************************************************************
+    flat_map_view()
+      : p_begin(ETL_NULLPTR)
+      , p_end(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs a view of an image. Check is_valid() before use.
+    //*************************************************************************
+    flat_map_view(const void* p_image, size_t image_size)
+      : p_begin(ETL_NULLPTR)
+      , p_end(ETL_NULLPTR)
+    {
+      open(p_image, image_size);
+    }
+
+    //*************************************************************************
+    /// Validates an image and views it.
+    /// Returns <b>false</b>, and leaves the view invalid, if the image is
+    /// damaged, of another kind or element type, misaligned, or its keys are
+    /// not sorted and unique.
+    //*************************************************************************
+    bool open(const void* p_image, size_t image_size)
+    {
+      close();
+
+      image_header header;
+
+      const uint8_t* p_payload = private_image_view::open(p_image, image_size, image_header::Flat_Map, sizeof(value_type), etl::alignment_of<value_type>::value, header);
+
+      if ((p_payload == ETL_NULLPTR) || (header.payload_size != (static_cast<size_t>(header.count) * sizeof(value_type))))
+      {
+        return false;
+      }
+
+      const_iterator first = reinterpret_cast<const_iterator>(p_payload);
+      const_iterator last  = first + header.count;
+
+      for (const_iterator itr = first; (itr != last) && ((itr + 1) != last); ++itr)
+      {
+        if (!key_compare()(itr->first, (itr + 1)->first))
+        {
+          return false;
+        }
+      }
+
+      p_begin = first;
+      p_end   = last;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Makes the view invalid.
+    //*************************************************************************
+    void close()
+    {
+      p_begin = ETL_NULLPTR;
+      p_end   = ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the view is of a valid image.
+    //*************************************************************************
+    bool is_valid() const
+    {
+      return p_begin != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_begin;
+    }
+
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_end;
+    }
+
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return p_begin;
+    }
+
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return p_end;
+    }
+
+    //*************************************************************************
+    size_type size() const
+    {
+      return static_cast<size_type>(p_end - p_begin);
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return p_begin == p_end;
+    }
+
+    //*************************************************************************
+    /// Returns the value mapped to 'key'.
+    /// Emits an etl::image_view_out_of_range if the key is not in the map.
+    //*************************************************************************
+    const mapped_type& at(const key_type& key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != p_end, ETL_ERROR(image_view_out_of_range));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    const_iterator lower_bound(const key_type& key) const
+    {
+      return etl::lower_bound(p_begin, p_end, key, compare());
+    }
+
+    //*************************************************************************
+    const_iterator upper_bound(const key_type& key) const
+    {
+      return etl::upper_bound(p_begin, p_end, key, compare());
+    }
+
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+      return etl::equal_range(p_begin, p_end, key, compare());
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the element with 'key', or end().
+    //*************************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      const_iterator itr = lower_bound(key);
+
+      return ((itr != p_end) && !key_compare()(key, itr->first)) ? itr : p_end;
+    }
+
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return find(key) != p_end;
+    }
+
+    //*************************************************************************
+    size_type count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the size of an image of 'n' elements.
+    //*************************************************************************
+    static size_t image_size(size_t n)
+    {
+      return sizeof(image_header) + (n * sizeof(value_type));
+    }
+
+    //*************************************************************************
+    /// Sorts the elements in place by key and writes an image of them.
+    /// Returns the size of the image, or 0 if it does not fit or a key is
+    /// duplicated.
+    //*************************************************************************
+    static size_t build(value_type* p_elements, size_t n, etl::span<uint8_t> image)
+    {
+      if (image.size() < image_size(n))
+      {
+        return 0U;
+      }
+
+      etl::sort(p_elements, p_elements + n, compare());
+
+      for (size_t i = 1U; i < n; ++i)
+      {
+        if (!key_compare()(p_elements[i - 1U].first, p_elements[i].first))
+        {
+          return 0U;
+        }
+      }
+
+      if (n != 0U)
+      {
+        memcpy(image.data() + sizeof(image_header), p_elements, n * sizeof(value_type));
+      }
+
+      return private_image_view::finish(image, image_header::Flat_Map, image_header::Sorted, sizeof(value_type), static_cast<uint32_t>(n), static_cast<uint32_t>(n * sizeof(value_type)));
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Compares elements and keys by key.
+    //*************************************************************************
+    struct compare
+    {
+      bool operator ()(const value_type& lhs, const value_type& rhs) const
+      {
+        return key_compare()(lhs.first, rhs.first);
+      }
+
+      bool operator ()(const value_type& element, const key_type& key) const
+      {
+        return key_compare()(element.first, key);
+      }
+
+      bool operator ()(const key_type& key, const value_type& element) const
+      {
+        return key_compare()(key, element.first);
+      }
+    };
+
+    const_iterator p_begin;
+    const_iterator p_end;
+  };
+
+  //***************************************************************************
+  /// A read only view of a table of strings in an image.
+  /// The payload is a table of count + 1 offsets, followed by the strings,
+  /// each terminated with a zero. A table built from sorted strings is
+  /// flagged as sorted, and is searched with a binary search.
+  ///\ingroup image_view
+  //***************************************************************************
+  class string_table_view
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Constructs an invalid view.
+    //*************************************************************************
+    string_table_view()
+      : p_offsets(ETL_NULLPTR)
+      , p_strings(ETL_NULLPTR)
+      , n_strings(0U)
+      , sorted(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs a view of an image. Check is_valid() before use.
+    //*************************************************************************
+    string_table_view(const void* p_image, size_t image_size)
+      : p_offsets(ETL_NULLPTR)
+      , p_strings(ETL_NULLPTR)
+      , n_strings(0U)
+      , sorted(false)
+    {
+      open(p_image, image_size);
+    }
+
+    //*************************************************************************
+    /// Validates an image and views it.
+    /// Returns <b>false</b>, and leaves the view invalid, if the image is
+    /// damaged, of another kind, misaligned, or has a malformed table.
+    //*************************************************************************
+    bool open(const void* p_image, size_t image_size)
+    {
+      close();
+
+      image_header header;
+
+      const uint8_t* p_payload = private_image_view::open(p_image, image_size, image_header::String_Table, sizeof(uint32_t), etl::alignment_of<uint32_t>::value, header);
+
+      if ((p_payload == ETL_NULLPTR) || (header.count >= (header.payload_size / sizeof(uint32_t))))
+      {
+        return false;
+      }
+
+      const uint32_t* p_table = reinterpret_cast<const uint32_t*>(p_payload);
+      const char*     p_chars = reinterpret_cast<const char*>(p_payload);
+
+      if ((p_table[0] != ((header.count + 1U) * sizeof(uint32_t))) || (p_table[header.count] != header.payload_size))
+      {
+        return false;
+      }
+
+      for (uint32_t i = 0U; i < header.count; ++i)
+      {
+        // Each string is at least its terminator, and ends with it.
+        if ((p_table[i + 1U] <= p_table[i]) || (p_chars[p_table[i + 1U] - 1U] != '\0'))
+        {
+          return false;
+        }
+      }
+
+      p_offsets = p_table;
+      p_strings = p_chars;
+      n_strings = header.count;
+      sorted    = (header.flags & image_header::Sorted) != 0U;
+
+      for (size_t i = 1U; sorted && (i < n_strings); ++i)
+      {
+        if (!((*this)[i - 1U] < (*this)[i]))
+        {
+          close();
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Makes the view invalid.
+    //*************************************************************************
+    void close()
+    {
+      p_offsets = ETL_NULLPTR;
+      p_strings = ETL_NULLPTR;
+      n_strings = 0U;
+      sorted    = false;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the view is of a valid image.
+    //*************************************************************************
+    bool is_valid() const
+    {
+      return p_offsets != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the strings are in sorted order.
+    //*************************************************************************
+    bool is_sorted() const
+    {
+      return sorted;
+    }
+
+    //*************************************************************************
+    size_type size() const
+    {
+      return n_strings;
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return n_strings == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the string at index 'i'.
+    //*************************************************************************
+    etl::string_view operator [](size_type i) const
+    {
+      return etl::string_view(p_strings + p_offsets[i], p_offsets[i + 1U] - p_offsets[i] - 1U);
+    }
+
+    //*************************************************************************
+    /// Returns the string at index 'i'.
+    /// Emits an etl::image_view_out_of_range if the index is out of range.
+    //*************************************************************************
+    etl::string_view at(size_type i) const
+    {
+      ETL_ASSERT(i < n_strings, ETL_ERROR(image_view_out_of_range));
+
+      return (*this)[i];
+    }
+
+    //*************************************************************************
+    /// Returns the zero terminated string at index 'i'.
+    //*************************************************************************
+    const char* c_str(size_type i) const
+    {
+      return p_strings + p_offsets[i];
+    }
+
+    //*************************************************************************
+    /// Returns the index of 'text', or size() if it is not in the table.
+    /// A binary search if the table is sorted, otherwise linear.
+    //*************************************************************************
+    size_type find(etl::string_view text) const
+    {
+      if (sorted)
+      {
+        size_type first = 0U;
+        size_type count = n_strings;
+
+        while (count != 0U)
+        {
+          const size_type step = count / 2U;
+          const size_type i    = first + step;
+
+          if ((*this)[i] < text)
+          {
+            first  = i + 1U;
+            count -= step + 1U;
+          }
+          else
+          {
+            count = step;
+          }
+        }
+
+        return ((first != n_strings) && ((*this)[first] == text)) ? first : n_strings;
+      }
+
+      for (size_type i = 0U; i < n_strings; ++i)
+      {
+        if ((*this)[i] == text)
+        {
+          return i;
+        }
+      }
+
+      return n_strings;
+    }
+
+    //*************************************************************************
+    bool contains(etl::string_view text) const
+    {
+      return find(text) != n_strings;
+    }
+
+    //*************************************************************************
+    /// Returns the size of an image of the strings.
+    //*************************************************************************
+    static size_t image_size(const etl::string_view* p_strings, size_t n)
+    {
+      size_t size = sizeof(image_header) + ((n + 1U) * sizeof(uint32_t));
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        size += p_strings[i].size() + 1U;
+      }
+
+      return size;
+    }
+
+    //*************************************************************************
+    /// Writes an image of the strings, in the order given.
+    /// Returns the size of the image, or 0 if it does not fit.
+    //*************************************************************************
+    static size_t build(const etl::string_view* p_strings, size_t n, etl::span<uint8_t> image)
+    {
+      if (image.size() < image_size(p_strings, n))
+      {
+        return 0U;
+      }
+
+      uint8_t* p_payload = image.data() + sizeof(image_header);
+      uint32_t offset    = static_cast<uint32_t>((n + 1U) * sizeof(uint32_t));
+      bool     in_order  = true;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        memcpy(p_payload + (i * sizeof(uint32_t)), &offset, sizeof(uint32_t));
+
+        if (!p_strings[i].empty())
+        {
+          memcpy(p_payload + offset, p_strings[i].data(), p_strings[i].size());
+        }
+
+        offset += static_cast<uint32_t>(p_strings[i].size());
+        p_payload[offset++] = 0U;
+
+        in_order = in_order && ((i == 0U) || (p_strings[i - 1U] < p_strings[i]));
+      }
+
+      memcpy(p_payload + (n * sizeof(uint32_t)), &offset, sizeof(uint32_t));
+
+      return private_image_view::finish(image, image_header::String_Table, in_order ? uint8_t(image_header::Sorted) : uint8_t(0U), sizeof(uint32_t), static_cast<uint32_t>(n), offset);
+    }
+
+  private:
+
+    const uint32_t* p_offsets;
+    const char*     p_strings;
+    size_t          n_strings;
+    bool            sorted;
+  };
+}
+
+#endif
@@ -35,6 +35,10 @@ SOFTWARE.
 #include "nullptr.h"
 #include "successor.h"
 
+#if ETL_HAS_ALLOCATION_STATISTICS
+  #include "allocation_statistics.h"
+#endif
+
 namespace etl
 {
   //*****************************************************************************
@@ -60,6 +64,17 @@ namespace etl
       // Call the derived implementation.
       void* p = allocate_block(required_size, required_alignment);
 
+#if ETL_HAS_ALLOCATION_STATISTICS
+      if (p == ETL_NULLPTR)
+      {
+        statistics.on_failure();
+      }
+      else
+      {
+        statistics.on_allocate();
+      }
+#endif
+
       // If that failed...
       if (p == ETL_NULLPTR)
       {
@@ -82,6 +97,13 @@ namespace etl
     {
       bool was_released = release_block(p);
 
+#if ETL_HAS_ALLOCATION_STATISTICS
+      if (was_released)
+      {
+        statistics.on_release();
+      }
+#endif
+
       // If that failed...
       if (!was_released)
       {
@@ -118,6 +140,25 @@ namespace etl
       return is_owner;
     }
 
+#if ETL_HAS_ALLOCATION_STATISTICS
+    //*****************************************************************************
+    /// Gets the allocation statistics for this allocator.
+    /// Requests handled by a successor are recorded by the successor.
+    //*****************************************************************************
+    etl::allocation_statistics& get_statistics()
+    {
+      return statistics;
+    }
+
+    //*****************************************************************************
+    /// Gets the allocation statistics for this allocator.
+    //*****************************************************************************
+    const etl::allocation_statistics& get_statistics() const
+    {
+      return statistics;
+    }
+#endif
+
   protected:
 
     virtual void* allocate_block(size_t required_size, size_t required_alignment) = 0;
@@ -129,6 +170,10 @@ namespace etl
     // No copying allowed.
     imemory_block_allocator(const etl::imemory_block_allocator&) ETL_DELETE;
     imemory_block_allocator& operator =(const imemory_block_allocator&) ETL_DELETE;
+
+#if ETL_HAS_ALLOCATION_STATISTICS
+    etl::allocation_statistics statistics;
+#endif
   };
 }
 
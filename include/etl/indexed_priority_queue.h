@@ -0,0 +1,592 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+#define ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+
+#include "platform.h"
+#include "priority_queue.h"
+#include "functional.h"
+#include "memory.h"
+#include "smallest.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup indexed_priority_queue indexed_priority_queue
+/// A priority queue that returns a handle for each pushed value.
+/// The handle may be used to access, update or erase the value in O(log n).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  /// A fixed capacity priority queue with handles.
+  /// Each value stays in its slot while queued; the heap orders slot indices,
+  /// so values are never moved by a push, pop, update or erase.
+  /// A handle is valid from the push that returned it until the value
+  /// leaves the queue, after which it may be reused by a later push.
+  /// This queue does not support concurrent access by different threads.
+  /// \tparam T         The type of value that the queue holds.
+  /// \tparam VMax_Size The maximum capacity of the queue.
+  /// \tparam TCompare  The comparison. The highest value is at the top.
+  /// \tparam Arity     The number of children of each node of the heap.
+  //***************************************************************************
+  template <typename T, size_t VMax_Size, typename TCompare = etl::less<T>, size_t Arity = 2U>
+  class indexed_priority_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VMax_Size > 0U, "Capacity must be greater than zero");
+    ETL_STATIC_ASSERT(Arity >= 2U, "A heap must have an arity of at least 2");
+
+    typedef T                                                   value_type;
+    typedef TCompare                                            compare_type;
+    typedef T&                                                  reference;
+    typedef const T&                                            const_reference;
+#if ETL_USING_CPP11
+    typedef T&&                                                 rvalue_reference;
+#endif
+    typedef size_t                                              size_type;
+    typedef typename etl::smallest_uint_for_value<VMax_Size>::type handle_type;
+
+    static ETL_CONSTANT size_type   MAX_SIZE  = VMax_Size;
+    static ETL_CONSTANT handle_type No_Handle = handle_type(VMax_Size); ///< Not a handle of any value.
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    indexed_priority_queue()
+      : current_size(0U)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// The handles of the copy refer to the same values as the original's.
+    //*************************************************************************
+    indexed_priority_queue(const indexed_priority_queue& other)
+      : current_size(0U)
+    {
+      clone(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    /// The handles of this queue refer to the same values as the other's.
+    //*************************************************************************
+    indexed_priority_queue(indexed_priority_queue&& other)
+      : current_size(0U)
+    {
+      move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~indexed_priority_queue()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    indexed_priority_queue& operator =(const indexed_priority_queue& other)
+    {
+      if (&other != this)
+      {
+        clear();
+        clone(other);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    indexed_priority_queue& operator =(indexed_priority_queue&& other)
+    {
+      if (&other != this)
+      {
+        clear();
+        move_from(other);
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// If asserts or exceptions are enabled, emits an etl::priority_queue_full
+    /// if the queue is already full.
+    ///\return The handle of the value, or No_Handle if the queue is full.
+    //*************************************************************************
+    handle_type push(const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(etl::priority_queue_full), No_Handle);
+
+      const handle_type handle = heap[current_size];
+      ::new (slot(handle)) T(value);
+
+      return insert(handle);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves a value to the queue.
+    /// If asserts or exceptions are enabled, emits an etl::priority_queue_full
+    /// if the queue is already full.
+    ///\return The handle of the value, or No_Handle if the queue is full.
+    //*************************************************************************
+    handle_type push(rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(etl::priority_queue_full), No_Handle);
+
+      const handle_type handle = heap[current_size];
+      ::new (slot(handle)) T(etl::move(value));
+
+      return insert(handle);
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue.
+    /// If asserts or exceptions are enabled, emits an etl::priority_queue_full
+    /// if the queue is already full.
+    ///\return The handle of the value, or No_Handle if the queue is full.
+    //*************************************************************************
+    template <typename... TArgs>
+    handle_type emplace(TArgs&&... args)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(etl::priority_queue_full), No_Handle);
+
+      const handle_type handle = heap[current_size];
+      ::new (slot(handle)) T(etl::forward<TArgs>(args)...);
+
+      return insert(handle);
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the highest priority value.
+    //*************************************************************************
+    reference top()
+    {
+      return *slot(heap[0]);
+    }
+
+    //*************************************************************************
+    /// Gets the highest priority value.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return *slot(heap[0]);
+    }
+
+    //*************************************************************************
+    /// Gets the handle of the highest priority value, or No_Handle if empty.
+    //*************************************************************************
+    handle_type top_handle() const
+    {
+      return empty() ? No_Handle : heap[0];
+    }
+
+    //*************************************************************************
+    /// Removes the highest priority value.
+    /// Does nothing if the queue is empty.
+    //*************************************************************************
+    void pop()
+    {
+      if (!empty())
+      {
+        remove(heap[0]);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the highest priority value to destination and removes it.
+    //*************************************************************************
+    void pop_into(reference destination)
+    {
+      destination = ETL_MOVE(top());
+      pop();
+    }
+
+    //*************************************************************************
+    /// Checks that the handle refers to a value in the queue.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return (handle < VMax_Size) && (position[handle] != No_Handle);
+    }
+
+    //*************************************************************************
+    /// Gets the value for the handle.
+    /// Call update(handle) after modifying the value's priority.
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::priority_queue_invalid_handle if the handle is not in the queue.
+    //*************************************************************************
+    reference get(handle_type handle)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::priority_queue_invalid_handle));
+
+      return *slot(handle);
+    }
+
+    //*************************************************************************
+    /// Gets the value for the handle.
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::priority_queue_invalid_handle if the handle is not in the queue.
+    //*************************************************************************
+    const_reference get(handle_type handle) const
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::priority_queue_invalid_handle));
+
+      return *slot(handle);
+    }
+
+    //*************************************************************************
+    /// Restores the order after the value for the handle has been modified.
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::priority_queue_invalid_handle if the handle is not in the queue.
+    //*************************************************************************
+    void update(handle_type handle)
+    {
+      ETL_ASSERT_OR_RETURN(contains(handle), ETL_ERROR(etl::priority_queue_invalid_handle));
+
+      restore(position[handle]);
+    }
+
+    //*************************************************************************
+    /// Replaces the value for the handle and restores the order.
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::priority_queue_invalid_handle if the handle is not in the queue.
+    //*************************************************************************
+    void update(handle_type handle, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(contains(handle), ETL_ERROR(etl::priority_queue_invalid_handle));
+
+      *slot(handle) = value;
+      restore(position[handle]);
+    }
+
+    //*************************************************************************
+    /// Removes the value for the handle.
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::priority_queue_invalid_handle if the handle is not in the queue.
+    //*************************************************************************
+    void erase(handle_type handle)
+    {
+      ETL_ASSERT_OR_RETURN(contains(handle), ETL_ERROR(etl::priority_queue_invalid_handle));
+
+      remove(handle);
+    }
+
+    //*************************************************************************
+    /// Removes all values.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_type i = 0U; i < current_size; ++i)
+      {
+        slot(heap[i])->~T();
+      }
+
+      current_size = 0U;
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Returns the number of values in the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values in the queue.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values in the queue.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return VMax_Size - current_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == VMax_Size;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// All slots free, in order.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0U; i < VMax_Size; ++i)
+      {
+        heap[i]     = handle_type(i);
+        position[i] = No_Handle;
+      }
+    }
+
+    //*************************************************************************
+    T* slot(handle_type handle)
+    {
+      return static_cast<T*>(buffer) + handle;
+    }
+
+    //*************************************************************************
+    const T* slot(handle_type handle) const
+    {
+      return static_cast<const T*>(buffer) + handle;
+    }
+
+    //*************************************************************************
+    /// Is the value at heap index a lower priority than the value at heap index b?
+    //*************************************************************************
+    bool lower(size_type a, size_type b) const
+    {
+      return compare(*slot(heap[a]), *slot(heap[b]));
+    }
+
+    //*************************************************************************
+    /// Places the handle at the heap index.
+    //*************************************************************************
+    void place(size_type index, handle_type handle)
+    {
+      heap[index]      = handle;
+      position[handle] = handle_type(index);
+    }
+
+    //*************************************************************************
+    /// Adds the constructed value in the slot to the heap.
+    /// The slot is the first free one, at heap[current_size].
+    //*************************************************************************
+    handle_type insert(handle_type handle)
+    {
+      position[handle] = handle_type(current_size);
+      ++current_size;
+      sift_up(current_size - 1U);
+
+      return handle;
+    }
+
+    //*************************************************************************
+    /// Destroys the value for the handle and removes it from the heap.
+    /// The slot becomes the first free one, at heap[current_size].
+    //*************************************************************************
+    void remove(handle_type handle)
+    {
+      const size_type index = position[handle];
+      const size_type last  = current_size - 1U;
+
+      slot(handle)->~T();
+      position[handle] = No_Handle;
+      current_size     = last;
+
+      if (index != last)
+      {
+        place(index, heap[last]);
+        heap[last] = handle;
+        restore(index);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the value at the heap index up or down to its place.
+    //*************************************************************************
+    void restore(size_type index)
+    {
+      if ((index > 0U) && lower((index - 1U) / Arity, index))
+      {
+        sift_up(index);
+      }
+      else
+      {
+        sift_down(index);
+      }
+    }
+
+    //*************************************************************************
+    void sift_up(size_type index)
+    {
+      const handle_type handle = heap[index];
+      const T&          value  = *slot(handle);
+
+      while (index > 0U)
+      {
+        const size_type parent = (index - 1U) / Arity;
+
+        if (!compare(*slot(heap[parent]), value))
+        {
+          break;
+        }
+
+        place(index, heap[parent]);
+        index = parent;
+      }
+
+      place(index, handle);
+    }
+
+    //*************************************************************************
+    void sift_down(size_type index)
+    {
+      const handle_type handle = heap[index];
+      const T&          value  = *slot(handle);
+
+      while (true)
+      {
+        const size_type child = (index * Arity) + 1U;
+
+        if (child >= current_size)
+        {
+          break;
+        }
+
+        const size_type end  = ((current_size - child) > Arity) ? child + Arity : current_size;
+        size_type       best = child;
+
+        for (size_type other = child + 1U; other < end; ++other)
+        {
+          if (lower(best, other))
+          {
+            best = other;
+          }
+        }
+
+        if (!compare(value, *slot(heap[best])))
+        {
+          break;
+        }
+
+        place(index, heap[best]);
+        index = best;
+      }
+
+      place(index, handle);
+    }
+
+    //*************************************************************************
+    /// Copies the values into the same slots as the other queue's.
+    //*************************************************************************
+    void clone(const indexed_priority_queue& other)
+    {
+      for (size_type i = 0U; i < VMax_Size; ++i)
+      {
+        heap[i]     = other.heap[i];
+        position[i] = other.position[i];
+      }
+
+      for (size_type i = 0U; i < other.current_size; ++i)
+      {
+        ::new (slot(heap[i])) T(*other.slot(heap[i]));
+        ++current_size;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the values into the same slots as the other queue's.
+    //*************************************************************************
+    void move_from(indexed_priority_queue& other)
+    {
+      for (size_type i = 0U; i < VMax_Size; ++i)
+      {
+        heap[i]     = other.heap[i];
+        position[i] = other.position[i];
+      }
+
+      for (size_type i = 0U; i < other.current_size; ++i)
+      {
+        ::new (slot(heap[i])) T(etl::move(*other.slot(heap[i])));
+        ++current_size;
+      }
+
+      other.clear();
+    }
+#endif
+
+    etl::uninitialized_buffer_of<T, VMax_Size> buffer;       ///< The values, by handle.
+    handle_type                                heap[VMax_Size];     ///< The handles in heap order, then the free handles.
+    handle_type                                position[VMax_Size]; ///< The heap index of each handle, or No_Handle if free.
+    size_type                                  current_size;
+    TCompare                                   compare;
+  };
+
+  template <typename T, size_t VMax_Size, typename TCompare, size_t Arity>
+  ETL_CONSTANT typename indexed_priority_queue<T, VMax_Size, TCompare, Arity>::size_type indexed_priority_queue<T, VMax_Size, TCompare, Arity>::MAX_SIZE;
+
+  template <typename T, size_t VMax_Size, typename TCompare, size_t Arity>
+  ETL_CONSTANT typename indexed_priority_queue<T, VMax_Size, TCompare, Arity>::handle_type indexed_priority_queue<T, VMax_Size, TCompare, Arity>::No_Handle;
+}
+
+#endif
@@ -0,0 +1,468 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INPLACE_FUNCTION_INCLUDED
+#define ETL_INPLACE_FUNCTION_INCLUDED
+
+#include "platform.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "alignment.h"
+#include "largest.h"
+#include "nullptr.h"
+#include "optional.h"
+#include "file_error_numbers.h"
+#include "placement_new.h"
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for inplace_function exceptions.
+  //***************************************************************************
+  class inplace_function_exception : public exception
+  {
+  public:
+
+    inplace_function_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the inplace_function is uninitialised.
+  //***************************************************************************
+  class inplace_function_uninitialised : public inplace_function_exception
+  {
+  public:
+
+    inplace_function_uninitialised(string_type file_name_, numeric_type line_number_)
+      : inplace_function_exception(ETL_ERROR_TEXT("inplace_function:uninitialised", ETL_INPLACE_FUNCTION_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_inplace_function
+  {
+    //*************************************************************************
+    /// The operations to copy, move and destroy a stored callable.
+    //*************************************************************************
+    struct operations
+    {
+      void (*copy)(void* p_destination, const void* p_source);
+      void (*move)(void* p_destination, void* p_source);
+      void (*destroy)(void* p_callable);
+    };
+
+    //*************************************************************************
+    /// The functions for a callable type.
+    //*************************************************************************
+    template <typename TCallable, typename TReturn, typename... TParams>
+    struct callable_functions
+    {
+      static TReturn invoke(void* p_callable, TParams... args)
+      {
+        return (*static_cast<TCallable*>(p_callable))(etl::forward<TParams>(args)...);
+      }
+
+      static void copy(void* p_destination, const void* p_source)
+      {
+        ::new (p_destination) TCallable(*static_cast<const TCallable*>(p_source));
+      }
+
+      // Moves the callable and destroys the source.
+      static void move(void* p_destination, void* p_source)
+      {
+        TCallable* p_callable = static_cast<TCallable*>(p_source);
+
+        ::new (p_destination) TCallable(etl::move(*p_callable));
+        p_callable->~TCallable();
+      }
+
+      static void destroy(void* p_callable)
+      {
+        static_cast<TCallable*>(p_callable)->~TCallable();
+      }
+
+      static const operations table;
+    };
+
+    template <typename TCallable, typename TReturn, typename... TParams>
+    const operations callable_functions<TCallable, TReturn, TParams...>::table =
+    {
+      &callable_functions<TCallable, TReturn, TParams...>::copy,
+      &callable_functions<TCallable, TReturn, TParams...>::move,
+      &callable_functions<TCallable, TReturn, TParams...>::destroy
+    };
+  }
+
+  //*************************************************************************
+  /// Declaration.
+  //*************************************************************************
+  template <typename TSignature,
+            size_t Capacity  = 4U * sizeof(void*),
+            size_t Alignment = etl::largest_alignment<long long, double, void*>::value>
+  class inplace_function;
+
+  //*************************************************************************
+  /// A function wrapper that stores a copy of the callable, such as a
+  /// capturing lambda, in an internal buffer.
+  /// Unlike etl::delegate, the callable does not have to outlive it.
+  /// Calls are a single indirect call through a stored function pointer.
+  /// The callable must be copy constructible and fit in the buffer.
+  ///\tparam Capacity  The size of the buffer.
+  ///\tparam Alignment The alignment of the buffer.
+  //*************************************************************************
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  class inplace_function<TReturn(TParams...), Capacity, Alignment>
+  {
+  private:
+
+    template <typename TCallable>
+    using enable_if_callable_t = etl::enable_if_t<!etl::is_same<etl::decay_t<TCallable>, inplace_function>::value &&
+                                                  !etl::is_same<etl::decay_t<TCallable>, std::nullptr_t>::value, int>;
+
+  public:
+
+    static ETL_CONSTANT size_t Buffer_Capacity  = Capacity;
+    static ETL_CONSTANT size_t Buffer_Alignment = Alignment;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    inplace_function() ETL_NOEXCEPT
+      : p_invoke(ETL_NULLPTR)
+      , p_operations(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct empty from nullptr.
+    //*************************************************************************
+    inplace_function(std::nullptr_t) ETL_NOEXCEPT
+      : p_invoke(ETL_NULLPTR)
+      , p_operations(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a function pointer.
+    /// Empty if the pointer is null.
+    //*************************************************************************
+    inplace_function(TReturn (*p_function)(TParams...))
+      : p_invoke(ETL_NULLPTR)
+      , p_operations(ETL_NULLPTR)
+    {
+      if (p_function != ETL_NULLPTR)
+      {
+        construct(p_function);
+      }
+    }
+
+    //*************************************************************************
+    /// Construct from a callable, which is copied or moved into the buffer.
+    //*************************************************************************
+    template <typename TCallable, enable_if_callable_t<TCallable> = 0>
+    inplace_function(TCallable&& callable)
+      : p_invoke(ETL_NULLPTR)
+      , p_operations(ETL_NULLPTR)
+    {
+      construct(etl::forward<TCallable>(callable));
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    inplace_function(const inplace_function& other)
+      : p_invoke(other.p_invoke)
+      , p_operations(other.p_operations)
+    {
+      if (p_operations != ETL_NULLPTR)
+      {
+        p_operations->copy(&buffer, &other.buffer);
+      }
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    /// Leaves the other empty.
+    //*************************************************************************
+    inplace_function(inplace_function&& other)
+      : p_invoke(other.p_invoke)
+      , p_operations(other.p_operations)
+    {
+      if (p_operations != ETL_NULLPTR)
+      {
+        p_operations->move(&buffer, &other.buffer);
+        other.p_invoke     = ETL_NULLPTR;
+        other.p_operations = ETL_NULLPTR;
+      }
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~inplace_function()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Copy assignment.
+    //*************************************************************************
+    inplace_function& operator =(const inplace_function& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+
+        if (rhs.p_operations != ETL_NULLPTR)
+        {
+          rhs.p_operations->copy(&buffer, &rhs.buffer);
+          p_invoke     = rhs.p_invoke;
+          p_operations = rhs.p_operations;
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment.
+    /// Leaves the other empty.
+    //*************************************************************************
+    inplace_function& operator =(inplace_function&& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+
+        if (rhs.p_operations != ETL_NULLPTR)
+        {
+          rhs.p_operations->move(&buffer, &rhs.buffer);
+          p_invoke         = rhs.p_invoke;
+          p_operations     = rhs.p_operations;
+          rhs.p_invoke     = ETL_NULLPTR;
+          rhs.p_operations = ETL_NULLPTR;
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign a callable.
+    //*************************************************************************
+    template <typename TCallable, enable_if_callable_t<TCallable> = 0>
+    inplace_function& operator =(TCallable&& callable)
+    {
+      clear();
+      construct(etl::forward<TCallable>(callable));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign a function pointer.
+    /// Empty if the pointer is null.
+    //*************************************************************************
+    inplace_function& operator =(TReturn (*p_function)(TParams...))
+    {
+      clear();
+
+      if (p_function != ETL_NULLPTR)
+      {
+        construct(p_function);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign nullptr, making the function empty.
+    //*************************************************************************
+    inplace_function& operator =(std::nullptr_t) ETL_NOEXCEPT
+    {
+      clear();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destroys the stored callable.
+    //*************************************************************************
+    void clear() ETL_NOEXCEPT
+    {
+      if (p_operations != ETL_NULLPTR)
+      {
+        p_operations->destroy(&buffer);
+        p_invoke     = ETL_NULLPTR;
+        p_operations = ETL_NULLPTR;
+      }
+    }
+
+    //*************************************************************************
+    /// Swaps with another inplace_function.
+    //*************************************************************************
+    void swap(inplace_function& other)
+    {
+      inplace_function temp(etl::move(other));
+      other = etl::move(*this);
+      *this = etl::move(temp);
+    }
+
+    //*************************************************************************
+    /// Execute the function.
+    //*************************************************************************
+    TReturn operator()(TParams... args) const
+    {
+      ETL_ASSERT(is_valid(), ETL_ERROR(inplace_function_uninitialised));
+
+      return (*p_invoke)(&buffer, etl::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    /// Execute the function if valid.
+    /// 'void' return.
+    //*************************************************************************
+    template <typename TRet = TReturn>
+    typename etl::enable_if_t<etl::is_same<TRet, void>::value, bool>
+      call_if(TParams... args) const
+    {
+      if (is_valid())
+      {
+        (*p_invoke)(&buffer, etl::forward<TParams>(args)...);
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Execute the function if valid.
+    /// Non 'void' return.
+    //*************************************************************************
+    template <typename TRet = TReturn>
+    typename etl::enable_if_t<!etl::is_same<TRet, void>::value, etl::optional<TReturn>>
+      call_if(TParams... args) const
+    {
+      etl::optional<TReturn> result;
+
+      if (is_valid())
+      {
+        result = (*p_invoke)(&buffer, etl::forward<TParams>(args)...);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Checks if the function holds a callable.
+    //*************************************************************************
+    bool is_valid() const ETL_NOEXCEPT
+    {
+      return p_invoke != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks if the function holds a callable.
+    //*************************************************************************
+    explicit operator bool() const ETL_NOEXCEPT
+    {
+      return is_valid();
+    }
+
+  private:
+
+    typedef TReturn (*invoke_type)(void*, TParams...);
+
+    //*************************************************************************
+    /// Constructs the callable in the buffer.
+    //*************************************************************************
+    template <typename TCallable>
+    void construct(TCallable&& callable)
+    {
+      typedef etl::decay_t<TCallable> callable_type;
+      typedef private_inplace_function::callable_functions<callable_type, TReturn, TParams...> functions;
+
+      ETL_STATIC_ASSERT(sizeof(callable_type) <= Capacity, "Callable is too large for the inplace_function");
+      ETL_STATIC_ASSERT((Alignment % etl::alignment_of<callable_type>::value) == 0U, "Callable alignment is incompatible with the inplace_function");
+
+      ::new (static_cast<void*>(&buffer)) callable_type(etl::forward<TCallable>(callable));
+
+      p_invoke     = &functions::invoke;
+      p_operations = &functions::table;
+    }
+
+    invoke_type                                   p_invoke;     ///< Calls the stored callable.
+    const private_inplace_function::operations*   p_operations; ///< Copies, moves and destroys the stored callable.
+    mutable typename etl::aligned_storage<Capacity, Alignment>::type buffer; ///< Storage for the callable.
+  };
+
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  ETL_CONSTANT size_t inplace_function<TReturn(TParams...), Capacity, Alignment>::Buffer_Capacity;
+
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  ETL_CONSTANT size_t inplace_function<TReturn(TParams...), Capacity, Alignment>::Buffer_Alignment;
+
+  //*************************************************************************
+  /// Swaps two inplace_functions.
+  //*************************************************************************
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  void swap(etl::inplace_function<TReturn(TParams...), Capacity, Alignment>& lhs,
+            etl::inplace_function<TReturn(TParams...), Capacity, Alignment>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+
+  //*************************************************************************
+  /// Compares with nullptr.
+  //*************************************************************************
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  bool operator ==(const etl::inplace_function<TReturn(TParams...), Capacity, Alignment>& lhs, std::nullptr_t)
+  {
+    return !lhs.is_valid();
+  }
+
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  bool operator !=(const etl::inplace_function<TReturn(TParams...), Capacity, Alignment>& lhs, std::nullptr_t)
+  {
+    return lhs.is_valid();
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,449 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_INTERVAL_MAP_INCLUDED
+#define ETL_INTERVAL_MAP_INCLUDED
+
+#include "platform.h"
+#include "map.h"
+#include "functional.h"
+#include "utility.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+
+///\defgroup interval_map interval_map
+/// Maps half open ranges of keys, [first, last), to values.
+/// The ranges never overlap. Assigning a range overwrites whatever it covers,
+/// splitting the ranges at its ends, and joins neighbouring ranges that
+/// have equal values.
+/// The ranges are held in an etl::map, keyed on the start of the range, so
+/// lookups are O(log n) and each range takes one pooled node.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the interval_map.
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_exception : public exception
+  {
+  public:
+
+    interval_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// There are not enough free nodes for the change.
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_full : public interval_map_exception
+  {
+  public:
+
+    interval_map_full(string_type file_name_, numeric_type line_number_)
+      : interval_map_exception(ETL_ERROR_TEXT("interval_map:full", ETL_INTERVAL_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The interface of an interval_map.
+  ///\ingroup interval_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TKeyCompare = etl::less<TKey> >
+  class iinterval_map
+  {
+  public:
+
+    typedef TKey          key_type;
+    typedef TValue        mapped_type;
+    typedef TValue*       pointer;
+    typedef const TValue* const_pointer;
+    typedef TKeyCompare   key_compare;
+    typedef size_t        size_type;
+
+    //*************************************************************************
+    /// The end and value of a range. The start is the key in the map.
+    //*************************************************************************
+    struct segment
+    {
+      segment(const TKey& end_, const TValue& value_)
+        : end(end_)
+        , value(value_)
+      {
+      }
+
+      TKey   end;
+      TValue value;
+    };
+
+    typedef etl::imap<TKey, segment, TKeyCompare> segment_map;
+
+    //*************************************************************************
+    /// Maps [first, last) to the value.
+    /// Returns false, having changed nothing, if there are not enough nodes.
+    /// An empty range changes nothing.
+    //*************************************************************************
+    bool assign(const TKey& first, const TKey& last, const TValue& value)
+    {
+      if (!compare(first, last))
+      {
+        return true;
+      }
+
+      if (!cut(first, last, 1U))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(interval_map_full));
+        return false;
+      }
+
+      iterator itr = segments.insert(map_value_type(first, segment(last, value))).first;
+
+      // Join the following range. Its start cannot be before last.
+      iterator next = itr;
+      ++next;
+
+      if ((next != segments.end()) && !compare(last, next->first) && (next->second.value == value))
+      {
+        itr->second.end = next->second.end;
+        segments.erase(next);
+      }
+
+      // Join the preceding range. Its end cannot be after first.
+      if (itr != segments.begin())
+      {
+        iterator previous = itr;
+        --previous;
+
+        if (!compare(previous->second.end, first) && (previous->second.value == value))
+        {
+          previous->second.end = itr->second.end;
+          segments.erase(itr);
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Unmaps [first, last).
+    /// Returns false, having changed nothing, if a range must be split and
+    /// there are no free nodes.
+    //*************************************************************************
+    bool erase(const TKey& first, const TKey& last)
+    {
+      if (!compare(first, last))
+      {
+        return true;
+      }
+
+      if (!cut(first, last, 0U))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(interval_map_full));
+        return false;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The value mapped to the key, or null if there is none.
+    //*************************************************************************
+    pointer find(const TKey& key)
+    {
+      iterator itr = segments.upper_bound(key);
+
+      if (itr == segments.begin())
+      {
+        return ETL_NULLPTR;
+      }
+
+      --itr;
+
+      return compare(key, itr->second.end) ? &itr->second.value : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    const_pointer find(const TKey& key) const
+    {
+      const_iterator itr = segments.upper_bound(key);
+
+      if (itr == segments.begin())
+      {
+        return ETL_NULLPTR;
+      }
+
+      --itr;
+
+      return compare(key, itr->second.end) ? &itr->second.value : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Is the key mapped?
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return find(key) != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Calls f(first, last, value) for each range that overlaps [first, last),
+    /// in order. The ranges are passed as stored, not clipped.
+    /// Returns the number of calls.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_overlapping(const TKey& first, const TKey& last, TFunction f) const
+    {
+      if (!compare(first, last))
+      {
+        return 0U;
+      }
+
+      const_iterator itr = segments.upper_bound(first);
+
+      if (itr != segments.begin())
+      {
+        const_iterator previous = itr;
+        --previous;
+
+        if (compare(first, previous->second.end))
+        {
+          itr = previous;
+        }
+      }
+
+      size_t count = 0U;
+
+      while ((itr != segments.end()) && compare(itr->first, last))
+      {
+        f(itr->first, itr->second.end, itr->second.value);
+        ++count;
+        ++itr;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Calls f(first, last, value) for each range, in order.
+    //*************************************************************************
+    template <typename TFunction>
+    void for_each(TFunction f) const
+    {
+      for (const_iterator itr = segments.begin(); itr != segments.end(); ++itr)
+      {
+        f(itr->first, itr->second.end, itr->second.value);
+      }
+    }
+
+    //*************************************************************************
+    /// Unmaps everything.
+    //*************************************************************************
+    void clear()
+    {
+      segments.clear();
+    }
+
+    //*************************************************************************
+    /// The number of ranges.
+    //*************************************************************************
+    size_t size() const
+    {
+      return segments.size();
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return segments.empty();
+    }
+
+    //*************************************************************************
+    bool full() const
+    {
+      return segments.full();
+    }
+
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return segments.max_size();
+    }
+
+    //*************************************************************************
+    size_t available() const
+    {
+      return segments.available();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iinterval_map(segment_map& segments_)
+      : segments(segments_)
+      , compare()
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~iinterval_map()
+    {
+    }
+
+  private:
+
+    typedef typename segment_map::iterator       iterator;
+    typedef typename segment_map::const_iterator const_iterator;
+    typedef typename segment_map::value_type     map_value_type;
+
+    //*************************************************************************
+    /// Removes [first, last) from the ranges, trimming and splitting them.
+    /// Checks first that there will be room for the new nodes, plus extra.
+    //*************************************************************************
+    bool cut(const TKey& first, const TKey& last, size_t extra)
+    {
+      iterator itr = segments.lower_bound(first);
+
+      // Count the nodes that will be added and removed.
+      size_t added   = extra;
+      size_t removed = 0U;
+
+      bool trim_left = false;
+
+      iterator previous = itr;
+
+      if (itr != segments.begin())
+      {
+        --previous;
+
+        if (compare(first, previous->second.end))
+        {
+          trim_left = true;
+
+          if (compare(last, previous->second.end))
+          {
+            ++added;
+          }
+        }
+      }
+
+      for (iterator scan = itr; (scan != segments.end()) && compare(scan->first, last); ++scan)
+      {
+        ++removed;
+
+        if (compare(last, scan->second.end))
+        {
+          ++added;
+        }
+      }
+
+      if ((added > removed) && ((added - removed) > segments.available()))
+      {
+        return false;
+      }
+
+      // Trim the range that starts before first.
+      if (trim_left)
+      {
+        if (compare(last, previous->second.end))
+        {
+          segments.insert(map_value_type(last, segment(previous->second.end, previous->second.value)));
+        }
+
+        previous->second.end = first;
+      }
+
+      // Remove the ranges that start in [first, last), keeping any tail.
+      while ((itr != segments.end()) && compare(itr->first, last))
+      {
+        if (compare(last, itr->second.end))
+        {
+          const segment tail(itr->second);
+
+          segments.erase(itr);
+          segments.insert(map_value_type(last, tail));
+          break;
+        }
+
+        itr = segments.erase(itr);
+      }
+
+      return true;
+    }
+
+    // Disable copy construction and assignment.
+    iinterval_map(const iinterval_map&) ETL_DELETE;
+    iinterval_map& operator =(const iinterval_map&) ETL_DELETE;
+
+    segment_map& segments;
+    TKeyCompare  compare;
+  };
+
+  //***************************************************************************
+  /// An interval_map with storage for Max_Ranges ranges.
+  ///\ingroup interval_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, size_t Max_Ranges, typename TKeyCompare = etl::less<TKey> >
+  class interval_map : public etl::iinterval_map<TKey, TValue, TKeyCompare>
+  {
+  public:
+
+    static ETL_CONSTANT size_t MAX_RANGES = Max_Ranges;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    interval_map()
+      : etl::iinterval_map<TKey, TValue, TKeyCompare>(storage)
+    {
+    }
+
+  private:
+
+    etl::map<TKey, typename etl::iinterval_map<TKey, TValue, TKeyCompare>::segment, Max_Ranges, TKeyCompare> storage;
+  };
+
+  template <typename TKey, typename TValue, size_t Max_Ranges, typename TKeyCompare>
+  ETL_CONSTANT size_t interval_map<TKey, TValue, Max_Ranges, TKeyCompare>::MAX_RANGES;
+}
+
+#endif
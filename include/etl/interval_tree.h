@@ -0,0 +1,518 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_INTERVAL_TREE_INCLUDED
+#define ETL_INTERVAL_TREE_INCLUDED
+
+#include "platform.h"
+#include "vector.h"
+#include "functional.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+
+///\defgroup interval_tree interval_tree
+/// A collection of half open ranges of keys, [first, last), each with a
+/// value, which may overlap.
+/// The ranges are held sorted by start, and read as an implicit balanced
+/// tree, in which each node records the greatest end in its subtree.
+/// Finding the ranges that contain a key, or overlap a range, is
+/// O(log n + k) for k results. Inserts and erases are O(n), as for
+/// etl::flat_map.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the interval_tree.
+  ///\ingroup interval_tree
+  //***************************************************************************
+  class interval_tree_exception : public exception
+  {
+  public:
+
+    interval_tree_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The interval_tree is full.
+  ///\ingroup interval_tree
+  //***************************************************************************
+  class interval_tree_full : public interval_tree_exception
+  {
+  public:
+
+    interval_tree_full(string_type file_name_, numeric_type line_number_)
+      : interval_tree_exception(ETL_ERROR_TEXT("interval_tree:full", ETL_INTERVAL_TREE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The interface of an interval_tree.
+  ///\ingroup interval_tree
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TKeyCompare = etl::less<TKey> >
+  class iinterval_tree
+  {
+  public:
+
+    typedef TKey        key_type;
+    typedef TValue      mapped_type;
+    typedef TKeyCompare key_compare;
+    typedef size_t      size_type;
+
+    //*************************************************************************
+    /// A range and its value.
+    //*************************************************************************
+    struct interval
+    {
+      interval(const TKey& first_, const TKey& last_, const TValue& value_)
+        : first(first_)
+        , last(last_)
+        , value(value_)
+      {
+      }
+
+      TKey   first;
+      TKey   last;
+      TValue value;
+    };
+
+    typedef interval        value_type;
+    typedef const interval* const_iterator;
+
+    //*************************************************************************
+    /// Adds the value for [first, last).
+    /// Returns false if the range is empty or the tree is full.
+    //*************************************************************************
+    bool insert(const TKey& first, const TKey& last, const TValue& value)
+    {
+      if (!compare(first, last))
+      {
+        return false;
+      }
+
+      if (intervals.full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(interval_tree_full));
+        return false;
+      }
+
+      // After any ranges with the same start.
+      size_t low  = 0U;
+      size_t high = intervals.size();
+
+      while (low < high)
+      {
+        const size_t middle = low + ((high - low) / 2U);
+
+        if (compare(first, intervals[middle].first))
+        {
+          high = middle;
+        }
+        else
+        {
+          low = middle + 1U;
+        }
+      }
+
+      intervals.insert(intervals.begin() + low, interval(first, last, value));
+      max_lasts.push_back(last);
+
+      rebuild(0U, intervals.size());
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases every range that is exactly [first, last).
+    /// Returns the number erased.
+    //*************************************************************************
+    size_t erase(const TKey& first, const TKey& last)
+    {
+      size_t count = 0U;
+
+      for (size_t i = lower_bound(first); (i < intervals.size()) && !compare(first, intervals[i].first);)
+      {
+        if (same_key(intervals[i].last, last))
+        {
+          erase_at(i);
+          ++count;
+        }
+        else
+        {
+          ++i;
+        }
+      }
+
+      if (count != 0U)
+      {
+        rebuild(0U, intervals.size());
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Erases the first range that is exactly [first, last) with the value.
+    /// Returns false if there is none.
+    //*************************************************************************
+    bool erase(const TKey& first, const TKey& last, const TValue& value)
+    {
+      for (size_t i = lower_bound(first); (i < intervals.size()) && !compare(first, intervals[i].first); ++i)
+      {
+        if (same_key(intervals[i].last, last) && (intervals[i].value == value))
+        {
+          erase_at(i);
+          rebuild(0U, intervals.size());
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Calls f(interval) for each range that contains the key, in order of
+    /// start. Returns the number of calls.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_containing(const TKey& key, TFunction f) const
+    {
+      return visit_containing(0U, intervals.size(), key, f);
+    }
+
+    //*************************************************************************
+    /// Calls f(interval) for each range that overlaps [first, last), in
+    /// order of start. Returns the number of calls.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_overlapping(const TKey& first, const TKey& last, TFunction f) const
+    {
+      if (!compare(first, last))
+      {
+        return 0U;
+      }
+
+      return visit_overlapping(0U, intervals.size(), first, last, f);
+    }
+
+    //*************************************************************************
+    /// Does any range contain the key?
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return for_each_containing(key, first_only()) != 0U;
+    }
+
+    //*************************************************************************
+    /// Does any range overlap [first, last)?
+    //*************************************************************************
+    bool overlaps(const TKey& first, const TKey& last) const
+    {
+      return for_each_overlapping(first, last, first_only()) != 0U;
+    }
+
+    //*************************************************************************
+    /// The ranges, in order of start.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return intervals.data();
+    }
+
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return intervals.data() + intervals.size();
+    }
+
+    //*************************************************************************
+    void clear()
+    {
+      intervals.clear();
+      max_lasts.clear();
+    }
+
+    //*************************************************************************
+    size_t size() const
+    {
+      return intervals.size();
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return intervals.empty();
+    }
+
+    //*************************************************************************
+    bool full() const
+    {
+      return intervals.full();
+    }
+
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return intervals.max_size();
+    }
+
+    //*************************************************************************
+    size_t available() const
+    {
+      return intervals.available();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iinterval_tree(etl::ivector<interval>& intervals_, etl::ivector<TKey>& max_lasts_)
+      : intervals(intervals_)
+      , max_lasts(max_lasts_)
+      , compare()
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~iinterval_tree()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Ignores the ranges, for queries that only count them.
+    //*************************************************************************
+    struct first_only
+    {
+      void operator()(const interval&) const
+      {
+      }
+    };
+
+    //*************************************************************************
+    bool same_key(const TKey& a, const TKey& b) const
+    {
+      return !compare(a, b) && !compare(b, a);
+    }
+
+    //*************************************************************************
+    /// The index of the first range whose start is not before the key.
+    //*************************************************************************
+    size_t lower_bound(const TKey& key) const
+    {
+      size_t low  = 0U;
+      size_t high = intervals.size();
+
+      while (low < high)
+      {
+        const size_t middle = low + ((high - low) / 2U);
+
+        if (compare(intervals[middle].first, key))
+        {
+          low = middle + 1U;
+        }
+        else
+        {
+          high = middle;
+        }
+      }
+
+      return low;
+    }
+
+    //*************************************************************************
+    void erase_at(size_t index)
+    {
+      intervals.erase(intervals.begin() + index);
+      max_lasts.pop_back();
+    }
+
+    //*************************************************************************
+    /// Sets the greatest end of each subtree of [low, high), whose root is the
+    /// middle element. Returns the greatest end, or null if the range is empty.
+    //*************************************************************************
+    const TKey* rebuild(size_t low, size_t high)
+    {
+      if (low >= high)
+      {
+        return ETL_NULLPTR;
+      }
+
+      const size_t middle = low + ((high - low) / 2U);
+
+      TKey& max_last = max_lasts[middle];
+      max_last = intervals[middle].last;
+
+      const TKey* p_left  = rebuild(low, middle);
+      const TKey* p_right = rebuild(middle + 1U, high);
+
+      if ((p_left != ETL_NULLPTR) && compare(max_last, *p_left))
+      {
+        max_last = *p_left;
+      }
+
+      if ((p_right != ETL_NULLPTR) && compare(max_last, *p_right))
+      {
+        max_last = *p_right;
+      }
+
+      return &max_last;
+    }
+
+    //*************************************************************************
+    /// Visits the ranges in the subtree [low, high) that contain the key.
+    /// Subtrees whose ends are all at or before the key are skipped, as are
+    /// right subtrees whose root starts after the key.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t visit_containing(size_t low, size_t high, const TKey& key, TFunction& f) const
+    {
+      size_t count = 0U;
+
+      while (low < high)
+      {
+        const size_t middle = low + ((high - low) / 2U);
+
+        if (!compare(key, max_lasts[middle]))
+        {
+          break;
+        }
+
+        count += visit_containing(low, middle, key, f);
+
+        const interval& item = intervals[middle];
+
+        if (compare(key, item.first))
+        {
+          break;
+        }
+
+        if (compare(key, item.last))
+        {
+          f(item);
+          ++count;
+        }
+
+        low = middle + 1U;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Visits the ranges in the subtree [low, high) that overlap [first, last).
+    //*************************************************************************
+    template <typename TFunction>
+    size_t visit_overlapping(size_t low, size_t high, const TKey& first, const TKey& last, TFunction& f) const
+    {
+      size_t count = 0U;
+
+      while (low < high)
+      {
+        const size_t middle = low + ((high - low) / 2U);
+
+        if (!compare(first, max_lasts[middle]))
+        {
+          break;
+        }
+
+        count += visit_overlapping(low, middle, first, last, f);
+
+        const interval& item = intervals[middle];
+
+        if (!compare(item.first, last))
+        {
+          break;
+        }
+
+        if (compare(first, item.last))
+        {
+          f(item);
+          ++count;
+        }
+
+        low = middle + 1U;
+      }
+
+      return count;
+    }
+
+    // Disable copy construction and assignment.
+    iinterval_tree(const iinterval_tree&) ETL_DELETE;
+    iinterval_tree& operator =(const iinterval_tree&) ETL_DELETE;
+
+    etl::ivector<interval>& intervals;
+    etl::ivector<TKey>&     max_lasts;
+    TKeyCompare             compare;
+  };
+
+  //***************************************************************************
+  /// An interval_tree with storage for Max_Intervals ranges.
+  ///\ingroup interval_tree
+  //***************************************************************************
+  template <typename TKey, typename TValue, size_t Max_Intervals, typename TKeyCompare = etl::less<TKey> >
+  class interval_tree : public etl::iinterval_tree<TKey, TValue, TKeyCompare>
+  {
+  public:
+
+    static ETL_CONSTANT size_t MAX_INTERVALS = Max_Intervals;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    interval_tree()
+      : etl::iinterval_tree<TKey, TValue, TKeyCompare>(interval_storage, max_last_storage)
+    {
+    }
+
+  private:
+
+    etl::vector<typename etl::iinterval_tree<TKey, TValue, TKeyCompare>::interval, Max_Intervals> interval_storage;
+    etl::vector<TKey, Max_Intervals> max_last_storage;
+  };
+
+  template <typename TKey, typename TValue, size_t Max_Intervals, typename TKeyCompare>
+  ETL_CONSTANT size_t interval_tree<TKey, TValue, Max_Intervals, TKeyCompare>::MAX_INTERVALS;
+}
+
+#endif
@@ -1320,6 +1320,141 @@ namespace etl
   {
     return node->is_linked();
   }
+
+  //***************************************************************************
+  /// A red-black tree link.
+  /// A binary tree link with a colour, as used by the intrusive associative containers.
+  //***************************************************************************
+  template <size_t ID_>
+  struct rb_tree_link
+  {
+      enum
+      {
+        ID = ID_,
+      };
+
+      //***********************************
+      rb_tree_link()
+        : etl_parent(ETL_NULLPTR)
+        , etl_left(ETL_NULLPTR)
+        , etl_right(ETL_NULLPTR)
+        , etl_red(false)
+      {
+      }
+
+      //***********************************
+      rb_tree_link(const rb_tree_link& other)
+        : etl_parent(other.etl_parent)
+        , etl_left(other.etl_left)
+        , etl_right(other.etl_right)
+        , etl_red(other.etl_red)
+      {
+      }
+
+      //***********************************
+      rb_tree_link& operator =(const rb_tree_link& other)
+      {
+        etl_parent = other.etl_parent;
+        etl_left   = other.etl_left;
+        etl_right  = other.etl_right;
+        etl_red    = other.etl_red;
+
+        return *this;
+      }
+
+      //***********************************
+      void clear()
+      {
+        etl_parent = ETL_NULLPTR;
+        etl_left   = ETL_NULLPTR;
+        etl_right  = ETL_NULLPTR;
+        etl_red    = false;
+      }
+
+      //***********************************
+      bool is_linked() const
+      {
+        return (etl_parent != ETL_NULLPTR) || (etl_left != ETL_NULLPTR) || (etl_right != ETL_NULLPTR);
+      }
+
+      //***********************************
+      ETL_NODISCARD
+      rb_tree_link* get_parent() const
+      {
+        return etl_parent;
+      }
+
+      //***********************************
+      ETL_NODISCARD
+      rb_tree_link* get_left() const
+      {
+        return etl_left;
+      }
+
+      //***********************************
+      ETL_NODISCARD
+      rb_tree_link* get_right() const
+      {
+        return etl_right;
+      }
+
+      //***********************************
+      ETL_NODISCARD
+      bool is_red() const
+      {
+        return etl_red;
+      }
+
+      rb_tree_link* etl_parent;
+      rb_tree_link* etl_left;
+      rb_tree_link* etl_right;
+      bool          etl_red;
+  };
+
+  //***********************************
+  template <typename TLink>
+  struct is_rb_tree_link
+  {
+    static ETL_CONSTANT bool value = etl::is_same<TLink, etl::rb_tree_link<TLink::ID> >::value;
+  };
+
+  //***********************************
+#if ETL_USING_CPP17
+  template <typename TLink>
+  inline constexpr bool is_rb_tree_link_v = etl::is_rb_tree_link<TLink>::value;
+#endif
+
+  // Reference
+  template <typename TLink>
+  typename etl::enable_if<etl::is_same<TLink, etl::rb_tree_link<TLink::ID> >::value, void>::type
+    link_clear(TLink& node)
+  {
+    node.clear();
+  }
+
+  // Pointer
+  template <typename TLink>
+  typename etl::enable_if<etl::is_same<TLink, etl::rb_tree_link<TLink::ID> >::value, void>::type
+    link_clear(TLink* node)
+  {
+    node->clear();
+  }
+
+  // Reference
+  template <typename TLink>
+  typename etl::enable_if<etl::is_same<TLink, etl::rb_tree_link<TLink::ID> >::value, bool>::type
+    is_linked(TLink& node)
+  {
+    return node.is_linked();
+  }
+
+  // Pointer
+  template <typename TLink>
+  typename etl::enable_if<etl::is_same<TLink, etl::rb_tree_link<TLink::ID> >::value, bool>::type
+    is_linked(TLink* node)
+  {
+    return node->is_linked();
+  }
 }
 
 #endif
@@ -0,0 +1,234 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_MPSC_QUEUE_INCLUDED
+#define ETL_INTRUSIVE_MPSC_QUEUE_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A forward link with an atomic 'etl_next', for lock free intrusive containers.
+  ///\ingroup intrusive_mpsc_queue
+  //***************************************************************************
+  template <size_t ID_>
+  struct atomic_forward_link
+  {
+    enum
+    {
+      ID = ID_,
+    };
+
+    //***********************************
+    atomic_forward_link()
+      : etl_next(ETL_NULLPTR)
+    {
+    }
+
+    etl::atomic<atomic_forward_link*> etl_next;
+
+  private:
+
+    // Links are not copyable.
+    atomic_forward_link(const atomic_forward_link&) ETL_DELETE;
+    atomic_forward_link& operator =(const atomic_forward_link&) ETL_DELETE;
+  };
+
+  //***************************************************************************
+  ///\ingroup queue
+  /// A lock free, intrusive, multiple producer, single consumer queue.
+  /// Dmitry Vyukov's non-blocking MPSC algorithm.
+  /// Any number of threads or interrupts may push, each with one atomic exchange
+  /// and no loops, so push never waits. Only one thread may pop.
+  /// Values are linked, not copied, and must not be destroyed or pushed again
+  /// until they have been popped.
+  /// A pop may return null while a push is part complete, even though the
+  /// queue is not empty. The value is returned by a later pop.
+  ///\tparam TValue The type of value that the queue holds.
+  ///\tparam TLink  The atomic_forward_link type that the value is derived from.
+  //***************************************************************************
+  template <typename TValue, typename TLink>
+  class intrusive_mpsc_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT((etl::is_base_of<TLink, TValue>::value), "TValue must be derived from TLink");
+
+    // Node typedef.
+    typedef TLink link_type;
+
+    // STL style typedefs.
+    typedef TValue            value_type;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    intrusive_mpsc_queue()
+      : head(&stub)
+      , tail(&stub)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a value to the back of the queue.
+    /// May be called by any number of producers at once.
+    //*************************************************************************
+    void push(reference value)
+    {
+      push_link(static_cast<link_type*>(&value));
+    }
+
+    //*************************************************************************
+    /// Removes the value at the front of the queue.
+    /// Returns null if the queue is empty, or the front value is still being pushed.
+    /// Only to be called by the consumer.
+    //*************************************************************************
+    pointer pop()
+    {
+      link_type* p_tail = tail;
+      link_type* p_next = next_of(p_tail);
+
+      // Step over the stub.
+      if (p_tail == &stub)
+      {
+        if (p_next == ETL_NULLPTR)
+        {
+          return ETL_NULLPTR;
+        }
+
+        tail   = p_next;
+        p_tail = p_next;
+        p_next = next_of(p_next);
+      }
+
+      if (p_next != ETL_NULLPTR)
+      {
+        tail = p_next;
+        return as_value(p_tail);
+      }
+
+      // p_tail is the last value, unless a push is part complete.
+      if (p_tail != head.load(etl::memory_order_acquire))
+      {
+        return ETL_NULLPTR;
+      }
+
+      // Push the stub behind the last value, so that it can be unlinked.
+      push_link(&stub);
+
+      p_next = next_of(p_tail);
+
+      if (p_next != ETL_NULLPTR)
+      {
+        tail = p_next;
+        return as_value(p_tail);
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Removes and passes each value to a function, until pop returns null.
+    /// Returns the number of values removed.
+    /// Only to be called by the consumer.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t drain(TFunction function)
+    {
+      size_t count = 0U;
+
+      pointer p_value;
+
+      while ((p_value = pop()) != ETL_NULLPTR)
+      {
+        function(*p_value);
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if nothing has been pushed that has not been popped.
+    /// Only to be called by the consumer.
+    //*************************************************************************
+    bool empty() const
+    {
+      return (tail == &stub) && (next_of(&stub) == ETL_NULLPTR);
+    }
+
+  private:
+
+    //*************************************************************************
+    void push_link(link_type* p_link)
+    {
+      p_link->etl_next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+
+      // Claim the back of the queue, then link the previous back to it.
+      link_type* p_previous = static_cast<link_type*>(head.exchange(p_link, etl::memory_order_acq_rel));
+      p_previous->etl_next.store(p_link, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    static link_type* next_of(const link_type* p_link)
+    {
+      return static_cast<link_type*>(const_cast<link_type*>(p_link)->etl_next.load(etl::memory_order_acquire));
+    }
+
+    //*************************************************************************
+    static pointer as_value(link_type* p_link)
+    {
+      return static_cast<pointer>(p_link);
+    }
+
+    // Disable copy construction and assignment.
+    intrusive_mpsc_queue(const intrusive_mpsc_queue&) ETL_DELETE;
+    intrusive_mpsc_queue& operator =(const intrusive_mpsc_queue&) ETL_DELETE;
+
+    link_type               stub; ///< Stands in for a value when the queue is empty.
+    etl::atomic<link_type*> head; ///< The most recently pushed. Shared by the producers.
+    link_type*              tail; ///< The next to pop. Only used by the consumer.
+  };
+}
+
+#endif
+#endif
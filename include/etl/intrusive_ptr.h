@@ -0,0 +1,341 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_PTR_INCLUDED
+#define ETL_INTRUSIVE_PTR_INCLUDED
+
+#include "platform.h"
+#include "reference_counted_object.h"
+#include "ipool.h"
+#include "utility.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// A smart pointer to an object that holds its own reference count.
+  /// T must be derived from etl::ireference_counted_object, such as
+  /// etl::reference_counted_object or etl::atomic_counted_object.
+  /// If the pointer was given the pool that the object was created in, the
+  /// object is destroyed and returned to the pool on the last release,
+  /// otherwise it is left for its owner.
+  /// A pooled object must be pointed to by its complete type, or by a base at
+  /// the same address, as the pool releases the address that it is given.
+  ///\tparam T The pointed to type.
+  ///\ingroup reference_counting
+  //***************************************************************************
+  template <typename T>
+  class intrusive_ptr
+  {
+  public:
+
+    template <typename U>
+    friend class intrusive_ptr;
+
+    typedef T  element_type;
+    typedef T* pointer;
+    typedef T& reference;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    ETL_CONSTEXPR intrusive_ptr() ETL_NOEXCEPT
+      : p_object(ETL_NULLPTR)
+      , p_pool(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from an object that is not owned by a pool.
+    /// \param add_reference If <b>false</b> the pointer adopts a reference already counted.
+    //*************************************************************************
+    explicit intrusive_ptr(pointer p_object_, bool add_reference = true)
+      : p_object(p_object_)
+      , p_pool(ETL_NULLPTR)
+    {
+      if (add_reference)
+      {
+        add_ref();
+      }
+    }
+
+    //*************************************************************************
+    /// Construct from an object that was created in the pool.
+    /// \param add_reference If <b>false</b> the pointer adopts a reference already counted.
+    //*************************************************************************
+    intrusive_ptr(pointer p_object_, etl::ipool& pool, bool add_reference = true)
+      : p_object(p_object_)
+      , p_pool(&pool)
+    {
+      if (add_reference)
+      {
+        add_ref();
+      }
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    intrusive_ptr(const intrusive_ptr& other)
+      : p_object(other.p_object)
+      , p_pool(other.p_pool)
+    {
+      add_ref();
+    }
+
+    //*************************************************************************
+    /// Converting copy constructor.
+    //*************************************************************************
+    template <typename U>
+    intrusive_ptr(const intrusive_ptr<U>& other)
+      : p_object(other.p_object)
+      , p_pool(other.p_pool)
+    {
+      add_ref();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    intrusive_ptr(intrusive_ptr&& other) ETL_NOEXCEPT
+      : p_object(other.p_object)
+      , p_pool(other.p_pool)
+    {
+      other.p_object = ETL_NULLPTR;
+      other.p_pool   = ETL_NULLPTR;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~intrusive_ptr()
+    {
+      release_ref();
+    }
+
+    //*************************************************************************
+    /// Copy assignment.
+    //*************************************************************************
+    intrusive_ptr& operator =(const intrusive_ptr& other)
+    {
+      intrusive_ptr(other).swap(*this);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment.
+    //*************************************************************************
+    intrusive_ptr& operator =(intrusive_ptr&& other) ETL_NOEXCEPT
+    {
+      intrusive_ptr(etl::move(other)).swap(*this);
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Releases the object and becomes null.
+    //*************************************************************************
+    void reset()
+    {
+      intrusive_ptr().swap(*this);
+    }
+
+    //*************************************************************************
+    /// Releases the object and points to another that is not owned by a pool.
+    //*************************************************************************
+    void reset(pointer p_object_, bool add_reference = true)
+    {
+      intrusive_ptr(p_object_, add_reference).swap(*this);
+    }
+
+    //*************************************************************************
+    /// Releases the object and points to another that was created in the pool.
+    //*************************************************************************
+    void reset(pointer p_object_, etl::ipool& pool, bool add_reference = true)
+    {
+      intrusive_ptr(p_object_, pool, add_reference).swap(*this);
+    }
+
+    //*************************************************************************
+    /// Becomes null without releasing the reference.
+    /// Returns the pointer to the object.
+    //*************************************************************************
+    pointer detach() ETL_NOEXCEPT
+    {
+      pointer p = p_object;
+
+      p_object = ETL_NULLPTR;
+      p_pool   = ETL_NULLPTR;
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Swaps with another intrusive_ptr.
+    //*************************************************************************
+    void swap(intrusive_ptr& other) ETL_NOEXCEPT
+    {
+      using ETL_OR_STD::swap;
+
+      swap(p_object, other.p_object);
+      swap(p_pool,   other.p_pool);
+    }
+
+    //*************************************************************************
+    /// Gets the pointer to the object.
+    //*************************************************************************
+    ETL_NODISCARD pointer get() const ETL_NOEXCEPT
+    {
+      return p_object;
+    }
+
+    //*************************************************************************
+    /// Gets the pool that the object will be returned to, or null.
+    //*************************************************************************
+    ETL_NODISCARD etl::ipool* get_pool() const ETL_NOEXCEPT
+    {
+      return p_pool;
+    }
+
+    //*************************************************************************
+    /// Gets the current reference count, or zero if null.
+    //*************************************************************************
+    ETL_NODISCARD int32_t use_count() const
+    {
+      return (p_object != ETL_NULLPTR) ? p_object->get_reference_counter().get_reference_count() : 0;
+    }
+
+    //*************************************************************************
+    /// Dereference.
+    //*************************************************************************
+    reference operator *() const
+    {
+      return *p_object;
+    }
+
+    //*************************************************************************
+    /// Member access.
+    //*************************************************************************
+    pointer operator ->() const ETL_NOEXCEPT
+    {
+      return p_object;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if not null.
+    //*************************************************************************
+    operator bool() const ETL_NOEXCEPT
+    {
+      return p_object != ETL_NULLPTR;
+    }
+
+  private:
+
+    //*************************************************************************
+    void add_ref()
+    {
+      if (p_object != ETL_NULLPTR)
+      {
+        p_object->get_reference_counter().increment_reference_count();
+      }
+    }
+
+    //*************************************************************************
+    void release_ref()
+    {
+      if ((p_object != ETL_NULLPTR) && (p_object->get_reference_counter().decrement_reference_count() == 0))
+      {
+        if (p_pool != ETL_NULLPTR)
+        {
+          p_pool->destroy(p_object);
+        }
+      }
+    }
+
+    pointer     p_object; ///< The counted object.
+    etl::ipool* p_pool;   ///< The pool that owns the object, or null.
+  };
+
+  //***************************************************************************
+  /// Equality.
+  //***************************************************************************
+  template <typename T1, typename T2>
+  bool operator ==(const etl::intrusive_ptr<T1>& lhs, const etl::intrusive_ptr<T2>& rhs)
+  {
+    return lhs.get() == rhs.get();
+  }
+
+  //***************************************************************************
+  /// Inequality.
+  //***************************************************************************
+  template <typename T1, typename T2>
+  bool operator !=(const etl::intrusive_ptr<T1>& lhs, const etl::intrusive_ptr<T2>& rhs)
+  {
+    return lhs.get() != rhs.get();
+  }
+
+  //***************************************************************************
+  /// Swap.
+  //***************************************************************************
+  template <typename T>
+  void swap(etl::intrusive_ptr<T>& lhs, etl::intrusive_ptr<T>& rhs) ETL_NOEXCEPT
+  {
+    lhs.swap(rhs);
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Creates an object in the pool and returns an intrusive_ptr to it.
+  /// If asserts or exceptions are not enabled and the pool is full then the
+  /// returned pointer is null.
+  ///\ingroup reference_counting
+  //***************************************************************************
+  template <typename T, typename... TArgs>
+  etl::intrusive_ptr<T> make_intrusive(etl::ipool& pool, TArgs&&... args)
+  {
+    T* p = pool.create<T>(etl::forward<TArgs>(args)...);
+
+    if (p == ETL_NULLPTR)
+    {
+      return etl::intrusive_ptr<T>();
+    }
+
+    return etl::intrusive_ptr<T>(p, pool);
+  }
+#endif
+}
+
+#endif
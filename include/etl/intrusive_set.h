@@ -0,0 +1,193 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_INTRUSIVE_SET_INCLUDED
+#define ETL_INTRUSIVE_SET_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "intrusive_links.h"
+#include "static_assert.h"
+#include "functional.h"
+#include "utility.h"
+
+#include "private/intrusive_rb_tree.h"
+
+#include <stddef.h>
+
+///\defgroup intrusive_set intrusive_set
+/// An ordered set of values with unique keys, linked through an etl::rb_tree_link.
+/// The values are not copied and no storage is allocated.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the intrusive_set.
+  ///\ingroup intrusive_set
+  //***************************************************************************
+  class intrusive_set_exception : public exception
+  {
+  public:
+
+    intrusive_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Already linked exception for the intrusive_set.
+  ///\ingroup intrusive_set
+  //***************************************************************************
+  class intrusive_set_value_is_already_linked : public intrusive_set_exception
+  {
+  public:
+
+    intrusive_set_value_is_already_linked(string_type file_name_, numeric_type line_number_)
+      : intrusive_set_exception(ETL_ERROR_TEXT("intrusive_set:value is already linked", ETL_INTRUSIVE_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// An intrusive set.
+  /// Values are ordered by TCompare and each value may appear only once.
+  ///\ingroup intrusive_set
+  ///\note TLink must be an etl::rb_tree_link and a base of TValue.
+  //***************************************************************************
+  template <typename TValue, typename TLink, typename TCompare = etl::less<TValue> >
+  class intrusive_set : public etl::private_intrusive_rb_tree::intrusive_rb_tree<TValue, TLink, TValue, etl::private_intrusive_rb_tree::value_is_key<TValue>, TCompare>
+  {
+  private:
+
+    typedef etl::private_intrusive_rb_tree::intrusive_rb_tree<TValue, TLink, TValue, etl::private_intrusive_rb_tree::value_is_key<TValue>, TCompare> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_rb_tree_link<TLink>::value, "TLink must be an etl::rb_tree_link");
+
+    typedef typename base_t::link_type link_type;
+
+    typedef typename base_t::key_type               key_type;
+    typedef typename base_t::value_type             value_type;
+    typedef TCompare                                value_compare;
+    typedef typename base_t::pointer                pointer;
+    typedef typename base_t::const_pointer          const_pointer;
+    typedef typename base_t::reference              reference;
+    typedef typename base_t::const_reference        const_reference;
+    typedef typename base_t::size_type              size_type;
+    typedef typename base_t::iterator               iterator;
+    typedef typename base_t::const_iterator         const_iterator;
+    typedef typename base_t::reverse_iterator       reverse_iterator;
+    typedef typename base_t::const_reverse_iterator const_reverse_iterator;
+    typedef typename base_t::difference_type        difference_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_set()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_set(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+    {
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Unlinks all of the values.
+    //*************************************************************************
+    ~intrusive_set()
+    {
+    }
+
+    //*************************************************************************
+    /// Unlinks the current values and inserts a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      this->clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Inserts a value.
+    /// If an equivalent value is already in the set then the value is not linked
+    /// and the iterator refers to the existing value.
+    /// If asserts or exceptions are enabled, emits intrusive_set_value_is_already_linked if the value is already linked.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type& value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!value.link_type::is_linked(), ETL_ERROR(intrusive_set_value_is_already_linked), ETL_OR_STD::make_pair(this->end(), false));
+
+      return this->insert_unique(value);
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the value comparison functor.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+  private:
+
+    // Disabled.
+    intrusive_set(const intrusive_set& other);
+    intrusive_set& operator = (const intrusive_set& rhs);
+  };
+}
+
+#endif
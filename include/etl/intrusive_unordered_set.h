@@ -0,0 +1,710 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_INTRUSIVE_UNORDERED_SET_INCLUDED
+#define ETL_INTRUSIVE_UNORDERED_SET_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "intrusive_links.h"
+#include "static_assert.h"
+#include "functional.h"
+#include "hash.h"
+#include "iterator.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+///\defgroup intrusive_unordered_set intrusive_unordered_set
+/// A hashed set of values with unique keys, chained through an etl::forward_link.
+/// The values are not copied and no storage is allocated.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the intrusive_unordered_set.
+  ///\ingroup intrusive_unordered_set
+  //***************************************************************************
+  class intrusive_unordered_set_exception : public exception
+  {
+  public:
+
+    intrusive_unordered_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Already linked exception for the intrusive_unordered_set.
+  ///\ingroup intrusive_unordered_set
+  //***************************************************************************
+  class intrusive_unordered_set_value_is_already_linked : public intrusive_unordered_set_exception
+  {
+  public:
+
+    intrusive_unordered_set_value_is_already_linked(string_type file_name_, numeric_type line_number_)
+      : intrusive_unordered_set_exception(ETL_ERROR_TEXT("intrusive_unordered_set:value is already linked", ETL_INTRUSIVE_UNORDERED_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// An intrusive unordered set.
+  /// Each bucket is the head of a chain of forward links.
+  /// Each value may appear only once.
+  ///\tparam TValue       The value type.
+  ///\tparam TLink        The link type. Must be an etl::forward_link and a base of TValue.
+  ///\tparam Bucket_Count The number of buckets.
+  ///\tparam THash        The hash functor.
+  ///\tparam TKeyEqual    The equality functor.
+  ///\ingroup intrusive_unordered_set
+  //***************************************************************************
+  template <typename TValue, typename TLink, size_t Bucket_Count, typename THash = etl::hash<TValue>, typename TKeyEqual = etl::equal_to<TValue> >
+  class intrusive_unordered_set
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_forward_link<TLink>::value, "TLink must be an etl::forward_link");
+    ETL_STATIC_ASSERT(Bucket_Count > 0U, "Bucket_Count must be greater than zero");
+
+    // Node typedef.
+    typedef TLink link_type;
+
+    // STL style typedefs.
+    typedef TValue            key_type;
+    typedef TValue            value_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef size_t            size_type;
+
+    static ETL_CONSTANT size_t BUCKET_COUNT = Bucket_Count;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, value_type>
+    {
+    public:
+
+      friend class intrusive_unordered_set;
+      friend class const_iterator;
+
+      iterator()
+        : p_bucket(ETL_NULLPTR)
+        , p_last_bucket(ETL_NULLPTR)
+        , p_value(ETL_NULLPTR)
+      {
+      }
+
+      iterator(const iterator& other)
+        : p_bucket(other.p_bucket)
+        , p_last_bucket(other.p_last_bucket)
+        , p_value(other.p_value)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        p_value = p_value->etl_next;
+        skip_empty_buckets();
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator =(const iterator& other)
+      {
+        p_bucket      = other.p_bucket;
+        p_last_bucket = other.p_last_bucket;
+        p_value       = other.p_value;
+        return *this;
+      }
+
+      reference operator *() const
+      {
+#include "etl/private/diagnostic_null_dereference_push.h"
+        return *static_cast<pointer>(p_value);
+#include "etl/private/diagnostic_pop.h"
+      }
+
+      pointer operator &() const
+      {
+        return static_cast<pointer>(p_value);
+      }
+
+      pointer operator ->() const
+      {
+        return static_cast<pointer>(p_value);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_value == rhs.p_value;
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(link_type* p_bucket_, link_type* p_last_bucket_, link_type* p_value_)
+        : p_bucket(p_bucket_)
+        , p_last_bucket(p_last_bucket_)
+        , p_value(p_value_)
+      {
+        skip_empty_buckets();
+      }
+
+      void skip_empty_buckets()
+      {
+        while ((p_value == &terminator) && (p_bucket != p_last_bucket))
+        {
+          ++p_bucket;
+          p_value = p_bucket->etl_next;
+        }
+      }
+
+      link_type* p_bucket;
+      link_type* p_last_bucket;
+      link_type* p_value;
+    };
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class intrusive_unordered_set;
+
+      const_iterator()
+        : p_bucket(ETL_NULLPTR)
+        , p_last_bucket(ETL_NULLPTR)
+        , p_value(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const typename intrusive_unordered_set::iterator& other)
+        : p_bucket(other.p_bucket)
+        , p_last_bucket(other.p_last_bucket)
+        , p_value(other.p_value)
+      {
+      }
+
+      const_iterator(const const_iterator& other)
+        : p_bucket(other.p_bucket)
+        , p_last_bucket(other.p_last_bucket)
+        , p_value(other.p_value)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        p_value = p_value->etl_next;
+        skip_empty_buckets();
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator =(const const_iterator& other)
+      {
+        p_bucket      = other.p_bucket;
+        p_last_bucket = other.p_last_bucket;
+        p_value       = other.p_value;
+        return *this;
+      }
+
+      const_reference operator *() const
+      {
+        return *static_cast<const value_type*>(p_value);
+      }
+
+      const_pointer operator &() const
+      {
+        return static_cast<const value_type*>(p_value);
+      }
+
+      const_pointer operator ->() const
+      {
+        return static_cast<const value_type*>(p_value);
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_value == rhs.p_value;
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const link_type* p_bucket_, const link_type* p_last_bucket_, const link_type* p_value_)
+        : p_bucket(p_bucket_)
+        , p_last_bucket(p_last_bucket_)
+        , p_value(p_value_)
+      {
+        skip_empty_buckets();
+      }
+
+      void skip_empty_buckets()
+      {
+        while ((p_value == &terminator) && (p_bucket != p_last_bucket))
+        {
+          ++p_bucket;
+          p_value = p_bucket->etl_next;
+        }
+      }
+
+      const link_type* p_bucket;
+      const link_type* p_last_bucket;
+      const link_type* p_value;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_unordered_set()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_unordered_set(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+    {
+      initialise();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Unlinks all of the values.
+    //*************************************************************************
+    ~intrusive_unordered_set()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the intrusive_unordered_set.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(&buckets[0], &buckets[Bucket_Count - 1U], buckets[0].etl_next);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the intrusive_unordered_set.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(&buckets[0], &buckets[Bucket_Count - 1U], buckets[0].etl_next);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the intrusive_unordered_set.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Gets the end of the intrusive_unordered_set.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(&buckets[Bucket_Count - 1U], &buckets[Bucket_Count - 1U], &terminator);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the intrusive_unordered_set.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(&buckets[Bucket_Count - 1U], &buckets[Bucket_Count - 1U], &terminator);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the intrusive_unordered_set.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Unlinks the current values and inserts a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Inserts a value.
+    /// If an equal value is already in the set then the value is not linked
+    /// and the iterator refers to the existing value.
+    /// If asserts or exceptions are enabled, emits intrusive_unordered_set_value_is_already_linked if the value is already linked.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type& value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!value.link_type::is_linked(), ETL_ERROR(intrusive_unordered_set_value_is_already_linked), ETL_OR_STD::make_pair(end(), false));
+
+      link_type* p_bucket = &buckets[bucket(value)];
+      link_type* p_found  = find_in_bucket(*p_bucket, value);
+
+      if (p_found != &terminator)
+      {
+        return ETL_OR_STD::make_pair(make_iterator(p_bucket, p_found), false);
+      }
+
+      // Link to the front of the bucket.
+      value.link_type::etl_next = p_bucket->etl_next;
+      p_bucket->etl_next        = &value;
+      ++current_size;
+
+      return ETL_OR_STD::make_pair(make_iterator(p_bucket, &value), true);
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Erases the value at the position.
+    /// Returns an iterator to the next value.
+    //*************************************************************************
+    iterator erase(iterator position)
+    {
+      iterator next = position;
+      ++next;
+
+      unlink(*position.p_bucket, *position.p_value);
+
+      return next;
+    }
+
+    //*************************************************************************
+    /// Erases the value at the position.
+    /// Returns an iterator to the next value.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      return erase(iterator(const_cast<link_type*>(position.p_bucket),
+                            const_cast<link_type*>(position.p_last_bucket),
+                            const_cast<link_type*>(position.p_value)));
+    }
+
+    //*************************************************************************
+    /// Erases a range of values.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      iterator i_first(const_cast<link_type*>(first.p_bucket),
+                       const_cast<link_type*>(first.p_last_bucket),
+                       const_cast<link_type*>(first.p_value));
+
+      iterator i_last(const_cast<link_type*>(last.p_bucket),
+                      const_cast<link_type*>(last.p_last_bucket),
+                      const_cast<link_type*>(last.p_value));
+
+      while (i_first != i_last)
+      {
+        i_first = erase(i_first);
+      }
+
+      return i_last;
+    }
+
+    //*************************************************************************
+    /// Erases the value equal to the key.
+    /// Returns the number of values erased.
+    //*************************************************************************
+    size_t erase(const key_type& key)
+    {
+      link_type* p_bucket = &buckets[bucket(key)];
+      link_type* p_found  = find_in_bucket(*p_bucket, key);
+
+      if (p_found == &terminator)
+      {
+        return 0U;
+      }
+
+      unlink(*p_bucket, *p_found);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Unlinks all of the values.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        link_type* p_unlink = buckets[i].etl_next;
+
+        while (p_unlink != &terminator)
+        {
+          link_type* p_next = p_unlink->etl_next;
+          p_unlink->clear();
+          p_unlink = p_next;
+        }
+      }
+
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Finds the value equal to the key.
+    //*************************************************************************
+    iterator find(const key_type& key)
+    {
+      link_type* p_bucket = &buckets[bucket(key)];
+      link_type* p_found  = find_in_bucket(*p_bucket, key);
+
+      return (p_found == &terminator) ? end() : make_iterator(p_bucket, p_found);
+    }
+
+    //*************************************************************************
+    /// Finds the value equal to the key.
+    //*************************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      return const_cast<intrusive_unordered_set*>(this)->find(key);
+    }
+
+    //*************************************************************************
+    /// Counts the values equal to the key.
+    //*************************************************************************
+    size_t count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Checks for a value equal to the key.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      const link_type& bucket_head = buckets[bucket(key)];
+
+      return find_in_bucket(const_cast<link_type&>(bucket_head), key) != &terminator;
+    }
+
+    //*************************************************************************
+    /// Returns true if there are no values.
+    //*************************************************************************
+    bool empty() const
+    {
+      return (current_size == 0U);
+    }
+
+    //*************************************************************************
+    /// Returns the number of values.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of buckets.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t bucket_count() const
+    {
+      return Bucket_Count;
+    }
+
+    //*************************************************************************
+    /// Returns the index of the bucket for the key.
+    //*************************************************************************
+    size_t bucket(const key_type& key) const
+    {
+      return static_cast<size_t>(hasher()(key)) % Bucket_Count;
+    }
+
+    //*************************************************************************
+    /// Returns the number of values in a bucket.
+    //*************************************************************************
+    size_t bucket_size(size_t index) const
+    {
+      size_t n = 0U;
+      const link_type* p_link = buckets[index].etl_next;
+
+      while (p_link != &terminator)
+      {
+        ++n;
+        p_link = p_link->etl_next;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Returns the average number of values per bucket.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(current_size) / static_cast<float>(Bucket_Count);
+    }
+
+    //*************************************************************************
+    /// Gets the hash functor.
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return hasher();
+    }
+
+    //*************************************************************************
+    /// Gets the equality functor.
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Initialise the intrusive_unordered_set.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        buckets[i].etl_next = &terminator;
+      }
+
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Finds the value equal to the key in a bucket.
+    /// Returns the terminator if not found.
+    //*************************************************************************
+    link_type* find_in_bucket(link_type& bucket_head, const key_type& key) const
+    {
+      link_type* p_link = bucket_head.etl_next;
+
+      while ((p_link != &terminator) && !key_equal()(*static_cast<const value_type*>(p_link), key))
+      {
+        p_link = p_link->etl_next;
+      }
+
+      return p_link;
+    }
+
+    //*************************************************************************
+    /// Unlinks a link from a bucket.
+    //*************************************************************************
+    void unlink(link_type& bucket_head, link_type& link)
+    {
+      link_type* p_previous = &bucket_head;
+
+      while (p_previous->etl_next != &link)
+      {
+        p_previous = p_previous->etl_next;
+      }
+
+      p_previous->etl_next = link.etl_next;
+      link.clear();
+      --current_size;
+    }
+
+    //*************************************************************************
+    /// Makes an iterator to a link in a bucket.
+    //*************************************************************************
+    iterator make_iterator(link_type* p_bucket, link_type* p_link)
+    {
+      return iterator(p_bucket, &buckets[Bucket_Count - 1U], p_link);
+    }
+
+    link_type buckets[Bucket_Count]; ///< The bucket heads.
+    static link_type terminator;     ///< The link that terminates every bucket chain.
+    size_t current_size;             ///< Counts the number of values.
+
+    // Disabled.
+    intrusive_unordered_set(const intrusive_unordered_set& other);
+    intrusive_unordered_set& operator = (const intrusive_unordered_set& rhs);
+  };
+
+  template <typename TValue, typename TLink, size_t Bucket_Count, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t intrusive_unordered_set<TValue, TLink, Bucket_Count, THash, TKeyEqual>::BUCKET_COUNT;
+
+  template <typename TValue, typename TLink, size_t Bucket_Count, typename THash, typename TKeyEqual>
+  TLink intrusive_unordered_set<TValue, TLink, Bucket_Count, THash, TKeyEqual>::terminator;
+}
+
+#endif
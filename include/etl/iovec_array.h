@@ -0,0 +1,331 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_IOVEC_ARRAY_INCLUDED
+#define ETL_IOVEC_ARRAY_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "multi_span.h"
+#include "byte_stream.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+///\defgroup iovec_array iovec_array
+/// A scatter/gather I/O vector.
+/// Describes one logical message spread across several buffers, such as a
+/// header, a payload and a trailer, without copying them.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the iovec_array.
+  ///\ingroup iovec_array
+  //***************************************************************************
+  class iovec_array_exception : public exception
+  {
+  public:
+
+    iovec_array_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the iovec_array.
+  ///\ingroup iovec_array
+  //***************************************************************************
+  class iovec_array_full : public iovec_array_exception
+  {
+  public:
+
+    iovec_array_full(string_type file_name_, numeric_type line_number_)
+      : iovec_array_exception(ETL_ERROR_TEXT("iovec_array:full", ETL_IOVEC_ARRAY_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A fixed capacity list of byte buffers that together form one message.
+  /// The buffers are referenced, not copied, and must outlive their use.
+  /// Empty buffers are not stored. The total length is kept as buffers are added.
+  ///\tparam MAX_SEGMENTS_ The maximum number of buffers.
+  ///\tparam T             The byte type. const for gather (transmit), non-const for scatter (receive).
+  ///\ingroup iovec_array
+  //***************************************************************************
+  template <size_t MAX_SEGMENTS_, typename T = const char>
+  class iovec_array
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof(T) == 1U, "etl::iovec_array must use a byte type");
+
+    static ETL_CONSTANT size_t MAX_SEGMENTS = MAX_SEGMENTS_;
+
+    typedef T                                    element_type;
+    typedef size_t                               size_type;
+    typedef etl::span<T>                         span_type;
+    typedef etl::multi_span<T>                   multi_span_type;
+    typedef const span_type*                     const_iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iovec_array()
+      : segment_count(0U)
+      , total_length(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a buffer of trivially copyable elements, as bytes.
+    /// If asserts or exceptions are enabled, emits etl::iovec_array_full if
+    /// there is no room for another buffer.
+    //*************************************************************************
+    template <typename U, size_t Extent>
+    void push_back(const etl::span<U, Extent>& buffer)
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<typename etl::remove_cv<U>::type>::value, "The elements must be trivially copyable");
+      ETL_STATIC_ASSERT(etl::is_const<T>::value || !etl::is_const<U>::value, "Cannot add a const buffer to a scatter iovec_array");
+
+      add_segment(reinterpret_cast<T*>(buffer.data()), buffer.size_bytes());
+    }
+
+    //*************************************************************************
+    /// Adds a buffer from a pointer and a length in bytes.
+    /// If asserts or exceptions are enabled, emits etl::iovec_array_full if
+    /// there is no room for another buffer.
+    //*************************************************************************
+    void push_back(T* data_, size_t length)
+    {
+      add_segment(data_, length);
+    }
+
+    //*************************************************************************
+    /// Adds the first 'count' elements of a buffer descriptor's buffer, such
+    /// as one from etl::buffer_descriptors.
+    /// If asserts or exceptions are enabled, emits etl::iovec_array_full if
+    /// there is no room for another buffer.
+    //*************************************************************************
+    template <typename TDescriptor>
+    typename etl::enable_if<!etl::is_pointer<TDescriptor>::value && !etl::is_array<TDescriptor>::value, void>::type
+      push_back(const TDescriptor& descriptor, size_t count)
+    {
+      add_segment(reinterpret_cast<T*>(descriptor.data()), etl::min(count, descriptor.max_size()) * sizeof(*descriptor.data()));
+    }
+
+    //*************************************************************************
+    /// Adds each non-empty span of a multi_span.
+    /// If asserts or exceptions are enabled, emits etl::iovec_array_full if
+    /// there is no room for all of them.
+    //*************************************************************************
+    template <typename U>
+    void append(const etl::multi_span<U>& buffers)
+    {
+      buffers.for_each_segment(segment_adder(*this));
+    }
+
+    //*************************************************************************
+    /// Adds the bytes written so far to a byte_stream_writer.
+    /// Only for gather (const) iovec_arrays.
+    /// If asserts or exceptions are enabled, emits etl::iovec_array_full if
+    /// there is no room for another buffer.
+    //*************************************************************************
+    void append(const etl::byte_stream_writer& writer)
+    {
+      push_back(writer.used_data());
+    }
+
+    //*************************************************************************
+    /// Removes the last buffer.
+    //*************************************************************************
+    void pop_back()
+    {
+      if (segment_count != 0U)
+      {
+        --segment_count;
+        total_length -= segments[segment_count].size();
+      }
+    }
+
+    //*************************************************************************
+    /// Removes all of the buffers.
+    //*************************************************************************
+    void clear()
+    {
+      segment_count = 0U;
+      total_length  = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the buffer at 'index'.
+    //*************************************************************************
+    const span_type& operator [](size_t index) const
+    {
+      return segments[index];
+    }
+
+    //*************************************************************************
+    /// The first buffer.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return segments;
+    }
+
+    //*************************************************************************
+    /// One past the last buffer.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return segments + segment_count;
+    }
+
+    //*************************************************************************
+    /// The buffers as a contiguous array, for hand-off to a driver.
+    //*************************************************************************
+    const span_type* data() const
+    {
+      return segments;
+    }
+
+    //*************************************************************************
+    /// A multi_span over the buffers.
+    /// Valid until the iovec_array is modified.
+    //*************************************************************************
+    multi_span_type view() const
+    {
+      return multi_span_type(typename multi_span_type::span_list_type(segments, segment_count));
+    }
+
+    //*************************************************************************
+    /// The number of buffers.
+    //*************************************************************************
+    size_t size() const
+    {
+      return segment_count;
+    }
+
+    //*************************************************************************
+    /// The total length, in bytes, of all of the buffers.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      return total_length;
+    }
+
+    //*************************************************************************
+    /// The maximum number of buffers.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SEGMENTS;
+    }
+
+    //*************************************************************************
+    /// The number of buffers that may still be added.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SEGMENTS - segment_count;
+    }
+
+    //*************************************************************************
+    /// Are there no buffers?
+    //*************************************************************************
+    bool empty() const
+    {
+      return segment_count == 0U;
+    }
+
+    //*************************************************************************
+    /// Is there room for another buffer?
+    //*************************************************************************
+    bool full() const
+    {
+      return segment_count == MAX_SEGMENTS;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds the spans passed by multi_span::for_each_segment.
+    //*************************************************************************
+    struct segment_adder
+    {
+      explicit segment_adder(iovec_array& owner_)
+        : p_owner(&owner_)
+      {
+      }
+
+      template <typename U>
+      void operator()(const etl::span<U>& buffer) const
+      {
+        p_owner->push_back(buffer);
+      }
+
+      iovec_array* p_owner;
+    };
+
+    //*************************************************************************
+    /// Stores a non-empty buffer.
+    //*************************************************************************
+    void add_segment(T* data_, size_t length)
+    {
+      if (length != 0U)
+      {
+        if (full())
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(iovec_array_full));
+          return;
+        }
+
+        segments[segment_count++] = span_type(data_, length);
+        total_length += length;
+      }
+    }
+
+    span_type segments[MAX_SEGMENTS_];
+    size_t    segment_count;
+    size_t    total_length;
+  };
+
+  template <size_t MAX_SEGMENTS_, typename T>
+  ETL_CONSTANT size_t iovec_array<MAX_SEGMENTS_, T>::MAX_SEGMENTS;
+}
+
+#endif
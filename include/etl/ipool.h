@@ -39,6 +39,10 @@ SOFTWARE.
 #include "memory.h"
 #include "placement_new.h"
 
+#if ETL_HAS_ALLOCATION_STATISTICS
+  #include "allocation_statistics.h"
+#endif
+
 #define ETL_POOL_CPP03_CODE 0
 
 namespace etl
@@ -247,6 +251,9 @@ namespace etl
     //*************************************************************************
     void release_all()
     {
+#if ETL_HAS_ALLOCATION_STATISTICS
+      statistics.on_release_all();
+#endif
       items_allocated = 0;
       items_initialised = 0;
       p_next = p_buffer;
@@ -279,6 +286,14 @@ namespace etl
       return Max_Size;
     }
 
+    //*************************************************************************
+    /// Returns the size of each item in the pool.
+    //*************************************************************************
+    size_t item_size() const
+    {
+      return Item_Size;
+    }
+
     //*************************************************************************
     /// Returns the number of free items in the pool.
     //*************************************************************************
@@ -313,6 +328,24 @@ namespace etl
       return items_allocated == Max_Size;
     }
 
+#if ETL_HAS_ALLOCATION_STATISTICS
+    //*************************************************************************
+    /// Gets the allocation statistics.
+    //*************************************************************************
+    etl::allocation_statistics& get_statistics()
+    {
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Gets the allocation statistics.
+    //*************************************************************************
+    const etl::allocation_statistics& get_statistics() const
+    {
+      return statistics;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -363,9 +396,16 @@ namespace etl
           // No more left!
           p_next = ETL_NULLPTR;
         }
+
+#if ETL_HAS_ALLOCATION_STATISTICS
+        statistics.on_allocate();
+#endif
       }
       else
       {
+#if ETL_HAS_ALLOCATION_STATISTICS
+        statistics.on_failure();
+#endif
         ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
       }
 
@@ -414,6 +454,10 @@ namespace etl
         p_next = p_value;
 
         --items_allocated;
+
+#if ETL_HAS_ALLOCATION_STATISTICS
+        statistics.on_release();
+#endif
       }
       else 
       {
@@ -454,6 +498,10 @@ namespace etl
     const uint32_t Item_Size;    ///< The size of allocated items.
     const uint32_t Max_Size;     ///< The maximum number of objects that can be allocated.
 
+#if ETL_HAS_ALLOCATION_STATISTICS
+    etl::allocation_statistics statistics; ///< The allocation statistics.
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -469,7 +517,64 @@ namespace etl
     }
 #endif
   };
-}
 
+  //***************************************************************************
+  /// A deleter that destroys an object and returns it to the pool that it
+  /// was created in. Holds just the pool pointer.
+  ///\tparam T The pointed to type.
+  ///\ingroup pool
+  //***************************************************************************
+  template <typename T>
+  struct pool_deleter
+  {
+    //*********************************
+    ETL_CONSTEXPR pool_deleter() ETL_NOEXCEPT
+      : p_pool(ETL_NULLPTR)
+    {
+    }
+
+    //*********************************
+    ETL_CONSTEXPR explicit pool_deleter(etl::ipool& pool) ETL_NOEXCEPT
+      : p_pool(&pool)
+    {
+    }
+
+    //*********************************
+    template <typename U>
+    pool_deleter(const pool_deleter<U>& other) ETL_NOEXCEPT
+      : p_pool(other.p_pool)
+    {
+    }
+
+    //*********************************
+    void operator()(T* p) const
+    {
+      p_pool->destroy(p);
+    }
+
+    etl::ipool* p_pool; ///< The pool that the object belongs to.
+  };
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// A unique_ptr to an object created in an etl::ipool.
+  ///\ingroup pool
+  //***************************************************************************
+  template <typename T>
+  using pool_unique_ptr = etl::unique_ptr<T, etl::pool_deleter<T>>;
+
+  //***************************************************************************
+  /// Creates an object in the pool and returns a pool_unique_ptr to it.
+  /// If asserts or exceptions are not enabled and the pool is full then the
+  /// returned pointer is null.
+  ///\ingroup pool
+  //***************************************************************************
+  template <typename T, typename... TArgs>
+  etl::pool_unique_ptr<T> make_pool_unique(etl::ipool& pool, TArgs&&... args)
+  {
+    return etl::pool_unique_ptr<T>(pool.create<T>(etl::forward<TArgs>(args)...), etl::pool_deleter<T>(pool));
+  }
 #endif
+}
 
+#endif
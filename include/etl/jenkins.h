@@ -76,6 +76,20 @@ namespace etl
       return hash;
     }
 
+    uint32_t add_block(value_type hash, const uint8_t* p) const
+    {
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      for (size_t i = 0U; i < Block_Size; ++i)
+      {
+        hash += p[i];
+        hash += (hash << 10U);
+        hash ^= (hash >> 6U);
+      }
+
+      return hash;
+    }
+
     uint32_t final(value_type hash) const
     {
       hash += (hash << 3U);
@@ -86,6 +100,8 @@ namespace etl
       return hash;
     }
 
+    static ETL_CONSTANT size_t Block_Size = 8U;
+
     mutable bool is_finalised;
   };
 
@@ -0,0 +1,464 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_KWAY_MERGE_INCLUDED
+#define ETL_KWAY_MERGE_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+
+///\defgroup kway_merge kway_merge
+/// Merges up to K sorted sources into one sorted sequence.
+/// A source is anything with a 'value_type' and empty(), front() and pop(),
+/// such as the ETL queues, or an iterator range through kway_merge_range.
+/// The sources are arranged in a tournament (loser) tree, so finding the
+/// next element costs one comparison per level, ceil(log2(K)) in all.
+/// The merge is stable; equal elements come from the earlier added source
+/// first.
+/// A source that is empty is treated as finished. If a source may be
+/// refilled, such as a queue fed by a producer, call rebuild() after it is.
+///\ingroup algorithms
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the kway_merge.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  class kway_merge_exception : public exception
+  {
+  public:
+
+    kway_merge_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// There is no room for another source.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  class kway_merge_full : public kway_merge_exception
+  {
+  public:
+
+    kway_merge_full(string_type file_name_, numeric_type line_number_)
+      : kway_merge_exception(ETL_ERROR_TEXT("kway_merge:full", ETL_KWAY_MERGE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Every source is empty.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  class kway_merge_empty : public kway_merge_exception
+  {
+  public:
+
+    kway_merge_empty(string_type file_name_, numeric_type line_number_)
+      : kway_merge_exception(ETL_ERROR_TEXT("kway_merge:empty", ETL_KWAY_MERGE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A kway_merge source over an iterator range.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  template <typename TIterator>
+  class kway_merge_range
+  {
+  public:
+
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    //*************************************************************************
+    kway_merge_range(TIterator first_, TIterator last_)
+      : first(first_)
+      , last(last_)
+    {
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return first == last;
+    }
+
+    //*************************************************************************
+    const value_type& front() const
+    {
+      return *first;
+    }
+
+    //*************************************************************************
+    void pop()
+    {
+      ++first;
+    }
+
+    //*************************************************************************
+    /// The remaining elements start here.
+    //*************************************************************************
+    TIterator begin() const
+    {
+      return first;
+    }
+
+  private:
+
+    TIterator first;
+    TIterator last;
+  };
+
+  //***************************************************************************
+  /// Merges up to K sorted sources of type TSource.
+  ///\ingroup kway_merge
+  //***************************************************************************
+  template <typename TSource, size_t K, typename TCompare = etl::less<typename TSource::value_type> >
+  class kway_merge
+  {
+  public:
+
+    ETL_STATIC_ASSERT(K != 0U, "A kway_merge needs at least one source");
+
+    typedef TSource                       source_type;
+    typedef typename TSource::value_type  value_type;
+    typedef TCompare                      value_compare;
+    typedef size_t                        size_type;
+
+    static ETL_CONSTANT size_type Max_Sources = K;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit kway_merge(TCompare compare_ = TCompare())
+      : compare(compare_)
+      , source_count(0U)
+    {
+      for (size_type i = 0U; i < K; ++i)
+      {
+        p_sources[i] = ETL_NULLPTR;
+        tree[i]      = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a source and rebuilds the tree.
+    /// If asserts or exceptions are enabled, emits kway_merge_full if there
+    /// are already K sources.
+    //*************************************************************************
+    void add(TSource& source)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(kway_merge_full));
+
+      p_sources[source_count] = &source;
+      ++source_count;
+
+      rebuild();
+    }
+
+    //*************************************************************************
+    /// Removes all of the sources.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_type i = 0U; i < K; ++i)
+      {
+        p_sources[i] = ETL_NULLPTR;
+        tree[i]      = 0U;
+      }
+
+      source_count = 0U;
+    }
+
+    //*************************************************************************
+    /// Rebuilds the tree from the heads of the sources.
+    /// Call after a source that was empty has been refilled.
+    //*************************************************************************
+    void rebuild()
+    {
+      // The winner of each node. The leaves are K to 2K - 1.
+      size_type winners[2U * K];
+
+      for (size_type i = 0U; i < K; ++i)
+      {
+        winners[K + i] = i;
+      }
+
+      for (size_type node = K - 1U; node != 0U; --node)
+      {
+        const size_type left  = winners[2U * node];
+        const size_type right = winners[(2U * node) + 1U];
+
+        if (beats(left, right))
+        {
+          winners[node] = left;
+          tree[node]    = right;
+        }
+        else
+        {
+          winners[node] = right;
+          tree[node]    = left;
+        }
+      }
+
+      tree[0] = winners[1];
+    }
+
+    //*************************************************************************
+    /// Returns true if every source is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return is_finished(tree[0]);
+    }
+
+    //*************************************************************************
+    /// The number of sources.
+    //*************************************************************************
+    size_type size() const
+    {
+      return source_count;
+    }
+
+    //*************************************************************************
+    /// The maximum number of sources.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_type max_size()
+    {
+      return K;
+    }
+
+    //*************************************************************************
+    /// Returns true if there are K sources.
+    //*************************************************************************
+    bool full() const
+    {
+      return source_count == K;
+    }
+
+    //*************************************************************************
+    /// The next element of the merge.
+    /// If asserts or exceptions are enabled, emits kway_merge_empty if every
+    /// source is empty.
+    //*************************************************************************
+    const value_type& front() const
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(kway_merge_empty));
+
+      return p_sources[tree[0]]->front();
+    }
+
+    //*************************************************************************
+    /// The index of the source that the next element comes from.
+    //*************************************************************************
+    size_type front_source() const
+    {
+      return tree[0];
+    }
+
+    //*************************************************************************
+    /// Removes the next element of the merge.
+    /// If asserts or exceptions are enabled, emits kway_merge_empty if every
+    /// source is empty.
+    //*************************************************************************
+    void pop()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(kway_merge_empty));
+
+      const size_type winner = tree[0];
+
+      p_sources[winner]->pop();
+      replay(winner);
+    }
+
+    //*************************************************************************
+    /// Moves every element to the output, in order.
+    /// Consecutive elements from one source are copied as a run, with one
+    /// comparison each, until the source's head no longer goes before the
+    /// best head of the other sources.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator merge(TOutputIterator output)
+    {
+      while (!empty())
+      {
+        size_type count = size_type(-1);
+        output = merge_run(output, count);
+      }
+
+      return output;
+    }
+
+    //*************************************************************************
+    /// Moves up to n elements to the output, in order, as merge(output).
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator merge(TOutputIterator output, size_type n)
+    {
+      while ((n != 0U) && !empty())
+      {
+        size_type count = n;
+        output = merge_run(output, count);
+        n -= count;
+      }
+
+      return output;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Copies the run of the winning source, of at most 'count' elements.
+    /// 'count' is set to the number of elements copied.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator merge_run(TOutputIterator output, size_type& count)
+    {
+      const size_type winner    = tree[0];
+      const size_type runner_up = find_runner_up(winner);
+      TSource&        source    = *p_sources[winner];
+
+      size_type copied = 0U;
+
+      do
+      {
+        *output = source.front();
+        ++output;
+        source.pop();
+        ++copied;
+      } while ((copied != count) && beats(winner, runner_up));
+
+      count = copied;
+      replay(winner);
+
+      return output;
+    }
+
+    //*************************************************************************
+    /// Is the source finished, or not there at all?
+    //*************************************************************************
+    bool is_finished(size_type i) const
+    {
+      return (i >= source_count) || p_sources[i]->empty();
+    }
+
+    //*************************************************************************
+    /// Does the head of source i go before the head of source j?
+    /// Ties go to the lower index, which keeps the merge stable.
+    //*************************************************************************
+    bool beats(size_type i, size_type j) const
+    {
+      if (is_finished(i))
+      {
+        return false;
+      }
+
+      if (is_finished(j))
+      {
+        return true;
+      }
+
+      if (i < j)
+      {
+        return !compare(p_sources[j]->front(), p_sources[i]->front());
+      }
+      else
+      {
+        return compare(p_sources[i]->front(), p_sources[j]->front());
+      }
+    }
+
+    //*************************************************************************
+    /// Plays the source's new head up the tree from its leaf.
+    //*************************************************************************
+    void replay(size_type source)
+    {
+      size_type winner = source;
+
+      for (size_type node = (K + source) / 2U; node != 0U; node /= 2U)
+      {
+        if (beats(tree[node], winner))
+        {
+          using ETL_OR_STD::swap;
+          swap(tree[node], winner);
+        }
+      }
+
+      tree[0] = winner;
+    }
+
+    //*************************************************************************
+    /// The second best source only lost to the winner, so is one of the
+    /// losers on the winner's path. Returns K if there is no other source.
+    //*************************************************************************
+    size_type find_runner_up(size_type winner) const
+    {
+      size_type runner_up = K;
+
+      for (size_type node = (K + winner) / 2U; node != 0U; node /= 2U)
+      {
+        if ((runner_up == K) || beats(tree[node], runner_up))
+        {
+          runner_up = tree[node];
+        }
+      }
+
+      return runner_up;
+    }
+
+    // Disable copy construction and assignment.
+    kway_merge(const kway_merge&) ETL_DELETE;
+    kway_merge& operator =(const kway_merge&) ETL_DELETE;
+
+    TCompare  compare;
+    TSource*  p_sources[K];
+    size_type tree[K];       ///< tree[0] is the winner, the rest the losers of each node.
+    size_type source_count;
+  };
+
+  template <typename TSource, size_t K, typename TCompare>
+  ETL_CONSTANT typename kway_merge<TSource, K, TCompare>::size_type kway_merge<TSource, K, TCompare>::Max_Sources;
+}
+
+#endif
@@ -1646,6 +1646,59 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Compacts the list, so that iteration visits the nodes in ascending
+    /// address order within the pool. The order of the elements is unchanged.
+    /// Elements are swapped between nodes, so iterators and references are
+    /// invalidated. Makes O(N^2) comparisons and O(N) swaps.
+    //*************************************************************************
+    void compact()
+    {
+      using ETL_OR_STD::swap; // Allow ADL
+
+      node_t* p_position = terminal_node.next;
+
+      while (p_position != &terminal_node)
+      {
+        // Find the lowest addressed node from this position to the end.
+        node_t* p_lowest = p_position;
+        node_t* p_node   = p_position->next;
+
+        while (p_node != &terminal_node)
+        {
+          if (p_node < p_lowest)
+          {
+            p_lowest = p_node;
+          }
+
+          p_node = p_node->next;
+        }
+
+        if (p_lowest != p_position)
+        {
+          node_t* p_lowest_previous = p_lowest->previous;
+
+          // Move the lowest node to this position.
+          join(*p_lowest->previous, *p_lowest->next);
+          join(*p_position->previous, *p_lowest);
+          join(*p_lowest, *p_position);
+
+          // Move this position's node to where the lowest node was.
+          if (p_lowest_previous != p_position)
+          {
+            join(*p_position->previous, *p_position->next);
+            join(*p_position, *p_lowest_previous->next);
+            join(*p_lowest_previous, *p_position);
+          }
+
+          // Restore the order of the elements.
+          swap(data_cast(p_lowest)->value, data_cast(p_position)->value);
+        }
+
+        p_position = p_lowest->next;
+      }
+    }
+
     //*************************************************************************
     /// Sort using in-place merge sort algorithm.
     /// Uses 'less-than operator as the predicate.
@@ -0,0 +1,211 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LOCK_FREE_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+#define ETL_LOCK_FREE_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "static_assert.h"
+#include "private/lock_free_free_list.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //*************************************************************************
+  /// A fixed sized memory block allocator that may be shared between
+  /// interrupts and threads without locking.
+  /// The free blocks are held in a lock free stack (a Treiber stack), with
+  /// a tag that guards against the ABA problem.
+  /// The allocated memory blocks are all the same size.
+  //*************************************************************************
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  class lock_free_memory_block_allocator : public imemory_block_allocator
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSize > 0U, "Size must be greater than zero");
+    ETL_STATIC_ASSERT(VSize <= etl::private_lock_free::free_list::Max_Items, "Size must be less than 65535");
+
+    static ETL_CONSTANT size_t Block_Size = VBlock_Size;
+    static ETL_CONSTANT size_t Alignment  = VAlignment;
+    static ETL_CONSTANT size_t Size       = VSize;
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    lock_free_memory_block_allocator()
+      : free_blocks(next_free, VSize)
+      , n_allocated(0U)
+    {
+      free_blocks.initialise();
+    }
+
+    //*************************************************************************
+    /// The number of allocated blocks.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      return n_allocated.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The number of free blocks.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      return VSize - size();
+    }
+
+    //*************************************************************************
+    /// The total number of blocks.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t max_size() const
+    {
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// Are all of the blocks free?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Are all of the blocks allocated?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == VSize;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if ((required_alignment > Alignment) || (required_size > Block_Size))
+      {
+        return ETL_NULLPTR;
+      }
+
+      const uint16_t index = free_blocks.pop();
+
+      if (index == etl::private_lock_free::free_list::Nil)
+      {
+        return ETL_NULLPTR;
+      }
+
+      n_allocated.fetch_add(1U, etl::memory_order_relaxed);
+
+      return blocks[index].template get_address<void>();
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      if (!is_owner_of_block(pblock))
+      {
+        return false;
+      }
+
+      free_blocks.push(get_block_index(pblock));
+
+      n_allocated.fetch_sub(1U, etl::memory_order_relaxed);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      const char* p     = static_cast<const char*>(pblock);
+      const char* begin = reinterpret_cast<const char*>(&blocks[0]);
+      const char* end   = begin + sizeof(blocks);
+
+      return (p >= begin) && (p < end) && (((p - begin) % sizeof(block_t)) == 0);
+    }
+
+  private:
+
+    typedef typename etl::aligned_storage<VBlock_Size, VAlignment>::type block_t;
+
+    //*************************************************************************
+    /// The index of a block owned by this allocator.
+    //*************************************************************************
+    uint16_t get_block_index(const void* const pblock) const
+    {
+      const char* p     = static_cast<const char*>(pblock);
+      const char* begin = reinterpret_cast<const char*>(&blocks[0]);
+
+      return static_cast<uint16_t>(static_cast<size_t>(p - begin) / sizeof(block_t));
+    }
+
+    block_t                           blocks[VSize];    ///< The memory blocks.
+    etl::atomic<uint16_t>             next_free[VSize]; ///< The links of the free list.
+    etl::private_lock_free::free_list free_blocks;      ///< The free list.
+    etl::atomic<size_t>               n_allocated;      ///< The number of allocated blocks.
+
+    // Should not be copied.
+    lock_free_memory_block_allocator(const lock_free_memory_block_allocator&) ETL_DELETE;
+    lock_free_memory_block_allocator& operator =(const lock_free_memory_block_allocator&) ETL_DELETE;
+  };
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t lock_free_memory_block_allocator<VBlock_Size, VAlignment, VSize>::Block_Size;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t lock_free_memory_block_allocator<VBlock_Size, VAlignment, VSize>::Alignment;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t lock_free_memory_block_allocator<VBlock_Size, VAlignment, VSize>::Size;
+}
+
+#endif
+
+#endif
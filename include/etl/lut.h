@@ -0,0 +1,234 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LUT_INCLUDED
+#define ETL_LUT_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+#if ETL_USING_CPP14
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interpolation between the entries of an etl::lut.
+  //***************************************************************************
+  struct lut_interpolation
+  {
+    enum enum_type
+    {
+      Nearest,
+      Linear,
+      Cubic
+    };
+  };
+
+  namespace private_lut
+  {
+    //*************************************************************************
+    /// Converts a function value to a table entry.
+    /// Integral entries are rounded half away from zero.
+    //*************************************************************************
+    template <typename T, bool Is_Integral = etl::is_integral<T>::value>
+    struct convert
+    {
+      static constexpr T from_double(double value)
+      {
+        return T(value);
+      }
+    };
+
+    template <typename T>
+    struct convert<T, true>
+    {
+      static constexpr T from_double(double value)
+      {
+        return T((value >= 0.0) ? (value + 0.5) : (value - 0.5));
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A lookup table of a function, generated at compile time.
+  /// TFunction is a literal type with static constexpr double members 'lower'
+  /// and 'upper', giving the range of inputs, and a constexpr
+  /// 'double operator()(double) const'.
+  /// The table holds Size samples, evenly spaced from lower to upper inclusive.
+  /// Declare it constexpr to place it in read only memory.
+  /// \code
+  /// struct square
+  /// {
+  ///   static constexpr double lower = 0.0;
+  ///   static constexpr double upper = 1.0;
+  ///   constexpr double operator()(double x) const { return x * x; }
+  /// };
+  ///
+  /// constexpr etl::lut<square, 33> table;
+  /// double y = table(0.3);
+  /// \endcode
+  ///\tparam TFunction     The function to tabulate.
+  ///\tparam Size          The number of entries.
+  ///\tparam Interpolation The etl::lut_interpolation used by operator().
+  ///\tparam T             The entry type. Integral entries are rounded.
+  //***************************************************************************
+  template <typename TFunction, size_t Size_, int Interpolation = etl::lut_interpolation::Linear, typename T = double>
+  class lut
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Size_ >= 2U, "A lookup table needs at least two entries");
+
+    static ETL_CONSTANT size_t Size = Size_;
+
+    typedef T         value_type;
+    typedef TFunction function_type;
+
+    //*************************************************************************
+    /// Constructor. Generates the table.
+    //*************************************************************************
+    constexpr lut()
+      : table()
+    {
+      const TFunction function{};
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        table[i] = private_lut::convert<T>::from_double(function(input(i)));
+      }
+    }
+
+    //*************************************************************************
+    /// The input for entry i.
+    //*************************************************************************
+    static constexpr double input(size_t i)
+    {
+      return (i == (Size - 1U)) ? TFunction::upper : TFunction::lower + (step() * double(i));
+    }
+
+    //*************************************************************************
+    /// The distance between the inputs of adjacent entries.
+    //*************************************************************************
+    static constexpr double step()
+    {
+      return (TFunction::upper - TFunction::lower) / double(Size - 1U);
+    }
+
+    //*************************************************************************
+    /// Gets entry i.
+    //*************************************************************************
+    constexpr T operator [](size_t i) const
+    {
+      return table[i];
+    }
+
+    //*************************************************************************
+    /// Gets the entries.
+    //*************************************************************************
+    constexpr const T* data() const
+    {
+      return table;
+    }
+
+    //*************************************************************************
+    /// Gets the number of entries.
+    //*************************************************************************
+    constexpr size_t size() const
+    {
+      return Size;
+    }
+
+    //*************************************************************************
+    /// Looks up the function at x, interpolating between entries.
+    /// Inputs outside the range are clamped to it.
+    //*************************************************************************
+    constexpr double operator ()(double x) const
+    {
+      if (!(x > TFunction::lower))
+      {
+        return double(table[0]);
+      }
+
+      if (!(x < TFunction::upper))
+      {
+        return double(table[Size - 1U]);
+      }
+
+      const double position = (x - TFunction::lower) / step();
+
+      size_t i = size_t(position);
+
+      if (i >= (Size - 1U))
+      {
+        i = Size - 2U;
+      }
+
+      const double t  = position - double(i);
+      const double p1 = double(table[i]);
+      const double p2 = double(table[i + 1U]);
+
+      if (Interpolation == etl::lut_interpolation::Nearest)
+      {
+        return (t < 0.5) ? p1 : p2;
+      }
+      else if (Interpolation == etl::lut_interpolation::Linear)
+      {
+        return p1 + (t * (p2 - p1));
+      }
+      else
+      {
+        // Catmull-Rom, extrapolating the end points quadratically.
+        // A two entry table has no curvature to extrapolate, so is linear.
+        const bool   first = (i == 0U);
+        const bool   last  = ((i + 2U) == Size);
+        const double pm    = first ? 0.0 : double(table[i - 1U]);
+        const double pp    = last  ? 0.0 : double(table[i + 2U]);
+
+        const double p0 = !first ? pm : (last ? (2.0 * p1) - p2 : (3.0 * (p1 - p2)) + pp);
+        const double p3 = !last  ? pp : (first ? (2.0 * p2) - p1 : (3.0 * (p2 - p1)) + pm);
+
+        return p1 + (0.5 * t * ((p2 - p0) + (t * (((2.0 * p0) - (5.0 * p1) + (4.0 * p2) - p3) + (t * ((3.0 * (p1 - p2)) + p3 - p0))))));
+      }
+    }
+
+  private:
+
+    T table[Size_];
+  };
+
+  template <typename TFunction, size_t Size_, int Interpolation, typename T>
+  ETL_CONSTANT size_t lut<TFunction, Size_, Interpolation, T>::Size;
+}
+
+#endif
+#endif
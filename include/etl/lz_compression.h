@@ -0,0 +1,581 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LZ_COMPRESSION_INCLUDED
+#define ETL_LZ_COMPRESSION_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "optional.h"
+#include "byte_stream.h"
+#include "static_assert.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup lz_compression lz_compression
+/// Heap free LZ compression, compatible with the LZ4 block format.
+/// Each block is compressed independently. The compressor uses a hash table
+/// of 4 byte sequences held in caller storage, and matches no further back
+/// than a configurable window, of at most 65535 bytes.
+/// Blocks may be written to, and read from, byte streams, prefixed with their
+/// size as a varint, to compress a stream a block at a time.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for lz_compression.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  class lz_compression_exception : public etl::exception
+  {
+  public:
+
+    lz_compression_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The hash table size is not a power of 2.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  class lz_compression_invalid_hash_table : public lz_compression_exception
+  {
+  public:
+
+    lz_compression_invalid_hash_table(string_type file_name_, numeric_type line_number_)
+      : lz_compression_exception(ETL_ERROR_TEXT("lz compression:hash table", ETL_LZ_COMPRESSION_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_lz_compression
+  {
+    static ETL_CONSTANT size_t Min_Match      = 4U;
+    static ETL_CONSTANT size_t Last_Literals  = 5U;  ///< The last bytes of a block are always literals.
+    static ETL_CONSTANT size_t Match_Limit    = 12U; ///< A match may not start in the last bytes of a block.
+    static ETL_CONSTANT size_t Run_Mask       = 15U;
+
+    //*************************************************************************
+    inline uint32_t read_32(const uint8_t* p)
+    {
+      uint32_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Writes an LZ4 length extension.
+    //*************************************************************************
+    inline uint8_t* write_length(uint8_t* p_out, size_t length)
+    {
+      while (length >= 255U)
+      {
+        *p_out++ = 255U;
+        length  -= 255U;
+      }
+
+      *p_out++ = static_cast<uint8_t>(length);
+
+      return p_out;
+    }
+
+    //*************************************************************************
+    /// Reads an LZ4 length extension.
+    /// Returns false if the input ends first.
+    //*************************************************************************
+    inline bool read_length(const uint8_t*& p_in, const uint8_t* p_in_end, size_t& length)
+    {
+      uint8_t value;
+
+      do
+      {
+        if (p_in == p_in_end)
+        {
+          return false;
+        }
+
+        value   = *p_in++;
+        length += value;
+      } while (value == 255U);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The number of bytes to write a sequence.
+    //*************************************************************************
+    inline size_t sequence_size(size_t n_literals, size_t match_length)
+    {
+      size_t size = 1U + n_literals;
+
+      if (n_literals >= Run_Mask)
+      {
+        size += ((n_literals - Run_Mask) / 255U) + 1U;
+      }
+
+      if (match_length != 0U)
+      {
+        size += 2U;
+
+        if ((match_length - Min_Match) >= Run_Mask)
+        {
+          size += ((match_length - Min_Match - Run_Mask) / 255U) + 1U;
+        }
+      }
+
+      return size;
+    }
+
+    //*************************************************************************
+    /// Writes a sequence of literals and, if match_length is not zero, a match.
+    //*************************************************************************
+    inline uint8_t* write_sequence(uint8_t* p_out, const uint8_t* p_literals, size_t n_literals, size_t offset, size_t match_length)
+    {
+      uint8_t* p_token = p_out++;
+
+      const size_t literal_code = (n_literals < Run_Mask) ? n_literals : Run_Mask;
+
+      if (n_literals >= Run_Mask)
+      {
+        p_out = write_length(p_out, n_literals - Run_Mask);
+      }
+
+      if (n_literals != 0U)
+      {
+        memcpy(p_out, p_literals, n_literals);
+        p_out += n_literals;
+      }
+
+      size_t match_code = 0U;
+
+      if (match_length != 0U)
+      {
+        *p_out++ = static_cast<uint8_t>(offset);
+        *p_out++ = static_cast<uint8_t>(offset >> 8U);
+
+        const size_t length = match_length - Min_Match;
+
+        match_code = (length < Run_Mask) ? length : Run_Mask;
+
+        if (length >= Run_Mask)
+        {
+          p_out = write_length(p_out, length - Run_Mask);
+        }
+      }
+
+      *p_token = static_cast<uint8_t>((literal_code << 4U) | match_code);
+
+      return p_out;
+    }
+  }
+
+  //***************************************************************************
+  /// The largest window, the furthest back that a match may refer.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  static ETL_CONSTANT size_t lz_max_window = 65535U;
+
+  //***************************************************************************
+  /// The maximum compressed size of input_size bytes.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  ETL_CONSTEXPR inline size_t lz_compress_bound(size_t input_size)
+  {
+    return input_size + (input_size / 255U) + 16U;
+  }
+
+  //***************************************************************************
+  /// Compresses a block.
+  /// The hash table is caller storage, of a power of 2 entries, and is
+  /// overwritten. 4096 entries is a good balance of speed, ratio and size.
+  /// window is the furthest back, in bytes, that a match may refer.
+  /// Returns the compressed size, or an empty optional if the output is too small.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  inline etl::optional<size_t> lz_compress(const uint8_t* input, size_t input_size,
+                                           uint8_t* output, size_t output_size,
+                                           etl::span<uint32_t> hash_table,
+                                           size_t window = lz_max_window)
+  {
+    using namespace private_lz_compression;
+
+    ETL_ASSERT_OR_RETURN_VALUE((hash_table.size() >= 2U) && ((hash_table.size() & (hash_table.size() - 1U)) == 0U),
+                               ETL_ERROR(lz_compression_invalid_hash_table),
+                               etl::optional<size_t>());
+
+    uint32_t hash_shift = 32U;
+
+    for (size_t n = hash_table.size(); n > 1U; n >>= 1U)
+    {
+      --hash_shift;
+    }
+
+    window = (window < lz_max_window) ? window : lz_max_window;
+
+    const uint8_t* const       p_out_end = output + output_size;
+    uint8_t*                   p_out     = output;
+    size_t                     anchor    = 0U;
+
+    if (input_size > Match_Limit)
+    {
+      memset(hash_table.data(), 0, hash_table.size_bytes());
+
+      const size_t match_start_limit = input_size - Match_Limit;
+      const size_t match_end_limit   = input_size - Last_Literals;
+
+      size_t position = 0U;
+      size_t skip     = 1U << 6U;
+
+      while (position < match_start_limit)
+      {
+        const uint32_t sequence  = read_32(input + position);
+        const uint32_t hash      = static_cast<uint32_t>(sequence * 2654435761UL) >> hash_shift;
+        size_t         candidate = hash_table[hash];
+
+        hash_table[hash] = static_cast<uint32_t>(position);
+
+        if ((candidate >= position) || ((position - candidate) > window) || (read_32(input + candidate) != sequence))
+        {
+          // The further since the last match, the faster incompressible data is skipped.
+          position += (skip++ >> 6U);
+          continue;
+        }
+
+        // Extend the match backwards.
+        while ((position > anchor) && (candidate > 0U) && (input[position - 1U] == input[candidate - 1U]))
+        {
+          --position;
+          --candidate;
+        }
+
+        // Extend the match forwards.
+        size_t length = Min_Match;
+
+        while (((position + length) < match_end_limit) && (input[candidate + length] == input[position + length]))
+        {
+          ++length;
+        }
+
+        const size_t n_literals = position - anchor;
+
+        if (sequence_size(n_literals, length) > static_cast<size_t>(p_out_end - p_out))
+        {
+          return etl::optional<size_t>();
+        }
+
+        p_out = write_sequence(p_out, input + anchor, n_literals, position - candidate, length);
+
+        position += length;
+        anchor    = position;
+        skip      = 1U << 6U;
+
+        // Index a sequence inside the match.
+        if (position < match_start_limit)
+        {
+          const size_t inner = position - 2U;
+          hash_table[static_cast<uint32_t>(read_32(input + inner) * 2654435761UL) >> hash_shift] = static_cast<uint32_t>(inner);
+        }
+      }
+    }
+
+    // The last literals.
+    const size_t n_literals = input_size - anchor;
+
+    if (sequence_size(n_literals, 0U) > static_cast<size_t>(p_out_end - p_out))
+    {
+      return etl::optional<size_t>();
+    }
+
+    p_out = write_sequence(p_out, input + anchor, n_literals, 0U, 0U);
+
+    return etl::optional<size_t>(static_cast<size_t>(p_out - output));
+  }
+
+  //***************************************************************************
+  /// Compresses a block.
+  /// Returns the compressed size, or an empty optional if the output is too small.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  template <size_t Length1, size_t Length2>
+  etl::optional<size_t> lz_compress(const etl::span<const uint8_t, Length1>& input,
+                                    const etl::span<uint8_t, Length2>&       output,
+                                    etl::span<uint32_t>                      hash_table,
+                                    size_t                                   window = lz_max_window)
+  {
+    return lz_compress(input.data(), input.size(), output.data(), output.size(), hash_table, window);
+  }
+
+  //***************************************************************************
+  /// Decompresses a block.
+  /// Returns the decompressed size, or an empty optional if the block is
+  /// malformed or the output is too small.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  inline etl::optional<size_t> lz_decompress(const uint8_t* input, size_t input_size, uint8_t* output, size_t output_size)
+  {
+    using namespace private_lz_compression;
+
+    const uint8_t*       p_in      = input;
+    const uint8_t* const p_in_end  = input + input_size;
+    uint8_t*             p_out     = output;
+    uint8_t* const       p_out_end = output + output_size;
+
+    while (p_in != p_in_end)
+    {
+      const uint8_t token = *p_in++;
+
+      // Literals.
+      size_t n_literals = token >> 4U;
+
+      if ((n_literals == Run_Mask) && !read_length(p_in, p_in_end, n_literals))
+      {
+        return etl::optional<size_t>();
+      }
+
+      if ((n_literals > static_cast<size_t>(p_in_end - p_in)) || (n_literals > static_cast<size_t>(p_out_end - p_out)))
+      {
+        return etl::optional<size_t>();
+      }
+
+      if (n_literals != 0U)
+      {
+        memcpy(p_out, p_in, n_literals);
+        p_in  += n_literals;
+        p_out += n_literals;
+      }
+
+      // The last sequence has no match.
+      if (p_in == p_in_end)
+      {
+        break;
+      }
+
+      // Match.
+      if ((p_in_end - p_in) < 2)
+      {
+        return etl::optional<size_t>();
+      }
+
+      const size_t offset = static_cast<size_t>(p_in[0]) | (static_cast<size_t>(p_in[1]) << 8U);
+      p_in += 2;
+
+      size_t length = token & Run_Mask;
+
+      if ((length == Run_Mask) && !read_length(p_in, p_in_end, length))
+      {
+        return etl::optional<size_t>();
+      }
+
+      length += Min_Match;
+
+      if ((offset == 0U) || (offset > static_cast<size_t>(p_out - output)) || (length > static_cast<size_t>(p_out_end - p_out)))
+      {
+        return etl::optional<size_t>();
+      }
+
+      const uint8_t* p_match = p_out - offset;
+
+      if (offset >= length)
+      {
+        memcpy(p_out, p_match, length);
+        p_out += length;
+      }
+      else
+      {
+        // The match overlaps its own output, repeating a pattern.
+        while (length-- != 0U)
+        {
+          *p_out++ = *p_match++;
+        }
+      }
+    }
+
+    return etl::optional<size_t>(static_cast<size_t>(p_out - output));
+  }
+
+  //***************************************************************************
+  /// Decompresses a block.
+  /// Returns the decompressed size, or an empty optional if the block is
+  /// malformed or the output is too small.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  template <size_t Length1, size_t Length2>
+  etl::optional<size_t> lz_decompress(const etl::span<const uint8_t, Length1>& input, const etl::span<uint8_t, Length2>& output)
+  {
+    return lz_decompress(input.data(), input.size(), output.data(), output.size());
+  }
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Compresses a block to a byte stream, prefixed with its compressed size as a varint.
+  /// Returns false, and writes nothing, if the stream does not have room.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  template <size_t Length>
+  bool lz_compress(const etl::span<const uint8_t, Length>& input,
+                   etl::byte_stream_writer&                writer,
+                   etl::span<uint32_t>                     hash_table,
+                   size_t                                  window = lz_max_window)
+  {
+    const size_t Max_Prefix = etl::private_byte_stream::varint_max_size<uint32_t>::value;
+
+    etl::span<char> free_data = writer.free_data();
+
+    if (free_data.size() <= Max_Prefix)
+    {
+      return false;
+    }
+
+    // Compress after the largest prefix, then move the block up to the actual prefix.
+    uint8_t* p_block = reinterpret_cast<uint8_t*>(free_data.data()) + Max_Prefix;
+
+    etl::optional<size_t> size = lz_compress(input.data(), input.size(), p_block, free_data.size() - Max_Prefix, hash_table, window);
+
+    if (!size.has_value())
+    {
+      return false;
+    }
+
+    const size_t prefix_size = etl::varint_size(static_cast<uint32_t>(size.value()));
+
+    memmove(free_data.data() + prefix_size, p_block, size.value());
+
+    writer.write_varint_unchecked(static_cast<uint32_t>(size.value()));
+    writer.skip<char>(size.value());
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Decompresses a block, prefixed with its compressed size as a varint, from a byte stream.
+  /// Returns the decompressed size, or an empty optional, and reads nothing,
+  /// if the block is truncated, malformed or the output is too small.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  template <size_t Length>
+  etl::optional<size_t> lz_decompress(etl::byte_stream_reader& reader, const etl::span<uint8_t, Length>& output)
+  {
+    const size_t start = reader.used_data().size();
+
+    etl::optional<size_t> result;
+
+    etl::optional<uint32_t> size = reader.read_varint<uint32_t>();
+
+    if (size.has_value())
+    {
+      if (reader.available<uint8_t>() >= size.value())
+      {
+        etl::span<const uint8_t> block = reader.read_unchecked<uint8_t>(size.value());
+
+        result = lz_decompress(block.data(), block.size(), output.data(), output.size());
+      }
+    }
+
+    if (!result.has_value())
+    {
+      reader.restart(start);
+    }
+
+    return result;
+  }
+#endif
+
+  //***************************************************************************
+  /// A compressor with its own hash table, of 2^Hash_Bits entries.
+  ///\ingroup lz_compression
+  //***************************************************************************
+  template <size_t Hash_Bits = 12U>
+  class lz_compressor
+  {
+  public:
+
+    ETL_STATIC_ASSERT((Hash_Bits >= 1U) && (Hash_Bits <= 20U), "Hash_Bits out of range");
+
+    static ETL_CONSTANT size_t Hash_Size = size_t(1U) << Hash_Bits;
+
+    //*************************************************************************
+    /// Constructor.
+    /// window is the furthest back, in bytes, that a match may refer.
+    //*************************************************************************
+    explicit lz_compressor(size_t window_ = lz_max_window)
+      : window(window_)
+    {
+    }
+
+    //*************************************************************************
+    /// Compresses a block.
+    /// Returns the compressed size, or an empty optional if the output is too small.
+    //*************************************************************************
+    etl::optional<size_t> compress(const uint8_t* input, size_t input_size, uint8_t* output, size_t output_size)
+    {
+      return etl::lz_compress(input, input_size, output, output_size, etl::span<uint32_t>(hash_table, Hash_Size), window);
+    }
+
+    //*************************************************************************
+    /// Compresses a block.
+    /// Returns the compressed size, or an empty optional if the output is too small.
+    //*************************************************************************
+    template <size_t Length1, size_t Length2>
+    etl::optional<size_t> compress(const etl::span<const uint8_t, Length1>& input, const etl::span<uint8_t, Length2>& output)
+    {
+      return etl::lz_compress(input, output, etl::span<uint32_t>(hash_table, Hash_Size), window);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Compresses a block to a byte stream, prefixed with its compressed size as a varint.
+    /// Returns false, and writes nothing, if the stream does not have room.
+    //*************************************************************************
+    template <size_t Length>
+    bool compress(const etl::span<const uint8_t, Length>& input, etl::byte_stream_writer& writer)
+    {
+      return etl::lz_compress(input, writer, etl::span<uint32_t>(hash_table, Hash_Size), window);
+    }
+#endif
+
+  private:
+
+    size_t   window;
+    uint32_t hash_table[Hash_Size];
+  };
+
+  template <size_t Hash_Bits>
+  ETL_CONSTANT size_t lz_compressor<Hash_Bits>::Hash_Size;
+}
+
+#endif
@@ -39,7 +39,10 @@ SOFTWARE.
 #include "exception.h"
 #include "error_handler.h"
 #include "debug_count.h"
+#include "container_statistics.h"
 #include "nullptr.h"
+#include "integral_limits.h"
+#include "static_assert.h"
 #include "type_traits.h"
 #include "nth_type.h"
 #include "parameter_type.h"
@@ -52,6 +55,7 @@ SOFTWARE.
 
 #include "private/minmax_push.h"
 #include "private/comparator_is_transparent.h"
+#include "private/tree_node_link.h"
 
 //*****************************************************************************
 ///\defgroup map map
@@ -191,6 +195,8 @@ namespace etl
     //*************************************************************************
     struct Node
     {
+      typedef etl::private_tree::node_link<Node>::type link_type;
+
       //***********************************************************************
       /// Constructor
       //***********************************************************************
@@ -218,11 +224,32 @@ namespace etl
         children[1] = ETL_NULLPTR;
       }
 
-      Node*   children[2];
+      link_type children[2];
       uint_least8_t weight;
       uint_least8_t dir;
     };
 
+    //*************************************************************************
+    /// The state of a search for ascending keys.
+    /// 'ancestors' holds the nodes above the position with greater keys,
+    /// deepest last. 'subtree' is the unsearched part of the tree below them.
+    //*************************************************************************
+    struct sorted_search
+    {
+      explicit sorted_search(const Node* root)
+        : subtree(root)
+        , depth(0U)
+      {
+      }
+
+      // Exceeds the height of any AVL tree that fits in memory.
+      static ETL_CONSTANT size_t Max_Depth = (etl::integral_limits<size_t>::bits * 3U) / 2U;
+
+      const Node* ancestors[Max_Depth];
+      const Node* subtree;
+      size_t      depth;
+    };
+
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
@@ -244,7 +271,8 @@ namespace etl
     //*************************************************************************
     /// Balance the critical node at the position provided as needed
     //*************************************************************************
-    void balance_node(Node*& critical_node)
+    template <typename TLink>
+    void balance_node(TLink& critical_node)
     {
       // Step 1: Update weights for all children of the critical node up to the
       // newly inserted node. This step is costly (in terms of traversing nodes
@@ -307,7 +335,8 @@ namespace etl
     //*************************************************************************
     /// Rotate two nodes at the position provided the to balance the tree
     //*************************************************************************
-    void rotate_2node(Node*& position, uint_least8_t dir)
+    template <typename TLink>
+    void rotate_2node(TLink& position, uint_least8_t dir)
     {
       //     A            C             A          B
       //   B   C   ->   A   E   OR    B   C  ->  D   A
@@ -337,7 +366,8 @@ namespace etl
     //*************************************************************************
     /// Rotate three nodes at the position provided the to balance the tree
     //*************************************************************************
-    void rotate_3node(Node*& position, uint_least8_t dir, uint_least8_t third)
+    template <typename TLink>
+    void rotate_3node(TLink& position, uint_least8_t dir, uint_least8_t third)
     {
       //        --A--             --E--            --A--             --D--
       //      _B_    C    ->     B     A    OR    B    _C_   ->     A     C
@@ -411,7 +441,8 @@ namespace etl
     //*************************************************************************
     /// Attach the provided node to the position provided
     //*************************************************************************
-    void attach_node(Node*& position, Node& node)
+    template <typename TLink>
+    void attach_node(TLink& position, Node& node)
     {
       // Mark new node as leaf on attach to tree at position provided
       node.mark_as_leaf();
@@ -426,7 +457,8 @@ namespace etl
     //*************************************************************************
     /// Detach the node at the position provided
     //*************************************************************************
-    void detach_node(Node*& position, Node*& replacement)
+    template <typename TPositionLink, typename TReplacementLink>
+    void detach_node(TPositionLink& position, TReplacementLink& replacement)
     {
       // Make temporary copy of actual nodes involved because we might lose
       // their references in the process (e.g. position is the same as
@@ -447,287 +479,917 @@ namespace etl
       swap->weight = detached->weight;
     }
 
-    size_type current_size;   ///< The number of the used nodes.
-    const size_type CAPACITY; ///< The maximum size of the map.
-    Node* root_node;          ///< The node that acts as the map root.
-    ETL_DECLARE_DEBUG_COUNT;
-  };
+    //*************************************************************************
+    /// Compares keys with the keys of nodes through function pointers.
+    /// The tree algorithms instantiated for it are shared by every map that
+    /// uses it, whatever its key type.
+    //*************************************************************************
+    class folded_node_compare
+    {
+    public:
 
-  //***************************************************************************
-  /// A templated base for all etl::map types.
-  ///\ingroup map
-  //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
-  class imap : public etl::map_base
-  {
-  public:
+      /// Returns <0, 0 or >0 as the key goes before, with or after the node's key.
+      typedef int (*compare_function)(const void* p_context, const void* p_key, const Node& node);
 
-    typedef TKey                           key_type;
-    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
-    typedef TMapped                        mapped_type;
-    typedef TKeyCompare                    key_compare;
-    typedef value_type&                    reference;
-    typedef const value_type&              const_reference;
-#if ETL_USING_CPP11
-    typedef value_type&&                   rvalue_reference;
-#endif
-    typedef value_type*                    pointer;
-    typedef const value_type*              const_pointer;
-    typedef size_t                         size_type;
+      /// Returns the address of the node's key.
+      typedef const void* (*key_function)(const Node& node);
 
-    /// Defines the parameter types
-    typedef const key_type&    const_key_reference;
-#if ETL_USING_CPP11
-    typedef key_type&&         rvalue_key_reference;
-#endif
-    typedef mapped_type&       mapped_reference;
-    typedef const mapped_type& const_mapped_reference;
+      folded_node_compare(compare_function p_compare_, key_function p_key_, const void* p_context_)
+        : p_compare(p_compare_)
+        , p_key(p_key_)
+        , p_context(p_context_)
+      {
+      }
 
-    class value_compare
-    {
-    public:
+      int operator()(const void* p_key_value, const Node& node) const
+      {
+        return p_compare(p_context, p_key_value, node);
+      }
 
-      bool operator()(const_reference lhs, const_reference rhs) const
+      const void* key(const Node& node) const
       {
-        return (kcompare(lhs.first, rhs.first));
+        return p_key(node);
       }
 
     private:
 
-      key_compare kcompare;
+      compare_function p_compare;
+      key_function     p_key;
+      const void*      p_context;
     };
 
-  protected:
+    //*************************************************************************
+    /// The tree algorithms below depend on the key only through the node
+    /// compare object. It returns <0, 0 or >0 as the key, passed by address,
+    /// goes before, with or after the key of a node, and its 'key' member
+    /// returns the address of a node's key.
+    //*************************************************************************
 
     //*************************************************************************
-    /// The data node element in the map.
+    /// Find the node matching the key provided
     //*************************************************************************
-    struct Data_Node : public Node
+    template <typename TNodeCompare>
+    Node* find_node(Node* position, const void* p_key, const TNodeCompare& node_compare) const
     {
-      explicit Data_Node(value_type value_)
-        : value(value_)
-      {
-      }
-
-      ~Data_Node()
+      Node* found = position;
+      while (found)
       {
+        // Compare the key to the current position value
+        const int compared = node_compare(p_key, *found);
 
+        if (compared < 0)
+        {
+          // Keep searching for the node on the left
+          found = found->children[kLeft];
+        }
+        else if (compared > 0)
+        {
+          // Keep searching for the node on the right
+          found = found->children[kRight];
+        }
+        else
+        {
+          // Node that matches the key provided was found, exit loop
+          break;
+        }
       }
 
-      value_type value;
-    };
+      // Return the node found (might be ETL_NULLPTR)
+      return found;
+    }
 
     //*************************************************************************
-    /// How to compare node elements.
+    /// Find the reference node matching the node provided
     //*************************************************************************
-    bool node_comp(const Data_Node& node1, const Data_Node& node2) const
+    template <typename TNodeCompare>
+    Node* find_node(Node* position, const Node* node, const TNodeCompare& node_compare) const
     {
-      return kcompare(node1.value.first, node2.value.first);
-    }
+      const void* p_key = node_compare.key(*node);
 
-    bool node_comp(const Data_Node& node, const_key_reference key) const
-    {
-      return kcompare(node.value.first, key);
-    }
+      Node* found = position;
+      while (found)
+      {
+        if (found->children[kLeft] == node)
+        {
+          return found->children[kLeft];
+        }
+        else if (found->children[kRight] == node)
+        {
+          return found->children[kRight];
+        }
+        else
+        {
+          // Compare the node value to the current position value
+          const int compared = node_compare(p_key, *found);
 
-    bool node_comp(const_key_reference key, const Data_Node& node) const
-    {
-      return kcompare(key, node.value.first);
-    }
+          if (compared < 0)
+          {
+            // Keep searching for the node on the left
+            found = found->children[kLeft];
+          }
+          else if (compared > 0)
+          {
+            // Keep searching for the node on the right
+            found = found->children[kRight];
+          }
+          else
+          {
+            // Return position provided (it matches the node)
+            return position;
+          }
+        }
+      }
 
-#if ETL_USING_CPP11
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    bool node_comp(const Data_Node& node, const K& key) const
-    {
-      return kcompare(node.value.first, key);
+      // Return root node if nothing was found
+      return root_node;
     }
 
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    bool node_comp(const K& key, const Data_Node& node) const
+    //*************************************************************************
+    /// Find the parent node that contains the node provided in its left or
+    /// right tree
+    //*************************************************************************
+    template <typename TNodeCompare>
+    const Node* find_parent_node(const Node* position, const Node* node, const TNodeCompare& node_compare) const
     {
-      return kcompare(key, node.value.first);
-    }
-#endif
+      // Default to no parent node found
+      const Node* found = ETL_NULLPTR;
 
-  private:
+      // If the position provided is the same as the node then there is no parent
+      if (position && node && position != node)
+      {
+        const void* p_key = node_compare.key(*node);
 
-    /// The pool of data nodes used in the map.
-    ipool* p_node_pool;
+        while (position)
+        {
+          // Is this position not the parent of the node we are looking for?
+          if (position->children[kLeft] != node &&
+            position->children[kRight] != node)
+          {
+            // Compare the node value to the current position value
+            const int compared = node_compare(p_key, *position);
 
-    key_compare   kcompare;
-    value_compare vcompare;
+            if (compared < 0)
+            {
+              // Keep looking for parent on the left
+              position = position->children[kLeft];
+            }
+            else if (compared > 0)
+            {
+              // Keep looking for parent on the right
+              position = position->children[kRight];
+            }
+          }
+          else
+          {
+            // Return the current position as the parent node found
+            found = position;
 
-    //*************************************************************************
-    /// Downcast a Node* to a Data_Node*
-    //*************************************************************************
-    static Data_Node* data_cast(Node* p_node)
-    {
-      return static_cast<Data_Node*>(p_node);
-    }
+            // Parent node found, exit loop
+            break;
+          }
+        }
+      }
 
-    //*************************************************************************
-    /// Downcast a Node& to a Data_Node&
-    //*************************************************************************
-    static Data_Node& data_cast(Node& node)
-    {
-      return static_cast<Data_Node&>(node);
+      // Return the parent node found (might be ETL_NULLPTR)
+      return found;
     }
 
     //*************************************************************************
-    /// Downcast a const Node* to a const Data_Node*
+    /// Find the node whose key is not considered to go before the key provided
     //*************************************************************************
-    static const Data_Node* data_cast(const Node* p_node)
+    template <typename TNodeCompare>
+    Node* find_lower_node(Node* position, const void* p_key, const TNodeCompare& node_compare) const
     {
-      return static_cast<const Data_Node*>(p_node);
-    }
+      // Something at this position? keep going
+      Node* lower_node = ETL_NULLPTR;
+      while (position)
+      {
+        // Compare the key value to the current lower node key value
+        const int compared = node_compare(p_key, *position);
 
-    //*************************************************************************
-    /// Downcast a const Node& to a const Data_Node&
-    //*************************************************************************
-    static const Data_Node& data_cast(const Node& node)
-    {
-      return static_cast<const Data_Node&>(node);
-    }
+        if (compared < 0)
+        {
+          lower_node = position;
+          if (position->children[kLeft])
+          {
+            position = position->children[kLeft];
+          }
+          else
+          {
+            // Found lowest node
+            break;
+          }
+        }
+        else if (compared > 0)
+        {
+          position = position->children[kRight];
+        }
+        else
+        {
+          // Make note of current position, but keep looking to left for more
+          lower_node = position;
+          position = position->children[kLeft];
+        }
+      }
 
-  public:
+      // Return the lower_node position found
+      return lower_node;
+    }
 
     //*************************************************************************
-    /// iterator.
+    /// Find the node whose key is considered to go after the key provided
     //*************************************************************************
-    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    template <typename TNodeCompare>
+    Node* find_upper_node(Node* position, const void* p_key, const TNodeCompare& node_compare) const
     {
-    public:
-
-      friend class imap;
-      friend class const_iterator;
-
-      iterator()
-        : p_map(ETL_NULLPTR)
-        , p_node(ETL_NULLPTR)
+      // Keep track of parent of last upper node
+      Node* upper_node = ETL_NULLPTR;
+      // Start with position provided
+      Node* node = position;
+      while (node)
       {
-      }
+        // Compare the key value to the current upper node key value
+        const int compared = node_compare(p_key, *node);
 
-      iterator(imap& map)
-        : p_map(&map)
-        , p_node(ETL_NULLPTR)
-      {
-      }
-
-      iterator(imap& map, Node* node)
-        : p_map(&map)
-        , p_node(node)
-      {
+        if (compared < 0)
+        {
+          upper_node = node;
+          node = node->children[kLeft];
+        }
+        else if (compared > 0)
+        {
+          node = node->children[kRight];
+        }
+        else if (node->children[kRight])
+        {
+          upper_node = find_limit_node(node->children[kRight], kLeft);
+          break;
+        }
+        else
+        {
+          break;
+        }
       }
 
-      iterator(const iterator& other)
-        : p_map(other.p_map)
-        , p_node(other.p_node)
-      {
-      }
+      // Return the upper node position found (might be ETL_NULLPTR)
+      return upper_node;
+    }
 
-      ~iterator()
-      {
-      }
+    //*************************************************************************
+    /// Insert a node.
+    /// Returns the node inserted, or the node with the same key if there was
+    /// one, in which case the node provided is not linked into the tree.
+    //*************************************************************************
+    template <typename TNodeCompare>
+    Node* insert_node(Node*& position, Node& node, const TNodeCompare& node_compare)
+    {
+      // Find the location where the node belongs
+      Node* found = position;
 
-      iterator& operator ++()
+      // Was position provided not empty? then find where the node belongs
+      if (position)
       {
-        p_map->next_node(p_node);
-        return *this;
-      }
+        const void* p_key = node_compare.key(node);
 
-      iterator operator ++(int)
-      {
-        iterator temp(*this);
-        p_map->next_node(p_node);
-        return temp;
-      }
+        // Find the critical parent node (default to ETL_NULLPTR)
+        Node* critical_parent_node = ETL_NULLPTR;
+        Node* critical_node = root_node;
 
-      iterator& operator --()
-      {
-        p_map->prev_node(p_node);
-        return *this;
-      }
+        while (found)
+        {
+          // Search for critical weight node (all nodes whose weight factor
+          // is set to kNeither (balanced)
+          if (kNeither != found->weight)
+          {
+            critical_node = found;
+          }
 
-      iterator operator --(int)
-      {
-        iterator temp(*this);
-        p_map->prev_node(p_node);
-        return temp;
-      }
+          const int compared = node_compare(p_key, *found);
 
-      iterator& operator =(const iterator& other)
-      {
-        p_map = other.p_map;
-        p_node = other.p_node;
-        return *this;
-      }
+          // Is the node provided to the left of the current position?
+          if (compared < 0)
+          {
+            // Update direction taken to insert new node in parent node
+            found->dir = kLeft;
+          }
+          // Is the node provided to the right of the current position?
+          else if (compared > 0)
+          {
+            // Update direction taken to insert new node in parent node
+            found->dir = kRight;
+          }
+          else
+          {
+            // Update direction taken to insert new node in parent node
+            found->dir = kNeither;
 
-      reference operator *() const
-      {
-        return imap::data_cast(p_node)->value;
-      }
+            // Clear critical node value to skip weight step below
+            critical_node = ETL_NULLPTR;
 
-      pointer operator &() const
-      {
-        return &(imap::data_cast(p_node)->value);
-      }
+            // Exit loop, duplicate node found
+            break;
+          }
 
-      pointer operator ->() const
-      {
-        return &(imap::data_cast(p_node)->value);
-      }
+          // Is there a child of this parent node?
+          if (found->children[found->dir])
+          {
+            // Will this node be the parent of the next critical node whose
+            // weight factor is set to kNeither (balanced)?
+            if (kNeither != found->children[found->dir]->weight)
+            {
+              critical_parent_node = found;
+            }
 
-      friend bool operator == (const iterator& lhs, const iterator& rhs)
-      {
-        return lhs.p_map == rhs.p_map && lhs.p_node == rhs.p_node;
-      }
+            // Keep looking for empty spot to insert new node
+            found = found->children[found->dir];
+          }
+          else
+          {
+            // Attach node to right
+            attach_node(found->children[found->dir], node);
 
-      friend bool operator != (const iterator& lhs, const iterator& rhs)
-      {
-        return !(lhs == rhs);
-      }
+            // Return newly added node
+            found = found->children[found->dir];
 
-    private:
+            // Exit loop
+            break;
+          }
+        }
 
-      // Pointer to map associated with this iterator
-      imap* p_map;
+        // Was a critical node found that should be checked for balance?
+        if (critical_node)
+        {
+          if (critical_parent_node == ETL_NULLPTR && critical_node == root_node)
+          {
+            balance_node(root_node);
+          }
+          else if (critical_parent_node == ETL_NULLPTR && critical_node == position)
+          {
+            balance_node(position);
+          }
+          else
+          {
+            if (critical_parent_node != ETL_NULLPTR)
+            {
+              balance_node(critical_parent_node->children[critical_parent_node->dir]);
+            }
+          }
+        }
+      }
+      else
+      {
+        // Attach node to current position
+        attach_node(position, node);
 
-      // Pointer to the current node for this iterator
-      Node* p_node;
-    };
+        // Return newly added node at current position
+        found = position;
+      }
 
-    friend class iterator;
+      // Return the node found (might be ETL_NULLPTR)
+      return found;
+    }
 
     //*************************************************************************
-    /// const_iterator
+    /// Find the next node in sequence from the node provided
     //*************************************************************************
-    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    template <typename TNodeCompare>
+    void next_node(const Node*& position, const TNodeCompare& node_compare) const
     {
-    public:
-
-      friend class imap;
-
-      const_iterator()
-        : p_map(ETL_NULLPTR)
-        , p_node(ETL_NULLPTR)
+      if (position)
       {
-      }
+        // Is there a tree on the right? then find the minimum of that tree
+        if (position->children[kRight])
+        {
+          // Return minimum node found
+          position = find_limit_node(position->children[kRight], kLeft);
+        }
+        // Otherwise find the parent of this node
+        else
+        {
+          // Start with current position as parent
+          const Node* parent = position;
+          do {
+            // Update current position as previous parent
+            position = parent;
+            // Find parent of current position
+            parent = find_parent_node(root_node, position, node_compare);
+            // Repeat while previous position was on right side of parent tree
+          } while (parent && parent->children[kRight] == position);
 
-      const_iterator(const imap& map)
-        : p_map(&map)
-        , p_node(ETL_NULLPTR)
-      {
+          // Set parent node as the next position
+          position = parent;
+        }
       }
+    }
 
-      const_iterator(const imap& map, const Node* node)
-        : p_map(&map)
-        , p_node(node)
+    //*************************************************************************
+    /// Find the previous node in sequence from the node provided
+    //*************************************************************************
+    template <typename TNodeCompare>
+    void prev_node(const Node*& position, const TNodeCompare& node_compare) const
+    {
+      // If starting at the terminal end, the previous node is the maximum node
+      // from the root
+      if (!position)
       {
+        position = find_limit_node(root_node, kRight);
       }
-
-      const_iterator(const typename imap::iterator& other)
-        : p_map(other.p_map)
-        , p_node(other.p_node)
+      else
+      {
+        // Is there a tree on the left? then find the maximum of that tree
+        if (position->children[kLeft])
+        {
+          // Return maximum node found
+          position = find_limit_node(position->children[kLeft], kRight);
+        }
+        // Otherwise find the parent of this node
+        else
+        {
+          // Start with current position as parent
+          const Node* parent = position;
+          do {
+            // Update current position as previous parent
+            position = parent;
+            // Find parent of current position
+            parent = find_parent_node(root_node, position, node_compare);
+            // Repeat while previous position was on left side of parent tree
+          } while (parent && parent->children[kLeft] == position);
+
+          // Set parent node as the next position
+          position = parent;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Unlink the node matching the key from somewhere starting at the
+    /// position provided. Returns the unlinked node (might be ETL_NULLPTR).
+    //*************************************************************************
+    template <typename TNodeCompare>
+    Node* remove_node(Node*& position, const void* p_key, const TNodeCompare& node_compare)
+    {
+      // Step 1: Find the target node that matches the key provided, the
+      // replacement node (might be the same as target node), and the critical
+      // node to start rebalancing the tree from (up to the replacement node)
+      Node* found_parent = ETL_NULLPTR;
+      Node* found = ETL_NULLPTR;
+      Node* replace_parent = ETL_NULLPTR;
+      Node* replace = position;
+      Node* balance_parent = ETL_NULLPTR;
+      Node* balance = root_node;
+      while (replace)
+      {
+        // Compare the key provided to the replace node key
+        const int compared = node_compare(p_key, *replace);
+
+        if (compared < 0)
+        {
+          // Update the direction to the target/replace node
+          replace->dir = kLeft;
+        }
+        else if (compared > 0)
+        {
+          // Update the direction to the target/replace node
+          replace->dir = kRight;
+        }
+        else
+        {
+          // Update the direction to the replace node (target node found here)
+          replace->dir = replace->children[kLeft] ? kLeft : kRight;
+
+          // Note the target node was found (and its parent)
+          found_parent = replace_parent;
+          found = replace;
+        }
+        // Replacement node found if its missing a child in the replace->dir
+        // value set above
+        if (replace->children[replace->dir] == ETL_NULLPTR)
+        {
+          // Exit loop once replace node is found (target might not have been)
+          break;
+        }
+
+        // If replacement node weight is kNeither or we are taking the shorter
+        // path of replacement node and our sibling (on longer path) is
+        // balanced then we need to update the balance node to match this
+        // replacement node but all our ancestors will not require rebalancing
+        if ((replace->weight == kNeither) ||
+          (replace->weight == (1 - replace->dir) &&
+            replace->children[1 - replace->dir]->weight == kNeither))
+        {
+          // Update balance node (and its parent) to replacement node
+          balance_parent = replace_parent;
+          balance = replace;
+        }
+
+        // Keep searching for the replacement node
+        replace_parent = replace;
+        replace = replace->children[replace->dir];
+      }
+
+      // If target node was found, proceed with rebalancing and replacement
+      if (found)
+      {
+        // Step 2: Update weights from critical node to replacement parent node
+        while (balance)
+        {
+          if (balance->children[balance->dir] == ETL_NULLPTR)
+          {
+            break;
+          }
+
+          if (balance->weight == kNeither)
+          {
+            balance->weight = 1 - balance->dir;
+          }
+          else if (balance->weight == balance->dir)
+          {
+            balance->weight = kNeither;
+          }
+          else
+          {
+            int weight = balance->children[1 - balance->dir]->weight;
+            // Perform a 3 node rotation if weight is same as balance->dir
+            if (weight == balance->dir)
+            {
+              // Is the root node being rebalanced (no parent)
+              if (balance_parent == ETL_NULLPTR)
+              {
+                rotate_3node(root_node, 1 - balance->dir,
+                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
+              }
+              else
+              {
+                rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
+                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
+              }
+            }
+            // Already balanced, rebalance and make it heavy in opposite
+            // direction of the node being removed
+            else if (weight == kNeither)
+            {
+              // Is the root node being rebalanced (no parent)
+              if (balance_parent == ETL_NULLPTR)
+              {
+                rotate_2node(root_node, 1 - balance->dir);
+                root_node->weight = balance->dir;
+              }
+              else
+              {
+                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
+                balance_parent->children[balance_parent->dir]->weight = balance->dir;
+              }
+              // Update balance node weight in opposite direction of node removed
+              balance->weight = 1 - balance->dir;
+            }
+            // Rebalance and leave it balanced
+            else
+            {
+              // Is the root node being rebalanced (no parent)
+              if (balance_parent == ETL_NULLPTR)
+              {
+                rotate_2node(root_node, 1 - balance->dir);
+              }
+              else
+              {
+                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
+              }
+            }
+
+            // Is balance node the same as the target node found? then update
+            // its parent after the rotation performed above
+            if (balance == found)
+            {
+              if (balance_parent)
+              {
+                found_parent = balance_parent->children[balance_parent->dir];
+                // Update dir since it is likely stale
+                found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
+              }
+              else
+              {
+                found_parent = root_node;
+                root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
+              }
+            }
+          }
+
+          // Next balance node to consider
+          balance_parent = balance;
+          balance = balance->children[balance->dir];
+        } // while(balance)
+
+          // Step 3: Swap found node with replacement node
+        if (found_parent)
+        {
+          // Handle traditional case
+          detach_node(found_parent->children[found_parent->dir],
+            replace_parent->children[replace_parent->dir]);
+        }
+        // Handle root node removal
+        else
+        {
+          // Valid replacement node for root node being removed?
+          if (replace_parent)
+          {
+            detach_node(root_node, replace_parent->children[replace_parent->dir]);
+          }
+          else
+          {
+            // Target node and replacement node are both root node
+            detach_node(root_node, root_node);
+          }
+        }
+
+        // One less.
+        --current_size;
+      } // if(found)
+
+        // Return node found (might be ETL_NULLPTR)
+      return found;
+    }
+
+    size_type current_size;   ///< The number of the used nodes.
+    const size_type CAPACITY; ///< The maximum size of the map.
+    Node* root_node;          ///< The node that acts as the map root.
+    ETL_DECLARE_DEBUG_COUNT;
+  };
+
+  //***************************************************************************
+  /// A templated base for all etl::map types.
+  ///\ingroup map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class imap : public etl::map_base
+  {
+  public:
+
+    typedef TKey                           key_type;
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TMapped                        mapped_type;
+    typedef TKeyCompare                    key_compare;
+    typedef value_type&                    reference;
+    typedef const value_type&              const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&                   rvalue_reference;
+#endif
+    typedef value_type*                    pointer;
+    typedef const value_type*              const_pointer;
+    typedef size_t                         size_type;
+
+    /// Defines the parameter types
+    typedef const key_type&    const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&         rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    class value_compare
+    {
+    public:
+
+      bool operator()(const_reference lhs, const_reference rhs) const
+      {
+        return (kcompare(lhs.first, rhs.first));
+      }
+
+    private:
+
+      key_compare kcompare;
+    };
+
+  protected:
+
+    //*************************************************************************
+    /// The data node element in the map.
+    //*************************************************************************
+    struct Data_Node : public Node
+    {
+      explicit Data_Node(value_type value_)
+        : value(value_)
+      {
+      }
+
+      ~Data_Node()
+      {
+
+      }
+
+      value_type value;
+    };
+
+    //*************************************************************************
+    /// How to compare node elements.
+    //*************************************************************************
+    bool node_comp(const Data_Node& node1, const Data_Node& node2) const
+    {
+      return kcompare(node1.value.first, node2.value.first);
+    }
+
+    bool node_comp(const Data_Node& node, const_key_reference key) const
+    {
+      return kcompare(node.value.first, key);
+    }
+
+    bool node_comp(const_key_reference key, const Data_Node& node) const
+    {
+      return kcompare(key, node.value.first);
+    }
+
+#if ETL_USING_CPP11
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool node_comp(const Data_Node& node, const K& key) const
+    {
+      return kcompare(node.value.first, key);
+    }
+
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool node_comp(const K& key, const Data_Node& node) const
+    {
+      return kcompare(key, node.value.first);
+    }
+#endif
+
+  private:
+
+    /// The pool of data nodes used in the map.
+    ipool* p_node_pool;
+
+    key_compare   kcompare;
+    value_compare vcompare;
+
+    //*************************************************************************
+    /// Downcast a Node* to a Data_Node*
+    //*************************************************************************
+    static Data_Node* data_cast(Node* p_node)
+    {
+      return static_cast<Data_Node*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Downcast a Node& to a Data_Node&
+    //*************************************************************************
+    static Data_Node& data_cast(Node& node)
+    {
+      return static_cast<Data_Node&>(node);
+    }
+
+    //*************************************************************************
+    /// Downcast a const Node* to a const Data_Node*
+    //*************************************************************************
+    static const Data_Node* data_cast(const Node* p_node)
+    {
+      return static_cast<const Data_Node*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Downcast a const Node& to a const Data_Node&
+    //*************************************************************************
+    static const Data_Node& data_cast(const Node& node)
+    {
+      return static_cast<const Data_Node&>(node);
+    }
+
+  public:
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class imap;
+      friend class const_iterator;
+
+      iterator()
+        : p_map(ETL_NULLPTR)
+        , p_node(ETL_NULLPTR)
+      {
+      }
+
+      iterator(imap& map)
+        : p_map(&map)
+        , p_node(ETL_NULLPTR)
+      {
+      }
+
+      iterator(imap& map, Node* node)
+        : p_map(&map)
+        , p_node(node)
+      {
+      }
+
+      iterator(const iterator& other)
+        : p_map(other.p_map)
+        , p_node(other.p_node)
+      {
+      }
+
+      ~iterator()
+      {
+      }
+
+      iterator& operator ++()
+      {
+        p_map->next_node(p_node);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        p_map->next_node(p_node);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        p_map->prev_node(p_node);
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        p_map->prev_node(p_node);
+        return temp;
+      }
+
+      iterator& operator =(const iterator& other)
+      {
+        p_map = other.p_map;
+        p_node = other.p_node;
+        return *this;
+      }
+
+      reference operator *() const
+      {
+        return imap::data_cast(p_node)->value;
+      }
+
+      pointer operator &() const
+      {
+        return &(imap::data_cast(p_node)->value);
+      }
+
+      pointer operator ->() const
+      {
+        return &(imap::data_cast(p_node)->value);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_map == rhs.p_map && lhs.p_node == rhs.p_node;
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      // Pointer to map associated with this iterator
+      imap* p_map;
+
+      // Pointer to the current node for this iterator
+      Node* p_node;
+    };
+
+    friend class iterator;
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class imap;
+
+      const_iterator()
+        : p_map(ETL_NULLPTR)
+        , p_node(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const imap& map)
+        : p_map(&map)
+        , p_node(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const imap& map, const Node* node)
+        : p_map(&map)
+        , p_node(node)
+      {
+      }
+
+      const_iterator(const typename imap::iterator& other)
+        : p_map(other.p_map)
+        , p_node(other.p_node)
       {
       }
 
@@ -796,1846 +1458,1222 @@ namespace etl
 
       friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
       {
-        return !(lhs == rhs);
-      }
-
-    private:
-
-      // Convert to an iterator.
-      imap::iterator to_iterator() const
-      {
-        return imap::iterator(const_cast<imap&>(*p_map), const_cast<Node*>(p_node));
-      }
-
-      // Pointer to map associated with this iterator
-      const imap* p_map;
-
-      // Pointer to the current node for this iterator
-      const Node* p_node;
-    };
-
-    friend class const_iterator;
-
-    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
-
-    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
-    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
-
-    //*************************************************************************
-    /// Gets the beginning of the map.
-    //*************************************************************************
-    iterator begin()
-    {
-      return iterator(*this, find_limit_node(root_node, kLeft));
-    }
-
-    //*************************************************************************
-    /// Gets the beginning of the map.
-    //*************************************************************************
-    const_iterator begin() const
-    {
-      return const_iterator(*this, find_limit_node(root_node, kLeft));
-    }
-
-    //*************************************************************************
-    /// Gets the end of the map.
-    //*************************************************************************
-    iterator end()
-    {
-      return iterator(*this);
-    }
-
-    //*************************************************************************
-    /// Gets the end of the map.
-    //*************************************************************************
-    const_iterator end() const
-    {
-      return const_iterator(*this);
-    }
-
-    //*************************************************************************
-    /// Gets the beginning of the map.
-    //*************************************************************************
-    const_iterator cbegin() const
-    {
-      return const_iterator(*this, find_limit_node(root_node, kLeft));
-    }
-
-    //*************************************************************************
-    /// Gets the end of the map.
-    //*************************************************************************
-    const_iterator cend() const
-    {
-      return const_iterator(*this);
-    }
-
-    //*************************************************************************
-    /// Gets the reverse beginning of the list.
-    //*************************************************************************
-    reverse_iterator rbegin()
-    {
-      return reverse_iterator(iterator(*this));
-    }
-
-    //*************************************************************************
-    /// Gets the reverse beginning of the list.
-    //*************************************************************************
-    const_reverse_iterator rbegin() const
-    {
-      return const_reverse_iterator(const_iterator(*this));
-    }
-
-    //*************************************************************************
-    /// Gets the reverse end of the list.
-    //*************************************************************************
-    reverse_iterator rend()
-    {
-      return reverse_iterator(iterator(*this, find_limit_node(root_node, kLeft)));
-    }
-
-    //*************************************************************************
-    /// Gets the reverse end of the list.
-    //*************************************************************************
-    const_reverse_iterator rend() const
-    {
-      return const_reverse_iterator(iterator(*this, find_limit_node(root_node, kLeft)));
-    }
-
-    //*************************************************************************
-    /// Gets the reverse beginning of the list.
-    //*************************************************************************
-    const_reverse_iterator crbegin() const
-    {
-      return const_reverse_iterator(const_iterator(*this));
-    }
-
-    //*************************************************************************
-    /// Gets the reverse end of the list.
-    //*************************************************************************
-    const_reverse_iterator crend() const
-    {
-      return const_reverse_iterator(const_iterator(*this, find_limit_node(root_node, kLeft)));
-    }
-
-#if ETL_USING_CPP11
-    //*********************************************************************
-    /// Returns a reference to the value at index 'key'
-    ///\param key The key.
-    ///\return A reference to the value at index 'key'
-    //*********************************************************************
-    mapped_reference operator [](rvalue_key_reference key)
-    {
-      iterator i_element = find(etl::move(key));
-
-      if (!i_element.p_node)
-      {
-        // Default to no inserted node
-        Node* inserted_node = ETL_NULLPTR;
-
-        ETL_ASSERT(!full(), ETL_ERROR(map_full));
-
-        // Get next available free node
-        Data_Node& node = allocate_data_node_with_key(etl::move(key));
-
-        // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
-        inserted_node = insert_node(root_node, node);
-
-        // Insert node into tree and return iterator to new node location in tree
-        i_element = iterator(*this, inserted_node);
-      }
-
-      return i_element->second;
-    }
-#endif
-
-    //*********************************************************************
-    /// Returns a reference to the value at index 'key'
-    ///\param key The key.
-    ///\return A reference to the value at index 'key'
-    //*********************************************************************
-    mapped_reference operator [](const_key_reference key)
-    {
-      iterator i_element = find(key);
-
-      if (!i_element.p_node)
-      {
-        // Default to no inserted node
-        Node* inserted_node = ETL_NULLPTR;
-
-        ETL_ASSERT(!full(), ETL_ERROR(map_full));
-
-        // Get next available free node
-        Data_Node& node = allocate_data_node_with_key(key);
-
-        // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
-        inserted_node = insert_node(root_node, node);
-
-        // Insert node into tree and return iterator to new node location in tree
-        i_element = iterator(*this, inserted_node);
-      }
-
-      return i_element->second;
-    }
-
-    //*********************************************************************
-    /// Returns a reference to the value at index 'key'
-    /// If asserts or exceptions are enabled, emits an etl::lookup_out_of_bounds if the key is not in the range.
-    ///\param key The key.
-    ///\return A reference to the value at index 'key'
-    //*********************************************************************
-    mapped_reference at(const_key_reference key)
-    {
-      iterator i_element = find(key);
-
-      ETL_ASSERT(i_element.p_node != ETL_NULLPTR, ETL_ERROR(map_out_of_bounds));
-
-      return i_element->second;
-    }
-
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    mapped_reference at(const K& key)
-    {
-      iterator i_element = find(key);
-
-      ETL_ASSERT(i_element.p_node != ETL_NULLPTR, ETL_ERROR(map_out_of_bounds));
-
-      return i_element->second;
-    }
-#endif
-
-    //*********************************************************************
-    /// Returns a const reference to the value at index 'key'
-    /// If asserts or exceptions are enabled, emits an etl::lookup_out_of_bounds if the key is not in the range.
-    ///\param key The key.
-    ///\return A const reference to the value at index 'key'
-    //*********************************************************************
-    const_mapped_reference at(const_key_reference key) const
-    {
-      const_iterator i_element = find(key);
+        return !(lhs == rhs);
+      }
 
-      ETL_ASSERT(i_element.p_node != ETL_NULLPTR, ETL_ERROR(map_out_of_bounds));
+    private:
 
-      return i_element->second;
-    }
+      // Convert to an iterator.
+      imap::iterator to_iterator() const
+      {
+        return imap::iterator(const_cast<imap&>(*p_map), const_cast<Node*>(p_node));
+      }
 
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    const_mapped_reference at(const K& key) const
-    {
-      const_iterator i_element = find(key);
+      // Pointer to map associated with this iterator
+      const imap* p_map;
 
-      ETL_ASSERT(i_element.p_node != ETL_NULLPTR, ETL_ERROR(map_out_of_bounds));
+      // Pointer to the current node for this iterator
+      const Node* p_node;
+    };
 
-      return i_element->second;
-    }
-#endif
+    friend class const_iterator;
 
-    //*********************************************************************
-    /// Assigns values to the map.
-    /// If asserts or exceptions are enabled, emits map_full if the map does not have enough free space.
-    /// If asserts or exceptions are enabled, emits map_iterator if the iterators are reversed.
-    ///\param first The iterator to the first element.
-    ///\param last  The iterator to the last element + 1.
-    //*********************************************************************
-    template <typename TIterator>
-    void assign(TIterator first, TIterator last)
-    {
-      initialise();
-      insert(first, last);
-    }
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
 
     //*************************************************************************
-    /// Clears the map.
+    /// Gets the beginning of the map.
     //*************************************************************************
-    void clear()
-    {
-      initialise();
-    }
-
-    //*********************************************************************
-    /// Counts the number of elements that contain the key specified.
-    ///\param key The key to search for.
-    ///\return 1 if element was found, 0 otherwise.
-    //*********************************************************************
-    size_type count(const_key_reference key) const
-    {
-      return find_node(root_node, key) ? 1 : 0;
-    }
-
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    size_type count(const K& key) const
+    iterator begin()
     {
-      return find_node(root_node, key) ? 1 : 0;
+      return iterator(*this, find_limit_node(root_node, kLeft));
     }
-#endif
 
     //*************************************************************************
-    /// Returns two iterators with bounding (lower bound, upper bound) the key
-    /// provided
+    /// Gets the beginning of the map.
     //*************************************************************************
-    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    const_iterator begin() const
     {
-      return ETL_OR_STD::make_pair<iterator, iterator>(iterator(*this, find_lower_node(root_node, key)),
-                                                       iterator(*this, find_upper_node(root_node, key)));
+      return const_iterator(*this, find_limit_node(root_node, kLeft));
     }
 
-#if ETL_USING_CPP11
     //*************************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    /// Gets the end of the map.
+    //*************************************************************************
+    iterator end()
     {
-      return ETL_OR_STD::make_pair<iterator, iterator>(iterator(*this, find_lower_node(root_node, key)),
-                                                       iterator(*this, find_upper_node(root_node, key)));
+      return iterator(*this);
     }
-#endif
 
     //*************************************************************************
-    /// Returns two const iterators with bounding (lower bound, upper bound)
-    /// the key provided.
+    /// Gets the end of the map.
     //*************************************************************************
-    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    const_iterator end() const
     {
-      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(const_iterator(*this, find_lower_node(root_node, key)),
-                                                                   const_iterator(*this, find_upper_node(root_node, key)));
+      return const_iterator(*this);
     }
 
-#if ETL_USING_CPP11
     //*************************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    /// Gets the beginning of the map.
+    //*************************************************************************
+    const_iterator cbegin() const
     {
-      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(const_iterator(*this, find_lower_node(root_node, key)),
-                                                                   const_iterator(*this, find_upper_node(root_node, key)));
+      return const_iterator(*this, find_limit_node(root_node, kLeft));
     }
-#endif
 
     //*************************************************************************
-    /// Erases the value at the specified position.
+    /// Gets the end of the map.
     //*************************************************************************
-    iterator erase(const_iterator position)
+    const_iterator cend() const
     {
-      // Find the parent node to be removed
-      Node*& reference_node = find_node(root_node, position.p_node);
-      iterator next(*this, reference_node);
-      ++next;
-
-      remove_node(root_node, (*position).first);
-
-      return next;
+      return const_iterator(*this);
     }
 
     //*************************************************************************
-    // Erase the key specified.
+    /// Gets the reverse beginning of the list.
     //*************************************************************************
-    size_type erase(const_key_reference key)
-    {
-      // Return 1 if key value was found and removed
-      return remove_node(root_node, key) ? 1 : 0;
-    }
-
-    //*********************************************************************
-#if ETL_USING_CPP11
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    size_type erase(K&& key)
+    reverse_iterator rbegin()
     {
-      // Return 1 if key value was found and removed
-      return remove_node(root_node, etl::forward<K>(key)) ? 1 : 0;
+      return reverse_iterator(iterator(*this));
     }
-#endif
 
     //*************************************************************************
-    /// Erases a range of elements.
+    /// Gets the reverse beginning of the list.
     //*************************************************************************
-    iterator erase(const_iterator first, const_iterator last)
-    {
-      while (first != last)
-      {
-        first = erase(first);
-      }
-
-      return last.to_iterator();
-    }
-
-    //*********************************************************************
-    /// Finds an element.
-    ///\param key The key to search for.
-    ///\return An iterator pointing to the element or end() if not found.
-    //*********************************************************************
-    iterator find(const_key_reference key)
-    {
-      return iterator(*this, find_node(root_node, key));
-    }
-
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    iterator find(const K& k)
-    {
-      return iterator(*this, find_node(root_node, k));
-    }
-#endif
-
-    //*********************************************************************
-    /// Finds an element.
-    ///\param key The key to search for.
-    ///\return An iterator pointing to the element or end() if not found.
-    //*********************************************************************
-    const_iterator find(const_key_reference key) const
-    {
-      return const_iterator(*this, find_node(root_node, key));
-    }
-
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    const_iterator find(const K& k) const
+    const_reverse_iterator rbegin() const
     {
-      return const_iterator(*this, find_node(root_node, k));
+      return const_reverse_iterator(const_iterator(*this));
     }
-#endif
 
-    //*********************************************************************
-    /// Inserts a value to the map.
-    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
-    ///\param value    The value to insert.
-    //*********************************************************************
-    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    reverse_iterator rend()
     {
-      // Default to no inserted node
-      Node* inserted_node = ETL_NULLPTR;
-      bool inserted = false;
-
-      ETL_ASSERT(!full(), ETL_ERROR(map_full));
-
-      // Get next available free node
-      Data_Node& node = allocate_data_node(value);
-
-      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
-      inserted_node = insert_node(root_node, node);
-      inserted = inserted_node == &node;
-
-      // Insert node into tree and return iterator to new node location in tree
-      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted);
+      return reverse_iterator(iterator(*this, find_limit_node(root_node, kLeft)));
     }
 
-#if ETL_USING_CPP11
-    //*********************************************************************
-    /// Inserts a value to the map.
-    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
-    ///\param value    The value to insert.
-    //*********************************************************************
-    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
     {
-      // Default to no inserted node
-      Node* inserted_node = ETL_NULLPTR;
-      bool inserted = false;
-
-      ETL_ASSERT(!full(), ETL_ERROR(map_full));
-
-      // Get next available free node
-      Data_Node& node = allocate_data_node(etl::move(value));
-
-      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
-      inserted_node = insert_node(root_node, node);
-      inserted = inserted_node == &node;
-
-      // Insert node into tree and return iterator to new node location in tree
-      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted);
+      return const_reverse_iterator(iterator(*this, find_limit_node(root_node, kLeft)));
     }
-#endif
-
-    //*********************************************************************
-    /// Inserts a value to the map starting at the position recommended.
-    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
-    ///\param position The position that would precede the value to insert.
-    ///\param value    The value to insert.
-    //*********************************************************************
-    iterator insert(const_iterator /*position*/, const_reference value)
-    {
-      // Default to no inserted node
-      Node* inserted_node = ETL_NULLPTR;
 
-      ETL_ASSERT(!full(), ETL_ERROR(map_full));
-
-      // Get next available free node
-      Data_Node& node = allocate_data_node(value);
-
-      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
-      inserted_node = insert_node(root_node, node);
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(const_iterator(*this));
+    }
 
-      // Insert node into tree and return iterator to new node location in tree
-      return iterator(*this, inserted_node);
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(const_iterator(*this, find_limit_node(root_node, kLeft)));
     }
 
 #if ETL_USING_CPP11
     //*********************************************************************
-    /// Inserts a value to the map starting at the position recommended.
-    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
-    ///\param position The position that would precede the value to insert.
-    ///\param value    The value to insert.
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
     //*********************************************************************
-    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    mapped_reference operator [](rvalue_key_reference key)
     {
-      // Default to no inserted node
-      Node* inserted_node = ETL_NULLPTR;
+      iterator i_element = find(etl::move(key));
 
-      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+      if (!i_element.p_node)
+      {
+        // Default to no inserted node
+        Node* inserted_node = ETL_NULLPTR;
 
-      // Get next available free node
-      Data_Node& node = allocate_data_node(etl::move(value));
+        ETL_ASSERT(!full(), ETL_ERROR(map_full));
 
-      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
-      inserted_node = insert_node(root_node, node);
+        // Get next available free node
+        Data_Node& node = allocate_data_node_with_key(etl::move(key));
 
-      // Insert node into tree and return iterator to new node location in tree
-      return iterator(*this, inserted_node);
+        // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
+        inserted_node = insert_node(root_node, node);
+
+        // Insert node into tree and return iterator to new node location in tree
+        i_element = iterator(*this, inserted_node);
+      }
+
+      return i_element->second;
     }
 #endif
 
     //*********************************************************************
-    /// Inserts a range of values to the map.
-    /// If asserts or exceptions are enabled, emits map_full if the map does not have enough free space.
-    ///\param position The position to insert at.
-    ///\param first    The first element to add.
-    ///\param last     The last + 1 element to add.
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
     //*********************************************************************
-    template <class TIterator>
-    void insert(TIterator first, TIterator last)
+    mapped_reference operator [](const_key_reference key)
     {
-      while (first != last)
+      iterator i_element = find(key);
+
+      if (!i_element.p_node)
       {
-        insert(*first);
-        ++first;
+        // Default to no inserted node
+        Node* inserted_node = ETL_NULLPTR;
+
+        ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+        // Get next available free node
+        Data_Node& node = allocate_data_node_with_key(key);
+
+        // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
+        inserted_node = insert_node(root_node, node);
+
+        // Insert node into tree and return iterator to new node location in tree
+        i_element = iterator(*this, inserted_node);
       }
+
+      return i_element->second;
     }
 
     //*********************************************************************
-    /// Returns an iterator pointing to the first element in the container
-    /// whose key is not considered to go before the key provided or end()
-    /// if all keys are considered to go before the key provided.
-    ///\return An iterator pointing to the element not before key or end()
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::lookup_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
     //*********************************************************************
-    iterator lower_bound(const_key_reference key)
+    mapped_reference at(const_key_reference key)
     {
-      return iterator(*this, find_lower_node(root_node, key));
+      iterator i_element = find(key);
+
+      ETL_ASSERT(i_element.p_node != ETL_NULLPTR, ETL_ERROR(map_out_of_bounds));
+
+      return i_element->second;
     }
 
 #if ETL_USING_CPP11
     //*********************************************************************
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    iterator lower_bound(const K& key)
+    mapped_reference at(const K& key)
     {
-      return iterator(*this, find_lower_node(root_node, key));
+      iterator i_element = find(key);
+
+      ETL_ASSERT(i_element.p_node != ETL_NULLPTR, ETL_ERROR(map_out_of_bounds));
+
+      return i_element->second;
     }
 #endif
 
     //*********************************************************************
-    /// Returns a const_iterator pointing to the first element in the
-    /// container whose key is not considered to go before the key provided
-    /// or end() if all keys are considered to go before the key provided.
-    ///\return An const_iterator pointing to the element not before key or end()
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::lookup_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
     //*********************************************************************
-    const_iterator lower_bound(const_key_reference key) const
+    const_mapped_reference at(const_key_reference key) const
     {
-      return const_iterator(*this, find_lower_node(root_node, key));
+      const_iterator i_element = find(key);
+
+      ETL_ASSERT(i_element.p_node != ETL_NULLPTR, ETL_ERROR(map_out_of_bounds));
+
+      return i_element->second;
     }
 
 #if ETL_USING_CPP11
     //*********************************************************************
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    const_iterator lower_bound(const K& key) const
+    const_mapped_reference at(const K& key) const
     {
-      return const_iterator(*this, find_lower_node(root_node, key));
+      const_iterator i_element = find(key);
+
+      ETL_ASSERT(i_element.p_node != ETL_NULLPTR, ETL_ERROR(map_out_of_bounds));
+
+      return i_element->second;
     }
 #endif
 
     //*********************************************************************
-    /// Returns an iterator pointing to the first element in the container
-    /// whose key is not considered to go after the key provided or end()
-    /// if all keys are considered to go after the key provided.
-    ///\return An iterator pointing to the element after key or end()
+    /// Assigns values to the map.
+    /// If asserts or exceptions are enabled, emits map_full if the map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
     //*********************************************************************
-    iterator upper_bound(const_key_reference key)
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
     {
-      return iterator(*this, find_upper_node(root_node, key));
+      initialise();
+      insert(first, last);
     }
 
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    iterator upper_bound(const K& key)
+    //*************************************************************************
+    /// Clears the map.
+    //*************************************************************************
+    void clear()
     {
-      return iterator(*this, find_upper_node(root_node, key));
+      initialise();
     }
-#endif
 
     //*********************************************************************
-    /// Returns a const_iterator pointing to the first element in the
-    /// container whose key is not considered to go after the key provided
-    /// or end() if all keys are considered to go after the key provided.
-    ///\return An const_iterator pointing to the element after key or end()
+    /// Counts the number of elements that contain the key specified.
+    ///\param key The key to search for.
+    ///\return 1 if element was found, 0 otherwise.
     //*********************************************************************
-    const_iterator upper_bound(const_key_reference key) const
+    size_type count(const_key_reference key) const
     {
-      return const_iterator(*this, find_upper_node(root_node, key));
+      return find_node(root_node, key) ? 1 : 0;
     }
 
 #if ETL_USING_CPP11
     //*********************************************************************
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    const_iterator upper_bound(const K& key) const
+    size_type count(const K& key) const
     {
-      return const_iterator(*this, find_upper_node(root_node, key));
+      return find_node(root_node, key) ? 1 : 0;
     }
 #endif
 
     //*************************************************************************
-    /// Assignment operator.
+    /// Returns two iterators with bounding (lower bound, upper bound) the key
+    /// provided
     //*************************************************************************
-    imap& operator = (const imap& rhs)
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
     {
-      // Skip if doing self assignment
-      if (this != &rhs)
-      {
-        assign(rhs.cbegin(), rhs.cend());
-      }
-
-      return *this;
+      return ETL_OR_STD::make_pair<iterator, iterator>(iterator(*this, find_lower_node(root_node, key)),
+                                                       iterator(*this, find_upper_node(root_node, key)));
     }
 
 #if ETL_USING_CPP11
     //*************************************************************************
-    /// Move assignment operator.
-    //*************************************************************************
-    imap& operator = (imap&& rhs)
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
     {
-      // Skip if doing self assignment
-      if (this != &rhs)
-      {
-        this->clear();
-
-        typename etl::imap<TKey, TMapped, TKeyCompare>::iterator from = rhs.begin();
-
-        while (from != rhs.end())
-        {
-          this->insert(etl::move(*from));
-          ++from;
-        }
-      }
-
-      return *this;
+      return ETL_OR_STD::make_pair<iterator, iterator>(iterator(*this, find_lower_node(root_node, key)),
+                                                       iterator(*this, find_upper_node(root_node, key)));
     }
 #endif
 
     //*************************************************************************
-    /// How to compare two key elements.
+    /// Returns two const iterators with bounding (lower bound, upper bound)
+    /// the key provided.
     //*************************************************************************
-    key_compare key_comp() const
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
     {
-      return kcompare;
+      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(const_iterator(*this, find_lower_node(root_node, key)),
+                                                                   const_iterator(*this, find_upper_node(root_node, key)));
     }
 
+#if ETL_USING_CPP11
     //*************************************************************************
-    /// How to compare two value elements.
-    //*************************************************************************
-    value_compare value_comp() const
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
     {
-      return vcompare;
+      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(const_iterator(*this, find_lower_node(root_node, key)),
+                                                                   const_iterator(*this, find_upper_node(root_node, key)));
     }
+#endif
 
     //*************************************************************************
-    /// Check if the map contains the key.
+    /// Erases the value at the specified position.
     //*************************************************************************
-    bool contains(const TKey& key) const
+    iterator erase(const_iterator position)
     {
-      return find(key) != end();
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
+      // Find the parent node to be removed
+      Node* reference_node = find_node(root_node, position.p_node);
+      iterator next(*this, reference_node);
+      ++next;
+
+      remove_node(root_node, (*position).first);
+
+      return next;
     }
 
-#if ETL_USING_CPP11
     //*************************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    bool contains(const K& k) const
+    // Erase the key specified.
+    //*************************************************************************
+    size_type erase(const_key_reference key)
     {
-      return find(k) != end();
-    }
-#endif
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
 
-  protected:
+      // Return 1 if key value was found and removed
+      return remove_node(root_node, key) ? 1 : 0;
+    }
 
-    //*************************************************************************
-    /// Constructor.
-    //*************************************************************************
-    imap(etl::ipool& node_pool, size_t max_size_)
-      : etl::map_base(max_size_)
-      , p_node_pool(&node_pool)
+    //*********************************************************************
+#if ETL_USING_CPP11
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type erase(K&& key)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
+      // Return 1 if key value was found and removed
+      return remove_node(root_node, etl::forward<K>(key)) ? 1 : 0;
     }
+#endif
 
     //*************************************************************************
-    /// Initialise the map.
+    /// Erases a range of elements.
     //*************************************************************************
-    void initialise()
+    iterator erase(const_iterator first, const_iterator last)
     {
-      const_iterator item = begin();
-
-      while (item != end())
+      while (first != last)
       {
-        item = erase(item);
+        first = erase(first);
       }
-    }
-
-  private:
 
-    //*************************************************************************
-    /// Allocate a Data_Node.
-    //*************************************************************************
-    Data_Node& allocate_data_node(const_reference value)
-    {
-      Data_Node* node = allocate_data_node();
-      ::new (&node->value) value_type(value);
-      ETL_INCREMENT_DEBUG_COUNT;
-      return *node;
+      return last.to_iterator();
     }
 
-    //*************************************************************************
-    /// Allocate a Data_Node with the supplied key.
-    //*************************************************************************
-    Data_Node& allocate_data_node_with_key(const_key_reference key)
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(const_key_reference key)
     {
-      Data_Node* node = allocate_data_node();
+      ETL_CONTAINER_STATISTICS_SCOPE(Find);
 
-      ::new ((void*)etl::addressof(node->value.first))  key_type(key);
-      ::new ((void*)etl::addressof(node->value.second)) mapped_type();
-      ETL_INCREMENT_DEBUG_COUNT;
-      return *node;
+      return iterator(*this, find_node(root_node, key));
     }
 
 #if ETL_USING_CPP11
-    //*************************************************************************
-    /// Allocate a Data_Node.
-    //*************************************************************************
-    Data_Node& allocate_data_node(rvalue_reference value)
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& k)
     {
-      Data_Node* node = allocate_data_node();
-      ::new (&node->value) value_type(etl::move(value));
-      ETL_INCREMENT_DEBUG_COUNT;
-      return *node;
+      ETL_CONTAINER_STATISTICS_SCOPE(Find);
+
+      return iterator(*this, find_node(root_node, k));
     }
+#endif
 
-    //*************************************************************************
-    /// Allocate a Data_Node with the supplied key.
-    //*************************************************************************
-    Data_Node& allocate_data_node_with_key(rvalue_key_reference key)
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
     {
-      Data_Node* node = allocate_data_node();
+      ETL_CONTAINER_STATISTICS_SCOPE(Find);
 
-      ::new ((void*)etl::addressof(node->value.first))  key_type(etl::move(key));
-      ::new ((void*)etl::addressof(node->value.second)) mapped_type();
-      ETL_INCREMENT_DEBUG_COUNT;
-      return *node;
+      return const_iterator(*this, find_node(root_node, key));
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& k) const
+    {
+      ETL_CONTAINER_STATISTICS_SCOPE(Find);
+
+      return const_iterator(*this, find_node(root_node, k));
+    }
 #endif
 
-    //*************************************************************************
-    /// Create a Data_Node.
-    //*************************************************************************
-    Data_Node* allocate_data_node()
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
     {
-      Data_Node* (etl::ipool::*func)() = &etl::ipool::allocate<Data_Node>;
-      return (p_node_pool->*func)();
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
+      // Default to no inserted node
+      Node* inserted_node = ETL_NULLPTR;
+      bool inserted = false;
+
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      // Get next available free node
+      Data_Node& node = allocate_data_node(value);
+
+      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
+      inserted_node = insert_node(root_node, node);
+      inserted = inserted_node == &node;
+
+      // Insert node into tree and return iterator to new node location in tree
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted);
     }
 
-    //*************************************************************************
-    /// Destroy a Data_Node.
-    //*************************************************************************
-    void destroy_data_node(Data_Node& node)
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
     {
-      node.value.~value_type();
-      p_node_pool->release(&node);
-      ETL_DECREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
+      // Default to no inserted node
+      Node* inserted_node = ETL_NULLPTR;
+      bool inserted = false;
+
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      // Get next available free node
+      Data_Node& node = allocate_data_node(etl::move(value));
+
+      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
+      inserted_node = insert_node(root_node, node);
+      inserted = inserted_node == &node;
+
+      // Insert node into tree and return iterator to new node location in tree
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted);
     }
+#endif
 
-    //*************************************************************************
-    /// Find the value matching the node provided
-    //*************************************************************************
-    Node* find_node(Node* position, const_key_reference key)
+    //*********************************************************************
+    /// Inserts a value to the map starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
     {
-      Node* found = position;
-      while (found)
-      {
-        // Downcast found to Data_Node class for comparison and other operations
-        Data_Node& found_data_node = imap::data_cast(*found);
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
 
-        // Compare the node value to the current position value
-        if (node_comp(key, found_data_node))
-        {
-          // Keep searching for the node on the left
-          found = found->children[kLeft];
-        }
-        else if (node_comp(found_data_node, key))
-        {
-          // Keep searching for the node on the right
-          found = found->children[kRight];
-        }
-        else
-        {
-          // Node that matches the key provided was found, exit loop
-          break;
-        }
-      }
+      // Default to no inserted node
+      Node* inserted_node = ETL_NULLPTR;
 
-      // Return the node found (might be ETL_NULLPTR)
-      return found;
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      // Get next available free node
+      Data_Node& node = allocate_data_node(value);
+
+      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
+      inserted_node = insert_node(root_node, node);
+
+      // Insert node into tree and return iterator to new node location in tree
+      return iterator(*this, inserted_node);
     }
 
 #if ETL_USING_CPP11
     //*********************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    Node* find_node(Node* position, const K& key)
+    /// Inserts a value to the map starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
     {
-      Node* found = position;
-      while (found)
-      {
-        // Downcast found to Data_Node class for comparison and other operations
-        Data_Node& found_data_node = imap::data_cast(*found);
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
 
-        // Compare the node value to the current position value
-        if (node_comp(key, found_data_node))
-        {
-          // Keep searching for the node on the left
-          found = found->children[kLeft];
-        }
-        else if (node_comp(found_data_node, key))
-        {
-          // Keep searching for the node on the right
-          found = found->children[kRight];
-        }
-        else
-        {
-          // Node that matches the key provided was found, exit loop
-          break;
-        }
-      }
+      // Default to no inserted node
+      Node* inserted_node = ETL_NULLPTR;
 
-      // Return the node found (might be ETL_NULLPTR)
-      return found;
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      // Get next available free node
+      Data_Node& node = allocate_data_node(etl::move(value));
+
+      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
+      inserted_node = insert_node(root_node, node);
+
+      // Insert node into tree and return iterator to new node location in tree
+      return iterator(*this, inserted_node);
     }
 #endif
 
-    //*************************************************************************
-    /// Find the value matching the node provided
-    //*************************************************************************
-    const Node* find_node(const Node* position, const_key_reference key) const
+    //*********************************************************************
+    /// Inserts a range of values to the map.
+    /// If asserts or exceptions are enabled, emits map_full if the map does not have enough free space.
+    ///\param position The position to insert at.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
     {
-      const Node* found = position;
-      while (found)
+      while (first != last)
       {
-        // Downcast found to Data_Node class for comparison and other operations
-        const Data_Node& found_data_node = imap::data_cast(*found);
-
-        // Compare the node value to the current position value
-        if (node_comp(key, found_data_node))
-        {
-          // Keep searching for the node on the left
-          found = found->children[kLeft];
-        }
-        else if (node_comp(found_data_node, key))
-        {
-          // Keep searching for the node on the right
-          found = found->children[kRight];
-        }
-        else
-        {
-          // Node that matches the key provided was found, exit loop
-          break;
-        }
+        insert(*first);
+        ++first;
       }
+    }
 
-      // Return the node found (might be ETL_NULLPTR)
-      return found;
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go before the key provided or end()
+    /// if all keys are considered to go before the key provided.
+    ///\return An iterator pointing to the element not before key or end()
+    //*********************************************************************
+    iterator lower_bound(const_key_reference key)
+    {
+      return iterator(*this, find_lower_node(root_node, key));
     }
 
 #if ETL_USING_CPP11
     //*********************************************************************
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    const Node* find_node(const Node* position, const K& key) const
+    iterator lower_bound(const K& key)
     {
-      const Node* found = position;
-      while (found)
-      {
-        // Downcast found to Data_Node class for comparison and other operations
-        const Data_Node& found_data_node = imap::data_cast(*found);
-
-        // Compare the node value to the current position value
-        if (node_comp(key, found_data_node))
-        {
-          // Keep searching for the node on the left
-          found = found->children[kLeft];
-        }
-        else if (node_comp(found_data_node, key))
-        {
-          // Keep searching for the node on the right
-          found = found->children[kRight];
-        }
-        else
-        {
-          // Node that matches the key provided was found, exit loop
-          break;
-        }
-      }
-
-      // Return the node found (might be ETL_NULLPTR)
-      return found;
+      return iterator(*this, find_lower_node(root_node, key));
     }
 #endif
 
-    //*************************************************************************
-    /// Find the reference node matching the node provided
-    //*************************************************************************
-    Node*& find_node(Node*& position, const Node* node)
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go before the key provided
+    /// or end() if all keys are considered to go before the key provided.
+    ///\return An const_iterator pointing to the element not before key or end()
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
     {
-      Node* found = position;
-      while (found)
-      {
-        if (found->children[kLeft] == node)
-        {
-          return found->children[kLeft];
-        }
-        else if (found->children[kRight] == node)
-        {
-          return found->children[kRight];
-        }
-        else
-        {
-          // Downcast found to Data_Node class for comparison and other operations
-          Data_Node& found_data_node = imap::data_cast(*found);
-          const Data_Node& data_node = imap::data_cast(*node);
-
-          // Compare the node value to the current position value
-          if (node_comp(data_node, found_data_node))
-          {
-            // Keep searching for the node on the left
-            found = found->children[kLeft];
-          }
-          else if (node_comp(found_data_node, data_node))
-          {
-            // Keep searching for the node on the right
-            found = found->children[kRight];
-          }
-          else
-          {
-            // Return position provided (it matches the node)
-            return position;
-          }
-        }
-      }
-
-      // Return root node if nothing was found
-      return root_node;
+      return const_iterator(*this, find_lower_node(root_node, key));
     }
 
-    //*************************************************************************
-    /// Find the parent node that contains the node provided in its left or
-    /// right tree
-    //*************************************************************************
-    Node* find_parent_node(Node* position, const Node* node)
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
     {
-      // Default to no parent node found
-      Node* found = ETL_NULLPTR;
-
-      // If the position provided is the same as the node then there is no parent
-      if (position && node && position != node)
-      {
-        while (position)
-        {
-          // Is this position not the parent of the node we are looking for?
-          if (position->children[kLeft] != node &&
-            position->children[kRight] != node)
-          {
-            // Downcast node and position to Data_Node references for key comparisons
-            const Data_Node& node_data_node = imap::data_cast(*node);
-            Data_Node& position_data_node = imap::data_cast(*position);
-            // Compare the node value to the current position value
-            if (node_comp(node_data_node, position_data_node))
-            {
-              // Keep looking for parent on the left
-              position = position->children[kLeft];
-            }
-            else if (node_comp(position_data_node, node_data_node))
-            {
-              // Keep looking for parent on the right
-              position = position->children[kRight];
-            }
-          }
-          else
-          {
-            // Return the current position as the parent node found
-            found = position;
-
-            // Parent node found, exit loop
-            break;
-          }
-        }
-      }
-
-      // Return the parent node found (might be ETL_NULLPTR)
-      return found;
+      return const_iterator(*this, find_lower_node(root_node, key));
     }
+#endif
 
-    //*************************************************************************
-    /// Find the parent node that contains the node provided in its left or
-    /// right tree
-    //*************************************************************************
-    const Node* find_parent_node(const Node* position, const Node* node) const
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go after the key provided or end()
+    /// if all keys are considered to go after the key provided.
+    ///\return An iterator pointing to the element after key or end()
+    //*********************************************************************
+    iterator upper_bound(const_key_reference key)
     {
-      // Default to no parent node found
-      const Node* found = ETL_NULLPTR;
-
-      // If the position provided is the same as the node then there is no parent
-      if (position && node && position != node)
-      {
-        while (position)
-        {
-          // Is this position not the parent of the node we are looking for?
-          if (position->children[kLeft] != node &&
-            position->children[kRight] != node)
-          {
-            // Downcast node and position to Data_Node references for key comparisons
-            const Data_Node& node_data_node = imap::data_cast(*node);
-            const Data_Node& position_data_node = imap::data_cast(*position);
-            // Compare the node value to the current position value
-            if (node_comp(node_data_node, position_data_node))
-            {
-              // Keep looking for parent on the left
-              position = position->children[kLeft];
-            }
-            else if (node_comp(position_data_node, node_data_node))
-            {
-              // Keep looking for parent on the right
-              position = position->children[kRight];
-            }
-          }
-          else
-          {
-            // Return the current position as the parent node found
-            found = position;
-
-            // Parent node found, exit loop
-            break;
-          }
-        }
-      }
-
-      // Return the parent node found (might be ETL_NULLPTR)
-      return found;
+      return iterator(*this, find_upper_node(root_node, key));
     }
 
-    //*************************************************************************
-    /// Find the node whose key is not considered to go before the key provided
-    //*************************************************************************
-    Node* find_lower_node(Node* position, const_key_reference key) const
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
     {
-      // Something at this position? keep going
-      Node* lower_node = ETL_NULLPTR;
-      while (position)
-      {
-        // Downcast lower node to Data_Node reference for key comparisons
-        Data_Node& data_node = imap::data_cast(*position);
-        // Compare the key value to the current lower node key value
-        if (node_comp(key, data_node))
-        {
-          lower_node = position;
-          if (position->children[kLeft])
-          {
-            position = position->children[kLeft];
-          }
-          else
-          {
-            // Found lowest node
-            break;
-          }
-        }
-        else if (node_comp(data_node, key))
-        {
-          position = position->children[kRight];
-        }
-        else
-        {
-          // Make note of current position, but keep looking to left for more
-          lower_node = position;
-          position = position->children[kLeft];
-        }
-      }
+      return iterator(*this, find_upper_node(root_node, key));
+    }
+#endif
 
-      // Return the lower_node position found
-      return lower_node;
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go after the key provided
+    /// or end() if all keys are considered to go after the key provided.
+    ///\return An const_iterator pointing to the element after key or end()
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return const_iterator(*this, find_upper_node(root_node, key));
     }
 
 #if ETL_USING_CPP11
-    //*************************************************************************
+    //*********************************************************************
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    Node* find_lower_node(Node* position, const K& key) const
+    const_iterator upper_bound(const K& key) const
     {
-      // Something at this position? keep going
-      Node* lower_node = ETL_NULLPTR;
-      while (position)
-      {
-        // Downcast lower node to Data_Node reference for key comparisons
-        Data_Node& data_node = imap::data_cast(*position);
-        // Compare the key value to the current lower node key value
-        if (node_comp(key, data_node))
-        {
-          lower_node = position;
-          if (position->children[kLeft])
-          {
-            position = position->children[kLeft];
-          }
-          else
-          {
-            // Found lowest node
-            break;
-          }
-        }
-        else if (node_comp(data_node, key))
-        {
-          position = position->children[kRight];
-        }
-        else
-        {
-          // Make note of current position, but keep looking to left for more
-          lower_node = position;
-          position = position->children[kLeft];
-        }
-      }
-
-      // Return the lower_node position found
-      return lower_node;
+      return const_iterator(*this, find_upper_node(root_node, key));
     }
 #endif
 
     //*************************************************************************
-    /// Find the node whose key is considered to go after the key provided
+    /// Assignment operator.
     //*************************************************************************
-    Node* find_upper_node(Node* position, const_key_reference key) const
+    imap& operator = (const imap& rhs)
     {
-      // Keep track of parent of last upper node
-      Node* upper_node = ETL_NULLPTR;
-      // Start with position provided
-      Node* node = position;
-      while (node)
+      // Skip if doing self assignment
+      if (this != &rhs)
       {
-        // Downcast position to Data_Node reference for key comparisons
-        Data_Node& data_node = imap::data_cast(*node);
-        // Compare the key value to the current upper node key value
-        if (node_comp(key, data_node))
-        {
-          upper_node = node;
-          node = node->children[kLeft];
-        }
-        else if (node_comp(data_node, key))
-        {
-          node = node->children[kRight];
-        }
-        else if (node->children[kRight])
-        {
-          upper_node = find_limit_node(node->children[kRight], kLeft);
-          break;
-        }
-        else
-        {
-          break;
-        }
+        assign(rhs.cbegin(), rhs.cend());
       }
 
-      // Return the upper node position found (might be ETL_NULLPTR)
-      return upper_node;
+      return *this;
     }
 
 #if ETL_USING_CPP11
     //*************************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    Node* find_upper_node(Node* position, const K& key) const
+    /// Move assignment operator.
+    //*************************************************************************
+    imap& operator = (imap&& rhs)
     {
-      // Keep track of parent of last upper node
-      Node* upper_node = ETL_NULLPTR;
-      // Start with position provided
-      Node* node = position;
-      while (node)
+      // Skip if doing self assignment
+      if (this != &rhs)
       {
-        // Downcast position to Data_Node reference for key comparisons
-        Data_Node& data_node = imap::data_cast(*node);
-        // Compare the key value to the current upper node key value
-        if (node_comp(key, data_node))
-        {
-          upper_node = node;
-          node = node->children[kLeft];
-        }
-        else if (node_comp(data_node, key))
-        {
-          node = node->children[kRight];
-        }
-        else if (node->children[kRight])
-        {
-          upper_node = find_limit_node(node->children[kRight], kLeft);
-          break;
-        }
-        else
+        this->clear();
+
+        typename etl::imap<TKey, TMapped, TKeyCompare>::iterator from = rhs.begin();
+
+        while (from != rhs.end())
         {
-          break;
+          this->insert(etl::move(*from));
+          ++from;
         }
       }
 
-      // Return the upper node position found (might be ETL_NULLPTR)
-      return upper_node;
+      return *this;
     }
 #endif
 
     //*************************************************************************
-    /// Insert a node.
+    /// Checks to see if the map is full.
+    /// The nodes come from the pool, which may be shared with other maps.
     //*************************************************************************
-    Node* insert_node(Node*& position, Data_Node& node)
+    bool full() const
     {
-      // Find the location where the node belongs
-      Node* found = position;
-
-      // Was position provided not empty? then find where the node belongs
-      if (position)
-      {
-        // Find the critical parent node (default to ETL_NULLPTR)
-        Node* critical_parent_node = ETL_NULLPTR;
-        Node* critical_node = root_node;
-
-        while (found)
-        {
-          // Search for critical weight node (all nodes whose weight factor
-          // is set to kNeither (balanced)
-          if (kNeither != found->weight)
-          {
-            critical_node = found;
-          }
-
-          // Downcast found to Data_Node class for comparison and other operations
-          Data_Node& found_data_node = imap::data_cast(*found);
-
-          // Is the node provided to the left of the current position?
-          if (node_comp(node, found_data_node))
-          {
-            // Update direction taken to insert new node in parent node
-            found->dir = kLeft;
-          }
-          // Is the node provided to the right of the current position?
-          else if (node_comp(found_data_node, node))
-          {
-            // Update direction taken to insert new node in parent node
-            found->dir = kRight;
-          }
-          else
-          {
-            // Update direction taken to insert new node in parent node
-            found->dir = kNeither;
+      return p_node_pool->full();
+    }
 
-            // Clear critical node value to skip weight step below
-            critical_node = ETL_NULLPTR;
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    /// The nodes come from the pool, which may be shared with other maps.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return p_node_pool->available();
+    }
 
-            // Destroy the node provided (its a duplicate)
-            destroy_data_node(node);
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return kcompare;
+    }
 
-            // Exit loop, duplicate node found
-            break;
-          }
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return vcompare;
+    }
 
-          // Is there a child of this parent node?
-          if (found->children[found->dir])
-          {
-            // Will this node be the parent of the next critical node whose
-            // weight factor is set to kNeither (balanced)?
-            if (kNeither != found->children[found->dir]->weight)
-            {
-              critical_parent_node = found;
-            }
+    //*********************************************************************
+    /// Finds each key of an ascending range.
+    /// Each search starts where the previous one ended, so a batch of K keys
+    /// visits fewer nodes than K calls to find().
+    ///\param first The first key. The keys must be ascending by key_comp().
+    ///\param last  One past the last key.
+    ///\param out   Receives an iterator for each key, or end() if not found.
+    ///\return One past the last iterator written.
+    //*********************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator find_sorted(TInputIterator first, TInputIterator last, TOutputIterator out)
+    {
+      sorted_search search(root_node);
 
-            // Keep looking for empty spot to insert new node
-            found = found->children[found->dir];
-          }
-          else
-          {
-            // Attach node to right
-            attach_node(found->children[found->dir], node);
+      while (first != last)
+      {
+        *out = iterator(*this, const_cast<Node*>(find_next_sorted_node(search, *first)));
+        ++out;
+        ++first;
+      }
 
-            // Return newly added node
-            found = found->children[found->dir];
+      return out;
+    }
 
-            // Exit loop
-            break;
-          }
-        }
+    //*********************************************************************
+    /// Finds each key of an ascending range.
+    ///\param first The first key. The keys must be ascending by key_comp().
+    ///\param last  One past the last key.
+    ///\param out   Receives a const_iterator for each key, or end() if not found.
+    ///\return One past the last iterator written.
+    //*********************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator find_sorted(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+      sorted_search search(root_node);
 
-        // Was a critical node found that should be checked for balance?
-        if (critical_node)
-        {
-          if (critical_parent_node == ETL_NULLPTR && critical_node == root_node)
-          {
-            balance_node(root_node);
-          }
-          else if (critical_parent_node == ETL_NULLPTR && critical_node == position)
-          {
-            balance_node(position);
-          }
-          else
-          {
-            if (critical_parent_node != ETL_NULLPTR)
-            {
-              balance_node(critical_parent_node->children[critical_parent_node->dir]);
-            }
-          }
-        }
-      }
-      else
+      while (first != last)
       {
-        // Attach node to current position
-        attach_node(position, node);
-
-        // Return newly added node at current position
-        found = position;
+        *out = const_iterator(*this, find_next_sorted_node(search, *first));
+        ++out;
+        ++first;
       }
 
-      // Return the node found (might be ETL_NULLPTR)
-      return found;
+      return out;
     }
 
-    //*************************************************************************
-    /// Find the next node in sequence from the node provided
-    //*************************************************************************
-    void next_node(Node*&position)
+    //*********************************************************************
+    /// Copies the elements whose keys are in an ascending range, in order.
+    ///\param first The first key. The keys must be ascending by key_comp().
+    ///\param last  One past the last key.
+    ///\param out   Receives the elements found.
+    ///\return One past the last element written.
+    //*********************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator intersect_sorted(TInputIterator first, TInputIterator last, TOutputIterator out) const
     {
-      if (position)
+      sorted_search search(root_node);
+
+      while (first != last)
       {
-        // Is there a tree on the right? then find the minimum of that tree
-        if (position->children[kRight])
+        const Node* p_node = find_next_sorted_node(search, *first);
+
+        if (p_node != ETL_NULLPTR)
         {
-          // Return minimum node found
-          position = find_limit_node(position->children[kRight], kLeft);
+          *out = imap::data_cast(p_node)->value;
+          ++out;
         }
-        // Otherwise find the parent of this node
-        else
-        {
-          // Start with current position as parent
-          Node* parent = position;
-          do {
-            // Update current position as previous parent
-            position = parent;
-            // Find parent of current position
-            parent = find_parent_node(root_node, position);
-            // Repeat while previous position was on right side of parent tree
-          } while (parent && parent->children[kRight] == position);
 
-          // Set parent node as the next position
-          position = parent;
-        }
+        ++first;
       }
+
+      return out;
     }
 
-    //*************************************************************************
-    /// Find the next node in sequence from the node provided
-    //*************************************************************************
-    void next_node(const Node*& position) const
+    //*********************************************************************
+    /// Copies the keys of an ascending range that are not in the map.
+    ///\param first The first key. The keys must be ascending by key_comp().
+    ///\param last  One past the last key.
+    ///\param out   Receives the keys not found.
+    ///\return One past the last key written.
+    //*********************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator difference_sorted(TInputIterator first, TInputIterator last, TOutputIterator out) const
     {
-      if (position)
+      sorted_search search(root_node);
+
+      while (first != last)
       {
-        // Is there a tree on the right? then find the minimum of that tree
-        if (position->children[kRight])
+        if (find_next_sorted_node(search, *first) == ETL_NULLPTR)
         {
-          // Return minimum node found
-          position = find_limit_node(position->children[kRight], kLeft);
+          *out = *first;
+          ++out;
         }
-        // Otherwise find the parent of this node
-        else
-        {
-          // Start with current position as parent
-          const Node* parent = position;
-          do {
-            // Update current position as previous parent
-            position = parent;
-            // Find parent of current position
-            parent = find_parent_node(root_node, position);
-            // Repeat while previous position was on right side of parent tree
-          } while (parent && parent->children[kRight] == position);
 
-          // Set parent node as the next position
-          position = parent;
-        }
+        ++first;
       }
+
+      return out;
     }
 
-    //*************************************************************************
-    /// Find the previous node in sequence from the node provided
-    //*************************************************************************
-    void prev_node(Node*&position)
+    //*********************************************************************
+    /// Counts the keys of an ascending range that are in the map.
+    ///\param first The first key. The keys must be ascending by key_comp().
+    ///\param last  One past the last key.
+    //*********************************************************************
+    template <typename TInputIterator>
+    size_type count_sorted(TInputIterator first, TInputIterator last) const
     {
-      // If starting at the terminal end, the previous node is the maximum node
-      // from the root
-      if (!position)
-      {
-        position = find_limit_node(root_node, kRight);
-      }
-      else
+      sorted_search search(root_node);
+      size_type     n = 0U;
+
+      while (first != last)
       {
-        // Is there a tree on the left? then find the maximum of that tree
-        if (position->children[kLeft])
+        if (find_next_sorted_node(search, *first) != ETL_NULLPTR)
         {
-          // Return maximum node found
-          position = find_limit_node(position->children[kLeft], kRight);
+          ++n;
         }
-        // Otherwise find the parent of this node
-        else
-        {
-          // Start with current position as parent
-          Node* parent = position;
-          do {
-            // Update current position as previous parent
-            position = parent;
-            // Find parent of current position
-            parent = find_parent_node(root_node, position);
-            // Repeat while previous position was on left side of parent tree
-          } while (parent && parent->children[kLeft] == position);
 
-          // Set parent node as the next position
-          position = parent;
-        }
+        ++first;
       }
+
+      return n;
     }
 
     //*************************************************************************
-    /// Find the previous node in sequence from the node provided
+    /// Check if the map contains the key.
     //*************************************************************************
-    void prev_node(const Node*& position) const
+    bool contains(const TKey& key) const
     {
-      // If starting at the terminal end, the previous node is the maximum node
-      // from the root
-      if (!position)
-      {
-        position = find_limit_node(root_node, kRight);
-      }
-      else
-      {
-        // Is there a tree on the left? then find the maximum of that tree
-        if (position->children[kLeft])
-        {
-          // Return maximum node found
-          position = find_limit_node(position->children[kLeft], kRight);
-        }
-        // Otherwise find the parent of this node
-        else
-        {
-          // Start with current position as parent
-          const Node* parent = position;
-          do {
-            // Update current position as previous parent
-            position = parent;
-            // Find parent of current position
-            parent = find_parent_node(root_node, position);
-            // Repeat while previous position was on left side of parent tree
-          } while (parent && parent->children[kLeft] == position);
+      return find(key) != end();
+    }
 
-          // Set parent node as the next position
-          position = parent;
-        }
-      }
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& k) const
+    {
+      return find(k) != end();
     }
+#endif
 
+#if ETL_HAS_CONTAINER_STATISTICS
     //*************************************************************************
-    /// Remove the node specified from somewhere starting at the position
-    /// provided
+    /// Gets the operation statistics.
     //*************************************************************************
-    Node* remove_node(Node*& position, const_key_reference key)
+    etl::container_statistics& get_statistics()
     {
-      // Step 1: Find the target node that matches the key provided, the
-      // replacement node (might be the same as target node), and the critical
-      // node to start rebalancing the tree from (up to the replacement node)
-      Node* found_parent = ETL_NULLPTR;
-      Node* found = ETL_NULLPTR;
-      Node* replace_parent = ETL_NULLPTR;
-      Node* replace = position;
-      Node* balance_parent = ETL_NULLPTR;
-      Node* balance = root_node;
-      while (replace)
-      {
-        // Downcast found to Data_Node class for comparison and other operations
-        Data_Node& replace_data_node = imap::data_cast(*replace);
+      return statistics;
+    }
 
-        // Compare the key provided to the replace data node key
-        if (node_comp(key, replace_data_node))
-        {
-          // Update the direction to the target/replace node
-          replace->dir = kLeft;
-        }
-        else if (node_comp(replace_data_node, key))
-        {
-          // Update the direction to the target/replace node
-          replace->dir = kRight;
-        }
-        else
-        {
-          // Update the direction to the replace node (target node found here)
-          replace->dir = replace->children[kLeft] ? kLeft : kRight;
+    //*************************************************************************
+    /// Gets the operation statistics.
+    //*************************************************************************
+    const etl::container_statistics& get_statistics() const
+    {
+      return statistics;
+    }
+#endif
 
-          // Note the target node was found (and its parent)
-          found_parent = replace_parent;
-          found = replace;
-        }
-        // Replacement node found if its missing a child in the replace->dir
-        // value set above
-        if (replace->children[replace->dir] == ETL_NULLPTR)
-        {
-          // Exit loop once replace node is found (target might not have been)
-          break;
-        }
+  protected:
 
-        // If replacement node weight is kNeither or we are taking the shorter
-        // path of replacement node and our sibling (on longer path) is
-        // balanced then we need to update the balance node to match this
-        // replacement node but all our ancestors will not require rebalancing
-        if ((replace->weight == kNeither) ||
-          (replace->weight == (1 - replace->dir) &&
-            replace->children[1 - replace->dir]->weight == kNeither))
-        {
-          // Update balance node (and its parent) to replacement node
-          balance_parent = replace_parent;
-          balance = replace;
-        }
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    imap(etl::ipool& node_pool, size_t max_size_)
+      : etl::map_base(max_size_)
+      , p_node_pool(&node_pool)
+    {
+    }
 
-        // Keep searching for the replacement node
-        replace_parent = replace;
-        replace = replace->children[replace->dir];
-      }
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_node_pool() const
+    {
+      return *p_node_pool;
+    }
 
-      // If target node was found, proceed with rebalancing and replacement
-      if (found)
+    //*************************************************************************
+    /// Initialise the map.
+    //*************************************************************************
+    void initialise()
+    {
+      const_iterator item = begin();
+
+      while (item != end())
       {
-        // Step 2: Update weights from critical node to replacement parent node
-        while (balance)
-        {
-          if (balance->children[balance->dir] == ETL_NULLPTR)
-          {
-            break;
-          }
+        item = erase(item);
+      }
+    }
 
-          if (balance->weight == kNeither)
-          {
-            balance->weight = 1 - balance->dir;
-          }
-          else if (balance->weight == balance->dir)
-          {
-            balance->weight = kNeither;
-          }
-          else
-          {
-            int weight = balance->children[1 - balance->dir]->weight;
-            // Perform a 3 node rotation if weight is same as balance->dir
-            if (weight == balance->dir)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_3node(root_node, 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-              else
-              {
-                rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-            }
-            // Already balanced, rebalance and make it heavy in opposite
-            // direction of the node being removed
-            else if (weight == kNeither)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-                root_node->weight = balance->dir;
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-                balance_parent->children[balance_parent->dir]->weight = balance->dir;
-              }
-              // Update balance node weight in opposite direction of node removed
-              balance->weight = 1 - balance->dir;
-            }
-            // Rebalance and leave it balanced
-            else
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-              }
-            }
+  private:
 
-            // Is balance node the same as the target node found? then update
-            // its parent after the rotation performed above
-            if (balance == found)
-            {
-              if (balance_parent)
-              {
-                found_parent = balance_parent->children[balance_parent->dir];
-                // Update dir since it is likely stale
-                found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
-              }
-              else
-              {
-                found_parent = root_node;
-                root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
-              }
-            }
-          }
+    //*************************************************************************
+    /// Allocate a Data_Node.
+    //*************************************************************************
+    Data_Node& allocate_data_node(const_reference value)
+    {
+      Data_Node* node = allocate_data_node();
+      ::new (&node->value) value_type(value);
+      ETL_INCREMENT_DEBUG_COUNT;
+      return *node;
+    }
+
+    //*************************************************************************
+    /// Allocate a Data_Node with the supplied key.
+    //*************************************************************************
+    Data_Node& allocate_data_node_with_key(const_key_reference key)
+    {
+      Data_Node* node = allocate_data_node();
 
-          // Next balance node to consider
-          balance_parent = balance;
-          balance = balance->children[balance->dir];
-        } // while(balance)
+      ::new ((void*)etl::addressof(node->value.first))  key_type(key);
+      ::new ((void*)etl::addressof(node->value.second)) mapped_type();
+      ETL_INCREMENT_DEBUG_COUNT;
+      return *node;
+    }
 
-          // Step 3: Swap found node with replacement node
-        if (found_parent)
-        {
-          // Handle traditional case
-          detach_node(found_parent->children[found_parent->dir],
-            replace_parent->children[replace_parent->dir]);
-        }
-        // Handle root node removal
-        else
-        {
-          // Valid replacement node for root node being removed?
-          if (replace_parent)
-          {
-            detach_node(root_node, replace_parent->children[replace_parent->dir]);
-          }
-          else
-          {
-            // Target node and replacement node are both root node
-            detach_node(root_node, root_node);
-          }
-        }
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Allocate a Data_Node.
+    //*************************************************************************
+    Data_Node& allocate_data_node(rvalue_reference value)
+    {
+      Data_Node* node = allocate_data_node();
+      ::new (&node->value) value_type(etl::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+      return *node;
+    }
 
-        // Downcast found into data node
-        Data_Node& found_data_node = imap::data_cast(*found);
+    //*************************************************************************
+    /// Allocate a Data_Node with the supplied key.
+    //*************************************************************************
+    Data_Node& allocate_data_node_with_key(rvalue_key_reference key)
+    {
+      Data_Node* node = allocate_data_node();
 
-        // One less.
-        --current_size;
+      ::new ((void*)etl::addressof(node->value.first))  key_type(etl::move(key));
+      ::new ((void*)etl::addressof(node->value.second)) mapped_type();
+      ETL_INCREMENT_DEBUG_COUNT;
+      return *node;
+    }
 
-        // Destroy the node removed
-        destroy_data_node(found_data_node);
-      } // if(found)
+#endif
 
-        // Return node found (might be ETL_NULLPTR)
-      return found;
+    //*************************************************************************
+    /// Create a Data_Node.
+    //*************************************************************************
+    Data_Node* allocate_data_node()
+    {
+      Data_Node* (etl::ipool::*func)() = &etl::ipool::allocate<Data_Node>;
+      return (p_node_pool->*func)();
     }
 
-#if ETL_USING_CPP11
     //*************************************************************************
-    /// Remove the node specified from somewhere starting at the position
-    /// provided
+    /// Finds the next of a series of ascending keys.
+    /// Leaves the subtrees whose keys are all less than the key, then searches
+    /// down from there, keeping the nodes with greater keys for the next key.
     //*************************************************************************
-    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    Node* remove_node(Node*& position, const K& key)
+    const Node* find_next_sorted_node(sorted_search& search, const_key_reference key) const
     {
-      // Step 1: Find the target node that matches the key provided, the
-      // replacement node (might be the same as target node), and the critical
-      // node to start rebalancing the tree from (up to the replacement node)
-      Node* found_parent = ETL_NULLPTR;
-      Node* found = ETL_NULLPTR;
-      Node* replace_parent = ETL_NULLPTR;
-      Node* replace = position;
-      Node* balance_parent = ETL_NULLPTR;
-      Node* balance = root_node;
-      while (replace)
+      while (search.depth != 0U)
       {
-        // Downcast found to Data_Node class for comparison and other operations
-        Data_Node& replace_data_node = imap::data_cast(*replace);
+        const Node* ancestor = search.ancestors[search.depth - 1U];
 
-        // Compare the key provided to the replace data node key
-        if (node_comp(key, replace_data_node))
+        if (!node_comp(imap::data_cast(*ancestor), key))
         {
-          // Update the direction to the target/replace node
-          replace->dir = kLeft;
+          // The nearest greater or equal ancestor.
+          if (!node_comp(key, imap::data_cast(*ancestor)))
+          {
+            return ancestor;
+          }
+
+          break;
         }
-        else if (node_comp(replace_data_node, key))
+
+        search.subtree = ancestor->children[kRight];
+        --search.depth;
+      }
+
+      while (search.subtree != ETL_NULLPTR)
+      {
+        const Node* position = search.subtree;
+        const Data_Node& data_node = imap::data_cast(*position);
+
+        if (node_comp(key, data_node))
         {
-          // Update the direction to the target/replace node
-          replace->dir = kRight;
+          search.ancestors[search.depth++] = position;
+          search.subtree = position->children[kLeft];
         }
-        else
+        else if (node_comp(data_node, key))
         {
-          // Update the direction to the replace node (target node found here)
-          replace->dir = replace->children[kLeft] ? kLeft : kRight;
-
-          // Note the target node was found (and its parent)
-          found_parent = replace_parent;
-          found = replace;
+          search.subtree = position->children[kRight];
         }
-        // Replacement node found if its missing a child in the replace->dir
-        // value set above
-        if (replace->children[replace->dir] == ETL_NULLPTR)
+        else
         {
-          // Exit loop once replace node is found (target might not have been)
-          break;
-        }
+          search.ancestors[search.depth++] = position;
+          search.subtree = ETL_NULLPTR;
 
-        // If replacement node weight is kNeither or we are taking the shorter
-        // path of replacement node and our sibling (on longer path) is
-        // balanced then we need to update the balance node to match this
-        // replacement node but all our ancestors will not require rebalancing
-        if ((replace->weight == kNeither) ||
-          (replace->weight == (1 - replace->dir) &&
-            replace->children[1 - replace->dir]->weight == kNeither))
-        {
-          // Update balance node (and its parent) to replacement node
-          balance_parent = replace_parent;
-          balance = replace;
+          return position;
         }
+      }
 
-        // Keep searching for the replacement node
-        replace_parent = replace;
-        replace = replace->children[replace->dir];
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Destroy a Data_Node.
+    //*************************************************************************
+    void destroy_data_node(Data_Node& node)
+    {
+      node.value.~value_type();
+      p_node_pool->release(&node);
+      ETL_DECREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Compares keys of type K with the keys of data nodes.
+    //*************************************************************************
+    template <typename K>
+    class key_node_compare
+    {
+    public:
+
+      explicit key_node_compare(const key_compare& compare_)
+        : compare(compare_)
+      {
       }
 
-      // If target node was found, proceed with rebalancing and replacement
-      if (found)
+      int operator()(const void* p_key, const Node& node) const
       {
-        // Step 2: Update weights from critical node to replacement parent node
-        while (balance)
-        {
-          if (balance->children[balance->dir] == ETL_NULLPTR)
-          {
-            break;
-          }
+        const K&    key   = *static_cast<const K*>(p_key);
+        const TKey& value = imap::data_cast(node).value.first;
+
+        return compare(key, value) ? -1 : (compare(value, key) ? 1 : 0);
+      }
+
+      const void* key(const Node& node) const
+      {
+        return &imap::data_cast(node).value.first;
+      }
+
+    private:
+
+      const key_compare& compare;
+    };
+
+    //*************************************************************************
+    /// The compare used by the tree algorithms.
+    /// If ETL_USE_FOLDED_TREE_CODE is defined, maps of trivially copyable keys
+    /// compare through function pointers and share one copy of the tree
+    /// algorithms, at the cost of an indirect call per comparison.
+    /// The setting must be the same in every translation unit.
+    //*************************************************************************
+#if defined(ETL_USE_FOLDED_TREE_CODE)
+    typedef typename etl::conditional<etl::is_trivially_copyable<TKey>::value, folded_node_compare, key_node_compare<TKey> >::type tree_compare_type;
+#else
+    typedef key_node_compare<TKey> tree_compare_type;
+#endif
+
+    tree_compare_type tree_compare() const
+    {
+      return make_tree_compare(static_cast<tree_compare_type*>(ETL_NULLPTR));
+    }
+
+    key_node_compare<TKey> make_tree_compare(key_node_compare<TKey>*) const
+    {
+      return key_node_compare<TKey>(kcompare);
+    }
+
+    folded_node_compare make_tree_compare(folded_node_compare*) const
+    {
+      return folded_node_compare(&imap::folded_compare, &imap::folded_key, &kcompare);
+    }
+
+    static int folded_compare(const void* p_context, const void* p_key, const Node& node)
+    {
+      return key_node_compare<TKey>(*static_cast<const key_compare*>(p_context))(p_key, node);
+    }
+
+    static const void* folded_key(const Node& node)
+    {
+      return &imap::data_cast(node).value.first;
+    }
+
+    //*************************************************************************
+    /// Find the value matching the node provided
+    //*************************************************************************
+    Node* find_node(Node* position, const_key_reference key) const
+    {
+      return map_base::find_node(position, &key, tree_compare());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    Node* find_node(Node* position, const K& key) const
+    {
+      return map_base::find_node(position, &key, key_node_compare<K>(kcompare));
+    }
+#endif
+
+    //*************************************************************************
+    /// Find the reference node matching the node provided
+    //*************************************************************************
+    Node* find_node(Node* position, const Node* node) const
+    {
+      return map_base::find_node(position, node, tree_compare());
+    }
+
+    //*************************************************************************
+    /// Find the node whose key is not considered to go before the key provided
+    //*************************************************************************
+    Node* find_lower_node(Node* position, const_key_reference key) const
+    {
+      return map_base::find_lower_node(position, &key, tree_compare());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    Node* find_lower_node(Node* position, const K& key) const
+    {
+      return map_base::find_lower_node(position, &key, key_node_compare<K>(kcompare));
+    }
+#endif
+
+    //*************************************************************************
+    /// Find the node whose key is considered to go after the key provided
+    //*************************************************************************
+    Node* find_upper_node(Node* position, const_key_reference key) const
+    {
+      return map_base::find_upper_node(position, &key, tree_compare());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    Node* find_upper_node(Node* position, const K& key) const
+    {
+      return map_base::find_upper_node(position, &key, key_node_compare<K>(kcompare));
+    }
+#endif
+
+    //*************************************************************************
+    /// Insert a node.
+    //*************************************************************************
+    Node* insert_node(Node*& position, Data_Node& node)
+    {
+      Node* found = map_base::insert_node(position, node, tree_compare());
+
+      if (found != &node)
+      {
+        // Destroy the node provided (its a duplicate)
+        destroy_data_node(node);
+      }
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Find the next node in sequence from the node provided
+    //*************************************************************************
+    void next_node(Node*& position) const
+    {
+      const Node* p_node = position;
+      map_base::next_node(p_node, tree_compare());
+      position = const_cast<Node*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Find the next node in sequence from the node provided
+    //*************************************************************************
+    void next_node(const Node*& position) const
+    {
+      map_base::next_node(position, tree_compare());
+    }
 
-          if (balance->weight == kNeither)
-          {
-            balance->weight = 1 - balance->dir;
-          }
-          else if (balance->weight == balance->dir)
-          {
-            balance->weight = kNeither;
-          }
-          else
-          {
-            int weight = balance->children[1 - balance->dir]->weight;
-            // Perform a 3 node rotation if weight is same as balance->dir
-            if (weight == balance->dir)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_3node(root_node, 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-              else
-              {
-                rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-            }
-            // Already balanced, rebalance and make it heavy in opposite
-            // direction of the node being removed
-            else if (weight == kNeither)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-                root_node->weight = balance->dir;
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-                balance_parent->children[balance_parent->dir]->weight = balance->dir;
-              }
-              // Update balance node weight in opposite direction of node removed
-              balance->weight = 1 - balance->dir;
-            }
-            // Rebalance and leave it balanced
-            else
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-              }
-            }
+    //*************************************************************************
+    /// Find the previous node in sequence from the node provided
+    //*************************************************************************
+    void prev_node(Node*& position) const
+    {
+      const Node* p_node = position;
+      map_base::prev_node(p_node, tree_compare());
+      position = const_cast<Node*>(p_node);
+    }
 
-            // Is balance node the same as the target node found? then update
-            // its parent after the rotation performed above
-            if (balance == found)
-            {
-              if (balance_parent)
-              {
-                found_parent = balance_parent->children[balance_parent->dir];
-                // Update dir since it is likely stale
-                found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
-              }
-              else
-              {
-                found_parent = root_node;
-                root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
-              }
-            }
-          }
+    //*************************************************************************
+    /// Find the previous node in sequence from the node provided
+    //*************************************************************************
+    void prev_node(const Node*& position) const
+    {
+      map_base::prev_node(position, tree_compare());
+    }
 
-          // Next balance node to consider
-          balance_parent = balance;
-          balance = balance->children[balance->dir];
-        } // while(balance)
+    //*************************************************************************
+    /// Remove the node specified from somewhere starting at the position
+    /// provided
+    //*************************************************************************
+    Node* remove_node(Node*& position, const_key_reference key)
+    {
+      Node* found = map_base::remove_node(position, &key, tree_compare());
 
-          // Step 3: Swap found node with replacement node
-        if (found_parent)
-        {
-          // Handle traditional case
-          detach_node(found_parent->children[found_parent->dir],
-            replace_parent->children[replace_parent->dir]);
-        }
-        // Handle root node removal
-        else
-        {
-          // Valid replacement node for root node being removed?
-          if (replace_parent)
-          {
-            detach_node(root_node, replace_parent->children[replace_parent->dir]);
-          }
-          else
-          {
-            // Target node and replacement node are both root node
-            detach_node(root_node, root_node);
-          }
-        }
+      if (found)
+      {
+        destroy_data_node(imap::data_cast(*found));
+      }
 
-        // Downcast found into data node
-        Data_Node& found_data_node = imap::data_cast(*found);
+      return found;
+    }
 
-        // One less.
-        --current_size;
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    Node* remove_node(Node*& position, const K& key)
+    {
+      Node* found = map_base::remove_node(position, &key, key_node_compare<K>(kcompare));
 
-        // Destroy the node removed
-        destroy_data_node(found_data_node);
-      } // if(found)
+      if (found)
+      {
+        destroy_data_node(imap::data_cast(*found));
+      }
 
-        // Return node found (might be ETL_NULLPTR)
       return found;
     }
 #endif
@@ -2643,6 +2681,11 @@ namespace etl
     // Disable copy construction.
     imap(const imap&);
 
+#if ETL_HAS_CONTAINER_STATISTICS
+    /// The operation statistics.
+    mutable etl::container_statistics statistics;
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -2790,11 +2833,176 @@ namespace etl
 
     /// The pool of data nodes used for the map.
     etl::pool<typename etl::imap<TKey, TValue, TCompare>::Data_Node, MAX_SIZE> node_pool;
+
+    ETL_STATIC_ASSERT(etl::private_tree::node_link_in_range<sizeof(etl::pool<typename etl::imap<TKey, TValue, TCompare>::Data_Node, MAX_SIZE>)>::value, "Pool is too large for ETL_COMPACT_TREE_NODE_OFFSET_TYPE");
   };
 
   template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
   ETL_CONSTANT size_t map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
 
+  //*************************************************************************
+  /// A templated map implementation that uses a shared pool of nodes.
+  /// Create the pool as etl::pool<etl::map_ext<...>::pool_type, N>.
+  /// Many map_ext instances may share one pool, so that they do not each
+  /// have to reserve nodes for the worst case.
+  //*************************************************************************
+  template <typename TKey, typename TValue, typename TCompare = etl::less<TKey> >
+  class map_ext : public etl::imap<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::imap<TKey, TValue, TCompare> base_t;
+
+  public:
+
+    typedef typename base_t::value_type value_type;
+    typedef typename base_t::Data_Node  pool_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    explicit map_ext(etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Implicit pool.
+    //*************************************************************************
+    map_ext(const map_ext& other)
+      : base_t(other.get_node_pool(), other.get_node_pool().max_size())
+    {
+      if (this != &other)
+      {
+        this->assign(other.cbegin(), other.cend());
+      }
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Explicit pool.
+    //*************************************************************************
+    map_ext(const map_ext& other, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      if (this != &other)
+      {
+        this->assign(other.cbegin(), other.cend());
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor. Implicit pool.
+    //*************************************************************************
+    map_ext(map_ext&& other)
+      : base_t(other.get_node_pool(), other.get_node_pool().max_size())
+    {
+      move_items(other);
+    }
+
+    //*************************************************************************
+    /// Move constructor. Explicit pool.
+    //*************************************************************************
+    map_ext(map_ext&& other, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      move_items(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    map_ext(TIterator first, TIterator last, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    map_ext(std::initializer_list<value_type> init, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    /// Releases the nodes back to the shared pool.
+    //*************************************************************************
+    ~map_ext()
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    map_ext& operator = (const map_ext& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    map_ext& operator = (map_ext&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->clear();
+        move_items(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_pool() const
+    {
+      return this->get_node_pool();
+    }
+
+  private:
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the items from another map_ext.
+    /// The nodes of other are released, so that a shared pool is not drained.
+    //*************************************************************************
+    void move_items(map_ext& other)
+    {
+      typename base_t::iterator from = other.begin();
+
+      while (from != other.end())
+      {
+        this->insert(etl::move(*from));
+        from = other.erase(from);
+      }
+    }
+#endif
+  };
+
   //*************************************************************************
   /// Template deduction guides.
   //*************************************************************************
@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
 
 //#include <math.h>
 #include <stdint.h>
@@ -125,6 +126,33 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a contiguous batch of values.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      calc_t batch_sum = calc_t(0);
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        batch_sum += TCalc(values[i]);
+      }
+
+      sum         += batch_sum;
+      counter     += uint32_t(values.size());
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Merge the values added to another mean.
+    //*********************************
+    void merge(const mean& other)
+    {
+      sum         += other.sum;
+      counter     += other.counter;
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
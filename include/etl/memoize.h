@@ -0,0 +1,317 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MEMOIZE_INCLUDED
+#define ETL_MEMOIZE_INCLUDED
+
+#include "platform.h"
+#include "delegate.h"
+#include "functional.h"
+#include "hash.h"
+#include "mutex.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup memoize memoize
+/// Remembers the results of a pure function of one argument in a fixed,
+/// set associative table, so that repeated arguments cost one hash and a
+/// compare of at most WAYS keys.
+/// Each argument hashes to one set. A set of one way is direct mapped; a new
+/// result replaces the old. With two ways, the least recently used is replaced.
+/// With more, any but the most recently used may be replaced.
+///\ingroup cache
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Declaration.
+  ///\ingroup memoize
+  //***************************************************************************
+  template <typename TSignature, const size_t CAPACITY_, const size_t WAYS_ = 1U, typename TMutex = etl::null_mutex, typename THash = void, typename TKeyEqual = void>
+  class memoize;
+
+  //***************************************************************************
+  /// Memoises a function of one argument.
+  /// The argument, without reference and cv qualifiers, is the key. The key and
+  /// result types must be default constructible and copy assignable.
+  /// The function is called without the lock held, so a result may be computed
+  /// twice by racing threads; it must be pure.
+  ///\tparam TReturn   The result type.
+  ///\tparam TParam    The argument type.
+  ///\tparam CAPACITY_ The number of results remembered. Must be a multiple of WAYS_.
+  ///\tparam WAYS_     The number of results in each set.
+  ///\tparam TMutex    The lock type. etl::null_mutex for one thread, or etl::mutex.
+  ///\tparam THash     The key hash. Defaults to etl::hash of the key.
+  ///\tparam TKeyEqual The key compare. Defaults to etl::equal_to of the key.
+  ///\ingroup memoize
+  //***************************************************************************
+  template <typename TReturn, typename TParam, const size_t CAPACITY_, const size_t WAYS_, typename TMutex, typename THash, typename TKeyEqual>
+  class memoize<TReturn(TParam), CAPACITY_, WAYS_, TMutex, THash, TKeyEqual>
+  {
+  public:
+
+    typedef typename etl::remove_cvref<TParam>::type key_type;
+    typedef TReturn                                   result_type;
+    typedef etl::delegate<TReturn(TParam)>            function_type;
+    typedef size_t                                    size_type;
+
+    typedef typename etl::conditional<etl::is_same<THash, void>::value, etl::hash<key_type>, THash>::type              hasher;
+    typedef typename etl::conditional<etl::is_same<TKeyEqual, void>::value, etl::equal_to<key_type>, TKeyEqual>::type key_equal;
+
+    ETL_STATIC_ASSERT(!etl::is_reference<TReturn>::value, "etl::memoize results are held by value");
+    ETL_STATIC_ASSERT((WAYS_ > 0U), "etl::memoize needs at least one way");
+    ETL_STATIC_ASSERT((CAPACITY_ >= WAYS_), "etl::memoize capacity must be at least one set");
+    ETL_STATIC_ASSERT(((CAPACITY_ % WAYS_) == 0U), "etl::memoize capacity must be a multiple of the number of ways");
+
+    static ETL_CONSTANT size_t CAPACITY = CAPACITY_;
+    static ETL_CONSTANT size_t WAYS     = WAYS_;
+    static ETL_CONSTANT size_t SETS     = CAPACITY_ / WAYS_;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// set_function must be called before use.
+    //*************************************************************************
+    memoize()
+      : function()
+      , hit_count(0U)
+      , miss_count(0U)
+    {
+      clear_entries();
+    }
+
+    //*************************************************************************
+    /// Constructs with the function to memoise.
+    //*************************************************************************
+    explicit memoize(function_type function_)
+      : function(function_)
+      , hit_count(0U)
+      , miss_count(0U)
+    {
+      clear_entries();
+    }
+
+    //*************************************************************************
+    /// Sets the function to memoise, forgetting all results.
+    /// Not to be called while other threads are using the memoiser.
+    //*************************************************************************
+    void set_function(function_type function_)
+    {
+      etl::lock_guard<TMutex> lock(access);
+
+      function = function_;
+      clear_entries();
+    }
+
+    //*************************************************************************
+    /// Gets the result for an argument, calling the function on a miss.
+    //*************************************************************************
+    TReturn operator ()(TParam param)
+    {
+      set_t& set = sets[set_index(static_cast<size_t>(hash_function(param)))];
+
+      {
+        etl::lock_guard<TMutex> lock(access);
+
+        const size_t way = find_way(set, param);
+
+        if (way != WAYS)
+        {
+          ++hit_count;
+          set.victim = (way + 1U) % WAYS;
+
+          return set.ways[way].result;
+        }
+
+        ++miss_count;
+      }
+
+      TReturn result = function(param);
+
+      etl::lock_guard<TMutex> lock(access);
+
+      // Another thread may have stored it meanwhile.
+      size_t way = find_way(set, param);
+
+      if (way == WAYS)
+      {
+        way = set.victim;
+        set.ways[way].key   = param;
+        set.ways[way].valid = true;
+      }
+
+      set.ways[way].result = result;
+      set.victim = (way + 1U) % WAYS;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Checks if the result for an argument is remembered.
+    //*************************************************************************
+    bool contains(TParam param) const
+    {
+      const set_t& set = sets[set_index(static_cast<size_t>(hash_function(param)))];
+
+      etl::lock_guard<TMutex> lock(access);
+
+      return find_way(set, param) != WAYS;
+    }
+
+    //*************************************************************************
+    /// Forgets all results.
+    //*************************************************************************
+    void clear()
+    {
+      etl::lock_guard<TMutex> lock(access);
+
+      clear_entries();
+    }
+
+    //*************************************************************************
+    /// The number of calls answered from the table.
+    //*************************************************************************
+    uint32_t hits() const
+    {
+      etl::lock_guard<TMutex> lock(access);
+
+      return hit_count;
+    }
+
+    //*************************************************************************
+    /// The number of calls that called the function.
+    //*************************************************************************
+    uint32_t misses() const
+    {
+      etl::lock_guard<TMutex> lock(access);
+
+      return miss_count;
+    }
+
+    //*************************************************************************
+    /// The maximum number of remembered results.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A remembered result.
+    //*************************************************************************
+    struct entry_t
+    {
+      key_type key;
+      TReturn  result;
+      bool     valid;
+    };
+
+    //*************************************************************************
+    /// The ways that share a hash.
+    //*************************************************************************
+    struct set_t
+    {
+      entry_t ways[WAYS_];
+      size_t  victim; ///< The next way to replace.
+    };
+
+    //*************************************************************************
+    /// Gets the set for a hash.
+    //*************************************************************************
+    static size_t set_index(size_t hash)
+    {
+      // Mix, so that hashes that differ only in their high bits spread over the sets.
+      const uint32_t mixed = static_cast<uint32_t>((uint64_t(hash) * 0x9E3779B97F4A7C15ULL) >> 32U);
+
+      return mixed % SETS;
+    }
+
+    //*************************************************************************
+    /// Finds the way holding a key, or WAYS.
+    //*************************************************************************
+    size_t find_way(const set_t& set, const key_type& key) const
+    {
+      for (size_t way = 0U; way < WAYS; ++way)
+      {
+        if (set.ways[way].valid && key_equal_function(set.ways[way].key, key))
+        {
+          return way;
+        }
+      }
+
+      return WAYS;
+    }
+
+    //*************************************************************************
+    /// Marks all entries as empty.
+    //*************************************************************************
+    void clear_entries()
+    {
+      for (size_t s = 0U; s < SETS; ++s)
+      {
+        for (size_t way = 0U; way < WAYS; ++way)
+        {
+          sets[s].ways[way].valid = false;
+        }
+
+        sets[s].victim = 0U;
+      }
+    }
+
+    // Disable copy construction and assignment.
+    memoize(const memoize&);
+    memoize& operator =(const memoize&);
+
+    function_type  function;
+    set_t          sets[SETS];
+    uint32_t       hit_count;
+    uint32_t       miss_count;
+    mutable TMutex access;
+    hasher         hash_function;
+    key_equal      key_equal_function;
+  };
+
+  template <typename TReturn, typename TParam, const size_t CAPACITY_, const size_t WAYS_, typename TMutex, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t memoize<TReturn(TParam), CAPACITY_, WAYS_, TMutex, THash, TKeyEqual>::CAPACITY;
+
+  template <typename TReturn, typename TParam, const size_t CAPACITY_, const size_t WAYS_, typename TMutex, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t memoize<TReturn(TParam), CAPACITY_, WAYS_, TMutex, THash, TKeyEqual>::WAYS;
+
+  template <typename TReturn, typename TParam, const size_t CAPACITY_, const size_t WAYS_, typename TMutex, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t memoize<TReturn(TParam), CAPACITY_, WAYS_, TMutex, THash, TKeyEqual>::SETS;
+}
+
+#endif
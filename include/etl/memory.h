@@ -478,6 +478,60 @@ namespace etl
   }
 #endif
 
+  //*****************************************************************************
+  /// Relocates a range of objects to uninitialised memory.
+  /// The objects in the source range are ended and the destination range may
+  /// overlap it. Trivially relocatable types are moved with a single memmove.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_trivially_relocatable<T>::value, T*>::type
+    uninitialized_relocate(T* i_begin, T* i_end, T* o_begin)
+  {
+    const size_t n = static_cast<size_t>(i_end - i_begin);
+
+    if ((n != 0U) && (i_begin != o_begin))
+    {
+      memmove(static_cast<void*>(o_begin), static_cast<const void*>(i_begin), n * sizeof(T));
+    }
+
+    return o_begin + n;
+  }
+
+  //*****************************************************************************
+  /// Relocates a range of objects to uninitialised memory.
+  /// The objects in the source range are ended and the destination range may
+  /// overlap it. Each object is move constructed and then destroyed.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename T>
+  typename etl::enable_if<!etl::is_trivially_relocatable<T>::value, T*>::type
+    uninitialized_relocate(T* i_begin, T* i_end, T* o_begin)
+  {
+    const size_t n = static_cast<size_t>(i_end - i_begin);
+
+    if (o_begin < i_begin)
+    {
+      // Forwards, so that an overlapping source is ended before it is overwritten.
+      for (size_t i = 0U; i < n; ++i)
+      {
+        ::new (static_cast<void*>(o_begin + i)) T(ETL_MOVE(i_begin[i]));
+        i_begin[i].~T();
+      }
+    }
+    else if (o_begin > i_begin)
+    {
+      // Backwards, so that an overlapping source is ended before it is overwritten.
+      for (size_t i = n; i != 0U; --i)
+      {
+        ::new (static_cast<void*>(o_begin + i - 1U)) T(ETL_MOVE(i_begin[i - 1U]));
+        i_begin[i - 1U].~T();
+      }
+    }
+
+    return o_begin + n;
+  }
+
 #if ETL_USING_CPP11
 #if ETL_USING_STL && ETL_USING_CPP17
   //*****************************************************************************
@@ -35,11 +35,28 @@ SOFTWARE.
 #include "message.h"
 #include "message_router.h"
 #include "span.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "static_assert.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace etl
 {
+  //***************************************************************************
+  /// The subscription index for the message broker is full.
+  //***************************************************************************
+  class message_broker_index_full : public etl::message_router_exception
+  {
+  public:
+
+    message_broker_index_full(string_type file_name_, numeric_type line_number_)
+      : message_router_exception(ETL_ERROR_TEXT("message broker:index full", ETL_MESSAGE_BROKER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   /// Message broker
   //***************************************************************************
@@ -136,6 +153,7 @@ namespace etl
     message_broker()
       : imessage_router(etl::imessage_router::MESSAGE_BROKER)
       , head()
+      , index()
     {
     }
 
@@ -145,6 +163,7 @@ namespace etl
     message_broker(etl::imessage_router& successor_)
       : imessage_router(etl::imessage_router::MESSAGE_BROKER, successor_)
       , head()
+      , index()
     {
     }
 
@@ -154,6 +173,7 @@ namespace etl
     message_broker(etl::message_router_id_t id_)
       : imessage_router(id_)
       , head()
+      , index()
     {
       ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
     }
@@ -164,6 +184,7 @@ namespace etl
     message_broker(etl::message_router_id_t id_, etl::imessage_router& successor_)
       : imessage_router(id_, successor_)
       , head()
+      , index()
     {
       ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
     }
@@ -174,12 +195,14 @@ namespace etl
     void subscribe(etl::message_broker::subscription& new_sub)
     {
       initialise_insertion_point(new_sub.get_router(), &new_sub);
+      rebuild_index();
     }
 
     //*******************************************
     void unsubscribe(etl::imessage_router& router)
     {
       initialise_insertion_point(&router, ETL_NULLPTR);
+      rebuild_index();
     }
 
     //*******************************************
@@ -197,33 +220,7 @@ namespace etl
     virtual void receive(etl::message_router_id_t destination_router_id,
                          const etl::imessage&     msg) ETL_OVERRIDE
     {
-      const etl::message_id_t id = msg.get_message_id();
-
-      if (!empty())
-      {
-        // Scan the subscription lists.
-        subscription* sub = static_cast<subscription*>(head.get_next());
-
-        while (sub != ETL_NULLPTR)
-        {
-          message_id_span_t message_ids = sub->message_id_list();
-
-          message_id_span_t::iterator itr = etl::find(message_ids.begin(), message_ids.end(), id);
-
-          if (itr != message_ids.end())
-          {
-            etl::imessage_router* router = sub->get_router();
-
-            if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS ||
-                destination_router_id == router->get_message_router_id())
-            {
-              router->receive(msg);
-            }
-          }
-
-          sub = sub->next_subscription();
-        }
-      }
+      distribute(destination_router_id, msg.get_message_id(), msg);
 
       // Always pass the message on to the successor.
       if (has_successor())
@@ -236,33 +233,7 @@ namespace etl
     virtual void receive(etl::message_router_id_t destination_router_id, 
                          etl::shared_message      shared_msg) ETL_OVERRIDE
     {
-      const etl::message_id_t id = shared_msg.get_message().get_message_id();
-
-      if (!empty())
-      {
-        // Scan the subscription lists.
-        subscription* sub = static_cast<subscription*>(head.get_next());
-
-        while (sub != ETL_NULLPTR)
-        {
-          message_id_span_t message_ids = sub->message_id_list();
-
-          message_id_span_t::iterator itr = etl::find(message_ids.begin(), message_ids.end(), id);
-
-          if (itr != message_ids.end())
-          {
-            etl::imessage_router* router = sub->get_router();
-
-            if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS ||
-                destination_router_id == router->get_message_router_id())
-            {
-              router->receive(shared_msg);
-            }
-          }
-
-          sub = sub->next_subscription();
-        }
-      }
+      distribute(destination_router_id, shared_msg.get_message().get_message_id(), shared_msg);
 
       // Always pass the message on to a successor.
       if (has_successor())
@@ -281,26 +252,45 @@ namespace etl
     {
       if (!empty())
       {
-        // Scan the subscription lists.
-        subscription* sub = static_cast<subscription*>(head.get_next());
-
-        while (sub != ETL_NULLPTR)
+        if (is_indexed())
         {
-          message_id_span_t message_ids = sub->message_id_list();
+          // Only the subscriptions for the id.
+          const size_t position = index.find(id);
 
-          message_id_span_t::iterator itr = etl::find(message_ids.begin(), message_ids.end(), id);
+          if (position != index.id_count)
+          {
+            for (size_t i = index.p_first[position]; i < index.p_first[position + 1U]; ++i)
+            {
+              if (index.p_subscriptions[i]->get_router()->accepts(id))
+              {
+                return true;
+              }
+            }
+          }
+        }
+        else
+        {
+          // Scan the subscription lists.
+          subscription* sub = static_cast<subscription*>(head.get_next());
 
-          if (itr != message_ids.end())
+          while (sub != ETL_NULLPTR)
           {
-            etl::imessage_router* router = sub->get_router();
+            message_id_span_t message_ids = sub->message_id_list();
+
+            message_id_span_t::iterator itr = etl::find(message_ids.begin(), message_ids.end(), id);
 
-            if (router->accepts(id))
+            if (itr != message_ids.end())
             {
-              return true;
+              etl::imessage_router* router = sub->get_router();
+
+              if (router->accepts(id))
+              {
+                return true;
+              }
             }
-          }
 
-          sub = sub->next_subscription();
+            sub = sub->next_subscription();
+          }
         }
       }
 
@@ -314,14 +304,13 @@ namespace etl
       }
 
       return false;
-
-      //return true;
     }
 
     //*******************************************
     void clear()
     {
       head.terminate();
+      rebuild_index();
     }
 
     //********************************************
@@ -348,8 +337,284 @@ namespace etl
       return head.get_next() == ETL_NULLPTR;
     }
 
+    //********************************************
+    /// Returns true if messages are distributed through the subscription index.
+    /// False if there is no index, or if the subscriptions do not fit in it.
+    //********************************************
+    bool is_indexed() const
+    {
+      return index.is_valid;
+    }
+
+    //********************************************
+    /// Rebuilds the subscription index.
+    /// Call this if a subscription's message id list changes while subscribed.
+    //********************************************
+    void rebuild_index()
+    {
+      if (index.id_capacity == 0U)
+      {
+        return;
+      }
+
+      index.is_valid = false;
+      index.id_count = 0U;
+
+      // Count the subscriptions for each id.
+      size_t n_entries = 0U;
+
+      for (subscription* sub = static_cast<subscription*>(head.get_next()); sub != ETL_NULLPTR; sub = sub->next_subscription())
+      {
+        message_id_span_t message_ids = sub->message_id_list();
+
+        for (message_id_span_t::iterator itr = message_ids.begin(); itr != message_ids.end(); ++itr)
+        {
+          // Ignore an id repeated in the same list.
+          if (etl::find(message_ids.begin(), itr, *itr) != itr)
+          {
+            continue;
+          }
+
+          size_t position = index.lower_bound(*itr);
+
+          if ((position == index.id_count) || (index.p_ids[position] != *itr))
+          {
+            ETL_ASSERT_OR_RETURN(index.id_count < index.id_capacity, ETL_ERROR(etl::message_broker_index_full));
+
+            // Insert the new id, keeping them sorted.
+            for (size_t i = index.id_count; i > position; --i)
+            {
+              index.p_ids[i]   = index.p_ids[i - 1U];
+              index.p_first[i] = index.p_first[i - 1U];
+            }
+
+            index.p_ids[position]   = *itr;
+            index.p_first[position] = 0U;
+            ++index.id_count;
+          }
+
+          ++index.p_first[position];
+          ++n_entries;
+        }
+      }
+
+      ETL_ASSERT_OR_RETURN(n_entries <= index.subscription_capacity, ETL_ERROR(etl::message_broker_index_full));
+
+      // Convert the counts to the start of each id's range.
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < index.id_count; ++i)
+      {
+        const size_t count = index.p_first[i];
+        index.p_first[i] = total;
+        total += count;
+      }
+
+      // Place the subscriptions, in list order. Each p_first moves on to the start of the next range.
+      for (subscription* sub = static_cast<subscription*>(head.get_next()); sub != ETL_NULLPTR; sub = sub->next_subscription())
+      {
+        message_id_span_t message_ids = sub->message_id_list();
+
+        for (message_id_span_t::iterator itr = message_ids.begin(); itr != message_ids.end(); ++itr)
+        {
+          if (etl::find(message_ids.begin(), itr, *itr) == itr)
+          {
+            index.p_subscriptions[index.p_first[index.find(*itr)]++] = sub;
+          }
+        }
+      }
+
+      // Move them back to the start of each range.
+      for (size_t i = index.id_count; i > 0U; --i)
+      {
+        index.p_first[i] = index.p_first[i - 1U];
+      }
+
+      index.p_first[0] = 0U;
+
+      index.is_valid = true;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor, with storage for the subscription index.
+    //*******************************************
+    message_broker(etl::message_id_t* p_ids_, size_t* p_first_, size_t id_capacity_, subscription** p_subscriptions_, size_t subscription_capacity_)
+      : imessage_router(etl::imessage_router::MESSAGE_BROKER)
+      , head()
+      , index(p_ids_, p_first_, id_capacity_, p_subscriptions_, subscription_capacity_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with storage for the subscription index.
+    //*******************************************
+    message_broker(etl::imessage_router& successor_, etl::message_id_t* p_ids_, size_t* p_first_, size_t id_capacity_, subscription** p_subscriptions_, size_t subscription_capacity_)
+      : imessage_router(etl::imessage_router::MESSAGE_BROKER, successor_)
+      , head()
+      , index(p_ids_, p_first_, id_capacity_, p_subscriptions_, subscription_capacity_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with storage for the subscription index.
+    //*******************************************
+    message_broker(etl::message_router_id_t id_, etl::message_id_t* p_ids_, size_t* p_first_, size_t id_capacity_, subscription** p_subscriptions_, size_t subscription_capacity_)
+      : imessage_router(id_)
+      , head()
+      , index(p_ids_, p_first_, id_capacity_, p_subscriptions_, subscription_capacity_)
+    {
+      ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //*******************************************
+    /// Constructor, with storage for the subscription index.
+    //*******************************************
+    message_broker(etl::message_router_id_t id_, etl::imessage_router& successor_, etl::message_id_t* p_ids_, size_t* p_first_, size_t id_capacity_, subscription** p_subscriptions_, size_t subscription_capacity_)
+      : imessage_router(id_, successor_)
+      , head()
+      , index(p_ids_, p_first_, id_capacity_, p_subscriptions_, subscription_capacity_)
+    {
+      ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
+    }
+
   private:
 
+    //*******************************************
+    /// The subscriptions for each message id.
+    /// The ids are sorted. The subscriptions for p_ids[i] are
+    /// p_subscriptions[p_first[i]] to p_subscriptions[p_first[i + 1] - 1],
+    /// in the order of the subscription list.
+    //*******************************************
+    struct subscription_index
+    {
+      //*******************************
+      subscription_index()
+        : p_ids(ETL_NULLPTR)
+        , p_first(ETL_NULLPTR)
+        , id_capacity(0U)
+        , id_count(0U)
+        , p_subscriptions(ETL_NULLPTR)
+        , subscription_capacity(0U)
+        , is_valid(false)
+      {
+      }
+
+      //*******************************
+      subscription_index(etl::message_id_t* p_ids_, size_t* p_first_, size_t id_capacity_, subscription** p_subscriptions_, size_t subscription_capacity_)
+        : p_ids(p_ids_)
+        , p_first(p_first_)
+        , id_capacity(id_capacity_)
+        , id_count(0U)
+        , p_subscriptions(p_subscriptions_)
+        , subscription_capacity(subscription_capacity_)
+        , is_valid(id_capacity_ != 0U)
+      {
+        p_first[0] = 0U;
+      }
+
+      //*******************************
+      /// The position of the first id not less than 'id'.
+      //*******************************
+      size_t lower_bound(etl::message_id_t id) const
+      {
+        size_t first = 0U;
+        size_t count = id_count;
+
+        while (count != 0U)
+        {
+          const size_t step = count / 2U;
+
+          if (p_ids[first + step] < id)
+          {
+            first += step + 1U;
+            count -= step + 1U;
+          }
+          else
+          {
+            count = step;
+          }
+        }
+
+        return first;
+      }
+
+      //*******************************
+      /// The position of 'id', or id_count if it is not there.
+      //*******************************
+      size_t find(etl::message_id_t id) const
+      {
+        const size_t position = lower_bound(id);
+
+        return ((position != id_count) && (p_ids[position] == id)) ? position : id_count;
+      }
+
+      etl::message_id_t* p_ids;
+      size_t*            p_first;
+      size_t             id_capacity;
+      size_t             id_count;
+      subscription**     p_subscriptions;
+      size_t             subscription_capacity;
+      bool               is_valid;
+    };
+
+    //*******************************************
+    /// Sends the message to the subscribed routers.
+    //*******************************************
+    template <typename TMessage>
+    void distribute(etl::message_router_id_t destination_router_id, etl::message_id_t id, const TMessage& msg)
+    {
+      if (empty())
+      {
+        return;
+      }
+
+      if (is_indexed())
+      {
+        // Only the subscriptions for the id.
+        const size_t position = index.find(id);
+
+        if (position != index.id_count)
+        {
+          for (size_t i = index.p_first[position]; i < index.p_first[position + 1U]; ++i)
+          {
+            deliver(index.p_subscriptions[i]->get_router(), destination_router_id, msg);
+          }
+        }
+      }
+      else
+      {
+        // Scan the subscription lists.
+        subscription* sub = static_cast<subscription*>(head.get_next());
+
+        while (sub != ETL_NULLPTR)
+        {
+          message_id_span_t message_ids = sub->message_id_list();
+
+          message_id_span_t::iterator itr = etl::find(message_ids.begin(), message_ids.end(), id);
+
+          if (itr != message_ids.end())
+          {
+            deliver(sub->get_router(), destination_router_id, msg);
+          }
+
+          sub = sub->next_subscription();
+        }
+      }
+    }
+
+    //*******************************************
+    template <typename TMessage>
+    static void deliver(etl::imessage_router* router, etl::message_router_id_t destination_router_id, const TMessage& msg)
+    {
+      if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS ||
+          destination_router_id == router->get_message_router_id())
+      {
+        router->receive(msg);
+      }
+    }
+
     //*******************************************
     void initialise_insertion_point(const etl::imessage_router* p_router, etl::message_broker::subscription* p_new_sub)
     {
@@ -383,8 +648,74 @@ namespace etl
       }
     }
 
-    subscription_node head;
+    subscription_node  head;
+    subscription_index index;
   };
+
+  //***************************************************************************
+  /// Message broker with a fixed capacity index from message id to subscriptions.
+  /// Publishing a message only visits the subscriptions for its id, rather
+  /// than scanning every subscription.
+  /// The index is rebuilt on subscribe, unsubscribe and clear.
+  /// If the subscriptions do not fit, an etl::message_broker_index_full is
+  /// raised and messages are distributed by scanning, as for etl::message_broker.
+  ///\tparam MAX_MESSAGE_IDS_   The maximum number of different message ids subscribed to.
+  ///\tparam MAX_INDEX_ENTRIES_ The maximum number of message ids summed over all subscriptions.
+  //***************************************************************************
+  template <size_t MAX_MESSAGE_IDS_, size_t MAX_INDEX_ENTRIES_>
+  class indexed_message_broker : public etl::message_broker
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_MESSAGE_IDS_ > 0U, "MAX_MESSAGE_IDS_ must be greater than zero");
+
+    static ETL_CONSTANT size_t MAX_MESSAGE_IDS   = MAX_MESSAGE_IDS_;
+    static ETL_CONSTANT size_t MAX_INDEX_ENTRIES = MAX_INDEX_ENTRIES_;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_broker()
+      : message_broker(ids, first, MAX_MESSAGE_IDS_, subscriptions, MAX_INDEX_ENTRIES_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_broker(etl::imessage_router& successor_)
+      : message_broker(successor_, ids, first, MAX_MESSAGE_IDS_, subscriptions, MAX_INDEX_ENTRIES_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_broker(etl::message_router_id_t id_)
+      : message_broker(id_, ids, first, MAX_MESSAGE_IDS_, subscriptions, MAX_INDEX_ENTRIES_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_broker(etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : message_broker(id_, successor_, ids, first, MAX_MESSAGE_IDS_, subscriptions, MAX_INDEX_ENTRIES_)
+    {
+    }
+
+  private:
+
+    etl::message_id_t ids[MAX_MESSAGE_IDS_];
+    size_t            first[MAX_MESSAGE_IDS_ + 1U];
+    subscription*     subscriptions[MAX_INDEX_ENTRIES_ == 0U ? 1U : MAX_INDEX_ENTRIES_];
+  };
+
+  template <size_t MAX_MESSAGE_IDS_, size_t MAX_INDEX_ENTRIES_>
+  ETL_CONSTANT size_t indexed_message_broker<MAX_MESSAGE_IDS_, MAX_INDEX_ENTRIES_>::MAX_MESSAGE_IDS;
+
+  template <size_t MAX_MESSAGE_IDS_, size_t MAX_INDEX_ENTRIES_>
+  ETL_CONSTANT size_t indexed_message_broker<MAX_MESSAGE_IDS_, MAX_INDEX_ENTRIES_>::MAX_INDEX_ENTRIES;
 }
 
 #endif
@@ -38,6 +38,12 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "shared_message.h"
+#include "alignment.h"
+#include "placement_new.h"
+#include "integral_limits.h"
+#include "queue_mpmc_atomic.h"
+#include "static_assert.h"
 
 #include <stdint.h>
 
@@ -69,6 +75,32 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// The message queue is full.
+  //***************************************************************************
+  class message_bus_queue_full : public etl::message_bus_exception
+  {
+  public:
+
+    message_bus_queue_full(string_type file_name_, numeric_type line_number_)
+      : message_bus_exception(ETL_ERROR_TEXT("message bus:queue full", ETL_MESSAGE_BUS_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The priority is out of range.
+  //***************************************************************************
+  class message_bus_invalid_priority : public etl::message_bus_exception
+  {
+  public:
+
+    message_bus_invalid_priority(string_type file_name_, numeric_type line_number_)
+      : message_bus_exception(ETL_ERROR_TEXT("message bus:invalid priority", ETL_MESSAGE_BUS_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   /// Interface for message bus
   //***************************************************************************
@@ -445,6 +477,275 @@ namespace etl
 
     etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
   };
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// A message bus that defers the delivery of shared messages.
+  /// Shared messages are pushed to a lock free queue, one per priority, and
+  /// delivered to the subscribed routers when process_queue() is called.
+  /// Messages may be posted from interrupts and other threads, but only one
+  /// thread should call process_queue().
+  /// Messages that are not shared are delivered immediately, as their lifetime
+  /// is not guaranteed beyond the call to receive().
+  ///\tparam MAX_ROUTERS_  The maximum number of subscribed routers.
+  ///\tparam QUEUE_SIZE_   The capacity of each priority's queue.
+  ///\tparam N_PRIORITIES_ The number of priorities. Higher values are delivered first.
+  //***************************************************************************
+  template <uint_least8_t MAX_ROUTERS_, size_t QUEUE_SIZE_, uint_least8_t N_PRIORITIES_ = 1U>
+  class queued_message_bus : public etl::imessage_bus
+  {
+  public:
+
+    ETL_STATIC_ASSERT(N_PRIORITIES_ > 0U, "There must be at least one priority");
+
+    static ETL_CONSTANT size_t        QUEUE_SIZE   = QUEUE_SIZE_;
+    static ETL_CONSTANT uint_least8_t N_PRIORITIES = N_PRIORITIES_;
+
+    using imessage_bus::receive;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    queued_message_bus()
+      : imessage_bus(router_list)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    queued_message_bus(etl::imessage_router& successor_)
+      : imessage_bus(router_list, successor_)
+    {
+    }
+
+    //*******************************************
+    /// Queues a shared message for all routers at the lowest priority.
+    //*******************************************
+    virtual void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg);
+    }
+
+    //*******************************************
+    /// Queues a shared message for a router at the lowest priority.
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id,
+                         etl::shared_message      shared_msg) ETL_OVERRIDE
+    {
+      bool ok = post(destination_router_id, shared_msg, 0U);
+
+      ETL_ASSERT(ok, ETL_ERROR(etl::message_bus_queue_full));
+      (void)ok;
+    }
+
+    //*******************************************
+    /// Queues a shared message for all routers.
+    /// Returns <b>false</b> if the queue for the priority is full.
+    //*******************************************
+    bool post(etl::shared_message shared_msg, uint_least8_t priority = 0U)
+    {
+      return post(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg, priority);
+    }
+
+    //*******************************************
+    /// Queues a shared message for a router.
+    /// Returns <b>false</b> if the queue for the priority is full.
+    //*******************************************
+    bool post(etl::message_router_id_t destination_router_id,
+              etl::shared_message      shared_msg,
+              uint_least8_t            priority = 0U)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(priority < N_PRIORITIES_, ETL_ERROR(etl::message_bus_invalid_priority), false);
+
+      return queues[priority].push(entry(destination_router_id, shared_msg));
+    }
+
+    //*******************************************
+    /// Delivers up to max_messages queued messages.
+    /// The highest priority queue is always served first, so a message posted
+    /// at a higher priority during processing is delivered next.
+    /// Returns the number of messages delivered.
+    //*******************************************
+    size_t process_queue(size_t max_messages = etl::integral_limits<size_t>::max)
+    {
+      size_t count = 0U;
+
+      while (count < max_messages)
+      {
+        entry item;
+
+        if (!pop(item))
+        {
+          break;
+        }
+
+        imessage_bus::receive(item.get_destination_router_id(), item.get_shared_message());
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// The number of queued messages.
+    /// Due to concurrency, this is a guess.
+    //*******************************************
+    size_t queue_size() const
+    {
+      size_t count = 0U;
+
+      for (size_t i = 0U; i < N_PRIORITIES_; ++i)
+      {
+        count += queues[i].size();
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// The number of queued messages at a priority.
+    /// Due to concurrency, this is a guess.
+    //*******************************************
+    size_t queue_size(uint_least8_t priority) const
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(priority < N_PRIORITIES_, ETL_ERROR(etl::message_bus_invalid_priority), 0U);
+
+      return queues[priority].size();
+    }
+
+    //*******************************************
+    /// Are there no queued messages?
+    /// Due to concurrency, this is a guess.
+    //*******************************************
+    bool queue_empty() const
+    {
+      return queue_size() == 0U;
+    }
+
+    //*******************************************
+    /// Discards all of the queued messages.
+    //*******************************************
+    void clear_queue()
+    {
+      for (size_t i = 0U; i < N_PRIORITIES_; ++i)
+      {
+        while (queues[i].pop())
+        {
+        }
+      }
+    }
+
+  private:
+
+    //*******************************************
+    /// A queued message and its destination.
+    /// May be empty, so that a message can be popped into it.
+    //*******************************************
+    class entry
+    {
+    public:
+
+      entry()
+        : destination_router_id(etl::imessage_router::ALL_MESSAGE_ROUTERS)
+        , valid(false)
+      {
+      }
+
+      entry(etl::message_router_id_t destination_router_id_, const etl::shared_message& shared_msg_)
+        : destination_router_id(destination_router_id_)
+        , valid(true)
+      {
+        ::new (storage.get_address<etl::shared_message>()) etl::shared_message(shared_msg_);
+      }
+
+      entry(const entry& other)
+        : destination_router_id(other.destination_router_id)
+        , valid(other.valid)
+      {
+        if (valid)
+        {
+          ::new (storage.get_address<etl::shared_message>()) etl::shared_message(other.get_shared_message());
+        }
+      }
+
+      entry& operator =(const entry& other)
+      {
+        if (&other != this)
+        {
+          reset();
+
+          destination_router_id = other.destination_router_id;
+          valid                 = other.valid;
+
+          if (valid)
+          {
+            ::new (storage.get_address<etl::shared_message>()) etl::shared_message(other.get_shared_message());
+          }
+        }
+
+        return *this;
+      }
+
+      ~entry()
+      {
+        reset();
+      }
+
+      etl::message_router_id_t get_destination_router_id() const
+      {
+        return destination_router_id;
+      }
+
+      const etl::shared_message& get_shared_message() const
+      {
+        return *storage.get_address<etl::shared_message>();
+      }
+
+    private:
+
+      void reset()
+      {
+        if (valid)
+        {
+          storage.get_address<etl::shared_message>()->~shared_message();
+          valid = false;
+        }
+      }
+
+      typedef etl::aligned_storage_as<sizeof(etl::shared_message), etl::shared_message>::type storage_t;
+
+      etl::message_router_id_t destination_router_id;
+      bool                     valid;
+      storage_t                storage;
+    };
+
+    //*******************************************
+    /// Pops from the highest priority queue that has a message.
+    //*******************************************
+    bool pop(entry& item)
+    {
+      for (size_t i = N_PRIORITIES_; i != 0U; --i)
+      {
+        if (queues[i - 1U].pop(item))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
+    etl::queue_mpmc_atomic<entry, QUEUE_SIZE_>       queues[N_PRIORITIES_];
+  };
+
+  template <uint_least8_t MAX_ROUTERS_, size_t QUEUE_SIZE_, uint_least8_t N_PRIORITIES_>
+  ETL_CONSTANT size_t queued_message_bus<MAX_ROUTERS_, QUEUE_SIZE_, N_PRIORITIES_>::QUEUE_SIZE;
+
+  template <uint_least8_t MAX_ROUTERS_, size_t QUEUE_SIZE_, uint_least8_t N_PRIORITIES_>
+  ETL_CONSTANT uint_least8_t queued_message_bus<MAX_ROUTERS_, QUEUE_SIZE_, N_PRIORITIES_>::N_PRIORITIES;
+#endif
 }
 
 #endif
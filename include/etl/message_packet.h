@@ -66,9 +66,38 @@ SOFTWARE.
 
 namespace etl
 {
-#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
+#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
+  namespace private_message_packet
+  {
+    //***************************************************************************
+    /// Checks if an id belongs to one of the message types.
+    //***************************************************************************
+    template <typename... TMessageTypes>
+    struct message_id_list;
+
+    template <>
+    struct message_id_list<>
+    {
+      static ETL_CONSTEXPR bool contains(etl::message_id_t)
+      {
+        return false;
+      }
+    };
+
+    template <typename TMessage, typename... TRest>
+    struct message_id_list<TMessage, TRest...>
+    {
+      static ETL_CONSTEXPR bool contains(etl::message_id_t id)
+      {
+        return (TMessage::ID == id) || etl::private_message_packet::message_id_list<TRest...>::contains(id);
+      }
+    };
+  }
+
   //***************************************************************************
   // The definition for all message types.
+  // Used from C++11, so that the packet does not expand a fixed number of
+  // overloads for every message type.
   //***************************************************************************
   template <typename... TMessageTypes>
   class message_packet
@@ -77,13 +106,21 @@ namespace etl
   private:
 
     template <typename T>
-    static constexpr bool IsMessagePacket = etl::is_same_v< etl::remove_const_t<etl::remove_reference_t<T>>, etl::message_packet<TMessageTypes...>>;
+    struct is_message_packet : etl::bool_constant<etl::is_same<typename etl::remove_cvref<T>::type, etl::message_packet<TMessageTypes...> >::value>
+    {
+    };
 
     template <typename T>
-    static constexpr bool IsInMessageList = etl::is_one_of_v<etl::remove_const_t<etl::remove_reference_t<T>>, TMessageTypes...>;
+    struct is_in_message_list : etl::bool_constant<etl::is_one_of<typename etl::remove_cvref<T>::type, TMessageTypes...>::value>
+    {
+    };
 
     template <typename T>
-    static constexpr bool IsIMessage = etl::is_same_v<remove_const_t<etl::remove_reference_t<T>>, etl::imessage>;
+    struct is_imessage : etl::bool_constant<etl::is_same<typename etl::remove_cvref<T>::type, etl::imessage>::value>
+    {
+    };
+
+    typedef etl::private_message_packet::message_id_list<TMessageTypes...> id_list;
 
   public:
 
@@ -96,39 +133,56 @@ namespace etl
 #include "private/diagnostic_pop.h"
 
     //********************************************
-    ///
+    /// Constructs from an etl::imessage.
     //********************************************
 #include "private/diagnostic_uninitialized_push.h"
-    template <typename T, typename = typename etl::enable_if<IsIMessage<T> || IsInMessageList<T>, int>::type>
+    template <typename T, typename etl::enable_if<is_imessage<T>::value, int>::type = 0>
     explicit message_packet(T&& msg)
       : valid(true)
     {
-      if constexpr (IsIMessage<T>)
-      {
-        if (accepts(msg))
-        {
-          add_new_message(etl::forward<T>(msg));
-          valid = true;
-        }
-        else
-        {
-          valid = false;
-        }
-
-        ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-      }
-      else if constexpr (IsInMessageList<T>)
+      if (accepts(msg))
       {
-        add_new_message_type<T>(etl::forward<T>(msg));
+        add_new_message(etl::forward<T>(msg));
+        valid = true;
       }
       else
       {
-        ETL_STATIC_ASSERT(IsInMessageList<T>, "Message not in packet type list");
+        valid = false;
       }
+
+      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
+    }
+#include "private/diagnostic_pop.h"
+
+    //********************************************
+    /// Constructs from one of the message types.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    template <typename T, typename etl::enable_if<is_in_message_list<T>::value, int>::type = 0>
+    explicit message_packet(T&& msg)
+      : valid(true)
+    {
+      add_new_message_type<T>(etl::forward<T>(msg));
+    }
+#include "private/diagnostic_pop.h"
+
+    //********************************************
+    /// Constructs the message directly in the packet.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    template <typename TMessage, typename... TArgs>
+    explicit message_packet(etl::in_place_type_t<TMessage>, TArgs&&... args)
+      : valid(true)
+    {
+      ETL_STATIC_ASSERT(is_in_message_list<TMessage>::value, "Message not in packet type list");
+
+      void* p = data;
+      new (p) TMessage(etl::forward<TArgs>(args)...);
     }
 #include "private/diagnostic_pop.h"
 
     //**********************************************
+#include "private/diagnostic_uninitialized_push.h"
     message_packet(const message_packet& other)
     {
       valid = other.is_valid();
@@ -138,9 +192,10 @@ namespace etl
         add_new_message(other.get());
       }
     }
+#include "private/diagnostic_pop.h"
 
-#if ETL_USING_CPP11
     //**********************************************
+#include "private/diagnostic_uninitialized_push.h"
     message_packet(message_packet&& other)
     {
       valid = other.is_valid();
@@ -150,9 +205,10 @@ namespace etl
         add_new_message(etl::move(other.get()));
       }
     }
-#endif
+#include "private/diagnostic_pop.h"
 
     //**********************************************
+#include "private/diagnostic_uninitialized_push.h"
     void copy(const message_packet& other)
     {
       valid = other.is_valid();
@@ -162,8 +218,10 @@ namespace etl
         add_new_message(other.get());
       }
     }
+#include "private/diagnostic_pop.h"
 
     //**********************************************
+#include "private/diagnostic_uninitialized_push.h"
     void copy(message_packet&& other)
     {
       valid = other.is_valid();
@@ -173,6 +231,7 @@ namespace etl
         add_new_message(etl::move(other.get()));
       }
     }
+#include "private/diagnostic_pop.h"
 
     //**********************************************
 #include "private/diagnostic_uninitialized_push.h"
@@ -210,6 +269,26 @@ namespace etl
       delete_current_message();
     }
 
+    //********************************************
+    /// Replaces the current message with one constructed directly in the packet.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT(is_in_message_list<TMessage>::value, "Message not in packet type list");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* p_msg = new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *p_msg;
+    }
+#include "private/diagnostic_pop.h"
+
     //********************************************
     etl::imessage& get() ETL_NOEXCEPT
     {
@@ -231,7 +310,7 @@ namespace etl
     //**********************************************
     static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
     {
-      return (accepts_message<TMessageTypes::ID>(id) || ...);
+      return id_list::contains(id);
     }
 
     //**********************************************
@@ -244,7 +323,7 @@ namespace etl
     template <etl::message_id_t Id>
     static ETL_CONSTEXPR bool accepts()
     {
-      return (accepts_message<TMessageTypes::ID, Id>() || ...);
+      return id_list::contains(Id);
     }
 
     //**********************************************
@@ -264,20 +343,6 @@ namespace etl
 
   private:
 
-    //**********************************************
-    template <etl::message_id_t Id1, etl::message_id_t Id2>
-    static bool accepts_message()
-    {
-      return Id1 == Id2;
-    }
-
-    //**********************************************
-    template <etl::message_id_t Id1>
-    static bool accepts_message(etl::message_id_t id2)
-    {
-      return Id1 == id2;
-    }
-
     //********************************************
 #include "private/diagnostic_uninitialized_push.h"
     void delete_current_message()
@@ -291,16 +356,22 @@ namespace etl
     }
 #include "private/diagnostic_pop.h"
 
+    //********************************************
+    /// Constructs the message type that matches the id.
     //********************************************
     void add_new_message(const etl::imessage& msg)
     {
-      (add_new_message_type<TMessageTypes>(msg) || ...);
+      bool added = false;
+      int dummy[] = { 0, (added = added || add_new_message_type<TMessageTypes>(msg), 0)... };
+      (void)dummy;
     }
 
     //********************************************
     void add_new_message(etl::imessage&& msg)
     {
-      (add_new_message_type<TMessageTypes>(etl::move(msg)) || ...);
+      bool added = false;
+      int dummy[] = { 0, (added = added || add_new_message_type<TMessageTypes>(etl::move(msg)), 0)... };
+      (void)dummy;
     }
 
 #include "private/diagnostic_uninitialized_push.h"
@@ -308,11 +379,11 @@ namespace etl
     /// Only enabled for types that are in the typelist.
     //********************************************
     template <typename TMessage>
-    etl::enable_if_t<etl::is_one_of_v<etl::remove_const_t<etl::remove_reference_t<TMessage>>, TMessageTypes...>, void>
+    typename etl::enable_if<is_in_message_list<TMessage>::value, void>::type
       add_new_message_type(TMessage&& msg)
     {
       void* p = data;
-      new (p) etl::remove_reference_t<TMessage>((etl::forward<TMessage>(msg)));
+      new (p) typename etl::remove_reference<TMessage>::type((etl::forward<TMessage>(msg)));
     }
 #include "private/diagnostic_pop.h"
 
@@ -393,44 +464,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -447,7 +480,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -461,20 +493,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -490,23 +508,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -617,36 +618,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        case T7::ID: ::new (p) T7(static_cast<T7&&>(msg)); break;
-        case T8::ID: ::new (p) T8(static_cast<T8&&>(msg)); break;
-        case T9::ID: ::new (p) T9(static_cast<T9&&>(msg)); break;
-        case T10::ID: ::new (p) T10(static_cast<T10&&>(msg)); break;
-        case T11::ID: ::new (p) T11(static_cast<T11&&>(msg)); break;
-        case T12::ID: ::new (p) T12(static_cast<T12&&>(msg)); break;
-        case T13::ID: ::new (p) T13(static_cast<T13&&>(msg)); break;
-        case T14::ID: ::new (p) T14(static_cast<T14&&>(msg)); break;
-        case T15::ID: ::new (p) T15(static_cast<T15&&>(msg)); break;
-        case T16::ID: ::new (p) T16(static_cast<T16&&>(msg)); break;
-        default: ETL_ASSERT(false, ETL_ERROR(unhandled_message_exception)); break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -688,44 +659,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -742,7 +675,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -756,20 +688,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -785,23 +703,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -911,35 +812,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        case T7::ID: ::new (p) T7(static_cast<T7&&>(msg)); break;
-        case T8::ID: ::new (p) T8(static_cast<T8&&>(msg)); break;
-        case T9::ID: ::new (p) T9(static_cast<T9&&>(msg)); break;
-        case T10::ID: ::new (p) T10(static_cast<T10&&>(msg)); break;
-        case T11::ID: ::new (p) T11(static_cast<T11&&>(msg)); break;
-        case T12::ID: ::new (p) T12(static_cast<T12&&>(msg)); break;
-        case T13::ID: ::new (p) T13(static_cast<T13&&>(msg)); break;
-        case T14::ID: ::new (p) T14(static_cast<T14&&>(msg)); break;
-        case T15::ID: ::new (p) T15(static_cast<T15&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -981,44 +853,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -1035,7 +869,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -1049,20 +882,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -1078,23 +897,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -1203,34 +1005,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        case T7::ID: ::new (p) T7(static_cast<T7&&>(msg)); break;
-        case T8::ID: ::new (p) T8(static_cast<T8&&>(msg)); break;
-        case T9::ID: ::new (p) T9(static_cast<T9&&>(msg)); break;
-        case T10::ID: ::new (p) T10(static_cast<T10&&>(msg)); break;
-        case T11::ID: ::new (p) T11(static_cast<T11&&>(msg)); break;
-        case T12::ID: ::new (p) T12(static_cast<T12&&>(msg)); break;
-        case T13::ID: ::new (p) T13(static_cast<T13&&>(msg)); break;
-        case T14::ID: ::new (p) T14(static_cast<T14&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -1272,44 +1046,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -1326,7 +1062,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -1340,20 +1075,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -1369,23 +1090,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -1493,33 +1197,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        case T7::ID: ::new (p) T7(static_cast<T7&&>(msg)); break;
-        case T8::ID: ::new (p) T8(static_cast<T8&&>(msg)); break;
-        case T9::ID: ::new (p) T9(static_cast<T9&&>(msg)); break;
-        case T10::ID: ::new (p) T10(static_cast<T10&&>(msg)); break;
-        case T11::ID: ::new (p) T11(static_cast<T11&&>(msg)); break;
-        case T12::ID: ::new (p) T12(static_cast<T12&&>(msg)); break;
-        case T13::ID: ::new (p) T13(static_cast<T13&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -1560,44 +1237,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -1614,7 +1253,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -1628,20 +1266,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -1657,23 +1281,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -1777,32 +1384,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        case T7::ID: ::new (p) T7(static_cast<T7&&>(msg)); break;
-        case T8::ID: ::new (p) T8(static_cast<T8&&>(msg)); break;
-        case T9::ID: ::new (p) T9(static_cast<T9&&>(msg)); break;
-        case T10::ID: ::new (p) T10(static_cast<T10&&>(msg)); break;
-        case T11::ID: ::new (p) T11(static_cast<T11&&>(msg)); break;
-        case T12::ID: ::new (p) T12(static_cast<T12&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -1843,44 +1424,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -1897,7 +1440,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -1911,20 +1453,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -1940,23 +1468,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -2059,31 +1570,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        case T7::ID: ::new (p) T7(static_cast<T7&&>(msg)); break;
-        case T8::ID: ::new (p) T8(static_cast<T8&&>(msg)); break;
-        case T9::ID: ::new (p) T9(static_cast<T9&&>(msg)); break;
-        case T10::ID: ::new (p) T10(static_cast<T10&&>(msg)); break;
-        case T11::ID: ::new (p) T11(static_cast<T11&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -2124,44 +1610,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -2178,7 +1626,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -2192,20 +1639,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -2221,23 +1654,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -2339,30 +1755,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        case T7::ID: ::new (p) T7(static_cast<T7&&>(msg)); break;
-        case T8::ID: ::new (p) T8(static_cast<T8&&>(msg)); break;
-        case T9::ID: ::new (p) T9(static_cast<T9&&>(msg)); break;
-        case T10::ID: ::new (p) T10(static_cast<T10&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -2403,44 +1795,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6, T7, T8, T9>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -2457,7 +1811,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -2471,20 +1824,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -2500,23 +1839,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -2617,29 +1939,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        case T7::ID: ::new (p) T7(static_cast<T7&&>(msg)); break;
-        case T8::ID: ::new (p) T8(static_cast<T8&&>(msg)); break;
-        case T9::ID: ::new (p) T9(static_cast<T9&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -2679,44 +1978,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6, T7, T8>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -2733,7 +1994,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -2747,20 +2007,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -2776,23 +2022,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -2889,28 +2118,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        case T7::ID: ::new (p) T7(static_cast<T7&&>(msg)); break;
-        case T8::ID: ::new (p) T8(static_cast<T8&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -2950,44 +2157,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6, T7>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6, T7> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6, T7>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -3004,7 +2173,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -3018,20 +2186,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -3047,23 +2201,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -3159,27 +2296,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        case T7::ID: ::new (p) T7(static_cast<T7&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -3219,44 +2335,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5, T6>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5, T6> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5, T6>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -3273,7 +2351,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -3287,20 +2364,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -3316,23 +2379,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -3427,26 +2473,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        case T6::ID: ::new (p) T6(static_cast<T6&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -3486,44 +2512,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4, T5>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4, T5> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4, T5>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -3540,7 +2528,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -3554,20 +2541,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -3583,23 +2556,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -3693,25 +2649,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        case T5::ID: ::new (p) T5(static_cast<T5&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -3750,44 +2687,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3, T4>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3, T4> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3, T4>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -3804,7 +2703,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -3818,20 +2716,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -3847,23 +2731,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -3953,24 +2820,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        case T4::ID: ::new (p) T4(static_cast<T4&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -4009,44 +2858,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2, T3>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2, T3> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2, T3>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -4063,7 +2874,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -4077,20 +2887,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -4106,23 +2902,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -4211,23 +2990,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        case T3::ID: ::new (p) T3(static_cast<T3&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -4266,44 +3028,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1, T2>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1, T2> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1, T2>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -4320,7 +3044,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -4334,20 +3057,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -4363,23 +3072,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -4467,22 +3159,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        case T2::ID: ::new (p) T2(static_cast<T2&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
@@ -4521,44 +3197,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    explicit message_packet(etl::imessage&& msg)
-    {
-      if (accepts(msg))
-      {
-        add_new_message(etl::move(msg));
-        valid = true;
-      }
-      else
-      {
-        valid = false;
-      }
-
-      ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)
-    //********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1> >::value &&
-                                                                    !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                                                    !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, T1>::value, int>::type>
-    explicit message_packet(TMessage&& /*msg*/)
-      : valid(true)
-    {
-      // Not etl::message_packet, not etl::imessage and in typelist.
-      static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<T1> >::value &&
-                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&
-                                       etl::is_one_of<typename etl::remove_cvref<TMessage>::type,T1>::value);
-
-      ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
-    }
-  #include "private/diagnostic_pop.h"
-  #else
     //********************************************
   #include "private/diagnostic_uninitialized_push.h"
     template <typename TMessage>
@@ -4575,7 +3213,6 @@ namespace etl
       ETL_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
   #include "private/diagnostic_pop.h"
-  #endif
 
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
@@ -4589,20 +3226,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
-    {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //**********************************************
   #include "private/diagnostic_uninitialized_push.h"
     message_packet& operator =(const message_packet& rhs)
@@ -4618,23 +3241,6 @@ namespace etl
     }
   #include "private/diagnostic_pop.h"
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //**********************************************
-  #include "private/diagnostic_uninitialized_push.h"
-    message_packet& operator =(message_packet&& rhs)
-    {
-      delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
-
-      return *this;
-    }
-  #include "private/diagnostic_pop.h"
-  #endif
-
     //********************************************
     ~message_packet()
     {
@@ -4721,21 +3327,6 @@ namespace etl
       }
     }
 
-  #if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
-    //********************************************
-    void add_new_message(etl::imessage&& msg)
-    {
-      const size_t id = msg.get_message_id();
-      void* p = data;
-
-      switch (id)
-      {
-        case T1::ID: ::new (p) T1(static_cast<T1&&>(msg)); break;
-        default: break;
-      }
-    }
-  #endif
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
     bool valid;
   };
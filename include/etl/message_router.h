@@ -65,6 +65,7 @@ SOFTWARE.
 #include "nullptr.h"
 #include "placement_new.h"
 #include "successor.h"
+#include "trace.h"
 #include "type_traits.h"
 
 #include <stdint.h>
@@ -404,8 +405,167 @@ namespace etl
 // For C++17 and above.
 //*************************************************************************************************
 #if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+  namespace private_message_router
+  {
+    //***************************************************************************
+    /// A compile time table that maps message ids to handlers in constant time.
+    /// If the ids are dense enough, a jump table indexed by 'id - Min_Id' is used.
+    /// Otherwise the ids are sorted and binary searched.
+    /// Where an id appears more than once, the first handler is used.
+    ///\tparam THandler The handler function pointer type.
+    ///\tparam Ids      The message ids, in the same order as the handlers.
+    //***************************************************************************
+    template <typename THandler, etl::message_id_t... Ids>
+    class dispatch_table
+    {
+    public:
+
+      static constexpr size_t Count = sizeof...(Ids);
+
+      static_assert(Count != 0U, "dispatch_table requires at least one id");
+
+      //*********************************
+      static constexpr etl::message_id_t min_id()
+      {
+        const etl::message_id_t ids[Count] = { Ids... };
+        etl::message_id_t result = ids[0];
+
+        for (size_t i = 1U; i < Count; ++i)
+        {
+          result = (ids[i] < result) ? ids[i] : result;
+        }
+
+        return result;
+      }
+
+      //*********************************
+      static constexpr etl::message_id_t max_id()
+      {
+        const etl::message_id_t ids[Count] = { Ids... };
+        etl::message_id_t result = ids[0];
+
+        for (size_t i = 1U; i < Count; ++i)
+        {
+          result = (ids[i] > result) ? ids[i] : result;
+        }
+
+        return result;
+      }
+
+      static constexpr etl::message_id_t Min_Id = min_id();
+      static constexpr etl::message_id_t Max_Id = max_id();
+      static constexpr size_t            Range  = static_cast<size_t>(Max_Id - Min_Id) + 1U;
+
+      /// Use a jump table if at least a quarter of its entries would be used.
+      static constexpr bool Is_Jump_Table = (Range <= (Count * 4U));
+
+      //*********************************
+      template <typename... THandlers>
+      constexpr dispatch_table(THandlers... handlers_)
+        : jump_table{}
+        , sorted_ids{}
+        , sorted_handlers{}
+      {
+        static_assert(sizeof...(THandlers) == Count, "There must be a handler for each id");
+
+        const etl::message_id_t ids[Count]      = { Ids... };
+        const THandler          handlers[Count] = { handlers_... };
+
+        if constexpr (Is_Jump_Table)
+        {
+          // Fill from the back, so that the first handler for an id wins.
+          for (size_t i = Count; i-- != 0U;)
+          {
+            jump_table[ids[i] - Min_Id] = handlers[i];
+          }
+        }
+        else
+        {
+          // Insertion sort, keeping the first handler for an id.
+          size_t n = 0U;
+
+          for (size_t i = 0U; i < Count; ++i)
+          {
+            size_t j = n;
+
+            while ((j != 0U) && (sorted_ids[j - 1U] > ids[i]))
+            {
+              --j;
+            }
+
+            if ((j != 0U) && (sorted_ids[j - 1U] == ids[i]))
+            {
+              continue;
+            }
+
+            for (size_t k = n; k != j; --k)
+            {
+              sorted_ids[k]      = sorted_ids[k - 1U];
+              sorted_handlers[k] = sorted_handlers[k - 1U];
+            }
+
+            sorted_ids[j]      = ids[i];
+            sorted_handlers[j] = handlers[i];
+            ++n;
+          }
+
+          // Pad any duplicate entries with the largest id, so the search range stays sorted.
+          for (size_t i = n; i < Count; ++i)
+          {
+            sorted_ids[i]      = sorted_ids[n - 1U];
+            sorted_handlers[i] = sorted_handlers[n - 1U];
+          }
+        }
+      }
+
+      //*********************************
+      /// Gets the handler for the id, or ETL_NULLPTR if there is none.
+      //*********************************
+      THandler find(etl::message_id_t id) const
+      {
+        if constexpr (Is_Jump_Table)
+        {
+          const size_t index = static_cast<size_t>(id - Min_Id);
+
+          // Ids below Min_Id wrap to a large index.
+          return (index < Range) ? jump_table[index] : ETL_NULLPTR;
+        }
+        else
+        {
+          size_t first = 0U;
+          size_t count = Count;
+
+          while (count != 0U)
+          {
+            const size_t step = count / 2U;
+
+            if (sorted_ids[first + step] < id)
+            {
+              first += step + 1U;
+              count -= step + 1U;
+            }
+            else
+            {
+              count = step;
+            }
+          }
+
+          return ((first < Count) && (sorted_ids[first] == id)) ? sorted_handlers[first] : ETL_NULLPTR;
+        }
+      }
+
+    private:
+
+      THandler          jump_table[Is_Jump_Table ? Range : 1U];
+      etl::message_id_t sorted_ids[Is_Jump_Table ? 1U : Count];
+      THandler          sorted_handlers[Is_Jump_Table ? 1U : Count];
+    };
+  }
+
   //***************************************************************************
   // The definition for all message types.
+  // Messages are dispatched through a compile time table of the message ids,
+  // so receive and accepts take constant time, whatever the number of types.
   //***************************************************************************
   template <typename TDerived, typename... TMessageTypes>
   class message_router : public imessage_router
@@ -447,9 +607,15 @@ namespace etl
 
     void receive(const etl::imessage& msg) ETL_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
+      const handler_type handler = find_handler(msg.get_message_id());
 
-      if (!was_handled)
+      if (handler != ETL_NULLPTR)
+      {
+        handler(*this, msg);
+      }
+      else
       {
         if (has_successor())
         {
@@ -465,6 +631,8 @@ namespace etl
     template <typename TMessage, typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value, int>::type = 0>
     void receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if constexpr (etl::is_one_of<TMessage, TMessageTypes...>::value)
       {
         static_cast<TDerived*>(this)->on_receive(msg);
@@ -487,7 +655,21 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      if (find_handler(id) != ETL_NULLPTR)
+      {
+        return true;
+      }
+      else
+      {
+        if (has_successor())
+        {
+          return get_successor().accepts(id);
+        }
+        else
+        {
+          return false;
+        }
+      }
     }
 
     //********************************************
@@ -510,39 +692,29 @@ namespace etl
 
   private:
 
+    typedef void (*handler_type)(message_router&, const etl::imessage&);
+
     //********************************************
     template <typename TMessage>
-    bool receive_message_type(const etl::imessage& msg)
+    static void receive_message_type(message_router& router, const etl::imessage& msg)
     {
-      if (TMessage::ID == msg.get_message_id())
-      {
-        static_cast<TDerived*>(this)->on_receive(static_cast<const TMessage&>(msg));
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      static_cast<TDerived&>(router).on_receive(static_cast<const TMessage&>(msg));
     }
 
     //********************************************
-    template <typename TMessage>
-    bool accepts_type(etl::message_id_t id) const
+    static handler_type find_handler(etl::message_id_t id)
     {
-      if (TMessage::ID == id)
+      if constexpr (sizeof...(TMessageTypes) == 0U)
       {
-        return true;
+        (void)id;
+        return ETL_NULLPTR;
       }
       else
       {
-        if (has_successor())
-        {
-          return get_successor().accepts(id);
-        }
-        else
-        {
-          return false;
-        }
+        static constexpr etl::private_message_router::dispatch_table<handler_type, TMessageTypes::ID...>
+          table(&message_router::template receive_message_type<TMessageTypes>...);
+
+        return table.find(id);
       }
     }
   };
@@ -599,6 +771,8 @@ namespace etl
     {
       const etl::message_id_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -636,6 +810,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -643,6 +819,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -746,6 +924,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -782,6 +962,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -789,6 +971,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -893,6 +1077,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -928,6 +1114,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -935,6 +1123,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -1039,6 +1229,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1073,6 +1265,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -1080,6 +1274,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -1183,6 +1379,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1216,6 +1414,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -1223,6 +1423,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -1326,6 +1528,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1358,6 +1562,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -1365,6 +1571,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -1468,6 +1676,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1499,6 +1709,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -1506,6 +1718,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -1609,6 +1823,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1639,6 +1855,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -1646,6 +1864,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -1748,6 +1968,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1777,6 +1999,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -1784,6 +2008,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -1886,6 +2112,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1914,6 +2142,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -1921,6 +2151,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -2022,6 +2254,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -2049,6 +2283,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -2056,6 +2292,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -2157,6 +2395,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -2183,6 +2423,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -2190,6 +2432,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -2290,6 +2534,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -2315,6 +2561,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -2322,6 +2570,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -2422,6 +2672,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -2446,6 +2698,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -2453,6 +2707,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -2553,6 +2809,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -2576,6 +2834,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -2583,6 +2843,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
@@ -2683,6 +2945,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), id));
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -2705,6 +2969,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       static_cast<TDerived*>(this)->on_receive(msg);
     }
 
@@ -2712,6 +2978,8 @@ namespace etl
     typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1>::value, void>::type
       receive(const TMessage& msg)
     {
+      ETL_TRACE(etl::trace_id::Message_Router_Receive, etl::trace_payload(get_message_router_id(), msg.get_message_id()));
+
       if (has_successor())
       {
         get_successor().receive(msg);
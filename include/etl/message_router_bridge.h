@@ -0,0 +1,258 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_MESSAGE_ROUTER_BRIDGE_INCLUDED
+#define ETL_MESSAGE_ROUTER_BRIDGE_INCLUDED
+
+#include "platform.h"
+#include "message.h"
+#include "message_types.h"
+#include "message_router.h"
+#include "queue_spsc_atomic.h"
+#include "memory_model.h"
+#include "delegate.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup message_router_bridge message_router_bridge
+/// Carries messages between two message buses, typically one on each core of
+/// a multi-core device, through a pair of single producer, single consumer rings.
+///\ingroup messaging
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup message_router_bridge
+  /// One end of a link between two message buses.
+  ///
+  /// Subscribed to the local bus, it accepts the message types of TPacket and
+  /// copies each one it receives straight into the 'outgoing' ring, then calls
+  /// the notify delegate so that the other side may be signalled, for example
+  /// by raising an inter-processor interrupt.
+  ///
+  /// process() is called on the receiving side, typically from that interrupt,
+  /// and dispatches each packet in the 'incoming' ring to the local destination
+  /// in place, without copying it out of the ring. Messages dispatched this way
+  /// are not sent back across the link, even though the bridge is subscribed to
+  /// the same bus.
+  ///
+  /// The rings are etl::queue_spsc_atomic<TPacket, SIZE, Memory_Model> objects
+  /// that the application places in memory shared by both sides. receive() is
+  /// the only producer for 'outgoing' and process() the only consumer for
+  /// 'incoming'. When the two sides run separate images the atomics must be
+  /// lock free and, unless ETL_MESSAGES_ARE_NOT_VIRTUAL is defined, the message
+  /// types must have the same vtable addresses in both.
+  //***************************************************************************
+  template <typename TPacket, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class message_router_bridge : public etl::imessage_router
+  {
+  public:
+
+    typedef TPacket                                        packet_type;
+    typedef etl::iqueue_spsc_atomic<TPacket, Memory_Model> queue_type;
+    typedef etl::delegate<void(void)>                      notify_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param id          The router id used when subscribing to the local bus.
+    ///\param outgoing    The ring carrying messages to the other side.
+    ///\param incoming    The ring carrying messages from the other side.
+    ///\param destination Where incoming messages are dispatched; usually the local bus.
+    ///\param notify      Called after each message is queued for the other side.
+    //*************************************************************************
+    message_router_bridge(etl::message_router_id_t id,
+                          queue_type&              outgoing_,
+                          queue_type&              incoming_,
+                          etl::imessage_router&    destination_,
+                          notify_type              notify_ = notify_type())
+      : imessage_router(id)
+      , outgoing(outgoing_)
+      , incoming(incoming_)
+      , destination(destination_)
+      , notify(notify_)
+      , p_dispatching(ETL_NULLPTR)
+      , dropped_count(0U)
+    {
+    }
+
+    //*************************************************************************
+    using imessage_router::receive;
+
+    //*************************************************************************
+    /// Queues an accepted message for the other side.
+    /// If the outgoing ring is full the message is dropped and counted.
+    //*************************************************************************
+    void receive(const etl::imessage& msg) ETL_OVERRIDE
+    {
+      // Messages that came from the other side are not sent back.
+      if (&msg != p_dispatching)
+      {
+        if (TPacket::accepts(msg.get_message_id()))
+        {
+          if (outgoing.emplace(msg))
+          {
+            if (notify.is_valid())
+            {
+              notify();
+            }
+          }
+          else
+          {
+            ++dropped_count;
+          }
+        }
+        else if (has_successor())
+        {
+          get_successor().receive(msg);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Dispatches every message waiting in the incoming ring to the destination.
+    /// Returns the number of messages dispatched.
+    //*************************************************************************
+    size_t process()
+    {
+      size_t count = 0U;
+
+      while (process_one())
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Dispatches at most one waiting message to the destination.
+    /// Returns <b>true</b> if a message was dispatched.
+    //*************************************************************************
+    bool process_one()
+    {
+      bool dispatched = !incoming.empty();
+
+      if (dispatched)
+      {
+        const etl::imessage& msg = incoming.front().get();
+
+        p_dispatching = &msg;
+        destination.receive(msg);
+        p_dispatching = ETL_NULLPTR;
+
+        incoming.pop();
+      }
+
+      return dispatched;
+    }
+
+    //*************************************************************************
+    /// The number of messages dropped because the outgoing ring was full.
+    //*************************************************************************
+    size_t dropped() const
+    {
+      return dropped_count;
+    }
+
+    //*************************************************************************
+    /// Clears the dropped message count.
+    //*************************************************************************
+    void clear_dropped()
+    {
+      dropped_count = 0U;
+    }
+
+    //*************************************************************************
+    /// Sets the delegate called after a message is queued for the other side.
+    //*************************************************************************
+    void set_notify(notify_type notify_)
+    {
+      notify = notify_;
+    }
+
+    //*************************************************************************
+    using imessage_router::accepts;
+
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      if (TPacket::accepts(id))
+      {
+        return true;
+      }
+      else if (has_successor())
+      {
+        return get_successor().accepts(id);
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    bool is_producer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //*************************************************************************
+    bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+  private:
+
+    // Disabled.
+    message_router_bridge(const message_router_bridge&) ETL_DELETE;
+    message_router_bridge& operator =(const message_router_bridge&) ETL_DELETE;
+
+    queue_type&           outgoing;
+    queue_type&           incoming;
+    etl::imessage_router& destination;
+    notify_type           notify;
+    const etl::imessage*  p_dispatching;
+    size_t                dropped_count;
+  };
+}
+
+#endif
+#endif
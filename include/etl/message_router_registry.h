@@ -37,6 +37,9 @@ SOFTWARE.
 #include "error_handler.h"
 #include "iterator.h"
 #include "memory.h"
+#include "algorithm.h"
+#include "integral_limits.h"
+#include "static_assert.h"
 
 #include <stdint.h>
 
@@ -70,6 +73,10 @@ namespace etl
 
   //***************************************************************************
   /// This is the base of all message router registries.
+  /// Routers are held in a flat_multimap sorted by ID.
+  /// A registry may also have a dense index, an array of the first router
+  /// registered for each ID below the index size, so that find() for those IDs
+  /// is a single load rather than a binary search.
   //***************************************************************************
   class imessage_router_registry
   {
@@ -295,9 +302,14 @@ namespace etl
     //********************************************
     etl::imessage_router* find(etl::message_router_id_t id)
     {
+      if (id < dense_size)
+      {
+        return p_dense[id];
+      }
+
       IRegistry::iterator itr = registry.find(id);
 
-      if (registry.find(id) != registry.end())
+      if (itr != registry.end())
       {
         return itr->second;
       }
@@ -309,9 +321,14 @@ namespace etl
 
     const etl::imessage_router* find(etl::message_router_id_t id) const
     {
+      if (id < dense_size)
+      {
+        return p_dense[id];
+      }
+
       IRegistry::const_iterator itr = registry.find(id);
 
-      if (registry.find(id) != registry.end())
+      if (itr != registry.end())
       {
         return itr->second;
       }
@@ -355,9 +372,17 @@ namespace etl
     {
       if (!registry.full() && !contains(router))
       {
-        IRegistry::value_type element(router.get_message_router_id(), &router);
+        const etl::message_router_id_t id = router.get_message_router_id();
+
+        IRegistry::value_type element(id, &router);
 
         registry.insert(element);
+
+        // The first router registered with an ID is the one found.
+        if ((id < dense_size) && (p_dense[id] == ETL_NULLPTR))
+        {
+          p_dense[id] = &router;
+        }
       }
       else
       {
@@ -397,6 +422,11 @@ namespace etl
     void remove(etl::message_router_id_t id)
     {
       registry.erase(id);
+
+      if (id < dense_size)
+      {
+        p_dense[id] = ETL_NULLPTR;
+      }
     }
 
     //********************************************
@@ -406,9 +436,6 @@ namespace etl
     bool contains(const etl::message_router_id_t id) const
     {
       return find(id) != ETL_NULLPTR;
-
-
-      //return registry.find(id) != registry.end();
     }
 
     //********************************************
@@ -486,34 +513,73 @@ namespace etl
       return registry.max_size();
     }
 
+    //********************************************
+    /// Returns the number of IDs in the dense index.
+    //********************************************
+    size_t dense_index_size() const
+    {
+      return dense_size;
+    }
+
   protected:
 
     //********************************************
     // Constructor.
     //********************************************
-    imessage_router_registry(IRegistry& registry_)
+    imessage_router_registry(IRegistry& registry_, etl::imessage_router** p_dense_, size_t dense_size_)
       : registry(registry_)
+      , p_dense(p_dense_)
+      , dense_size(dense_size_)
     {
+      etl::fill_n(p_dense, dense_size, static_cast<etl::imessage_router*>(ETL_NULLPTR));
+    }
+
+    //********************************************
+    // Rebuilds the dense index from the registry.
+    //********************************************
+    void rebuild_dense_index()
+    {
+      etl::fill_n(p_dense, dense_size, static_cast<etl::imessage_router*>(ETL_NULLPTR));
+
+      // Iterate in reverse so that the first router for each ID is the one kept.
+      IRegistry::reverse_iterator itr = registry.rbegin();
+
+      while (itr != registry.rend())
+      {
+        if (itr->first < dense_size)
+        {
+          p_dense[itr->first] = itr->second;
+        }
+
+        ++itr;
+      }
     }
 
   private:
 
-    IRegistry& registry;
+    IRegistry&             registry;
+    etl::imessage_router** p_dense;    ///< The first router for each ID below dense_size.
+    size_t                 dense_size; ///< The number of IDs in the dense index.
   };
 
   //***************************************************************************
   /// Message router registry.
+  ///\tparam MaxRouters The maximum number of routers.
+  ///\tparam Dense_Ids  Routers with IDs less than this are also held in the dense index,
+  ///                   so that they are found in O(1). The default is 0, no dense index.
   //***************************************************************************
-  template <size_t MaxRouters>
+  template <size_t MaxRouters, size_t Dense_Ids = 0U>
   class message_router_registry : public etl::imessage_router_registry
   {
   public:
 
+    ETL_STATIC_ASSERT(Dense_Ids <= (size_t(etl::integral_limits<etl::message_router_id_t>::max) + 1U), "Dense_Ids exceeds the range of message_router_id_t");
+
     //********************************************
     // Default constructor.
     //********************************************
     message_router_registry()
-      : imessage_router_registry(registry)
+      : imessage_router_registry(registry, dense, Dense_Ids)
     {
     }
 
@@ -523,7 +589,7 @@ namespace etl
     //********************************************
     template <typename TIterator>
     message_router_registry(TIterator first, const TIterator& last)
-       : imessage_router_registry(registry)
+       : imessage_router_registry(registry, dense, Dense_Ids)
     {
       while (first != last)
       {
@@ -537,7 +603,7 @@ namespace etl
     // Initializer_list constructor.
     //********************************************
     message_router_registry(std::initializer_list<etl::imessage_router*> init)
-      : imessage_router_registry(registry)
+      : imessage_router_registry(registry, dense, Dense_Ids)
     {
       std::initializer_list<etl::imessage_router*>::const_iterator itr = init.begin();
 
@@ -553,9 +619,10 @@ namespace etl
     // Copy constructor.
     //********************************************
     message_router_registry(const message_router_registry& rhs)
-      : imessage_router_registry(registry)
+      : imessage_router_registry(registry, dense, Dense_Ids)
     {
       registry = rhs.registry;
+      this->rebuild_dense_index();
     }
 
     //********************************************
@@ -564,6 +631,7 @@ namespace etl
     message_router_registry& operator =(const message_router_registry& rhs)
     {
       registry = rhs.registry;
+      this->rebuild_dense_index();
 
       return *this;
     }
@@ -572,6 +640,9 @@ namespace etl
 
     typedef etl::flat_multimap<etl::message_router_id_t, etl::imessage_router*, MaxRouters> Registry;
     Registry registry;
+
+    // The dense index. Always at least one element, as zero sized arrays are not allowed.
+    etl::imessage_router* dense[Dense_Ids == 0U ? 1U : Dense_Ids];
   };
 }
 
@@ -446,6 +446,9 @@ namespace etl
     //*******************************************
     // Called by the timer service to indicate the
     // amount of time that has elapsed since the last successful call to 'tick'.
+    // Every timer that expires within 'count' is processed in the one call,
+    // so a tickless caller may sleep for 'time_to_next()' and pass the
+    // actual time slept.
     // Returns true if the tick was processed,
     // false if not.
     //*******************************************
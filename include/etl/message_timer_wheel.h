@@ -0,0 +1,511 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_TIMER_WHEEL_INCLUDED
+#define ETL_MESSAGE_TIMER_WHEEL_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "message_types.h"
+#include "message.h"
+#include "message_router.h"
+#include "message_bus.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "atomic.h"
+#include "placement_new.h"
+
+#include "private/timer_wheel.h"
+
+#include <stdint.h>
+
+#if defined(ETL_IN_UNIT_TEST) && ETL_NOT_USING_STL
+  #define ETL_DISABLE_TIMER_UPDATES
+  #define ETL_ENABLE_TIMER_UPDATES
+  #define ETL_TIMER_UPDATES_ENABLED true
+
+  #undef ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK
+  #undef ETL_MESSAGE_TIMER_USE_INTERRUPT_LOCK
+#else
+  #if !defined(ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK) && !defined(ETL_MESSAGE_TIMER_USE_INTERRUPT_LOCK)
+    #error ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK or ETL_MESSAGE_TIMER_USE_INTERRUPT_LOCK not defined
+  #endif
+
+  #if defined(ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK) && defined(ETL_MESSAGE_TIMER_USE_INTERRUPT_LOCK)
+    #error Only define one of ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK or ETL_MESSAGE_TIMER_USE_INTERRUPT_LOCK
+  #endif
+
+  #if defined(ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK)
+    #define ETL_DISABLE_TIMER_UPDATES (++process_semaphore)
+    #define ETL_ENABLE_TIMER_UPDATES  (--process_semaphore)
+    #define ETL_TIMER_UPDATES_ENABLED (process_semaphore.load() == 0)
+  #endif
+
+  #if defined(ETL_MESSAGE_TIMER_USE_INTERRUPT_LOCK)
+    #if !defined(ETL_MESSAGE_TIMER_DISABLE_INTERRUPTS) || !defined(ETL_MESSAGE_TIMER_ENABLE_INTERRUPTS)
+      #error ETL_MESSAGE_TIMER_DISABLE_INTERRUPTS and/or ETL_MESSAGE_TIMER_ENABLE_INTERRUPTS not defined
+    #endif
+
+    #define ETL_DISABLE_TIMER_UPDATES ETL_MESSAGE_TIMER_DISABLE_INTERRUPTS
+    #define ETL_ENABLE_TIMER_UPDATES  ETL_MESSAGE_TIMER_ENABLE_INTERRUPTS
+    #define ETL_TIMER_UPDATES_ENABLED true
+  #endif
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for the message timer wheel.
+  /// Has the same interface as etl::imessage_timer, but keeps the active
+  /// timers in a hierarchical timing wheel rather than a sorted list.
+  /// start() and stop() are O(1) and tick() is amortised O(1) per tick.
+  //***************************************************************************
+  class imessage_timer_wheel
+  {
+  public:
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(const etl::imessage&     message_,
+                                        etl::imessage_router&    router_,
+                                        uint32_t                 period_,
+                                        bool                     repeating_,
+                                        etl::message_router_id_t destination_router_id_ = etl::imessage_router::ALL_MESSAGE_ROUTERS)
+    {
+      etl::timer::id::type id = etl::timer::id::NO_TIMER;
+
+      // There's no point adding null message routers.
+      if ((registered_timers < MAX_TIMERS) && !router_.is_null_router())
+      {
+        // Search for the free space.
+        for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+        {
+          timer_data& timer = timer_array[i];
+
+          if (timer.id == etl::timer::id::NO_TIMER)
+          {
+            // Create in-place.
+            new (&timer) timer_data(i, message_, router_, period_, repeating_, destination_router_id_);
+            ++registered_timers;
+            id = i;
+            break;
+          }
+        }
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            wheel.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          // Reset in-place.
+          new (&timer) timer_data();
+          --registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      wheel.clear();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      for (int i = 0; i < MAX_TIMERS; ++i)
+      {
+        new (&timer_array[i]) timer_data();
+      }
+
+      registered_timers = 0;
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Every timer that expires within 'count' is processed in the one call,
+    // so a tickless caller may sleep for 'time_to_next()' and pass the
+    // actual time slept.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (ETL_TIMER_UPDATES_ENABLED)
+        {
+          etl::timer::id::type id = wheel.next_expired(count);
+
+          while (id != etl::timer::id::NO_TIMER)
+          {
+            timer_data& timer = timer_array[id];
+
+            if (timer.repeating)
+            {
+              // Reinsert the timer.
+              wheel.insert(timer.id, timer.period);
+            }
+
+            if (timer.p_router != ETL_NULLPTR)
+            {
+              timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
+            }
+
+            id = wheel.next_expired(count);
+          }
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(etl::timer::id::type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::Inactive)
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            if (timer.is_active())
+            {
+              wheel.remove(timer.id);
+            }
+
+            wheel.insert(timer.id, immediate_ ? 0U : timer.period);
+            ETL_ENABLE_TIMER_UPDATES;
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            wheel.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(etl::timer::id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Check if there is an active timer.
+    //*******************************************
+    bool has_active_timer() const
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      bool result = !wheel.empty();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      return result;
+    }
+
+    //*******************************************
+    /// Get the time to the next timer event.
+    /// Returns etl::timer::interval::No_Active_Interval if there is no active timer.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      uint32_t delta = wheel.time_to_next();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      return delta;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The configuration of a timer.
+    //*************************************************************************
+    struct timer_data
+    {
+      //*******************************************
+      timer_data()
+        : p_message(ETL_NULLPTR)
+        , p_router(ETL_NULLPTR)
+        , period(0U)
+        , expiry(0U)
+        , destination_router_id(etl::imessage_bus::ALL_MESSAGE_ROUTERS)
+        , id(etl::timer::id::NO_TIMER)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , bucket(private_timer_wheel::bucket::No_Bucket)
+        , repeating(true)
+      {
+      }
+
+      //*******************************************
+      timer_data(etl::timer::id::type     id_,
+                 const etl::imessage&     message_,
+                 etl::imessage_router&    irouter_,
+                 uint32_t                 period_,
+                 bool                     repeating_,
+                 etl::message_router_id_t destination_router_id_)
+        : p_message(&message_)
+        , p_router(&irouter_)
+        , period(period_)
+        , expiry(0U)
+        , destination_router_id(destination_router_id_)
+        , id(id_)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , bucket(private_timer_wheel::bucket::No_Bucket)
+        , repeating(repeating_)
+      {
+      }
+
+      //*******************************************
+      /// Returns true if the timer is active.
+      //*******************************************
+      bool is_active() const
+      {
+        return bucket != private_timer_wheel::bucket::No_Bucket;
+      }
+
+      const etl::imessage*              p_message;
+      etl::imessage_router*             p_router;
+      uint32_t                          period;
+      uint32_t                          expiry;
+      etl::message_router_id_t          destination_router_id;
+      etl::timer::id::type              id;
+      etl::timer::id::type              previous;
+      etl::timer::id::type              next;
+      private_timer_wheel::bucket::type bucket;
+      bool                              repeating;
+
+    private:
+
+      // Disabled.
+      timer_data(const timer_data& other) ETL_DELETE;
+      timer_data& operator =(const timer_data& other) ETL_DELETE;
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    imessage_timer_wheel(timer_data* const           timer_array_,
+                         const uint_least8_t         MAX_TIMERS_,
+                         etl::timer::id::type* const bucket_array_,
+                         uint_least8_t               slot_bits_,
+                         uint_least8_t               levels_)
+      : timer_array(timer_array_),
+        wheel(timer_array_, bucket_array_, slot_bits_, levels_),
+        enabled(false),
+#if defined(ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK)
+        process_semaphore(0),
+#endif
+        registered_timers(0),
+        MAX_TIMERS(MAX_TIMERS_)
+    {
+    }
+
+    //*******************************************
+    /// Destructor.
+    //*******************************************
+    ~imessage_timer_wheel()
+    {
+    }
+
+  private:
+
+    // The array of timer data structures.
+    timer_data* const timer_array;
+
+    // The wheel of active timers.
+    private_timer_wheel::timer_wheel<timer_data> wheel;
+
+    bool enabled;
+
+#if defined(ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK)
+
+#if defined(ETL_TIMER_SEMAPHORE_TYPE)
+    typedef ETL_TIMER_SEMAPHORE_TYPE timer_semaphore_t;
+#else
+  #if ETL_HAS_ATOMIC
+    typedef etl::atomic_uint16_t timer_semaphore_t;
+  #else
+    #error No atomic type available
+  #endif
+#endif
+
+    mutable etl::timer_semaphore_t process_semaphore;
+#endif
+    uint_least8_t registered_timers;
+
+  public:
+
+    const uint_least8_t MAX_TIMERS;
+  };
+
+  //***************************************************************************
+  /// The message timer wheel.
+  ///\tparam MAX_TIMERS_ The maximum number of timers.
+  ///\tparam SLOTS_      The number of slots per level of the wheel. A power of 2.
+  ///                    More slots use more RAM but cascade less often.
+  //***************************************************************************
+  template <const uint_least8_t MAX_TIMERS_, const uint_least16_t SLOTS_ = 16U>
+  class message_timer_wheel : public etl::imessage_timer_wheel
+  {
+  private:
+
+    typedef private_timer_wheel::wheel_size<SLOTS_> wheel_size;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254, "No more than 254 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_timer_wheel()
+      : imessage_timer_wheel(timer_array, MAX_TIMERS_, bucket_array, wheel_size::Slot_Bits, wheel_size::Levels)
+    {
+    }
+
+  private:
+
+    timer_data           timer_array[MAX_TIMERS_];
+    etl::timer::id::type bucket_array[wheel_size::Buckets];
+  };
+}
+
+#undef ETL_DISABLE_TIMER_UPDATES
+#undef ETL_ENABLE_TIMER_UPDATES
+#undef ETL_TIMER_UPDATES_ENABLED
+
+#endif
@@ -0,0 +1,218 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MOVING_AVERAGE_INCLUDED
+#define ETL_MOVING_AVERAGE_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "pseudo_moving_average.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_moving_average
+  {
+    //***************************************************
+    /// The default type used to hold the running sum.
+    /// Integral samples are summed in the widest integral type of the same
+    /// signedness, floating point samples in their own type.
+    //***************************************************
+    template <typename T, bool IsIntegral = etl::is_integral<T>::value>
+    struct sum_type
+    {
+      typedef T type;
+    };
+
+    template <typename T>
+    struct sum_type<T, true>
+    {
+      typedef typename etl::conditional<etl::is_signed<T>::value, intmax_t, uintmax_t>::type type;
+    };
+  }
+
+  //***************************************************************************
+  /// Moving Average
+  /// The exact average of the last WINDOW_SIZE samples.
+  /// Keeps the samples in a ring buffer and a running sum, so each new sample
+  /// costs O(1) regardless of the window size.
+  /// For floating point types the sum is recalculated from the window each
+  /// time the ring buffer wraps, which stops rounding errors accumulating.
+  /// \tparam T           The sample value type.
+  /// \tparam WINDOW_SIZE The number of samples to average over.
+  /// \tparam TSum        The type used for the running sum.
+  //***************************************************************************
+  template <typename T,
+            const size_t WINDOW_SIZE_,
+            typename TSum = typename private_moving_average::sum_type<T>::type>
+  class moving_average
+  {
+  private:
+
+    typedef moving_average<T, WINDOW_SIZE_, TSum> this_t;
+
+    ETL_STATIC_ASSERT(WINDOW_SIZE_ != 0U, "The window size must not be zero");
+
+  public:
+
+    typedef T    value_type;
+    typedef TSum sum_type;
+    typedef private_pseudo_moving_average::add_insert_iterator<this_t> add_insert_iterator;
+
+    static ETL_CONSTANT size_t WINDOW_SIZE = WINDOW_SIZE_; ///< The number of samples averaged over.
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    moving_average()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the window.
+    //*************************************************************************
+    void clear()
+    {
+      sum       = TSum(0);
+      next      = 0U;
+      n_samples = 0U;
+    }
+
+    //*************************************************************************
+    /// Adds a new sample to the window, replacing the oldest if it is full.
+    /// \param new_value The value to add.
+    //*************************************************************************
+    void add(T new_value)
+    {
+      if (n_samples == WINDOW_SIZE)
+      {
+        sum -= TSum(samples[next]);
+      }
+      else
+      {
+        ++n_samples;
+      }
+
+      samples[next] = new_value;
+      sum += TSum(new_value);
+
+      if (++next == WINDOW_SIZE)
+      {
+        next = 0U;
+
+        if (etl::is_floating_point<TSum>::value)
+        {
+          resum();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the average of the samples in the window.
+    /// \return The current average, or zero if there are no samples.
+    //*************************************************************************
+    T value() const
+    {
+      return (n_samples == 0U) ? T(0) : T(sum / TSum(n_samples));
+    }
+
+    //*************************************************************************
+    /// Gets the sum of the samples in the window.
+    //*************************************************************************
+    TSum total() const
+    {
+      return sum;
+    }
+
+    //*************************************************************************
+    /// Gets the number of samples in the window.
+    //*************************************************************************
+    size_t size() const
+    {
+      return n_samples;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no samples in the window.
+    //*************************************************************************
+    bool empty() const
+    {
+      return n_samples == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the window holds WINDOW_SIZE samples.
+    //*************************************************************************
+    bool full() const
+    {
+      return n_samples == WINDOW_SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets an iterator for input.
+    /// \return An iterator.
+    //*************************************************************************
+    add_insert_iterator input()
+    {
+      return add_insert_iterator(*this);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Recalculates the sum from the samples in the window.
+    //*************************************************************************
+    void resum()
+    {
+      TSum new_sum = TSum(0);
+
+      for (size_t i = 0U; i < n_samples; ++i)
+      {
+        new_sum += TSum(samples[i]);
+      }
+
+      sum = new_sum;
+    }
+
+    T      samples[WINDOW_SIZE_]; ///< The ring buffer of samples.
+    TSum   sum;                   ///< The running sum of the samples.
+    size_t next;                  ///< The index of the next sample to write.
+    size_t n_samples;             ///< The number of samples in the window.
+  };
+
+  template <typename T, const size_t WINDOW_SIZE_, typename TSum>
+  ETL_CONSTANT size_t moving_average<T, WINDOW_SIZE_, TSum>::WINDOW_SIZE;
+}
+
+#endif
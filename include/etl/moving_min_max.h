@@ -0,0 +1,241 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MOVING_MIN_MAX_INCLUDED
+#define ETL_MOVING_MIN_MAX_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "static_assert.h"
+#include "pseudo_moving_average.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_moving_min_max
+  {
+    //*************************************************************************
+    /// The extremum of the last WINDOW_SIZE samples.
+    /// Keeps a monotonic deque of the samples that may still become the
+    /// extremum, in a ring buffer of WINDOW_SIZE entries.
+    /// Each sample is pushed and popped at most once, so adding a sample is
+    /// amortised O(1).
+    /// \tparam T           The sample value type.
+    /// \tparam WINDOW_SIZE The number of samples in the window.
+    /// \tparam TCompare    The comparison that orders the extremum first.
+    //*************************************************************************
+    template <typename T, const size_t WINDOW_SIZE_, typename TCompare>
+    class moving_extremum
+    {
+    private:
+
+      ETL_STATIC_ASSERT(WINDOW_SIZE_ != 0U, "The window size must not be zero");
+
+    public:
+
+      typedef T value_type;
+
+      static ETL_CONSTANT size_t WINDOW_SIZE = WINDOW_SIZE_; ///< The number of samples in the window.
+
+      //***********************************
+      /// Constructor
+      //***********************************
+      moving_extremum()
+      {
+        clear();
+      }
+
+      //***********************************
+      /// Clears the window.
+      //***********************************
+      void clear()
+      {
+        front     = 0U;
+        length    = 0U;
+        sequence  = 0U;
+        n_samples = 0U;
+      }
+
+      //***********************************
+      /// Adds a new sample to the window, dropping the oldest if it is full.
+      /// \param new_value The value to add.
+      //***********************************
+      void add(T new_value)
+      {
+        TCompare compare;
+
+        // Drop the front if it has left the window.
+        if ((length != 0U) && ((sequence - entries[front].sequence) >= WINDOW_SIZE))
+        {
+          front = increment(front);
+          --length;
+        }
+
+        // Drop the samples that can never be the extremum again.
+        while ((length != 0U) && !compare(entries[back()].value, new_value))
+        {
+          --length;
+        }
+
+        entry& e   = entries[index_of(length)];
+        e.value    = new_value;
+        e.sequence = sequence;
+        ++length;
+
+        ++sequence;
+
+        if (n_samples < WINDOW_SIZE)
+        {
+          ++n_samples;
+        }
+      }
+
+      //***********************************
+      /// Gets the extremum of the samples in the window.
+      /// \return The current extremum, or a default constructed T if there are no samples.
+      //***********************************
+      T value() const
+      {
+        return (length == 0U) ? T() : entries[front].value;
+      }
+
+      //***********************************
+      /// Gets the number of samples in the window.
+      //***********************************
+      size_t size() const
+      {
+        return n_samples;
+      }
+
+      //***********************************
+      /// Returns <b>true</b> if there are no samples in the window.
+      //***********************************
+      bool empty() const
+      {
+        return n_samples == 0U;
+      }
+
+      //***********************************
+      /// Returns <b>true</b> if the window holds WINDOW_SIZE samples.
+      //***********************************
+      bool full() const
+      {
+        return n_samples == WINDOW_SIZE;
+      }
+
+    private:
+
+      //***********************************
+      struct entry
+      {
+        T      value;
+        size_t sequence;
+      };
+
+      //***********************************
+      static size_t increment(size_t index)
+      {
+        return (index == (WINDOW_SIZE - 1U)) ? 0U : index + 1U;
+      }
+
+      //***********************************
+      size_t index_of(size_t offset) const
+      {
+        const size_t index = front + offset;
+
+        return (index >= WINDOW_SIZE) ? index - WINDOW_SIZE : index;
+      }
+
+      //***********************************
+      size_t back() const
+      {
+        return index_of(length - 1U);
+      }
+
+      entry  entries[WINDOW_SIZE_]; ///< The ring buffer holding the monotonic deque.
+      size_t front;                 ///< The index of the front of the deque.
+      size_t length;                ///< The number of entries in the deque.
+      size_t sequence;              ///< The sequence number of the next sample.
+      size_t n_samples;             ///< The number of samples in the window.
+    };
+
+    template <typename T, const size_t WINDOW_SIZE_, typename TCompare>
+    ETL_CONSTANT size_t moving_extremum<T, WINDOW_SIZE_, TCompare>::WINDOW_SIZE;
+  }
+
+  //***************************************************************************
+  /// Moving Minimum
+  /// The minimum of the last WINDOW_SIZE samples, in amortised O(1) per sample.
+  /// \tparam T           The sample value type.
+  /// \tparam WINDOW_SIZE The number of samples in the window.
+  //***************************************************************************
+  template <typename T, const size_t WINDOW_SIZE_>
+  class moving_min : public private_moving_min_max::moving_extremum<T, WINDOW_SIZE_, etl::less<T> >
+  {
+  public:
+
+    typedef private_pseudo_moving_average::add_insert_iterator<moving_min<T, WINDOW_SIZE_> > add_insert_iterator;
+
+    //*************************************************************************
+    /// Gets an iterator for input.
+    /// \return An iterator.
+    //*************************************************************************
+    add_insert_iterator input()
+    {
+      return add_insert_iterator(*this);
+    }
+  };
+
+  //***************************************************************************
+  /// Moving Maximum
+  /// The maximum of the last WINDOW_SIZE samples, in amortised O(1) per sample.
+  /// \tparam T           The sample value type.
+  /// \tparam WINDOW_SIZE The number of samples in the window.
+  //***************************************************************************
+  template <typename T, const size_t WINDOW_SIZE_>
+  class moving_max : public private_moving_min_max::moving_extremum<T, WINDOW_SIZE_, etl::greater<T> >
+  {
+  public:
+
+    typedef private_pseudo_moving_average::add_insert_iterator<moving_max<T, WINDOW_SIZE_> > add_insert_iterator;
+
+    //*************************************************************************
+    /// Gets an iterator for input.
+    /// \return An iterator.
+    //*************************************************************************
+    add_insert_iterator input()
+    {
+      return add_insert_iterator(*this);
+    }
+  };
+}
+
+#endif
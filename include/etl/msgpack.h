@@ -0,0 +1,881 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MSGPACK_INCLUDED
+#define ETL_MSGPACK_INCLUDED
+
+#include "platform.h"
+#include "byte_stream.h"
+#include "string_view.h"
+#include "span.h"
+#include "enum_type.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <stdint.h>
+
+#if ETL_USING_64BIT_TYPES
+
+///\defgroup msgpack msgpack
+/// A MessagePack encoder and pull parser over byte streams.
+/// Nothing is allocated. Strings and binary data are parsed as views of the
+/// stream. The byte streams must be big endian, the MessagePack byte order.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for msgpack.
+  ///\ingroup msgpack
+  //***************************************************************************
+  class msgpack_exception : public etl::exception
+  {
+  public:
+
+    msgpack_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The byte stream is not big endian.
+  ///\ingroup msgpack
+  //***************************************************************************
+  class msgpack_endianness : public msgpack_exception
+  {
+  public:
+
+    msgpack_endianness(string_type file_name_, numeric_type line_number_)
+      : msgpack_exception(ETL_ERROR_TEXT("msgpack:endianness", ETL_MSGPACK_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The type of a MessagePack item.
+  ///\ingroup msgpack
+  //***************************************************************************
+  struct msgpack_type
+  {
+    enum enum_type
+    {
+      Nil,
+      Boolean,
+      Unsigned_Integer,
+      Signed_Integer,
+      Float32,
+      Float64,
+      String,
+      Binary,
+      Array,
+      Map,
+      Extension
+    };
+
+    ETL_DECLARE_ENUM_TYPE(msgpack_type, int)
+    ETL_ENUM_TYPE(Nil,              "Nil")
+    ETL_ENUM_TYPE(Boolean,          "Boolean")
+    ETL_ENUM_TYPE(Unsigned_Integer, "Unsigned_Integer")
+    ETL_ENUM_TYPE(Signed_Integer,   "Signed_Integer")
+    ETL_ENUM_TYPE(Float32,          "Float32")
+    ETL_ENUM_TYPE(Float64,          "Float64")
+    ETL_ENUM_TYPE(String,           "String")
+    ETL_ENUM_TYPE(Binary,           "Binary")
+    ETL_ENUM_TYPE(Array,            "Array")
+    ETL_ENUM_TYPE(Map,              "Map")
+    ETL_ENUM_TYPE(Extension,        "Extension")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// Writes MessagePack to a big endian byte stream.
+  /// Each item uses its smallest encoding, and is written whole or not at all.
+  /// Arrays and maps are written as a header with the number of elements,
+  /// followed by the elements, with maps as alternate keys and values.
+  ///\ingroup msgpack
+  //***************************************************************************
+  class msgpack_writer
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit msgpack_writer(etl::byte_stream_writer& stream_)
+      : stream(stream_)
+    {
+      ETL_ASSERT(stream.get_endianness() == etl::endian::big, ETL_ERROR(msgpack_endianness));
+    }
+
+    //*************************************************************************
+    /// Writes a nil.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    bool write_nil()
+    {
+      return write_tag(0xC0U);
+    }
+
+    //*************************************************************************
+    /// Writes a boolean.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    bool write(bool value)
+    {
+      return write_tag(value ? 0xC3U : 0xC2U);
+    }
+
+    //*************************************************************************
+    /// Writes a signed integer.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_signed<T>::value, bool>::type
+      write(T value)
+    {
+      return write_signed(static_cast<int64_t>(value));
+    }
+
+    //*************************************************************************
+    /// Writes an unsigned integer.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && !etl::is_same<T, bool>::value, bool>::type
+      write(T value)
+    {
+      return write_unsigned(static_cast<uint64_t>(value));
+    }
+
+    //*************************************************************************
+    /// Writes a 32 bit float.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    bool write(float value)
+    {
+      return write_value(0xCAU, value);
+    }
+
+    //*************************************************************************
+    /// Writes a 64 bit float.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    bool write(double value)
+    {
+      return write_value(0xCBU, value);
+    }
+
+    //*************************************************************************
+    /// Writes a string.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    bool write(const etl::string_view& value)
+    {
+      const size_t length = value.size();
+
+      if (length <= 31U)
+      {
+        return write_sized(static_cast<uint8_t>(0xA0U | length), 0U, length, value.data());
+      }
+      else if (length <= 0xFFU)
+      {
+        return write_sized(0xD9U, 1U, length, value.data());
+      }
+      else if (length <= 0xFFFFU)
+      {
+        return write_sized(0xDAU, 2U, length, value.data());
+      }
+      else
+      {
+        return write_sized(0xDBU, 4U, length, value.data());
+      }
+    }
+
+    //*************************************************************************
+    /// Writes a null terminated string.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    bool write(const char* value)
+    {
+      return write(etl::string_view(value));
+    }
+
+    //*************************************************************************
+    /// Writes binary data.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    bool write_binary(etl::span<const uint8_t> value)
+    {
+      const size_t length = value.size();
+
+      if (length <= 0xFFU)
+      {
+        return write_sized(0xC4U, 1U, length, value.data());
+      }
+      else if (length <= 0xFFFFU)
+      {
+        return write_sized(0xC5U, 2U, length, value.data());
+      }
+      else
+      {
+        return write_sized(0xC6U, 4U, length, value.data());
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the header of an array of n elements.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    bool write_array(size_t n)
+    {
+      if (n <= 15U)
+      {
+        return write_tag(static_cast<uint8_t>(0x90U | n));
+      }
+      else if (n <= 0xFFFFU)
+      {
+        return write_value(0xDCU, static_cast<uint16_t>(n));
+      }
+      else
+      {
+        return write_value(0xDDU, static_cast<uint32_t>(n));
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the header of a map of n key and value pairs.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    bool write_map(size_t n)
+    {
+      if (n <= 15U)
+      {
+        return write_tag(static_cast<uint8_t>(0x80U | n));
+      }
+      else if (n <= 0xFFFFU)
+      {
+        return write_value(0xDEU, static_cast<uint16_t>(n));
+      }
+      else
+      {
+        return write_value(0xDFU, static_cast<uint32_t>(n));
+      }
+    }
+
+    //*************************************************************************
+    /// Writes an extension of an application defined type.
+    /// Returns <b>false</b> if there is no room.
+    //*************************************************************************
+    bool write_extension(int8_t type, etl::span<const uint8_t> value)
+    {
+      const size_t length = value.size();
+
+      uint8_t tag;
+      size_t  length_size = 0U;
+
+      switch (length)
+      {
+        case 1U:  tag = 0xD4U; break;
+        case 2U:  tag = 0xD5U; break;
+        case 4U:  tag = 0xD6U; break;
+        case 8U:  tag = 0xD7U; break;
+        case 16U: tag = 0xD8U; break;
+        default:
+        {
+          if (length <= 0xFFU)
+          {
+            tag = 0xC7U; length_size = 1U;
+          }
+          else if (length <= 0xFFFFU)
+          {
+            tag = 0xC8U; length_size = 2U;
+          }
+          else
+          {
+            tag = 0xC9U; length_size = 4U;
+          }
+          break;
+        }
+      }
+
+      etl::byte_stream_writer::reservation r(stream, 1U + length_size + 1U + length);
+
+      if (!r.is_valid())
+      {
+        return false;
+      }
+
+      r.write_unchecked(tag);
+      write_length(r, length_size, length);
+      r.write_unchecked(type);
+      write_data(r, value.data(), length);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the byte stream.
+    //*************************************************************************
+    etl::byte_stream_writer& get_stream()
+    {
+      return stream;
+    }
+
+  private:
+
+    //*************************************************************************
+    bool write_signed(int64_t value)
+    {
+      if (value >= 0)
+      {
+        return write_unsigned(static_cast<uint64_t>(value));
+      }
+      else if (value >= -32)
+      {
+        return write_tag(static_cast<uint8_t>(value));
+      }
+      else if (value >= INT8_MIN)
+      {
+        return write_value(0xD0U, static_cast<int8_t>(value));
+      }
+      else if (value >= INT16_MIN)
+      {
+        return write_value(0xD1U, static_cast<int16_t>(value));
+      }
+      else if (value >= INT32_MIN)
+      {
+        return write_value(0xD2U, static_cast<int32_t>(value));
+      }
+      else
+      {
+        return write_value(0xD3U, value);
+      }
+    }
+
+    //*************************************************************************
+    bool write_unsigned(uint64_t value)
+    {
+      if (value <= 0x7FU)
+      {
+        return write_tag(static_cast<uint8_t>(value));
+      }
+      else if (value <= 0xFFU)
+      {
+        return write_value(0xCCU, static_cast<uint8_t>(value));
+      }
+      else if (value <= 0xFFFFU)
+      {
+        return write_value(0xCDU, static_cast<uint16_t>(value));
+      }
+      else if (value <= 0xFFFFFFFFUL)
+      {
+        return write_value(0xCEU, static_cast<uint32_t>(value));
+      }
+      else
+      {
+        return write_value(0xCFU, value);
+      }
+    }
+
+    //*************************************************************************
+    bool write_tag(uint8_t tag)
+    {
+      return stream.write(tag);
+    }
+
+    //*************************************************************************
+    /// Writes a tag followed by a value.
+    //*************************************************************************
+    template <typename T>
+    bool write_value(uint8_t tag, T value)
+    {
+      etl::byte_stream_writer::reservation r(stream, 1U + sizeof(T));
+
+      if (!r.is_valid())
+      {
+        return false;
+      }
+
+      r.write_unchecked(tag);
+      r.write_unchecked(value);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Writes a tag, a length of length_size bytes and the data.
+    //*************************************************************************
+    bool write_sized(uint8_t tag, size_t length_size, size_t length, const void* data)
+    {
+      etl::byte_stream_writer::reservation r(stream, 1U + length_size + length);
+
+      if (!r.is_valid())
+      {
+        return false;
+      }
+
+      r.write_unchecked(tag);
+      write_length(r, length_size, length);
+      write_data(r, data, length);
+
+      return true;
+    }
+
+    //*************************************************************************
+    static void write_length(etl::byte_stream_writer::reservation& r, size_t length_size, size_t length)
+    {
+      switch (length_size)
+      {
+        case 1U: r.write_unchecked(static_cast<uint8_t>(length));  break;
+        case 2U: r.write_unchecked(static_cast<uint16_t>(length)); break;
+        case 4U: r.write_unchecked(static_cast<uint32_t>(length)); break;
+        default:                                                    break;
+      }
+    }
+
+    //*************************************************************************
+    static void write_data(etl::byte_stream_writer::reservation& r, const void* data, size_t length)
+    {
+      if (length != 0U)
+      {
+        r.write_unchecked(etl::span<const char>(static_cast<const char*>(data), length));
+      }
+    }
+
+    etl::byte_stream_writer& stream;
+  };
+
+  //***************************************************************************
+  /// An item read by msgpack_reader.
+  /// Strings, binary data and extensions are views of the byte stream.
+  /// Arrays and maps hold the number of elements, or pairs, that follow.
+  ///\ingroup msgpack
+  //***************************************************************************
+  class msgpack_item
+  {
+  public:
+
+    friend class msgpack_reader;
+
+    //*************************************************************************
+    msgpack_item()
+      : item_type(msgpack_type::Nil)
+      , p_data(ETL_NULLPTR)
+      , length(0U)
+      , extension(0)
+    {
+      value.u = 0U;
+    }
+
+    //*************************************************************************
+    /// The type of the item.
+    //*************************************************************************
+    msgpack_type type() const
+    {
+      return item_type;
+    }
+
+    //*************************************************************************
+    bool is_nil() const
+    {
+      return item_type == msgpack_type::Nil;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the item is a signed or unsigned integer.
+    //*************************************************************************
+    bool is_integer() const
+    {
+      return (item_type == msgpack_type::Signed_Integer) || (item_type == msgpack_type::Unsigned_Integer);
+    }
+
+    //*************************************************************************
+    /// The value of a boolean.
+    //*************************************************************************
+    bool as_bool() const
+    {
+      return value.b;
+    }
+
+    //*************************************************************************
+    /// The value of a signed or unsigned integer, as signed.
+    //*************************************************************************
+    int64_t as_int() const
+    {
+      return (item_type == msgpack_type::Signed_Integer) ? value.i : static_cast<int64_t>(value.u);
+    }
+
+    //*************************************************************************
+    /// The value of a signed or unsigned integer, as unsigned.
+    //*************************************************************************
+    uint64_t as_uint() const
+    {
+      return (item_type == msgpack_type::Signed_Integer) ? static_cast<uint64_t>(value.i) : value.u;
+    }
+
+    //*************************************************************************
+    /// The value of a 32 bit float.
+    //*************************************************************************
+    float as_float() const
+    {
+      return value.f;
+    }
+
+    //*************************************************************************
+    /// The value of a 32 or 64 bit float, as double.
+    //*************************************************************************
+    double as_double() const
+    {
+      return (item_type == msgpack_type::Float32) ? static_cast<double>(value.f) : value.d;
+    }
+
+    //*************************************************************************
+    /// A view of a string.
+    //*************************************************************************
+    etl::string_view as_string() const
+    {
+      return etl::string_view(p_data, length);
+    }
+
+    //*************************************************************************
+    /// A view of binary data or the data of an extension.
+    //*************************************************************************
+    etl::span<const uint8_t> as_binary() const
+    {
+      return etl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(p_data), length);
+    }
+
+    //*************************************************************************
+    /// The application defined type of an extension.
+    //*************************************************************************
+    int8_t extension_type() const
+    {
+      return extension;
+    }
+
+    //*************************************************************************
+    /// The number of elements of an array, or key and value pairs of a map.
+    //*************************************************************************
+    size_t size() const
+    {
+      return length;
+    }
+
+  private:
+
+    msgpack_type item_type;
+
+    union
+    {
+      bool     b;
+      int64_t  i;
+      uint64_t u;
+      float    f;
+      double   d;
+    } value;
+
+    const char* p_data;
+    size_t      length;
+    int8_t      extension;
+  };
+
+  //***************************************************************************
+  /// Reads MessagePack from a big endian byte stream, an item at a time.
+  /// Arrays and maps are read as a header, then their elements as the items
+  /// that follow.
+  ///\ingroup msgpack
+  //***************************************************************************
+  class msgpack_reader
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit msgpack_reader(etl::byte_stream_reader& stream_)
+      : stream(stream_)
+    {
+      ETL_ASSERT(stream.get_endianness() == etl::endian::big, ETL_ERROR(msgpack_endianness));
+    }
+
+    //*************************************************************************
+    /// Reads the next item.
+    /// Returns <b>false</b>, and reads nothing, if the stream is empty, the
+    /// item is truncated or the tag is invalid.
+    //*************************************************************************
+    bool read(msgpack_item& item)
+    {
+      const size_t start = stream.used_data().size();
+
+      if (!read_item(item))
+      {
+        stream.restart(start);
+        return false;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Skips the next value, including all of the elements of an array or map.
+    /// Returns <b>false</b>, and reads nothing, if the value is incomplete or invalid.
+    //*************************************************************************
+    bool skip()
+    {
+      const size_t start = stream.used_data().size();
+
+      uint64_t     remaining = 1U;
+      msgpack_item item;
+
+      while (remaining != 0U)
+      {
+        if (!read_item(item))
+        {
+          stream.restart(start);
+          return false;
+        }
+
+        --remaining;
+
+        if (item.type() == msgpack_type::Array)
+        {
+          remaining += item.size();
+        }
+        else if (item.type() == msgpack_type::Map)
+        {
+          // A key and a value for each.
+          remaining += item.size();
+          remaining += item.size();
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there is nothing left to read.
+    //*************************************************************************
+    bool empty() const
+    {
+      return stream.empty();
+    }
+
+    //*************************************************************************
+    /// Gets the byte stream.
+    //*************************************************************************
+    etl::byte_stream_reader& get_stream()
+    {
+      return stream;
+    }
+
+  private:
+
+    //*************************************************************************
+    bool read_item(msgpack_item& item)
+    {
+      if (stream.empty())
+      {
+        return false;
+      }
+
+      const uint8_t tag = stream.read_unchecked<uint8_t>();
+
+      item.p_data    = ETL_NULLPTR;
+      item.length    = 0U;
+      item.extension = 0;
+
+      if (tag <= 0x7FU)
+      {
+        item.item_type = msgpack_type::Unsigned_Integer;
+        item.value.u   = tag;
+        return true;
+      }
+      else if (tag >= 0xE0U)
+      {
+        item.item_type = msgpack_type::Signed_Integer;
+        item.value.i   = static_cast<int8_t>(tag);
+        return true;
+      }
+      else if (tag <= 0x8FU)
+      {
+        item.item_type = msgpack_type::Map;
+        item.length    = tag & 0x0FU;
+        return true;
+      }
+      else if (tag <= 0x9FU)
+      {
+        item.item_type = msgpack_type::Array;
+        item.length    = tag & 0x0FU;
+        return true;
+      }
+      else if (tag <= 0xBFU)
+      {
+        item.item_type = msgpack_type::String;
+        return read_data(item, tag & 0x1FU);
+      }
+
+      switch (tag)
+      {
+        case 0xC0U: item.item_type = msgpack_type::Nil;                                   return true;
+        case 0xC2U: item.item_type = msgpack_type::Boolean; item.value.b = false;          return true;
+        case 0xC3U: item.item_type = msgpack_type::Boolean; item.value.b = true;           return true;
+        case 0xC4U: item.item_type = msgpack_type::Binary;                                 return read_sized<uint8_t>(item);
+        case 0xC5U: item.item_type = msgpack_type::Binary;                                 return read_sized<uint16_t>(item);
+        case 0xC6U: item.item_type = msgpack_type::Binary;                                 return read_sized<uint32_t>(item);
+        case 0xC7U: item.item_type = msgpack_type::Extension;                              return read_extension<uint8_t>(item);
+        case 0xC8U: item.item_type = msgpack_type::Extension;                              return read_extension<uint16_t>(item);
+        case 0xC9U: item.item_type = msgpack_type::Extension;                              return read_extension<uint32_t>(item);
+        case 0xCAU: item.item_type = msgpack_type::Float32;                                return read_value(item.value.f);
+        case 0xCBU: item.item_type = msgpack_type::Float64;                                return read_value(item.value.d);
+        case 0xCCU: item.item_type = msgpack_type::Unsigned_Integer;                       return read_integer<uint8_t>(item.value.u);
+        case 0xCDU: item.item_type = msgpack_type::Unsigned_Integer;                       return read_integer<uint16_t>(item.value.u);
+        case 0xCEU: item.item_type = msgpack_type::Unsigned_Integer;                       return read_integer<uint32_t>(item.value.u);
+        case 0xCFU: item.item_type = msgpack_type::Unsigned_Integer;                       return read_integer<uint64_t>(item.value.u);
+        case 0xD0U: item.item_type = msgpack_type::Signed_Integer;                         return read_integer<int8_t>(item.value.i);
+        case 0xD1U: item.item_type = msgpack_type::Signed_Integer;                         return read_integer<int16_t>(item.value.i);
+        case 0xD2U: item.item_type = msgpack_type::Signed_Integer;                         return read_integer<int32_t>(item.value.i);
+        case 0xD3U: item.item_type = msgpack_type::Signed_Integer;                         return read_integer<int64_t>(item.value.i);
+        case 0xD4U: item.item_type = msgpack_type::Extension;                              return read_fixed_extension(item, 1U);
+        case 0xD5U: item.item_type = msgpack_type::Extension;                              return read_fixed_extension(item, 2U);
+        case 0xD6U: item.item_type = msgpack_type::Extension;                              return read_fixed_extension(item, 4U);
+        case 0xD7U: item.item_type = msgpack_type::Extension;                              return read_fixed_extension(item, 8U);
+        case 0xD8U: item.item_type = msgpack_type::Extension;                              return read_fixed_extension(item, 16U);
+        case 0xD9U: item.item_type = msgpack_type::String;                                 return read_sized<uint8_t>(item);
+        case 0xDAU: item.item_type = msgpack_type::String;                                 return read_sized<uint16_t>(item);
+        case 0xDBU: item.item_type = msgpack_type::String;                                 return read_sized<uint32_t>(item);
+        case 0xDCU: item.item_type = msgpack_type::Array;                                  return read_count<uint16_t>(item);
+        case 0xDDU: item.item_type = msgpack_type::Array;                                  return read_count<uint32_t>(item);
+        case 0xDEU: item.item_type = msgpack_type::Map;                                    return read_count<uint16_t>(item);
+        case 0xDFU: item.item_type = msgpack_type::Map;                                    return read_count<uint32_t>(item);
+        default:                                                                           return false; // 0xC1 is never used.
+      }
+    }
+
+    //*************************************************************************
+    template <typename T>
+    bool read_value(T& value)
+    {
+      if (stream.available<T>() == 0U)
+      {
+        return false;
+      }
+
+      value = stream.read_unchecked<T>();
+
+      return true;
+    }
+
+    //*************************************************************************
+    template <typename T, typename TValue>
+    bool read_integer(TValue& value)
+    {
+      T v;
+
+      if (!read_value(v))
+      {
+        return false;
+      }
+
+      value = static_cast<TValue>(v);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reads an array or map count of type T.
+    //*************************************************************************
+    template <typename T>
+    bool read_count(msgpack_item& item)
+    {
+      T count;
+
+      if (!read_value(count))
+      {
+        return false;
+      }
+
+      item.length = count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reads a length of type T, then the data.
+    //*************************************************************************
+    template <typename T>
+    bool read_sized(msgpack_item& item)
+    {
+      T length;
+
+      return read_value(length) && read_data(item, length);
+    }
+
+    //*************************************************************************
+    /// Reads a length of type T, the extension type, then the data.
+    //*************************************************************************
+    template <typename T>
+    bool read_extension(msgpack_item& item)
+    {
+      T length;
+
+      return read_value(length) && read_fixed_extension(item, length);
+    }
+
+    //*************************************************************************
+    bool read_fixed_extension(msgpack_item& item, size_t length)
+    {
+      return read_value(item.extension) && read_data(item, length);
+    }
+
+    //*************************************************************************
+    /// Takes a view of length bytes of the stream.
+    //*************************************************************************
+    bool read_data(msgpack_item& item, size_t length)
+    {
+      if (stream.available<char>() < length)
+      {
+        return false;
+      }
+
+      item.p_data = stream.read_unchecked<char>(length).data();
+      item.length = length;
+
+      return true;
+    }
+
+    etl::byte_stream_reader& stream;
+  };
+}
+
+#endif
+#endif
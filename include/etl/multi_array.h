@@ -33,9 +33,34 @@ SOFTWARE.
 
 #include "platform.h"
 #include "array.h"
+#include "binary.h"
+#include "log.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "span.h"
+#include "iterator.h"
+#include "utility.h"
+
+#include <stdint.h>
+
+//*****************************************************************************
+/// The default tile edge used by etl::transpose.
+/// An 8 x 8 tile of 4 byte elements is 256 bytes, so the source and
+/// destination tiles together stay well inside a typical L1 cache.
+//*****************************************************************************
+#if !defined(ETL_MULTI_ARRAY_DEFAULT_TILE)
+  #define ETL_MULTI_ARRAY_DEFAULT_TILE 8U
+#endif
 
 ///\defgroup multi_array multi_array
 /// A multi dimensional array.
+/// etl::multi_array is nested etl::arrays, in row major order.
+/// etl::multi_array_layout stores the elements in one block, in the order
+/// given by an index policy, either etl::row_major_index or
+/// etl::z_order_index.
+/// For 2D etl::multi_array, etl::row_of and etl::column_of give row and
+/// column views, and etl::for_each_tile and etl::transpose walk the array
+/// tile by tile so that each step stays within a few cache lines.
 ///\ingroup containers
 
 namespace etl
@@ -62,6 +87,527 @@ namespace etl
   template <typename T, const size_t... TDx>
   using multi_array = typename private_multi_array::multi_array_t<T, TDx...>::type;
 
+  //***************************************************************************
+  /// Row major indexing of the dimensions Dx.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <size_t... Dx>
+  struct row_major_index;
+
+  template <>
+  struct row_major_index<>
+  {
+    static constexpr size_t Rank = 0U;
+    static constexpr size_t Size = 1U;
+
+    static constexpr size_t index()
+    {
+      return 0U;
+    }
+  };
+
+  template <size_t D1, size_t... Dx>
+  struct row_major_index<D1, Dx...>
+  {
+    static constexpr size_t Rank = 1U + sizeof...(Dx);
+    static constexpr size_t Size = D1 * row_major_index<Dx...>::Size;
+
+    //*************************************************************************
+    /// The offset of the element.
+    //*************************************************************************
+    template <typename... TIndices>
+    static constexpr size_t index(size_t i1, TIndices... indices)
+    {
+      return (i1 * row_major_index<Dx...>::Size) + row_major_index<Dx...>::index(indices...);
+    }
+  };
+
+  template <size_t D1, size_t... Dx>
+  constexpr size_t row_major_index<D1, Dx...>::Rank;
+
+  template <size_t D1, size_t... Dx>
+  constexpr size_t row_major_index<D1, Dx...>::Size;
+
+  namespace private_multi_array
+  {
+    //*************************************************************************
+    /// The number of bits to index a dimension of D elements.
+    //*************************************************************************
+    template <size_t D>
+    struct index_bits
+    {
+      static constexpr size_t value = (D <= 1U) ? 0U : (etl::log2<D - 1U>::value + 1U);
+    };
+
+    //*************************************************************************
+    /// The bits of the index that each coordinate occupies in Z-order.
+    /// Bit b of every coordinate that has one comes before bit b + 1 of any,
+    /// lower dimensions first. When the dimensions are the same size this is
+    /// the Morton order of etl::morton_encode2 and etl::morton_encode3.
+    //*************************************************************************
+    template <size_t B1, size_t B2, size_t B3, size_t Level = 0U, size_t Position = 0U,
+              bool Done = ((Level >= B1) && (Level >= B2) && (Level >= B3))>
+    struct z_order_masks
+    {
+      typedef z_order_masks<B1, B2, B3, Level + 1U, Position + size_t(Level < B1) + size_t(Level < B2) + size_t(Level < B3)> next;
+
+      static constexpr uint64_t mask1 = ((Level < B1) ? (uint64_t(1U) << Position) : 0U) | next::mask1;
+      static constexpr uint64_t mask2 = ((Level < B2) ? (uint64_t(1U) << (Position + size_t(Level < B1))) : 0U) | next::mask2;
+      static constexpr uint64_t mask3 = ((Level < B3) ? (uint64_t(1U) << (Position + size_t(Level < B1) + size_t(Level < B2))) : 0U) | next::mask3;
+    };
+
+    template <size_t B1, size_t B2, size_t B3, size_t Level, size_t Position>
+    struct z_order_masks<B1, B2, B3, Level, Position, true>
+    {
+      static constexpr uint64_t mask1 = 0U;
+      static constexpr uint64_t mask2 = 0U;
+      static constexpr uint64_t mask3 = 0U;
+    };
+  }
+
+  //***************************************************************************
+  /// Z-order (Morton order) indexing of two or three dimensions.
+  /// Elements that are close in every dimension are close in memory, which
+  /// suits spatial grids that are accessed in neighbourhoods.
+  /// Each dimension is rounded up to a power of 2 for the storage size.
+  /// Square and cubic grids use the Morton functions of binary.h; other
+  /// shapes deposit the coordinates' bits with etl::pdep, which is a single
+  /// instruction only when ETL_USING_BUILTIN_BMI2 is set.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <size_t... Dx>
+  struct z_order_index;
+
+  template <size_t D1, size_t D2>
+  struct z_order_index<D1, D2>
+  {
+  private:
+
+    static constexpr size_t B1 = private_multi_array::index_bits<D1>::value;
+    static constexpr size_t B2 = private_multi_array::index_bits<D2>::value;
+
+    ETL_STATIC_ASSERT((B1 + B2) <= 64U, "Too many elements for a Z-order index");
+
+    typedef typename etl::conditional<((B1 + B2) <= 32U), uint32_t, uint64_t>::type code_t;
+    typedef private_multi_array::z_order_masks<B1, B2, 0U> masks;
+
+  public:
+
+    static constexpr size_t Rank = 2U;
+    static constexpr size_t Size = size_t(1U) << (B1 + B2);
+
+    //*************************************************************************
+    /// The offset of the element.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t index(size_t i1, size_t i2)
+    {
+      return (B1 == B2) ? size_t(etl::morton_encode2(code_t(i1), code_t(i2)))
+                        : size_t(etl::pdep(code_t(i1), code_t(masks::mask1)) | etl::pdep(code_t(i2), code_t(masks::mask2)));
+    }
+  };
+
+  template <size_t D1, size_t D2>
+  constexpr size_t z_order_index<D1, D2>::Rank;
+
+  template <size_t D1, size_t D2>
+  constexpr size_t z_order_index<D1, D2>::Size;
+
+  template <size_t D1, size_t D2, size_t D3>
+  struct z_order_index<D1, D2, D3>
+  {
+  private:
+
+    static constexpr size_t B1 = private_multi_array::index_bits<D1>::value;
+    static constexpr size_t B2 = private_multi_array::index_bits<D2>::value;
+    static constexpr size_t B3 = private_multi_array::index_bits<D3>::value;
+
+    ETL_STATIC_ASSERT((B1 + B2 + B3) <= 64U, "Too many elements for a Z-order index");
+
+    typedef typename etl::conditional<((B1 + B2 + B3) <= 30U), uint32_t, uint64_t>::type code_t;
+    typedef private_multi_array::z_order_masks<B1, B2, B3> masks;
+
+  public:
+
+    static constexpr size_t Rank = 3U;
+    static constexpr size_t Size = size_t(1U) << (B1 + B2 + B3);
+
+    //*************************************************************************
+    /// The offset of the element.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t index(size_t i1, size_t i2, size_t i3)
+    {
+      return ((B1 == B2) && (B2 == B3)) ? size_t(etl::morton_encode3(code_t(i1), code_t(i2), code_t(i3)))
+                                        : size_t(etl::pdep(code_t(i1), code_t(masks::mask1)) |
+                                                 etl::pdep(code_t(i2), code_t(masks::mask2)) |
+                                                 etl::pdep(code_t(i3), code_t(masks::mask3)));
+    }
+  };
+
+  template <size_t D1, size_t D2, size_t D3>
+  constexpr size_t z_order_index<D1, D2, D3>::Rank;
+
+  template <size_t D1, size_t D2, size_t D3>
+  constexpr size_t z_order_index<D1, D2, D3>::Size;
+
+  //***************************************************************************
+  /// A multi dimensional array stored in one block, in the order given by the
+  /// index policy TIndex.
+  /// Elements are accessed with operator()(i1, i2, ...). Iteration is in
+  /// storage order, and includes any padding elements of the layout.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <typename T, typename TIndex>
+  class multi_array_layout
+  {
+  public:
+
+    typedef T                                   value_type;
+    typedef size_t                              size_type;
+    typedef T&                                  reference;
+    typedef const T&                            const_reference;
+    typedef T*                                  pointer;
+    typedef const T*                            const_pointer;
+    typedef T*                                  iterator;
+    typedef const T*                            const_iterator;
+    typedef TIndex                              index_policy;
+
+    static constexpr size_t Rank = TIndex::Rank;
+    static constexpr size_t Size = TIndex::Size;
+
+    //*************************************************************************
+    /// The element at the indices.
+    //*************************************************************************
+    template <typename... TIndices>
+    ETL_CONSTEXPR14 reference operator ()(TIndices... indices)
+    {
+      ETL_STATIC_ASSERT(sizeof...(TIndices) == Rank, "Wrong number of indices");
+
+      return elements[TIndex::index(size_t(indices)...)];
+    }
+
+    //*************************************************************************
+    /// The element at the indices.
+    //*************************************************************************
+    template <typename... TIndices>
+    ETL_CONSTEXPR const_reference operator ()(TIndices... indices) const
+    {
+      ETL_STATIC_ASSERT(sizeof...(TIndices) == Rank, "Wrong number of indices");
+
+      return elements[TIndex::index(size_t(indices)...)];
+    }
+
+    //*************************************************************************
+    /// Fills every element with the value.
+    //*************************************************************************
+    void fill(const_reference value)
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        elements[i] = value;
+      }
+    }
+
+    //*************************************************************************
+    /// The number of elements in the storage.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_type size()
+    {
+      return Size;
+    }
+
+    ETL_CONSTEXPR14 pointer       data()         { return elements; }
+    ETL_CONSTEXPR const_pointer   data() const   { return elements; }
+    ETL_CONSTEXPR14 iterator      begin()        { return elements; }
+    ETL_CONSTEXPR const_iterator  begin() const  { return elements; }
+    ETL_CONSTEXPR const_iterator  cbegin() const { return elements; }
+    ETL_CONSTEXPR14 iterator      end()          { return elements + Size; }
+    ETL_CONSTEXPR const_iterator  end() const    { return elements + Size; }
+    ETL_CONSTEXPR const_iterator  cend() const   { return elements + Size; }
+
+    /// The elements. Public so that the array can be aggregate initialised.
+    T elements[Size];
+  };
+
+  template <typename T, typename TIndex>
+  constexpr size_t multi_array_layout<T, TIndex>::Rank;
+
+  template <typename T, typename TIndex>
+  constexpr size_t multi_array_layout<T, TIndex>::Size;
+
+  //***************************************************************************
+  /// A row of a 2D multi_array as a span.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <typename T, size_t Rows, size_t Cols>
+  ETL_CONSTEXPR14 etl::span<T, Cols> row_of(etl::array<etl::array<T, Cols>, Rows>& grid, size_t row)
+  {
+    return etl::span<T, Cols>(grid[row].data(), Cols);
+  }
+
+  //***************************************************************************
+  /// A row of a 2D multi_array as a span.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <typename T, size_t Rows, size_t Cols>
+  ETL_CONSTEXPR14 etl::span<const T, Cols> row_of(const etl::array<etl::array<T, Cols>, Rows>& grid, size_t row)
+  {
+    return etl::span<const T, Cols>(grid[row].data(), Cols);
+  }
+
+  //***************************************************************************
+  /// A column of a 2D multi_array.
+  /// The elements are not contiguous, so the view indexes through the array
+  /// rather than striding a pointer across the nested rows.
+  /// T may be const qualified for a read only view.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <typename T, size_t Rows, size_t Cols>
+  class multi_array_column
+  {
+  public:
+
+    typedef T                                     value_type;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+    typedef T&                                    reference;
+    typedef T*                                    pointer;
+
+    typedef typename etl::conditional<etl::is_const<T>::value,
+                                      const etl::multi_array<typename etl::remove_const<T>::type, Rows, Cols>,
+                                      etl::multi_array<T, Rows, Cols> >::type grid_type;
+
+    //*************************************************************************
+    /// Random access iterator over the column.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, T>
+    {
+    public:
+
+      friend class multi_array_column;
+
+      ETL_CONSTEXPR iterator()
+        : p_grid(ETL_NULLPTR)
+        , column(0U)
+        , row(0)
+      {
+      }
+
+      ETL_CONSTEXPR14 reference operator *() const                  { return (*p_grid)[size_t(row)][column]; }
+      ETL_CONSTEXPR14 pointer   operator ->() const                 { return &(*p_grid)[size_t(row)][column]; }
+      ETL_CONSTEXPR14 reference operator [](difference_type n) const { return (*p_grid)[size_t(row + n)][column]; }
+
+      ETL_CONSTEXPR14 iterator& operator ++()                  { ++row; return *this; }
+      ETL_CONSTEXPR14 iterator& operator --()                  { --row; return *this; }
+      ETL_CONSTEXPR14 iterator  operator ++(int)               { iterator temp(*this); ++row; return temp; }
+      ETL_CONSTEXPR14 iterator  operator --(int)               { iterator temp(*this); --row; return temp; }
+      ETL_CONSTEXPR14 iterator& operator +=(difference_type n) { row += n; return *this; }
+      ETL_CONSTEXPR14 iterator& operator -=(difference_type n) { row -= n; return *this; }
+
+      friend ETL_CONSTEXPR14 iterator operator +(iterator itr, difference_type n) { itr.row += n; return itr; }
+      friend ETL_CONSTEXPR14 iterator operator +(difference_type n, iterator itr) { itr.row += n; return itr; }
+      friend ETL_CONSTEXPR14 iterator operator -(iterator itr, difference_type n) { itr.row -= n; return itr; }
+
+      friend ETL_CONSTEXPR difference_type operator -(const iterator& lhs, const iterator& rhs) { return lhs.row - rhs.row; }
+
+      friend ETL_CONSTEXPR bool operator ==(const iterator& lhs, const iterator& rhs) { return lhs.row == rhs.row; }
+      friend ETL_CONSTEXPR bool operator !=(const iterator& lhs, const iterator& rhs) { return lhs.row != rhs.row; }
+      friend ETL_CONSTEXPR bool operator <(const iterator& lhs, const iterator& rhs)  { return lhs.row < rhs.row; }
+      friend ETL_CONSTEXPR bool operator >(const iterator& lhs, const iterator& rhs)  { return lhs.row > rhs.row; }
+      friend ETL_CONSTEXPR bool operator <=(const iterator& lhs, const iterator& rhs) { return lhs.row <= rhs.row; }
+      friend ETL_CONSTEXPR bool operator >=(const iterator& lhs, const iterator& rhs) { return lhs.row >= rhs.row; }
+
+    private:
+
+      ETL_CONSTEXPR iterator(grid_type* p_grid_, size_t column_, difference_type row_)
+        : p_grid(p_grid_)
+        , column(column_)
+        , row(row_)
+      {
+      }
+
+      grid_type*      p_grid;
+      size_t          column;
+      difference_type row;
+    };
+
+    typedef iterator const_iterator;
+
+    //*************************************************************************
+    /// Constructs a view of the column of the grid.
+    //*************************************************************************
+    ETL_CONSTEXPR multi_array_column(grid_type& grid, size_t column_)
+      : p_grid(&grid)
+      , column(column_)
+    {
+    }
+
+    ETL_CONSTEXPR14 reference operator [](size_t row) const { return (*p_grid)[row][column]; }
+    ETL_CONSTEXPR14 reference front() const                 { return (*p_grid)[0U][column]; }
+    ETL_CONSTEXPR14 reference back() const                  { return (*p_grid)[Rows - 1U][column]; }
+
+    ETL_CONSTEXPR14 iterator begin() const { return iterator(p_grid, column, 0); }
+    ETL_CONSTEXPR14 iterator end() const   { return iterator(p_grid, column, difference_type(Rows)); }
+
+    static ETL_CONSTEXPR size_type size() { return Rows; }
+    static ETL_CONSTEXPR bool      empty() { return Rows == 0U; }
+
+  private:
+
+    grid_type* p_grid;
+    size_t     column;
+  };
+
+  //***************************************************************************
+  /// A column of a 2D multi_array.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <typename T, size_t Rows, size_t Cols>
+  ETL_CONSTEXPR14 etl::multi_array_column<T, Rows, Cols> column_of(etl::array<etl::array<T, Cols>, Rows>& grid, size_t column)
+  {
+    return etl::multi_array_column<T, Rows, Cols>(grid, column);
+  }
+
+  //***************************************************************************
+  /// A column of a 2D multi_array.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <typename T, size_t Rows, size_t Cols>
+  ETL_CONSTEXPR14 etl::multi_array_column<const T, Rows, Cols> column_of(const etl::array<etl::array<T, Cols>, Rows>& grid, size_t column)
+  {
+    return etl::multi_array_column<const T, Rows, Cols>(grid, column);
+  }
+
+  namespace private_multi_array
+  {
+    //*************************************************************************
+    /// Calls f(element, row, column) for every element, one
+    /// Tile_Rows x Tile_Cols tile at a time. Tiles are visited in row major
+    /// order, as are the elements within each tile.
+    //*************************************************************************
+    template <size_t Tile_Rows, size_t Tile_Cols, typename TGrid, size_t Rows, size_t Cols, typename TFunction>
+    void for_each_tile(TGrid& grid, TFunction& f)
+    {
+      ETL_STATIC_ASSERT((Tile_Rows != 0U) && (Tile_Cols != 0U), "Tile size must not be zero");
+
+      for (size_t tile_row = 0U; tile_row < Rows; tile_row += Tile_Rows)
+      {
+        const size_t row_end = (Rows - tile_row) < Tile_Rows ? Rows : tile_row + Tile_Rows;
+
+        for (size_t tile_col = 0U; tile_col < Cols; tile_col += Tile_Cols)
+        {
+          const size_t col_end = (Cols - tile_col) < Tile_Cols ? Cols : tile_col + Tile_Cols;
+
+          for (size_t row = tile_row; row < row_end; ++row)
+          {
+            for (size_t col = tile_col; col < col_end; ++col)
+            {
+              f(grid[row][col], row, col);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Calls f(element, row, column) for every element of a 2D multi_array,
+  /// one Tile_Rows x Tile_Cols tile at a time.
+  /// Returns the function object.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <size_t Tile_Rows, size_t Tile_Cols = Tile_Rows, typename T, size_t Rows, size_t Cols, typename TFunction>
+  TFunction for_each_tile(etl::array<etl::array<T, Cols>, Rows>& grid, TFunction f)
+  {
+    private_multi_array::for_each_tile<Tile_Rows, Tile_Cols, etl::multi_array<T, Rows, Cols>, Rows, Cols>(grid, f);
+
+    return f;
+  }
+
+  //***************************************************************************
+  /// Calls f(element, row, column) for every element of a 2D multi_array,
+  /// one Tile_Rows x Tile_Cols tile at a time.
+  /// Returns the function object.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <size_t Tile_Rows, size_t Tile_Cols = Tile_Rows, typename T, size_t Rows, size_t Cols, typename TFunction>
+  TFunction for_each_tile(const etl::array<etl::array<T, Cols>, Rows>& grid, TFunction f)
+  {
+    private_multi_array::for_each_tile<Tile_Rows, Tile_Cols, const etl::multi_array<T, Rows, Cols>, Rows, Cols>(grid, f);
+
+    return f;
+  }
+
+  //***************************************************************************
+  /// Writes the transpose of source to destination, one Tile x Tile block at
+  /// a time, so that the column wise writes stay within a few cache lines.
+  /// source and destination must not be the same object.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <size_t Tile = ETL_MULTI_ARRAY_DEFAULT_TILE, typename T, size_t Rows, size_t Cols>
+  void transpose(const etl::array<etl::array<T, Cols>, Rows>& source, etl::array<etl::array<T, Rows>, Cols>& destination)
+  {
+    ETL_STATIC_ASSERT(Tile != 0U, "Tile size must not be zero");
+
+    for (size_t tile_row = 0U; tile_row < Rows; tile_row += Tile)
+    {
+      const size_t row_end = (Rows - tile_row) < Tile ? Rows : tile_row + Tile;
+
+      for (size_t tile_col = 0U; tile_col < Cols; tile_col += Tile)
+      {
+        const size_t col_end = (Cols - tile_col) < Tile ? Cols : tile_col + Tile;
+
+        for (size_t row = tile_row; row < row_end; ++row)
+        {
+          for (size_t col = tile_col; col < col_end; ++col)
+          {
+            destination[col][row] = source[row][col];
+          }
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Transposes a square multi_array in place, one pair of Tile x Tile
+  /// blocks at a time.
+  ///\ingroup multi_array
+  //***************************************************************************
+  template <size_t Tile = ETL_MULTI_ARRAY_DEFAULT_TILE, typename T, size_t N>
+  void transpose(etl::array<etl::array<T, N>, N>& grid)
+  {
+    ETL_STATIC_ASSERT(Tile != 0U, "Tile size must not be zero");
+
+    using ETL_OR_STD::swap;
+
+    for (size_t tile_row = 0U; tile_row < N; tile_row += Tile)
+    {
+      const size_t row_end = (N - tile_row) < Tile ? N : tile_row + Tile;
+
+      // Diagonal block, swapped with itself.
+      for (size_t row = tile_row; row < row_end; ++row)
+      {
+        for (size_t col = row + 1U; col < row_end; ++col)
+        {
+          swap(grid[row][col], grid[col][row]);
+        }
+      }
+
+      // Blocks to the right of the diagonal, swapped with their mirror below.
+      for (size_t tile_col = row_end; tile_col < N; tile_col += Tile)
+      {
+        const size_t col_end = (N - tile_col) < Tile ? N : tile_col + Tile;
+
+        for (size_t row = tile_row; row < row_end; ++row)
+        {
+          for (size_t col = tile_col; col < col_end; ++col)
+          {
+            swap(grid[row][col], grid[col][row]);
+          }
+        }
+      }
+    }
+  }
+
 #endif
 }
 
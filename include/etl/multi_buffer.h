@@ -0,0 +1,354 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MULTI_BUFFER_INCLUDED
+#define ETL_MULTI_BUFFER_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "span.h"
+#include "delegate.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup multi_buffer multi_buffer
+/// Zero copy buffers for continuous DMA streams, such as ADC or I2S capture.
+/// The DMA runs in circular mode over data(), which is Block_Count blocks of
+/// Block_Size elements. Its block (or half and full) complete interrupt calls
+/// block_complete(). The CPU processes the oldest completed block in place
+/// while the DMA fills the next.
+///\code
+/// etl::double_buffer<int16_t, 256> samples;
+///
+/// start_dma_circular(samples.data(), samples.size());
+///
+/// void DMA_IRQHandler()
+/// {
+///   if (half_transfer) samples.half_complete();
+///   if (transfer_complete) samples.full_complete();
+/// }
+///
+/// etl::span<int16_t> block = samples.acquire();
+/// if (!block.empty()) { process(block); samples.release(); }
+///\endcode
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A buffer of Count blocks of N elements, filled in turn by a producer,
+  /// usually a DMA, and processed in place by one consumer.
+  /// An overrun is when the producer starts to fill a block that the consumer
+  /// has not released. It is counted, the overrun callback is called, and the
+  /// overwritten blocks are skipped by the consumer.
+  ///\tparam T     The element type.
+  ///\tparam N     The number of elements in each block.
+  ///\tparam Count The number of blocks. At least 2.
+  ///\ingroup multi_buffer
+  //***************************************************************************
+  template <typename T, size_t N, size_t Count>
+  class multi_buffer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Count >= 2U, "At least two blocks are needed");
+    ETL_STATIC_ASSERT(N > 0U, "Blocks must not be empty");
+
+    typedef T                                 value_type;
+    typedef etl::span<T>                      span_type;
+    typedef etl::delegate<void(etl::span<T>)> ready_callback_type;
+    typedef etl::delegate<void(void)>         overrun_callback_type;
+
+    static ETL_CONSTANT size_t Block_Size  = N;
+    static ETL_CONSTANT size_t Block_Count = Count;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    multi_buffer()
+      : write_block(0U)
+      , read_block(0U)
+      , ready_callback()
+      , overrun_callback()
+    {
+      completed.store(0U);
+      consumed.store(0U);
+      overruns.store(0U);
+    }
+
+    //*************************************************************************
+    /// Gets the start of the buffer, for the DMA.
+    //*************************************************************************
+    T* data()
+    {
+      return buffer;
+    }
+
+    //*************************************************************************
+    /// Gets the start of the buffer.
+    //*************************************************************************
+    const T* data() const
+    {
+      return buffer;
+    }
+
+    //*************************************************************************
+    /// Gets the number of elements in the whole buffer.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return N * Count;
+    }
+
+    //*************************************************************************
+    /// Gets the number of bytes in the whole buffer.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size_bytes() const
+    {
+      return N * Count * sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Gets a block by index.
+    //*************************************************************************
+    etl::span<T> block(size_t index)
+    {
+      return etl::span<T>(buffer + (index * N), N);
+    }
+
+    //*************************************************************************
+    /// Sets the callback for each completed block.
+    /// Called from block_complete(), so usually from an interrupt.
+    //*************************************************************************
+    void set_ready_callback(ready_callback_type callback)
+    {
+      ready_callback = callback;
+    }
+
+    //*************************************************************************
+    /// Sets the callback for an overrun.
+    /// Called from block_complete(), so usually from an interrupt.
+    //*************************************************************************
+    void set_overrun_callback(overrun_callback_type callback)
+    {
+      overrun_callback = callback;
+    }
+
+    //*************************************************************************
+    /// Called by the producer when the block that it was filling is complete,
+    /// and it has moved on to the next.
+    //*************************************************************************
+    void block_complete()
+    {
+      complete(1U);
+    }
+
+    //*************************************************************************
+    /// Called by the producer when the block with the index has just completed.
+    /// Any blocks before it that were not reported are completed too, which
+    /// keeps the buffer in step with the DMA if an interrupt was missed.
+    //*************************************************************************
+    void block_complete(size_t index)
+    {
+      complete(((index + Count - write_block) % Count) + 1U);
+    }
+
+    //*************************************************************************
+    /// Gets the oldest completed block, or an empty span if there is none.
+    /// The block stays acquired until release() is called.
+    /// Only to be called by the consumer.
+    //*************************************************************************
+    etl::span<T> acquire()
+    {
+      const uint32_t done  = completed.load(etl::memory_order_acquire);
+      const uint32_t taken = consumed.load(etl::memory_order_relaxed);
+      const uint32_t ahead = done - taken;
+
+      if (ahead == 0U)
+      {
+        return etl::span<T>();
+      }
+
+      if (ahead >= Count)
+      {
+        // The producer has lapped the oldest blocks. Skip to the oldest intact one.
+        const uint32_t lost = ahead - uint32_t(Count - 1U);
+
+        read_block = (read_block + (lost % Count)) % Count;
+        consumed.store(taken + lost, etl::memory_order_release);
+      }
+
+      return block(read_block);
+    }
+
+    //*************************************************************************
+    /// Releases the block from acquire(), for the producer to fill again.
+    /// Returns <b>false</b> if the producer started to overwrite it while it
+    /// was held, so that its contents may be mixed.
+    /// Only to be called by the consumer.
+    //*************************************************************************
+    bool release()
+    {
+      const uint32_t done  = completed.load(etl::memory_order_acquire);
+      const uint32_t taken = consumed.load(etl::memory_order_relaxed);
+
+      if (done == taken)
+      {
+        // Nothing acquired.
+        return true;
+      }
+
+      const bool intact = (done - taken) < Count;
+
+      read_block = (read_block + 1U) % Count;
+      consumed.store(taken + 1U, etl::memory_order_release);
+
+      return intact;
+    }
+
+    //*************************************************************************
+    /// Gets the number of completed blocks not yet released, up to Count.
+    //*************************************************************************
+    size_t ready_count() const
+    {
+      const uint32_t ahead = completed.load(etl::memory_order_acquire) - consumed.load(etl::memory_order_relaxed);
+
+      return (ahead > Count) ? Count : size_t(ahead);
+    }
+
+    //*************************************************************************
+    /// Gets the number of overruns since the last reset.
+    //*************************************************************************
+    uint32_t overrun_count() const
+    {
+      return overruns.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Restarts at the first block, with none completed.
+    /// Not to be called while the producer is running.
+    //*************************************************************************
+    void reset()
+    {
+      write_block = 0U;
+      read_block  = 0U;
+      completed.store(0U);
+      consumed.store(0U);
+      overruns.store(0U);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Completes 'count' blocks from the one being written.
+    //*************************************************************************
+    void complete(size_t count)
+    {
+      write_block = (write_block + count) % Count;
+
+      const size_t last = (write_block + Count - 1U) % Count;
+
+      const uint32_t done = completed.load(etl::memory_order_relaxed) + uint32_t(count);
+
+      completed.store(done, etl::memory_order_release);
+
+      // The block now being filled has not been released.
+      if ((done - consumed.load(etl::memory_order_acquire)) >= Count)
+      {
+        overruns.fetch_add(1U, etl::memory_order_relaxed);
+
+        if (overrun_callback.is_valid())
+        {
+          overrun_callback();
+        }
+      }
+
+      if (ready_callback.is_valid())
+      {
+        ready_callback(block(last));
+      }
+    }
+
+    // Disable copy construction and assignment.
+    multi_buffer(const multi_buffer&) ETL_DELETE;
+    multi_buffer& operator =(const multi_buffer&) ETL_DELETE;
+
+    T                     buffer[N * Count];
+    size_t                write_block; ///< The block being filled. Only used by the producer.
+    size_t                read_block;  ///< The oldest unreleased block. Only used by the consumer.
+    etl::atomic<uint32_t> completed;   ///< The number of blocks completed.
+    etl::atomic<uint32_t> consumed;    ///< The number of blocks released.
+    etl::atomic<uint32_t> overruns;    ///< The number of overruns.
+    ready_callback_type   ready_callback;
+    overrun_callback_type overrun_callback;
+  };
+
+  template <typename T, size_t N, size_t Count>
+  ETL_CONSTANT size_t multi_buffer<T, N, Count>::Block_Size;
+
+  template <typename T, size_t N, size_t Count>
+  ETL_CONSTANT size_t multi_buffer<T, N, Count>::Block_Count;
+
+  //***************************************************************************
+  /// A ping-pong buffer of two halves, for a DMA with half and full transfer
+  /// complete interrupts.
+  ///\tparam T The element type.
+  ///\tparam N The number of elements in each half.
+  ///\ingroup multi_buffer
+  //***************************************************************************
+  template <typename T, size_t N>
+  class double_buffer : public etl::multi_buffer<T, N, 2U>
+  {
+  public:
+
+    //*************************************************************************
+    /// Called from the DMA half transfer complete interrupt.
+    //*************************************************************************
+    void half_complete()
+    {
+      this->block_complete(0U);
+    }
+
+    //*************************************************************************
+    /// Called from the DMA transfer complete interrupt.
+    //*************************************************************************
+    void full_complete()
+    {
+      this->block_complete(1U);
+    }
+  };
+}
+
+#endif
+#endif
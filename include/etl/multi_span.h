@@ -36,6 +36,11 @@ SOFTWARE.
 #include "algorithm.h"
 #include "vector.h"
 #include "span.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "byte_stream.h"
+
+#include <string.h>
 
 ///\defgroup multi_multi_span multi_span multi_span
 /// Scatter/Gather functionality
@@ -150,7 +155,7 @@ namespace etl
       //*************************************************************************
       friend bool operator ==(const iterator& lhs, const iterator& rhs)
       {
-        return (lhs.p_current == rhs.p_current);
+        return (lhs.p_current == rhs.p_current) && (lhs.p_value == rhs.p_value);
       }
 
       //*************************************************************************
@@ -279,62 +284,155 @@ namespace etl
     //*************************************************************************
     /// Returns the number of elements in the multi_span.
     //*************************************************************************
-    ETL_CONSTEXPR14 size_t size() const ETL_NOEXCEPT
+    ETL_CONSTEXPR size_t size() const ETL_NOEXCEPT
+    {
+      return count_elements(span_list.begin(), span_list.end(), 0U);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the multi_span size is zero.
+    //*************************************************************************
+    ETL_CONSTEXPR bool empty() const ETL_NOEXCEPT
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the multi_span.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size_bytes() const ETL_NOEXCEPT
+    {
+      return size() * sizeof(element_type);
+    }
+
+    //*************************************************************************
+    /// Returns the number of spans in the multi_span.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size_spans() const ETL_NOEXCEPT
     {
-      size_t total_n_spans = 0U;
+      return span_list.size();
+    }
 
+    //*************************************************************************
+    /// Calls 'function' with each non-empty span, in order.
+    ///\return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_segment(TFunction function) const
+    {
       for (typename span_list_type::iterator itr = span_list.begin();
-           itr != span_list.end(); 
+           itr != span_list.end();
            ++itr)
       {
-        total_n_spans += itr->size();
+        if (!itr->empty())
+        {
+          function(*itr);
+        }
       }
 
-      return total_n_spans;
+      return function;
     }
 
     //*************************************************************************
-    /// Returns <b>true</b> if the multi_span size is zero.
+    /// Copies the bytes of the elements to 'destination', a span at a time.
+    /// Copies no more than the size of the destination.
+    ///\return The number of bytes copied.
     //*************************************************************************
-    ETL_CONSTEXPR bool empty() const ETL_NOEXCEPT
+    template <typename TByte, size_t Extent>
+    size_t copy_to(etl::span<TByte, Extent> destination) const
     {
-      if (span_list.empty())
-      {
-        return true;
-      }
-      else
+      ETL_STATIC_ASSERT(sizeof(TByte) == 1U, "The destination must be a span of bytes");
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<value_type>::value, "The elements must be trivially copyable");
+
+      char*  p_destination = reinterpret_cast<char*>(destination.data());
+      size_t remaining     = destination.size();
+
+      for (typename span_list_type::iterator itr = span_list.begin();
+           (itr != span_list.end()) && (remaining != 0U);
+           ++itr)
       {
-        return size() == 0U;
+        const size_t n = etl::min(itr->size_bytes(), remaining);
+
+        if (n != 0U)
+        {
+          memcpy(p_destination, itr->data(), n);
+          p_destination += n;
+          remaining     -= n;
+        }
       }
+
+      return destination.size() - remaining;
     }
 
     //*************************************************************************
-    /// Returns the size of the multi_span.
+    /// Copies bytes from 'source' to the elements, a span at a time.
+    /// Copies no more than the size of the source.
+    ///\return The number of bytes copied.
     //*************************************************************************
-    ETL_CONSTEXPR14 size_t size_bytes() const ETL_NOEXCEPT
+    template <typename TByte, size_t Extent>
+    size_t copy_from(etl::span<TByte, Extent> source) const
     {
-      size_t total_n_spans_bytes = 0U;
+      ETL_STATIC_ASSERT(sizeof(TByte) == 1U, "The source must be a span of bytes");
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<value_type>::value, "The elements must be trivially copyable");
+      ETL_STATIC_ASSERT(!etl::is_const<element_type>::value, "Cannot copy to const elements");
+
+      const char* p_source  = reinterpret_cast<const char*>(source.data());
+      size_t      remaining = source.size();
 
-      for (typename span_list_type::iterator itr = span_list.begin(); 
-           itr != span_list.end(); 
+      for (typename span_list_type::iterator itr = span_list.begin();
+           (itr != span_list.end()) && (remaining != 0U);
            ++itr)
       {
-        total_n_spans_bytes += itr->size_bytes();
+        const size_t n = etl::min(itr->size_bytes(), remaining);
+
+        if (n != 0U)
+        {
+          memcpy(itr->data(), p_source, n);
+          p_source  += n;
+          remaining -= n;
+        }
       }
 
-      return total_n_spans_bytes;
+      return source.size() - remaining;
     }
 
     //*************************************************************************
-    /// Returns the number of spans in the multi_span.
+    /// Writes the elements to a byte stream, a span at a time.
+    /// The elements are written with the stream's endianness, so each span
+    /// is a single block copy when it already matches the stream's layout.
+    /// Writes nothing if the stream does not have room for all of the elements.
+    ///\return <b>true</b> if the elements were written.
     //*************************************************************************
-    ETL_CONSTEXPR size_t size_spans() const ETL_NOEXCEPT
+    bool write_to(etl::byte_stream_writer& writer) const
     {
-      return span_list.size();
+      if (writer.available<value_type>() < size())
+      {
+        return false;
+      }
+
+      for (typename span_list_type::iterator itr = span_list.begin();
+           itr != span_list.end();
+           ++itr)
+      {
+        if (!itr->empty())
+        {
+          writer.write_unchecked(itr->data(), itr->size());
+        }
+      }
+
+      return true;
     }
 
   private:
 
+    //*************************************************************************
+    /// Sums the sizes of the spans.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t count_elements(const span_type* first, const span_type* last, size_t total) ETL_NOEXCEPT
+    {
+      return (first == last) ? total : count_elements(first + 1, last, total + first->size());
+    }
+
     span_list_type span_list;
   };
 }
@@ -40,6 +40,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "debug_count.h"
 #include "nullptr.h"
+#include "static_assert.h"
 #include "type_traits.h"
 #include "nth_type.h"
 #include "parameter_type.h"
@@ -52,6 +53,7 @@ SOFTWARE.
 
 #include "private/minmax_push.h"
 #include "private/comparator_is_transparent.h"
+#include "private/tree_node_link.h"
 
 //*****************************************************************************
 /// A multimap with the capacity defined at compile time.
@@ -190,6 +192,8 @@ namespace etl
     //*************************************************************************
     struct Node
     {
+      typedef etl::private_tree::node_link<Node>::type link_type;
+
       //***********************************************************************
       /// Constructor
       //***********************************************************************
@@ -214,8 +218,8 @@ namespace etl
         children[1] = ETL_NULLPTR;
       }
 
-      Node* parent;
-      Node* children[2];
+      link_type parent;
+      link_type children[2];
       uint_least8_t weight;
       uint_least8_t dir;
     };
@@ -240,7 +244,8 @@ namespace etl
     //*************************************************************************
     /// Balance the critical node at the position provided as needed
     //*************************************************************************
-    void balance_node(Node*& critical_node)
+    template <typename TLink>
+    void balance_node(TLink& critical_node)
     {
       // Step 1: Update weights for all children of the critical node up to the
       // newly inserted node. This step is costly (in terms of traversing nodes
@@ -303,7 +308,8 @@ namespace etl
     //*************************************************************************
     /// Rotate two nodes at the position provided the to balance the tree
     //*************************************************************************
-    void rotate_2node(Node*& position, uint_least8_t dir)
+    template <typename TLink>
+    void rotate_2node(TLink& position, uint_least8_t dir)
     {
       //     A            C             A          B
       //   B   C   ->   A   E   OR    B   C  ->  D   A
@@ -344,7 +350,8 @@ namespace etl
     //*************************************************************************
     /// Rotate three nodes at the position provided the to balance the tree
     //*************************************************************************
-    void rotate_3node(Node*& position, uint_least8_t dir, uint_least8_t third)
+    template <typename TLink>
+    void rotate_3node(TLink& position, uint_least8_t dir, uint_least8_t third)
     {
       //        --A--             --E--            --A--             --D--
       //      _B_    C    ->     B     A    OR    B    _C_   ->     A     C
@@ -557,7 +564,8 @@ namespace etl
     //*************************************************************************
     /// Attach the provided node to the position provided
     //*************************************************************************
-    void attach_node(Node* parent, Node*& position, Node& node)
+    template <typename TLink>
+    void attach_node(Node* parent, TLink& position, Node& node)
     {
       // Mark new node as leaf on attach to tree at position provided
       node.mark_as_leaf();
@@ -575,7 +583,8 @@ namespace etl
     //*************************************************************************
     /// Detach the node at the position provided
     //*************************************************************************
-    void detach_node(Node*& position, Node*& replacement)
+    template <typename TPositionLink, typename TReplacementLink>
+    void detach_node(TPositionLink& position, TReplacementLink& replacement)
     {
       // Make temporary copy of actual nodes involved because we might lose
       // their references in the process (e.g. position is the same as
@@ -1478,6 +1487,25 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Checks to see if the multimap is full.
+    /// The nodes come from the pool, which may be shared with other multimaps.
+    //*************************************************************************
+    bool full() const
+    {
+      return p_node_pool->full();
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    /// The nodes come from the pool, which may be shared with other multimaps.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return p_node_pool->available();
+    }
+
     //*************************************************************************
     /// How to compare two key elements.
     //*************************************************************************
@@ -1522,6 +1550,14 @@ namespace etl
     {
     }
 
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_node_pool() const
+    {
+      return *p_node_pool;
+    }
+
     //*************************************************************************
     /// Initialise the multimap.
     //*************************************************************************
@@ -2438,11 +2474,176 @@ namespace etl
 
     /// The pool of data nodes used for the multimap.
     etl::pool<typename etl::imultimap<TKey, TValue, TCompare>::Data_Node, MAX_SIZE> node_pool;
+
+    ETL_STATIC_ASSERT(etl::private_tree::node_link_in_range<sizeof(etl::pool<typename etl::imultimap<TKey, TValue, TCompare>::Data_Node, MAX_SIZE>)>::value, "Pool is too large for ETL_COMPACT_TREE_NODE_OFFSET_TYPE");
   };
 
   template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
   ETL_CONSTANT size_t multimap<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
 
+  //*************************************************************************
+  /// A templated multimap implementation that uses a shared pool of nodes.
+  /// Create the pool as etl::pool<etl::multimap_ext<...>::pool_type, N>.
+  /// Many multimap_ext instances may share one pool, so that they do not each
+  /// have to reserve nodes for the worst case.
+  //*************************************************************************
+  template <typename TKey, typename TValue, typename TCompare = etl::less<TKey> >
+  class multimap_ext : public etl::imultimap<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::imultimap<TKey, TValue, TCompare> base_t;
+
+  public:
+
+    typedef typename base_t::value_type value_type;
+    typedef typename base_t::Data_Node  pool_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    explicit multimap_ext(etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Implicit pool.
+    //*************************************************************************
+    multimap_ext(const multimap_ext& other)
+      : base_t(other.get_node_pool(), other.get_node_pool().max_size())
+    {
+      if (this != &other)
+      {
+        this->assign(other.cbegin(), other.cend());
+      }
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Explicit pool.
+    //*************************************************************************
+    multimap_ext(const multimap_ext& other, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      if (this != &other)
+      {
+        this->assign(other.cbegin(), other.cend());
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor. Implicit pool.
+    //*************************************************************************
+    multimap_ext(multimap_ext&& other)
+      : base_t(other.get_node_pool(), other.get_node_pool().max_size())
+    {
+      move_items(other);
+    }
+
+    //*************************************************************************
+    /// Move constructor. Explicit pool.
+    //*************************************************************************
+    multimap_ext(multimap_ext&& other, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      move_items(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    multimap_ext(TIterator first, TIterator last, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    multimap_ext(std::initializer_list<value_type> init, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    /// Releases the nodes back to the shared pool.
+    //*************************************************************************
+    ~multimap_ext()
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    multimap_ext& operator = (const multimap_ext& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    multimap_ext& operator = (multimap_ext&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->clear();
+        move_items(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_pool() const
+    {
+      return this->get_node_pool();
+    }
+
+  private:
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the items from another multimap_ext.
+    /// The nodes of other are released, so that a shared pool is not drained.
+    //*************************************************************************
+    void move_items(multimap_ext& other)
+    {
+      typename base_t::iterator from = other.begin();
+
+      while (from != other.end())
+      {
+        this->insert(etl::move(*from));
+        from = other.erase(from);
+      }
+    }
+#endif
+  };
+
   //*************************************************************************
   /// Template deduction guides.
   //*************************************************************************
@@ -98,6 +98,28 @@ namespace etl
     mutex_type& m;
   };
 
+  //***************************************************************************
+  /// null_mutex
+  /// A mutex that does nothing, for classes that take their mutex type as a
+  /// template parameter and are used from one thread only.
+  //***************************************************************************
+  class null_mutex
+  {
+  public:
+
+    void lock()
+    {
+    }
+
+    bool try_lock()
+    {
+      return true;
+    }
+
+    void unlock()
+    {
+    }
+  };
 }
 
 #endif
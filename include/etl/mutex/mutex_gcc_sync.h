@@ -30,6 +30,7 @@ SOFTWARE.
 #define ETL_MUTEX_GCC_SYNC_INCLUDED
 
 #include "../platform.h"
+#include "../spin_mutex.h"
 
 #include <stdint.h>
 
@@ -38,40 +39,20 @@ namespace etl
   //***************************************************************************
   ///\ingroup mutex
   ///\brief This mutex class is implemented using GCC's __sync functions.
+  /// An etl::spin_mutex, waiting with plain loads and exponential backoff.
   //***************************************************************************
-  class mutex
+  class mutex : public etl::spin_mutex
   {
   public:
 
     mutex()
-      : flag(0)
     {
-      __sync_lock_release(&flag);
-    }
-
-    void lock()
-    {
-      while (__sync_lock_test_and_set(&flag, 1U))
-      {
-      }
-    }
-
-    bool try_lock()
-    {
-      return (__sync_lock_test_and_set(&flag, 1U) == 0U);
-    }
-
-    void unlock()
-    {
-      __sync_lock_release(&flag);
     }
 
   private:
 
     mutex(const mutex&) ETL_DELETE;
     mutex& operator=(const mutex&) ETL_DELETE;
-
-    char flag;
   };
 }
 
@@ -35,6 +35,8 @@ SOFTWARE.
 #include "type_traits.h"
 #include "limits.h"
 #include "iterator.h"
+#include "absolute.h"
+#include "static_assert.h"
 
 #if ETL_USING_STL
   #include <iterator>
@@ -62,6 +64,332 @@ namespace etl
     }
   }
 
+  //***************************************************************************
+  /// reduce
+  /// Reduces a range with a binary operation, starting with <b>init</b>.
+  /// Sequential, so the same as accumulate. See etl/execution.h for the
+  /// parallel version, which requires the operation to be associative.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  ETL_CONSTEXPR14 T reduce(TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    while (first != last)
+    {
+      init = operation(init, *first);
+      ++first;
+    }
+
+    return init;
+  }
+
+  namespace private_numeric
+  {
+    //*************************************************************************
+    /// Sums of pointers to arithmetic values use four accumulators, so that
+    /// each addition does not wait for the one before. Compilers may also
+    /// vectorise the loop. They remain plain loops, so stay usable in
+    /// constant expressions.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    struct is_unrolled_sum
+      : etl::integral_constant<bool, etl::is_pointer<TIterator>::value &&
+                                     etl::is_arithmetic<T>::value &&
+                                     etl::is_arithmetic<typename etl::iterator_traits<TIterator>::value_type>::value>
+    {
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14 T reduce(TIterator first, TIterator last, T init, etl::false_type)
+    {
+      while (first != last)
+      {
+        init = init + *first;
+        ++first;
+      }
+
+      return init;
+    }
+
+    //*************************************************************************
+    template <typename TPointer, typename T>
+    ETL_CONSTEXPR14 T reduce(TPointer first, TPointer last, T init, etl::true_type)
+    {
+      T sum0 = T(0);
+      T sum1 = T(0);
+      T sum2 = T(0);
+      T sum3 = T(0);
+
+      while ((last - first) >= 4)
+      {
+        sum0 = static_cast<T>(sum0 + first[0]);
+        sum1 = static_cast<T>(sum1 + first[1]);
+        sum2 = static_cast<T>(sum2 + first[2]);
+        sum3 = static_cast<T>(sum3 + first[3]);
+        first += 4;
+      }
+
+      init = static_cast<T>(init + static_cast<T>(static_cast<T>(sum0 + sum1) + static_cast<T>(sum2 + sum3)));
+
+      return reduce(first, last, init, etl::false_type());
+    }
+
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename T>
+    ETL_CONSTEXPR14 T transform_reduce(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init, etl::false_type)
+    {
+      while (first1 != last1)
+      {
+        init = init + (*first1 * *first2);
+        ++first1;
+        ++first2;
+      }
+
+      return init;
+    }
+
+    //*************************************************************************
+    template <typename TPointer1, typename TPointer2, typename T>
+    ETL_CONSTEXPR14 T transform_reduce(TPointer1 first1, TPointer1 last1, TPointer2 first2, T init, etl::true_type)
+    {
+      T sum0 = T(0);
+      T sum1 = T(0);
+      T sum2 = T(0);
+      T sum3 = T(0);
+
+      while ((last1 - first1) >= 4)
+      {
+        sum0 = static_cast<T>(sum0 + (first1[0] * first2[0]));
+        sum1 = static_cast<T>(sum1 + (first1[1] * first2[1]));
+        sum2 = static_cast<T>(sum2 + (first1[2] * first2[2]));
+        sum3 = static_cast<T>(sum3 + (first1[3] * first2[3]));
+        first1 += 4;
+        first2 += 4;
+      }
+
+      init = static_cast<T>(init + static_cast<T>(static_cast<T>(sum0 + sum1) + static_cast<T>(sum2 + sum3)));
+
+      return transform_reduce(first1, last1, first2, init, etl::false_type());
+    }
+  }
+
+  //***************************************************************************
+  /// reduce
+  /// Sums a range, starting with <b>init</b>.
+  /// As for std::reduce, the order of the additions is unspecified. Ranges of
+  /// arithmetic values given by pointers are summed with four accumulators,
+  /// which for floating point may round differently from accumulate.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  ETL_CONSTEXPR14 T reduce(TIterator first, TIterator last, T init)
+  {
+    return private_numeric::reduce(first, last, init, private_numeric::is_unrolled_sum<TIterator, T>());
+  }
+
+  //***************************************************************************
+  /// reduce_compensated
+  /// Sums a range of floating point values, starting with <b>init</b>,
+  /// carrying the rounding error of each addition into the next
+  /// (Kahan-Babuska summation). Much more accurate than reduce for long
+  /// ranges or values of differing magnitude, at about four times the cost.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  ETL_CONSTEXPR14 T reduce_compensated(TIterator first, TIterator last, T init)
+  {
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "reduce_compensated requires a floating point type");
+
+    T sum          = init;
+    T compensation = T(0);
+
+    while (first != last)
+    {
+      const T value = static_cast<T>(*first);
+      const T total = sum + value;
+
+      // Recover the low order bits lost from the smaller of the two.
+      if (etl::absolute(sum) >= etl::absolute(value))
+      {
+        compensation += (sum - total) + value;
+      }
+      else
+      {
+        compensation += (value - total) + sum;
+      }
+
+      sum = total;
+      ++first;
+    }
+
+    return sum + compensation;
+  }
+
+  //***************************************************************************
+  /// transform_reduce
+  /// The sum of the products of the elements of two ranges, starting with
+  /// <b>init</b>. Pointers to arithmetic values use four accumulators.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T>
+  ETL_CONSTEXPR14 T transform_reduce(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init)
+  {
+    typedef etl::integral_constant<bool, private_numeric::is_unrolled_sum<TIterator1, T>::value &&
+                                         private_numeric::is_unrolled_sum<TIterator2, T>::value> is_unrolled;
+
+    return private_numeric::transform_reduce(first1, last1, first2, init, is_unrolled());
+  }
+
+  //***************************************************************************
+  /// transform_reduce
+  /// Reduces the results of <b>transform</b> on pairs of elements of two
+  /// ranges with <b>reduce</b>, starting with <b>init</b>.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T, typename TReduce, typename TTransform>
+  ETL_CONSTEXPR14 T transform_reduce(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init, TReduce reduce, TTransform transform)
+  {
+    while (first1 != last1)
+    {
+      init = reduce(init, transform(*first1, *first2));
+      ++first1;
+      ++first2;
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// transform_reduce
+  /// Reduces the results of <b>transform</b> on the elements of a range with
+  /// <b>reduce</b>, starting with <b>init</b>.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TReduce, typename TTransform>
+  ETL_CONSTEXPR14 T transform_reduce(TIterator first, TIterator last, T init, TReduce reduce, TTransform transform)
+  {
+    while (first != last)
+    {
+      init = reduce(init, transform(*first));
+      ++first;
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// inclusive_scan
+  /// Writes the running sums of a range, each including its own element.
+  /// The output may be the input.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TBinaryOperation, typename T>
+  ETL_CONSTEXPR14 TOutputIterator inclusive_scan(TInputIterator first, TInputIterator last, TOutputIterator d_first, TBinaryOperation operation, T init)
+  {
+    while (first != last)
+    {
+      init = operation(init, *first);
+      *d_first = init;
+      ++first;
+      ++d_first;
+    }
+
+    return d_first;
+  }
+
+  //***************************************************************************
+  /// inclusive_scan
+  /// As above, starting with the first element.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TBinaryOperation>
+  ETL_CONSTEXPR14 TOutputIterator inclusive_scan(TInputIterator first, TInputIterator last, TOutputIterator d_first, TBinaryOperation operation)
+  {
+    if (first == last)
+    {
+      return d_first;
+    }
+
+    typename etl::iterator_traits<TInputIterator>::value_type sum = *first;
+
+    *d_first = sum;
+
+    return etl::inclusive_scan(++first, last, ++d_first, operation, sum);
+  }
+
+  //***************************************************************************
+  /// inclusive_scan
+  /// As above, with addition.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  ETL_CONSTEXPR14 TOutputIterator inclusive_scan(TInputIterator first, TInputIterator last, TOutputIterator d_first)
+  {
+    if (first == last)
+    {
+      return d_first;
+    }
+
+    typename etl::iterator_traits<TInputIterator>::value_type sum = *first;
+
+    *d_first = sum;
+    ++first;
+    ++d_first;
+
+    while (first != last)
+    {
+      sum = sum + *first;
+      *d_first = sum;
+      ++first;
+      ++d_first;
+    }
+
+    return d_first;
+  }
+
+  //***************************************************************************
+  /// exclusive_scan
+  /// Writes the running sums of a range, starting with <b>init</b>, each
+  /// excluding its own element. The output may be the input.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename T, typename TBinaryOperation>
+  ETL_CONSTEXPR14 TOutputIterator exclusive_scan(TInputIterator first, TInputIterator last, TOutputIterator d_first, T init, TBinaryOperation operation)
+  {
+    while (first != last)
+    {
+      // Read before writing, in case the output is the input.
+      const T next = operation(init, *first);
+      *d_first = init;
+      init = next;
+      ++first;
+      ++d_first;
+    }
+
+    return d_first;
+  }
+
+  //***************************************************************************
+  /// exclusive_scan
+  /// As above, with addition.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename T>
+  ETL_CONSTEXPR14 TOutputIterator exclusive_scan(TInputIterator first, TInputIterator last, TOutputIterator d_first, T init)
+  {
+    while (first != last)
+    {
+      const T next = init + *first;
+      *d_first = init;
+      init = next;
+      ++first;
+      ++d_first;
+    }
+
+    return d_first;
+  }
+
   //***************************************************************************
   /// midpoint
   /// For floating point.
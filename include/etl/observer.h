@@ -58,6 +58,9 @@ SOFTWARE.
 #include "exception.h"
 #include "error_handler.h"
 #include "utility.h"
+#include "span.h"
+#include "type_traits.h"
+#include "atomic.h"
 
 namespace etl
 {
@@ -89,6 +92,56 @@ namespace etl
     }
   };
 
+  namespace private_observer
+  {
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Does the observer take a span of notifications?
+    //*********************************************************************
+    template <typename TObserver, typename TSpan, typename = void>
+    struct accepts_batch : etl::false_type
+    {
+    };
+
+    template <typename TObserver, typename TSpan>
+    struct accepts_batch<TObserver, TSpan, etl::void_t<decltype(etl::declval<TObserver&>().notification(etl::declval<TSpan>()))> > : etl::true_type
+    {
+    };
+
+    //*********************************************************************
+    /// Sends the batch in one call.
+    //*********************************************************************
+    template <typename TObserver, typename TNotification>
+    typename etl::enable_if<accepts_batch<TObserver, etl::span<const TNotification> >::value>::type
+      notify_batch(TObserver& observer, etl::span<const TNotification> notifications)
+    {
+      observer.notification(notifications);
+    }
+
+    //*********************************************************************
+    /// Sends each notification of the batch in turn.
+    //*********************************************************************
+    template <typename TObserver, typename TNotification>
+    typename etl::enable_if<!accepts_batch<TObserver, etl::span<const TNotification> >::value>::type
+      notify_batch(TObserver& observer, etl::span<const TNotification> notifications)
+    {
+      for (size_t i = 0U; i < notifications.size(); ++i)
+      {
+        observer.notification(notifications[i]);
+      }
+    }
+#else
+    //*********************************************************************
+    /// Sends the batch in one call.
+    //*********************************************************************
+    template <typename TObserver, typename TNotification>
+    void notify_batch(TObserver& observer, etl::span<const TNotification> notifications)
+    {
+      observer.notification(notifications);
+    }
+#endif
+  }
+
   //*********************************************************************
   /// The object that is being observed.
   ///\tparam TObserver     The observer type.
@@ -253,6 +306,30 @@ namespace etl
       }
     }
 
+    //*****************************************************************
+    /// Notify all of the observers of a batch of notifications.
+    /// An observer that has etl::span<const TNotification> as a notification
+    /// type receives the whole batch in one call.
+    /// From C++11, other observers receive each notification in turn.
+    ///\tparam TNotification The notification type.
+    ///\param notifications The notifications.
+    //*****************************************************************
+    template <typename TNotification>
+    void notify_observers(etl::span<const TNotification> notifications)
+    {
+      typename Observer_List::iterator i_observer_item = observer_list.begin();
+
+      while (i_observer_item != observer_list.end())
+      {
+        if (i_observer_item->enabled)
+        {
+          private_observer::notify_batch(*i_observer_item->p_observer, notifications);
+        }
+
+        ++i_observer_item;
+      }
+    }
+
   protected:
 
     ~observable()
@@ -274,6 +351,324 @@ namespace etl
     Observer_List observer_list;
   };
 
+#if ETL_HAS_ATOMIC
+  //*********************************************************************
+  /// An object that is being observed, where the observers may be changed
+  /// while notifications are being sent from another thread or interrupt.
+  /// There are two observer lists. Notifications read the active list without
+  /// locking. A change copies the active list to the other one, changes the
+  /// copy and makes it the active list.
+  /// A change waits for any notification still reading the other list from
+  /// before the last change, so a notification may change the observers
+  /// once. Changes from several threads are serialised with a spin lock.
+  /// A removed observer may still be notified by notifications that were
+  /// already running. Call synchronize() before destroying it.
+  ///\tparam TObserver     The observer type.
+  ///\tparam MAX_OBSERVERS The maximum number of observers that can be accommodated.
+  ///\ingroup observer
+  //*********************************************************************
+  template <typename TObserver, const size_t MAX_OBSERVERS>
+  class observable_atomic
+  {
+  private:
+
+    //***********************************
+    // Item stored in the observer list.
+    //***********************************
+    struct observer_item
+    {
+      observer_item(TObserver& observer_)
+        : p_observer(&observer_)
+        , enabled(true)
+      {
+      }
+
+      TObserver* p_observer;
+      bool       enabled;
+    };
+
+    //***********************************
+    // How to compare an observer with an observer list item.
+    //***********************************
+    struct compare_observers
+    {
+      compare_observers(TObserver& observer_)
+        : p_observer(&observer_)
+      {
+      }
+
+      bool operator ()(const observer_item& item) const
+      {
+        return p_observer == item.p_observer;
+      }
+
+      TObserver* p_observer;
+    };
+
+  public:
+
+    typedef size_t size_type;
+
+    typedef etl::vector<observer_item, MAX_OBSERVERS> Observer_List;
+
+    //*****************************************************************
+    /// Constructor.
+    //*****************************************************************
+    observable_atomic()
+      : active(0U)
+      , updating(false)
+    {
+      readers[0].store(0U);
+      readers[1].store(0U);
+    }
+
+    //*****************************************************************
+    /// Add an observer to the list.
+    /// If asserts or exceptions are enabled then an etl::observable_observer_list_full
+    /// is emitted if the observer list is already full.
+    ///\param observer A reference to the observer.
+    //*****************************************************************
+    void add_observer(TObserver& observer)
+    {
+      Observer_List& list = begin_update();
+
+      bool is_full = false;
+
+      if (find_observer(list, observer) == list.end())
+      {
+        is_full = list.full();
+
+        if (!is_full)
+        {
+          list.push_back(observer_item(observer));
+        }
+      }
+
+      end_update();
+
+      ETL_ASSERT(!is_full, ETL_ERROR(etl::observer_list_full));
+    }
+
+    //*****************************************************************
+    /// Remove a particular observer from the list.
+    ///\param observer A reference to the observer.
+    ///\return <b>true</b> if the observer was removed, <b>false</b> if not.
+    //*****************************************************************
+    bool remove_observer(TObserver& observer)
+    {
+      Observer_List& list = begin_update();
+
+      typename Observer_List::iterator i_observer_item = find_observer(list, observer);
+
+      const bool found = (i_observer_item != list.end());
+
+      if (found)
+      {
+        list.erase(i_observer_item);
+      }
+
+      end_update();
+
+      return found;
+    }
+
+    //*****************************************************************
+    /// Enable an observer
+    ///\param observer A reference to the observer.
+    ///\param state    <b>true</b> to enable, <b>false</b> to disable. Default is enable.
+    //*****************************************************************
+    void enable_observer(TObserver& observer, bool state = true)
+    {
+      Observer_List& list = begin_update();
+
+      typename Observer_List::iterator i_observer_item = find_observer(list, observer);
+
+      if (i_observer_item != list.end())
+      {
+        i_observer_item->enabled = state;
+      }
+
+      end_update();
+    }
+
+    //*****************************************************************
+    /// Disable an observer
+    //*****************************************************************
+    void disable_observer(TObserver& observer)
+    {
+      enable_observer(observer, false);
+    }
+
+    //*****************************************************************
+    /// Clear all observers from the list.
+    //*****************************************************************
+    void clear_observers()
+    {
+      begin_update().clear();
+      end_update();
+    }
+
+    //*****************************************************************
+    /// Returns the number of observers.
+    //*****************************************************************
+    size_type number_of_observers() const
+    {
+      const uint32_t index = begin_read();
+      const size_type size = lists[index].size();
+      end_read(index);
+
+      return size;
+    }
+
+    //*****************************************************************
+    /// Waits until no notification is reading an observer list from before
+    /// the last change. Must not be called from a notification.
+    //*****************************************************************
+    void synchronize() const
+    {
+      const uint32_t previous = active.load() ^ 1U;
+
+      while (readers[previous].load() != 0U)
+      {
+      }
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers, sending them the notification.
+    /// Does not lock.
+    ///\tparam TNotification The notification type.
+    ///\param n The notification.
+    //*****************************************************************
+    template <typename TNotification>
+    void notify_observers(TNotification n)
+    {
+      const uint32_t index = begin_read();
+      const Observer_List& list = lists[index];
+
+      for (size_t i = 0U; i < list.size(); ++i)
+      {
+        if (list[i].enabled)
+        {
+          list[i].p_observer->notification(n);
+        }
+      }
+
+      end_read(index);
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers of a batch of notifications.
+    /// An observer that has etl::span<const TNotification> as a notification
+    /// type receives the whole batch in one call.
+    /// From C++11, other observers receive each notification in turn.
+    /// Does not lock.
+    ///\tparam TNotification The notification type.
+    ///\param notifications The notifications.
+    //*****************************************************************
+    template <typename TNotification>
+    void notify_observers(etl::span<const TNotification> notifications)
+    {
+      const uint32_t index = begin_read();
+      const Observer_List& list = lists[index];
+
+      for (size_t i = 0U; i < list.size(); ++i)
+      {
+        if (list[i].enabled)
+        {
+          private_observer::notify_batch(*list[i].p_observer, notifications);
+        }
+      }
+
+      end_read(index);
+    }
+
+  protected:
+
+    ~observable_atomic()
+    {
+    }
+
+  private:
+
+    //*****************************************************************
+    /// Find an observer in a list.
+    /// Returns the end of the list if not found.
+    //*****************************************************************
+    static typename Observer_List::iterator find_observer(Observer_List& list, TObserver& observer_)
+    {
+      return etl::find_if(list.begin(), list.end(), compare_observers(observer_));
+    }
+
+    //*****************************************************************
+    /// Marks the active list as being read.
+    /// Checks that it is still active once marked, so that a change
+    /// cannot start to overwrite it.
+    //*****************************************************************
+    uint32_t begin_read() const
+    {
+      while (true)
+      {
+        const uint32_t index = active.load();
+
+        readers[index].fetch_add(1U);
+
+        if (active.load() == index)
+        {
+          return index;
+        }
+
+        readers[index].fetch_sub(1U);
+      }
+    }
+
+    //*****************************************************************
+    void end_read(uint32_t index) const
+    {
+      readers[index].fetch_sub(1U);
+    }
+
+    //*****************************************************************
+    /// Locks out other changes and returns a copy of the active list, in
+    /// the list that is not active, once no notification is reading it.
+    //*****************************************************************
+    Observer_List& begin_update()
+    {
+      while (updating.exchange(true))
+      {
+      }
+
+      const uint32_t current = active.load();
+      const uint32_t next    = current ^ 1U;
+
+      while (readers[next].load() != 0U)
+      {
+      }
+
+      lists[next] = lists[current];
+
+      return lists[next];
+    }
+
+    //*****************************************************************
+    /// Makes the changed list the active one.
+    //*****************************************************************
+    void end_update()
+    {
+      active.store(active.load() ^ 1U);
+      updating.store(false);
+    }
+
+    // Disabled.
+    observable_atomic(const observable_atomic&) ETL_DELETE;
+    observable_atomic& operator =(const observable_atomic&) ETL_DELETE;
+
+    Observer_List                  lists[2]; ///< The active list and the one for the next change.
+    etl::atomic<uint32_t>          active;   ///< The index of the active list.
+    mutable etl::atomic<uint32_t>  readers[2]; ///< Notifications reading each list.
+    etl::atomic<bool>              updating; ///< Set while the observers are being changed.
+  };
+#endif
+
 #if ETL_USING_CPP11 && !defined(ETL_OBSERVER_FORCE_CPP03_IMPLEMENTATION)
 
   //*****************************************************************
@@ -39,6 +39,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "hash.h"
 
 namespace etl
 {
@@ -97,14 +98,185 @@ namespace etl
     }
   };
 
+  //*****************************************************************************
+  /// Declares a value of T that an etl::optional<T> can use to mean 'empty',
+  /// so that it needs no separate flag and is the same size as T.
+  /// Opt in by specialising for the type. The specialisation must define
+  /// 'value' as true and provide 'sentinel()' and 'is_sentinel(const T&)'.
+  /// The type must be trivially copyable and default constructible.
+  /// Storing the sentinel in the optional makes it empty.
+  /// etl::optional_niche_value may be used for integral, enum and pointer types.
+  ///\ingroup utilities
+  //*****************************************************************************
+  template <typename T>
+  struct optional_niche
+  {
+    static ETL_CONSTANT bool value = false;
+  };
+
+  template <typename T>
+  ETL_CONSTANT bool optional_niche<T>::value;
+
+  //*****************************************************************************
+  /// An optional_niche where the sentinel is a compile time constant.
+  /// e.g. template <> struct etl::optional_niche<Id> : etl::optional_niche_value<Id, Id(0xFFFFFFFF)> {};
+  ///\ingroup utilities
+  //*****************************************************************************
+  template <typename T, T Sentinel>
+  struct optional_niche_value
+  {
+    static ETL_CONSTANT bool value = true;
+
+    static ETL_CONSTEXPR T sentinel()
+    {
+      return Sentinel;
+    }
+
+    static ETL_CONSTEXPR bool is_sentinel(const T& v)
+    {
+      return v == Sentinel;
+    }
+  };
+
+  template <typename T, T Sentinel>
+  ETL_CONSTANT bool optional_niche_value<T, Sentinel>::value;
+
   //*****************************************************************************
   // Implementations for fundamental and non fundamental types.
   //*****************************************************************************
   namespace private_optional
   {
-    template <typename T, bool IsDefaultConstructible = etl::is_integral<T>::value>
+    template <typename T, bool IsDefaultConstructible = etl::is_integral<T>::value || etl::optional_niche<T>::value>
     class optional_impl;
 
+    //*****************************************************************************
+    // The storage for fundamental types, with a flag.
+    //*****************************************************************************
+    template <typename T, bool HasNiche = etl::optional_niche<T>::value>
+    struct fundamental_storage
+    {
+      //*******************************
+      ETL_CONSTEXPR14
+      fundamental_storage()
+        : value()
+        , valid(false)
+      {
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14
+      void construct(const T& value_)
+      {
+        value = value_;
+        valid = true;
+      }
+
+#if ETL_USING_CPP11
+      //*******************************
+      ETL_CONSTEXPR14
+      void construct(T&& value_)
+      {
+        value = value_;
+        valid = true;
+      }
+
+      //*******************************
+      template <typename... TArgs>
+      ETL_CONSTEXPR14
+      void construct(TArgs&&... args)
+      {
+        value = T(etl::forward<TArgs>(args)...);
+        valid = true;
+      }
+#endif
+
+      //*******************************
+      ETL_CONSTEXPR14
+      void destroy()
+      {
+        valid = false;
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14
+      void set_valid()
+      {
+        valid = true;
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14
+      bool is_valid() const
+      {
+        return valid;
+      }
+
+      T    value;
+      bool valid;
+    };
+
+    //*****************************************************************************
+    // The storage for fundamental types, where a sentinel value means empty.
+    //*****************************************************************************
+    template <typename T>
+    struct fundamental_storage<T, true>
+    {
+      typedef etl::optional_niche<T> niche;
+
+      //*******************************
+      ETL_CONSTEXPR14
+      fundamental_storage()
+        : value(niche::sentinel())
+      {
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14
+      void construct(const T& value_)
+      {
+        value = value_;
+      }
+
+#if ETL_USING_CPP11
+      //*******************************
+      ETL_CONSTEXPR14
+      void construct(T&& value_)
+      {
+        value = value_;
+      }
+
+      //*******************************
+      template <typename... TArgs>
+      ETL_CONSTEXPR14
+      void construct(TArgs&&... args)
+      {
+        value = T(etl::forward<TArgs>(args)...);
+      }
+#endif
+
+      //*******************************
+      ETL_CONSTEXPR14
+      void destroy()
+      {
+        value = niche::sentinel();
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14
+      void set_valid()
+      {
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14
+      bool is_valid() const
+      {
+        return !niche::is_sentinel(value);
+      }
+
+      T value;
+    };
+
     //*****************************************************************************
     // Implementation for non fundamental types.
     //*****************************************************************************
@@ -924,7 +1096,7 @@ namespace etl
       ETL_CONSTEXPR14
       bool has_value() const ETL_NOEXCEPT
       {
-        return storage.valid;
+        return storage.is_valid();
       }
 
       //***************************************************************************
@@ -1066,7 +1238,7 @@ namespace etl
         }
 
         T* p = ::new (&storage.value) T();
-        storage.valid = true;
+        storage.set_valid();
 
         return *p;
       }
@@ -1085,7 +1257,7 @@ namespace etl
         }
 
         T* p = ::new (&storage.value) T(value1);
-        storage.valid = true;
+        storage.set_valid();
 
         return *p;
       }
@@ -1104,7 +1276,7 @@ namespace etl
         }
 
         T* p = ::new (&storage.value) T(value1, value2);
-        storage.valid = true;
+        storage.set_valid();
 
         return *p;
       }
@@ -1123,7 +1295,7 @@ namespace etl
         }
 
         T* p = ::new (&storage.value) T(value1, value2, value3);
-        storage.valid = true;
+        storage.set_valid();
 
         return *p;
       }
@@ -1142,7 +1314,7 @@ namespace etl
         }
 
         T* p = ::new (&storage.value) T(value1, value2, value3, value4);
-        storage.valid = true;
+        storage.set_valid();
 
         return *p;
       }
@@ -1153,55 +1325,7 @@ namespace etl
       //*************************************
       // The storage for the optional value.
       //*************************************
-      struct storage_type
-      {
-        //*******************************
-        ETL_CONSTEXPR14
-        storage_type()
-          : value()
-          , valid(false)
-        {
-        }
-
-        //*******************************
-        ETL_CONSTEXPR14
-        void construct(const T& value_)
-        {
-          value = value_;
-          valid   = true;
-        }
-
-#if ETL_USING_CPP11
-        //*******************************
-        ETL_CONSTEXPR14
-        void construct(T&& value_)
-        {
-          value = value_;
-          valid = true;
-        }
-
-        //*******************************
-        template <typename... TArgs>
-        ETL_CONSTEXPR14
-        void construct(TArgs&&... args)
-        {
-          value = T(etl::forward<TArgs>(args)...);
-          valid = true;
-        }
-#endif
-
-        //*******************************
-        ETL_CONSTEXPR14
-        void destroy()
-        {
-          valid = false;
-        }
-
-        T    value;
-        bool valid;
-      };
-
-      storage_type storage;
+      fundamental_storage<T> storage;
     };
   }
 
@@ -2158,6 +2282,21 @@ namespace etl
   template <typename T>
   optional(T) -> optional<T>;
 #endif
+
+#if ETL_USING_8BIT_TYPES
+  //***************************************************************************
+  /// Hash function.
+  /// The hash of the value, or zero if there is none.
+  //***************************************************************************
+  template <typename T>
+  struct hash<etl::optional<T> >
+  {
+    size_t operator()(const etl::optional<T>& o) const
+    {
+      return o.has_value() ? etl::hash<T>()(o.value()) : 0U;
+    }
+  };
+#endif
 }
 
 //*************************************************************************
@@ -0,0 +1,902 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_PACKED_VECTOR_INCLUDED
+#define ETL_PACKED_VECTOR_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "span.h"
+#include "smallest.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup packed_vector packed_vector
+/// Arrays and vectors of unsigned integers of 1 to 32 bits, packed end to
+/// end in 32 bit words, least significant bits first.
+/// Elements are read and written through proxy references. Values wider
+/// than the element are truncated.
+/// pack and unpack convert runs of elements to and from uint32_t, walking
+/// the words in order rather than recalculating the position of each.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the packed_vector.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  class packed_vector_exception : public exception
+  {
+  public:
+
+    packed_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The packed_vector is full.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  class packed_vector_full : public packed_vector_exception
+  {
+  public:
+
+    packed_vector_full(string_type file_name_, numeric_type line_number_)
+      : packed_vector_exception(ETL_ERROR_TEXT("packed_vector:full", ETL_PACKED_VECTOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// An index or range is out of bounds.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  class packed_vector_out_of_bounds : public packed_vector_exception
+  {
+  public:
+
+    packed_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : packed_vector_exception(ETL_ERROR_TEXT("packed_vector:bounds", ETL_PACKED_VECTOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_packed_vector
+  {
+    //*************************************************************************
+    /// Reads and writes elements of Bits bits in an array of words.
+    //*************************************************************************
+    template <size_t Bits>
+    struct access
+    {
+      ETL_STATIC_ASSERT((Bits > 0U) && (Bits <= 32U), "Bits must be 1 to 32");
+
+      typedef typename etl::smallest_uint_for_bits<Bits>::type value_type;
+
+      static ETL_CONSTANT uint32_t Mask = static_cast<uint32_t>(0xFFFFFFFFUL >> (32U - Bits));
+
+      //***********************************************************************
+      static value_type get(const uint32_t* p_words, size_t index)
+      {
+        const size_t    bit   = index * Bits;
+        const uint32_t* p     = p_words + (bit / 32U);
+        const uint32_t  shift = static_cast<uint32_t>(bit % 32U);
+
+        uint32_t value = p[0] >> shift;
+
+        // Does it run into the next word?
+        if ((shift + Bits) > 32U)
+        {
+          value |= p[1] << (32U - shift);
+        }
+
+        return static_cast<value_type>(value & Mask);
+      }
+
+      //***********************************************************************
+      static void set(uint32_t* p_words, size_t index, uint32_t value)
+      {
+        const size_t   bit   = index * Bits;
+        uint32_t*      p     = p_words + (bit / 32U);
+        const uint32_t shift = static_cast<uint32_t>(bit % 32U);
+
+        value &= Mask;
+
+        p[0] = (p[0] & ~(Mask << shift)) | (value << shift);
+
+        if ((shift + Bits) > 32U)
+        {
+          const uint32_t low_bits = 32U - shift;
+
+          p[1] = (p[1] & ~(Mask >> low_bits)) | (value >> low_bits);
+        }
+      }
+
+      //***********************************************************************
+      /// Reads count elements from first.
+      //***********************************************************************
+      static void unpack(const uint32_t* p_words, size_t first, uint32_t* p_out, size_t count)
+      {
+        const size_t    bit   = first * Bits;
+        const uint32_t* p     = p_words + (bit / 32U);
+        uint32_t        shift = static_cast<uint32_t>(bit % 32U);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          uint32_t value = *p >> shift;
+
+          shift += Bits;
+
+          if (shift >= 32U)
+          {
+            ++p;
+            shift -= 32U;
+
+            // The high bits of the element are in the next word.
+            if (shift != 0U)
+            {
+              value |= *p << (Bits - shift);
+            }
+          }
+
+          p_out[i] = value & Mask;
+        }
+      }
+
+      //***********************************************************************
+      /// Writes count elements from first.
+      //***********************************************************************
+      static void pack(uint32_t* p_words, size_t first, const uint32_t* p_in, size_t count)
+      {
+        const size_t bit   = first * Bits;
+        uint32_t*    p     = p_words + (bit / 32U);
+        uint32_t     shift = static_cast<uint32_t>(bit % 32U);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          const uint32_t value = p_in[i] & Mask;
+
+          *p = (*p & ~(Mask << shift)) | (value << shift);
+
+          shift += Bits;
+
+          if (shift >= 32U)
+          {
+            ++p;
+            shift -= 32U;
+
+            if (shift != 0U)
+            {
+              const uint32_t low_bits = Bits - shift;
+
+              *p = (*p & ~(Mask >> low_bits)) | (value >> low_bits);
+            }
+          }
+        }
+      }
+    };
+
+    template <size_t Bits>
+    ETL_CONSTANT uint32_t access<Bits>::Mask;
+
+    //*************************************************************************
+    /// A reference to an element.
+    //*************************************************************************
+    template <size_t Bits>
+    class reference
+    {
+    public:
+
+      typedef typename access<Bits>::value_type value_type;
+
+      reference(uint32_t* p_words_, size_t index_)
+        : p_words(p_words_)
+        , index(index_)
+      {
+      }
+
+      operator value_type() const
+      {
+        return access<Bits>::get(p_words, index);
+      }
+
+      reference& operator =(value_type value)
+      {
+        access<Bits>::set(p_words, index, value);
+        return *this;
+      }
+
+      reference& operator =(const reference& other)
+      {
+        access<Bits>::set(p_words, index, value_type(other));
+        return *this;
+      }
+
+      //***********************************************************************
+      /// Swaps the referenced values. The references are proxies, so are
+      /// passed by value.
+      //***********************************************************************
+      friend void swap(reference a, reference b)
+      {
+        const value_type temp = a;
+        a = value_type(b);
+        b = temp;
+      }
+
+    private:
+
+      uint32_t* p_words;
+      size_t    index;
+    };
+
+    //*************************************************************************
+    /// A random access iterator.
+    /// TWord is const uint32_t for a const_iterator, whose elements are read
+    /// by value.
+    //*************************************************************************
+    template <size_t Bits, typename TWord>
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, typename access<Bits>::value_type>
+    {
+    private:
+
+      struct not_convertible;
+
+      // The word type of the iterator that converts to this one, if any.
+      typedef typename etl::conditional<etl::is_const<TWord>::value,
+                                        typename etl::remove_const<TWord>::type,
+                                        not_convertible>::type mutable_word_t;
+
+    public:
+
+      typedef typename access<Bits>::value_type value_type;
+      typedef ptrdiff_t                         difference_type;
+      typedef void                              pointer;
+      typedef typename etl::conditional<etl::is_const<TWord>::value,
+                                        value_type,
+                                        etl::private_packed_vector::reference<Bits> >::type reference;
+
+      iterator()
+        : p_words(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      iterator(TWord* p_words_, size_t index_)
+        : p_words(p_words_)
+        , index(index_)
+      {
+      }
+
+      iterator(const iterator& other)
+        : p_words(other.p_words)
+        , index(other.index)
+      {
+      }
+
+      // Mutable to const conversion.
+      iterator(const iterator<Bits, mutable_word_t>& other)
+        : p_words(other.p_words)
+        , index(other.index)
+      {
+      }
+
+      iterator& operator =(const iterator& other)
+      {
+        p_words = other.p_words;
+        index   = other.index;
+        return *this;
+      }
+
+      reference operator *() const
+      {
+        return make_reference(p_words, index);
+      }
+
+      reference operator [](difference_type n) const
+      {
+        return make_reference(p_words, size_t(difference_type(index) + n));
+      }
+
+      iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++index;
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --index;
+        return temp;
+      }
+
+      iterator& operator +=(difference_type n)
+      {
+        index = size_t(difference_type(index) + n);
+        return *this;
+      }
+
+      iterator& operator -=(difference_type n)
+      {
+        index = size_t(difference_type(index) - n);
+        return *this;
+      }
+
+      friend iterator operator +(iterator itr, difference_type n)
+      {
+        return itr += n;
+      }
+
+      friend iterator operator +(difference_type n, iterator itr)
+      {
+        return itr += n;
+      }
+
+      friend iterator operator -(iterator itr, difference_type n)
+      {
+        return itr -= n;
+      }
+
+      template <typename TOther>
+      difference_type operator -(const iterator<Bits, TOther>& other) const
+      {
+        return difference_type(index) - difference_type(other.index);
+      }
+
+      template <typename TOther>
+      bool operator ==(const iterator<Bits, TOther>& other) const
+      {
+        return index == other.index;
+      }
+
+      template <typename TOther>
+      bool operator !=(const iterator<Bits, TOther>& other) const
+      {
+        return index != other.index;
+      }
+
+      template <typename TOther>
+      bool operator <(const iterator<Bits, TOther>& other) const
+      {
+        return index < other.index;
+      }
+
+      template <typename TOther>
+      bool operator >(const iterator<Bits, TOther>& other) const
+      {
+        return index > other.index;
+      }
+
+      template <typename TOther>
+      bool operator <=(const iterator<Bits, TOther>& other) const
+      {
+        return index <= other.index;
+      }
+
+      template <typename TOther>
+      bool operator >=(const iterator<Bits, TOther>& other) const
+      {
+        return index >= other.index;
+      }
+
+    private:
+
+      template <size_t, typename>
+      friend class iterator;
+
+      static etl::private_packed_vector::reference<Bits> make_reference(uint32_t* p, size_t i)
+      {
+        return etl::private_packed_vector::reference<Bits>(p, i);
+      }
+
+      static value_type make_reference(const uint32_t* p, size_t i)
+      {
+        return access<Bits>::get(p, i);
+      }
+
+      TWord* p_words;
+      size_t index;
+    };
+  }
+
+  //***************************************************************************
+  /// A fixed size array of Size elements of Bits bits.
+  /// The elements are zero on construction.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  template <size_t Bits, size_t Size>
+  class packed_array
+  {
+  private:
+
+    typedef private_packed_vector::access<Bits> access_t;
+
+  public:
+
+    typedef typename access_t::value_type                           value_type;
+    typedef size_t                                                  size_type;
+    typedef private_packed_vector::reference<Bits>                  reference;
+    typedef value_type                                              const_reference;
+    typedef private_packed_vector::iterator<Bits, uint32_t>         iterator;
+    typedef private_packed_vector::iterator<Bits, const uint32_t>   const_iterator;
+
+    static ETL_CONSTANT size_t     BITS      = Bits;
+    static ETL_CONSTANT size_t     SIZE      = Size;
+    static ETL_CONSTANT size_t     WORDS     = ((Size * Bits) + 31U) / 32U;
+    static ETL_CONSTANT value_type MAX_VALUE = static_cast<value_type>(access_t::Mask);
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    packed_array()
+    {
+      for (size_t i = 0U; i < WORDS; ++i)
+      {
+        words[i] = 0U;
+      }
+    }
+
+    //*************************************************************************
+    reference operator [](size_t i)
+    {
+      return reference(words, i);
+    }
+
+    //*************************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return access_t::get(words, i);
+    }
+
+    //*************************************************************************
+    reference at(size_t i)
+    {
+      ETL_ASSERT(i < Size, ETL_ERROR(packed_vector_out_of_bounds));
+      return reference(words, i);
+    }
+
+    //*************************************************************************
+    const_reference at(size_t i) const
+    {
+      ETL_ASSERT(i < Size, ETL_ERROR(packed_vector_out_of_bounds));
+      return access_t::get(words, i);
+    }
+
+    //*************************************************************************
+    value_type get(size_t i) const
+    {
+      return access_t::get(words, i);
+    }
+
+    //*************************************************************************
+    void set(size_t i, uint32_t value)
+    {
+      access_t::set(words, i, value);
+    }
+
+    //*************************************************************************
+    reference       front()       { return reference(words, 0U); }
+    const_reference front() const { return access_t::get(words, 0U); }
+    reference       back()        { return reference(words, Size - 1U); }
+    const_reference back() const  { return access_t::get(words, Size - 1U); }
+
+    //*************************************************************************
+    iterator       begin()        { return iterator(words, 0U); }
+    const_iterator begin() const  { return const_iterator(words, 0U); }
+    const_iterator cbegin() const { return const_iterator(words, 0U); }
+    iterator       end()          { return iterator(words, Size); }
+    const_iterator end() const    { return const_iterator(words, Size); }
+    const_iterator cend() const   { return const_iterator(words, Size); }
+
+    //*************************************************************************
+    /// Sets every element to the value.
+    //*************************************************************************
+    void fill(uint32_t value)
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        access_t::set(words, i, value);
+      }
+    }
+
+    //*************************************************************************
+    /// Copies elements from first to the output, as many as fit.
+    /// Returns the number copied.
+    //*************************************************************************
+    size_t unpack(size_t first, etl::span<uint32_t> output) const
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(first <= Size, ETL_ERROR(packed_vector_out_of_bounds), 0U);
+
+      const size_t count = ((Size - first) < output.size()) ? (Size - first) : output.size();
+
+      access_t::unpack(words, first, output.data(), count);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Writes elements from first, from the input, as many as fit.
+    /// Returns the number written.
+    //*************************************************************************
+    size_t pack(size_t first, etl::span<const uint32_t> input)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(first <= Size, ETL_ERROR(packed_vector_out_of_bounds), 0U);
+
+      const size_t count = ((Size - first) < input.size()) ? (Size - first) : input.size();
+
+      access_t::pack(words, first, input.data(), count);
+
+      return count;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const     { return Size; }
+    ETL_CONSTEXPR size_t max_size() const { return Size; }
+    ETL_CONSTEXPR bool   empty() const    { return Size == 0U; }
+
+    //*************************************************************************
+    /// The packed words.
+    //*************************************************************************
+    uint32_t*       data()       { return words; }
+    const uint32_t* data() const { return words; }
+
+  private:
+
+    uint32_t words[(WORDS == 0U) ? 1U : WORDS];
+  };
+
+  template <size_t Bits, size_t Size>
+  ETL_CONSTANT size_t packed_array<Bits, Size>::BITS;
+
+  template <size_t Bits, size_t Size>
+  ETL_CONSTANT size_t packed_array<Bits, Size>::SIZE;
+
+  template <size_t Bits, size_t Size>
+  ETL_CONSTANT size_t packed_array<Bits, Size>::WORDS;
+
+  template <size_t Bits, size_t Size>
+  ETL_CONSTANT typename packed_array<Bits, Size>::value_type packed_array<Bits, Size>::MAX_VALUE;
+
+  //***************************************************************************
+  /// The interface of a packed_vector of elements of Bits bits.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  template <size_t Bits>
+  class ipacked_vector
+  {
+  private:
+
+    typedef private_packed_vector::access<Bits> access_t;
+
+  public:
+
+    typedef typename access_t::value_type                           value_type;
+    typedef size_t                                                  size_type;
+    typedef private_packed_vector::reference<Bits>                  reference;
+    typedef value_type                                              const_reference;
+    typedef private_packed_vector::iterator<Bits, uint32_t>         iterator;
+    typedef private_packed_vector::iterator<Bits, const uint32_t>   const_iterator;
+
+    static ETL_CONSTANT size_t     BITS      = Bits;
+    static ETL_CONSTANT value_type MAX_VALUE = static_cast<value_type>(access_t::Mask);
+
+    //*************************************************************************
+    reference operator [](size_t i)
+    {
+      return reference(p_words, i);
+    }
+
+    //*************************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return access_t::get(p_words, i);
+    }
+
+    //*************************************************************************
+    reference at(size_t i)
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(packed_vector_out_of_bounds));
+      return reference(p_words, i);
+    }
+
+    //*************************************************************************
+    const_reference at(size_t i) const
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(packed_vector_out_of_bounds));
+      return access_t::get(p_words, i);
+    }
+
+    //*************************************************************************
+    value_type get(size_t i) const
+    {
+      return access_t::get(p_words, i);
+    }
+
+    //*************************************************************************
+    void set(size_t i, uint32_t value)
+    {
+      access_t::set(p_words, i, value);
+    }
+
+    //*************************************************************************
+    reference       front()       { return reference(p_words, 0U); }
+    const_reference front() const { return access_t::get(p_words, 0U); }
+    reference       back()        { return reference(p_words, current_size - 1U); }
+    const_reference back() const  { return access_t::get(p_words, current_size - 1U); }
+
+    //*************************************************************************
+    iterator       begin()        { return iterator(p_words, 0U); }
+    const_iterator begin() const  { return const_iterator(p_words, 0U); }
+    const_iterator cbegin() const { return const_iterator(p_words, 0U); }
+    iterator       end()          { return iterator(p_words, current_size); }
+    const_iterator end() const    { return const_iterator(p_words, current_size); }
+    const_iterator cend() const   { return const_iterator(p_words, current_size); }
+
+    //*************************************************************************
+    /// Adds a value to the end.
+    /// If asserts or exceptions are enabled, emits packed_vector_full if the
+    /// vector is already full.
+    //*************************************************************************
+    void push_back(uint32_t value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT_OR_RETURN(current_size != CAPACITY, ETL_ERROR(packed_vector_full));
+#endif
+      access_t::set(p_words, current_size, value);
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Removes the last value.
+    //*************************************************************************
+    void pop_back()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT_OR_RETURN(current_size != 0U, ETL_ERROR(packed_vector_out_of_bounds));
+#endif
+      --current_size;
+    }
+
+    //*************************************************************************
+    /// Appends the values of the input.
+    /// If they do not all fit, emits packed_vector_full and appends none.
+    //*************************************************************************
+    void append(etl::span<const uint32_t> input)
+    {
+      ETL_ASSERT_OR_RETURN(input.size() <= (CAPACITY - current_size), ETL_ERROR(packed_vector_full));
+
+      access_t::pack(p_words, current_size, input.data(), input.size());
+      current_size += input.size();
+    }
+
+    //*************************************************************************
+    /// Resizes the vector. New elements are set to the value.
+    /// If asserts or exceptions are enabled, emits packed_vector_full if the
+    /// size is greater than the capacity.
+    //*************************************************************************
+    void resize(size_t new_size, uint32_t value = 0U)
+    {
+      ETL_ASSERT_OR_RETURN(new_size <= CAPACITY, ETL_ERROR(packed_vector_full));
+
+      for (size_t i = current_size; i < new_size; ++i)
+      {
+        access_t::set(p_words, i, value);
+      }
+
+      current_size = new_size;
+    }
+
+    //*************************************************************************
+    /// Replaces the contents with n copies of the value.
+    //*************************************************************************
+    void assign(size_t n, uint32_t value)
+    {
+      ETL_ASSERT_OR_RETURN(n <= CAPACITY, ETL_ERROR(packed_vector_full));
+
+      current_size = 0U;
+      resize(n, value);
+    }
+
+    //*************************************************************************
+    /// Sets every element to the value.
+    //*************************************************************************
+    void fill(uint32_t value)
+    {
+      for (size_t i = 0U; i < current_size; ++i)
+      {
+        access_t::set(p_words, i, value);
+      }
+    }
+
+    //*************************************************************************
+    void clear()
+    {
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Copies elements from first to the output, as many as fit.
+    /// Returns the number copied.
+    //*************************************************************************
+    size_t unpack(size_t first, etl::span<uint32_t> output) const
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(first <= current_size, ETL_ERROR(packed_vector_out_of_bounds), 0U);
+
+      const size_t count = ((current_size - first) < output.size()) ? (current_size - first) : output.size();
+
+      access_t::unpack(p_words, first, output.data(), count);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Overwrites elements from first, from the input, as many as fit in the
+    /// current size. Returns the number written.
+    //*************************************************************************
+    size_t pack(size_t first, etl::span<const uint32_t> input)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(first <= current_size, ETL_ERROR(packed_vector_out_of_bounds), 0U);
+
+      const size_t count = ((current_size - first) < input.size()) ? (current_size - first) : input.size();
+
+      access_t::pack(p_words, first, input.data(), count);
+
+      return count;
+    }
+
+    //*************************************************************************
+    size_t size() const      { return current_size; }
+    size_t max_size() const  { return CAPACITY; }
+    size_t capacity() const  { return CAPACITY; }
+    size_t available() const { return CAPACITY - current_size; }
+    bool   empty() const     { return current_size == 0U; }
+    bool   full() const      { return current_size == CAPACITY; }
+
+    //*************************************************************************
+    /// The packed words.
+    //*************************************************************************
+    uint32_t*       data()       { return p_words; }
+    const uint32_t* data() const { return p_words; }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ipacked_vector(uint32_t* p_words_, size_t max_size_)
+      : p_words(p_words_)
+      , current_size(0U)
+      , CAPACITY(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~ipacked_vector()
+    {
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    ipacked_vector(const ipacked_vector&) ETL_DELETE;
+    ipacked_vector& operator =(const ipacked_vector&) ETL_DELETE;
+
+    uint32_t*    p_words;
+    size_t       current_size;
+    const size_t CAPACITY;
+  };
+
+  template <size_t Bits>
+  ETL_CONSTANT size_t ipacked_vector<Bits>::BITS;
+
+  template <size_t Bits>
+  ETL_CONSTANT typename ipacked_vector<Bits>::value_type ipacked_vector<Bits>::MAX_VALUE;
+
+  //***************************************************************************
+  /// A packed_vector with capacity for Max_Size elements of Bits bits.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  template <size_t Bits, size_t Max_Size>
+  class packed_vector : public etl::ipacked_vector<Bits>
+  {
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = Max_Size;
+    static ETL_CONSTANT size_t WORDS    = ((Max_Size * Bits) + 31U) / 32U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    packed_vector()
+      : etl::ipacked_vector<Bits>(words, Max_Size)
+    {
+      clear_words();
+    }
+
+    //*************************************************************************
+    /// Constructor, with n copies of the value.
+    //*************************************************************************
+    packed_vector(size_t n, uint32_t value)
+      : etl::ipacked_vector<Bits>(words, Max_Size)
+    {
+      clear_words();
+      this->assign(n, value);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Elements share words, so the unused bits must be defined before any
+    /// are written.
+    //*************************************************************************
+    void clear_words()
+    {
+      for (size_t i = 0U; i < WORDS; ++i)
+      {
+        words[i] = 0U;
+      }
+    }
+
+    uint32_t words[(WORDS == 0U) ? 1U : WORDS];
+  };
+
+  template <size_t Bits, size_t Max_Size>
+  ETL_CONSTANT size_t packed_vector<Bits, Max_Size>::MAX_SIZE;
+
+  template <size_t Bits, size_t Max_Size>
+  ETL_CONSTANT size_t packed_vector<Bits, Max_Size>::WORDS;
+}
+
+#endif
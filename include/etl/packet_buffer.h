@@ -0,0 +1,686 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PACKET_BUFFER_INCLUDED
+#define ETL_PACKET_BUFFER_INCLUDED
+
+#include "platform.h"
+#include "ipool.h"
+#include "span.h"
+#include "iovec_array.h"
+#include "algorithm.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup packet_buffer packet_buffer
+/// Zero copy packet buffers, in the style of a pbuf chain.
+/// A packet is a list of segments, each a range of bytes in a block from an
+/// etl::ipool, such as an etl::generic_pool. Headers are written into the
+/// headroom in front of the first segment, or into a new block, so the
+/// payload is never moved. Blocks are reference counted, so packets can share
+/// segments, such as a payload held for retransmission.
+/// Exported for transmission as an etl::iovec_array.
+/// Not thread safe.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the packet_buffer.
+  ///\ingroup packet_buffer
+  //***************************************************************************
+  class packet_buffer_exception : public exception
+  {
+  public:
+
+    packet_buffer_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// There are no free segments in the packet.
+  ///\ingroup packet_buffer
+  //***************************************************************************
+  class packet_buffer_full : public packet_buffer_exception
+  {
+  public:
+
+    packet_buffer_full(string_type file_name_, numeric_type line_number_)
+      : packet_buffer_exception(ETL_ERROR_TEXT("packet_buffer:full", ETL_PACKET_BUFFER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The request is larger than a block.
+  ///\ingroup packet_buffer
+  //***************************************************************************
+  class packet_buffer_too_large : public packet_buffer_exception
+  {
+  public:
+
+    packet_buffer_too_large(string_type file_name_, numeric_type line_number_)
+      : packet_buffer_exception(ETL_ERROR_TEXT("packet_buffer:too large", ETL_PACKET_BUFFER_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The interface for packet buffers.
+  ///\ingroup packet_buffer
+  //***************************************************************************
+  class ipacket_buffer
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Releases the segments.
+    //*************************************************************************
+    void clear()
+    {
+      while (segment_count != 0U)
+      {
+        release(at(0U).p_block);
+        head = next(head);
+        --segment_count;
+      }
+
+      head         = 0U;
+      total_length = 0U;
+    }
+
+    //*************************************************************************
+    /// Starts a new packet with a block of its own, leaving 'headroom' bytes
+    /// in front for the headers of the layers below.
+    /// Returns <b>false</b> if a block could not be allocated.
+    //*************************************************************************
+    bool reserve_headroom(size_t headroom)
+    {
+      clear();
+
+      ETL_ASSERT_OR_RETURN_VALUE(headroom <= block_capacity(), ETL_ERROR(packet_buffer_too_large), false);
+
+      block_header* p_block = allocate();
+
+      if (p_block == ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      insert_back(p_block, headroom);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Makes room for n bytes in front of the packet, and returns them to be
+    /// written. Uses the headroom of the first segment if its block is not
+    /// shared, otherwise adds a segment, filled from the end of a new block.
+    /// Returns an empty span if there is no room.
+    //*************************************************************************
+    etl::span<uint8_t> prepend(size_t n)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(n <= block_capacity(), ETL_ERROR(packet_buffer_too_large), etl::span<uint8_t>());
+
+      if ((segment_count == 0U) || !is_exclusive(at(0U)) || (at(0U).begin < n))
+      {
+        ETL_ASSERT_OR_RETURN_VALUE(segment_count < max_segments, ETL_ERROR(packet_buffer_full), etl::span<uint8_t>());
+
+        block_header* p_block = allocate();
+
+        if (p_block == ETL_NULLPTR)
+        {
+          return etl::span<uint8_t>();
+        }
+
+        insert_front(p_block, block_capacity());
+      }
+
+      segment& s = at(0U);
+
+      s.begin      -= n;
+      total_length += n;
+
+      return etl::span<uint8_t>(data_of(s.p_block) + s.begin, n);
+    }
+
+    //*************************************************************************
+    /// Makes room for n bytes at the back of the packet, and returns them to be
+    /// written. Uses the tailroom of the last segment if its block is not
+    /// shared, otherwise adds a segment in a new block.
+    /// Returns an empty span if there is no room.
+    //*************************************************************************
+    etl::span<uint8_t> append(size_t n)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(n <= block_capacity(), ETL_ERROR(packet_buffer_too_large), etl::span<uint8_t>());
+
+      if ((segment_count == 0U) || !is_exclusive(back()) || (tailroom() < n))
+      {
+        ETL_ASSERT_OR_RETURN_VALUE(segment_count < max_segments, ETL_ERROR(packet_buffer_full), etl::span<uint8_t>());
+
+        block_header* p_block = allocate();
+
+        if (p_block == ETL_NULLPTR)
+        {
+          return etl::span<uint8_t>();
+        }
+
+        insert_back(p_block, 0U);
+      }
+
+      segment& s = back();
+
+      const size_t start = s.end;
+
+      s.end        += n;
+      total_length += n;
+
+      return etl::span<uint8_t>(data_of(s.p_block) + start, n);
+    }
+
+    //*************************************************************************
+    /// Copies bytes to the back of the packet, across as many blocks as needed.
+    /// Returns <b>false</b> if they did not all fit, leaving those that did.
+    //*************************************************************************
+    bool append(etl::span<const uint8_t> bytes)
+    {
+      while (!bytes.empty())
+      {
+        size_t n = ((segment_count != 0U) && is_exclusive(back())) ? tailroom() : 0U;
+
+        if (n == 0U)
+        {
+          n = block_capacity();
+        }
+
+        n = etl::min(n, bytes.size());
+
+        etl::span<uint8_t> space = append(n);
+
+        if (space.empty())
+        {
+          return false;
+        }
+
+        memcpy(space.data(), bytes.data(), n);
+        bytes = bytes.subspan(n);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Adds the segments of another packet to the back of this one, without
+    /// copying. The blocks become shared and are not written by either packet.
+    /// Returns <b>false</b> if there are not enough free segments.
+    //*************************************************************************
+    bool append(const ipacket_buffer& other)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE((segment_count + other.segment_count) <= max_segments, ETL_ERROR(packet_buffer_full), false);
+
+      // Copied first, in case the other is this.
+      const size_t count = other.segment_count;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        const segment& s = other.at(i);
+
+        ++s.p_block->references;
+
+        segment& d = at(segment_count);
+
+        d = s;
+        ++segment_count;
+        total_length += (s.end - s.begin);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Removes n bytes from the front, such as a header that has been read.
+    //*************************************************************************
+    void trim_front(size_t n)
+    {
+      n = etl::min(n, total_length);
+      total_length -= n;
+
+      while (n != 0U)
+      {
+        segment& s = at(0U);
+
+        const size_t length = s.end - s.begin;
+
+        if (n < length)
+        {
+          s.begin += n;
+          n = 0U;
+        }
+        else
+        {
+          n -= length;
+
+          // Keep an exclusive block, for its headroom.
+          if ((segment_count == 1U) && is_exclusive(s))
+          {
+            s.begin = s.end;
+          }
+          else
+          {
+            release(s.p_block);
+            head = next(head);
+            --segment_count;
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Removes n bytes from the back, such as a trailer that has been read.
+    //*************************************************************************
+    void trim_back(size_t n)
+    {
+      n = etl::min(n, total_length);
+      total_length -= n;
+
+      while (n != 0U)
+      {
+        segment& s = back();
+
+        const size_t length = s.end - s.begin;
+
+        if (n < length)
+        {
+          s.end -= n;
+          n = 0U;
+        }
+        else
+        {
+          n -= length;
+          release(s.p_block);
+          --segment_count;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Adds each non-empty segment to an iovec_array, for transmission.
+    /// The iovec_array is valid while the packet is unchanged.
+    //*************************************************************************
+    template <size_t Max_Segments, typename T>
+    void gather(etl::iovec_array<Max_Segments, T>& iov) const
+    {
+      for (size_t i = 0U; i < segment_count; ++i)
+      {
+        const segment& s = at(i);
+
+        iov.push_back(reinterpret_cast<T*>(data_of(s.p_block) + s.begin), s.end - s.begin);
+      }
+    }
+
+    //*************************************************************************
+    /// Copies the bytes of the packet, from 'offset', to the destination.
+    /// Returns the number of bytes copied.
+    //*************************************************************************
+    size_t copy_to(etl::span<uint8_t> destination, size_t offset = 0U) const
+    {
+      size_t copied = 0U;
+
+      for (size_t i = 0U; (i < segment_count) && (copied < destination.size()); ++i)
+      {
+        const segment& s = at(i);
+
+        const size_t length = s.end - s.begin;
+
+        if (offset >= length)
+        {
+          offset -= length;
+        }
+        else
+        {
+          const size_t n = etl::min(length - offset, destination.size() - copied);
+
+          memcpy(destination.data() + copied, data_of(s.p_block) + s.begin + offset, n);
+          copied += n;
+          offset  = 0U;
+        }
+      }
+
+      return copied;
+    }
+
+    //*************************************************************************
+    /// Gets a segment.
+    //*************************************************************************
+    etl::span<const uint8_t> segment_data(size_t index) const
+    {
+      const segment& s = at(index);
+
+      return etl::span<const uint8_t>(data_of(s.p_block) + s.begin, s.end - s.begin);
+    }
+
+    //*************************************************************************
+    /// Gets the number of bytes in the packet.
+    //*************************************************************************
+    size_t size() const
+    {
+      return total_length;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the packet has no bytes.
+    //*************************************************************************
+    bool empty() const
+    {
+      return total_length == 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the number of segments.
+    //*************************************************************************
+    size_t segment_count_used() const
+    {
+      return segment_count;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of segments.
+    //*************************************************************************
+    size_t max_segment_count() const
+    {
+      return max_segments;
+    }
+
+    //*************************************************************************
+    /// Gets the headroom in front of the first segment, or zero if its block is shared.
+    //*************************************************************************
+    size_t headroom() const
+    {
+      return ((segment_count != 0U) && is_exclusive(at(0U))) ? at(0U).begin : 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the tailroom after the last segment, or zero if its block is shared.
+    //*************************************************************************
+    size_t tailroom() const
+    {
+      return ((segment_count != 0U) && is_exclusive(back())) ? block_capacity() - back().end : 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the number of bytes in each block.
+    //*************************************************************************
+    size_t block_capacity() const
+    {
+      return pool.item_size() - sizeof(block_header);
+    }
+
+    //*************************************************************************
+    /// Gets the pool.
+    //*************************************************************************
+    etl::ipool& get_pool() const
+    {
+      return pool;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The header at the start of each block. The bytes follow it.
+    //*************************************************************************
+    struct block_header
+    {
+      etl::ipool* p_pool;
+      size_t      references;
+    };
+
+    //*************************************************************************
+    /// A range of bytes in a block.
+    //*************************************************************************
+    struct segment
+    {
+      block_header* p_block;
+      size_t        begin;
+      size_t        end;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ipacket_buffer(etl::ipool& pool_, segment* p_segments_, size_t max_segments_)
+      : pool(pool_)
+      , p_segments(p_segments_)
+      , max_segments(max_segments_)
+      , head(0U)
+      , segment_count(0U)
+      , total_length(0U)
+    {
+      ETL_ASSERT(pool.item_size() > sizeof(block_header), ETL_ERROR(packet_buffer_too_large));
+    }
+
+    //*************************************************************************
+    /// Shares the segments of another packet.
+    //*************************************************************************
+    void assign(const ipacket_buffer& other)
+    {
+      if (&other != this)
+      {
+        clear();
+        append(other);
+      }
+    }
+
+#if defined(ETL_POLYMORPHIC_PACKET_BUFFER) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ipacket_buffer()
+    {
+    }
+#else
+    ~ipacket_buffer()
+    {
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    segment& at(size_t index)
+    {
+      return p_segments[(head + index) % max_segments];
+    }
+
+    //*************************************************************************
+    const segment& at(size_t index) const
+    {
+      return p_segments[(head + index) % max_segments];
+    }
+
+    //*************************************************************************
+    segment& back()
+    {
+      return at(segment_count - 1U);
+    }
+
+    //*************************************************************************
+    const segment& back() const
+    {
+      return at(segment_count - 1U);
+    }
+
+    //*************************************************************************
+    size_t next(size_t index) const
+    {
+      return (index + 1U) % max_segments;
+    }
+
+    //*************************************************************************
+    static bool is_exclusive(const segment& s)
+    {
+      return s.p_block->references == 1U;
+    }
+
+    //*************************************************************************
+    static uint8_t* data_of(block_header* p_block)
+    {
+      return reinterpret_cast<uint8_t*>(p_block + 1);
+    }
+
+    //*************************************************************************
+    block_header* allocate()
+    {
+      block_header* p_block = pool.allocate<block_header>();
+
+      if (p_block != ETL_NULLPTR)
+      {
+        p_block->p_pool     = &pool;
+        p_block->references = 1U;
+      }
+
+      return p_block;
+    }
+
+    //*************************************************************************
+    static void release(block_header* p_block)
+    {
+      if (--p_block->references == 0U)
+      {
+        p_block->p_pool->release(p_block);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds an empty segment at 'offset' in a new block, at the front.
+    //*************************************************************************
+    void insert_front(block_header* p_block, size_t offset)
+    {
+      head = (head + max_segments - 1U) % max_segments;
+      ++segment_count;
+
+      segment& s = at(0U);
+
+      s.p_block = p_block;
+      s.begin   = offset;
+      s.end     = offset;
+    }
+
+    //*************************************************************************
+    /// Adds an empty segment at 'offset' in a new block, at the back.
+    //*************************************************************************
+    void insert_back(block_header* p_block, size_t offset)
+    {
+      ++segment_count;
+
+      segment& s = back();
+
+      s.p_block = p_block;
+      s.begin   = offset;
+      s.end     = offset;
+    }
+
+    // Disable copy construction.
+    ipacket_buffer(const ipacket_buffer&);
+
+    etl::ipool&    pool;         ///< The pool for new blocks.
+    segment* const p_segments;   ///< The segments, as a ring.
+    const size_t   max_segments;
+    size_t         head;         ///< The index of the first segment.
+    size_t         segment_count;
+    size_t         total_length;
+  };
+
+  //***************************************************************************
+  /// A packet buffer of up to Max_Segments segments.
+  /// Copies share the segments of the original.
+  ///\ingroup packet_buffer
+  //***************************************************************************
+  template <size_t Max_Segments>
+  class packet_buffer : public etl::ipacket_buffer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Segments > 0U, "At least one segment is needed");
+
+    static ETL_CONSTANT size_t MAX_SEGMENTS = Max_Segments;
+
+    //*************************************************************************
+    /// Constructor. New blocks are allocated from the pool.
+    //*************************************************************************
+    explicit packet_buffer(etl::ipool& pool_)
+      : ipacket_buffer(pool_, segments, Max_Segments)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Shares the segments.
+    //*************************************************************************
+    packet_buffer(const packet_buffer& other)
+      : ipacket_buffer(other.get_pool(), segments, Max_Segments)
+    {
+      this->assign(other);
+    }
+
+    //*************************************************************************
+    /// Copy assignment. Shares the segments.
+    //*************************************************************************
+    packet_buffer& operator =(const packet_buffer& other)
+    {
+      this->assign(other);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor. Releases the segments.
+    //*************************************************************************
+    ~packet_buffer()
+    {
+      this->clear();
+    }
+
+  private:
+
+    segment segments[Max_Segments];
+  };
+
+  template <size_t Max_Segments>
+  ETL_CONSTANT size_t packet_buffer<Max_Segments>::MAX_SEGMENTS;
+}
+
+#endif
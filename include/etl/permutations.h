@@ -32,9 +32,15 @@ SOFTWARE.
 #define ETL_PERMUTATIONS_INCLUDED
 
 #include "platform.h"
+#include "iterator.h"
+#include "utility.h"
+#include "static_assert.h"
+
+#include <stddef.h>
 
 ///\defgroup permutations permutations
 /// permutations<N, K> : Calculates K permutations from N.
+/// heap_permutation<N> and permutation_view<N, TIterator> : Lazily step through every ordering of N elements.
 ///\ingroup maths
 
 namespace etl
@@ -69,6 +75,213 @@ namespace etl
   template <size_t NV, size_t KV>
   inline constexpr size_t permutations_v = permutations<NV, KV>::value;
 #endif
+
+  //***************************************************************************
+  ///\ingroup permutations
+  /// Steps through all N! orderings of N elements by Heap's algorithm.
+  /// Each step exchanges exactly one pair of elements, at constant amortised cost.
+  //***************************************************************************
+  template <size_t NV>
+  class heap_permutation
+  {
+  public:
+
+    ETL_STATIC_ASSERT(NV > 0U, "heap_permutation requires at least one element");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    heap_permutation()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Restarts the sequence from the current ordering.
+    //*************************************************************************
+    void reset()
+    {
+      index = 1U;
+
+      for (size_t i = 0U; i < NV; ++i)
+      {
+        counters[i] = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the pair of positions to exchange for the next permutation.
+    /// Returns <b>false</b> once all N! permutations have been produced.
+    //*************************************************************************
+    bool next_swap(size_t& a, size_t& b)
+    {
+      while (index < NV)
+      {
+        if (counters[index] < index)
+        {
+          a = ((index & 1U) == 0U) ? 0U : counters[index];
+          b = index;
+
+          ++counters[index];
+          index = 1U;
+
+          return true;
+        }
+
+        counters[index] = 0U;
+        ++index;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Moves the N elements starting at 'first' to the next permutation.
+    /// Returns <b>false</b>, leaving the elements unchanged, once all N!
+    /// permutations have been produced.
+    //*************************************************************************
+    template <typename TIterator>
+    bool next(TIterator first)
+    {
+      size_t a;
+      size_t b;
+
+      if (next_swap(a, b))
+      {
+        using ETL_OR_STD::swap; // Allow ADL
+
+        TIterator ia = first;
+        TIterator ib = first;
+        etl::advance(ia, a);
+        etl::advance(ib, b);
+
+        swap(*ia, *ib);
+
+        return true;
+      }
+
+      return false;
+    }
+
+  private:
+
+    size_t index;
+    size_t counters[NV];
+  };
+
+  //***************************************************************************
+  ///\ingroup permutations
+  /// A lazy view of every ordering of the N elements starting at 'first'.
+  /// The elements are permuted in place; dereferencing an iterator gives the
+  /// start of the range in its current order. The first ordering visited is
+  /// the one the range holds when begin() is called.
+  //***************************************************************************
+  template <size_t NV, typename TIterator>
+  class permutation_view
+  {
+  public:
+
+    //*************************************************************************
+    /// Iterator. Single pass; incrementing permutes the viewed range.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::input_iterator_tag, TIterator>
+    {
+    public:
+
+      iterator()
+        : first()
+        , generator()
+        , done(true)
+      {
+      }
+
+      iterator(TIterator first_, bool done_)
+        : first(first_)
+        , generator()
+        , done(done_)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        done = !generator.next(first);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const TIterator& operator *() const
+      {
+        return first;
+      }
+
+      const TIterator* operator ->() const
+      {
+        return &first;
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.done == rhs.done;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      TIterator                 first;
+      etl::heap_permutation<NV> generator;
+      bool                      done;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit permutation_view(TIterator first_)
+      : first(first_)
+    {
+    }
+
+    iterator begin() const
+    {
+      return iterator(first, false);
+    }
+
+    iterator end() const
+    {
+      return iterator(first, true);
+    }
+
+    //*************************************************************************
+    /// The number of orderings visited.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t size()
+    {
+      return etl::permutations<NV, NV>::value;
+    }
+
+  private:
+
+    TIterator first;
+  };
+
+  //***************************************************************************
+  ///\ingroup permutations
+  /// Makes a permutation_view of the N elements starting at 'first'.
+  //***************************************************************************
+  template <size_t NV, typename TIterator>
+  permutation_view<NV, TIterator> make_permutation_view(TIterator first)
+  {
+    return permutation_view<NV, TIterator>(first);
+  }
 }
 
 #endif
@@ -0,0 +1,218 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PIPELINE_INCLUDED
+#define ETL_PIPELINE_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "span.h"
+
+#include <stddef.h>
+
+///\defgroup pipeline pipeline
+/// Composes unary functors, such as etl::rescale, etl::limiter,
+/// etl::threshold, etl::quantize and etl::invert, lambdas, or function
+/// pointers, such as &etl::round_half_even_unscaled<10, int>, into one
+/// functor, and applies it to a block of samples in a single loop.
+/// The stages are held by value and called directly, so the compiler can
+/// inline them into the loop, and no intermediate arrays are needed.
+/// Requires C++11.
+///\ingroup utilities
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  namespace private_pipeline
+  {
+    //*************************************************************************
+    /// Holds the stages, and applies them in order.
+    //*************************************************************************
+    template <typename... TStages>
+    class stages;
+
+    //*************************************************************************
+    /// No more stages.
+    //*************************************************************************
+    template <>
+    class stages<>
+    {
+    public:
+
+      ETL_CONSTEXPR stages()
+      {
+      }
+
+      template <typename T>
+      ETL_CONSTEXPR T apply(T value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// The first stage, followed by the rest.
+    //*************************************************************************
+    template <typename TFirst, typename... TRest>
+    class stages<TFirst, TRest...>
+    {
+    public:
+
+      ETL_CONSTEXPR stages()
+        : first()
+        , rest()
+      {
+      }
+
+      ETL_CONSTEXPR explicit stages(const TFirst& first_, const TRest&... rest_)
+        : first(first_)
+        , rest(rest_...)
+      {
+      }
+
+      template <typename T>
+      ETL_CONSTEXPR auto apply(T value) const
+        -> decltype(etl::declval<const stages<TRest...>&>().apply(etl::declval<const TFirst&>()(value)))
+      {
+        return rest.apply(first(value));
+      }
+
+    private:
+
+      TFirst             first;
+      stages<TRest...>   rest;
+    };
+  }
+
+  //***************************************************************************
+  /// A composition of unary functors.
+  /// pipeline<A, B, C>(a, b, c)(x) is c(b(a(x))).
+  ///\ingroup pipeline
+  //***************************************************************************
+  template <typename... TStages>
+  class pipeline
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TStages) > 0U, "A pipeline must have at least one stage");
+
+    //*************************************************************************
+    /// The type of the result of the pipeline, for an input type.
+    //*************************************************************************
+    template <typename TInput>
+    struct result
+    {
+      typedef decltype(etl::declval<const private_pipeline::stages<TStages...>&>().apply(etl::declval<TInput>())) type;
+    };
+
+    //*************************************************************************
+    /// Default constructor. Default constructs every stage.
+    //*************************************************************************
+    ETL_CONSTEXPR pipeline()
+      : chain()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from the stages.
+    //*************************************************************************
+    ETL_CONSTEXPR explicit pipeline(const TStages&... stages_)
+      : chain(stages_...)
+    {
+    }
+
+    //*************************************************************************
+    /// Applies every stage to one value.
+    //*************************************************************************
+    template <typename TInput>
+    ETL_CONSTEXPR typename result<TInput>::type operator ()(TInput value) const
+    {
+      return chain.apply(value);
+    }
+
+    //*************************************************************************
+    /// Applies every stage to each value of input, writing to output.
+    /// Processes the number of values in the smaller of the spans.
+    /// output may be the same as input.
+    ///\return The number of values processed.
+    //*************************************************************************
+    template <typename TInput, size_t Input_Extent, typename TOutput, size_t Output_Extent>
+    ETL_CONSTEXPR14 size_t process(etl::span<TInput, Input_Extent> input, etl::span<TOutput, Output_Extent> output) const
+    {
+      const size_t n = (input.size() < output.size()) ? input.size() : output.size();
+
+      const TInput* p_input  = input.data();
+      TOutput*      p_output = output.data();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_output[i] = static_cast<TOutput>(chain.apply(p_input[i]));
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Applies every stage to each value in the range, writing to output.
+    ///\return An iterator to the end of the output.
+    //*************************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    ETL_CONSTEXPR14 TOutputIterator process(TInputIterator first, TInputIterator last, TOutputIterator output) const
+    {
+      while (first != last)
+      {
+        *output = chain.apply(*first);
+        ++output;
+        ++first;
+      }
+
+      return output;
+    }
+
+  private:
+
+    private_pipeline::stages<TStages...> chain;
+  };
+
+  //***************************************************************************
+  /// Makes a pipeline, deducing the stage types.
+  ///\ingroup pipeline
+  //***************************************************************************
+  template <typename... TStages>
+  ETL_CONSTEXPR etl::pipeline<typename etl::decay<TStages>::type...> make_pipeline(TStages&&... stages)
+  {
+    return etl::pipeline<typename etl::decay<TStages>::type...>(etl::forward<TStages>(stages)...);
+  }
+}
+
+#endif
+#endif
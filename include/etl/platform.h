@@ -210,6 +210,30 @@ SOFTWARE.
 #define ETL_HAS_ICIRCULAR_BUFFER_REPAIR 0
 #endif
 
+//*************************************
+// Option to enable allocation statistics for ipool and imemory_block_allocator.
+#if defined(ETL_ALLOCATION_STATISTICS_ENABLE)
+  #define ETL_HAS_ALLOCATION_STATISTICS 1
+#else
+  #define ETL_HAS_ALLOCATION_STATISTICS 0
+#endif
+
+//*************************************
+// Option to enable operation statistics for the instrumented containers.
+#if defined(ETL_CONTAINER_STATISTICS_ENABLE)
+  #define ETL_HAS_CONTAINER_STATISTICS 1
+#else
+  #define ETL_HAS_CONTAINER_STATISTICS 0
+#endif
+
+//*************************************
+// Option to enable the trace probes.
+#if defined(ETL_TRACE_ENABLE)
+  #define ETL_HAS_TRACE 1
+#else
+  #define ETL_HAS_TRACE 0
+#endif
+
 //*************************************
 // Indicate if C++ exceptions are enabled.
 #if defined(ETL_THROW_EXCEPTIONS)
@@ -355,6 +379,22 @@ SOFTWARE.
   #define ETL_ASSUME ETL_DO_NOTHING
 #endif
 
+//*************************************
+// Branch prediction hints, and placement of rarely run code away from hot paths.
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_ARM6) || defined(ETL_COMPILER_ARM7) || defined(ETL_COMPILER_ARM8)
+  #define ETL_EXPECT_TRUE(expression)  (__builtin_expect(!!(expression), 1))
+  #define ETL_EXPECT_FALSE(expression) (__builtin_expect(!!(expression), 0))
+  #define ETL_COLD                     __attribute__((cold, noinline))
+#elif defined(ETL_COMPILER_MICROSOFT)
+  #define ETL_EXPECT_TRUE(expression)  (expression)
+  #define ETL_EXPECT_FALSE(expression) (expression)
+  #define ETL_COLD                     __declspec(noinline)
+#else
+  #define ETL_EXPECT_TRUE(expression)  (expression)
+  #define ETL_EXPECT_FALSE(expression) (expression)
+  #define ETL_COLD
+#endif
+
 //*************************************
 // Determine if the ETL can use char8_t type.
 #if ETL_NO_SMALL_CHAR_SUPPORT
@@ -407,6 +447,19 @@ SOFTWARE.
   #endif
 #endif
 
+//*************************************
+// Determine the size of a cache line.
+// Define ETL_CACHE_LINE_SIZE in the profile to override the default.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #if defined(__APPLE__) && defined(__aarch64__)
+    #define ETL_CACHE_LINE_SIZE 128
+  #elif defined(ETL_TARGET_DEVICE_ARM) || (defined(__arm__) && !defined(__aarch64__))
+    #define ETL_CACHE_LINE_SIZE 32
+  #else
+    #define ETL_CACHE_LINE_SIZE 64
+  #endif
+#endif
+
 //*************************************
 // Determine if the ETL should use std::initializer_list.
 #if (defined(ETL_FORCE_ETL_INITIALIZER_LIST) && defined(ETL_FORCE_STD_INITIALIZER_LIST))
@@ -489,6 +542,12 @@ namespace etl
     static ETL_CONSTANT bool has_mutable_array_view           = (ETL_HAS_MUTABLE_ARRAY_VIEW == 1);
     static ETL_CONSTANT bool has_ideque_repair                = (ETL_HAS_IDEQUE_REPAIR == 1);
     static ETL_CONSTANT bool has_virtual_messages             = (ETL_HAS_VIRTUAL_MESSAGES == 1);
+    static ETL_CONSTANT bool has_allocation_statistics        = (ETL_HAS_ALLOCATION_STATISTICS == 1);
+    static ETL_CONSTANT bool has_container_statistics         = (ETL_HAS_CONTAINER_STATISTICS == 1);
+    static ETL_CONSTANT bool has_trace                        = (ETL_HAS_TRACE == 1);
+
+    // Sizes...
+    static ETL_CONSTANT size_t cache_line_size                = ETL_CACHE_LINE_SIZE;
 
     // Is...
     static ETL_CONSTANT bool is_debug_build                   = (ETL_IS_DEBUG_BUILD == 1);
@@ -0,0 +1,699 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_ATOMIC_INCLUDED
+#define ETL_POOL_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "ipool.h"
+#include "atomic.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "private/lock_free_free_list.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup pool_atomic pool_atomic
+/// A fixed capacity pool that may be shared between interrupts and threads
+/// without locking.
+///\ingroup pool
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for lock free pools.
+  /// The free items are held in a lock free stack (a Treiber stack), with a
+  /// tag that guards against the ABA problem.
+  /// The API matches etl::ipool, except that there is no release_all(), as
+  /// that cannot be made safe while other threads are using the pool.
+  ///\ingroup pool_atomic
+  //***************************************************************************
+  class ipool_atomic
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool, if it has a free item.
+    /// Returns a null pointer, without an error, if there are no free items.
+    /// Unlike checking full() first, this cannot be beaten to the last item.
+    //*************************************************************************
+    template <typename T>
+    T* try_allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(try_allocate_item());
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const char* p = static_cast<const char*>(p_object);
+
+      ETL_ASSERT_OR_RETURN(is_in_pool(p), ETL_ERROR(etl::pool_object_not_in_pool));
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(etl::pool_no_allocation));
+
+      free_items.push(static_cast<uint16_t>(static_cast<size_t>(p - p_buffer) / Item_Size));
+      items_allocated.fetch_sub(1U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* const p_object) const
+    {
+      const char* p = static_cast<const char*>(p_object);
+
+      // Within the range of the buffer?
+      intptr_t distance = p - p_buffer;
+      bool is_within_range = (distance >= 0) && (distance <= intptr_t((Item_Size * Max_Size) - Item_Size));
+
+      // Is the address on a valid object boundary?
+      bool is_valid_address = ((distance % Item_Size) == 0);
+
+      return is_within_range && is_valid_address;
+    }
+
+    //*************************************************************************
+    /// Returns the size of each item in the pool.
+    //*************************************************************************
+    size_t item_size() const
+    {
+      return Item_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == Max_Size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    /// \param p_buffer_  The storage for the items.
+    /// \param p_next_    The links of the free list. One per item.
+    /// \param item_size_ The size of each item.
+    /// \param max_size_  The number of items.
+    //*************************************************************************
+    ipool_atomic(char* p_buffer_, etl::atomic<uint16_t>* p_next_, uint32_t item_size_, uint32_t max_size_)
+      : p_buffer(p_buffer_)
+      , free_items(p_next_, max_size_)
+      , items_allocated(0U)
+      , Item_Size(item_size_)
+      , Max_Size(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Makes all of the items free.
+    /// Called by the derived class once the free list links are constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      free_items.initialise();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocate an item from the pool.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      char* p = try_allocate_item();
+
+      if (p == ETL_NULLPTR)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::pool_no_allocation));
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate an item from the pool, or return null if there are none free.
+    //*************************************************************************
+    char* try_allocate_item()
+    {
+      const uint16_t index = free_items.pop();
+
+      if (index == etl::private_lock_free::free_list::Nil)
+      {
+        return ETL_NULLPTR;
+      }
+
+      items_allocated.fetch_add(1U, etl::memory_order_relaxed);
+
+      return p_buffer + (index * Item_Size);
+    }
+
+    // Disable copy construction and assignment.
+    ipool_atomic(const ipool_atomic&) ETL_DELETE;
+    ipool_atomic& operator =(const ipool_atomic&) ETL_DELETE;
+
+    char* const                       p_buffer;
+    etl::private_lock_free::free_list free_items;      ///< The free list.
+    etl::atomic<uint32_t>             items_allocated; ///< The number of items allocated.
+
+    const uint32_t Item_Size; ///< The size of allocated items.
+    const uint32_t Max_Size;  ///< The maximum number of objects that can be allocated.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ipool_atomic()
+    {
+    }
+#else
+  protected:
+    ~ipool_atomic()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated abstract lock free pool implementation that uses a fixed size pool.
+  ///\ingroup pool_atomic
+  //*************************************************************************
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  class generic_pool_atomic : public etl::ipool_atomic
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSize > 0U, "Size must be greater than zero");
+    ETL_STATIC_ASSERT(VSize <= etl::private_lock_free::free_list::Max_Items, "Size must be less than 65535");
+
+    static ETL_CONSTANT size_t SIZE      = VSize;
+    static ETL_CONSTANT size_t ALIGNMENT = VAlignment;
+    static ETL_CONSTANT size_t TYPE_SIZE = VTypeSize;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    generic_pool_atomic()
+      : etl::ipool_atomic(reinterpret_cast<char*>(&buffer[0]), next_free, Element_Size, VSize)
+    {
+      ipool_atomic::initialise();
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::allocate<U>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      p_object->~U();
+      ipool_atomic::release(p_object);
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      char     value[VTypeSize]; ///< Storage for value type.
+      typename etl::type_with_alignment<VAlignment>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[VSize];
+
+    ///< The links of the free list.
+    etl::atomic<uint16_t> next_free[VSize];
+
+    static ETL_CONSTANT uint32_t Element_Size = sizeof(Element);
+
+    // Should not be copied.
+    generic_pool_atomic(const generic_pool_atomic&) ETL_DELETE;
+    generic_pool_atomic& operator =(const generic_pool_atomic&) ETL_DELETE;
+  };
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::SIZE;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::ALIGNMENT;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::TYPE_SIZE;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT uint32_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::Element_Size;
+
+  //*************************************************************************
+  /// A templated lock free pool implementation that uses a fixed size pool.
+  ///\ingroup pool_atomic
+  //*************************************************************************
+  template <typename T, const size_t VSize>
+  class pool_atomic : public etl::generic_pool_atomic<sizeof(T), etl::alignment_of<T>::value, VSize>
+  {
+  private:
+
+    typedef etl::generic_pool_atomic<sizeof(T), etl::alignment_of<T>::value, VSize> base_t;
+
+  public:
+
+    using base_t::SIZE;
+    using base_t::ALIGNMENT;
+    using base_t::TYPE_SIZE;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    pool_atomic()
+    {
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// Uses the default constructor.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    T* allocate()
+    {
+      return base_t::template allocate<T>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    T* create()
+    {
+      return base_t::template create<T>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1>
+    T* create(const T1& value1)
+    {
+      return base_t::template create<T>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      return base_t::template create<T>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return base_t::template create<T>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return base_t::template create<T>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with variadic parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+      return base_t::template create<T>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Releases the object.
+    /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void release(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_same<U, T>::value || etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::release(p_object);
+    }
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::destroy(p_object);
+    }
+
+  private:
+
+    // Should not be copied.
+    pool_atomic(const pool_atomic&) ETL_DELETE;
+    pool_atomic& operator =(const pool_atomic&) ETL_DELETE;
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,389 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_CACHE_INCLUDED
+#define ETL_POOL_CACHE_INCLUDED
+
+#include "platform.h"
+#include "ipool.h"
+#include "pool_atomic.h"
+#include "error_handler.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup pool_cache pool_cache
+/// A local cache of free items in front of a shared pool.
+///\ingroup pool
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// A local cache of free items, layered over a shared pool.
+  /// Each thread or core owns its own cache, so the common path of allocate
+  /// and release never touches the shared pool. When the cache runs dry it
+  /// takes half of its capacity from the shared pool, and when it fills it
+  /// returns half, so the shared pool is only accessed once per batch.
+  /// A cache must only be used by the context that owns it.
+  ///
+  /// The shared pool type is etl::ipool, for any etl::pool or etl::generic_pool,
+  /// or etl::ipool_atomic, for the lock free variants.
+  /// Override lock() and unlock() to protect a pool that is not lock free.
+  /// Each batch is accessed within a single lock, and nothing raises an
+  /// error while it is held.
+  /// Call flush() before the cache is destroyed, to return its items to the
+  /// shared pool.
+  ///\tparam TPool       The shared pool interface type. etl::ipool or etl::ipool_atomic.
+  ///\tparam VCache_Size The number of free items the cache may hold.
+  ///\ingroup pool_cache
+  //***************************************************************************
+  template <typename TPool, size_t VCache_Size>
+  class pool_cache
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VCache_Size > 0U, "Cache size must be greater than zero");
+
+    static ETL_CONSTANT size_t Cache_Size = VCache_Size;
+    static ETL_CONSTANT size_t Batch_Size = (VCache_Size + 1U) / 2U;
+
+    typedef TPool pool_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    pool_cache(TPool& pool_)
+      : pool(pool_)
+      , n_cached(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Does not return the cached items to the shared pool, as an overridden
+    /// lock() cannot be called from here. Call flush() first.
+    //*************************************************************************
+    virtual ~pool_cache()
+    {
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(sizeof(T) <= pool.item_size(), ETL_ERROR(etl::pool_element_size), ETL_NULLPTR);
+
+      if (n_cached == 0U)
+      {
+        refill<T>();
+
+        // Reported once the lock is released.
+        ETL_ASSERT_OR_RETURN_VALUE(n_cached != 0U, ETL_ERROR(etl::pool_no_allocation), ETL_NULLPTR);
+      }
+
+      return static_cast<T*>(cache[--n_cached]);
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object and create default.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 1 parameter.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object to the cache.
+    /// The object must have been allocated from the shared pool, though not
+    /// necessarily through this cache.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      ETL_ASSERT_OR_RETURN(pool.is_in_pool(p_object), ETL_ERROR(etl::pool_object_not_in_pool));
+
+      if (n_cached == VCache_Size)
+      {
+        flush_items(Batch_Size);
+      }
+
+      cache[n_cached++] = const_cast<void*>(p_object);
+    }
+
+    //*************************************************************************
+    /// Returns all of the cached items to the shared pool.
+    //*************************************************************************
+    void flush()
+    {
+      flush_items(n_cached);
+    }
+
+    //*************************************************************************
+    /// The number of free items held in the cache.
+    //*************************************************************************
+    size_t size() const
+    {
+      return n_cached;
+    }
+
+    //*************************************************************************
+    /// The number of free items the cache may hold.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t capacity() const
+    {
+      return VCache_Size;
+    }
+
+    //*************************************************************************
+    /// Is the cache empty?
+    //*************************************************************************
+    bool empty() const
+    {
+      return n_cached == 0U;
+    }
+
+    //*************************************************************************
+    /// Is the cache full?
+    //*************************************************************************
+    bool full() const
+    {
+      return n_cached == VCache_Size;
+    }
+
+    //*************************************************************************
+    /// The shared pool.
+    //*************************************************************************
+    TPool& get_pool()
+    {
+      return pool;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The shared pool lock function.
+    /// Override to add thread or interrupt locking to the shared pool.
+    //*************************************************************************
+    virtual void lock()
+    {
+      // The default implementation does nothing.
+    }
+
+    //*************************************************************************
+    /// The shared pool unlock function.
+    /// Override to add thread or interrupt unlocking to the shared pool.
+    //*************************************************************************
+    virtual void unlock()
+    {
+      // The default implementation does nothing.
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Takes a batch of items from the shared pool, or as many as it has.
+    //*************************************************************************
+    template <typename T>
+    void refill()
+    {
+      lock();
+
+      while (n_cached < Batch_Size)
+      {
+        T* p = try_allocate<T>(pool);
+
+        if (p == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        cache[n_cached++] = p;
+      }
+
+      unlock();
+    }
+
+    //*************************************************************************
+    /// Takes an item from a shared etl::ipool, or returns null if it has none.
+    /// The pool is not lock free, so lock() protects the check.
+    //*************************************************************************
+    template <typename T>
+    static T* try_allocate(etl::ipool& shared_pool)
+    {
+      return shared_pool.full() ? ETL_NULLPTR : shared_pool.template allocate<T>();
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    /// Takes an item from a shared etl::ipool_atomic, or returns null if it
+    /// has none. Another context may take the last item at any time.
+    //*************************************************************************
+    template <typename T>
+    static T* try_allocate(etl::ipool_atomic& shared_pool)
+    {
+      return shared_pool.template try_allocate<T>();
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns a number of items to the shared pool.
+    //*************************************************************************
+    void flush_items(size_t count)
+    {
+      if (count != 0U)
+      {
+        lock();
+
+        while (count-- != 0U)
+        {
+          pool.release(cache[--n_cached]);
+        }
+
+        unlock();
+      }
+    }
+
+    // Should not be copied.
+    pool_cache(const pool_cache&) ETL_DELETE;
+    pool_cache& operator =(const pool_cache&) ETL_DELETE;
+
+    TPool& pool;                ///< The shared pool.
+    void*  cache[VCache_Size];  ///< The cached free items.
+    size_t n_cached;            ///< The number of cached free items.
+  };
+
+  template <typename TPool, size_t VCache_Size>
+  ETL_CONSTANT size_t pool_cache<TPool, VCache_Size>::Cache_Size;
+
+  template <typename TPool, size_t VCache_Size>
+  ETL_CONSTANT size_t pool_cache<TPool, VCache_Size>::Batch_Size;
+}
+
+#endif
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "parameter_type.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "static_assert.h"
 
 #include <stddef.h>
 
@@ -95,6 +96,185 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// The exception thrown when a handle does not refer to a queued value.
+  ///\ingroup queue
+  //***************************************************************************
+  class priority_queue_invalid_handle : public etl::priority_queue_exception
+  {
+  public:
+
+    priority_queue_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : priority_queue_exception(ETL_ERROR_TEXT("priority_queue:invalid handle", ETL_PRIORITY_QUEUE_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_priority_queue
+  {
+    //*************************************************************************
+    /// Heap operations for a heap where each node has Arity children.
+    /// A wider heap is shallower, so a push or pop visits fewer cache lines.
+    //*************************************************************************
+    template <size_t Arity>
+    struct heap
+    {
+      ETL_STATIC_ASSERT(Arity >= 2U, "A heap must have an arity of at least 2");
+
+      //***********************************************************************
+      /// Moves the value up from the index until its parent is not lower.
+      //***********************************************************************
+      template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
+      static void sift_up(TIterator first, TDistance index, TValue& value, TCompare& compare)
+      {
+        while (index > 0)
+        {
+          const TDistance parent = (index - 1) / TDistance(Arity);
+
+          if (!compare(first[parent], value))
+          {
+            break;
+          }
+
+          first[index] = ETL_MOVE(first[parent]);
+          index = parent;
+        }
+
+        first[index] = ETL_MOVE(value);
+      }
+
+      //***********************************************************************
+      /// Moves the value down from the index until no child is higher.
+      //***********************************************************************
+      template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
+      static void sift_down(TIterator first, TDistance index, TDistance length, TValue& value, TCompare& compare)
+      {
+        while (true)
+        {
+          const TDistance child = (index * TDistance(Arity)) + 1;
+
+          if (child >= length)
+          {
+            break;
+          }
+
+          const TDistance end  = ((length - child) > TDistance(Arity)) ? child + TDistance(Arity) : length;
+          TDistance       best = child;
+
+          for (TDistance other = child + 1; other < end; ++other)
+          {
+            if (compare(first[best], first[other]))
+            {
+              best = other;
+            }
+          }
+
+          if (!compare(value, first[best]))
+          {
+            break;
+          }
+
+          first[index] = ETL_MOVE(first[best]);
+          index = best;
+        }
+
+        first[index] = ETL_MOVE(value);
+      }
+
+      //***********************************************************************
+      /// Adds the last value to the heap.
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void push(TIterator first, TIterator last, TCompare& compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+        typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+
+        const difference_t index = difference_t(last - first - 1);
+        value_t value = ETL_MOVE(first[index]);
+
+        sift_up(first, index, value, compare);
+      }
+
+      //***********************************************************************
+      /// Moves the highest value to the end.
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void pop(TIterator first, TIterator last, TCompare& compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+        typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+
+        const difference_t length = difference_t(last - first - 1);
+
+        if (length > 0)
+        {
+          value_t value = ETL_MOVE(first[length]);
+          first[length] = ETL_MOVE(first[0]);
+
+          sift_down(first, difference_t(0), length, value, compare);
+        }
+      }
+
+      //***********************************************************************
+      /// Arranges the values as a heap.
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void make(TIterator first, TIterator last, TCompare& compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+        typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+
+        const difference_t length = difference_t(last - first);
+
+        if (length < 2)
+        {
+          return;
+        }
+
+        difference_t parent = (length - 2) / difference_t(Arity);
+
+        while (true)
+        {
+          value_t value = ETL_MOVE(first[parent]);
+          sift_down(first, parent, length, value, compare);
+
+          if (parent == 0)
+          {
+            return;
+          }
+
+          --parent;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Binary heaps use the ETL heap algorithms.
+    //*************************************************************************
+    template <>
+    struct heap<2U>
+    {
+      template <typename TIterator, typename TCompare>
+      static void push(TIterator first, TIterator last, TCompare& compare)
+      {
+        etl::push_heap(first, last, compare);
+      }
+
+      template <typename TIterator, typename TCompare>
+      static void pop(TIterator first, TIterator last, TCompare& compare)
+      {
+        etl::pop_heap(first, last, compare);
+      }
+
+      template <typename TIterator, typename TCompare>
+      static void make(TIterator first, TIterator last, TCompare& compare)
+      {
+        etl::make_heap(first, last, compare);
+      }
+    };
+  }
+
   //***************************************************************************
   ///\ingroup queue
   ///\brief This is the base for all priority queues that contain a particular type.
@@ -110,10 +290,15 @@ namespace etl
   /// \tparam T The type of value that the queue holds.
   /// \tparam TContainer to hold the T queue values
   /// \tparam TCompare to use in comparing T values
+  /// \tparam Arity The number of children of each node of the heap.
   //***************************************************************************
-  template <typename T, typename TContainer, typename TCompare = etl::less<T> >
+  template <typename T, typename TContainer, typename TCompare = etl::less<T>, size_t Arity = 2U>
   class ipriority_queue
   {
+  private:
+
+    typedef private_priority_queue::heap<Arity> heap_t;
+
   public:
 
     typedef T                     value_type;         ///< The type stored in the queue.
@@ -158,7 +343,7 @@ namespace etl
       // Put element at end
       container.push_back(value);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 
 #if ETL_USING_CPP11
@@ -175,7 +360,7 @@ namespace etl
       // Put element at end
       container.push_back(etl::move(value));
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 #endif
 
@@ -194,7 +379,7 @@ namespace etl
       // Put element at end
       container.emplace_back(etl::forward<Args>(args)...);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 #else
     //*************************************************************************
@@ -210,7 +395,7 @@ namespace etl
       // Put element at end
       container.emplace_back();
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -227,7 +412,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -244,7 +429,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -261,7 +446,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -278,7 +463,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3, value4);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_t::push(container.begin(), container.end(), compare);
     }
 #endif
 
@@ -302,7 +487,7 @@ namespace etl
 
       clear();
       container.assign(first, last);
-      etl::make_heap(container.begin(), container.end(), compare);
+      heap_t::make(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -312,7 +497,7 @@ namespace etl
     void pop()
     {
       // Move largest element to end
-      etl::pop_heap(container.begin(), container.end(), compare);
+      heap_t::pop(container.begin(), container.end(), compare);
       // Actually remove largest element at end
       container.pop_back();
     }
@@ -455,9 +640,10 @@ namespace etl
   /// This queue does not support concurrent access by different threads.
   /// \tparam T    The type this queue should support.
   /// \tparam SIZE The maximum capacity of the queue.
+  /// \tparam Arity The number of children of each node of the heap.
   //***************************************************************************
-  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = etl::less<typename TContainer::value_type> >
-  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare>
+  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = etl::less<typename TContainer::value_type>, size_t Arity = 2U>
+  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare, Arity>
   {
   public:
 
@@ -470,7 +656,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     priority_queue()
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, Arity>()
     {
     }
 
@@ -478,9 +664,9 @@ namespace etl
     /// Copy constructor
     //*************************************************************************
     priority_queue(const priority_queue& rhs)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, Arity>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+      etl::ipriority_queue<T, TContainer, TCompare, Arity>::clone(rhs);
     }
 
 #if ETL_USING_CPP11
@@ -488,9 +674,9 @@ namespace etl
     /// Move constructor
     //*************************************************************************
     priority_queue(priority_queue&& rhs)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, Arity>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::move(etl::move(rhs));
+      etl::ipriority_queue<T, TContainer, TCompare, Arity>::move(etl::move(rhs));
     }
 #endif
 
@@ -502,9 +688,9 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     priority_queue(TIterator first, TIterator last)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, Arity>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::assign(first, last);
+      etl::ipriority_queue<T, TContainer, TCompare, Arity>::assign(first, last);
     }
 
     //*************************************************************************
@@ -512,7 +698,7 @@ namespace etl
     //*************************************************************************
     ~priority_queue()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clear();
+      etl::ipriority_queue<T, TContainer, TCompare, Arity>::clear();
     }
 
     //*************************************************************************
@@ -522,7 +708,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+        etl::ipriority_queue<T, TContainer, TCompare, Arity>::clone(rhs);
       }
 
       return *this;
@@ -536,8 +722,8 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::ipriority_queue<T, TContainer, TCompare>::clear();
-        etl::ipriority_queue<T, TContainer, TCompare>::move(etl::move(rhs));
+        etl::ipriority_queue<T, TContainer, TCompare, Arity>::clear();
+        etl::ipriority_queue<T, TContainer, TCompare, Arity>::move(etl::move(rhs));
       }
 
       return *this;
@@ -545,8 +731,8 @@ namespace etl
 #endif
   };
 
-  template <typename T, const size_t SIZE, typename TContainer, typename TCompare>
-  ETL_CONSTANT typename priority_queue<T, SIZE, TContainer, TCompare>::size_type priority_queue<T, SIZE, TContainer, TCompare>::MAX_SIZE;
+  template <typename T, const size_t SIZE, typename TContainer, typename TCompare, size_t Arity>
+  ETL_CONSTANT typename priority_queue<T, SIZE, TContainer, TCompare, Arity>::size_type priority_queue<T, SIZE, TContainer, TCompare, Arity>::MAX_SIZE;
 }
 
 #endif
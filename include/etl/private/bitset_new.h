@@ -176,6 +176,92 @@ namespace etl
       static ETL_CONSTANT size_t   Bits_Per_Element  = etl::integral_limits<TElement>::bits;
       static ETL_CONSTANT TElement All_Set_Element   = etl::integral_limits<TElement>::max;
       static ETL_CONSTANT TElement All_Clear_Element = element_type(0);
+
+      //*************************************************************************
+      /// Calls the function with the position of each set bit, in ascending order.
+      /// Visits each element once, then each of its set bits by clearing the lowest.
+      //*************************************************************************
+      template <typename TFunction>
+      static
+      TFunction for_each_set_bit(const_pointer pbuffer,
+                                 size_t        number_of_elements,
+                                 TFunction     function)
+      {
+        for (size_t index = 0U; index < number_of_elements; ++index)
+        {
+          element_type value = pbuffer[index];
+
+          while (value != All_Clear_Element)
+          {
+            function((index * Bits_Per_Element) + etl::count_trailing_zeros(value));
+            value &= element_type(value - 1U);
+          }
+        }
+
+        return function;
+      }
+
+      //*************************************************************************
+      /// The number of set bits before the position.
+      //*************************************************************************
+      ETL_CONSTEXPR14
+      static
+      size_t rank(const_pointer pbuffer,
+                  size_t        number_of_elements,
+                  size_t        position) ETL_NOEXCEPT
+      {
+        const size_t whole_elements = position / Bits_Per_Element;
+        const size_t last           = (whole_elements < number_of_elements) ? whole_elements : number_of_elements;
+
+        size_t n = 0U;
+
+        for (size_t index = 0U; index < last; ++index)
+        {
+          n += etl::count_bits(pbuffer[index]);
+        }
+
+        const size_t bit = position % Bits_Per_Element;
+
+        if ((whole_elements < number_of_elements) && (bit != 0U))
+        {
+          n += etl::count_bits(element_type(pbuffer[whole_elements] & element_type(~(All_Set_Element << bit))));
+        }
+
+        return n;
+      }
+
+      //*************************************************************************
+      /// The position of the nth set bit, counting from zero.
+      ///\returns The position of the bit or npos if there are not enough set bits.
+      //*************************************************************************
+      ETL_CONSTEXPR14
+      static
+      size_t select(const_pointer pbuffer,
+                    size_t        number_of_elements,
+                    size_t        n) ETL_NOEXCEPT
+      {
+        for (size_t index = 0U; index < number_of_elements; ++index)
+        {
+          element_type value = pbuffer[index];
+
+          const size_t element_count = etl::count_bits(value);
+
+          if (n < element_count)
+          {
+            while (n != 0U)
+            {
+              value &= element_type(value - 1U);
+              --n;
+            }
+
+            return (index * Bits_Per_Element) + etl::count_trailing_zeros(value);
+          }
+
+          n -= element_count;
+        }
+
+        return npos;
+      }
     };
 
     template <typename TElement>
@@ -191,6 +277,219 @@ namespace etl
     ETL_CONSTANT TElement bitset_impl_common<TElement>::All_Clear_Element;
   }
 
+  namespace private_bitset
+  {
+    //***************************************************************************
+    /// Iterates the positions of the set bits of a bitset, in ascending order.
+    //***************************************************************************
+    template <typename TElement>
+    class set_bit_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, size_t>
+    {
+    public:
+
+      //*******************************
+      set_bit_iterator()
+        : p_element(ETL_NULLPTR)
+        , p_end(ETL_NULLPTR)
+        , offset(0U)
+        , value(0U)
+      {
+      }
+
+      //*******************************
+      set_bit_iterator(const TElement* p_begin_, const TElement* p_end_)
+        : p_element(p_begin_)
+        , p_end(p_end_)
+        , offset(0U)
+        , value(0U)
+      {
+        if (p_element != p_end)
+        {
+          value = *p_element;
+          skip_clear_elements();
+        }
+      }
+
+      //*******************************
+      size_t operator *() const
+      {
+        return offset + etl::count_trailing_zeros(value);
+      }
+
+      //*******************************
+      set_bit_iterator& operator ++()
+      {
+        value &= TElement(value - 1U);
+        skip_clear_elements();
+
+        return *this;
+      }
+
+      //*******************************
+      set_bit_iterator operator ++(int)
+      {
+        set_bit_iterator temp(*this);
+        ++(*this);
+
+        return temp;
+      }
+
+      //*******************************
+      friend bool operator ==(const set_bit_iterator& lhs, const set_bit_iterator& rhs)
+      {
+        return (lhs.p_element == rhs.p_element) && (lhs.value == rhs.value);
+      }
+
+      //*******************************
+      friend bool operator !=(const set_bit_iterator& lhs, const set_bit_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*******************************
+      void skip_clear_elements()
+      {
+        while ((value == 0U) && (p_element != p_end))
+        {
+          ++p_element;
+          offset += etl::integral_limits<TElement>::bits;
+
+          if (p_element != p_end)
+          {
+            value = *p_element;
+          }
+        }
+      }
+
+      const TElement* p_element;
+      const TElement* p_end;
+      size_t          offset;
+      TElement        value;
+    };
+
+    //***************************************************************************
+    /// A range of the positions of the set bits of a bitset.
+    /// The bitset must not be modified while the range is in use.
+    //***************************************************************************
+    template <typename TElement>
+    class set_bit_range
+    {
+    public:
+
+      typedef etl::private_bitset::set_bit_iterator<TElement> iterator;
+      typedef iterator                                        const_iterator;
+
+      //*******************************
+      set_bit_range(const TElement* p_begin_, const TElement* p_end_)
+        : p_begin(p_begin_)
+        , p_end(p_end_)
+      {
+      }
+
+      //*******************************
+      iterator begin() const
+      {
+        return iterator(p_begin, p_end);
+      }
+
+      //*******************************
+      iterator end() const
+      {
+        return iterator(p_end, p_end);
+      }
+
+    private:
+
+      const TElement* p_begin;
+      const TElement* p_end;
+    };
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Loads and stores 64 bit words made of consecutive narrower elements,
+    /// the lowest element in the least significant bits.
+    /// Written as shifts, so that they remain constexpr and do not depend on
+    /// the endianness or alignment of the buffer. Compilers merge them into
+    /// single word loads and stores.
+    //***************************************************************************
+    template <typename TElement, size_t Bits = etl::integral_limits<TElement>::bits>
+    struct element_word
+    {
+      static ETL_CONSTEXPR14 uint64_t load(const TElement* p) ETL_NOEXCEPT
+      {
+        return static_cast<uint64_t>(p[0]);
+      }
+
+      static ETL_CONSTEXPR14 void store(TElement* p, uint64_t word) ETL_NOEXCEPT
+      {
+        p[0] = static_cast<TElement>(word);
+      }
+    };
+
+    //*******************************
+    template <typename TElement>
+    struct element_word<TElement, 8U>
+    {
+      static ETL_CONSTEXPR14 uint64_t load(const TElement* p) ETL_NOEXCEPT
+      {
+        return  static_cast<uint64_t>(p[0])         | (static_cast<uint64_t>(p[1]) << 8U)  |
+               (static_cast<uint64_t>(p[2]) << 16U) | (static_cast<uint64_t>(p[3]) << 24U) |
+               (static_cast<uint64_t>(p[4]) << 32U) | (static_cast<uint64_t>(p[5]) << 40U) |
+               (static_cast<uint64_t>(p[6]) << 48U) | (static_cast<uint64_t>(p[7]) << 56U);
+      }
+
+      static ETL_CONSTEXPR14 void store(TElement* p, uint64_t word) ETL_NOEXCEPT
+      {
+        p[0] = static_cast<TElement>(word);
+        p[1] = static_cast<TElement>(word >> 8U);
+        p[2] = static_cast<TElement>(word >> 16U);
+        p[3] = static_cast<TElement>(word >> 24U);
+        p[4] = static_cast<TElement>(word >> 32U);
+        p[5] = static_cast<TElement>(word >> 40U);
+        p[6] = static_cast<TElement>(word >> 48U);
+        p[7] = static_cast<TElement>(word >> 56U);
+      }
+    };
+
+    //*******************************
+    template <typename TElement>
+    struct element_word<TElement, 16U>
+    {
+      static ETL_CONSTEXPR14 uint64_t load(const TElement* p) ETL_NOEXCEPT
+      {
+        return  static_cast<uint64_t>(p[0])         | (static_cast<uint64_t>(p[1]) << 16U) |
+               (static_cast<uint64_t>(p[2]) << 32U) | (static_cast<uint64_t>(p[3]) << 48U);
+      }
+
+      static ETL_CONSTEXPR14 void store(TElement* p, uint64_t word) ETL_NOEXCEPT
+      {
+        p[0] = static_cast<TElement>(word);
+        p[1] = static_cast<TElement>(word >> 16U);
+        p[2] = static_cast<TElement>(word >> 32U);
+        p[3] = static_cast<TElement>(word >> 48U);
+      }
+    };
+
+    //*******************************
+    template <typename TElement>
+    struct element_word<TElement, 32U>
+    {
+      static ETL_CONSTEXPR14 uint64_t load(const TElement* p) ETL_NOEXCEPT
+      {
+        return static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 32U);
+      }
+
+      static ETL_CONSTEXPR14 void store(TElement* p, uint64_t word) ETL_NOEXCEPT
+      {
+        p[0] = static_cast<TElement>(word);
+        p[1] = static_cast<TElement>(word >> 32U);
+      }
+    };
+#endif
+  }
+
   //*************************************************************************
   /// Bitset implementation declaration.
   ///\ingroup bitset
@@ -681,27 +980,15 @@ namespace etl
     {
       if (position < active_bits)
       {
-        // Where to start.
-        size_t bit = position;
+        // Invert to search for clear bits, and ignore the bits before the position.
+        element_type value = state ? *pbuffer : element_type(~*pbuffer);
+        value &= element_type(All_Set_Element << position);
 
-        element_type mask = 1U << position;
-
-        // Needs checking?
-        if ((state && (*pbuffer != All_Clear_Element)) || (!state && (*pbuffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < active_bits)
-          {
-            // Equal to the required state?
-            if (((*pbuffer & mask) != 0) == state)
-            {
-              return bit;
-            }
+          const size_t bit = etl::count_trailing_zeros(value);
 
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
-          }
+          return (bit < active_bits) ? bit : npos;
         }
       }
 
@@ -789,6 +1076,12 @@ namespace etl
       else
       {
         *pbuffer <<= shift;
+
+        // Clear any bits shifted above the top.
+        if (active_bits < Bits_Per_Element)
+        {
+          *pbuffer &= element_type(~(All_Set_Element << active_bits));
+        }
       }
     }
 
@@ -863,6 +1156,13 @@ namespace etl
 
     typedef etl::private_bitset::bitset_impl_common<TElement> common;
 
+#if ETL_USING_64BIT_TYPES
+    typedef etl::private_bitset::element_word<TElement> word_type;
+
+    /// The number of elements in a 64 bit word.
+    static ETL_CONSTANT size_t Elements_Per_Word = (etl::integral_limits<TElement>::bits < 64U) ? (64U / etl::integral_limits<TElement>::bits) : 1U;
+#endif
+
   public:
 
     using typename etl::private_bitset::bitset_impl_common<TElement>::element_type;
@@ -909,6 +1209,20 @@ namespace etl
     {
       size_t count = 0;
 
+#if ETL_USING_64BIT_TYPES
+      // Count narrow elements 64 bits at a time.
+      if (Elements_Per_Word > 1U)
+      {
+        while (number_of_elements >= Elements_Per_Word)
+        {
+          count += etl::count_bits(word_type::load(pbuffer));
+
+          pbuffer            += Elements_Per_Word;
+          number_of_elements -= Elements_Per_Word;
+        }
+      }
+#endif
+
       while (number_of_elements-- != 0)
       {
         count += etl::count_bits(*pbuffer++);
@@ -1476,40 +1790,22 @@ namespace etl
       size_t index = position >> log2<Bits_Per_Element>::value;
       size_t bit   = position & (Bits_Per_Element - 1);
 
-      element_type mask = 1 << bit;
-
       // For each element in the bitset...
       while (index < number_of_elements)
       {
-        element_type value = pbuffer[index];
+        // Invert to search for clear bits, and ignore the bits before the position.
+        element_type value = state ? pbuffer[index] : element_type(~pbuffer[index]);
+        value &= element_type(All_Set_Element << bit);
 
-        // Needs checking?
-        if ((state && (value != All_Clear_Element)) ||
-            (!state && (value != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while ((bit < Bits_Per_Element) && (position < total_bits))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
+          position = (index * Bits_Per_Element) + etl::count_trailing_zeros(value);
 
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
-        }
-        else
-        {
-          position += (Bits_Per_Element - bit);
+          return (position < total_bits) ? position : npos;
         }
 
         // Start at the beginning for all other elements.
         bit = 0;
-        mask = 1;
 
         ++index;
       }
@@ -1642,50 +1938,60 @@ namespace etl
       }
       else
       {
-        // The place where the elements are split when shifting.
-        const size_t split_position = Bits_Per_Element - (shift % Bits_Per_Element);
+        const size_t element_shift = shift / Bits_Per_Element;
+        const size_t bit_shift     = shift % Bits_Per_Element;
+
+        // Work down from the top, so that each source element is read before it is overwritten.
+        if (bit_shift == 0U)
+        {
+          for (size_t i = number_of_elements; i-- > element_shift;)
+          {
+            pbuffer[i] = pbuffer[i - element_shift];
+          }
+        }
+        else
+        {
+          const size_t carry_shift = Bits_Per_Element - bit_shift;
 
-        // Where we are shifting from.
-        int src_index = int(number_of_elements - (shift / Bits_Per_Element) - 1U);
+          size_t i = number_of_elements - 1U;
 
-        // Where we are shifting to.
-        int dst_index = int(number_of_elements - 1U);
+#if ETL_USING_64BIT_TYPES
+          // Shift narrow elements 64 bits at a time.
+          if (Elements_Per_Word > 1U)
+          {
+            while (i >= (element_shift + Elements_Per_Word))
+            {
+              const size_t   dst   = i + 1U - Elements_Per_Word;
+              const uint64_t word  = word_type::load(pbuffer + dst - element_shift);
+              const uint64_t carry = static_cast<uint64_t>(pbuffer[dst - element_shift - 1U]) >> carry_shift;
 
-        // Shift control constants.
-        const size_t lsb_shift = Bits_Per_Element - split_position;
-        const size_t msb_shift = split_position;
+              word_type::store(pbuffer + dst, (word << bit_shift) | carry);
 
-        const element_type lsb_mask = element_type(etl::integral_limits<element_type>::max >> (Bits_Per_Element - split_position));
-        const element_type msb_mask = etl::integral_limits<element_type>::max - lsb_mask;
-        const element_type lsb_shifted_mask = element_type(lsb_mask << lsb_shift);
+              i -= Elements_Per_Word;
+            }
+          }
+#endif
 
-        // First lsb.
-        element_type lsb = element_type((pbuffer[src_index] & lsb_mask) << lsb_shift);
-        pbuffer[dst_index] = lsb;
-        --src_index;
+          for (; i > element_shift; --i)
+          {
+            pbuffer[i] = element_type((pbuffer[i - element_shift] << bit_shift) | (pbuffer[i - element_shift - 1U] >> carry_shift));
+          }
 
-        // Now do the shifting.
-        while (src_index >= 0)
+          pbuffer[element_shift] = element_type(pbuffer[0] << bit_shift);
+        }
+
+        // Clear the elements shifted in from the bottom.
+        for (size_t i = 0U; i < element_shift; ++i)
         {
-          // Shift msb.
-          element_type msb = element_type((pbuffer[src_index] & msb_mask) >> msb_shift);
-          pbuffer[dst_index] = pbuffer[dst_index] | msb;
-          --dst_index;
-
-          // Shift lsb.
-          lsb = element_type((pbuffer[src_index] & lsb_mask) << lsb_shift);
-          pbuffer[dst_index] = lsb;
-          --src_index;
+          pbuffer[i] = All_Clear_Element;
         }
 
-        // Clear the remaining bits.
-        // First lsb.
-        pbuffer[dst_index] &= lsb_shifted_mask;
+        // Clear any bits shifted above the top.
+        const size_t top_bits = active_bits % Bits_Per_Element;
 
-        // The other remaining bytes on the right.
-        for (int i = 0; i < dst_index; ++i)
+        if (top_bits != 0U)
         {
-          pbuffer[i] = 0;
+          pbuffer[number_of_elements - 1U] &= element_type(~(All_Set_Element << top_bits));
         }
       }
     }
@@ -1706,52 +2012,53 @@ namespace etl
       }
       else
       {
-        // The place where the elements are split when shifting.
-        const size_t split_position = shift % Bits_Per_Element;
+        const size_t element_shift = shift / Bits_Per_Element;
+        const size_t bit_shift     = shift % Bits_Per_Element;
+        const size_t last          = number_of_elements - 1U - element_shift;
 
-        // Where we are shifting from.
-        int src_index = int(shift / Bits_Per_Element);
+        // Work up from the bottom, so that each source element is read before it is overwritten.
+        // The bits above the top are always clear, so nothing is shifted in from there.
+        if (bit_shift == 0U)
+        {
+          for (size_t i = 0U; i <= last; ++i)
+          {
+            pbuffer[i] = pbuffer[i + element_shift];
+          }
+        }
+        else
+        {
+          const size_t carry_shift = Bits_Per_Element - bit_shift;
 
-        // Where we are shifting to.
-        int dst_index = 0;
+          size_t i = 0U;
 
-        // Shift control constants.
-        const size_t lsb_shift = Bits_Per_Element - split_position;
-        const size_t msb_shift = split_position;
+#if ETL_USING_64BIT_TYPES
+          // Shift narrow elements 64 bits at a time.
+          if (Elements_Per_Word > 1U)
+          {
+            while ((i + Elements_Per_Word) <= last)
+            {
+              const uint64_t word  = word_type::load(pbuffer + i + element_shift);
+              const uint64_t carry = static_cast<uint64_t>(pbuffer[i + element_shift + Elements_Per_Word]) << (64U - bit_shift);
 
-        const element_type lsb_mask = element_type(etl::integral_limits<element_type>::max >> (Bits_Per_Element - split_position));
-        const element_type msb_mask = etl::integral_limits<element_type>::max - lsb_mask;
-        const element_type msb_shifted_mask = element_type(msb_mask >> msb_shift);
+              word_type::store(pbuffer + i, (word >> bit_shift) | carry);
 
-        // Now do the shifting.
-        while (src_index < int(number_of_elements - 1))
-        {
-          // Shift msb.
-          element_type msb = element_type((pbuffer[src_index] & msb_mask) >> msb_shift);
-          ++src_index;
+              i += Elements_Per_Word;
+            }
+          }
+#endif
 
-          // Shift lsb.
-          element_type lsb = element_type((pbuffer[src_index] & lsb_mask) << lsb_shift);
+          for (; i < last; ++i)
+          {
+            pbuffer[i] = element_type((pbuffer[i + element_shift] >> bit_shift) | (pbuffer[i + element_shift + 1U] << carry_shift));
+          }
 
-          // Combine them.
-          pbuffer[dst_index] = lsb | msb;
-          ++dst_index;
+          pbuffer[last] = element_type(pbuffer[number_of_elements - 1U] >> bit_shift);
         }
 
-        // Final msb.
-        element_type msb = element_type((pbuffer[src_index] & msb_mask) >> msb_shift);
-        pbuffer[dst_index] = msb;
-
-        // Clear the remaining bits.
-        // First msb.
-        pbuffer[dst_index] &= msb_shifted_mask;
-        ++dst_index;
-
-        // The other remaining bytes.
-        while (dst_index < int(number_of_elements))
+        // Clear the elements shifted in from the top.
+        for (size_t i = last + 1U; i < number_of_elements; ++i)
         {
-          pbuffer[dst_index] = 0;
-          ++dst_index;
+          pbuffer[i] = All_Clear_Element;
         }
       }
     }
@@ -1835,6 +2142,11 @@ namespace etl
     }
   };
 
+#if ETL_USING_64BIT_TYPES
+  template <typename TElement>
+  ETL_CONSTANT size_t bitset_impl<TElement, etl::bitset_storage_model::Multi>::Elements_Per_Word;
+#endif
+
   namespace private_bitset
   {
     //***************************************************************************
@@ -1936,6 +2248,9 @@ namespace etl
     typedef typename etl::private_bitset::bitset_common<Active_Bits, TElement>::span_type       span_type;
     typedef typename etl::private_bitset::bitset_common<Active_Bits, TElement>::const_span_type const_span_type;
 
+    typedef etl::private_bitset::set_bit_iterator<TElement> set_bit_iterator;
+    typedef etl::private_bitset::set_bit_range<TElement>    set_bit_range;
+
     using etl::private_bitset::bitset_common<Active_Bits, TElement>::Bits_Per_Element;
     using etl::private_bitset::bitset_common<Active_Bits, TElement>::All_Set_Element;
     using etl::private_bitset::bitset_common<Active_Bits, TElement>::All_Clear_Element;
@@ -2564,6 +2879,43 @@ namespace etl
       return implementation::find_next(buffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// Returns a range of the positions of the set bits, in ascending order.
+    /// Each increment clears the lowest remaining bit of an element, so
+    /// iterating all of the set bits is proportional to count(), not size().
+    //*************************************************************************
+    set_bit_range set_bits() const
+    {
+      return set_bit_range(buffer, buffer + Number_Of_Elements);
+    }
+
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_set_bit(TFunction function) const
+    {
+      return implementation::for_each_set_bit(buffer, Number_Of_Elements, function);
+    }
+
+    //*************************************************************************
+    /// The number of set bits before the position.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t rank(size_t position) const ETL_NOEXCEPT
+    {
+      return implementation::rank(buffer, Number_Of_Elements, position);
+    }
+
+    //*************************************************************************
+    /// The position of the nth set bit, counting from zero.
+    ///\returns The position of the bit or npos if there are fewer than n + 1 set bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t select(size_t n) const ETL_NOEXCEPT
+    {
+      return implementation::select(buffer, Number_Of_Elements, n);
+    }
+
     //*************************************************************************
     /// operator &
     //*************************************************************************
@@ -2860,7 +3212,10 @@ namespace etl
     typedef typename etl::private_bitset::bitset_common<Active_Bits, TElement>::element_type    element_type;
     typedef typename etl::private_bitset::bitset_common<Active_Bits, TElement>::span_type       span_type;
     typedef typename etl::private_bitset::bitset_common<Active_Bits, TElement>::const_span_type const_span_type;
-    
+
+    typedef etl::private_bitset::set_bit_iterator<TElement> set_bit_iterator;
+    typedef etl::private_bitset::set_bit_range<TElement>    set_bit_range;
+
     using etl::private_bitset::bitset_common<Active_Bits, TElement>::Bits_Per_Element;
     using etl::private_bitset::bitset_common<Active_Bits, TElement>::All_Set_Element;
     using etl::private_bitset::bitset_common<Active_Bits, TElement>::All_Clear_Element;
@@ -3570,6 +3925,43 @@ namespace etl
       return implementation::find_next(pbuffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// Returns a range of the positions of the set bits, in ascending order.
+    /// Each increment clears the lowest remaining bit of an element, so
+    /// iterating all of the set bits is proportional to count(), not size().
+    //*************************************************************************
+    set_bit_range set_bits() const
+    {
+      return set_bit_range(pbuffer, pbuffer + Number_Of_Elements);
+    }
+
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_set_bit(TFunction function) const
+    {
+      return implementation::for_each_set_bit(pbuffer, Number_Of_Elements, function);
+    }
+
+    //*************************************************************************
+    /// The number of set bits before the position.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t rank(size_t position) const ETL_NOEXCEPT
+    {
+      return implementation::rank(pbuffer, Number_Of_Elements, position);
+    }
+
+    //*************************************************************************
+    /// The position of the nth set bit, counting from zero.
+    ///\returns The position of the bit or npos if there are fewer than n + 1 set bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t select(size_t n) const ETL_NOEXCEPT
+    {
+      return implementation::select(pbuffer, Number_Of_Elements, n);
+    }
+
     //*************************************************************************
     /// operator &=
     //*************************************************************************
@@ -40,6 +40,7 @@ SOFTWARE.
 #include "stdint.h"
 
 #include "crc_parameters.h"
+#include "crc_intrinsics.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -587,12 +588,443 @@ namespace etl
       }
     };
 
+    //*****************************************************************************
+    /// CRC Slice Table Entry
+    /// The CRC of a byte followed by 'Slice' zero bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    class crc_slice_table_entry
+    {
+    private:
+
+      static ETL_CONSTANT TAccumulator Previous    = crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice - 1U>::value;
+      static ETL_CONSTANT size_t       Table_Index = Reflect ? size_t(Previous & 0xFFU) : size_t(Previous >> (Accumulator_Bits - 8U));
+
+    public:
+
+      static ETL_CONSTANT TAccumulator value = Reflect ? TAccumulator((Previous >> 8U) ^ crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Table_Index, 8U>::value)
+                                                       : TAccumulator((Previous << 8U) ^ crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Table_Index, 8U>::value);
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Previous;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT size_t crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Table_Index;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::value;
+
+    //*********************************
+    // Slice 0 is the standard byte table.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    class crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>
+    {
+    public:
+
+      static ETL_CONSTANT TAccumulator value = crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>::value;
+
+    //*****************************************************************************
+    /// CRC Slice Table
+    /// The 256 entry table for one slice.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice>
+    struct crc_slice_table
+    {
+      static const TAccumulator table[256U];
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice>
+    const TAccumulator crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice>::table[256U] =
+    {
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 1U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 2U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 3U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 4U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 5U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 6U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 7U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 9U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 10U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 11U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 12U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 13U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 14U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 15U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 17U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 18U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 19U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 20U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 21U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 22U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 23U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 24U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 25U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 26U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 27U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 28U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 29U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 30U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 31U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 32U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 33U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 34U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 35U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 36U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 37U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 38U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 39U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 40U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 41U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 42U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 43U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 44U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 45U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 46U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 47U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 48U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 49U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 50U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 51U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 52U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 53U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 54U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 55U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 56U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 57U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 58U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 59U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 60U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 61U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 62U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 63U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 64U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 65U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 66U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 67U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 68U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 69U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 70U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 71U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 72U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 73U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 74U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 75U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 76U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 77U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 78U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 79U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 80U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 81U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 82U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 83U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 84U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 85U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 86U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 87U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 88U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 89U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 90U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 91U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 92U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 93U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 94U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 95U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 96U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 97U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 98U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 99U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 100U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 101U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 102U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 103U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 104U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 105U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 106U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 107U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 108U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 109U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 110U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 111U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 112U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 113U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 114U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 115U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 116U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 117U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 118U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 119U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 120U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 121U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 122U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 123U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 124U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 125U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 126U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 127U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 128U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 129U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 130U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 131U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 132U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 133U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 134U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 135U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 136U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 137U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 138U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 139U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 140U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 141U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 142U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 143U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 144U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 145U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 146U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 147U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 148U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 149U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 150U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 151U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 152U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 153U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 154U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 155U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 156U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 157U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 158U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 159U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 160U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 161U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 162U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 163U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 164U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 165U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 166U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 167U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 168U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 169U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 170U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 171U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 172U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 173U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 174U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 175U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 176U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 177U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 178U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 179U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 180U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 181U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 182U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 183U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 184U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 185U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 186U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 187U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 188U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 189U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 190U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 191U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 192U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 193U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 194U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 195U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 196U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 197U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 198U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 199U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 200U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 201U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 202U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 203U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 204U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 205U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 206U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 207U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 208U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 209U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 210U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 211U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 212U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 213U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 214U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 215U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 216U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 217U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 218U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 219U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 220U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 221U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 222U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 223U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 224U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 225U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 226U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 227U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 228U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 229U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 230U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 231U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 232U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 233U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 234U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 235U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 236U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 237U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 238U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 239U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 240U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 241U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 242U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 243U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 244U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 245U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 246U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 247U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 248U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 249U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 250U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 251U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 252U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 253U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 254U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 255U, Slice>::value
+    };
+
+    //*****************************************************************************
+    /// CRC Slice Terms
+    /// Combines the table lookups for each byte of a block.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices, size_t Remaining>
+    struct crc_slice_terms
+    {
+      static ETL_CONSTANT size_t Byte_Index = Slices - Remaining;
+      static ETL_CONSTANT bool   Use_Crc    = (Byte_Index < (Accumulator_Bits / 8U));
+      static ETL_CONSTANT size_t Crc_Shift  = Use_Crc ? (Reflect ? (Byte_Index * 8U) : (Accumulator_Bits - ((Byte_Index + 1U) * 8U))) : 0U;
+
+      //*************************************************************************
+      static TAccumulator get(TAccumulator crc, const uint8_t* p)
+      {
+        uint8_t index = p[Byte_Index];
+
+        if ETL_IF_CONSTEXPR(Use_Crc)
+        {
+          index ^= uint8_t(crc >> Crc_Shift);
+        }
+
+        return crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Remaining - 1U>::table[index] ^
+               crc_slice_terms<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, Remaining - 1U>::get(crc, p);
+      }
+    };
+
+    //*********************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_terms<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, 0U>
+    {
+      //*************************************************************************
+      static TAccumulator get(TAccumulator, const uint8_t*)
+      {
+        return TAccumulator(0U);
+      }
+    };
+
+    //*****************************************************************************
+    /// CRC Sliced Tables.
+    /// Processes 'Slices' bytes per step using 'Slices' 256 entry tables.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_tables
+    {
+      ETL_STATIC_ASSERT((Accumulator_Bits % 8U) == 0U, "Accumulator bits must be a multiple of 8");
+      ETL_STATIC_ASSERT((Accumulator_Bits / 8U) <= Slices, "Accumulator is wider than the slice block");
+
+      /// The number of bytes processed by add_block.
+      static ETL_CONSTANT size_t Block_Size = Slices;
+
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, uint8_t value) const
+      {
+        return crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, value, crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U>::table);
+      }
+
+      //*************************************************************************
+      /// Adds Block_Size bytes.
+      //*************************************************************************
+      TAccumulator add_block(TAccumulator crc, const uint8_t* p) const
+      {
+        return crc_slice_terms<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, Slices>::get(crc, p);
+      }
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    ETL_CONSTANT size_t crc_slice_tables<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices>::Block_Size;
+
     //*****************************************************************************
     // CRC Policies.
     //*****************************************************************************
     template <typename TCrcParameters, size_t Table_Size>
     struct crc_policy;
 
+    //*********************************
+    // Policy for slice-by-16 tables.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 4096U> : public crc_slice_tables<typename TCrcParameters::accumulator_type, 
+                                                                       TCrcParameters::Accumulator_Bits,
+                                                                       TCrcParameters::Polynomial,
+                                                                       TCrcParameters::Reflect,
+                                                                       16U> 
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    //*********************************
+    // Policy for slice-by-8 tables.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 2048U> : public crc_slice_tables<typename TCrcParameters::accumulator_type, 
+                                                                       TCrcParameters::Accumulator_Bits,
+                                                                       TCrcParameters::Polynomial,
+                                                                       TCrcParameters::Reflect,
+                                                                       8U> 
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
     //*********************************
     // Policy for 256 entry table.
     template <typename TCrcParameters>
@@ -676,17 +1108,163 @@ namespace etl
         return crc ^ TCrcParameters::Xor_Out;
       }
     };
+
+    //*****************************************************************************
+    /// CRC Combine.
+    /// Polynomial arithmetic modulo the CRC polynomial, in the bit order of the
+    /// accumulator, used to merge the CRCs of adjacent blocks.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_combine
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT size_t           Accumulator_Bits = TCrcParameters::Accumulator_Bits;
+      static ETL_CONSTANT accumulator_type Top_Bit          = accumulator_type(accumulator_type(1U) << (Accumulator_Bits - 1U));
+      static ETL_CONSTANT accumulator_type Polynomial       = TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Polynomial>::value
+                                                                                      : TCrcParameters::Polynomial;
+      static ETL_CONSTANT accumulator_type Initial          = TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                                                                      : TCrcParameters::Initial;
+      static ETL_CONSTANT accumulator_type One              = TCrcParameters::Reflect ? Top_Bit : accumulator_type(1U);
+
+      //*************************************************************************
+      /// Returns a * x mod P.
+      //*************************************************************************
+      static accumulator_type multiply_x(accumulator_type a)
+      {
+        if ETL_IF_CONSTEXPR(TCrcParameters::Reflect)
+        {
+          return ((a & accumulator_type(1U)) != 0U) ? accumulator_type((a >> 1U) ^ Polynomial) : accumulator_type(a >> 1U);
+        }
+        else
+        {
+          return ((a & Top_Bit) != 0U) ? accumulator_type((a << 1U) ^ Polynomial) : accumulator_type(a << 1U);
+        }
+      }
+
+      //*************************************************************************
+      /// Returns a * b mod P.
+      //*************************************************************************
+      static accumulator_type multiply(accumulator_type a, accumulator_type b)
+      {
+        accumulator_type product = 0U;
+        accumulator_type term    = One;
+
+        for (size_t i = 0U; i < Accumulator_Bits; ++i)
+        {
+          if ((a & term) != 0U)
+          {
+            product ^= b;
+          }
+
+          b    = multiply_x(b);
+          term = TCrcParameters::Reflect ? accumulator_type(term >> 1U) : accumulator_type(term << 1U);
+        }
+
+        return product;
+      }
+
+      //*************************************************************************
+      /// Returns x^(8 * n) mod P, the effect of n zero bytes on the accumulator.
+      //*************************************************************************
+      static accumulator_type x_pow_8n(size_t n)
+      {
+        accumulator_type result = One;
+        accumulator_type square = One;
+
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          square = multiply_x(square);
+        }
+
+        while (n != 0U)
+        {
+          if ((n & 1U) != 0U)
+          {
+            result = multiply(result, square);
+          }
+
+          square = multiply(square, square);
+          n >>= 1U;
+        }
+
+        return result;
+      }
+
+      //*************************************************************************
+      /// Returns the CRC of the concatenation of A and B.
+      /// \param crc_a    The CRC of block A.
+      /// \param crc_b    The CRC of block B.
+      /// \param length_b The length of block B in bytes.
+      //*************************************************************************
+      static accumulator_type combine(accumulator_type crc_a, accumulator_type crc_b, size_t length_b)
+      {
+        accumulator_type shifted = accumulator_type(crc_a ^ TCrcParameters::Xor_Out ^ Initial);
+
+        return accumulator_type(multiply(shifted, x_pow_8n(length_b)) ^ crc_b);
+      }
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT size_t crc_combine<TCrcParameters>::Accumulator_Bits;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT typename crc_combine<TCrcParameters>::accumulator_type crc_combine<TCrcParameters>::Top_Bit;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT typename crc_combine<TCrcParameters>::accumulator_type crc_combine<TCrcParameters>::Polynomial;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT typename crc_combine<TCrcParameters>::accumulator_type crc_combine<TCrcParameters>::Initial;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT typename crc_combine<TCrcParameters>::accumulator_type crc_combine<TCrcParameters>::One;
+
+    //*****************************************************************************
+    // CRC Policy Selection.
+    // Selects the CRC instruction policy, if enabled and available, otherwise
+    // the table policy.
+    //*****************************************************************************
+    template <typename TCrcParameters, size_t Table_Size>
+    struct crc_policy_type
+    {
+      typedef crc_policy<TCrcParameters, Table_Size> type;
+    };
+
+#if ETL_USING_BUILTIN_CRC32_C == 1
+    //*********************************
+    template <size_t Table_Size>
+    struct crc_policy_type<crc32_c_parameters, Table_Size>
+    {
+      typedef crc_intrinsic_policy<crc32_c_parameters, crc32_c_intrinsics> type;
+    };
+#endif
+
+#if ETL_USING_BUILTIN_CRC32 == 1
+    //*********************************
+    template <size_t Table_Size>
+    struct crc_policy_type<crc32_parameters, Table_Size>
+    {
+      typedef crc_intrinsic_policy<crc32_parameters, crc32_intrinsics> type;
+    };
+#endif
   }
 
   //*****************************************************************************
   /// Basic parameterised CRC type.
+  /// Table_Size selects the algorithm.
+  /// 4, 16 or 256 : Processes one byte per step using a 4, 16 or 256 entry table.
+  /// 2048         : Slice-by-8. Processes 8 bytes per step when adding a range of pointers.
+  /// 4096         : Slice-by-16. Processes 16 bytes per step when adding a range of pointers.
+  /// If ETL_USE_CRC_INTRINSICS is defined, CRC32-C and CRC32 use the CRC
+  /// instructions of the target, where available, for all table sizes.
   //*****************************************************************************
   template <typename TCrcParameters, size_t Table_Size>
-  class crc_type : public etl::frame_check_sequence<private_crc::crc_policy<TCrcParameters, Table_Size> >
+  class crc_type : public etl::frame_check_sequence<typename private_crc::crc_policy_type<TCrcParameters, Table_Size>::type>
   {
   public:
 
-    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || (Table_Size == 2048U) || (Table_Size == 4096U), "Table size must be 4, 16, 256, 2048 or 4096");
 
     //*************************************************************************
     /// Default constructor.
@@ -707,7 +1285,33 @@ namespace etl
       this->reset();
       this->add(begin, end);
     }
+
+    //*************************************************************************
+    /// Returns the CRC of the concatenation of two blocks, from the CRCs of each.
+    /// \param crc_a    The CRC of the first block.
+    /// \param crc_b    The CRC of the second block.
+    /// \param length_b The length of the second block in bytes.
+    //*************************************************************************
+    static typename TCrcParameters::accumulator_type combine(typename TCrcParameters::accumulator_type crc_a,
+                                                             typename TCrcParameters::accumulator_type crc_b,
+                                                             size_t length_b)
+    {
+      return private_crc::crc_combine<TCrcParameters>::combine(crc_a, crc_b, length_b);
+    }
   };
+
+  //*****************************************************************************
+  /// Returns the CRC of the concatenation of two blocks, from the CRCs of each.
+  ///\tparam TCrc    The CRC type. e.g. etl::crc32
+  /// \param crc_a    The CRC of the first block.
+  /// \param crc_b    The CRC of the second block.
+  /// \param length_b The length of the second block in bytes.
+  //*****************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_combine(typename TCrc::value_type crc_a, typename TCrc::value_type crc_b, size_t length_b)
+  {
+    return TCrc::combine(crc_a, crc_b, length_b);
+  }
 }
 
 #endif
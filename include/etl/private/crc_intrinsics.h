@@ -0,0 +1,187 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_INTRINSICS_INCLUDED
+#define ETL_CRC_INTRINSICS_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "crc_parameters.h"
+
+#if (ETL_USING_BUILTIN_CRC32_C == 1) || (ETL_USING_BUILTIN_CRC32 == 1)
+  #if defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+    #define ETL_CRC_INTRINSICS_ARM
+  #else
+    #include <nmmintrin.h>
+    #define ETL_CRC_INTRINSICS_X86
+    #if defined(__x86_64__) || defined(_M_X64)
+      #define ETL_CRC_INTRINSICS_X86_64
+    #endif
+  #endif
+#endif
+
+namespace etl
+{
+  namespace private_crc
+  {
+#if (ETL_USING_BUILTIN_CRC32_C == 1) || (ETL_USING_BUILTIN_CRC32 == 1)
+    //*****************************************************************************
+    /// Loads an unaligned little endian 64 bit word.
+    //*****************************************************************************
+    inline uint64_t crc_intrinsic_load_u64(const uint8_t* p)
+    {
+      uint64_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+    }
+
+    //*****************************************************************************
+    /// Loads an unaligned little endian 32 bit word.
+    //*****************************************************************************
+    inline uint32_t crc_intrinsic_load_u32(const uint8_t* p)
+    {
+      uint32_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+    }
+#endif
+
+#if ETL_USING_BUILTIN_CRC32_C == 1
+    //*****************************************************************************
+    /// CRC32-C instructions.
+    //*****************************************************************************
+    struct crc32_c_intrinsics
+    {
+      //*************************************************************************
+      static uint32_t add(uint32_t crc, uint8_t value)
+      {
+  #if defined(ETL_CRC_INTRINSICS_ARM)
+        return __crc32cb(crc, value);
+  #else
+        return _mm_crc32_u8(crc, value);
+  #endif
+      }
+
+      //*************************************************************************
+      static uint32_t add_block(uint32_t crc, const uint8_t* p)
+      {
+  #if defined(ETL_CRC_INTRINSICS_ARM)
+        return __crc32cd(crc, crc_intrinsic_load_u64(p));
+  #elif defined(ETL_CRC_INTRINSICS_X86_64)
+        return static_cast<uint32_t>(_mm_crc32_u64(crc, crc_intrinsic_load_u64(p)));
+  #else
+        crc = _mm_crc32_u32(crc, crc_intrinsic_load_u32(p));
+        return _mm_crc32_u32(crc, crc_intrinsic_load_u32(p + 4U));
+  #endif
+      }
+    };
+#endif
+
+#if ETL_USING_BUILTIN_CRC32 == 1
+    //*****************************************************************************
+    /// CRC32 instructions.
+    //*****************************************************************************
+    struct crc32_intrinsics
+    {
+      //*************************************************************************
+      static uint32_t add(uint32_t crc, uint8_t value)
+      {
+        return __crc32b(crc, value);
+      }
+
+      //*************************************************************************
+      static uint32_t add_block(uint32_t crc, const uint8_t* p)
+      {
+        return __crc32d(crc, crc_intrinsic_load_u64(p));
+      }
+    };
+#endif
+
+    //*****************************************************************************
+    /// Policy that uses CRC instructions.
+    /// Bit identical to the table policies for the same parameters.
+    ///\tparam TCrcParameters The reflected 32 bit CRC parameters.
+    ///\tparam TIntrinsics    The instructions for the polynomial.
+    //*****************************************************************************
+    template <typename TCrcParameters, typename TIntrinsics>
+    struct crc_intrinsic_policy
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      ETL_STATIC_ASSERT(TCrcParameters::Reflect, "CRC instructions require reflected parameters");
+
+      /// The number of bytes processed by add_block.
+      static ETL_CONSTANT size_t Block_Size = 8U;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value;
+      }
+
+      //*************************************************************************
+      accumulator_type add(accumulator_type crc, uint8_t value) const
+      {
+        return TIntrinsics::add(crc, value);
+      }
+
+      //*************************************************************************
+      /// Adds Block_Size bytes.
+      //*************************************************************************
+      accumulator_type add_block(accumulator_type crc, const uint8_t* p) const
+      {
+        return TIntrinsics::add_block(crc, p);
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    template <typename TCrcParameters, typename TIntrinsics>
+    ETL_CONSTANT size_t crc_intrinsic_policy<TCrcParameters, TIntrinsics>::Block_Size;
+  }
+}
+
+#undef ETL_CRC_INTRINSICS_ARM
+#undef ETL_CRC_INTRINSICS_X86
+#undef ETL_CRC_INTRINSICS_X86_64
+
+#endif
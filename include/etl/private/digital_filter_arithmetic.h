@@ -0,0 +1,140 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DIGITAL_FILTER_ARITHMETIC_INCLUDED
+#define ETL_DIGITAL_FILTER_ARITHMETIC_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../integral_limits.h"
+#include "../static_assert.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_digital_filter
+  {
+    //*************************************************************************
+    /// The default number of fraction bits for fixed point samples.
+    /// Q15 for int16_t, Q31 for int32_t. Not used for floating point.
+    //*************************************************************************
+    template <typename T, bool Is_Integral = etl::is_integral<T>::value>
+    struct default_fraction_bits
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <typename T>
+    struct default_fraction_bits<T, true>
+    {
+      static ETL_CONSTANT size_t value = size_t(etl::integral_limits<T>::bits - 1);
+    };
+
+    template <typename T, bool Is_Integral>
+    ETL_CONSTANT size_t default_fraction_bits<T, Is_Integral>::value;
+
+    template <typename T>
+    ETL_CONSTANT size_t default_fraction_bits<T, true>::value;
+
+    //*************************************************************************
+    /// Floating point arithmetic.
+    //*************************************************************************
+    template <typename T, size_t Fraction_Bits, bool Is_Integral = etl::is_integral<T>::value>
+    struct arithmetic
+    {
+      ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "Samples must be floating point or integral");
+
+      typedef T accumulator_type;
+
+      //*******************************
+      static accumulator_type multiply(T coefficient, T sample)
+      {
+        return coefficient * sample;
+      }
+
+      //*******************************
+      static T to_sample(accumulator_type accumulator)
+      {
+        return accumulator;
+      }
+    };
+
+    //*************************************************************************
+    /// Fixed point arithmetic.
+    /// Coefficients and samples have Fraction_Bits fraction bits, so products
+    /// are accumulated with twice as many in a wider accumulator. The result
+    /// is rounded half away from zero, as etl::round_half_up_unscaled, and
+    /// saturated to the range of T.
+    //*************************************************************************
+    template <typename T, size_t Fraction_Bits>
+    struct arithmetic<T, Fraction_Bits, true>
+    {
+      ETL_STATIC_ASSERT(etl::is_signed<T>::value, "Fixed point samples must be signed");
+      ETL_STATIC_ASSERT((Fraction_Bits > 0U) && (Fraction_Bits < size_t(etl::integral_limits<T>::bits)), "Invalid number of fraction bits");
+
+#if ETL_USING_64BIT_TYPES
+      typedef int64_t accumulator_type;
+#else
+      typedef int32_t accumulator_type;
+#endif
+
+      //*******************************
+      static accumulator_type multiply(T coefficient, T sample)
+      {
+        return accumulator_type(coefficient) * sample;
+      }
+
+      //*******************************
+      static T to_sample(accumulator_type accumulator)
+      {
+        const accumulator_type scale = accumulator_type(1) << Fraction_Bits;
+        const accumulator_type half  = scale / 2;
+
+        const accumulator_type rounded = (accumulator >= 0) ? (accumulator + half) / scale
+                                                            : (accumulator - half) / scale;
+
+        if (rounded > accumulator_type(etl::integral_limits<T>::max))
+        {
+          return etl::integral_limits<T>::max;
+        }
+
+        if (rounded < accumulator_type(etl::integral_limits<T>::min))
+        {
+          return etl::integral_limits<T>::min;
+        }
+
+        return T(rounded);
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,239 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EYTZINGER_INCLUDED
+#define ETL_EYTZINGER_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_eytzinger
+  {
+    //*************************************************************************
+    // Index arithmetic for a complete binary tree stored breadth first.
+    // Indexes are one based, with zero used as the 'end' position.
+    // The element for index k is stored at offset k - 1.
+    //*************************************************************************
+
+    //*************************************************************************
+    /// The index of the smallest element.
+    //*************************************************************************
+    inline ETL_CONSTEXPR14 size_t first(size_t n)
+    {
+      if (n == 0U)
+      {
+        return 0U;
+      }
+
+      size_t k = 1U;
+
+      while ((2U * k) <= n)
+      {
+        k = 2U * k;
+      }
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// The index of the largest element.
+    //*************************************************************************
+    inline ETL_CONSTEXPR14 size_t last(size_t n)
+    {
+      if (n == 0U)
+      {
+        return 0U;
+      }
+
+      size_t k = 1U;
+
+      while (((2U * k) + 1U) <= n)
+      {
+        k = (2U * k) + 1U;
+      }
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// The index of the next larger element, or zero if there is none.
+    //*************************************************************************
+    inline ETL_CONSTEXPR14 size_t next(size_t k, size_t n)
+    {
+      if (((2U * k) + 1U) <= n)
+      {
+        // The smallest element of the right sub-tree.
+        k = (2U * k) + 1U;
+
+        while ((2U * k) <= n)
+        {
+          k = 2U * k;
+        }
+
+        return k;
+      }
+
+      // Climb while this is a right child.
+      while ((k & 1U) != 0U)
+      {
+        k >>= 1U;
+      }
+
+      return k >> 1U;
+    }
+
+    //*************************************************************************
+    /// The index of the next smaller element.
+    /// The element before 'end' is the largest element.
+    //*************************************************************************
+    inline ETL_CONSTEXPR14 size_t previous(size_t k, size_t n)
+    {
+      if (k == 0U)
+      {
+        return last(n);
+      }
+
+      if ((2U * k) <= n)
+      {
+        // The largest element of the left sub-tree.
+        k = 2U * k;
+
+        while (((2U * k) + 1U) <= n)
+        {
+          k = (2U * k) + 1U;
+        }
+
+        return k;
+      }
+
+      // Climb while this is a left child.
+      while ((k & 1U) == 0U)
+      {
+        k >>= 1U;
+      }
+
+      return k >> 1U;
+    }
+
+    //*************************************************************************
+    /// Converts the final position of a descent into the index of the
+    /// element where the descent last went left, or zero if it never did.
+    //*************************************************************************
+    inline ETL_CONSTEXPR14 size_t descent_result(size_t k)
+    {
+      return k >> (etl::count_trailing_ones(k) + 1U);
+    }
+
+    //*************************************************************************
+    /// The index of the first element not less than the key, or zero.
+    /// The loop has no data dependent branches.
+    //*************************************************************************
+    template <typename TElement, typename TKey, typename TCompare>
+    ETL_CONSTEXPR14 size_t lower_bound(const TElement* p_keys, size_t n, const TKey& key, const TCompare& compare)
+    {
+      size_t k = 1U;
+
+      while (k <= n)
+      {
+        k = (2U * k) + static_cast<size_t>(compare(p_keys[k - 1U], key));
+      }
+
+      return descent_result(k);
+    }
+
+    //*************************************************************************
+    /// The index of the first element greater than the key, or zero.
+    /// The loop has no data dependent branches.
+    //*************************************************************************
+    template <typename TElement, typename TKey, typename TCompare>
+    ETL_CONSTEXPR14 size_t upper_bound(const TElement* p_keys, size_t n, const TKey& key, const TCompare& compare)
+    {
+      size_t k = 1U;
+
+      while (k <= n)
+      {
+        k = (2U * k) + static_cast<size_t>(!compare(key, p_keys[k - 1U]));
+      }
+
+      return descent_result(k);
+    }
+
+    //*************************************************************************
+    /// Sorts the indexes of the elements in 'order' by the key of the element
+    /// that they refer to.
+    /// An insertion sort, so that it may be used in constant expressions.
+    //*************************************************************************
+    template <typename TIterator, typename TGetKey, typename TCompare>
+    ETL_CONSTEXPR14 void sort_order(TIterator elements, size_t* order, size_t n, const TGetKey& get_key, const TCompare& compare)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        order[i] = i;
+      }
+
+      for (size_t i = 1U; i < n; ++i)
+      {
+        const size_t index = order[i];
+        size_t       j     = i;
+
+        while ((j > 0U) && compare(get_key(elements[index]), get_key(elements[order[j - 1U]])))
+        {
+          order[j] = order[j - 1U];
+          --j;
+        }
+
+        order[j] = index;
+      }
+    }
+
+    //*************************************************************************
+    /// Checks that no two adjacent sorted keys are equivalent.
+    //*************************************************************************
+    template <typename TIterator, typename TGetKey, typename TCompare>
+    ETL_CONSTEXPR14 bool is_unique(TIterator elements, const size_t* order, size_t n, const TGetKey& get_key, const TCompare& compare)
+    {
+      for (size_t i = 1U; i < n; ++i)
+      {
+        if (!compare(get_key(elements[order[i - 1U]]), get_key(elements[order[i]])))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,210 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_BULK_INSERT_INCLUDED
+#define ETL_FLAT_BULK_INSERT_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../iterator.h"
+#include "../utility.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_flat
+  {
+    //*************************************************************************
+    /// Compares the elements that the lookup pointers refer to.
+    //*************************************************************************
+    template <typename TCompare>
+    class indirect_compare
+    {
+    public:
+
+      explicit indirect_compare(TCompare compare_)
+        : compare(compare_)
+      {
+      }
+
+      template <typename TPointer>
+      bool operator ()(TPointer lhs, TPointer rhs) const
+      {
+        return compare(*lhs, *rhs);
+      }
+
+    private:
+
+      TCompare compare;
+    };
+
+    //*************************************************************************
+    /// Stable merge of the sorted ranges [first, middle) and [middle, last)
+    /// without a buffer, by binary search and rotation.
+    /// Requires random access iterators.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void merge_in_place(TIterator first, TIterator middle, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type length1 = middle - first;
+      const difference_type length2 = last - middle;
+
+      // Nothing to do if the ranges are empty or already in order.
+      if ((length1 == 0) || (length2 == 0) || !compare(*middle, *etl::prev(middle)))
+      {
+        return;
+      }
+
+      if ((length1 + length2) == 2)
+      {
+        if (compare(*middle, *first))
+        {
+          etl::iter_swap(first, middle);
+        }
+
+        return;
+      }
+
+      TIterator cut1;
+      TIterator cut2;
+
+      if (length1 > length2)
+      {
+        cut1 = first + (length1 / 2);
+        cut2 = etl::lower_bound(middle, last, *cut1, compare);
+      }
+      else
+      {
+        cut2 = middle + (length2 / 2);
+        cut1 = etl::upper_bound(first, middle, *cut2, compare);
+      }
+
+      TIterator new_middle;
+
+      if (cut1 == middle)
+      {
+        new_middle = cut2;
+      }
+      else if (cut2 == middle)
+      {
+        new_middle = cut1;
+      }
+      else
+      {
+        // Rotate by three reversals.
+        etl::reverse(cut1, middle);
+        etl::reverse(middle, cut2);
+        etl::reverse(cut1, cut2);
+        new_middle = cut1 + (cut2 - middle);
+      }
+
+      merge_in_place(first, cut1, new_middle, compare);
+      merge_in_place(new_middle, cut2, last, compare);
+    }
+
+    //*************************************************************************
+    /// Stable bottom up merge sort without a buffer.
+    /// O(NlogN) comparisons.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort_in_place(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type length = last - first;
+
+      for (difference_type width = 1; width < length; width *= 2)
+      {
+        for (difference_type start = 0; (start + width) < length; start += (2 * width))
+        {
+          const difference_type end = ((length - start) > (2 * width)) ? start + (2 * width) : length;
+
+          merge_in_place(first + start, first + start + width, first + end, compare);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Merges the elements appended at [middle, last) into the sorted range
+    /// [first, middle), allowing equivalent elements.
+    /// Equivalent elements keep their insertion order.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void merge_equivalent(TIterator first, TIterator middle, TIterator last, TCompare compare, bool is_sorted)
+    {
+      if (!is_sorted)
+      {
+        sort_in_place(middle, last, compare);
+      }
+
+      merge_in_place(first, middle, last, compare);
+    }
+
+    //*************************************************************************
+    /// Merges the elements appended at [middle, last) into the sorted range
+    /// [first, middle), rejecting elements with keys that already exist.
+    /// Of equivalent appended elements, the first is kept.
+    /// The rejected elements are moved to the end of the range.
+    ///\return The start of the rejected elements.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator merge_unique(TIterator first, TIterator middle, TIterator last, TCompare compare, bool is_sorted)
+    {
+      if (!is_sorted)
+      {
+        sort_in_place(middle, last, compare);
+      }
+
+      // Move the duplicates to the end.
+      TIterator kept = middle;
+
+      for (TIterator itr = middle; itr != last; ++itr)
+      {
+        const bool is_duplicate = ((kept != middle) && !compare(*etl::prev(kept), *itr)) ||
+                                  etl::binary_search(first, middle, *itr, compare);
+
+        if (!is_duplicate)
+        {
+          etl::iter_swap(kept, itr);
+          ++kept;
+        }
+      }
+
+      merge_in_place(first, middle, kept, compare);
+
+      return kept;
+    }
+  }
+}
+
+#endif
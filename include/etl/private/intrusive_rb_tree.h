@@ -0,0 +1,1204 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_INTRUSIVE_RB_TREE_INCLUDED
+#define ETL_INTRUSIVE_RB_TREE_INCLUDED
+
+#include "../platform.h"
+#include "../nullptr.h"
+#include "../type_traits.h"
+#include "../intrusive_links.h"
+#include "../iterator.h"
+#include "../utility.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_intrusive_rb_tree
+  {
+    //*************************************************************************
+    /// The red-black tree algorithms shared by the intrusive associative containers.
+    /// The tree has a header link that is never a value.
+    /// The header's parent is the root and the root's parent is the header,
+    /// so every value in the tree reports itself as linked.
+    /// The header is always red and the root is always black, which allows
+    /// an iterator to recognise the header when decrementing from end().
+    //*************************************************************************
+    template <typename TLink>
+    class intrusive_rb_tree_base
+    {
+    public:
+
+      typedef TLink link_type;
+
+      //***********************************************************************
+      /// Unlinks all of the values.
+      //***********************************************************************
+      void clear()
+      {
+        link_type* p_link = get_root();
+
+        // Unlink without recursion by walking down to a leaf, unlinking it, and climbing back up.
+        while (p_link != ETL_NULLPTR)
+        {
+          if (p_link->etl_left != ETL_NULLPTR)
+          {
+            p_link = p_link->etl_left;
+          }
+          else if (p_link->etl_right != ETL_NULLPTR)
+          {
+            p_link = p_link->etl_right;
+          }
+          else
+          {
+            link_type* p_parent = p_link->etl_parent;
+
+            if (p_parent == &header)
+            {
+              p_parent = ETL_NULLPTR;
+            }
+            else if (p_parent->etl_left == p_link)
+            {
+              p_parent->etl_left = ETL_NULLPTR;
+            }
+            else
+            {
+              p_parent->etl_right = ETL_NULLPTR;
+            }
+
+            p_link->clear();
+            p_link = p_parent;
+          }
+        }
+
+        initialise();
+      }
+
+      //***********************************************************************
+      /// Returns true if there are no values.
+      //***********************************************************************
+      bool empty() const
+      {
+        return (current_size == 0U);
+      }
+
+      //***********************************************************************
+      /// Returns the number of values.
+      //***********************************************************************
+      size_t size() const
+      {
+        return current_size;
+      }
+
+      //***********************************************************************
+      /// Gets the successor of a link.
+      /// The successor of the last value is the header.
+      //***********************************************************************
+      static link_type* next(link_type* p_link)
+      {
+        if (p_link->etl_right != ETL_NULLPTR)
+        {
+          return leftmost(p_link->etl_right);
+        }
+
+        link_type* p_parent = p_link->etl_parent;
+
+        while (p_link == p_parent->etl_right)
+        {
+          p_link   = p_parent;
+          p_parent = p_parent->etl_parent;
+        }
+
+        return p_parent;
+      }
+
+      //***********************************************************************
+      /// Gets the successor of a link.
+      //***********************************************************************
+      static const link_type* next(const link_type* p_link)
+      {
+        return next(const_cast<link_type*>(p_link));
+      }
+
+      //***********************************************************************
+      /// Gets the predecessor of a link.
+      /// The predecessor of the header is the last value.
+      //***********************************************************************
+      static link_type* previous(link_type* p_link)
+      {
+        if (is_header(p_link))
+        {
+          return rightmost(p_link->etl_parent);
+        }
+
+        if (p_link->etl_left != ETL_NULLPTR)
+        {
+          return rightmost(p_link->etl_left);
+        }
+
+        link_type* p_parent = p_link->etl_parent;
+
+        while (p_link == p_parent->etl_left)
+        {
+          p_link   = p_parent;
+          p_parent = p_parent->etl_parent;
+        }
+
+        return p_parent;
+      }
+
+      //***********************************************************************
+      /// Gets the predecessor of a link.
+      //***********************************************************************
+      static const link_type* previous(const link_type* p_link)
+      {
+        return previous(const_cast<link_type*>(p_link));
+      }
+
+    protected:
+
+      //***********************************************************************
+      /// Constructor.
+      //***********************************************************************
+      intrusive_rb_tree_base()
+      {
+        initialise();
+      }
+
+      //***********************************************************************
+      /// Destructor.
+      //***********************************************************************
+      ~intrusive_rb_tree_base()
+      {
+        clear();
+      }
+
+      //***********************************************************************
+      /// Initialises the tree.
+      //***********************************************************************
+      void initialise()
+      {
+        header.etl_parent = ETL_NULLPTR;
+        header.etl_left   = ETL_NULLPTR;
+        header.etl_right  = ETL_NULLPTR;
+        header.etl_red    = true;
+        current_size      = 0U;
+      }
+
+      //***********************************************************************
+      /// Gets the root, or ETL_NULLPTR if empty.
+      //***********************************************************************
+      link_type* get_root() const
+      {
+        return header.etl_parent;
+      }
+
+      //***********************************************************************
+      /// Gets the header, which is the end position.
+      //***********************************************************************
+      link_type* get_header()
+      {
+        return &header;
+      }
+
+      //***********************************************************************
+      /// Gets the header, which is the end position.
+      //***********************************************************************
+      const link_type* get_header() const
+      {
+        return &header;
+      }
+
+      //***********************************************************************
+      /// Gets the first link, or the header if empty.
+      //***********************************************************************
+      link_type* get_first() const
+      {
+        link_type* p_root = get_root();
+
+        return (p_root == ETL_NULLPTR) ? const_cast<link_type*>(&header) : leftmost(p_root);
+      }
+
+      //***********************************************************************
+      /// Links a new leaf as a child of p_parent and rebalances the tree.
+      /// If p_parent is the header then the link becomes the root.
+      //***********************************************************************
+      void insert_link(link_type* p_parent, link_type& link, bool insert_left)
+      {
+        link_type* p_link = &link;
+
+        p_link->etl_parent = p_parent;
+        p_link->etl_left   = ETL_NULLPTR;
+        p_link->etl_right  = ETL_NULLPTR;
+        p_link->etl_red    = true;
+
+        if (p_parent == &header)
+        {
+          header.etl_parent = p_link;
+        }
+        else if (insert_left)
+        {
+          p_parent->etl_left = p_link;
+        }
+        else
+        {
+          p_parent->etl_right = p_link;
+        }
+
+        // Restore the red-black properties.
+        while ((p_link != get_root()) && p_link->etl_parent->etl_red)
+        {
+          link_type* p_grandparent = p_link->etl_parent->etl_parent;
+
+          if (p_link->etl_parent == p_grandparent->etl_left)
+          {
+            link_type* p_uncle = p_grandparent->etl_right;
+
+            if (is_red(p_uncle))
+            {
+              p_link->etl_parent->etl_red = false;
+              p_uncle->etl_red            = false;
+              p_grandparent->etl_red      = true;
+              p_link                      = p_grandparent;
+            }
+            else
+            {
+              if (p_link == p_link->etl_parent->etl_right)
+              {
+                p_link = p_link->etl_parent;
+                rotate_left(p_link);
+              }
+
+              p_link->etl_parent->etl_red = false;
+              p_grandparent->etl_red      = true;
+              rotate_right(p_grandparent);
+            }
+          }
+          else
+          {
+            link_type* p_uncle = p_grandparent->etl_left;
+
+            if (is_red(p_uncle))
+            {
+              p_link->etl_parent->etl_red = false;
+              p_uncle->etl_red            = false;
+              p_grandparent->etl_red      = true;
+              p_link                      = p_grandparent;
+            }
+            else
+            {
+              if (p_link == p_link->etl_parent->etl_left)
+              {
+                p_link = p_link->etl_parent;
+                rotate_right(p_link);
+              }
+
+              p_link->etl_parent->etl_red = false;
+              p_grandparent->etl_red      = true;
+              rotate_left(p_grandparent);
+            }
+          }
+        }
+
+        get_root()->etl_red = false;
+        ++current_size;
+      }
+
+      //***********************************************************************
+      /// Unlinks a link from the tree and rebalances the tree.
+      //***********************************************************************
+      void remove_link(link_type& link)
+      {
+        link_type* p_remove   = &link;
+        link_type* p_spliced  = p_remove; // The link that is physically removed from its position.
+        link_type* p_child    = ETL_NULLPTR;
+        link_type* p_parent   = ETL_NULLPTR;
+
+        if (p_spliced->etl_left == ETL_NULLPTR)
+        {
+          p_child = p_spliced->etl_right;
+        }
+        else if (p_spliced->etl_right == ETL_NULLPTR)
+        {
+          p_child = p_spliced->etl_left;
+        }
+        else
+        {
+          p_spliced = leftmost(p_spliced->etl_right);
+          p_child   = p_spliced->etl_right;
+        }
+
+        bool removed_red;
+
+        if (p_spliced != p_remove)
+        {
+          // The successor takes the place of the removed link.
+          p_remove->etl_left->etl_parent = p_spliced;
+          p_spliced->etl_left = p_remove->etl_left;
+
+          if (p_spliced != p_remove->etl_right)
+          {
+            p_parent = p_spliced->etl_parent;
+
+            if (p_child != ETL_NULLPTR)
+            {
+              p_child->etl_parent = p_parent;
+            }
+
+            p_parent->etl_left = p_child;
+            p_spliced->etl_right = p_remove->etl_right;
+            p_remove->etl_right->etl_parent = p_spliced;
+          }
+          else
+          {
+            p_parent = p_spliced;
+          }
+
+          replace_child(p_remove, p_spliced);
+          p_spliced->etl_parent = p_remove->etl_parent;
+
+          removed_red = p_spliced->etl_red;
+          p_spliced->etl_red = p_remove->etl_red;
+        }
+        else
+        {
+          p_parent = p_remove->etl_parent;
+
+          if (p_child != ETL_NULLPTR)
+          {
+            p_child->etl_parent = p_parent;
+          }
+
+          replace_child(p_remove, p_child);
+
+          removed_red = p_remove->etl_red;
+        }
+
+        // Restore the red-black properties if a black link was removed.
+        if (!removed_red)
+        {
+          while ((p_child != get_root()) && !is_red(p_child))
+          {
+            if (p_child == p_parent->etl_left)
+            {
+              link_type* p_sibling = p_parent->etl_right;
+
+              if (p_sibling->etl_red)
+              {
+                p_sibling->etl_red = false;
+                p_parent->etl_red  = true;
+                rotate_left(p_parent);
+                p_sibling = p_parent->etl_right;
+              }
+
+              if (!is_red(p_sibling->etl_left) && !is_red(p_sibling->etl_right))
+              {
+                p_sibling->etl_red = true;
+                p_child  = p_parent;
+                p_parent = p_parent->etl_parent;
+              }
+              else
+              {
+                if (!is_red(p_sibling->etl_right))
+                {
+                  p_sibling->etl_left->etl_red = false;
+                  p_sibling->etl_red = true;
+                  rotate_right(p_sibling);
+                  p_sibling = p_parent->etl_right;
+                }
+
+                p_sibling->etl_red = p_parent->etl_red;
+                p_parent->etl_red  = false;
+
+                if (p_sibling->etl_right != ETL_NULLPTR)
+                {
+                  p_sibling->etl_right->etl_red = false;
+                }
+
+                rotate_left(p_parent);
+                break;
+              }
+            }
+            else
+            {
+              link_type* p_sibling = p_parent->etl_left;
+
+              if (p_sibling->etl_red)
+              {
+                p_sibling->etl_red = false;
+                p_parent->etl_red  = true;
+                rotate_right(p_parent);
+                p_sibling = p_parent->etl_left;
+              }
+
+              if (!is_red(p_sibling->etl_right) && !is_red(p_sibling->etl_left))
+              {
+                p_sibling->etl_red = true;
+                p_child  = p_parent;
+                p_parent = p_parent->etl_parent;
+              }
+              else
+              {
+                if (!is_red(p_sibling->etl_left))
+                {
+                  p_sibling->etl_right->etl_red = false;
+                  p_sibling->etl_red = true;
+                  rotate_left(p_sibling);
+                  p_sibling = p_parent->etl_left;
+                }
+
+                p_sibling->etl_red = p_parent->etl_red;
+                p_parent->etl_red  = false;
+
+                if (p_sibling->etl_left != ETL_NULLPTR)
+                {
+                  p_sibling->etl_left->etl_red = false;
+                }
+
+                rotate_right(p_parent);
+                break;
+              }
+            }
+          }
+
+          if (p_child != ETL_NULLPTR)
+          {
+            p_child->etl_red = false;
+          }
+        }
+
+        p_remove->clear();
+        --current_size;
+      }
+
+      //***********************************************************************
+      /// Gets the leftmost link in a subtree.
+      //***********************************************************************
+      static link_type* leftmost(link_type* p_link)
+      {
+        while (p_link->etl_left != ETL_NULLPTR)
+        {
+          p_link = p_link->etl_left;
+        }
+
+        return p_link;
+      }
+
+      //***********************************************************************
+      /// Gets the rightmost link in a subtree.
+      //***********************************************************************
+      static link_type* rightmost(link_type* p_link)
+      {
+        while (p_link->etl_right != ETL_NULLPTR)
+        {
+          p_link = p_link->etl_right;
+        }
+
+        return p_link;
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Is the link a header?
+      /// Only the header is red and is the parent of its own parent.
+      //***********************************************************************
+      static bool is_header(const link_type* p_link)
+      {
+        return p_link->etl_red &&
+               (p_link->etl_parent != ETL_NULLPTR) &&
+               (p_link->etl_parent->etl_parent == p_link);
+      }
+
+      //***********************************************************************
+      /// Missing links are black.
+      //***********************************************************************
+      static bool is_red(const link_type* p_link)
+      {
+        return (p_link != ETL_NULLPTR) && p_link->etl_red;
+      }
+
+      //***********************************************************************
+      /// Makes p_new take the place of p_old in p_old's parent.
+      //***********************************************************************
+      void replace_child(link_type* p_old, link_type* p_new)
+      {
+        link_type* p_parent = p_old->etl_parent;
+
+        if (p_parent == &header)
+        {
+          header.etl_parent = p_new;
+        }
+        else if (p_parent->etl_left == p_old)
+        {
+          p_parent->etl_left = p_new;
+        }
+        else
+        {
+          p_parent->etl_right = p_new;
+        }
+      }
+
+      //***********************************************************************
+      void rotate_left(link_type* p_link)
+      {
+        link_type* p_pivot = p_link->etl_right;
+
+        p_link->etl_right = p_pivot->etl_left;
+
+        if (p_pivot->etl_left != ETL_NULLPTR)
+        {
+          p_pivot->etl_left->etl_parent = p_link;
+        }
+
+        replace_child(p_link, p_pivot);
+        p_pivot->etl_parent = p_link->etl_parent;
+        p_pivot->etl_left   = p_link;
+        p_link->etl_parent  = p_pivot;
+      }
+
+      //***********************************************************************
+      void rotate_right(link_type* p_link)
+      {
+        link_type* p_pivot = p_link->etl_left;
+
+        p_link->etl_left = p_pivot->etl_right;
+
+        if (p_pivot->etl_right != ETL_NULLPTR)
+        {
+          p_pivot->etl_right->etl_parent = p_link;
+        }
+
+        replace_child(p_link, p_pivot);
+        p_pivot->etl_parent = p_link->etl_parent;
+        p_pivot->etl_right  = p_link;
+        p_link->etl_parent  = p_pivot;
+      }
+
+      link_type header;     ///< The link that acts as the parent of the root and as the end position.
+      size_t current_size;  ///< Counts the number of values in the tree.
+    };
+
+    //*************************************************************************
+    /// Gets the key from a value that is its own key.
+    //*************************************************************************
+    template <typename TValue>
+    struct value_is_key
+    {
+      const TValue& operator()(const TValue& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// A red-black tree of values with unique keys.
+    ///\tparam TValue      The value type. TLink must be a base of TValue.
+    ///\tparam TLink       The rb_tree_link type.
+    ///\tparam TKey        The key type.
+    ///\tparam TKeyOfValue Functor that gets the key of a value.
+    ///\tparam TKeyCompare Functor that compares keys.
+    //*************************************************************************
+    template <typename TValue, typename TLink, typename TKey, typename TKeyOfValue, typename TKeyCompare>
+    class intrusive_rb_tree : public intrusive_rb_tree_base<TLink>
+    {
+    public:
+
+      typedef intrusive_rb_tree_base<TLink> base_t;
+
+      typedef typename base_t::link_type link_type;
+
+      typedef TKey              key_type;
+      typedef TValue            value_type;
+      typedef TKeyCompare       key_compare;
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+      typedef size_t            size_type;
+
+      //***********************************************************************
+      /// iterator.
+      //***********************************************************************
+      class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+      {
+      public:
+
+        friend class intrusive_rb_tree;
+        friend class const_iterator;
+
+        iterator()
+          : p_value(ETL_NULLPTR)
+        {
+        }
+
+        iterator(const iterator& other)
+          : p_value(other.p_value)
+        {
+        }
+
+        iterator& operator ++()
+        {
+          p_value = base_t::next(p_value);
+          return *this;
+        }
+
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          p_value = base_t::next(p_value);
+          return temp;
+        }
+
+        iterator& operator --()
+        {
+          p_value = base_t::previous(p_value);
+          return *this;
+        }
+
+        iterator operator --(int)
+        {
+          iterator temp(*this);
+          p_value = base_t::previous(p_value);
+          return temp;
+        }
+
+        iterator& operator =(const iterator& other)
+        {
+          p_value = other.p_value;
+          return *this;
+        }
+
+        reference operator *() const
+        {
+#include "diagnostic_null_dereference_push.h"
+          return *static_cast<pointer>(p_value);
+#include "diagnostic_pop.h"
+        }
+
+        pointer operator &() const
+        {
+          return static_cast<pointer>(p_value);
+        }
+
+        pointer operator ->() const
+        {
+          return static_cast<pointer>(p_value);
+        }
+
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.p_value == rhs.p_value;
+        }
+
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        iterator(link_type* value)
+          : p_value(value)
+        {
+        }
+
+        link_type* p_value;
+      };
+
+      //***********************************************************************
+      /// const_iterator
+      //***********************************************************************
+      class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+      {
+      public:
+
+        friend class intrusive_rb_tree;
+
+        const_iterator()
+          : p_value(ETL_NULLPTR)
+        {
+        }
+
+        const_iterator(const typename intrusive_rb_tree::iterator& other)
+          : p_value(other.p_value)
+        {
+        }
+
+        const_iterator(const const_iterator& other)
+          : p_value(other.p_value)
+        {
+        }
+
+        const_iterator& operator ++()
+        {
+          p_value = base_t::next(p_value);
+          return *this;
+        }
+
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          p_value = base_t::next(p_value);
+          return temp;
+        }
+
+        const_iterator& operator --()
+        {
+          p_value = base_t::previous(p_value);
+          return *this;
+        }
+
+        const_iterator operator --(int)
+        {
+          const_iterator temp(*this);
+          p_value = base_t::previous(p_value);
+          return temp;
+        }
+
+        const_iterator& operator =(const const_iterator& other)
+        {
+          p_value = other.p_value;
+          return *this;
+        }
+
+        const_reference operator *() const
+        {
+          return *static_cast<const value_type*>(p_value);
+        }
+
+        const_pointer operator &() const
+        {
+          return static_cast<const value_type*>(p_value);
+        }
+
+        const_pointer operator ->() const
+        {
+          return static_cast<const value_type*>(p_value);
+        }
+
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return lhs.p_value == rhs.p_value;
+        }
+
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        const_iterator(const link_type* value)
+          : p_value(value)
+        {
+        }
+
+        const link_type* p_value;
+      };
+
+      typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+      typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+      typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+      //***********************************************************************
+      /// Gets the beginning.
+      //***********************************************************************
+      iterator begin()
+      {
+        return iterator(this->get_first());
+      }
+
+      //***********************************************************************
+      /// Gets the beginning.
+      //***********************************************************************
+      const_iterator begin() const
+      {
+        return const_iterator(this->get_first());
+      }
+
+      //***********************************************************************
+      /// Gets the beginning.
+      //***********************************************************************
+      const_iterator cbegin() const
+      {
+        return const_iterator(this->get_first());
+      }
+
+      //***********************************************************************
+      /// Gets the end.
+      //***********************************************************************
+      iterator end()
+      {
+        return iterator(this->get_header());
+      }
+
+      //***********************************************************************
+      /// Gets the end.
+      //***********************************************************************
+      const_iterator end() const
+      {
+        return const_iterator(this->get_header());
+      }
+
+      //***********************************************************************
+      /// Gets the end.
+      //***********************************************************************
+      const_iterator cend() const
+      {
+        return const_iterator(this->get_header());
+      }
+
+      //***********************************************************************
+      /// Gets the reverse beginning.
+      //***********************************************************************
+      reverse_iterator rbegin()
+      {
+        return reverse_iterator(end());
+      }
+
+      //***********************************************************************
+      /// Gets the reverse beginning.
+      //***********************************************************************
+      const_reverse_iterator rbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //***********************************************************************
+      /// Gets the reverse beginning.
+      //***********************************************************************
+      const_reverse_iterator crbegin() const
+      {
+        return const_reverse_iterator(cend());
+      }
+
+      //***********************************************************************
+      /// Gets the reverse end.
+      //***********************************************************************
+      reverse_iterator rend()
+      {
+        return reverse_iterator(begin());
+      }
+
+      //***********************************************************************
+      /// Gets the reverse end.
+      //***********************************************************************
+      const_reverse_iterator rend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //***********************************************************************
+      /// Gets the reverse end.
+      //***********************************************************************
+      const_reverse_iterator crend() const
+      {
+        return const_reverse_iterator(cbegin());
+      }
+
+      //***********************************************************************
+      /// Erases the value at the position.
+      /// Returns an iterator to the next value.
+      //***********************************************************************
+      iterator erase(iterator position)
+      {
+        link_type* p_next = base_t::next(position.p_value);
+        this->remove_link(*position.p_value);
+
+        return iterator(p_next);
+      }
+
+      //***********************************************************************
+      /// Erases the value at the position.
+      /// Returns an iterator to the next value.
+      //***********************************************************************
+      iterator erase(const_iterator position)
+      {
+        return erase(iterator(const_cast<link_type*>(position.p_value)));
+      }
+
+      //***********************************************************************
+      /// Erases a range of values.
+      //***********************************************************************
+      iterator erase(const_iterator first, const_iterator last)
+      {
+        iterator i_first(const_cast<link_type*>(first.p_value));
+        iterator i_last(const_cast<link_type*>(last.p_value));
+
+        while (i_first != i_last)
+        {
+          i_first = erase(i_first);
+        }
+
+        return i_last;
+      }
+
+      //***********************************************************************
+      /// Erases the value with the key.
+      /// Returns the number of values erased.
+      //***********************************************************************
+      size_t erase(const key_type& key)
+      {
+        iterator i_value = find(key);
+
+        if (i_value == end())
+        {
+          return 0U;
+        }
+
+        erase(i_value);
+
+        return 1U;
+      }
+
+      //***********************************************************************
+      /// Finds the value with the key.
+      //***********************************************************************
+      iterator find(const key_type& key)
+      {
+        return iterator(find_link(key));
+      }
+
+      //***********************************************************************
+      /// Finds the value with the key.
+      //***********************************************************************
+      const_iterator find(const key_type& key) const
+      {
+        return const_iterator(find_link(key));
+      }
+
+      //***********************************************************************
+      /// Gets the first value whose key is not less than the key.
+      //***********************************************************************
+      iterator lower_bound(const key_type& key)
+      {
+        return iterator(lower_bound_link(key));
+      }
+
+      //***********************************************************************
+      /// Gets the first value whose key is not less than the key.
+      //***********************************************************************
+      const_iterator lower_bound(const key_type& key) const
+      {
+        return const_iterator(lower_bound_link(key));
+      }
+
+      //***********************************************************************
+      /// Gets the first value whose key is greater than the key.
+      //***********************************************************************
+      iterator upper_bound(const key_type& key)
+      {
+        return iterator(upper_bound_link(key));
+      }
+
+      //***********************************************************************
+      /// Gets the first value whose key is greater than the key.
+      //***********************************************************************
+      const_iterator upper_bound(const key_type& key) const
+      {
+        return const_iterator(upper_bound_link(key));
+      }
+
+      //***********************************************************************
+      /// Gets the range of values with the key.
+      //***********************************************************************
+      ETL_OR_STD::pair<iterator, iterator> equal_range(const key_type& key)
+      {
+        return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+      }
+
+      //***********************************************************************
+      /// Gets the range of values with the key.
+      //***********************************************************************
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+      {
+        return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+      }
+
+      //***********************************************************************
+      /// Counts the values with the key.
+      //***********************************************************************
+      size_t count(const key_type& key) const
+      {
+        return contains(key) ? 1U : 0U;
+      }
+
+      //***********************************************************************
+      /// Checks for a value with the key.
+      //***********************************************************************
+      bool contains(const key_type& key) const
+      {
+        return find_link(key) != this->get_header();
+      }
+
+      //***********************************************************************
+      /// Gets the key comparison functor.
+      //***********************************************************************
+      key_compare key_comp() const
+      {
+        return key_compare();
+      }
+
+    protected:
+
+      //***********************************************************************
+      /// Constructor.
+      //***********************************************************************
+      intrusive_rb_tree()
+      {
+      }
+
+      //***********************************************************************
+      /// Destructor.
+      //***********************************************************************
+      ~intrusive_rb_tree()
+      {
+      }
+
+      //***********************************************************************
+      /// Links the value if no other value has the same key.
+      //***********************************************************************
+      ETL_OR_STD::pair<iterator, bool> insert_unique(value_type& value)
+      {
+        const link_type* p_header = this->get_header();
+        link_type* p_parent = const_cast<link_type*>(p_header);
+        link_type* p_link   = this->get_root();
+        link_type* p_lower  = ETL_NULLPTR; // The greatest link not greater than the value.
+        bool insert_left    = true;
+
+        while (p_link != ETL_NULLPTR)
+        {
+          p_parent    = p_link;
+          insert_left = compare(TKeyOfValue()(value), TKeyOfValue()(value_of(*p_link)));
+
+          if (insert_left)
+          {
+            p_link = p_link->etl_left;
+          }
+          else
+          {
+            p_lower = p_link;
+            p_link  = p_link->etl_right;
+          }
+        }
+
+        if ((p_lower != ETL_NULLPTR) && !compare(TKeyOfValue()(value_of(*p_lower)), TKeyOfValue()(value)))
+        {
+          return ETL_OR_STD::make_pair(iterator(p_lower), false);
+        }
+
+        this->insert_link(p_parent, value, insert_left);
+
+        return ETL_OR_STD::make_pair(iterator(&value), true);
+      }
+
+    private:
+
+      //***********************************************************************
+      static bool compare(const key_type& lhs, const key_type& rhs)
+      {
+        return key_compare()(lhs, rhs);
+      }
+
+      //***********************************************************************
+      static const value_type& value_of(const link_type& link)
+      {
+        return static_cast<const value_type&>(link);
+      }
+
+      //***********************************************************************
+      link_type* lower_bound_link(const key_type& key) const
+      {
+        link_type* p_result = const_cast<link_type*>(this->get_header());
+        link_type* p_link   = this->get_root();
+
+        while (p_link != ETL_NULLPTR)
+        {
+          if (!compare(TKeyOfValue()(value_of(*p_link)), key))
+          {
+            p_result = p_link;
+            p_link   = p_link->etl_left;
+          }
+          else
+          {
+            p_link = p_link->etl_right;
+          }
+        }
+
+        return p_result;
+      }
+
+      //***********************************************************************
+      link_type* upper_bound_link(const key_type& key) const
+      {
+        link_type* p_result = const_cast<link_type*>(this->get_header());
+        link_type* p_link   = this->get_root();
+
+        while (p_link != ETL_NULLPTR)
+        {
+          if (compare(key, TKeyOfValue()(value_of(*p_link))))
+          {
+            p_result = p_link;
+            p_link   = p_link->etl_left;
+          }
+          else
+          {
+            p_link = p_link->etl_right;
+          }
+        }
+
+        return p_result;
+      }
+
+      //***********************************************************************
+      link_type* find_link(const key_type& key) const
+      {
+        link_type* p_link = lower_bound_link(key);
+
+        if ((p_link != this->get_header()) && compare(key, TKeyOfValue()(value_of(*p_link))))
+        {
+          p_link = const_cast<link_type*>(this->get_header());
+        }
+
+        return p_link;
+      }
+
+      // Disabled.
+      intrusive_rb_tree(const intrusive_rb_tree& other);
+      intrusive_rb_tree& operator = (const intrusive_rb_tree& rhs);
+    };
+  }
+}
+
+#endif
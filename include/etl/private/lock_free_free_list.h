@@ -0,0 +1,167 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LOCK_FREE_FREE_LIST_INCLUDED
+#define ETL_LOCK_FREE_FREE_LIST_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  namespace private_lock_free
+  {
+    //*************************************************************************
+    /// A lock free stack of free item indexes (a Treiber stack).
+    /// The head holds the index of the top item and a tag that changes on
+    /// every push and pop, which guards against the ABA problem.
+    /// Both fit into 32 bits so that only single word atomics are required,
+    /// which limits the list to 65534 items.
+    /// The links are held in an external array, one per item.
+    //*************************************************************************
+    class free_list
+    {
+    public:
+
+      enum
+      {
+        Nil       = 0xFFFF, ///< The index returned when the list is empty.
+        Max_Items = 0xFFFE  ///< The maximum number of items.
+      };
+
+      //***********************************************************************
+      /// Constructor.
+      /// The links may not be constructed yet, so initialise() must be
+      /// called before the list is used.
+      /// \param p_next_ The links. One per item.
+      /// \param size_   The number of items.
+      //***********************************************************************
+      free_list(etl::atomic<uint16_t>* p_next_, size_t size_)
+        : p_next(p_next_)
+        , size(size_)
+      {
+        head.store(static_cast<uint32_t>(Nil), etl::memory_order_relaxed);
+      }
+
+      //***********************************************************************
+      /// Makes all of the items free.
+      /// Must not be called while the list is in use.
+      //***********************************************************************
+      void initialise()
+      {
+        for (size_t i = 0U; (i + 1U) < size; ++i)
+        {
+          p_next[i].store(static_cast<uint16_t>(i + 1U), etl::memory_order_relaxed);
+        }
+
+        if (size != 0U)
+        {
+          p_next[size - 1U].store(static_cast<uint16_t>(Nil), etl::memory_order_relaxed);
+          head.store(0U, etl::memory_order_release);
+        }
+      }
+
+      //***********************************************************************
+      /// Pops a free item.
+      /// Returns Nil if there are none.
+      //***********************************************************************
+      uint16_t pop()
+      {
+        uint32_t old_head = head.load(etl::memory_order_acquire);
+        uint32_t new_head;
+        uint16_t index;
+
+        do
+        {
+          index = get_index(old_head);
+
+          if (index == Nil)
+          {
+            return static_cast<uint16_t>(Nil);
+          }
+
+          new_head = make_head(old_head, p_next[index].load(etl::memory_order_relaxed));
+        } while (!head.compare_exchange_weak(old_head, new_head, etl::memory_order_acq_rel, etl::memory_order_acquire));
+
+        return index;
+      }
+
+      //***********************************************************************
+      /// Pushes a free item.
+      //***********************************************************************
+      void push(uint16_t index)
+      {
+        uint32_t old_head = head.load(etl::memory_order_relaxed);
+        uint32_t new_head;
+
+        do
+        {
+          p_next[index].store(get_index(old_head), etl::memory_order_relaxed);
+          new_head = make_head(old_head, index);
+        } while (!head.compare_exchange_weak(old_head, new_head, etl::memory_order_release, etl::memory_order_relaxed));
+      }
+
+    private:
+
+      //***********************************************************************
+      /// The index of the top item in a head.
+      //***********************************************************************
+      static uint16_t get_index(uint32_t value)
+      {
+        return static_cast<uint16_t>(value & 0xFFFFU);
+      }
+
+      //***********************************************************************
+      /// A new head with the index and the next tag.
+      //***********************************************************************
+      static uint32_t make_head(uint32_t old_head, uint16_t index)
+      {
+        return ((old_head + 0x10000U) & 0xFFFF0000U) | index;
+      }
+
+      // Should not be copied.
+      free_list(const free_list&) ETL_DELETE;
+      free_list& operator =(const free_list&) ETL_DELETE;
+
+      etl::atomic<uint16_t>* p_next; ///< The next free item, for each item in the list.
+      const size_t           size;   ///< The number of items.
+      etl::atomic<uint32_t>  head;   ///< The tag and index of the top of the list.
+    };
+  }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,105 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SPARSE_ID_TABLE_INCLUDED
+#define ETL_SPARSE_ID_TABLE_INCLUDED
+
+#include "../platform.h"
+#include "../static_assert.h"
+
+#include <stddef.h>
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  namespace private_sparse_id_table
+  {
+    //*************************************************************************
+    /// A sorted table of ids, fixed at compile time.
+    /// Maps an id to its position in the table.
+    /// Users should check is_ascending() with a static assert.
+    //*************************************************************************
+    template <size_t... Ids>
+    struct id_table
+    {
+      static ETL_CONSTANT size_t Size = sizeof...(Ids);
+
+      static constexpr size_t ids[Size] = { Ids... };
+
+      //***********************************************************************
+      /// Are ids [i, Size) in strictly ascending order?
+      //***********************************************************************
+      static constexpr bool is_ascending(size_t i = 1U)
+      {
+        return (i >= Size) ? true : ((ids[i - 1U] < ids[i]) && is_ascending(i + 1U));
+      }
+
+      //***********************************************************************
+      /// The position of the id, found at compile time.
+      /// Returns Size if the id is not in the table.
+      //***********************************************************************
+      static constexpr size_t index_of_id(size_t id, size_t i = 0U)
+      {
+        return (i == Size) ? Size : ((ids[i] == id) ? i : index_of_id(id, i + 1U));
+      }
+
+      //***********************************************************************
+      /// The position of the id, found by a binary search in which the only
+      /// branch is the loop, which runs log2(Size) times for any id.
+      /// Returns Size if the id is not in the table.
+      //***********************************************************************
+      static size_t index_of(size_t id)
+      {
+        const size_t* p_first = ids;
+        size_t        count   = Size;
+
+        while (count > 1U)
+        {
+          const size_t half = count / 2U;
+
+          p_first += (p_first[half] <= id) ? half : 0U;
+          count   -= half;
+        }
+
+        return (*p_first == id) ? static_cast<size_t>(p_first - ids) : Size;
+      }
+    };
+
+    template <size_t... Ids>
+    ETL_CONSTANT size_t id_table<Ids...>::Size;
+
+    template <size_t... Ids>
+    constexpr size_t id_table<Ids...>::ids[];
+  }
+}
+
+#endif
+#endif
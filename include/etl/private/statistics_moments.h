@@ -0,0 +1,515 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATISTICS_MOMENTS_INCLUDED
+#define ETL_STATISTICS_MOMENTS_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_statistics
+  {
+    //*************************************************************************
+    /// The counts, means and sums of squared deviations for one variable.
+    /// Integral calculation types keep exact sums of values and squares.
+    /// Floating point calculation types use Welford's running update and
+    /// Chan's formula to merge, which avoid the cancellation of the sums.
+    //*************************************************************************
+    template <typename TCalc, bool Is_Floating = etl::is_floating_point<TCalc>::value>
+    class moments;
+
+    //*************************************************************************
+    /// Exact sums for integral calculation types.
+    //*************************************************************************
+    template <typename TCalc>
+    class moments<TCalc, false>
+    {
+    public:
+
+      moments()
+      {
+        clear();
+      }
+
+      //*********************************
+      template <typename TInput>
+      void add(TInput value)
+      {
+        sum_of_squares += TCalc(value * value);
+        sum            += TCalc(value);
+        ++counter;
+      }
+
+      //*********************************
+      template <typename TInput>
+      void add(const TInput* p_values, size_t n)
+      {
+        TCalc batch_sum            = TCalc(0);
+        TCalc batch_sum_of_squares = TCalc(0);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          batch_sum            += TCalc(p_values[i]);
+          batch_sum_of_squares += TCalc(p_values[i] * p_values[i]);
+        }
+
+        sum            += batch_sum;
+        sum_of_squares += batch_sum_of_squares;
+        counter        += uint32_t(n);
+      }
+
+      //*********************************
+      void merge(const moments& other)
+      {
+        sum            += other.sum;
+        sum_of_squares += other.sum_of_squares;
+        counter        += other.counter;
+      }
+
+      //*********************************
+      void clear()
+      {
+        sum            = TCalc(0);
+        sum_of_squares = TCalc(0);
+        counter        = 0U;
+      }
+
+      //*********************************
+      uint32_t count() const
+      {
+        return counter;
+      }
+
+      //*********************************
+      /// The sum of the squared deviations from the mean.
+      //*********************************
+      double squared_deviations() const
+      {
+        const double n = double(counter);
+        const double s = double(sum);
+
+        return (counter == 0U) ? 0.0 : ((n * double(sum_of_squares)) - (s * s)) / n;
+      }
+
+    private:
+
+      TCalc    sum;
+      TCalc    sum_of_squares;
+      uint32_t counter;
+    };
+
+    //*************************************************************************
+    /// Welford and Chan for floating point calculation types.
+    //*************************************************************************
+    template <typename TCalc>
+    class moments<TCalc, true>
+    {
+    public:
+
+      moments()
+      {
+        clear();
+      }
+
+      //*********************************
+      template <typename TInput>
+      void add(TInput value)
+      {
+        const TCalc x = TCalc(value);
+
+        ++counter;
+
+        const TCalc delta = x - mean;
+        mean += delta / TCalc(counter);
+        m2   += delta * (x - mean);
+      }
+
+      //*********************************
+      /// Two passes over the batch give its mean and squared deviations,
+      /// which are then merged.
+      //*********************************
+      template <typename TInput>
+      void add(const TInput* p_values, size_t n)
+      {
+        if (n == 0U)
+        {
+          return;
+        }
+
+        TCalc batch_sum = TCalc(0);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          batch_sum += TCalc(p_values[i]);
+        }
+
+        const TCalc batch_mean = batch_sum / TCalc(n);
+
+        TCalc batch_m2 = TCalc(0);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const TCalc delta = TCalc(p_values[i]) - batch_mean;
+          batch_m2 += delta * delta;
+        }
+
+        merge(uint32_t(n), batch_mean, batch_m2);
+      }
+
+      //*********************************
+      void merge(const moments& other)
+      {
+        merge(other.counter, other.mean, other.m2);
+      }
+
+      //*********************************
+      void clear()
+      {
+        mean    = TCalc(0);
+        m2      = TCalc(0);
+        counter = 0U;
+      }
+
+      //*********************************
+      uint32_t count() const
+      {
+        return counter;
+      }
+
+      //*********************************
+      /// The sum of the squared deviations from the mean.
+      //*********************************
+      double squared_deviations() const
+      {
+        return double(m2);
+      }
+
+    private:
+
+      //*********************************
+      void merge(uint32_t other_count, TCalc other_mean, TCalc other_m2)
+      {
+        if (other_count == 0U)
+        {
+          return;
+        }
+
+        const TCalc n_a   = TCalc(counter);
+        const TCalc n_b   = TCalc(other_count);
+        const TCalc n     = n_a + n_b;
+        const TCalc delta = other_mean - mean;
+
+        mean    += delta * (n_b / n);
+        m2      += other_m2 + (delta * delta * ((n_a * n_b) / n));
+        counter += other_count;
+      }
+
+      TCalc    mean;
+      TCalc    m2;
+      uint32_t counter;
+    };
+
+    //*************************************************************************
+    /// The counts, means, sums of squared deviations and sum of the products
+    /// of the deviations for two variables.
+    //*************************************************************************
+    template <typename TCalc, bool Is_Floating = etl::is_floating_point<TCalc>::value>
+    class co_moments;
+
+    //*************************************************************************
+    /// Exact sums for integral calculation types.
+    //*************************************************************************
+    template <typename TCalc>
+    class co_moments<TCalc, false>
+    {
+    public:
+
+      co_moments()
+      {
+        clear();
+      }
+
+      //*********************************
+      template <typename TInput>
+      void add(TInput value1, TInput value2)
+      {
+        inner_product   += TCalc(value1 * value2);
+        sum_of_squares1 += TCalc(value1 * value1);
+        sum_of_squares2 += TCalc(value2 * value2);
+        sum1            += TCalc(value1);
+        sum2            += TCalc(value2);
+        ++counter;
+      }
+
+      //*********************************
+      template <typename TInput>
+      void add(const TInput* p_values1, const TInput* p_values2, size_t n)
+      {
+        co_moments batch;
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          batch.inner_product   += TCalc(p_values1[i] * p_values2[i]);
+          batch.sum_of_squares1 += TCalc(p_values1[i] * p_values1[i]);
+          batch.sum_of_squares2 += TCalc(p_values2[i] * p_values2[i]);
+          batch.sum1            += TCalc(p_values1[i]);
+          batch.sum2            += TCalc(p_values2[i]);
+        }
+
+        batch.counter = uint32_t(n);
+
+        merge(batch);
+      }
+
+      //*********************************
+      void merge(const co_moments& other)
+      {
+        inner_product   += other.inner_product;
+        sum_of_squares1 += other.sum_of_squares1;
+        sum_of_squares2 += other.sum_of_squares2;
+        sum1            += other.sum1;
+        sum2            += other.sum2;
+        counter         += other.counter;
+      }
+
+      //*********************************
+      void clear()
+      {
+        inner_product   = TCalc(0);
+        sum_of_squares1 = TCalc(0);
+        sum_of_squares2 = TCalc(0);
+        sum1            = TCalc(0);
+        sum2            = TCalc(0);
+        counter         = 0U;
+      }
+
+      //*********************************
+      uint32_t count() const
+      {
+        return counter;
+      }
+
+      //*********************************
+      /// The sum of the squared deviations of the first variable.
+      //*********************************
+      double squared_deviations1() const
+      {
+        return deviation_product(sum_of_squares1, sum1, sum1);
+      }
+
+      //*********************************
+      /// The sum of the squared deviations of the second variable.
+      //*********************************
+      double squared_deviations2() const
+      {
+        return deviation_product(sum_of_squares2, sum2, sum2);
+      }
+
+      //*********************************
+      /// The sum of the products of the deviations.
+      //*********************************
+      double co_deviations() const
+      {
+        return deviation_product(inner_product, sum1, sum2);
+      }
+
+    private:
+
+      //*********************************
+      double deviation_product(TCalc sum_of_products, TCalc sum_a, TCalc sum_b) const
+      {
+        const double n = double(counter);
+
+        return (counter == 0U) ? 0.0 : ((n * double(sum_of_products)) - (double(sum_a) * double(sum_b))) / n;
+      }
+
+      TCalc    inner_product;
+      TCalc    sum_of_squares1;
+      TCalc    sum_of_squares2;
+      TCalc    sum1;
+      TCalc    sum2;
+      uint32_t counter;
+    };
+
+    //*************************************************************************
+    /// Welford and Chan for floating point calculation types.
+    //*************************************************************************
+    template <typename TCalc>
+    class co_moments<TCalc, true>
+    {
+    public:
+
+      co_moments()
+      {
+        clear();
+      }
+
+      //*********************************
+      template <typename TInput>
+      void add(TInput value1, TInput value2)
+      {
+        const TCalc x = TCalc(value1);
+        const TCalc y = TCalc(value2);
+
+        ++counter;
+
+        const TCalc n      = TCalc(counter);
+        const TCalc delta1 = x - mean1;
+        const TCalc delta2 = y - mean2;
+
+        mean1 += delta1 / n;
+        mean2 += delta2 / n;
+        m2_1  += delta1 * (x - mean1);
+        m2_2  += delta2 * (y - mean2);
+        c12   += delta1 * (y - mean2);
+      }
+
+      //*********************************
+      /// Two passes over the batch give its moments, which are then merged.
+      //*********************************
+      template <typename TInput>
+      void add(const TInput* p_values1, const TInput* p_values2, size_t n)
+      {
+        if (n == 0U)
+        {
+          return;
+        }
+
+        co_moments batch;
+
+        TCalc batch_sum1 = TCalc(0);
+        TCalc batch_sum2 = TCalc(0);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          batch_sum1 += TCalc(p_values1[i]);
+          batch_sum2 += TCalc(p_values2[i]);
+        }
+
+        batch.mean1 = batch_sum1 / TCalc(n);
+        batch.mean2 = batch_sum2 / TCalc(n);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const TCalc delta1 = TCalc(p_values1[i]) - batch.mean1;
+          const TCalc delta2 = TCalc(p_values2[i]) - batch.mean2;
+
+          batch.m2_1 += delta1 * delta1;
+          batch.m2_2 += delta2 * delta2;
+          batch.c12  += delta1 * delta2;
+        }
+
+        batch.counter = uint32_t(n);
+
+        merge(batch);
+      }
+
+      //*********************************
+      void merge(const co_moments& other)
+      {
+        if (other.counter == 0U)
+        {
+          return;
+        }
+
+        const TCalc n_a    = TCalc(counter);
+        const TCalc n_b    = TCalc(other.counter);
+        const TCalc n      = n_a + n_b;
+        const TCalc scale  = (n_a * n_b) / n;
+        const TCalc delta1 = other.mean1 - mean1;
+        const TCalc delta2 = other.mean2 - mean2;
+
+        mean1   += delta1 * (n_b / n);
+        mean2   += delta2 * (n_b / n);
+        m2_1    += other.m2_1 + (delta1 * delta1 * scale);
+        m2_2    += other.m2_2 + (delta2 * delta2 * scale);
+        c12     += other.c12  + (delta1 * delta2 * scale);
+        counter += other.counter;
+      }
+
+      //*********************************
+      void clear()
+      {
+        mean1   = TCalc(0);
+        mean2   = TCalc(0);
+        m2_1    = TCalc(0);
+        m2_2    = TCalc(0);
+        c12     = TCalc(0);
+        counter = 0U;
+      }
+
+      //*********************************
+      uint32_t count() const
+      {
+        return counter;
+      }
+
+      //*********************************
+      /// The sum of the squared deviations of the first variable.
+      //*********************************
+      double squared_deviations1() const
+      {
+        return double(m2_1);
+      }
+
+      //*********************************
+      /// The sum of the squared deviations of the second variable.
+      //*********************************
+      double squared_deviations2() const
+      {
+        return double(m2_2);
+      }
+
+      //*********************************
+      /// The sum of the products of the deviations.
+      //*********************************
+      double co_deviations() const
+      {
+        return double(c12);
+      }
+
+    private:
+
+      TCalc    mean1;
+      TCalc    mean2;
+      TCalc    m2_1;
+      TCalc    m2_2;
+      TCalc    c12;
+      uint32_t counter;
+    };
+  }
+}
+
+#endif
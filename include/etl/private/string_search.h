@@ -0,0 +1,584 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+#include "../platform.h"
+#include "../integral_limits.h"
+#include "../binary.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    /// Returned when the search fails.
+    static ETL_CONSTANT size_t npos = etl::integral_limits<size_t>::max;
+
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t word_type;
+#else
+    typedef uint32_t word_type;
+#endif
+
+    /// The number of characters in a word.
+    static ETL_CONSTANT size_t Word_Size = sizeof(word_type);
+
+    /// 0x0101...01
+    static ETL_CONSTANT word_type Low_Bits = ~word_type(0U) / 0xFFU;
+
+    /// 0x8080...80
+    static ETL_CONSTANT word_type High_Bits = Low_Bits * 0x80U;
+
+    //*************************************************************************
+    /// The character as an unsigned value.
+    /// Byte sized characters are always in the range 0 to 255.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 uint32_t to_unsigned(T c)
+    {
+      return (sizeof(T) == 1U) ? static_cast<uint32_t>(static_cast<uint8_t>(c)) : static_cast<uint32_t>(c);
+    }
+
+    //*************************************************************************
+    /// Loads a word of byte sized characters, the first in the lowest byte.
+    /// Built from the characters so that it is valid in a constant expression.
+    /// Compilers merge this into one unaligned load.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 word_type load_word(const T* p)
+    {
+#if ETL_USING_64BIT_TYPES
+      return  static_cast<word_type>(static_cast<uint8_t>(p[0]))         | (static_cast<word_type>(static_cast<uint8_t>(p[1])) << 8U)  |
+             (static_cast<word_type>(static_cast<uint8_t>(p[2])) << 16U) | (static_cast<word_type>(static_cast<uint8_t>(p[3])) << 24U) |
+             (static_cast<word_type>(static_cast<uint8_t>(p[4])) << 32U) | (static_cast<word_type>(static_cast<uint8_t>(p[5])) << 40U) |
+             (static_cast<word_type>(static_cast<uint8_t>(p[6])) << 48U) | (static_cast<word_type>(static_cast<uint8_t>(p[7])) << 56U);
+#else
+      return  static_cast<word_type>(static_cast<uint8_t>(p[0]))         | (static_cast<word_type>(static_cast<uint8_t>(p[1])) << 8U) |
+             (static_cast<word_type>(static_cast<uint8_t>(p[2])) << 16U) | (static_cast<word_type>(static_cast<uint8_t>(p[3])) << 24U);
+#endif
+    }
+
+    //*************************************************************************
+    /// Flags the bytes that are zero, with the high bit of each byte.
+    /// The lowest flag is always exact. Flags above it may be false positives.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline word_type zero_bytes(word_type word)
+    {
+      return (word - Low_Bits) & ~word & High_Bits;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of a character.
+    /// Byte sized characters are compared a word at a time.
+    ///\return The index of the character, or npos.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_char(const T* p, size_t length, T c)
+    {
+      size_t i = 0U;
+
+      if (sizeof(T) == 1U)
+      {
+        const word_type pattern = Low_Bits * to_unsigned(c);
+
+        while ((length - i) >= Word_Size)
+        {
+          const word_type zeros = zero_bytes(load_word(p + i) ^ pattern);
+
+          if (zeros != 0U)
+          {
+            return i + (etl::count_trailing_zeros(zeros) / 8U);
+          }
+
+          i += Word_Size;
+        }
+      }
+
+      for (; i < length; ++i)
+      {
+        if (p[i] == c)
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of a character.
+    /// Byte sized characters are compared a word at a time.
+    ///\return The index of the character, or npos.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t rfind_char(const T* p, size_t length, T c)
+    {
+      size_t i = length;
+
+      if (sizeof(T) == 1U)
+      {
+        const word_type pattern = Low_Bits * to_unsigned(c);
+
+        while (i >= Word_Size)
+        {
+          if (zero_bytes(load_word(p + i - Word_Size) ^ pattern) != 0U)
+          {
+            // The upper flags may be false, so find the exact one below.
+            break;
+          }
+
+          i -= Word_Size;
+        }
+      }
+
+      while (i-- > 0U)
+      {
+        if (p[i] == c)
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// The text, read forwards or backwards.
+    //*************************************************************************
+    template <typename T, bool Reverse>
+    struct text_reader
+    {
+      ETL_CONSTEXPR14 text_reader(const T* p_, size_t length_)
+        : p(p_)
+        , length(length_)
+      {
+      }
+
+      ETL_CONSTEXPR14 T operator [](size_t i) const
+      {
+        return Reverse ? p[length - 1U - i] : p[i];
+      }
+
+      const T* p;
+      size_t   length;
+    };
+
+    //*************************************************************************
+    /// Finds the critical factorisation of the needle.
+    /// Returns the start of the right half, and sets the period.
+    //*************************************************************************
+    template <typename TReader>
+    ETL_CONSTEXPR14 size_t critical_factorisation(const TReader& needle, size_t& period)
+    {
+      const size_t n = needle.length;
+
+      // Maximal suffix for the forward ordering.
+      size_t max_suffix = npos;
+      size_t j = 0U;
+      size_t k = 1U;
+      size_t p = 1U;
+
+      while ((j + k) < n)
+      {
+        const uint32_t a = to_unsigned(needle[j + k]);
+        const uint32_t b = to_unsigned(needle[max_suffix + k]);
+
+        if (a < b)
+        {
+          j += k;
+          k = 1U;
+          p = j - max_suffix;
+        }
+        else if (a == b)
+        {
+          if (k != p)
+          {
+            ++k;
+          }
+          else
+          {
+            j += p;
+            k = 1U;
+          }
+        }
+        else
+        {
+          max_suffix = j++;
+          k = p = 1U;
+        }
+      }
+
+      period = p;
+
+      // Maximal suffix for the reverse ordering.
+      size_t max_suffix_rev = npos;
+      j = 0U;
+      k = 1U;
+      p = 1U;
+
+      while ((j + k) < n)
+      {
+        const uint32_t a = to_unsigned(needle[j + k]);
+        const uint32_t b = to_unsigned(needle[max_suffix_rev + k]);
+
+        if (b < a)
+        {
+          j += k;
+          k = 1U;
+          p = j - max_suffix_rev;
+        }
+        else if (a == b)
+        {
+          if (k != p)
+          {
+            ++k;
+          }
+          else
+          {
+            j += p;
+            k = 1U;
+          }
+        }
+        else
+        {
+          max_suffix_rev = j++;
+          k = p = 1U;
+        }
+      }
+
+      // The larger of the two (+1 as the initial value is npos).
+      if ((max_suffix_rev + 1U) < (max_suffix + 1U))
+      {
+        return max_suffix + 1U;
+      }
+
+      period = p;
+
+      return max_suffix_rev + 1U;
+    }
+
+    //*************************************************************************
+    /// Two way string matching (Crochemore and Perrin).
+    /// Linear time and constant space. The needle must not be longer than the haystack.
+    ///\return The index of the match, in the reader's direction, or npos.
+    //*************************************************************************
+    template <typename TReader>
+    ETL_CONSTEXPR14 size_t two_way(const TReader& haystack, const TReader& needle)
+    {
+      const size_t n    = needle.length;
+      const size_t last = haystack.length - n;
+
+      size_t period = 0U;
+      const size_t suffix = critical_factorisation(needle, period);
+
+      bool is_periodic = true;
+
+      for (size_t i = 0U; (i < suffix) && is_periodic; ++i)
+      {
+        is_periodic = (needle[i] == needle[i + period]);
+      }
+
+      size_t j = 0U;
+
+      if (is_periodic)
+      {
+        // Remember how much of the left half is known to match after a shift by the period.
+        size_t memory = 0U;
+
+        while (j <= last)
+        {
+          size_t i = (suffix > memory) ? suffix : memory;
+
+          while ((i < n) && (needle[i] == haystack[i + j]))
+          {
+            ++i;
+          }
+
+          if (n <= i)
+          {
+            i = suffix - 1U;
+
+            while ((memory < (i + 1U)) && (needle[i] == haystack[i + j]))
+            {
+              --i;
+            }
+
+            if ((i + 1U) < (memory + 1U))
+            {
+              return j;
+            }
+
+            j     += period;
+            memory = n - period;
+          }
+          else
+          {
+            j     += i - suffix + 1U;
+            memory = 0U;
+          }
+        }
+      }
+      else
+      {
+        period = ((suffix > (n - suffix)) ? suffix : (n - suffix)) + 1U;
+
+        while (j <= last)
+        {
+          size_t i = suffix;
+
+          while ((i < n) && (needle[i] == haystack[i + j]))
+          {
+            ++i;
+          }
+
+          if (n <= i)
+          {
+            i = suffix - 1U;
+
+            while ((i != npos) && (needle[i] == haystack[i + j]))
+            {
+              --i;
+            }
+
+            if (i == npos)
+            {
+              return j;
+            }
+
+            j += period;
+          }
+          else
+          {
+            j += i - suffix + 1U;
+          }
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the needle in the haystack.
+    ///\return The index of the match, or npos.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find(const T* haystack, size_t haystack_length, const T* needle, size_t needle_length)
+    {
+      if (needle_length > haystack_length)
+      {
+        return npos;
+      }
+
+      if (needle_length == 0U)
+      {
+        return 0U;
+      }
+
+      if (needle_length == 1U)
+      {
+        return find_char(haystack, haystack_length, needle[0]);
+      }
+
+      typedef text_reader<T, false> reader;
+
+      return two_way(reader(haystack, haystack_length), reader(needle, needle_length));
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of the needle in the haystack.
+    ///\return The index of the match, or npos.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t rfind(const T* haystack, size_t haystack_length, const T* needle, size_t needle_length)
+    {
+      if (needle_length > haystack_length)
+      {
+        return npos;
+      }
+
+      if (needle_length == 0U)
+      {
+        return haystack_length;
+      }
+
+      if (needle_length == 1U)
+      {
+        return rfind_char(haystack, haystack_length, needle[0]);
+      }
+
+      typedef text_reader<T, true> reader;
+
+      // Match the reversed needle in the reversed haystack.
+      const size_t index = two_way(reader(haystack, haystack_length), reader(needle, needle_length));
+
+      return (index == npos) ? npos : (haystack_length - index - needle_length);
+    }
+
+    //*************************************************************************
+    /// A set of characters, for find_first_of and similar.
+    /// Characters below 256 are held in a bitmap. Others, for wide character
+    /// types only, are found by searching the original set.
+    //*************************************************************************
+    template <typename T>
+    class character_set
+    {
+    public:
+
+      //*********************************
+      /// From a pointer and length.
+      //*********************************
+      ETL_CONSTEXPR14 character_set(const T* p_set_, size_t length_)
+        : bitmap()
+        , p_set(p_set_)
+        , length(length_)
+        , has_wide(false)
+      {
+        for (size_t i = 0U; i < length; ++i)
+        {
+          add(p_set[i]);
+        }
+      }
+
+      //*********************************
+      /// From a zero terminated set.
+      //*********************************
+      ETL_CONSTEXPR14 explicit character_set(const T* p_set_)
+        : bitmap()
+        , p_set(p_set_)
+        , length(0U)
+        , has_wide(false)
+      {
+        while (p_set[length] != 0)
+        {
+          add(p_set[length]);
+          ++length;
+        }
+      }
+
+      //*********************************
+      /// Is the character in the set?
+      //*********************************
+      ETL_CONSTEXPR14 bool contains(T c) const
+      {
+        const uint32_t value = to_unsigned(c);
+
+        if (value < 256U)
+        {
+          return (bitmap[value >> 5U] & (uint32_t(1U) << (value & 0x1FU))) != 0U;
+        }
+        else if (has_wide)
+        {
+          for (size_t i = 0U; i < length; ++i)
+          {
+            if (p_set[i] == c)
+            {
+              return true;
+            }
+          }
+        }
+
+        return false;
+      }
+
+    private:
+
+      //*********************************
+      ETL_CONSTEXPR14 void add(T c)
+      {
+        const uint32_t value = to_unsigned(c);
+
+        if (value < 256U)
+        {
+          bitmap[value >> 5U] |= (uint32_t(1U) << (value & 0x1FU));
+        }
+        else
+        {
+          has_wide = true;
+        }
+      }
+
+      uint32_t bitmap[256U / 32U];
+      const T* p_set;
+      size_t   length;
+      bool     has_wide;
+    };
+
+    //*************************************************************************
+    /// Finds the first character that is, or is not, in the set.
+    ///\return The index of the character, or npos.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_first_of(const T* p, size_t position, size_t length, const character_set<T>& set, bool in_set)
+    {
+      for (size_t i = position; i < length; ++i)
+      {
+        if (set.contains(p[i]) == in_set)
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last character that is, or is not, in the set, searching
+    /// from position towards the start.
+    ///\return The index of the character, or npos.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_last_of(const T* p, size_t position, size_t length, const character_set<T>& set, bool in_set)
+    {
+      if (length == 0U)
+      {
+        return npos;
+      }
+
+      size_t i = (position < length) ? position + 1U : length;
+
+      while (i-- > 0U)
+      {
+        if (set.contains(p[i]) == in_set)
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,428 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_WHEEL_INCLUDED
+#define ETL_TIMER_WHEEL_INCLUDED
+
+#include "../platform.h"
+#include "../timer.h"
+#include "../log.h"
+#include "../static_assert.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_timer_wheel
+  {
+    //*************************************************************************
+    /// The bucket index of a timer that is not in the wheel.
+    //*************************************************************************
+    struct bucket
+    {
+      enum
+      {
+        No_Bucket = 0xFFFFU
+      };
+
+      typedef uint_least16_t type;
+    };
+
+    //*************************************************************************
+    /// The dimensions of a wheel with Slots slots per level.
+    /// There are enough levels to hold any 32 bit delay.
+    //*************************************************************************
+    template <size_t Slots>
+    struct wheel_size
+    {
+      ETL_STATIC_ASSERT((Slots >= 2U) && (Slots <= 256U), "Slots must be between 2 and 256");
+      ETL_STATIC_ASSERT((Slots & (Slots - 1U)) == 0U, "Slots must be a power of 2");
+
+      static ETL_CONSTANT uint_least8_t Slot_Bits = static_cast<uint_least8_t>(etl::log2<Slots>::value);
+      static ETL_CONSTANT uint_least8_t Levels    = static_cast<uint_least8_t>((32U + Slot_Bits - 1U) / Slot_Bits);
+      static ETL_CONSTANT size_t        Buckets   = Levels * Slots;
+    };
+
+    template <size_t Slots>
+    ETL_CONSTANT uint_least8_t wheel_size<Slots>::Slot_Bits;
+
+    template <size_t Slots>
+    ETL_CONSTANT uint_least8_t wheel_size<Slots>::Levels;
+
+    template <size_t Slots>
+    ETL_CONSTANT size_t wheel_size<Slots>::Buckets;
+
+    //*************************************************************************
+    /// A hierarchical timing wheel of intrusively linked timers.
+    /// Level 0 has one slot per tick. Each higher level has slots that are
+    /// Slots times longer, and its timers are moved down a level each time
+    /// the level below wraps. Insert and remove are O(1). Advancing time is
+    /// amortised O(1) per tick, and empty stretches are skipped.
+    /// TTimerData must have the members 'expiry' (uint32_t), 'previous' and
+    /// 'next' (etl::timer::id::type) and 'bucket' (bucket::type).
+    //*************************************************************************
+    template <typename TTimerData>
+    class timer_wheel
+    {
+    public:
+
+      //*******************************
+      timer_wheel(TTimerData* ptimers_, etl::timer::id::type* pbuckets_, uint_least8_t slot_bits_, uint_least8_t levels_)
+        : ptimers(ptimers_)
+        , pbuckets(pbuckets_)
+        , now(0U)
+        , active_count(0U)
+        , slot_bits(slot_bits_)
+        , slots(static_cast<uint_least16_t>(1U << slot_bits_))
+        , levels(levels_)
+      {
+        clear_buckets();
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return active_count == 0U;
+      }
+
+      //*******************************
+      /// Adds a timer that expires delay ticks from now.
+      //*******************************
+      void insert(etl::timer::id::type id_, uint32_t delay)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        timer.expiry = now + delay;
+        link(id_, bucket_for(delay, timer.expiry));
+        ++active_count;
+      }
+
+      //*******************************
+      /// Removes an active timer.
+      //*******************************
+      void remove(etl::timer::id::type id_)
+      {
+        unlink(id_);
+        ptimers[id_].bucket = static_cast<bucket::type>(bucket::No_Bucket);
+        --active_count;
+      }
+
+      //*******************************
+      /// Removes and returns the next timer that expires within count ticks,
+      /// or etl::timer::id::NO_TIMER if there are no more.
+      /// Time is advanced to the expiry of the returned timer, and count is
+      /// reduced by the time advanced. If no timer is returned, count is
+      /// reduced to zero.
+      //*******************************
+      etl::timer::id::type next_expired(uint32_t& count)
+      {
+        while (true)
+        {
+          // Any timers due now?
+          etl::timer::id::type id = pbuckets[now & slot_mask()];
+
+          if (id != etl::timer::id::NO_TIMER)
+          {
+            remove(id);
+            return id;
+          }
+
+          if (count == 0U)
+          {
+            return etl::timer::id::NO_TIMER;
+          }
+
+          if (active_count == 0U)
+          {
+            // Nothing to expire, so just move time on.
+            now  += count;
+            count = 0U;
+            return etl::timer::id::NO_TIMER;
+          }
+
+          // Skip straight to the next time that something happens.
+          uint32_t steps = steps_to_next_event();
+
+          if ((steps == 0U) || (steps > count))
+          {
+            steps = count;
+          }
+
+          now   += steps;
+          count -= steps;
+
+          if ((now & slot_mask()) == 0U)
+          {
+            cascade(1U);
+          }
+        }
+      }
+
+      //*******************************
+      /// The time to the next expiry,
+      /// or etl::timer::interval::No_Active_Interval if there are no active timers.
+      //*******************************
+      uint32_t time_to_next() const
+      {
+        uint32_t delta = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+
+        if (active_count == 0U)
+        {
+          return delta;
+        }
+
+        // Level 0 slots each hold a single expiry time.
+        for (uint32_t offset = 0U; offset < slots; ++offset)
+        {
+          if (pbuckets[(now + offset) & slot_mask()] != etl::timer::id::NO_TIMER)
+          {
+            delta = offset;
+            break;
+          }
+        }
+
+        // The first occupied slot of each higher level holds the level's earliest timers.
+        for (uint_least8_t level = 1U; level < levels; ++level)
+        {
+          uint32_t index = (now >> (level * slot_bits)) & slot_mask();
+
+          for (uint32_t offset = 1U; offset <= slots; ++offset)
+          {
+            etl::timer::id::type id = pbuckets[(level * slots) + ((index + offset) & slot_mask())];
+
+            if (id != etl::timer::id::NO_TIMER)
+            {
+              while (id != etl::timer::id::NO_TIMER)
+              {
+                uint32_t remaining = ptimers[id].expiry - now;
+
+                if (remaining < delta)
+                {
+                  delta = remaining;
+                }
+
+                id = ptimers[id].next;
+              }
+
+              break;
+            }
+          }
+        }
+
+        return delta;
+      }
+
+      //*******************************
+      /// Removes all of the timers.
+      //*******************************
+      void clear()
+      {
+        for (size_t i = 0U; i < (size_t(levels) * slots); ++i)
+        {
+          etl::timer::id::type id = pbuckets[i];
+
+          while (id != etl::timer::id::NO_TIMER)
+          {
+            TTimerData& timer = ptimers[id];
+            id = timer.next;
+
+            timer.previous = etl::timer::id::NO_TIMER;
+            timer.next     = etl::timer::id::NO_TIMER;
+            timer.bucket   = static_cast<bucket::type>(bucket::No_Bucket);
+          }
+        }
+
+        clear_buckets();
+        active_count = 0U;
+      }
+
+    private:
+
+      //*******************************
+      uint32_t slot_mask() const
+      {
+        return slots - 1U;
+      }
+
+      //*******************************
+      /// The number of ticks until the next occupied level 0 slot, or the
+      /// next cascade of an occupied bucket, whichever is first.
+      /// Empty slots and cascades of empty buckets can be skipped.
+      /// Returns 0 if the next event is 2^32 ticks away.
+      //*******************************
+      uint32_t steps_to_next_event() const
+      {
+        uint32_t steps = 0U;
+
+        for (uint32_t offset = 1U; offset < slots; ++offset)
+        {
+          if (pbuckets[(now + offset) & slot_mask()] != etl::timer::id::NO_TIMER)
+          {
+            steps = offset;
+            break;
+          }
+        }
+
+        for (uint_least8_t level = 1U; level < levels; ++level)
+        {
+          const uint_least8_t shift = static_cast<uint_least8_t>(level * slot_bits);
+          const uint32_t      index = now >> shift;
+
+          for (uint32_t offset = 1U; offset <= slots; ++offset)
+          {
+            if (pbuckets[(level * slots) + ((index + offset) & slot_mask())] != etl::timer::id::NO_TIMER)
+            {
+              // Wraps naturally at 2^32, as 'now' does.
+              uint32_t cascade_steps = ((index + offset) << shift) - now;
+
+              if ((cascade_steps != 0U) && ((steps == 0U) || (cascade_steps < steps)))
+              {
+                steps = cascade_steps;
+              }
+
+              break;
+            }
+          }
+        }
+
+        return steps;
+      }
+
+      //*******************************
+      /// The bucket for a timer that expires delay ticks from now.
+      //*******************************
+      bucket::type bucket_for(uint32_t delay, uint32_t expiry) const
+      {
+        uint_least8_t level = 0U;
+
+        while (((level + 1U) < levels) && ((delay >> ((level + 1U) * slot_bits)) != 0U))
+        {
+          ++level;
+        }
+
+        return static_cast<bucket::type>((level * slots) + ((expiry >> (level * slot_bits)) & slot_mask()));
+      }
+
+      //*******************************
+      /// Moves the timers in the current slot of a level down to the lower levels.
+      //*******************************
+      void cascade(uint_least8_t level)
+      {
+        if (level >= levels)
+        {
+          return;
+        }
+
+        uint32_t index = (now >> (level * slot_bits)) & slot_mask();
+
+        etl::timer::id::type id = pbuckets[(level * slots) + index];
+        pbuckets[(level * slots) + index] = etl::timer::id::NO_TIMER;
+
+        while (id != etl::timer::id::NO_TIMER)
+        {
+          TTimerData& timer = ptimers[id];
+          etl::timer::id::type next_id = timer.next;
+
+          link(id, bucket_for(timer.expiry - now, timer.expiry));
+
+          id = next_id;
+        }
+
+        if (index == 0U)
+        {
+          cascade(level + 1U);
+        }
+      }
+
+      //*******************************
+      /// Adds a timer to the head of a bucket.
+      //*******************************
+      void link(etl::timer::id::type id_, bucket::type bucket_)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        timer.bucket   = bucket_;
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = pbuckets[bucket_];
+
+        if (timer.next != etl::timer::id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = id_;
+        }
+
+        pbuckets[bucket_] = id_;
+      }
+
+      //*******************************
+      /// Removes a timer from its bucket.
+      //*******************************
+      void unlink(etl::timer::id::type id_)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        if (timer.previous == etl::timer::id::NO_TIMER)
+        {
+          pbuckets[timer.bucket] = timer.next;
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+
+        if (timer.next != etl::timer::id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = etl::timer::id::NO_TIMER;
+      }
+
+      //*******************************
+      void clear_buckets()
+      {
+        for (size_t i = 0U; i < (size_t(levels) * slots); ++i)
+        {
+          pbuckets[i] = etl::timer::id::NO_TIMER;
+        }
+      }
+
+      TTimerData* const           ptimers;
+      etl::timer::id::type* const pbuckets;
+      uint32_t                    now;
+      uint_least16_t              active_count;
+      const uint_least8_t         slot_bits;
+      const uint_least16_t        slots;
+      const uint_least8_t         levels;
+    };
+  }
+}
+
+#endif
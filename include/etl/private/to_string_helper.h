@@ -45,6 +45,8 @@ SOFTWARE.
 #include "../math.h"
 #include "../limits.h"
 
+#include "to_string_shortest.h"
+
 #include <math.h>
 
 #if ETL_USING_STL && ETL_USING_CPP11
@@ -64,204 +66,336 @@ namespace etl
 #endif
 
     //***************************************************************************
-    /// Helper function for left/right alignment.
+    /// A sink that counts the characters written to it.
+    /// Used to find the length of a composite value before it is aligned.
     //***************************************************************************
-    template <typename TIString>
-    void add_alignment(TIString& str, typename TIString::iterator position, const etl::basic_format_spec<TIString>& format)
+    template <typename T>
+    class counting_sink
     {
-      uint32_t length = static_cast<uint32_t>(etl::distance(position, str.end()));
+    public:
 
-      if (length < format.get_width())
+      typedef T value_type;
+
+      counting_sink()
+        : count(0U)
       {
-        uint32_t fill_length = format.get_width() - length;
+      }
 
-        if (format.is_left())
-        {
-          // Insert fill characters on the right.
-          str.insert(str.end(), fill_length, format.get_fill());
-        }
-        else
-        {
-          // Insert fill characters on the left.
-          str.insert(position, fill_length, format.get_fill());
-        }
+      void push_back(T)
+      {
+        ++count;
+      }
+
+      void append(size_t n, T)
+      {
+        count += n;
       }
+
+      template <typename TIterator>
+      void append(TIterator first, TIterator last)
+      {
+        count += static_cast<size_t>(etl::distance(first, last));
+      }
+
+      size_t size() const
+      {
+        return count;
+      }
+
+    private:
+
+      size_t count;
+    };
+
+    //***************************************************************************
+    /// Helper function for left/right alignment.
+    /// Adds the fill characters that go before (right aligned) or after
+    /// (left aligned) a value of the given length.
+    /// The sink may be a string or any type with push_back and append members.
+    //***************************************************************************
+    template <typename TSink, typename TIString>
+    void add_alignment(TSink& sink, size_t length, const etl::basic_format_spec<TIString>& format, const bool before)
+    {
+      if ((length < format.get_width()) && (format.is_left() != before))
+      {
+        sink.append(format.get_width() - length, format.get_fill());
+      }
+    }
+
+    //***************************************************************************
+    /// Helper function for aligned text.
+    //***************************************************************************
+    template <typename TSink, typename TIString, typename TIterator>
+    void add_aligned(TSink& sink, TIterator first, TIterator last, const etl::basic_format_spec<TIString>& format)
+    {
+      const size_t length = static_cast<size_t>(etl::distance(first, last));
+
+      etl::private_to_string::add_alignment(sink, length, format, true);
+      sink.append(first, last);
+      etl::private_to_string::add_alignment(sink, length, format, false);
     }
 
     //***************************************************************************
     /// Helper function for booleans.
     //***************************************************************************
-    template <typename TIString>
+    template <typename TSink, typename TIString>
     void add_boolean(const bool value,
-                     TIString& str,
-                     const etl::basic_format_spec<TIString>& format,
-                     const bool append)
+                     TSink& sink,
+                     const etl::basic_format_spec<TIString>& format)
     {
       typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
 
       static const type t[] = { 't', 'r', 'u', 'e' };
       static const type f[] = { 'f', 'a', 'l', 's', 'e' };
-
-      if (!append)
-      {
-        str.clear();
-      }
-
-      iterator start = str.end();
+      static const type d[] = { '0', '1' };
 
       if (format.is_boolalpha())
       {
         if (value)
         {
-          str.insert(str.end(), ETL_OR_STD11::begin(t), ETL_OR_STD11::end(t));
+          etl::private_to_string::add_aligned(sink, ETL_OR_STD11::begin(t), ETL_OR_STD11::end(t), format);
         }
         else
         {
-          str.insert(str.end(), ETL_OR_STD11::begin(f), ETL_OR_STD11::end(f));
+          etl::private_to_string::add_aligned(sink, ETL_OR_STD11::begin(f), ETL_OR_STD11::end(f), format);
         }
       }
       else
       {
-        if (value)
-        {
-          str.push_back(type('1'));
-        }
-        else
-        {
-          str.push_back(type('0'));
-        }
+        const type* p = value ? d + 1 : d;
+
+        etl::private_to_string::add_aligned(sink, p, p + 1, format);
+      }
+    }
+
+    //***************************************************************************
+    /// The two character decimal representations of 0 to 99.
+    //***************************************************************************
+    inline const char* decimal_digit_pairs()
+    {
+      static const char pairs[] = "00010203040506070809"
+                                  "10111213141516171819"
+                                  "20212223242526272829"
+                                  "30313233343536373839"
+                                  "40414243444546474849"
+                                  "50515253545556575859"
+                                  "60616263646566676869"
+                                  "70717273747576777879"
+                                  "80818283848586878889"
+                                  "90919293949596979899";
+
+      return pairs;
+    }
+
+    //***************************************************************************
+    /// Helper function for a single digit in any base.
+    //***************************************************************************
+    template <typename TChar>
+    TChar digit_to_char(const uint32_t digit, const bool upper_case)
+    {
+      return (digit > 9U) ? (upper_case ? TChar('A' + (digit - 10U)) : TChar('a' + (digit - 10U))) : TChar('0' + digit);
+    }
+
+    //***************************************************************************
+    /// Writes the decimal digits of a non-zero value backwards from p_end.
+    /// Two digits are produced per division.
+    /// Returns a pointer to the most significant digit.
+    //***************************************************************************
+    template <typename TChar, typename TUnsigned>
+    TChar* write_decimal_digits(TUnsigned value, TChar* p_end)
+    {
+      const char* pairs = decimal_digit_pairs();
+
+      while (value >= 100U)
+      {
+        const size_t index = 2U * (value % 100U);
+        value /= 100U;
+
+        *--p_end = TChar(pairs[index + 1U]);
+        *--p_end = TChar(pairs[index]);
+      }
+
+      if (value >= 10U)
+      {
+        const size_t index = 2U * value;
+
+        *--p_end = TChar(pairs[index + 1U]);
+        *--p_end = TChar(pairs[index]);
+      }
+      else
+      {
+        *--p_end = TChar('0' + value);
+      }
+
+      return p_end;
+    }
+
+    //***************************************************************************
+    /// Writes the digits of a non-zero value in a power of two base backwards from p_end.
+    /// Returns a pointer to the most significant digit.
+    //***************************************************************************
+    template <typename TChar, typename TUnsigned>
+    TChar* write_power_of_2_digits(TUnsigned value, TChar* p_end, const uint32_t shift, const bool upper_case)
+    {
+      const uint32_t mask = (1U << shift) - 1U;
+
+      while (value != 0U)
+      {
+        const uint32_t digit = value & mask;
+        value >>= shift;
+
+        *--p_end = digit_to_char<TChar>(digit, upper_case);
       }
 
-      etl::private_to_string::add_alignment(str, start, format);
+      return p_end;
+    }
+
+    //***************************************************************************
+    /// Writes the digits of a non-zero value in any base backwards from p_end.
+    /// Returns a pointer to the most significant digit.
+    //***************************************************************************
+    template <typename TChar, typename TUnsigned>
+    TChar* write_digits(TUnsigned value, TChar* p_end, const uint32_t base, const bool upper_case)
+    {
+      while (value != 0U)
+      {
+        const uint32_t digit = value % base;
+        value /= base;
+
+        *--p_end = digit_to_char<TChar>(digit, upper_case);
+      }
+
+      return p_end;
     }
 
     //***************************************************************************
     /// Helper function for integrals.
+    /// The characters are written backwards into a local buffer, in their final order,
+    /// and appended in one operation.
     //***************************************************************************
-    template <typename T, typename TIString>
+    template <typename T, typename TSink, typename TIString>
     void add_integral(T value,
-                      TIString& str,
+                      TSink& sink,
                       const etl::basic_format_spec<TIString>& format,
-                      bool append,
                       const bool negative)
     {
-      typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
+      typedef typename TIString::value_type         type;
+      typedef typename etl::make_unsigned<T>::type  utype;
 
-      if (!append)
+      // Room for the base 2 digits of the largest value, a two character base prefix and a sign.
+      type  buffer[etl::numeric_limits<utype>::digits + 3];
+      type* p_end   = buffer + (sizeof(buffer) / sizeof(type));
+      type* p_first = p_end;
+
+      // The magnitude of the value.
+      utype uvalue = value;
+
+      if (etl::is_negative(value))
       {
-        str.clear();
+        uvalue = 0U - uvalue;
       }
 
-      iterator start = str.end();
+      const uint32_t base       = format.get_base();
+      const bool     upper_case = format.is_upper_case();
 
-      if (value == 0)
+      if (uvalue == 0U)
       {
-        // If number is negative, append '-' (a negative zero might occur for fractional numbers > -1.0)
-        if ((format.get_base() == 10U) && negative)
-        {
-          str.push_back(type('-'));
-        }
-
-        str.push_back(type('0'));
+        *--p_first = type('0');
       }
       else
       {
-        // Extract the digits, in reverse order.
-        while (value != 0)
+        switch (base)
         {
-          T remainder = etl::absolute(value % T(format.get_base()));
-          str.push_back((remainder > 9) ? (format.is_upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10))) : type('0' + remainder));
-          value = value / T(format.get_base());
+          case 10U: { p_first = etl::private_to_string::write_decimal_digits(uvalue, p_first); break; }
+          case 16U: { p_first = etl::private_to_string::write_power_of_2_digits(uvalue, p_first, 4U, upper_case); break; }
+          case 8U:  { p_first = etl::private_to_string::write_power_of_2_digits(uvalue, p_first, 3U, upper_case); break; }
+          case 2U:  { p_first = etl::private_to_string::write_power_of_2_digits(uvalue, p_first, 1U, upper_case); break; }
+          default:  { p_first = etl::private_to_string::write_digits(uvalue, p_first, base, upper_case); break; }
         }
+      }
 
-        // If number is negative, append '-'
-        if ((format.get_base() == 10U) && negative)
-        {
-          str.push_back(type('-'));
-        }
+      // If number is negative, prepend '-' (a negative zero might occur for fractional numbers > -1.0)
+      if ((base == 10U) && negative)
+      {
+        *--p_first = type('-');
+      }
 
-        if (format.is_show_base())
+      if (format.is_show_base() && (uvalue != 0U))
+      {
+        switch (base)
         {
-          switch (format.get_base())
+          case 2U:
           {
-            case 2U:
-            {
-              str.push_back(format.is_upper_case() ? type('B') : type('b'));
-              str.push_back(type('0'));
-              break;
-            }
+            *--p_first = upper_case ? type('B') : type('b');
+            *--p_first = type('0');
+            break;
+          }
 
-            case 8U:
-            {
-              str.push_back(type('0'));
-              break;
-            }
+          case 8U:
+          {
+            *--p_first = type('0');
+            break;
+          }
 
-            case 16U:
-            {
-              str.push_back(format.is_upper_case() ? type('X') : type('x'));
-              str.push_back(type('0'));
-              break;
-            }
+          case 16U:
+          {
+            *--p_first = upper_case ? type('X') : type('x');
+            *--p_first = type('0');
+            break;
+          }
 
-            default:
-            {
-              break;
-            }
+          default:
+          {
+            break;
           }
         }
-
-        // Reverse the string we appended.
-        etl::reverse(start, str.end());
       }
 
-      etl::private_to_string::add_alignment(str, start, format);
+      etl::private_to_string::add_aligned(sink, p_first, p_end, format);
     }
 
     //***************************************************************************
     /// Helper function for floating point nan and inf.
     //***************************************************************************
-    template <typename TIString>
+    template <typename TSink>
     void add_nan_inf(const bool not_a_number,
                      const bool infinity,
-                     TIString&  str)
+                     TSink&     sink)
     {
-      typedef typename TIString::value_type type;
+      typedef typename TSink::value_type type;
 
       static const type n[] = { 'n', 'a', 'n' };
       static const type i[] = { 'i', 'n', 'f' };
 
       if (not_a_number)
       {
-        str.insert(str.end(), ETL_OR_STD11::begin(n), ETL_OR_STD11::end(n));
+        sink.append(ETL_OR_STD11::begin(n), ETL_OR_STD11::end(n));
       }
       else if (infinity)
       {
-        str.insert(str.end(), ETL_OR_STD11::begin(i), ETL_OR_STD11::end(i));
+        sink.append(ETL_OR_STD11::begin(i), ETL_OR_STD11::end(i));
       }
     }
 
     //***************************************************************************
     /// Helper function for floating point integral and fractional.
     //***************************************************************************
-    template <typename TIString>
+    template <typename TSink, typename TIString>
     void add_integral_and_fractional(const uint32_t integral,
                                      const uint32_t fractional,
-                                     TIString& str,
+                                     TSink& sink,
                                      const etl::basic_format_spec<TIString>& integral_format,
                                      const etl::basic_format_spec<TIString>& fractional_format,
                                      const bool negative)
     {
       typedef typename TIString::value_type type;
 
-      etl::private_to_string::add_integral(integral, str, integral_format, true, negative);
+      etl::private_to_string::add_integral(integral, sink, integral_format, negative);
 
       if (fractional_format.get_precision() > 0)
       {
-        str.push_back(type('.'));
-        etl::private_to_string::add_integral(fractional, str, fractional_format, true, false);
+        sink.push_back(type('.'));
+        etl::private_to_string::add_integral(fractional, sink, fractional_format, false);
       }
     }
 
@@ -269,49 +403,161 @@ namespace etl
     //***************************************************************************
     /// Helper function for floating point integral and fractional.
     //***************************************************************************
-    template <typename TIString>
+    template <typename TSink, typename TIString>
     void add_integral_and_fractional(const uint64_t integral,
                                      const uint64_t fractional,
-                                     TIString& str,
+                                     TSink& sink,
                                      const etl::basic_format_spec<TIString>& integral_format,
                                      const etl::basic_format_spec<TIString>& fractional_format,
                                      const bool negative)
     {
       typedef typename TIString::value_type type;
 
-      etl::private_to_string::add_integral(integral, str, integral_format, true, negative);
+      etl::private_to_string::add_integral(integral, sink, integral_format, negative);
 
       if (fractional_format.get_precision() > 0)
       {
-        str.push_back(type('.'));
-        etl::private_to_string::add_integral(fractional, str, fractional_format, true, false);
+        sink.push_back(type('.'));
+        etl::private_to_string::add_integral(fractional, sink, fractional_format, false);
       }
     }
 #endif
 
+#if ETL_USING_64BIT_TYPES
     //***************************************************************************
-    /// Helper function for floating point.
+    /// Helper function for the shortest round trip floating point format.
+    /// Fixed notation is used for decimal exponents from -5 up to digits10,
+    /// otherwise scientific notation is used.
+    /// long double is formatted as double.
     //***************************************************************************
-    template <typename T, typename TIString>
-    void add_floating_point(const T value,
-                            TIString& str,
-                            const etl::basic_format_spec<TIString>& format,
-                            const bool append)
+    template <typename T, typename TSink, typename TIString>
+    void add_floating_point_shortest(const T value,
+                                     TSink& sink,
+                                     const etl::basic_format_spec<TIString>& format)
     {
-      typedef typename TIString::iterator   iterator;
       typedef typename TIString::value_type type;
+      typedef typename etl::conditional<etl::is_same<T, float>::value, float, double>::type shortest_t;
 
-      if (!append)
+      // Room for a sign, 17 digits, a decimal point, 5 leading zeros or an exponent.
+      type   buffer[40];
+      size_t length = 0U;
+
+      shortest_t v = value;
+
+      if (etl::is_negative(v))
       {
-        str.clear();
+        buffer[length++] = type('-');
+        v = -v;
       }
 
-      iterator start = str.end();
+      if (!(v > shortest_t(0)))
+      {
+        buffer[length++] = type('0');
+      }
+      else
+      {
+        const etl::private_to_string::shortest_digits d = etl::private_to_string::get_shortest_digits(v);
+
+        const int point     = d.length + d.exponent; // The position of the decimal point in the digits.
+        const int exponent  = point - 1;             // The scientific notation exponent.
+        const int max_fixed = etl::numeric_limits<shortest_t>::digits10 + 1;
+
+        if ((exponent >= -5) && (exponent < max_fixed))
+        {
+          if (d.exponent >= 0)
+          {
+            // An integer.
+            for (int i = 0; i < d.length; ++i)
+            {
+              buffer[length++] = type(d.digits[i]);
+            }
+
+            for (int i = 0; i < d.exponent; ++i)
+            {
+              buffer[length++] = type('0');
+            }
+          }
+          else if (point > 0)
+          {
+            for (int i = 0; i < d.length; ++i)
+            {
+              if (i == point)
+              {
+                buffer[length++] = type('.');
+              }
+
+              buffer[length++] = type(d.digits[i]);
+            }
+          }
+          else
+          {
+            buffer[length++] = type('0');
+            buffer[length++] = type('.');
+
+            for (int i = point; i < 0; ++i)
+            {
+              buffer[length++] = type('0');
+            }
+
+            for (int i = 0; i < d.length; ++i)
+            {
+              buffer[length++] = type(d.digits[i]);
+            }
+          }
+        }
+        else
+        {
+          buffer[length++] = type(d.digits[0]);
+
+          if (d.length > 1)
+          {
+            buffer[length++] = type('.');
+
+            for (int i = 1; i < d.length; ++i)
+            {
+              buffer[length++] = type(d.digits[i]);
+            }
+          }
+
+          buffer[length++] = format.is_upper_case() ? type('E') : type('e');
+          buffer[length++] = (exponent < 0) ? type('-') : type('+');
+
+          const int abs_exponent = (exponent < 0) ? -exponent : exponent;
+
+          if (abs_exponent >= 100)
+          {
+            buffer[length++] = type('0' + (abs_exponent / 100));
+          }
+
+          buffer[length++] = type('0' + ((abs_exponent / 10) % 10));
+          buffer[length++] = type('0' + (abs_exponent % 10));
+        }
+      }
+
+      sink.append(buffer, buffer + length);
+    }
+#endif
+
+    //***************************************************************************
+    /// Helper function for floating point, without alignment.
+    //***************************************************************************
+    template <typename T, typename TSink, typename TIString>
+    void add_floating_point_unaligned(const T value,
+                                      TSink& sink,
+                                      const etl::basic_format_spec<TIString>& format)
+    {
+      typedef typename TIString::value_type type;
 
       if (isnan(value) || isinf(value))
       {
-        etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
+        etl::private_to_string::add_nan_inf(isnan(value), isinf(value), sink);
       }
+#if ETL_USING_64BIT_TYPES
+      else if (format.is_shortest())
+      {
+        etl::private_to_string::add_floating_point_shortest(value, sink, format);
+      }
+#endif
       else
       {
         // Make sure we format the two halves correctly.
@@ -351,33 +597,45 @@ namespace etl
           fractional = 0U;
         }
 
-        etl::private_to_string::add_integral_and_fractional(integral, fractional, str, integral_format, fractional_format, etl::is_negative(value));
+        etl::private_to_string::add_integral_and_fractional(integral, fractional, sink, integral_format, fractional_format, etl::is_negative(value));
       }
+    }
 
-      etl::private_to_string::add_alignment(str, start, format);
+    //***************************************************************************
+    /// Helper function for floating point.
+    /// The length is only needed, and found, when there is a width.
+    //***************************************************************************
+    template <typename T, typename TSink, typename TIString>
+    void add_floating_point(const T value,
+                            TSink& sink,
+                            const etl::basic_format_spec<TIString>& format)
+    {
+      size_t length = 0U;
+
+      if (format.get_width() != 0U)
+      {
+        etl::private_to_string::counting_sink<typename TIString::value_type> counter;
+        etl::private_to_string::add_floating_point_unaligned(value, counter, format);
+        length = counter.size();
+      }
+
+      etl::private_to_string::add_alignment(sink, length, format, true);
+      etl::private_to_string::add_floating_point_unaligned(value, sink, format);
+      etl::private_to_string::add_alignment(sink, length, format, false);
     }
 
     //***************************************************************************
     /// Helper function for denominated integers.
     //***************************************************************************
-    template <typename T, typename TIString>
+    template <typename T, typename TSink, typename TIString>
     void add_integral_denominated(const T value,
                                   const uint32_t denominator_exponent,
-                                  TIString& str,
-                                  const etl::basic_format_spec<TIString>& format,
-                                  const bool append = false)
+                                  TSink& sink,
+                                  const etl::basic_format_spec<TIString>& format)
     {
-      typedef typename TIString::iterator          iterator;
       typedef typename TIString::value_type        type;
       typedef typename etl::make_unsigned<T>::type working_t;
 
-      if (!append)
-      {
-        str.clear();
-      }
-
-      iterator start = str.end();
-
       // Calculate the denominator.
       working_t denominator = 1U;
 
@@ -431,23 +689,33 @@ namespace etl
         fractional /= 10U;
       }    
 
+      // The length is only needed, and found, when there is a width.
+      size_t length = 0U;
+
+      if (format.get_width() != 0U)
+      {
+        etl::private_to_string::counting_sink<type> counter;
+        etl::private_to_string::add_integral_and_fractional(integral, fractional, counter, integral_format, fractional_format, etl::is_negative(value));
+        length = counter.size();
+      }
+
       // Create the string.
-      etl::private_to_string::add_integral_and_fractional(integral, fractional, str, integral_format, fractional_format, etl::is_negative(value));
-      etl::private_to_string::add_alignment(str, start, format);
+      etl::private_to_string::add_alignment(sink, length, format, true);
+      etl::private_to_string::add_integral_and_fractional(integral, fractional, sink, integral_format, fractional_format, etl::is_negative(value));
+      etl::private_to_string::add_alignment(sink, length, format, false);
     }
 
     //***************************************************************************
     /// Helper function for pointers.
     //***************************************************************************
-    template <typename TIString>
+    template <typename TSink, typename TIString>
     void add_pointer(const volatile void* value,
-                     TIString& str,
-                     const etl::basic_format_spec<TIString>& format,
-                     const bool append)
+                     TSink& sink,
+                     const etl::basic_format_spec<TIString>& format)
     {
       uintptr_t p = reinterpret_cast<uintptr_t>(value);
 
-      return etl::private_to_string::add_integral(p, str, format, append, false);
+      etl::private_to_string::add_integral(p, sink, format, false);
     }
 
     //***************************************************************************
@@ -464,11 +732,7 @@ namespace etl
         str.clear();
       }
 
-      typename TIString::iterator start = str.end();
-
-      str.insert(str.end(), value.begin(), value.end());
-
-      etl::private_to_string::add_alignment(str, start, format);
+      etl::private_to_string::add_aligned(str, value.begin(), value.end(), format);
     }
 
     //***************************************************************************
@@ -485,11 +749,7 @@ namespace etl
         str.clear();
       }
 
-      typename TIString::iterator start = str.end();
-
-      str.insert(str.end(), value.begin(), value.end());
-
-      etl::private_to_string::add_alignment(str, start, format);
+      etl::private_to_string::add_aligned(str, value.begin(), value.end(), format);
     }
 
     //*********************************************************************************************************
@@ -497,129 +757,152 @@ namespace etl
     //***************************************************************************
     /// For booleans.
     //***************************************************************************
-    template <typename TIString>
-    const TIString& to_string(const bool value,
-                              TIString& str,
-                              const etl::basic_format_spec<TIString>& format,
-                              const bool append = false)
+    template <typename TSink, typename TIString>
+    void add_value(const bool value,
+                   TSink& sink,
+                   const etl::basic_format_spec<TIString>& format)
     {
-      etl::private_to_string::add_boolean(value, str, format, append);
-
-      return str;
+      etl::private_to_string::add_boolean(value, sink, format);
     }
 
     //***************************************************************************
     /// For pointers.
     //***************************************************************************
-    template <typename TIString>
-    const TIString& to_string(const volatile void* value,
-                              TIString& str,
-                              const etl::basic_format_spec<TIString>& format,
-                              const bool append = false)
+    template <typename TSink, typename TIString>
+    void add_value(const volatile void* value,
+                   TSink& sink,
+                   const etl::basic_format_spec<TIString>& format)
     {
-      etl::private_to_string::add_pointer(value, str, format, append);
-
-      return str;
+      etl::private_to_string::add_pointer(value, sink, format);
     }
 
 #if ETL_USING_64BIT_TYPES
     //***************************************************************************
     /// For integrals less than 64 bits.
     //***************************************************************************
-    template <typename T, typename TIString>
+    template <typename T, typename TSink, typename TIString>
     typename etl::enable_if<etl::is_integral<T>::value &&
                             !etl::is_same<T, bool>::value &&
-                            !etl::is_one_of<T, int64_t, uint64_t>::value, const TIString&>::type
-      to_string(const T value, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
+                            !etl::is_one_of<T, int64_t, uint64_t>::value, void>::type
+      add_value(const T value, TSink& sink, const etl::basic_format_spec<TIString>& format)
     {
       typedef typename etl::conditional<etl::is_signed<T>::value, int32_t, uint32_t>::type type;
 
-      etl::private_to_string::add_integral(type(value), str, format, append, etl::is_negative(value));
-
-      return str;
+      etl::private_to_string::add_integral(type(value), sink, format, etl::is_negative(value));
     }
 
     //***************************************************************************
     /// For 64 bit integrals.
     //***************************************************************************
-    template <typename T, typename TIString>
+    template <typename T, typename TSink, typename TIString>
     typename etl::enable_if<etl::is_integral<T>::value &&
                             !etl::is_same<T, bool>::value &&
-                            etl::is_one_of<T, int64_t, uint64_t>::value, const TIString&>::type
-      to_string(const T value, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
+                            etl::is_one_of<T, int64_t, uint64_t>::value, void>::type
+      add_value(const T value, TSink& sink, const etl::basic_format_spec<TIString>& format)
     {
-      etl::private_to_string::add_integral(value, str, format, append, etl::is_negative(value));
-
-      return str;
+      etl::private_to_string::add_integral(value, sink, format, etl::is_negative(value));
     }
 
     //***************************************************************************
     /// For denominated integrals less than 64 bits.
     //***************************************************************************
-    template <typename T, typename TIString>
+    template <typename T, typename TSink, typename TIString>
     typename etl::enable_if<etl::is_integral<T>::value &&
                             !etl::is_same<T, bool>::value &&
-                            !etl::is_one_of<T, int64_t, uint64_t>::value, const TIString&>::type
-      to_string(const T value, uint32_t denominator_exponent, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
+                            !etl::is_one_of<T, int64_t, uint64_t>::value, void>::type
+      add_value(const T value, uint32_t denominator_exponent, TSink& sink, const etl::basic_format_spec<TIString>& format)
     {
       typedef typename etl::conditional<etl::is_signed<T>::value, int32_t, uint32_t>::type type;
 
-      etl::private_to_string::add_integral_denominated(type(value), denominator_exponent, str, format, append);
-
-      return str;
+      etl::private_to_string::add_integral_denominated(type(value), denominator_exponent, sink, format);
     }
 
     //***************************************************************************
     /// For denominated 64 bit integrals.
     //***************************************************************************
-    template <typename T, typename TIString>
-    typename etl::enable_if<etl::is_integral<T>::value&&
-                            !etl::is_same<T, bool>::value&&
-                            etl::is_one_of<T, int64_t, uint64_t>::value, const TIString&>::type
-      to_string(const T value, uint32_t denominator_exponent, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
+    template <typename T, typename TSink, typename TIString>
+    typename etl::enable_if<etl::is_integral<T>::value &&
+                            !etl::is_same<T, bool>::value &&
+                            etl::is_one_of<T, int64_t, uint64_t>::value, void>::type
+      add_value(const T value, uint32_t denominator_exponent, TSink& sink, const etl::basic_format_spec<TIString>& format)
     {
-      etl::private_to_string::add_integral_denominated(value, denominator_exponent, str, format, append);
-
-      return str;
+      etl::private_to_string::add_integral_denominated(value, denominator_exponent, sink, format);
     }
 #else
     //***************************************************************************
     /// For integrals less than 64 bits.
     //***************************************************************************
-    template <typename T, typename TIString>
+    template <typename T, typename TSink, typename TIString>
     typename etl::enable_if<etl::is_integral<T>::value &&
-      !etl::is_same<T, bool>::value>::value, const TIString& > ::type
-      to_string(const T value, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
+                            !etl::is_same<T, bool>::value, void>::type
+      add_value(const T value, TSink& sink, const etl::basic_format_spec<TIString>& format)
     {
       typedef typename etl::conditional<etl::is_signed<T>::value, int32_t, uint32_t>::type type;
 
-      etl::private_to_string::add_integral(type(value), str, format, append, false);
-
-      return str;
+      etl::private_to_string::add_integral(type(value), sink, format, etl::is_negative(value));
     }
 
     //***************************************************************************
     /// For denominated integrals less than 64 bits.
     //***************************************************************************
-    template <typename T, typename TIString>
+    template <typename T, typename TSink, typename TIString>
     typename etl::enable_if<etl::is_integral<T>::value &&
-      !etl::is_same<T, bool>::value>::value, const TIString& > ::type
-      to_string(const T value, uint32_t denominator_exponent, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
+                            !etl::is_same<T, bool>::value, void>::type
+      add_value(const T value, uint32_t denominator_exponent, TSink& sink, const etl::basic_format_spec<TIString>& format)
     {
-      etl::private_to_string::add_integral_denominated(type(value), denominator_exponent, str, format, append, false);
+      typedef typename etl::conditional<etl::is_signed<T>::value, int32_t, uint32_t>::type type;
 
-      return str;
+      etl::private_to_string::add_integral_denominated(type(value), denominator_exponent, sink, format);
     }
 #endif
 
     //***************************************************************************
     /// For floating point.
     //***************************************************************************
+    template <typename T, typename TSink, typename TIString>
+    typename etl::enable_if<etl::is_floating_point<T>::value, void>::type
+      add_value(const T value, TSink& sink, const etl::basic_format_spec<TIString>& format)
+    {
+      etl::private_to_string::add_floating_point(value, sink, format);
+    }
+
+    //***************************************************************************
+    /// For strings.
+    /// Replaces the contents, unless appending.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    const TIString& to_string(const T value,
+                              TIString& str,
+                              const etl::basic_format_spec<TIString>& format,
+                              const bool append = false)
+    {
+      if (!append)
+      {
+        str.clear();
+      }
+
+      etl::private_to_string::add_value(value, str, format);
+
+      return str;
+    }
+
+    //***************************************************************************
+    /// For strings, denominated.
+    /// Replaces the contents, unless appending.
+    //***************************************************************************
     template <typename T, typename TIString>
-    typename etl::enable_if<etl::is_floating_point<T>::value, const TIString&>::type
-      to_string(const T value, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
+    const TIString& to_string(const T value,
+                              uint32_t denominator_exponent,
+                              TIString& str,
+                              const etl::basic_format_spec<TIString>& format,
+                              const bool append = false)
     {
-      etl::private_to_string::add_floating_point(value, str, format, append);
+      if (!append)
+      {
+        str.clear();
+      }
+
+      etl::private_to_string::add_value(value, denominator_exponent, str, format);
 
       return str;
     }
@@ -0,0 +1,458 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_TO_STRING_SHORTEST_INCLUDED
+#define ETL_TO_STRING_SHORTEST_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../limits.h"
+#include "../static_assert.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  namespace private_to_string
+  {
+    //*************************************************************************
+    /// The shortest decimal digits that convert back to the same floating point value.
+    /// The value is digits x 10^exponent.
+    /// Uses the Grisu2 algorithm (Florian Loitsch, "Printing Floating-Point Numbers
+    /// Quickly and Accurately with Integers"). The result always converts back to
+    /// the original value and is the shortest such representation for almost all values.
+    /// Only integer arithmetic is used and stack usage is fixed.
+    //*************************************************************************
+    struct shortest_digits
+    {
+      /// The maximum number of significant digits produced.
+      enum
+      {
+        Max_Digits = 17
+      };
+
+      char digits[Max_Digits + 1];
+      int  length;
+      int  exponent;
+    };
+
+    namespace private_grisu
+    {
+      //***********************************************************************
+      /// A 'do it yourself' floating point value, f x 2^e.
+      //***********************************************************************
+      struct diy_fp
+      {
+        diy_fp()
+          : f(0U)
+          , e(0)
+        {
+        }
+
+        diy_fp(uint64_t f_, int e_)
+          : f(f_)
+          , e(e_)
+        {
+        }
+
+        uint64_t f;
+        int      e;
+      };
+
+      //***********************************************************************
+      /// x - y, where the exponents are equal and x.f >= y.f.
+      //***********************************************************************
+      inline diy_fp subtract(const diy_fp& x, const diy_fp& y)
+      {
+        return diy_fp(x.f - y.f, x.e);
+      }
+
+      //***********************************************************************
+      /// The upper 64 bits of x * y, rounded.
+      //***********************************************************************
+      inline diy_fp multiply(const diy_fp& x, const diy_fp& y)
+      {
+        const uint64_t x_lo = x.f & 0xFFFFFFFFU;
+        const uint64_t x_hi = x.f >> 32U;
+        const uint64_t y_lo = y.f & 0xFFFFFFFFU;
+        const uint64_t y_hi = y.f >> 32U;
+
+        const uint64_t p0 = x_lo * y_lo;
+        const uint64_t p1 = x_lo * y_hi;
+        const uint64_t p2 = x_hi * y_lo;
+        const uint64_t p3 = x_hi * y_hi;
+
+        uint64_t q = (p0 >> 32U) + (p1 & 0xFFFFFFFFU) + (p2 & 0xFFFFFFFFU);
+        q += uint64_t(1U) << 31U; // Round.
+
+        return diy_fp(p3 + (p2 >> 32U) + (p1 >> 32U) + (q >> 32U), x.e + y.e + 64);
+      }
+
+      //***********************************************************************
+      /// Shifts the significand until the top bit is set.
+      //***********************************************************************
+      inline diy_fp normalise(diy_fp x)
+      {
+        while ((x.f >> 63U) == 0U)
+        {
+          x.f <<= 1U;
+          --x.e;
+        }
+
+        return x;
+      }
+
+      //***********************************************************************
+      /// Shifts the significand to give the target exponent.
+      //***********************************************************************
+      inline diy_fp normalise_to(const diy_fp& x, int target_exponent)
+      {
+        return diy_fp(x.f << (x.e - target_exponent), target_exponent);
+      }
+
+      //***********************************************************************
+      /// The value and the boundaries of the interval of real numbers that round to it.
+      //***********************************************************************
+      struct boundaries
+      {
+        diy_fp w;
+        diy_fp minus;
+        diy_fp plus;
+      };
+
+      //***********************************************************************
+      /// Gets the bits of a float or double.
+      //***********************************************************************
+      template <typename T>
+      struct float_bits
+      {
+        typedef typename etl::conditional<sizeof(T) == 4U, uint32_t, uint64_t>::type type;
+
+        static type get(T value)
+        {
+          type bits;
+          memcpy(&bits, &value, sizeof(bits));
+
+          return bits;
+        }
+      };
+
+      //***********************************************************************
+      /// Computes the normalised value and its boundaries.
+      /// The value must be finite and positive.
+      //***********************************************************************
+      template <typename T>
+      boundaries compute_boundaries(T value)
+      {
+        typedef typename float_bits<T>::type bits_t;
+
+        const int      precision  = etl::numeric_limits<T>::digits; // Including the hidden bit.
+        const int      bias       = etl::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+        const int      min_exp    = 1 - bias;
+        const uint64_t hidden_bit = uint64_t(1U) << (precision - 1);
+
+        const bits_t   bits     = float_bits<T>::get(value);
+        const uint64_t exponent = bits >> (precision - 1);
+        const uint64_t fraction = bits & (hidden_bit - 1U);
+
+        const diy_fp v = (exponent == 0U) ? diy_fp(fraction, min_exp)
+                                          : diy_fp(fraction + hidden_bit, int(exponent) - bias);
+
+        // The lower boundary is closer when the fraction is zero, except for the smallest normal.
+        const bool lower_boundary_is_closer = (fraction == 0U) && (exponent > 1U);
+
+        const diy_fp m_plus  = diy_fp((2U * v.f) + 1U, v.e - 1);
+        const diy_fp m_minus = lower_boundary_is_closer ? diy_fp((4U * v.f) - 1U, v.e - 2)
+                                                        : diy_fp((2U * v.f) - 1U, v.e - 1);
+
+        boundaries result;
+
+        result.plus  = normalise(m_plus);
+        result.minus = normalise_to(m_minus, result.plus.e);
+        result.w     = normalise(v);
+
+        return result;
+      }
+
+      //***********************************************************************
+      /// A cached power of ten, f x 2^e ~= 10^k.
+      //***********************************************************************
+      struct cached_power
+      {
+        uint64_t f;
+        int      e;
+        int      k;
+      };
+
+      /// The range of the binary exponent of the scaled value.
+      static ETL_CONSTANT int Alpha = -60;
+      static ETL_CONSTANT int Gamma = -32;
+
+      //***********************************************************************
+      /// Gets a power of ten, c, such that Alpha <= (e + c.e + 64) <= Gamma.
+      //***********************************************************************
+      inline cached_power get_cached_power(int e)
+      {
+        static const cached_power powers[] =
+        {
+          { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+          { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+          { 0xBE5691EF416BD60CULL, -1007, -284 },
+          { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+          { 0xD3515C2831559A83ULL,  -954, -268 },
+          { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+          { 0xEA9C227723EE8BCBULL,  -901, -252 },
+          { 0xAECC49914078536DULL,  -874, -244 },
+          { 0x823C12795DB6CE57ULL,  -847, -236 },
+          { 0xC21094364DFB5637ULL,  -821, -228 },
+          { 0x9096EA6F3848984FULL,  -794, -220 },
+          { 0xD77485CB25823AC7ULL,  -768, -212 },
+          { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+          { 0xEF340A98172AACE5ULL,  -715, -196 },
+          { 0xB23867FB2A35B28EULL,  -688, -188 },
+          { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+          { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+          { 0x936B9FCEBB25C996ULL,  -608, -164 },
+          { 0xDBAC6C247D62A584ULL,  -582, -156 },
+          { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+          { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+          { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+          { 0x87625F056C7C4A8BULL,  -475, -124 },
+          { 0xC9BCFF6034C13053ULL,  -449, -116 },
+          { 0x964E858C91BA2655ULL,  -422, -108 },
+          { 0xDFF9772470297EBDULL,  -396, -100 },
+          { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+          { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+          { 0xB94470938FA89BCFULL,  -316,  -76 },
+          { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+          { 0xCDB02555653131B6ULL,  -263,  -60 },
+          { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+          { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+          { 0xAA242499697392D3ULL,  -183,  -36 },
+          { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+          { 0xBCE5086492111AEBULL,  -130,  -20 },
+          { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+          { 0xD1B71758E219652CULL,   -77,   -4 },
+          { 0x9C40000000000000ULL,   -50,    4 },
+          { 0xE8D4A51000000000ULL,   -24,   12 },
+          { 0xAD78EBC5AC620000ULL,     3,   20 },
+          { 0x813F3978F8940984ULL,    30,   28 },
+          { 0xC097CE7BC90715B3ULL,    56,   36 },
+          { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+          { 0xD5D238A4ABE98068ULL,   109,   52 },
+          { 0x9F4F2726179A2245ULL,   136,   60 },
+          { 0xED63A231D4C4FB27ULL,   162,   68 },
+          { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+          { 0x83C7088E1AAB65DBULL,   216,   84 },
+          { 0xC45D1DF942711D9AULL,   242,   92 },
+          { 0x924D692CA61BE758ULL,   269,  100 },
+          { 0xDA01EE641A708DEAULL,   295,  108 },
+          { 0xA26DA3999AEF774AULL,   322,  116 },
+          { 0xF209787BB47D6B85ULL,   348,  124 },
+          { 0xB454E4A179DD1877ULL,   375,  132 },
+          { 0x865B86925B9BC5C2ULL,   402,  140 },
+          { 0xC83553C5C8965D3DULL,   428,  148 },
+          { 0x952AB45CFA97A0B3ULL,   455,  156 },
+          { 0xDE469FBD99A05FE3ULL,   481,  164 },
+          { 0xA59BC234DB398C25ULL,   508,  172 },
+          { 0xF6C69A72A3989F5CULL,   534,  180 },
+          { 0xB7DCBF5354E9BECEULL,   561,  188 },
+          { 0x88FCF317F22241E2ULL,   588,  196 },
+          { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+          { 0x98165AF37B2153DFULL,   641,  212 },
+          { 0xE2A0B5DC971F303AULL,   667,  220 },
+          { 0xA8D9D1535CE3B396ULL,   694,  228 },
+          { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+          { 0xBB764C4CA7A44410ULL,   747,  244 },
+          { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+          { 0xD01FEF10A657842CULL,   800,  260 },
+          { 0x9B10A4E5E9913129ULL,   827,  268 },
+          { 0xE7109BFBA19C0C9DULL,   853,  276 },
+          { 0xAC2820D9623BF429ULL,   880,  284 },
+          { 0x80444B5E7AA7CF85ULL,   907,  292 },
+          { 0xBF21E44003ACDD2DULL,   933,  300 },
+          { 0x8E679C2F5E44FF8FULL,   960,  308 },
+          { 0xD433179D9C8CB841ULL,   986,  316 },
+          { 0x9E19DB92B4E31BA9ULL,  1013,  324 },
+        };
+
+        const int min_decimal_exponent = -300;
+        const int decimal_step         = 8;
+
+        // k = ceil((Alpha - e - 1) * log10(2))
+        const int f = Alpha - e - 1;
+        const int k = ((f * 78913) / (1 << 18)) + ((f > 0) ? 1 : 0);
+
+        const size_t index = static_cast<size_t>((-min_decimal_exponent + k + (decimal_step - 1)) / decimal_step);
+
+        return powers[index];
+      }
+
+      //***********************************************************************
+      /// Gets the number of decimal digits in n and the largest power of ten not greater than n.
+      //***********************************************************************
+      inline int find_largest_power_of_10(uint32_t n, uint32_t& power_of_10)
+      {
+        int      digits = 10;
+        uint32_t power  = 1000000000U;
+
+        while ((digits > 1) && (n < power))
+        {
+          power /= 10U;
+          --digits;
+        }
+
+        power_of_10 = power;
+
+        return digits;
+      }
+
+      //***********************************************************************
+      /// Moves the last digit towards w while it stays within the interval.
+      //***********************************************************************
+      inline void round_towards_w(char* buffer, int length, uint64_t distance, uint64_t delta, uint64_t rest, uint64_t ten_k)
+      {
+        while ((rest < distance) &&
+               ((delta - rest) >= ten_k) &&
+               (((rest + ten_k) < distance) || ((distance - rest) > (rest + ten_k - distance))))
+        {
+          --buffer[length - 1];
+          rest += ten_k;
+        }
+      }
+
+      //***********************************************************************
+      /// Generates the shortest digits of a value in the interval (m_minus, m_plus).
+      //***********************************************************************
+      inline void generate_digits(shortest_digits& result, diy_fp m_minus, diy_fp w, diy_fp m_plus)
+      {
+        uint64_t delta    = subtract(m_plus, m_minus).f;
+        uint64_t distance = subtract(m_plus, w).f;
+
+        const diy_fp one(uint64_t(1U) << -m_plus.e, m_plus.e);
+        const int    shift = -one.e;
+
+        uint32_t p1 = static_cast<uint32_t>(m_plus.f >> shift); // The integral part.
+        uint64_t p2 = m_plus.f & (one.f - 1U);                  // The fractional part.
+
+        // The integral digits.
+        uint32_t power_of_10;
+        int n = find_largest_power_of_10(p1, power_of_10);
+
+        while (n > 0)
+        {
+          const uint32_t digit = p1 / power_of_10;
+          p1 %= power_of_10;
+          --n;
+
+          result.digits[result.length++] = static_cast<char>('0' + digit);
+
+          const uint64_t rest = (uint64_t(p1) << shift) + p2;
+
+          if (rest <= delta)
+          {
+            result.exponent += n;
+            round_towards_w(result.digits, result.length, distance, delta, rest, uint64_t(power_of_10) << shift);
+            return;
+          }
+
+          power_of_10 /= 10U;
+        }
+
+        // The fractional digits.
+        int m = 0;
+
+        for (;;)
+        {
+          p2 *= 10U;
+          const uint64_t digit = p2 >> shift;
+          p2 &= (one.f - 1U);
+          ++m;
+
+          result.digits[result.length++] = static_cast<char>('0' + digit);
+
+          delta    *= 10U;
+          distance *= 10U;
+
+          if (p2 <= delta)
+          {
+            break;
+          }
+        }
+
+        result.exponent -= m;
+        round_towards_w(result.digits, result.length, distance, delta, p2, one.f);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the shortest digits of a finite, positive float or double.
+    //*************************************************************************
+    template <typename T>
+    shortest_digits get_shortest_digits(T value)
+    {
+      using namespace etl::private_to_string::private_grisu;
+
+      ETL_STATIC_ASSERT((etl::is_same<T, float>::value || etl::is_same<T, double>::value), "Only float and double are supported");
+
+      shortest_digits result;
+      result.length   = 0;
+      result.exponent = 0;
+
+      const boundaries b = compute_boundaries(value);
+
+      const cached_power cached = get_cached_power(b.plus.e);
+      const diy_fp       c(cached.f, cached.e);
+
+      const diy_fp w       = multiply(b.w, c);
+      const diy_fp w_minus = multiply(b.minus, c);
+      const diy_fp w_plus  = multiply(b.plus, c);
+
+      // Shrink the interval by one unit at each end to allow for the multiplication errors.
+      const diy_fp m_minus(w_minus.f + 1U, w_minus.e);
+      const diy_fp m_plus(w_plus.f - 1U, w_plus.e);
+
+      result.exponent = -cached.k;
+
+      generate_digits(result, m_minus, w, m_plus);
+
+      result.digits[result.length] = '\0';
+
+      return result;
+    }
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,209 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TREE_NODE_LINK_INCLUDED
+#define ETL_TREE_NODE_LINK_INCLUDED
+
+#include "../platform.h"
+#include "../integral_limits.h"
+#include "../type_traits.h"
+#include "../static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// The links between the nodes of etl::map, etl::multimap, etl::set and
+// etl::multiset.
+// By default a link is a node pointer.
+// Define ETL_USE_COMPACT_TREE_NODES to store each link as a signed offset
+// from the link to the node that it refers to, in units of the offset type's
+// alignment. The offset type is int32_t, or ETL_COMPACT_TREE_NODE_OFFSET_TYPE
+// if defined. An int16_t offset can address pools of up to 64K bytes.
+// The fixed capacity containers static assert that their pool is in range.
+// The pool of an _ext container must be no larger than the range.
+// The setting must be the same in every translation unit.
+//*****************************************************************************
+
+#if defined(ETL_USE_COMPACT_TREE_NODES) && !defined(ETL_COMPACT_TREE_NODE_OFFSET_TYPE)
+  #define ETL_COMPACT_TREE_NODE_OFFSET_TYPE int32_t
+#endif
+
+namespace etl
+{
+  namespace private_tree
+  {
+    //*************************************************************************
+    /// A link to a node, stored as an offset from the link.
+    /// Behaves as a TNode*.
+    //*************************************************************************
+    template <typename TNode, typename TOffset>
+    class node_offset_link
+    {
+    public:
+
+      ETL_STATIC_ASSERT(etl::is_signed<TOffset>::value, "The offset type must be signed");
+
+      static ETL_CONSTANT size_t Scale = etl::alignment_of<TOffset>::value;
+
+      //***********************************************************************
+      /// A null link.
+      //***********************************************************************
+      node_offset_link()
+        : offset(0)
+      {
+      }
+
+      //***********************************************************************
+      /// Refers to the node.
+      //***********************************************************************
+      node_offset_link(TNode* p_node)
+        : offset(0)
+      {
+        set(p_node);
+      }
+
+      //***********************************************************************
+      /// Refers to the same node as the other link.
+      //***********************************************************************
+      node_offset_link(const node_offset_link& other)
+        : offset(0)
+      {
+        set(other.get());
+      }
+
+      //***********************************************************************
+      /// Refers to the same node as the other link.
+      //***********************************************************************
+      node_offset_link& operator =(const node_offset_link& other)
+      {
+        set(other.get());
+
+        return *this;
+      }
+
+      //***********************************************************************
+      /// Refers to the node.
+      //***********************************************************************
+      node_offset_link& operator =(TNode* p_node)
+      {
+        set(p_node);
+
+        return *this;
+      }
+
+      //***********************************************************************
+      /// The node, or null.
+      //***********************************************************************
+      operator TNode*() const
+      {
+        return get();
+      }
+
+      //***********************************************************************
+      TNode* operator ->() const
+      {
+        return get();
+      }
+
+      //***********************************************************************
+      TNode& operator *() const
+      {
+        return *get();
+      }
+
+    private:
+
+      //***********************************************************************
+      TNode* get() const
+      {
+        if (offset == 0)
+        {
+          return ETL_NULLPTR;
+        }
+
+        char* p_this = const_cast<char*>(reinterpret_cast<const char*>(this));
+
+        return reinterpret_cast<TNode*>(p_this + (ptrdiff_t(offset) * ptrdiff_t(Scale)));
+      }
+
+      //***********************************************************************
+      void set(TNode* p_node)
+      {
+        if (p_node == ETL_NULLPTR)
+        {
+          offset = 0;
+        }
+        else
+        {
+          const ptrdiff_t difference = reinterpret_cast<const char*>(p_node) - reinterpret_cast<const char*>(this);
+
+          offset = TOffset(difference / ptrdiff_t(Scale));
+        }
+      }
+
+      TOffset offset;
+    };
+
+    template <typename TNode, typename TOffset>
+    ETL_CONSTANT size_t node_offset_link<TNode, TOffset>::Scale;
+
+    //*************************************************************************
+    /// The link type for a tree node.
+    //*************************************************************************
+    template <typename TNode>
+    struct node_link
+    {
+#if defined(ETL_USE_COMPACT_TREE_NODES)
+      typedef node_offset_link<TNode, ETL_COMPACT_TREE_NODE_OFFSET_TYPE> type;
+#else
+      typedef TNode* type;
+#endif
+    };
+
+    //*************************************************************************
+    /// Is a pool of Pool_Size bytes addressable by the links?
+    //*************************************************************************
+    template <size_t Pool_Size>
+    struct node_link_in_range
+    {
+#if defined(ETL_USE_COMPACT_TREE_NODES)
+      static ETL_CONSTANT bool value = (Pool_Size / etl::alignment_of<ETL_COMPACT_TREE_NODE_OFFSET_TYPE>::value) <= size_t(etl::integral_limits<ETL_COMPACT_TREE_NODE_OFFSET_TYPE>::max);
+#else
+      static ETL_CONSTANT bool value = true;
+#endif
+    };
+
+    template <size_t Pool_Size>
+    ETL_CONSTANT bool node_link_in_range<Pool_Size>::value;
+  }
+}
+
+#endif
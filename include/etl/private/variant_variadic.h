@@ -1050,21 +1050,35 @@ namespace etl
 
 #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
     //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
+    /// Call the relevant visitor through a table indexed by the type index.
     //***************************************************************************
     template <typename TVisitor, size_t... I>
     void do_visitor(TVisitor& visitor, etl::index_sequence<I...>)
     {
-      (attempt_visitor<I>(visitor) || ...);
+      using function_type = void(*)(variant&, TVisitor&);
+
+      static constexpr function_type jump_table[] = { &variant::template visit_alternative<I, variant, TVisitor>... };
+
+      if (index() != variant_npos)
+      {
+        jump_table[index()](*this, visitor);
+      }
     }
 
     //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
+    /// Call the relevant visitor through a table indexed by the type index.
     //***************************************************************************
     template <typename TVisitor, size_t... I>
     void do_visitor(TVisitor& visitor, etl::index_sequence<I...>) const
     {
-      (attempt_visitor<I>(visitor) || ...);
+      using function_type = void(*)(const variant&, TVisitor&);
+
+      static constexpr function_type jump_table[] = { &variant::template visit_alternative<I, const variant, TVisitor>... };
+
+      if (index() != variant_npos)
+      {
+        jump_table[index()](*this, visitor);
+      }
     }
 #else
     //***************************************************************************
@@ -1169,64 +1183,50 @@ namespace etl
 #endif
 
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call a visitor with the alternative at Index.
+    /// An entry in the visitor jump table.
     //***************************************************************************
-    template <size_t Index, typename TVisitor>
-    bool attempt_visitor(TVisitor& visitor)
+    template <size_t Index, typename TVariant, typename TVisitor>
+    static void visit_alternative(TVariant& variant_, TVisitor& visitor)
     {
-      if (Index == index())
-      {
-        // Workaround for MSVC (2023/05/13)
-        // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly for C++17 & C++20.
-        // Changed all of the instances for consistency.
-        auto& v = etl::get<Index>(*this);
-        visitor.visit(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
-    }
-
-    //***************************************************************************
-    /// Attempt to call a visitor.
-    //***************************************************************************
-    template <size_t Index, typename TVisitor>
-    bool attempt_visitor(TVisitor& visitor) const
-    {
-      if (Index == index())
-      {
-        // Workaround for MSVC (2023/05/13)
-        // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly for C++17 & C++20.
-        // Changed all of the instances for consistency.
-        auto& v = etl::get<Index>(*this);
-        visitor.visit(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      // Workaround for MSVC (2023/05/13)
+      // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly for C++17 & C++20.
+      // Changed all of the instances for consistency.
+      auto& v = etl::get<Index>(variant_);
+      visitor.visit(v);
     }
 
 #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
     //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
+    /// Call the relevant visitor through a table indexed by the type index.
     //***************************************************************************
     template <typename TVisitor, size_t... I>
     void do_operator(TVisitor& visitor, etl::index_sequence<I...>)
     {
-      (attempt_operator<I>(visitor) || ...);
+      using function_type = void(*)(variant&, TVisitor&);
+
+      static constexpr function_type jump_table[] = { &variant::template call_alternative<I, variant, TVisitor>... };
+
+      if (index() != variant_npos)
+      {
+        jump_table[index()](*this, visitor);
+      }
     }
 
     //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
+    /// Call the relevant visitor through a table indexed by the type index.
     //***************************************************************************
     template <typename TVisitor, size_t... I>
     void do_operator(TVisitor& visitor, etl::index_sequence<I...>) const
     {
-      (attempt_operator<I>(visitor) || ...);
+      using function_type = void(*)(const variant&, TVisitor&);
+
+      static constexpr function_type jump_table[] = { &variant::template call_alternative<I, const variant, TVisitor>... };
+
+      if (index() != variant_npos)
+      {
+        jump_table[index()](*this, visitor);
+      }
     }
 #else
     //***************************************************************************
@@ -1359,39 +1359,14 @@ namespace etl
 #endif
 
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call a functor with the alternative at Index.
+    /// An entry in the functor jump table.
     //***************************************************************************
-    template <size_t Index, typename TVisitor>
-    bool attempt_operator(TVisitor& visitor)
+    template <size_t Index, typename TVariant, typename TVisitor>
+    static void call_alternative(TVariant& variant_, TVisitor& visitor)
     {
-      if (Index == index())
-      {
-        auto& v = etl::get<Index>(*this);
-        visitor(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
-    }
-
-    //***************************************************************************
-    /// Attempt to call a visitor.
-    //***************************************************************************
-    template <size_t Index, typename TVisitor>
-    bool attempt_operator(TVisitor& visitor) const
-    {
-      if (Index == index())
-      {
-        auto& v = etl::get<Index>(*this);
-        visitor(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      auto& v = etl::get<Index>(variant_);
+      visitor(v);
     }
 
     //***************************************************************************
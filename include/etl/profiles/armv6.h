@@ -37,6 +37,9 @@ SOFTWARE.
 
 #define ETL_TARGET_DEVICE_ARM
 #define ETL_TARGET_OS_NONE
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 32
+#endif
 #define ETL_COMPILER_CLANG
 #define ETL_CPP11_SUPPORTED 1
 #define ETL_CPP14_SUPPORTED 0
@@ -96,6 +96,113 @@ SOFTWARE.
   #define ETL_USING_BUILTIN_IS_TRIVIALLY_COPYABLE 0
 #endif
 
+//*************************************
+// Hardware CRC support.
+// Opt-in by defining ETL_USE_CRC_INTRINSICS.
+// x86 : SSE4.2 supplies the CRC32-C instruction.
+// ARM : The ARMv8 CRC32 extension supplies both CRC32 and CRC32-C instructions.
+#if defined(ETL_USE_CRC_INTRINSICS)
+  #if !defined(ETL_USING_BUILTIN_CRC32_C)
+    #if defined(__SSE4_2__) || (defined(_MSC_VER) && defined(__AVX__))
+      #define ETL_USING_BUILTIN_CRC32_C 1
+    #elif defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+      #define ETL_USING_BUILTIN_CRC32_C 1
+    #endif
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_CRC32)
+    #if defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+      #define ETL_USING_BUILTIN_CRC32 1
+    #endif
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CRC32_C)
+  #define ETL_USING_BUILTIN_CRC32_C 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CRC32)
+  #define ETL_USING_BUILTIN_CRC32 0
+#endif
+
+//*************************************
+// SIMD byte shuffles.
+// Opt-in by defining ETL_USE_SIMD_INTRINSICS.
+// x86 : SSSE3 supplies the PSHUFB instruction.
+// ARM : NEON supplies the VREV instructions.
+#if defined(ETL_USE_SIMD_INTRINSICS)
+  #if !defined(ETL_USING_BUILTIN_SSSE3)
+    #if defined(__SSSE3__) || (defined(_MSC_VER) && defined(__AVX__))
+      #define ETL_USING_BUILTIN_SSSE3 1
+    #endif
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_NEON)
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+      #define ETL_USING_BUILTIN_NEON 1
+    #endif
+  #endif
+
+  // x86 : BMI2 supplies the PEXT instruction.
+  #if !defined(ETL_USING_BUILTIN_BMI2)
+    #if defined(__BMI2__) && (defined(__x86_64__) || defined(_M_X64))
+      #define ETL_USING_BUILTIN_BMI2 1
+    #endif
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_SSSE3)
+  #define ETL_USING_BUILTIN_SSSE3 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_NEON)
+  #define ETL_USING_BUILTIN_NEON 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_BMI2)
+  #define ETL_USING_BUILTIN_BMI2 0
+#endif
+
+//*************************************
+// Data prefetch hint.
+#if !defined(ETL_USING_BUILTIN_PREFETCH)
+  #if defined(__GNUC__) || defined(__clang__)
+    #define ETL_USING_BUILTIN_PREFETCH 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_PREFETCH)
+  #define ETL_USING_BUILTIN_PREFETCH 0
+#endif
+
+//*************************************
+// Byte swap.
+#if !defined(ETL_USING_BUILTIN_BSWAP)
+  #if defined(__GNUC__) || defined(__clang__)
+    #define ETL_USING_BUILTIN_BSWAP 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_BSWAP)
+  #define ETL_USING_BUILTIN_BSWAP 0
+#endif
+
+//*************************************
+// Detection of constant evaluation.
+#if !defined(ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+      #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 1
+    #endif
+  #elif defined(_MSC_VER) && (_MSC_VER >= 1925)
+    #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+  #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 0
+#endif
+
 namespace etl
 {
   namespace traits
@@ -107,6 +214,14 @@ namespace etl
     static ETL_CONSTANT bool using_builtin_is_trivially_constructible = (ETL_USING_BUILTIN_IS_TRIVIALLY_CONSTRUCTIBLE == 1);
     static ETL_CONSTANT bool using_builtin_is_trivially_destructible  = (ETL_USING_BUILTIN_IS_TRIVIALLY_DESTRUCTIBLE == 1);
     static ETL_CONSTANT bool using_builtin_is_trivially_copyable      = (ETL_USING_BUILTIN_IS_TRIVIALLY_COPYABLE == 1);
+    static ETL_CONSTANT bool using_builtin_crc32_c                    = (ETL_USING_BUILTIN_CRC32_C == 1);
+    static ETL_CONSTANT bool using_builtin_crc32                      = (ETL_USING_BUILTIN_CRC32 == 1);
+    static ETL_CONSTANT bool using_builtin_ssse3                      = (ETL_USING_BUILTIN_SSSE3 == 1);
+    static ETL_CONSTANT bool using_builtin_neon                       = (ETL_USING_BUILTIN_NEON == 1);
+    static ETL_CONSTANT bool using_builtin_bmi2                       = (ETL_USING_BUILTIN_BMI2 == 1);
+    static ETL_CONSTANT bool using_builtin_prefetch                   = (ETL_USING_BUILTIN_PREFETCH == 1);
+    static ETL_CONSTANT bool using_builtin_bswap                      = (ETL_USING_BUILTIN_BSWAP == 1);
+    static ETL_CONSTANT bool using_builtin_is_constant_evaluated      = (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1);
   }
 }
 
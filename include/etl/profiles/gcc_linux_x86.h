@@ -37,5 +37,8 @@ SOFTWARE.
 
 #define ETL_TARGET_DEVICE_X86
 #define ETL_TARGET_OS_LINUX
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
 
 #endif
@@ -37,6 +37,9 @@ SOFTWARE.
 
 #define ETL_TARGET_DEVICE_X86
 #define ETL_TARGET_OS_LINUX
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
 #define ETL_NO_STL
 
 #endif
@@ -0,0 +1,399 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUANTILE_SKETCH_INCLUDED
+#define ETL_QUANTILE_SKETCH_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup quantile_sketch quantile_sketch
+/// A fixed memory streaming quantile estimator.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup quantile_sketch
+  /// Exception base for quantile sketches.
+  //***************************************************************************
+  class quantile_sketch_exception : public exception
+  {
+  public:
+
+    quantile_sketch_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup quantile_sketch
+  /// The relative accuracy or minimum value is out of range.
+  //***************************************************************************
+  class quantile_sketch_invalid_parameter : public quantile_sketch_exception
+  {
+  public:
+
+    quantile_sketch_invalid_parameter(string_type file_name_, numeric_type line_number_)
+      : quantile_sketch_exception(ETL_ERROR_TEXT("quantile_sketch:invalid parameter", ETL_QUANTILE_SKETCH_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup quantile_sketch
+  /// The sketches to merge do not have the same buckets.
+  //***************************************************************************
+  class quantile_sketch_incompatible : public quantile_sketch_exception
+  {
+  public:
+
+    quantile_sketch_incompatible(string_type file_name_, numeric_type line_number_)
+      : quantile_sketch_exception(ETL_ERROR_TEXT("quantile_sketch:incompatible", ETL_QUANTILE_SKETCH_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup quantile_sketch
+  /// A streaming quantile estimator with logarithmically sized buckets, in
+  /// the style of DDSketch.
+  /// Bucket k counts the values in (gamma^(k-1), gamma^k], where
+  /// gamma = (1 + relative_accuracy) / (1 - relative_accuracy), so every
+  /// quantile is reported within the relative accuracy of a true sample.
+  /// The buckets start at the bucket containing min_value. Smaller values,
+  /// including zero and negative values, are counted in the first bucket and
+  /// values beyond the last bucket are counted in the last one. Reported
+  /// quantiles are clamped to the smallest and largest values added.
+  /// Adding a value is O(1). A quantile query is O(Bucket_Count).
+  /// Sketches with the same parameters may be merged, for example to combine
+  /// the sketches kept by each core.
+  ///\tparam Bucket_Count The number of buckets.
+  ///\tparam TCount       The type used to count the values in a bucket.
+  //***************************************************************************
+  template <size_t Bucket_Count_, typename TCount = uint32_t>
+  class quantile_sketch
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Bucket_Count_ != 0U, "The bucket count must not be zero");
+    ETL_STATIC_ASSERT(etl::is_integral<TCount>::value, "Only integral count allowed");
+
+    static ETL_CONSTANT size_t Bucket_Count = Bucket_Count_;
+
+    typedef double value_type;
+    typedef TCount count_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param relative_accuracy_ The relative accuracy of the quantiles, between 0 and 1 exclusive.
+    ///\param min_value_         The smallest value with full accuracy. Must be greater than zero.
+    //*************************************************************************
+    quantile_sketch(double relative_accuracy_, double min_value_)
+      : accuracy(relative_accuracy_)
+      , gamma((1.0 + relative_accuracy_) / (1.0 - relative_accuracy_))
+      , inverse_log_gamma(1.0 / log(gamma))
+      , first_key(0)
+    {
+      ETL_ASSERT((relative_accuracy_ > 0.0) && (relative_accuracy_ < 1.0) && (min_value_ > 0.0), ETL_ERROR(quantile_sketch_invalid_parameter));
+
+      first_key = key_of(min_value_);
+
+      clear();
+    }
+
+    //*************************************************************************
+    /// Adds a value.
+    //*************************************************************************
+    void add(double value)
+    {
+      ++buckets[bucket_of(value)];
+
+      if ((total == 0U) || (value < smallest))
+      {
+        smallest = value;
+      }
+
+      if ((total == 0U) || (value > largest))
+      {
+        largest = value;
+      }
+
+      ++total;
+    }
+
+    //*************************************************************************
+    /// Adds a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(double(*first));
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a value.
+    //*************************************************************************
+    void operator ()(double value)
+    {
+      add(value);
+    }
+
+    //*************************************************************************
+    /// Adds a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*************************************************************************
+    /// Adds the counts of another sketch with the same parameters.
+    //*************************************************************************
+    void merge(const quantile_sketch& other)
+    {
+      ETL_ASSERT_OR_RETURN(is_compatible(other), ETL_ERROR(quantile_sketch_incompatible));
+
+      if (other.total == 0U)
+      {
+        return;
+      }
+
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        buckets[i] += other.buckets[i];
+      }
+
+      if ((total == 0U) || (other.smallest < smallest))
+      {
+        smallest = other.smallest;
+      }
+
+      if ((total == 0U) || (other.largest > largest))
+      {
+        largest = other.largest;
+      }
+
+      total += other.total;
+    }
+
+    //*************************************************************************
+    /// Gets the estimated value at quantile q.
+    ///\param q The quantile, between 0 and 1. 0.99 is the 99th percentile.
+    ///\return The estimate, or zero if no values have been added.
+    //*************************************************************************
+    double quantile(double q) const
+    {
+      if (total == 0U)
+      {
+        return 0.0;
+      }
+
+      if (q <= 0.0)
+      {
+        return smallest;
+      }
+
+      if (q >= 1.0)
+      {
+        return largest;
+      }
+
+      const TCount rank = TCount(q * double(total - 1U));
+
+      TCount cumulative = 0U;
+      size_t index      = 0U;
+
+      while (index < (Bucket_Count - 1U))
+      {
+        cumulative += buckets[index];
+
+        if (cumulative > rank)
+        {
+          break;
+        }
+
+        ++index;
+      }
+
+      double estimate = (2.0 * pow(gamma, double(first_key + int(index)))) / (gamma + 1.0);
+
+      if (estimate < smallest)
+      {
+        estimate = smallest;
+      }
+
+      if (estimate > largest)
+      {
+        estimate = largest;
+      }
+
+      return estimate;
+    }
+
+    //*************************************************************************
+    /// Gets the estimated value at percentile p.
+    ///\param p The percentile, between 0 and 100.
+    //*************************************************************************
+    double percentile(double p) const
+    {
+      return quantile(p / 100.0);
+    }
+
+    //*************************************************************************
+    /// Gets the number of values added.
+    //*************************************************************************
+    TCount count() const
+    {
+      return total;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if no values have been added.
+    //*************************************************************************
+    bool empty() const
+    {
+      return total == 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the smallest value added.
+    //*************************************************************************
+    double min() const
+    {
+      return smallest;
+    }
+
+    //*************************************************************************
+    /// Gets the largest value added.
+    //*************************************************************************
+    double max() const
+    {
+      return largest;
+    }
+
+    //*************************************************************************
+    /// Gets the relative accuracy.
+    //*************************************************************************
+    double relative_accuracy() const
+    {
+      return accuracy;
+    }
+
+    //*************************************************************************
+    /// Gets the count in bucket i.
+    //*************************************************************************
+    TCount operator [](size_t i) const
+    {
+      return buckets[i];
+    }
+
+    //*************************************************************************
+    /// Clears the sketch.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        buckets[i] = TCount(0);
+      }
+
+      total    = TCount(0);
+      smallest = 0.0;
+      largest  = 0.0;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The logarithmic key of a positive value.
+    //*************************************************************************
+    int key_of(double value) const
+    {
+      return int(ceil(log(value) * inverse_log_gamma));
+    }
+
+    //*************************************************************************
+    /// The bucket for a value.
+    //*************************************************************************
+    size_t bucket_of(double value) const
+    {
+      if (!(value > 0.0))
+      {
+        return 0U;
+      }
+
+      const int key = key_of(value) - first_key;
+
+      if (key <= 0)
+      {
+        return 0U;
+      }
+
+      return (size_t(key) >= Bucket_Count) ? (Bucket_Count - 1U) : size_t(key);
+    }
+
+    //*************************************************************************
+    /// Two sketches are compatible if their buckets cover the same values.
+    //*************************************************************************
+    bool is_compatible(const quantile_sketch& other) const
+    {
+      return (first_key == other.first_key) && !(gamma < other.gamma) && !(other.gamma < gamma);
+    }
+
+    double accuracy;
+    double gamma;
+    double inverse_log_gamma;
+    int    first_key;
+    TCount buckets[Bucket_Count_];
+    TCount total;
+    double smallest;
+    double largest;
+  };
+
+  template <size_t Bucket_Count_, typename TCount>
+  ETL_CONSTANT size_t quantile_sketch<Bucket_Count_, TCount>::Bucket_Count;
+}
+
+#endif
@@ -38,6 +38,7 @@ SOFTWARE.
 #include "exception.h"
 #include "error_handler.h"
 #include "debug_count.h"
+#include "container_statistics.h"
 #include "type_traits.h"
 #include "parameter_type.h"
 #include "memory_model.h"
@@ -310,6 +311,8 @@ namespace etl
     //*************************************************************************
     void push(const_reference value)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(queue_full));
 #endif
@@ -325,6 +328,8 @@ namespace etl
     //*************************************************************************
     void push(rvalue_reference value)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(queue_full));
 #endif
@@ -342,6 +347,8 @@ namespace etl
     template <typename ... Args>
     void emplace(Args && ... args)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(queue_full));
 #endif
@@ -356,6 +363,8 @@ namespace etl
     //*************************************************************************
     void emplace()
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(queue_full));
 #endif
@@ -371,6 +380,8 @@ namespace etl
     template <typename T1>
     void emplace(const T1& value1)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(queue_full));
 #endif
@@ -386,6 +397,8 @@ namespace etl
     template <typename T1, typename T2>
     void emplace(const T1& value1, const T2& value2)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(queue_full));
 #endif
@@ -401,6 +414,8 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     void emplace(const T1& value1, const T2& value2, const T3& value3)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(queue_full));
 #endif
@@ -416,6 +431,8 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     void emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(queue_full));
 #endif
@@ -453,6 +470,8 @@ namespace etl
     //*************************************************************************
     void pop()
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!empty(), ETL_ERROR(queue_empty));
 #endif
@@ -483,6 +502,24 @@ namespace etl
       pop();
     }
 
+#if ETL_HAS_CONTAINER_STATISTICS
+    //*************************************************************************
+    /// Gets the operation statistics.
+    //*************************************************************************
+    etl::container_statistics& get_statistics()
+    {
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Gets the operation statistics.
+    //*************************************************************************
+    const etl::container_statistics& get_statistics() const
+    {
+      return statistics;
+    }
+#endif
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -565,6 +602,10 @@ namespace etl
 
     T* p_buffer; ///< The internal buffer.
 
+#if ETL_HAS_CONTAINER_STATISTICS
+    etl::container_statistics statistics; ///< The operation statistics.
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -0,0 +1,656 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup queue_mpmc_atomic queue_mpmc_atomic
+/// A lock free, fixed capacity, multiple producer, multiple consumer queue.
+/// Each slot carries a sequence number that tells producers and consumers
+/// whether it is free, full, or still owned by another thread.
+///\ingroup containers
+
+namespace etl
+{
+  template <size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      // Read the dequeue position first, so that it can never overtake the enqueue position.
+      size_type dequeue_pos = dequeue_position.load(etl::memory_order_acquire);
+      size_type enqueue_pos = enqueue_position.load(etl::memory_order_acquire);
+
+      size_type n = distance(dequeue_pos, enqueue_pos);
+
+      return (n > MAX_SIZE) ? MAX_SIZE : n;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : enqueue_position(0),
+        dequeue_position(0),
+        MAX_SIZE(max_size_),
+        WRAP(size_type((etl::integral_limits<size_type>::max / max_size_) * max_size_))
+    {
+    }
+
+    //*************************************************************************
+    /// Advances a position by n, modulo WRAP.
+    //*************************************************************************
+    size_type advance(size_type position, size_type n) const
+    {
+      return (position >= size_type(WRAP - n)) ? size_type(position - (WRAP - n)) : size_type(position + n);
+    }
+
+    //*************************************************************************
+    /// The distance from one position to another, modulo WRAP.
+    //*************************************************************************
+    size_type distance(size_type from, size_type to) const
+    {
+      return (to >= from) ? size_type(to - from) : size_type(WRAP - from + to);
+    }
+
+    //*************************************************************************
+    /// Is 'to' at or ahead of 'from'?
+    /// Positions less than half of WRAP ahead are considered to be ahead.
+    //*************************************************************************
+    bool is_ahead(size_type from, size_type to) const
+    {
+      return distance(from, to) < (WRAP / 2U);
+    }
+
+    etl::atomic<size_type> enqueue_position; ///< Where to input new data.
+    etl::atomic<size_type> dequeue_position; ///< Where to get the oldest data.
+    const size_type        MAX_SIZE;         ///< The maximum number of items in the queue.
+    const size_type        WRAP;             ///< Positions and sequences are counted modulo this multiple of MAX_SIZE.
+
+  private:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  ///\brief This is the base for all queue_mpmc_atomics that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 10> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef typename etl::queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_USING_CPP11
+    typedef T&&                        rvalue_reference;///< An rvalue_reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+    using base_t::enqueue_position;
+    using base_t::dequeue_position;
+    using base_t::MAX_SIZE;
+    using base_t::advance;
+    using base_t::distance;
+    using base_t::is_ahead;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->data()) T(value);
+        commit_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->data()) T(etl::move(value));
+        commit_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->data()) T(etl::forward<Args>(args)...);
+        commit_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    bool emplace()
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->data()) T();
+        commit_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->data()) T(value1);
+        commit_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->data()) T(value1, value2);
+        commit_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->data()) T(value1, value2, value3);
+        commit_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->data()) T(value1, value2, value3, value4);
+        commit_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_type position;
+      cell*     p_cell = claim_pop(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        value = etl::move(*p_cell->data());
+#else
+        value = *p_cell->data();
+#endif
+        p_cell->data()->~T();
+        commit_pop(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      size_type position;
+      cell*     p_cell = claim_pop(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        p_cell->data()->~T();
+        commit_pop(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Peek a value at the front of the queue.
+    /// Only valid when there is a single consumer and the queue is not empty.
+    //*************************************************************************
+    reference front()
+    {
+      return *p_cells[dequeue_position.load(etl::memory_order_relaxed) % MAX_SIZE].data();
+    }
+
+    //*************************************************************************
+    /// Peek a value at the front of the queue.
+    /// Only valid when there is a single consumer and the queue is not empty.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return *p_cells[dequeue_position.load(etl::memory_order_relaxed) % MAX_SIZE].data();
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Pops until the queue is seen as empty.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A slot in the queue.
+    /// The sequence tells whether the slot is ready to be written or read
+    /// for a particular position.
+    //*************************************************************************
+    struct cell
+    {
+      T* data()
+      {
+        return reinterpret_cast<T*>(&storage);
+      }
+
+      const T* data() const
+      {
+        return reinterpret_cast<const T*>(&storage);
+      }
+
+      etl::atomic<size_type> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage;
+    };
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(cell* p_cells_, size_type max_size_)
+      : base_t(max_size_),
+        p_cells(p_cells_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets each slot ready to be written for its first position.
+    /// Called from the derived class once the buffer has been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0U; i < MAX_SIZE; ++i)
+      {
+        p_cells[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims the next slot to push to.
+    /// Returns ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    cell* claim_push(size_type& position)
+    {
+      position = enqueue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell&     c        = p_cells[position % MAX_SIZE];
+        size_type sequence = c.sequence.load(etl::memory_order_acquire);
+
+        if (sequence == position)
+        {
+          // The slot is free for this position. Try to take it.
+          if (enqueue_position.compare_exchange_weak(position, advance(position, 1U), etl::memory_order_relaxed))
+          {
+            return &c;
+          }
+        }
+        else if (is_ahead(position, sequence))
+        {
+          // Another producer has taken this position.
+          position = enqueue_position.load(etl::memory_order_relaxed);
+        }
+        else
+        {
+          // The slot still holds the value from the previous lap.
+          return ETL_NULLPTR;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Publishes a pushed slot to the consumers.
+    //*************************************************************************
+    void commit_push(cell* p_cell, size_type position)
+    {
+      p_cell->sequence.store(advance(position, 1U), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Claims the next slot to pop from.
+    /// Returns ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    cell* claim_pop(size_type& position)
+    {
+      position = dequeue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell&     c        = p_cells[position % MAX_SIZE];
+        size_type sequence = c.sequence.load(etl::memory_order_acquire);
+        size_type expected = advance(position, 1U);
+
+        if (sequence == expected)
+        {
+          // The slot holds a value for this position. Try to take it.
+          if (dequeue_position.compare_exchange_weak(position, expected, etl::memory_order_relaxed))
+          {
+            return &c;
+          }
+        }
+        else if (is_ahead(expected, sequence))
+        {
+          // Another consumer has taken this position.
+          position = dequeue_position.load(etl::memory_order_relaxed);
+        }
+        else
+        {
+          // The slot has not been written for this position yet.
+          return ETL_NULLPTR;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Releases a popped slot to the producers of the next lap.
+    //*************************************************************************
+    void commit_pop(cell* p_cell, size_type position)
+    {
+      p_cell->sequence.store(advance(position, MAX_SIZE), etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&) = delete;
+    iqueue_mpmc_atomic& operator =(iqueue_mpmc_atomic&&) = delete;
+#endif
+
+    cell* p_cells; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  /// A fixed capacity, lock free mpmc queue.
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef typename etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT((SIZE >= 2U), "Size must be at least 2");
+    ETL_STATIC_ASSERT((SIZE <= (etl::integral_limits<size_type>::max / 4U)), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(&buffer[0], MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    /// The slots used in the queue_mpmc_atomic.
+    typename base_t::cell buffer[MAX_SIZE];
+  };
+
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL>
+  ETL_CONSTANT typename queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::size_type queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::MAX_SIZE;
+}
+
+#endif
+
+#endif
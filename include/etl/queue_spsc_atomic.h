@@ -39,6 +39,8 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "iterator.h"
+#include "power.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -47,6 +49,16 @@ SOFTWARE.
 
 namespace etl
 {
+  //***************************************************************************
+  /// The base for all queue_spsc_atomics.
+  /// Each thread keeps a cached copy of the other thread's index and only
+  /// reloads the shared index when the copy says that the queue is full or empty.
+  /// When the capacity is a power of two the indices are free running counters,
+  /// the slot is selected with a mask and no slot is reserved to tell 'full'
+  /// from 'empty'.
+  /// Define ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE (e.g. ETL_CACHE_LINE_SIZE) to place the 'push'
+  /// and 'pop' indices on separate cache lines.
+  //***************************************************************************
   template <size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
   class queue_spsc_atomic_base
   {
@@ -72,9 +84,7 @@ namespace etl
     //*************************************************************************
     bool full() const
     {
-      size_type next_index = get_next_index(write.load(etl::memory_order_acquire), RESERVED);
-
-      return (next_index == read.load(etl::memory_order_acquire));
+      return size() == MAX_ITEMS;
     }
 
     //*************************************************************************
@@ -86,18 +96,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_acquire);
       size_type read_index = read.load(etl::memory_order_acquire);
 
-      size_type n;
-
-      if (write_index >= read_index)
-      {
-        n = write_index - read_index;
-      }
-      else
-      {
-        n = RESERVED - read_index + write_index;
-      }
-
-      return n;
+      return used(write_index, read_index);
     }
 
     //*************************************************************************
@@ -106,7 +105,7 @@ namespace etl
     //*************************************************************************
     size_type available() const
     {
-      return RESERVED - size() - 1;
+      return MAX_ITEMS - size();
     }
 
     //*************************************************************************
@@ -114,7 +113,7 @@ namespace etl
     //*************************************************************************
     size_type capacity() const
     {
-      return RESERVED - 1;
+      return MAX_ITEMS;
     }
 
     //*************************************************************************
@@ -122,20 +121,62 @@ namespace etl
     //*************************************************************************
     size_type max_size() const
     {
-      return RESERVED - 1;
+      return MAX_ITEMS;
     }
 
   protected:
 
-    queue_spsc_atomic_base(size_type reserved_)
+    //*************************************************************************
+    /// Constructor.
+    ///\param reserved_     The number of slots in the buffer.
+    ///\param free_running_ <b>true</b> if the number of slots is a power of two
+    /// and the indices are free running counters.
+    //*************************************************************************
+    queue_spsc_atomic_base(size_type reserved_, bool free_running_ = false)
       : write(0),
+        cached_read(0),
         read(0),
-        RESERVED(reserved_)
+        cached_write(0),
+        RESERVED(reserved_),
+        MAX_ITEMS(free_running_ ? reserved_ : size_type(reserved_ - 1U)),
+        WRAP_INDEX(free_running_ ? size_type(0U) : reserved_),
+        INDEX_MASK(free_running_ ? size_type(reserved_ - 1U) : etl::integral_limits<size_type>::max)
     {
     }
 
+    //*************************************************************************
+    /// Is there space to push to write_index?
+    /// Called from the 'push' thread. Only reloads the shared read index when
+    /// the producer's cached copy says that the queue is full.
+    //*************************************************************************
+    bool has_space(size_type write_index)
+    {
+      if (used(write_index, cached_read) == MAX_ITEMS)
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+      }
+
+      return used(write_index, cached_read) != MAX_ITEMS;
+    }
+
+    //*************************************************************************
+    /// Is there data to pop from read_index?
+    /// Called from the 'pop' thread. Only reloads the shared write index when
+    /// the consumer's cached copy says that the queue is empty.
+    //*************************************************************************
+    bool has_data(size_type read_index)
+    {
+      if (read_index == cached_write)
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+      }
+
+      return read_index != cached_write;
+    }
+
     //*************************************************************************
     /// Calculate the next index.
+    /// A maximum of zero lets a free running counter wrap naturally.
     //*************************************************************************
     static size_type get_next_index(size_type index, size_type maximum)
     {
@@ -149,9 +190,43 @@ namespace etl
       return index;
     }
 
-    etl::atomic<size_type> write; ///< Where to input new data.
-    etl::atomic<size_type> read;  ///< Where to get the oldest data.
-    const size_type RESERVED;     ///< The maximum number of items in the queue.
+    //*************************************************************************
+    /// The number of items between read_index and write_index.
+    //*************************************************************************
+    size_type used(size_type write_index, size_type read_index) const
+    {
+      size_type n = size_type(write_index - read_index);
+
+      if (write_index < read_index)
+      {
+        n = size_type(n + WRAP_INDEX);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The buffer slot for an index.
+    //*************************************************************************
+    size_type get_slot(size_type index) const
+    {
+      return size_type(index & INDEX_MASK);
+    }
+
+    etl::atomic<size_type> write;        ///< Where to input new data.
+    size_type              cached_read;  ///< The 'push' thread's copy of read.
+#if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE)
+    char write_padding[ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE - sizeof(etl::atomic<size_type>) - sizeof(size_type)];
+#endif
+    etl::atomic<size_type> read;         ///< Where to get the oldest data.
+    size_type              cached_write; ///< The 'pop' thread's copy of write.
+#if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE)
+    char read_padding[ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE - sizeof(etl::atomic<size_type>) - sizeof(size_type)];
+#endif
+    const size_type        RESERVED;     ///< The number of slots in the buffer.
+    const size_type        MAX_ITEMS;    ///< The maximum number of items in the queue.
+    const size_type        WRAP_INDEX;   ///< The index that wraps to zero. Zero if free running.
+    const size_type        INDEX_MASK;   ///< The mask from an index to a slot.
 
   private:
 
@@ -201,8 +276,12 @@ namespace etl
 
     using base_t::write;
     using base_t::read;
-    using base_t::RESERVED;
+    using base_t::WRAP_INDEX;
     using base_t::get_next_index;
+    using base_t::get_slot;
+    using base_t::used;
+    using base_t::has_space;
+    using base_t::has_data;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -210,11 +289,11 @@ namespace etl
     bool push(const_reference value)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index, WRAP_INDEX);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(write_index))
       {
-        ::new (&p_buffer[write_index]) T(value);
+        ::new (&p_buffer[get_slot(write_index)]) T(value);
 
         write.store(next_index, etl::memory_order_release);
 
@@ -232,11 +311,11 @@ namespace etl
     bool push(rvalue_reference value)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index = get_next_index(write_index, RESERVED);
+      size_type next_index = get_next_index(write_index, WRAP_INDEX);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(write_index))
       {
-        ::new (&p_buffer[write_index]) T(etl::move(value));
+        ::new (&p_buffer[get_slot(write_index)]) T(etl::move(value));
 
         write.store(next_index, etl::memory_order_release);
 
@@ -257,11 +336,11 @@ namespace etl
     bool emplace(Args&&... args)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index, WRAP_INDEX);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(write_index))
       {
-        ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
+        ::new (&p_buffer[get_slot(write_index)]) T(etl::forward<Args>(args)...);
 
         write.store(next_index, etl::memory_order_release);
 
@@ -279,11 +358,11 @@ namespace etl
     bool emplace()
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index = get_next_index(write_index, RESERVED);
+      size_type next_index = get_next_index(write_index, WRAP_INDEX);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(write_index))
       {
-        ::new (&p_buffer[write_index]) T();
+        ::new (&p_buffer[get_slot(write_index)]) T();
 
         write.store(next_index, etl::memory_order_release);
 
@@ -302,11 +381,11 @@ namespace etl
     bool emplace(const T1& value1)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index, WRAP_INDEX);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(write_index))
       {
-        ::new (&p_buffer[write_index]) T(value1);
+        ::new (&p_buffer[get_slot(write_index)]) T(value1);
 
         write.store(next_index, etl::memory_order_release);
 
@@ -325,11 +404,11 @@ namespace etl
     bool emplace(const T1& value1, const T2& value2)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index, WRAP_INDEX);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(write_index))
       {
-        ::new (&p_buffer[write_index]) T(value1, value2);
+        ::new (&p_buffer[get_slot(write_index)]) T(value1, value2);
 
         write.store(next_index, etl::memory_order_release);
 
@@ -348,11 +427,11 @@ namespace etl
     bool emplace(const T1& value1, const T2& value2, const T3& value3)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index, WRAP_INDEX);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(write_index))
       {
-        ::new (&p_buffer[write_index]) T(value1, value2, value3);
+        ::new (&p_buffer[get_slot(write_index)]) T(value1, value2, value3);
 
         write.store(next_index, etl::memory_order_release);
 
@@ -371,11 +450,11 @@ namespace etl
     bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type next_index  = get_next_index(write_index, RESERVED);
+      size_type next_index  = get_next_index(write_index, WRAP_INDEX);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (has_space(write_index))
       {
-        ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
+        ::new (&p_buffer[get_slot(write_index)]) T(value1, value2, value3, value4);
 
         write.store(next_index, etl::memory_order_release);
 
@@ -394,13 +473,13 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!has_data(read_index))
       {
         // Queue is empty
         return false;
       }
 
-      value = p_buffer[read_index];
+      value = p_buffer[get_slot(read_index)];
 
       return true;
     }
@@ -412,21 +491,21 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!has_data(read_index))
       {
         // Queue is empty
         return false;
       }
 
-      size_type next_index = get_next_index(read_index, RESERVED);
+      size_type next_index = get_next_index(read_index, WRAP_INDEX);
 
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
-      value = etl::move(p_buffer[read_index]);
+      value = etl::move(p_buffer[get_slot(read_index)]);
 #else
-      value = p_buffer[read_index];
+      value = p_buffer[get_slot(read_index)];
 #endif
 
-      p_buffer[read_index].~T();
+      p_buffer[get_slot(read_index)].~T();
 
       read.store(next_index, etl::memory_order_release);
 
@@ -440,21 +519,67 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!has_data(read_index))
       {
         // Queue is empty
         return false;
       }
 
-      size_type next_index = get_next_index(read_index, RESERVED);
+      size_type next_index = get_next_index(read_index, WRAP_INDEX);
 
-      p_buffer[read_index].~T();
+      p_buffer[get_slot(read_index)].~T();
 
       read.store(next_index, etl::memory_order_release);
 
       return true;
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue.
+    /// The write index is published once for the whole batch.
+    ///\param p_values A pointer to the values to push.
+    ///\param n        The number of values.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_t push(const T* p_values, size_t n)
+    {
+      return push_n(p_values, n);
+    }
+
+    //*************************************************************************
+    /// Push values from a range to the queue, until the queue is full.
+    /// The write index is published once for the whole batch.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t push(TIterator first, TIterator last)
+    {
+      return push_n(first, static_cast<size_t>(etl::distance(first, last)));
+    }
+
+    //*************************************************************************
+    /// Pop up to max_n values from the queue.
+    /// The read index is published once for the whole batch.
+    ///\param p_values A pointer to the destination.
+    ///\param max_n    The maximum number of values to pop.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_t pop(T* p_values, size_t max_n)
+    {
+      return pop_n(p_values, max_n);
+    }
+
+    //*************************************************************************
+    /// Pop values from the queue to a range, until the range is full or the queue is empty.
+    /// The read index is published once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t pop(TIterator first, TIterator last)
+    {
+      return pop_n(first, static_cast<size_t>(etl::distance(first, last)));
+    }
+
     //*************************************************************************
     /// Peek a value from the front of the queue.
     //*************************************************************************
@@ -462,7 +587,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      return p_buffer[read_index];
+      return p_buffer[get_slot(read_index)];
     }
 
     //*************************************************************************
@@ -472,7 +597,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      return p_buffer[read_index];
+      return p_buffer[get_slot(read_index)];
     }
 
     //*************************************************************************
@@ -493,14 +618,71 @@ namespace etl
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
-    iqueue_spsc_atomic(T* p_buffer_, size_type reserved_)
-      : base_t(reserved_),
+    iqueue_spsc_atomic(T* p_buffer_, size_type reserved_, bool free_running_ = false)
+      : base_t(reserved_, free_running_),
         p_buffer(p_buffer_)
     {
     }
 
   private:
 
+    //*************************************************************************
+    /// Push up to n values from an iterator.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t push_n(TIterator first, size_t n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type read_index  = read.load(etl::memory_order_acquire);
+
+      this->cached_read = read_index;
+
+      size_t free_space = size_t(this->MAX_ITEMS - used(write_index, read_index));
+      size_t count = (n < free_space) ? n : free_space;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        ::new (&p_buffer[get_slot(write_index)]) T(*first);
+        ++first;
+        write_index = get_next_index(write_index, WRAP_INDEX);
+      }
+
+      write.store(write_index, etl::memory_order_release);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_n values to an iterator.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t pop_n(TIterator first, size_t max_n)
+    {
+      size_type read_index  = read.load(etl::memory_order_relaxed);
+      size_type write_index = write.load(etl::memory_order_acquire);
+
+      this->cached_write = write_index;
+
+      size_t n_used = size_t(used(write_index, read_index));
+      size_t count  = (max_n < n_used) ? max_n : n_used;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        *first = etl::move(p_buffer[get_slot(read_index)]);
+#else
+        *first = p_buffer[get_slot(read_index)];
+#endif
+        p_buffer[get_slot(read_index)].~T();
+        ++first;
+        read_index = get_next_index(read_index, WRAP_INDEX);
+      }
+
+      read.store(read_index, etl::memory_order_release);
+
+      return count;
+    }
+
     // Disable copy construction and assignment.
     iqueue_spsc_atomic(const iqueue_spsc_atomic&) ETL_DELETE;
     iqueue_spsc_atomic& operator =(const iqueue_spsc_atomic&) ETL_DELETE;
@@ -517,6 +699,7 @@ namespace etl
   ///\ingroup queue_spsc
   /// A fixed capacity spsc queue.
   /// This queue supports concurrent access by one producer and one consumer.
+  /// If SIZE is a power of two the indices are masked free running counters.
   /// \tparam T            The type this queue should support.
   /// \tparam SIZE         The maximum capacity of the queue.
   /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
@@ -534,7 +717,8 @@ namespace etl
 
   private:
 
-    static ETL_CONSTANT size_type RESERVED_SIZE = size_type(SIZE + 1);
+    static ETL_CONSTANT bool      FREE_RUNNING  = etl::is_power_of_2<SIZE>::value;
+    static ETL_CONSTANT size_type RESERVED_SIZE = size_type(FREE_RUNNING ? SIZE : SIZE + 1);
 
   public:
 
@@ -546,7 +730,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     queue_spsc_atomic()
-      : base_t(reinterpret_cast<T*>(&buffer[0]), RESERVED_SIZE)
+      : base_t(reinterpret_cast<T*>(&buffer[0]), RESERVED_SIZE, FREE_RUNNING)
     {
     }
 
@@ -38,6 +38,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "iterator.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -106,6 +107,44 @@ namespace etl
       return pop_implementation();
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue from an ISR.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_t push_from_isr(const T* p_values, size_t n)
+    {
+      return push_n_implementation(p_values, n);
+    }
+
+    //*************************************************************************
+    /// Push values from a range to the queue from an ISR, until the queue is full.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t push_from_isr(TIterator first, TIterator last)
+    {
+      return push_n_implementation(first, static_cast<size_t>(etl::distance(first, last)));
+    }
+
+    //*************************************************************************
+    /// Pop up to max_n values from the queue from an ISR.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_t pop_from_isr(T* p_values, size_t max_n)
+    {
+      return pop_n_implementation(p_values, max_n);
+    }
+
+    //*************************************************************************
+    /// Pop values from the queue to a range from an ISR, until the range is full or the queue is empty.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t pop_from_isr(TIterator first, TIterator last)
+    {
+      return pop_n_implementation(first, static_cast<size_t>(etl::distance(first, last)));
+    }
+
     //*************************************************************************
     /// Peek a value at the front of the queue from an ISR
     //*************************************************************************
@@ -435,6 +474,60 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Push up to n values from an iterator.
+    /// The indexes and size are updated once for the whole batch.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t push_n_implementation(TIterator first, size_t n)
+    {
+      size_t free_space = size_t(MAX_SIZE - current_size);
+      size_t count      = (n < free_space) ? n : free_space;
+
+      size_type index = write_index;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        ::new (&p_buffer[index]) T(*first);
+        ++first;
+        index = get_next_index(index, MAX_SIZE);
+      }
+
+      write_index   = index;
+      current_size += size_type(count);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_n values to an iterator.
+    /// The indexes and size are updated once for the whole batch.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t pop_n_implementation(TIterator first, size_t max_n)
+    {
+      size_t count = (max_n < size_t(current_size)) ? max_n : size_t(current_size);
+
+      size_type index = read_index;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
+        *first = etl::move(p_buffer[index]);
+#else
+        *first = p_buffer[index];
+#endif
+        p_buffer[index].~T();
+        ++first;
+        index = get_next_index(index, MAX_SIZE);
+      }
+
+      read_index    = index;
+      current_size -= size_type(count);
+
+      return count;
+    }
+
     //*************************************************************************
     /// Calculate the next index.
     //*************************************************************************
@@ -657,6 +750,72 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue.
+    /// The interrupts are locked once for the whole batch.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_t push(const T* p_values, size_t n)
+    {
+      TAccess::lock();
+
+      size_t result = this->push_n_implementation(p_values, n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Push values from a range to the queue, until the queue is full.
+    /// The interrupts are locked once for the whole batch.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t push(TIterator first, TIterator last)
+    {
+      TAccess::lock();
+
+      size_t result = this->push_n_implementation(first, static_cast<size_t>(etl::distance(first, last)));
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_n values from the queue.
+    /// The interrupts are locked once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_t pop(T* p_values, size_t max_n)
+    {
+      TAccess::lock();
+
+      size_t result = this->pop_n_implementation(p_values, max_n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop values from the queue to a range, until the range is full or the queue is empty.
+    /// The interrupts are locked once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t pop(TIterator first, TIterator last)
+    {
+      TAccess::lock();
+
+      size_t result = this->pop_n_implementation(first, static_cast<size_t>(etl::distance(first, last)));
+
+      TAccess::unlock();
+
+      return result;
+    }
+
     //*************************************************************************
     /// Peek a value at the front of the queue.
     //*************************************************************************
@@ -39,6 +39,7 @@ SOFTWARE.
 #include "function.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "iterator.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -446,6 +447,114 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push up to n values to the queue.
+    /// Unlocked
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_t push_from_unlocked(const T* p_values, size_t n)
+    {
+      return push_n_implementation(p_values, n);
+    }
+
+    //*************************************************************************
+    /// Push up to n values to the queue.
+    /// Locks once for the whole batch.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_t push(const T* p_values, size_t n)
+    {
+      lock();
+
+      size_t result = push_n_implementation(p_values, n);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Push values from a range to the queue, until the queue is full.
+    /// Unlocked
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t push_from_unlocked(TIterator first, TIterator last)
+    {
+      return push_n_implementation(first, static_cast<size_t>(etl::distance(first, last)));
+    }
+
+    //*************************************************************************
+    /// Push values from a range to the queue, until the queue is full.
+    /// Locks once for the whole batch.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t push(TIterator first, TIterator last)
+    {
+      lock();
+
+      size_t result = push_n_implementation(first, static_cast<size_t>(etl::distance(first, last)));
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_n values from the queue.
+    /// Unlocked
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_t pop_from_unlocked(T* p_values, size_t max_n)
+    {
+      return pop_n_implementation(p_values, max_n);
+    }
+
+    //*************************************************************************
+    /// Pop up to max_n values from the queue.
+    /// Locks once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_t pop(T* p_values, size_t max_n)
+    {
+      lock();
+
+      size_t result = pop_n_implementation(p_values, max_n);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop values from the queue to a range, until the range is full or the queue is empty.
+    /// Unlocked
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t pop_from_unlocked(TIterator first, TIterator last)
+    {
+      return pop_n_implementation(first, static_cast<size_t>(etl::distance(first, last)));
+    }
+
+    //*************************************************************************
+    /// Pop values from the queue to a range, until the range is full or the queue is empty.
+    /// Locks once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t pop(TIterator first, TIterator last)
+    {
+      lock();
+
+      size_t result = pop_n_implementation(first, static_cast<size_t>(etl::distance(first, last)));
+
+      unlock();
+
+      return result;
+    }
+
     //*************************************************************************
     /// Peek a value from the front of the queue.
     /// Unlocked
@@ -589,6 +698,60 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Push up to n values from an iterator.
+    /// The indexes and size are updated once for the whole batch.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t push_n_implementation(TIterator first, size_t n)
+    {
+      size_t free_space = size_t(this->MAX_SIZE - this->current_size);
+      size_t count      = (n < free_space) ? n : free_space;
+
+      size_type index = this->write_index;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        ::new (&p_buffer[index]) T(*first);
+        ++first;
+        index = this->get_next_index(index, this->MAX_SIZE);
+      }
+
+      this->write_index   = index;
+      this->current_size += size_type(count);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_n values to an iterator.
+    /// The indexes and size are updated once for the whole batch.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t pop_n_implementation(TIterator first, size_t max_n)
+    {
+      size_t count = (max_n < size_t(this->current_size)) ? max_n : size_t(this->current_size);
+
+      size_type index = this->read_index;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKED_FORCE_CPP03_IMPLEMENTATION)
+        *first = etl::move(p_buffer[index]);
+#else
+        *first = p_buffer[index];
+#endif
+        p_buffer[index].~T();
+        ++first;
+        index = this->get_next_index(index, this->MAX_SIZE);
+      }
+
+      this->read_index    = index;
+      this->current_size -= size_type(count);
+
+      return count;
+    }
+
     //*************************************************************************
     /// Push a value to the queue.
     //*************************************************************************
@@ -0,0 +1,1060 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_RADIX_MAP_INCLUDED
+#define ETL_RADIX_MAP_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "string_view.h"
+#include "alignment.h"
+#include "placement_new.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup radix_map radix_map
+/// A map from byte string keys to values, held as a compressed trie
+/// (radix tree) in fixed storage.
+/// Each node holds the bytes of the edge from its parent, so a lookup costs
+/// one step per edge of the key, and compares each byte of the key once,
+/// however many entries there are.
+/// The edge bytes of every node share one pool of Key_Bytes bytes. Erasing
+/// leaves gaps, which are compacted when an insert would not otherwise fit.
+/// Keys may be given as byte spans or as string views.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the radix_map.
+  ///\ingroup radix_map
+  //***************************************************************************
+  class radix_map_exception : public exception
+  {
+  public:
+
+    radix_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// There are not enough free nodes or key bytes for the insert.
+  ///\ingroup radix_map
+  //***************************************************************************
+  class radix_map_full : public radix_map_exception
+  {
+  public:
+
+    radix_map_full(string_type file_name_, numeric_type line_number_)
+      : radix_map_exception(ETL_ERROR_TEXT("radix_map:full", ETL_RADIX_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The interface of a radix_map.
+  ///\ingroup radix_map
+  //***************************************************************************
+  template <typename TValue>
+  class iradix_map
+  {
+  public:
+
+    typedef TValue                   value_type;
+    typedef TValue&                  reference;
+    typedef const TValue&            const_reference;
+    typedef TValue*                  pointer;
+    typedef const TValue*            const_pointer;
+    typedef size_t                   size_type;
+    typedef etl::span<const uint8_t> key_type;
+
+    //*************************************************************************
+    /// The key as bytes.
+    //*************************************************************************
+    static key_type to_key(etl::string_view text)
+    {
+      return key_type(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    }
+
+    //*************************************************************************
+    /// The value for the key, or null if there is none.
+    //*************************************************************************
+    pointer find(key_type key)
+    {
+      const index_type n = find_node(key);
+
+      return ((n != Null) && p_nodes[n].has_value) ? &p_values[n] : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    const_pointer find(key_type key) const
+    {
+      const index_type n = find_node(key);
+
+      return ((n != Null) && p_nodes[n].has_value) ? &p_values[n] : ETL_NULLPTR;
+    }
+
+    pointer       find(etl::string_view key)       { return find(to_key(key)); }
+    const_pointer find(etl::string_view key) const { return find(to_key(key)); }
+
+    //*************************************************************************
+    /// Is there a value for the key?
+    //*************************************************************************
+    bool contains(key_type key) const
+    {
+      return find(key) != ETL_NULLPTR;
+    }
+
+    bool contains(etl::string_view key) const
+    {
+      return contains(to_key(key));
+    }
+
+    //*************************************************************************
+    /// Inserts the value for the key, if the key is not already present.
+    /// Returns false if it was present, or if there was no room.
+    //*************************************************************************
+    bool insert(key_type key, const_reference value)
+    {
+      const index_type n = insert_node(key);
+
+      if (n == Null)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(radix_map_full));
+        return false;
+      }
+
+      if (p_nodes[n].has_value)
+      {
+        return false;
+      }
+
+      ::new (&p_values[n]) value_type(value);
+      p_nodes[n].has_value = true;
+      ++value_count;
+
+      return true;
+    }
+
+    bool insert(etl::string_view key, const_reference value)
+    {
+      return insert(to_key(key), value);
+    }
+
+    //*************************************************************************
+    /// Inserts or replaces the value for the key.
+    /// Returns false if there was no room.
+    //*************************************************************************
+    bool insert_or_assign(key_type key, const_reference value)
+    {
+      const index_type n = insert_node(key);
+
+      if (n == Null)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(radix_map_full));
+        return false;
+      }
+
+      if (p_nodes[n].has_value)
+      {
+        p_values[n] = value;
+      }
+      else
+      {
+        ::new (&p_values[n]) value_type(value);
+        p_nodes[n].has_value = true;
+        ++value_count;
+      }
+
+      return true;
+    }
+
+    bool insert_or_assign(etl::string_view key, const_reference value)
+    {
+      return insert_or_assign(to_key(key), value);
+    }
+
+    //*************************************************************************
+    /// Erases the value for the key.
+    /// Returns false if there was none.
+    //*************************************************************************
+    bool erase(key_type key)
+    {
+      const index_type n = find_node(key);
+
+      if ((n == Null) || !p_nodes[n].has_value)
+      {
+        return false;
+      }
+
+      p_values[n].~value_type();
+      p_nodes[n].has_value = false;
+      --value_count;
+
+      tidy(n);
+
+      return true;
+    }
+
+    bool erase(etl::string_view key)
+    {
+      return erase(to_key(key));
+    }
+
+    //*************************************************************************
+    /// The value for the longest key that is a prefix of the key, or null if
+    /// there is none. The length of that key is written to length.
+    //*************************************************************************
+    pointer longest_prefix_match(key_type key, size_t& length)
+    {
+      return const_cast<pointer>(static_cast<const iradix_map&>(*this).longest_prefix_match(key, length));
+    }
+
+    //*************************************************************************
+    const_pointer longest_prefix_match(key_type key, size_t& length) const
+    {
+      index_type best = p_nodes[Root].has_value ? Root : Null;
+      size_t     pos  = 0U;
+
+      length = 0U;
+
+      index_type n = Root;
+
+      while (pos < key.size())
+      {
+        n = find_child(n, key[pos]);
+
+        if ((n == Null) || !label_matches(n, key, pos))
+        {
+          break;
+        }
+
+        pos += p_nodes[n].label_length;
+
+        if (p_nodes[n].has_value)
+        {
+          best   = n;
+          length = pos;
+        }
+      }
+
+      return (best != Null) ? &p_values[best] : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    pointer longest_prefix_match(key_type key)
+    {
+      size_t length;
+      return longest_prefix_match(key, length);
+    }
+
+    const_pointer longest_prefix_match(key_type key) const
+    {
+      size_t length;
+      return longest_prefix_match(key, length);
+    }
+
+    pointer       longest_prefix_match(etl::string_view key, size_t& length)       { return longest_prefix_match(to_key(key), length); }
+    const_pointer longest_prefix_match(etl::string_view key, size_t& length) const { return longest_prefix_match(to_key(key), length); }
+    pointer       longest_prefix_match(etl::string_view key)                       { return longest_prefix_match(to_key(key)); }
+    const_pointer longest_prefix_match(etl::string_view key) const                 { return longest_prefix_match(to_key(key)); }
+
+    //*************************************************************************
+    /// Calls f(value) for each value whose key starts with the prefix, in
+    /// key order. Returns the number of calls.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_prefixed(key_type prefix, TFunction f)
+    {
+      size_t length;
+      const index_type n = find_prefix_node(prefix, length);
+
+      return (n != Null) ? visit_values(n, f) : 0U;
+    }
+
+    template <typename TFunction>
+    size_t for_each_prefixed(etl::string_view prefix, TFunction f)
+    {
+      return for_each_prefixed(to_key(prefix), f);
+    }
+
+    //*************************************************************************
+    /// Calls f(key, value) for each value whose key starts with the prefix,
+    /// in key order. The key is assembled in the buffer, and is valid for the
+    /// call. Keys longer than the buffer are skipped.
+    /// Returns the number of calls.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_prefixed(key_type prefix, etl::span<uint8_t> buffer, TFunction f)
+    {
+      size_t length;
+      const index_type n = find_prefix_node(prefix, length);
+
+      if ((n == Null) || (length > buffer.size()))
+      {
+        return 0U;
+      }
+
+      // The prefix may end part way through the node's edge.
+      const size_t label_start = length - p_nodes[n].label_length;
+
+      memcpy(buffer.data(), prefix.data(), label_start);
+      memcpy(buffer.data() + label_start, p_bytes + p_nodes[n].label_offset, p_nodes[n].label_length);
+
+      return visit_keys(n, buffer, length, f);
+    }
+
+    template <typename TFunction>
+    size_t for_each_prefixed(etl::string_view prefix, etl::span<uint8_t> buffer, TFunction f)
+    {
+      return for_each_prefixed(to_key(prefix), buffer, f);
+    }
+
+    //*************************************************************************
+    /// Erases every value.
+    //*************************************************************************
+    void clear()
+    {
+      for (index_type i = 0U; i <= max_node_total; ++i)
+      {
+        if (p_nodes[i].has_value)
+        {
+          p_values[i].~value_type();
+        }
+      }
+
+      initialise();
+    }
+
+    //*************************************************************************
+    /// The number of values.
+    //*************************************************************************
+    size_t size() const
+    {
+      return value_count;
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return value_count == 0U;
+    }
+
+    //*************************************************************************
+    /// Are all of the nodes in use?
+    //*************************************************************************
+    bool full() const
+    {
+      return free_nodes == Null;
+    }
+
+    //*************************************************************************
+    /// The number of nodes in use, not counting the root.
+    //*************************************************************************
+    size_t node_count() const
+    {
+      return node_total;
+    }
+
+    //*************************************************************************
+    size_t max_nodes() const
+    {
+      return max_node_total;
+    }
+
+    //*************************************************************************
+    /// The number of key bytes held by the nodes.
+    //*************************************************************************
+    size_t key_bytes() const
+    {
+      return bytes_live;
+    }
+
+    //*************************************************************************
+    size_t max_key_bytes() const
+    {
+      return max_bytes;
+    }
+
+  protected:
+
+    typedef uint16_t index_type;
+
+    static ETL_CONSTANT index_type Null = 0xFFFFU;
+    static ETL_CONSTANT index_type Root = 0U;
+
+    //*************************************************************************
+    /// A node of the trie, and the edge to it from its parent.
+    /// Children are linked through next_sibling, in order of the first byte
+    /// of their edge. Free nodes have an edge of zero length.
+    //*************************************************************************
+    struct node
+    {
+      index_type label_offset;
+      index_type label_length;
+      index_type parent;
+      index_type first_child;
+      index_type next_sibling;
+      bool       has_value;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    /// p_nodes_ and p_values_ have max_nodes_ + 1 entries, the first being
+    /// the root, whose key is empty.
+    //*************************************************************************
+    iradix_map(node* p_nodes_, pointer p_values_, size_t max_nodes_, uint8_t* p_bytes_, size_t max_bytes_)
+      : p_nodes(p_nodes_)
+      , p_values(p_values_)
+      , p_bytes(p_bytes_)
+      , max_node_total(index_type(max_nodes_))
+      , max_bytes(index_type(max_bytes_))
+    {
+      for (index_type i = 0U; i <= max_node_total; ++i)
+      {
+        p_nodes[i].has_value = false;
+      }
+
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~iradix_map()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Does the node's edge match the key from pos?
+    //*************************************************************************
+    bool label_matches(index_type n, key_type key, size_t pos) const
+    {
+      const node& current = p_nodes[n];
+
+      return ((key.size() - pos) >= current.label_length) &&
+             (memcmp(p_bytes + current.label_offset, key.data() + pos, current.label_length) == 0);
+    }
+
+    //*************************************************************************
+    /// The child of n whose edge starts with the byte.
+    //*************************************************************************
+    index_type find_child(index_type n, uint8_t byte) const
+    {
+      index_type child = p_nodes[n].first_child;
+
+      while (child != Null)
+      {
+        const uint8_t first = p_bytes[p_nodes[child].label_offset];
+
+        if (first == byte)
+        {
+          return child;
+        }
+
+        if (first > byte)
+        {
+          break;
+        }
+
+        child = p_nodes[child].next_sibling;
+      }
+
+      return Null;
+    }
+
+    //*************************************************************************
+    /// The node for the key, with or without a value.
+    //*************************************************************************
+    index_type find_node(key_type key) const
+    {
+      index_type n   = Root;
+      size_t     pos = 0U;
+
+      while ((pos < key.size()) && (n != Null))
+      {
+        n = find_child(n, key[pos]);
+
+        if ((n != Null) && !label_matches(n, key, pos))
+        {
+          n = Null;
+        }
+
+        if (n != Null)
+        {
+          pos += p_nodes[n].label_length;
+        }
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The highest node whose key starts with the prefix.
+    /// length is set to the length of the node's key.
+    //*************************************************************************
+    index_type find_prefix_node(key_type prefix, size_t& length) const
+    {
+      index_type n   = Root;
+      size_t     pos = 0U;
+
+      while (pos < prefix.size())
+      {
+        n = find_child(n, prefix[pos]);
+
+        if (n == Null)
+        {
+          return Null;
+        }
+
+        const size_t compare_length = min_size(size_t(p_nodes[n].label_length), prefix.size() - pos);
+
+        if (memcmp(p_bytes + p_nodes[n].label_offset, prefix.data() + pos, compare_length) != 0)
+        {
+          return Null;
+        }
+
+        pos += p_nodes[n].label_length;
+      }
+
+      length = pos;
+
+      return n;
+    }
+
+    //*************************************************************************
+    static size_t min_size(size_t a, size_t b)
+    {
+      return (a < b) ? a : b;
+    }
+
+    //*************************************************************************
+    /// Visits the values of n and its descendants, in key order.
+    /// Recurses once per edge of the deepest key.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t visit_values(index_type n, TFunction& f)
+    {
+      size_t count = 0U;
+
+      if (p_nodes[n].has_value)
+      {
+        f(p_values[n]);
+        ++count;
+      }
+
+      for (index_type child = p_nodes[n].first_child; child != Null; child = p_nodes[child].next_sibling)
+      {
+        count += visit_values(child, f);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// As visit_values, with the first length bytes of the buffer holding the
+    /// key of n.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t visit_keys(index_type n, etl::span<uint8_t> buffer, size_t length, TFunction& f)
+    {
+      size_t count = 0U;
+
+      if (p_nodes[n].has_value)
+      {
+        f(key_type(buffer.data(), length), p_values[n]);
+        ++count;
+      }
+
+      for (index_type child = p_nodes[n].first_child; child != Null; child = p_nodes[child].next_sibling)
+      {
+        const node& current = p_nodes[child];
+
+        if ((length + current.label_length) <= buffer.size())
+        {
+          memcpy(buffer.data() + length, p_bytes + current.label_offset, current.label_length);
+          count += visit_keys(child, buffer, length + current.label_length, f);
+        }
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// The node for the key, created if need be.
+    /// Returns Null, having changed nothing, if there is not enough room.
+    //*************************************************************************
+    index_type insert_node(key_type key)
+    {
+      // Walk as far as the key matches, without changing anything.
+      index_type n      = Root;
+      index_type child  = Null;
+      size_t     pos    = 0U;
+      size_t     common = 0U;
+
+      while (pos < key.size())
+      {
+        child = find_child(n, key[pos]);
+
+        if (child == Null)
+        {
+          break;
+        }
+
+        common = common_length(child, key, pos);
+
+        if (common < p_nodes[child].label_length)
+        {
+          break;
+        }
+
+        n      = child;
+        child  = Null;
+        pos   += common;
+        common = 0U;
+      }
+
+      if (pos == key.size())
+      {
+        return n;
+      }
+
+      // The key diverges part way along the child's edge, or there is no child.
+      const bool   split      = (child != Null);
+      const size_t leaf_bytes = key.size() - pos - common;
+      const size_t new_nodes  = (split ? 1U : 0U) + ((leaf_bytes != 0U) ? 1U : 0U);
+
+      if ((free_node_count < new_nodes) || !reserve_bytes(leaf_bytes))
+      {
+        return Null;
+      }
+
+      if (split)
+      {
+        n    = split_node(child, common);
+        pos += common;
+      }
+
+      if (leaf_bytes != 0U)
+      {
+        n = add_leaf(n, key, pos);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The number of leading bytes of the node's edge that match the key from pos.
+    //*************************************************************************
+    size_t common_length(index_type n, key_type key, size_t pos) const
+    {
+      const node&   current = p_nodes[n];
+      const size_t  length  = min_size(size_t(current.label_length), key.size() - pos);
+      const uint8_t* p_label = p_bytes + current.label_offset;
+
+      size_t i = 0U;
+
+      while ((i < length) && (p_label[i] == key[pos + i]))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Splits the node's edge after length bytes.
+    /// The new node takes the place of n, with n as its only child.
+    /// Both edges keep their bytes where they are.
+    //*************************************************************************
+    index_type split_node(index_type n, size_t length)
+    {
+      const index_type m = allocate_node();
+
+      node& upper = p_nodes[m];
+      node& lower = p_nodes[n];
+
+      upper.label_offset = lower.label_offset;
+      upper.label_length = index_type(length);
+      upper.parent       = lower.parent;
+      upper.first_child  = n;
+      upper.next_sibling = lower.next_sibling;
+      upper.has_value    = false;
+
+      replace_child(lower.parent, n, m);
+
+      lower.label_offset = index_type(lower.label_offset + length);
+      lower.label_length = index_type(lower.label_length - length);
+      lower.parent       = m;
+      lower.next_sibling = Null;
+
+      return m;
+    }
+
+    //*************************************************************************
+    /// Adds a child of n with the rest of the key from pos as its edge.
+    /// The bytes have been reserved.
+    //*************************************************************************
+    index_type add_leaf(index_type n, key_type key, size_t pos)
+    {
+      const index_type leaf   = allocate_node();
+      const size_t     length = key.size() - pos;
+
+      node& current = p_nodes[leaf];
+
+      current.label_offset = bytes_used;
+      current.label_length = index_type(length);
+      current.parent       = n;
+      current.first_child  = Null;
+      current.next_sibling = Null;
+      current.has_value    = false;
+
+      memcpy(p_bytes + bytes_used, key.data() + pos, length);
+      bytes_used = index_type(bytes_used + length);
+      bytes_live = index_type(bytes_live + length);
+
+      // Link in order of the first byte.
+      const uint8_t first = key[pos];
+
+      index_type* p_link = &p_nodes[n].first_child;
+
+      while ((*p_link != Null) && (p_bytes[p_nodes[*p_link].label_offset] < first))
+      {
+        p_link = &p_nodes[*p_link].next_sibling;
+      }
+
+      current.next_sibling = *p_link;
+      *p_link = leaf;
+
+      return leaf;
+    }
+
+    //*************************************************************************
+    /// Replaces the child old_child of n with new_child, in the same place.
+    //*************************************************************************
+    void replace_child(index_type n, index_type old_child, index_type new_child)
+    {
+      index_type* p_link = &p_nodes[n].first_child;
+
+      while (*p_link != old_child)
+      {
+        p_link = &p_nodes[*p_link].next_sibling;
+      }
+
+      *p_link = new_child;
+    }
+
+    //*************************************************************************
+    /// Removes nodes that no longer hold a value or lead to one, and merges
+    /// a node without a value into its only child.
+    //*************************************************************************
+    void tidy(index_type n)
+    {
+      while ((n != Root) && !p_nodes[n].has_value)
+      {
+        node& current = p_nodes[n];
+
+        if (current.first_child == Null)
+        {
+          // A leaf. Unlink it, then look at its parent.
+          const index_type parent = current.parent;
+
+          index_type* p_link = &p_nodes[parent].first_child;
+
+          while (*p_link != n)
+          {
+            p_link = &p_nodes[*p_link].next_sibling;
+          }
+
+          *p_link = current.next_sibling;
+
+          free_node(n);
+          n = parent;
+        }
+        else
+        {
+          if (p_nodes[current.first_child].next_sibling == Null)
+          {
+            merge_with_child(n);
+          }
+
+          return;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Joins the edge of n to that of its only child, and frees n.
+    /// If the edges are not next to each other in the pool and there is no
+    /// room to join them, n is left in place.
+    //*************************************************************************
+    void merge_with_child(index_type n)
+    {
+      const index_type child = p_nodes[n].first_child;
+
+      const size_t upper_length = p_nodes[n].label_length;
+      const size_t lower_length = p_nodes[child].label_length;
+
+      if ((size_t(p_nodes[n].label_offset) + upper_length) != p_nodes[child].label_offset)
+      {
+        if (!reserve_bytes(upper_length + lower_length))
+        {
+          return;
+        }
+
+        // Offsets may have moved in compaction.
+        memcpy(p_bytes + bytes_used, p_bytes + p_nodes[n].label_offset, upper_length);
+        memcpy(p_bytes + bytes_used + upper_length, p_bytes + p_nodes[child].label_offset, lower_length);
+
+        bytes_live = index_type(bytes_live - lower_length);
+        p_nodes[child].label_offset = bytes_used;
+        bytes_used = index_type(bytes_used + upper_length + lower_length);
+        bytes_live = index_type(bytes_live + upper_length + lower_length);
+      }
+      else
+      {
+        p_nodes[child].label_offset = p_nodes[n].label_offset;
+        bytes_live = index_type(bytes_live + upper_length);
+      }
+
+      p_nodes[child].label_length = index_type(upper_length + lower_length);
+      p_nodes[child].parent       = p_nodes[n].parent;
+      p_nodes[child].next_sibling = p_nodes[n].next_sibling;
+
+      replace_child(p_nodes[n].parent, n, child);
+
+      free_node(n);
+    }
+
+    //*************************************************************************
+    /// Ensures that there are count bytes free at the end of the pool,
+    /// compacting it if need be.
+    //*************************************************************************
+    bool reserve_bytes(size_t count)
+    {
+      if ((size_t(bytes_used) + count) <= max_bytes)
+      {
+        return true;
+      }
+
+      if ((size_t(bytes_live) + count) > max_bytes)
+      {
+        return false;
+      }
+
+      compact();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Moves the edges down to close the gaps left by erased nodes.
+    /// The edges never overlap, so they are moved in order of offset.
+    /// Takes time proportional to the square of the number of nodes, and is
+    /// only needed when an insert would not otherwise fit.
+    //*************************************************************************
+    void compact()
+    {
+      size_t next_free = 0U;
+      size_t threshold = 0U;
+
+      while (true)
+      {
+        index_type lowest        = Null;
+        size_t     lowest_offset = max_bytes;
+
+        for (index_type i = 1U; i <= max_node_total; ++i)
+        {
+          const node& current = p_nodes[i];
+
+          if ((current.label_length != 0U) && (current.label_offset >= threshold) && (current.label_offset < lowest_offset))
+          {
+            lowest        = i;
+            lowest_offset = current.label_offset;
+          }
+        }
+
+        if (lowest == Null)
+        {
+          break;
+        }
+
+        node& current = p_nodes[lowest];
+
+        memmove(p_bytes + next_free, p_bytes + current.label_offset, current.label_length);
+
+        threshold            = size_t(current.label_offset) + current.label_length;
+        current.label_offset = index_type(next_free);
+        next_free           += current.label_length;
+      }
+
+      bytes_used = index_type(next_free);
+    }
+
+    //*************************************************************************
+    index_type allocate_node()
+    {
+      const index_type n = free_nodes;
+
+      free_nodes = p_nodes[n].next_sibling;
+      --free_node_count;
+      ++node_total;
+
+      return n;
+    }
+
+    //*************************************************************************
+    void free_node(index_type n)
+    {
+      node& current = p_nodes[n];
+
+      bytes_live = index_type(bytes_live - current.label_length);
+
+      current.label_length = 0U;
+      current.first_child  = Null;
+      current.next_sibling = free_nodes;
+
+      free_nodes = n;
+      ++free_node_count;
+      --node_total;
+    }
+
+    //*************************************************************************
+    /// Frees every node but the root. Values must have been destroyed.
+    //*************************************************************************
+    void initialise()
+    {
+      node& root = p_nodes[Root];
+      root.label_offset = 0U;
+      root.label_length = 0U;
+      root.parent       = Null;
+      root.first_child  = Null;
+      root.next_sibling = Null;
+      root.has_value    = false;
+
+      free_nodes = Null;
+
+      for (index_type i = max_node_total; i > 0U; --i)
+      {
+        p_nodes[i].label_length = 0U;
+        p_nodes[i].has_value    = false;
+        p_nodes[i].next_sibling = free_nodes;
+        free_nodes = i;
+      }
+
+      free_node_count = max_node_total;
+      node_total      = 0U;
+      value_count     = 0U;
+      bytes_used      = 0U;
+      bytes_live      = 0U;
+    }
+
+    // Disable copy construction and assignment.
+    iradix_map(const iradix_map&) ETL_DELETE;
+    iradix_map& operator =(const iradix_map&) ETL_DELETE;
+
+    node*      p_nodes;
+    pointer    p_values;
+    uint8_t*   p_bytes;
+    index_type max_node_total;
+    index_type max_bytes;
+    index_type free_nodes;
+    index_type free_node_count;
+    index_type node_total;
+    index_type value_count;
+    index_type bytes_used;
+    index_type bytes_live;
+  };
+
+  template <typename TValue>
+  ETL_CONSTANT typename iradix_map<TValue>::index_type iradix_map<TValue>::Null;
+
+  template <typename TValue>
+  ETL_CONSTANT typename iradix_map<TValue>::index_type iradix_map<TValue>::Root;
+
+  //***************************************************************************
+  /// A radix_map with storage for Max_Nodes nodes, besides the root, and
+  /// Key_Bytes bytes of edges.
+  /// Each key needs at most two nodes, and at most its own length in bytes.
+  ///\ingroup radix_map
+  //***************************************************************************
+  template <typename TValue, size_t Max_Nodes, size_t Key_Bytes>
+  class radix_map : public etl::iradix_map<TValue>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((Max_Nodes > 0U) && (Max_Nodes < 0xFFFFU), "Max_Nodes must be 1 to 65534");
+    ETL_STATIC_ASSERT((Key_Bytes > 0U) && (Key_Bytes < 0xFFFFU), "Key_Bytes must be 1 to 65534");
+
+    static ETL_CONSTANT size_t MAX_NODES = Max_Nodes;
+    static ETL_CONSTANT size_t KEY_BYTES = Key_Bytes;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    radix_map()
+      : etl::iradix_map<TValue>(nodes, reinterpret_cast<TValue*>(&values), Max_Nodes, bytes, Key_Bytes)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~radix_map()
+    {
+      this->clear();
+    }
+
+  private:
+
+    typename etl::iradix_map<TValue>::node nodes[Max_Nodes + 1U];
+    typename etl::aligned_storage<sizeof(TValue) * (Max_Nodes + 1U), etl::alignment_of<TValue>::value>::type values;
+    uint8_t bytes[Key_Bytes];
+  };
+
+  template <typename TValue, size_t Max_Nodes, size_t Key_Bytes>
+  ETL_CONSTANT size_t radix_map<TValue, Max_Nodes, Key_Bytes>::MAX_NODES;
+
+  template <typename TValue, size_t Max_Nodes, size_t Key_Bytes>
+  ETL_CONSTANT size_t radix_map<TValue, Max_Nodes, Key_Bytes>::KEY_BYTES;
+}
+
+#endif
@@ -33,11 +33,62 @@ SOFTWARE.
 
 #include "platform.h"
 #include "binary.h"
+#include "span.h"
+#include "static_assert.h"
 
+#include <math.h>
 #include <stdint.h>
 
 namespace etl
 {
+  namespace private_random
+  {
+    //***************************************************************************
+    /// An unbiased random number in [0, bound), by Lemire's multiply and shift.
+    /// Only needs a division in the rare case that a value must be rejected.
+    /// A bound of zero returns a full 32 bit value.
+    /// https://arxiv.org/abs/1805.10941
+    //***************************************************************************
+    template <typename TGenerator>
+    uint32_t bounded(TGenerator& generator, uint32_t bound)
+    {
+      if (bound == 0U)
+      {
+        return generator();
+      }
+
+#if ETL_USING_64BIT_TYPES
+      uint64_t product  = uint64_t(generator()) * bound;
+      uint32_t leftover = uint32_t(product);
+
+      if (leftover < bound)
+      {
+        const uint32_t threshold = (0U - bound) % bound;
+
+        while (leftover < threshold)
+        {
+          product  = uint64_t(generator()) * bound;
+          leftover = uint32_t(product);
+        }
+      }
+
+      return uint32_t(product >> 32U);
+#else
+      // Reject the values above the last whole multiple of bound.
+      const uint32_t threshold = (0U - bound) % bound;
+
+      uint32_t n = generator();
+
+      while (n < threshold)
+      {
+        n = generator();
+      }
+
+      return n % bound;
+#endif
+    }
+  }
+
 #if defined(ETL_POLYMORPHIC_RANDOM)
   //***************************************************************************
   /// The base for all 32 bit random number generators.
@@ -53,6 +104,7 @@ namespace etl
     virtual void initialise(uint32_t seed) = 0;
     virtual uint32_t operator()() = 0;
     virtual uint32_t range(uint32_t low, uint32_t high) = 0;
+    virtual void generate(etl::span<uint32_t> values) = 0;
   };
 #else
   //***************************************************************************
@@ -139,12 +191,19 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
-        uint32_t r = high - low + 1UL;
-        uint32_t n = operator()();
-        n %= r;
-        n += low;
+        return low + private_random::bounded(*this, high - low + 1UL);
+      }
 
-        return n;
+      //***************************************************************************
+      /// Fills a span with random numbers.
+      /// Calls operator() directly, so there is no virtual call per value.
+      //***************************************************************************
+      void generate(etl::span<uint32_t> values)
+      {
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          values[i] = random_xorshift::operator()();
+        }
       }
 
     private:
@@ -208,12 +267,19 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
+      return low + private_random::bounded(*this, high - low + 1UL);
+    }
 
-      return n;
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    /// Calls operator() directly, so there is no virtual call per value.
+    //***************************************************************************
+    void generate(etl::span<uint32_t> values)
+    {
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = random_lcg::operator()();
+      }
     }
 
   private:
@@ -284,12 +350,19 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
-        uint32_t r = high - low + 1UL;
-        uint32_t n = operator()();
-        n %= r;
-        n += low;
+        return low + private_random::bounded(*this, high - low + 1UL);
+      }
 
-        return n;
+      //***************************************************************************
+      /// Fills a span with random numbers.
+      /// Calls operator() directly, so there is no virtual call per value.
+      //***************************************************************************
+      void generate(etl::span<uint32_t> values)
+      {
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          values[i] = random_clcg::operator()();
+        }
       }
 
     private:
@@ -367,12 +440,19 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
-        uint32_t r = high - low + 1UL;
-        uint32_t n = operator()();
-        n %= r;
-        n += low;
+        return low + private_random::bounded(*this, high - low + 1UL);
+      }
 
-        return n;
+      //***************************************************************************
+      /// Fills a span with random numbers.
+      /// Calls operator() directly, so there is no virtual call per value.
+      //***************************************************************************
+      void generate(etl::span<uint32_t> values)
+      {
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          values[i] = random_lsfr::operator()();
+        }
       }
 
     private:
@@ -436,12 +516,19 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
+      return low + private_random::bounded(*this, high - low + 1UL);
+    }
 
-      return n;
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    /// Calls operator() directly, so there is no virtual call per value.
+    //***************************************************************************
+    void generate(etl::span<uint32_t> values)
+    {
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = random_mwc::operator()();
+      }
     }
 
   private:
@@ -506,12 +593,19 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
+      return low + private_random::bounded(*this, high - low + 1UL);
+    }
 
-      return n;
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    /// Calls operator() directly, so there is no virtual call per value.
+    //***************************************************************************
+    void generate(etl::span<uint32_t> values)
+    {
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = random_pcg::operator()();
+      }
     }
 
   private:
@@ -575,12 +669,19 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
+      return low + private_random::bounded(*this, high - low + 1UL);
+    }
 
-      return n;
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    /// Calls operator() directly, so there is no virtual call per value.
+    //***************************************************************************
+    void generate(etl::span<uint32_t> values)
+    {
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = random_hash::operator()();
+      }
     }
 
   private:
@@ -589,6 +690,340 @@ namespace etl
     uint8_t value;
   };
 #endif
+
+  //***************************************************************************
+  /// A 32 bit random number generator with several independent lanes.
+  /// Each lane is a xoshiro128** generator, with the lane states stored
+  /// side by side so that one step of all lanes is a loop the compiler can
+  /// vectorise. Each step produces Lanes values, which are returned lane by
+  /// lane. generate() writes whole steps straight to the output.
+  /// https://prng.di.unimi.it/
+  ///\tparam Lanes The number of lanes. Four or eight suit most SIMD units.
+  //***************************************************************************
+  template <size_t Lanes_ = 4U>
+  class random_xoshiro128 : public random
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Lanes_ != 0U, "The number of lanes must not be zero");
+
+    static ETL_CONSTANT size_t Lanes = Lanes_;
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_xoshiro128()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n    = reinterpret_cast<uintptr_t>(this);
+      uint32_t  seed = static_cast<uint32_t>(n);
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_xoshiro128(uint32_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// Each lane's state is derived from the seed and the lane number.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint32_t seed)
+    {
+      uint32_t key = seed;
+
+      for (size_t lane = 0U; lane < Lanes; ++lane)
+      {
+        s0[lane] = mix(key += 0x9E3779B9UL);
+        s1[lane] = mix(key += 0x9E3779B9UL);
+        s2[lane] = mix(key += 0x9E3779B9UL);
+        s3[lane] = mix(key += 0x9E3779B9UL);
+
+        // The state must not be all zero.
+        if ((s0[lane] | s1[lane] | s2[lane] | s3[lane]) == 0U)
+        {
+          s0[lane] = 1U;
+        }
+      }
+
+      index = Lanes;
+    }
+
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      if (index == Lanes)
+      {
+        step(buffer);
+        index = 0U;
+      }
+
+      return buffer[index++];
+    }
+
+    //***************************************************************************
+    /// Get the next random number in a specified inclusive range.
+    //***************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      return low + private_random::bounded(*this, high - low + 1UL);
+    }
+
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    /// Gives the same sequence as repeated calls to operator().
+    //***************************************************************************
+    void generate(etl::span<uint32_t> values)
+    {
+      uint32_t* p_values  = values.data();
+      size_t    remaining = values.size();
+
+      // Use up the buffered values first.
+      while ((index != Lanes) && (remaining != 0U))
+      {
+        *p_values++ = buffer[index++];
+        --remaining;
+      }
+
+      // Whole steps go straight to the output.
+      while (remaining >= Lanes)
+      {
+        step(p_values);
+        p_values  += Lanes;
+        remaining -= Lanes;
+      }
+
+      if (remaining != 0U)
+      {
+        step(buffer);
+        index = 0U;
+
+        while (remaining != 0U)
+        {
+          *p_values++ = buffer[index++];
+          --remaining;
+        }
+      }
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Advances every lane by one, writing one value per lane.
+    //***************************************************************************
+    void step(uint32_t* output)
+    {
+      for (size_t lane = 0U; lane < Lanes; ++lane)
+      {
+        const uint32_t x = s1[lane] * 5U;
+        output[lane] = ((x << 7U) | (x >> 25U)) * 9U;
+
+        const uint32_t t = s1[lane] << 9U;
+
+        s2[lane] ^= s0[lane];
+        s3[lane] ^= s1[lane];
+        s1[lane] ^= s2[lane];
+        s0[lane] ^= s3[lane];
+        s2[lane] ^= t;
+        s3[lane]  = (s3[lane] << 11U) | (s3[lane] >> 21U);
+      }
+    }
+
+    //***************************************************************************
+    /// The MurmurHash3 finaliser, to spread the seed over the states.
+    //***************************************************************************
+    static uint32_t mix(uint32_t h)
+    {
+      h ^= h >> 16U;
+      h *= 0x85EBCA6BUL;
+      h ^= h >> 13U;
+      h *= 0xC2B2AE35UL;
+      h ^= h >> 16U;
+
+      return h;
+    }
+
+    uint32_t s0[Lanes_];
+    uint32_t s1[Lanes_];
+    uint32_t s2[Lanes_];
+    uint32_t s3[Lanes_];
+    uint32_t buffer[Lanes_];
+    size_t   index;
+  };
+
+  template <size_t Lanes_>
+  ETL_CONSTANT size_t random_xoshiro128<Lanes_>::Lanes;
+
+  //***************************************************************************
+  /// An unbiased random number in [0, bound) from any 32 bit generator.
+  /// Uses Lemire's multiply and shift, so there is normally no division.
+  /// A bound of zero returns a full 32 bit value.
+  //***************************************************************************
+  template <typename TGenerator>
+  uint32_t random_bounded(TGenerator& generator, uint32_t bound)
+  {
+    return private_random::bounded(generator, bound);
+  }
+
+  //***************************************************************************
+  /// A random float in [0, 1) from any 32 bit generator.
+  /// The top 24 bits of one value are scaled by 2^-24, so every result is
+  /// exactly representable and no division is needed.
+  //***************************************************************************
+  template <typename TGenerator>
+  float random_float(TGenerator& generator)
+  {
+    return float(generator() >> 8U) * (1.0f / 16777216.0f);
+  }
+
+  //***************************************************************************
+  /// A random double in [0, 1) from any 32 bit generator.
+  /// Combines 27 and 26 bits from two values into a 53 bit mantissa.
+  //***************************************************************************
+  template <typename TGenerator>
+  double random_double(TGenerator& generator)
+  {
+    const uint32_t high = generator() >> 5U;
+    const uint32_t low  = generator() >> 6U;
+
+    return ((double(high) * 67108864.0) + double(low)) * (1.0 / 9007199254740992.0);
+  }
+
+  namespace private_random
+  {
+    /// The start of the tail of the 128 layer ziggurat.
+    static const double ziggurat_r = 3.442619855899;
+  }
+
+  //***************************************************************************
+  /// Normally distributed random numbers, by the Ziggurat method of Marsaglia
+  /// and Tsang. Most samples cost one 32 bit value, a table lookup and a
+  /// multiply. The tables of 128 layers are built by the constructor.
+  /// https://www.jstatsoft.org/article/view/v005i08
+  ///\tparam T The result type. float or double.
+  //***************************************************************************
+  template <typename T = float>
+  class random_normal
+  {
+  public:
+
+    typedef T value_type;
+
+    //***************************************************************************
+    /// Constructor.
+    ///\param mean_               The mean of the distribution.
+    ///\param standard_deviation_ The standard deviation of the distribution.
+    //***************************************************************************
+    random_normal(T mean_ = T(0), T standard_deviation_ = T(1))
+      : mean(mean_)
+      , standard_deviation(standard_deviation_)
+    {
+      const double m1 = 2147483648.0;
+      const double vn = 9.91256303526217e-3;
+
+      double dn = private_random::ziggurat_r;
+      double tn = dn;
+      double q  = vn / ::exp(-0.5 * dn * dn);
+
+      kn[0] = uint32_t((dn / q) * m1);
+      kn[1] = 0U;
+
+      wn[0]   = T(q / m1);
+      wn[127] = T(dn / m1);
+
+      fn[0]   = T(1);
+      fn[127] = T(::exp(-0.5 * dn * dn));
+
+      for (size_t i = 126U; i >= 1U; --i)
+      {
+        dn = ::sqrt(-2.0 * ::log((vn / dn) + ::exp(-0.5 * dn * dn)));
+        kn[i + 1U] = uint32_t((dn / tn) * m1);
+        tn = dn;
+        fn[i] = T(::exp(-0.5 * dn * dn));
+        wn[i] = T(dn / m1);
+      }
+    }
+
+    //***************************************************************************
+    /// Gets a normally distributed random number.
+    ///\param generator Any 32 bit generator.
+    //***************************************************************************
+    template <typename TGenerator>
+    T operator()(TGenerator& generator) const
+    {
+      return mean + (standard_deviation * standard_normal(generator));
+    }
+
+  private:
+
+    //***************************************************************************
+    /// A number from the standard normal distribution.
+    //***************************************************************************
+    template <typename TGenerator>
+    T standard_normal(TGenerator& generator) const
+    {
+      while (true)
+      {
+        const int32_t  hz = int32_t(generator());
+        const uint32_t iz = uint32_t(hz) & 127U;
+        const uint32_t uz = (hz < 0) ? (0U - uint32_t(hz)) : uint32_t(hz);
+
+        const T x = T(hz) * wn[iz];
+
+        // Inside the layer's rectangle.
+        if (uz < kn[iz])
+        {
+          return x;
+        }
+
+        // The tail, beyond ziggurat_r.
+        if (iz == 0U)
+        {
+          T tail_x;
+          T tail_y;
+
+          do
+          {
+            tail_x = T(-::log(uniform_open(generator)) / private_random::ziggurat_r);
+            tail_y = T(-::log(uniform_open(generator)));
+          } while ((tail_y + tail_y) < (tail_x * tail_x));
+
+          return (hz > 0) ? T(private_random::ziggurat_r + tail_x) : T(-private_random::ziggurat_r - tail_x);
+        }
+
+        // The wedge between the rectangle and the curve.
+        if ((fn[iz] + (T(uniform_open(generator)) * (fn[iz - 1U] - fn[iz]))) < T(::exp(-0.5 * double(x) * double(x))))
+        {
+          return x;
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// A uniform double in (0, 1), so that the log is finite.
+    //***************************************************************************
+    template <typename TGenerator>
+    static double uniform_open(TGenerator& generator)
+    {
+      return (double(generator() >> 8U) + 0.5) * (1.0 / 16777216.0);
+    }
+
+    T        mean;
+    T        standard_deviation;
+    uint32_t kn[128];
+    T        wn[128];
+    T        fn[128];
+  };
 }
 
 #endif
@@ -0,0 +1,235 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RECORD_RING_SPSC_INCLUDED
+#define ETL_RECORD_RING_SPSC_INCLUDED
+
+#include "platform.h"
+#include "bip_buffer_spsc_atomic.h"
+#include "smallest.h"
+#include "span.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC && ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// A single producer, single consumer ring of variable length byte records.
+  /// Each record is stored contiguously, after its length, in a
+  /// bip_buffer_spsc_atomic, so both sides access records in place.
+  /// The writer reserves space for a record, fills it, and commits it,
+  /// optionally shorter than reserved. The reader gets the next whole record
+  /// with read_next() and releases it with read_commit().
+  /// Records must not be empty, and are limited to max_record_size(), which
+  /// always fits in one of the halves either side of the drained indexes.
+  ///\tparam SIZE The capacity in bytes, including a length per record.
+  //***************************************************************************
+  template <size_t SIZE>
+  class record_ring_spsc
+  {
+  public:
+
+    /// The type of the stored length of each record.
+    typedef typename etl::smallest_uint_for_value<SIZE>::type length_type;
+
+    static ETL_CONSTANT size_t Header_Size     = sizeof(length_type);
+    static ETL_CONSTANT size_t Max_Record_Size = ((SIZE - 1U) / 2U) - Header_Size;
+
+    ETL_STATIC_ASSERT(((SIZE - 1U) / 2U) > sizeof(length_type), "SIZE too small for a record");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    record_ring_spsc()
+      : write_reservation()
+      , read_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Writer: Reserves contiguous space for a record.
+    ///\param length The length of the record.
+    ///\return The space for the record, or an empty span if there is no room
+    /// or the length is zero or more than max_record_size().
+    //*************************************************************************
+    etl::span<uint8_t> reserve(size_t length)
+    {
+      write_reservation = etl::span<uint8_t>();
+
+      if ((length == 0U) || (length > Max_Record_Size))
+      {
+        return etl::span<uint8_t>();
+      }
+
+      const etl::span<uint8_t> block = buffer.write_reserve(static_cast<size_type>(Header_Size + length));
+
+      if (block.size() != (Header_Size + length))
+      {
+        return etl::span<uint8_t>();
+      }
+
+      write_reservation = block;
+
+      return block.subspan(Header_Size);
+    }
+
+    //*************************************************************************
+    /// Writer: Commits the reserved record, at its reserved length.
+    //*************************************************************************
+    void commit()
+    {
+      commit(write_reservation.empty() ? 0U : (write_reservation.size() - Header_Size));
+    }
+
+    //*************************************************************************
+    /// Writer: Commits the reserved record, trimmed to length.
+    /// Throws bip_buffer_reserve_invalid if there is no reservation, or the
+    /// length is zero or longer than reserved.
+    //*************************************************************************
+    void commit(size_t length)
+    {
+      ETL_ASSERT_OR_RETURN(!write_reservation.empty() && (length != 0U) && ((Header_Size + length) <= write_reservation.size()),
+                           ETL_ERROR(bip_buffer_reserve_invalid));
+
+      const length_type header = static_cast<length_type>(length);
+      memcpy(write_reservation.data(), &header, Header_Size);
+
+      buffer.write_commit(write_reservation.first(Header_Size + length));
+
+      write_reservation = etl::span<uint8_t>();
+    }
+
+    //*************************************************************************
+    /// Writer: Copies in a whole record.
+    ///\return <b>true</b> if there was room for the record.
+    //*************************************************************************
+    bool write(etl::span<const uint8_t> record)
+    {
+      const etl::span<uint8_t> space = reserve(record.size());
+
+      if (space.empty())
+      {
+        return false;
+      }
+
+      memcpy(space.data(), record.data(), record.size());
+      commit();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reader: Gets the next record, which stays valid until read_commit().
+    ///\return The record, or an empty span if there are none.
+    //*************************************************************************
+    etl::span<const uint8_t> read_next()
+    {
+      const etl::span<uint8_t> block = buffer.read_reserve();
+
+      if (block.size() < Header_Size)
+      {
+        read_size = 0U;
+        return etl::span<const uint8_t>();
+      }
+
+      length_type length;
+      memcpy(&length, block.data(), Header_Size);
+
+      read_size = Header_Size + length;
+
+      return etl::span<const uint8_t>(block.data() + Header_Size, length);
+    }
+
+    //*************************************************************************
+    /// Reader: Releases the record from the last read_next().
+    //*************************************************************************
+    void read_commit()
+    {
+      if (read_size != 0U)
+      {
+        const etl::span<uint8_t> block = buffer.read_reserve(static_cast<size_type>(read_size));
+
+        buffer.read_commit(block);
+        read_size = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no records to read.
+    //*************************************************************************
+    bool empty() const
+    {
+      return buffer.empty();
+    }
+
+    //*************************************************************************
+    /// Gets the capacity in bytes, including the length of each record.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t capacity()
+    {
+      return SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets the longest record that can be stored.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t max_record_size()
+    {
+      return Max_Record_Size;
+    }
+
+  private:
+
+    typedef etl::bip_buffer_spsc_atomic<uint8_t, SIZE> buffer_t;
+    typedef typename buffer_t::size_type              size_type;
+
+    record_ring_spsc(const record_ring_spsc&) ETL_DELETE;
+    record_ring_spsc& operator=(const record_ring_spsc&) ETL_DELETE;
+
+    buffer_t           buffer;
+    etl::span<uint8_t> write_reservation; ///< Owned by the writer, including the length.
+    size_t             read_size;         ///< Owned by the reader, including the length.
+  };
+
+  template <size_t SIZE>
+  ETL_CONSTANT size_t record_ring_spsc<SIZE>::Header_Size;
+
+  template <size_t SIZE>
+  ETL_CONSTANT size_t record_ring_spsc<SIZE>::Max_Record_Size;
+}
+
+#endif /* ETL_HAS_ATOMIC && ETL_USING_CPP11 */
+#endif
@@ -42,6 +42,7 @@ SOFTWARE.
 #include "atomic.h"
 #include "memory.h"
 #include "largest.h"
+#include "lock_free_memory_block_allocator.h"
 
 namespace etl
 {
@@ -316,6 +317,64 @@ namespace etl
 
 #if ETL_USING_CPP11 && ETL_HAS_ATOMIC
   using  atomic_counted_message_pool = reference_counted_message_pool<etl::atomic_int>;
+
+  //***************************************************************************
+  /// A pool of atomic counted messages that needs no locking.
+  /// Messages may be allocated and released from any interrupt or thread,
+  /// so etl::shared_message may be created and destroyed from any context.
+  ///\tparam VSize     The number of messages in the pool.
+  ///\tparam TMessages The message types that the pool may allocate.
+  //***************************************************************************
+  template <size_t VSize, typename... TMessages>
+  class lock_free_message_pool : public etl::atomic_counted_message_pool
+  {
+  private:
+
+    typedef typename etl::atomic_counted_message_pool::template pool_message_parameters<TMessages...> parameters;
+
+  public:
+
+    typedef etl::lock_free_memory_block_allocator<parameters::max_size, parameters::max_alignment, VSize> allocator_type;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    lock_free_message_pool()
+      : atomic_counted_message_pool(allocator)
+    {
+    }
+
+    //*************************************************************************
+    /// The number of allocated messages.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      return allocator.size();
+    }
+
+    //*************************************************************************
+    /// The number of messages that may still be allocated.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      return allocator.available();
+    }
+
+    //*************************************************************************
+    /// The number of messages in the pool.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t max_size() const
+    {
+      return VSize;
+    }
+
+  private:
+
+    /// The lock free memory block pool.
+    allocator_type allocator;
+  };
 #endif
 }
 
@@ -45,6 +45,7 @@ SOFTWARE.
 #include "optional.h"
 
 #include "private/comparator_is_transparent.h"
+#include "private/flat_bulk_insert.h"
 
 #include <stddef.h>
 
@@ -536,11 +537,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
     }
 
     //*********************************************************************
@@ -576,11 +573,20 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values with unique keys to the reference_flat_map.
+    /// The range is appended and merged in, without being sorted first.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      append_and_merge(first, last, true);
     }
 
     //*********************************************************************
@@ -780,7 +786,7 @@ namespace etl
     //*********************************************************************
     iterator lower_bound(key_parameter_t key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(lookup_lower_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -788,7 +794,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     iterator lower_bound(const K& key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(lookup_lower_bound(lookup.begin(), key));
     }
 #endif
 
@@ -799,7 +805,7 @@ namespace etl
     //*********************************************************************
     const_iterator lower_bound(key_parameter_t key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_lower_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -807,7 +813,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     const_iterator lower_bound(const K& key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_lower_bound(lookup.begin(), key));
     }
 #endif
 
@@ -818,7 +824,7 @@ namespace etl
     //*********************************************************************
     iterator upper_bound(key_parameter_t key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -826,7 +832,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     iterator upper_bound(const K& key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 #endif
 
@@ -837,7 +843,7 @@ namespace etl
     //*********************************************************************
     const_iterator upper_bound(key_parameter_t key) const
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -845,7 +851,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     const_iterator upper_bound(const K& key) const
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 #endif
 
@@ -856,9 +862,9 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
     {
-      iterator i_lower = etl::lower_bound(begin(), end(), key, compare);
+      iterator i_lower(lookup_lower_bound(lookup.begin(), key));
 
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, end(), key, compare));
+      return ETL_OR_STD::make_pair(i_lower, iterator(lookup_upper_bound(i_lower.ilookup, key)));
     }
 
 #if ETL_USING_CPP11
@@ -866,9 +872,9 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
     {
-      iterator i_lower = etl::lower_bound(begin(), end(), key, compare);
+      iterator i_lower(lookup_lower_bound(lookup.begin(), key));
 
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, end(), key, compare));
+      return ETL_OR_STD::make_pair(i_lower, iterator(lookup_upper_bound(i_lower.ilookup, key)));
     }
 #endif
 
@@ -879,9 +885,9 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
     {
-      const_iterator i_lower = etl::lower_bound(cbegin(), cend(), key, compare);
+      const_iterator i_lower(lookup_lower_bound(lookup.begin(), key));
 
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, cend(), key, compare));
+      return ETL_OR_STD::make_pair(i_lower, const_iterator(lookup_upper_bound(i_lower.ilookup, key)));
     }
 
 #if ETL_USING_CPP11
@@ -889,9 +895,9 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
     {
-      const_iterator i_lower = etl::lower_bound(cbegin(), cend(), key, compare);
+      const_iterator i_lower(lookup_lower_bound(lookup.begin(), key));
 
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, cend(), key, compare));
+      return ETL_OR_STD::make_pair(i_lower, const_iterator(lookup_upper_bound(i_lower.ilookup, key)));
     }
 #endif
 
@@ -1029,8 +1035,97 @@ namespace etl
     }
 #endif
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, out of order.
+    /// merge_appended must be called before the reference_flat_map is used again.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Merges the values appended since the size was n_sorted.
+    /// Values with keys that are already in the reference_flat_map are moved to the end.
+    ///\param n_sorted  The size before appending.
+    ///\param is_sorted <b>true</b> if the appended values are already sorted.
+    ///\return An iterator to the first rejected value.
+    //*********************************************************************
+    iterator merge_appended(size_t n_sorted, bool is_sorted)
+    {
+      typename lookup_t::iterator first = lookup.begin();
+
+      return iterator(etl::private_flat::merge_unique(first, first + n_sorted, lookup.end(), etl::private_flat::indirect_compare<element_compare>(element_compare()), is_sorted));
+    }
+
   private:
 
+    //*********************************************************************
+    /// How to compare two elements.
+    //*********************************************************************
+    class element_compare
+    {
+    public:
+
+      bool operator ()(const value_type& lhs, const value_type& rhs) const
+      {
+        return key_compare()(lhs.first, rhs.first);
+      }
+    };
+
+    //*********************************************************************
+    /// Appends the range and merges it in.
+    //*********************************************************************
+    template <class TIterator>
+    void append_and_merge(TIterator first, TIterator last, bool is_sorted)
+    {
+      size_t n_sorted = size();
+
+      while (first != last)
+      {
+        if (lookup.full())
+        {
+          // Drop any duplicates to make room.
+          erase(merge_appended(n_sorted, is_sorted), end());
+          n_sorted = size();
+
+          if (lookup.full())
+          {
+            // Only values with existing keys can still be inserted.
+            while (first != last)
+            {
+              insert(*first);
+              ++first;
+            }
+
+            return;
+          }
+        }
+
+        append(*first);
+        ++first;
+      }
+
+      erase(merge_appended(n_sorted, is_sorted), end());
+    }
+
+    //*********************************************************************
+    /// Binary searches the lookup, as it is random access and the iterators
+    /// are not.
+    //*********************************************************************
+    template <typename TLookupIterator, typename K>
+    TLookupIterator lookup_lower_bound(TLookupIterator first, const K& key) const
+    {
+      return private_algorithm::indirect_key_lower_bound<key_type, TKeyCompare>(first, TLookupIterator(lookup.end()), key, compare);
+    }
+
+    //*********************************************************************
+    template <typename TLookupIterator, typename K>
+    TLookupIterator lookup_upper_bound(TLookupIterator first, const K& key) const
+    {
+      return private_algorithm::indirect_key_upper_bound<key_type, TKeyCompare>(first, TLookupIterator(lookup.end()), key, compare);
+    }
+
     // Disable copy construction and assignment.
     ireference_flat_map(const ireference_flat_map&);
     ireference_flat_map& operator = (const ireference_flat_map&);
@@ -42,6 +42,7 @@ SOFTWARE.
 #include "type_traits.h"
 
 #include "private/comparator_is_transparent.h"
+#include "private/flat_bulk_insert.h"
 
 #include <stddef.h>
 
@@ -451,11 +452,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
     }
 
     //*********************************************************************
@@ -495,11 +492,20 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values to the reference_flat_multimap.
+    /// The range is appended and merged in, without being sorted first.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the reference_flat_multimap does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_equivalent_t, TIterator first, TIterator last)
+    {
+      append_and_merge(first, last, true);
     }
 
     //*********************************************************************
@@ -705,7 +711,7 @@ namespace etl
     //*********************************************************************
     iterator lower_bound(key_parameter_t key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(lookup_lower_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -713,7 +719,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     iterator lower_bound(const K& key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(lookup_lower_bound(lookup.begin(), key));
     }
 #endif
 
@@ -724,7 +730,7 @@ namespace etl
     //*********************************************************************
     const_iterator lower_bound(key_parameter_t key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_lower_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -732,7 +738,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     const_iterator lower_bound(const K& key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_lower_bound(lookup.begin(), key));
     }
 #endif
 
@@ -743,7 +749,7 @@ namespace etl
     //*********************************************************************
     iterator upper_bound(key_parameter_t key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -751,7 +757,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     iterator upper_bound(const K& key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 #endif
 
@@ -762,7 +768,7 @@ namespace etl
     //*********************************************************************
     const_iterator upper_bound(key_parameter_t key) const
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -770,7 +776,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     const_iterator upper_bound(const K& key) const
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 #endif
 
@@ -781,9 +787,9 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
     {
-      iterator i_lower = etl::lower_bound(begin(), end(), key, compare);
+      iterator i_lower(lookup_lower_bound(lookup.begin(), key));
 
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, end(), key, compare));
+      return ETL_OR_STD::make_pair(i_lower, iterator(lookup_upper_bound(i_lower.ilookup, key)));
     }
 
 #if ETL_USING_CPP11
@@ -791,9 +797,9 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
     {
-      iterator i_lower = etl::lower_bound(begin(), end(), key, compare);
+      iterator i_lower(lookup_lower_bound(lookup.begin(), key));
 
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, end(), key, compare));
+      return ETL_OR_STD::make_pair(i_lower, iterator(lookup_upper_bound(i_lower.ilookup, key)));
     }
 #endif
 
@@ -804,9 +810,9 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
     {
-      const_iterator i_lower = etl::lower_bound(cbegin(), cend(), key, compare);
+      const_iterator i_lower(lookup_lower_bound(lookup.begin(), key));
 
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, cend(), key, compare));
+      return ETL_OR_STD::make_pair(i_lower, const_iterator(lookup_upper_bound(i_lower.ilookup, key)));
     }
 
 #if ETL_USING_CPP11
@@ -814,9 +820,9 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
     {
-      const_iterator i_lower = etl::lower_bound(cbegin(), cend(), key, compare);
+      const_iterator i_lower(lookup_lower_bound(lookup.begin(), key));
 
-      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, cend(), key, compare));
+      return ETL_OR_STD::make_pair(i_lower, const_iterator(lookup_upper_bound(i_lower.ilookup, key)));
     }
 #endif
 
@@ -928,8 +934,79 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, out of order.
+    /// merge_appended must be called before the reference_flat_multimap is used again.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Merges the values appended since the size was n_sorted.
+    /// Equivalent values keep their insertion order.
+    ///\param n_sorted  The size before appending.
+    ///\param is_sorted <b>true</b> if the appended values are already sorted.
+    //*********************************************************************
+    void merge_appended(size_t n_sorted, bool is_sorted)
+    {
+      typename lookup_t::iterator first = lookup.begin();
+
+      etl::private_flat::merge_equivalent(first, first + n_sorted, lookup.end(), etl::private_flat::indirect_compare<element_compare>(element_compare()), is_sorted);
+    }
+
   private:
 
+    //*********************************************************************
+    /// How to compare two elements.
+    //*********************************************************************
+    class element_compare
+    {
+    public:
+
+      bool operator ()(const value_type& lhs, const value_type& rhs) const
+      {
+        return key_compare()(lhs.first, rhs.first);
+      }
+    };
+
+    //*********************************************************************
+    /// Appends the range and merges it in.
+    //*********************************************************************
+    template <class TIterator>
+    void append_and_merge(TIterator first, TIterator last, bool is_sorted)
+    {
+      const size_t n_sorted = size();
+
+      while ((first != last) && !lookup.full())
+      {
+        append(*first);
+        ++first;
+      }
+
+      merge_appended(n_sorted, is_sorted);
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_multimap_full));
+    }
+
+    //*********************************************************************
+    /// Binary searches the lookup, as it is random access and the iterators
+    /// are not.
+    //*********************************************************************
+    template <typename TLookupIterator, typename K>
+    TLookupIterator lookup_lower_bound(TLookupIterator first, const K& key) const
+    {
+      return private_algorithm::indirect_key_lower_bound<key_type, TKeyCompare>(first, TLookupIterator(lookup.end()), key, compare);
+    }
+
+    //*********************************************************************
+    template <typename TLookupIterator, typename K>
+    TLookupIterator lookup_upper_bound(TLookupIterator first, const K& key) const
+    {
+      return private_algorithm::indirect_key_upper_bound<key_type, TKeyCompare>(first, TLookupIterator(lookup.end()), key, compare);
+    }
+
     // Disable copy construction and assignment.
     ireference_flat_multimap(const ireference_flat_multimap&);
     ireference_flat_multimap& operator = (const ireference_flat_multimap&);
@@ -44,6 +44,7 @@ SOFTWARE.
 #include "exception.h"
 
 #include "private/comparator_is_transparent.h"
+#include "private/flat_bulk_insert.h"
 
 #include <stddef.h>
 
@@ -428,11 +429,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
     }
 
     //*********************************************************************
@@ -446,7 +443,7 @@ namespace etl
 
       ETL_ASSERT(!lookup.full(), ETL_ERROR(flat_multiset_full));
 
-      iterator i_element = etl::upper_bound(begin(), end(), value, compare);
+      iterator i_element(lookup_upper_bound(lookup.begin(), value));
 
       if (i_element == end())
       {
@@ -487,11 +484,20 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values to the reference_flat_multiset.
+    /// The range is appended and merged in, without being sorted first.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the reference_flat_multiset does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_equivalent_t, TIterator first, TIterator last)
+    {
+      append_and_merge(first, last, true);
     }
 
     //*********************************************************************
@@ -580,7 +586,7 @@ namespace etl
     //*********************************************************************
     iterator find(parameter_t key)
     {
-      iterator itr = etl::lower_bound(begin(), end(), key, compare);
+      iterator itr(lookup_lower_bound(lookup.begin(), key));
 
       if (itr != end())
       {
@@ -602,7 +608,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     iterator find(const K& key)
     {
-      iterator itr = etl::lower_bound(begin(), end(), key, compare);
+      iterator itr(lookup_lower_bound(lookup.begin(), key));
 
       if (itr != end())
       {
@@ -627,7 +633,7 @@ namespace etl
     //*********************************************************************
     const_iterator find(parameter_t key) const
     {
-      const_iterator itr = etl::lower_bound(begin(), end(), key, compare);
+      const_iterator itr(lookup_lower_bound(lookup.begin(), key));
 
       if (itr != end())
       {
@@ -649,7 +655,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     const_iterator find(const K& key) const
     {
-      const_iterator itr = etl::lower_bound(begin(), end(), key, compare);
+      const_iterator itr(lookup_lower_bound(lookup.begin(), key));
 
       if (itr != end())
       {
@@ -697,7 +703,7 @@ namespace etl
     //*********************************************************************
     iterator lower_bound(parameter_t key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(lookup_lower_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -705,7 +711,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     iterator lower_bound(const K& key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(lookup_lower_bound(lookup.begin(), key));
     }
 #endif
 
@@ -716,7 +722,7 @@ namespace etl
     //*********************************************************************
     const_iterator lower_bound(parameter_t key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_lower_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -724,7 +730,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     const_iterator lower_bound(const K& key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_lower_bound(lookup.begin(), key));
     }
 #endif
 
@@ -735,7 +741,7 @@ namespace etl
     //*********************************************************************
     iterator upper_bound(parameter_t key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -743,7 +749,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     iterator upper_bound(const K& key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 #endif
 
@@ -754,7 +760,7 @@ namespace etl
     //*********************************************************************
     const_iterator upper_bound(parameter_t key) const
     {
-      return etl::upper_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_upper_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -762,7 +768,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     const_iterator upper_bound(const K& key) const
     {
-      return etl::upper_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_upper_bound(lookup.begin(), key));
     }
 #endif
 
@@ -908,8 +914,66 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, out of order.
+    /// merge_appended must be called before the reference_flat_multiset is used again.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Merges the values appended since the size was n_sorted.
+    /// Equivalent values keep their insertion order.
+    ///\param n_sorted  The size before appending.
+    ///\param is_sorted <b>true</b> if the appended values are already sorted.
+    //*********************************************************************
+    void merge_appended(size_t n_sorted, bool is_sorted)
+    {
+      typename lookup_t::iterator first = lookup.begin();
+
+      etl::private_flat::merge_equivalent(first, first + n_sorted, lookup.end(), etl::private_flat::indirect_compare<TKeyCompare>(compare), is_sorted);
+    }
+
   private:
 
+    //*********************************************************************
+    /// Appends the range and merges it in.
+    //*********************************************************************
+    template <class TIterator>
+    void append_and_merge(TIterator first, TIterator last, bool is_sorted)
+    {
+      const size_t n_sorted = size();
+
+      while ((first != last) && !lookup.full())
+      {
+        append(*first);
+        ++first;
+      }
+
+      merge_appended(n_sorted, is_sorted);
+
+      ETL_ASSERT(first == last, ETL_ERROR(flat_multiset_full));
+    }
+
+    //*********************************************************************
+    /// Binary searches the lookup, as it is random access and the iterators
+    /// are not.
+    //*********************************************************************
+    template <typename TLookupIterator, typename K>
+    TLookupIterator lookup_lower_bound(TLookupIterator first, const K& key) const
+    {
+      return private_algorithm::indirect_key_lower_bound<key_type, TKeyCompare>(first, TLookupIterator(lookup.end()), key, compare);
+    }
+
+    //*********************************************************************
+    template <typename TLookupIterator, typename K>
+    TLookupIterator lookup_upper_bound(TLookupIterator first, const K& key) const
+    {
+      return private_algorithm::indirect_key_upper_bound<key_type, TKeyCompare>(first, TLookupIterator(lookup.end()), key, compare);
+    }
+
     // Disable copy construction.
     ireference_flat_multiset(const ireference_flat_multiset&);
     ireference_flat_multiset& operator =(const ireference_flat_multiset&);
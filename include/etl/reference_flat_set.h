@@ -45,6 +45,7 @@ SOFTWARE.
 #include "iterator.h"
 
 #include "private/comparator_is_transparent.h"
+#include "private/flat_bulk_insert.h"
 
 #include <stddef.h>
 
@@ -430,11 +431,7 @@ namespace etl
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
     }
 
     //*********************************************************************
@@ -470,11 +467,20 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      append_and_merge(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values with unique keys to the reference_flat_set.
+    /// The range is appended and merged in, without being sorted first.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the reference_flat_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      append_and_merge(first, last, true);
     }
 
     //*********************************************************************
@@ -561,7 +567,7 @@ namespace etl
     //*********************************************************************
     iterator find(parameter_t key)
     {
-      iterator itr = etl::lower_bound(begin(), end(), key, compare);
+      iterator itr(lookup_lower_bound(lookup.begin(), key));
 
       if (itr != end())
       {
@@ -583,7 +589,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     iterator find(const K& key)
     {
-      iterator itr = etl::lower_bound(begin(), end(), key, compare);
+      iterator itr(lookup_lower_bound(lookup.begin(), key));
 
       if (itr != end())
       {
@@ -608,7 +614,7 @@ namespace etl
     //*********************************************************************
     const_iterator find(parameter_t key) const
     {
-      const_iterator itr = etl::lower_bound(begin(), end(), key, compare);
+      const_iterator itr(lookup_lower_bound(lookup.begin(), key));
 
       if (itr != end())
       {
@@ -630,7 +636,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     const_iterator find(const K& key) const
     {
-      const_iterator itr = etl::lower_bound(begin(), end(), key, compare);
+      const_iterator itr(lookup_lower_bound(lookup.begin(), key));
 
       if (itr != end())
       {
@@ -674,7 +680,7 @@ namespace etl
     //*********************************************************************
     iterator lower_bound(parameter_t key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(lookup_lower_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -682,7 +688,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     iterator lower_bound(const K& key)
     {
-      return etl::lower_bound(begin(), end(), key, compare);
+      return iterator(lookup_lower_bound(lookup.begin(), key));
     }
 #endif
 
@@ -693,7 +699,7 @@ namespace etl
     //*********************************************************************
     const_iterator lower_bound(parameter_t key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_lower_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -701,7 +707,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     const_iterator lower_bound(const K& key) const
     {
-      return etl::lower_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_lower_bound(lookup.begin(), key));
     }
 #endif
 
@@ -712,7 +718,7 @@ namespace etl
     //*********************************************************************
     iterator upper_bound(parameter_t key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -720,7 +726,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     iterator upper_bound(const K& key)
     {
-      return etl::upper_bound(begin(), end(), key, compare);
+      return iterator(lookup_upper_bound(lookup.begin(), key));
     }
 #endif
 
@@ -731,7 +737,7 @@ namespace etl
     //*********************************************************************
     const_iterator upper_bound(parameter_t key) const
     {
-      return etl::upper_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_upper_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -739,7 +745,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     const_iterator upper_bound(const K& key) const
     {
-      return etl::upper_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_upper_bound(lookup.begin(), key));
     }
 #endif
 
@@ -769,7 +775,7 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(parameter_t key) const
     {
-      return etl::upper_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_upper_bound(lookup.begin(), key));
     }
 
 #if ETL_USING_CPP11
@@ -777,7 +783,7 @@ namespace etl
     template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
     {
-      return etl::upper_bound(cbegin(), cend(), key, compare);
+      return const_iterator(lookup_upper_bound(lookup.begin(), key));
     }
 #endif
 
@@ -898,8 +904,84 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, out of order.
+    /// merge_appended must be called before the reference_flat_set is used again.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Merges the values appended since the size was n_sorted.
+    /// Values with keys that are already in the reference_flat_set are moved to the end.
+    ///\param n_sorted  The size before appending.
+    ///\param is_sorted <b>true</b> if the appended values are already sorted.
+    ///\return An iterator to the first rejected value.
+    //*********************************************************************
+    iterator merge_appended(size_t n_sorted, bool is_sorted)
+    {
+      typename lookup_t::iterator first = lookup.begin();
+
+      return iterator(etl::private_flat::merge_unique(first, first + n_sorted, lookup.end(), etl::private_flat::indirect_compare<TKeyCompare>(compare), is_sorted));
+    }
+
   private:
 
+    //*********************************************************************
+    /// Appends the range and merges it in.
+    //*********************************************************************
+    template <class TIterator>
+    void append_and_merge(TIterator first, TIterator last, bool is_sorted)
+    {
+      size_t n_sorted = size();
+
+      while (first != last)
+      {
+        if (lookup.full())
+        {
+          // Drop any duplicates to make room.
+          erase(merge_appended(n_sorted, is_sorted), end());
+          n_sorted = size();
+
+          if (lookup.full())
+          {
+            // Only values with existing keys can still be inserted.
+            while (first != last)
+            {
+              insert(*first);
+              ++first;
+            }
+
+            return;
+          }
+        }
+
+        append(*first);
+        ++first;
+      }
+
+      erase(merge_appended(n_sorted, is_sorted), end());
+    }
+
+    //*********************************************************************
+    /// Binary searches the lookup, as it is random access and the iterators
+    /// are not.
+    //*********************************************************************
+    template <typename TLookupIterator, typename K>
+    TLookupIterator lookup_lower_bound(TLookupIterator first, const K& key) const
+    {
+      return private_algorithm::indirect_key_lower_bound<key_type, TKeyCompare>(first, TLookupIterator(lookup.end()), key, compare);
+    }
+
+    //*********************************************************************
+    template <typename TLookupIterator, typename K>
+    TLookupIterator lookup_upper_bound(TLookupIterator first, const K& key) const
+    {
+      return private_algorithm::indirect_key_upper_bound<key_type, TKeyCompare>(first, TLookupIterator(lookup.end()), key, compare);
+    }
+
     // Disable copy construction.
     ireference_flat_set(const ireference_flat_set&);
     ireference_flat_set& operator =(const ireference_flat_set&);
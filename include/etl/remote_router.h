@@ -0,0 +1,463 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_REMOTE_ROUTER_INCLUDED
+#define ETL_REMOTE_ROUTER_INCLUDED
+
+#include "platform.h"
+#include "message.h"
+#include "message_types.h"
+#include "message_router.h"
+#include "message_packet.h"
+#include "byte_stream.h"
+#include "endianness.h"
+#include "span.h"
+#include "optional.h"
+#include "utility.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_CPP11
+
+///\defgroup remote_router remote_router
+/// Carries messages between nodes as frames of serialised messages.
+/// Each message type is encoded and decoded by the etl::write<T> and
+/// etl::read<T> byte_stream functions, which must be specialised for it.
+/// A frame is a sequence of records, each one being the message id, the
+/// payload length as a uint16_t and the payload, in the stream's endianness.
+///\ingroup messaging
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup remote_router
+  /// The interface of the remote_router_receiver, used by a remote_router to
+  /// recognise messages that have just arrived from the other node.
+  //***************************************************************************
+  class iremote_router_receiver
+  {
+  public:
+
+    //*************************************************************************
+    /// The message currently being dispatched, or ETL_NULLPTR.
+    //*************************************************************************
+    const etl::imessage* dispatching() const
+    {
+      return p_dispatching;
+    }
+
+    //*************************************************************************
+    /// The number of records that could not be decoded.
+    //*************************************************************************
+    size_t rejected() const
+    {
+      return rejected_count;
+    }
+
+    //*************************************************************************
+    /// Clears the rejected record count.
+    //*************************************************************************
+    void clear_rejected()
+    {
+      rejected_count = 0U;
+    }
+
+  protected:
+
+    iremote_router_receiver()
+      : p_dispatching(ETL_NULLPTR)
+      , rejected_count(0U)
+    {
+    }
+
+    ~iremote_router_receiver()
+    {
+    }
+
+    const etl::imessage* p_dispatching;
+    size_t               rejected_count;
+  };
+
+  //***************************************************************************
+  ///\ingroup remote_router
+  /// Decodes frames produced by a remote_router and dispatches each message to
+  /// a local router, usually a message bus.
+  /// Records for other message types, or that fail to decode, are skipped and
+  /// counted; a truncated record ends the frame.
+  //***************************************************************************
+  template <typename... TMessageTypes>
+  class remote_router_receiver : public etl::iremote_router_receiver
+  {
+  public:
+
+    typedef etl::message_packet<TMessageTypes...> message_packet;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    remote_router_receiver(etl::imessage_router& destination_, etl::endian stream_endianness_ = etl::endian::big)
+      : destination(destination_)
+      , stream_endianness(stream_endianness_)
+    {
+    }
+
+    //*************************************************************************
+    /// Decodes and dispatches the messages in a frame.
+    /// Returns the number of messages dispatched.
+    //*************************************************************************
+    size_t receive(etl::span<const char> frame)
+    {
+      etl::byte_stream_reader reader(frame, stream_endianness);
+
+      size_t count = 0U;
+      bool   more  = true;
+
+      while (more && !reader.empty())
+      {
+        etl::optional<etl::message_id_t> id     = reader.read<etl::message_id_t>();
+        etl::optional<uint16_t>          length = reader.read<uint16_t>();
+
+        more = id.has_value() && length.has_value() && (reader.available_bytes() >= *length);
+
+        if (more)
+        {
+          etl::span<const char>   payload = reader.free_data().first(*length);
+          etl::byte_stream_reader record(payload, stream_endianness);
+
+          if (decode(*id, record))
+          {
+            ++count;
+          }
+          else
+          {
+            ++rejected_count;
+          }
+
+          reader.skip<char>(*length);
+        }
+        else
+        {
+          ++rejected_count;
+        }
+      }
+
+      return count;
+    }
+
+  private:
+
+    // Disabled.
+    remote_router_receiver(const remote_router_receiver&) ETL_DELETE;
+    remote_router_receiver& operator =(const remote_router_receiver&) ETL_DELETE;
+
+    //*************************************************************************
+    bool decode(etl::message_id_t id, etl::byte_stream_reader& record)
+    {
+      bool decoded = false;
+      bool found   = false;
+
+      int dummy[] = { 0, (found = found || decode_type<TMessageTypes>(id, record, decoded), 0)... };
+      (void)dummy;
+
+      return decoded;
+    }
+
+    //*************************************************************************
+    /// Returns true if the id matches TMessage, setting 'decoded' on success.
+    //*************************************************************************
+    template <typename TMessage>
+    bool decode_type(etl::message_id_t id, etl::byte_stream_reader& record, bool& decoded)
+    {
+      const bool match = (TMessage::ID == id);
+
+      if (match)
+      {
+        etl::optional<TMessage> msg = etl::read<TMessage>(record);
+
+        decoded = msg.has_value();
+
+        if (decoded)
+        {
+          message_packet packet(etl::move(*msg));
+
+          p_dispatching = &packet.get();
+          destination.receive(packet.get());
+          p_dispatching = ETL_NULLPTR;
+        }
+      }
+
+      return match;
+    }
+
+    etl::imessage_router& destination;
+    const etl::endian     stream_endianness;
+  };
+
+  //***************************************************************************
+  ///\ingroup remote_router
+  /// A router that stands in for the routers of another node.
+  /// Subscribed to a local message bus or broker, it serialises each message
+  /// of TMessageTypes into a frame buffer. Messages are batched until flush()
+  /// is called, or until the next one does not fit, when the frame is passed to
+  /// transport.send(etl::span<const char>).
+  /// If a receiver is set, messages that it is dispatching are not sent back.
+  //***************************************************************************
+  template <typename TTransport, typename... TMessageTypes>
+  class remote_router : public etl::imessage_router
+  {
+  public:
+
+    typedef TTransport                            transport_type;
+    typedef etl::message_packet<TMessageTypes...> message_packet;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param id         The router id used when subscribing.
+    ///\param transport  Sends completed frames.
+    ///\param buffer     Holds the frame being built; its size is the largest frame.
+    //*************************************************************************
+    remote_router(etl::message_router_id_t id,
+                  TTransport&              transport_,
+                  etl::span<char>          buffer,
+                  etl::endian              stream_endianness_ = etl::endian::big)
+      : imessage_router(id)
+      , transport(transport_)
+      , writer(buffer, stream_endianness_)
+      , stream_endianness(stream_endianness_)
+      , p_receiver(ETL_NULLPTR)
+      , message_count(0U)
+      , dropped_count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the receiver whose messages must not be sent back.
+    //*************************************************************************
+    void set_receiver(const etl::iremote_router_receiver& receiver)
+    {
+      p_receiver = &receiver;
+    }
+
+    //*************************************************************************
+    using imessage_router::receive;
+
+    //*************************************************************************
+    /// Adds an accepted message to the frame.
+    /// A message that does not fit in an empty frame is dropped and counted.
+    //*************************************************************************
+    void receive(const etl::imessage& msg) ETL_OVERRIDE
+    {
+      const bool is_echo = (p_receiver != ETL_NULLPTR) && (p_receiver->dispatching() == &msg);
+
+      if (!is_echo)
+      {
+        if (message_packet::accepts(msg.get_message_id()))
+        {
+          bool added = encode(msg);
+
+          if (!added && (message_count != 0U))
+          {
+            flush();
+            added = encode(msg);
+          }
+
+          if (added)
+          {
+            ++message_count;
+          }
+          else
+          {
+            ++dropped_count;
+          }
+        }
+        else if (has_successor())
+        {
+          get_successor().receive(msg);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Sends the frame, if it holds any messages.
+    //*************************************************************************
+    void flush()
+    {
+      if (message_count != 0U)
+      {
+        etl::span<const char> frame = writer.used_data();
+
+        transport.send(frame);
+
+        writer.restart();
+        message_count = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// The number of messages waiting in the frame.
+    //*************************************************************************
+    size_t size() const
+    {
+      return message_count;
+    }
+
+    //*************************************************************************
+    /// The number of bytes waiting in the frame.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      return writer.size_bytes();
+    }
+
+    //*************************************************************************
+    /// The number of messages that did not fit in an empty frame.
+    //*************************************************************************
+    size_t dropped() const
+    {
+      return dropped_count;
+    }
+
+    //*************************************************************************
+    /// Clears the dropped message count.
+    //*************************************************************************
+    void clear_dropped()
+    {
+      dropped_count = 0U;
+    }
+
+    //*************************************************************************
+    using imessage_router::accepts;
+
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      if (message_packet::accepts(id))
+      {
+        return true;
+      }
+      else if (has_successor())
+      {
+        return get_successor().accepts(id);
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    bool is_producer() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+  private:
+
+    // Disabled.
+    remote_router(const remote_router&) ETL_DELETE;
+    remote_router& operator =(const remote_router&) ETL_DELETE;
+
+    //*************************************************************************
+    /// Appends a record for the message, or leaves the frame unchanged.
+    //*************************************************************************
+    bool encode(const etl::imessage& msg)
+    {
+      bool encoded = false;
+      bool found   = false;
+
+      int dummy[] = { 0, (found = found || encode_type<TMessageTypes>(msg, encoded), 0)... };
+      (void)dummy;
+
+      return encoded;
+    }
+
+    //*************************************************************************
+    /// Returns true if the message is a TMessage, setting 'encoded' on success.
+    //*************************************************************************
+    template <typename TMessage>
+    bool encode_type(const etl::imessage& msg, bool& encoded)
+    {
+      const bool match = (TMessage::ID == msg.get_message_id());
+
+      if (match)
+      {
+        const size_t start = writer.size_bytes();
+
+        encoded = writer.write(etl::message_id_t(TMessage::ID)) && writer.write(uint16_t(0U));
+
+        const size_t payload_start = writer.size_bytes();
+
+        encoded = encoded && etl::write<TMessage>(writer, static_cast<const TMessage&>(msg));
+
+        const size_t length = writer.size_bytes() - payload_start;
+
+        encoded = encoded && (length <= etl::integral_limits<uint16_t>::max);
+
+        if (encoded)
+        {
+          // Fill in the payload length.
+          etl::byte_stream_writer header(writer.data().data() + payload_start - sizeof(uint16_t), sizeof(uint16_t), stream_endianness);
+          header.write_unchecked(uint16_t(length));
+        }
+        else
+        {
+          writer.restart(start);
+        }
+      }
+
+      return match;
+    }
+
+    TTransport&                         transport;
+    etl::byte_stream_writer             writer;
+    const etl::endian                   stream_endianness;
+    const etl::iremote_router_receiver* p_receiver;
+    size_t                              message_count;
+    size_t                              dropped_count;
+  };
+}
+
+#endif
+#endif
@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -127,6 +128,33 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a contiguous batch of values.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      calc_t batch_sum_of_squares = calc_t(0);
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        batch_sum_of_squares += TCalc(values[i] * values[i]);
+      }
+
+      sum_of_squares += batch_sum_of_squares;
+      counter        += uint32_t(values.size());
+      recalculate    = true;
+    }
+
+    //*********************************
+    /// Merge the values added to another rms.
+    //*********************************
+    void merge(const rms& other)
+    {
+      sum_of_squares += other.sum_of_squares;
+      counter        += other.counter;
+      recalculate    = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
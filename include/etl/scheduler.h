@@ -37,6 +37,10 @@ SOFTWARE.
 #include "task.h"
 #include "type_traits.h"
 #include "function.h"
+#include "atomic.h"
+#include "bit.h"
+#include "integral_limits.h"
+#include "trace.h"
 
 #include <stdint.h>
 
@@ -111,6 +115,7 @@ namespace etl
 
         if (task.task_request_work() > 0)
         {
+          ETL_TRACE(etl::trace_id::Scheduler_Dispatch, task.get_task_priority());
           task.task_process_work();
           idle = false;
         }
@@ -140,6 +145,7 @@ namespace etl
 
         while (task.task_request_work() > 0)
         {
+          ETL_TRACE(etl::trace_id::Scheduler_Dispatch, task.get_task_priority());
           task.task_process_work();
           idle = false;
         }
@@ -170,6 +176,7 @@ namespace etl
 
         if (task.task_request_work() > 0)
         {
+          ETL_TRACE(etl::trace_id::Scheduler_Dispatch, task.get_task_priority());
           task.task_process_work();
           idle = false;
           break;
@@ -215,6 +222,7 @@ namespace etl
 
       if (!idle)
       {
+        ETL_TRACE(etl::trace_id::Scheduler_Dispatch, task_list[most_index]->get_task_priority());
         task_list[most_index]->task_process_work();
       }
 
@@ -222,6 +230,198 @@ namespace etl
     }
   };
 
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// Ready Bitmap.
+  /// A policy the scheduler can use to decide what to do next.
+  /// Calls the highest priority task that has work, as
+  /// scheduler_policy_highest_priority does, without polling every task.
+  /// Call set_task_ready() with a task when it is given work, which may be
+  /// from an interrupt. The policy is reached through the scheduler's
+  /// get_policy(). That sets the task's bit in a bitmap in priority order.
+  /// The highest priority ready task is found with countl_zero, and is the
+  /// only one asked for work. Its bit is cleared when it has none.
+  /// Each task is given its bit when the task list is bound, and every task
+  /// is treated as ready when the task list changes.
+  /// Supports up to Max_Tasks tasks. Any more are rejected when bound.
+  //***************************************************************************
+  class scheduler_policy_ready_bitmap
+  {
+  public:
+
+    enum
+    {
+      Max_Tasks = 64
+    };
+
+    scheduler_policy_ready_bitmap()
+      : bound_count(0U)
+      , list_size(0U)
+    {
+      for (size_t i = 0U; i < Word_Count; ++i)
+      {
+        ready[i].store(0U);
+      }
+
+      for (size_t i = 0U; i < Priorities; ++i)
+      {
+        first_index[i] = 0U;
+      }
+    }
+
+    //*******************************************
+    /// Marks the task as having work.
+    /// May be called from an interrupt or another thread.
+    /// Tasks that are not in the scheduler are ignored, as are calls made
+    /// while the task list is being bound, as every task is then made ready.
+    //*******************************************
+    void set_task_ready(const etl::task& task)
+    {
+      const size_t count = bound_count.load(etl::memory_order_acquire);
+
+      // Tasks of the same priority are next to each other in the list.
+      const etl::task_priority_t priority = task.get_task_priority();
+
+      for (size_t index = first_index[priority]; (index < count) && (bound[index]->get_task_priority() == priority); ++index)
+      {
+        if (bound[index] == &task)
+        {
+          ready[index / Word_Bits].fetch_or(Top_Bit >> (index % Word_Bits));
+          return;
+        }
+      }
+    }
+
+    bool schedule_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      if (list_size != task_list.size())
+      {
+        bind_tasks(task_list);
+      }
+
+      for (size_t word = 0U; word < Word_Count; ++word)
+      {
+        uint32_t bits = ready[word].load();
+
+        while (bits != 0U)
+        {
+          const size_t   bit   = size_t(etl::countl_zero(bits));
+          const uint32_t mask  = Top_Bit >> bit;
+          const size_t   index = (word * Word_Bits) + bit;
+
+          // A different list of the same size.
+          if (bound[index] != task_list[index])
+          {
+            bind_tasks(task_list);
+            return false;
+          }
+
+          etl::task& task = *(task_list[index]);
+
+          // Cleared before asking, so that a set_task_ready() from here on is kept.
+          ready[word].fetch_and(~mask);
+
+          if (task.task_request_work() > 0)
+          {
+            // It may have more.
+            ready[word].fetch_or(mask);
+            ETL_TRACE(etl::trace_id::Scheduler_Dispatch, task.get_task_priority());
+            task.task_process_work();
+
+            return false;
+          }
+
+          bits &= ~mask;
+        }
+      }
+
+      // A different list of the same size, whose tasks have no bits set.
+      if (!is_bound(task_list))
+      {
+        bind_tasks(task_list);
+        return false;
+      }
+
+      return true;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t   Word_Bits  = 32U;
+    static ETL_CONSTANT size_t   Word_Count = Max_Tasks / Word_Bits;
+    static ETL_CONSTANT uint32_t Top_Bit    = UINT32_C(0x80000000);
+    static ETL_CONSTANT uint32_t All_Bits   = UINT32_C(0xFFFFFFFF);
+    static ETL_CONSTANT size_t   Priorities = size_t(etl::integral_limits<etl::task_priority_t>::max) + 1U;
+
+    //*******************************************
+    /// Records each task against the bit for its position in the list,
+    /// highest priority first, and marks all of them as ready.
+    /// set_task_ready() ignores tasks until the new list is published.
+    //*******************************************
+    void bind_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      bound_count.store(0U, etl::memory_order_release);
+
+      list_size = task_list.size();
+
+      const size_t count = (list_size < size_t(Max_Tasks)) ? list_size : size_t(Max_Tasks);
+
+      // Backwards, so that each priority is given the index of its first task.
+      for (size_t index = count; index > 0U; --index)
+      {
+        const etl::task* p_task = task_list[index - 1U];
+
+        bound[index - 1U]                        = p_task;
+        first_index[p_task->get_task_priority()] = uint_least8_t(index - 1U);
+      }
+
+      bound_count.store(uint32_t(count), etl::memory_order_release);
+
+      for (size_t word = 0U; word < Word_Count; ++word)
+      {
+        const size_t first = word * Word_Bits;
+        const size_t n     = (count > first) ? (count - first) : 0U;
+
+        if (n >= Word_Bits)
+        {
+          ready[word].store(All_Bits);
+        }
+        else
+        {
+          ready[word].store(~(All_Bits >> n));
+        }
+      }
+
+      // Only raised when the list changes, the tasks after Max_Tasks are never called.
+      ETL_ASSERT(list_size <= size_t(Max_Tasks), ETL_ERROR(etl::scheduler_too_many_tasks_exception));
+    }
+
+    //*******************************************
+    /// Checks that the bound tasks are the ones in the list.
+    //*******************************************
+    bool is_bound(const etl::ivector<etl::task*>& task_list) const
+    {
+      const size_t count = bound_count.load();
+
+      for (size_t index = 0U; index < count; ++index)
+      {
+        if (bound[index] != task_list[index])
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    etl::atomic<uint32_t> ready[Word_Count];
+    etl::atomic<uint32_t> bound_count;
+    size_t                list_size;
+    const etl::task*      bound[Max_Tasks];
+    uint_least8_t         first_index[Priorities];
+  };
+#endif
+
   //***************************************************************************
   /// Scheduler base.
   //***************************************************************************
@@ -396,6 +596,22 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Get the scheduler policy, for policies with state.
+    //*******************************************
+    TSchedulerPolicy& get_policy()
+    {
+      return *this;
+    }
+
+    //*******************************************
+    /// Get the scheduler policy, for policies with state.
+    //*******************************************
+    const TSchedulerPolicy& get_policy() const
+    {
+      return *this;
+    }
+
   private:
 
     typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
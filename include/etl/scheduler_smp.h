@@ -0,0 +1,414 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SCHEDULER_SMP_INCLUDED
+#define ETL_SCHEDULER_SMP_INCLUDED
+
+#include "platform.h"
+#include "scheduler.h"
+#include "task.h"
+#include "vector.h"
+#include "algorithm.h"
+#include "atomic.h"
+#include "power.h"
+#include "function.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  namespace private_scheduler_smp
+  {
+    //*************************************************************************
+    /// A Chase-Lev work stealing deque of task indices.
+    /// The owning core pushes and pops at the bottom, other cores steal from
+    /// the top. CAPACITY must be a power of 2 and at least the number of
+    /// tasks, as a task is never in more than one deque at a time.
+    //*************************************************************************
+    template <size_t CAPACITY>
+    class work_stealing_deque
+    {
+    public:
+
+      ETL_STATIC_ASSERT((CAPACITY & (CAPACITY - 1U)) == 0U, "CAPACITY must be a power of 2");
+
+      work_stealing_deque()
+        : top(0U)
+        , bottom(0U)
+      {
+        for (size_t i = 0U; i < CAPACITY; ++i)
+        {
+          buffer[i].store(0U, etl::memory_order_relaxed);
+        }
+      }
+
+      //***********************************************************************
+      /// Pushes at the bottom. Owner only.
+      //***********************************************************************
+      void push(uint32_t value)
+      {
+        const uint32_t b = bottom.load(etl::memory_order_relaxed);
+
+        buffer[b & Mask].store(value, etl::memory_order_relaxed);
+        bottom.store(b + 1U);
+      }
+
+      //***********************************************************************
+      /// Pops from the bottom. Owner only.
+      //***********************************************************************
+      bool pop(uint32_t& value)
+      {
+        const uint32_t b = bottom.load(etl::memory_order_relaxed) - 1U;
+        bottom.store(b);
+
+        uint32_t t = top.load();
+
+        const int32_t length = int32_t(b - t);
+
+        if (length < 0)
+        {
+          // Empty.
+          bottom.store(b + 1U);
+          return false;
+        }
+
+        value = buffer[b & Mask].load(etl::memory_order_relaxed);
+
+        if (length > 0)
+        {
+          return true;
+        }
+
+        // The last one. Race any thief for it.
+        const bool won = top.compare_exchange_strong(t, t + 1U);
+        bottom.store(b + 1U);
+
+        return won;
+      }
+
+      //***********************************************************************
+      /// Steals from the top. Any core.
+      /// Returns false if empty, or if another core took the value first.
+      //***********************************************************************
+      bool steal(uint32_t& value)
+      {
+        uint32_t t = top.load();
+        const uint32_t b = bottom.load();
+
+        if (int32_t(b - t) <= 0)
+        {
+          return false;
+        }
+
+        value = buffer[t & Mask].load(etl::memory_order_relaxed);
+
+        return top.compare_exchange_strong(t, t + 1U);
+      }
+
+      //***********************************************************************
+      /// Approximate when other cores are using the deque.
+      //***********************************************************************
+      bool empty() const
+      {
+        return int32_t(bottom.load() - top.load()) <= 0;
+      }
+
+    private:
+
+      static ETL_CONSTANT uint32_t Mask = uint32_t(CAPACITY - 1U);
+
+      etl::atomic<uint32_t> top;
+      etl::atomic<uint32_t> bottom;
+      etl::atomic<uint32_t> buffer[CAPACITY];
+    };
+
+    //*************************************************************************
+    /// Used to order tasks in descending priority.
+    //*************************************************************************
+    struct compare_priority
+    {
+      bool operator()(etl::task_priority_t priority, etl::task* ptask) const
+      {
+        return priority > ptask->get_task_priority();
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A scheduler whose tasks run on CORES cores.
+  /// Each core calls start_core() with its index, or process() from its own
+  /// loop. Every task has a home core, which is the only one that asks it for
+  /// work. Tasks are dealt to the cores in priority order. A home core queues
+  /// its tasks that have work in its own deque, highest priority at the
+  /// bottom, and processes them from there. A core with nothing queued and no
+  /// home task with work steals the oldest queued task of another core.
+  /// A task is processed by one core at a time, once per dispatch, and is
+  /// requeued by whichever core processed it while it still has work.
+  /// Tasks must be added before any core starts.
+  //***************************************************************************
+  template <size_t MAX_TASKS_, size_t CORES_>
+  class scheduler_smp
+  {
+  public:
+
+    ETL_STATIC_ASSERT(CORES_ > 0U, "At least one core is required");
+
+    enum
+    {
+      MAX_TASKS = MAX_TASKS_,
+      CORES     = CORES_
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    scheduler_smp()
+      : scheduler_running(false)
+      , scheduler_exit(false)
+      , p_idle_callback(ETL_NULLPTR)
+      , p_watchdog_callback(ETL_NULLPTR)
+    {
+      for (size_t i = 0U; i < MAX_TASKS; ++i)
+      {
+        queued[i].store(false, etl::memory_order_relaxed);
+      }
+    }
+
+    //*******************************************
+    /// Set the idle callback.
+    /// Called by any core that finds no work.
+    //*******************************************
+    void set_idle_callback(etl::ifunction<void>& callback)
+    {
+      p_idle_callback = &callback;
+    }
+
+    //*******************************************
+    /// Set the watchdog callback.
+    /// Called by every core on each cycle.
+    //*******************************************
+    void set_watchdog_callback(etl::ifunction<void>& callback)
+    {
+      p_watchdog_callback = &callback;
+    }
+
+    //*******************************************
+    /// Set the running state for the scheduler.
+    //*******************************************
+    void set_scheduler_running(bool scheduler_running_)
+    {
+      scheduler_running.store(scheduler_running_);
+    }
+
+    //*******************************************
+    /// Get the running state for the scheduler.
+    //*******************************************
+    bool scheduler_is_running() const
+    {
+      return scheduler_running.load();
+    }
+
+    //*******************************************
+    /// Force every core to exit the scheduler.
+    //*******************************************
+    void exit_scheduler()
+    {
+      scheduler_exit.store(true);
+    }
+
+    //*******************************************
+    /// Add a task.
+    /// Add to the task list in priority order.
+    //*******************************************
+    void add_task(etl::task& task)
+    {
+      ETL_ASSERT_OR_RETURN(!task_list.full(), ETL_ERROR(etl::scheduler_too_many_tasks_exception));
+
+      typename task_list_t::iterator itask = etl::upper_bound(task_list.begin(),
+                                                              task_list.end(),
+                                                              task.get_task_priority(),
+                                                              private_scheduler_smp::compare_priority());
+
+      task_list.insert(itask, &task);
+
+      task.on_task_added();
+    }
+
+    //*******************************************
+    /// Add a task list.
+    /// Adds to the tasks to the internal task list in priority order.
+    /// Input order is ignored.
+    //*******************************************
+    template <typename TSize>
+    void add_task_list(etl::task** p_tasks, TSize size)
+    {
+      for (TSize i = 0; i < size; ++i)
+      {
+        ETL_ASSERT((p_tasks[i] != ETL_NULLPTR), ETL_ERROR(etl::scheduler_null_task_exception));
+        add_task(*(p_tasks[i]));
+      }
+    }
+
+    //*******************************************
+    /// The core that asks the task at 'index', in priority order, for work.
+    //*******************************************
+    static size_t home_core(size_t index)
+    {
+      return index % CORES;
+    }
+
+    //*******************************************
+    /// Runs the scheduler on a core until exit_scheduler() is called.
+    /// The first core to start sets the scheduler running.
+    //*******************************************
+    void start_core(size_t core)
+    {
+      ETL_ASSERT(task_list.size() > 0, ETL_ERROR(etl::scheduler_no_tasks_exception));
+
+      scheduler_running.store(true);
+
+      while (!scheduler_exit.load())
+      {
+        if (scheduler_running.load())
+        {
+          const bool idle = !process(core);
+
+          if (p_watchdog_callback)
+          {
+            (*p_watchdog_callback)();
+          }
+
+          if (idle && p_idle_callback)
+          {
+            (*p_idle_callback)();
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    /// Dispatches one task on the core, which must be less than CORES.
+    /// Returns true if a task was processed.
+    //*******************************************
+    bool process(size_t core)
+    {
+      uint32_t index;
+
+      if (!deques[core].pop(index))
+      {
+        queue_home_tasks(core);
+
+        if (!deques[core].pop(index) && !steal(core, index))
+        {
+          return false;
+        }
+      }
+
+      etl::task& task = *(task_list[index]);
+
+      task.task_process_work();
+
+      if (task.task_request_work() > 0)
+      {
+        deques[core].push(index);
+      }
+      else
+      {
+        queued[index].store(false);
+      }
+
+      return true;
+    }
+
+  private:
+
+    typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
+
+    static ETL_CONSTANT size_t Capacity = etl::power_of_2_round_up<MAX_TASKS>::value;
+
+    //*******************************************
+    /// Queues the core's home tasks that have work and are not queued
+    /// already, lowest priority first.
+    //*******************************************
+    void queue_home_tasks(size_t core)
+    {
+      for (size_t index = task_list.size(); index > 0U; --index)
+      {
+        const size_t i = index - 1U;
+
+        if ((home_core(i) == core) && !queued[i].load() && (task_list[i]->task_request_work() > 0))
+        {
+          queued[i].store(true);
+          deques[core].push(uint32_t(i));
+        }
+      }
+    }
+
+    //*******************************************
+    /// Steals a task from another core.
+    //*******************************************
+    bool steal(size_t core, uint32_t& index)
+    {
+      for (size_t i = 1U; i < CORES; ++i)
+      {
+        if (deques[(core + i) % CORES].steal(index))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    // Disabled.
+    scheduler_smp(const scheduler_smp&) ETL_DELETE;
+    scheduler_smp& operator =(const scheduler_smp&) ETL_DELETE;
+
+    etl::atomic<bool>     scheduler_running;
+    etl::atomic<bool>     scheduler_exit;
+    etl::ifunction<void>* p_idle_callback;
+    etl::ifunction<void>* p_watchdog_callback;
+    task_list_t           task_list;
+
+    /// Is the task in a deque, or being processed?
+    etl::atomic<bool>     queued[MAX_TASKS];
+
+    private_scheduler_smp::work_stealing_deque<Capacity> deques[CORES];
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,366 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SCHEDULER_STATISTICS_INCLUDED
+#define ETL_SCHEDULER_STATISTICS_INCLUDED
+
+#include "platform.h"
+#include "scheduler.h"
+#include "task.h"
+#include "vector.h"
+#include "delegate.h"
+#include "nullptr.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+///\defgroup scheduler_statistics Scheduler statistics
+/// An instrumentation policy for etl::scheduler.
+///\ingroup utilities
+
+#if !defined(ETL_SCHEDULER_STATISTICS_TIMESTAMP_TYPE)
+  #define ETL_SCHEDULER_STATISTICS_TIMESTAMP_TYPE uint32_t
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The statistics for one task.
+  /// Times are in the units of the clock, and are zero without one.
+  ///\ingroup scheduler_statistics
+  //***************************************************************************
+  struct task_statistics
+  {
+    typedef ETL_SCHEDULER_STATISTICS_TIMESTAMP_TYPE timestamp_type;
+
+    task_statistics()
+      : invocations(0U)
+      , total_time(0U)
+      , max_time(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// The mean time of task_process_work().
+    //*************************************************************************
+    timestamp_type mean_time() const
+    {
+      return (invocations == 0U) ? timestamp_type(0) : timestamp_type(total_time / invocations);
+    }
+
+    uint32_t       invocations; ///< Calls to task_process_work().
+    uint64_t       total_time;  ///< Total time in task_process_work().
+    timestamp_type max_time;    ///< Longest call to task_process_work().
+  };
+
+  namespace private_scheduler_statistics
+  {
+    //*************************************************************************
+    /// Stands in for a task in the list given to the wrapped policy, and
+    /// times its calls to task_process_work().
+    //*************************************************************************
+    class task_proxy : public etl::task
+    {
+    public:
+
+      typedef etl::task_statistics::timestamp_type timestamp_type;
+      typedef etl::delegate<timestamp_type(void)>  clock_type;
+
+      task_proxy()
+        : task(0)
+        , p_task(ETL_NULLPTR)
+        , p_clock(ETL_NULLPTR)
+      {
+      }
+
+      void bind(etl::task* p_task_, const clock_type* p_clock_)
+      {
+        p_task  = p_task_;
+        p_clock = p_clock_;
+      }
+
+      virtual uint32_t task_request_work() const ETL_OVERRIDE
+      {
+        return p_task->task_request_work();
+      }
+
+      virtual void task_process_work() ETL_OVERRIDE
+      {
+        ++statistics.invocations;
+
+        if (p_clock->is_valid())
+        {
+          const timestamp_type start = (*p_clock)();
+
+          p_task->task_process_work();
+
+          timestamp_type duration = (*p_clock)();
+          duration -= start;
+
+          statistics.total_time += duration;
+
+          if (duration > statistics.max_time)
+          {
+            statistics.max_time = duration;
+          }
+        }
+        else
+        {
+          p_task->task_process_work();
+        }
+      }
+
+      etl::task*          p_task;
+      const clock_type*   p_clock;
+      etl::task_statistics statistics;
+    };
+  }
+
+  //***************************************************************************
+  /// A policy that records runtime statistics for another policy.
+  /// Records, for each task, the number of calls to task_process_work() and
+  /// their total and longest times, and for the scheduler the number of
+  /// cycles, the number of idle cycles, and the time spent busy and idle.
+  /// Times are read from a user supplied clock, such as a cycle counter,
+  /// and are zero without one. Differences are taken modulo the timestamp
+  /// type, so the clock may wrap.
+  /// Each cycle is counted as busy or idle up to the start of the next, so
+  /// idle time includes the scheduler's idle callback.
+  ///\code
+  /// typedef etl::scheduler_policy_statistics<etl::scheduler_policy_highest_priority, 8> Policy;
+  /// etl::scheduler<Policy, 8> scheduler;
+  /// scheduler.get_policy().set_clock(Policy::clock_type::create<read_cycle_counter>());
+  ///\endcode
+  /// The wrapped policy sees stand-ins for the tasks, so
+  /// scheduler_policy_ready_bitmap may not be wrapped.
+  ///\ingroup scheduler_statistics
+  //***************************************************************************
+  template <typename TSchedulerPolicy, size_t MAX_TASKS>
+  class scheduler_policy_statistics
+  {
+  public:
+
+    typedef etl::task_statistics::timestamp_type timestamp_type;
+    typedef etl::delegate<timestamp_type(void)>  clock_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    scheduler_policy_statistics()
+      : clock()
+    {
+      clear_statistics();
+    }
+
+    //*************************************************************************
+    /// Sets the clock used to time tasks and cycles.
+    //*************************************************************************
+    void set_clock(const clock_type& clock_)
+    {
+      clock = clock_;
+      has_cycle_start = false;
+    }
+
+    //*************************************************************************
+    /// Clears all of the statistics.
+    //*************************************************************************
+    void clear_statistics()
+    {
+      for (size_t i = 0U; i < MAX_TASKS; ++i)
+      {
+        proxies[i].statistics = etl::task_statistics();
+      }
+
+      cycles          = 0U;
+      idle_cycles     = 0U;
+      busy_time       = 0U;
+      idle_time       = 0U;
+      last_was_idle   = false;
+      has_cycle_start = false;
+      cycle_start     = timestamp_type(0);
+    }
+
+    //*************************************************************************
+    /// The statistics for a task, or null if it has not been scheduled.
+    //*************************************************************************
+    const etl::task_statistics* get_task_statistics(const etl::task& task) const
+    {
+      for (size_t i = 0U; i < proxy_list.size(); ++i)
+      {
+        if (proxies[i].p_task == &task)
+        {
+          return &proxies[i].statistics;
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The number of scheduling cycles.
+    //*************************************************************************
+    uint32_t get_cycles() const
+    {
+      return cycles;
+    }
+
+    //*************************************************************************
+    /// The number of cycles in which no task had work.
+    //*************************************************************************
+    uint32_t get_idle_cycles() const
+    {
+      return idle_cycles;
+    }
+
+    //*************************************************************************
+    /// The time from the start of busy cycles to the start of the next.
+    //*************************************************************************
+    uint64_t get_busy_time() const
+    {
+      return busy_time;
+    }
+
+    //*************************************************************************
+    /// The time from the start of idle cycles to the start of the next.
+    //*************************************************************************
+    uint64_t get_idle_time() const
+    {
+      return idle_time;
+    }
+
+    //*************************************************************************
+    /// The proportion of time spent idle, or of cycles that were idle if
+    /// there is no clock.
+    //*************************************************************************
+    double get_idle_ratio() const
+    {
+      if ((busy_time + idle_time) != 0U)
+      {
+        return double(idle_time) / double(busy_time + idle_time);
+      }
+
+      return (cycles == 0U) ? 0.0 : double(idle_cycles) / double(cycles);
+    }
+
+    //*************************************************************************
+    /// Schedules the tasks with the wrapped policy.
+    //*************************************************************************
+    bool schedule_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      if (proxy_list.size() != task_list.size())
+      {
+        bind_tasks(task_list);
+      }
+
+      if (clock.is_valid())
+      {
+        const timestamp_type now = clock();
+
+        if (has_cycle_start)
+        {
+          timestamp_type duration = now;
+          duration -= cycle_start;
+
+          if (last_was_idle)
+          {
+            idle_time += duration;
+          }
+          else
+          {
+            busy_time += duration;
+          }
+        }
+
+        cycle_start     = now;
+        has_cycle_start = true;
+      }
+
+      const bool idle = policy.schedule_tasks(proxy_list);
+
+      ++cycles;
+
+      if (idle)
+      {
+        ++idle_cycles;
+      }
+
+      last_was_idle = idle;
+
+      return idle;
+    }
+
+  private:
+
+    typedef private_scheduler_statistics::task_proxy task_proxy;
+
+    //*************************************************************************
+    /// Points the stand-ins at the tasks, keeping the statistics of tasks that
+    /// were already scheduled.
+    //*************************************************************************
+    void bind_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      etl::task_statistics statistics[MAX_TASKS];
+
+      for (size_t i = 0U; i < task_list.size(); ++i)
+      {
+        const etl::task_statistics* p_statistics = get_task_statistics(*task_list[i]);
+
+        if (p_statistics != ETL_NULLPTR)
+        {
+          statistics[i] = *p_statistics;
+        }
+      }
+
+      proxy_list.clear();
+
+      for (size_t i = 0U; i < task_list.size(); ++i)
+      {
+        proxies[i].bind(task_list[i], &clock);
+        proxies[i].statistics = statistics[i];
+        proxy_list.push_back(&proxies[i]);
+      }
+    }
+
+    TSchedulerPolicy                     policy;
+    clock_type                           clock;
+    task_proxy                           proxies[MAX_TASKS];
+    etl::vector<etl::task*, MAX_TASKS>   proxy_list;
+
+    uint32_t       cycles;
+    uint32_t       idle_cycles;
+    uint64_t       busy_time;
+    uint64_t       idle_time;
+    bool           last_was_idle;
+    bool           has_cycle_start;
+    timestamp_type cycle_start;
+  };
+}
+
+#endif
@@ -0,0 +1,1354 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_SEGMENTED_DEQUE_INCLUDED
+#define ETL_SEGMENTED_DEQUE_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "initializer_list.h"
+#include "ipool.h"
+#include "iterator.h"
+#include "memory.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup segmented_deque segmented_deque
+/// A double ended queue that stores its items in fixed size blocks allocated
+/// on demand from a shared etl::ipool. Only the blocks in use are held, so
+/// many deques, each with a large maximum size, may share one memory budget.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup segmented_deque
+  /// Exception base for segmented_deque
+  //***************************************************************************
+  class segmented_deque_exception : public etl::exception
+  {
+  public:
+
+    segmented_deque_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup segmented_deque
+  /// Full exception.
+  /// The deque is at its maximum size.
+  //***************************************************************************
+  class segmented_deque_full : public segmented_deque_exception
+  {
+  public:
+
+    segmented_deque_full(string_type file_name_, numeric_type line_number_)
+      : segmented_deque_exception(ETL_ERROR_TEXT("segmented_deque:full", ETL_SEGMENTED_DEQUE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup segmented_deque
+  /// Empty exception.
+  //***************************************************************************
+  class segmented_deque_empty : public segmented_deque_exception
+  {
+  public:
+
+    segmented_deque_empty(string_type file_name_, numeric_type line_number_)
+      : segmented_deque_exception(ETL_ERROR_TEXT("segmented_deque:empty", ETL_SEGMENTED_DEQUE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup segmented_deque
+  /// Out of bounds exception.
+  //***************************************************************************
+  class segmented_deque_out_of_bounds : public segmented_deque_exception
+  {
+  public:
+
+    segmented_deque_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : segmented_deque_exception(ETL_ERROR_TEXT("segmented_deque:bounds", ETL_SEGMENTED_DEQUE_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized segmented_deques.
+  /// Can be used as a reference type for all segmented_deques containing a
+  /// specific type with a specific block size.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  template <typename T, size_t Block_Size>
+  class isegmented_deque
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Block_Size > 0U, "Block_Size must be greater than zero");
+
+    typedef T                 value_type;
+    typedef T&                reference;
+    typedef const T&          const_reference;
+#if ETL_USING_CPP11
+    typedef T&&               rvalue_reference;
+#endif
+    typedef T*                pointer;
+    typedef const T*          const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    /// The type of a block. The pool must be able to allocate these.
+    typedef typename etl::aligned_storage<sizeof(T) * Block_Size, etl::alignment_of<T>::value>::type block_type;
+
+    static ETL_CONSTANT size_t BLOCK_SIZE = Block_Size;
+
+    //*************************************************************************
+    /// Iterator
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, T>
+    {
+    public:
+
+      friend class isegmented_deque;
+      friend class const_iterator;
+
+      //***************************************************
+      iterator()
+        : index(0)
+        , p_deque(ETL_NULLPTR)
+      {
+      }
+
+      //***************************************************
+      iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      //***************************************************
+      iterator operator ++(int)
+      {
+        iterator previous(*this);
+        ++index;
+        return previous;
+      }
+
+      //***************************************************
+      iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      //***************************************************
+      iterator operator --(int)
+      {
+        iterator previous(*this);
+        --index;
+        return previous;
+      }
+
+      //***************************************************
+      iterator& operator +=(difference_type offset)
+      {
+        index += offset;
+        return *this;
+      }
+
+      //***************************************************
+      iterator& operator -=(difference_type offset)
+      {
+        index -= offset;
+        return *this;
+      }
+
+      //***************************************************
+      reference operator *() const
+      {
+        return p_deque->element(size_type(index));
+      }
+
+      //***************************************************
+      pointer operator ->() const
+      {
+        return &p_deque->element(size_type(index));
+      }
+
+      //***************************************************
+      reference operator [](difference_type offset) const
+      {
+        return p_deque->element(size_type(index + offset));
+      }
+
+      //***************************************************
+      friend iterator operator +(const iterator& lhs, difference_type offset)
+      {
+        iterator result(lhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend iterator operator +(difference_type offset, const iterator& rhs)
+      {
+        iterator result(rhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend iterator operator -(const iterator& lhs, difference_type offset)
+      {
+        iterator result(lhs);
+        result -= offset;
+        return result;
+      }
+
+      //***************************************************
+      friend difference_type operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index - rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //***************************************************
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      //***************************************************
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      //***************************************************
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      //***************************************************
+      iterator(difference_type index_, isegmented_deque& the_deque)
+        : index(index_)
+        , p_deque(&the_deque)
+      {
+      }
+
+      difference_type   index;
+      isegmented_deque* p_deque;
+    };
+
+    //*************************************************************************
+    /// Const Iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, const T>
+    {
+    public:
+
+      friend class isegmented_deque;
+
+      //***************************************************
+      const_iterator()
+        : index(0)
+        , p_deque(ETL_NULLPTR)
+      {
+      }
+
+      //***************************************************
+      const_iterator(const typename isegmented_deque::iterator& other)
+        : index(other.index)
+        , p_deque(other.p_deque)
+      {
+      }
+
+      //***************************************************
+      const_iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      //***************************************************
+      const_iterator operator ++(int)
+      {
+        const_iterator previous(*this);
+        ++index;
+        return previous;
+      }
+
+      //***************************************************
+      const_iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      //***************************************************
+      const_iterator operator --(int)
+      {
+        const_iterator previous(*this);
+        --index;
+        return previous;
+      }
+
+      //***************************************************
+      const_iterator& operator +=(difference_type offset)
+      {
+        index += offset;
+        return *this;
+      }
+
+      //***************************************************
+      const_iterator& operator -=(difference_type offset)
+      {
+        index -= offset;
+        return *this;
+      }
+
+      //***************************************************
+      const_reference operator *() const
+      {
+        return p_deque->element(size_type(index));
+      }
+
+      //***************************************************
+      const_pointer operator ->() const
+      {
+        return &p_deque->element(size_type(index));
+      }
+
+      //***************************************************
+      const_reference operator [](difference_type offset) const
+      {
+        return p_deque->element(size_type(index + offset));
+      }
+
+      //***************************************************
+      friend const_iterator operator +(const const_iterator& lhs, difference_type offset)
+      {
+        const_iterator result(lhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend const_iterator operator +(difference_type offset, const const_iterator& rhs)
+      {
+        const_iterator result(rhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend const_iterator operator -(const const_iterator& lhs, difference_type offset)
+      {
+        const_iterator result(lhs);
+        result -= offset;
+        return result;
+      }
+
+      //***************************************************
+      friend difference_type operator -(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index - rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //***************************************************
+      friend bool operator <(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator <=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      //***************************************************
+      friend bool operator >(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      //***************************************************
+      friend bool operator >=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      //***************************************************
+      const_iterator(difference_type index_, const isegmented_deque& the_deque)
+        : index(index_)
+        , p_deque(&the_deque)
+      {
+      }
+
+      difference_type         index;
+      const isegmented_deque* p_deque;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets an iterator to the beginning of the deque.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(0, *this);
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the beginning of the deque.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(0, *this);
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the beginning of the deque.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(0, *this);
+    }
+
+    //*************************************************************************
+    /// Gets an iterator to the end of the deque.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(difference_type(current_size), *this);
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the end of the deque.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(difference_type(current_size), *this);
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the end of the deque.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(difference_type(current_size), *this);
+    }
+
+    //*************************************************************************
+    /// Gets a reverse iterator to the end of the deque.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the end of the deque.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the end of the deque.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets a reverse iterator to the beginning of the deque.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the beginning of the deque.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the beginning of the deque.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the item at the index.
+    /// If asserts or exceptions are enabled, emits an etl::segmented_deque_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    reference at(size_type index)
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(segmented_deque_out_of_bounds));
+
+      return element(index);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the index.
+    /// If asserts or exceptions are enabled, emits an etl::segmented_deque_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    const_reference at(size_type index) const
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(segmented_deque_out_of_bounds));
+
+      return element(index);
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the item at the index.
+    //*************************************************************************
+    reference operator [](size_type index)
+    {
+      return element(index);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the index.
+    //*************************************************************************
+    const_reference operator [](size_type index) const
+    {
+      return element(index);
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the item at the front of the deque.
+    //*************************************************************************
+    reference front()
+    {
+      return element(0U);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the front of the deque.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return element(0U);
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the item at the back of the deque.
+    //*************************************************************************
+    reference back()
+    {
+      return element(current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the back of the deque.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return element(current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Adds an item to the back of the deque.
+    /// If asserts or exceptions are enabled, emits an etl::segmented_deque_full if the deque is full
+    /// The pool emits an etl::pool_no_allocation if it has no free blocks.
+    //*************************************************************************
+    void push_back(const_reference value)
+    {
+      pointer p = create_back();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(value);
+        ++current_size;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Adds an item to the back of the deque.
+    /// If asserts or exceptions are enabled, emits an etl::segmented_deque_full if the deque is full
+    /// The pool emits an etl::pool_no_allocation if it has no free blocks.
+    //*************************************************************************
+    void push_back(rvalue_reference value)
+    {
+      pointer p = create_back();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(etl::move(value));
+        ++current_size;
+      }
+    }
+
+    //*************************************************************************
+    /// Emplaces an item at the back of the deque.
+    /// If asserts or exceptions are enabled, emits an etl::segmented_deque_full if the deque is full
+    /// The pool emits an etl::pool_no_allocation if it has no free blocks.
+    //*************************************************************************
+    template <typename ... Args>
+    reference emplace_back(Args&& ... args)
+    {
+      pointer p = ::new (create_back()) T(etl::forward<Args>(args)...);
+      ++current_size;
+
+      return *p;
+    }
+#else
+    //*************************************************************************
+    /// Emplaces an item at the back of the deque.
+    //*************************************************************************
+    reference emplace_back()
+    {
+      pointer p = ::new (create_back()) T();
+      ++current_size;
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces an item at the back of the deque.
+    //*************************************************************************
+    template <typename T1>
+    reference emplace_back(const T1& value1)
+    {
+      pointer p = ::new (create_back()) T(value1);
+      ++current_size;
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces an item at the back of the deque.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    reference emplace_back(const T1& value1, const T2& value2)
+    {
+      pointer p = ::new (create_back()) T(value1, value2);
+      ++current_size;
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces an item at the back of the deque.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    reference emplace_back(const T1& value1, const T2& value2, const T3& value3)
+    {
+      pointer p = ::new (create_back()) T(value1, value2, value3);
+      ++current_size;
+
+      return *p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Adds an item to the front of the deque.
+    /// If asserts or exceptions are enabled, emits an etl::segmented_deque_full if the deque is full
+    /// The pool emits an etl::pool_no_allocation if it has no free blocks.
+    //*************************************************************************
+    void push_front(const_reference value)
+    {
+      pointer p = create_front();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(value);
+        commit_front();
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Adds an item to the front of the deque.
+    /// If asserts or exceptions are enabled, emits an etl::segmented_deque_full if the deque is full
+    /// The pool emits an etl::pool_no_allocation if it has no free blocks.
+    //*************************************************************************
+    void push_front(rvalue_reference value)
+    {
+      pointer p = create_front();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(etl::move(value));
+        commit_front();
+      }
+    }
+
+    //*************************************************************************
+    /// Emplaces an item at the front of the deque.
+    /// If asserts or exceptions are enabled, emits an etl::segmented_deque_full if the deque is full
+    /// The pool emits an etl::pool_no_allocation if it has no free blocks.
+    //*************************************************************************
+    template <typename ... Args>
+    reference emplace_front(Args&& ... args)
+    {
+      pointer p = ::new (create_front()) T(etl::forward<Args>(args)...);
+      commit_front();
+
+      return *p;
+    }
+#else
+    //*************************************************************************
+    /// Emplaces an item at the front of the deque.
+    //*************************************************************************
+    reference emplace_front()
+    {
+      pointer p = ::new (create_front()) T();
+      commit_front();
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces an item at the front of the deque.
+    //*************************************************************************
+    template <typename T1>
+    reference emplace_front(const T1& value1)
+    {
+      pointer p = ::new (create_front()) T(value1);
+      commit_front();
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces an item at the front of the deque.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    reference emplace_front(const T1& value1, const T2& value2)
+    {
+      pointer p = ::new (create_front()) T(value1, value2);
+      commit_front();
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces an item at the front of the deque.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    reference emplace_front(const T1& value1, const T2& value2, const T3& value3)
+    {
+      pointer p = ::new (create_front()) T(value1, value2, value3);
+      commit_front();
+
+      return *p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the item at the back of the deque.
+    /// Releases the back block to the pool when it becomes empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(segmented_deque_empty));
+
+      --current_size;
+      etl::destroy_at(&element(current_size));
+
+      if (current_size == 0U)
+      {
+        release_blocks();
+      }
+      else if ((first_offset + current_size) <= ((n_blocks - 1U) * Block_Size))
+      {
+        --n_blocks;
+        p_pool->release(p_map[map_index(n_blocks)]);
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the item at the front of the deque.
+    /// Releases the front block to the pool when it becomes empty.
+    //*************************************************************************
+    void pop_front()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(segmented_deque_empty));
+
+      etl::destroy_at(&element(0U));
+      --current_size;
+      ++first_offset;
+
+      if (current_size == 0U)
+      {
+        release_blocks();
+      }
+      else if (first_offset == Block_Size)
+      {
+        p_pool->release(p_map[first_block]);
+        first_block  = map_index(1U);
+        first_offset = 0U;
+        --n_blocks;
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns a range of values to the deque.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        push_back(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns n copies of a value to the deque.
+    //*************************************************************************
+    void assign(size_type n, const_reference value)
+    {
+      clear();
+
+      for (size_type i = 0U; i < n; ++i)
+      {
+        push_back(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the deque and releases all of its blocks to the pool.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR(!etl::is_trivially_destructible<T>::value)
+      {
+        for (size_type i = 0U; i < current_size; ++i)
+        {
+          etl::destroy_at(&element(i));
+        }
+      }
+
+      current_size = 0U;
+      release_blocks();
+    }
+
+    //*************************************************************************
+    /// Gets the number of items in the deque.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the deque is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the deque is at its maximum size.
+    /// A push may still fail if the pool has no free blocks.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of items in the deque.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of items in the deque.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets the number of items that may be added before the deque reaches its maximum size.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the number of blocks held from the pool.
+    //*************************************************************************
+    size_type blocks() const
+    {
+      return n_blocks;
+    }
+
+    //*************************************************************************
+    /// Gets the pool that the blocks are allocated from.
+    //*************************************************************************
+    etl::ipool& get_pool() const
+    {
+      return *p_pool;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    isegmented_deque& operator =(const isegmented_deque& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    isegmented_deque(pointer* p_map_, size_type map_size_, size_type max_size_, etl::ipool& pool_)
+      : p_map(p_map_)
+      , p_pool(&pool_)
+      , first_block(0U)
+      , first_offset(0U)
+      , n_blocks(0U)
+      , current_size(0U)
+      , MAP_SIZE(map_size_)
+      , MAX_SIZE(max_size_)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Takes the blocks from another deque that uses the same pool.
+    /// Otherwise moves the items one at a time.
+    //*************************************************************************
+    void move_from(isegmented_deque& other)
+    {
+      if ((p_pool == other.p_pool) && (other.n_blocks <= MAP_SIZE))
+      {
+        for (size_type i = 0U; i < other.n_blocks; ++i)
+        {
+          p_map[i] = other.p_map[other.map_index(i)];
+        }
+
+        first_block  = 0U;
+        first_offset = other.first_offset;
+        n_blocks     = other.n_blocks;
+        current_size = other.current_size;
+
+        other.current_size = 0U;
+        other.n_blocks     = 0U;
+        other.first_block  = 0U;
+        other.first_offset = 0U;
+      }
+      else
+      {
+        for (size_type i = 0U; i < other.current_size; ++i)
+        {
+          push_back(etl::move(other.element(i)));
+        }
+
+        other.clear();
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~isegmented_deque()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the map index of the n'th block.
+    //*************************************************************************
+    size_type map_index(size_type n) const
+    {
+      size_type index = first_block + n;
+
+      return (index >= MAP_SIZE) ? index - MAP_SIZE : index;
+    }
+
+    //*************************************************************************
+    /// Gets the i'th item.
+    //*************************************************************************
+    reference element(size_type i)
+    {
+      const size_type position = first_offset + i;
+
+      return p_map[map_index(position / Block_Size)][position % Block_Size];
+    }
+
+    //*************************************************************************
+    /// Gets the i'th item.
+    //*************************************************************************
+    const_reference element(size_type i) const
+    {
+      const size_type position = first_offset + i;
+
+      return p_map[map_index(position / Block_Size)][position % Block_Size];
+    }
+
+    //*************************************************************************
+    /// Allocates a block from the pool.
+    //*************************************************************************
+    pointer allocate_block()
+    {
+      return reinterpret_cast<pointer>(p_pool->template allocate<block_type>());
+    }
+
+    //*************************************************************************
+    /// Gets the storage for a new item at the back, adding a block if needed.
+    /// Returns a null pointer if the deque is full or the pool has no free blocks.
+    //*************************************************************************
+    pointer create_back()
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(segmented_deque_full), ETL_NULLPTR);
+
+      const size_type position = first_offset + current_size;
+
+      if (position == (n_blocks * Block_Size))
+      {
+        pointer p_block = allocate_block();
+
+        if (p_block == ETL_NULLPTR)
+        {
+          return ETL_NULLPTR;
+        }
+
+        p_map[map_index(n_blocks)] = p_block;
+        ++n_blocks;
+      }
+
+      return &p_map[map_index(position / Block_Size)][position % Block_Size];
+    }
+
+    //*************************************************************************
+    /// Gets the storage for a new item at the front, adding a block if needed.
+    /// Returns a null pointer if the deque is full or the pool has no free blocks.
+    //*************************************************************************
+    pointer create_front()
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(segmented_deque_full), ETL_NULLPTR);
+
+      if (first_offset == 0U)
+      {
+        pointer p_block = allocate_block();
+
+        if (p_block == ETL_NULLPTR)
+        {
+          return ETL_NULLPTR;
+        }
+
+        first_block  = (first_block == 0U) ? MAP_SIZE - 1U : first_block - 1U;
+        p_map[first_block] = p_block;
+        first_offset = Block_Size;
+        ++n_blocks;
+      }
+
+      return &p_map[first_block][first_offset - 1U];
+    }
+
+    //*************************************************************************
+    /// Records the item created by create_front.
+    //*************************************************************************
+    void commit_front()
+    {
+      --first_offset;
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Releases all of the blocks to the pool.
+    //*************************************************************************
+    void release_blocks()
+    {
+      for (size_type i = 0U; i < n_blocks; ++i)
+      {
+        p_pool->release(p_map[map_index(i)]);
+      }
+
+      first_block  = 0U;
+      first_offset = 0U;
+      n_blocks     = 0U;
+    }
+
+    // Disable copy construction.
+    isegmented_deque(const isegmented_deque&) ETL_DELETE;
+
+    pointer*    p_map;        ///< The ring of block pointers.
+    etl::ipool* p_pool;       ///< The pool that blocks are allocated from.
+    size_type   first_block;  ///< The map index of the first block.
+    size_type   first_offset; ///< The index of the first item in the first block.
+    size_type   n_blocks;     ///< The number of blocks held.
+    size_type   current_size; ///< The number of items.
+
+    const size_type MAP_SIZE; ///< The number of block pointers in the map.
+    const size_type MAX_SIZE; ///< The maximum number of items.
+  };
+
+  template <typename T, size_t Block_Size>
+  ETL_CONSTANT size_t isegmented_deque<T, Block_Size>::BLOCK_SIZE;
+
+  //***************************************************************************
+  /// A segmented_deque with a compile time maximum size, whose blocks of
+  /// Block_Size items are allocated from a shared pool as they are needed.
+  /// The pool's items must be at least as large and aligned as block_type,
+  /// for example etl::pool<segmented_deque<T, N, B>::block_type, Blocks>.
+  ///\tparam T          The type stored in the deque.
+  ///\tparam Max_Size   The maximum number of items.
+  ///\tparam Block_Size The number of items in each block.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  template <typename T, size_t Max_Size, size_t Block_Size = 16U>
+  class segmented_deque : public etl::isegmented_deque<T, Block_Size>
+  {
+  private:
+
+    typedef etl::isegmented_deque<T, Block_Size> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(Max_Size > 0U, "Max_Size must be greater than zero");
+
+    typedef typename base_t::pointer   pointer;
+    typedef typename base_t::size_type size_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = Max_Size;
+
+    /// The largest number of blocks that Max_Size items may span.
+    static ETL_CONSTANT size_t MAX_BLOCKS = (Max_Size + (2U * Block_Size) - 2U) / Block_Size;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit segmented_deque(etl::ipool& pool_)
+      : base_t(map, MAX_BLOCKS, Max_Size, pool_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from a range.
+    //*************************************************************************
+    template <typename TIterator>
+    segmented_deque(TIterator first, TIterator last, etl::ipool& pool_, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+      : base_t(map, MAX_BLOCKS, Max_Size, pool_)
+    {
+      base_t::assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor from an initializer list.
+    //*************************************************************************
+    segmented_deque(std::initializer_list<T> init, etl::ipool& pool_)
+      : base_t(map, MAX_BLOCKS, Max_Size, pool_)
+    {
+      base_t::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Copy constructor. Uses the same pool as other.
+    //*************************************************************************
+    segmented_deque(const segmented_deque& other)
+      : base_t(map, MAX_BLOCKS, Max_Size, other.get_pool())
+    {
+      base_t::assign(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Copy constructor with an explicit pool.
+    //*************************************************************************
+    segmented_deque(const segmented_deque& other, etl::ipool& pool_)
+      : base_t(map, MAX_BLOCKS, Max_Size, pool_)
+    {
+      base_t::assign(other.begin(), other.end());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor. Takes the blocks from other.
+    //*************************************************************************
+    segmented_deque(segmented_deque&& other)
+      : base_t(map, MAX_BLOCKS, Max_Size, other.get_pool())
+    {
+      base_t::move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor. Releases all blocks to the pool.
+    //*************************************************************************
+    ~segmented_deque()
+    {
+      base_t::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    segmented_deque& operator =(const segmented_deque& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    segmented_deque& operator =(segmented_deque&& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::clear();
+        base_t::move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    pointer map[MAX_BLOCKS]; ///< The ring of block pointers.
+  };
+
+  template <typename T, size_t Max_Size, size_t Block_Size>
+  ETL_CONSTANT size_t segmented_deque<T, Max_Size, Block_Size>::MAX_SIZE;
+
+  template <typename T, size_t Max_Size, size_t Block_Size>
+  ETL_CONSTANT size_t segmented_deque<T, Max_Size, Block_Size>::MAX_BLOCKS;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  template <typename T, size_t Block_Size>
+  bool operator ==(const etl::isegmented_deque<T, Block_Size>& lhs, const etl::isegmented_deque<T, Block_Size>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  template <typename T, size_t Block_Size>
+  bool operator !=(const etl::isegmented_deque<T, Block_Size>& lhs, const etl::isegmented_deque<T, Block_Size>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  template <typename T, size_t Block_Size>
+  bool operator <(const etl::isegmented_deque<T, Block_Size>& lhs, const etl::isegmented_deque<T, Block_Size>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+}
+
+#endif
@@ -0,0 +1,414 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEGREGATED_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+#define ETL_SEGREGATED_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "alignment.h"
+#include "bit.h"
+#include "binary.h"
+#include "power.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //*************************************************************************
+  /// The interface for a memory block allocator with several size classes.
+  /// Class 'n' holds blocks of Min_Block_Size * 2^n bytes.
+  /// A request is served by the smallest class that fits, which is found
+  /// directly from the requested size. If that class is exhausted, the next
+  /// larger classes are tried.
+  //*************************************************************************
+  class isegregated_memory_block_allocator : public imemory_block_allocator
+  {
+  public:
+
+    //*************************************************************************
+    /// The number of size classes.
+    //*************************************************************************
+    size_t number_of_classes() const
+    {
+      return n_classes;
+    }
+
+    //*************************************************************************
+    /// The size class that serves a required size.
+    /// Returns number_of_classes() if the size is too large for all classes.
+    //*************************************************************************
+    size_t class_index(size_t required_size) const
+    {
+      if (required_size <= min_block_size)
+      {
+        return 0U;
+      }
+
+      const size_t index = etl::bit_width((required_size - 1U) >> min_block_shift);
+
+      return (index < n_classes) ? index : n_classes;
+    }
+
+    //*************************************************************************
+    /// The block size of a size class.
+    //*************************************************************************
+    size_t block_size(size_t index) const
+    {
+      return min_block_size << index;
+    }
+
+    //*************************************************************************
+    /// The number of blocks in a size class.
+    //*************************************************************************
+    size_t max_size(size_t index) const
+    {
+      return classes[index].capacity;
+    }
+
+    //*************************************************************************
+    /// The number of allocated blocks in a size class.
+    //*************************************************************************
+    size_t size(size_t index) const
+    {
+      return classes[index].allocated;
+    }
+
+    //*************************************************************************
+    /// The number of free blocks in a size class.
+    //*************************************************************************
+    size_t available(size_t index) const
+    {
+      return classes[index].capacity - classes[index].allocated;
+    }
+
+    //*************************************************************************
+    /// The highest number of blocks allocated at once from a size class.
+    //*************************************************************************
+    size_t peak_size(size_t index) const
+    {
+      return classes[index].peak;
+    }
+
+    //*************************************************************************
+    /// The number of requests for a size class that it could not serve.
+    /// These were either served by a larger class, or failed.
+    //*************************************************************************
+    size_t overflow_count(size_t index) const
+    {
+      return classes[index].overflows;
+    }
+
+    //*************************************************************************
+    /// The number of requests that could not be served at all.
+    //*************************************************************************
+    size_t failure_count() const
+    {
+      return failures;
+    }
+
+    //*************************************************************************
+    /// Resets the peak sizes and overflow and failure counts.
+    /// The peak sizes are reset to the current sizes.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      for (size_t i = 0U; i < n_classes; ++i)
+      {
+        classes[i].peak      = classes[i].allocated;
+        classes[i].overflows = 0U;
+      }
+
+      failures = 0U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The state of one size class.
+    //*************************************************************************
+    struct size_class
+    {
+      char*  p_begin;     ///< The first block.
+      char*  p_free;      ///< The first block in the free list.
+      size_t capacity;    ///< The number of blocks.
+      size_t initialised; ///< The number of blocks that have been added to the free list.
+      size_t allocated;   ///< The number of allocated blocks.
+      size_t peak;        ///< The highest number of allocated blocks.
+      size_t overflows;   ///< The number of requests that could not be served.
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param p_buffer        The storage for all of the blocks, class 0 first.
+    /// \param classes_        The class state storage.
+    /// \param capacities      The number of blocks in each class.
+    /// \param n_classes_      The number of classes.
+    /// \param min_block_size_ The block size of class 0. Must be a power of 2.
+    /// \param alignment_      The alignment of all blocks.
+    //*************************************************************************
+    isegregated_memory_block_allocator(char*         p_buffer,
+                                       size_class*   classes_,
+                                       const size_t* capacities,
+                                       size_t        n_classes_,
+                                       size_t        min_block_size_,
+                                       size_t        alignment_)
+      : classes(classes_)
+      , n_classes(n_classes_)
+      , min_block_size(min_block_size_)
+      , min_block_shift(etl::count_trailing_zeros(min_block_size_))
+      , alignment(alignment_)
+      , failures(0U)
+    {
+      for (size_t i = 0U; i < n_classes; ++i)
+      {
+        classes[i].p_begin     = p_buffer;
+        classes[i].p_free      = ETL_NULLPTR;
+        classes[i].capacity    = capacities[i];
+        classes[i].initialised = 0U;
+        classes[i].allocated   = 0U;
+        classes[i].peak        = 0U;
+        classes[i].overflows   = 0U;
+
+        p_buffer += capacities[i] * block_size(i);
+      }
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if (required_alignment > alignment)
+      {
+        return ETL_NULLPTR;
+      }
+
+      const size_t first = class_index(required_size);
+
+      for (size_t i = first; i < n_classes; ++i)
+      {
+        void* p = allocate_from(classes[i], block_size(i));
+
+        if (p != ETL_NULLPTR)
+        {
+          return p;
+        }
+
+        ++classes[i].overflows;
+      }
+
+      ++failures;
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      const size_t index = owner_class(pblock);
+
+      if (index == n_classes)
+      {
+        return false;
+      }
+
+      size_class& sc = classes[index];
+
+      char* p = const_cast<char*>(static_cast<const char*>(pblock));
+
+      *reinterpret_cast<char**>(p) = sc.p_free;
+      sc.p_free = p;
+      --sc.allocated;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      return owner_class(pblock) != n_classes;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocates a block from a size class.
+    /// Blocks are added to the free list as they are first needed, so that
+    /// construction does not have to touch all of the storage.
+    //*************************************************************************
+    static void* allocate_from(size_class& sc, size_t size)
+    {
+      if (sc.allocated == sc.capacity)
+      {
+        return ETL_NULLPTR;
+      }
+
+      char* p;
+
+      if (sc.p_free != ETL_NULLPTR)
+      {
+        p = sc.p_free;
+        sc.p_free = *reinterpret_cast<char**>(p);
+      }
+      else
+      {
+        p = sc.p_begin + (sc.initialised * size);
+        ++sc.initialised;
+      }
+
+      ++sc.allocated;
+
+      if (sc.allocated > sc.peak)
+      {
+        sc.peak = sc.allocated;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// The class that owns a block, or n_classes if none.
+    //*************************************************************************
+    size_t owner_class(const void* const pblock) const
+    {
+      const char* p = static_cast<const char*>(pblock);
+
+      for (size_t i = 0U; i < n_classes; ++i)
+      {
+        const size_class& sc = classes[i];
+
+        if ((p >= sc.p_begin) && (p < (sc.p_begin + (sc.capacity * block_size(i)))))
+        {
+          // Class block sizes are powers of 2.
+          return ((static_cast<size_t>(p - sc.p_begin) & (block_size(i) - 1U)) == 0U) ? i : n_classes;
+        }
+      }
+
+      return n_classes;
+    }
+
+    // Disable copy construction and assignment.
+    isegregated_memory_block_allocator(const isegregated_memory_block_allocator&) ETL_DELETE;
+    isegregated_memory_block_allocator& operator =(const isegregated_memory_block_allocator&) ETL_DELETE;
+
+    size_class*  classes;
+    const size_t n_classes;
+    const size_t min_block_size;
+    const size_t min_block_shift;
+    const size_t alignment;
+    size_t       failures;
+  };
+
+#if ETL_USING_CPP11
+  namespace private_segregated_memory_block_allocator
+  {
+    //*************************************************************************
+    /// The total storage size for all of the classes.
+    //*************************************************************************
+    template <size_t Block_Size, size_t... Blocks_Per_Class>
+    struct buffer_size;
+
+    template <size_t Block_Size>
+    struct buffer_size<Block_Size>
+    {
+      static constexpr size_t value = 0U;
+    };
+
+    template <size_t Block_Size, size_t Blocks, size_t... Blocks_Per_Class>
+    struct buffer_size<Block_Size, Blocks, Blocks_Per_Class...>
+    {
+      static constexpr size_t value = (Block_Size * Blocks) + buffer_size<Block_Size * 2U, Blocks_Per_Class...>::value;
+    };
+  }
+
+  //*************************************************************************
+  /// A memory block allocator with several size classes.
+  /// Class 'n' holds VBlocks_Per_Class[n] blocks of VMin_Block_Size * 2^n bytes.
+  /// e.g. segregated_memory_block_allocator<16, 8, 32, 16, 8, 4> has
+  /// 32 x 16 byte, 16 x 32 byte, 8 x 64 byte and 4 x 128 byte blocks.
+  ///\tparam VMin_Block_Size   The smallest block size. Must be a power of 2, at least the size of a pointer.
+  ///\tparam VAlignment        The alignment of all blocks. Must not be larger than VMin_Block_Size.
+  ///\tparam VBlocks_Per_Class The number of blocks in each size class.
+  //*************************************************************************
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t... VBlocks_Per_Class>
+  class segregated_memory_block_allocator : public isegregated_memory_block_allocator
+  {
+  public:
+
+    static ETL_CONSTANT size_t Min_Block_Size = VMin_Block_Size;
+    static ETL_CONSTANT size_t Alignment      = VAlignment;
+    static ETL_CONSTANT size_t Classes        = sizeof...(VBlocks_Per_Class);
+
+    ETL_STATIC_ASSERT(Classes > 0U, "There must be at least one size class");
+    ETL_STATIC_ASSERT(etl::is_power_of_2<VMin_Block_Size>::value, "Min_Block_Size must be a power of 2");
+    ETL_STATIC_ASSERT((VAlignment != 0U) && ((VAlignment & (VAlignment - 1U)) == 0U), "Alignment must be a power of 2");
+    ETL_STATIC_ASSERT(VMin_Block_Size >= sizeof(char*), "Min_Block_Size must hold a pointer");
+    ETL_STATIC_ASSERT(VMin_Block_Size >= VAlignment, "Alignment must not be larger than Min_Block_Size");
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    segregated_memory_block_allocator()
+      : isegregated_memory_block_allocator(reinterpret_cast<char*>(&buffer), classes, capacities, Classes, VMin_Block_Size, VAlignment)
+    {
+    }
+
+  private:
+
+    static constexpr size_t capacities[Classes] = { VBlocks_Per_Class... };
+
+    typedef typename private_segregated_memory_block_allocator::buffer_size<VMin_Block_Size, VBlocks_Per_Class...> buffer_size;
+
+    typename etl::aligned_storage<buffer_size::value, VAlignment>::type buffer;
+    size_class                                                          classes[Classes];
+  };
+
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t... VBlocks_Per_Class>
+  constexpr size_t segregated_memory_block_allocator<VMin_Block_Size, VAlignment, VBlocks_Per_Class...>::Min_Block_Size;
+
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t... VBlocks_Per_Class>
+  constexpr size_t segregated_memory_block_allocator<VMin_Block_Size, VAlignment, VBlocks_Per_Class...>::Alignment;
+
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t... VBlocks_Per_Class>
+  constexpr size_t segregated_memory_block_allocator<VMin_Block_Size, VAlignment, VBlocks_Per_Class...>::Classes;
+
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t... VBlocks_Per_Class>
+  constexpr size_t segregated_memory_block_allocator<VMin_Block_Size, VAlignment, VBlocks_Per_Class...>::capacities[];
+#endif
+}
+
+#endif
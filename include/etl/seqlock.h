@@ -0,0 +1,217 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEQLOCK_INCLUDED
+#define ETL_SEQLOCK_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "spin_mutex.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+  #define ETL_HAS_SEQLOCK 1
+#else
+  #define ETL_HAS_SEQLOCK 0
+#endif
+
+#if ETL_HAS_SEQLOCK
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A sequence lock holding a small trivially copyable value.
+  /// Readers never write to shared memory. They copy the value, then retry if
+  /// a write overlapped the copy, as shown by the sequence count.
+  /// Writes are serialised on the sequence count, which is odd during a write.
+  /// The value is held as atomic words, so overlapping reads and writes are
+  /// not data races. Best for values of a few words that are read far more
+  /// often than they are written.
+  ///\tparam T The type of the value. Must be trivially copyable.
+  //***************************************************************************
+  template <typename T>
+  class seqlock
+  {
+  public:
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    seqlock()
+      : sequence(0U)
+    {
+      store(T());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an initial value.
+    //*************************************************************************
+    explicit seqlock(const T& value)
+      : sequence(0U)
+    {
+      store(value);
+    }
+
+    //*************************************************************************
+    /// Writes a new value.
+    /// Waits for any other write to complete.
+    //*************************************************************************
+    void write(const T& value)
+    {
+      private_spin_mutex::backoff backoff;
+
+      uint32_t expected = sequence.load(etl::memory_order_relaxed);
+
+      // Claim the write by making the sequence count odd.
+      while (((expected & 1U) != 0U) ||
+             !sequence.compare_exchange_weak(expected, expected + 1U, etl::memory_order_acquire))
+      {
+        backoff.wait();
+        expected = sequence.load(etl::memory_order_relaxed);
+      }
+
+      store(value);
+
+      sequence.store(expected + 2U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Reads the value.
+    /// Retries until it reads a value that no write overlapped.
+    //*************************************************************************
+    T read() const
+    {
+      private_spin_mutex::backoff backoff;
+
+      T value;
+
+      while (!try_read(value))
+      {
+        backoff.wait();
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Reads the value, once.
+    ///\param value Receives the value, if the read succeeded.
+    ///\return <b>true</b> if no write overlapped the read.
+    //*************************************************************************
+    bool try_read(T& value) const
+    {
+      uint32_t count;
+
+      return try_read(value, count);
+    }
+
+    //*************************************************************************
+    /// Reads the value, once, with the sequence count it was read at.
+    ///\param value Receives the value, if the read succeeded.
+    ///\param count Receives the sequence count from before the read.
+    ///              Odd if a write was in progress.
+    ///\return <b>true</b> if no write overlapped the read.
+    //*************************************************************************
+    bool try_read(T& value, uint32_t& count) const
+    {
+      const uint32_t before = sequence.load(etl::memory_order_acquire);
+
+      count = before;
+
+      if ((before & 1U) != 0U)
+      {
+        return false;
+      }
+
+      uint32_t buffer[Words];
+
+      // Acquire loads, so that the second sequence read cannot move before them.
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        buffer[i] = words[i].load(etl::memory_order_acquire);
+      }
+
+      if (sequence.load(etl::memory_order_relaxed) != before)
+      {
+        return false;
+      }
+
+      memcpy(&value, buffer, sizeof(T));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the sequence count, which increases by two for each write.
+    //*************************************************************************
+    uint32_t sequence_count() const
+    {
+      return sequence.load(etl::memory_order_acquire);
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Words = (sizeof(T) + sizeof(uint32_t) - 1U) / sizeof(uint32_t);
+
+    seqlock(const seqlock&) ETL_DELETE;
+    seqlock& operator=(const seqlock&) ETL_DELETE;
+
+    //*************************************************************************
+    /// Stores the value as words, with release stores so that a reader that
+    /// sees any of them also sees the odd sequence count.
+    //*************************************************************************
+    void store(const T& value)
+    {
+      uint32_t buffer[Words];
+
+      buffer[Words - 1U] = 0U;
+      memcpy(buffer, &value, sizeof(T));
+
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        words[i].store(buffer[i], etl::memory_order_release);
+      }
+    }
+
+    etl::atomic_uint32_t sequence;
+    etl::atomic_uint32_t words[Words];
+  };
+
+  template <typename T>
+  ETL_CONSTANT size_t seqlock<T>::Words;
+}
+
+#endif
+#endif
@@ -0,0 +1,528 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_SERIAL_SCHEMA_INCLUDED
+#define ETL_SERIAL_SCHEMA_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "smallest.h"
+#include "binary.h"
+#include "endianness.h"
+#include "byte_stream.h"
+#include "bit_stream.h"
+
+#include <stdint.h>
+#include <limits.h>
+#include <string.h>
+
+#if ETL_USING_CPP11
+
+///\defgroup serial_schema Serial schema
+/// Describes the wire format of a struct as a compile time list of fields,
+/// from which the encode and decode code is generated.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_serial_schema
+  {
+    //*************************************************************************
+    /// The sum of the field widths.
+    //*************************************************************************
+    template <typename... TFields>
+    struct total_bits;
+
+    template <>
+    struct total_bits<> : etl::integral_constant<size_t, 0U>
+    {
+    };
+
+    template <typename TField, typename... TRest>
+    struct total_bits<TField, TRest...> : etl::integral_constant<size_t, TField::Bits + total_bits<TRest...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// true if every field is a whole number of bytes wide.
+    //*************************************************************************
+    template <typename... TFields>
+    struct all_whole_bytes;
+
+    template <>
+    struct all_whole_bytes<> : etl::true_type
+    {
+    };
+
+    template <typename TField, typename... TRest>
+    struct all_whole_bytes<TField, TRest...> : etl::bool_constant<TField::Is_Whole_Bytes && all_whole_bytes<TRest...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Encodes and decodes whole byte fields at fixed offsets.
+    //*************************************************************************
+    template <size_t Offset, typename... TFields>
+    struct byte_codec;
+
+    template <size_t Offset>
+    struct byte_codec<Offset>
+    {
+      template <typename TObject>
+      static void encode(const TObject&, char*)
+      {
+      }
+
+      template <typename TObject>
+      static void decode(const char*, TObject&)
+      {
+      }
+    };
+
+    template <size_t Offset, typename TField, typename... TRest>
+    struct byte_codec<Offset, TField, TRest...>
+    {
+      typedef byte_codec<Offset + (TField::Bits / CHAR_BIT), TRest...> next;
+
+      template <typename TObject>
+      static void encode(const TObject& object, char* destination)
+      {
+        TField::store(destination + Offset, object);
+        next::encode(object, destination);
+      }
+
+      template <typename TObject>
+      static void decode(const char* source, TObject& object)
+      {
+        TField::load(source + Offset, object);
+        next::decode(source, object);
+      }
+    };
+
+    //*************************************************************************
+    /// Encodes and decodes packed fields through a bit stream.
+    //*************************************************************************
+    template <typename... TFields>
+    struct bit_codec;
+
+    template <>
+    struct bit_codec<>
+    {
+      template <typename TObject>
+      static void encode(const TObject&, etl::bit_stream_writer&)
+      {
+      }
+
+      template <typename TObject>
+      static void decode(etl::bit_stream_reader&, TObject&)
+      {
+      }
+    };
+
+    template <typename TField, typename... TRest>
+    struct bit_codec<TField, TRest...>
+    {
+      template <typename TObject>
+      static void encode(const TObject& object, etl::bit_stream_writer& stream)
+      {
+        TField::write(stream, object);
+        bit_codec<TRest...>::encode(object, stream);
+      }
+
+      template <typename TObject>
+      static void decode(etl::bit_stream_reader& stream, TObject& object)
+      {
+        TField::read(stream, object);
+        bit_codec<TRest...>::decode(stream, object);
+      }
+    };
+
+    //*************************************************************************
+    /// The class and value types of a pointer to member.
+    //*************************************************************************
+    template <typename T>
+    struct member_pointer_traits;
+
+    template <typename TObject, typename TValue>
+    struct member_pointer_traits<TValue TObject::*>
+    {
+      typedef TObject object_type;
+      typedef TValue  value_type;
+    };
+  }
+
+  //***************************************************************************
+  /// Describes one field of a serial schema.
+  /// Integral, bool and floating point members are supported. Integral and
+  /// bool members may be narrower than their type; signed values are sign
+  /// extended when decoded. Floating point members are always full width.
+  /// The endianness applies to fields that are a whole number of bytes wide.
+  /// Narrower fields are always written most significant bit first.
+  ///\tparam TObject The struct type.
+  ///\tparam TValue  The member type.
+  ///\tparam Member  The pointer to the member.
+  ///\tparam Bits_   The width of the field on the wire. Default: the width of TValue.
+  ///\tparam Endian_ The byte order of the field on the wire. Default: big.
+  ///\ingroup serial_schema
+  //***************************************************************************
+  template <typename TObject, typename TValue, TValue TObject::* Member, size_t Bits_ = CHAR_BIT * sizeof(TValue), int Endian_ = etl::endian::big>
+  struct serial_field
+  {
+    ETL_STATIC_ASSERT(etl::is_arithmetic<TValue>::value, "Field must be integral, bool or floating point");
+    ETL_STATIC_ASSERT((Bits_ > 0U) && (Bits_ <= (CHAR_BIT * sizeof(TValue))), "Field width out of range");
+    ETL_STATIC_ASSERT(!etl::is_floating_point<TValue>::value || (Bits_ == (CHAR_BIT * sizeof(TValue))), "Floating point fields must be full width");
+
+    typedef TObject object_type;
+    typedef TValue  value_type;
+
+    /// An unsigned type with the same width as TValue.
+    typedef typename etl::smallest_uint_for_bits<CHAR_BIT * sizeof(TValue)>::type bits_type;
+
+    static ETL_CONSTANT size_t Bits           = Bits_;
+    static ETL_CONSTANT int    Endian         = Endian_;
+    static ETL_CONSTANT bool   Is_Whole_Bytes = ((Bits_ % CHAR_BIT) == 0U);
+
+    //*************************************************************************
+    /// Stores a whole byte field at the destination.
+    //*************************************************************************
+    static void store(char* destination, const TObject& object)
+    {
+      ETL_STATIC_ASSERT(Is_Whole_Bytes, "Field is not a whole number of bytes");
+
+      bits_type value = to_bits(object.*Member);
+
+      if (Bits_ == (CHAR_BIT * sizeof(bits_type)))
+      {
+        if (Endian_ != etl::endian::native)
+        {
+          value = etl::reverse_bytes(value);
+        }
+
+        memcpy(destination, &value, sizeof(bits_type));
+      }
+      else
+      {
+        for (size_t i = 0U; i < Bytes; ++i)
+        {
+          const size_t shift = (Endian_ == etl::endian::big) ? (Bytes - 1U - i) : i;
+
+          destination[i] = static_cast<char>(value >> (CHAR_BIT * shift));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Loads a whole byte field from the source.
+    //*************************************************************************
+    static void load(const char* source, TObject& object)
+    {
+      ETL_STATIC_ASSERT(Is_Whole_Bytes, "Field is not a whole number of bytes");
+
+      bits_type value = 0U;
+
+      if (Bits_ == (CHAR_BIT * sizeof(bits_type)))
+      {
+        memcpy(&value, source, sizeof(bits_type));
+
+        if (Endian_ != etl::endian::native)
+        {
+          value = etl::reverse_bytes(value);
+        }
+      }
+      else
+      {
+        for (size_t i = 0U; i < Bytes; ++i)
+        {
+          const size_t shift = (Endian_ == etl::endian::big) ? (Bytes - 1U - i) : i;
+
+          value |= static_cast<bits_type>(static_cast<bits_type>(static_cast<unsigned char>(source[i])) << (CHAR_BIT * shift));
+        }
+      }
+
+      object.*Member = from_bits(value);
+    }
+
+    //*************************************************************************
+    /// Writes the field to a bit stream.
+    //*************************************************************************
+    static void write(etl::bit_stream_writer& stream, const TObject& object)
+    {
+      bits_type value = to_bits(object.*Member);
+
+      if (Is_Whole_Bytes && (Endian_ == etl::endian::little))
+      {
+        value = reverse_field_bytes(value);
+      }
+
+      stream.write_unchecked(value, static_cast<uint_least8_t>(Bits_));
+    }
+
+    //*************************************************************************
+    /// Reads the field from a bit stream.
+    //*************************************************************************
+    static void read(etl::bit_stream_reader& stream, TObject& object)
+    {
+      bits_type value = stream.read_unchecked<bits_type>(static_cast<uint_least8_t>(Bits_));
+
+      if (Is_Whole_Bytes && (Endian_ == etl::endian::little))
+      {
+        value = reverse_field_bytes(value);
+      }
+
+      object.*Member = from_bits(value);
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Bytes = Bits_ / CHAR_BIT;
+    static ETL_CONSTANT size_t Type_Bits = CHAR_BIT * sizeof(bits_type);
+
+    //*************************************************************************
+    /// Reverses the bytes of a field held in the low bits of the value.
+    //*************************************************************************
+    static bits_type reverse_field_bytes(bits_type value)
+    {
+      return static_cast<bits_type>(etl::reverse_bytes(value) >> (Type_Bits - Bits_));
+    }
+
+    //*************************************************************************
+    template <typename T = TValue>
+    static typename etl::enable_if<!etl::is_floating_point<T>::value, bits_type>::type
+      to_bits(T value)
+    {
+      return static_cast<bits_type>(value);
+    }
+
+    //*************************************************************************
+    template <typename T = TValue>
+    static typename etl::enable_if<etl::is_floating_point<T>::value, bits_type>::type
+      to_bits(T value)
+    {
+      bits_type bits;
+      memcpy(&bits, &value, sizeof(bits_type));
+
+      return bits;
+    }
+
+    //*************************************************************************
+    template <typename T = TValue>
+    static typename etl::enable_if<etl::is_same<T, bool>::value, T>::type
+      from_bits(bits_type bits)
+    {
+      return (bits != 0U);
+    }
+
+    //*************************************************************************
+    template <typename T = TValue>
+    static typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, T>::type
+      from_bits(bits_type bits)
+    {
+      if (etl::is_signed<T>::value && (Bits_ < Type_Bits))
+      {
+        return etl::sign_extend<T, bits_type>(bits, Bits_);
+      }
+
+      return static_cast<T>(bits);
+    }
+
+    //*************************************************************************
+    template <typename T = TValue>
+    static typename etl::enable_if<etl::is_floating_point<T>::value, T>::type
+      from_bits(bits_type bits)
+    {
+      T value;
+      memcpy(&value, &bits, sizeof(T));
+
+      return value;
+    }
+  };
+
+  template <typename TObject, typename TValue, TValue TObject::* Member, size_t Bits_, int Endian_>
+  ETL_CONSTANT size_t serial_field<TObject, TValue, Member, Bits_, Endian_>::Bits;
+
+  template <typename TObject, typename TValue, TValue TObject::* Member, size_t Bits_, int Endian_>
+  ETL_CONSTANT int serial_field<TObject, TValue, Member, Bits_, Endian_>::Endian;
+
+  template <typename TObject, typename TValue, TValue TObject::* Member, size_t Bits_, int Endian_>
+  ETL_CONSTANT bool serial_field<TObject, TValue, Member, Bits_, Endian_>::Is_Whole_Bytes;
+
+  template <typename TObject, typename TValue, TValue TObject::* Member, size_t Bits_, int Endian_>
+  ETL_CONSTANT size_t serial_field<TObject, TValue, Member, Bits_, Endian_>::Bytes;
+
+  template <typename TObject, typename TValue, TValue TObject::* Member, size_t Bits_, int Endian_>
+  ETL_CONSTANT size_t serial_field<TObject, TValue, Member, Bits_, Endian_>::Type_Bits;
+
+#if ETL_USING_CPP17
+  //***************************************************************************
+  /// Describes one field of a serial schema, deduced from the pointer to member.
+  /// e.g. etl::serial_member<&Header::id, 12>
+  ///\ingroup serial_schema
+  //***************************************************************************
+  template <auto Member,
+            size_t Bits   = CHAR_BIT * sizeof(typename private_serial_schema::member_pointer_traits<decltype(Member)>::value_type),
+            int    Endian = etl::endian::big>
+  using serial_member = etl::serial_field<typename private_serial_schema::member_pointer_traits<decltype(Member)>::object_type,
+                                          typename private_serial_schema::member_pointer_traits<decltype(Member)>::value_type,
+                                          Member,
+                                          Bits,
+                                          Endian>;
+#endif
+
+  //***************************************************************************
+  /// Encodes and decodes a struct as a packed sequence of fields.
+  /// The wire size is known at compile time. When every field is a whole
+  /// number of bytes wide, each is stored at a fixed offset with no bounds
+  /// checks; otherwise the fields are packed through a bit stream.
+  ///\tparam TObject The struct type.
+  ///\tparam TFields The etl::serial_field descriptions, in wire order.
+  ///\ingroup serial_schema
+  //***************************************************************************
+  template <typename TObject, typename... TFields>
+  class serial_schema
+  {
+  public:
+
+    typedef TObject object_type;
+
+    static ETL_CONSTANT size_t Bit_Size        = private_serial_schema::total_bits<TFields...>::value;
+    static ETL_CONSTANT size_t Byte_Size       = (Bit_Size + CHAR_BIT - 1U) / CHAR_BIT;
+    static ETL_CONSTANT bool   Is_Byte_Aligned = private_serial_schema::all_whole_bytes<TFields...>::value;
+
+    //*************************************************************************
+    /// Encodes the object to Byte_Size chars at the destination.
+    //*************************************************************************
+    static void encode(const TObject& object, char* destination)
+    {
+      do_encode(object, destination, etl::integral_constant<bool, Is_Byte_Aligned>());
+    }
+
+    //*************************************************************************
+    /// Decodes the object from Byte_Size chars at the source.
+    //*************************************************************************
+    static void decode(const char* source, TObject& object)
+    {
+      do_decode(source, object, etl::integral_constant<bool, Is_Byte_Aligned>());
+    }
+
+    //*************************************************************************
+    /// Writes the object to a byte stream, without checking the space available.
+    //*************************************************************************
+    static void write_unchecked(etl::byte_stream_writer& stream, const TObject& object)
+    {
+      encode(object, stream.free_data().data());
+      stream.skip<char>(Byte_Size);
+    }
+
+    //*************************************************************************
+    /// Writes the object to a byte stream.
+    /// Returns <b>false</b>, having written nothing, if there is not enough space.
+    //*************************************************************************
+    static bool write(etl::byte_stream_writer& stream, const TObject& object)
+    {
+      bool success = (stream.available_bytes() >= Byte_Size);
+
+      if (success)
+      {
+        write_unchecked(stream, object);
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Reads the object from a byte stream, without checking the data available.
+    //*************************************************************************
+    static void read_unchecked(etl::byte_stream_reader& stream, TObject& object)
+    {
+      decode(stream.free_data().data(), object);
+      stream.skip<char>(Byte_Size);
+    }
+
+    //*************************************************************************
+    /// Reads the object from a byte stream.
+    /// Returns <b>false</b>, having read nothing, if there is not enough data.
+    //*************************************************************************
+    static bool read(etl::byte_stream_reader& stream, TObject& object)
+    {
+      bool success = (stream.available_bytes() >= Byte_Size);
+
+      if (success)
+      {
+        read_unchecked(stream, object);
+      }
+
+      return success;
+    }
+
+  private:
+
+    //*************************************************************************
+    static void do_encode(const TObject& object, char* destination, etl::true_type)
+    {
+      private_serial_schema::byte_codec<0U, TFields...>::encode(object, destination);
+    }
+
+    //*************************************************************************
+    static void do_encode(const TObject& object, char* destination, etl::false_type)
+    {
+      etl::bit_stream_writer stream(destination, Byte_Size, etl::endian::big);
+
+      private_serial_schema::bit_codec<TFields...>::encode(object, stream);
+    }
+
+    //*************************************************************************
+    static void do_decode(const char* source, TObject& object, etl::true_type)
+    {
+      private_serial_schema::byte_codec<0U, TFields...>::decode(source, object);
+    }
+
+    //*************************************************************************
+    static void do_decode(const char* source, TObject& object, etl::false_type)
+    {
+      etl::bit_stream_reader stream(etl::span<const char>(source, Byte_Size), etl::endian::big);
+
+      private_serial_schema::bit_codec<TFields...>::decode(stream, object);
+    }
+  };
+
+  template <typename TObject, typename... TFields>
+  ETL_CONSTANT size_t serial_schema<TObject, TFields...>::Bit_Size;
+
+  template <typename TObject, typename... TFields>
+  ETL_CONSTANT size_t serial_schema<TObject, TFields...>::Byte_Size;
+
+  template <typename TObject, typename... TFields>
+  ETL_CONSTANT bool serial_schema<TObject, TFields...>::Is_Byte_Aligned;
+}
+
+#endif
+#endif
@@ -37,6 +37,8 @@ SOFTWARE.
 #include "error_handler.h"
 #include "debug_count.h"
 #include "nullptr.h"
+#include "integral_limits.h"
+#include "static_assert.h"
 #include "type_traits.h"
 #include "parameter_type.h"
 #include "iterator.h"
@@ -49,6 +51,7 @@ SOFTWARE.
 #include "initializer_list.h"
 
 #include "private/comparator_is_transparent.h"
+#include "private/tree_node_link.h"
 
 #include <stddef.h>
 
@@ -192,6 +195,8 @@ namespace etl
     //*************************************************************************
     struct Node
     {
+      typedef etl::private_tree::node_link<Node>::type link_type;
+
       //***********************************************************************
       /// Constructor
       //***********************************************************************
@@ -214,11 +219,32 @@ namespace etl
         children[1] = ETL_NULLPTR;
       }
 
-      Node* children[2];
+      link_type children[2];
       uint_least8_t weight;
       uint_least8_t dir;
     };
 
+    //*************************************************************************
+    /// The state of a search for ascending keys.
+    /// 'ancestors' holds the nodes above the position with greater keys,
+    /// deepest last. 'subtree' is the unsearched part of the tree below them.
+    //*************************************************************************
+    struct sorted_search
+    {
+      explicit sorted_search(const Node* root)
+        : subtree(root)
+        , depth(0U)
+      {
+      }
+
+      // Exceeds the height of any AVL tree that fits in memory.
+      static ETL_CONSTANT size_t Max_Depth = (etl::integral_limits<size_t>::bits * 3U) / 2U;
+
+      const Node* ancestors[Max_Depth];
+      const Node* subtree;
+      size_t      depth;
+    };
+
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
@@ -240,7 +266,8 @@ namespace etl
     //*************************************************************************
     /// Attach the provided node to the position provided
     //*************************************************************************
-    void attach_node(Node*& position, Node& node)
+    template <typename TLink>
+    void attach_node(TLink& position, Node& node)
     {
       // Mark new node as leaf on attach to tree at position provided
       node.mark_as_leaf();
@@ -255,7 +282,8 @@ namespace etl
     //*************************************************************************
     /// Detach the node at the position provided
     //*************************************************************************
-    void detach_node(Node*& position, Node*& replacement)
+    template <typename TPositionLink, typename TReplacementLink>
+    void detach_node(TPositionLink& position, TReplacementLink& replacement)
     {
       // Make temporary copy of actual nodes involved because we might lose
       // their references in the process (e.g. position is the same as
@@ -279,7 +307,8 @@ namespace etl
     //*************************************************************************
     /// Balance the critical node at the position provided as needed
     //*************************************************************************
-    void balance_node(Node*& critical_node)
+    template <typename TLink>
+    void balance_node(TLink& critical_node)
     {
       // Step 1: Update weights for all children of the critical node up to the
       // newly inserted node. This step is costly (in terms of traversing nodes
@@ -376,7 +405,8 @@ namespace etl
     //*************************************************************************
     /// Rotate two nodes at the position provided the to balance the tree
     //*************************************************************************
-    void rotate_2node(Node*& position, uint_least8_t dir)
+    template <typename TLink>
+    void rotate_2node(TLink& position, uint_least8_t dir)
     {
       //     A            C             A          B
       //   B   C   ->   A   E   OR    B   C  ->  D   A
@@ -406,7 +436,8 @@ namespace etl
     //*************************************************************************
     /// Rotate three nodes at the position provided the to balance the tree
     //*************************************************************************
-    void rotate_3node(Node*& position, uint_least8_t dir, uint_least8_t third)
+    template <typename TLink>
+    void rotate_3node(TLink& position, uint_least8_t dir, uint_least8_t third)
     {
       //        --A--             --E--            --A--             --D--
       //      _B_    C    ->     B     A    OR    B    _C_   ->     A     C
@@ -443,2080 +474,2049 @@ namespace etl
       position->weight = uint_least8_t(kNeither);
     }
 
-    size_type current_size;   ///< The number of the used nodes.
-    const size_type CAPACITY; ///< The maximum size of the set.
-    Node* root_node;          ///< The node that acts as the set root.
-    ETL_DECLARE_DEBUG_COUNT;
+    //*************************************************************************
+    /// Compares keys with the keys of nodes through function pointers.
+    /// The tree algorithms instantiated for it are shared by every set that
+    /// uses it, whatever its key type.
+    //*************************************************************************
+    class folded_node_compare
+    {
+    public:
 
-  };
+      /// Returns <0, 0 or >0 as the key goes before, with or after the node's key.
+      typedef int (*compare_function)(const void* p_context, const void* p_key, const Node& node);
 
-  //***************************************************************************
-  /// A templated base for all etl::set types.
-  ///\ingroup set
-  //***************************************************************************
-  template <typename TKey, typename TCompare = etl::less<TKey> >
-  class iset : public etl::set_base
-  {
-  public:
+      /// Returns the address of the node's key.
+      typedef const void* (*key_function)(const Node& node);
 
-    typedef TKey                key_type;
-    typedef TKey                value_type;
-    typedef TCompare            key_compare;
-    typedef TCompare            value_compare;
-    typedef value_type&         reference;
-    typedef const value_type&   const_reference;
-#if ETL_USING_CPP11
-    typedef value_type&&        rvalue_reference;
-#endif
-    typedef value_type*         pointer;
-    typedef const value_type*   const_pointer;
-    typedef size_t              size_type;
+      folded_node_compare(compare_function p_compare_, key_function p_key_, const void* p_context_)
+        : p_compare(p_compare_)
+        , p_key(p_key_)
+        , p_context(p_context_)
+      {
+      }
 
-  protected:
+      int operator()(const void* p_key_value, const Node& node) const
+      {
+        return p_compare(p_context, p_key_value, node);
+      }
 
-    //*************************************************************************
-    /// The data node element in the set.
-    //*************************************************************************
-    struct Data_Node : public Node
-    {
-      explicit Data_Node(value_type value_)
-        : value(value_)
+      const void* key(const Node& node) const
       {
+        return p_key(node);
       }
 
-      value_type value;
+    private:
+
+      compare_function p_compare;
+      key_function     p_key;
+      const void*      p_context;
     };
 
-    /// Defines the key value parameter type
-    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+    //*************************************************************************
+    /// The tree algorithms below depend on the key only through the node
+    /// compare object. It returns <0, 0 or >0 as the key, passed by address,
+    /// goes before, with or after the key of a node, and its 'key' member
+    /// returns the address of a node's key.
+    //*************************************************************************
 
     //*************************************************************************
-    /// How to compare node elements.
+    /// Find the node matching the key provided
     //*************************************************************************
-    bool node_comp(const Data_Node& node1, const Data_Node& node2) const
+    template <typename TNodeCompare>
+    Node* find_node(Node* position, const void* p_key, const TNodeCompare& node_compare) const
     {
-      return compare(node1.value, node2.value);
+      Node* found = position;
+      while (found)
+      {
+        // Compare the key to the current position value
+        const int compared = node_compare(p_key, *found);
+
+        if (compared < 0)
+        {
+          // Keep searching for the node on the left
+          found = found->children[kLeft];
+        }
+        else if (compared > 0)
+        {
+          // Keep searching for the node on the right
+          found = found->children[kRight];
+        }
+        else
+        {
+          // Node that matches the key provided was found, exit loop
+          break;
+        }
+      }
+
+      // Return the node found (might be ETL_NULLPTR)
+      return found;
     }
 
-    bool node_comp(const Data_Node& node, key_parameter_t key) const
+    //*************************************************************************
+    /// Find the reference node matching the node provided
+    //*************************************************************************
+    template <typename TNodeCompare>
+    Node* find_node(Node* position, const Node* node, const TNodeCompare& node_compare) const
     {
-      return compare(node.value, key);
-    }
+      const void* p_key = node_compare.key(*node);
 
-    bool node_comp(key_parameter_t key, const Data_Node& node) const
+      Node* found = position;
+      while (found)
+      {
+        if (found->children[kLeft] == node)
+        {
+          return found->children[kLeft];
+        }
+        else if (found->children[kRight] == node)
+        {
+          return found->children[kRight];
+        }
+        else
+        {
+          // Compare the node value to the current position value
+          const int compared = node_compare(p_key, *found);
 
-    {
-      return compare(key, node.value);
-    }
+          if (compared < 0)
+          {
+            // Keep searching for the node on the left
+            found = found->children[kLeft];
+          }
+          else if (compared > 0)
+          {
+            // Keep searching for the node on the right
+            found = found->children[kRight];
+          }
+          else
+          {
+            // Return position provided (it matches the node)
+            return position;
+          }
+        }
+      }
 
-#if ETL_USING_CPP11
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    bool node_comp(const Data_Node& node, const K& key) const
-    {
-      return compare(node.value, key);
+      // Return root node if nothing was found
+      return root_node;
     }
 
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    bool node_comp(const K& key, const Data_Node& node) const
-
+    //*************************************************************************
+    /// Find the parent node that contains the node provided in its left or
+    /// right tree
+    //*************************************************************************
+    template <typename TNodeCompare>
+    const Node* find_parent_node(const Node* position, const Node* node, const TNodeCompare& node_compare) const
     {
-      return compare(key, node.value);
-    }
-#endif
+      // Default to no parent node found
+      const Node* found = ETL_NULLPTR;
 
-  private:
+      // If the position provided is the same as the node then there is no parent
+      if (position && node && position != node)
+      {
+        const void* p_key = node_compare.key(*node);
 
-    /// The pool of data nodes used in the set.
-    etl::ipool* p_node_pool;
+        while (position)
+        {
+          // Is this position not the parent of the node we are looking for?
+          if (position->children[kLeft] != node &&
+            position->children[kRight] != node)
+          {
+            // Compare the node value to the current position value
+            const int compared = node_compare(p_key, *position);
 
-    key_compare compare;
+            if (compared < 0)
+            {
+              // Keep looking for parent on the left
+              position = position->children[kLeft];
+            }
+            else if (compared > 0)
+            {
+              // Keep looking for parent on the right
+              position = position->children[kRight];
+            }
+          }
+          else
+          {
+            // Return the current position as the parent node found
+            found = position;
 
-    //*************************************************************************
-    /// Downcast a Node* to a Data_Node*
-    //*************************************************************************
-    static Data_Node* data_cast(Node* p_node)
-    {
-      return static_cast<Data_Node*>(p_node);
+            // Parent node found, exit loop
+            break;
+          }
+        }
+      }
+
+      // Return the parent node found (might be ETL_NULLPTR)
+      return found;
     }
 
     //*************************************************************************
-    /// Downcast a Node& to a Data_Node&
+    /// Find the node whose key is not considered to go before the key provided
     //*************************************************************************
-    static Data_Node& data_cast(Node& node)
+    template <typename TNodeCompare>
+    Node* find_lower_node(Node* position, const void* p_key, const TNodeCompare& node_compare) const
     {
-      return static_cast<Data_Node&>(node);
+      // Something at this position? keep going
+      Node* lower_node = ETL_NULLPTR;
+      while (position)
+      {
+        // Compare the key value to the current lower node key value
+        const int compared = node_compare(p_key, *position);
+
+        if (compared < 0)
+        {
+          lower_node = position;
+          if (position->children[kLeft])
+          {
+            position = position->children[kLeft];
+          }
+          else
+          {
+            // Found lowest node
+            break;
+          }
+        }
+        else if (compared > 0)
+        {
+          position = position->children[kRight];
+        }
+        else
+        {
+          // Make note of current position, but keep looking to left for more
+          lower_node = position;
+          position = position->children[kLeft];
+        }
+      }
+
+      // Return the lower_node position found
+      return lower_node;
     }
 
     //*************************************************************************
-    /// Downcast a const Node* to a const Data_Node*
+    /// Find the node whose key is considered to go after the key provided
     //*************************************************************************
-    static const Data_Node* data_cast(const Node* p_node)
+    template <typename TNodeCompare>
+    Node* find_upper_node(Node* position, const void* p_key, const TNodeCompare& node_compare) const
     {
-      return static_cast<const Data_Node*>(p_node);
+      // Keep track of parent of last upper node
+      Node* upper_node = ETL_NULLPTR;
+      // Start with position provided
+      Node* node = position;
+      while (node)
+      {
+        // Compare the key value to the current upper node key value
+        const int compared = node_compare(p_key, *node);
+
+        if (compared < 0)
+        {
+          upper_node = node;
+          node = node->children[kLeft];
+        }
+        else if (compared > 0)
+        {
+          node = node->children[kRight];
+        }
+        else if (node->children[kRight])
+        {
+          upper_node = find_limit_node(node->children[kRight], kLeft);
+          break;
+        }
+        else
+        {
+          break;
+        }
+      }
+
+      // Return the upper node position found (might be ETL_NULLPTR)
+      return upper_node;
     }
 
     //*************************************************************************
-    /// Downcast a const Node& to a const Data_Node&
+    /// Insert a node.
+    /// Returns the node inserted, or the node with the same key if there was
+    /// one, in which case the node provided is not linked into the tree.
     //*************************************************************************
-    static const Data_Node& data_cast(const Node& node)
+    template <typename TNodeCompare>
+    Node* insert_node(Node*& position, Node& node, const TNodeCompare& node_compare)
     {
-      return static_cast<const Data_Node&>(node);
-    }
+      // Find the location where the node belongs
+      Node* found = position;
 
-  public:
-    //*************************************************************************
-    /// iterator.
-    //*************************************************************************
-    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
-    {
-    public:
+      // Was position provided not empty? then find where the node belongs
+      if (position)
+      {
+        const void* p_key = node_compare.key(node);
 
-      friend class iset;
-      friend class const_iterator;
+        // Find the critical parent node (default to ETL_NULLPTR)
+        Node* critical_parent_node = ETL_NULLPTR;
+        Node* critical_node = root_node;
 
-      iterator()
-        : p_set(ETL_NULLPTR)
-        , p_node(ETL_NULLPTR)
-      {
-      }
+        while (found)
+        {
+          // Search for critical weight node (all nodes whose weight factor
+          // is set to kNeither (balanced)
+          if (kNeither != found->weight)
+          {
+            critical_node = found;
+          }
 
-      iterator(iset& set)
-        : p_set(&set)
-        , p_node(ETL_NULLPTR)
-      {
-      }
+          const int compared = node_compare(p_key, *found);
 
-      iterator(iset& set, Node* node)
-        : p_set(&set)
-        , p_node(node)
-      {
-      }
+          // Is the node provided to the left of the current position?
+          if (compared < 0)
+          {
+            // Update direction taken to insert new node in parent node
+            found->dir = kLeft;
+          }
+          // Is the node provided to the right of the current position?
+          else if (compared > 0)
+          {
+            // Update direction taken to insert new node in parent node
+            found->dir = kRight;
+          }
+          else
+          {
+            // Update direction taken to insert new node in parent node
+            found->dir = kNeither;
 
-      iterator(const iterator& other)
-        : p_set(other.p_set)
-        , p_node(other.p_node)
-      {
-      }
+            // Clear critical node value to skip weight step below
+            critical_node = ETL_NULLPTR;
 
-      ~iterator()
-      {
-      }
+            // Exit loop, duplicate node found
+            break;
+          }
 
-      iterator& operator ++()
-      {
-        p_set->next_node(p_node);
-        return *this;
-      }
+          // Is there a child of this parent node?
+          if (found->children[found->dir])
+          {
+            // Will this node be the parent of the next critical node whose
+            // weight factor is set to kNeither (balanced)?
+            if (kNeither != found->children[found->dir]->weight)
+            {
+              critical_parent_node = found;
+            }
 
-      iterator operator ++(int)
-      {
-        iterator temp(*this);
-        p_set->next_node(p_node);
-        return temp;
-      }
+            // Keep looking for empty spot to insert new node
+            found = found->children[found->dir];
+          }
+          else
+          {
+            // Attach node to right
+            attach_node(found->children[found->dir], node);
 
-      iterator& operator --()
-      {
-        p_set->prev_node(p_node);
-        return *this;
-      }
+            // Return newly added node
+            found = found->children[found->dir];
 
-      iterator operator --(int)
-      {
-        iterator temp(*this);
-        p_set->prev_node(p_node);
-        return temp;
-      }
+            // Exit loop
+            break;
+          }
+        }
 
-      iterator& operator =(const iterator& other)
-      {
-        p_set = other.p_set;
-        p_node = other.p_node;
-        return *this;
+        // Was a critical node found that should be checked for balance?
+        if (critical_node)
+        {
+          if (critical_parent_node == ETL_NULLPTR && critical_node == root_node)
+          {
+            balance_node(root_node);
+          }
+          else if (critical_parent_node == ETL_NULLPTR && critical_node == position)
+          {
+            balance_node(position);
+          }
+          else
+          {
+            if (critical_parent_node != ETL_NULLPTR)
+            {
+              balance_node(critical_parent_node->children[critical_parent_node->dir]);
+            }
+          }
+        }
       }
-
-      reference operator *() const
+      else
       {
-        return iset::data_cast(p_node)->value;
-      }
+        // Attach node to current position
+        attach_node(position, node);
 
-      pointer operator &() const
-      {
-        return &(iset::data_cast(p_node)->value);
+        // Return newly added node at current position
+        found = position;
       }
 
-      pointer operator ->() const
-      {
-        return &(iset::data_cast(p_node)->value);
-      }
+      // Return the node found (might be ETL_NULLPTR)
+      return found;
+    }
 
-      friend bool operator == (const iterator& lhs, const iterator& rhs)
+    //*************************************************************************
+    /// Find the next node in sequence from the node provided
+    //*************************************************************************
+    template <typename TNodeCompare>
+    void next_node(const Node*& position, const TNodeCompare& node_compare) const
+    {
+      if (position)
       {
-        return lhs.p_set == rhs.p_set && lhs.p_node == rhs.p_node;
-      }
+        // Is there a tree on the right? then find the minimum of that tree
+        if (position->children[kRight])
+        {
+          // Return minimum node found
+          position = find_limit_node(position->children[kRight], kLeft);
+        }
+        // Otherwise find the parent of this node
+        else
+        {
+          // Start with current position as parent
+          const Node* parent = position;
+          do {
+            // Update current position as previous parent
+            position = parent;
+            // Find parent of current position
+            parent = find_parent_node(root_node, position, node_compare);
+            // Repeat while previous position was on right side of parent tree
+          } while (parent && parent->children[kRight] == position);
 
-      friend bool operator != (const iterator& lhs, const iterator& rhs)
-      {
-        return !(lhs == rhs);
+          // Set parent node as the next position
+          position = parent;
+        }
       }
-
-    private:
-
-      // Pointer to set associated with this iterator
-      iset* p_set;
-
-      // Pointer to the current node for this iterator
-      Node* p_node;
-    };
-    friend class iterator;
+    }
 
     //*************************************************************************
-    /// const_iterator
+    /// Find the previous node in sequence from the node provided
     //*************************************************************************
-    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    template <typename TNodeCompare>
+    void prev_node(const Node*& position, const TNodeCompare& node_compare) const
     {
-    public:
-
-      friend class iset;
-
-      const_iterator()
-        : p_set(ETL_NULLPTR)
-        , p_node(ETL_NULLPTR)
+      // If starting at the terminal end, the previous node is the maximum node
+      // from the root
+      if (!position)
       {
+        position = find_limit_node(root_node, kRight);
       }
-
-      const_iterator(const iset& set)
-        : p_set(&set)
-        , p_node(ETL_NULLPTR)
+      else
       {
-      }
+        // Is there a tree on the left? then find the maximum of that tree
+        if (position->children[kLeft])
+        {
+          // Return maximum node found
+          position = find_limit_node(position->children[kLeft], kRight);
+        }
+        // Otherwise find the parent of this node
+        else
+        {
+          // Start with current position as parent
+          const Node* parent = position;
+          do {
+            // Update current position as previous parent
+            position = parent;
+            // Find parent of current position
+            parent = find_parent_node(root_node, position, node_compare);
+            // Repeat while previous position was on left side of parent tree
+          } while (parent && parent->children[kLeft] == position);
 
-      const_iterator(const iset& set, const Node* node)
-        : p_set(&set)
-        , p_node(node)
-      {
+          // Set parent node as the next position
+          position = parent;
+        }
       }
+    }
 
-      const_iterator(const typename iset::iterator& other)
-        : p_set(other.p_set)
-        , p_node(other.p_node)
+    //*************************************************************************
+    /// Unlink the node matching the key from somewhere starting at the
+    /// position provided. Returns the unlinked node (might be ETL_NULLPTR).
+    //*************************************************************************
+    template <typename TNodeCompare>
+    Node* remove_node(Node*& position, const void* p_key, const TNodeCompare& node_compare)
+    {
+      // Step 1: Find the target node that matches the key provided, the
+      // replacement node (might be the same as target node), and the critical
+      // node to start rebalancing the tree from (up to the replacement node)
+      Node* found_parent = ETL_NULLPTR;
+      Node* found = ETL_NULLPTR;
+      Node* replace_parent = ETL_NULLPTR;
+      Node* replace = position;
+      Node* balance_parent = ETL_NULLPTR;
+      Node* balance = root_node;
+      while (replace)
       {
-      }
+        // Compare the key provided to the replace node key
+        const int compared = node_compare(p_key, *replace);
 
-      const_iterator(const const_iterator& other)
-        : p_set(other.p_set)
-        , p_node(other.p_node)
-      {
-      }
-
-      ~const_iterator()
-      {
-      }
-
-      const_iterator& operator ++()
-      {
-        p_set->next_node(p_node);
-        return *this;
-      }
+        if (compared < 0)
+        {
+          // Update the direction to the target/replace node
+          replace->dir = kLeft;
+        }
+        else if (compared > 0)
+        {
+          // Update the direction to the target/replace node
+          replace->dir = kRight;
+        }
+        else
+        {
+          // Update the direction to the replace node (target node found here)
+          replace->dir = replace->children[kLeft] ? kLeft : kRight;
 
-      const_iterator operator ++(int)
-      {
-        const_iterator temp(*this);
-        p_set->next_node(p_node);
-        return temp;
-      }
+          // Note the target node was found (and its parent)
+          found_parent = replace_parent;
+          found = replace;
+        }
+        // Replacement node found if its missing a child in the replace->dir
+        // value set above
+        if (replace->children[replace->dir] == ETL_NULLPTR)
+        {
+          // Exit loop once replace node is found (target might not have been)
+          break;
+        }
 
-      const_iterator& operator --()
-      {
-        p_set->prev_node(p_node);
-        return *this;
-      }
+        // If replacement node weight is kNeither or we are taking the shorter
+        // path of replacement node and our sibling (on longer path) is
+        // balanced then we need to update the balance node to match this
+        // replacement node but all our ancestors will not require rebalancing
+        if ((replace->weight == kNeither) ||
+          (replace->weight == (1 - replace->dir) &&
+            replace->children[1 - replace->dir]->weight == kNeither))
+        {
+          // Update balance node (and its parent) to replacement node
+          balance_parent = replace_parent;
+          balance = replace;
+        }
 
-      const_iterator operator --(int)
-      {
-        const_iterator temp(*this);
-        p_set->prev_node(p_node);
-        return temp;
+        // Keep searching for the replacement node
+        replace_parent = replace;
+        replace = replace->children[replace->dir];
       }
 
-      const_iterator& operator =(const const_iterator& other)
+      // If target node was found, proceed with rebalancing and replacement
+      if (found)
       {
-        p_set = other.p_set;
-        p_node = other.p_node;
-        return *this;
-      }
+        // Step 2: Update weights from critical node to replacement parent node
+        while (balance)
+        {
+          if (balance->children[balance->dir] == ETL_NULLPTR)
+          {
+            break;
+          }
 
-      const_reference operator *() const
-      {
-        return iset::data_cast(p_node)->value;
-      }
+          if (balance->weight == kNeither)
+          {
+            balance->weight = 1 - balance->dir;
+          }
+          else if (balance->weight == balance->dir)
+          {
+            balance->weight = kNeither;
+          }
+          else
+          {
+            int weight = balance->children[1 - balance->dir]->weight;
+            // Perform a 3 node rotation if weight is same as balance->dir
+            if (weight == balance->dir)
+            {
+              // Is the root node being rebalanced (no parent)
+              if (balance_parent == ETL_NULLPTR)
+              {
+                rotate_3node(root_node, 1 - balance->dir,
+                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
+              }
+              else
+              {
+                rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
+                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
+              }
+            }
+            // Already balanced, rebalance and make it heavy in opposite
+            // direction of the node being removed
+            else if (weight == kNeither)
+            {
+              // Is the root node being rebalanced (no parent)
+              if (balance_parent == ETL_NULLPTR)
+              {
+                rotate_2node(root_node, 1 - balance->dir);
+                root_node->weight = balance->dir;
+              }
+              else
+              {
+                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
+                balance_parent->children[balance_parent->dir]->weight = balance->dir;
+              }
+              // Update balance node weight in opposite direction of node removed
+              balance->weight = 1 - balance->dir;
+            }
+            // Rebalance and leave it balanced
+            else
+            {
+              // Is the root node being rebalanced (no parent)
+              if (balance_parent == ETL_NULLPTR)
+              {
+                rotate_2node(root_node, 1 - balance->dir);
+              }
+              else
+              {
+                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
+              }
+            }
 
-      const_pointer operator &() const
-      {
-        return iset::data_cast(p_node)->value;
-      }
+            // Is balance node the same as the target node found? then update
+            // its parent after the rotation performed above
+            if (balance == found)
+            {
+              if (balance_parent)
+              {
+                found_parent = balance_parent->children[balance_parent->dir];
+                // Update dir since it is likely stale
+                found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
+              }
+              else
+              {
+                found_parent = root_node;
+                root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
+              }
+            }
+          }
 
-      const_pointer operator ->() const
-      {
-        return &(iset::data_cast(p_node)->value);
-      }
+          // Next balance node to consider
+          balance_parent = balance;
+          balance = balance->children[balance->dir];
+        } // while(balance)
 
-      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
-      {
-        return lhs.p_set == rhs.p_set && lhs.p_node == rhs.p_node;
-      }
+          // Step 3: Swap found node with replacement node
+        if (found_parent)
+        {
+          // Handle traditional case
+          detach_node(found_parent->children[found_parent->dir],
+            replace_parent->children[replace_parent->dir]);
+        }
+        // Handle root node removal
+        else
+        {
+          // Valid replacement node for root node being removed?
+          if (replace_parent)
+          {
+            detach_node(root_node, replace_parent->children[replace_parent->dir]);
+          }
+          else
+          {
+            // Target node and replacement node are both root node
+            detach_node(root_node, root_node);
+          }
+        }
 
-      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
-      {
-        return !(lhs == rhs);
-      }
+        // One less.
+        --current_size;
+      } // if(found)
 
-    private:
+        // Return node found (might be ETL_NULLPTR)
+      return found;
+    }
 
-      // Convert to an iterator.
-      iset::iterator to_iterator() const
-      {
-        return iset::iterator(const_cast<iset&>(*p_set), const_cast<Node*>(p_node));
-      }
+    size_type current_size;   ///< The number of the used nodes.
+    const size_type CAPACITY; ///< The maximum size of the set.
+    Node* root_node;          ///< The node that acts as the set root.
+    ETL_DECLARE_DEBUG_COUNT;
 
-      // Pointer to set associated with this iterator
-      const iset* p_set;
+  };
 
-      // Pointer to the current node for this iterator
-      const Node* p_node;
-    };
-    friend class const_iterator;
+  //***************************************************************************
+  /// A templated base for all etl::set types.
+  ///\ingroup set
+  //***************************************************************************
+  template <typename TKey, typename TCompare = etl::less<TKey> >
+  class iset : public etl::set_base
+  {
+  public:
 
-    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+    typedef TKey                key_type;
+    typedef TKey                value_type;
+    typedef TCompare            key_compare;
+    typedef TCompare            value_compare;
+    typedef value_type&         reference;
+    typedef const value_type&   const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&        rvalue_reference;
+#endif
+    typedef value_type*         pointer;
+    typedef const value_type*   const_pointer;
+    typedef size_t              size_type;
 
-    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
-    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+  protected:
 
     //*************************************************************************
-    /// Assignment operator.
+    /// The data node element in the set.
     //*************************************************************************
-    iset& operator = (const iset& rhs)
+    struct Data_Node : public Node
     {
-      // Skip if doing self assignment
-      if (this != &rhs)
+      explicit Data_Node(value_type value_)
+        : value(value_)
       {
-        assign(rhs.cbegin(), rhs.cend());
       }
 
-      return *this;
-    }
-
-#if ETL_USING_CPP11
-    //*************************************************************************
-    /// Move assignment operator.
-    //*************************************************************************
-    iset& operator = (iset&& rhs)
-    {
-      // Skip if doing self assignment
-      if (this != &rhs)
-      {
-        this->clear();
-
-        typename etl::iset<TKey, TCompare>::iterator from = rhs.begin();
-
-        while (from != rhs.end())
-        {
-          typename etl::iset<TKey, TCompare>::iterator temp = from;
-          ++temp;
-
-          this->insert(etl::move(*from));
-          from = temp;
-        }
-      }
+      value_type value;
+    };
 
-      return *this;
-    }
-#endif
+    /// Defines the key value parameter type
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
 
     //*************************************************************************
-    /// Gets the beginning of the set.
+    /// How to compare node elements.
     //*************************************************************************
-    iterator begin()
+    bool node_comp(const Data_Node& node1, const Data_Node& node2) const
     {
-      return iterator(*this, find_limit_node(root_node, kLeft));
+      return compare(node1.value, node2.value);
     }
 
-    //*************************************************************************
-    /// Gets the beginning of the set.
-    //*************************************************************************
-    const_iterator begin() const
+    bool node_comp(const Data_Node& node, key_parameter_t key) const
     {
-      return const_iterator(*this, find_limit_node(root_node, kLeft));
+      return compare(node.value, key);
     }
 
-    //*************************************************************************
-    /// Gets the end of the set.
-    //*************************************************************************
-    iterator end()
-    {
-      return iterator(*this);
-    }
+    bool node_comp(key_parameter_t key, const Data_Node& node) const
 
-    //*************************************************************************
-    /// Gets the end of the set.
-    //*************************************************************************
-    const_iterator end() const
     {
-      return const_iterator(*this);
+      return compare(key, node.value);
     }
 
-    //*************************************************************************
-    /// Gets the beginning of the set.
-    //*************************************************************************
-    const_iterator cbegin() const
+#if ETL_USING_CPP11
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool node_comp(const Data_Node& node, const K& key) const
     {
-      return const_iterator(*this, find_limit_node(root_node, kLeft));
+      return compare(node.value, key);
     }
 
-    //*************************************************************************
-    /// Gets the end of the set.
-    //*************************************************************************
-    const_iterator cend() const
-    {
-      return const_iterator(*this);
-    }
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool node_comp(const K& key, const Data_Node& node) const
 
-    //*************************************************************************
-    /// Gets the reverse beginning of the list.
-    //*************************************************************************
-    reverse_iterator rbegin()
     {
-      return reverse_iterator(iterator(*this));
+      return compare(key, node.value);
     }
+#endif
+
+  private:
+
+    /// The pool of data nodes used in the set.
+    etl::ipool* p_node_pool;
+
+    key_compare compare;
 
     //*************************************************************************
-    /// Gets the reverse beginning of the list.
+    /// Downcast a Node* to a Data_Node*
     //*************************************************************************
-    const_reverse_iterator rbegin() const
+    static Data_Node* data_cast(Node* p_node)
     {
-      return const_reverse_iterator(const_iterator(*this));
+      return static_cast<Data_Node*>(p_node);
     }
 
     //*************************************************************************
-    /// Gets the reverse end of the list.
+    /// Downcast a Node& to a Data_Node&
     //*************************************************************************
-    reverse_iterator rend()
+    static Data_Node& data_cast(Node& node)
     {
-      return reverse_iterator(iterator(*this, find_limit_node(root_node, kLeft)));
+      return static_cast<Data_Node&>(node);
     }
 
     //*************************************************************************
-    /// Gets the reverse end of the list.
+    /// Downcast a const Node* to a const Data_Node*
     //*************************************************************************
-    const_reverse_iterator rend() const
+    static const Data_Node* data_cast(const Node* p_node)
     {
-      return const_reverse_iterator(iterator(*this, find_limit_node(root_node, kLeft)));
+      return static_cast<const Data_Node*>(p_node);
     }
 
     //*************************************************************************
-    /// Gets the reverse beginning of the list.
+    /// Downcast a const Node& to a const Data_Node&
     //*************************************************************************
-    const_reverse_iterator crbegin() const
+    static const Data_Node& data_cast(const Node& node)
     {
-      return const_reverse_iterator(const_iterator(*this));
+      return static_cast<const Data_Node&>(node);
     }
 
+  public:
     //*************************************************************************
-    /// Gets the reverse end of the list.
+    /// iterator.
     //*************************************************************************
-    const_reverse_iterator crend() const
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
     {
-      return const_reverse_iterator(const_iterator(*this, find_limit_node(root_node, kLeft)));
-    }
+    public:
 
-    //*********************************************************************
-    /// Assigns values to the set.
-    /// If asserts or exceptions are enabled, emits set_full if the set does not have enough free space.
-    /// If asserts or exceptions are enabled, emits set_iterator if the iterators are reversed.
-    ///\param first The iterator to the first element.
-    ///\param last  The iterator to the last element + 1.
-    //*********************************************************************
-    template <typename TIterator>
-    void assign(TIterator first, TIterator last)
-    {
-      initialise();
-      insert(first, last);
-    }
+      friend class iset;
+      friend class const_iterator;
 
-    //*************************************************************************
-    /// Clears the set.
-    //*************************************************************************
-    void clear()
-    {
-      initialise();
-    }
+      iterator()
+        : p_set(ETL_NULLPTR)
+        , p_node(ETL_NULLPTR)
+      {
+      }
 
-    //*********************************************************************
-    /// Counts the number of elements that contain the key specified.
-    ///\param key The key to search for.
-    ///\return 1 if element was found, 0 otherwise.
-    //*********************************************************************
-    size_type count(key_parameter_t key) const
-    {
-      return find_node(root_node, key) ? 1 : 0;
-    }
+      iterator(iset& set)
+        : p_set(&set)
+        , p_node(ETL_NULLPTR)
+      {
+      }
+
+      iterator(iset& set, Node* node)
+        : p_set(&set)
+        , p_node(node)
+      {
+      }
+
+      iterator(const iterator& other)
+        : p_set(other.p_set)
+        , p_node(other.p_node)
+      {
+      }
+
+      ~iterator()
+      {
+      }
+
+      iterator& operator ++()
+      {
+        p_set->next_node(p_node);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        p_set->next_node(p_node);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        p_set->prev_node(p_node);
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        p_set->prev_node(p_node);
+        return temp;
+      }
+
+      iterator& operator =(const iterator& other)
+      {
+        p_set = other.p_set;
+        p_node = other.p_node;
+        return *this;
+      }
+
+      reference operator *() const
+      {
+        return iset::data_cast(p_node)->value;
+      }
+
+      pointer operator &() const
+      {
+        return &(iset::data_cast(p_node)->value);
+      }
+
+      pointer operator ->() const
+      {
+        return &(iset::data_cast(p_node)->value);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_set == rhs.p_set && lhs.p_node == rhs.p_node;
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
 
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    size_type count(const K& key) const
-    {
-      return find_node(root_node, key) ? 1 : 0;
-    }
-#endif
+      // Pointer to set associated with this iterator
+      iset* p_set;
+
+      // Pointer to the current node for this iterator
+      Node* p_node;
+    };
+    friend class iterator;
 
     //*************************************************************************
-    /// Returns two iterators with bounding (lower bound, upper bound) the
-    /// value provided
+    /// const_iterator
     //*************************************************************************
-    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
     {
-      return ETL_OR_STD::make_pair<iterator, iterator>(iterator(*this, find_lower_node(root_node, key)),
-                                                       iterator(*this, find_upper_node(root_node, key)));
-    }
+    public:
 
-#if ETL_USING_CPP11
-    //*************************************************************************
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
-    {
-      return ETL_OR_STD::make_pair<iterator, iterator>(iterator(*this, find_lower_node(root_node, key)),
-                                                       iterator(*this, find_upper_node(root_node, key)));
-    }
-#endif
+      friend class iset;
 
-    //*************************************************************************
-    /// Returns two const iterators with bounding (lower bound, upper bound)
-    /// the value provided.
-    //*************************************************************************
-    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
-    {
-      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(const_iterator(*this, find_lower_node(root_node, key)),
-                                                                   const_iterator(*this, find_upper_node(root_node, key)));
-    }
+      const_iterator()
+        : p_set(ETL_NULLPTR)
+        , p_node(ETL_NULLPTR)
+      {
+      }
 
-#if ETL_USING_CPP11
-    //*************************************************************************
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
-    {
-      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(const_iterator(*this, find_lower_node(root_node, key)),
-                                                                   const_iterator(*this, find_upper_node(root_node, key)));
-    }
-#endif
+      const_iterator(const iset& set)
+        : p_set(&set)
+        , p_node(ETL_NULLPTR)
+      {
+      }
 
-    //*************************************************************************
-    /// Erases the value at the specified position.
-    //*************************************************************************
-    iterator erase(iterator position)
-    {
-      // Remove the node by its node specified in iterator position
-      return erase(const_iterator(position));
-    }
+      const_iterator(const iset& set, const Node* node)
+        : p_set(&set)
+        , p_node(node)
+      {
+      }
 
-    //*************************************************************************
-    /// Erases the value at the specified position.
-    //*************************************************************************
-    iterator erase(const_iterator position)
-    {
-      // Find the parent node to be removed
-      Node*& reference_node = find_node(root_node, position.p_node);
-      iterator next(*this, reference_node);
-      ++next;
+      const_iterator(const typename iset::iterator& other)
+        : p_set(other.p_set)
+        , p_node(other.p_node)
+      {
+      }
 
-      remove_node(root_node, (*position));
+      const_iterator(const const_iterator& other)
+        : p_set(other.p_set)
+        , p_node(other.p_node)
+      {
+      }
 
-      return next;
-    }
+      ~const_iterator()
+      {
+      }
 
-    //*************************************************************************
-    // Erase the key specified.
-    //*************************************************************************
-    size_type erase(key_parameter_t key_value)
-    {
-      // Return 1 if key value was found and removed
-      return remove_node(root_node, key_value) ? 1 : 0;
-    }
+      const_iterator& operator ++()
+      {
+        p_set->next_node(p_node);
+        return *this;
+      }
 
-    //*************************************************************************
-#if ETL_USING_CPP11
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    size_type erase(K&& key_value)
-    {
-      // Return 1 if key value was found and removed
-      return remove_node(root_node, etl::forward<K>(key_value)) ? 1 : 0;
-    }
-#endif
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        p_set->next_node(p_node);
+        return temp;
+      }
 
-    //*************************************************************************
-    /// Erases a range of elements.
-    //*************************************************************************
-    iterator erase(const_iterator first, const_iterator last)
-    {
-      while (first != last)
+      const_iterator& operator --()
       {
-        first = erase(first);
+        p_set->prev_node(p_node);
+        return *this;
       }
 
-      return last.to_iterator();
-    }
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        p_set->prev_node(p_node);
+        return temp;
+      }
 
-    //*********************************************************************
-    /// Finds an element.
-    ///\param key The key to search for.
-    ///\return An iterator pointing to the element or end() if not found.
-    //*********************************************************************
-    iterator find(key_parameter_t key_value)
-    {
-      return iterator(*this, find_node(root_node, key_value));
-    }
+      const_iterator& operator =(const const_iterator& other)
+      {
+        p_set = other.p_set;
+        p_node = other.p_node;
+        return *this;
+      }
 
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    iterator find(const K& k)
-    {
-      return iterator(*this, find_node(root_node, k));
-    }
-#endif
+      const_reference operator *() const
+      {
+        return iset::data_cast(p_node)->value;
+      }
 
-    //*********************************************************************
-    /// Finds an element.
-    ///\param key The key to search for.
-    ///\return An iterator pointing to the element or end() if not found.
-    //*********************************************************************
-    const_iterator find(key_parameter_t key_value) const
-    {
-      return const_iterator(*this, find_node(root_node, key_value));
-    }
+      const_pointer operator &() const
+      {
+        return iset::data_cast(p_node)->value;
+      }
 
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    const_iterator find(const K& key_value) const
-    {
-      return const_iterator(*this, find_node(root_node, key_value));
-    }
-#endif
+      const_pointer operator ->() const
+      {
+        return &(iset::data_cast(p_node)->value);
+      }
 
-    //*********************************************************************
-    /// Inserts a value to the set.
-    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
-    ///\param value    The value to insert.
-    //*********************************************************************
-    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
-    {
-      // Default to no inserted node
-      Node* inserted_node = ETL_NULLPTR;
-      bool inserted = false;
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_set == rhs.p_set && lhs.p_node == rhs.p_node;
+      }
 
-      if (full())
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
       {
-        iterator iter = find(value);
-        if (iter == end())
-        {
-          ETL_ASSERT_FAIL(ETL_ERROR(set_full));
-        }
-        else
-        {
-          return ETL_OR_STD::make_pair(iter, false);
-        }
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      // Convert to an iterator.
+      iset::iterator to_iterator() const
+      {
+        return iset::iterator(const_cast<iset&>(*p_set), const_cast<Node*>(p_node));
+      }
+
+      // Pointer to set associated with this iterator
+      const iset* p_set;
+
+      // Pointer to the current node for this iterator
+      const Node* p_node;
+    };
+    friend class const_iterator;
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iset& operator = (const iset& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
       }
-      
-      // Get next available free node
-      Data_Node& node = allocate_data_node(value);
-
-      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
-      inserted_node = insert_node(root_node, node);
-      inserted = inserted_node == &node;
 
-      // Insert node into tree and return iterator to new node location in tree
-      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted);
+      return *this;
     }
 
 #if ETL_USING_CPP11
-    //*********************************************************************
-    /// Inserts a value to the set.
-    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
-    ///\param value    The value to insert.
-    //*********************************************************************
-    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iset& operator = (iset&& rhs)
     {
-      // Default to no inserted node
-      Node* inserted_node = ETL_NULLPTR;
-      bool inserted = false;
-      
-      if (full())
+      // Skip if doing self assignment
+      if (this != &rhs)
       {
-        iterator iter = find(value);
-        if (iter == end())
-        {
-          ETL_ASSERT_FAIL(ETL_ERROR(set_full));
-        }
-        else
+        this->clear();
+
+        typename etl::iset<TKey, TCompare>::iterator from = rhs.begin();
+
+        while (from != rhs.end())
         {
-          return ETL_OR_STD::make_pair(iter, false);
+          typename etl::iset<TKey, TCompare>::iterator temp = from;
+          ++temp;
+
+          this->insert(etl::move(*from));
+          from = temp;
         }
       }
 
-      // Get next available free node
-      Data_Node& node = allocate_data_node(etl::move(value));
-
-      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
-      inserted_node = insert_node(root_node, node);
-      inserted = inserted_node == &node;
-
-      // Insert node into tree and return iterator to new node location in tree
-      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted);
+      return *this;
     }
 #endif
 
-    //*********************************************************************
-    /// Inserts a value to the set starting at the position recommended.
-    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
-    ///\param position The position that would precede the value to insert.
-    ///\param value    The value to insert.
-    //*********************************************************************
-    iterator insert(const_iterator, const_reference value)
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    iterator begin()
     {
-      // Default to no inserted node
-      Node* inserted_node = ETL_NULLPTR;
-
-      if (full())
-      {
-        iterator iter = find(value);
-        if (iter == end())
-        {
-          ETL_ASSERT_FAIL(ETL_ERROR(set_full));
-        }
-        else
-        {
-          return iter;
-        }
-      }
-
-      // Get next available free node
-      Data_Node& node = allocate_data_node(value);
-
-      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
-      inserted_node = insert_node(root_node, node);
+      return iterator(*this, find_limit_node(root_node, kLeft));
+    }
 
-      // Insert node into tree and return iterator to new node location in tree
-      return iterator(*this, inserted_node);
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, find_limit_node(root_node, kLeft));
     }
 
-#if ETL_USING_CPP11
-    //*********************************************************************
-    /// Inserts a value to the set starting at the position recommended.
-    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
-    ///\param position The position that would precede the value to insert.
-    ///\param value    The value to insert.
-    //*********************************************************************
-    iterator insert(const_iterator, rvalue_reference value)
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    iterator end()
     {
-      // Default to no inserted node
-      Node* inserted_node = ETL_NULLPTR;
+      return iterator(*this);
+    }
 
-      if (full())
-      {
-        iterator iter = find(value);
-        if (iter == end())
-        {
-          ETL_ASSERT_FAIL(ETL_ERROR(set_full));
-        }
-        else
-        {
-          return iter;
-        }
-      }
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this);
+    }
 
-      // Get next available free node
-      Data_Node& node = allocate_data_node(etl::move(value));
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, find_limit_node(root_node, kLeft));
+    }
 
-      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
-      inserted_node = insert_node(root_node, node);
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this);
+    }
 
-      // Insert node into tree and return iterator to new node location in tree
-      return iterator(*this, inserted_node);
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(iterator(*this));
     }
-#endif
 
-    //*********************************************************************
-    /// Inserts a range of values to the set.
-    /// If asserts or exceptions are enabled, emits set_full if the set does not have enough free space.
-    ///\param position The position to insert at.
-    ///\param first    The first element to add.
-    ///\param last     The last + 1 element to add.
-    //*********************************************************************
-    template <class TIterator>
-    void insert(TIterator first, TIterator last)
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      return const_reverse_iterator(const_iterator(*this));
     }
 
-    //*********************************************************************
-    /// Returns an iterator pointing to the first element in the container
-    /// whose key is not considered to go before the key provided or end()
-    /// if all keys are considered to go before the key provided.
-    ///\return An iterator pointing to the element not before key or end()
-    //*********************************************************************
-    iterator lower_bound(key_parameter_t key)
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    reverse_iterator rend()
     {
-      return iterator(*this, find_lower_node(root_node, key));
+      return reverse_iterator(iterator(*this, find_limit_node(root_node, kLeft)));
     }
 
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    iterator lower_bound(const K& key)
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
     {
-      return iterator(*this, find_lower_node(root_node, key));
+      return const_reverse_iterator(iterator(*this, find_limit_node(root_node, kLeft)));
     }
-#endif
 
-    //*********************************************************************
-    /// Returns a const_iterator pointing to the first element in the
-    /// container whose key is not considered to go before the key provided
-    /// or end() if all keys are considered to go before the key provided.
-    ///\return An const_iterator pointing to the element not before key or end()
-    //*********************************************************************
-    const_iterator lower_bound(key_parameter_t key) const
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
     {
-      return const_iterator(*this, find_lower_node(root_node, key));
+      return const_reverse_iterator(const_iterator(*this));
     }
 
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    const_iterator lower_bound(const K& key) const
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
     {
-      return const_iterator(*this, find_lower_node(root_node, key));
+      return const_reverse_iterator(const_iterator(*this, find_limit_node(root_node, kLeft)));
     }
-#endif
 
     //*********************************************************************
-    /// Returns an iterator pointing to the first element in the container
-    /// whose key is not considered to go after the key provided or end()
-    /// if all keys are considered to go after the key provided.
-    ///\return An iterator pointing to the element after key or end()
+    /// Assigns values to the set.
+    /// If asserts or exceptions are enabled, emits set_full if the set does not have enough free space.
+    /// If asserts or exceptions are enabled, emits set_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
     //*********************************************************************
-    iterator upper_bound(key_parameter_t key)
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
     {
-      return iterator(*this, find_upper_node(root_node, key));
+      initialise();
+      insert(first, last);
     }
 
-#if ETL_USING_CPP11
-    //*********************************************************************
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    iterator upper_bound(const K& key)
+    //*************************************************************************
+    /// Clears the set.
+    //*************************************************************************
+    void clear()
     {
-      return iterator(*this, find_upper_node(root_node, key));
+      initialise();
     }
-#endif
 
     //*********************************************************************
-    /// Returns a const_iterator pointing to the first element in the
-    /// container whose key is not considered to go after the key provided
-    /// or end() if all keys are considered to go after the key provided.
-    ///\return An const_iterator pointing to the element after key or end()
-    //*********************************************************************
-    const_iterator upper_bound(key_parameter_t key) const
+    /// Counts the number of elements that contain the key specified.
+    ///\param key The key to search for.
+    ///\return 1 if element was found, 0 otherwise.
+    //*********************************************************************
+    size_type count(key_parameter_t key) const
     {
-      return const_iterator(*this, find_upper_node(root_node, key));
+      return find_node(root_node, key) ? 1 : 0;
     }
 
 #if ETL_USING_CPP11
     //*********************************************************************
     template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    const_iterator upper_bound(const K& key) const
+    size_type count(const K& key) const
     {
-      return const_iterator(*this, find_upper_node(root_node, key));
+      return find_node(root_node, key) ? 1 : 0;
     }
 #endif
 
     //*************************************************************************
-    /// How to compare two key elements.
+    /// Returns two iterators with bounding (lower bound, upper bound) the
+    /// value provided
     //*************************************************************************
-    key_compare key_comp() const
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
     {
-      return compare;
-    };
+      return ETL_OR_STD::make_pair<iterator, iterator>(iterator(*this, find_lower_node(root_node, key)),
+                                                       iterator(*this, find_upper_node(root_node, key)));
+    }
 
+#if ETL_USING_CPP11
     //*************************************************************************
-    /// How to compare two value elements.
-    //*************************************************************************
-    value_compare value_comp() const
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
     {
-      return compare;
-    };
+      return ETL_OR_STD::make_pair<iterator, iterator>(iterator(*this, find_lower_node(root_node, key)),
+                                                       iterator(*this, find_upper_node(root_node, key)));
+    }
+#endif
 
     //*************************************************************************
-    /// Check if the set contains the key.
+    /// Returns two const iterators with bounding (lower bound, upper bound)
+    /// the value provided.
     //*************************************************************************
-    bool contains(const TKey& key) const
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
     {
-      return find(key) != end();
+      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(const_iterator(*this, find_lower_node(root_node, key)),
+                                                                   const_iterator(*this, find_upper_node(root_node, key)));
     }
 
 #if ETL_USING_CPP11
     //*************************************************************************
     template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    bool contains(const K& k) const
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
     {
-      return find(k) != end();
+      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(const_iterator(*this, find_lower_node(root_node, key)),
+                                                                   const_iterator(*this, find_upper_node(root_node, key)));
     }
 #endif
 
-  protected:
-
     //*************************************************************************
-    /// Constructor.
+    /// Erases the value at the specified position.
     //*************************************************************************
-    iset(etl::ipool& node_pool, size_t max_size_)
-      : etl::set_base(max_size_)
-      , p_node_pool(&node_pool)
+    iterator erase(iterator position)
     {
+      // Remove the node by its node specified in iterator position
+      return erase(const_iterator(position));
     }
 
     //*************************************************************************
-    /// Initialise the set.
+    /// Erases the value at the specified position.
     //*************************************************************************
-    void initialise()
+    iterator erase(const_iterator position)
     {
-      const_iterator item = begin();
+      // Find the parent node to be removed
+      Node* reference_node = find_node(root_node, position.p_node);
+      iterator next(*this, reference_node);
+      ++next;
 
-      while (item != end())
-      {
-        item = erase(item);
-      }
-    }
+      remove_node(root_node, (*position));
 
-  private:
+      return next;
+    }
 
     //*************************************************************************
-    /// Allocate a Data_Node.
+    // Erase the key specified.
     //*************************************************************************
-    Data_Node& allocate_data_node(const_reference value)
+    size_type erase(key_parameter_t key_value)
     {
-      Data_Node* node = allocate_data_node();
-      ::new ((void*)&node->value) value_type(value);
-      ETL_INCREMENT_DEBUG_COUNT;
-      return *node;
+      // Return 1 if key value was found and removed
+      return remove_node(root_node, key_value) ? 1 : 0;
     }
 
-#if ETL_USING_CPP11
-    //*************************************************************************
-    /// Allocate a Data_Node.
     //*************************************************************************
-    Data_Node& allocate_data_node(rvalue_reference value)
+#if ETL_USING_CPP11
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type erase(K&& key_value)
     {
-      Data_Node* node = allocate_data_node();
-      ::new ((void*)&node->value) value_type(etl::move(value));
-      ETL_INCREMENT_DEBUG_COUNT;
-      return *node;
+      // Return 1 if key value was found and removed
+      return remove_node(root_node, etl::forward<K>(key_value)) ? 1 : 0;
     }
 #endif
 
     //*************************************************************************
-    /// Create a Data_Node.
+    /// Erases a range of elements.
     //*************************************************************************
-    Data_Node* allocate_data_node()
+    iterator erase(const_iterator first, const_iterator last)
     {
-      Data_Node* (etl::ipool::*func)() = &etl::ipool::allocate<Data_Node>;
-      return (p_node_pool->*func)();
+      while (first != last)
+      {
+        first = erase(first);
+      }
+
+      return last.to_iterator();
     }
 
-    //*************************************************************************
-    /// Destroy a Data_Node.
-    //*************************************************************************
-    void destroy_data_node(Data_Node& node)
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key_value)
     {
-      node.value.~value_type();
-      p_node_pool->release(&node);
-      ETL_DECREMENT_DEBUG_COUNT;
+      return iterator(*this, find_node(root_node, key_value));
     }
 
-    //*************************************************************************
-    /// Find the value matching the node provided
-    //*************************************************************************
-    Node* find_node(Node* position, key_parameter_t key)
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& k)
     {
-      Node* found = position;
-      while (found)
-      {
-        // Downcast found to Data_Node class for comparison and other operations
-        Data_Node& found_data_node = iset::data_cast(*found);
-
-        // Compare the node value to the current position value
-        if (node_comp(key, found_data_node))
-        {
-          // Keep searching for the node on the left
-          found = found->children[kLeft];
-        }
-        else if (node_comp(found_data_node, key))
-        {
-          // Keep searching for the node on the right
-          found = found->children[kRight];
-        }
-        else
-        {
-          // Node that matches the key provided was found, exit loop
-          break;
-        }
-      }
+      return iterator(*this, find_node(root_node, k));
+    }
+#endif
 
-      // Return the node found (might be ETL_NULLPTR)
-      return found;
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key_value) const
+    {
+      return const_iterator(*this, find_node(root_node, key_value));
     }
 
 #if ETL_USING_CPP11
-    //*************************************************************************
+    //*********************************************************************
     template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    Node* find_node(Node* position, const K& key)
+    const_iterator find(const K& key_value) const
     {
-      Node* found = position;
-      while (found)
-      {
-        // Downcast found to Data_Node class for comparison and other operations
-        Data_Node& found_data_node = iset::data_cast(*found);
+      return const_iterator(*this, find_node(root_node, key_value));
+    }
+#endif
 
-        // Compare the node value to the current position value
-        if (node_comp(key, found_data_node))
-        {
-          // Keep searching for the node on the left
-          found = found->children[kLeft];
-        }
-        else if (node_comp(found_data_node, key))
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      // Default to no inserted node
+      Node* inserted_node = ETL_NULLPTR;
+      bool inserted = false;
+
+      if (full())
+      {
+        iterator iter = find(value);
+        if (iter == end())
         {
-          // Keep searching for the node on the right
-          found = found->children[kRight];
+          ETL_ASSERT_FAIL(ETL_ERROR(set_full));
         }
         else
         {
-          // Node that matches the key provided was found, exit loop
-          break;
+          return ETL_OR_STD::make_pair(iter, false);
         }
       }
+      
+      // Get next available free node
+      Data_Node& node = allocate_data_node(value);
 
-      // Return the node found (might be ETL_NULLPTR)
-      return found;
+      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
+      inserted_node = insert_node(root_node, node);
+      inserted = inserted_node == &node;
+
+      // Insert node into tree and return iterator to new node location in tree
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted);
     }
-#endif
 
-    //*************************************************************************
-    /// Find the value matching the node provided
-    //*************************************************************************
-    const Node* find_node(const Node* position, key_parameter_t key) const
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
     {
-      const Node* found = position;
-      while (found)
+      // Default to no inserted node
+      Node* inserted_node = ETL_NULLPTR;
+      bool inserted = false;
+      
+      if (full())
       {
-        // Downcast found to Data_Node class for comparison and other operations
-        const Data_Node& found_data_node = iset::data_cast(*found);
-
-        // Compare the node value to the current position value
-        if (node_comp(key, found_data_node))
-        {
-          // Keep searching for the node on the left
-          found = found->children[kLeft];
-        }
-        else if (node_comp(found_data_node, key))
+        iterator iter = find(value);
+        if (iter == end())
         {
-          // Keep searching for the node on the right
-          found = found->children[kRight];
+          ETL_ASSERT_FAIL(ETL_ERROR(set_full));
         }
         else
         {
-          // Node that matches the key provided was found, exit loop
-          break;
+          return ETL_OR_STD::make_pair(iter, false);
         }
       }
 
-      // Return the node found (might be ETL_NULLPTR)
-      return found;
+      // Get next available free node
+      Data_Node& node = allocate_data_node(etl::move(value));
+
+      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
+      inserted_node = insert_node(root_node, node);
+      inserted = inserted_node == &node;
+
+      // Insert node into tree and return iterator to new node location in tree
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted);
     }
+#endif
 
-#if ETL_USING_CPP11
-    //*************************************************************************
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    const Node* find_node(const Node* position, const K& key) const
+    //*********************************************************************
+    /// Inserts a value to the set starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference value)
     {
-      const Node* found = position;
-      while (found)
-      {
-        // Downcast found to Data_Node class for comparison and other operations
-        const Data_Node& found_data_node = iset::data_cast(*found);
+      // Default to no inserted node
+      Node* inserted_node = ETL_NULLPTR;
 
-        // Compare the node value to the current position value
-        if (node_comp(key, found_data_node))
-        {
-          // Keep searching for the node on the left
-          found = found->children[kLeft];
-        }
-        else if (node_comp(found_data_node, key))
+      if (full())
+      {
+        iterator iter = find(value);
+        if (iter == end())
         {
-          // Keep searching for the node on the right
-          found = found->children[kRight];
+          ETL_ASSERT_FAIL(ETL_ERROR(set_full));
         }
         else
         {
-          // Node that matches the key provided was found, exit loop
-          break;
+          return iter;
         }
       }
 
-      // Return the node found (might be ETL_NULLPTR)
-      return found;
+      // Get next available free node
+      Data_Node& node = allocate_data_node(value);
+
+      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
+      inserted_node = insert_node(root_node, node);
+
+      // Insert node into tree and return iterator to new node location in tree
+      return iterator(*this, inserted_node);
     }
-#endif
 
-    //*************************************************************************
-    /// Find the reference node matching the node provided
-    //*************************************************************************
-    Node*& find_node(Node*& position, const Node* node)
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the set starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits set_full if the set is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference value)
     {
-      Node* found = position;
-      while (found)
+      // Default to no inserted node
+      Node* inserted_node = ETL_NULLPTR;
+
+      if (full())
       {
-        if (found->children[kLeft] == node)
-        {
-          return found->children[kLeft];
-        }
-        else if (found->children[kRight] == node)
+        iterator iter = find(value);
+        if (iter == end())
         {
-          return found->children[kRight];
+          ETL_ASSERT_FAIL(ETL_ERROR(set_full));
         }
         else
         {
-          // Downcast found to Data_Node class for comparison and other operations
-          Data_Node& found_data_node = iset::data_cast(*found);
-          const Data_Node& data_node = iset::data_cast(*node);
-
-          // Compare the node value to the current position value
-          if (node_comp(data_node, found_data_node))
-          {
-            // Keep searching for the node on the left
-            found = found->children[kLeft];
-          }
-          else if (node_comp(found_data_node, data_node))
-          {
-            // Keep searching for the node on the right
-            found = found->children[kRight];
-          }
-          else
-          {
-            // Return position provided (it matches the node)
-            return position;
-          }
+          return iter;
         }
       }
 
-      // Return root node if nothing was found
-      return root_node;
+      // Get next available free node
+      Data_Node& node = allocate_data_node(etl::move(value));
+
+      // Obtain the inserted node (might be ETL_NULLPTR if node was a duplicate)
+      inserted_node = insert_node(root_node, node);
+
+      // Insert node into tree and return iterator to new node location in tree
+      return iterator(*this, inserted_node);
     }
+#endif
 
-    //*************************************************************************
-    /// Find the parent node that contains the node provided in its left or
-    /// right tree
-    //*************************************************************************
-    Node* find_parent_node(Node* position, const Node* node)
+    //*********************************************************************
+    /// Inserts a range of values to the set.
+    /// If asserts or exceptions are enabled, emits set_full if the set does not have enough free space.
+    ///\param position The position to insert at.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
     {
-      // Default to no parent node found
-      Node* found = ETL_NULLPTR;
-
-      // If the position provided is the same as the node then there is no parent
-      if (position && node && position != node)
+      while (first != last)
       {
-        while (position)
-        {
-          // Is this position not the parent of the node we are looking for?
-          if (position->children[kLeft] != node &&
-            position->children[kRight] != node)
-          {
-            // Downcast node and position to Data_Node references for key comparisons
-            const Data_Node& node_data_node = iset::data_cast(*node);
-            Data_Node& position_data_node = iset::data_cast(*position);
-            // Compare the node value to the current position value
-            if (node_comp(node_data_node, position_data_node))
-            {
-              // Keep looking for parent on the left
-              position = position->children[kLeft];
-            }
-            else if (node_comp(position_data_node, node_data_node))
-            {
-              // Keep looking for parent on the right
-              position = position->children[kRight];
-            }
-          }
-          else
-          {
-            // Return the current position as the parent node found
-            found = position;
-
-            // Parent node found, exit loop
-            break;
-          }
-        }
+        insert(*first);
+        ++first;
       }
+    }
 
-      // Return the parent node found (might be ETL_NULLPTR)
-      return found;
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go before the key provided or end()
+    /// if all keys are considered to go before the key provided.
+    ///\return An iterator pointing to the element not before key or end()
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      return iterator(*this, find_lower_node(root_node, key));
     }
 
-    //*************************************************************************
-    /// Find the parent node that contains the node provided in its left or
-    /// right tree
-    //*************************************************************************
-    const Node* find_parent_node(const Node* position, const Node* node) const
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
     {
-      // Default to no parent node found
-      const Node* found = ETL_NULLPTR;
+      return iterator(*this, find_lower_node(root_node, key));
+    }
+#endif
 
-      // If the position provided is the same as the node then there is no parent
-      if (position && node && position != node)
-      {
-        while (position)
-        {
-          // Is this position not the parent of the node we are looking for?
-          if (position->children[kLeft] != node &&
-            position->children[kRight] != node)
-          {
-            // Downcast node and position to Data_Node references for key comparisons
-            const Data_Node& node_data_node = iset::data_cast(*node);
-            const Data_Node& position_data_node = iset::data_cast(*position);
-            // Compare the node value to the current position value
-            if (node_comp(node_data_node, position_data_node))
-            {
-              // Keep looking for parent on the left
-              position = position->children[kLeft];
-            }
-            else if (node_comp(position_data_node, node_data_node))
-            {
-              // Keep looking for parent on the right
-              position = position->children[kRight];
-            }
-          }
-          else
-          {
-            // Return the current position as the parent node found
-            found = position;
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go before the key provided
+    /// or end() if all keys are considered to go before the key provided.
+    ///\return An const_iterator pointing to the element not before key or end()
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return const_iterator(*this, find_lower_node(root_node, key));
+    }
 
-            // Parent node found, exit loop
-            break;
-          }
-        }
-      }
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_iterator(*this, find_lower_node(root_node, key));
+    }
+#endif
 
-      // Return the parent node found (might be ETL_NULLPTR)
-      return found;
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go after the key provided or end()
+    /// if all keys are considered to go after the key provided.
+    ///\return An iterator pointing to the element after key or end()
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      return iterator(*this, find_upper_node(root_node, key));
     }
 
-    //*************************************************************************
-    /// Find the node whose key is not considered to go before the key provided
-    //*************************************************************************
-    Node* find_lower_node(Node* position, key_parameter_t key) const
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
     {
-      // Something at this position? keep going
-      Node* lower_node = ETL_NULLPTR;
-      while (position)
-      {
-        // Downcast lower node to Data_Node reference for key comparisons
-        Data_Node& data_node = iset::data_cast(*position);
-        // Compare the key value to the current lower node key value
-        if (node_comp(key, data_node))
-        {
-          lower_node = position;
-          if (position->children[kLeft])
-          {
-            position = position->children[kLeft];
-          }
-          else
-          {
-            // Found lowest node
-            break;
-          }
-        }
-        else if (node_comp(data_node, key))
-        {
-          position = position->children[kRight];
-        }
-        else
-        {
-          // Make note of current position, but keep looking to left for more
-          lower_node = position;
-          position = position->children[kLeft];
-        }
-      }
+      return iterator(*this, find_upper_node(root_node, key));
+    }
+#endif
 
-      // Return the lower_node position found
-      return lower_node;
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go after the key provided
+    /// or end() if all keys are considered to go after the key provided.
+    ///\return An const_iterator pointing to the element after key or end()
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return const_iterator(*this, find_upper_node(root_node, key));
     }
 
 #if ETL_USING_CPP11
-    //*************************************************************************
+    //*********************************************************************
     template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    Node* find_lower_node(Node* position, const K& key) const
+    const_iterator upper_bound(const K& key) const
     {
-      // Something at this position? keep going
-      Node* lower_node = ETL_NULLPTR;
-      while (position)
-      {
-        // Downcast lower node to Data_Node reference for key comparisons
-        Data_Node& data_node = iset::data_cast(*position);
-        // Compare the key value to the current lower node key value
-        if (node_comp(key, data_node))
-        {
-          lower_node = position;
-          if (position->children[kLeft])
-          {
-            position = position->children[kLeft];
-          }
-          else
-          {
-            // Found lowest node
-            break;
-          }
-        }
-        else if (node_comp(data_node, key))
-        {
-          position = position->children[kRight];
-        }
-        else
-        {
-          // Make note of current position, but keep looking to left for more
-          lower_node = position;
-          position = position->children[kLeft];
-        }
-      }
-
-      // Return the lower_node position found
-      return lower_node;
+      return const_iterator(*this, find_upper_node(root_node, key));
     }
 #endif
 
     //*************************************************************************
-    /// Find the node whose key is considered to go after the key provided
+    /// Checks to see if the set is full.
+    /// The nodes come from the pool, which may be shared with other sets.
     //*************************************************************************
-    Node* find_upper_node(Node* position, key_parameter_t key) const
+    bool full() const
     {
-      // Keep track of parent of last upper node
-      Node* upper_node = ETL_NULLPTR;
-      // Start with position provided
-      Node* node = position;
-      while (node)
-      {
-        // Downcast position to Data_Node reference for key comparisons
-        Data_Node& data_node = iset::data_cast(*node);
-        // Compare the key value to the current upper node key value
-        if (node_comp(key, data_node))
-        {
-          upper_node = node;
-          node = node->children[kLeft];
-        }
-        else if (node_comp(data_node, key))
-        {
-          node = node->children[kRight];
-        }
-        else if (node->children[kRight])
-        {
-          upper_node = find_limit_node(node->children[kRight], kLeft);
-          break;
-        }
-        else
-        {
-          break;
-        }
-      }
-
-      // Return the upper node position found (might be ETL_NULLPTR)
-      return upper_node;
+      return p_node_pool->full();
     }
 
-#if ETL_USING_CPP11
     //*************************************************************************
-    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    Node* find_upper_node(Node* position, const K& key) const
+    /// Returns the remaining capacity.
+    /// The nodes come from the pool, which may be shared with other sets.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
     {
-      // Keep track of parent of last upper node
-      Node* upper_node = ETL_NULLPTR;
-      // Start with position provided
-      Node* node = position;
-      while (node)
-      {
-        // Downcast position to Data_Node reference for key comparisons
-        Data_Node& data_node = iset::data_cast(*node);
-        // Compare the key value to the current upper node key value
-        if (node_comp(key, data_node))
-        {
-          upper_node = node;
-          node = node->children[kLeft];
-        }
-        else if (node_comp(data_node, key))
-        {
-          node = node->children[kRight];
-        }
-        else if (node->children[kRight])
-        {
-          upper_node = find_limit_node(node->children[kRight], kLeft);
-          break;
-        }
-        else
-        {
-          break;
-        }
-      }
-
-      // Return the upper node position found (might be ETL_NULLPTR)
-      return upper_node;
+      return p_node_pool->available();
     }
-#endif
 
     //*************************************************************************
-    /// Insert a node.
+    /// How to compare two key elements.
     //*************************************************************************
-    Node* insert_node(Node*& position, Data_Node& node)
+    key_compare key_comp() const
     {
-      // Find the location where the node belongs
-      Node* found = position;
-
-      // Was position provided not empty? then find where the node belongs
-      if (position)
-      {
-        // Find the critical parent node (default to ETL_NULLPTR)
-        Node* critical_parent_node = ETL_NULLPTR;
-        Node* critical_node = root_node;
-
-        while (found)
-        {
-          // Search for critical weight node (all nodes whose weight factor
-          // is set to kNeither (balanced)
-          if (kNeither != found->weight)
-          {
-            critical_node = found;
-          }
-
-          // Downcast found to Data_Node class for comparison and other operations
-          Data_Node& found_data_node = iset::data_cast(*found);
-
-          // Is the node provided to the left of the current position?
-          if (node_comp(node, found_data_node))
-          {
-            // Update direction taken to insert new node in parent node
-            found->dir = kLeft;
-          }
-          // Is the node provided to the right of the current position?
-          else if (node_comp(found_data_node, node))
-          {
-            // Update direction taken to insert new node in parent node
-            found->dir = kRight;
-          }
-          else
-          {
-            // Update direction taken to insert new node in parent node
-            found->dir = kNeither;
-
-            // Clear critical node value to skip weight step below
-            critical_node = ETL_NULLPTR;
-
-            // Destroy the node provided (its a duplicate)
-            destroy_data_node(node);
+      return compare;
+    };
 
-            // Exit loop, duplicate node found
-            break;
-          }
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return compare;
+    };
 
-          // Is there a child of this parent node?
-          if (found->children[found->dir])
-          {
-            // Will this node be the parent of the next critical node whose
-            // weight factor is set to kNeither (balanced)?
-            if (kNeither != found->children[found->dir]->weight)
-            {
-              critical_parent_node = found;
-            }
+    //*********************************************************************
+    /// Finds each key of an ascending range.
+    /// Each search starts where the previous one ended, so a batch of K keys
+    /// visits fewer nodes than K calls to find().
+    ///\param first The first key. The keys must be ascending by key_comp().
+    ///\param last  One past the last key.
+    ///\param out   Receives an iterator for each key, or end() if not found.
+    ///\return One past the last iterator written.
+    //*********************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator find_sorted(TInputIterator first, TInputIterator last, TOutputIterator out)
+    {
+      sorted_search search(root_node);
 
-            // Keep looking for empty spot to insert new node
-            found = found->children[found->dir];
-          }
-          else
-          {
-            // Attach node to right
-            attach_node(found->children[found->dir], node);
+      while (first != last)
+      {
+        *out = iterator(*this, const_cast<Node*>(find_next_sorted_node(search, *first)));
+        ++out;
+        ++first;
+      }
 
-            // Return newly added node
-            found = found->children[found->dir];
+      return out;
+    }
 
-            // Exit loop
-            break;
-          }
-        }
+    //*********************************************************************
+    /// Finds each key of an ascending range.
+    ///\param first The first key. The keys must be ascending by key_comp().
+    ///\param last  One past the last key.
+    ///\param out   Receives a const_iterator for each key, or end() if not found.
+    ///\return One past the last iterator written.
+    //*********************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator find_sorted(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+      sorted_search search(root_node);
 
-        // Was a critical node found that should be checked for balance?
-        if (critical_node)
-        {
-          if (critical_parent_node == ETL_NULLPTR && critical_node == root_node)
-          {
-            balance_node(root_node);
-          }
-          else if (critical_parent_node == ETL_NULLPTR && critical_node == position)
-          {
-            balance_node(position);
-          }
-          else
-          {
-            if (critical_parent_node != ETL_NULLPTR)
-            {
-              balance_node(critical_parent_node->children[critical_parent_node->dir]);
-            }
-          }
-        }
-      }
-      else
+      while (first != last)
       {
-        // Attach node to current position
-        attach_node(position, node);
-
-        // Return newly added node at current position
-        found = position;
+        *out = const_iterator(*this, find_next_sorted_node(search, *first));
+        ++out;
+        ++first;
       }
 
-      // Return the node found (might be ETL_NULLPTR)
-      return found;
+      return out;
     }
 
-    //*************************************************************************
-    /// Find the next node in sequence from the node provided
-    //*************************************************************************
-    void next_node(Node*&position)
+    //*********************************************************************
+    /// Copies the elements whose keys are in an ascending range, in order.
+    ///\param first The first key. The keys must be ascending by key_comp().
+    ///\param last  One past the last key.
+    ///\param out   Receives the elements found.
+    ///\return One past the last element written.
+    //*********************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator intersect_sorted(TInputIterator first, TInputIterator last, TOutputIterator out) const
     {
-      if (position)
-      {
-        // Is there a tree on the right? then find the minimum of that tree
-        if (position->children[kRight])
-        {
-          // Return minimum node found
-          position = find_limit_node(position->children[kRight], kLeft);
-        }
-        // Otherwise find the parent of this node
-        else
-        {
-          // Start with current position as parent
-          Node* parent = position;
-          do {
-            // Update current position as previous parent
-            position = parent;
-            // Find parent of current position
-            parent = find_parent_node(root_node, position);
-            // Repeat while previous position was on right side of parent tree
-          } while (parent && parent->children[kRight] == position);
+      sorted_search search(root_node);
+
+      while (first != last)
+      {
+        const Node* p_node = find_next_sorted_node(search, *first);
 
-          // Set parent node as the next position
-          position = parent;
+        if (p_node != ETL_NULLPTR)
+        {
+          *out = iset::data_cast(p_node)->value;
+          ++out;
         }
+
+        ++first;
       }
+
+      return out;
     }
 
-    //*************************************************************************
-    /// Find the next node in sequence from the node provided
-    //*************************************************************************
-    void next_node(const Node*& position) const
+    //*********************************************************************
+    /// Copies the keys of an ascending range that are not in the set.
+    ///\param first The first key. The keys must be ascending by key_comp().
+    ///\param last  One past the last key.
+    ///\param out   Receives the keys not found.
+    ///\return One past the last key written.
+    //*********************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator difference_sorted(TInputIterator first, TInputIterator last, TOutputIterator out) const
     {
-      if (position)
+      sorted_search search(root_node);
+
+      while (first != last)
       {
-        // Is there a tree on the right? then find the minimum of that tree
-        if (position->children[kRight])
+        if (find_next_sorted_node(search, *first) == ETL_NULLPTR)
         {
-          // Return minimum node found
-          position = find_limit_node(position->children[kRight], kLeft);
+          *out = *first;
+          ++out;
         }
-        // Otherwise find the parent of this node
-        else
-        {
-          // Start with current position as parent
-          const Node* parent = position;
-          do {
-            // Update current position as previous parent
-            position = parent;
-            // Find parent of current position
-            parent = find_parent_node(root_node, position);
-            // Repeat while previous position was on right side of parent tree
-          } while (parent && parent->children[kRight] == position);
 
-          // Set parent node as the next position
-          position = parent;
-        }
+        ++first;
       }
+
+      return out;
     }
 
-    //*************************************************************************
-    /// Find the previous node in sequence from the node provided
-    //*************************************************************************
-    void prev_node(Node*&position)
+    //*********************************************************************
+    /// Counts the keys of an ascending range that are in the set.
+    ///\param first The first key. The keys must be ascending by key_comp().
+    ///\param last  One past the last key.
+    //*********************************************************************
+    template <typename TInputIterator>
+    size_type count_sorted(TInputIterator first, TInputIterator last) const
     {
-      // If starting at the terminal end, the previous node is the maximum node
-      // from the root
-      if (!position)
-      {
-        position = find_limit_node(root_node, kRight);
-      }
-      else
+      sorted_search search(root_node);
+      size_type     n = 0U;
+
+      while (first != last)
       {
-        // Is there a tree on the left? then find the maximum of that tree
-        if (position->children[kLeft])
+        if (find_next_sorted_node(search, *first) != ETL_NULLPTR)
         {
-          // Return maximum node found
-          position = find_limit_node(position->children[kLeft], kRight);
+          ++n;
         }
-        // Otherwise find the parent of this node
-        else
-        {
-          // Start with current position as parent
-          Node* parent = position;
-          do {
-            // Update current position as previous parent
-            position = parent;
-            // Find parent of current position
-            parent = find_parent_node(root_node, position);
-            // Repeat while previous position was on left side of parent tree
-          } while (parent && parent->children[kLeft] == position);
 
-          // Set parent node as the next position
-          position = parent;
-        }
+        ++first;
       }
+
+      return n;
     }
 
     //*************************************************************************
-    /// Find the previous node in sequence from the node provided
+    /// Check if the set contains the key.
     //*************************************************************************
-    void prev_node(const Node*& position) const
+    bool contains(const TKey& key) const
     {
-      // If starting at the terminal end, the previous node is the maximum node
-      // from the root
-      if (!position)
-      {
-        position = find_limit_node(root_node, kRight);
-      }
-      else
-      {
-        // Is there a tree on the left? then find the maximum of that tree
-        if (position->children[kLeft])
-        {
-          // Return maximum node found
-          position = find_limit_node(position->children[kLeft], kRight);
-        }
-        // Otherwise find the parent of this node
-        else
-        {
-          // Start with current position as parent
-          const Node* parent = position;
-          do {
-            // Update current position as previous parent
-            position = parent;
-            // Find parent of current position
-            parent = find_parent_node(root_node, position);
-            // Repeat while previous position was on left side of parent tree
-          } while (parent && parent->children[kLeft] == position);
+      return find(key) != end();
+    }
 
-          // Set parent node as the next position
-          position = parent;
-        }
-      }
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& k) const
+    {
+      return find(k) != end();
     }
+#endif
+
+  protected:
 
     //*************************************************************************
-    /// Remove the node specified from somewhere starting at the position
-    /// provided
+    /// Constructor.
     //*************************************************************************
-    Node* remove_node(Node*& position, key_parameter_t key)
+    iset(etl::ipool& node_pool, size_t max_size_)
+      : etl::set_base(max_size_)
+      , p_node_pool(&node_pool)
     {
-      // Step 1: Find the target node that matches the key provided, the
-      // replacement node (might be the same as target node), and the critical
-      // node to start rebalancing the tree from (up to the replacement node)
-      Node* found_parent = ETL_NULLPTR;
-      Node* found = ETL_NULLPTR;
-      Node* replace_parent = ETL_NULLPTR;
-      Node* replace = position;
-      Node* balance_parent = ETL_NULLPTR;
-      Node* balance = root_node;
-      while (replace)
-      {
-        // Downcast found to Data_Node class for comparison and other operations
-        Data_Node& replace_data_node = iset::data_cast(*replace);
-
-        // Compare the key provided to the replace data node key
-        if (node_comp(key, replace_data_node))
-        {
-          // Update the direction to the target/replace node
-          replace->dir = kLeft;
-        }
-        else if (node_comp(replace_data_node, key))
-        {
-          // Update the direction to the target/replace node
-          replace->dir = kRight;
-        }
-        else
-        {
-          // Update the direction to the replace node (target node found here)
-          replace->dir = replace->children[kLeft] ? kLeft : kRight;
+    }
 
-          // Note the target node was found (and its parent)
-          found_parent = replace_parent;
-          found = replace;
-        }
-        // Replacement node found if its missing a child in the replace->dir
-        // value set above
-        if (replace->children[replace->dir] == ETL_NULLPTR)
-        {
-          // Exit loop once replace node is found (target might not have been)
-          break;
-        }
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_node_pool() const
+    {
+      return *p_node_pool;
+    }
 
-        // If replacement node weight is kNeither or we are taking the shorter
-        // path of replacement node and our sibling (on longer path) is
-        // balanced then we need to update the balance node to match this
-        // replacement node but all our ancestors will not require rebalancing
-        if ((replace->weight == kNeither) ||
-          (replace->weight == (1 - replace->dir) &&
-            replace->children[1 - replace->dir]->weight == kNeither))
-        {
-          // Update balance node (and its parent) to replacement node
-          balance_parent = replace_parent;
-          balance = replace;
-        }
+    //*************************************************************************
+    /// Initialise the set.
+    //*************************************************************************
+    void initialise()
+    {
+      const_iterator item = begin();
 
-        // Keep searching for the replacement node
-        replace_parent = replace;
-        replace = replace->children[replace->dir];
+      while (item != end())
+      {
+        item = erase(item);
       }
+    }
 
-      // If target node was found, proceed with rebalancing and replacement
-      if (found)
-      {
-        // Step 2: Update weights from critical node to replacement parent node
-        while (balance)
-        {
-          if (balance->children[balance->dir] == ETL_NULLPTR)
-          {
-            break;
-          }
+  private:
 
-          if (balance->weight == kNeither)
-          {
-            balance->weight = 1 - balance->dir;
-          }
-          else if (balance->weight == balance->dir)
-          {
-            balance->weight = kNeither;
-          }
-          else
-          {
-            int weight = balance->children[1 - balance->dir]->weight;
-            // Perform a 3 node rotation if weight is same as balance->dir
-            if (weight == balance->dir)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_3node(root_node, 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-              else
-              {
-                rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-            }
-            // Already balanced, rebalance and make it heavy in opposite
-            // direction of the node being removed
-            else if (weight == kNeither)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-                root_node->weight = balance->dir;
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-                balance_parent->children[balance_parent->dir]->weight = balance->dir;
-              }
-              // Update balance node weight in opposite direction of node removed
-              balance->weight = 1 - balance->dir;
-            }
-            // Rebalance and leave it balanced
-            else
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-              }
-            }
+    //*************************************************************************
+    /// Allocate a Data_Node.
+    //*************************************************************************
+    Data_Node& allocate_data_node(const_reference value)
+    {
+      Data_Node* node = allocate_data_node();
+      ::new ((void*)&node->value) value_type(value);
+      ETL_INCREMENT_DEBUG_COUNT;
+      return *node;
+    }
 
-            // Is balance node the same as the target node found? then update
-            // its parent after the rotation performed above
-            if (balance == found)
-            {
-              if (balance_parent)
-              {
-                found_parent = balance_parent->children[balance_parent->dir];
-                // Update dir since it is likely stale
-                found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
-              }
-              else
-              {
-                found_parent = root_node;
-                root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
-              }
-            }
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Allocate a Data_Node.
+    //*************************************************************************
+    Data_Node& allocate_data_node(rvalue_reference value)
+    {
+      Data_Node* node = allocate_data_node();
+      ::new ((void*)&node->value) value_type(etl::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+      return *node;
+    }
+#endif
+
+    //*************************************************************************
+    /// Create a Data_Node.
+    //*************************************************************************
+    Data_Node* allocate_data_node()
+    {
+      Data_Node* (etl::ipool::*func)() = &etl::ipool::allocate<Data_Node>;
+      return (p_node_pool->*func)();
+    }
+
+    //*************************************************************************
+    /// Finds the next of a series of ascending keys.
+    /// Leaves the subtrees whose keys are all less than the key, then searches
+    /// down from there, keeping the nodes with greater keys for the next key.
+    //*************************************************************************
+    const Node* find_next_sorted_node(sorted_search& search, key_parameter_t key) const
+    {
+      while (search.depth != 0U)
+      {
+        const Node* ancestor = search.ancestors[search.depth - 1U];
+
+        if (!node_comp(iset::data_cast(*ancestor), key))
+        {
+          // The nearest greater or equal ancestor.
+          if (!node_comp(key, iset::data_cast(*ancestor)))
+          {
+            return ancestor;
           }
 
-          // Next balance node to consider
-          balance_parent = balance;
-          balance = balance->children[balance->dir];
-        } // while(balance)
+          break;
+        }
 
-          // Step 3: Swap found node with replacement node
-        if (found_parent)
+        search.subtree = ancestor->children[kRight];
+        --search.depth;
+      }
+
+      while (search.subtree != ETL_NULLPTR)
+      {
+        const Node* position = search.subtree;
+        const Data_Node& data_node = iset::data_cast(*position);
+
+        if (node_comp(key, data_node))
         {
-          // Handle traditional case
-          detach_node(found_parent->children[found_parent->dir],
-            replace_parent->children[replace_parent->dir]);
+          search.ancestors[search.depth++] = position;
+          search.subtree = position->children[kLeft];
+        }
+        else if (node_comp(data_node, key))
+        {
+          search.subtree = position->children[kRight];
         }
-        // Handle root node removal
         else
         {
-          // Valid replacement node for root node being removed?
-          if (replace_parent)
-          {
-            detach_node(root_node, replace_parent->children[replace_parent->dir]);
-          }
-          else
-          {
-            // Target node and replacement node are both root node
-            detach_node(root_node, root_node);
-          }
+          search.ancestors[search.depth++] = position;
+          search.subtree = ETL_NULLPTR;
+
+          return position;
         }
+      }
 
-        // Downcast found into data node
-        Data_Node& found_data_node = iset::data_cast(*found);
+      return ETL_NULLPTR;
+    }
 
-        // One less.
-        --current_size;
+    //*************************************************************************
+    /// Destroy a Data_Node.
+    //*************************************************************************
+    void destroy_data_node(Data_Node& node)
+    {
+      node.value.~value_type();
+      p_node_pool->release(&node);
+      ETL_DECREMENT_DEBUG_COUNT;
+    }
 
-        // Destroy the node removed
-        destroy_data_node(found_data_node);
-      } // if(found)
+    //*************************************************************************
+    /// Compares keys of type K with the keys of data nodes.
+    //*************************************************************************
+    template <typename K>
+    class key_node_compare
+    {
+    public:
 
-        // Return node found (might be ETL_NULLPTR)
-      return found;
+      explicit key_node_compare(const key_compare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      int operator()(const void* p_key, const Node& node) const
+      {
+        const K&        key   = *static_cast<const K*>(p_key);
+        const_reference value = iset::data_cast(node).value;
+
+        return compare(key, value) ? -1 : (compare(value, key) ? 1 : 0);
+      }
+
+      const void* key(const Node& node) const
+      {
+        return &iset::data_cast(node).value;
+      }
+
+    private:
+
+      const key_compare& compare;
+    };
+
+    //*************************************************************************
+    /// The compare used by the tree algorithms.
+    /// If ETL_USE_FOLDED_TREE_CODE is defined, sets of trivially copyable keys
+    /// compare through function pointers and share one copy of the tree
+    /// algorithms, at the cost of an indirect call per comparison.
+    /// The setting must be the same in every translation unit.
+    //*************************************************************************
+#if defined(ETL_USE_FOLDED_TREE_CODE)
+    typedef typename etl::conditional<etl::is_trivially_copyable<TKey>::value, folded_node_compare, key_node_compare<TKey> >::type tree_compare_type;
+#else
+    typedef key_node_compare<TKey> tree_compare_type;
+#endif
+
+    tree_compare_type tree_compare() const
+    {
+      return make_tree_compare(static_cast<tree_compare_type*>(ETL_NULLPTR));
+    }
+
+    key_node_compare<TKey> make_tree_compare(key_node_compare<TKey>*) const
+    {
+      return key_node_compare<TKey>(compare);
+    }
+
+    folded_node_compare make_tree_compare(folded_node_compare*) const
+    {
+      return folded_node_compare(&iset::folded_compare, &iset::folded_key, &compare);
+    }
+
+    static int folded_compare(const void* p_context, const void* p_key, const Node& node)
+    {
+      return key_node_compare<TKey>(*static_cast<const key_compare*>(p_context))(p_key, node);
+    }
+
+    static const void* folded_key(const Node& node)
+    {
+      return &iset::data_cast(node).value;
+    }
+
+    //*************************************************************************
+    /// Find the value matching the node provided
+    //*************************************************************************
+    Node* find_node(Node* position, key_parameter_t key) const
+    {
+      return set_base::find_node(position, &key, tree_compare());
     }
 
 #if ETL_USING_CPP11
     //*************************************************************************
     template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
-    Node* remove_node(Node*& position, const K& key)
+    Node* find_node(Node* position, const K& key) const
     {
-      // Step 1: Find the target node that matches the key provided, the
-      // replacement node (might be the same as target node), and the critical
-      // node to start rebalancing the tree from (up to the replacement node)
-      Node* found_parent = ETL_NULLPTR;
-      Node* found = ETL_NULLPTR;
-      Node* replace_parent = ETL_NULLPTR;
-      Node* replace = position;
-      Node* balance_parent = ETL_NULLPTR;
-      Node* balance = root_node;
-      while (replace)
-      {
-        // Downcast found to Data_Node class for comparison and other operations
-        Data_Node& replace_data_node = iset::data_cast(*replace);
+      return set_base::find_node(position, &key, key_node_compare<K>(compare));
+    }
+#endif
 
-        // Compare the key provided to the replace data node key
-        if (node_comp(key, replace_data_node))
-        {
-          // Update the direction to the target/replace node
-          replace->dir = kLeft;
-        }
-        else if (node_comp(replace_data_node, key))
-        {
-          // Update the direction to the target/replace node
-          replace->dir = kRight;
-        }
-        else
-        {
-          // Update the direction to the replace node (target node found here)
-          replace->dir = replace->children[kLeft] ? kLeft : kRight;
+    //*************************************************************************
+    /// Find the reference node matching the node provided
+    //*************************************************************************
+    Node* find_node(Node* position, const Node* node) const
+    {
+      return set_base::find_node(position, node, tree_compare());
+    }
 
-          // Note the target node was found (and its parent)
-          found_parent = replace_parent;
-          found = replace;
-        }
-        // Replacement node found if its missing a child in the replace->dir
-        // value set above
-        if (replace->children[replace->dir] == ETL_NULLPTR)
-        {
-          // Exit loop once replace node is found (target might not have been)
-          break;
-        }
+    //*************************************************************************
+    /// Find the node whose key is not considered to go before the key provided
+    //*************************************************************************
+    Node* find_lower_node(Node* position, key_parameter_t key) const
+    {
+      return set_base::find_lower_node(position, &key, tree_compare());
+    }
 
-        // If replacement node weight is kNeither or we are taking the shorter
-        // path of replacement node and our sibling (on longer path) is
-        // balanced then we need to update the balance node to match this
-        // replacement node but all our ancestors will not require rebalancing
-        if ((replace->weight == kNeither) ||
-          (replace->weight == (1 - replace->dir) &&
-            replace->children[1 - replace->dir]->weight == kNeither))
-        {
-          // Update balance node (and its parent) to replacement node
-          balance_parent = replace_parent;
-          balance = replace;
-        }
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    Node* find_lower_node(Node* position, const K& key) const
+    {
+      return set_base::find_lower_node(position, &key, key_node_compare<K>(compare));
+    }
+#endif
 
-        // Keep searching for the replacement node
-        replace_parent = replace;
-        replace = replace->children[replace->dir];
-      }
+    //*************************************************************************
+    /// Find the node whose key is considered to go after the key provided
+    //*************************************************************************
+    Node* find_upper_node(Node* position, key_parameter_t key) const
+    {
+      return set_base::find_upper_node(position, &key, tree_compare());
+    }
 
-      // If target node was found, proceed with rebalancing and replacement
-      if (found)
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    Node* find_upper_node(Node* position, const K& key) const
+    {
+      return set_base::find_upper_node(position, &key, key_node_compare<K>(compare));
+    }
+#endif
+
+    //*************************************************************************
+    /// Insert a node.
+    //*************************************************************************
+    Node* insert_node(Node*& position, Data_Node& node)
+    {
+      Node* found = set_base::insert_node(position, node, tree_compare());
+
+      if (found != &node)
       {
-        // Step 2: Update weights from critical node to replacement parent node
-        while (balance)
-        {
-          if (balance->children[balance->dir] == ETL_NULLPTR)
-          {
-            break;
-          }
+        // Destroy the node provided (its a duplicate)
+        destroy_data_node(node);
+      }
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Find the next node in sequence from the node provided
+    //*************************************************************************
+    void next_node(Node*& position) const
+    {
+      const Node* p_node = position;
+      set_base::next_node(p_node, tree_compare());
+      position = const_cast<Node*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Find the next node in sequence from the node provided
+    //*************************************************************************
+    void next_node(const Node*& position) const
+    {
+      set_base::next_node(position, tree_compare());
+    }
 
-          if (balance->weight == kNeither)
-          {
-            balance->weight = 1 - balance->dir;
-          }
-          else if (balance->weight == balance->dir)
-          {
-            balance->weight = kNeither;
-          }
-          else
-          {
-            int weight = balance->children[1 - balance->dir]->weight;
-            // Perform a 3 node rotation if weight is same as balance->dir
-            if (weight == balance->dir)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_3node(root_node, 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-              else
-              {
-                rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-            }
-            // Already balanced, rebalance and make it heavy in opposite
-            // direction of the node being removed
-            else if (weight == kNeither)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-                root_node->weight = balance->dir;
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-                balance_parent->children[balance_parent->dir]->weight = balance->dir;
-              }
-              // Update balance node weight in opposite direction of node removed
-              balance->weight = 1 - balance->dir;
-            }
-            // Rebalance and leave it balanced
-            else
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-              }
-            }
+    //*************************************************************************
+    /// Find the previous node in sequence from the node provided
+    //*************************************************************************
+    void prev_node(Node*& position) const
+    {
+      const Node* p_node = position;
+      set_base::prev_node(p_node, tree_compare());
+      position = const_cast<Node*>(p_node);
+    }
 
-            // Is balance node the same as the target node found? then update
-            // its parent after the rotation performed above
-            if (balance == found)
-            {
-              if (balance_parent)
-              {
-                found_parent = balance_parent->children[balance_parent->dir];
-                // Update dir since it is likely stale
-                found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
-              }
-              else
-              {
-                found_parent = root_node;
-                root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
-              }
-            }
-          }
+    //*************************************************************************
+    /// Find the previous node in sequence from the node provided
+    //*************************************************************************
+    void prev_node(const Node*& position) const
+    {
+      set_base::prev_node(position, tree_compare());
+    }
 
-          // Next balance node to consider
-          balance_parent = balance;
-          balance = balance->children[balance->dir];
-        } // while(balance)
+    //*************************************************************************
+    /// Remove the node specified from somewhere starting at the position
+    /// provided
+    //*************************************************************************
+    Node* remove_node(Node*& position, key_parameter_t key)
+    {
+      Node* found = set_base::remove_node(position, &key, tree_compare());
 
-          // Step 3: Swap found node with replacement node
-        if (found_parent)
-        {
-          // Handle traditional case
-          detach_node(found_parent->children[found_parent->dir],
-            replace_parent->children[replace_parent->dir]);
-        }
-        // Handle root node removal
-        else
-        {
-          // Valid replacement node for root node being removed?
-          if (replace_parent)
-          {
-            detach_node(root_node, replace_parent->children[replace_parent->dir]);
-          }
-          else
-          {
-            // Target node and replacement node are both root node
-            detach_node(root_node, root_node);
-          }
-        }
+      if (found)
+      {
+        destroy_data_node(iset::data_cast(*found));
+      }
 
-        // Downcast found into data node
-        Data_Node& found_data_node = iset::data_cast(*found);
+      return found;
+    }
 
-        // One less.
-        --current_size;
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    Node* remove_node(Node*& position, const K& key)
+    {
+      Node* found = set_base::remove_node(position, &key, key_node_compare<K>(compare));
 
-        // Destroy the node removed
-        destroy_data_node(found_data_node);
-      } // if(found)
+      if (found)
+      {
+        destroy_data_node(iset::data_cast(*found));
+      }
 
-        // Return node found (might be ETL_NULLPTR)
       return found;
     }
 #endif
@@ -2671,11 +2671,176 @@ namespace etl
 
     /// The pool of data nodes used for the set.
     etl::pool<typename etl::iset<TKey, TCompare>::Data_Node, MAX_SIZE> node_pool;
+
+    ETL_STATIC_ASSERT(etl::private_tree::node_link_in_range<sizeof(etl::pool<typename etl::iset<TKey, TCompare>::Data_Node, MAX_SIZE>)>::value, "Pool is too large for ETL_COMPACT_TREE_NODE_OFFSET_TYPE");
   };
 
   template <typename TKey, const size_t MAX_SIZE_, typename TCompare>
   ETL_CONSTANT size_t set<TKey, MAX_SIZE_, TCompare>::MAX_SIZE;
 
+  //*************************************************************************
+  /// A templated set implementation that uses a shared pool of nodes.
+  /// Create the pool as etl::pool<etl::set_ext<...>::pool_type, N>.
+  /// Many set_ext instances may share one pool, so that they do not each
+  /// have to reserve nodes for the worst case.
+  //*************************************************************************
+  template <typename TKey, typename TCompare = etl::less<TKey> >
+  class set_ext : public etl::iset<TKey, TCompare>
+  {
+  private:
+
+    typedef etl::iset<TKey, TCompare> base_t;
+
+  public:
+
+    typedef typename base_t::value_type value_type;
+    typedef typename base_t::Data_Node  pool_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    explicit set_ext(etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Implicit pool.
+    //*************************************************************************
+    set_ext(const set_ext& other)
+      : base_t(other.get_node_pool(), other.get_node_pool().max_size())
+    {
+      if (this != &other)
+      {
+        this->assign(other.cbegin(), other.cend());
+      }
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Explicit pool.
+    //*************************************************************************
+    set_ext(const set_ext& other, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      if (this != &other)
+      {
+        this->assign(other.cbegin(), other.cend());
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor. Implicit pool.
+    //*************************************************************************
+    set_ext(set_ext&& other)
+      : base_t(other.get_node_pool(), other.get_node_pool().max_size())
+    {
+      move_items(other);
+    }
+
+    //*************************************************************************
+    /// Move constructor. Explicit pool.
+    //*************************************************************************
+    set_ext(set_ext&& other, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      move_items(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    set_ext(TIterator first, TIterator last, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    set_ext(std::initializer_list<value_type> init, etl::ipool& node_pool)
+      : base_t(node_pool, node_pool.max_size())
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    /// Releases the nodes back to the shared pool.
+    //*************************************************************************
+    ~set_ext()
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    set_ext& operator = (const set_ext& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    set_ext& operator = (set_ext&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->clear();
+        move_items(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_pool() const
+    {
+      return this->get_node_pool();
+    }
+
+  private:
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the items from another set_ext.
+    /// The nodes of other are released, so that a shared pool is not drained.
+    //*************************************************************************
+    void move_items(set_ext& other)
+    {
+      typename base_t::iterator from = other.begin();
+
+      while (from != other.end())
+      {
+        this->insert(etl::move(*from));
+        from = other.erase(from);
+      }
+    }
+#endif
+  };
+
   //*************************************************************************
   /// Template deduction guides.
   //*************************************************************************
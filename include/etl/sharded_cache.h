@@ -0,0 +1,452 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SHARDED_CACHE_INCLUDED
+#define ETL_SHARDED_CACHE_INCLUDED
+
+#include "platform.h"
+#include "mutex.h"
+
+#if ETL_HAS_MUTEX
+
+#include "cache.h"
+#include "cache_aligned.h"
+#include "functional.h"
+#include "hash.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup sharded_cache sharded_cache
+/// A least recently used cache split into independently locked shards, so
+/// that threads working on different keys rarely contend.
+///\ingroup cache
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The counters kept by each shard of an etl::sharded_cache.
+  ///\ingroup sharded_cache
+  //***************************************************************************
+  struct sharded_cache_statistics
+  {
+    sharded_cache_statistics()
+      : hits(0U)
+      , misses(0U)
+      , evictions(0U)
+    {
+    }
+
+    uint32_t hits;      ///< Reads found in the cache.
+    uint32_t misses;    ///< Reads not found in the cache.
+    uint32_t evictions; ///< Values evicted to make room.
+  };
+
+  //***************************************************************************
+  /// A least recently used cache split into SHARDS_ shards, each an
+  /// etl::lru_cache behind its own mutex and on its own cache lines.
+  /// Keys are given to shards by their hash.
+  /// Values are copied out under the shard's lock, as a pointer into a shard
+  /// would not outlive it.
+  /// The store functions are called with a shard's lock held, and may be
+  /// called from several shards at once.
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The value type. Must be default constructible.
+  ///\tparam MAX_SIZE_ The total number of cached values. Must be a multiple of SHARDS_.
+  ///\tparam SHARDS_   The number of shards.
+  ///\tparam TMutex    The mutex type for each shard.
+  ///\ingroup sharded_cache
+  //***************************************************************************
+  template <typename TKey,
+            typename TValue,
+            const size_t MAX_SIZE_,
+            const size_t SHARDS_,
+            typename TMutex    = etl::mutex,
+            typename THash     = etl::hash<TKey>,
+            typename TKeyEqual = etl::equal_to<TKey> >
+  class sharded_cache
+  {
+  public:
+
+    ETL_STATIC_ASSERT((SHARDS_ > 0U), "etl::sharded_cache needs at least one shard");
+    ETL_STATIC_ASSERT((MAX_SIZE_ >= SHARDS_), "etl::sharded_cache needs at least one value per shard");
+    ETL_STATIC_ASSERT(((MAX_SIZE_ % SHARDS_) == 0U), "etl::sharded_cache size must be a multiple of the number of shards");
+
+    static ETL_CONSTANT size_t MAX_SIZE   = MAX_SIZE_;
+    static ETL_CONSTANT size_t SHARDS     = SHARDS_;
+    static ETL_CONSTANT size_t SHARD_SIZE = MAX_SIZE_ / SHARDS_;
+
+    typedef TKey                                                       key_type;
+    typedef TValue                                                     mapped_type;
+    typedef size_t                                                     size_type;
+    typedef etl::lru_cache<TKey, TValue, SHARD_SIZE, THash, TKeyEqual> cache_type;
+    typedef typename cache_type::key_value_type                        key_value_type;
+    typedef typename cache_type::read_function_type                    read_function_type;
+    typedef typename cache_type::write_function_type                   write_function_type;
+    typedef etl::sharded_cache_statistics                              statistics_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    sharded_cache()
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the function that reads from the store, for all shards.
+    /// Not thread safe; call before the cache is shared.
+    //*************************************************************************
+    void set_read_function(read_function_type reader)
+    {
+      for (size_t i = 0U; i < SHARDS; ++i)
+      {
+        shards[i]->cache.set_read_function(reader);
+      }
+    }
+
+    //*************************************************************************
+    /// Sets the function that writes to the store, for all shards.
+    /// Not thread safe; call before the cache is shared.
+    //*************************************************************************
+    void set_write_function(write_function_type writer)
+    {
+      for (size_t i = 0U; i < SHARDS; ++i)
+      {
+        shards[i]->cache.set_write_function(writer);
+      }
+    }
+
+    //*************************************************************************
+    /// Sets the 'write through' flag, for all shards.
+    /// Not thread safe; call before the cache is shared.
+    //*************************************************************************
+    void set_write_through(bool write_through)
+    {
+      for (size_t i = 0U; i < SHARDS; ++i)
+      {
+        shards[i]->cache.set_write_through(write_through);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets a copy of a value, reading from the store on a miss.
+    ///\return <b>true</b> if the cache or the store held the key.
+    //*************************************************************************
+    bool get(const TKey& key, TValue& value)
+    {
+      shard_t& shard = get_shard(key);
+
+      etl::lock_guard<TMutex> lock(shard.access);
+
+      return get_locked(shard, key, value);
+    }
+
+    //*************************************************************************
+    /// Gets copies of several values, taking each shard's lock at most once.
+    /// 'found', if not null, receives whether each key was found.
+    ///\return The number of keys found.
+    //*************************************************************************
+    size_t get_many(const TKey* keys, TValue* values, bool* found, size_t count)
+    {
+      size_t n_found = 0U;
+
+      for (size_t s = 0U; s < SHARDS; ++s)
+      {
+        shard_t& shard  = *shards[s];
+        bool     locked = false;
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          if (shard_index(keys[i]) == s)
+          {
+            if (!locked)
+            {
+              shard.access.lock();
+              locked = true;
+            }
+
+            const bool is_found = get_locked(shard, keys[i], values[i]);
+
+            if (found != ETL_NULLPTR)
+            {
+              found[i] = is_found;
+            }
+
+            n_found += is_found ? 1U : 0U;
+          }
+        }
+
+        if (locked)
+        {
+          shard.access.unlock();
+        }
+      }
+
+      return n_found;
+    }
+
+    //*************************************************************************
+    /// Writes a value, evicting another from its shard if the shard is full.
+    //*************************************************************************
+    void put(const TKey& key, const TValue& value)
+    {
+      shard_t& shard = get_shard(key);
+
+      etl::lock_guard<TMutex> lock(shard.access);
+
+      if (shard.cache.full() && !shard.cache.contains(key))
+      {
+        ++shard.statistics.evictions;
+      }
+
+      shard.cache.write(key, value);
+    }
+
+    //*************************************************************************
+    /// Checks if the cache holds the key.
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      const shard_t& shard = get_shard(key);
+
+      etl::lock_guard<TMutex> lock(shard.access);
+
+      return shard.cache.contains(key);
+    }
+
+    //*************************************************************************
+    /// Removes a key from the cache, writing it to the store if changed.
+    ///\return <b>true</b> if the cache held the key.
+    //*************************************************************************
+    bool erase(const TKey& key)
+    {
+      shard_t& shard = get_shard(key);
+
+      etl::lock_guard<TMutex> lock(shard.access);
+
+      return shard.cache.erase(key);
+    }
+
+    //*************************************************************************
+    /// Writes all changed values to the store.
+    //*************************************************************************
+    void flush()
+    {
+      for (size_t i = 0U; i < SHARDS; ++i)
+      {
+        etl::lock_guard<TMutex> lock(shards[i]->access);
+
+        shards[i]->cache.flush();
+      }
+    }
+
+    //*************************************************************************
+    /// Removes all keys, writing changed values to the store.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < SHARDS; ++i)
+      {
+        etl::lock_guard<TMutex> lock(shards[i]->access);
+
+        shards[i]->cache.clear();
+      }
+    }
+
+    //*************************************************************************
+    /// The number of cached values.
+    /// Shards are counted one at a time, so this is a snapshot under load.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_type n = 0U;
+
+      for (size_t i = 0U; i < SHARDS; ++i)
+      {
+        etl::lock_guard<TMutex> lock(shards[i]->access);
+
+        n += shards[i]->cache.size();
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The maximum number of cached values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets the shard that holds a key.
+    //*************************************************************************
+    size_t shard_index(const TKey& key) const
+    {
+      // Use the high bits of a mixed hash, as each shard's index uses the low bits.
+      const uint64_t mixed = uint64_t(hash_function(key)) * 0x9E3779B97F4A7C15ULL;
+      const uint32_t high  = static_cast<uint32_t>(mixed >> 32U);
+
+      return high % SHARDS;
+    }
+
+    //*************************************************************************
+    /// Gets a copy of a shard's counters.
+    //*************************************************************************
+    statistics_type statistics(size_t shard) const
+    {
+      etl::lock_guard<TMutex> lock(shards[shard]->access);
+
+      return shards[shard]->statistics;
+    }
+
+    //*************************************************************************
+    /// Gets the sum of the shards' counters.
+    //*************************************************************************
+    statistics_type statistics() const
+    {
+      statistics_type total;
+
+      for (size_t i = 0U; i < SHARDS; ++i)
+      {
+        const statistics_type s = statistics(i);
+
+        total.hits      += s.hits;
+        total.misses    += s.misses;
+        total.evictions += s.evictions;
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Resets all of the shards' counters.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      for (size_t i = 0U; i < SHARDS; ++i)
+      {
+        etl::lock_guard<TMutex> lock(shards[i]->access);
+
+        shards[i]->statistics = statistics_type();
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A cache, its lock and its counters.
+    //*************************************************************************
+    struct shard_t
+    {
+      mutable TMutex  access;
+      cache_type      cache;
+      statistics_type statistics;
+    };
+
+    //*************************************************************************
+    /// Each shard is on its own cache lines.
+    //*************************************************************************
+#if ETL_USING_CPP11 && !defined(ETL_COMPILER_ARM5)
+    typedef etl::cache_aligned<shard_t> shard_slot;
+#else
+    typedef etl::padded<shard_t> shard_slot;
+#endif
+
+    //*************************************************************************
+    shard_t& get_shard(const TKey& key)
+    {
+      return *shards[shard_index(key)];
+    }
+
+    //*************************************************************************
+    const shard_t& get_shard(const TKey& key) const
+    {
+      return *shards[shard_index(key)];
+    }
+
+    //*************************************************************************
+    /// Gets a value from a locked shard, counting the hit or miss.
+    //*************************************************************************
+    bool get_locked(shard_t& shard, const TKey& key, TValue& value)
+    {
+      const TValue* p_value = shard.cache.find(key);
+
+      if (p_value != ETL_NULLPTR)
+      {
+        ++shard.statistics.hits;
+        value = *p_value;
+        return true;
+      }
+
+      ++shard.statistics.misses;
+
+      const bool was_full = shard.cache.full();
+
+      p_value = shard.cache.read(key);
+
+      if (p_value == ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      if (was_full)
+      {
+        ++shard.statistics.evictions;
+      }
+
+      value = *p_value;
+      return true;
+    }
+
+    // Disable copy construction and assignment.
+    sharded_cache(const sharded_cache&);
+    sharded_cache& operator =(const sharded_cache&);
+
+    shard_slot shards[SHARDS_];
+    THash      hash_function;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t SHARDS_, typename TMutex, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t sharded_cache<TKey, TValue, MAX_SIZE_, SHARDS_, TMutex, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t SHARDS_, typename TMutex, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t sharded_cache<TKey, TValue, MAX_SIZE_, SHARDS_, TMutex, THash, TKeyEqual>::SHARDS;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t SHARDS_, typename TMutex, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t sharded_cache<TKey, TValue, MAX_SIZE_, SHARDS_, TMutex, THash, TKeyEqual>::SHARD_SIZE;
+}
+
+#endif
+#endif
@@ -0,0 +1,212 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SHARED_MUTEX_INCLUDED
+#define ETL_SHARED_MUTEX_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "spin_mutex.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+  #define ETL_HAS_SHARED_MUTEX 1
+#else
+  #define ETL_HAS_SHARED_MUTEX 0
+#endif
+
+#if ETL_HAS_SHARED_MUTEX
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A reader-writer spin lock, built on etl::atomic.
+  /// Any number of readers may hold the lock at once, or one writer.
+  /// A waiting writer stops new readers from entering, so that a stream of
+  /// readers cannot starve it. Waiters back off as etl::spin_mutex.
+  //***************************************************************************
+  class shared_mutex
+  {
+  public:
+
+    shared_mutex()
+      : state(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Locks for exclusive access.
+    //*************************************************************************
+    void lock()
+    {
+      private_spin_mutex::backoff backoff;
+
+      uint32_t expected = state.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        if ((expected & ~Writer_Waiting) == 0U)
+        {
+          // No readers and no writer.
+          if (state.compare_exchange_weak(expected, Writer, etl::memory_order_acquire))
+          {
+            return;
+          }
+        }
+        else
+        {
+          // Hold off new readers.
+          if ((expected & Writer_Waiting) == 0U)
+          {
+            state.fetch_or(Writer_Waiting, etl::memory_order_relaxed);
+          }
+
+          backoff.wait();
+          expected = state.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Tries to lock for exclusive access.
+    ///\return <b>true</b> if the lock was taken.
+    //*************************************************************************
+    bool try_lock()
+    {
+      uint32_t expected = state.load(etl::memory_order_relaxed) & Writer_Waiting;
+
+      return state.compare_exchange_weak(expected, Writer, etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Unlocks exclusive access.
+    //*************************************************************************
+    void unlock()
+    {
+      // Keeps any other writer's waiting flag.
+      state.fetch_and(~Writer, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Locks for shared access.
+    //*************************************************************************
+    void lock_shared()
+    {
+      private_spin_mutex::backoff backoff;
+
+      while (!try_lock_shared())
+      {
+        backoff.wait();
+      }
+    }
+
+    //*************************************************************************
+    /// Tries to lock for shared access.
+    /// Fails if a writer holds, or is waiting for, the lock.
+    ///\return <b>true</b> if the lock was taken.
+    //*************************************************************************
+    bool try_lock_shared()
+    {
+      uint32_t expected = state.load(etl::memory_order_relaxed);
+
+      while ((expected & (Writer | Writer_Waiting)) == 0U)
+      {
+        if (state.compare_exchange_weak(expected, expected + 1U, etl::memory_order_acquire))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Unlocks shared access.
+    //*************************************************************************
+    void unlock_shared()
+    {
+      state.fetch_sub(1U, etl::memory_order_release);
+    }
+
+  private:
+
+    static ETL_CONSTANT uint32_t Writer         = 0x80000000UL;
+    static ETL_CONSTANT uint32_t Writer_Waiting = 0x40000000UL;
+
+    shared_mutex(const shared_mutex&) ETL_DELETE;
+    shared_mutex& operator=(const shared_mutex&) ETL_DELETE;
+
+    /// The writer flags, and the number of readers in the low bits.
+    etl::atomic_uint32_t state;
+  };
+
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A shared_mutex wrapper that holds shared access for the duration of a
+  /// scoped block, as etl::lock_guard does for exclusive access.
+  //***************************************************************************
+  template <typename TMutex>
+  class shared_lock_guard
+  {
+  public:
+
+    typedef TMutex mutex_type;
+
+    //*****************************************************
+    /// Constructor
+    /// Locks the mutex for shared access.
+    //*****************************************************
+    explicit shared_lock_guard(mutex_type& m_)
+      : m(m_)
+    {
+      m.lock_shared();
+    }
+
+    //*****************************************************
+    /// Destructor
+    //*****************************************************
+    ~shared_lock_guard()
+    {
+      m.unlock_shared();
+    }
+
+  private:
+
+    // Deleted.
+    shared_lock_guard(const shared_lock_guard&) ETL_DELETE;
+
+    mutex_type& m;
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,861 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLOT_MAP_INCLUDED
+#define ETL_SLOT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "alignment.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "memory.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup slot_map slot_map
+/// A container that gives each value a 32 bit handle, made from a slot index
+/// and a generation count. Erasing a value changes the slot's generation, so
+/// old handles to it are detected as stale.
+/// Insertion, erasure and lookup are O(1). The values are stored densely,
+/// so iterating over them is a walk over contiguous memory.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_exception : public exception
+  {
+  public:
+
+    slot_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_full : public slot_map_exception
+  {
+  public:
+
+    slot_map_full(string_type file_name_, numeric_type line_number_)
+      : slot_map_exception(ETL_ERROR_TEXT("slot_map:full", ETL_SLOT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid handle exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_invalid_handle : public slot_map_exception
+  {
+  public:
+
+    slot_map_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : slot_map_exception(ETL_ERROR_TEXT("slot_map:invalid handle", ETL_SLOT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A handle to a value in a slot_map.
+  /// The low bits hold the slot index, the high bits the slot's generation.
+  /// A default constructed handle is never valid.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_handle
+  {
+  public:
+
+    typedef uint32_t value_type;
+
+    //*************************************************************************
+    /// Constructs a null handle.
+    //*************************************************************************
+    ETL_CONSTEXPR slot_map_handle()
+      : handle_value(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a raw value, such as one stored externally.
+    //*************************************************************************
+    ETL_CONSTEXPR explicit slot_map_handle(value_type handle_value_)
+      : handle_value(handle_value_)
+    {
+    }
+
+    //*************************************************************************
+    /// The raw value.
+    //*************************************************************************
+    ETL_CONSTEXPR value_type value() const
+    {
+      return handle_value;
+    }
+
+    //*************************************************************************
+    /// Is the handle not null?
+    /// This does not check that it refers to a value.
+    //*************************************************************************
+    ETL_CONSTEXPR bool is_null() const
+    {
+      return handle_value == 0U;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator ==(const slot_map_handle& lhs, const slot_map_handle& rhs)
+    {
+      return lhs.handle_value == rhs.handle_value;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator !=(const slot_map_handle& lhs, const slot_map_handle& rhs)
+    {
+      return lhs.handle_value != rhs.handle_value;
+    }
+
+  private:
+
+    value_type handle_value;
+  };
+
+  //***************************************************************************
+  /// The base class for all slot_maps of T.
+  ///\ingroup slot_map
+  //***************************************************************************
+  template <typename T>
+  class islot_map
+  {
+  public:
+
+    typedef T                     value_type;
+    typedef T&                    reference;
+    typedef const T&              const_reference;
+#if ETL_USING_CPP11
+    typedef T&&                   rvalue_reference;
+#endif
+    typedef T*                    pointer;
+    typedef const T*              const_pointer;
+    typedef T*                    iterator;
+    typedef const T*              const_iterator;
+    typedef size_t                size_type;
+    typedef etl::slot_map_handle  handle_type;
+
+  protected:
+
+    //*************************************************************************
+    /// A slot holds the index of its value, or of the next free slot.
+    //*************************************************************************
+    struct slot_t
+    {
+      uint32_t generation;
+      uint32_t index;
+    };
+
+  public:
+
+    //*************************************************************************
+    /// Inserts a copy of a value.
+    /// If asserts or exceptions are enabled, emits etl::slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle of the value, or a null handle if the slot_map is full.
+    //*************************************************************************
+    handle_type insert(const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), handle_type());
+
+      ::new (p_values + current_size) T(value);
+
+      return link_new_value();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value.
+    /// If asserts or exceptions are enabled, emits etl::slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle of the value, or a null handle if the slot_map is full.
+    //*************************************************************************
+    handle_type insert(rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), handle_type());
+
+      ::new (p_values + current_size) T(etl::move(value));
+
+      return link_new_value();
+    }
+
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits etl::slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle of the value, or a null handle if the slot_map is full.
+    //*************************************************************************
+    template <typename... Args>
+    handle_type emplace(Args&&... args)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), handle_type());
+
+      ::new (p_values + current_size) T(etl::forward<Args>(args)...);
+
+      return link_new_value();
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits etl::slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle of the value, or a null handle if the slot_map is full.
+    //*************************************************************************
+    handle_type emplace()
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), handle_type());
+
+      ::new (p_values + current_size) T();
+
+      return link_new_value();
+    }
+
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits etl::slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle of the value, or a null handle if the slot_map is full.
+    //*************************************************************************
+    template <typename T1>
+    handle_type emplace(const T1& value1)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), handle_type());
+
+      ::new (p_values + current_size) T(value1);
+
+      return link_new_value();
+    }
+
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits etl::slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle of the value, or a null handle if the slot_map is full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    handle_type emplace(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), handle_type());
+
+      ::new (p_values + current_size) T(value1, value2);
+
+      return link_new_value();
+    }
+
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits etl::slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle of the value, or a null handle if the slot_map is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    handle_type emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), handle_type());
+
+      ::new (p_values + current_size) T(value1, value2, value3);
+
+      return link_new_value();
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the value for a handle.
+    /// The last value is moved into its place, so iteration order changes.
+    ///\return <b>true</b> if the handle was valid.
+    //*************************************************************************
+    bool erase(handle_type handle)
+    {
+      if (!contains(handle))
+      {
+        return false;
+      }
+
+      erase_at(p_slots[slot_index(handle)].index);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases the value at 'position'.
+    /// The last value is moved into its place, so iteration order changes.
+    ///\return An iterator to the value that is now at 'position'.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      const size_type index = static_cast<size_type>(position - p_values);
+
+      erase_at(index);
+
+      return p_values + index;
+    }
+
+    //*************************************************************************
+    /// Erases all of the values.
+    /// All existing handles become stale.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_type i = 0U; i < current_size; ++i)
+      {
+        slot_t& slot = p_slots[p_dense_to_slot[i]];
+        slot.generation = next_generation(slot.generation);
+      }
+
+      etl::destroy(p_values, p_values + current_size);
+      current_size = 0U;
+
+      link_free_slots();
+    }
+
+    //*************************************************************************
+    /// Checks if a handle refers to a value.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      const size_type index = slot_index(handle);
+
+      if ((index >= CAPACITY) || (p_slots[index].generation != slot_generation(handle)))
+      {
+        return false;
+      }
+
+      // The slot's generation may match a handle that was never issued, so check it is occupied.
+      const size_type dense_index = p_slots[index].index;
+
+      return (dense_index < current_size) && (p_dense_to_slot[dense_index] == index);
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the value for a handle.
+    ///\return A pointer to the value, or a null pointer if the handle is stale.
+    //*************************************************************************
+    pointer find(handle_type handle)
+    {
+      return contains(handle) ? p_values + p_slots[slot_index(handle)].index : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the value for a handle.
+    ///\return A pointer to the value, or a null pointer if the handle is stale.
+    //*************************************************************************
+    const_pointer find(handle_type handle) const
+    {
+      return contains(handle) ? p_values + p_slots[slot_index(handle)].index : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the value for a handle.
+    /// If asserts or exceptions are enabled, emits etl::slot_map_invalid_handle
+    /// if the handle is stale.
+    //*************************************************************************
+    reference at(handle_type handle)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(slot_map_invalid_handle));
+
+      return p_values[p_slots[slot_index(handle)].index];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the value for a handle.
+    /// If asserts or exceptions are enabled, emits etl::slot_map_invalid_handle
+    /// if the handle is stale.
+    //*************************************************************************
+    const_reference at(handle_type handle) const
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(slot_map_invalid_handle));
+
+      return p_values[p_slots[slot_index(handle)].index];
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the value for a handle.
+    /// The handle must be valid.
+    //*************************************************************************
+    reference operator [](handle_type handle)
+    {
+      return at(handle);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the value for a handle.
+    /// The handle must be valid.
+    //*************************************************************************
+    const_reference operator [](handle_type handle) const
+    {
+      return at(handle);
+    }
+
+    //*************************************************************************
+    /// Gets the handle for the value at 'position'.
+    //*************************************************************************
+    handle_type get_handle(const_iterator position) const
+    {
+      const uint32_t index = p_dense_to_slot[position - p_values];
+
+      return make_handle(index, p_slots[index].generation);
+    }
+
+    //*************************************************************************
+    /// Gets an iterator to the first value.
+    //*************************************************************************
+    iterator begin()
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the first value.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the first value.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// Gets an iterator to one past the last value.
+    //*************************************************************************
+    iterator end()
+    {
+      return p_values + current_size;
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to one past the last value.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_values + current_size;
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to one past the last value.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return p_values + current_size;
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the densely stored values.
+    //*************************************************************************
+    pointer data()
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// Gets a const pointer to the densely stored values.
+    //*************************************************************************
+    const_pointer data() const
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// Gets the number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of values.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Gets the number of values that may still be inserted.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the slot_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the slot_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    islot_map(T* p_values_, uint32_t* p_dense_to_slot_, slot_t* p_slots_, size_type capacity_)
+      : p_values(p_values_)
+      , p_dense_to_slot(p_dense_to_slot_)
+      , p_slots(p_slots_)
+      , current_size(0U)
+      , free_head(0U)
+      , CAPACITY(capacity_)
+      , Index_Bits(index_bits(capacity_))
+    {
+      for (size_type i = 0U; i < CAPACITY; ++i)
+      {
+        p_slots[i].generation = 1U;
+      }
+
+      link_free_slots();
+    }
+
+    //*************************************************************************
+    /// Copies the values and slots of another slot_map of the same capacity,
+    /// so that its handles are valid for this one.
+    //*************************************************************************
+    void copy_from(const islot_map& other)
+    {
+      etl::destroy(p_values, p_values + current_size);
+      current_size = 0U;
+
+      for (size_type i = 0U; i < other.current_size; ++i)
+      {
+        ::new (p_values + i) T(other.p_values[i]);
+        ++current_size;
+      }
+
+      copy_slots_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the values and slots of another slot_map of the same capacity,
+    /// so that its handles are valid for this one. The other is cleared.
+    //*************************************************************************
+    void move_from(islot_map& other)
+    {
+      etl::destroy(p_values, p_values + current_size);
+      current_size = 0U;
+
+      for (size_type i = 0U; i < other.current_size; ++i)
+      {
+        ::new (p_values + i) T(etl::move(other.p_values[i]));
+        ++current_size;
+      }
+
+      copy_slots_from(other);
+
+      other.clear();
+    }
+#endif
+
+#if defined(ETL_POLYMORPHIC_SLOT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~islot_map()
+    {
+    }
+#else
+  protected:
+    ~islot_map()
+    {
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// The number of bits needed for the slot index.
+    //*************************************************************************
+    static uint32_t index_bits(size_type capacity_)
+    {
+      uint32_t bits = 1U;
+
+      while ((size_type(1U) << bits) < capacity_)
+      {
+        ++bits;
+      }
+
+      return bits;
+    }
+
+    //*************************************************************************
+    /// Gets the slot index from a handle.
+    //*************************************************************************
+    size_type slot_index(handle_type handle) const
+    {
+      return handle.value() & ((uint32_t(1U) << Index_Bits) - 1U);
+    }
+
+    //*************************************************************************
+    /// Gets the generation from a handle.
+    //*************************************************************************
+    uint32_t slot_generation(handle_type handle) const
+    {
+      return handle.value() >> Index_Bits;
+    }
+
+    //*************************************************************************
+    /// Makes a handle from a slot index and generation.
+    //*************************************************************************
+    handle_type make_handle(uint32_t index, uint32_t generation) const
+    {
+      return handle_type((generation << Index_Bits) | index);
+    }
+
+    //*************************************************************************
+    /// The generation after 'generation'. Wraps around, skipping zero.
+    //*************************************************************************
+    uint32_t next_generation(uint32_t generation) const
+    {
+      const uint32_t mask = uint32_t(0xFFFFFFFFUL) >> Index_Bits;
+
+      generation = (generation + 1U) & mask;
+
+      return (generation == 0U) ? 1U : generation;
+    }
+
+    //*************************************************************************
+    /// Links all of the slots into the free list.
+    //*************************************************************************
+    void link_free_slots()
+    {
+      for (size_type i = 0U; i < CAPACITY; ++i)
+      {
+        p_slots[i].index = static_cast<uint32_t>(i + 1U);
+      }
+
+      free_head = 0U;
+    }
+
+    //*************************************************************************
+    /// Takes a free slot for the value just constructed at the end.
+    //*************************************************************************
+    handle_type link_new_value()
+    {
+      const uint32_t index = static_cast<uint32_t>(free_head);
+      slot_t&        slot  = p_slots[index];
+
+      free_head = slot.index;
+
+      slot.index                    = static_cast<uint32_t>(current_size);
+      p_dense_to_slot[current_size] = index;
+      ++current_size;
+
+      return make_handle(index, slot.generation);
+    }
+
+    //*************************************************************************
+    /// Erases the value at a dense index, moving the last value into its place.
+    //*************************************************************************
+    void erase_at(size_type dense_index)
+    {
+      const uint32_t index = p_dense_to_slot[dense_index];
+      const size_type last  = current_size - 1U;
+
+      if (dense_index != last)
+      {
+        p_values[dense_index] = ETL_MOVE(p_values[last]);
+
+        const uint32_t moved_index = p_dense_to_slot[last];
+        p_slots[moved_index].index   = static_cast<uint32_t>(dense_index);
+        p_dense_to_slot[dense_index] = moved_index;
+      }
+
+      p_values[last].~T();
+      --current_size;
+
+      slot_t& slot = p_slots[index];
+      slot.generation = next_generation(slot.generation);
+      slot.index      = static_cast<uint32_t>(free_head);
+      free_head       = index;
+    }
+
+    //*************************************************************************
+    /// Copies the slots and free list of another slot_map.
+    //*************************************************************************
+    void copy_slots_from(const islot_map& other)
+    {
+      etl::copy(other.p_slots, other.p_slots + CAPACITY, p_slots);
+      etl::copy(other.p_dense_to_slot, other.p_dense_to_slot + other.current_size, p_dense_to_slot);
+      free_head = other.free_head;
+    }
+
+    // Disable copy construction.
+    islot_map(const islot_map&);
+
+    T*              p_values;        ///< The densely stored values.
+    uint32_t*       p_dense_to_slot; ///< The slot index for each value.
+    slot_t*         p_slots;         ///< The slots, indexed by handle.
+    size_type       current_size;    ///< The number of values.
+    size_type       free_head;       ///< The first free slot.
+    const size_type CAPACITY;        ///< The maximum number of values.
+    const uint32_t  Index_Bits;      ///< The number of handle bits for the slot index.
+  };
+
+  //***************************************************************************
+  /// A slot_map with the capacity defined at compile time.
+  ///\tparam T         The value type.
+  ///\tparam MAX_SIZE_ The maximum number of values.
+  ///\ingroup slot_map
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_>
+  class slot_map : public etl::islot_map<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity etl::slot_map is not valid");
+    ETL_STATIC_ASSERT((MAX_SIZE_ <= (1UL << 24U)), "etl::slot_map needs at least 8 bits of the handle for the generation");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    slot_map()
+      : etl::islot_map<T>(reinterpret_cast<T*>(&buffer), dense_to_slot, slots, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// The handles of 'other' are valid for the copy.
+    //*************************************************************************
+    slot_map(const slot_map& other)
+      : etl::islot_map<T>(reinterpret_cast<T*>(&buffer), dense_to_slot, slots, MAX_SIZE)
+    {
+      this->copy_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    /// The handles of 'other' are valid for the new slot_map.
+    //*************************************************************************
+    slot_map(slot_map&& other)
+      : etl::islot_map<T>(reinterpret_cast<T*>(&buffer), dense_to_slot, slots, MAX_SIZE)
+    {
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~slot_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    slot_map& operator =(const slot_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    slot_map& operator =(slot_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    typedef typename etl::islot_map<T>::slot_t slot_t;
+
+    typename etl::aligned_storage<sizeof(T) * MAX_SIZE_, etl::alignment_of<T>::value>::type buffer;
+    uint32_t dense_to_slot[MAX_SIZE_];
+    slot_t   slots[MAX_SIZE_];
+  };
+
+  template <typename T, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t slot_map<T, MAX_SIZE_>::MAX_SIZE;
+}
+
+#endif
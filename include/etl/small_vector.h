@@ -0,0 +1,1210 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SMALL_VECTOR_INCLUDED
+#define ETL_SMALL_VECTOR_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "imemory_block_allocator.h"
+#include "initializer_list.h"
+#include "iterator.h"
+#include "memory.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup small_vector small_vector
+/// A vector that stores up to a compile time number of elements within the
+/// object, and moves to a block from a memory block allocator when it grows
+/// beyond that. A typical size stays local and no instance has to be sized
+/// for the worst case.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup small_vector
+  /// Exception base for small_vector
+  //***************************************************************************
+  class small_vector_exception : public etl::exception
+  {
+  public:
+
+    small_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup small_vector
+  /// Full exception.
+  /// The inline storage is full and a larger block could not be allocated.
+  //***************************************************************************
+  class small_vector_full : public small_vector_exception
+  {
+  public:
+
+    small_vector_full(string_type file_name_, numeric_type line_number_)
+      : small_vector_exception(ETL_ERROR_TEXT("small_vector:full", ETL_SMALL_VECTOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup small_vector
+  /// Out of bounds exception.
+  //***************************************************************************
+  class small_vector_out_of_bounds : public small_vector_exception
+  {
+  public:
+
+    small_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : small_vector_exception(ETL_ERROR_TEXT("small_vector:bounds", ETL_SMALL_VECTOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup small_vector
+  /// Empty exception.
+  //***************************************************************************
+  class small_vector_empty : public small_vector_exception
+  {
+  public:
+
+    small_vector_empty(string_type file_name_, numeric_type line_number_)
+      : small_vector_exception(ETL_ERROR_TEXT("small_vector:empty", ETL_SMALL_VECTOR_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized small_vectors.
+  /// Can be used as a reference type for all small_vectors containing a specific type.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  class ismall_vector
+  {
+  public:
+
+    typedef T                                     value_type;
+    typedef T&                                    reference;
+    typedef const T&                              const_reference;
+#if ETL_USING_CPP11
+    typedef T&&                                   rvalue_reference;
+#endif
+    typedef T*                                    pointer;
+    typedef const T*                              const_pointer;
+    typedef T*                                    iterator;
+    typedef const T*                              const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef size_t                                size_type;
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the vector.
+    //*********************************************************************
+    iterator begin()
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the vector.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the vector.
+    //*********************************************************************
+    iterator end()
+    {
+      return p_buffer + current_size;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the vector.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return p_buffer + current_size;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the vector.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the vector.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return p_buffer + current_size;
+    }
+
+    //*********************************************************************
+    /// Returns an reverse iterator to the reverse beginning of the vector.
+    //*********************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the vector.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a reverse iterator to the end + 1 of the vector.
+    //*********************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the vector.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the vector.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the vector.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'i'
+    ///\param i The index.
+    ///\return A reference to the value at index 'i'
+    //*********************************************************************
+    reference operator [](size_t i)
+    {
+      return p_buffer[i];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'i'
+    ///\param i The index.
+    ///\return A const reference to the value at index 'i'
+    //*********************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return p_buffer[i];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'i'
+    /// If asserts or exceptions are enabled, emits an etl::small_vector_out_of_bounds if the index is out of range.
+    ///\param i The index.
+    ///\return A reference to the value at index 'i'
+    //*********************************************************************
+    reference at(size_t i)
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(small_vector_out_of_bounds));
+      return p_buffer[i];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'i'
+    /// If asserts or exceptions are enabled, emits an etl::small_vector_out_of_bounds if the index is out of range.
+    ///\param i The index.
+    ///\return A const reference to the value at index 'i'
+    //*********************************************************************
+    const_reference at(size_t i) const
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(small_vector_out_of_bounds));
+      return p_buffer[i];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the first element.
+    //*********************************************************************
+    reference front()
+    {
+      return p_buffer[0];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the first element.
+    //*********************************************************************
+    const_reference front() const
+    {
+      return p_buffer[0];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the last element.
+    //*********************************************************************
+    reference back()
+    {
+      return p_buffer[current_size - 1U];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the last element.
+    //*********************************************************************
+    const_reference back() const
+    {
+      return p_buffer[current_size - 1U];
+    }
+
+    //*********************************************************************
+    /// Returns a pointer to the beginning of the vector data.
+    //*********************************************************************
+    pointer data()
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const pointer to the beginning of the vector data.
+    //*********************************************************************
+    const_pointer data() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns the number of elements.
+    //*********************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*********************************************************************
+    /// Checks the 'empty' state of the vector.
+    //*********************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*********************************************************************
+    /// Returns the number of elements that can be held before the next allocation.
+    //*********************************************************************
+    size_type capacity() const
+    {
+      return current_capacity;
+    }
+
+    //*********************************************************************
+    /// Returns the number of elements that can be held within the object.
+    //*********************************************************************
+    size_type inline_capacity() const
+    {
+      return INLINE_CAPACITY;
+    }
+
+    //*********************************************************************
+    /// Returns <b>true</b> if the elements are held within the object.
+    //*********************************************************************
+    bool is_inline() const
+    {
+      return p_buffer == p_inline;
+    }
+
+    //*********************************************************************
+    /// Sets the allocator that larger blocks are obtained from.
+    /// May only be changed while the elements are inline.
+    //*********************************************************************
+    void set_allocator(etl::imemory_block_allocator& allocator)
+    {
+      ETL_ASSERT_OR_RETURN(is_inline(), ETL_ERROR(small_vector_full));
+
+      p_allocator = &allocator;
+    }
+
+    //*********************************************************************
+    /// Gets the allocator that larger blocks are obtained from.
+    /// Returns ETL_NULLPTR if there is none.
+    //*********************************************************************
+    etl::imemory_block_allocator* get_allocator() const
+    {
+      return p_allocator;
+    }
+
+    //*********************************************************************
+    /// Ensures that the capacity is at least n.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    //*********************************************************************
+    void reserve(size_t n)
+    {
+      if (n > current_capacity)
+      {
+        reallocate(n);
+      }
+    }
+
+    //*********************************************************************
+    /// Moves the elements back inline if they fit, or releases the unused
+    /// part of the block by moving to a block of exactly the right size.
+    //*********************************************************************
+    void shrink_to_fit()
+    {
+      if (!is_inline() && (current_size < current_capacity))
+      {
+        if (current_size <= INLINE_CAPACITY)
+        {
+          relocate(p_inline, INLINE_CAPACITY);
+        }
+        else
+        {
+          void* p = p_allocator->allocate(current_size * sizeof(T), etl::alignment_of<T>::value);
+
+          if (p != ETL_NULLPTR)
+          {
+            relocate(static_cast<T*>(p), current_size);
+          }
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Resizes the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    ///\param new_size The new size.
+    //*********************************************************************
+    void resize(size_t new_size)
+    {
+      resize(new_size, T());
+    }
+
+    //*********************************************************************
+    /// Resizes the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    ///\param new_size The new size.
+    ///\param value    The value to fill new elements with.
+    //*********************************************************************
+    void resize(size_t new_size, const_reference value)
+    {
+      if (new_size > current_size)
+      {
+        if (!grow(new_size))
+        {
+          return;
+        }
+
+        etl::uninitialized_fill(end(), p_buffer + new_size, value);
+      }
+      else
+      {
+        etl::destroy(p_buffer + new_size, end());
+      }
+
+      current_size = new_size;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<!etl::is_integral<TIterator>::value, void>::type
+      assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      const size_t n = static_cast<size_t>(etl::distance(first, last));
+
+      if (!grow(n))
+      {
+        return;
+      }
+
+      etl::uninitialized_copy(first, last, p_buffer);
+      current_size = n;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    ///\param n     The number of elements to add.
+    ///\param value The value to insert for each element.
+    //*********************************************************************
+    void assign(size_t n, const_reference value)
+    {
+      clear();
+      resize(n, value);
+    }
+
+    //*********************************************************************
+    /// Clears the vector.
+    /// The capacity is not changed.
+    //*********************************************************************
+    void clear()
+    {
+      etl::destroy(begin(), end());
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Inserts a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back(const_reference value)
+    {
+      if (current_size == current_capacity)
+      {
+        // The value may be an element of this vector.
+        T temp(value);
+
+        if (grow(current_size + 1U))
+        {
+          create_back(ETL_MOVE(temp));
+        }
+      }
+      else
+      {
+        create_back(value);
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves a value to the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back(rvalue_reference value)
+    {
+      if (current_size == current_capacity)
+      {
+        // The value may be an element of this vector.
+        T temp(etl::move(value));
+
+        if (grow(current_size + 1U))
+        {
+          create_back(etl::move(temp));
+        }
+      }
+      else
+      {
+        create_back(etl::move(value));
+      }
+    }
+
+    //*********************************************************************
+    /// Constructs a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    //*********************************************************************
+    template <typename ... Args>
+    reference emplace_back(Args && ... args)
+    {
+      if (current_size == current_capacity)
+      {
+        // The arguments may refer to elements of this vector.
+        T temp(etl::forward<Args>(args)...);
+
+        if (grow(current_size + 1U))
+        {
+          create_back(etl::move(temp));
+        }
+      }
+      else
+      {
+        ::new (end()) T(etl::forward<Args>(args)...);
+        ++current_size;
+      }
+
+      return back();
+    }
+#else
+    //*********************************************************************
+    /// Constructs a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    //*********************************************************************
+    reference emplace_back()
+    {
+      if (current_size == current_capacity)
+      {
+        // The arguments may refer to elements of this vector.
+        T temp = T();
+
+        if (grow(current_size + 1U))
+        {
+          create_back(temp);
+        }
+      }
+      else
+      {
+        ::new (end()) T();
+        ++current_size;
+      }
+
+      return back();
+    }
+
+    //*********************************************************************
+    /// Constructs a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    //*********************************************************************
+    template <typename T1>
+    reference emplace_back(const T1& value1)
+    {
+      if (current_size == current_capacity)
+      {
+        // The arguments may refer to elements of this vector.
+        T temp(value1);
+
+        if (grow(current_size + 1U))
+        {
+          create_back(temp);
+        }
+      }
+      else
+      {
+        ::new (end()) T(value1);
+        ++current_size;
+      }
+
+      return back();
+    }
+
+    //*********************************************************************
+    /// Constructs a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    //*********************************************************************
+    template <typename T1, typename T2>
+    reference emplace_back(const T1& value1, const T2& value2)
+    {
+      if (current_size == current_capacity)
+      {
+        // The arguments may refer to elements of this vector.
+        T temp(value1, value2);
+
+        if (grow(current_size + 1U))
+        {
+          create_back(temp);
+        }
+      }
+      else
+      {
+        ::new (end()) T(value1, value2);
+        ++current_size;
+      }
+
+      return back();
+    }
+
+    //*********************************************************************
+    /// Constructs a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3>
+    reference emplace_back(const T1& value1, const T2& value2, const T3& value3)
+    {
+      if (current_size == current_capacity)
+      {
+        // The arguments may refer to elements of this vector.
+        T temp(value1, value2, value3);
+
+        if (grow(current_size + 1U))
+        {
+          create_back(temp);
+        }
+      }
+      else
+      {
+        ::new (end()) T(value1, value2, value3);
+        ++current_size;
+      }
+
+      return back();
+    }
+#endif
+
+    //*********************************************************************
+    /// Removes an element from the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_empty if the vector is empty.
+    //*********************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT_OR_RETURN(current_size != 0U, ETL_ERROR(small_vector_empty));
+
+      --current_size;
+      etl::destroy_at(end());
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    ///\param position The position to insert before.
+    ///\param value    The value to insert.
+    ///\return An iterator to the inserted value.
+    //*********************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      const size_t index = static_cast<size_t>(position - cbegin());
+
+      // The value may be an element of this vector.
+      T temp(value);
+
+      if (grow(current_size + 1U))
+      {
+        if (index == current_size)
+        {
+          create_back(ETL_MOVE(temp));
+        }
+        else
+        {
+          open_gap(index);
+          p_buffer[index] = ETL_MOVE(temp);
+        }
+      }
+
+      return begin() + index;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves a value to the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if a block could not be allocated.
+    ///\param position The position to insert before.
+    ///\param value    The value to insert.
+    ///\return An iterator to the inserted value.
+    //*********************************************************************
+    iterator insert(const_iterator position, rvalue_reference value)
+    {
+      const size_t index = static_cast<size_t>(position - cbegin());
+
+      // The value may be an element of this vector.
+      T temp(etl::move(value));
+
+      if (grow(current_size + 1U))
+      {
+        if (index == current_size)
+        {
+          create_back(ETL_MOVE(temp));
+        }
+        else
+        {
+          open_gap(index);
+          p_buffer[index] = ETL_MOVE(temp);
+        }
+      }
+
+      return begin() + index;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param position Iterator to the element.
+    ///\return An iterator pointing to the element that followed the erased element.
+    //*********************************************************************
+    iterator erase(const_iterator position)
+    {
+      return erase(position, position + 1);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element + 1.
+    ///\return An iterator pointing to the element that followed the erased elements.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      iterator i_first = to_iterator(first);
+      iterator i_last  = to_iterator(last);
+
+      if (i_first != i_last)
+      {
+        iterator i_new_end = etl::move(i_last, end(), i_first);
+        etl::destroy(i_new_end, end());
+        current_size -= static_cast<size_t>(i_last - i_first);
+      }
+
+      return i_first;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// The allocator is not changed.
+    //*************************************************************************
+    ismall_vector& operator = (const ismall_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    /// The allocator is not changed.
+    //*************************************************************************
+    ismall_vector& operator = (ismall_vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    ismall_vector(T* p_inline_, size_t inline_capacity_, etl::imemory_block_allocator* p_allocator_)
+      : p_buffer(p_inline_)
+      , p_inline(p_inline_)
+      , current_size(0U)
+      , current_capacity(inline_capacity_)
+      , INLINE_CAPACITY(inline_capacity_)
+      , p_allocator(p_allocator_)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Takes the elements of another vector.
+    /// The block is taken over if both use the same allocator.
+    //*********************************************************************
+    void move_container(ismall_vector&& other)
+    {
+      clear();
+
+      if (!other.is_inline() && (other.p_allocator == p_allocator))
+      {
+        release_block();
+
+        p_buffer         = other.p_buffer;
+        current_size     = other.current_size;
+        current_capacity = other.current_capacity;
+
+        other.p_buffer         = other.p_inline;
+        other.current_size     = 0U;
+        other.current_capacity = other.INLINE_CAPACITY;
+      }
+      else
+      {
+        if (grow(other.current_size))
+        {
+          etl::uninitialized_move(other.begin(), other.end(), p_buffer);
+          current_size = other.current_size;
+        }
+
+        other.clear();
+      }
+    }
+#endif
+
+    //*********************************************************************
+    /// Destroys the elements and releases any allocated block.
+    //*********************************************************************
+    void release()
+    {
+      clear();
+      release_block();
+      p_buffer         = p_inline;
+      current_capacity = INLINE_CAPACITY;
+    }
+
+  private:
+
+    //*********************************************************************
+    /// Ensures that there is room for n elements.
+    /// Doubles the capacity, or grows to n, whichever is larger.
+    //*********************************************************************
+    bool grow(size_t n)
+    {
+      if (n <= current_capacity)
+      {
+        return true;
+      }
+
+      const size_t doubled = current_capacity * 2U;
+
+      return reallocate((doubled > n) ? doubled : n, n);
+    }
+
+    //*********************************************************************
+    /// Moves the elements to a new block with room for n elements.
+    //*********************************************************************
+    bool reallocate(size_t n)
+    {
+      return reallocate(n, n);
+    }
+
+    //*********************************************************************
+    /// Moves the elements to a new block with room for 'preferred' elements,
+    /// or 'minimum' if that could not be allocated.
+    //*********************************************************************
+    bool reallocate(size_t preferred, size_t minimum)
+    {
+      void* p = ETL_NULLPTR;
+
+      if (p_allocator != ETL_NULLPTR)
+      {
+        p = p_allocator->allocate(preferred * sizeof(T), etl::alignment_of<T>::value);
+
+        if ((p == ETL_NULLPTR) && (minimum < preferred))
+        {
+          preferred = minimum;
+          p = p_allocator->allocate(preferred * sizeof(T), etl::alignment_of<T>::value);
+        }
+      }
+
+      ETL_ASSERT(p != ETL_NULLPTR, ETL_ERROR(small_vector_full));
+
+      if (p == ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      relocate(static_cast<T*>(p), preferred);
+
+      return true;
+    }
+
+    //*********************************************************************
+    /// Moves the elements to the new storage and releases the old block.
+    //*********************************************************************
+    void relocate(T* p_new_buffer, size_t new_capacity)
+    {
+      etl::uninitialized_move(begin(), end(), p_new_buffer);
+      etl::destroy(begin(), end());
+
+      release_block();
+
+      p_buffer         = p_new_buffer;
+      current_capacity = new_capacity;
+    }
+
+    //*********************************************************************
+    /// Releases the current block, if it is not the inline storage.
+    //*********************************************************************
+    void release_block()
+    {
+      if (!is_inline())
+      {
+        p_allocator->release(p_buffer);
+      }
+    }
+
+    //*********************************************************************
+    /// Constructs a new element at the end.
+    //*********************************************************************
+    void create_back(const_reference value)
+    {
+      ::new (end()) T(value);
+      ++current_size;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Constructs a new element at the end.
+    //*********************************************************************
+    void create_back(rvalue_reference value)
+    {
+      ::new (end()) T(etl::move(value));
+      ++current_size;
+    }
+#endif
+
+    //*********************************************************************
+    /// Opens a gap at index by moving the following elements up by one.
+    /// There must be room for one more element, and index must not be the end.
+    //*********************************************************************
+    void open_gap(size_t index)
+    {
+      iterator i_end = end();
+      etl::uninitialized_move(i_end - 1, i_end, i_end);
+      etl::move_backward(begin() + index, i_end - 1, i_end);
+
+      ++current_size;
+    }
+
+    //*********************************************************************
+    /// Converts a const_iterator to an iterator.
+    //*********************************************************************
+    iterator to_iterator(const_iterator itr)
+    {
+      return begin() + (itr - cbegin());
+    }
+
+    // Disable copy construction.
+    ismall_vector(const ismall_vector&);
+
+    T*                            p_buffer;
+    T* const                      p_inline;
+    size_type                     current_size;
+    size_type                     current_capacity;
+    const size_type               INLINE_CAPACITY;
+    etl::imemory_block_allocator* p_allocator;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SMALL_VECTOR) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ismall_vector()
+    {
+    }
+#else
+  protected:
+    ~ismall_vector()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator ==(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator !=(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator <(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //***************************************************************************
+  /// Greater than operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator >(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //***************************************************************************
+  /// Less than or equal operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator <=(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //***************************************************************************
+  /// Greater than or equal operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator >=(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+
+  //***************************************************************************
+  /// A vector that holds up to Inline_Size elements within the object, and
+  /// moves to blocks from an etl::imemory_block_allocator when it grows.
+  /// Without an allocator it is limited to Inline_Size elements.
+  ///\tparam T           The element type.
+  ///\tparam Inline_Size The number of elements held within the object.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T, size_t Inline_Size>
+  class small_vector : public etl::ismall_vector<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Inline_Size > 0U, "Inline_Size must be greater than zero");
+
+    static ETL_CONSTANT size_t INLINE_SIZE = Inline_Size;
+
+    //*************************************************************************
+    /// Constructor, without an allocator.
+    //*************************************************************************
+    small_vector()
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Inline_Size, ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param allocator The allocator to obtain larger blocks from.
+    //*************************************************************************
+    explicit small_vector(etl::imemory_block_allocator& allocator)
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Inline_Size, &allocator)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\param first     The iterator to the first element.
+    ///\param last      The iterator to the last element + 1.
+    ///\param allocator The allocator to obtain larger blocks from.
+    //*************************************************************************
+    template <typename TIterator>
+    small_vector(TIterator first, TIterator last, etl::imemory_block_allocator& allocator)
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Inline_Size, &allocator)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    ///\param init      The initial values.
+    ///\param allocator The allocator to obtain larger blocks from.
+    //*************************************************************************
+    small_vector(std::initializer_list<T> init, etl::imemory_block_allocator& allocator)
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Inline_Size, &allocator)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Uses the same allocator as the other vector.
+    //*************************************************************************
+    small_vector(const small_vector& other)
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Inline_Size, other.get_allocator())
+    {
+      this->assign(other.begin(), other.end());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    /// Uses the same allocator as the other vector.
+    //*************************************************************************
+    small_vector(small_vector&& other)
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Inline_Size, other.get_allocator())
+    {
+      this->move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~small_vector()
+    {
+      this->release();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    small_vector& operator = (const small_vector& rhs)
+    {
+      etl::ismall_vector<T>::operator =(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    small_vector& operator = (small_vector&& rhs)
+    {
+      etl::ismall_vector<T>::operator =(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The inline storage.
+    typename etl::aligned_storage<sizeof(T) * Inline_Size, etl::alignment_of<T>::value>::type buffer;
+  };
+
+  template <typename T, size_t Inline_Size>
+  ETL_CONSTANT size_t small_vector<T, Inline_Size>::INLINE_SIZE;
+}
+
+#endif
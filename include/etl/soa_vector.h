@@ -0,0 +1,593 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_VECTOR_INCLUDED
+#define ETL_SOA_VECTOR_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "memory.h"
+#include "span.h"
+#include "utility.h"
+#include "nth_type.h"
+#include "placement_new.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+///\defgroup soa_vector soa_vector
+/// A vector of records, with each field stored as a separate contiguous column.
+///\ingroup containers
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup soa_vector
+  /// Exception base for soa_vector.
+  //***************************************************************************
+  class soa_vector_exception : public exception
+  {
+  public:
+
+    soa_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup soa_vector
+  /// soa_vector full exception.
+  //***************************************************************************
+  class soa_vector_full : public soa_vector_exception
+  {
+  public:
+
+    soa_vector_full(string_type file_name_, numeric_type line_number_)
+      : soa_vector_exception(ETL_ERROR_TEXT("soa_vector:full", ETL_SOA_VECTOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup soa_vector
+  /// soa_vector empty exception.
+  //***************************************************************************
+  class soa_vector_empty : public soa_vector_exception
+  {
+  public:
+
+    soa_vector_empty(string_type file_name_, numeric_type line_number_)
+      : soa_vector_exception(ETL_ERROR_TEXT("soa_vector:empty", ETL_SOA_VECTOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup soa_vector
+  /// soa_vector out of bounds exception.
+  //***************************************************************************
+  class soa_vector_out_of_bounds : public soa_vector_exception
+  {
+  public:
+
+    soa_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : soa_vector_exception(ETL_ERROR_TEXT("soa_vector:bounds", ETL_SOA_VECTOR_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_soa_vector
+  {
+    //*************************************************************************
+    /// The storage for one column.
+    //*************************************************************************
+    template <size_t Index, typename T, size_t Size>
+    struct column
+    {
+      etl::uninitialized_buffer_of<T, Size> buffer;
+    };
+
+    //*************************************************************************
+    /// The storage for all of the columns.
+    //*************************************************************************
+    template <typename TIndices, size_t Size, typename... TTypes>
+    struct columns;
+
+    template <size_t... Indices, size_t Size, typename... TTypes>
+    struct columns<etl::index_sequence<Indices...>, Size, TTypes...> : column<Indices, TTypes, Size>...
+    {
+    };
+
+    //*************************************************************************
+    /// A reference to one record, as a set of fields.
+    //*************************************************************************
+    template <typename TSoa>
+    class element_reference
+    {
+    public:
+
+      element_reference(TSoa& soa_, size_t index_)
+        : p_soa(&soa_)
+        , index(index_)
+      {
+      }
+
+      //***********************************************************************
+      /// Gets the field for column Index.
+      //***********************************************************************
+      template <size_t Index>
+      auto get() const -> decltype(etl::declval<TSoa&>().template data<Index>()[0])
+      {
+        return p_soa->template data<Index>()[index];
+      }
+
+    private:
+
+      TSoa*  p_soa;
+      size_t index;
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup soa_vector
+  /// Gets a field from a record reference.
+  //***************************************************************************
+  template <size_t Index, typename TSoa>
+  auto get(const private_soa_vector::element_reference<TSoa>& element) -> decltype(element.template get<Index>())
+  {
+    return element.template get<Index>();
+  }
+
+  //***************************************************************************
+  ///\ingroup soa_vector
+  /// A fixed capacity vector of records stored as a structure of arrays.
+  /// Each field type has its own contiguous column, so a loop over one field
+  /// touches only that field's memory.
+  ///\tparam Max_Size The maximum number of records.
+  ///\tparam TTypes   The field types.
+  //***************************************************************************
+  template <size_t Max_Size, typename... TTypes>
+  class soa_vector
+  {
+  private:
+
+    using indices_t = etl::make_index_sequence<sizeof...(TTypes)>;
+
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TTypes) != 0U, "soa_vector must have at least one column");
+
+    typedef size_t size_type;
+
+    template <size_t Index>
+    using column_type = etl::nth_type_t<Index, TTypes...>;
+
+    typedef private_soa_vector::element_reference<soa_vector>       reference;
+    typedef private_soa_vector::element_reference<const soa_vector> const_reference;
+
+    static ETL_CONSTANT size_t Columns  = sizeof...(TTypes);
+    static ETL_CONSTANT size_t Capacity = Max_Size;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_vector()
+      : current_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_vector(const soa_vector& other)
+      : current_size(0U)
+    {
+      copy_construct(other, indices_t());
+      current_size = other.current_size;
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    soa_vector(soa_vector&& other)
+      : current_size(0U)
+    {
+      move_construct(other, indices_t());
+      current_size = other.current_size;
+      other.clear();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_vector()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Copy assignment.
+    //*************************************************************************
+    soa_vector& operator =(const soa_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        copy_construct(rhs, indices_t());
+        current_size = rhs.current_size;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment.
+    //*************************************************************************
+    soa_vector& operator =(soa_vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        move_construct(rhs, indices_t());
+        current_size = rhs.current_size;
+        rhs.clear();
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Adds a record to the end.
+    /// If asserts or exceptions are enabled, emits soa_vector_full if the vector is already full.
+    ///\param fields The fields of the record, one for each column.
+    //*************************************************************************
+    template <typename... TFields>
+    void push_back(TFields&&... fields)
+    {
+      ETL_STATIC_ASSERT(sizeof...(TFields) == sizeof...(TTypes), "One field for each column is required");
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(soa_vector_full));
+#endif
+      construct_back(indices_t(), etl::forward<TFields>(fields)...);
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Adds n records to the end, copied from one array for each column.
+    /// If asserts or exceptions are enabled, emits soa_vector_full if there is not enough space.
+    ///\param n       The number of records.
+    ///\param sources Pointers to the first of n values for each column.
+    //*************************************************************************
+    void append(size_t n, const TTypes*... sources)
+    {
+      ETL_ASSERT_OR_RETURN(n <= available(), ETL_ERROR(soa_vector_full));
+
+      append_columns(n, indices_t(), sources...);
+      current_size += n;
+    }
+
+    //*************************************************************************
+    /// Removes the last record.
+    /// If asserts or exceptions are enabled, emits soa_vector_empty if the vector is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(soa_vector_empty));
+#endif
+      destroy_range(current_size - 1U, current_size, indices_t());
+      --current_size;
+    }
+
+    //*************************************************************************
+    /// Erases the record at index, keeping the order of the others.
+    //*************************************************************************
+    void erase(size_t index)
+    {
+      erase(index, index + 1U);
+    }
+
+    //*************************************************************************
+    /// Erases the records in [first, last), keeping the order of the others.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if the range is invalid.
+    //*************************************************************************
+    void erase(size_t first, size_t last)
+    {
+      ETL_ASSERT_OR_RETURN((first <= last) && (last <= current_size), ETL_ERROR(soa_vector_out_of_bounds));
+
+      erase_range(first, last, indices_t());
+      current_size -= (last - first);
+    }
+
+    //*************************************************************************
+    /// Resizes, value initialising any new records.
+    /// If asserts or exceptions are enabled, emits soa_vector_full if n is larger than the capacity.
+    //*************************************************************************
+    void resize(size_t n)
+    {
+      ETL_ASSERT_OR_RETURN(n <= Max_Size, ETL_ERROR(soa_vector_full));
+
+      if (n < current_size)
+      {
+        destroy_range(n, current_size, indices_t());
+      }
+      else
+      {
+        value_construct_range(current_size, n, indices_t());
+      }
+
+      current_size = n;
+    }
+
+    //*************************************************************************
+    /// Removes all records.
+    //*************************************************************************
+    void clear()
+    {
+      destroy_range(0U, current_size, indices_t());
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets a reference to a record.
+    //*************************************************************************
+    reference operator [](size_t index)
+    {
+      return reference(*this, index);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to a record.
+    //*************************************************************************
+    const_reference operator [](size_t index) const
+    {
+      return const_reference(*this, index);
+    }
+
+    //*************************************************************************
+    /// Gets a reference to a record.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    reference at(size_t index)
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      return reference(*this, index);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to a record.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    const_reference at(size_t index) const
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      return const_reference(*this, index);
+    }
+
+    //*************************************************************************
+    /// Gets the field of column Index for a record.
+    //*************************************************************************
+    template <size_t Index>
+    column_type<Index>& get(size_t index)
+    {
+      return data<Index>()[index];
+    }
+
+    //*************************************************************************
+    /// Gets the field of column Index for a record.
+    //*************************************************************************
+    template <size_t Index>
+    const column_type<Index>& get(size_t index) const
+    {
+      return data<Index>()[index];
+    }
+
+    //*************************************************************************
+    /// Gets a span of column Index.
+    //*************************************************************************
+    template <size_t Index>
+    etl::span<column_type<Index>> column()
+    {
+      return etl::span<column_type<Index>>(data<Index>(), current_size);
+    }
+
+    //*************************************************************************
+    /// Gets a span of column Index.
+    //*************************************************************************
+    template <size_t Index>
+    etl::span<const column_type<Index>> column() const
+    {
+      return etl::span<const column_type<Index>>(data<Index>(), current_size);
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the start of column Index.
+    //*************************************************************************
+    template <size_t Index>
+    column_type<Index>* data()
+    {
+      return column_storage<Index>().buffer.begin();
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the start of column Index.
+    //*************************************************************************
+    template <size_t Index>
+    const column_type<Index>* data() const
+    {
+      return column_storage<Index>().buffer.begin();
+    }
+
+    //*************************************************************************
+    /// Returns the number of records.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks for no records.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks for maximum records.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of records.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of records.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the space left for records.
+    //*************************************************************************
+    size_type available() const
+    {
+      return Max_Size - current_size;
+    }
+
+  private:
+
+    template <size_t Index>
+    using column_storage_t = private_soa_vector::column<Index, column_type<Index>, Max_Size>;
+
+    //*************************************************************************
+    template <size_t Index>
+    column_storage_t<Index>& column_storage()
+    {
+      return static_cast<column_storage_t<Index>&>(storage);
+    }
+
+    //*************************************************************************
+    template <size_t Index>
+    const column_storage_t<Index>& column_storage() const
+    {
+      return static_cast<const column_storage_t<Index>&>(storage);
+    }
+
+    //*************************************************************************
+    template <size_t... Indices, typename... TFields>
+    void construct_back(etl::index_sequence<Indices...>, TFields&&... fields)
+    {
+      int dummy[] = { 0, (::new (static_cast<void*>(data<Indices>() + current_size)) column_type<Indices>(etl::forward<TFields>(fields)), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    template <size_t... Indices>
+    void append_columns(size_t n, etl::index_sequence<Indices...>, const TTypes*... sources)
+    {
+      int dummy[] = { 0, (etl::uninitialized_copy(sources, sources + n, data<Indices>() + current_size), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    template <size_t... Indices>
+    void copy_construct(const soa_vector& other, etl::index_sequence<Indices...>)
+    {
+      int dummy[] = { 0, (etl::uninitialized_copy(other.template data<Indices>(), other.template data<Indices>() + other.current_size, data<Indices>()), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    template <size_t... Indices>
+    void move_construct(soa_vector& other, etl::index_sequence<Indices...>)
+    {
+      int dummy[] = { 0, (etl::uninitialized_move(other.template data<Indices>(), other.template data<Indices>() + other.current_size, data<Indices>()), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    template <size_t... Indices>
+    void destroy_range(size_t first, size_t last, etl::index_sequence<Indices...>)
+    {
+      int dummy[] = { 0, (etl::destroy(data<Indices>() + first, data<Indices>() + last), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    template <size_t... Indices>
+    void value_construct_range(size_t first, size_t last, etl::index_sequence<Indices...>)
+    {
+      int dummy[] = { 0, (etl::uninitialized_value_construct(data<Indices>() + first, data<Indices>() + last), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    template <size_t... Indices>
+    void erase_range(size_t first, size_t last, etl::index_sequence<Indices...>)
+    {
+      int dummy[] = { 0, (etl::move(data<Indices>() + last, data<Indices>() + current_size, data<Indices>() + first), 0)... };
+      (void)dummy;
+
+      destroy_range(current_size - (last - first), current_size, etl::index_sequence<Indices...>());
+    }
+
+    // The columns.
+    private_soa_vector::columns<indices_t, Max_Size, TTypes...> storage;
+
+    // The number of records.
+    size_t current_size;
+  };
+
+  template <size_t Max_Size, typename... TTypes>
+  ETL_CONSTANT size_t soa_vector<Max_Size, TTypes...>::Columns;
+
+  template <size_t Max_Size, typename... TTypes>
+  ETL_CONSTANT size_t soa_vector<Max_Size, TTypes...>::Capacity;
+}
+
+#endif
+#endif
@@ -0,0 +1,272 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_SORT_NETWORK_INCLUDED
+#define ETL_SORT_NETWORK_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "log.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+///\defgroup sort_network sort_network
+/// Sorting networks for small arrays whose size is known at compile time.
+/// The sequence of compare-exchanges is Batcher's merge exchange (Knuth,
+/// TAOCP 5.2.2, Algorithm M), generated and unrolled at compile time.
+/// It is size optimal up to 8 elements and within 3 compare-exchanges of the
+/// best known networks up to 16.
+/// For arithmetic and pointer types each compare-exchange is a pair of
+/// selects, with no data dependent branches.
+///\ingroup algorithms
+
+namespace etl
+{
+  namespace private_sort_network
+  {
+    //*************************************************************************
+    /// Branch free compare-exchange for arithmetic and pointer types.
+    //*************************************************************************
+    template <typename T, typename TCompare>
+    void compare_exchange(T& a, T& b, TCompare& compare, etl::true_type)
+    {
+      const bool exchange = compare(b, a);
+      const T    lower    = exchange ? b : a;
+      const T    upper    = exchange ? a : b;
+
+      a = lower;
+      b = upper;
+    }
+
+    //*************************************************************************
+    /// Compare-exchange for other types.
+    //*************************************************************************
+    template <typename T, typename TCompare>
+    void compare_exchange(T& a, T& b, TCompare& compare, etl::false_type)
+    {
+      if (compare(b, a))
+      {
+        using ETL_OR_STD::swap; // Allow ADL
+        swap(a, b);
+      }
+    }
+
+    //*************************************************************************
+    template <typename T, typename TCompare>
+    void compare_exchange(T& a, T& b, TCompare& compare)
+    {
+      typedef etl::integral_constant<bool, etl::is_arithmetic<T>::value || etl::is_pointer<T>::value> is_selectable;
+
+      compare_exchange(a, b, compare, is_selectable());
+    }
+
+    //*************************************************************************
+    /// Compare-exchanges elements I and I + D for each I where (I & P) == R.
+    //*************************************************************************
+    template <size_t N, size_t P, size_t R, size_t D, size_t I, bool Done = ((I + D) >= N)>
+    struct merge_exchange_pass
+    {
+      template <typename TIterator, typename TCompare>
+      static void apply(TIterator first, TCompare& compare)
+      {
+        if ((I & P) == R)
+        {
+          compare_exchange(first[I], first[I + D], compare);
+        }
+
+        merge_exchange_pass<N, P, R, D, I + 1>::apply(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P, size_t R, size_t D, size_t I>
+    struct merge_exchange_pass<N, P, R, D, I, true>
+    {
+      template <typename TIterator, typename TCompare>
+      static void apply(TIterator, TCompare&)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// The merges for one value of P.
+    //*************************************************************************
+    template <size_t N, size_t P>
+    struct merge_exchange_round;
+
+    template <size_t N, size_t P, size_t Q, size_t R, size_t D>
+    struct merge_exchange_merge;
+
+    template <size_t N, size_t P, size_t Q, bool Last = (Q == P)>
+    struct merge_exchange_next
+    {
+      template <typename TIterator, typename TCompare>
+      static void apply(TIterator first, TCompare& compare)
+      {
+        merge_exchange_merge<N, P, Q / 2U, P, Q - P>::apply(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P, size_t Q>
+    struct merge_exchange_next<N, P, Q, true>
+    {
+      template <typename TIterator, typename TCompare>
+      static void apply(TIterator first, TCompare& compare)
+      {
+        merge_exchange_round<N, P / 2U>::apply(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P, size_t Q, size_t R, size_t D>
+    struct merge_exchange_merge
+    {
+      template <typename TIterator, typename TCompare>
+      static void apply(TIterator first, TCompare& compare)
+      {
+        merge_exchange_pass<N, P, R, D, 0U>::apply(first, compare);
+        merge_exchange_next<N, P, Q>::apply(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P>
+    struct merge_exchange_round
+    {
+      // The largest power of 2 less than N.
+      static const size_t Top = size_t(1U) << etl::log2<N - 1U>::value;
+
+      template <typename TIterator, typename TCompare>
+      static void apply(TIterator first, TCompare& compare)
+      {
+        merge_exchange_merge<N, P, Top, 0U, P>::apply(first, compare);
+      }
+    };
+
+    template <size_t N>
+    struct merge_exchange_round<N, 0U>
+    {
+      template <typename TIterator, typename TCompare>
+      static void apply(TIterator, TCompare&)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// The network for N elements.
+    //*************************************************************************
+    template <size_t N, bool Trivial = (N < 2U)>
+    struct network
+    {
+      template <typename TIterator, typename TCompare>
+      static void apply(TIterator first, TCompare& compare)
+      {
+        merge_exchange_round<N, (size_t(1U) << etl::log2<N - 1U>::value)>::apply(first, compare);
+      }
+    };
+
+    template <size_t N>
+    struct network<N, true>
+    {
+      template <typename TIterator, typename TCompare>
+      static void apply(TIterator, TCompare&)
+      {
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Sorts the N elements starting at 'first' with a sorting network.
+  /// The sort is not stable.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator, typename TCompare>
+  void sort_network(TIterator first, TCompare compare)
+  {
+    private_sort_network::network<N>::apply(first, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the N elements starting at 'first' with a sorting network.
+  /// The sort is not stable.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator>
+  void sort_network(TIterator first)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    etl::sort_network<N>(first, etl::less<value_type>());
+  }
+
+  //***************************************************************************
+  /// Returns the median of the N elements starting at 'first', which are
+  /// left unchanged. For even N it is the first of the two middle elements
+  /// in the order of the compare.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator, typename TCompare>
+  typename etl::iterator_traits<TIterator>::value_type median_of(TIterator first, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(N != 0U, "median_of needs at least one element");
+
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    value_type values[N];
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      values[i] = *first;
+      ++first;
+    }
+
+    etl::sort_network<N>(values, compare);
+
+    return values[(N - 1U) / 2U];
+  }
+
+  //***************************************************************************
+  /// Returns the median of the N elements starting at 'first', which are
+  /// left unchanged. For even N it is the first of the two middle elements
+  /// in the order of the compare.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator>
+  typename etl::iterator_traits<TIterator>::value_type median_of(TIterator first)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    return etl::median_of<N>(first, etl::less<value_type>());
+  }
+}
+
+#endif
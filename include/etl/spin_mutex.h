@@ -0,0 +1,242 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SPIN_MUTEX_INCLUDED
+#define ETL_SPIN_MUTEX_INCLUDED
+
+#include "platform.h"
+
+#include <stdint.h>
+
+///\defgroup spin_mutex spin_mutex
+/// Spin locks built on the __sync builtins.
+/// etl::spin_mutex waits with plain loads and exponential backoff.
+/// etl::ticket_mutex grants the lock in arrival order.
+/// While waiting, ETL_SPIN_PAUSE() is called between polls, and ETL_SPIN_YIELD()
+/// once the backoff reaches ETL_SPIN_MAX_BACKOFF pauses. Either may be defined
+/// in the profile. ETL_SPIN_YIELD() may call the OS, i.e. sched_yield() or taskYIELD().
+///\ingroup mutex
+
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_ARM5) || \
+    defined(ETL_COMPILER_ARM6) || defined(ETL_COMPILER_ARM7) || defined(ETL_COMPILER_ARM8)
+  #define ETL_HAS_SPIN_MUTEX 1
+#else
+  #define ETL_HAS_SPIN_MUTEX 0
+#endif
+
+#if !defined(ETL_SPIN_PAUSE)
+  #if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__i386__) || defined(__x86_64__))
+    #define ETL_SPIN_PAUSE() __builtin_ia32_pause()
+  #elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_ARM6) || defined(ETL_COMPILER_ARM7) || defined(ETL_COMPILER_ARM8)) && \
+        (defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+    #define ETL_SPIN_PAUSE() __asm__ __volatile__("yield" ::: "memory")
+  #elif ETL_HAS_SPIN_MUTEX && !defined(ETL_COMPILER_ARM5)
+    #define ETL_SPIN_PAUSE() __asm__ __volatile__("" ::: "memory")
+  #else
+    #define ETL_SPIN_PAUSE()
+  #endif
+#endif
+
+#if !defined(ETL_SPIN_YIELD)
+  #define ETL_SPIN_YIELD() ETL_SPIN_PAUSE()
+#endif
+
+#if !defined(ETL_SPIN_MAX_BACKOFF)
+  #define ETL_SPIN_MAX_BACKOFF 64
+#endif
+
+namespace etl
+{
+  namespace private_spin_mutex
+  {
+    //*************************************************************************
+    /// Exponential backoff for a waiting spin lock.
+    /// Each wait pauses twice as long as the last, up to ETL_SPIN_MAX_BACKOFF
+    /// pauses, after which each wait yields.
+    //*************************************************************************
+    class backoff
+    {
+    public:
+
+      backoff()
+        : pauses(1U)
+      {
+      }
+
+      void wait()
+      {
+        if (pauses <= Max_Pauses)
+        {
+          for (uint_least16_t i = 0U; i < pauses; ++i)
+          {
+            ETL_SPIN_PAUSE();
+          }
+
+          pauses = static_cast<uint_least16_t>(pauses * 2U);
+        }
+        else
+        {
+          ETL_SPIN_YIELD();
+        }
+      }
+
+    private:
+
+      static ETL_CONSTANT uint_least16_t Max_Pauses = ETL_SPIN_MAX_BACKOFF;
+
+      uint_least16_t pauses;
+    };
+  }
+}
+
+#if ETL_HAS_SPIN_MUTEX
+
+namespace etl
+{
+  namespace private_spin_mutex
+  {
+    //*************************************************************************
+    /// An acquire load, for polling without taking the cache line for writing.
+    //*************************************************************************
+    template <typename T>
+    T load(const T& value)
+    {
+#if defined(__ATOMIC_ACQUIRE)
+      return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+#else
+      const T result = *static_cast<const volatile T*>(&value);
+      __sync_synchronize();
+
+      return result;
+#endif
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup spin_mutex
+  /// A test and test-and-set spin lock with exponential backoff.
+  /// Waiters poll with plain loads, and only attempt the test-and-set when the
+  /// lock appears free, so the lock holder's cache line is not contended.
+  //***************************************************************************
+  class spin_mutex
+  {
+  public:
+
+    spin_mutex()
+      : flag(0)
+    {
+      __sync_lock_release(&flag);
+    }
+
+    void lock()
+    {
+      private_spin_mutex::backoff backoff;
+
+      while (__sync_lock_test_and_set(&flag, 1U) != 0)
+      {
+        do
+        {
+          backoff.wait();
+        } while (private_spin_mutex::load(flag) != 0);
+      }
+    }
+
+    bool try_lock()
+    {
+      return (private_spin_mutex::load(flag) == 0) && (__sync_lock_test_and_set(&flag, 1U) == 0);
+    }
+
+    void unlock()
+    {
+      __sync_lock_release(&flag);
+    }
+
+  private:
+
+    spin_mutex(const spin_mutex&) ETL_DELETE;
+    spin_mutex& operator=(const spin_mutex&) ETL_DELETE;
+
+    char flag;
+  };
+
+  //***************************************************************************
+  ///\ingroup spin_mutex
+  /// A ticket spin lock, granting the lock in arrival order.
+  /// Each locker takes the next ticket and waits until it is served, so no
+  /// waiter can be overtaken. Waiters back off as etl::spin_mutex.
+  //***************************************************************************
+  class ticket_mutex
+  {
+  public:
+
+    ticket_mutex()
+      : next(0U)
+      , serving(0U)
+    {
+    }
+
+    void lock()
+    {
+      const uint32_t ticket = __sync_fetch_and_add(&next, 1U);
+
+      private_spin_mutex::backoff backoff;
+
+      // The load acquires the writes made by the previous holder.
+      while (private_spin_mutex::load(serving) != ticket)
+      {
+        backoff.wait();
+      }
+    }
+
+    bool try_lock()
+    {
+      // Only succeeds if no ticket is outstanding.
+      const uint32_t ticket = private_spin_mutex::load(serving);
+
+      return __sync_bool_compare_and_swap(&next, ticket, ticket + 1U);
+    }
+
+    void unlock()
+    {
+      __sync_fetch_and_add(&serving, 1U);
+    }
+
+  private:
+
+    ticket_mutex(const ticket_mutex&) ETL_DELETE;
+    ticket_mutex& operator=(const ticket_mutex&) ETL_DELETE;
+
+    uint32_t next;
+    uint32_t serving;
+  };
+}
+
+#endif
+#endif
@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_moments.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -132,9 +134,7 @@ namespace etl
     //*********************************
     void add(TInput value)
     {
-      sum_of_squares += TCalc(value * value);
-      sum            += TCalc(value);
-      ++counter;
+      moments.add(value);
       recalculate = true;
     }
 
@@ -151,6 +151,24 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a contiguous batch of values.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      moments.add(values.data(), values.size());
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Merge the values added to another standard_deviation.
+    //*********************************
+    void merge(const standard_deviation& other)
+    {
+      moments.merge(other.moments);
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -203,7 +221,7 @@ namespace etl
     //*********************************
     size_t count() const
     {
-      return size_t(counter);
+      return size_t(moments.count());
     }
 
     //*********************************
@@ -211,9 +229,7 @@ namespace etl
     //*********************************
     void clear()
     {
-      sum_of_squares           = calc_t(0);
-      sum                      = calc_t(0);
-      counter                  = 0U;
+      moments.clear();
       variance_value           = 0.0;
       standard_deviation_value = 0.0;
       recalculate              = true;
@@ -231,14 +247,11 @@ namespace etl
         standard_deviation_value = 0.0;
         variance_value = 0.0;
 
-        if (counter != 0)
+        if (moments.count() != 0U)
         {
-          double n = double(counter);
-          double adjustment = 1.0 / (n * (n - Adjustment));
-
-          double square_of_sum = (sum * sum);
+          double n = double(moments.count());
 
-          variance_value = ((n * sum_of_squares) - square_of_sum) * adjustment;
+          variance_value = moments.squared_deviations() / (n - Adjustment);
 
           if (variance_value > 0)
           {
@@ -250,9 +263,7 @@ namespace etl
       }
     }
 
-    calc_t   sum_of_squares;
-    calc_t   sum;
-    uint32_t counter;
+    private_statistics::moments<calc_t> moments;
     mutable double variance_value;
     mutable double standard_deviation_value;
     mutable bool   recalculate;
@@ -34,8 +34,12 @@ SOFTWARE.
 #include "array.h"
 #include "array_view.h"
 #include "utility.h"
+#include "integral_limits.h"
+#include "smallest.h"
+#include "static_assert.h"
 
 #include <stdint.h>
+#include <stddef.h>
 
 namespace etl
 {
@@ -152,6 +156,307 @@ namespace etl
     };
   }
 
+  namespace state_chart_traits
+  {
+    //*************************************************************************
+    /// Selects a linear search of the tables of a compile time state chart.
+    /// The default.
+    //*************************************************************************
+    struct linear_lookup
+    {
+    };
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    /// Selects lookup through an index of the tables of a compile time state chart,
+    /// built at compile time. The tables must be constexpr.
+    /// Finding the transitions for an event is O(log N), and finding a state is O(1).
+    /// Transitions are still tried in table order.
+    //*************************************************************************
+    struct indexed_lookup
+    {
+    };
+#endif
+  }
+
+  namespace private_state_chart
+  {
+    //*************************************************************************
+    /// Finds states and transitions in the tables of a compile time state chart.
+    /// Linear search.
+    //*************************************************************************
+    template <typename TLookup,
+              typename TTransition, const TTransition* Transitions, size_t Transitions_Size,
+              typename TState,      const TState*      States,      size_t States_Size>
+    struct lookup
+    {
+      typedef state_chart_traits::state_id_t state_id_t;
+      typedef state_chart_traits::event_id_t event_id_t;
+
+      //***********************************
+      /// Returns the first state with the id, or the end of the state table.
+      //***********************************
+      static const TState* find_state(state_id_t state_id)
+      {
+        const TState* s = States;
+
+        while ((s != (States + States_Size)) && (s->state_id != state_id))
+        {
+          ++s;
+        }
+
+        return s;
+      }
+
+      //***********************************
+      /// Finds, in table order, the transitions for an event from a state.
+      //***********************************
+      class transition_finder
+      {
+      public:
+
+        transition_finder(event_id_t event_id_, state_id_t state_id_)
+          : event_id(event_id_)
+          , state_id(state_id_)
+          , position(Transitions)
+        {
+        }
+
+        //*********************************
+        /// Returns the next transition, or the end of the transition table.
+        //*********************************
+        const TTransition* next()
+        {
+          while (position != (Transitions + Transitions_Size))
+          {
+            const TTransition* t = position++;
+
+            if ((t->event_id == event_id) && (t->from_any_state || (t->current_state_id == state_id)))
+            {
+              return t;
+            }
+          }
+
+          return position;
+        }
+
+      private:
+
+        const event_id_t   event_id;
+        const state_id_t   state_id;
+        const TTransition* position;
+      };
+    };
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    /// The index of the tables of a compile time state chart.
+    //*************************************************************************
+    template <typename TIndex, size_t Transitions_Size, size_t State_Map_Size>
+    struct state_chart_index
+    {
+      TIndex transitions[Transitions_Size]; ///< Transitions, ordered by key then position.
+      TIndex states[State_Map_Size];        ///< The position of the first state for each id.
+    };
+
+    //*************************************************************************
+    /// The sort key of a transition.
+    /// Orders by event, then transitions from a state before those from any
+    /// state, then by state.
+    //*************************************************************************
+    typedef uint32_t transition_key_t;
+
+    ETL_STATIC_ASSERT(((2 * etl::integral_limits<state_chart_traits::state_id_t>::bits) + 1) <= etl::integral_limits<transition_key_t>::bits,
+                      "State and event ids too large for the transition key");
+
+    constexpr transition_key_t transition_key(state_chart_traits::event_id_t event_id, bool from_any_state, state_chart_traits::state_id_t state_id)
+    {
+      return (transition_key_t(event_id) << (etl::integral_limits<state_chart_traits::state_id_t>::bits + 1)) |
+             (transition_key_t(from_any_state) << etl::integral_limits<state_chart_traits::state_id_t>::bits) |
+             (from_any_state ? 0U : transition_key_t(state_id));
+    }
+
+    template <typename TTransition>
+    constexpr transition_key_t transition_key(const TTransition& t)
+    {
+      return transition_key(t.event_id, t.from_any_state, t.current_state_id);
+    }
+
+    //*************************************************************************
+    /// One more than the largest state id in the state table.
+    //*************************************************************************
+    template <typename TState>
+    constexpr size_t state_map_size(const TState* states, size_t size)
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < size; ++i)
+      {
+        if (size_t(states[i].state_id) >= n)
+        {
+          n = size_t(states[i].state_id) + 1U;
+        }
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Builds the index.
+    //*************************************************************************
+    template <typename TIndex, size_t Index_Transitions_Size, size_t Index_State_Map_Size, typename TTransition, typename TState>
+    constexpr state_chart_index<TIndex, Index_Transitions_Size, Index_State_Map_Size>
+      make_state_chart_index(const TTransition* transitions, size_t transitions_size, const TState* states, size_t states_size, size_t state_map_size)
+    {
+      state_chart_index<TIndex, Index_Transitions_Size, Index_State_Map_Size> index{};
+
+      // A stable insertion sort, so that transitions with the same key stay in table order.
+      for (size_t i = 0U; i < transitions_size; ++i)
+      {
+        const transition_key_t key = transition_key(transitions[i]);
+
+        size_t j = i;
+
+        while ((j > 0U) && (transition_key(transitions[index.transitions[j - 1U]]) > key))
+        {
+          index.transitions[j] = index.transitions[j - 1U];
+          --j;
+        }
+
+        index.transitions[j] = TIndex(i);
+      }
+
+      for (size_t i = 0U; i < state_map_size; ++i)
+      {
+        index.states[i] = TIndex(states_size);
+      }
+
+      // Backwards, so that the first state with an id is the one found.
+      for (size_t i = states_size; i > 0U; --i)
+      {
+        index.states[states[i - 1U].state_id] = TIndex(i - 1U);
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Finds states and transitions in the tables of a compile time state chart.
+    /// Indexed.
+    //*************************************************************************
+    template <typename TTransition, const TTransition* Transitions, size_t Transitions_Size,
+              typename TState,      const TState*      States,      size_t States_Size>
+    struct lookup<state_chart_traits::indexed_lookup, TTransition, Transitions, Transitions_Size, TState, States, States_Size>
+    {
+      typedef state_chart_traits::state_id_t state_id_t;
+      typedef state_chart_traits::event_id_t event_id_t;
+
+      typedef typename etl::smallest_uint_for_value<(Transitions_Size > States_Size) ? Transitions_Size : States_Size>::type index_t;
+
+      static constexpr size_t State_Map_Size       = state_map_size(States, States_Size);
+      static constexpr size_t Index_Transition_Size = (Transitions_Size > 0U) ? Transitions_Size : 1U;
+      static constexpr size_t Index_State_Map_Size  = (State_Map_Size > 0U) ? State_Map_Size : 1U;
+
+      typedef state_chart_index<index_t, Index_Transition_Size, Index_State_Map_Size> index_type;
+
+      static constexpr index_type index = make_state_chart_index<index_t, Index_Transition_Size, Index_State_Map_Size>(Transitions, Transitions_Size, States, States_Size, State_Map_Size);
+
+      //***********************************
+      /// Returns the first state with the id, or the end of the state table.
+      //***********************************
+      static const TState* find_state(state_id_t state_id)
+      {
+        return (size_t(state_id) < State_Map_Size) ? (States + index.states[state_id]) : (States + States_Size);
+      }
+
+      //***********************************
+      /// Finds, in table order, the transitions for an event from a state.
+      /// Merges the transitions from the state with those from any state.
+      //***********************************
+      class transition_finder
+      {
+      public:
+
+        transition_finder(event_id_t event_id, state_id_t state_id)
+        {
+          const transition_key_t from_state_key = transition_key(event_id, false, state_id);
+          const transition_key_t from_any_key   = transition_key(event_id, true, state_id);
+
+          from_state     = lower_bound(from_state_key);
+          from_state_end = lower_bound(from_state_key + 1U);
+          from_any       = lower_bound(from_any_key);
+          from_any_end   = lower_bound(from_any_key + 1U);
+        }
+
+        //*********************************
+        /// Returns the next transition, or the end of the transition table.
+        //*********************************
+        const TTransition* next()
+        {
+          if (from_state != from_state_end)
+          {
+            if ((from_any == from_any_end) || (*from_state < *from_any))
+            {
+              return Transitions + *from_state++;
+            }
+          }
+
+          if (from_any != from_any_end)
+          {
+            return Transitions + *from_any++;
+          }
+
+          return Transitions + Transitions_Size;
+        }
+
+      private:
+
+        //*********************************
+        /// The first entry in the index with a key not less than the one given.
+        //*********************************
+        static const index_t* lower_bound(transition_key_t key)
+        {
+          const index_t* first = index.transitions;
+          size_t         count = Transitions_Size;
+
+          while (count > 0U)
+          {
+            const size_t half = count / 2U;
+
+            if (transition_key(Transitions[first[half]]) < key)
+            {
+              first += half + 1U;
+              count -= half + 1U;
+            }
+            else
+            {
+              count = half;
+            }
+          }
+
+          return first;
+        }
+
+        const index_t* from_state;
+        const index_t* from_state_end;
+        const index_t* from_any;
+        const index_t* from_any_end;
+      };
+    };
+
+  #if !ETL_USING_CPP17
+    template <typename TTransition, const TTransition* Transitions, size_t Transitions_Size,
+              typename TState,      const TState*      States,      size_t States_Size>
+    constexpr size_t lookup<state_chart_traits::indexed_lookup, TTransition, Transitions, Transitions_Size, TState, States, States_Size>::State_Map_Size;
+
+    template <typename TTransition, const TTransition* Transitions, size_t Transitions_Size,
+              typename TState,      const TState*      States,      size_t States_Size>
+    constexpr typename lookup<state_chart_traits::indexed_lookup, TTransition, Transitions, Transitions_Size, TState, States, States_Size>::index_type
+      lookup<state_chart_traits::indexed_lookup, TTransition, Transitions, Transitions_Size, TState, States, States_Size>::index;
+  #endif
+#endif
+  }
+
   //***************************************************************************
   /// For non-void parameter types
   //***************************************************************************
@@ -233,7 +538,8 @@ namespace etl
             size_t                                                    Transition_Table_Size,
             const etl::state_chart_traits::state<TObject>*            State_Table_Begin,
             size_t                                                    State_Table_Size,
-            etl::state_chart_traits::state_id_t                       Initial_State>
+            etl::state_chart_traits::state_id_t                       Initial_State,
+            typename                                                  TLookup = etl::state_chart_traits::linear_lookup>
   class state_chart_ct : public istate_chart<void>
   {
   public:  
@@ -304,59 +610,55 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = Transition_Table_Begin;
+        typename lookup_t::transition_finder finder(event_id, this->current_state_id);
 
-        // Keep looping until we execute a transition or reach the end of the table.
+        // Find the first candidate transition, in table order.
+        const transition* t = finder.next();
+
+        // Keep looping until we execute a transition or run out of candidates.
         while (t != (Transition_Table_Begin + Transition_Table_Size))
         {
-          // Scan the transition table from the latest position.
-          t = etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
-
-          // Found an entry?
-          if (t != (Transition_Table_Begin + Transition_Table_Size))
+          // Shall we execute the transition?
+          if ((t->guard == ETL_NULLPTR) || ((TObject_Ref.*t->guard)()))
           {
-            // Shall we execute the transition?
-            if ((t->guard == ETL_NULLPTR) || ((TObject_Ref.*t->guard)()))
+            // Shall we execute the action?
+            if (t->action != ETL_NULLPTR)
             {
-              // Shall we execute the action?
-              if (t->action != ETL_NULLPTR)
-              {
-                (TObject_Ref.*t->action)();
-              }
+              (TObject_Ref.*t->action)();
+            }
 
-              // Changing state?
-              if (this->current_state_id != t->next_state_id)
-              {
-                const state* s;
+            // Changing state?
+            if (this->current_state_id != t->next_state_id)
+            {
+              const state* s;
 
-                // See if we have a state item for the current state.
-                s = find_state(this->current_state_id);
+              // See if we have a state item for the current state.
+              s = find_state(this->current_state_id);
 
-                // If the current state has an 'on_exit' then call it.
-                if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_exit != ETL_NULLPTR))
-                {
-                  (TObject_Ref.*(s->on_exit))();
-                }
+              // If the current state has an 'on_exit' then call it.
+              if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_exit != ETL_NULLPTR))
+              {
+                (TObject_Ref.*(s->on_exit))();
+              }
 
-                this->current_state_id = t->next_state_id;
+              this->current_state_id = t->next_state_id;
 
-                // See if we have a state item for the new state.
-                s = find_state(this->current_state_id);
+              // See if we have a state item for the new state.
+              s = find_state(this->current_state_id);
 
-                // If the new state has an 'on_entry' then call it.
-                if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_entry != ETL_NULLPTR))
-                {
-                  (TObject_Ref.*(s->on_entry))();
-                }
+              // If the new state has an 'on_entry' then call it.
+              if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_entry != ETL_NULLPTR))
+              {
+                (TObject_Ref.*(s->on_entry))();
               }
-
-              t = (Transition_Table_Begin + Transition_Table_Size);
-            }
-            else
-            {
-              // Start the search from the next item in the table.
-              ++t;
             }
+
+            t = (Transition_Table_Begin + Transition_Table_Size);
+          }
+          else
+          {
+            // Try the next candidate.
+            t = finder.next();
           }
         }
       }
@@ -364,49 +666,19 @@ namespace etl
 
   private:
 
+    typedef private_state_chart::lookup<TLookup,
+                                        transition, Transition_Table_Begin, Transition_Table_Size,
+                                        state,      State_Table_Begin,      State_Table_Size> lookup_t;
+
     //*************************************************************************
     /// Gets the current state id.
     /// \return The current state id.
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
-      return etl::find_if(State_Table_Begin, State_Table_Begin + State_Table_Size, is_state(state_id));
+      return lookup_t::find_state(state_id);
     }
 
-    //*************************************************************************
-    struct is_transition
-    {
-      is_transition(event_id_t event_id_, state_id_t state_id_)
-        : event_id(event_id_)
-        , state_id(state_id_)
-      {
-      }
-
-      bool operator()(const transition& t) const
-      {
-        return (t.event_id == event_id) && (t.from_any_state || (t.current_state_id == state_id));
-      }
-
-      const event_id_t event_id;
-      const state_id_t state_id;
-    };
-
-    //*************************************************************************
-    struct is_state
-    {
-      is_state(state_id_t state_id_)
-        : state_id(state_id_)
-      {
-      }
-
-      bool operator()(const state& s) const
-      {
-        return (s.state_id == state_id);
-      }
-
-      const state_id_t state_id;
-    };
-
     // Disabled
     state_chart_ct(const state_chart_ct&) ETL_DELETE;
     state_chart_ct& operator =(const state_chart_ct&) ETL_DELETE;
@@ -426,7 +698,8 @@ namespace etl
             size_t                                                          Transition_Table_Size,
             const etl::state_chart_traits::state<TObject>*                  State_Table_Begin,
             size_t                                                          State_Table_Size,
-            etl::state_chart_traits::state_id_t                             Initial_State>
+            etl::state_chart_traits::state_id_t                             Initial_State,
+            typename                                                        TLookup = etl::state_chart_traits::linear_lookup>
   class state_chart_ctp : public istate_chart<TParameter>
   {
   public:
@@ -497,63 +770,59 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = Transition_Table_Begin;
+        typename lookup_t::transition_finder finder(event_id, this->current_state_id);
 
-        // Keep looping until we execute a transition or reach the end of the table.
+        // Find the first candidate transition, in table order.
+        const transition* t = finder.next();
+
+        // Keep looping until we execute a transition or run out of candidates.
         while (t != (Transition_Table_Begin + Transition_Table_Size))
         {
-          // Scan the transition table from the latest position.
-          t = etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
-
-          // Found an entry?
-          if (t != (Transition_Table_Begin + Transition_Table_Size))
+          // Shall we execute the transition?
+          if ((t->guard == ETL_NULLPTR) || ((TObject_Ref.*t->guard)()))
           {
-            // Shall we execute the transition?
-            if ((t->guard == ETL_NULLPTR) || ((TObject_Ref.*t->guard)()))
+            // Shall we execute the action?
+            if (t->action != ETL_NULLPTR)
             {
-              // Shall we execute the action?
-              if (t->action != ETL_NULLPTR)
-              {
 #if ETL_USING_CPP11
-                (TObject_Ref.*t->action)(etl::forward<parameter_t>(data));
+              (TObject_Ref.*t->action)(etl::forward<parameter_t>(data));
 #else
-                (TObject_Ref.*t->action)(data);
+              (TObject_Ref.*t->action)(data);
 #endif
-              }
+            }
 
-              // Changing state?
-              if (this->current_state_id != t->next_state_id)
-              {
-                const state* s;
+            // Changing state?
+            if (this->current_state_id != t->next_state_id)
+            {
+              const state* s;
 
-                // See if we have a state item for the current state.
-                s = find_state(this->current_state_id);
+              // See if we have a state item for the current state.
+              s = find_state(this->current_state_id);
 
-                // If the current state has an 'on_exit' then call it.
-                if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_exit != ETL_NULLPTR))
-                {
-                  (TObject_Ref.*(s->on_exit))();
-                }
+              // If the current state has an 'on_exit' then call it.
+              if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_exit != ETL_NULLPTR))
+              {
+                (TObject_Ref.*(s->on_exit))();
+              }
 
-                this->current_state_id = t->next_state_id;
+              this->current_state_id = t->next_state_id;
 
-                // See if we have a state item for the new state.
-                s = find_state(this->current_state_id);
+              // See if we have a state item for the new state.
+              s = find_state(this->current_state_id);
 
-                // If the new state has an 'on_entry' then call it.
-                if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_entry != ETL_NULLPTR))
-                {
-                  (TObject_Ref.*(s->on_entry))();
-                }
+              // If the new state has an 'on_entry' then call it.
+              if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_entry != ETL_NULLPTR))
+              {
+                (TObject_Ref.*(s->on_entry))();
               }
-
-              t = (Transition_Table_Begin + Transition_Table_Size);
-            }
-            else
-            {
-              // Start the search from the next item in the table.
-              ++t;
             }
+
+            t = (Transition_Table_Begin + Transition_Table_Size);
+          }
+          else
+          {
+            // Try the next candidate.
+            t = finder.next();
           }
         }
       }
@@ -561,49 +830,19 @@ namespace etl
 
   private:
 
+    typedef private_state_chart::lookup<TLookup,
+                                        transition, Transition_Table_Begin, Transition_Table_Size,
+                                        state,      State_Table_Begin,      State_Table_Size> lookup_t;
+
     //*************************************************************************
     /// Gets the current state id.
     /// \return The current state id.
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
-      return etl::find_if(State_Table_Begin, State_Table_Begin + State_Table_Size, is_state(state_id));
+      return lookup_t::find_state(state_id);
     }
 
-    //*************************************************************************
-    struct is_transition
-    {
-      is_transition(event_id_t event_id_, state_id_t state_id_)
-        : event_id(event_id_)
-        , state_id(state_id_)
-      {
-      }
-
-      bool operator()(const transition& t) const
-      {
-        return (t.event_id == event_id) && (t.from_any_state || (t.current_state_id == state_id));
-      }
-
-      const event_id_t event_id;
-      const state_id_t state_id;
-    };
-
-    //*************************************************************************
-    struct is_state
-    {
-      is_state(state_id_t state_id_)
-        : state_id(state_id_)
-      {
-      }
-
-      bool operator()(const state& s) const
-      {
-        return (s.state_id == state_id);
-      }
-
-      const state_id_t state_id;
-    };
-
     // Disabled
     state_chart_ctp(const state_chart_ctp&) ETL_DELETE;
     state_chart_ctp& operator =(const state_chart_ctp&) ETL_DELETE;
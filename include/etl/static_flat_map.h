@@ -0,0 +1,575 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATIC_FLAT_MAP_INCLUDED
+#define ETL_STATIC_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "functional.h"
+#include "iterator.h"
+#include "utility.h"
+#include "initializer_list.h"
+
+#include "private/eytzinger.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup static_flat_map static_flat_map
+/// A read only map that is built once, optionally at compile time.
+/// The keys are stored contiguously in Eytzinger (breadth first tree) order,
+/// separately from the mapped values, so that a search touches memory in a
+/// cache friendly pattern and has no data dependent branches.
+/// Construction is O(N^2). Find is O(logN).
+/// Duplicate keys are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup static_flat_map
+  /// Exception base for static_flat_map
+  //***************************************************************************
+  class static_flat_map_exception : public etl::exception
+  {
+  public:
+
+    static_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup static_flat_map
+  /// Full exception.
+  //***************************************************************************
+  class static_flat_map_full : public static_flat_map_exception
+  {
+  public:
+
+    static_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : static_flat_map_exception(ETL_ERROR_TEXT("static_flat_map:full", ETL_STATIC_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup static_flat_map
+  /// Duplicate key exception.
+  //***************************************************************************
+  class static_flat_map_duplicate : public static_flat_map_exception
+  {
+  public:
+
+    static_flat_map_duplicate(string_type file_name_, numeric_type line_number_)
+      : static_flat_map_exception(ETL_ERROR_TEXT("static_flat_map:duplicate", ETL_STATIC_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup static_flat_map
+  /// Out of bounds exception.
+  //***************************************************************************
+  class static_flat_map_out_of_bounds : public static_flat_map_exception
+  {
+  public:
+
+    static_flat_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : static_flat_map_exception(ETL_ERROR_TEXT("static_flat_map:bounds", ETL_STATIC_FLAT_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A read only map with keys stored in Eytzinger order.
+  /// Iteration is in key order. As the keys and mapped values are stored
+  /// separately, iterators return a pair like object of references.
+  /// The keys cannot be modified. The mapped values may be modified with at().
+  ///\tparam TKey     The key type. Must be default constructible and assignable.
+  ///\tparam TMapped  The mapped type. Must be default constructible and assignable.
+  ///\tparam Max_Size The maximum number of elements.
+  ///\tparam TCompare The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup static_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t Max_Size, typename TCompare = etl::less<TKey> >
+  class static_flat_map
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Size > 0U, "Max_Size must be greater than zero");
+
+    typedef TKey                                    key_type;
+    typedef TMapped                                 mapped_type;
+    typedef ETL_OR_STD::pair<key_type, mapped_type> value_type;
+    typedef TCompare                                key_compare;
+    typedef size_t                                  size_type;
+    typedef ptrdiff_t                               difference_type;
+
+    //*************************************************************************
+    /// The result of dereferencing an iterator.
+    /// Refers to the separately stored key and mapped value.
+    //*************************************************************************
+    struct const_reference
+    {
+      //*******************************
+      ETL_CONSTEXPR14 const_reference(const key_type& first_, const mapped_type& second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      const key_type&    first;
+      const mapped_type& second;
+    };
+
+    //*************************************************************************
+    /// Allows operator -> to be used on an iterator.
+    //*************************************************************************
+    class const_pointer
+    {
+    public:
+
+      //*******************************
+      ETL_CONSTEXPR14 explicit const_pointer(const const_reference& reference_)
+        : reference(reference_)
+      {
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const const_reference* operator ->() const
+      {
+        return &reference;
+      }
+
+    private:
+
+      const_reference reference;
+    };
+
+    //*************************************************************************
+    /// Iterates the elements in key order.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type, ptrdiff_t, const_pointer, const_reference>
+    {
+    public:
+
+      friend class static_flat_map;
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator()
+        : p_map(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator& operator ++()
+      {
+        index = etl::private_eytzinger::next(index, p_map->n_elements);
+        return *this;
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator& operator --()
+      {
+        index = etl::private_eytzinger::previous(index, p_map->n_elements);
+        return *this;
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_reference operator *() const
+      {
+        return const_reference(key(), mapped());
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_pointer operator ->() const
+      {
+        return const_pointer(**this);
+      }
+
+      //*******************************
+      /// The key of the element.
+      //*******************************
+      ETL_CONSTEXPR14 const key_type& key() const
+      {
+        return p_map->keys[index - 1U];
+      }
+
+      //*******************************
+      /// The mapped value of the element.
+      //*******************************
+      ETL_CONSTEXPR14 const mapped_type& mapped() const
+      {
+        return p_map->mapped_values[index - 1U];
+      }
+
+      //*******************************
+      friend ETL_CONSTEXPR14 bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_map == rhs.p_map) && (lhs.index == rhs.index);
+      }
+
+      //*******************************
+      friend ETL_CONSTEXPR14 bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator(const static_flat_map* p_map_, size_t index_)
+        : p_map(p_map_)
+        , index(index_)
+      {
+      }
+
+      const static_flat_map* p_map;
+      size_t                 index; ///< The one based Eytzinger index, or zero for 'end'.
+    };
+
+    typedef const_iterator                               iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator                       reverse_iterator;
+
+    //*************************************************************************
+    /// Default constructor. An empty map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 static_flat_map()
+      : keys()
+      , mapped_values()
+      , n_elements(0U)
+      , compare()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a random access range of key/value pairs, in any order.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 static_flat_map(TIterator first, TIterator last)
+      : keys()
+      , mapped_values()
+      , n_elements(0U)
+      , compare()
+    {
+      build(first, static_cast<size_t>(etl::distance(first, last)));
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructs from an initializer_list of key/value pairs, in any order.
+    //*************************************************************************
+    ETL_CONSTEXPR14 static_flat_map(std::initializer_list<value_type> init)
+      : keys()
+      , mapped_values()
+      , n_elements(0U)
+      , compare()
+    {
+      build(init.begin(), init.size());
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns an iterator to the element with the smallest key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator begin() const
+    {
+      return const_iterator(this, etl::private_eytzinger::first(n_elements));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the element with the smallest key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator end() const
+    {
+      return const_iterator(this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the element with the largest key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the element with the largest key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator crbegin() const
+    {
+      return rbegin();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the start of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the start of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator crend() const
+    {
+      return rend();
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at the key.
+    /// If asserts or exceptions are enabled, emits an etl::static_flat_map_out_of_bounds if the key is not in the map.
+    ///\param key The key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 mapped_type& at(const key_type& key)
+    {
+      const size_t index = find_index(key);
+
+      ETL_ASSERT(index != 0U, ETL_ERROR(static_flat_map_out_of_bounds));
+
+      return mapped_values[index - 1U];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at the key.
+    /// If asserts or exceptions are enabled, emits an etl::static_flat_map_out_of_bounds if the key is not in the map.
+    ///\param key The key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const mapped_type& at(const key_type& key) const
+    {
+      const size_t index = find_index(key);
+
+      ETL_ASSERT(index != 0U, ETL_ERROR(static_flat_map_out_of_bounds));
+
+      return mapped_values[index - 1U];
+    }
+
+    //*************************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator find(const key_type& key) const
+    {
+      return const_iterator(this, find_index(key));
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains a key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(const key_type& key) const
+    {
+      return find_index(key) != 0U;
+    }
+
+    //*************************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Finds the lower bound of a key.
+    ///\param key The key to search for.
+    ///\return An iterator to the first element with a key not less than the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator lower_bound(const key_type& key) const
+    {
+      return const_iterator(this, etl::private_eytzinger::lower_bound(keys, n_elements, key, compare));
+    }
+
+    //*************************************************************************
+    /// Finds the upper bound of a key.
+    ///\param key The key to search for.
+    ///\return An iterator to the first element with a key greater than the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator upper_bound(const key_type& key) const
+    {
+      return const_iterator(this, etl::private_eytzinger::upper_bound(keys, n_elements, key, compare));
+    }
+
+    //*************************************************************************
+    /// Finds the range of equal elements of a key.
+    ///\param key The key to search for.
+    ///\return A pair of iterators defining the range.
+    //*************************************************************************
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t size() const
+    {
+      return n_elements;
+    }
+
+    //*************************************************************************
+    /// Checks if the map is empty.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool empty() const
+    {
+      return n_elements == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 key_compare key_comp() const
+    {
+      return compare;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the key of an input element.
+    //*************************************************************************
+    struct get_key
+    {
+      template <typename TValue>
+      ETL_CONSTEXPR const key_type& operator()(const TValue& value) const
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// The one based index of the key, or zero if not found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_index(const key_type& key) const
+    {
+      const size_t index = etl::private_eytzinger::lower_bound(keys, n_elements, key, compare);
+
+      if ((index != 0U) && !compare(key, keys[index - 1U]))
+      {
+        return index;
+      }
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// Sorts the elements and stores them in Eytzinger order.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 void build(TIterator first, size_t n)
+    {
+      ETL_ASSERT_OR_RETURN(n <= Max_Size, ETL_ERROR(static_flat_map_full));
+
+      size_t order[Max_Size] = {};
+
+      etl::private_eytzinger::sort_order(first, order, n, get_key(), compare);
+
+      ETL_ASSERT_OR_RETURN(etl::private_eytzinger::is_unique(first, order, n, get_key(), compare), ETL_ERROR(static_flat_map_duplicate));
+
+      size_t index = etl::private_eytzinger::first(n);
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        keys[index - 1U]          = first[order[i]].first;
+        mapped_values[index - 1U] = first[order[i]].second;
+        index = etl::private_eytzinger::next(index, n);
+      }
+
+      n_elements = n;
+    }
+
+    key_type    keys[Max_Size];          ///< The keys in Eytzinger order.
+    mapped_type mapped_values[Max_Size]; ///< The mapped values, in the same order as the keys.
+    size_t      n_elements;
+    key_compare compare;
+  };
+}
+
+#endif
@@ -0,0 +1,469 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATIC_FLAT_SET_INCLUDED
+#define ETL_STATIC_FLAT_SET_INCLUDED
+
+#include "platform.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "functional.h"
+#include "iterator.h"
+#include "utility.h"
+#include "initializer_list.h"
+
+#include "private/eytzinger.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup static_flat_set static_flat_set
+/// A read only set that is built once, optionally at compile time.
+/// The keys are stored contiguously in Eytzinger (breadth first tree) order,
+/// so that a search touches memory in a cache friendly pattern and has no
+/// data dependent branches.
+/// Construction is O(N^2). Find is O(logN).
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup static_flat_set
+  /// Exception base for static_flat_set
+  //***************************************************************************
+  class static_flat_set_exception : public etl::exception
+  {
+  public:
+
+    static_flat_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup static_flat_set
+  /// Full exception.
+  //***************************************************************************
+  class static_flat_set_full : public static_flat_set_exception
+  {
+  public:
+
+    static_flat_set_full(string_type file_name_, numeric_type line_number_)
+      : static_flat_set_exception(ETL_ERROR_TEXT("static_flat_set:full", ETL_STATIC_FLAT_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup static_flat_set
+  /// Duplicate key exception.
+  //***************************************************************************
+  class static_flat_set_duplicate : public static_flat_set_exception
+  {
+  public:
+
+    static_flat_set_duplicate(string_type file_name_, numeric_type line_number_)
+      : static_flat_set_exception(ETL_ERROR_TEXT("static_flat_set:duplicate", ETL_STATIC_FLAT_SET_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A read only set with keys stored in Eytzinger order.
+  /// Iteration is in key order.
+  ///\tparam TKey     The key type. Must be default constructible and assignable.
+  ///\tparam Max_Size The maximum number of keys.
+  ///\tparam TCompare The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup static_flat_set
+  //***************************************************************************
+  template <typename TKey, size_t Max_Size, typename TCompare = etl::less<TKey> >
+  class static_flat_set
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Size > 0U, "Max_Size must be greater than zero");
+
+    typedef TKey              key_type;
+    typedef TKey              value_type;
+    typedef TCompare          key_compare;
+    typedef TCompare          value_compare;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    //*************************************************************************
+    /// Iterates the keys in order.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type, ptrdiff_t, const_pointer, const_reference>
+    {
+    public:
+
+      friend class static_flat_set;
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator()
+        : p_set(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator& operator ++()
+      {
+        index = etl::private_eytzinger::next(index, p_set->n_elements);
+        return *this;
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator& operator --()
+      {
+        index = etl::private_eytzinger::previous(index, p_set->n_elements);
+        return *this;
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_reference operator *() const
+      {
+        return p_set->keys[index - 1U];
+      }
+
+      //*******************************
+      ETL_CONSTEXPR14 const_pointer operator ->() const
+      {
+        return &p_set->keys[index - 1U];
+      }
+
+      //*******************************
+      friend ETL_CONSTEXPR14 bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_set == rhs.p_set) && (lhs.index == rhs.index);
+      }
+
+      //*******************************
+      friend ETL_CONSTEXPR14 bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*******************************
+      ETL_CONSTEXPR14 const_iterator(const static_flat_set* p_set_, size_t index_)
+        : p_set(p_set_)
+        , index(index_)
+      {
+      }
+
+      const static_flat_set* p_set;
+      size_t                 index; ///< The one based Eytzinger index, or zero for 'end'.
+    };
+
+    typedef const_iterator                               iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator                       reverse_iterator;
+
+    //*************************************************************************
+    /// Default constructor. An empty set.
+    //*************************************************************************
+    ETL_CONSTEXPR14 static_flat_set()
+      : keys()
+      , n_elements(0U)
+      , compare()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a random access range of keys, in any order.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 static_flat_set(TIterator first, TIterator last)
+      : keys()
+      , n_elements(0U)
+      , compare()
+    {
+      build(first, static_cast<size_t>(etl::distance(first, last)));
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructs from an initializer_list of keys, in any order.
+    //*************************************************************************
+    ETL_CONSTEXPR14 static_flat_set(std::initializer_list<value_type> init)
+      : keys()
+      , n_elements(0U)
+      , compare()
+    {
+      build(init.begin(), init.size());
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns an iterator to the smallest key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator begin() const
+    {
+      return const_iterator(this, etl::private_eytzinger::first(n_elements));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the smallest key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the set.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator end() const
+    {
+      return const_iterator(this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the set.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the largest key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the largest key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator crbegin() const
+    {
+      return rbegin();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the start of the set.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the start of the set.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator crend() const
+    {
+      return rend();
+    }
+
+    //*************************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator find(const key_type& key) const
+    {
+      const size_t index = etl::private_eytzinger::lower_bound(keys, n_elements, key, compare);
+
+      if ((index != 0U) && !compare(key, keys[index - 1U]))
+      {
+        return const_iterator(this, index);
+      }
+
+      return end();
+    }
+
+    //*************************************************************************
+    /// Checks if the set contains a key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(const key_type& key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Finds the lower bound of a key.
+    ///\param key The key to search for.
+    ///\return An iterator to the first key not less than the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator lower_bound(const key_type& key) const
+    {
+      return const_iterator(this, etl::private_eytzinger::lower_bound(keys, n_elements, key, compare));
+    }
+
+    //*************************************************************************
+    /// Finds the upper bound of a key.
+    ///\param key The key to search for.
+    ///\return An iterator to the first key greater than the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator upper_bound(const key_type& key) const
+    {
+      return const_iterator(this, etl::private_eytzinger::upper_bound(keys, n_elements, key, compare));
+    }
+
+    //*************************************************************************
+    /// Finds the range of equal elements of a key.
+    ///\param key The key to search for.
+    ///\return A pair of iterators defining the range.
+    //*************************************************************************
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns the number of keys.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t size() const
+    {
+      return n_elements;
+    }
+
+    //*************************************************************************
+    /// Checks if the set is empty.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool empty() const
+    {
+      return n_elements == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of keys.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of keys.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 value_compare value_comp() const
+    {
+      return compare;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the key of an input element.
+    //*************************************************************************
+    struct get_key
+    {
+      ETL_CONSTEXPR const key_type& operator()(const value_type& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Sorts the keys and stores them in Eytzinger order.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 void build(TIterator first, size_t n)
+    {
+      ETL_ASSERT_OR_RETURN(n <= Max_Size, ETL_ERROR(static_flat_set_full));
+
+      size_t order[Max_Size] = {};
+
+      etl::private_eytzinger::sort_order(first, order, n, get_key(), compare);
+
+      ETL_ASSERT_OR_RETURN(etl::private_eytzinger::is_unique(first, order, n, get_key(), compare), ETL_ERROR(static_flat_set_duplicate));
+
+      size_t index = etl::private_eytzinger::first(n);
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        keys[index - 1U] = first[order[i]];
+        index = etl::private_eytzinger::next(index, n);
+      }
+
+      n_elements = n;
+    }
+
+    key_type    keys[Max_Size]; ///< The keys in Eytzinger order.
+    size_t      n_elements;
+    key_compare compare;
+  };
+}
+
+#endif
@@ -0,0 +1,606 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATIC_VECTOR_INCLUDED
+#define ETL_STATIC_VECTOR_INCLUDED
+
+#include "platform.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "iterator.h"
+#include "utility.h"
+#include "initializer_list.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup static_vector static_vector
+/// A fixed capacity vector that can be constant initialised.
+/// Unlike etl::vector, the elements are stored in a plain array within the
+/// object and there is no pointer to the storage, so from C++14 a
+/// static_vector of literal types may be built by a constexpr constructor or
+/// function and placed in read only memory, with no startup initialisation.
+/// The elements beyond size() are default constructed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup static_vector
+  /// Exception base for static_vector
+  //***************************************************************************
+  class static_vector_exception : public etl::exception
+  {
+  public:
+
+    static_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup static_vector
+  /// Full exception.
+  //***************************************************************************
+  class static_vector_full : public static_vector_exception
+  {
+  public:
+
+    static_vector_full(string_type file_name_, numeric_type line_number_)
+      : static_vector_exception(ETL_ERROR_TEXT("static_vector:full", ETL_STATIC_VECTOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup static_vector
+  /// Empty exception.
+  //***************************************************************************
+  class static_vector_empty : public static_vector_exception
+  {
+  public:
+
+    static_vector_empty(string_type file_name_, numeric_type line_number_)
+      : static_vector_exception(ETL_ERROR_TEXT("static_vector:empty", ETL_STATIC_VECTOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup static_vector
+  /// Out of bounds exception.
+  //***************************************************************************
+  class static_vector_out_of_bounds : public static_vector_exception
+  {
+  public:
+
+    static_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : static_vector_exception(ETL_ERROR_TEXT("static_vector:bounds", ETL_STATIC_VECTOR_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A fixed capacity vector with in place array storage.
+  ///\tparam T        The element type. Must be default constructible and assignable.
+  ///\tparam Max_Size The maximum number of elements.
+  ///\ingroup static_vector
+  //***************************************************************************
+  template <typename T, size_t Max_Size>
+  class static_vector
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Size > 0U, "Max_Size must be greater than zero");
+
+    typedef T                                            value_type;
+    typedef T&                                           reference;
+    typedef const T&                                     const_reference;
+    typedef T*                                           pointer;
+    typedef const T*                                     const_pointer;
+    typedef T*                                           iterator;
+    typedef const T*                                     const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef size_t                                       size_type;
+    typedef ptrdiff_t                                    difference_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = Max_Size;
+
+    //*************************************************************************
+    /// Default constructor. An empty vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 static_vector()
+      : buffer()
+      , current_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs with 'n' copies of 'value'.
+    //*************************************************************************
+    ETL_CONSTEXPR14 static_vector(size_t n, const_reference value)
+      : buffer()
+      , current_size(0U)
+    {
+      assign(n, value);
+    }
+
+    //*************************************************************************
+    /// Constructs from a range.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 static_vector(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+      : buffer()
+      , current_size(0U)
+    {
+      assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructs from an initializer_list.
+    //*************************************************************************
+    ETL_CONSTEXPR14 static_vector(std::initializer_list<T> init)
+      : buffer()
+      , current_size(0U)
+    {
+      assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 iterator begin()
+    {
+      return buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the beginning of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator begin() const
+    {
+      return buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the beginning of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cbegin() const
+    {
+      return buffer;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 iterator end()
+    {
+      return buffer + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the end of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator end() const
+    {
+      return buffer + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the end of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cend() const
+    {
+      return buffer + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse end of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse end of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse end of the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at index 'i'.
+    //*************************************************************************
+    ETL_CONSTEXPR14 reference operator [](size_t i)
+    {
+      return buffer[i];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at index 'i'.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reference operator [](size_t i) const
+    {
+      return buffer[i];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at index 'i'.
+    /// If asserts or exceptions are enabled, emits an etl::static_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    ETL_CONSTEXPR14 reference at(size_t i)
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(static_vector_out_of_bounds));
+
+      return buffer[i];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at index 'i'.
+    /// If asserts or exceptions are enabled, emits an etl::static_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reference at(size_t i) const
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(static_vector_out_of_bounds));
+
+      return buffer[i];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the first element.
+    //*************************************************************************
+    ETL_CONSTEXPR14 reference front()
+    {
+      return buffer[0];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the first element.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reference front() const
+    {
+      return buffer[0];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the last element.
+    //*************************************************************************
+    ETL_CONSTEXPR14 reference back()
+    {
+      return buffer[current_size - 1U];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the last element.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_reference back() const
+    {
+      return buffer[current_size - 1U];
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the beginning of the vector data.
+    //*************************************************************************
+    ETL_CONSTEXPR14 pointer data()
+    {
+      return buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const pointer to the beginning of the vector data.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_pointer data() const
+    {
+      return buffer;
+    }
+
+    //*************************************************************************
+    /// Assigns 'n' copies of 'value'.
+    /// If asserts or exceptions are enabled, emits an etl::static_vector_full if 'n' is greater than the capacity.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void assign(size_t n, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(n <= Max_Size, ETL_ERROR(static_vector_full));
+
+      clear();
+
+      while (current_size < n)
+      {
+        buffer[current_size++] = value;
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns a range.
+    /// If asserts or exceptions are enabled, emits an etl::static_vector_full if the range is larger than the capacity.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 typename etl::enable_if<!etl::is_integral<TIterator>::value, void>::type
+      assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        ETL_ASSERT_OR_RETURN(current_size < Max_Size, ETL_ERROR(static_vector_full));
+
+        buffer[current_size++] = *first;
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a value to the end of the vector.
+    /// If asserts or exceptions are enabled, emits an etl::static_vector_full if the vector is full.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void push_back(const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(current_size < Max_Size, ETL_ERROR(static_vector_full));
+
+      buffer[current_size++] = value;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Constructs a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits an etl::static_vector_full if the vector is full.
+    //*************************************************************************
+    template <typename... TArgs>
+    ETL_CONSTEXPR14 reference emplace_back(TArgs&&... args)
+    {
+      ETL_ASSERT(current_size < Max_Size, ETL_ERROR(static_vector_full));
+
+      buffer[current_size] = T(etl::forward<TArgs>(args)...);
+
+      return buffer[current_size++];
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the last element.
+    /// If asserts or exceptions are enabled, emits an etl::static_vector_empty if the vector is empty.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void pop_back()
+    {
+      ETL_ASSERT_OR_RETURN(current_size > 0U, ETL_ERROR(static_vector_empty));
+
+      buffer[--current_size] = T();
+    }
+
+    //*************************************************************************
+    /// Inserts a value before 'position'.
+    /// If asserts or exceptions are enabled, emits an etl::static_vector_full if the vector is full.
+    //*************************************************************************
+    ETL_CONSTEXPR14 iterator insert(const_iterator position, const_reference value)
+    {
+      const size_t index = static_cast<size_t>(position - cbegin());
+
+      ETL_ASSERT(current_size < Max_Size, ETL_ERROR(static_vector_full));
+
+      for (size_t i = current_size; i > index; --i)
+      {
+        buffer[i] = buffer[i - 1U];
+      }
+
+      buffer[index] = value;
+      ++current_size;
+
+      return buffer + index;
+    }
+
+    //*************************************************************************
+    /// Erases the element at 'position'.
+    //*************************************************************************
+    ETL_CONSTEXPR14 iterator erase(const_iterator position)
+    {
+      const size_t index = static_cast<size_t>(position - cbegin());
+
+      for (size_t i = index + 1U; i < current_size; ++i)
+      {
+        buffer[i - 1U] = buffer[i];
+      }
+
+      buffer[--current_size] = T();
+
+      return buffer + index;
+    }
+
+    //*************************************************************************
+    /// Resizes the vector. New elements are default constructed.
+    /// If asserts or exceptions are enabled, emits an etl::static_vector_full if 'n' is greater than the capacity.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void resize(size_t n)
+    {
+      resize(n, T());
+    }
+
+    //*************************************************************************
+    /// Resizes the vector. New elements are copies of 'value'.
+    /// If asserts or exceptions are enabled, emits an etl::static_vector_full if 'n' is greater than the capacity.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void resize(size_t n, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(n <= Max_Size, ETL_ERROR(static_vector_full));
+
+      while (current_size > n)
+      {
+        buffer[--current_size] = T();
+      }
+
+      while (current_size < n)
+      {
+        buffer[current_size++] = value;
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the vector.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void clear()
+    {
+      while (current_size > 0U)
+      {
+        buffer[--current_size] = T();
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the vector is empty.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the vector is full.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool full() const
+    {
+      return current_size == Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t available() const
+    {
+      return Max_Size - current_size;
+    }
+
+  private:
+
+    T      buffer[Max_Size];
+    size_t current_size;
+  };
+
+  template <typename T, size_t Max_Size>
+  ETL_CONSTANT size_t static_vector<T, Max_Size>::MAX_SIZE;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup static_vector
+  //***************************************************************************
+  template <typename T, size_t Max_Size>
+  ETL_CONSTEXPR14 bool operator ==(const etl::static_vector<T, Max_Size>& lhs, const etl::static_vector<T, Max_Size>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    for (size_t i = 0U; i < lhs.size(); ++i)
+    {
+      if (!(lhs[i] == rhs[i]))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup static_vector
+  //***************************************************************************
+  template <typename T, size_t Max_Size>
+  ETL_CONSTEXPR14 bool operator !=(const etl::static_vector<T, Max_Size>& lhs, const etl::static_vector<T, Max_Size>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,321 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_BUILDER_INCLUDED
+#define ETL_STRING_BUILDER_INCLUDED
+
+#include "platform.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "string_sink.h"
+#include "type_traits.h"
+
+#include <string.h>
+#include <stddef.h>
+
+///\defgroup string_builder string_builder
+/// Builds text in place in the free space of an etl::ibasic_string.
+/// Appends only check the free space; the string's size, terminator and
+/// truncation flag are updated once, when the builder commits.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// Appends to an etl::ibasic_string, deferring the size update and the
+  /// truncation check to commit(), which is also called by the destructor.
+  /// The string must not be modified through other means while the builder
+  /// exists. Characters that do not fit are dropped.
+  /// The builder is a string sink, so etl::to_string may format into it.
+  ///\ingroup string_builder
+  //***************************************************************************
+  template <typename T>
+  class basic_string_builder
+  {
+  public:
+
+    typedef T                          value_type;
+    typedef size_t                     size_type;
+    typedef const T*                   const_iterator;
+    typedef etl::ibasic_string<T>      string_type;
+    typedef etl::basic_string_view<T>  view_type;
+
+    //*************************************************************************
+    /// Constructs a builder that appends to the current contents of 'str_'.
+    //*************************************************************************
+    explicit basic_string_builder(string_type& str_)
+      : p_string(&str_)
+      , p_buffer(str_.data())
+      , buffer_size(str_.max_size())
+      , current_size(str_.size())
+      , truncated(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor. Commits the text to the string.
+    /// Truncation sets the string's flag, but does not raise an error here.
+    //*************************************************************************
+    ~basic_string_builder()
+    {
+      update_string();
+    }
+
+    //*************************************************************************
+    /// Adds a character.
+    //*************************************************************************
+    void push_back(T c)
+    {
+      if (current_size < buffer_size)
+      {
+        p_buffer[current_size++] = c;
+      }
+      else
+      {
+        truncated = true;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds n copies of a character.
+    //*************************************************************************
+    basic_string_builder& append(size_t n, T c)
+    {
+      if (n > available())
+      {
+        n         = available();
+        truncated = true;
+      }
+
+      etl::fill_n(p_buffer + current_size, n, c);
+      current_size += n;
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Adds 'n' characters from a buffer.
+    //*************************************************************************
+    basic_string_builder& append(const T* s, size_t n)
+    {
+      if (n > available())
+      {
+        n         = available();
+        truncated = true;
+      }
+
+      if (n != 0U)
+      {
+        memcpy(p_buffer + current_size, s, n * sizeof(T));
+      }
+
+      current_size += n;
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Adds a null terminated string.
+    //*************************************************************************
+    basic_string_builder& append(const T* s)
+    {
+      return append(s, etl::strlen(s));
+    }
+
+    //*************************************************************************
+    /// Adds a string.
+    //*************************************************************************
+    basic_string_builder& append(const string_type& str)
+    {
+      return append(str.data(), str.size());
+    }
+
+    //*************************************************************************
+    /// Adds a string view.
+    //*************************************************************************
+    basic_string_builder& append(const view_type& view)
+    {
+      return append(view.data(), view.size());
+    }
+
+    //*************************************************************************
+    /// Adds a range of characters.
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<!etl::is_integral<TIterator>::value, basic_string_builder&>::type
+      append(TIterator first, TIterator last)
+    {
+      while ((first != last) && (current_size < buffer_size))
+      {
+        p_buffer[current_size++] = *first;
+        ++first;
+      }
+
+      if (first != last)
+      {
+        truncated = true;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Adds a character.
+    //*************************************************************************
+    basic_string_builder& operator <<(T c)
+    {
+      push_back(c);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Adds a null terminated string.
+    //*************************************************************************
+    basic_string_builder& operator <<(const T* s)
+    {
+      return append(s);
+    }
+
+    //*************************************************************************
+    /// Adds a string.
+    //*************************************************************************
+    basic_string_builder& operator <<(const string_type& str)
+    {
+      return append(str);
+    }
+
+    //*************************************************************************
+    /// Adds a string view.
+    //*************************************************************************
+    basic_string_builder& operator <<(const view_type& view)
+    {
+      return append(view);
+    }
+
+    //*************************************************************************
+    /// Updates the string's size, terminator and truncation flag.
+    /// If ETL_HAS_ERROR_ON_STRING_TRUNCATION is set and characters were
+    /// dropped, emits etl::string_truncation.
+    //*************************************************************************
+    void commit()
+    {
+      update_string();
+
+#if ETL_HAS_STRING_TRUNCATION_CHECKS && ETL_HAS_ERROR_ON_STRING_TRUNCATION
+      ETL_ASSERT(!truncated, ETL_ERROR(string_truncation));
+#endif
+    }
+
+    //*************************************************************************
+    /// The number of characters in the string, including those not yet committed.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// The capacity of the string.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return buffer_size;
+    }
+
+    //*************************************************************************
+    /// The number of characters that may still be added.
+    //*************************************************************************
+    size_t available() const
+    {
+      return buffer_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Were any characters dropped?
+    //*************************************************************************
+    bool is_truncated() const
+    {
+      return truncated;
+    }
+
+    //*************************************************************************
+    /// A view of the characters, including those not yet committed.
+    //*************************************************************************
+    view_type view() const
+    {
+      return view_type(p_buffer, current_size);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Writes the size, terminator and truncation flag to the string.
+    //*************************************************************************
+    void update_string()
+    {
+      p_string->current_size   = current_size;
+      p_buffer[current_size]   = 0;
+
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+      if (truncated)
+      {
+        p_string->set_truncated(true);
+      }
+#endif
+    }
+
+    // Disabled.
+    basic_string_builder(const basic_string_builder&) ETL_DELETE;
+    basic_string_builder& operator =(const basic_string_builder&) ETL_DELETE;
+
+    string_type* p_string;
+    T*           p_buffer;
+    size_t       buffer_size;
+    size_t       current_size;
+    bool         truncated;
+  };
+
+  typedef etl::basic_string_builder<char>     string_builder;
+  typedef etl::basic_string_builder<wchar_t>  wstring_builder;
+  typedef etl::basic_string_builder<char8_t>  u8string_builder;
+  typedef etl::basic_string_builder<char16_t> u16string_builder;
+  typedef etl::basic_string_builder<char32_t> u32string_builder;
+
+  //***************************************************************************
+  /// The string builder is a string sink.
+  ///\ingroup string_builder
+  //***************************************************************************
+  template <typename T>
+  struct is_string_sink<etl::basic_string_builder<T> > : etl::true_type
+  {
+  };
+}
+
+#endif
@@ -0,0 +1,490 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_STRING_INTERN_POOL_INCLUDED
+#define ETL_STRING_INTERN_POOL_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "string_view.h"
+#include "hash.h"
+#include "power.h"
+#include "fnv_1.h"
+
+#include <stdint.h>
+
+///\defgroup string_intern_pool string_intern_pool
+/// Stores unique strings contiguously in a single arena and identifies each
+/// by a compact handle. Handles from the same pool compare equal if and only
+/// if their strings are equal, so comparisons are integer compares.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for string_intern_pool
+  //***************************************************************************
+  class string_intern_pool_exception : public etl::exception
+  {
+  public:
+
+    string_intern_pool_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Pool full exception.
+  //***************************************************************************
+  class string_intern_pool_full : public string_intern_pool_exception
+  {
+  public:
+
+    string_intern_pool_full(string_type file_name_, numeric_type line_number_)
+      : string_intern_pool_exception(ETL_ERROR_TEXT("string_intern_pool:full", ETL_STRING_INTERN_POOL_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid handle exception.
+  //***************************************************************************
+  class string_intern_pool_invalid_handle : public string_intern_pool_exception
+  {
+  public:
+
+    string_intern_pool_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : string_intern_pool_exception(ETL_ERROR_TEXT("string_intern_pool:invalid handle", ETL_STRING_INTERN_POOL_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base of all string_intern_pools.
+  /// Can be used as a reference type for all pools, whatever their size.
+  ///\ingroup string_intern_pool
+  //***************************************************************************
+  class istring_intern_pool
+  {
+  public:
+
+    typedef size_t   size_type;
+    typedef uint32_t index_type;
+    typedef uint32_t hash_type;
+
+    //*************************************************************************
+    /// Identifies a string in a pool.
+    /// Handles are only comparable with others from the same pool.
+    /// A default constructed handle is invalid.
+    //*************************************************************************
+    class handle
+    {
+    public:
+
+      //***********************************
+      ETL_CONSTEXPR handle()
+        : index_value(Invalid_Index)
+        , hash_value(0U)
+      {
+      }
+
+      //***********************************
+      /// The index of the string in the pool.
+      //***********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR index_type index() const
+      {
+        return index_value;
+      }
+
+      //***********************************
+      /// The hash of the string.
+      //***********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR hash_type hash() const
+      {
+        return hash_value;
+      }
+
+      //***********************************
+      /// Returns true if the handle refers to a string.
+      //***********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR bool is_valid() const
+      {
+        return index_value != Invalid_Index;
+      }
+
+      //***********************************
+      friend ETL_CONSTEXPR bool operator ==(const handle& lhs, const handle& rhs)
+      {
+        return lhs.index_value == rhs.index_value;
+      }
+
+      //***********************************
+      friend ETL_CONSTEXPR bool operator !=(const handle& lhs, const handle& rhs)
+      {
+        return lhs.index_value != rhs.index_value;
+      }
+
+      //***********************************
+      /// Orders by index, which is the order of interning, not the order of the strings.
+      //***********************************
+      friend ETL_CONSTEXPR bool operator <(const handle& lhs, const handle& rhs)
+      {
+        return lhs.index_value < rhs.index_value;
+      }
+
+    private:
+
+      friend class istring_intern_pool;
+
+      //***********************************
+      ETL_CONSTEXPR handle(index_type index_, hash_type hash_)
+        : index_value(index_)
+        , hash_value(hash_)
+      {
+      }
+
+      index_type index_value;
+      hash_type  hash_value;
+    };
+
+    //*************************************************************************
+    /// Returns the handle of the string, adding it to the pool if it is not already there.
+    /// If the pool is full, an etl::string_intern_pool_full is raised and an invalid handle is returned.
+    //*************************************************************************
+    handle intern(const etl::string_view& text)
+    {
+      const hash_type hash = hash_of(text);
+      index_type* p_slot   = find_slot(text, hash);
+
+      if (*p_slot != Invalid_Index)
+      {
+        return handle(*p_slot, hash);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE((n_strings < max_strings) && (text.size() <= arena_available()), ETL_ERROR(string_intern_pool_full), handle());
+
+      etl::copy(text.begin(), text.end(), p_arena + arena_used);
+
+      entry& new_entry = p_entries[n_strings];
+      new_entry.offset = static_cast<index_type>(arena_used);
+      new_entry.length = static_cast<index_type>(text.size());
+      new_entry.hash   = hash;
+
+      arena_used += text.size();
+      *p_slot     = static_cast<index_type>(n_strings);
+
+      return handle(static_cast<index_type>(n_strings++), hash);
+    }
+
+    //*************************************************************************
+    /// Returns the handle of the string, or an invalid handle if it is not in the pool.
+    //*************************************************************************
+    ETL_NODISCARD
+    handle find(const etl::string_view& text) const
+    {
+      const hash_type hash = hash_of(text);
+      const index_type index = *find_slot(text, hash);
+
+      return (index != Invalid_Index) ? handle(index, hash) : handle();
+    }
+
+    //*************************************************************************
+    /// Returns true if the string is in the pool.
+    //*************************************************************************
+    ETL_NODISCARD
+    bool contains(const etl::string_view& text) const
+    {
+      return find(text).is_valid();
+    }
+
+    //*************************************************************************
+    /// Gets the string for a handle.
+    /// An invalid handle raises an etl::string_intern_pool_invalid_handle and returns an empty view.
+    //*************************************************************************
+    ETL_NODISCARD
+    etl::string_view view(const handle& h) const
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(h.index() < n_strings, ETL_ERROR(string_intern_pool_invalid_handle), etl::string_view());
+
+      const entry& e = p_entries[h.index()];
+
+      return etl::string_view(p_arena + e.offset, e.length);
+    }
+
+    //*************************************************************************
+    /// Gets the string for a handle.
+    //*************************************************************************
+    ETL_NODISCARD
+    etl::string_view operator [](const handle& h) const
+    {
+      return view(h);
+    }
+
+    //*************************************************************************
+    /// Gets the handle of the string at an index.
+    //*************************************************************************
+    ETL_NODISCARD
+    handle at(size_t index) const
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(index < n_strings, ETL_ERROR(string_intern_pool_invalid_handle), handle());
+
+      return handle(static_cast<index_type>(index), p_entries[index].hash);
+    }
+
+    //*************************************************************************
+    /// Removes all of the strings. Existing handles become invalid.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < n_slots; ++i)
+      {
+        p_slots[i] = Invalid_Index;
+      }
+
+      n_strings  = 0U;
+      arena_used = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of strings in the pool.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t size() const
+    {
+      return n_strings;
+    }
+
+    //*************************************************************************
+    /// The maximum number of strings in the pool.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t max_size() const
+    {
+      return max_strings;
+    }
+
+    //*************************************************************************
+    /// Returns true if there are no strings in the pool.
+    //*************************************************************************
+    ETL_NODISCARD
+    bool empty() const
+    {
+      return n_strings == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns true if no more strings may be added.
+    //*************************************************************************
+    ETL_NODISCARD
+    bool full() const
+    {
+      return (n_strings == max_strings) || (arena_used == arena_capacity);
+    }
+
+    //*************************************************************************
+    /// The number of characters stored.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t arena_size() const
+    {
+      return arena_used;
+    }
+
+    //*************************************************************************
+    /// The maximum number of characters that may be stored.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t arena_max_size() const
+    {
+      return arena_capacity;
+    }
+
+    //*************************************************************************
+    /// The number of characters that may still be stored.
+    //*************************************************************************
+    ETL_NODISCARD
+    size_t arena_available() const
+    {
+      return arena_capacity - arena_used;
+    }
+
+  protected:
+
+    static ETL_CONSTANT index_type Invalid_Index = 0xFFFFFFFFUL;
+
+    //*************************************************************************
+    /// The location of a string in the arena.
+    //*************************************************************************
+    struct entry
+    {
+      index_type offset;
+      index_type length;
+      hash_type  hash;
+    };
+
+    //*************************************************************************
+    /// Constructor. n_slots_ must be a power of 2 greater than max_strings_.
+    //*************************************************************************
+    istring_intern_pool(char* p_arena_, size_t arena_capacity_, entry* p_entries_, size_t max_strings_, index_type* p_slots_, size_t n_slots_)
+      : p_arena(p_arena_)
+      , arena_capacity(arena_capacity_)
+      , arena_used(0U)
+      , p_entries(p_entries_)
+      , max_strings(max_strings_)
+      , n_strings(0U)
+      , p_slots(p_slots_)
+      , n_slots(n_slots_)
+    {
+      clear();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Calculates the hash of a string.
+    //*************************************************************************
+    static hash_type hash_of(const etl::string_view& text)
+    {
+      return etl::fnv_1a_32(text.begin(), text.end()).value();
+    }
+
+    //*************************************************************************
+    /// Finds the slot that holds the string, or the empty slot where it would be added.
+    /// Open addressing with linear probing. There is always at least one empty slot.
+    //*************************************************************************
+    index_type* find_slot(const etl::string_view& text, hash_type hash) const
+    {
+      const size_t mask = n_slots - 1U;
+      size_t       slot = hash & mask;
+
+      while (p_slots[slot] != Invalid_Index)
+      {
+        const entry& e = p_entries[p_slots[slot]];
+
+        // Compare the hashes first, so that the characters are only compared for a likely match.
+        if ((e.hash == hash) &&
+            (e.length == text.size()) &&
+            etl::equal(text.begin(), text.end(), p_arena + e.offset))
+        {
+          break;
+        }
+
+        slot = (slot + 1U) & mask;
+      }
+
+      return p_slots + slot;
+    }
+
+    // Disable copy construction and assignment.
+    istring_intern_pool(const istring_intern_pool&) ETL_DELETE;
+    istring_intern_pool& operator =(const istring_intern_pool&) ETL_DELETE;
+
+    char*       p_arena;
+    size_t      arena_capacity;
+    size_t      arena_used;
+    entry*      p_entries;
+    size_t      max_strings;
+    size_t      n_strings;
+    index_type* p_slots;
+    size_t      n_slots;
+  };
+
+  //***************************************************************************
+  /// A string_intern_pool with its own storage.
+  ///\tparam Capacity    The total number of characters that may be stored.
+  ///\tparam Max_Strings The maximum number of unique strings.
+  ///\ingroup string_intern_pool
+  //***************************************************************************
+  template <size_t Capacity, size_t Max_Strings>
+  class string_intern_pool : public istring_intern_pool
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Strings > 0U, "Max_Strings must be greater than zero");
+    ETL_STATIC_ASSERT(Max_Strings < 0xFFFFFFFFUL, "Max_Strings must be representable as a 32 bit index");
+    ETL_STATIC_ASSERT(Capacity <= 0xFFFFFFFFUL, "Capacity must be representable as a 32 bit offset");
+
+    static ETL_CONSTANT size_t CAPACITY    = Capacity;
+    static ETL_CONSTANT size_t MAX_STRINGS = Max_Strings;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    string_intern_pool()
+      : istring_intern_pool(arena, Capacity, entries, Max_Strings, slots, N_Slots)
+    {
+    }
+
+  private:
+
+    // Twice as many slots as strings keeps the probe sequences short.
+    static ETL_CONSTANT size_t N_Slots = etl::power_of_2_round_up<Max_Strings * 2U>::value;
+
+    // Disable copy construction and assignment.
+    string_intern_pool(const string_intern_pool&) ETL_DELETE;
+    string_intern_pool& operator =(const string_intern_pool&) ETL_DELETE;
+
+    char       arena[(Capacity == 0U) ? 1U : Capacity];
+    entry      entries[Max_Strings];
+    index_type slots[N_Slots];
+  };
+
+  template <size_t Capacity, size_t Max_Strings>
+  ETL_CONSTANT size_t string_intern_pool<Capacity, Max_Strings>::CAPACITY;
+
+  template <size_t Capacity, size_t Max_Strings>
+  ETL_CONSTANT size_t string_intern_pool<Capacity, Max_Strings>::MAX_STRINGS;
+
+  template <size_t Capacity, size_t Max_Strings>
+  ETL_CONSTANT size_t string_intern_pool<Capacity, Max_Strings>::N_Slots;
+
+  //***************************************************************************
+  /// Hash function for string_intern_pool handles.
+  /// Uses the hash of the string held in the handle.
+  //***************************************************************************
+  template <>
+  struct hash<istring_intern_pool::handle>
+  {
+    size_t operator()(const istring_intern_pool::handle& h) const
+    {
+      return static_cast<size_t>(h.hash());
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,387 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_STRING_SINK_INCLUDED
+#define ETL_STRING_SINK_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "type_traits.h"
+#include "iterator.h"
+#include "span.h"
+#include "string_view.h"
+#include "integral_limits.h"
+
+#include <stddef.h>
+
+///\defgroup string_sink string_sink
+/// Character sinks that etl::to_string may format into, instead of an etl::istring.
+/// This allows text to be formatted directly into its final buffer.
+/// A sink has push_back and append members, like a string, and reports truncation.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// A sink that writes into a buffer, such as a transmit buffer or the free
+  /// space of an etl::byte_stream_writer.
+  /// No terminating null is written.
+  /// Characters that do not fit are dropped and the sink is marked as truncated.
+  ///\ingroup string_sink
+  //***************************************************************************
+  template <typename T>
+  class basic_span_sink
+  {
+  public:
+
+    typedef T                          value_type;
+    typedef size_t                     size_type;
+    typedef T*                         iterator;
+    typedef const T*                   const_iterator;
+    typedef etl::basic_string_view<T>  view_type;
+
+    //*************************************************************************
+    /// Constructs from a span.
+    //*************************************************************************
+    explicit basic_span_sink(etl::span<T> buffer_)
+      : p_buffer(buffer_.data())
+      , buffer_size(buffer_.size())
+      , current_size(0U)
+      , truncated(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a pointer and size.
+    //*************************************************************************
+    basic_span_sink(T* p_buffer_, size_t buffer_size_)
+      : p_buffer(p_buffer_)
+      , buffer_size(buffer_size_)
+      , current_size(0U)
+      , truncated(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a character.
+    //*************************************************************************
+    void push_back(T c)
+    {
+      if (current_size < buffer_size)
+      {
+        p_buffer[current_size++] = c;
+      }
+      else
+      {
+        truncated = true;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds n copies of a character.
+    //*************************************************************************
+    void append(size_t n, T c)
+    {
+      if (n > available())
+      {
+        n         = available();
+        truncated = true;
+      }
+
+      etl::fill_n(p_buffer + current_size, n, c);
+      current_size += n;
+    }
+
+    //*************************************************************************
+    /// Adds a range of characters.
+    //*************************************************************************
+    template <typename TIterator>
+    void append(TIterator first, TIterator last)
+    {
+      while ((first != last) && (current_size < buffer_size))
+      {
+        p_buffer[current_size++] = *first;
+        ++first;
+      }
+
+      if (first != last)
+      {
+        truncated = true;
+      }
+    }
+
+    //*************************************************************************
+    /// Empties the sink and clears the truncation flag.
+    //*************************************************************************
+    void clear()
+    {
+      current_size = 0U;
+      truncated    = false;
+    }
+
+    //*************************************************************************
+    /// The number of characters written.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Is the sink empty?
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// The size of the buffer.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return buffer_size;
+    }
+
+    //*************************************************************************
+    /// The number of characters that may still be written.
+    //*************************************************************************
+    size_t available() const
+    {
+      return buffer_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Were any characters dropped?
+    //*************************************************************************
+    bool is_truncated() const
+    {
+      return truncated;
+    }
+
+    //*************************************************************************
+    /// The start of the buffer.
+    //*************************************************************************
+    T* data()
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// The start of the buffer.
+    //*************************************************************************
+    const T* data() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// The first character written.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// One past the last character written.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_buffer + current_size;
+    }
+
+    //*************************************************************************
+    /// A view of the characters written.
+    //*************************************************************************
+    view_type view() const
+    {
+      return view_type(p_buffer, current_size);
+    }
+
+  private:
+
+    T*     p_buffer;
+    size_t buffer_size;
+    size_t current_size;
+    bool   truncated;
+  };
+
+  typedef etl::basic_span_sink<char>     span_sink;
+  typedef etl::basic_span_sink<wchar_t>  wspan_sink;
+  typedef etl::basic_span_sink<char8_t>  u8span_sink;
+  typedef etl::basic_span_sink<char16_t> u16span_sink;
+  typedef etl::basic_span_sink<char32_t> u32span_sink;
+
+  //***************************************************************************
+  /// A sink that writes to an output iterator, up to a maximum number of characters.
+  /// Characters beyond the maximum are dropped and the sink is marked as truncated.
+  ///\ingroup string_sink
+  //***************************************************************************
+  template <typename TIterator, typename T = char>
+  class basic_iterator_sink
+  {
+  public:
+
+    typedef T         value_type;
+    typedef size_t    size_type;
+    typedef TIterator iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param out_      The output iterator.
+    ///\param max_size_ The maximum number of characters to write.
+    //*************************************************************************
+    explicit basic_iterator_sink(TIterator out_, size_t max_size_ = etl::integral_limits<size_t>::max)
+      : out(out_)
+      , maximum_size(max_size_)
+      , current_size(0U)
+      , truncated(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a character.
+    //*************************************************************************
+    void push_back(T c)
+    {
+      if (current_size < maximum_size)
+      {
+        *out = c;
+        ++out;
+        ++current_size;
+      }
+      else
+      {
+        truncated = true;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds n copies of a character.
+    //*************************************************************************
+    void append(size_t n, T c)
+    {
+      while (n-- != 0U)
+      {
+        push_back(c);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of characters.
+    //*************************************************************************
+    template <typename TInputIterator>
+    void append(TInputIterator first, TInputIterator last)
+    {
+      while (first != last)
+      {
+        push_back(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// The number of characters written.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// The maximum number of characters.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Were any characters dropped?
+    //*************************************************************************
+    bool is_truncated() const
+    {
+      return truncated;
+    }
+
+    //*************************************************************************
+    /// The output iterator, past the last character written.
+    //*************************************************************************
+    TIterator get_iterator() const
+    {
+      return out;
+    }
+
+  private:
+
+    TIterator out;
+    size_t    maximum_size;
+    size_t    current_size;
+    bool      truncated;
+  };
+
+  //***************************************************************************
+  /// Makes a char iterator sink.
+  ///\ingroup string_sink
+  //***************************************************************************
+  template <typename TIterator>
+  etl::basic_iterator_sink<TIterator> make_iterator_sink(TIterator out, size_t max_size = etl::integral_limits<size_t>::max)
+  {
+    return etl::basic_iterator_sink<TIterator>(out, max_size);
+  }
+
+  //***************************************************************************
+  /// Is the type a string sink?
+  ///\ingroup string_sink
+  //***************************************************************************
+  template <typename T>
+  struct is_string_sink : etl::false_type
+  {
+  };
+
+  template <typename T>
+  struct is_string_sink<etl::basic_span_sink<T> > : etl::true_type
+  {
+  };
+
+  template <typename TIterator, typename T>
+  struct is_string_sink<etl::basic_iterator_sink<TIterator, T> > : etl::true_type
+  {
+  };
+
+#if ETL_USING_CPP17
+  template <typename T>
+  inline constexpr bool is_string_sink_v = is_string_sink<T>::value;
+#endif
+}
+
+#endif
@@ -37,9 +37,16 @@ SOFTWARE.
 #include "memory.h"
 #include "char_traits.h"
 #include "optional.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "fnv_1.h"
+
+#include "private/string_search.h"
 
 #include <ctype.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "private/minmax_push.h"
 
@@ -504,20 +511,17 @@ namespace etl
   template <typename TIterator, typename TPointer>
   TIterator find_first_of(TIterator first, TIterator last, TPointer delimiters)
   {
+    typedef typename etl::iterator_traits<TPointer>::value_type value_type;
+
+    const private_string_search::character_set<value_type> set(delimiters);
+
     TIterator itr(first);
 
     while (itr != last)
     {
-      TPointer pd = delimiters;
-
-      while (*pd != 0)
+      if (set.contains(*itr))
       {
-        if (*itr == *pd)
-        {
-          return itr;
-        }
-
-        ++pd;
+        return itr;
       }
 
       ++itr;
@@ -550,26 +554,15 @@ namespace etl
   template <typename TIterator, typename TPointer>
   TIterator find_first_not_of(TIterator first, TIterator last, TPointer delimiters)
   {
+    typedef typename etl::iterator_traits<TPointer>::value_type value_type;
+
+    const private_string_search::character_set<value_type> set(delimiters);
+
     TIterator itr(first);
 
     while (itr != last)
     {
-      TPointer pd = delimiters;
-
-      bool found = false;
-
-      while (*pd != 0)
-      {
-        if (*itr == *pd)
-        {
-          found = true;
-          break;
-        }
-
-        ++pd;
-      }
-
-      if (!found)
+      if (!set.contains(*itr))
       {
         return itr;
       }
@@ -609,6 +602,10 @@ namespace etl
       return last;
     }
 
+    typedef typename etl::iterator_traits<TPointer>::value_type value_type;
+
+    const private_string_search::character_set<value_type> set(delimiters);
+
     TIterator itr(last);
     TIterator end(first);
 
@@ -616,16 +613,9 @@ namespace etl
     {
       --itr;
 
-      TPointer pd = delimiters;
-
-      while (*pd != 0)
+      if (set.contains(*itr))
       {
-        if (*itr == *pd)
-        {
-          return itr;
-        }
-
-        ++pd;
+        return itr;
       }
     } while (itr != end);
 
@@ -661,6 +651,10 @@ namespace etl
       return last;
     }
 
+    typedef typename etl::iterator_traits<TPointer>::value_type value_type;
+
+    const private_string_search::character_set<value_type> set(delimiters);
+
     TIterator itr(last);
     TIterator end(first);
 
@@ -668,22 +662,7 @@ namespace etl
     {
       --itr;
 
-      TPointer pd = delimiters;
-
-      bool found = false;
-
-      while (*pd != 0)
-      {
-        if (*itr == *pd)
-        {
-          found = true;
-          break;
-        }
-
-        ++pd;
-      }
-
-      if (!found)
+      if (!set.contains(*itr))
       {
         return itr;
       }
@@ -844,6 +823,356 @@ namespace etl
 
     etl::transform(itr, s.end(), itr, ::tolower);
   }
+
+  namespace private_case_insensitive
+  {
+    //*************************************************************************
+    /// Eight byte characters are folded at a time where possible.
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t word_type;
+#else
+    typedef uint32_t word_type;
+#endif
+
+    /// 0x01 in every byte of a word.
+    static ETL_CONSTANT word_type Ones = etl::integral_limits<word_type>::max / 0xFFU;
+
+    //*************************************************************************
+    /// Folds an ASCII upper case character to lower case.
+    /// Other characters, including any above 0x7F, are unchanged, so the
+    /// result does not depend on the C locale.
+    //*************************************************************************
+    template <typename TChar>
+    ETL_CONSTEXPR TChar fold(TChar c)
+    {
+      return ((c >= TChar('A')) && (c <= TChar('Z'))) ? TChar(c | TChar(0x20)) : c;
+    }
+
+    //*************************************************************************
+    /// Folds every ASCII upper case byte of the word to lower case.
+    /// Each byte below 0x80 is tested for 'A' <= b <= 'Z' with two additions
+    /// whose carries land in the top bit of the byte, and cannot cross into
+    /// the next.
+    //*************************************************************************
+    inline word_type fold_word(word_type word)
+    {
+      const word_type low_bits = word & (Ones * 0x7FU);
+      const word_type at_least_a = low_bits + (Ones * (0x80U - 'A'));
+      const word_type above_z    = low_bits + (Ones * (0x80U - 'Z' - 1U));
+      const word_type is_upper   = (at_least_a ^ above_z) & ~word & (Ones * 0x80U);
+
+      return word | (is_upper >> 2U);
+    }
+
+    //*************************************************************************
+    /// Is any byte of the word zero?
+    //*************************************************************************
+    inline bool has_zero_byte(word_type word)
+    {
+      return ((word - Ones) & ~word & (Ones * 0x80U)) != 0U;
+    }
+
+    //*************************************************************************
+    template <typename TChar>
+    word_type load_word(const TChar* p)
+    {
+      word_type word;
+      memcpy(&word, p, sizeof(word_type));
+
+      return word;
+    }
+
+    //*************************************************************************
+    /// The length of the common case insensitive prefix.
+    //*************************************************************************
+    template <typename TChar>
+    size_t mismatch(const TChar* lhs, const TChar* rhs, size_t length, etl::true_type /*is byte*/)
+    {
+      size_t i = 0U;
+
+      while (((length - i) >= sizeof(word_type)) && (fold_word(load_word(lhs + i)) == fold_word(load_word(rhs + i))))
+      {
+        i += sizeof(word_type);
+      }
+
+      while ((i < length) && (fold(lhs[i]) == fold(rhs[i])))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    template <typename TChar>
+    size_t mismatch(const TChar* lhs, const TChar* rhs, size_t length, etl::false_type /*is byte*/)
+    {
+      size_t i = 0U;
+
+      while ((i < length) && (fold(lhs[i]) == fold(rhs[i])))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    template <typename TChar>
+    size_t mismatch(const TChar* lhs, const TChar* rhs, size_t length)
+    {
+      return mismatch(lhs, rhs, length, etl::integral_constant<bool, sizeof(TChar) == 1U>());
+    }
+
+    //*************************************************************************
+    /// The first position at or after pos that could match the folded character.
+    /// Whole words are skipped while none of their bytes match.
+    //*************************************************************************
+    template <typename TChar>
+    size_t find_candidate(const TChar* text, size_t pos, size_t last, TChar folded, etl::true_type /*is byte*/)
+    {
+      const word_type pattern = Ones * word_type(static_cast<unsigned char>(folded));
+
+      while (((last - pos) >= sizeof(word_type)) && !has_zero_byte(fold_word(load_word(text + pos)) ^ pattern))
+      {
+        pos += sizeof(word_type);
+      }
+
+      while ((pos < last) && (fold(text[pos]) != folded))
+      {
+        ++pos;
+      }
+
+      return pos;
+    }
+
+    //*************************************************************************
+    template <typename TChar>
+    size_t find_candidate(const TChar* text, size_t pos, size_t last, TChar folded, etl::false_type /*is byte*/)
+    {
+      while ((pos < last) && (fold(text[pos]) != folded))
+      {
+        ++pos;
+      }
+
+      return pos;
+    }
+
+    //*************************************************************************
+    template <typename TChar>
+    bool equals(const TChar* lhs, size_t lhs_length, const TChar* rhs, size_t rhs_length)
+    {
+      return (lhs_length == rhs_length) && (mismatch(lhs, rhs, lhs_length) == lhs_length);
+    }
+
+    //*************************************************************************
+    template <typename TChar>
+    int compare(const TChar* lhs, size_t lhs_length, const TChar* rhs, size_t rhs_length)
+    {
+      typedef typename etl::make_unsigned<TChar>::type unsigned_type;
+
+      const size_t length = (lhs_length < rhs_length) ? lhs_length : rhs_length;
+      const size_t i      = mismatch(lhs, rhs, length);
+
+      if (i < length)
+      {
+        return (unsigned_type(fold(lhs[i])) < unsigned_type(fold(rhs[i]))) ? -1 : 1;
+      }
+
+      return (lhs_length < rhs_length) ? -1 : ((lhs_length > rhs_length) ? 1 : 0);
+    }
+
+    //*************************************************************************
+    template <typename TChar>
+    size_t find(const TChar* text, size_t text_length, const TChar* pattern, size_t pattern_length, size_t pos)
+    {
+      const size_t npos = etl::integral_limits<size_t>::max;
+
+      if ((pos > text_length) || (pattern_length > (text_length - pos)))
+      {
+        return npos;
+      }
+
+      if (pattern_length == 0U)
+      {
+        return pos;
+      }
+
+      const TChar  first = fold(pattern[0]);
+      const size_t last  = text_length - pattern_length + 1U;
+
+      while (pos < last)
+      {
+        pos = find_candidate(text, pos, last, first, etl::integral_constant<bool, sizeof(TChar) == 1U>());
+
+        if (pos == last)
+        {
+          break;
+        }
+
+        if (mismatch(text + pos + 1U, pattern + 1U, pattern_length - 1U) == (pattern_length - 1U))
+        {
+          return pos;
+        }
+
+        ++pos;
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// FNV-1a over the folded characters, least significant byte first.
+    //*************************************************************************
+    template <typename TChar>
+    size_t hash(const TChar* text, size_t length)
+    {
+#if ETL_USING_64BIT_TYPES
+      typedef typename etl::conditional<(sizeof(size_t) >= sizeof(uint64_t)), etl::fnv_1a_policy_64, etl::fnv_1a_policy_32>::type policy_type;
+#else
+      typedef etl::fnv_1a_policy_32 policy_type;
+#endif
+      typedef typename etl::make_unsigned<TChar>::type unsigned_type;
+
+      const policy_type policy;
+      typename policy_type::value_type h = policy.initial();
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        unsigned_type c = unsigned_type(fold(text[i]));
+
+        for (size_t b = 0U; b < sizeof(TChar); ++b)
+        {
+          h = policy.add(h, uint8_t(c & 0xFFU));
+          c = unsigned_type(c >> 8U);
+        }
+      }
+
+      return size_t(h);
+    }
+
+    //*************************************************************************
+    /// The characters of a string, string view or C string.
+    //*************************************************************************
+    template <typename TString>
+    const typename TString::value_type* data_of(const TString& text)
+    {
+      return text.data();
+    }
+
+    template <typename TChar>
+    const TChar* data_of(const TChar* text)
+    {
+      return text;
+    }
+
+    template <typename TString>
+    size_t size_of(const TString& text, typename TString::value_type* = ETL_NULLPTR)
+    {
+      return size_t(text.size());
+    }
+
+    template <typename TChar>
+    size_t size_of(const TChar* text)
+    {
+      return etl::strlen(text);
+    }
+  }
+
+  //***************************************************************************
+  /// Compares two strings for equality, ignoring ASCII case.
+  /// Each may be a string, a string view or a C string.
+  //***************************************************************************
+  template <typename TString1, typename TString2>
+  bool iequals(const TString1& lhs, const TString2& rhs)
+  {
+    return private_case_insensitive::equals(private_case_insensitive::data_of(lhs),
+                                            private_case_insensitive::size_of(lhs),
+                                            private_case_insensitive::data_of(rhs),
+                                            private_case_insensitive::size_of(rhs));
+  }
+
+  //***************************************************************************
+  /// Compares two strings, ignoring ASCII case.
+  /// Returns <0, 0 or >0, as for compare.
+  //***************************************************************************
+  template <typename TString1, typename TString2>
+  int icompare(const TString1& lhs, const TString2& rhs)
+  {
+    return private_case_insensitive::compare(private_case_insensitive::data_of(lhs),
+                                             private_case_insensitive::size_of(lhs),
+                                             private_case_insensitive::data_of(rhs),
+                                             private_case_insensitive::size_of(rhs));
+  }
+
+  //***************************************************************************
+  /// Finds the first occurrence of pattern in text, at or after pos,
+  /// ignoring ASCII case.
+  /// Returns the position, or etl::string_view::npos if not found.
+  //***************************************************************************
+  template <typename TString1, typename TString2>
+  size_t ifind(const TString1& text, const TString2& pattern, size_t pos = 0U)
+  {
+    return private_case_insensitive::find(private_case_insensitive::data_of(text),
+                                          private_case_insensitive::size_of(text),
+                                          private_case_insensitive::data_of(pattern),
+                                          private_case_insensitive::size_of(pattern),
+                                          pos);
+  }
+
+  //***************************************************************************
+  /// A hash of the string that ignores ASCII case.
+  /// Strings that are iequals have the same hash.
+  //***************************************************************************
+  template <typename TString>
+  size_t ihash(const TString& text)
+  {
+    return private_case_insensitive::hash(private_case_insensitive::data_of(text),
+                                          private_case_insensitive::size_of(text));
+  }
+
+  //***************************************************************************
+  /// Transparent equality functor that ignores ASCII case.
+  //***************************************************************************
+  struct case_insensitive_equal_to
+  {
+    typedef int is_transparent;
+
+    template <typename TString1, typename TString2>
+    bool operator ()(const TString1& lhs, const TString2& rhs) const
+    {
+      return etl::iequals(lhs, rhs);
+    }
+  };
+
+  //***************************************************************************
+  /// Transparent less than functor that ignores ASCII case.
+  //***************************************************************************
+  struct case_insensitive_less
+  {
+    typedef int is_transparent;
+
+    template <typename TString1, typename TString2>
+    bool operator ()(const TString1& lhs, const TString2& rhs) const
+    {
+      return etl::icompare(lhs, rhs) < 0;
+    }
+  };
+
+  //***************************************************************************
+  /// Transparent hash functor that ignores ASCII case.
+  /// For use with etl::case_insensitive_equal_to.
+  //***************************************************************************
+  struct case_insensitive_hash
+  {
+    typedef int is_transparent;
+
+    template <typename TString>
+    size_t operator ()(const TString& text) const
+    {
+      return etl::ihash(text);
+    }
+  };
 }
 
 #include "private/minmax_pop.h"
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "hash.h"
 #include "basic_string.h"
 #include "algorithm.h"
+#include "private/string_search.h"
 #include "private/minmax_push.h"
 
 #include <stdint.h>
@@ -479,26 +480,26 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
+      if (position > size())
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
+      const size_t i = private_string_search::find(mbegin + position, size() - position, view.data(), view.size());
 
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return (i == private_string_search::npos) ? npos : position + i;
     }
 
     ETL_CONSTEXPR14 size_type find(T c, size_type position = 0) const
     {
-      return find(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      if (position >= size())
+      {
+        return npos;
+      }
+
+      const size_t i = private_string_search::find_char(mbegin + position, size() - position, c);
+
+      return (i == private_string_search::npos) ? npos : position + i;
     }
 
     ETL_CONSTEXPR14 size_type find(const T* text, size_type position, size_type count) const
@@ -516,31 +517,17 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type rfind(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if ((size() < view.size()))
-      {
-        return npos;
-      }
+      // Finds the last match that ends before position.
+      const size_t i = private_string_search::rfind(mbegin, etl::min(position, size()), view.data(), view.size());
 
-      position = etl::min(position, size());
-
-      const_iterator iposition = etl::find_end(begin(),
-        begin() + position,
-        view.begin(),
-        view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     ETL_CONSTEXPR14 size_type rfind(T c, size_type position = npos) const
     {
-      return rfind(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      const size_t i = private_string_search::rfind_char(mbegin, etl::min(position, size()), c);
+
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     ETL_CONSTEXPR14 size_type rfind(const T* text, size_type position, size_type count) const
@@ -558,30 +545,20 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (view.size() == 1U)
       {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0UL; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
-        }
+        return find(view[0], position);
       }
 
-      return npos;
+      const private_string_search::character_set<T> set(view.data(), view.size());
+      const size_t i = private_string_search::find_first_of(mbegin, position, size(), set, true);
+
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     ETL_CONSTEXPR14 size_type find_first_of(T c, size_type position = 0) const
     {
-      return find_first_of(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      return find(c, position);
     }
 
     ETL_CONSTEXPR14 size_type find_first_of(const T* text, size_type position, size_type count) const
@@ -599,37 +576,24 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_last_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if (empty())
+      if (view.size() == 1U)
       {
-        return npos;
+        return find_last_of(view[0], position);
       }
 
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const private_string_search::character_set<T> set(view.data(), view.size());
+      const size_t i = private_string_search::find_last_of(mbegin, position, size(), set, true);
 
-      while (it != rend())
-      {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     ETL_CONSTEXPR14 size_type find_last_of(T c, size_type position = npos) const
     {
-      return find_last_of(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      // Searches the characters up to and including position.
+      const size_t length = (position < size()) ? position + 1U : size();
+      const size_t i      = private_string_search::rfind_char(mbegin, length, c);
+
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     ETL_CONSTEXPR14 size_type find_last_of(const T* text, size_type position, size_type count) const
@@ -647,33 +611,10 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0UL; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-              break;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
+      const private_string_search::character_set<T> set(view.data(), view.size());
+      const size_t i = private_string_search::find_first_of(mbegin, position, size(), set, false);
 
-      return npos;
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     ETL_CONSTEXPR14 size_type find_first_not_of(T c, size_type position = 0) const
@@ -696,40 +637,10 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_last_not_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
+      const private_string_search::character_set<T> set(view.data(), view.size());
+      const size_t i = private_string_search::find_last_of(mbegin, position, size(), set, false);
 
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-            break;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (i == private_string_search::npos) ? npos : i;
     }
 
     ETL_CONSTEXPR14 size_type find_last_not_of(T c, size_type position = npos) const
@@ -898,6 +809,28 @@ namespace etl
                                                      reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
+
+  //*************************************************************************
+  /// Transparent hash function for strings and string views.
+  /// Gives the same hash for an etl::string, string view or C string with the
+  /// same text, so an unordered container keyed by etl::string may be
+  /// searched with a string view, without copying it to a key.
+  //*************************************************************************
+  template <typename T, typename TTraits = etl::char_traits<T> >
+  struct basic_string_view_hash
+  {
+    typedef int is_transparent;
+
+    size_t operator()(etl::basic_string_view<T, TTraits> text) const
+    {
+      return etl::hash<etl::basic_string_view<T, TTraits> >()(text);
+    }
+  };
+
+  typedef basic_string_view_hash<char>     string_view_hash;
+  typedef basic_string_view_hash<wchar_t>  wstring_view_hash;
+  typedef basic_string_view_hash<char16_t> u16string_view_hash;
+  typedef basic_string_view_hash<char32_t> u32string_view_hash;
 #endif
 }
 
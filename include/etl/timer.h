@@ -105,6 +105,20 @@ namespace etl
       };
     };
 
+    // Timer commands, posted to be applied by the next tick.
+    struct command
+    {
+      enum
+      {
+        None            = 0,
+        Start           = 1,
+        Start_Immediate = 2,
+        Stop            = 3
+      };
+
+      typedef uint_least8_t type;
+    };
+
     // Timer time interval.
     struct interval
     {
@@ -46,6 +46,8 @@ SOFTWARE.
 #include "expected.h"
 #include "math.h"
 
+#include "private/to_arithmetic_eisel_lemire.h"
+
 #include <math.h>
 
 namespace etl
@@ -374,10 +376,10 @@ namespace etl
     {
       //*********************************
       ETL_CONSTEXPR14
-      integral_accumulator(etl::radix::value_type radix_, TValue maximum_)
+      integral_accumulator(etl::radix::value_type radix_, TValue maximum_, TValue initial_value_ = 0)
         : radix(radix_)
         , maximum(maximum_)
-        , integral_value(0)
+        , integral_value(initial_value_)
         , conversion_status(to_arithmetic_status::Valid)
       {
       }
@@ -465,14 +467,18 @@ namespace etl
     //***************************************************************************
     struct floating_point_accumulator
     {
+      //*********************************
+      /// \param accumulate_value_ If false then only the format is checked and the
+      /// digits collected, and value() is not calculated.
       //*********************************
       ETL_CONSTEXPR14
-      floating_point_accumulator()
+      explicit floating_point_accumulator(bool accumulate_value_ = true)
         : divisor(1)
         , floating_point_value(0)
         , is_negative_mantissa(false)
         , is_negative_exponent(false)
         , expecting_sign(true)
+        , accumulate_value(accumulate_value_)
         , exponent_value(0)
         , state(Parsing_Integral)
         , conversion_status(to_arithmetic_status::Valid)
@@ -511,8 +517,14 @@ namespace etl
             else if (is_valid(c, etl::radix::decimal))
             {
               const char digit = digit_value(c, etl::radix::decimal);
-              floating_point_value *= 10;
-              is_negative_mantissa ? floating_point_value -= digit : floating_point_value += digit;
+              if (accumulate_value)
+              {
+                floating_point_value *= 10;
+                is_negative_mantissa ? floating_point_value -= digit : floating_point_value += digit;
+              }
+#if ETL_USING_64BIT_TYPES
+              decimal.add_integral_digit(digit);
+#endif
               conversion_status = to_arithmetic_status::Valid;
               expecting_sign = false;
             }
@@ -542,9 +554,15 @@ namespace etl
             else if (is_valid(c, etl::radix::decimal))
             {
               const char digit = digit_value(c, etl::radix::decimal);
-              divisor *= 10;
-              long double fraction = digit / divisor;
-              is_negative_mantissa ? floating_point_value -= fraction : floating_point_value += fraction;
+              if (accumulate_value)
+              {
+                divisor *= 10;
+                long double fraction = digit / divisor;
+                is_negative_mantissa ? floating_point_value -= fraction : floating_point_value += fraction;
+              }
+#if ETL_USING_64BIT_TYPES
+              decimal.add_fractional_digit(digit);
+#endif
               conversion_status = to_arithmetic_status::Valid;
             }
             else
@@ -626,6 +644,26 @@ namespace etl
         return exponent_value;
       }
 
+      //*********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR14
+      bool is_negative() const
+      {
+        return is_negative_mantissa;
+      }
+
+#if ETL_USING_64BIT_TYPES
+      //*********************************
+      /// The leading digits of the mantissa, for correctly rounded conversion.
+      //*********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR14
+      const decimal_significand& significand() const
+      {
+        return decimal;
+      }
+#endif
+
     private:
 
       enum
@@ -640,9 +678,13 @@ namespace etl
       bool is_negative_mantissa;
       bool is_negative_exponent;
       bool expecting_sign;
+      bool accumulate_value;
       int  exponent_value;
       int  state;
       to_arithmetic_status conversion_status;
+#if ETL_USING_64BIT_TYPES
+      decimal_significand decimal;
+#endif
     };
 
     //***************************************************************************
@@ -677,6 +719,55 @@ namespace etl
     };
 #endif
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Loads eight characters into a word, the first character in the lowest byte.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    uint64_t load_eight_chars(const TChar* p)
+    {
+      uint64_t word = 0U;
+
+      for (int i = 7; i >= 0; --i)
+      {
+        word = (word << 8U) | static_cast<uint8_t>(convert(p[i]));
+      }
+
+      return word;
+    }
+
+    //***************************************************************************
+    /// Checks that all eight characters in the word are decimal digits.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    bool is_eight_decimal_digits(const uint64_t word)
+    {
+      // The high nibble of every byte must be 3, and adding 6 must not carry out of the low nibble.
+      return (((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U)) == 0x3333333333333333ULL);
+    }
+
+    //***************************************************************************
+    /// Converts eight decimal digits in a word to their value.
+    /// Pairs of digits, then pairs of pairs, are combined in parallel.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    uint32_t eight_decimal_digits_value(uint64_t word)
+    {
+      word -= 0x3030303030303030ULL;
+      word  = (word * 10U) + (word >> 8U);
+      word  = (((word & 0x000000FF000000FFULL) * (100U + (1000000ULL << 32U))) +
+               (((word >> 16U) & 0x000000FF000000FFULL) * (1U + (10000ULL << 32U)))) >> 32U;
+
+      return static_cast<uint32_t>(word);
+    }
+#endif
+
     //***************************************************************************
     /// Text to integral from view, radix value and maximum.
     //***************************************************************************
@@ -693,7 +784,36 @@ namespace etl
       typename etl::basic_string_view<TChar>::const_iterator       itr     = view.begin();
       const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
 
-      integral_accumulator<TAccumulatorType> accumulator(radix, maximum);
+      TAccumulatorType initial_value = 0;
+
+#if ETL_USING_64BIT_TYPES
+      // Decimal digits are accumulated eight at a time while they are valid and cannot overflow.
+      // Anything else is left for the character by character loop, which sets the status.
+      if (radix == etl::radix::decimal)
+      {
+        while ((itr_end - itr) >= 8)
+        {
+          const uint64_t word = load_eight_chars(itr);
+
+          if (!is_eight_decimal_digits(word))
+          {
+            break;
+          }
+
+          const uint32_t block = eight_decimal_digits_value(word);
+
+          if ((block > maximum) || (initial_value > ((maximum - block) / 100000000U)))
+          {
+            break;
+          }
+
+          initial_value = (initial_value * 100000000U) + block;
+          itr += 8;
+        }
+      }
+#endif
+
+      integral_accumulator<TAccumulatorType> accumulator(radix, maximum, initial_value);
 
       while ((itr != itr_end) && accumulator.add(convert(*itr)))
       {
@@ -901,7 +1021,12 @@ namespace etl
     }
     else
     {
+#if ETL_USING_64BIT_TYPES
+      // The long double value is only needed if the type cannot be correctly rounded from the digits.
+      floating_point_accumulator accumulator(!private_eisel_lemire::binary_format<TValue>::Is_Supported);
+#else
       floating_point_accumulator accumulator;
+#endif
 
       typename etl::basic_string_view<TChar>::const_iterator itr           = view.begin();
       const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
@@ -916,10 +1041,18 @@ namespace etl
 
       if (result.has_value())
       {
-        TValue value = static_cast<TValue>(accumulator.value());
-        int exponent = accumulator.exponent();
+        TValue value = 0;
 
-        value *= pow(static_cast<TValue>(10.0), static_cast<TValue>(exponent));
+#if ETL_USING_64BIT_TYPES
+        // float and double are correctly rounded from the decimal digits.
+        if (!decimal_to_floating_point(accumulator.significand(), accumulator.exponent(), accumulator.is_negative(), view.begin(), view.end(), value))
+#endif
+        {
+          value = static_cast<TValue>(accumulator.value());
+          int exponent = accumulator.exponent();
+
+          value *= pow(static_cast<TValue>(10.0), static_cast<TValue>(exponent));
+        }
 
         // Check that the result is a valid floating point number.
         if (etl::is_infinity(value))
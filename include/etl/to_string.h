@@ -37,6 +37,7 @@ SOFTWARE.
 #include "type_traits.h"
 #include "string.h"
 #include "format_spec.h"
+#include "string_sink.h"
 #include "private/to_string_helper.h"
 
 namespace etl
@@ -144,6 +145,139 @@ namespace etl
 
     return str;
   }
+
+  namespace private_to_string
+  {
+    //*************************************************************************
+    /// Is T etl::istring or derived from it?
+    /// is_base_of is only evaluated for classes, as it does not compile for
+    /// other types without the STL or the compiler built-ins.
+    //*************************************************************************
+    template <typename T>
+    struct is_istring : etl::conditional<etl::is_class<T>::value, etl::is_base_of<etl::istring, T>, etl::false_type>::type
+    {
+    };
+  }
+
+  //***************************************************************************
+  /// Default format spec.
+  /// String sink.
+  /// !etl::istring (or derived) && !etl::string_view
+  //***************************************************************************
+  template <typename T, typename TSink>
+  typename etl::enable_if<etl::is_string_sink<TSink>::value && !private_to_string::is_istring<T>::value && !etl::is_same<T, etl::string_view>::value, TSink&>::type
+    to_string(const T value, TSink& sink)
+  {
+    etl::format_spec format;
+
+    private_to_string::add_value(value, sink, format);
+
+    return sink;
+  }
+
+  //***************************************************************************
+  /// Supplied format spec.
+  /// String sink.
+  /// !etl::istring (or derived) && !etl::string_view
+  //***************************************************************************
+  template <typename T, typename TSink>
+  typename etl::enable_if<etl::is_string_sink<TSink>::value && !private_to_string::is_istring<T>::value && !etl::is_same<T, etl::string_view>::value, TSink&>::type
+    to_string(const T value, TSink& sink, const etl::format_spec& format)
+  {
+    private_to_string::add_value(value, sink, format);
+
+    return sink;
+  }
+
+  //***************************************************************************
+  /// Default format spec.
+  /// String sink.
+  /// !etl::istring (or derived) && !etl::string_view
+  //***************************************************************************
+  template <typename T, typename TSink>
+  typename etl::enable_if<etl::is_string_sink<TSink>::value && !private_to_string::is_istring<T>::value && !etl::is_same<T, etl::string_view>::value, TSink&>::type
+    to_string(const T value, uint32_t denominator_exponent, TSink& sink)
+  {
+    etl::format_spec format;
+
+    private_to_string::add_value(value, denominator_exponent, sink, format);
+
+    return sink;
+  }
+
+  //***************************************************************************
+  /// Supplied format spec.
+  /// String sink.
+  /// !etl::istring (or derived) && !etl::string_view
+  //***************************************************************************
+  template <typename T, typename TSink>
+  typename etl::enable_if<etl::is_string_sink<TSink>::value && !private_to_string::is_istring<T>::value && !etl::is_same<T, etl::string_view>::value, TSink&>::type
+    to_string(const T value, uint32_t denominator_exponent, TSink& sink, const etl::format_spec& format)
+  {
+    private_to_string::add_value(value, denominator_exponent, sink, format);
+
+    return sink;
+  }
+
+  //***************************************************************************
+  /// Default format spec.
+  /// String sink.
+  /// etl::istring
+  //***************************************************************************
+  template <typename TSink>
+  typename etl::enable_if<etl::is_string_sink<TSink>::value, TSink&>::type
+    to_string(const etl::istring& value, TSink& sink)
+  {
+    etl::format_spec format;
+
+    private_to_string::add_aligned(sink, value.begin(), value.end(), format);
+
+    return sink;
+  }
+
+  //***************************************************************************
+  /// Supplied format spec.
+  /// String sink.
+  /// etl::istring
+  //***************************************************************************
+  template <typename TSink>
+  typename etl::enable_if<etl::is_string_sink<TSink>::value, TSink&>::type
+    to_string(const etl::istring& value, TSink& sink, const etl::format_spec& format)
+  {
+    private_to_string::add_aligned(sink, value.begin(), value.end(), format);
+
+    return sink;
+  }
+
+  //***************************************************************************
+  /// Default format spec.
+  /// String sink.
+  /// etl::string_view
+  //***************************************************************************
+  template <typename TSink>
+  typename etl::enable_if<etl::is_string_sink<TSink>::value, TSink&>::type
+    to_string(etl::string_view value, TSink& sink)
+  {
+    etl::format_spec format;
+
+    private_to_string::add_aligned(sink, value.begin(), value.end(), format);
+
+    return sink;
+  }
+
+  //***************************************************************************
+  /// Supplied format spec.
+  /// String sink.
+  /// etl::string_view
+  //***************************************************************************
+  template <typename TSink>
+  typename etl::enable_if<etl::is_string_sink<TSink>::value, TSink&>::type
+    to_string(etl::string_view value, TSink& sink, const etl::format_spec& format)
+  {
+    private_to_string::add_aligned(sink, value.begin(), value.end(), format);
+
+    return sink;
+  }
 }
 
 #endif
@@ -0,0 +1,583 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TOKEN_BUCKET_INCLUDED
+#define ETL_TOKEN_BUCKET_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup token_bucket token_bucket
+/// Rate limiters that refill lazily from a caller supplied timestamp.
+/// There are no timers. Each call works out what has been earned since the
+/// last one. Timestamps are free running uint32_t ticks in any unit, and may
+/// wrap, but calls must be less than 2^31 ticks apart. A time before the
+/// last one is treated as the last one. The rate is 'tokens' per 'period' ticks.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception for token buckets.
+  ///\ingroup token_bucket
+  //***************************************************************************
+  class token_bucket_exception : public etl::exception
+  {
+  public:
+
+    token_bucket_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The rate, capacity or period are zero, or capacity * period is more than 32 bits.
+  ///\ingroup token_bucket
+  //***************************************************************************
+  class token_bucket_invalid_rate : public etl::token_bucket_exception
+  {
+  public:
+
+    token_bucket_invalid_rate(string_type file_name_, numeric_type line_number_)
+      : etl::token_bucket_exception(ETL_ERROR_TEXT("token_bucket:invalid rate", ETL_TOKEN_BUCKET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_token_bucket
+  {
+    //*************************************************************************
+    /// The fixed rate shared by the buckets.
+    /// Levels are held in 'units', where one token is 'period' units and each
+    /// tick earns 'tokens' units, so that there is no rounding.
+    //*************************************************************************
+    class rate
+    {
+    public:
+
+      //***********************************
+      rate(uint32_t capacity_, uint32_t tokens_, uint32_t period_)
+        : capacity_units(capacity_ * period_)
+        , tokens(tokens_)
+        , period(period_)
+      {
+        ETL_ASSERT((capacity_ != 0U) && (tokens_ != 0U) && (period_ != 0U), ETL_ERROR(etl::token_bucket_invalid_rate));
+        ETL_ASSERT((capacity_units / period_) == capacity_, ETL_ERROR(etl::token_bucket_invalid_rate));
+      }
+
+      //***********************************
+      /// The level after 'elapsed' ticks have earned units, up to the capacity.
+      //***********************************
+      uint32_t fill(uint32_t level, uint32_t elapsed) const
+      {
+        const uint32_t missing = capacity_units - level;
+
+        return (elapsed > (missing / tokens)) ? capacity_units : level + (elapsed * tokens);
+      }
+
+      //***********************************
+      /// The level after 'elapsed' ticks have drained units, down to zero.
+      //***********************************
+      uint32_t drain(uint32_t level, uint32_t elapsed) const
+      {
+        return (elapsed > (level / tokens)) ? 0U : level - (elapsed * tokens);
+      }
+
+      //***********************************
+      /// The units for n tokens, or more than the capacity if it would not fit.
+      //***********************************
+      uint32_t units(uint32_t n) const
+      {
+        return (n > capacity()) ? capacity_units + 1U : n * period;
+      }
+
+      //***********************************
+      /// The ticks needed to earn 'needed' units.
+      //***********************************
+      uint32_t ticks_for(uint32_t needed) const
+      {
+        return (needed / tokens) + (((needed % tokens) != 0U) ? 1U : 0U);
+      }
+
+      //***********************************
+      uint32_t capacity() const
+      {
+        return capacity_units / period;
+      }
+
+      const uint32_t capacity_units;
+      const uint32_t tokens;
+      const uint32_t period;
+    };
+
+    //*************************************************************************
+    /// The ticks since 'last', or zero if 'now' is before it.
+    //*************************************************************************
+    inline uint32_t elapsed(uint32_t now, uint32_t last)
+    {
+      const uint32_t delta = now - last;
+
+      return (delta > UINT32_C(0x7FFFFFFF)) ? 0U : delta;
+    }
+
+    //*************************************************************************
+    /// The level and time of a bucket.
+    //*************************************************************************
+    struct bucket
+    {
+      uint32_t level;
+      uint32_t last;
+
+      //***********************************
+      /// Brings the level up to date with 'now'.
+      //***********************************
+      void refill(const rate& r, uint32_t now)
+      {
+        const uint32_t delta = elapsed(now, last);
+
+        level = r.fill(level, delta);
+        last += delta;
+      }
+
+      //***********************************
+      bool try_acquire(const rate& r, uint32_t now, uint32_t n)
+      {
+        refill(r, now);
+
+        const uint32_t needed = r.units(n);
+
+        if (needed <= level)
+        {
+          level -= needed;
+          return true;
+        }
+
+        return false;
+      }
+
+      //***********************************
+      uint32_t time_until_available(const rate& r, uint32_t now, uint32_t n)
+      {
+        refill(r, now);
+
+        const uint32_t needed = r.units(n);
+
+        if (needed > r.capacity_units)
+        {
+          return UINT32_MAX;
+        }
+
+        return (needed <= level) ? 0U : r.ticks_for(needed - level);
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A token bucket.
+  /// Holds up to 'capacity' tokens, earning 'tokens' every 'period' ticks.
+  /// try_acquire is O(1) and takes tokens only if there are enough.
+  ///\ingroup token_bucket
+  //***************************************************************************
+  class token_bucket
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param capacity The most tokens held. The largest burst.
+    /// \param tokens   The tokens earned every 'period'.
+    /// \param period   The ticks over which 'tokens' are earned.
+    /// \param now      The current time.
+    /// \param full     <b>true</b> to start with 'capacity' tokens, otherwise none.
+    //*************************************************************************
+    token_bucket(uint32_t capacity, uint32_t tokens, uint32_t period, uint32_t now, bool full = true)
+      : r(capacity, tokens, period)
+    {
+      reset(now, full);
+    }
+
+    //*************************************************************************
+    /// Takes n tokens, if there are enough.
+    /// Returns <b>true</b> if they were taken.
+    //*************************************************************************
+    bool try_acquire(uint32_t now, uint32_t n = 1U)
+    {
+      return b.try_acquire(r, now, n);
+    }
+
+    //*************************************************************************
+    /// Gets the whole number of tokens available.
+    //*************************************************************************
+    uint32_t available(uint32_t now)
+    {
+      b.refill(r, now);
+
+      return b.level / r.period;
+    }
+
+    //*************************************************************************
+    /// Gets the ticks until n tokens will be available.
+    /// Returns 0 if they are available now, or UINT32_MAX if n is more than the capacity.
+    //*************************************************************************
+    uint32_t time_until_available(uint32_t now, uint32_t n = 1U)
+    {
+      return b.time_until_available(r, now, n);
+    }
+
+    //*************************************************************************
+    /// Refills, or empties, the bucket.
+    //*************************************************************************
+    void reset(uint32_t now, bool full = true)
+    {
+      b.level = full ? r.capacity_units : 0U;
+      b.last  = now;
+    }
+
+    //*************************************************************************
+    /// Gets the capacity in tokens.
+    //*************************************************************************
+    uint32_t capacity() const
+    {
+      return r.capacity();
+    }
+
+  private:
+
+    private_token_bucket::rate   r;
+    private_token_bucket::bucket b;
+  };
+
+  //***************************************************************************
+  /// A bank of Size token buckets that share one rate, such as one per channel.
+  ///\ingroup token_bucket
+  //***************************************************************************
+  template <size_t Size>
+  class token_bucket_array
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param capacity The most tokens held by each bucket.
+    /// \param tokens   The tokens earned every 'period'.
+    /// \param period   The ticks over which 'tokens' are earned.
+    /// \param now      The current time.
+    /// \param full     <b>true</b> to start with 'capacity' tokens, otherwise none.
+    //*************************************************************************
+    token_bucket_array(uint32_t capacity, uint32_t tokens, uint32_t period, uint32_t now, bool full = true)
+      : r(capacity, tokens, period)
+    {
+      reset_all(now, full);
+    }
+
+    //*************************************************************************
+    /// Takes n tokens from a bucket, if there are enough.
+    //*************************************************************************
+    bool try_acquire(size_t index, uint32_t now, uint32_t n = 1U)
+    {
+      return buckets[index].try_acquire(r, now, n);
+    }
+
+    //*************************************************************************
+    /// Gets the whole number of tokens available in a bucket.
+    //*************************************************************************
+    uint32_t available(size_t index, uint32_t now)
+    {
+      buckets[index].refill(r, now);
+
+      return buckets[index].level / r.period;
+    }
+
+    //*************************************************************************
+    /// Gets the ticks until n tokens will be available in a bucket.
+    //*************************************************************************
+    uint32_t time_until_available(size_t index, uint32_t now, uint32_t n = 1U)
+    {
+      return buckets[index].time_until_available(r, now, n);
+    }
+
+    //*************************************************************************
+    /// Refills, or empties, every bucket.
+    //*************************************************************************
+    void reset_all(uint32_t now, bool full = true)
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        reset(i, now, full);
+      }
+    }
+
+    //*************************************************************************
+    /// Refills, or empties, a bucket.
+    //*************************************************************************
+    void reset(size_t index, uint32_t now, bool full = true)
+    {
+      buckets[index].level = full ? r.capacity_units : 0U;
+      buckets[index].last  = now;
+    }
+
+    //*************************************************************************
+    /// Gets the capacity of each bucket in tokens.
+    //*************************************************************************
+    uint32_t capacity() const
+    {
+      return r.capacity();
+    }
+
+    //*************************************************************************
+    /// Gets the number of buckets.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return Size;
+    }
+
+  private:
+
+    private_token_bucket::rate   r;
+    private_token_bucket::bucket buckets[Size];
+  };
+
+#if ETL_HAS_ATOMIC && ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// A token bucket that may be shared by several producers.
+  /// The level and time are held in one 64 bit atomic, updated by compare and
+  /// exchange, so try_acquire is lock free where 64 bit atomics are.
+  ///\ingroup token_bucket
+  //***************************************************************************
+  class atomic_token_bucket
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param capacity The most tokens held. The largest burst.
+    /// \param tokens   The tokens earned every 'period'.
+    /// \param period   The ticks over which 'tokens' are earned.
+    /// \param now      The current time.
+    /// \param full     <b>true</b> to start with 'capacity' tokens, otherwise none.
+    //*************************************************************************
+    atomic_token_bucket(uint32_t capacity, uint32_t tokens, uint32_t period, uint32_t now, bool full = true)
+      : r(capacity, tokens, period)
+    {
+      reset(now, full);
+    }
+
+    //*************************************************************************
+    /// Takes n tokens, if there are enough.
+    /// Returns <b>true</b> if they were taken.
+    //*************************************************************************
+    bool try_acquire(uint32_t now, uint32_t n = 1U)
+    {
+      const uint32_t needed = r.units(n);
+
+      uint64_t expected = state.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        private_token_bucket::bucket b = unpack(expected);
+
+        b.refill(r, now);
+
+        if (needed > b.level)
+        {
+          return false;
+        }
+
+        b.level -= needed;
+
+        if (state.compare_exchange_weak(expected, pack(b), etl::memory_order_acq_rel, etl::memory_order_relaxed))
+        {
+          return true;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the whole number of tokens available.
+    //*************************************************************************
+    uint32_t available(uint32_t now) const
+    {
+      private_token_bucket::bucket b = unpack(state.load(etl::memory_order_relaxed));
+
+      b.refill(r, now);
+
+      return b.level / r.period;
+    }
+
+    //*************************************************************************
+    /// Refills, or empties, the bucket.
+    //*************************************************************************
+    void reset(uint32_t now, bool full = true)
+    {
+      private_token_bucket::bucket b;
+
+      b.level = full ? r.capacity_units : 0U;
+      b.last  = now;
+
+      state.store(pack(b), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Gets the capacity in tokens.
+    //*************************************************************************
+    uint32_t capacity() const
+    {
+      return r.capacity();
+    }
+
+  private:
+
+    //*************************************************************************
+    static uint64_t pack(const private_token_bucket::bucket& b)
+    {
+      return (uint64_t(b.last) << 32U) | b.level;
+    }
+
+    //*************************************************************************
+    static private_token_bucket::bucket unpack(uint64_t value)
+    {
+      private_token_bucket::bucket b;
+
+      b.level = uint32_t(value);
+      b.last  = uint32_t(value >> 32U);
+
+      return b;
+    }
+
+    private_token_bucket::rate r;
+    etl::atomic<uint64_t>      state; ///< The last time in the top half, the level in the bottom.
+  };
+#endif
+
+  //***************************************************************************
+  /// A leaky bucket, as a meter.
+  /// Holds up to 'capacity', and drains at 'tokens' every 'period' ticks.
+  /// try_add succeeds only if there is room, which smooths bursts down to the
+  /// drain rate.
+  ///\ingroup token_bucket
+  //***************************************************************************
+  class leaky_bucket
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor. Starts empty.
+    /// \param capacity The most held.
+    /// \param tokens   The amount drained every 'period'.
+    /// \param period   The ticks over which 'tokens' are drained.
+    /// \param now      The current time.
+    //*************************************************************************
+    leaky_bucket(uint32_t capacity, uint32_t tokens, uint32_t period, uint32_t now)
+      : r(capacity, tokens, period)
+    {
+      reset(now);
+    }
+
+    //*************************************************************************
+    /// Adds n, if there is room.
+    /// Returns <b>true</b> if they were added.
+    //*************************************************************************
+    bool try_add(uint32_t now, uint32_t n = 1U)
+    {
+      drain(now);
+
+      const uint32_t added = r.units(n);
+
+      if (added <= (r.capacity_units - b.level))
+      {
+        b.level += added;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Gets the level, rounded up to a whole number.
+    //*************************************************************************
+    uint32_t level(uint32_t now)
+    {
+      drain(now);
+
+      return (b.level / r.period) + (((b.level % r.period) != 0U) ? 1U : 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the ticks until the bucket is empty.
+    //*************************************************************************
+    uint32_t time_until_empty(uint32_t now)
+    {
+      drain(now);
+
+      return r.ticks_for(b.level);
+    }
+
+    //*************************************************************************
+    /// Empties the bucket.
+    //*************************************************************************
+    void reset(uint32_t now)
+    {
+      b.level = 0U;
+      b.last  = now;
+    }
+
+    //*************************************************************************
+    /// Gets the capacity.
+    //*************************************************************************
+    uint32_t capacity() const
+    {
+      return r.capacity();
+    }
+
+  private:
+
+    //*************************************************************************
+    void drain(uint32_t now)
+    {
+      const uint32_t delta = private_token_bucket::elapsed(now, b.last);
+
+      b.level = r.drain(b.level, delta);
+      b.last += delta;
+    }
+
+    private_token_bucket::rate   r;
+    private_token_bucket::bucket b;
+  };
+}
+
+#endif
@@ -0,0 +1,314 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_TOKENIZER_INCLUDED
+#define ETL_TOKENIZER_INCLUDED
+
+#include "platform.h"
+#include "string_view.h"
+#include "iterator.h"
+#include "char_traits.h"
+
+#include "private/string_search.h"
+
+#include <stddef.h>
+
+///\defgroup tokenizer tokenizer
+/// A lazy range of the tokens in a string view.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// Splits text into tokens, separated by any of a set of delimiters.
+  /// Tokens are views of the original text and are found lazily, one per
+  /// iterator increment, so nothing is copied or allocated.
+  /// The delimiter set is converted to a bitmap on construction.
+  /// Optionally, delimiters between quote characters do not split a token.
+  /// A token that starts and ends with the quote character is returned
+  /// without them.
+  /// The text and delimiters must outlive the tokenizer and its iterators.
+  ///\ingroup tokenizer
+  //***************************************************************************
+  template <typename T, typename TTraits = etl::char_traits<T> >
+  class basic_tokenizer
+  {
+  public:
+
+    typedef etl::basic_string_view<T, TTraits> view_type;
+    typedef T                                  value_type;
+    typedef size_t                             size_type;
+
+    //*************************************************************************
+    /// Forward iterator over the tokens.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, view_type>
+    {
+    public:
+
+      friend class basic_tokenizer;
+
+      //***********************************
+      ETL_CONSTEXPR14 const_iterator()
+        : p_tokenizer(ETL_NULLPTR)
+        , token()
+        , next_position(0U)
+        , is_end(true)
+      {
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 const_iterator& operator ++()
+      {
+        find_next();
+        return *this;
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        find_next();
+        return temp;
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 const view_type& operator *() const
+      {
+        return token;
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 const view_type* operator ->() const
+      {
+        return &token;
+      }
+
+      //***********************************
+      friend ETL_CONSTEXPR14 bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.is_end == rhs.is_end) && (lhs.is_end || (lhs.next_position == rhs.next_position));
+      }
+
+      //***********************************
+      friend ETL_CONSTEXPR14 bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //***********************************
+      /// Iterator at the first token.
+      //***********************************
+      ETL_CONSTEXPR14 explicit const_iterator(const basic_tokenizer& tokenizer)
+        : p_tokenizer(&tokenizer)
+        , token()
+        , next_position(0U)
+        , is_end(false)
+      {
+        find_next();
+      }
+
+      //***********************************
+      /// Finds the next token, skipping empty ones if required.
+      /// next_position is npos once the last token has been found.
+      //***********************************
+      ETL_CONSTEXPR14 void find_next()
+      {
+        const view_type& text = p_tokenizer->text;
+
+        while (next_position != view_type::npos)
+        {
+          const size_t start = next_position;
+          size_t       end   = p_tokenizer->find_delimiter(start);
+
+          if (end == view_type::npos)
+          {
+            next_position = view_type::npos;
+            end           = text.size();
+          }
+          else
+          {
+            next_position = end + 1U;
+          }
+
+          size_t length = end - start;
+
+          if ((length != 0U) || !p_tokenizer->ignore_empty_tokens)
+          {
+            size_t first = start;
+
+            if (p_tokenizer->has_quote && (length >= 2U) &&
+                TTraits::eq(text[start], p_tokenizer->quote) &&
+                TTraits::eq(text[end - 1U], p_tokenizer->quote))
+            {
+              ++first;
+              length -= 2U;
+            }
+
+            token = view_type(text.data() + first, length);
+            return;
+          }
+        }
+
+        token  = view_type();
+        is_end = true;
+      }
+
+      const basic_tokenizer* p_tokenizer;
+      view_type              token;
+      size_t                 next_position;
+      bool                   is_end;
+    };
+
+    typedef const_iterator iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param text_                The text to split.
+    ///\param delimiters_          The delimiter characters.
+    ///\param ignore_empty_tokens_ If true, empty tokens between adjacent delimiters are skipped.
+    //*************************************************************************
+    ETL_CONSTEXPR14 basic_tokenizer(const view_type& text_, const view_type& delimiters_, bool ignore_empty_tokens_ = false)
+      : text(text_)
+      , delimiters(delimiters_.data(), delimiters_.size())
+      , ignore_empty_tokens(ignore_empty_tokens_)
+      , has_quote(false)
+      , quote(T(0))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor with quote handling.
+    ///\param text_                The text to split.
+    ///\param delimiters_          The delimiter characters.
+    ///\param ignore_empty_tokens_ If true, empty tokens between adjacent delimiters are skipped.
+    ///\param quote_               Delimiters between pairs of this character do not split tokens.
+    //*************************************************************************
+    ETL_CONSTEXPR14 basic_tokenizer(const view_type& text_, const view_type& delimiters_, bool ignore_empty_tokens_, T quote_)
+      : text(text_)
+      , delimiters(delimiters_.data(), delimiters_.size())
+      , ignore_empty_tokens(ignore_empty_tokens_)
+      , has_quote(true)
+      , quote(quote_)
+    {
+    }
+
+    //*************************************************************************
+    /// Iterator to the first token.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator begin() const
+    {
+      return const_iterator(*this);
+    }
+
+    //*************************************************************************
+    /// Iterator to the first token.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cbegin() const
+    {
+      return const_iterator(*this);
+    }
+
+    //*************************************************************************
+    /// Iterator past the last token.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator end() const
+    {
+      return const_iterator();
+    }
+
+    //*************************************************************************
+    /// Iterator past the last token.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cend() const
+    {
+      return const_iterator();
+    }
+
+    //*************************************************************************
+    /// The text being split.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const view_type& view() const
+    {
+      return text;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the next delimiter at or after position that is not quoted.
+    /// Returns npos if there is none.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_delimiter(size_t position) const
+    {
+      if (!has_quote)
+      {
+        const size_t result = etl::private_string_search::find_first_of(text.data(), position, text.size(), delimiters, true);
+
+        return (result == etl::private_string_search::npos) ? view_type::npos : result;
+      }
+
+      bool is_quoted = false;
+
+      for (size_t i = position; i < text.size(); ++i)
+      {
+        const T c = text[i];
+
+        if (TTraits::eq(c, quote))
+        {
+          is_quoted = !is_quoted;
+        }
+        else if (!is_quoted && delimiters.contains(c))
+        {
+          return i;
+        }
+      }
+
+      return view_type::npos;
+    }
+
+    view_type                                    text;
+    etl::private_string_search::character_set<T> delimiters;
+    bool                                         ignore_empty_tokens;
+    bool                                         has_quote;
+    T                                            quote;
+  };
+
+  typedef etl::basic_tokenizer<char>     tokenizer;
+  typedef etl::basic_tokenizer<wchar_t>  wtokenizer;
+  typedef etl::basic_tokenizer<char8_t>  u8tokenizer;
+  typedef etl::basic_tokenizer<char16_t> u16tokenizer;
+  typedef etl::basic_tokenizer<char32_t> u32tokenizer;
+}
+
+#endif
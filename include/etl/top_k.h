@@ -0,0 +1,232 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TOP_K_INCLUDED
+#define ETL_TOP_K_INCLUDED
+
+#include "platform.h"
+#include "priority_queue.h"
+#include "vector.h"
+#include "functional.h"
+#include "algorithm.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup top_k top_k
+/// Keeps the K greatest values seen in a stream, in O(log K) per value.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_top_k
+  {
+    //*************************************************************************
+    /// Reverses the arguments of a comparison, so that the priority queue
+    /// keeps the least of the kept values at the top.
+    //*************************************************************************
+    template <typename T, typename TCompare>
+    struct reversed_compare
+    {
+      bool operator()(const T& lhs, const T& rhs) const
+      {
+        return TCompare()(rhs, lhs);
+      }
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup top_k
+  /// Streaming top K accumulator.
+  /// Keeps the K values that are greatest by TCompare, from any number pushed.
+  /// Built on a priority queue whose top is the least of the kept values, so
+  /// a new value is rejected with one comparison once the accumulator is full.
+  /// \tparam T        The type of the values.
+  /// \tparam K        The number of values to keep.
+  /// \tparam TCompare The comparison. The default keeps the K largest.
+  //***************************************************************************
+  template <typename T, const size_t K, typename TCompare = etl::less<T> >
+  class top_k
+  {
+  public:
+
+    typedef T        value_type;
+    typedef TCompare compare_type;
+    typedef size_t   size_type;
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(K);
+
+    ETL_STATIC_ASSERT(K > 0U, "top_k must keep at least one value");
+
+    //*************************************************************************
+    /// Offers a value.
+    /// Kept if fewer than K values are held, or if greater than the least of
+    /// them, which is then discarded.
+    ///\return <b>true</b> if the value was kept.
+    //*************************************************************************
+    bool push(const T& value)
+    {
+      if (!queue.full())
+      {
+        queue.push(value);
+        return true;
+      }
+
+      if (compare(queue.top(), value))
+      {
+        queue.pop();
+        queue.push(value);
+        return true;
+      }
+
+      return false;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Offers a value, moving it if it is kept.
+    ///\return <b>true</b> if the value was kept.
+    //*************************************************************************
+    bool push(T&& value)
+    {
+      if (!queue.full())
+      {
+        queue.push(etl::move(value));
+        return true;
+      }
+
+      if (compare(queue.top(), value))
+      {
+        queue.pop();
+        queue.push(etl::move(value));
+        return true;
+      }
+
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Offers each value in a range.
+    //*************************************************************************
+    template <typename TIterator>
+    void push(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        push(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// The least of the kept values. Any value not greater is rejected once
+    /// the accumulator is full.
+    /// Undefined if empty.
+    //*************************************************************************
+    const T& threshold() const
+    {
+      return queue.top();
+    }
+
+    //*************************************************************************
+    /// Copies the kept values to the destination, greatest first.
+    ///\return An iterator to the end of the copied values.
+    //*************************************************************************
+    template <typename TIterator>
+    TIterator copy_sorted(TIterator destination) const
+    {
+      queue_t           remaining(queue);
+      etl::vector<T, K> ascending;
+
+      while (!remaining.empty())
+      {
+        ascending.push_back(remaining.top());
+        remaining.pop();
+      }
+
+      return etl::copy(ascending.rbegin(), ascending.rend(), destination);
+    }
+
+    //*************************************************************************
+    /// The number of values kept.
+    //*************************************************************************
+    size_type size() const
+    {
+      return queue.size();
+    }
+
+    //*************************************************************************
+    /// The maximum number of values kept.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Checks if no values are kept.
+    //*************************************************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+    //*************************************************************************
+    /// Checks if K values are kept.
+    //*************************************************************************
+    bool full() const
+    {
+      return queue.full();
+    }
+
+    //*************************************************************************
+    /// Discards all kept values.
+    //*************************************************************************
+    void clear()
+    {
+      queue.clear();
+    }
+
+  private:
+
+    typedef etl::priority_queue<T, K, etl::vector<T, K>, private_top_k::reversed_compare<T, TCompare> > queue_t;
+
+    queue_t  queue;
+    TCompare compare;
+  };
+
+  template <typename T, const size_t K, typename TCompare>
+  ETL_CONSTANT typename top_k<T, K, TCompare>::size_type top_k<T, K, TCompare>::MAX_SIZE;
+}
+
+#endif
@@ -0,0 +1,723 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_TOPIC_TRIE_INCLUDED
+#define ETL_TOPIC_TRIE_INCLUDED
+
+#include "platform.h"
+#include "string_view.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup topic_trie topic_trie
+/// A subscription index for MQTT style hierarchical topics.
+/// Topics are split into levels at '/'. In a subscription's topic filter,
+/// '+' matches any one level and '#', which must be the last level, matches
+/// the parent level and any number of levels below it.
+/// As in MQTT, topics beginning with '$' are not matched by a wildcard at
+/// the first level.
+/// Matching a topic costs time proportional to its depth, times the number
+/// of literal siblings searched at each level.
+/// The filter text is referenced, not copied, and must remain valid while
+/// the subscription exists.
+/// The subscribers may be anything that is copyable and equality comparable,
+/// such as etl::imessage_router pointers, to publish to routers and
+/// etl::message_broker instances by topic.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the topic_trie.
+  ///\ingroup topic_trie
+  //***************************************************************************
+  class topic_trie_exception : public exception
+  {
+  public:
+
+    topic_trie_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// There are no free nodes or subscriptions.
+  ///\ingroup topic_trie
+  //***************************************************************************
+  class topic_trie_full : public topic_trie_exception
+  {
+  public:
+
+    topic_trie_full(string_type file_name_, numeric_type line_number_)
+      : topic_trie_exception(ETL_ERROR_TEXT("topic_trie:full", ETL_TOPIC_TRIE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A wildcard is not a whole level, or '#' is not the last level.
+  ///\ingroup topic_trie
+  //***************************************************************************
+  class topic_trie_invalid_filter : public topic_trie_exception
+  {
+  public:
+
+    topic_trie_invalid_filter(string_type file_name_, numeric_type line_number_)
+      : topic_trie_exception(ETL_ERROR_TEXT("topic_trie:invalid filter", ETL_TOPIC_TRIE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The interface of a topic_trie.
+  ///\ingroup topic_trie
+  //***************************************************************************
+  template <typename TSubscriber>
+  class itopic_trie
+  {
+  public:
+
+    typedef TSubscriber value_type;
+    typedef size_t      size_type;
+
+    //*************************************************************************
+    /// Subscribes to the topics that match the filter.
+    /// Subscribing again with the same filter and subscriber does nothing.
+    /// Returns false if the filter is invalid or the trie is full.
+    //*************************************************************************
+    bool subscribe(etl::string_view filter, const TSubscriber& subscriber)
+    {
+      if (!is_valid_filter(filter))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(topic_trie_invalid_filter));
+        return false;
+      }
+
+      index_type       n    = Root;
+      etl::string_view rest = filter;
+      bool             more = true;
+
+      while (more)
+      {
+        etl::string_view level = next_level(rest, more);
+
+        index_type child = find_child(n, level);
+
+        if (child == Null)
+        {
+          child = add_child(n, level);
+
+          if (child == Null)
+          {
+            prune(n);
+            ETL_ASSERT_FAIL(ETL_ERROR(topic_trie_full));
+            return false;
+          }
+        }
+
+        n = child;
+      }
+
+      // Already subscribed?
+      for (index_type s = p_nodes[n].first_subscription; s != Null; s = p_subscriptions[s].next)
+      {
+        if (p_subscriptions[s].subscriber == subscriber)
+        {
+          return true;
+        }
+      }
+
+      if (free_subscriptions == Null)
+      {
+        prune(n);
+        ETL_ASSERT_FAIL(ETL_ERROR(topic_trie_full));
+        return false;
+      }
+
+      index_type s = free_subscriptions;
+      free_subscriptions = p_subscriptions[s].next;
+
+      subscription& sub = p_subscriptions[s];
+      sub.subscriber = subscriber;
+      sub.owner      = n;
+      sub.next       = p_nodes[n].first_subscription;
+      p_nodes[n].first_subscription = s;
+
+      ++subscription_count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Removes the subscription with the filter and subscriber.
+    /// Returns false if there was no such subscription.
+    //*************************************************************************
+    bool unsubscribe(etl::string_view filter, const TSubscriber& subscriber)
+    {
+      index_type       n    = Root;
+      etl::string_view rest = filter;
+      bool             more = true;
+
+      while (more && (n != Null))
+      {
+        n = find_child(n, next_level(rest, more));
+      }
+
+      if (n != Null)
+      {
+        for (index_type s = p_nodes[n].first_subscription; s != Null; s = p_subscriptions[s].next)
+        {
+          if (p_subscriptions[s].subscriber == subscriber)
+          {
+            remove_subscription(s);
+            return true;
+          }
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Removes every subscription for the subscriber.
+    /// Returns the number removed.
+    //*************************************************************************
+    size_t unsubscribe_all(const TSubscriber& subscriber)
+    {
+      size_t count = 0U;
+
+      for (index_type s = 0U; s < max_subscriptions; ++s)
+      {
+        if ((p_subscriptions[s].owner != Null) && (p_subscriptions[s].subscriber == subscriber))
+        {
+          remove_subscription(s);
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Calls f(subscriber) for every subscription whose filter matches the
+    /// topic. A subscriber with several matching filters is called for each.
+    /// Wildcards in the topic are not special.
+    /// Returns the number of calls.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t match(etl::string_view topic, TFunction f) const
+    {
+      const bool is_system = !topic.empty() && (topic[0] == '$');
+
+      return match_levels(Root, topic, true, !is_system, f);
+    }
+
+    //*************************************************************************
+    /// Returns true if any subscription matches the topic.
+    //*************************************************************************
+    bool has_match(etl::string_view topic) const
+    {
+      return match(topic, null_function()) != 0U;
+    }
+
+    //*************************************************************************
+    /// Removes every subscription.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// The number of subscriptions.
+    //*************************************************************************
+    size_t size() const
+    {
+      return subscription_count;
+    }
+
+    //*************************************************************************
+    /// The maximum number of subscriptions.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return max_subscriptions;
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return subscription_count == 0U;
+    }
+
+    //*************************************************************************
+    bool full() const
+    {
+      return subscription_count == max_subscriptions;
+    }
+
+    //*************************************************************************
+    /// The number of levels in use, across every filter.
+    //*************************************************************************
+    size_t node_count() const
+    {
+      return node_total;
+    }
+
+    //*************************************************************************
+    /// The maximum number of levels across every filter.
+    //*************************************************************************
+    size_t max_nodes() const
+    {
+      return max_node_total;
+    }
+
+    //*************************************************************************
+    /// Is the filter valid?
+    /// '+' and '#' must be whole levels, and '#' must be the last level.
+    //*************************************************************************
+    static bool is_valid_filter(etl::string_view filter)
+    {
+      etl::string_view rest = filter;
+      bool             more = true;
+
+      while (more)
+      {
+        etl::string_view level = next_level(rest, more);
+
+        for (size_t i = 0U; i < level.size(); ++i)
+        {
+          if (((level[i] == '+') || (level[i] == '#')) && (level.size() != 1U))
+          {
+            return false;
+          }
+        }
+
+        if ((level == etl::string_view("#")) && more)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+  protected:
+
+    typedef uint16_t index_type;
+
+    static ETL_CONSTANT index_type Null = 0xFFFFU;
+    static ETL_CONSTANT index_type Root = 0U;
+
+    //*************************************************************************
+    /// A level of a topic filter.
+    /// Literal children are linked through next_sibling. The '+' and '#'
+    /// children are held apart, so that matching never searches for them.
+    //*************************************************************************
+    struct node
+    {
+      etl::string_view level;
+      index_type       parent;
+      index_type       first_child;
+      index_type       next_sibling;
+      index_type       plus_child;
+      index_type       hash_child;
+      index_type       first_subscription;
+    };
+
+    //*************************************************************************
+    /// A subscriber to the filter that ends at the owner node.
+    //*************************************************************************
+    struct subscription
+    {
+      TSubscriber subscriber;
+      index_type  owner;
+      index_type  next;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    /// p_nodes_ has max_nodes_ + 1 entries, the first being the root.
+    //*************************************************************************
+    itopic_trie(node* p_nodes_, size_t max_nodes_, subscription* p_subscriptions_, size_t max_subscriptions_)
+      : p_nodes(p_nodes_)
+      , p_subscriptions(p_subscriptions_)
+      , max_node_total(index_type(max_nodes_))
+      , max_subscriptions(index_type(max_subscriptions_))
+    {
+      initialise();
+    }
+
+  private:
+
+    //*************************************************************************
+    struct null_function
+    {
+      void operator ()(const TSubscriber&) const
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Splits the next level from the front of rest.
+    /// more is false once the last level has been taken.
+    //*************************************************************************
+    static etl::string_view next_level(etl::string_view& rest, bool& more)
+    {
+      const size_t separator = rest.find('/');
+
+      if (separator == etl::string_view::npos)
+      {
+        more = false;
+        return rest;
+      }
+
+      etl::string_view level = rest.substr(0U, separator);
+      rest = rest.substr(separator + 1U);
+
+      return level;
+    }
+
+    //*************************************************************************
+    /// Every subscription of the node.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t deliver(index_type n, TFunction& f) const
+    {
+      size_t count = 0U;
+
+      for (index_type s = p_nodes[n].first_subscription; s != Null; s = p_subscriptions[s].next)
+      {
+        f(p_subscriptions[s].subscriber);
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Matches the remaining levels of the topic below node n.
+    /// Recurses once per level of the topic.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t match_levels(index_type n, etl::string_view rest, bool more, bool wildcards, TFunction& f) const
+    {
+      const node& current = p_nodes[n];
+
+      size_t count = 0U;
+
+      if (!more)
+      {
+        count += deliver(n, f);
+
+        // 'a/#' also matches 'a'.
+        if (current.hash_child != Null)
+        {
+          count += deliver(current.hash_child, f);
+        }
+
+        return count;
+      }
+
+      etl::string_view level = next_level(rest, more);
+
+      if (wildcards)
+      {
+        if (current.hash_child != Null)
+        {
+          count += deliver(current.hash_child, f);
+        }
+
+        if (current.plus_child != Null)
+        {
+          count += match_levels(current.plus_child, rest, more, true, f);
+        }
+      }
+
+      const index_type child = find_literal_child(n, level);
+
+      if (child != Null)
+      {
+        count += match_levels(child, rest, more, true, f);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    index_type find_literal_child(index_type n, etl::string_view level) const
+    {
+      index_type child = p_nodes[n].first_child;
+
+      while ((child != Null) && (p_nodes[child].level != level))
+      {
+        child = p_nodes[child].next_sibling;
+      }
+
+      return child;
+    }
+
+    //*************************************************************************
+    /// The child for the filter level, including the wildcards.
+    //*************************************************************************
+    index_type find_child(index_type n, etl::string_view level) const
+    {
+      if (level == etl::string_view("+"))
+      {
+        return p_nodes[n].plus_child;
+      }
+      else if (level == etl::string_view("#"))
+      {
+        return p_nodes[n].hash_child;
+      }
+      else
+      {
+        return find_literal_child(n, level);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a child for the filter level. Returns Null if there are no free nodes.
+    //*************************************************************************
+    index_type add_child(index_type n, etl::string_view level)
+    {
+      if (free_nodes == Null)
+      {
+        return Null;
+      }
+
+      const index_type child = free_nodes;
+      free_nodes = p_nodes[child].next_sibling;
+
+      node& new_node = p_nodes[child];
+      new_node.level              = level;
+      new_node.parent             = n;
+      new_node.first_child        = Null;
+      new_node.next_sibling       = Null;
+      new_node.plus_child         = Null;
+      new_node.hash_child         = Null;
+      new_node.first_subscription = Null;
+
+      if (level == etl::string_view("+"))
+      {
+        p_nodes[n].plus_child = child;
+      }
+      else if (level == etl::string_view("#"))
+      {
+        p_nodes[n].hash_child = child;
+      }
+      else
+      {
+        new_node.next_sibling = p_nodes[n].first_child;
+        p_nodes[n].first_child = child;
+      }
+
+      ++node_total;
+
+      return child;
+    }
+
+    //*************************************************************************
+    /// Unlinks and frees the subscription, then prunes its node.
+    //*************************************************************************
+    void remove_subscription(index_type s)
+    {
+      const index_type n = p_subscriptions[s].owner;
+
+      index_type* p_link = &p_nodes[n].first_subscription;
+
+      while (*p_link != s)
+      {
+        p_link = &p_subscriptions[*p_link].next;
+      }
+
+      *p_link = p_subscriptions[s].next;
+
+      p_subscriptions[s].owner = Null;
+      p_subscriptions[s].next  = free_subscriptions;
+      free_subscriptions = s;
+
+      --subscription_count;
+
+      prune(n);
+    }
+
+    //*************************************************************************
+    /// Frees the node, and then its parents, while they have no children and
+    /// no subscriptions.
+    //*************************************************************************
+    void prune(index_type n)
+    {
+      while (n != Root)
+      {
+        node& current = p_nodes[n];
+
+        if ((current.first_subscription != Null) ||
+            (current.first_child        != Null) ||
+            (current.plus_child         != Null) ||
+            (current.hash_child         != Null))
+        {
+          return;
+        }
+
+        node& parent = p_nodes[current.parent];
+
+        if (parent.plus_child == n)
+        {
+          parent.plus_child = Null;
+        }
+        else if (parent.hash_child == n)
+        {
+          parent.hash_child = Null;
+        }
+        else
+        {
+          index_type* p_link = &parent.first_child;
+
+          while (*p_link != n)
+          {
+            p_link = &p_nodes[*p_link].next_sibling;
+          }
+
+          *p_link = current.next_sibling;
+        }
+
+        const index_type parent_index = current.parent;
+
+        current.next_sibling = free_nodes;
+        free_nodes = n;
+        --node_total;
+
+        n = parent_index;
+      }
+    }
+
+    //*************************************************************************
+    /// Frees every node but the root, and every subscription.
+    //*************************************************************************
+    void initialise()
+    {
+      node& root = p_nodes[Root];
+      root.level              = etl::string_view();
+      root.parent             = Null;
+      root.first_child        = Null;
+      root.next_sibling       = Null;
+      root.plus_child         = Null;
+      root.hash_child         = Null;
+      root.first_subscription = Null;
+
+      free_nodes = Null;
+
+      for (index_type i = max_node_total; i > 0U; --i)
+      {
+        p_nodes[i].next_sibling = free_nodes;
+        free_nodes = i;
+      }
+
+      free_subscriptions = Null;
+
+      for (index_type i = max_subscriptions; i > 0U; --i)
+      {
+        p_subscriptions[i - 1U].owner = Null;
+        p_subscriptions[i - 1U].next  = free_subscriptions;
+        free_subscriptions = index_type(i - 1U);
+      }
+
+      node_total         = 0U;
+      subscription_count = 0U;
+    }
+
+    // Disable copy construction and assignment.
+    itopic_trie(const itopic_trie&) ETL_DELETE;
+    itopic_trie& operator =(const itopic_trie&) ETL_DELETE;
+
+    node*         p_nodes;
+    subscription* p_subscriptions;
+    index_type    max_node_total;
+    index_type    max_subscriptions;
+    index_type    free_nodes;
+    index_type    free_subscriptions;
+    index_type    node_total;
+    index_type    subscription_count;
+  };
+
+  template <typename TSubscriber>
+  ETL_CONSTANT typename itopic_trie<TSubscriber>::index_type itopic_trie<TSubscriber>::Null;
+
+  template <typename TSubscriber>
+  ETL_CONSTANT typename itopic_trie<TSubscriber>::index_type itopic_trie<TSubscriber>::Root;
+
+  //***************************************************************************
+  /// A topic_trie with storage for Max_Nodes filter levels and
+  /// Max_Subscriptions subscriptions.
+  /// TSubscriber must be default constructible, copy assignable and
+  /// equality comparable.
+  ///\ingroup topic_trie
+  //***************************************************************************
+  template <typename TSubscriber, size_t Max_Nodes, size_t Max_Subscriptions>
+  class topic_trie : public etl::itopic_trie<TSubscriber>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((Max_Nodes > 0U) && (Max_Nodes < 0xFFFFU), "Max_Nodes must be 1 to 65534");
+    ETL_STATIC_ASSERT((Max_Subscriptions > 0U) && (Max_Subscriptions < 0xFFFFU), "Max_Subscriptions must be 1 to 65534");
+
+    static ETL_CONSTANT size_t MAX_NODES         = Max_Nodes;
+    static ETL_CONSTANT size_t MAX_SUBSCRIPTIONS = Max_Subscriptions;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    topic_trie()
+      : etl::itopic_trie<TSubscriber>(nodes, Max_Nodes, subscriptions, Max_Subscriptions)
+    {
+    }
+
+  private:
+
+    typename etl::itopic_trie<TSubscriber>::node         nodes[Max_Nodes + 1U];
+    typename etl::itopic_trie<TSubscriber>::subscription subscriptions[Max_Subscriptions];
+  };
+
+  template <typename TSubscriber, size_t Max_Nodes, size_t Max_Subscriptions>
+  ETL_CONSTANT size_t topic_trie<TSubscriber, Max_Nodes, Max_Subscriptions>::MAX_NODES;
+
+  template <typename TSubscriber, size_t Max_Nodes, size_t Max_Subscriptions>
+  ETL_CONSTANT size_t topic_trie<TSubscriber, Max_Nodes, Max_Subscriptions>::MAX_SUBSCRIPTIONS;
+}
+
+#endif
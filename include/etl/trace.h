@@ -0,0 +1,342 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRACE_INCLUDED
+#define ETL_TRACE_INCLUDED
+
+#include "platform.h"
+
+#if ETL_HAS_TRACE
+  #include "algorithm.h"
+  #include "atomic.h"
+  #include "delegate.h"
+  #include "span.h"
+  #include "bip_buffer_spsc_atomic.h"
+
+  #if !ETL_HAS_ATOMIC
+    #error ETL_TRACE_ENABLE requires atomics
+  #endif
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup trace trace
+/// Records (timestamp, event id, payload) in a lock free ring, from probes
+/// placed in the hot paths of the message routers, the callback timer, the
+/// scheduler policies and the FSM.
+/// Enabled by defining ETL_TRACE_ENABLE in the profile. When disabled, the
+/// probes compile to nothing.
+///\ingroup utilities
+
+#if !defined(ETL_TRACE_TIMESTAMP_TYPE)
+  #define ETL_TRACE_TIMESTAMP_TYPE uint32_t
+#endif
+
+#if ETL_HAS_TRACE
+  #define ETL_TRACE(id, payload) etl::trace::record((id), (payload))
+#else
+  #define ETL_TRACE(id, payload) ETL_DO_NOTHING
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The trace event ids.
+  /// The ids are fixed at compile time. Ids below User_Base are reserved for
+  /// the ETL probes.
+  ///\ingroup trace
+  //***************************************************************************
+  struct trace_id
+  {
+    typedef uint16_t type;
+
+    enum
+    {
+      No_Event               = 0U,
+      Message_Router_Receive = 1U, ///< Payload: router id << 16 | message id.
+      Callback_Timer_Tick    = 2U, ///< Payload: the id of the timer that expired.
+      Scheduler_Dispatch     = 3U, ///< Payload: the priority of the task given work.
+      Fsm_Transition         = 4U, ///< Payload: FSM router id << 16 | new state id.
+      User_Base              = 256U
+    };
+  };
+
+  typedef ETL_TRACE_TIMESTAMP_TYPE trace_timestamp_t;
+  typedef uint32_t                 trace_payload_t;
+
+  //***************************************************************************
+  /// Packs two 16 bit values into a payload.
+  ///\ingroup trace
+  //***************************************************************************
+  inline ETL_CONSTEXPR etl::trace_payload_t trace_payload(uint32_t high, uint32_t low)
+  {
+    return ((high & 0xFFFFU) << 16U) | (low & 0xFFFFU);
+  }
+
+#if ETL_HAS_TRACE
+  //***************************************************************************
+  /// One trace event.
+  ///\ingroup trace
+  //***************************************************************************
+  struct trace_record
+  {
+    etl::trace_timestamp_t timestamp;
+    etl::trace_id::type    event_id;
+    etl::trace_payload_t   payload;
+  };
+
+  //***************************************************************************
+  /// The interface to a trace ring.
+  /// Written by one producer, the core being traced, and read by one consumer.
+  /// A record that does not fit is dropped and counted.
+  ///\ingroup trace
+  //***************************************************************************
+  class itrace_buffer
+  {
+  public:
+
+    typedef etl::ibip_buffer_spsc_atomic<etl::trace_record> ring_type;
+
+    //*************************************************************************
+    /// Writes a record. Producer only.
+    /// Returns false, and counts the drop, if the ring is full.
+    //*************************************************************************
+    bool write(const etl::trace_record& record)
+    {
+      etl::span<etl::trace_record> reserve = ring.write_reserve(1U);
+
+      if (reserve.empty())
+      {
+        dropped.fetch_add(1U, etl::memory_order_relaxed);
+        return false;
+      }
+
+      reserve[0] = record;
+      ring.write_commit(reserve);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reads the oldest record. Consumer only.
+    /// Returns false if the ring is empty.
+    //*************************************************************************
+    bool read(etl::trace_record& record)
+    {
+      etl::span<etl::trace_record> reserve = ring.read_reserve(1U);
+
+      if (reserve.empty())
+      {
+        return false;
+      }
+
+      record = reserve[0];
+      ring.read_commit(reserve);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reads the oldest records into 'destination'. Consumer only.
+    /// Returns the number of records read.
+    //*************************************************************************
+    size_t read(etl::span<etl::trace_record> destination)
+    {
+      size_t count = 0U;
+
+      while (count < destination.size())
+      {
+        etl::span<etl::trace_record> reserve = ring.read_reserve(destination.size() - count);
+
+        if (reserve.empty())
+        {
+          break;
+        }
+
+        etl::copy(reserve.begin(), reserve.end(), destination.begin() + count);
+        ring.read_commit(reserve);
+        count += reserve.size();
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// The number of records dropped because the ring was full.
+    //*************************************************************************
+    uint32_t dropped_count() const
+    {
+      return dropped.load(etl::memory_order_relaxed);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    itrace_buffer(ring_type& ring_)
+      : ring(ring_)
+      , dropped(0U)
+    {
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    itrace_buffer(const itrace_buffer&);
+    itrace_buffer& operator =(const itrace_buffer&);
+
+    ring_type&            ring;
+    etl::atomic<uint32_t> dropped;
+  };
+
+  //***************************************************************************
+  /// A trace ring of SIZE records.
+  ///\ingroup trace
+  //***************************************************************************
+  template <size_t SIZE>
+  class trace_buffer : public etl::itrace_buffer
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    trace_buffer()
+      : etl::itrace_buffer(ring_buffer)
+    {
+    }
+
+  private:
+
+    etl::bip_buffer_spsc_atomic<etl::trace_record, SIZE> ring_buffer;
+  };
+
+  //***************************************************************************
+  /// The destination of the probes.
+  /// Records go to the buffer returned by the selector if one is set, so that
+  /// each core can write to its own ring, otherwise to the single buffer.
+  /// Nothing is recorded if there is neither.
+  /// Configure before the probes run; the settings are not synchronised.
+  ///\ingroup trace
+  //***************************************************************************
+  class trace
+  {
+  public:
+
+    typedef etl::delegate<etl::trace_timestamp_t(void)> clock_type;
+    typedef etl::delegate<etl::itrace_buffer*(void)>     selector_type;
+
+    //*************************************************************************
+    /// Sets the buffer used when there is no selector.
+    //*************************************************************************
+    static void set_buffer(etl::itrace_buffer& buffer)
+    {
+      get_settings().p_buffer = &buffer;
+    }
+
+    //*************************************************************************
+    /// Sets the function that returns the buffer for the calling core.
+    //*************************************************************************
+    static void set_selector(const selector_type& selector)
+    {
+      get_settings().selector = selector;
+    }
+
+    //*************************************************************************
+    /// Sets the clock used to timestamp records.
+    /// Timestamps are zero if there is no clock.
+    //*************************************************************************
+    static void set_clock(const clock_type& clock)
+    {
+      get_settings().clock = clock;
+    }
+
+    //*************************************************************************
+    /// Removes the buffer, selector and clock.
+    //*************************************************************************
+    static void clear()
+    {
+      get_settings() = settings();
+    }
+
+    //*************************************************************************
+    /// Records an event.
+    //*************************************************************************
+    static void record(etl::trace_id::type event_id, etl::trace_payload_t payload)
+    {
+      settings& s = get_settings();
+
+      etl::itrace_buffer* p_buffer = s.selector.is_valid() ? s.selector() : s.p_buffer;
+
+      if (p_buffer != ETL_NULLPTR)
+      {
+        etl::trace_record record;
+
+        record.timestamp = s.clock.is_valid() ? s.clock() : etl::trace_timestamp_t();
+        record.event_id  = event_id;
+        record.payload   = payload;
+
+        p_buffer->write(record);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The current destination and clock.
+    //*************************************************************************
+    struct settings
+    {
+      settings()
+        : p_buffer(ETL_NULLPTR)
+        , selector()
+        , clock()
+      {
+      }
+
+      etl::itrace_buffer* p_buffer;
+      selector_type       selector;
+      clock_type          clock;
+    };
+
+    //*************************************************************************
+    static settings& get_settings()
+    {
+      static settings s;
+
+      return s;
+    }
+  };
+#endif
+}
+
+#endif
@@ -0,0 +1,203 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRIPLE_BUFFER_INCLUDED
+#define ETL_TRIPLE_BUFFER_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "utility.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A wait-free single producer, single consumer triple buffer.
+  /// Passes the latest value from the producer to the consumer. Older values
+  /// that the consumer has not taken are overwritten, rather than queued.
+  /// The producer writes into its own buffer and publishes it, exchanging it
+  /// with the spare buffer. The consumer takes the spare buffer in exchange
+  /// for its own if a newer value has been published. Neither side ever waits
+  /// for the other, and a value is copied only when it is written.
+  ///\tparam T The type of the value.
+  //***************************************************************************
+  template <typename T>
+  class triple_buffer
+  {
+  public:
+
+    typedef T        value_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+
+    //*************************************************************************
+    /// Constructor.
+    /// Every buffer is default constructed.
+    //*************************************************************************
+    triple_buffer()
+      : spare(1U)
+      , write_index(0U)
+      , read_index(2U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// Every buffer starts as a copy of the initial value.
+    //*************************************************************************
+    explicit triple_buffer(const T& initial)
+      : spare(1U)
+      , write_index(0U)
+      , read_index(2U)
+    {
+      buffers[0] = initial;
+      buffers[1] = initial;
+      buffers[2] = initial;
+    }
+
+    //*************************************************************************
+    /// Producer: Gets the buffer to write the next value in to.
+    /// The buffer holds an older value, so every member must be written.
+    //*************************************************************************
+    reference write_buffer()
+    {
+      return buffers[write_index];
+    }
+
+    //*************************************************************************
+    /// Producer: Publishes the write buffer as the latest value.
+    //*************************************************************************
+    void publish()
+    {
+      const uint_least8_t previous = spare.exchange(static_cast<uint_least8_t>(write_index | Fresh), etl::memory_order_acq_rel);
+
+      write_index = static_cast<uint_least8_t>(previous & Index_Mask);
+    }
+
+    //*************************************************************************
+    /// Producer: Writes and publishes a new value.
+    //*************************************************************************
+    void write(const T& value)
+    {
+      write_buffer() = value;
+      publish();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Producer: Writes and publishes a new value.
+    //*************************************************************************
+    void write(T&& value)
+    {
+      write_buffer() = etl::move(value);
+      publish();
+    }
+#endif
+
+    //*************************************************************************
+    /// Consumer: Returns <b>true</b> if a value has been published since the
+    /// last update.
+    //*************************************************************************
+    bool has_update() const
+    {
+      return (spare.load(etl::memory_order_acquire) & Fresh) != 0U;
+    }
+
+    //*************************************************************************
+    /// Consumer: Takes the latest published value, if there is a newer one.
+    ///\return <b>true</b> if the read buffer now holds a newer value.
+    //*************************************************************************
+    bool update()
+    {
+      if (!has_update())
+      {
+        return false;
+      }
+
+      // Only the producer can change the spare buffer meanwhile, and it can
+      // only replace it with a newer one.
+      const uint_least8_t previous = spare.exchange(read_index, etl::memory_order_acq_rel);
+
+      read_index = static_cast<uint_least8_t>(previous & Index_Mask);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Consumer: Gets the buffer holding the latest value taken by update.
+    //*************************************************************************
+    const_reference read_buffer() const
+    {
+      return buffers[read_index];
+    }
+
+    //*************************************************************************
+    /// Consumer: Copies the latest published value.
+    ///\param value Receives the latest value.
+    ///\return <b>true</b> if it is newer than the last value read.
+    //*************************************************************************
+    bool read(T& value)
+    {
+      const bool updated = update();
+
+      value = read_buffer();
+
+      return updated;
+    }
+
+  private:
+
+    static ETL_CONSTANT uint_least8_t Index_Mask = 0x03U;
+    static ETL_CONSTANT uint_least8_t Fresh      = 0x04U;
+
+    triple_buffer(const triple_buffer&) ETL_DELETE;
+    triple_buffer& operator=(const triple_buffer&) ETL_DELETE;
+
+    T buffers[3];
+
+    /// The index of the spare buffer, and whether it is newer than the read buffer.
+    etl::atomic<uint_least8_t> spare;
+
+    uint_least8_t write_index; ///< Owned by the producer.
+    uint_least8_t read_index;  ///< Owned by the consumer.
+  };
+
+  template <typename T>
+  ETL_CONSTANT uint_least8_t triple_buffer<T>::Index_Mask;
+
+  template <typename T>
+  ETL_CONSTANT uint_least8_t triple_buffer<T>::Fresh;
+}
+
+#endif
+#endif
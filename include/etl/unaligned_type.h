@@ -40,6 +40,7 @@ SOFTWARE.
 #include "endianness.h"
 #include "iterator.h"
 #include "algorithm.h"
+#include "binary.h"
 
 #include <string.h>
 
@@ -47,6 +48,71 @@ namespace etl
 {
   namespace private_unaligned_type
   {
+    //*************************************************************************
+    /// Returns true if the bytes may be copied with memcpy.
+    /// When the copy may be constant evaluated, and that cannot be detected,
+    /// they are shifted byte by byte.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline bool use_memcpy()
+    {
+#if ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+      return !__builtin_is_constant_evaluated();
+#else
+      return !ETL_USING_CPP14;
+#endif
+    }
+
+    //*************************************************************************
+    /// Stores a value with one copy, reversing the bytes if required.
+    //*************************************************************************
+    template <typename TBits, typename T>
+    void store_bytes(T value, unsigned char* store, bool reverse)
+    {
+      TBits bits;
+      memcpy(&bits, &value, sizeof(TBits));
+
+      if (reverse)
+      {
+        bits = etl::reverse_bytes(bits);
+      }
+
+      memcpy(store, &bits, sizeof(TBits));
+    }
+
+    //*************************************************************************
+    /// Loads a value with one copy, reversing the bytes if required.
+    //*************************************************************************
+    template <typename TBits, typename T>
+    void load_bytes(const unsigned char* store, T& value, bool reverse)
+    {
+      TBits bits;
+      memcpy(&bits, store, sizeof(TBits));
+
+      if (reverse)
+      {
+        bits = etl::reverse_bytes(bits);
+      }
+
+      memcpy(&value, &bits, sizeof(TBits));
+    }
+
+    //*************************************************************************
+    /// Copies stored bytes with one copy, reversing them if required.
+    //*************************************************************************
+    template <typename TBits>
+    void copy_bytes(const unsigned char* src, unsigned char* dst, bool reverse)
+    {
+      TBits bits;
+      memcpy(&bits, src, sizeof(TBits));
+
+      if (reverse)
+      {
+        bits = etl::reverse_bytes(bits);
+      }
+
+      memcpy(dst, &bits, sizeof(TBits));
+    }
+
     //*************************************************************************
     /// unaligned_type_common
     /// Contains all functionality that doesn't require the type.
@@ -406,7 +472,11 @@ namespace etl
       //*******************************
       static ETL_CONSTEXPR14 void copy(T value, unsigned char* store)
       {
-        if (Endian == etl::endianness::value())
+        if (etl::private_unaligned_type::use_memcpy())
+        {
+          etl::private_unaligned_type::store_bytes<uint16_t>(value, store, Endian != etl::endianness::value());
+        }
+        else if (Endian == etl::endianness::value())
         {
           store[0] = static_cast<storage_type>(value);
           store[1] = static_cast<storage_type>(value >> (1U * CHAR_BIT));
@@ -421,7 +491,11 @@ namespace etl
       //*******************************
       static ETL_CONSTEXPR14 void copy(const_pointer store, T& value)
       {
-        if (Endian == etl::endianness::value())
+        if (etl::private_unaligned_type::use_memcpy())
+        {
+          etl::private_unaligned_type::load_bytes<uint16_t>(store, value, Endian != etl::endianness::value());
+        }
+        else if (Endian == etl::endianness::value())
         {
           value = static_cast<T>(static_cast<unsigned char>(store[0]));
           value |= static_cast<T>(static_cast<unsigned char>(store[1])) << (1U * CHAR_BIT);
@@ -436,7 +510,11 @@ namespace etl
       //*******************************
       static ETL_CONSTEXPR14 void copy(const_pointer src, int endian_src, unsigned char* dst)
       {
-        if (Endian == endian_src)
+        if (etl::private_unaligned_type::use_memcpy())
+        {
+          etl::private_unaligned_type::copy_bytes<uint16_t>(src, dst, Endian != endian_src);
+        }
+        else if (Endian == endian_src)
         {
           dst[0] = src[0];
           dst[1] = src[1];
@@ -458,7 +536,11 @@ namespace etl
     {
       static ETL_CONSTEXPR14 void copy(T value, unsigned char* store)
       {
-        if (Endian == etl::endianness::value())
+        if (etl::private_unaligned_type::use_memcpy())
+        {
+          etl::private_unaligned_type::store_bytes<uint32_t>(value, store, Endian != etl::endianness::value());
+        }
+        else if (Endian == etl::endianness::value())
         {
           store[0] = static_cast<storage_type>(value);
           store[1] = static_cast<storage_type>(value >> (1U * CHAR_BIT));
@@ -477,7 +559,11 @@ namespace etl
       //*******************************
       static ETL_CONSTEXPR14 void copy(const_pointer store, T& value)
       {
-        if (Endian == etl::endianness::value())
+        if (etl::private_unaligned_type::use_memcpy())
+        {
+          etl::private_unaligned_type::load_bytes<uint32_t>(store, value, Endian != etl::endianness::value());
+        }
+        else if (Endian == etl::endianness::value())
         {
           value = static_cast<T>(static_cast<unsigned char>(store[0]));
           value |= static_cast<T>(static_cast<unsigned char>(store[1])) << (1U * CHAR_BIT);
@@ -496,7 +582,11 @@ namespace etl
       //*******************************
       static ETL_CONSTEXPR14 void copy(const_pointer src, int endian_src, unsigned char* dst)
       {
-        if (Endian == endian_src)
+        if (etl::private_unaligned_type::use_memcpy())
+        {
+          etl::private_unaligned_type::copy_bytes<uint32_t>(src, dst, Endian != endian_src);
+        }
+        else if (Endian == endian_src)
         {
           dst[0] = src[0];
           dst[1] = src[1];
@@ -522,6 +612,13 @@ namespace etl
     {
       static ETL_CONSTEXPR14 void copy(T value, unsigned char* store)
       {
+#if ETL_USING_64BIT_TYPES
+        if (etl::private_unaligned_type::use_memcpy())
+        {
+          etl::private_unaligned_type::store_bytes<uint64_t>(value, store, Endian != etl::endianness::value());
+        }
+        else
+#endif
         if (Endian == etl::endianness::value())
         {
           store[0] = static_cast<storage_type>(value);
@@ -549,6 +646,13 @@ namespace etl
       //*******************************
       static ETL_CONSTEXPR14 void copy(const_pointer store, T& value)
       {
+#if ETL_USING_64BIT_TYPES
+        if (etl::private_unaligned_type::use_memcpy())
+        {
+          etl::private_unaligned_type::load_bytes<uint64_t>(store, value, Endian != etl::endianness::value());
+        }
+        else
+#endif
         if (Endian == etl::endianness::value())
         {
           value = static_cast<T>(static_cast<unsigned char>(store[0]));
@@ -576,6 +680,13 @@ namespace etl
       //*******************************
       static ETL_CONSTEXPR14 void copy(const_pointer src, int endian_src, unsigned char* dst)
       {
+#if ETL_USING_64BIT_TYPES
+        if (etl::private_unaligned_type::use_memcpy())
+        {
+          etl::private_unaligned_type::copy_bytes<uint64_t>(src, dst, Endian != endian_src);
+        }
+        else
+#endif
         if (Endian == endian_src)
         {
           dst[0] = src[0];
@@ -0,0 +1,1422 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_MAP_INCLUDED
+#define ETL_UNORDERED_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "memory.h"
+#include "hash.h"
+#include "power.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "nth_type.h"
+#include "nullptr.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup unordered_flat_map unordered_flat_map
+/// An unordered_map with the capacity defined at compile time, that stores
+/// the elements inline using open addressing.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_exception : public etl::exception
+  {
+  public:
+
+    unordered_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_full : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:full", ETL_UNORDERED_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_out_of_range : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:range", ETL_UNORDERED_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized unordered_flat_map.
+  /// Can be used as a reference type for all unordered_flat_map containing a specific type.
+  /// The elements are stored inline in a power of 2 sized array of slots,
+  /// using Robin Hood open addressing with linear probing.
+  /// Each slot has a metadata byte holding its element's probe distance + 1,
+  /// or 0 if the slot is empty. Lookups compare the metadata bytes before
+  /// the keys, and stop as soon as the probe distance exceeds the slot's.
+  /// Erasing shifts the following elements back, so there are no tombstones.
+  /// Inserting and erasing may move elements, and invalidates iterators and
+  /// references, except for the iterator returned by erase.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iunordered_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    /// Defines the parameter types
+    typedef const key_type&    const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&         rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    /// The type of the slot metadata.
+    typedef uint_least8_t metadata_type;
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, value_type>
+    {
+    public:
+
+      friend class iunordered_flat_map;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pmap(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        index = pmap->next_occupied(index);
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return pmap->pslots[index];
+      }
+
+      //*********************************
+      pointer operator &() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.pmap == rhs.pmap) && (lhs.index == rhs.index);
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(iunordered_flat_map* pmap_, size_t index_)
+        : pmap(pmap_)
+        , index(index_)
+      {
+      }
+
+      iunordered_flat_map* pmap;
+      size_t               index;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class iunordered_flat_map;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pmap(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iunordered_flat_map::iterator& other)
+        : pmap(other.pmap)
+        , index(other.index)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        index = pmap->next_occupied(index);
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return pmap->pslots[index];
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.pmap == rhs.pmap) && (lhs.index == rhs.index);
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const iunordered_flat_map* pmap_, size_t index_)
+        : pmap(pmap_)
+        , index(index_)
+      {
+      }
+
+      const iunordered_flat_map* pmap;
+      size_t                     index;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the unordered_flat_map.
+    ///\return An iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(this, first_occupied());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, first_occupied());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, first_occupied());
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the unordered_flat_map.
+    ///\return An iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(this, start);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, start);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, start);
+    }
+
+    //*********************************************************************
+    /// Returns the number of slots.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return slot_mask + 1U;
+    }
+
+    //*********************************************************************
+    /// Returns the maximum number of slots.
+    //*********************************************************************
+    size_type max_bucket_count() const
+    {
+      return slot_mask + 1U;
+    }
+
+    //*********************************************************************
+    /// Returns the home slot index of a key.
+    //*********************************************************************
+    size_type get_bucket_index(const_key_reference key) const
+    {
+      return key_hash_function(key) & slot_mask;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](rvalue_key_reference key)
+    {
+      ETL_OR_STD::pair<size_t, bool> result = find_or_make_slot(key);
+
+      if (result.second)
+      {
+        ::new ((void*)etl::addressof(pslots[result.first].first))  key_type(etl::move(key));
+        ::new ((void*)etl::addressof(pslots[result.first].second)) mapped_type();
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pslots[result.first].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      ETL_OR_STD::pair<size_t, bool> result = find_or_make_slot(key);
+
+      if (result.second)
+      {
+        ::new ((void*)etl::addressof(pslots[result.first].first))  key_type(key);
+        ::new ((void*)etl::addressof(pslots[result.first].second)) mapped_type();
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pslots[result.first].second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      size_t index = find_slot(key);
+
+      ETL_ASSERT(index != Not_Found, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      size_t index = find_slot(key);
+
+      ETL_ASSERT(index != Not_Found, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pslots[index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      size_t index = find_slot(key);
+
+      ETL_ASSERT(index != Not_Found, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      size_t index = find_slot(key);
+
+      ETL_ASSERT(index != Not_Found, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pslots[index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the element with the key, and true if the value was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      ETL_OR_STD::pair<size_t, bool> result = find_or_make_slot(key_value_pair.first);
+
+      if (result.first == Not_Found)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      if (result.second)
+      {
+        ::new ((void*)etl::addressof(pslots[result.first])) value_type(key_value_pair);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(this, result.first), result.second);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the element with the key, and true if the value was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      ETL_OR_STD::pair<size_t, bool> result = find_or_make_slot(key_value_pair.first);
+
+      if (result.first == Not_Found)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      if (result.second)
+      {
+        ::new ((void*)etl::addressof(pslots[result.first])) value_type(etl::move(key_value_pair));
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(this, result.first), result.second);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      size_t index = find_slot(key);
+
+      if (index == Not_Found)
+      {
+        return 0U;
+      }
+
+      erase_slot(index);
+
+      return 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value && !etl::is_convertible<K, iterator>::value && !etl::is_convertible<K, const_iterator>::value, int> = 0>
+    size_t erase(const K& key)
+    {
+      size_t index = find_slot(key);
+
+      if (index == Not_Found)
+      {
+        return 0U;
+      }
+
+      erase_slot(index);
+
+      return 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param ielement Iterator to the element.
+    ///\return An iterator to the element after the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      size_t index = ielement.index;
+
+      erase_slot(index);
+
+      // The next element may have been shifted back into the erased slot.
+      if (pmeta[index] == 0U)
+      {
+        index = next_occupied(index);
+      }
+
+      return iterator(this, index);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element after the erased ones.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Erasing shifts elements, so 'last' may move. Count instead.
+      size_t n = static_cast<size_t>(etl::distance(first_, last_));
+
+      iterator inext(this, first_.index);
+
+      while (n-- != 0U)
+      {
+        inext = erase(inext);
+      }
+
+      return inext;
+    }
+
+    //*************************************************************************
+    /// Clears the unordered_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_slot(key) == Not_Found) ? 0U : 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find_slot(key) == Not_Found) ? 0U : 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the unordered_flat_map contains the key.
+    //*********************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_slot(key) != Not_Found;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_slot(key) != Not_Found;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      size_t index = find_slot(key);
+
+      return (index == Not_Found) ? end() : iterator(this, index);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      size_t index = find_slot(key);
+
+      return (index == Not_Found) ? end() : iterator(this, index);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      size_t index = find_slot(key);
+
+      return (index == Not_Found) ? end() : const_iterator(this, index);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      size_t index = find_slot(key);
+
+      return (index == Not_Found) ? end() : const_iterator(this, index);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the size of the unordered_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator = (const iunordered_flat_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator = (iunordered_flat_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    /// The largest probe distance + 1 that the metadata can hold.
+    static ETL_CONSTANT metadata_type Max_Metadata = etl::integral_limits<metadata_type>::max;
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iunordered_flat_map(value_type* pslots_, metadata_type* pmeta_, size_t number_of_slots_, size_t max_size_, hasher key_hash_function_, key_equal key_equal_function_)
+      : pslots(pslots_)
+      , pmeta(pmeta_)
+      , slot_mask(number_of_slots_ - 1U)
+      , start(0U)
+      , current_size(0U)
+      , MAX_SIZE(max_size_)
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+      for (size_t i = 0U; i < number_of_slots_; ++i)
+      {
+        pmeta[i] = 0U;
+      }
+    }
+
+    //*********************************************************************
+    /// Initialise the unordered_flat_map.
+    //*********************************************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i <= slot_mask; ++i)
+      {
+        if (pmeta[i] != 0U)
+        {
+          pslots[i].~value_type();
+          pmeta[i] = 0U;
+          ETL_DECREMENT_DEBUG_COUNT;
+        }
+      }
+
+      current_size = 0U;
+      start        = 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator b, iterator e)
+    {
+      while (b != e)
+      {
+        insert(etl::move(*b));
+        ++b;
+      }
+    }
+#endif
+
+  private:
+
+    /// The index returned when a key is not found.
+    static ETL_CONSTANT size_t Not_Found = etl::integral_limits<size_t>::max;
+
+    //*********************************************************************
+    size_t next_slot(size_t index) const
+    {
+      return (index + 1U) & slot_mask;
+    }
+
+    //*********************************************************************
+    size_t previous_slot(size_t index) const
+    {
+      return (index - 1U) & slot_mask;
+    }
+
+    //*********************************************************************
+    /// Iteration runs cyclically from the slot after 'start', which is
+    /// always empty. No run of occupied slots spans 'start', so erasing
+    /// only ever shifts elements that have not yet been visited.
+    //*********************************************************************
+    size_t next_occupied(size_t index) const
+    {
+      do
+      {
+        index = next_slot(index);
+      } while ((index != start) && (pmeta[index] == 0U));
+
+      return index;
+    }
+
+    //*********************************************************************
+    size_t first_occupied() const
+    {
+      return empty() ? start : next_occupied(start);
+    }
+
+    //*********************************************************************
+    /// Finds the slot that holds the key, or Not_Found.
+    //*********************************************************************
+    size_t find_slot(const_key_reference key) const
+    {
+      size_t   index    = get_bucket_index(key);
+      uint32_t distance = 1U;
+
+      // An element further than its probe distance would have displaced this one.
+      while (distance <= pmeta[index])
+      {
+        if ((pmeta[index] == distance) && key_equal_function(pslots[index].first, key))
+        {
+          return index;
+        }
+
+        ++distance;
+        index = next_slot(index);
+      }
+
+      return Not_Found;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    size_t find_slot(const K& key) const
+    {
+      size_t   index    = key_hash_function(key) & slot_mask;
+      uint32_t distance = 1U;
+
+      // An element further than its probe distance would have displaced this one.
+      while (distance <= pmeta[index])
+      {
+        if ((pmeta[index] == distance) && key_equal_function(pslots[index].first, key))
+        {
+          return index;
+        }
+
+        ++distance;
+        index = next_slot(index);
+      }
+
+      return Not_Found;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the slot that holds the key, or makes an empty slot for it.
+    /// Returns the slot index and true if a slot was made.
+    /// Returns Not_Found if the key is not in the unordered_flat_map and
+    /// there is no room for it.
+    //*********************************************************************
+    ETL_OR_STD::pair<size_t, bool> find_or_make_slot(const_key_reference key)
+    {
+      size_t   index    = get_bucket_index(key);
+      uint32_t distance = 1U;
+
+      while (distance <= pmeta[index])
+      {
+        if ((pmeta[index] == distance) && key_equal_function(pslots[index].first, key))
+        {
+          return ETL_OR_STD::pair<size_t, bool>(index, false);
+        }
+
+        ++distance;
+        index = next_slot(index);
+      }
+
+      // A new key, which belongs at 'index'.
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(unordered_flat_map_full), (ETL_OR_STD::pair<size_t, bool>(Not_Found, false)));
+
+      // Find the end of the run. Each element up to it moves one slot further from home.
+      size_t empty_index = index;
+
+      while (pmeta[empty_index] != 0U)
+      {
+        ETL_ASSERT_OR_RETURN_VALUE(pmeta[empty_index] < Max_Metadata, ETL_ERROR(unordered_flat_map_full), (ETL_OR_STD::pair<size_t, bool>(Not_Found, false)));
+        empty_index = next_slot(empty_index);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(distance <= Max_Metadata, ETL_ERROR(unordered_flat_map_full), (ETL_OR_STD::pair<size_t, bool>(Not_Found, false)));
+
+      // Shift the run up by one.
+      while (empty_index != index)
+      {
+        size_t from = previous_slot(empty_index);
+
+        ::new ((void*)etl::addressof(pslots[empty_index])) value_type(ETL_MOVE(pslots[from]));
+        pslots[from].~value_type();
+        pmeta[empty_index] = static_cast<metadata_type>(pmeta[from] + 1U);
+
+        empty_index = from;
+      }
+
+      pmeta[index] = static_cast<metadata_type>(distance);
+      ++current_size;
+
+      // The iteration start slot must stay empty.
+      if (pmeta[start] != 0U)
+      {
+        start = find_empty(start);
+      }
+
+      return ETL_OR_STD::pair<size_t, bool>(index, true);
+    }
+
+    //*********************************************************************
+    /// Finds the next empty slot. There is always at least one.
+    //*********************************************************************
+    size_t find_empty(size_t index) const
+    {
+      while (pmeta[index] != 0U)
+      {
+        index = next_slot(index);
+      }
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Destroys the element in a slot and shifts the rest of the run back.
+    //*********************************************************************
+    void erase_slot(size_t index)
+    {
+      pslots[index].~value_type();
+      ETL_DECREMENT_DEBUG_COUNT;
+      --current_size;
+
+      size_t next = next_slot(index);
+
+      // Elements not in their home slot move back by one.
+      while (pmeta[next] > 1U)
+      {
+        ::new ((void*)etl::addressof(pslots[index])) value_type(ETL_MOVE(pslots[next]));
+        pslots[next].~value_type();
+        pmeta[index] = static_cast<metadata_type>(pmeta[next] - 1U);
+
+        index = next;
+        next  = next_slot(next);
+      }
+
+      pmeta[index] = 0U;
+    }
+
+    // Disable copy construction.
+    iunordered_flat_map(const iunordered_flat_map&);
+
+    /// The slots that hold the elements.
+    value_type* pslots;
+
+    /// The probe distance + 1 of each slot's element, or 0 if empty.
+    metadata_type* pmeta;
+
+    /// The number of slots - 1.
+    const size_t slot_mask;
+
+    /// An empty slot that iteration starts after and ends at.
+    size_t start;
+
+    /// The number of elements.
+    size_t current_size;
+
+    /// The maximum number of elements.
+    const size_t MAX_SIZE;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNORDERED_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iunordered_flat_map()
+    {
+    }
+#else
+  protected:
+    ~iunordered_flat_map()
+    {
+    }
+#endif
+  };
+
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  ETL_CONSTANT typename iunordered_flat_map<TKey, T, THash, TKeyEqual>::metadata_type iunordered_flat_map<TKey, T, THash, TKeyEqual>::Max_Metadata;
+
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t iunordered_flat_map<TKey, T, THash, TKeyEqual>::Not_Found;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs,
+                   const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typedef typename etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>::const_iterator itr_t;
+
+    for (itr_t l = lhs.begin(); l != lhs.end(); ++l)
+    {
+      itr_t r = rhs.find(l->first);
+
+      if ((r == rhs.end()) || !(r->second == l->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs,
+                   const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated unordered_flat_map implementation that uses a fixed size buffer.
+  ///\tparam MAX_SIZE_  The maximum number of elements.
+  ///\tparam MAX_SLOTS_ The number of slots. A power of 2 greater than MAX_SIZE_.
+  ///                   The default keeps the load factor at or below 7/8.
+  ///\ingroup unordered_flat_map
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_,
+            const size_t MAX_SLOTS_ = etl::power_of_2_round_up<((MAX_SIZE_ * 8U) + 6U) / 7U>::value,
+            typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_map : public etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef iunordered_flat_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SLOTS_ & (MAX_SLOTS_ - 1U)) == 0U, "MAX_SLOTS_ must be a power of 2");
+    ETL_STATIC_ASSERT(MAX_SLOTS_ > MAX_SIZE_, "MAX_SLOTS_ must be greater than MAX_SIZE_");
+
+    static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_SLOTS_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unordered_flat_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::value_type*>(&slots), metadata, MAX_SLOTS_, MAX_SIZE_, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_map(const unordered_flat_map& other)
+      : base(reinterpret_cast<typename base::value_type*>(&slots), metadata, MAX_SLOTS_, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_flat_map(unordered_flat_map&& other)
+      : base(reinterpret_cast<typename base::value_type*>(&slots), metadata, MAX_SLOTS_, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::value_type*>(&slots), metadata, MAX_SLOTS_, MAX_SIZE_, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_flat_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::value_type*>(&slots), metadata, MAX_SLOTS_, MAX_SIZE_, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator = (const unordered_flat_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator = (unordered_flat_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The slots that hold the elements.
+    etl::uninitialized_buffer_of<typename base::value_type, MAX_SLOTS_> slots;
+
+    /// The slot metadata.
+    typename base::metadata_type metadata[MAX_SLOTS_];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_SLOTS_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, MAX_SLOTS_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_SLOTS_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, MAX_SLOTS_, THash, TKeyEqual>::MAX_BUCKETS;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  unordered_flat_map(TPairs...) -> unordered_flat_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                                      typename etl::nth_type_t<0, TPairs...>::second_type,
+                                                      sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... TPairs>
+  constexpr auto make_unordered_flat_map(TPairs&&... pairs) -> etl::unordered_flat_map<TKey, T, sizeof...(TPairs), etl::power_of_2_round_up<((sizeof...(TPairs) * 8U) + 6U) / 7U>::value, THash, TKeyEqual>
+  {
+    return { {etl::forward<TPairs>(pairs)...} };
+  }
+#endif
+}
+
+#endif
@@ -48,10 +48,13 @@ SOFTWARE.
 #include "error_handler.h"
 #include "exception.h"
 #include "debug_count.h"
+#include "container_statistics.h"
 #include "iterator.h"
 #include "placement_new.h"
 #include "initializer_list.h"
 
+#include "private/comparator_is_transparent.h"
+
 #include <stddef.h>
 
 //*****************************************************************************
@@ -120,6 +123,8 @@ namespace etl
   //***************************************************************************
   /// The base class for specifically sized unordered_map.
   /// Can be used as a reference type for all unordered_map containing a specific type.
+  /// Define ETL_USE_UNORDERED_HASH_CACHE to store the hash of each key in its
+  /// node, so that keys are only compared when the hashes are equal.
   ///\ingroup unordered_map
   //***************************************************************************
   template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
@@ -162,6 +167,9 @@ namespace etl
       }
 
       value_type key_value_pair;
+#if defined(ETL_USE_UNORDERED_HASH_CACHE)
+      size_t hash_value;
+#endif
     };
 
     friend bool operator ==(const node_t& lhs, const node_t& rhs)
@@ -596,7 +604,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(const_key_reference key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return bucket_index(key_hash_function(key));
     }
 
     //*********************************************************************
@@ -637,7 +645,8 @@ namespace etl
     mapped_reference operator [](rvalue_key_reference key)
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + bucket_index(hash_value);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -646,7 +655,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_has_key(*inode, hash_value, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -659,7 +668,7 @@ namespace etl
 
       // Doesn't exist, so add a new one.
       // Get a new node.
-      node_t* node = allocate_data_node();
+      node_t* node = allocate_data_node(hash_value);
       node->clear();
       ::new ((void*)etl::addressof(node->key_value_pair.first))  key_type(etl::move(key));
       ::new ((void*)etl::addressof(node->key_value_pair.second)) mapped_type();
@@ -681,7 +690,8 @@ namespace etl
     mapped_reference operator [](const_key_reference key)
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + bucket_index(hash_value);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -690,7 +700,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_has_key(*inode, hash_value, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -703,7 +713,7 @@ namespace etl
 
       // Doesn't exist, so add a new one.
       // Get a new node.
-      node_t* node = allocate_data_node();
+      node_t* node = allocate_data_node(hash_value);
       node->clear();
       ::new ((void*)etl::addressof(node->key_value_pair.first))  key_type(key);
       ::new ((void*)etl::addressof(node->key_value_pair.second)) mapped_type();
@@ -725,7 +735,8 @@ namespace etl
     mapped_reference at(const_key_reference key)
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + bucket_index(hash_value);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -734,7 +745,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_has_key(*inode, hash_value, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -751,6 +762,40 @@ namespace etl
       return begin()->second;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      // Find the bucket.
+      const size_t hash_value = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + bucket_index(hash_value);
+
+      // Find the first node in the bucket.
+      local_iterator inode = pbucket->begin();
+
+      // Walk the list looking for the right one.
+      while (inode != pbucket->end())
+      {
+        // Equal keys?
+        if (node_has_key(*inode, hash_value, key))
+        {
+          // Found a match.
+          return inode->key_value_pair.second;
+        }
+        else
+        {
+          ++inode;
+        }
+      }
+
+      // Doesn't exist.
+      ETL_ASSERT(false, ETL_ERROR(unordered_map_out_of_range));
+
+      return begin()->second;
+    }
+#endif
+
     //*********************************************************************
     /// Returns a const reference to the value at index 'key'
     /// If asserts or exceptions are enabled, emits an etl::unordered_map_out_of_range if the key is not in the range.
@@ -760,7 +805,8 @@ namespace etl
     const_mapped_reference at(const_key_reference key) const
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + bucket_index(hash_value);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -769,7 +815,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_has_key(*inode, hash_value, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -786,6 +832,40 @@ namespace etl
       return begin()->second;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      // Find the bucket.
+      const size_t hash_value = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + bucket_index(hash_value);
+
+      // Find the first node in the bucket.
+      local_iterator inode = pbucket->begin();
+
+      // Walk the list looking for the right one.
+      while (inode != pbucket->end())
+      {
+        // Equal keys?
+        if (node_has_key(*inode, hash_value, key))
+        {
+          // Found a match.
+          return inode->key_value_pair.second;
+        }
+        else
+        {
+          ++inode;
+        }
+      }
+
+      // Doesn't exist.
+      ETL_ASSERT(false, ETL_ERROR(unordered_map_out_of_range));
+
+      return begin()->second;
+    }
+#endif
+
     //*********************************************************************
     /// Assigns values to the unordered_map.
     /// If asserts or exceptions are enabled, emits unordered_map_full if the unordered_map does not have enough free space.
@@ -818,6 +898,8 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
     {
+      ETL_CONTAINER_STATISTICS_PROBED_SCOPE(Insert);
+
       ETL_OR_STD::pair<iterator, bool> result(end(), false);
 
       ETL_ASSERT(!full(), ETL_ERROR(unordered_map_full));
@@ -825,7 +907,8 @@ namespace etl
       const key_type&    key = key_value_pair.first;
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -835,7 +918,7 @@ namespace etl
       if (bucket.empty())
       {
         // Get a new node.
-        node_t* node = allocate_data_node();
+        node_t* node = allocate_data_node(hash_value);
         node->clear();
         ::new ((void*)etl::addressof(node->key_value_pair)) value_type(key_value_pair);        
         ETL_INCREMENT_DEBUG_COUNT;
@@ -856,8 +939,10 @@ namespace etl
 
         while (inode != bucket.end())
         {
+          ETL_CONTAINER_STATISTICS_PROBE;
+
           // Do we already have this key?
-          if (key_equal_function(inode->key_value_pair.first, key))
+          if (node_has_key(*inode, hash_value, key))
           {
             break;
           }
@@ -870,7 +955,7 @@ namespace etl
         if (inode == bucket.end())
         {
           // Get a new node.
-          node_t* node = allocate_data_node();
+          node_t* node = allocate_data_node(hash_value);
           node->clear();
           ::new ((void*)etl::addressof(node->key_value_pair)) value_type(key_value_pair);
           ETL_INCREMENT_DEBUG_COUNT;
@@ -896,6 +981,8 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
     {
+      ETL_CONTAINER_STATISTICS_PROBED_SCOPE(Insert);
+
       ETL_OR_STD::pair<iterator, bool> result(end(), false);
 
       ETL_ASSERT(!full(), ETL_ERROR(unordered_map_full));
@@ -903,7 +990,8 @@ namespace etl
       const key_type&    key = key_value_pair.first;
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -913,7 +1001,7 @@ namespace etl
       if (bucket.empty())
       {
         // Get a new node.
-        node_t* node = allocate_data_node();
+        node_t* node = allocate_data_node(hash_value);
         node->clear();
         ::new ((void*)etl::addressof(node->key_value_pair)) value_type(etl::move(key_value_pair));
         ETL_INCREMENT_DEBUG_COUNT;
@@ -934,8 +1022,10 @@ namespace etl
 
         while (inode != bucket.end())
         {
+          ETL_CONTAINER_STATISTICS_PROBE;
+
           // Do we already have this key?
-          if (key_equal_function(inode->key_value_pair.first, key))
+          if (node_has_key(*inode, hash_value, key))
           {
             break;
           }
@@ -948,7 +1038,7 @@ namespace etl
         if (inode == bucket.end())
         {
           // Get a new node.
-          node_t* node = allocate_data_node();
+          node_t* node = allocate_data_node(hash_value);
           node->clear();
           ::new ((void*)etl::addressof(node->key_value_pair)) value_type(etl::move(key_value_pair));
           ETL_INCREMENT_DEBUG_COUNT;
@@ -1015,8 +1105,46 @@ namespace etl
     //*********************************************************************
     size_t erase(const_key_reference key)
     {
+      ETL_CONTAINER_STATISTICS_PROBED_SCOPE(Erase);
+
+      size_t n = 0UL;
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
+
+      bucket_t& bucket = pbuckets[index];
+
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent = bucket.begin();
+
+      // Search for the key, if we have it.
+      while ((icurrent != bucket.end()) && (!node_has_key(*icurrent, hash_value, key)))
+      {
+        ETL_CONTAINER_STATISTICS_PROBE;
+        ++iprevious;
+        ++icurrent;
+      }
+
+      // Did we find it?
+      if (icurrent != bucket.end())
+      {
+        ETL_CONTAINER_STATISTICS_PROBE;
+        delete_data_node(iprevious, icurrent, bucket);
+        n = 1;
+      }
+
+      return n;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value && !etl::is_convertible<K, iterator>::value && !etl::is_convertible<K, const_iterator>::value, int> = 0>
+    size_t erase(const K& key)
+    {
+      ETL_CONTAINER_STATISTICS_PROBED_SCOPE(Erase);
+
       size_t n = 0UL;
-      size_t index = get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
 
       bucket_t& bucket = pbuckets[index];
 
@@ -1024,8 +1152,9 @@ namespace etl
       local_iterator icurrent = bucket.begin();
 
       // Search for the key, if we have it.
-      while ((icurrent != bucket.end()) && (!key_equal_function(icurrent->key_value_pair.first, key)))
+      while ((icurrent != bucket.end()) && (!node_has_key(*icurrent, hash_value, key)))
       {
+        ETL_CONTAINER_STATISTICS_PROBE;
         ++iprevious;
         ++icurrent;
       }
@@ -1033,12 +1162,14 @@ namespace etl
       // Did we find it?
       if (icurrent != bucket.end())
       {
+        ETL_CONTAINER_STATISTICS_PROBE;
         delete_data_node(iprevious, icurrent, bucket);
         n = 1;
       }
 
       return n;
     }
+#endif
 
     //*********************************************************************
     /// Erases an element.
@@ -1046,6 +1177,8 @@ namespace etl
     //*********************************************************************
     iterator erase(const_iterator ielement)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
       // Make a note of the next one.
       iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
@@ -1141,6 +1274,32 @@ namespace etl
       return (find(key) == end()) ? 0 : 1;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the unordered_map contains the key.
+    //*********************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1148,7 +1307,10 @@ namespace etl
     //*********************************************************************
     iterator find(const_key_reference key)
     {
-      size_t index = get_bucket_index(key);
+      ETL_CONTAINER_STATISTICS_PROBED_SCOPE(Find);
+
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1162,8 +1324,10 @@ namespace etl
 
         while (inode != iend)
         {
+          ETL_CONTAINER_STATISTICS_PROBE;
+
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (node_has_key(*inode, hash_value, key))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1175,6 +1339,44 @@ namespace etl
       return end();
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      ETL_CONTAINER_STATISTICS_PROBED_SCOPE(Find);
+
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          ETL_CONTAINER_STATISTICS_PROBE;
+
+          // Do we have this one?
+          if (node_has_key(*inode, hash_value, key))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1182,7 +1384,47 @@ namespace etl
     //*********************************************************************
     const_iterator find(const_key_reference key) const
     {
-      size_t index = get_bucket_index(key);
+      ETL_CONTAINER_STATISTICS_PROBED_SCOPE(Find);
+
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          ETL_CONTAINER_STATISTICS_PROBE;
+
+          // Do we have this one?
+          if (node_has_key(*inode, hash_value, key))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      ETL_CONTAINER_STATISTICS_PROBED_SCOPE(Find);
+
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1196,8 +1438,10 @@ namespace etl
 
         while (inode != iend)
         {
+          ETL_CONTAINER_STATISTICS_PROBE;
+
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (node_has_key(*inode, hash_value, key))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1208,6 +1452,7 @@ namespace etl
 
       return end();
     }
+#endif
 
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
@@ -1230,6 +1475,23 @@ namespace etl
       return ETL_OR_STD::pair<iterator, iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1251,12 +1513,29 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_map.
     //*************************************************************************
     size_type size() const
     {
-      return pnodepool->size();
+      return current_size;
     }
 
     //*************************************************************************
@@ -1280,7 +1559,7 @@ namespace etl
     //*************************************************************************
     bool empty() const
     {
-      return pnodepool->empty();
+      return current_size == 0U;
     }
 
     //*************************************************************************
@@ -1361,6 +1640,24 @@ namespace etl
     }
 #endif
 
+#if ETL_HAS_CONTAINER_STATISTICS
+    //*************************************************************************
+    /// Gets the operation statistics.
+    //*************************************************************************
+    etl::container_statistics& get_statistics()
+    {
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Gets the operation statistics.
+    //*************************************************************************
+    const etl::container_statistics& get_statistics() const
+    {
+      return statistics;
+    }
+#endif
+
   protected:
 
     //*********************************************************************
@@ -1368,8 +1665,10 @@ namespace etl
     //*********************************************************************
     iunordered_map(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, hasher key_hash_function_, key_equal key_equal_function_)
       : pnodepool(&node_pool_)
+      , current_size(0U)
       , pbuckets(pbuckets_)
       , number_of_buckets(number_of_buckets_)
+      , bucket_mask(((number_of_buckets_ & (number_of_buckets_ - 1U)) == 0U) ? (number_of_buckets_ - 1U) : 0U)
       , first(pbuckets)
       , last(pbuckets)
       , key_hash_function(key_hash_function_)
@@ -1377,6 +1676,14 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*********************************************************************
+    pool_t& get_node_pool() const
+    {
+      return *pnodepool;
+    }
+
     //*********************************************************************
     /// Initialise the unordered_map.
     //*********************************************************************
@@ -1384,6 +1691,9 @@ namespace etl
     {
       if (!empty())
       {
+        // Does the pool hold nodes that belong to other containers?
+        const bool pool_is_shared = (pnodepool->size() != current_size);
+
         // For each bucket...
         for (size_t i = 0UL; i < number_of_buckets; ++i)
         {
@@ -1391,25 +1701,45 @@ namespace etl
 
           if (!bucket.empty())
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
-
-            while (it != bucket.end())
+            if (pool_is_shared)
             {
-              // Destroy the value contents.
-              it->key_value_pair.~value_type();
-              ETL_DECREMENT_DEBUG_COUNT;
-
-              ++it;
+              // Other containers have nodes in the pool, so release each one.
+              while (!bucket.empty())
+              {
+                node_t& node = bucket.front();
+                bucket.pop_front();
+                node.key_value_pair.~value_type();
+                pnodepool->release(&node);
+                ETL_DECREMENT_DEBUG_COUNT;
+              }
             }
+            else
+            {
+              // For each item in the bucket...
+              local_iterator it = bucket.begin();
 
-            // Now it's safe to clear the bucket.
-            bucket.clear();
+              while (it != bucket.end())
+              {
+                // Destroy the value contents.
+                it->key_value_pair.~value_type();
+                ETL_DECREMENT_DEBUG_COUNT;
+
+                ++it;
+              }
+
+              // Now it's safe to clear the bucket.
+              bucket.clear();
+            }
           }
         }
 
-        // Now it's safe to clear the entire pool in one go.
-        pnodepool->release_all();
+        if (!pool_is_shared)
+        {
+          // Now it's safe to clear the entire pool in one go.
+          pnodepool->release_all();
+        }
+
+        current_size = 0U;
       }
 
       first = pbuckets;
@@ -1437,11 +1767,68 @@ namespace etl
     //*************************************************************************
     /// Create a node.
     //*************************************************************************
-    node_t* allocate_data_node()
+    node_t* allocate_data_node(size_t hash_value)
     {
       node_t* (etl::ipool::*func)() = &etl::ipool::allocate<node_t>;
-      return (pnodepool->*func)();
+      node_t* p_node = (pnodepool->*func)();
+
+      if (p_node != ETL_NULLPTR)
+      {
+#if defined(ETL_USE_UNORDERED_HASH_CACHE)
+        p_node->hash_value = hash_value;
+#else
+        (void)hash_value;
+#endif
+        ++current_size;
+      }
+
+      return p_node;
+    }
+
+    //*********************************************************************
+    /// Maps a hash to a bucket.
+    /// A power of two bucket count is indexed with a mask.
+    //*********************************************************************
+    size_t bucket_index(size_t hash_value) const
+    {
+      return (bucket_mask != 0U) ? (hash_value & bucket_mask) : (hash_value % number_of_buckets);
+    }
+
+    //*********************************************************************
+    /// Checks whether a node holds the key.
+    /// The cached hashes, if enabled, are compared before the keys.
+    //*********************************************************************
+    bool node_has_key(const node_t& node, size_t hash_value, const_key_reference key) const
+    {
+#if defined(ETL_USE_UNORDERED_HASH_CACHE)
+      if (node.hash_value != hash_value)
+      {
+        return false;
+      }
+#else
+      (void)hash_value;
+#endif
+
+      return key_equal_function(key, node.key_value_pair.first);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    bool node_has_key(const node_t& node, size_t hash_value, const K& key) const
+    {
+#if defined(ETL_USE_UNORDERED_HASH_CACHE)
+      if (node.hash_value != hash_value)
+      {
+        return false;
+      }
+#else
+      (void)hash_value;
+#endif
+
+      return key_equal_function(key, node.key_value_pair.first);
     }
+#endif
 
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
@@ -1515,6 +1902,7 @@ namespace etl
       local_iterator inext = bucket.erase_after(iprevious); // Unlink from the bucket.
       icurrent->key_value_pair.~value_type();               // Destroy the value.
       pnodepool->release(&*icurrent);                       // Release it back to the pool.
+      --current_size;
       adjust_first_last_markers_after_erase(&bucket);
       ETL_DECREMENT_DEBUG_COUNT;
 
@@ -1524,15 +1912,26 @@ namespace etl
     // Disable copy construction.
     iunordered_map(const iunordered_map&);
 
+#if ETL_HAS_CONTAINER_STATISTICS
+    /// The operation statistics.
+    mutable etl::container_statistics statistics;
+#endif
+
     /// The pool of data nodes used in the list.
     pool_t* pnodepool;
 
+    /// The number of nodes that belong to this container.
+    size_t current_size;
+
     /// The bucket list.
     bucket_t* pbuckets;
 
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// The mask for a power of two number of buckets, otherwise zero.
+    const size_t bucket_mask;
+
     /// The first and last pointers to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1731,6 +2130,138 @@ namespace etl
     typename base::bucket_t buckets[MAX_BUCKETS_];
   };
 
+  //*************************************************************************
+  /// A templated unordered_map implementation that uses a shared pool of nodes.
+  /// Create the pool as etl::pool<etl::unordered_map_ext<...>::pool_type, N>.
+  /// Many unordered_map_ext instances may share one pool, so that they do not each
+  /// have to reserve nodes for the worst case. The buckets are still owned
+  /// by each instance.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_BUCKETS_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_map_ext : public etl::iunordered_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iunordered_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+
+    typedef typename base::node_t pool_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    explicit unordered_map_ext(etl::ipool& node_pool, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Implicit pool.
+    //*************************************************************************
+    unordered_map_ext(const unordered_map_ext& other)
+      : base(other.get_pool(), buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Explicit pool.
+    //*************************************************************************
+    unordered_map_ext(const unordered_map_ext& other, etl::ipool& node_pool)
+      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor. Implicit pool.
+    //*************************************************************************
+    unordered_map_ext(unordered_map_ext&& other)
+      : base(other.get_pool(), buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+        other.clear();
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_map_ext(TIterator first_, TIterator last_, etl::ipool& node_pool, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_map_ext(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, etl::ipool& node_pool, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    /// Releases the nodes back to the shared pool.
+    //*************************************************************************
+    ~unordered_map_ext()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_map_ext& operator = (const unordered_map_ext& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_map_ext& operator = (unordered_map_ext&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      rhs.clear();
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_pool() const
+    {
+      return base::get_node_pool();
+    }
+
+  private:
+
+    /// The buckets of node lists.
+    typename base::bucket_t buckets[MAX_BUCKETS_];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_BUCKETS_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_map_ext<TKey, TValue, MAX_BUCKETS_, THash, TKeyEqual>::MAX_BUCKETS;
+
   //*************************************************************************
   /// Template deduction guides.
   //*************************************************************************
@@ -52,6 +52,8 @@ SOFTWARE.
 #include "placement_new.h"
 #include "initializer_list.h"
 
+#include "private/comparator_is_transparent.h"
+
 #include <stddef.h>
 
 //*****************************************************************************
@@ -868,6 +870,39 @@ namespace etl
       return n;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value && !etl::is_convertible<K, iterator>::value && !etl::is_convertible<K, const_iterator>::value, int> = 0>
+    size_t erase(const K& key)
+    {
+      size_t n = 0UL;
+      size_t bucket_id = key_hash_function(key) % number_of_buckets;
+
+      bucket_t& bucket = pbuckets[bucket_id];
+
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent = bucket.begin();
+
+      while (icurrent != bucket.end())
+      {
+        if (key_equal_function(icurrent->key_value_pair.first, key))
+        {
+          delete_data_node(iprevious, icurrent, bucket);
+          ++n;
+          icurrent = iprevious;
+        }
+        else
+        {
+          ++iprevious;
+        }
+
+        ++icurrent;
+      }
+
+      return n;
+    }
+#endif
+
     //*********************************************************************
     /// Erases an element.
     ///\param ielement Iterator to the element.
@@ -985,6 +1020,48 @@ namespace etl
       return n;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      size_t n = 0UL;
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+        ++n;
+
+        while ((l != end()) && key_equal_function(key, l->first))
+        {
+          ++l;
+          ++n;
+        }
+      }
+
+      return n;
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the unordered_multimap contains the key.
+    //*********************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1019,6 +1096,39 @@ namespace etl
       return end();
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      size_t index = key_hash_function(key) % number_of_buckets;
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key_value_pair.first))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1053,6 +1163,39 @@ namespace etl
       return end();
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      size_t index = key_hash_function(key) % number_of_buckets;
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key_value_pair.first))
+          {
+            return const_iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1079,6 +1222,28 @@ namespace etl
       return ETL_OR_STD::pair<iterator, iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+
+        while ((l != end()) && key_equal_function(key, l->first))
+        {
+          ++l;
+        }
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1105,12 +1270,34 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+
+        while ((l != end()) && key_equal_function(key, l->first))
+        {
+          ++l;
+        }
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_multimap.
     //*************************************************************************
     size_type size() const
     {
-      return pnodepool->size();
+      return current_size;
     }
 
     //*************************************************************************
@@ -1134,7 +1321,7 @@ namespace etl
     //*************************************************************************
     bool empty() const
     {
-      return pnodepool->empty();
+      return current_size == 0U;
     }
 
     //*************************************************************************
@@ -1223,6 +1410,7 @@ namespace etl
     //*********************************************************************
     iunordered_multimap(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, hasher key_hash_function_, key_equal key_equal_function_)
       : pnodepool(&node_pool_)
+      , current_size(0U)
       , pbuckets(pbuckets_)
       , number_of_buckets(number_of_buckets_)
       , first(pbuckets)
@@ -1232,6 +1420,14 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*********************************************************************
+    pool_t& get_node_pool() const
+    {
+      return *pnodepool;
+    }
+
     //*********************************************************************
     /// Initialise the unordered_multimap.
     //*********************************************************************
@@ -1239,6 +1435,9 @@ namespace etl
     {
       if (!empty())
       {
+        // Does the pool hold nodes that belong to other containers?
+        const bool pool_is_shared = (pnodepool->size() != current_size);
+
         // For each bucket...
         for (size_t i = 0UL; i < number_of_buckets; ++i)
         {
@@ -1246,24 +1445,44 @@ namespace etl
 
           if (!bucket.empty())
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
-
-            while (it != bucket.end())
+            if (pool_is_shared)
             {
-              // Destroy the value contents.
-              it->key_value_pair.~value_type();
-              ++it;
-              ETL_DECREMENT_DEBUG_COUNT;
+              // Other containers have nodes in the pool, so release each one.
+              while (!bucket.empty())
+              {
+                node_t& node = bucket.front();
+                bucket.pop_front();
+                node.key_value_pair.~value_type();
+                pnodepool->release(&node);
+                ETL_DECREMENT_DEBUG_COUNT;
+              }
+            }
+            else
+            {
+              // For each item in the bucket...
+              local_iterator it = bucket.begin();
+
+              while (it != bucket.end())
+              {
+                // Destroy the value contents.
+                it->key_value_pair.~value_type();
+                ++it;
+                ETL_DECREMENT_DEBUG_COUNT;
+              }
+
+              // Now it's safe to clear the bucket.
+              bucket.clear();
             }
-
-            // Now it's safe to clear the bucket.
-            bucket.clear();
           }
         }
 
-        // Now it's safe to clear the entire pool in one go.
-        pnodepool->release_all();
+        if (!pool_is_shared)
+        {
+          // Now it's safe to clear the entire pool in one go.
+          pnodepool->release_all();
+        }
+
+        current_size = 0U;
       }
 
       first = pbuckets;
@@ -1294,7 +1513,14 @@ namespace etl
     node_t* allocate_data_node()
     {
       node_t* (etl::ipool::*func)() = &etl::ipool::allocate<node_t>;
-      return (pnodepool->*func)();
+      node_t* p_node = (pnodepool->*func)();
+
+      if (p_node != ETL_NULLPTR)
+      {
+        ++current_size;
+      }
+
+      return p_node;
     }
 
     //*********************************************************************
@@ -1369,6 +1595,7 @@ namespace etl
       local_iterator inext = bucket.erase_after(iprevious); // Unlink from the bucket.
       icurrent->key_value_pair.~value_type();               // Destroy the value.
       pnodepool->release(&*icurrent);                       // Release it back to the pool.
+      --current_size;
       adjust_first_last_markers_after_erase(&bucket);
       ETL_DECREMENT_DEBUG_COUNT;
 
@@ -1381,6 +1608,9 @@ namespace etl
     /// The pool of data nodes used in the list.
     pool_t* pnodepool;
 
+    /// The number of nodes that belong to this container.
+    size_t current_size;
+
     /// The bucket list.
     bucket_t* pbuckets;
 
@@ -1599,6 +1829,138 @@ namespace etl
     typename base::bucket_t buckets[MAX_BUCKETS_];
   };
 
+  //*************************************************************************
+  /// A templated unordered_multimap implementation that uses a shared pool of nodes.
+  /// Create the pool as etl::pool<etl::unordered_multimap_ext<...>::pool_type, N>.
+  /// Many unordered_multimap_ext instances may share one pool, so that they do not each
+  /// have to reserve nodes for the worst case. The buckets are still owned
+  /// by each instance.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_BUCKETS_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_multimap_ext : public etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+
+    typedef typename base::node_t pool_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    explicit unordered_multimap_ext(etl::ipool& node_pool, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Implicit pool.
+    //*************************************************************************
+    unordered_multimap_ext(const unordered_multimap_ext& other)
+      : base(other.get_pool(), buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Explicit pool.
+    //*************************************************************************
+    unordered_multimap_ext(const unordered_multimap_ext& other, etl::ipool& node_pool)
+      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor. Implicit pool.
+    //*************************************************************************
+    unordered_multimap_ext(unordered_multimap_ext&& other)
+      : base(other.get_pool(), buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+        other.clear();
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_multimap_ext(TIterator first_, TIterator last_, etl::ipool& node_pool, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_multimap_ext(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, etl::ipool& node_pool, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    /// Releases the nodes back to the shared pool.
+    //*************************************************************************
+    ~unordered_multimap_ext()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_multimap_ext& operator = (const unordered_multimap_ext& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_multimap_ext& operator = (unordered_multimap_ext&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      rhs.clear();
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_pool() const
+    {
+      return base::get_node_pool();
+    }
+
+  private:
+
+    /// The buckets of node lists.
+    typename base::bucket_t buckets[MAX_BUCKETS_];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_BUCKETS_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_multimap_ext<TKey, TValue, MAX_BUCKETS_, THash, TKeyEqual>::MAX_BUCKETS;
+
   //*************************************************************************
   /// Template deduction guides.
   //*************************************************************************
@@ -52,6 +52,8 @@ SOFTWARE.
 #include "placement_new.h"
 #include "initializer_list.h"
 
+#include "private/comparator_is_transparent.h"
+
 #include <stddef.h>
 
 //*****************************************************************************
@@ -120,6 +122,8 @@ namespace etl
   //***************************************************************************
   /// The base class for specifically sized unordered_set.
   /// Can be used as a reference type for all unordered_set containing a specific type.
+  /// Define ETL_USE_UNORDERED_HASH_CACHE to store the hash of each key in its
+  /// node, so that keys are only compared when the hashes are equal.
   ///\ingroup unordered_set
   //***************************************************************************
   template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
@@ -154,6 +158,9 @@ namespace etl
       }
 
       value_type key;
+#if defined(ETL_USE_UNORDERED_HASH_CACHE)
+      size_t hash_value;
+#endif
     };
 
     friend bool operator ==(const node_t& lhs, const node_t& rhs)
@@ -586,7 +593,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return bucket_index(key_hash_function(key));
     }
 
     //*********************************************************************
@@ -668,7 +675,8 @@ namespace etl
       }
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -678,7 +686,7 @@ namespace etl
       if (bucket.empty())
       {
         // Get a new node.
-        node_t* node = allocate_data_node();
+        node_t* node = allocate_data_node(hash_value);
         node->clear();
         ::new (&node->key) value_type(key);
         ETL_INCREMENT_DEBUG_COUNT;
@@ -699,7 +707,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key, key))
+          if (node_has_key(*inode, hash_value, key))
           {
             break;
           }
@@ -712,7 +720,7 @@ namespace etl
         if (inode == bucket.end())
         {
           // Get a new node.
-          node_t* node = allocate_data_node();
+          node_t* node = allocate_data_node(hash_value);
           node->clear();
           ::new (&node->key) value_type(key);
           ETL_INCREMENT_DEBUG_COUNT;
@@ -756,7 +764,8 @@ namespace etl
       }
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -766,7 +775,7 @@ namespace etl
       if (bucket.empty())
       {
         // Get a new node.
-        node_t* node = allocate_data_node();
+        node_t* node = allocate_data_node(hash_value);
         node->clear();
         ::new (&node->key) value_type(etl::move(key));
         ETL_INCREMENT_DEBUG_COUNT;
@@ -787,7 +796,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key, key))
+          if (node_has_key(*inode, hash_value, key))
           {
             break;
           }
@@ -800,7 +809,7 @@ namespace etl
         if (inode == bucket.end())
         {
           // Get a new node.
-          node_t* node = allocate_data_node();
+          node_t* node = allocate_data_node(hash_value);
           node->clear();
           ::new (&node->key) value_type(etl::move(key));
           ETL_INCREMENT_DEBUG_COUNT;
@@ -868,7 +877,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0UL;
-      size_t index = get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
 
       bucket_t& bucket = pbuckets[index];
 
@@ -876,7 +886,7 @@ namespace etl
       local_iterator icurrent = bucket.begin();
 
       // Search for the key, if we have it.
-      while ((icurrent != bucket.end()) && (!key_equal_function(icurrent->key, key)))
+      while ((icurrent != bucket.end()) && (!node_has_key(*icurrent, hash_value, key)))
       {
         ++iprevious;
         ++icurrent;
@@ -892,6 +902,38 @@ namespace etl
       return n;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value && !etl::is_convertible<K, iterator>::value && !etl::is_convertible<K, const_iterator>::value, int> = 0>
+    size_t erase(const K& key)
+    {
+      size_t n = 0UL;
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
+
+      bucket_t& bucket = pbuckets[index];
+
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent = bucket.begin();
+
+      // Search for the key, if we have it.
+      while ((icurrent != bucket.end()) && (!node_has_key(*icurrent, hash_value, key)))
+      {
+        ++iprevious;
+        ++icurrent;
+      }
+
+      // Did we find it?
+      if (icurrent != bucket.end())
+      {
+        delete_data_node(iprevious, icurrent, bucket);
+        n = 1;
+      }
+
+      return n;
+    }
+#endif
+
     //*********************************************************************
     /// Erases an element.
     ///\param ielement Iterator to the element.
@@ -993,6 +1035,32 @@ namespace etl
       return (find(key) == end()) ? 0 : 1;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the unordered_set contains the key.
+    //*********************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1000,7 +1068,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1015,7 +1084,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (node_has_key(*inode, hash_value, key))
           {
             return iterator(pbuckets + number_of_buckets, pbucket, inode);
           }
@@ -1027,6 +1096,40 @@ namespace etl
       return end();
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (node_has_key(*inode, hash_value, key))
+          {
+            return iterator(pbuckets + number_of_buckets, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1034,7 +1137,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1049,7 +1153,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (node_has_key(*inode, hash_value, key))
           {
             return iterator(pbuckets + number_of_buckets, pbucket, inode);
           }
@@ -1061,6 +1165,40 @@ namespace etl
       return end();
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      const size_t hash_value = key_hash_function(key);
+      size_t index = bucket_index(hash_value);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (node_has_key(*inode, hash_value, key))
+          {
+            return iterator(pbuckets + number_of_buckets, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key 'key' in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1082,6 +1220,23 @@ namespace etl
       return ETL_OR_STD::pair<iterator, iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key 'key' in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1103,12 +1258,29 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_set.
     //*************************************************************************
     size_type size() const
     {
-      return pnodepool->size();
+      return current_size;
     }
 
     //*************************************************************************
@@ -1132,7 +1304,7 @@ namespace etl
     //*************************************************************************
     bool empty() const
     {
-      return pnodepool->empty();
+      return current_size == 0U;
     }
 
     //*************************************************************************
@@ -1221,8 +1393,10 @@ namespace etl
     //*********************************************************************
     iunordered_set(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, hasher key_hash_function_, key_equal key_equal_function_)
       : pnodepool(&node_pool_)
+      , current_size(0U)
       , pbuckets(pbuckets_)
       , number_of_buckets(number_of_buckets_)
+      , bucket_mask(((number_of_buckets_ & (number_of_buckets_ - 1U)) == 0U) ? (number_of_buckets_ - 1U) : 0U)
       , first(pbuckets)
       , last(pbuckets)
       , key_hash_function(key_hash_function_)
@@ -1230,6 +1404,14 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*********************************************************************
+    pool_t& get_node_pool() const
+    {
+      return *pnodepool;
+    }
+
     //*********************************************************************
     /// Initialise the unordered_set.
     //*********************************************************************
@@ -1237,6 +1419,9 @@ namespace etl
     {
       if (!empty())
       {
+        // Does the pool hold nodes that belong to other containers?
+        const bool pool_is_shared = (pnodepool->size() != current_size);
+
         // For each bucket...
         for (size_t i = 0UL; i < number_of_buckets; ++i)
         {
@@ -1244,24 +1429,44 @@ namespace etl
 
           if (!bucket.empty())
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
-
-            while (it != bucket.end())
+            if (pool_is_shared)
             {
-              // Destroy the value contents.
-              it->key.~value_type();
-              ++it;
-              ETL_DECREMENT_DEBUG_COUNT;
+              // Other containers have nodes in the pool, so release each one.
+              while (!bucket.empty())
+              {
+                node_t& node = bucket.front();
+                bucket.pop_front();
+                node.key.~value_type();
+                pnodepool->release(&node);
+                ETL_DECREMENT_DEBUG_COUNT;
+              }
+            }
+            else
+            {
+              // For each item in the bucket...
+              local_iterator it = bucket.begin();
+
+              while (it != bucket.end())
+              {
+                // Destroy the value contents.
+                it->key.~value_type();
+                ++it;
+                ETL_DECREMENT_DEBUG_COUNT;
+              }
+
+              // Now it's safe to clear the bucket.
+              bucket.clear();
             }
-
-            // Now it's safe to clear the bucket.
-            bucket.clear();
           }
         }
 
-        // Now it's safe to clear the entire pool in one go.
-        pnodepool->release_all();
+        if (!pool_is_shared)
+        {
+          // Now it's safe to clear the entire pool in one go.
+          pnodepool->release_all();
+        }
+
+        current_size = 0U;
       }
 
       first = pbuckets;
@@ -1295,11 +1500,68 @@ namespace etl
     //*************************************************************************
     /// Create a node.
     //*************************************************************************
-    node_t* allocate_data_node()
+    node_t* allocate_data_node(size_t hash_value)
     {
       node_t* (etl::ipool::*func)() = &etl::ipool::allocate<node_t>;
-      return (pnodepool->*func)();
+      node_t* p_node = (pnodepool->*func)();
+
+      if (p_node != ETL_NULLPTR)
+      {
+#if defined(ETL_USE_UNORDERED_HASH_CACHE)
+        p_node->hash_value = hash_value;
+#else
+        (void)hash_value;
+#endif
+        ++current_size;
+      }
+
+      return p_node;
+    }
+
+    //*********************************************************************
+    /// Maps a hash to a bucket.
+    /// A power of two bucket count is indexed with a mask.
+    //*********************************************************************
+    size_t bucket_index(size_t hash_value) const
+    {
+      return (bucket_mask != 0U) ? (hash_value & bucket_mask) : (hash_value % number_of_buckets);
+    }
+
+    //*********************************************************************
+    /// Checks whether a node holds the key.
+    /// The cached hashes, if enabled, are compared before the keys.
+    //*********************************************************************
+    bool node_has_key(const node_t& node, size_t hash_value, key_parameter_t key) const
+    {
+#if defined(ETL_USE_UNORDERED_HASH_CACHE)
+      if (node.hash_value != hash_value)
+      {
+        return false;
+      }
+#else
+      (void)hash_value;
+#endif
+
+      return key_equal_function(key, node.key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    bool node_has_key(const node_t& node, size_t hash_value, const K& key) const
+    {
+#if defined(ETL_USE_UNORDERED_HASH_CACHE)
+      if (node.hash_value != hash_value)
+      {
+        return false;
+      }
+#else
+      (void)hash_value;
+#endif
+
+      return key_equal_function(key, node.key);
     }
+#endif
 
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
@@ -1373,6 +1635,7 @@ namespace etl
       local_iterator inext = bucket.erase_after(iprevious); // Unlink from the bucket.
       icurrent->key.~value_type();                          // Destroy the value.
       pnodepool->release(&*icurrent);                       // Release it back to the pool.
+      --current_size;
       adjust_first_last_markers_after_erase(&bucket);
       ETL_DECREMENT_DEBUG_COUNT;
 
@@ -1385,12 +1648,18 @@ namespace etl
     /// The pool of data nodes used in the list.
     pool_t* pnodepool;
 
+    /// The number of nodes that belong to this container.
+    size_t current_size;
+
     /// The bucket list.
     bucket_t* pbuckets;
 
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// The mask for a power of two number of buckets, otherwise zero.
+    const size_t bucket_mask;
+
     /// The first and last iterators to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1595,6 +1864,138 @@ namespace etl
     typename base::bucket_t buckets[MAX_BUCKETS_];
   };
 
+  //*************************************************************************
+  /// A templated unordered_set implementation that uses a shared pool of nodes.
+  /// Create the pool as etl::pool<etl::unordered_set_ext<...>::pool_type, N>.
+  /// Many unordered_set_ext instances may share one pool, so that they do not each
+  /// have to reserve nodes for the worst case. The buckets are still owned
+  /// by each instance.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_BUCKETS_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_set_ext : public etl::iunordered_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iunordered_set<TKey, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+
+    typedef typename base::node_t pool_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    explicit unordered_set_ext(etl::ipool& node_pool, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Implicit pool.
+    //*************************************************************************
+    unordered_set_ext(const unordered_set_ext& other)
+      : base(other.get_pool(), buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Explicit pool.
+    //*************************************************************************
+    unordered_set_ext(const unordered_set_ext& other, etl::ipool& node_pool)
+      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor. Implicit pool.
+    //*************************************************************************
+    unordered_set_ext(unordered_set_ext&& other)
+      : base(other.get_pool(), buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+        other.clear();
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_set_ext(TIterator first_, TIterator last_, etl::ipool& node_pool, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_set_ext(std::initializer_list<TKey> init, etl::ipool& node_pool, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    /// Releases the nodes back to the shared pool.
+    //*************************************************************************
+    ~unordered_set_ext()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_set_ext& operator = (const unordered_set_ext& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_set_ext& operator = (unordered_set_ext&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      rhs.clear();
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the pool that the nodes are allocated from.
+    //*************************************************************************
+    etl::ipool& get_pool() const
+    {
+      return base::get_node_pool();
+    }
+
+  private:
+
+    /// The buckets of node lists.
+    typename base::bucket_t buckets[MAX_BUCKETS_];
+  };
+
+  template <typename TKey, const size_t MAX_BUCKETS_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_set_ext<TKey, MAX_BUCKETS_, THash, TKeyEqual>::MAX_BUCKETS;
+
   //*************************************************************************
   /// Template deduction guides.
   //*************************************************************************
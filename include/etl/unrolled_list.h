@@ -0,0 +1,1251 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNROLLED_LIST_INCLUDED
+#define ETL_UNROLLED_LIST_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "generic_pool.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "static_assert.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup unrolled_list unrolled_list
+/// A linked list that stores several elements in each node, with the
+/// capacity defined at compile time.
+/// Iteration walks contiguous runs of elements, so it visits far fewer nodes
+/// than etl::list, while insertion and erasure only move the elements of one
+/// or two nodes.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_exception : public exception
+  {
+  public:
+
+    unrolled_list_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_full : public unrolled_list_exception
+  {
+  public:
+
+    unrolled_list_full(string_type file_name_, numeric_type line_number_)
+      : unrolled_list_exception(ETL_ERROR_TEXT("unrolled_list:full", ETL_UNROLLED_LIST_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_empty : public unrolled_list_exception
+  {
+  public:
+
+    unrolled_list_empty(string_type file_name_, numeric_type line_number_)
+      : unrolled_list_exception(ETL_ERROR_TEXT("unrolled_list:empty", ETL_UNROLLED_LIST_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all unrolled_lists of T.
+  /// Each chunk holds up to 'chunk_capacity' elements in a contiguous run.
+  /// Adjacent chunks always hold more than 'chunk_capacity' elements between
+  /// them, so the chunks stay at least half full on average.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  template <typename T>
+  class iunrolled_list
+  {
+  public:
+
+    typedef T                     value_type;
+    typedef T&                    reference;
+    typedef const T&              const_reference;
+#if ETL_USING_CPP11
+    typedef T&&                   rvalue_reference;
+#endif
+    typedef T*                    pointer;
+    typedef const T*              const_pointer;
+    typedef size_t                size_type;
+    typedef ptrdiff_t             difference_type;
+
+  protected:
+
+    //*************************************************************************
+    /// The links between chunks.
+    //*************************************************************************
+    struct link_t
+    {
+      link_t* previous;
+      link_t* next;
+    };
+
+    //*************************************************************************
+    /// The chunk header. The elements follow it in the pool item.
+    //*************************************************************************
+    struct chunk_t : public link_t
+    {
+      size_type count;
+    };
+
+  public:
+
+    /// The offset of the elements from the start of a chunk.
+    static ETL_CONSTANT size_t Elements_Offset = ((sizeof(chunk_t) + etl::alignment_of<T>::value - 1U) / etl::alignment_of<T>::value) * etl::alignment_of<T>::value;
+
+    /// The alignment required for a chunk.
+    static ETL_CONSTANT size_t Chunk_Alignment = (etl::alignment_of<chunk_t>::value > etl::alignment_of<T>::value) ? etl::alignment_of<chunk_t>::value : etl::alignment_of<T>::value;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, T>
+    {
+    public:
+
+      friend class iunrolled_list;
+      friend class const_iterator;
+
+      iterator()
+        : p_link(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      iterator(const iterator& other)
+        : p_link(other.p_link)
+        , index(other.index)
+      {
+      }
+
+      iterator& operator =(const iterator& other)
+      {
+        p_link = other.p_link;
+        index  = other.index;
+        return *this;
+      }
+
+      iterator& operator ++()
+      {
+        if (++index == iunrolled_list::chunk_cast(p_link)->count)
+        {
+          p_link = p_link->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        if (index == 0U)
+        {
+          p_link = p_link->previous;
+          index  = iunrolled_list::chunk_cast(p_link)->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return iunrolled_list::elements(p_link)[index];
+      }
+
+      pointer operator ->() const
+      {
+        return &iunrolled_list::elements(p_link)[index];
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_link == rhs.p_link) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(link_t* p_link_, size_type index_)
+        : p_link(p_link_)
+        , index(index_)
+      {
+      }
+
+      link_t*   p_link;
+      size_type index;
+    };
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const T>
+    {
+    public:
+
+      friend class iunrolled_list;
+
+      const_iterator()
+        : p_link(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      const_iterator(const typename iunrolled_list::iterator& other)
+        : p_link(other.p_link)
+        , index(other.index)
+      {
+      }
+
+      const_iterator(const const_iterator& other)
+        : p_link(other.p_link)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator =(const const_iterator& other)
+      {
+        p_link = other.p_link;
+        index  = other.index;
+        return *this;
+      }
+
+      const_iterator& operator ++()
+      {
+        if (++index == iunrolled_list::chunk_cast(p_link)->count)
+        {
+          p_link = p_link->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        if (index == 0U)
+        {
+          p_link = p_link->previous;
+          index  = iunrolled_list::chunk_cast(p_link)->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return iunrolled_list::elements(p_link)[index];
+      }
+
+      const_pointer operator ->() const
+      {
+        return &iunrolled_list::elements(p_link)[index];
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_link == rhs.p_link) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const link_t* p_link_, size_type index_)
+        : p_link(const_cast<link_t*>(p_link_))
+        , index(index_)
+      {
+      }
+
+      link_t*   p_link;
+      size_type index;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the unrolled_list.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(terminal.next, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the unrolled_list.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(terminal.next, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the unrolled_list.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(terminal.next, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the unrolled_list.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(&terminal, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the unrolled_list.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(&terminal, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the unrolled_list.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(&terminal, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the unrolled_list.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the unrolled_list.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the unrolled_list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the unrolled_list.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the unrolled_list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the unrolled_list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the first element.
+    //*************************************************************************
+    reference front()
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(unrolled_list_empty));
+
+      return *begin();
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the first element.
+    //*************************************************************************
+    const_reference front() const
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(unrolled_list_empty));
+
+      return *begin();
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the last element.
+    //*************************************************************************
+    reference back()
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(unrolled_list_empty));
+
+      return *(--end());
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the last element.
+    //*************************************************************************
+    const_reference back() const
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(unrolled_list_empty));
+
+      return *(--end());
+    }
+
+    //*************************************************************************
+    /// Assigns a range of values to the unrolled_list.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list does not have enough free space.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        push_back(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns 'n' copies of a value to the unrolled_list.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list does not have enough free space.
+    //*************************************************************************
+    void assign(size_type n, const_reference value)
+    {
+      clear();
+
+      while (n-- != 0U)
+      {
+        push_back(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds an element to the back of the unrolled_list.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list is full.
+    //*************************************************************************
+    void push_back(const_reference value)
+    {
+      insert(cend(), value);
+    }
+
+    //*************************************************************************
+    /// Adds an element to the front of the unrolled_list.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list is full.
+    //*************************************************************************
+    void push_front(const_reference value)
+    {
+      insert(cbegin(), value);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Adds an element to the back of the unrolled_list.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list is full.
+    //*************************************************************************
+    void push_back(rvalue_reference value)
+    {
+      insert(cend(), etl::move(value));
+    }
+
+    //*************************************************************************
+    /// Adds an element to the front of the unrolled_list.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list is full.
+    //*************************************************************************
+    void push_front(rvalue_reference value)
+    {
+      insert(cbegin(), etl::move(value));
+    }
+
+    //*************************************************************************
+    /// Constructs an element at the back of the unrolled_list.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list is full.
+    //*************************************************************************
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+      return *emplace(cend(), etl::forward<Args>(args)...);
+    }
+
+    //*************************************************************************
+    /// Constructs an element at the front of the unrolled_list.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list is full.
+    //*************************************************************************
+    template <typename... Args>
+    reference emplace_front(Args&&... args)
+    {
+      return *emplace(cbegin(), etl::forward<Args>(args)...);
+    }
+
+    //*************************************************************************
+    /// Constructs an element before 'position'.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list is full.
+    ///\return An iterator to the new element.
+    //*************************************************************************
+    template <typename... Args>
+    iterator emplace(const_iterator position, Args&&... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      iterator slot = make_slot(position);
+      ::new (&*slot) T(etl::forward<Args>(args)...);
+
+      return slot;
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the first element.
+    //*************************************************************************
+    void pop_front()
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(unrolled_list_empty));
+
+      erase(cbegin());
+    }
+
+    //*************************************************************************
+    /// Removes the last element.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(unrolled_list_empty));
+
+      erase(--cend());
+    }
+
+    //*************************************************************************
+    /// Inserts a value before 'position'.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list is full.
+    ///\return An iterator to the new element.
+    //*************************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      iterator slot = make_slot(position);
+      ::new (&*slot) T(value);
+
+      return slot;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value before 'position'.
+    /// If asserts or exceptions are enabled, emits etl::unrolled_list_full if
+    /// the unrolled_list is full.
+    ///\return An iterator to the new element.
+    //*************************************************************************
+    iterator insert(const_iterator position, rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      iterator slot = make_slot(position);
+      ::new (&*slot) T(etl::move(value));
+
+      return slot;
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the element at 'position'.
+    ///\return An iterator to the element after the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      chunk_t* p_chunk = chunk_cast(position.p_link);
+      T*       p_first = elements(p_chunk);
+
+      // Close the gap.
+      p_first[position.index].~T();
+      move_elements(p_first + position.index + 1U, p_first + p_chunk->count, p_first + position.index);
+      --p_chunk->count;
+      --current_size;
+
+      return rebalance_after_erase(p_chunk, position.index);
+    }
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    ///\return An iterator to the element after the erased ones.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      // Erasing rebalances the chunks, so 'last' may move. Count instead.
+      size_type n = static_cast<size_type>(etl::distance(first, last));
+
+      iterator itr(first.p_link, first.index);
+
+      while (n-- != 0U)
+      {
+        itr = erase(itr);
+      }
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Clears the unrolled_list.
+    //*************************************************************************
+    void clear()
+    {
+      link_t* p_link = terminal.next;
+
+      while (p_link != &terminal)
+      {
+        link_t*  p_next  = p_link->next;
+        chunk_t* p_chunk = chunk_cast(p_link);
+
+        etl::destroy(elements(p_chunk), elements(p_chunk) + p_chunk->count);
+        p_chunk_pool->release(p_chunk);
+
+        p_link = p_next;
+      }
+
+      terminal.previous = &terminal;
+      terminal.next     = &terminal;
+      current_size      = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the number of elements in the unrolled_list.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of elements in the unrolled_list.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of elements in the unrolled_list.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Gets the number of elements that may still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return Max_Size - current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the unrolled_list is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the unrolled_list is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == Max_Size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of elements in a chunk.
+    //*************************************************************************
+    size_type chunk_capacity() const
+    {
+      return Chunk_Capacity;
+    }
+
+    //*************************************************************************
+    /// Gets the number of chunks in use.
+    //*************************************************************************
+    size_type chunk_count() const
+    {
+      return p_chunk_pool->size();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunrolled_list& operator =(const iunrolled_list& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunrolled_list& operator =(iunrolled_list&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iunrolled_list(etl::ipool& chunk_pool, size_type max_size_, size_type chunk_capacity_)
+      : p_chunk_pool(&chunk_pool)
+      , current_size(0U)
+      , Max_Size(max_size_)
+      , Chunk_Capacity(chunk_capacity_)
+    {
+      terminal.previous = &terminal;
+      terminal.next     = &terminal;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another unrolled_list.
+    //*************************************************************************
+    void move_from(iunrolled_list& other)
+    {
+      clear();
+
+      iterator itr = other.begin();
+
+      while (itr != other.end())
+      {
+        push_back(etl::move(*itr));
+        ++itr;
+      }
+
+      other.clear();
+    }
+#endif
+
+#if defined(ETL_POLYMORPHIC_UNROLLED_LIST) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iunrolled_list()
+    {
+    }
+#else
+  protected:
+    ~iunrolled_list()
+    {
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Gets the chunk for a link.
+    //*************************************************************************
+    static chunk_t* chunk_cast(link_t* p_link)
+    {
+      return static_cast<chunk_t*>(p_link);
+    }
+
+    //*************************************************************************
+    /// Gets the elements of a chunk.
+    //*************************************************************************
+    static T* elements(link_t* p_link)
+    {
+      return reinterpret_cast<T*>(reinterpret_cast<char*>(p_link) + Elements_Offset);
+    }
+
+    //*************************************************************************
+    /// Moves a range of elements to uninitialised storage, destroying the
+    /// originals. The ranges may overlap.
+    //*************************************************************************
+    static void move_elements(T* first, T* last, T* destination)
+    {
+      if (destination < first)
+      {
+        while (first != last)
+        {
+          ::new (destination) T(ETL_MOVE(*first));
+          first->~T();
+          ++first;
+          ++destination;
+        }
+      }
+      else if (destination > first)
+      {
+        destination += (last - first);
+
+        while (last != first)
+        {
+          --last;
+          --destination;
+          ::new (destination) T(ETL_MOVE(*last));
+          last->~T();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Allocates an empty chunk and links it after 'p_previous'.
+    //*************************************************************************
+    chunk_t* create_chunk_after(link_t* p_previous)
+    {
+      chunk_t* p_chunk = ::new (p_chunk_pool->template allocate<chunk_t>()) chunk_t;
+
+      p_chunk->count    = 0U;
+      p_chunk->previous = p_previous;
+      p_chunk->next     = p_previous->next;
+
+      p_previous->next->previous = p_chunk;
+      p_previous->next           = p_chunk;
+
+      return p_chunk;
+    }
+
+    //*************************************************************************
+    /// Unlinks an empty chunk and releases it.
+    //*************************************************************************
+    void release_chunk(chunk_t* p_chunk)
+    {
+      p_chunk->previous->next = p_chunk->next;
+      p_chunk->next->previous = p_chunk->previous;
+
+      p_chunk_pool->release(p_chunk);
+    }
+
+    //*************************************************************************
+    /// Opens an uninitialised slot for a new element before 'position'.
+    /// A full chunk passes an element to a neighbour with room, or is split.
+    ///\return An iterator to the slot.
+    //*************************************************************************
+    iterator make_slot(const_iterator position)
+    {
+      link_t*   p_link = position.p_link;
+      size_type index  = position.index;
+
+      ++current_size;
+
+      if (p_link == &terminal)
+      {
+        if (terminal.previous == &terminal)
+        {
+          // The first element.
+          chunk_t* p_chunk = create_chunk_after(&terminal);
+          p_chunk->count = 1U;
+
+          return iterator(p_chunk, 0U);
+        }
+
+        // Append to the last chunk.
+        p_link = terminal.previous;
+        index  = chunk_cast(p_link)->count;
+      }
+
+      chunk_t* p_chunk    = chunk_cast(p_link);
+      chunk_t* p_previous = (p_chunk->previous != &terminal) ? chunk_cast(p_chunk->previous) : ETL_NULLPTR;
+      chunk_t* p_next     = (p_chunk->next != &terminal)     ? chunk_cast(p_chunk->next)     : ETL_NULLPTR;
+
+      // Inserting at the start? Append to the previous chunk, if it has room.
+      if ((index == 0U) && (p_previous != ETL_NULLPTR) && (p_previous->count < Chunk_Capacity))
+      {
+        return iterator(p_previous, p_previous->count++);
+      }
+
+      if (p_chunk->count == Chunk_Capacity)
+      {
+        T* p_first = elements(p_chunk);
+
+        if ((p_previous != ETL_NULLPTR) && (p_previous->count < Chunk_Capacity))
+        {
+          // Pass the first element to the previous chunk.
+          move_elements(p_first, p_first + 1U, elements(p_previous) + p_previous->count);
+          ++p_previous->count;
+          move_elements(p_first + 1U, p_first + index, p_first);
+
+          return iterator(p_chunk, index - 1U);
+        }
+
+        if ((p_next != ETL_NULLPTR) && (p_next->count < Chunk_Capacity))
+        {
+          // Pass the last element to the next chunk.
+          T* p_next_first = elements(p_next);
+
+          move_elements(p_next_first, p_next_first + p_next->count, p_next_first + 1U);
+          ++p_next->count;
+
+          if (index == Chunk_Capacity)
+          {
+            return iterator(p_next, 0U);
+          }
+
+          move_elements(p_first + Chunk_Capacity - 1U, p_first + Chunk_Capacity, p_next_first);
+          move_elements(p_first + index, p_first + Chunk_Capacity - 1U, p_first + index + 1U);
+
+          return iterator(p_chunk, index);
+        }
+
+        // Split the chunk.
+        const size_type split = (index <= (Chunk_Capacity / 2U)) ? (Chunk_Capacity / 2U) : ((Chunk_Capacity + 1U) / 2U);
+
+        chunk_t* p_new = create_chunk_after(p_chunk);
+
+        move_elements(p_first + split, p_first + Chunk_Capacity, elements(p_new));
+        p_new->count   = Chunk_Capacity - split;
+        p_chunk->count = split;
+
+        if (index > split)
+        {
+          p_chunk = p_new;
+          index  -= split;
+        }
+      }
+
+      // Open a gap in the chunk.
+      T* p_first = elements(p_chunk);
+
+      move_elements(p_first + index, p_first + p_chunk->count, p_first + index + 1U);
+      ++p_chunk->count;
+
+      return iterator(p_chunk, index);
+    }
+
+    //*************************************************************************
+    /// Merges a chunk with a neighbour, if they fit in one chunk.
+    ///\return An iterator to the element that was at 'index' in the chunk.
+    //*************************************************************************
+    iterator rebalance_after_erase(chunk_t* p_chunk, size_type index)
+    {
+      chunk_t* p_previous = (p_chunk->previous != &terminal) ? chunk_cast(p_chunk->previous) : ETL_NULLPTR;
+      chunk_t* p_next     = (p_chunk->next != &terminal)     ? chunk_cast(p_chunk->next)     : ETL_NULLPTR;
+
+      if ((p_previous != ETL_NULLPTR) && ((p_previous->count + p_chunk->count) <= Chunk_Capacity))
+      {
+        // Merge into the previous chunk.
+        const size_type offset = p_previous->count;
+
+        move_elements(elements(p_chunk), elements(p_chunk) + p_chunk->count, elements(p_previous) + offset);
+        p_previous->count += p_chunk->count;
+        release_chunk(p_chunk);
+
+        p_chunk = p_previous;
+        index  += offset;
+      }
+      else if ((p_next != ETL_NULLPTR) && ((p_chunk->count + p_next->count) <= Chunk_Capacity))
+      {
+        // Merge the next chunk into this one.
+        move_elements(elements(p_next), elements(p_next) + p_next->count, elements(p_chunk) + p_chunk->count);
+        p_chunk->count += p_next->count;
+        release_chunk(p_next);
+      }
+      else if (p_chunk->count == 0U)
+      {
+        // The last element.
+        release_chunk(p_chunk);
+
+        return end();
+      }
+
+      if (index == p_chunk->count)
+      {
+        return iterator(p_chunk->next, 0U);
+      }
+
+      return iterator(p_chunk, index);
+    }
+
+    // Disable copy construction.
+    iunrolled_list(const iunrolled_list&);
+
+    etl::ipool*     p_chunk_pool;   ///< The pool of chunks.
+    link_t          terminal;       ///< The link that acts as the start and end.
+    size_type       current_size;   ///< The number of elements.
+    const size_type Max_Size;       ///< The maximum number of elements.
+    const size_type Chunk_Capacity; ///< The maximum number of elements in a chunk.
+  };
+
+  template <typename T>
+  ETL_CONSTANT size_t iunrolled_list<T>::Elements_Offset;
+
+  template <typename T>
+  ETL_CONSTANT size_t iunrolled_list<T>::Chunk_Alignment;
+
+  //***************************************************************************
+  /// An unrolled_list with the capacity defined at compile time.
+  ///\tparam T             The element type.
+  ///\tparam MAX_SIZE_     The maximum number of elements.
+  ///\tparam CHUNK_SIZE_   The maximum number of elements in each chunk.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, const size_t CHUNK_SIZE_>
+  class unrolled_list : public etl::iunrolled_list<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity etl::unrolled_list is not valid");
+    ETL_STATIC_ASSERT((CHUNK_SIZE_ > 1U), "etl::unrolled_list chunks must hold at least two elements");
+
+    static ETL_CONSTANT size_t MAX_SIZE   = MAX_SIZE_;
+    static ETL_CONSTANT size_t CHUNK_SIZE = CHUNK_SIZE_;
+
+    /// Adjacent chunks hold more than CHUNK_SIZE elements, which bounds the
+    /// number of chunks.
+    static ETL_CONSTANT size_t MAX_CHUNKS = (2U * (MAX_SIZE_ / (CHUNK_SIZE_ + 1U))) + 1U;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unrolled_list()
+      : etl::iunrolled_list<T>(chunk_pool, MAX_SIZE, CHUNK_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from size and value.
+    //*************************************************************************
+    unrolled_list(size_t initial_size, const T& value)
+      : etl::iunrolled_list<T>(chunk_pool, MAX_SIZE, CHUNK_SIZE)
+    {
+      this->assign(initial_size, value);
+    }
+
+    //*************************************************************************
+    /// Construct from range.
+    //*************************************************************************
+    template <typename TIterator>
+    unrolled_list(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+      : etl::iunrolled_list<T>(chunk_pool, MAX_SIZE, CHUNK_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unrolled_list(std::initializer_list<T> init)
+      : etl::iunrolled_list<T>(chunk_pool, MAX_SIZE, CHUNK_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unrolled_list(const unrolled_list& other)
+      : etl::iunrolled_list<T>(chunk_pool, MAX_SIZE, CHUNK_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unrolled_list(unrolled_list&& other)
+      : etl::iunrolled_list<T>(chunk_pool, MAX_SIZE, CHUNK_SIZE)
+    {
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unrolled_list()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unrolled_list& operator =(const unrolled_list& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unrolled_list& operator =(unrolled_list&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    static ETL_CONSTANT size_t Chunk_Size = etl::iunrolled_list<T>::Elements_Offset + (sizeof(T) * CHUNK_SIZE_);
+
+    /// The pool of chunks.
+    etl::generic_pool<Chunk_Size, etl::iunrolled_list<T>::Chunk_Alignment, MAX_CHUNKS> chunk_pool;
+  };
+
+  template <typename T, const size_t MAX_SIZE_, const size_t CHUNK_SIZE_>
+  ETL_CONSTANT size_t unrolled_list<T, MAX_SIZE_, CHUNK_SIZE_>::MAX_SIZE;
+
+  template <typename T, const size_t MAX_SIZE_, const size_t CHUNK_SIZE_>
+  ETL_CONSTANT size_t unrolled_list<T, MAX_SIZE_, CHUNK_SIZE_>::CHUNK_SIZE;
+
+  template <typename T, const size_t MAX_SIZE_, const size_t CHUNK_SIZE_>
+  ETL_CONSTANT size_t unrolled_list<T, MAX_SIZE_, CHUNK_SIZE_>::MAX_CHUNKS;
+
+  template <typename T, const size_t MAX_SIZE_, const size_t CHUNK_SIZE_>
+  ETL_CONSTANT size_t unrolled_list<T, MAX_SIZE_, CHUNK_SIZE_>::Chunk_Size;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  template <typename T>
+  bool operator ==(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  template <typename T>
+  bool operator !=(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,818 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UTF_INCLUDED
+#define ETL_UTF_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "enum_type.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_BUILTIN_SSSE3
+  #include <tmmintrin.h>
+#elif ETL_USING_BUILTIN_NEON
+  #include <arm_neon.h>
+#endif
+
+///\defgroup utf utf
+/// Validation of UTF-8 and conversion between UTF-8, UTF-16 and UTF-32.
+/// Overlong encodings, surrogates in UTF-8 and UTF-32, unpaired surrogates in
+/// UTF-16 and code points above U+10FFFF are rejected.
+/// Runs of ASCII are found and converted 8 bytes at a time, or 16 bytes at a
+/// time with SSSE3 or NEON if ETL_USE_SIMD_INTRINSICS is defined. Other
+/// sequences are validated and converted one code point at a time.
+/// The UTF-8 code unit may be any byte sized character type, the UTF-16 unit
+/// any 16 bit type and the UTF-32 unit any 32 bit type.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The status of a UTF conversion.
+  ///\ingroup utf
+  //***************************************************************************
+  struct utf_status
+  {
+    enum enum_type
+    {
+      Success,
+      Invalid_Sequence,
+      Output_Full
+    };
+
+    ETL_DECLARE_ENUM_TYPE(utf_status, int)
+    ETL_ENUM_TYPE(Success,          "Success")
+    ETL_ENUM_TYPE(Invalid_Sequence, "Invalid_Sequence")
+    ETL_ENUM_TYPE(Output_Full,      "Output_Full")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The result of a UTF conversion.
+  /// On failure, 'read' is the number of code units before the invalid
+  /// sequence, or the code point that did not fit, and 'written' is the
+  /// number converted from them.
+  ///\ingroup utf
+  //***************************************************************************
+  struct utf_result
+  {
+    utf_result()
+      : read(0U)
+      , written(0U)
+      , status(utf_status::Success)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if all of the input was converted.
+    //*************************************************************************
+    bool ok() const
+    {
+      return status == utf_status::Success;
+    }
+
+    size_t     read;    ///< The number of input code units converted.
+    size_t     written; ///< The number of output code units written.
+    utf_status status;
+  };
+
+  namespace private_utf
+  {
+    static ETL_CONSTANT uint32_t Max_Code_Point = 0x10FFFFUL;
+
+    //*************************************************************************
+    /// Returns the number of leading ASCII bytes, found a block at a time,
+    /// and writes them to out, widened, if out is not null.
+    //*************************************************************************
+    template <typename TOut>
+    size_t ascii_run(const uint8_t* p, size_t n, TOut* out)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_BUILTIN_SSSE3
+      const __m128i zero = _mm_setzero_si128();
+
+      for (; (i + 16U) <= n; i += 16U)
+      {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+
+        if (_mm_movemask_epi8(block) != 0)
+        {
+          break;
+        }
+
+        if (out != ETL_NULLPTR)
+        {
+          if (sizeof(TOut) == 2U)
+          {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),      _mm_unpacklo_epi8(block, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8U), _mm_unpackhi_epi8(block, zero));
+          }
+          else if (sizeof(TOut) == 4U)
+          {
+            const __m128i low  = _mm_unpacklo_epi8(block, zero);
+            const __m128i high = _mm_unpackhi_epi8(block, zero);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),       _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4U),  _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8U),  _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 12U), _mm_unpackhi_epi16(high, zero));
+          }
+          else
+          {
+            memcpy(out + i, p + i, 16U);
+          }
+        }
+      }
+#elif ETL_USING_BUILTIN_NEON
+      for (; (i + 16U) <= n; i += 16U)
+      {
+        const uint8x16_t block = vld1q_u8(p + i);
+        const uint64x2_t words = vreinterpretq_u64_u8(block);
+
+        if (((vgetq_lane_u64(words, 0) | vgetq_lane_u64(words, 1)) & 0x8080808080808080ULL) != 0U)
+        {
+          break;
+        }
+
+        if (out != ETL_NULLPTR)
+        {
+          if (sizeof(TOut) == 2U)
+          {
+            vst1q_u16(reinterpret_cast<uint16_t*>(out + i),      vmovl_u8(vget_low_u8(block)));
+            vst1q_u16(reinterpret_cast<uint16_t*>(out + i + 8U), vmovl_u8(vget_high_u8(block)));
+          }
+          else if (sizeof(TOut) == 4U)
+          {
+            const uint16x8_t low  = vmovl_u8(vget_low_u8(block));
+            const uint16x8_t high = vmovl_u8(vget_high_u8(block));
+
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + i),       vmovl_u16(vget_low_u16(low)));
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + i + 4U),  vmovl_u16(vget_high_u16(low)));
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + i + 8U),  vmovl_u16(vget_low_u16(high)));
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + i + 12U), vmovl_u16(vget_high_u16(high)));
+          }
+          else
+          {
+            vst1q_u8(reinterpret_cast<uint8_t*>(out + i), block);
+          }
+        }
+      }
+#endif
+
+#if ETL_USING_64BIT_TYPES
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        uint64_t word;
+        memcpy(&word, p + i, sizeof(word));
+
+        if ((word & 0x8080808080808080ULL) != 0U)
+        {
+          break;
+        }
+
+        if (out != ETL_NULLPTR)
+        {
+          for (size_t j = 0U; j < 8U; ++j)
+          {
+            out[i + j] = static_cast<TOut>(p[i + j]);
+          }
+        }
+      }
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Returns the number of leading UTF-16 units below 0x80, found a block
+    /// at a time, and writes them to out, narrowed.
+    //*************************************************************************
+    template <typename TIn, typename TOut>
+    size_t ascii_run_16(const TIn* p, size_t n, TOut* out)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_BUILTIN_SSSE3
+      const __m128i mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+      const __m128i zero = _mm_setzero_si128();
+
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, mask), zero)) != 0xFFFF)
+        {
+          break;
+        }
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(block, block));
+      }
+#elif ETL_USING_BUILTIN_NEON
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const uint16x8_t block = vld1q_u16(reinterpret_cast<const uint16_t*>(p + i));
+        const uint64x2_t words = vreinterpretq_u64_u16(block);
+
+        if (((vgetq_lane_u64(words, 0) | vgetq_lane_u64(words, 1)) & 0xFF80FF80FF80FF80ULL) != 0U)
+        {
+          break;
+        }
+
+        vst1_u8(reinterpret_cast<uint8_t*>(out + i), vmovn_u16(block));
+      }
+#endif
+
+      for (; (i + 4U) <= n; i += 4U)
+      {
+        if (((static_cast<uint32_t>(p[i]) | p[i + 1U] | p[i + 2U] | p[i + 3U]) & 0xFF80U) != 0U)
+        {
+          break;
+        }
+
+        out[i]      = static_cast<TOut>(p[i]);
+        out[i + 1U] = static_cast<TOut>(p[i + 1U]);
+        out[i + 2U] = static_cast<TOut>(p[i + 2U]);
+        out[i + 3U] = static_cast<TOut>(p[i + 3U]);
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    inline bool is_continuation(uint8_t c)
+    {
+      return (c & 0xC0U) == 0x80U;
+    }
+
+    //*************************************************************************
+    /// Gets the payload bits of a continuation byte.
+    //*************************************************************************
+    inline uint32_t continuation_bits(uint8_t c)
+    {
+      return c & 0x3FU;
+    }
+
+    //*************************************************************************
+    /// Decodes one UTF-8 sequence.
+    /// Returns its length, or zero if it is invalid or truncated.
+    //*************************************************************************
+    inline size_t decode_utf8(const uint8_t* p, size_t n, uint32_t& code_point)
+    {
+      const uint8_t  c0   = p[0];
+      const uint32_t lead = c0;
+
+      if (c0 < 0x80U)
+      {
+        code_point = c0;
+        return 1U;
+      }
+      else if (c0 < 0xC2U)
+      {
+        // A continuation byte, or the start of an overlong 2 byte sequence.
+        return 0U;
+      }
+      else if (c0 < 0xE0U)
+      {
+        if ((n < 2U) || !is_continuation(p[1]))
+        {
+          return 0U;
+        }
+
+        code_point = ((lead & 0x1FU) << 6U) | continuation_bits(p[1]);
+        return 2U;
+      }
+      else if (c0 < 0xF0U)
+      {
+        if ((n < 3U) || !is_continuation(p[1]) || !is_continuation(p[2]))
+        {
+          return 0U;
+        }
+
+        code_point = ((lead & 0x0FU) << 12U) | (continuation_bits(p[1]) << 6U) | continuation_bits(p[2]);
+
+        // Overlong, or a surrogate.
+        if ((code_point < 0x800U) || ((code_point >= 0xD800U) && (code_point <= 0xDFFFU)))
+        {
+          return 0U;
+        }
+
+        return 3U;
+      }
+      else if (c0 < 0xF5U)
+      {
+        if ((n < 4U) || !is_continuation(p[1]) || !is_continuation(p[2]) || !is_continuation(p[3]))
+        {
+          return 0U;
+        }
+
+        code_point = ((lead & 0x07U) << 18U) | (continuation_bits(p[1]) << 12U) | (continuation_bits(p[2]) << 6U) | continuation_bits(p[3]);
+
+        // Overlong, or beyond the last code point.
+        if ((code_point < 0x10000UL) || (code_point > Max_Code_Point))
+        {
+          return 0U;
+        }
+
+        return 4U;
+      }
+      else
+      {
+        return 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Decodes one UTF-16 sequence.
+    /// Returns its length, or zero if it is invalid or truncated.
+    //*************************************************************************
+    template <typename T16>
+    size_t decode_utf16(const T16* p, size_t n, uint32_t& code_point)
+    {
+      const uint32_t u0 = static_cast<uint16_t>(p[0]);
+
+      if ((u0 < 0xD800U) || (u0 > 0xDFFFU))
+      {
+        code_point = u0;
+        return 1U;
+      }
+
+      if ((u0 > 0xDBFFU) || (n < 2U))
+      {
+        return 0U;
+      }
+
+      const uint32_t u1 = static_cast<uint16_t>(p[1]);
+
+      if ((u1 < 0xDC00U) || (u1 > 0xDFFFU))
+      {
+        return 0U;
+      }
+
+      code_point = 0x10000UL + ((u0 - 0xD800U) << 10U) + (u1 - 0xDC00U);
+      return 2U;
+    }
+
+    //*************************************************************************
+    /// Encodes a code point as UTF-8.
+    /// Returns its length, or zero if it does not fit.
+    //*************************************************************************
+    template <typename T8>
+    size_t encode_utf8(uint32_t code_point, T8* out, size_t n)
+    {
+      if (code_point < 0x80U)
+      {
+        if (n < 1U) { return 0U; }
+
+        out[0] = static_cast<T8>(code_point);
+        return 1U;
+      }
+      else if (code_point < 0x800U)
+      {
+        if (n < 2U) { return 0U; }
+
+        out[0] = static_cast<T8>(0xC0U | (code_point >> 6U));
+        out[1] = static_cast<T8>(0x80U | (code_point & 0x3FU));
+        return 2U;
+      }
+      else if (code_point < 0x10000UL)
+      {
+        if (n < 3U) { return 0U; }
+
+        out[0] = static_cast<T8>(0xE0U | (code_point >> 12U));
+        out[1] = static_cast<T8>(0x80U | ((code_point >> 6U) & 0x3FU));
+        out[2] = static_cast<T8>(0x80U | (code_point & 0x3FU));
+        return 3U;
+      }
+      else
+      {
+        if (n < 4U) { return 0U; }
+
+        out[0] = static_cast<T8>(0xF0U | (code_point >> 18U));
+        out[1] = static_cast<T8>(0x80U | ((code_point >> 12U) & 0x3FU));
+        out[2] = static_cast<T8>(0x80U | ((code_point >> 6U) & 0x3FU));
+        out[3] = static_cast<T8>(0x80U | (code_point & 0x3FU));
+        return 4U;
+      }
+    }
+
+    //*************************************************************************
+    /// Encodes a code point as UTF-16.
+    /// Returns its length, or zero if it does not fit.
+    //*************************************************************************
+    template <typename T16>
+    size_t encode_utf16(uint32_t code_point, T16* out, size_t n)
+    {
+      if (code_point < 0x10000UL)
+      {
+        if (n < 1U) { return 0U; }
+
+        out[0] = static_cast<T16>(code_point);
+        return 1U;
+      }
+      else
+      {
+        if (n < 2U) { return 0U; }
+
+        code_point -= 0x10000UL;
+        out[0] = static_cast<T16>(0xD800U + (code_point >> 10U));
+        out[1] = static_cast<T16>(0xDC00U + (code_point & 0x3FFU));
+        return 2U;
+      }
+    }
+
+    //*************************************************************************
+    /// Encodes a code point as UTF-32.
+    //*************************************************************************
+    template <typename T32>
+    size_t encode_utf32(uint32_t code_point, T32* out, size_t n)
+    {
+      if (n < 1U) { return 0U; }
+
+      out[0] = static_cast<T32>(code_point);
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Converts UTF-8 with an encoder for the output.
+    //*************************************************************************
+    template <typename TOut, typename TEncoder>
+    utf_result from_utf8(const uint8_t* in, size_t n, TOut* out, size_t out_n, TEncoder encode)
+    {
+      utf_result result;
+
+      size_t i = 0U;
+      size_t o = 0U;
+
+      while (i < n)
+      {
+        // Convert a run of ASCII.
+        const size_t limit = ((n - i) < (out_n - o)) ? (n - i) : (out_n - o);
+        const size_t run   = ascii_run(in + i, limit, out + o);
+
+        i += run;
+        o += run;
+
+        if (i == n)
+        {
+          break;
+        }
+
+        uint32_t     code_point;
+        const size_t length = decode_utf8(in + i, n - i, code_point);
+
+        if (length == 0U)
+        {
+          result.status = utf_status::Invalid_Sequence;
+          break;
+        }
+
+        const size_t written = encode(code_point, out + o, out_n - o);
+
+        if (written == 0U)
+        {
+          result.status = utf_status::Output_Full;
+          break;
+        }
+
+        i += length;
+        o += written;
+      }
+
+      result.read    = i;
+      result.written = o;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Decodes one UTF-32 code point.
+    /// Returns one, or zero if it is invalid.
+    //*************************************************************************
+    template <typename T32>
+    size_t decode_utf32(const T32* p, size_t, uint32_t& code_point)
+    {
+      code_point = static_cast<uint32_t>(p[0]);
+
+      return ((code_point > Max_Code_Point) || ((code_point >= 0xD800U) && (code_point <= 0xDFFFU))) ? 0U : 1U;
+    }
+
+    //*************************************************************************
+    /// UTF-32 has no block conversion of ASCII.
+    //*************************************************************************
+    template <typename TIn, typename TOut>
+    size_t no_ascii_run(const TIn*, size_t, TOut*)
+    {
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// Converts UTF-16 or UTF-32 to UTF-8 with a decoder for the input.
+    //*************************************************************************
+    template <typename TIn, typename T8, typename TDecoder, typename TRun>
+    utf_result to_utf8(const TIn* in, size_t n, T8* out, size_t out_n, TDecoder decode, TRun run_of_ascii)
+    {
+      utf_result result;
+
+      size_t i = 0U;
+      size_t o = 0U;
+
+      while (i < n)
+      {
+        // Convert a run of ASCII.
+        const size_t limit = ((n - i) < (out_n - o)) ? (n - i) : (out_n - o);
+        const size_t run   = run_of_ascii(in + i, limit, out + o);
+
+        i += run;
+        o += run;
+
+        if (i == n)
+        {
+          break;
+        }
+
+        uint32_t     code_point;
+        const size_t length = decode(in + i, n - i, code_point);
+
+        if (length == 0U)
+        {
+          result.status = utf_status::Invalid_Sequence;
+          break;
+        }
+
+        const size_t written = encode_utf8(code_point, out + o, out_n - o);
+
+        if (written == 0U)
+        {
+          result.status = utf_status::Output_Full;
+          break;
+        }
+
+        i += length;
+        o += written;
+      }
+
+      result.read    = i;
+      result.written = o;
+
+      return result;
+    }
+
+    //*************************************************************************
+    template <typename T8>
+    const uint8_t* as_bytes(const T8* p)
+    {
+      ETL_STATIC_ASSERT(sizeof(T8) == 1U, "UTF-8 code units must be one byte");
+
+      return reinterpret_cast<const uint8_t*>(p);
+    }
+  }
+
+  //***************************************************************************
+  /// Returns <b>true</b> if the text is valid UTF-8.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T8>
+  bool utf8_validate(const T8* text, size_t length)
+  {
+    const uint8_t* p = private_utf::as_bytes(text);
+
+    size_t i = 0U;
+
+    while (i < length)
+    {
+      i += private_utf::ascii_run(p + i, length - i, static_cast<uint8_t*>(ETL_NULLPTR));
+
+      if (i == length)
+      {
+        break;
+      }
+
+      uint32_t     code_point;
+      const size_t sequence = private_utf::decode_utf8(p + i, length - i, code_point);
+
+      if (sequence == 0U)
+      {
+        return false;
+      }
+
+      i += sequence;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Returns <b>true</b> if the text is valid UTF-8.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T8, size_t Extent>
+  bool utf8_validate(const etl::span<T8, Extent>& text)
+  {
+    return etl::utf8_validate(text.data(), text.size());
+  }
+
+  //***************************************************************************
+  /// Returns <b>true</b> if the text is valid UTF-8.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T8, typename TTraits>
+  bool utf8_validate(const etl::basic_string_view<T8, TTraits>& text)
+  {
+    return etl::utf8_validate(text.data(), text.size());
+  }
+
+  //***************************************************************************
+  /// Converts UTF-8 to UTF-16.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T8, typename T16>
+  utf_result utf8_to_utf16(const T8* in, size_t in_length, T16* out, size_t out_length)
+  {
+    ETL_STATIC_ASSERT(sizeof(T16) == 2U, "UTF-16 code units must be 16 bits");
+
+    return private_utf::from_utf8(private_utf::as_bytes(in), in_length, out, out_length, &private_utf::encode_utf16<T16>);
+  }
+
+  //***************************************************************************
+  /// Converts UTF-8 to UTF-32.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T8, typename T32>
+  utf_result utf8_to_utf32(const T8* in, size_t in_length, T32* out, size_t out_length)
+  {
+    ETL_STATIC_ASSERT(sizeof(T32) == 4U, "UTF-32 code units must be 32 bits");
+
+    return private_utf::from_utf8(private_utf::as_bytes(in), in_length, out, out_length, &private_utf::encode_utf32<T32>);
+  }
+
+  //***************************************************************************
+  /// Converts UTF-16 to UTF-8.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T16, typename T8>
+  utf_result utf16_to_utf8(const T16* in, size_t in_length, T8* out, size_t out_length)
+  {
+    ETL_STATIC_ASSERT(sizeof(T16) == 2U, "UTF-16 code units must be 16 bits");
+    ETL_STATIC_ASSERT(sizeof(T8) == 1U, "UTF-8 code units must be one byte");
+
+    return private_utf::to_utf8(in, in_length, out, out_length, &private_utf::decode_utf16<T16>, &private_utf::ascii_run_16<T16, T8>);
+  }
+
+  //***************************************************************************
+  /// Converts UTF-32 to UTF-8.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T32, typename T8>
+  utf_result utf32_to_utf8(const T32* in, size_t in_length, T8* out, size_t out_length)
+  {
+    ETL_STATIC_ASSERT(sizeof(T32) == 4U, "UTF-32 code units must be 32 bits");
+    ETL_STATIC_ASSERT(sizeof(T8) == 1U, "UTF-8 code units must be one byte");
+
+    return private_utf::to_utf8(in, in_length, out, out_length, &private_utf::decode_utf32<T32>, &private_utf::no_ascii_run<T32, T8>);
+  }
+
+  //***************************************************************************
+  /// Converts UTF-8 to UTF-16.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T8, size_t Extent8, typename T16, size_t Extent16>
+  utf_result utf8_to_utf16(const etl::span<T8, Extent8>& in, const etl::span<T16, Extent16>& out)
+  {
+    return etl::utf8_to_utf16(in.data(), in.size(), out.data(), out.size());
+  }
+
+  //***************************************************************************
+  /// Converts UTF-8 to UTF-32.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T8, size_t Extent8, typename T32, size_t Extent32>
+  utf_result utf8_to_utf32(const etl::span<T8, Extent8>& in, const etl::span<T32, Extent32>& out)
+  {
+    return etl::utf8_to_utf32(in.data(), in.size(), out.data(), out.size());
+  }
+
+  //***************************************************************************
+  /// Converts UTF-16 to UTF-8.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T16, size_t Extent16, typename T8, size_t Extent8>
+  utf_result utf16_to_utf8(const etl::span<T16, Extent16>& in, const etl::span<T8, Extent8>& out)
+  {
+    return etl::utf16_to_utf8(in.data(), in.size(), out.data(), out.size());
+  }
+
+  //***************************************************************************
+  /// Converts UTF-32 to UTF-8.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T32, size_t Extent32, typename T8, size_t Extent8>
+  utf_result utf32_to_utf8(const etl::span<T32, Extent32>& in, const etl::span<T8, Extent8>& out)
+  {
+    return etl::utf32_to_utf8(in.data(), in.size(), out.data(), out.size());
+  }
+
+  //***************************************************************************
+  /// Converts UTF-8 to UTF-16, replacing the contents of the string.
+  /// On failure, the string holds the text converted before the failure.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T8, typename TTraits, typename T16>
+  utf_result utf8_to_utf16(const etl::basic_string_view<T8, TTraits>& in, etl::ibasic_string<T16>& out)
+  {
+    out.uninitialized_resize(out.max_size());
+
+    utf_result result = etl::utf8_to_utf16(in.data(), in.size(), out.data(), out.size());
+
+    out.uninitialized_resize(result.written);
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Converts UTF-8 to UTF-32, replacing the contents of the string.
+  /// On failure, the string holds the text converted before the failure.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T8, typename TTraits, typename T32>
+  utf_result utf8_to_utf32(const etl::basic_string_view<T8, TTraits>& in, etl::ibasic_string<T32>& out)
+  {
+    out.uninitialized_resize(out.max_size());
+
+    utf_result result = etl::utf8_to_utf32(in.data(), in.size(), out.data(), out.size());
+
+    out.uninitialized_resize(result.written);
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Converts UTF-16 to UTF-8, replacing the contents of the string.
+  /// On failure, the string holds the text converted before the failure.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T16, typename TTraits, typename T8>
+  utf_result utf16_to_utf8(const etl::basic_string_view<T16, TTraits>& in, etl::ibasic_string<T8>& out)
+  {
+    out.uninitialized_resize(out.max_size());
+
+    utf_result result = etl::utf16_to_utf8(in.data(), in.size(), out.data(), out.size());
+
+    out.uninitialized_resize(result.written);
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Converts UTF-32 to UTF-8, replacing the contents of the string.
+  /// On failure, the string holds the text converted before the failure.
+  ///\ingroup utf
+  //***************************************************************************
+  template <typename T32, typename TTraits, typename T8>
+  utf_result utf32_to_utf8(const etl::basic_string_view<T32, TTraits>& in, etl::ibasic_string<T8>& out)
+  {
+    out.uninitialized_resize(out.max_size());
+
+    utf_result result = etl::utf32_to_utf8(in.data(), in.size(), out.data(), out.size());
+
+    out.uninitialized_resize(result.written);
+
+    return result;
+  }
+}
+
+#endif
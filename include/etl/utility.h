@@ -599,6 +599,32 @@ namespace etl
   inline constexpr in_place_index_t<I> in_place_index{};
 #endif
 
+  //***************************************************************************
+  /// Sorted range disambiguation tags for the flat containers.
+  //***************************************************************************
+
+  //*************************
+  /// The range is sorted and contains no equivalent keys.
+  struct sorted_unique_t
+  {
+    explicit ETL_CONSTEXPR sorted_unique_t() {}
+  };
+
+#if ETL_USING_CPP17
+  inline constexpr sorted_unique_t sorted_unique{};
+#endif
+
+  //*************************
+  /// The range is sorted and may contain equivalent keys.
+  struct sorted_equivalent_t
+  {
+    explicit ETL_CONSTEXPR sorted_equivalent_t() {}
+  };
+
+#if ETL_USING_CPP17
+  inline constexpr sorted_equivalent_t sorted_equivalent{};
+#endif
+
 #if ETL_USING_CPP11
   //*************************************************************************
   /// A function wrapper for free/global functions.
@@ -42,6 +42,7 @@ SOFTWARE.
 #include "array.h"
 #include "exception.h"
 #include "debug_count.h"
+#include "container_statistics.h"
 #include "private/vector_base.h"
 #include "iterator.h"
 #include "functional.h"
@@ -433,6 +434,8 @@ namespace etl
     //*********************************************************************
     void push_back(const_reference value)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT_OR_RETURN(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
@@ -447,6 +450,8 @@ namespace etl
     //*********************************************************************
     void push_back(rvalue_reference value)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT_OR_RETURN(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
@@ -463,6 +468,8 @@ namespace etl
     template <typename ... Args>
     reference emplace_back(Args && ... args)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
@@ -479,6 +486,8 @@ namespace etl
     //*********************************************************************
     reference emplace_back()
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
@@ -496,6 +505,8 @@ namespace etl
     template <typename T1>
     reference emplace_back(const T1& value1)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
@@ -513,6 +524,8 @@ namespace etl
     template <typename T1, typename T2>
     reference emplace_back(const T1& value1, const T2& value2)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
@@ -530,6 +543,8 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     reference emplace_back(const T1& value1, const T2& value2, const T3& value3)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
@@ -547,6 +562,8 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     reference emplace_back(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
 #endif
@@ -563,6 +580,8 @@ namespace etl
     //*************************************************************************
     void pop_back()
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT_OR_RETURN(size() > 0, ETL_ERROR(vector_empty));
 #endif
@@ -577,6 +596,8 @@ namespace etl
     //*********************************************************************
     iterator insert(const_iterator position, const_reference value)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
 
       iterator position_ = to_iterator(position);
@@ -585,9 +606,15 @@ namespace etl
       {
         create_back(value);
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        open_gap(position_, 1U);
+        etl::create_copy_at(position_, value);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
-        create_back(back());
+        create_back(ETL_MOVE(back()));
         etl::move_backward(position_, p_end - 2, p_end - 1);
         *position_ = value;
       }
@@ -604,6 +631,8 @@ namespace etl
     //*********************************************************************
     iterator insert(const_iterator position, rvalue_reference value)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
 
       iterator position_ = to_iterator(position);
@@ -612,6 +641,12 @@ namespace etl
       {
         create_back(etl::move(value));
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        open_gap(position_, 1U);
+        etl::create_copy_at(position_, etl::move(value));
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         create_back(etl::move(back()));
@@ -630,6 +665,8 @@ namespace etl
     template <typename ... Args>
     iterator emplace(const_iterator position, Args && ... args)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
 
       iterator position_ = to_iterator(position);
@@ -641,10 +678,16 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         p = etl::addressof(*position_);
-        create_back(back());
+        create_back(etl::move(back()));
         etl::move_backward(position_, p_end - 2, p_end - 1);
         (*position_).~T();
       }
@@ -657,6 +700,8 @@ namespace etl
     template <typename T1>
     iterator emplace(const_iterator position, const T1& value1)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
 
       iterator position_ = to_iterator(position);
@@ -668,6 +713,12 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -684,6 +735,8 @@ namespace etl
     template <typename T1, typename T2>
     iterator emplace(const_iterator position, const T1& value1, const T2& value2)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
 
       iterator position_ = to_iterator(position);
@@ -695,6 +748,12 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -711,6 +770,8 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     iterator emplace(const_iterator position, const T1& value1, const T2& value2, const T3& value3)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
 
       iterator position_ = to_iterator(position);
@@ -722,6 +783,12 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -738,6 +805,8 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     iterator emplace(const_iterator position, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
 
       iterator position_ = to_iterator(position);
@@ -749,6 +818,12 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -772,10 +847,20 @@ namespace etl
     //*********************************************************************
     void insert(const_iterator position, size_t n, parameter_t value)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       ETL_ASSERT_OR_RETURN((size() + n) <= CAPACITY, ETL_ERROR(vector_full));
 
       iterator position_ = to_iterator(position);
 
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        open_gap(position_, n);
+        etl::uninitialized_fill_n(position_, n, value);
+        ETL_ADD_DEBUG_COUNT(n);
+        return;
+      }
+
       size_t insert_n = n;
       size_t insert_begin = etl::distance(begin(), position_);
       size_t insert_end = insert_begin + insert_n;
@@ -829,10 +914,22 @@ namespace etl
     template <class TIterator>
     void insert(const_iterator position, TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Insert);
+
       size_t count = etl::distance(first, last);
 
       ETL_ASSERT_OR_RETURN((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        iterator position_ = to_iterator(position);
+
+        open_gap(position_, count);
+        etl::uninitialized_copy(first, last, position_);
+        ETL_ADD_DEBUG_COUNT(count);
+        return;
+      }
+
       size_t insert_n = count;
       size_t insert_begin = etl::distance(cbegin(), position);
       size_t insert_end = insert_begin + insert_n;
@@ -882,8 +979,19 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      etl::move(i_element + 1, end(), i_element);
-      destroy_back();
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy_at(i_element);
+        ETL_DECREMENT_DEBUG_COUNT;
+        close_gap(i_element, 1U);
+      }
+      else
+      {
+        etl::move(i_element + 1, end(), i_element);
+        destroy_back();
+      }
 
       return i_element;
     }
@@ -895,10 +1003,21 @@ namespace etl
     //*********************************************************************
     iterator erase(const_iterator i_element)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
       iterator i_element_ = to_iterator(i_element);
 
-      etl::move(i_element_ + 1, end(), i_element_);
-      destroy_back();
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy_at(i_element_);
+        ETL_DECREMENT_DEBUG_COUNT;
+        close_gap(i_element_, 1U);
+      }
+      else
+      {
+        etl::move(i_element_ + 1, end(), i_element_);
+        destroy_back();
+      }
 
       return i_element_;
     }
@@ -913,6 +1032,8 @@ namespace etl
     //*********************************************************************
     iterator erase(const_iterator first, const_iterator last)
     {
+      ETL_CONTAINER_STATISTICS_SCOPE(Erase);
+
       iterator first_ = to_iterator(first);
       iterator last_  = to_iterator(last);
 
@@ -920,6 +1041,14 @@ namespace etl
       {
         clear();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        size_t n_delete = etl::distance(first_, last_);
+
+        etl::destroy(first_, last_);
+        ETL_SUBTRACT_DEBUG_COUNT(n_delete);
+        close_gap(first_, n_delete);
+      }
       else
       {
         etl::move(last_, end(), first_);
@@ -1013,6 +1142,24 @@ namespace etl
     virtual void repair() = 0;
 #endif
 
+#if ETL_HAS_CONTAINER_STATISTICS
+    //*************************************************************************
+    /// Gets the operation statistics.
+    //*************************************************************************
+    etl::container_statistics& get_statistics()
+    {
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Gets the operation statistics.
+    //*************************************************************************
+    const etl::container_statistics& get_statistics() const
+    {
+      return statistics;
+    }
+#endif
+
   protected:
 
     //*********************************************************************
@@ -1097,9 +1244,33 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+    //*********************************************************************
+    /// Opens a gap of n uninitialised elements at position by relocating
+    /// the elements that follow it. For trivially relocatable types.
+    //*********************************************************************
+    void open_gap(iterator position, size_t n)
+    {
+      etl::uninitialized_relocate(position, p_end, position + n);
+      p_end += n;
+    }
+
+    //*********************************************************************
+    /// Closes a gap of n destroyed elements at position by relocating
+    /// the elements that follow it. For trivially relocatable types.
+    //*********************************************************************
+    void close_gap(iterator position, size_t n)
+    {
+      etl::uninitialized_relocate(position + n, p_end, position);
+      p_end -= n;
+    }
+
     // Disable copy construction.
     ivector(const ivector&) ETL_DELETE;
 
+#if ETL_HAS_CONTAINER_STATISTICS
+    etl::container_statistics statistics; ///< The operation statistics.
+#endif
+
   private:
 
     //*************************************************************************
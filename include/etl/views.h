@@ -0,0 +1,929 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_VIEWS_INCLUDED
+#define ETL_VIEWS_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "alignment.h"
+
+#include <stddef.h>
+
+///\defgroup views views
+/// Lazy views over containers, spans, arrays and other views.
+/// Each view holds a pair of iterators that adapt those of the range it
+/// views, so chained stages run element by element in a single pass,
+/// without temporary containers.
+/// Views may be composed with operator |, or called directly.
+///\code
+/// int total = 0;
+/// for (int x : samples | etl::views::filter(is_valid) | etl::views::transform(scale) | etl::views::take(16))
+/// {
+///   total += x;
+/// }
+///\endcode
+/// A view does not own the elements, so the viewed container must outlive
+/// it. Views of views may be temporaries, as their iterators are copied.
+/// Requires C++11.
+///\ingroup utilities
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  namespace views
+  {
+    //*************************************************************************
+    /// A range given by a pair of iterators.
+    //*************************************************************************
+    template <typename TIterator>
+    class view
+    {
+    public:
+
+      typedef TIterator                                                   iterator;
+      typedef TIterator                                                   const_iterator;
+      typedef typename etl::iterator_traits<TIterator>::value_type        value_type;
+      typedef typename etl::iterator_traits<TIterator>::reference         reference;
+      typedef typename etl::iterator_traits<TIterator>::difference_type   difference_type;
+      typedef size_t                                                      size_type;
+
+      view(TIterator first_, TIterator last_)
+        : first(first_)
+        , last(last_)
+      {
+      }
+
+      TIterator begin() const
+      {
+        return first;
+      }
+
+      TIterator end() const
+      {
+        return last;
+      }
+
+      bool empty() const
+      {
+        return first == last;
+      }
+
+      //***********************************************************************
+      /// The number of elements. Walks the range unless the iterators are
+      /// random access.
+      //***********************************************************************
+      size_t size() const
+      {
+        return static_cast<size_t>(etl::distance(first, last));
+      }
+
+      reference front() const
+      {
+        return *first;
+      }
+
+    private:
+
+      TIterator first;
+      TIterator last;
+    };
+  }
+
+  namespace private_views
+  {
+    //*************************************************************************
+    /// The begin and end of containers, views and arrays.
+    //*************************************************************************
+    template <typename TRange>
+    auto begin_of(TRange& range) -> decltype(range.begin())
+    {
+      return range.begin();
+    }
+
+    template <typename TRange>
+    auto end_of(TRange& range) -> decltype(range.end())
+    {
+      return range.end();
+    }
+
+    template <typename T, size_t Size>
+    T* begin_of(T (&range)[Size])
+    {
+      return range;
+    }
+
+    template <typename T, size_t Size>
+    T* end_of(T (&range)[Size])
+    {
+      return range + Size;
+    }
+
+    //*************************************************************************
+    /// The iterator type of a range.
+    //*************************************************************************
+    template <typename TRange>
+    struct range_iterator
+    {
+      typedef typename etl::decay<decltype(begin_of(etl::declval<typename etl::remove_reference<TRange>::type&>()))>::type type;
+    };
+
+    //*************************************************************************
+    /// Advances the iterator by n, but not past last.
+    //*************************************************************************
+    template <typename TIterator>
+    TIterator advance_bounded(TIterator itr, TIterator last, size_t n, ETL_OR_STD::random_access_iterator_tag)
+    {
+      const size_t remaining = static_cast<size_t>(last - itr);
+
+      return (n < remaining) ? itr + static_cast<typename etl::iterator_traits<TIterator>::difference_type>(n) : last;
+    }
+
+    template <typename TIterator, typename TTag>
+    TIterator advance_bounded(TIterator itr, TIterator last, size_t n, TTag)
+    {
+      while ((n != 0U) && (itr != last))
+      {
+        ++itr;
+        --n;
+      }
+
+      return itr;
+    }
+
+    template <typename TIterator>
+    TIterator advance_bounded(TIterator itr, TIterator last, size_t n)
+    {
+      return advance_bounded(itr, last, n, typename etl::iterator_traits<TIterator>::iterator_category());
+    }
+
+    //*************************************************************************
+    /// Holds a function object, and makes it assignable, as lambdas are not.
+    /// Iterators that hold one may then be assigned.
+    //*************************************************************************
+    template <typename TFunction>
+    class function_box
+    {
+    public:
+
+      explicit function_box(const TFunction& function)
+      {
+        ::new (storage.template get_address<TFunction>()) TFunction(function);
+      }
+
+      function_box(const function_box& other)
+      {
+        ::new (storage.template get_address<TFunction>()) TFunction(other.get());
+      }
+
+      function_box& operator =(const function_box& other)
+      {
+        if (this != &other)
+        {
+          object().~TFunction();
+          ::new (storage.template get_address<TFunction>()) TFunction(other.get());
+        }
+
+        return *this;
+      }
+
+      ~function_box()
+      {
+        object().~TFunction();
+      }
+
+      const TFunction& get() const
+      {
+        return *storage.template get_address<TFunction>();
+      }
+
+    private:
+
+      TFunction& object()
+      {
+        return *storage.template get_address<TFunction>();
+      }
+
+      typename etl::aligned_storage<sizeof(TFunction), etl::alignment_of<TFunction>::value>::type storage;
+    };
+
+    //*************************************************************************
+    /// Applies a function to each element as it is read.
+    /// Has the category of the underlying iterator, though elements are
+    /// returned by value if the function returns them so.
+    //*************************************************************************
+    template <typename TIterator, typename TFunction>
+    class transform_iterator
+    {
+    public:
+
+      typedef typename etl::iterator_traits<TIterator>::iterator_category iterator_category;
+      typedef typename etl::iterator_traits<TIterator>::difference_type   difference_type;
+      typedef decltype(etl::declval<const TFunction&>()(*etl::declval<TIterator&>())) reference;
+      typedef typename etl::decay<reference>::type                        value_type;
+      typedef void                                                        pointer;
+
+      transform_iterator(TIterator itr_, const TFunction& function_)
+        : itr(itr_)
+        , function(function_)
+      {
+      }
+
+      reference operator *() const
+      {
+        return function.get()(*itr);
+      }
+
+      reference operator [](difference_type n) const
+      {
+        return function.get()(itr[n]);
+      }
+
+      transform_iterator& operator ++()
+      {
+        ++itr;
+        return *this;
+      }
+
+      transform_iterator operator ++(int)
+      {
+        transform_iterator temp(*this);
+        ++itr;
+        return temp;
+      }
+
+      transform_iterator& operator --()
+      {
+        --itr;
+        return *this;
+      }
+
+      transform_iterator operator --(int)
+      {
+        transform_iterator temp(*this);
+        --itr;
+        return temp;
+      }
+
+      transform_iterator& operator +=(difference_type n)
+      {
+        itr += n;
+        return *this;
+      }
+
+      transform_iterator& operator -=(difference_type n)
+      {
+        itr -= n;
+        return *this;
+      }
+
+      friend transform_iterator operator +(transform_iterator lhs, difference_type n)
+      {
+        return lhs += n;
+      }
+
+      friend transform_iterator operator +(difference_type n, transform_iterator rhs)
+      {
+        return rhs += n;
+      }
+
+      friend transform_iterator operator -(transform_iterator lhs, difference_type n)
+      {
+        return lhs -= n;
+      }
+
+      friend difference_type operator -(const transform_iterator& lhs, const transform_iterator& rhs)
+      {
+        return lhs.itr - rhs.itr;
+      }
+
+      friend bool operator ==(const transform_iterator& lhs, const transform_iterator& rhs)
+      {
+        return lhs.itr == rhs.itr;
+      }
+
+      friend bool operator !=(const transform_iterator& lhs, const transform_iterator& rhs)
+      {
+        return lhs.itr != rhs.itr;
+      }
+
+      friend bool operator <(const transform_iterator& lhs, const transform_iterator& rhs)
+      {
+        return lhs.itr < rhs.itr;
+      }
+
+      friend bool operator >(const transform_iterator& lhs, const transform_iterator& rhs)
+      {
+        return lhs.itr > rhs.itr;
+      }
+
+      friend bool operator <=(const transform_iterator& lhs, const transform_iterator& rhs)
+      {
+        return lhs.itr <= rhs.itr;
+      }
+
+      friend bool operator >=(const transform_iterator& lhs, const transform_iterator& rhs)
+      {
+        return lhs.itr >= rhs.itr;
+      }
+
+    private:
+
+      TIterator                 itr;
+      function_box<TFunction>   function;
+    };
+
+    //*************************************************************************
+    /// Skips the elements for which the predicate is false.
+    //*************************************************************************
+    template <typename TIterator, typename TPredicate>
+    class filter_iterator
+    {
+    public:
+
+      typedef ETL_OR_STD::forward_iterator_tag                            iterator_category;
+      typedef typename etl::iterator_traits<TIterator>::value_type        value_type;
+      typedef typename etl::iterator_traits<TIterator>::difference_type   difference_type;
+      typedef typename etl::iterator_traits<TIterator>::pointer           pointer;
+      typedef typename etl::iterator_traits<TIterator>::reference         reference;
+
+      filter_iterator(TIterator itr_, TIterator last_, const TPredicate& predicate_)
+        : itr(itr_)
+        , last(last_)
+        , predicate(predicate_)
+      {
+        skip();
+      }
+
+      reference operator *() const
+      {
+        return *itr;
+      }
+
+      filter_iterator& operator ++()
+      {
+        ++itr;
+        skip();
+        return *this;
+      }
+
+      filter_iterator operator ++(int)
+      {
+        filter_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      friend bool operator ==(const filter_iterator& lhs, const filter_iterator& rhs)
+      {
+        return lhs.itr == rhs.itr;
+      }
+
+      friend bool operator !=(const filter_iterator& lhs, const filter_iterator& rhs)
+      {
+        return lhs.itr != rhs.itr;
+      }
+
+    private:
+
+      void skip()
+      {
+        while ((itr != last) && !predicate.get()(*itr))
+        {
+          ++itr;
+        }
+      }
+
+      TIterator                 itr;
+      TIterator                 last;
+      function_box<TPredicate>  predicate;
+    };
+
+    //*************************************************************************
+    /// Stops after a number of elements, or at the end of the range.
+    /// The underlying iterator is not advanced past the last element taken,
+    /// so a filter beneath it reads no further than it must.
+    //*************************************************************************
+    template <typename TIterator>
+    class take_iterator
+    {
+    public:
+
+      typedef ETL_OR_STD::forward_iterator_tag                            iterator_category;
+      typedef typename etl::iterator_traits<TIterator>::value_type        value_type;
+      typedef typename etl::iterator_traits<TIterator>::difference_type   difference_type;
+      typedef typename etl::iterator_traits<TIterator>::pointer           pointer;
+      typedef typename etl::iterator_traits<TIterator>::reference         reference;
+
+      take_iterator(TIterator itr_, size_t remaining_)
+        : itr(itr_)
+        , remaining(remaining_)
+      {
+      }
+
+      reference operator *() const
+      {
+        return *itr;
+      }
+
+      take_iterator& operator ++()
+      {
+        --remaining;
+
+        if (remaining != 0U)
+        {
+          ++itr;
+        }
+
+        return *this;
+      }
+
+      take_iterator operator ++(int)
+      {
+        take_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      // Equal if either has reached the end of its count or range.
+      friend bool operator ==(const take_iterator& lhs, const take_iterator& rhs)
+      {
+        return (lhs.remaining == rhs.remaining) || (lhs.itr == rhs.itr);
+      }
+
+      friend bool operator !=(const take_iterator& lhs, const take_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      TIterator itr;
+      size_t    remaining;
+    };
+
+    //*************************************************************************
+    /// Visits every nth element.
+    //*************************************************************************
+    template <typename TIterator>
+    class stride_iterator
+    {
+    public:
+
+      typedef ETL_OR_STD::forward_iterator_tag                            iterator_category;
+      typedef typename etl::iterator_traits<TIterator>::value_type        value_type;
+      typedef typename etl::iterator_traits<TIterator>::difference_type   difference_type;
+      typedef typename etl::iterator_traits<TIterator>::pointer           pointer;
+      typedef typename etl::iterator_traits<TIterator>::reference         reference;
+
+      stride_iterator(TIterator itr_, TIterator last_, size_t step_)
+        : itr(itr_)
+        , last(last_)
+        , step(step_)
+      {
+      }
+
+      reference operator *() const
+      {
+        return *itr;
+      }
+
+      stride_iterator& operator ++()
+      {
+        itr = advance_bounded(itr, last, step);
+        return *this;
+      }
+
+      stride_iterator operator ++(int)
+      {
+        stride_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      friend bool operator ==(const stride_iterator& lhs, const stride_iterator& rhs)
+      {
+        return lhs.itr == rhs.itr;
+      }
+
+      friend bool operator !=(const stride_iterator& lhs, const stride_iterator& rhs)
+      {
+        return lhs.itr != rhs.itr;
+      }
+
+    private:
+
+      TIterator itr;
+      TIterator last;
+      size_t    step;
+    };
+
+    //*************************************************************************
+    /// Visits the range in views of up to n elements.
+    //*************************************************************************
+    template <typename TIterator>
+    class chunk_iterator
+    {
+    public:
+
+      typedef ETL_OR_STD::forward_iterator_tag                            iterator_category;
+      typedef etl::views::view<TIterator>                                 value_type;
+      typedef typename etl::iterator_traits<TIterator>::difference_type   difference_type;
+      typedef void                                                        pointer;
+      typedef value_type                                                  reference;
+
+      chunk_iterator(TIterator itr_, TIterator last_, size_t size_)
+        : itr(itr_)
+        , last(last_)
+        , size(size_)
+      {
+      }
+
+      reference operator *() const
+      {
+        return value_type(itr, advance_bounded(itr, last, size));
+      }
+
+      chunk_iterator& operator ++()
+      {
+        itr = advance_bounded(itr, last, size);
+        return *this;
+      }
+
+      chunk_iterator operator ++(int)
+      {
+        chunk_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      friend bool operator ==(const chunk_iterator& lhs, const chunk_iterator& rhs)
+      {
+        return lhs.itr == rhs.itr;
+      }
+
+      friend bool operator !=(const chunk_iterator& lhs, const chunk_iterator& rhs)
+      {
+        return lhs.itr != rhs.itr;
+      }
+
+    private:
+
+      TIterator itr;
+      TIterator last;
+      size_t    size;
+    };
+
+    //*************************************************************************
+    /// Visits two ranges together, as pairs of references, until either ends.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    class zip_iterator
+    {
+    public:
+
+      typedef typename etl::iterator_traits<TIterator1>::reference        reference1;
+      typedef typename etl::iterator_traits<TIterator2>::reference        reference2;
+
+      typedef ETL_OR_STD::forward_iterator_tag                            iterator_category;
+      typedef etl::pair<typename etl::iterator_traits<TIterator1>::value_type,
+                        typename etl::iterator_traits<TIterator2>::value_type> value_type;
+      typedef typename etl::iterator_traits<TIterator1>::difference_type  difference_type;
+      typedef void                                                        pointer;
+      typedef etl::pair<reference1, reference2>                           reference;
+
+      zip_iterator(TIterator1 itr1_, TIterator2 itr2_)
+        : itr1(itr1_)
+        , itr2(itr2_)
+      {
+      }
+
+      reference operator *() const
+      {
+        return reference(*itr1, *itr2);
+      }
+
+      zip_iterator& operator ++()
+      {
+        ++itr1;
+        ++itr2;
+        return *this;
+      }
+
+      zip_iterator operator ++(int)
+      {
+        zip_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      // Equal if either range has reached the other's position.
+      friend bool operator ==(const zip_iterator& lhs, const zip_iterator& rhs)
+      {
+        return (lhs.itr1 == rhs.itr1) || (lhs.itr2 == rhs.itr2);
+      }
+
+      friend bool operator !=(const zip_iterator& lhs, const zip_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      TIterator1 itr1;
+      TIterator2 itr2;
+    };
+
+    //*************************************************************************
+    /// Closures returned by the adaptors when called without a range, to be
+    /// applied with operator |.
+    //*************************************************************************
+    struct closure_base
+    {
+    };
+
+    template <typename TFunction>
+    struct transform_closure : closure_base
+    {
+      explicit transform_closure(const TFunction& function_)
+        : function(function_)
+      {
+      }
+
+      template <typename TRange>
+      etl::views::view<transform_iterator<typename range_iterator<TRange>::type, TFunction> > operator()(TRange&& range) const;
+
+      TFunction function;
+    };
+
+    template <typename TPredicate>
+    struct filter_closure : closure_base
+    {
+      explicit filter_closure(const TPredicate& predicate_)
+        : predicate(predicate_)
+      {
+      }
+
+      template <typename TRange>
+      etl::views::view<filter_iterator<typename range_iterator<TRange>::type, TPredicate> > operator()(TRange&& range) const;
+
+      TPredicate predicate;
+    };
+
+    //*************************************************************************
+    /// The closures that take a count.
+    //*************************************************************************
+    struct take_tag   {};
+    struct drop_tag   {};
+    struct stride_tag {};
+    struct chunk_tag  {};
+
+    template <typename TTag>
+    struct count_closure
+    {
+      explicit count_closure(size_t n_)
+        : n(n_)
+      {
+      }
+
+      size_t n;
+    };
+
+    //*************************************************************************
+    /// Applies a closure to a range.
+    //*************************************************************************
+    template <typename TRange, typename TClosure>
+    auto operator |(TRange&& range, const TClosure& closure)
+      -> typename etl::enable_if<etl::is_base_of<closure_base, TClosure>::value,
+                                 decltype(closure(etl::forward<TRange>(range)))>::type
+    {
+      return closure(etl::forward<TRange>(range));
+    }
+  }
+
+  namespace views
+  {
+    //*************************************************************************
+    /// A view of the whole range.
+    //*************************************************************************
+    template <typename TRange>
+    view<typename private_views::range_iterator<TRange>::type> all(TRange&& range)
+    {
+      typedef typename private_views::range_iterator<TRange>::type iterator;
+
+      return view<iterator>(private_views::begin_of(range), private_views::end_of(range));
+    }
+
+    //*************************************************************************
+    /// The results of the function for each element.
+    //*************************************************************************
+    template <typename TRange, typename TFunction>
+    view<private_views::transform_iterator<typename private_views::range_iterator<TRange>::type, TFunction> >
+      transform(TRange&& range, TFunction function)
+    {
+      typedef private_views::transform_iterator<typename private_views::range_iterator<TRange>::type, TFunction> iterator;
+
+      return view<iterator>(iterator(private_views::begin_of(range), function),
+                            iterator(private_views::end_of(range), function));
+    }
+
+    template <typename TFunction>
+    private_views::transform_closure<TFunction> transform(TFunction function)
+    {
+      return private_views::transform_closure<TFunction>(function);
+    }
+
+    //*************************************************************************
+    /// The elements for which the predicate is true.
+    //*************************************************************************
+    template <typename TRange, typename TPredicate>
+    view<private_views::filter_iterator<typename private_views::range_iterator<TRange>::type, TPredicate> >
+      filter(TRange&& range, TPredicate predicate)
+    {
+      typedef private_views::filter_iterator<typename private_views::range_iterator<TRange>::type, TPredicate> iterator;
+
+      return view<iterator>(iterator(private_views::begin_of(range), private_views::end_of(range), predicate),
+                            iterator(private_views::end_of(range), private_views::end_of(range), predicate));
+    }
+
+    template <typename TPredicate>
+    private_views::filter_closure<TPredicate> filter(TPredicate predicate)
+    {
+      return private_views::filter_closure<TPredicate>(predicate);
+    }
+
+    //*************************************************************************
+    /// The first n elements, or all of them if there are fewer.
+    //*************************************************************************
+    template <typename TRange>
+    view<private_views::take_iterator<typename private_views::range_iterator<TRange>::type> >
+      take(TRange&& range, size_t n)
+    {
+      typedef private_views::take_iterator<typename private_views::range_iterator<TRange>::type> iterator;
+
+      return view<iterator>(iterator(private_views::begin_of(range), n),
+                            iterator(private_views::end_of(range), 0U));
+    }
+
+    inline private_views::count_closure<private_views::take_tag> take(size_t n)
+    {
+      return private_views::count_closure<private_views::take_tag>(n);
+    }
+
+    //*************************************************************************
+    /// All but the first n elements.
+    //*************************************************************************
+    template <typename TRange>
+    view<typename private_views::range_iterator<TRange>::type> drop(TRange&& range, size_t n)
+    {
+      typedef typename private_views::range_iterator<TRange>::type iterator;
+
+      const iterator last = private_views::end_of(range);
+
+      return view<iterator>(private_views::advance_bounded(iterator(private_views::begin_of(range)), last, n), last);
+    }
+
+    inline private_views::count_closure<private_views::drop_tag> drop(size_t n)
+    {
+      return private_views::count_closure<private_views::drop_tag>(n);
+    }
+
+    //*************************************************************************
+    /// Every nth element, starting with the first.
+    //*************************************************************************
+    template <typename TRange>
+    view<private_views::stride_iterator<typename private_views::range_iterator<TRange>::type> >
+      stride(TRange&& range, size_t n)
+    {
+      typedef private_views::stride_iterator<typename private_views::range_iterator<TRange>::type> iterator;
+
+      return view<iterator>(iterator(private_views::begin_of(range), private_views::end_of(range), n),
+                            iterator(private_views::end_of(range), private_views::end_of(range), n));
+    }
+
+    inline private_views::count_closure<private_views::stride_tag> stride(size_t n)
+    {
+      return private_views::count_closure<private_views::stride_tag>(n);
+    }
+
+    //*************************************************************************
+    /// Views of n elements, the last of which may be shorter.
+    //*************************************************************************
+    template <typename TRange>
+    view<private_views::chunk_iterator<typename private_views::range_iterator<TRange>::type> >
+      chunk(TRange&& range, size_t n)
+    {
+      typedef private_views::chunk_iterator<typename private_views::range_iterator<TRange>::type> iterator;
+
+      return view<iterator>(iterator(private_views::begin_of(range), private_views::end_of(range), n),
+                            iterator(private_views::end_of(range), private_views::end_of(range), n));
+    }
+
+    inline private_views::count_closure<private_views::chunk_tag> chunk(size_t n)
+    {
+      return private_views::count_closure<private_views::chunk_tag>(n);
+    }
+
+    //*************************************************************************
+    /// Pairs of references to the elements of two ranges, as long as the
+    /// shorter.
+    //*************************************************************************
+    template <typename TRange1, typename TRange2>
+    view<private_views::zip_iterator<typename private_views::range_iterator<TRange1>::type,
+                                     typename private_views::range_iterator<TRange2>::type> >
+      zip(TRange1&& range1, TRange2&& range2)
+    {
+      typedef private_views::zip_iterator<typename private_views::range_iterator<TRange1>::type,
+                                          typename private_views::range_iterator<TRange2>::type> iterator;
+
+      return view<iterator>(iterator(private_views::begin_of(range1), private_views::begin_of(range2)),
+                            iterator(private_views::end_of(range1), private_views::end_of(range2)));
+    }
+  }
+
+  namespace private_views
+  {
+    //*************************************************************************
+    template <typename TFunction>
+    template <typename TRange>
+    etl::views::view<transform_iterator<typename range_iterator<TRange>::type, TFunction> >
+      transform_closure<TFunction>::operator()(TRange&& range) const
+    {
+      return etl::views::transform(etl::forward<TRange>(range), function);
+    }
+
+    //*************************************************************************
+    template <typename TPredicate>
+    template <typename TRange>
+    etl::views::view<filter_iterator<typename range_iterator<TRange>::type, TPredicate> >
+      filter_closure<TPredicate>::operator()(TRange&& range) const
+    {
+      return etl::views::filter(etl::forward<TRange>(range), predicate);
+    }
+
+    //*************************************************************************
+    template <typename TRange>
+    auto operator |(TRange&& range, const count_closure<take_tag>& closure)
+      -> decltype(etl::views::take(etl::forward<TRange>(range), closure.n))
+    {
+      return etl::views::take(etl::forward<TRange>(range), closure.n);
+    }
+
+    template <typename TRange>
+    auto operator |(TRange&& range, const count_closure<drop_tag>& closure)
+      -> decltype(etl::views::drop(etl::forward<TRange>(range), closure.n))
+    {
+      return etl::views::drop(etl::forward<TRange>(range), closure.n);
+    }
+
+    template <typename TRange>
+    auto operator |(TRange&& range, const count_closure<stride_tag>& closure)
+      -> decltype(etl::views::stride(etl::forward<TRange>(range), closure.n))
+    {
+      return etl::views::stride(etl::forward<TRange>(range), closure.n);
+    }
+
+    template <typename TRange>
+    auto operator |(TRange&& range, const count_closure<chunk_tag>& closure)
+      -> decltype(etl::views::chunk(etl::forward<TRange>(range), closure.n))
+    {
+      return etl::views::chunk(etl::forward<TRange>(range), closure.n);
+    }
+  }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,259 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WORKER_POOL_INCLUDED
+#define ETL_WORKER_POOL_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup worker_pool worker_pool
+/// A heap free pool of workers that execute the chunks of one job at a time.
+/// The pool does not create threads. Each worker thread, created however the
+/// platform does it, calls run(), or process() from its own loop.
+/// The thread that submits a job executes chunks too, so a job completes even
+/// if no worker is running.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup worker_pool
+  //***************************************************************************
+  class worker_pool
+  {
+  public:
+
+    /// The function that executes one chunk of a job.
+    typedef void (*chunk_function_t)(void* context, size_t chunk);
+
+    /// Called by run() when there is no work.
+    typedef void (*idle_function_t)();
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param worker_count_ The number of threads that will call run() or
+    /// process(). Used to decide how many chunks to split a job into.
+    //*************************************************************************
+    explicit worker_pool(size_t worker_count_)
+      : busy(false)
+      , current(ETL_NULLPTR)
+      , users(0U)
+      , stopping(false)
+      , workers(worker_count_)
+    {
+    }
+
+    //*************************************************************************
+    /// The number of worker threads.
+    //*************************************************************************
+    size_t worker_count() const
+    {
+      return workers;
+    }
+
+    //*************************************************************************
+    /// The number of threads that execute a job, including the submitter.
+    //*************************************************************************
+    size_t concurrency() const
+    {
+      return workers + 1U;
+    }
+
+    //*************************************************************************
+    /// Executes chunk_count chunks of a job, returning when all have finished.
+    /// The calling thread executes chunks alongside the workers.
+    /// If another job is running, from another thread or because this is
+    /// called from within a chunk, the chunks are executed here, in order.
+    //*************************************************************************
+    void execute(chunk_function_t function, void* context, size_t chunk_count)
+    {
+      if (chunk_count == 0U)
+      {
+        return;
+      }
+
+      if ((chunk_count == 1U) || busy.exchange(true))
+      {
+        for (size_t chunk = 0U; chunk < chunk_count; ++chunk)
+        {
+          function(context, chunk);
+        }
+
+        return;
+      }
+
+      job_t job(function, context, chunk_count);
+
+      current.store(&job);
+
+      process_job(job);
+
+      while (job.done.load() != chunk_count)
+      {
+        // Wait for chunks still running on workers.
+      }
+
+      // No worker may still be looking at the job when it goes out of scope.
+      current.store(ETL_NULLPTR);
+
+      while (users.load() != 0U)
+      {
+      }
+
+      busy.store(false);
+    }
+
+    //*************************************************************************
+    /// Executes chunks of the current job, if there is one.
+    /// Called by worker threads.
+    ///\return <b>true</b> if any chunks were executed.
+    //*************************************************************************
+    bool process()
+    {
+      bool executed = false;
+
+      users.fetch_add(1U);
+
+      job_t* job = current.load();
+
+      if (job != ETL_NULLPTR)
+      {
+        executed = process_job(*job);
+      }
+
+      users.fetch_sub(1U);
+
+      return executed;
+    }
+
+    //*************************************************************************
+    /// Processes jobs until stop() is called.
+    /// Called by worker threads.
+    ///\param idle Called when there is no work, to yield or sleep. May be null.
+    //*************************************************************************
+    void run(idle_function_t idle = ETL_NULLPTR)
+    {
+      while (!stopping.load())
+      {
+        if (!process() && (idle != ETL_NULLPTR))
+        {
+          idle();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Makes run() return.
+    //*************************************************************************
+    void stop()
+    {
+      stopping.store(true);
+    }
+
+    //*************************************************************************
+    /// Allows run() to be called again after stop().
+    //*************************************************************************
+    void restart()
+    {
+      stopping.store(false);
+    }
+
+    //*************************************************************************
+    /// Has stop() been called?
+    //*************************************************************************
+    bool is_stopped() const
+    {
+      return stopping.load();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A job. Chunks are claimed in order by incrementing 'next'.
+    //*************************************************************************
+    struct job_t
+    {
+      job_t(chunk_function_t function_, void* context_, size_t chunk_count_)
+        : function(function_)
+        , context(context_)
+        , chunk_count(chunk_count_)
+        , next(0U)
+        , done(0U)
+      {
+      }
+
+      chunk_function_t    function;
+      void*               context;
+      size_t              chunk_count;
+      etl::atomic<size_t> next;
+      etl::atomic<size_t> done;
+    };
+
+    //*************************************************************************
+    /// Executes chunks of the job until none are left to claim.
+    //*************************************************************************
+    static bool process_job(job_t& job)
+    {
+      bool executed = false;
+
+      size_t chunk = job.next.fetch_add(1U);
+
+      while (chunk < job.chunk_count)
+      {
+        job.function(job.context, chunk);
+        job.done.fetch_add(1U);
+        executed = true;
+
+        chunk = job.next.fetch_add(1U);
+      }
+
+      return executed;
+    }
+
+    // Disabled.
+    worker_pool(const worker_pool&) ETL_DELETE;
+    worker_pool& operator =(const worker_pool&) ETL_DELETE;
+
+    etl::atomic<bool>    busy;
+    etl::atomic<job_t*>  current;
+    etl::atomic<size_t>  users;
+    etl::atomic<bool>    stopping;
+    const size_t         workers;
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,553 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_XXHASH_INCLUDED
+#define ETL_XXHASH_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "iterator.h"
+#include "binary.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+ETL_STATIC_ASSERT(ETL_USING_8BIT_TYPES, "This file does not currently support targets with no 8bit type");
+
+///\defgroup xxhash xxHash XXH32 & XXH64 hash calculations
+/// Non-cryptographic hashes that consume 16 or 32 bytes per step.
+/// The results are identical to the reference XXH32 and XXH64 implementations.
+/// Define ETL_USE_XXHASH to make etl::hash use them for strings, string views and spans.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_xxhash
+  {
+    //*************************************************************************
+    /// Reads a little endian 32 bit value, one byte at a time so that it may
+    /// be used in constant expressions.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 uint32_t read_u32(const T* p)
+    {
+      return  static_cast<uint32_t>(static_cast<uint8_t>(p[0]))         |
+             (static_cast<uint32_t>(static_cast<uint8_t>(p[1])) << 8U)  |
+             (static_cast<uint32_t>(static_cast<uint8_t>(p[2])) << 16U) |
+             (static_cast<uint32_t>(static_cast<uint8_t>(p[3])) << 24U);
+    }
+
+    //*************************************************************************
+    /// The XXH32 steps.
+    //*************************************************************************
+    struct xxhash32_policy
+    {
+      typedef uint32_t value_type;
+
+      static ETL_CONSTANT size_t Stripe_Size = 16U;
+
+      static ETL_CONSTANT uint32_t Prime1 = 0x9E3779B1UL;
+      static ETL_CONSTANT uint32_t Prime2 = 0x85EBCA77UL;
+      static ETL_CONSTANT uint32_t Prime3 = 0xC2B2AE3DUL;
+      static ETL_CONSTANT uint32_t Prime4 = 0x27D4EB2FUL;
+      static ETL_CONSTANT uint32_t Prime5 = 0x165667B1UL;
+
+      //***********************************
+      static ETL_CONSTEXPR14 uint32_t round(uint32_t accumulator, uint32_t input)
+      {
+        accumulator += input * Prime2;
+        accumulator  = etl::rotate_left(accumulator, 13U);
+        accumulator *= Prime1;
+
+        return accumulator;
+      }
+
+      //***********************************
+      static ETL_CONSTEXPR14 void initial(uint32_t* v, uint32_t seed)
+      {
+        v[0] = seed + Prime1 + Prime2;
+        v[1] = seed + Prime2;
+        v[2] = seed;
+        v[3] = seed - Prime1;
+      }
+
+      //***********************************
+      template <typename T>
+      static ETL_CONSTEXPR14 void add_stripe(uint32_t* v, const T* p)
+      {
+        v[0] = round(v[0], read_u32(p));
+        v[1] = round(v[1], read_u32(p + 4U));
+        v[2] = round(v[2], read_u32(p + 8U));
+        v[3] = round(v[3], read_u32(p + 12U));
+      }
+
+      //***********************************
+      static ETL_CONSTEXPR14 uint32_t converge(const uint32_t* v)
+      {
+        return etl::rotate_left(v[0], 1U) + etl::rotate_left(v[1], 7U) + etl::rotate_left(v[2], 12U) + etl::rotate_left(v[3], 18U);
+      }
+
+      //***********************************
+      static ETL_CONSTEXPR14 uint32_t short_initial(uint32_t seed)
+      {
+        return seed + Prime5;
+      }
+
+      //***********************************
+      /// Adds the remaining, less than Stripe_Size, bytes and mixes the result.
+      //***********************************
+      template <typename T>
+      static ETL_CONSTEXPR14 uint32_t final(uint32_t hash, uint64_t total_length, const T* p, size_t length)
+      {
+        hash += static_cast<uint32_t>(total_length);
+
+        while (length >= 4U)
+        {
+          hash += read_u32(p) * Prime3;
+          hash  = etl::rotate_left(hash, 17U) * Prime4;
+          p      += 4U;
+          length -= 4U;
+        }
+
+        while (length != 0U)
+        {
+          hash += static_cast<uint32_t>(static_cast<uint8_t>(*p)) * Prime5;
+          hash  = etl::rotate_left(hash, 11U) * Prime1;
+          ++p;
+          --length;
+        }
+
+        hash ^= hash >> 15U;
+        hash *= Prime2;
+        hash ^= hash >> 13U;
+        hash *= Prime3;
+        hash ^= hash >> 16U;
+
+        return hash;
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Reads a little endian 64 bit value, one byte at a time so that it may
+    /// be used in constant expressions.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 uint64_t read_u64(const T* p)
+    {
+      return static_cast<uint64_t>(read_u32(p)) | (static_cast<uint64_t>(read_u32(p + 4U)) << 32U);
+    }
+
+    //*************************************************************************
+    /// The XXH64 steps.
+    //*************************************************************************
+    struct xxhash64_policy
+    {
+      typedef uint64_t value_type;
+
+      static ETL_CONSTANT size_t Stripe_Size = 32U;
+
+      static ETL_CONSTANT uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+      static ETL_CONSTANT uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+      static ETL_CONSTANT uint64_t Prime3 = 0x165667B19E3779F9ULL;
+      static ETL_CONSTANT uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+      static ETL_CONSTANT uint64_t Prime5 = 0x27D4EB2F165667C5ULL;
+
+      //***********************************
+      static ETL_CONSTEXPR14 uint64_t round(uint64_t accumulator, uint64_t input)
+      {
+        accumulator += input * Prime2;
+        accumulator  = etl::rotate_left(accumulator, 31U);
+        accumulator *= Prime1;
+
+        return accumulator;
+      }
+
+      //***********************************
+      static ETL_CONSTEXPR14 uint64_t merge_round(uint64_t accumulator, uint64_t value)
+      {
+        accumulator ^= round(0U, value);
+        accumulator  = (accumulator * Prime1) + Prime4;
+
+        return accumulator;
+      }
+
+      //***********************************
+      static ETL_CONSTEXPR14 void initial(uint64_t* v, uint64_t seed)
+      {
+        v[0] = seed + Prime1 + Prime2;
+        v[1] = seed + Prime2;
+        v[2] = seed;
+        v[3] = seed - Prime1;
+      }
+
+      //***********************************
+      template <typename T>
+      static ETL_CONSTEXPR14 void add_stripe(uint64_t* v, const T* p)
+      {
+        v[0] = round(v[0], read_u64(p));
+        v[1] = round(v[1], read_u64(p + 8U));
+        v[2] = round(v[2], read_u64(p + 16U));
+        v[3] = round(v[3], read_u64(p + 24U));
+      }
+
+      //***********************************
+      static ETL_CONSTEXPR14 uint64_t converge(const uint64_t* v)
+      {
+        uint64_t hash = etl::rotate_left(v[0], 1U) + etl::rotate_left(v[1], 7U) + etl::rotate_left(v[2], 12U) + etl::rotate_left(v[3], 18U);
+
+        hash = merge_round(hash, v[0]);
+        hash = merge_round(hash, v[1]);
+        hash = merge_round(hash, v[2]);
+        hash = merge_round(hash, v[3]);
+
+        return hash;
+      }
+
+      //***********************************
+      static ETL_CONSTEXPR14 uint64_t short_initial(uint64_t seed)
+      {
+        return seed + Prime5;
+      }
+
+      //***********************************
+      /// Adds the remaining, less than Stripe_Size, bytes and mixes the result.
+      //***********************************
+      template <typename T>
+      static ETL_CONSTEXPR14 uint64_t final(uint64_t hash, uint64_t total_length, const T* p, size_t length)
+      {
+        hash += total_length;
+
+        while (length >= 8U)
+        {
+          hash ^= round(0U, read_u64(p));
+          hash  = (etl::rotate_left(hash, 27U) * Prime1) + Prime4;
+          p      += 8U;
+          length -= 8U;
+        }
+
+        if (length >= 4U)
+        {
+          hash ^= static_cast<uint64_t>(read_u32(p)) * Prime1;
+          hash  = (etl::rotate_left(hash, 23U) * Prime2) + Prime3;
+          p      += 4U;
+          length -= 4U;
+        }
+
+        while (length != 0U)
+        {
+          hash ^= static_cast<uint64_t>(static_cast<uint8_t>(*p)) * Prime5;
+          hash  = etl::rotate_left(hash, 11U) * Prime1;
+          ++p;
+          --length;
+        }
+
+        hash ^= hash >> 33U;
+        hash *= Prime2;
+        hash ^= hash >> 29U;
+        hash *= Prime3;
+        hash ^= hash >> 32U;
+
+        return hash;
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// Calculates the hash of a buffer in one call.
+    //*************************************************************************
+    template <typename TPolicy, typename T>
+    ETL_CONSTEXPR14 typename TPolicy::value_type calculate(const T* p, size_t length, typename TPolicy::value_type seed)
+    {
+      typedef typename TPolicy::value_type value_type;
+
+      const uint64_t total_length = length;
+      value_type hash = TPolicy::short_initial(seed);
+
+      if (length >= TPolicy::Stripe_Size)
+      {
+        value_type v[4] = { 0, 0, 0, 0 };
+        TPolicy::initial(v, seed);
+
+        while (length >= TPolicy::Stripe_Size)
+        {
+          TPolicy::add_stripe(v, p);
+          p      += TPolicy::Stripe_Size;
+          length -= TPolicy::Stripe_Size;
+        }
+
+        hash = TPolicy::converge(v);
+      }
+
+      return TPolicy::final(hash, total_length, p, length);
+    }
+
+    //*************************************************************************
+    /// The streaming hash, common to XXH32 and XXH64.
+    /// Input is consumed a stripe at a time, with any partial stripe held until
+    /// the next call or until value() is called.
+    //*************************************************************************
+    template <typename TPolicy>
+    class xxhash_base
+    {
+    public:
+
+      typedef typename TPolicy::value_type value_type;
+
+      //*************************************************************************
+      /// Resets the hash to the initial state.
+      //*************************************************************************
+      void reset()
+      {
+        TPolicy::initial(v, seed);
+        buffer_size  = 0U;
+        total_length = 0U;
+      }
+
+      //*************************************************************************
+      /// Adds a range.
+      /// \param begin
+      /// \param end
+      //*************************************************************************
+      template <typename TIterator>
+      void add(TIterator begin, const TIterator end)
+      {
+        ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+        add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+      }
+
+      //*************************************************************************
+      /// Adds a uint8_t value.
+      /// \param value The char to add to the hash.
+      //*************************************************************************
+      void add(uint8_t value_)
+      {
+        buffer[buffer_size++] = value_;
+        ++total_length;
+
+        if (buffer_size == TPolicy::Stripe_Size)
+        {
+          TPolicy::add_stripe(v, buffer);
+          buffer_size = 0U;
+        }
+      }
+
+      //*************************************************************************
+      /// Gets the hash value.
+      /// More data may be added afterwards.
+      //*************************************************************************
+      value_type value() const
+      {
+        const value_type hash = (total_length >= TPolicy::Stripe_Size) ? TPolicy::converge(v) : TPolicy::short_initial(seed);
+
+        return TPolicy::final(hash, total_length, buffer, buffer_size);
+      }
+
+      //*************************************************************************
+      /// Conversion operator to value_type.
+      //*************************************************************************
+      operator value_type () const
+      {
+        return value();
+      }
+
+    protected:
+
+      //*************************************************************************
+      /// Constructor.
+      //*************************************************************************
+      explicit xxhash_base(value_type seed_)
+        : seed(seed_)
+      {
+        reset();
+      }
+
+    private:
+
+      //*************************************************************************
+      /// Adds a range of bytes in memory, a stripe at a time.
+      //*************************************************************************
+      template <typename TPointer>
+      void add_range(TPointer begin, const TPointer end, etl::true_type)
+      {
+        size_t length = static_cast<size_t>(end - begin);
+        total_length += length;
+
+        // Complete any partial stripe.
+        if (buffer_size != 0U)
+        {
+          while ((buffer_size < TPolicy::Stripe_Size) && (length != 0U))
+          {
+            buffer[buffer_size++] = static_cast<uint8_t>(*begin++);
+            --length;
+          }
+
+          if (buffer_size < TPolicy::Stripe_Size)
+          {
+            return;
+          }
+
+          TPolicy::add_stripe(v, buffer);
+          buffer_size = 0U;
+        }
+
+        while (length >= TPolicy::Stripe_Size)
+        {
+          TPolicy::add_stripe(v, begin);
+          begin  += TPolicy::Stripe_Size;
+          length -= TPolicy::Stripe_Size;
+        }
+
+        // Hold the remainder. The buffer is empty and length < Stripe_Size.
+        for (size_t i = 0U; i < length; ++i)
+        {
+          buffer[i] = static_cast<uint8_t>(begin[i]);
+        }
+
+        buffer_size = length;
+      }
+
+      //*************************************************************************
+      /// Adds a range of bytes from other iterators, one at a time.
+      //*************************************************************************
+      template <typename TIterator>
+      void add_range(TIterator begin, const TIterator end, etl::false_type)
+      {
+        while (begin != end)
+        {
+          add(static_cast<uint8_t>(*begin));
+          ++begin;
+        }
+      }
+
+      value_type v[4];
+      uint8_t    buffer[TPolicy::Stripe_Size];
+      size_t     buffer_size;
+      uint64_t   total_length;
+      value_type seed;
+    };
+  }
+
+  //***************************************************************************
+  /// Calculates the XXH32 hash.
+  ///\ingroup xxhash
+  //***************************************************************************
+  class xxhash32 : public private_xxhash::xxhash_base<private_xxhash::xxhash32_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    explicit xxhash32(value_type seed_ = 0U)
+      : xxhash_base(seed_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template <typename TIterator>
+    xxhash32(TIterator begin, const TIterator end, value_type seed_ = 0U)
+      : xxhash_base(seed_)
+    {
+      this->add(begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// Calculates the XXH32 hash of a buffer.
+  /// May be used in constant expressions from C++14.
+  ///\ingroup xxhash
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), uint32_t>::type
+    xxhash32_calculate(const T* data, size_t length, uint32_t seed = 0U)
+  {
+    return private_xxhash::calculate<private_xxhash::xxhash32_policy>(data, length, seed);
+  }
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Calculates the XXH64 hash.
+  ///\ingroup xxhash
+  //***************************************************************************
+  class xxhash64 : public private_xxhash::xxhash_base<private_xxhash::xxhash64_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    explicit xxhash64(value_type seed_ = 0U)
+      : xxhash_base(seed_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template <typename TIterator>
+    xxhash64(TIterator begin, const TIterator end, value_type seed_ = 0U)
+      : xxhash_base(seed_)
+    {
+      this->add(begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// Calculates the XXH64 hash of a buffer.
+  /// May be used in constant expressions from C++14.
+  ///\ingroup xxhash
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), uint64_t>::type
+    xxhash64_calculate(const T* data, size_t length, uint64_t seed = 0U)
+  {
+    return private_xxhash::calculate<private_xxhash::xxhash64_policy>(data, length, seed);
+  }
+#endif
+}
+
+#endif
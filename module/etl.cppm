@@ -0,0 +1,134 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Experimental C++20 module interface for the ETL containers.
+// Built by the etl::module CMake target when ETL_BUILD_MODULE is ON.
+//
+// The headers are included in the global module fragment, so the module is
+// built with the same profile (etl_profile.h or compiler definitions) as the
+// code that imports it. Macros, such as ETL_ASSERT, are not exported; code that
+// needs them must still include the headers.
+//*****************************************************************************
+
+module;
+
+#include "etl/platform.h"
+
+#include "etl/array.h"
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/list.h"
+#include "etl/forward_list.h"
+#include "etl/map.h"
+#include "etl/multimap.h"
+#include "etl/set.h"
+#include "etl/multiset.h"
+#include "etl/unordered_map.h"
+#include "etl/unordered_multimap.h"
+#include "etl/unordered_set.h"
+#include "etl/unordered_multiset.h"
+#include "etl/flat_map.h"
+#include "etl/flat_multimap.h"
+#include "etl/flat_set.h"
+#include "etl/flat_multiset.h"
+#include "etl/queue.h"
+#include "etl/stack.h"
+#include "etl/priority_queue.h"
+#include "etl/circular_buffer.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/span.h"
+
+export module etl;
+
+export namespace etl
+{
+  // Sequence containers.
+  using etl::array;
+  using etl::vector;
+  using etl::ivector;
+  using etl::deque;
+  using etl::ideque;
+  using etl::list;
+  using etl::ilist;
+  using etl::forward_list;
+  using etl::iforward_list;
+  using etl::circular_buffer;
+  using etl::icircular_buffer;
+
+  // Associative containers.
+  using etl::map;
+  using etl::imap;
+  using etl::multimap;
+  using etl::imultimap;
+  using etl::set;
+  using etl::iset;
+  using etl::multiset;
+  using etl::imultiset;
+  using etl::flat_map;
+  using etl::iflat_map;
+  using etl::flat_multimap;
+  using etl::iflat_multimap;
+  using etl::flat_set;
+  using etl::iflat_set;
+  using etl::flat_multiset;
+  using etl::iflat_multiset;
+
+  // Hashed containers.
+  using etl::unordered_map;
+  using etl::iunordered_map;
+  using etl::unordered_multimap;
+  using etl::iunordered_multimap;
+  using etl::unordered_set;
+  using etl::iunordered_set;
+  using etl::unordered_multiset;
+  using etl::iunordered_multiset;
+
+  // Adaptors.
+  using etl::queue;
+  using etl::iqueue;
+  using etl::stack;
+  using etl::istack;
+  using etl::priority_queue;
+  using etl::ipriority_queue;
+
+  // Strings and views.
+  using etl::ibasic_string;
+  using etl::istring;
+  using etl::string;
+  using etl::string_ext;
+  using etl::basic_string_view;
+  using etl::string_view;
+  using etl::span;
+
+  // Called by name as well as found by argument dependent lookup.
+  using etl::swap;
+}
@@ -0,0 +1,167 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PERFORMANCE_BENCHMARK_INCLUDED
+#define ETL_PERFORMANCE_BENCHMARK_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+//*****************************************************************************
+// A minimal benchmark harness for comparing ETL components with their
+// std counterparts.
+//
+// A benchmark is a function that performs a batch of operations and returns
+// the number of operations that it performed. The harness times each batch,
+// repeating it until the minimum run time has elapsed, and reports:
+//   Throughput : total operations / total time.
+//   Latency    : the median, 99th percentile and maximum batch time, divided
+//                by the number of operations in the batch.
+//
+// Define one with
+//   ETL_BENCHMARK(group, name, implementation)
+//   {
+//     ...
+//     return operations;
+//   }
+// where 'group' is the component family, 'name' describes the operation and
+// 'implementation' is usually 'etl' or 'std'.
+//*****************************************************************************
+
+namespace benchmark
+{
+  typedef size_t (*function_type)();
+
+  //***************************************************************************
+  /// A registered benchmark.
+  //***************************************************************************
+  struct entry
+  {
+    const char*   group;
+    const char*   name;
+    const char*   implementation;
+    function_type function;
+  };
+
+  //***************************************************************************
+  /// The measured result of a benchmark.
+  //***************************************************************************
+  struct result
+  {
+    const entry* pentry;
+    size_t       batches;
+    uint64_t     operations;
+    double       ops_per_second;
+    double       ns_per_op_median;
+    double       ns_per_op_p99;
+    double       ns_per_op_max;
+  };
+
+  //***************************************************************************
+  /// The registered benchmarks.
+  //***************************************************************************
+  std::vector<entry>& registry();
+
+  //***************************************************************************
+  /// Registers a benchmark at static initialisation time.
+  //***************************************************************************
+  struct registrar
+  {
+    registrar(const char* group, const char* name, const char* implementation, function_type function)
+    {
+      entry e = { group, name, implementation, function };
+      registry().push_back(e);
+    }
+  };
+
+  //***************************************************************************
+  /// Stops the compiler from optimising away a value.
+  //***************************************************************************
+  template <typename T>
+  inline void do_not_optimise(const T& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+  }
+
+  //***************************************************************************
+  /// Stops the compiler from assuming the contents of memory.
+  //***************************************************************************
+  inline void clobber_memory()
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+  }
+
+  //***************************************************************************
+  /// A deterministic pseudo random sequence, so that every implementation
+  /// is given the same keys.
+  //***************************************************************************
+  class random
+  {
+  public:
+
+    explicit random(uint32_t seed = 0x12345678UL)
+      : state(seed)
+    {
+    }
+
+    uint32_t operator()()
+    {
+      // xorshift32
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+
+      return state;
+    }
+
+  private:
+
+    uint32_t state;
+  };
+}
+
+#define ETL_BENCHMARK_CONCAT2(a, b) a##b
+#define ETL_BENCHMARK_CONCAT(a, b)  ETL_BENCHMARK_CONCAT2(a, b)
+
+#define ETL_BENCHMARK(group, name, implementation)                                                             \
+  static size_t ETL_BENCHMARK_CONCAT(benchmark_, __LINE__)();                                                  \
+  static benchmark::registrar ETL_BENCHMARK_CONCAT(registrar_, __LINE__)(#group, #name, #implementation,       \
+                                                                         &ETL_BENCHMARK_CONCAT(benchmark_, __LINE__)); \
+  static size_t ETL_BENCHMARK_CONCAT(benchmark_, __LINE__)()
+
+#endif
@@ -0,0 +1,220 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+#include "etl/histogram.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  const size_t Size = 4096U;
+
+  //***************************************************************************
+  /// Signal samples. No sample equals Missing.
+  //***************************************************************************
+  const std::vector<int16_t>& samples()
+  {
+    static std::vector<int16_t> values;
+
+    if (values.empty())
+    {
+      benchmark::random generator;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        values.push_back(int16_t(generator() % 30000U));
+      }
+    }
+
+    return values;
+  }
+
+  const int16_t Missing = -1;
+
+  std::vector<int16_t> copy_of_samples(samples());
+
+  const int16_t* first()       { return samples().data(); }
+  const int16_t* last()        { return samples().data() + Size; }
+  const int16_t* other_first() { return copy_of_samples.data(); }
+
+  //***************************************************************************
+  /// A sorted table, larger than the L1 cache, and the keys to look up.
+  //***************************************************************************
+  const size_t Table_Size   = 65536U;
+  const size_t Lookup_Count = 256U;
+
+  const std::vector<uint32_t>& table()
+  {
+    static std::vector<uint32_t> values;
+
+    if (values.empty())
+    {
+      benchmark::random generator;
+
+      for (size_t i = 0U; i < Table_Size; ++i)
+      {
+        values.push_back(generator());
+      }
+
+      std::sort(values.begin(), values.end());
+    }
+
+    return values;
+  }
+
+  const std::vector<uint32_t>& lookups()
+  {
+    static std::vector<uint32_t> values;
+
+    if (values.empty())
+    {
+      benchmark::random generator;
+
+      for (size_t i = 0U; i < Lookup_Count; ++i)
+      {
+        values.push_back(generator());
+      }
+    }
+
+    return values;
+  }
+
+  const uint32_t* found[Lookup_Count];
+
+  //***************************************************************************
+  template <typename TSearch>
+  size_t search_table(TSearch search)
+  {
+    const uint32_t* table_first = table().data();
+    const uint32_t* table_last  = table_first + Table_Size;
+
+    for (size_t i = 0U; i < Lookup_Count; ++i)
+    {
+      found[i] = search(table_first, table_last, lookups()[i]);
+    }
+
+    benchmark::do_not_optimise(found[Lookup_Count - 1U]);
+
+    return Lookup_Count;
+  }
+
+  const uint32_t* etl_lower_bound(const uint32_t* first, const uint32_t* last, uint32_t key)            { return etl::lower_bound(first, last, key); }
+  const uint32_t* etl_branchless_lower_bound(const uint32_t* first, const uint32_t* last, uint32_t key) { return etl::branchless_lower_bound(first, last, key); }
+  const uint32_t* std_lower_bound(const uint32_t* first, const uint32_t* last, uint32_t key)            { return std::lower_bound(first, last, key); }
+
+  size_t search_table_batch()
+  {
+    const uint32_t* table_first = table().data();
+
+    etl::lower_bound_batch(table_first, table_first + Table_Size, lookups().begin(), lookups().end(), found);
+
+    benchmark::do_not_optimise(found[Lookup_Count - 1U]);
+
+    return Lookup_Count;
+  }
+
+  //***************************************************************************
+  /// 8 bit pixels, with the runs of equal values found in real images.
+  //***************************************************************************
+  const std::vector<uint8_t>& pixels()
+  {
+    static std::vector<uint8_t> values;
+
+    if (values.empty())
+    {
+      benchmark::random generator;
+
+      while (values.size() < Size)
+      {
+        const uint8_t value  = uint8_t(generator() % 256U);
+        const size_t  length = 1U + (generator() % 16U);
+
+        for (size_t i = 0U; (i < length) && (values.size() < Size); ++i)
+        {
+          values.push_back(value);
+        }
+      }
+    }
+
+    return values;
+  }
+
+  typedef etl::histogram<uint8_t, uint32_t, 256U, 0> Pixel_Histogram;
+
+  size_t histogram_add()
+  {
+    Pixel_Histogram histogram;
+    histogram.add(pixels().begin(), pixels().end());
+    benchmark::do_not_optimise(histogram[0]);
+
+    return Size;
+  }
+
+  size_t histogram_add_bulk()
+  {
+    Pixel_Histogram histogram;
+    histogram.add_bulk(pixels().begin(), pixels().end());
+    benchmark::do_not_optimise(histogram[0]);
+
+    return Size;
+  }
+}
+
+//*****************************************************************************
+// Kernels over contiguous int16_t samples, samples per second.
+//*****************************************************************************
+ETL_BENCHMARK(min_element, int16_t, etl)         { benchmark::do_not_optimise(etl::min_element(first(), last())); return Size; }
+ETL_BENCHMARK(min_element, int16_t, etl_compare) { benchmark::do_not_optimise(etl::min_element(first(), last(), etl::less<int16_t>())); return Size; }
+ETL_BENCHMARK(min_element, int16_t, std)         { benchmark::do_not_optimise(std::min_element(first(), last())); return Size; }
+
+ETL_BENCHMARK(find, int16_t, etl) { benchmark::do_not_optimise(etl::find(first(), last(), Missing)); return Size; }
+ETL_BENCHMARK(find, int16_t, std) { benchmark::do_not_optimise(std::find(first(), last(), Missing)); return Size; }
+
+ETL_BENCHMARK(count, int16_t, etl) { benchmark::do_not_optimise(etl::count(first(), last(), int16_t(5))); return Size; }
+ETL_BENCHMARK(count, int16_t, std) { benchmark::do_not_optimise(std::count(first(), last(), int16_t(5))); return Size; }
+
+ETL_BENCHMARK(mismatch, int16_t, etl) { benchmark::do_not_optimise(etl::mismatch(first(), last(), other_first()).first); return Size; }
+ETL_BENCHMARK(mismatch, int16_t, std) { benchmark::do_not_optimise(std::mismatch(first(), last(), other_first()).first); return Size; }
+
+//*****************************************************************************
+// Searches of a sorted 64K uint32_t table, lookups per second.
+//*****************************************************************************
+ETL_BENCHMARK(lower_bound, uint32_t, etl)            { return search_table(etl_lower_bound); }
+ETL_BENCHMARK(lower_bound, uint32_t, etl_branchless) { return search_table(etl_branchless_lower_bound); }
+ETL_BENCHMARK(lower_bound, uint32_t, etl_batch)      { return search_table_batch(); }
+ETL_BENCHMARK(lower_bound, uint32_t, std)            { return search_table(std_lower_bound); }
+
+//*****************************************************************************
+// Histogram accumulation of 8 bit pixels, samples per second.
+//*****************************************************************************
+ETL_BENCHMARK(histogram, uint8_t, etl_add)      { return histogram_add(); }
+ETL_BENCHMARK(histogram, uint8_t, etl_add_bulk) { return histogram_add_bulk(); }
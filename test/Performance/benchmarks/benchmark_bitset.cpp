@@ -0,0 +1,154 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "benchmark.h"
+
+#include "etl/bitset.h"
+
+#include <bitset>
+
+namespace
+{
+  const size_t Bits       = 4096U;
+  const size_t Iterations = 1000U;
+
+  typedef etl::bitset<Bits>           Etl_Bitset;
+  typedef etl::bitset<Bits, uint64_t> Etl_Bitset_64;
+  typedef std::bitset<Bits>           Std_Bitset;
+
+  //***************************************************************************
+  /// Fills a pair of bitsets with the same pseudo random pattern.
+  //***************************************************************************
+  template <typename TBitset>
+  void fill(TBitset& lhs, TBitset& rhs)
+  {
+    benchmark::random generator;
+
+    for (size_t i = 0U; i < Bits; ++i)
+    {
+      lhs.set(i, (generator() & 1U) != 0U);
+      rhs.set(i, (generator() & 1U) != 0U);
+    }
+  }
+
+  //***************************************************************************
+  template <typename TBitset>
+  size_t and_or_xor()
+  {
+    static TBitset lhs;
+    static TBitset rhs;
+    static bool    filled = false;
+
+    if (!filled)
+    {
+      fill(lhs, rhs);
+      filled = true;
+    }
+
+    for (size_t i = 0U; i < Iterations; ++i)
+    {
+      lhs &= rhs;
+      lhs |= rhs;
+      lhs ^= rhs;
+      benchmark::clobber_memory();
+    }
+
+    benchmark::do_not_optimise(lhs);
+
+    // Bytes processed.
+    return Iterations * 3U * (Bits / 8U);
+  }
+
+  //***************************************************************************
+  template <typename TBitset>
+  size_t count_any()
+  {
+    static TBitset lhs;
+    static TBitset rhs;
+    static bool    filled = false;
+
+    if (!filled)
+    {
+      fill(lhs, rhs);
+      filled = true;
+    }
+
+    size_t total = 0U;
+
+    for (size_t i = 0U; i < Iterations; ++i)
+    {
+      total += lhs.count();
+      total += rhs.none() ? 1U : 0U;
+      benchmark::clobber_memory();
+    }
+
+    benchmark::do_not_optimise(total);
+
+    return Iterations * (Bits / 8U);
+  }
+
+  //***************************************************************************
+  template <typename TBitset>
+  size_t shift()
+  {
+    static TBitset lhs;
+    static TBitset rhs;
+    static bool    filled = false;
+
+    if (!filled)
+    {
+      fill(lhs, rhs);
+      filled = true;
+    }
+
+    for (size_t i = 0U; i < Iterations; ++i)
+    {
+      lhs <<= 3U;
+      lhs >>= 3U;
+      lhs |= rhs;
+      benchmark::clobber_memory();
+    }
+
+    benchmark::do_not_optimise(lhs);
+
+    return Iterations * 2U * (Bits / 8U);
+  }
+}
+
+//*****************************************************************************
+// Throughput is in bytes of bitset processed.
+//*****************************************************************************
+ETL_BENCHMARK(bitset_4096, and_or_xor, etl)    { return and_or_xor<Etl_Bitset>(); }
+ETL_BENCHMARK(bitset_4096, and_or_xor, etl_64) { return and_or_xor<Etl_Bitset_64>(); }
+ETL_BENCHMARK(bitset_4096, and_or_xor, std)    { return and_or_xor<Std_Bitset>(); }
+ETL_BENCHMARK(bitset_4096, count_none, etl)    { return count_any<Etl_Bitset>(); }
+ETL_BENCHMARK(bitset_4096, count_none, etl_64) { return count_any<Etl_Bitset_64>(); }
+ETL_BENCHMARK(bitset_4096, count_none, std)    { return count_any<Std_Bitset>(); }
+ETL_BENCHMARK(bitset_4096, shift,      etl)    { return shift<Etl_Bitset>(); }
+ETL_BENCHMARK(bitset_4096, shift,      etl_64) { return shift<Etl_Bitset_64>(); }
+ETL_BENCHMARK(bitset_4096, shift,      std)    { return shift<Std_Bitset>(); }
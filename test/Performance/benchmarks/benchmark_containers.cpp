@@ -0,0 +1,385 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "benchmark.h"
+
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/list.h"
+#include "etl/map.h"
+#include "etl/flat_map.h"
+#include "etl/unordered_map.h"
+#include "etl/unordered_flat_map.h"
+#include "etl/circular_buffer.h"
+
+#include <vector>
+#include <algorithm>
+#include <deque>
+#include <list>
+#include <map>
+#include <unordered_map>
+
+namespace
+{
+  const size_t Size = 1000U;
+
+  //***************************************************************************
+  /// The keys used by the associative containers, in a random order.
+  //***************************************************************************
+  const std::vector<uint32_t>& keys()
+  {
+    static std::vector<uint32_t> values;
+
+    if (values.empty())
+    {
+      benchmark::random generator;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        values.push_back(generator());
+      }
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  // A quarter of the keys and a quarter of missing keys, in ascending order.
+  //***************************************************************************
+  const std::vector<uint32_t>& sorted_keys()
+  {
+    static std::vector<uint32_t> values;
+
+    if (values.empty())
+    {
+      const std::vector<uint32_t>& k = keys();
+
+      for (size_t i = 0U; i < Size; i += 4U)
+      {
+        values.push_back(k[i]);
+        values.push_back(k[i + 1U] + 1U);
+      }
+
+      std::sort(values.begin(), values.end());
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  // Each benchmark starts from the state that it needs, as the containers are
+  // shared between benchmarks.
+  //***************************************************************************
+  template <typename TContainer>
+  size_t push_back_clear(TContainer& container)
+  {
+    container.clear();
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      container.push_back(static_cast<int>(i));
+    }
+
+    benchmark::do_not_optimise(container.back());
+    container.clear();
+
+    return Size;
+  }
+
+  //***************************************************************************
+  template <typename TContainer>
+  size_t iterate(TContainer& container)
+  {
+    if (container.empty())
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        container.push_back(static_cast<int>(i));
+      }
+    }
+
+    int sum = 0;
+
+    for (typename TContainer::const_iterator itr = container.begin(); itr != container.end(); ++itr)
+    {
+      sum += *itr;
+    }
+
+    benchmark::do_not_optimise(sum);
+
+    return Size;
+  }
+
+  //***************************************************************************
+  template <typename TContainer>
+  size_t fifo(TContainer& container)
+  {
+    container.clear();
+
+    for (size_t i = 0U; i < (Size / 2U); ++i)
+    {
+      container.push_back(static_cast<int>(i));
+    }
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      container.push_back(static_cast<int>(i));
+      benchmark::do_not_optimise(container.front());
+      container.pop_front();
+    }
+
+    container.clear();
+
+    return Size;
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  size_t map_insert_erase(TMap& map)
+  {
+    const std::vector<uint32_t>& k = keys();
+
+    map.clear();
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      map.insert(typename TMap::value_type(k[i], i));
+    }
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      map.erase(k[i]);
+    }
+
+    return Size * 2U;
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  size_t map_find(TMap& map)
+  {
+    const std::vector<uint32_t>& k = keys();
+
+    if (map.empty())
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        map.insert(typename TMap::value_type(k[i], i));
+      }
+    }
+
+    size_t sum = 0U;
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      sum += map.find(k[(i * 7U) % Size])->second;
+    }
+
+    benchmark::do_not_optimise(sum);
+
+    return Size;
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  size_t map_find_missing(TMap& map)
+  {
+    const std::vector<uint32_t>& k = keys();
+
+    if (map.empty())
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        map.insert(typename TMap::value_type(k[i], i));
+      }
+    }
+
+    size_t found = 0U;
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      found += (map.find(k[i] + 1U) != map.end()) ? 1U : 0U;
+    }
+
+    benchmark::do_not_optimise(found);
+
+    return Size;
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  size_t map_find_batch(TMap& map)
+  {
+    const std::vector<uint32_t>& k = sorted_keys();
+
+    if (map.empty())
+    {
+      map_find(map);
+    }
+
+    size_t found = 0U;
+
+    for (size_t i = 0U; i < k.size(); ++i)
+    {
+      found += (map.find(k[i]) != map.end()) ? 1U : 0U;
+    }
+
+    benchmark::do_not_optimise(found);
+
+    return k.size();
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  size_t map_find_sorted(TMap& map)
+  {
+    const std::vector<uint32_t>& k = sorted_keys();
+
+    if (map.empty())
+    {
+      map_find(map);
+    }
+
+    size_t found = map.count_sorted(k.begin(), k.end());
+
+    benchmark::do_not_optimise(found);
+
+    return k.size();
+  }
+
+  //***************************************************************************
+  /// etl::circular_buffer with the same interface as std::deque.
+  //***************************************************************************
+  struct circular_buffer_adaptor
+  {
+    typedef etl::circular_buffer<int, Size>::const_iterator const_iterator;
+
+
+    void push_back(int value)     { buffer.push(value); }
+    void pop_front()              { buffer.pop(); }
+    int& front()                  { return buffer.front(); }
+    int& back()                   { return buffer.back(); }
+    void clear()                  { buffer.clear(); }
+    bool empty() const            { return buffer.empty(); }
+    const_iterator begin() const  { return buffer.begin(); }
+    const_iterator end() const    { return buffer.end(); }
+
+    etl::circular_buffer<int, Size> buffer;
+  };
+
+  typedef etl::vector<int, Size>                                 Etl_Vector;
+  typedef etl::deque<int, Size>                                  Etl_Deque;
+  typedef etl::list<int, Size>                                   Etl_List;
+  typedef etl::map<uint32_t, size_t, Size>                       Etl_Map;
+  typedef etl::flat_map<uint32_t, size_t, Size>                  Etl_Flat_Map;
+  typedef etl::unordered_map<uint32_t, size_t, Size, Size>       Etl_Unordered_Map;
+  typedef etl::unordered_flat_map<uint32_t, size_t, Size>        Etl_Unordered_Flat_Map;
+  typedef std::map<uint32_t, size_t>                             Std_Map;
+  typedef std::unordered_map<uint32_t, size_t>                   Std_Unordered_Map;
+
+  Etl_Vector             etl_vector;
+  Etl_Deque              etl_deque;
+  Etl_List               etl_list;
+  circular_buffer_adaptor etl_circular_buffer;
+  Etl_Map                etl_map;
+  Etl_Flat_Map           etl_flat_map;
+  Etl_Unordered_Map      etl_unordered_map;
+  Etl_Unordered_Flat_Map etl_unordered_flat_map;
+
+  std::vector<int>       std_vector;
+  std::deque<int>        std_deque;
+  std::list<int>         std_list;
+  Std_Map                std_map;
+  Std_Unordered_Map      std_unordered_map;
+}
+
+//*****************************************************************************
+// vector
+//*****************************************************************************
+ETL_BENCHMARK(vector, push_back, etl) { return push_back_clear(etl_vector); }
+ETL_BENCHMARK(vector, push_back, std) { std_vector.reserve(Size); return push_back_clear(std_vector); }
+ETL_BENCHMARK(vector, iterate,   etl) { return iterate(etl_vector); }
+ETL_BENCHMARK(vector, iterate,   std) { return iterate(std_vector); }
+
+//*****************************************************************************
+// deque
+//*****************************************************************************
+ETL_BENCHMARK(deque, push_back, etl) { return push_back_clear(etl_deque); }
+ETL_BENCHMARK(deque, push_back, std) { return push_back_clear(std_deque); }
+ETL_BENCHMARK(deque, fifo,      etl) { return fifo(etl_deque); }
+ETL_BENCHMARK(deque, fifo,      std) { return fifo(std_deque); }
+ETL_BENCHMARK(deque, iterate,   etl) { return iterate(etl_deque); }
+ETL_BENCHMARK(deque, iterate,   std) { return iterate(std_deque); }
+
+//*****************************************************************************
+// list
+//*****************************************************************************
+ETL_BENCHMARK(list, push_back, etl) { return push_back_clear(etl_list); }
+ETL_BENCHMARK(list, push_back, std) { return push_back_clear(std_list); }
+ETL_BENCHMARK(list, iterate,   etl) { return iterate(etl_list); }
+ETL_BENCHMARK(list, iterate,   std) { return iterate(std_list); }
+
+//*****************************************************************************
+// circular_buffer, compared with a std::deque used as a ring.
+//*****************************************************************************
+ETL_BENCHMARK(circular_buffer, fifo,    etl) { return fifo(etl_circular_buffer); }
+ETL_BENCHMARK(circular_buffer, fifo,    std) { return fifo(std_deque); }
+ETL_BENCHMARK(circular_buffer, iterate, etl) { return iterate(etl_circular_buffer); }
+ETL_BENCHMARK(circular_buffer, iterate, std) { return iterate(std_deque); }
+
+//*****************************************************************************
+// map
+//*****************************************************************************
+ETL_BENCHMARK(map, insert_erase, etl) { return map_insert_erase(etl_map); }
+ETL_BENCHMARK(map, insert_erase, std) { return map_insert_erase(std_map); }
+ETL_BENCHMARK(map, find,         etl) { return map_find(etl_map); }
+ETL_BENCHMARK(map, find,         std) { return map_find(std_map); }
+ETL_BENCHMARK(map, find_batch,   etl) { return map_find_batch(etl_map); }
+ETL_BENCHMARK(map, find_batch,   std) { return map_find_batch(std_map); }
+ETL_BENCHMARK(map, find_sorted,  etl) { return map_find_sorted(etl_map); }
+
+//*****************************************************************************
+// flat_map, compared with std::map.
+//*****************************************************************************
+ETL_BENCHMARK(flat_map, insert_erase, etl) { return map_insert_erase(etl_flat_map); }
+ETL_BENCHMARK(flat_map, insert_erase, std) { return map_insert_erase(std_map); }
+ETL_BENCHMARK(flat_map, find,         etl) { return map_find(etl_flat_map); }
+ETL_BENCHMARK(flat_map, find,         std) { return map_find(std_map); }
+
+//*****************************************************************************
+// unordered_map
+//*****************************************************************************
+ETL_BENCHMARK(unordered_map, insert_erase, etl)      { return map_insert_erase(etl_unordered_map); }
+ETL_BENCHMARK(unordered_map, insert_erase, etl_flat) { return map_insert_erase(etl_unordered_flat_map); }
+ETL_BENCHMARK(unordered_map, insert_erase, std)      { return map_insert_erase(std_unordered_map); }
+ETL_BENCHMARK(unordered_map, find,         etl)      { return map_find(etl_unordered_map); }
+ETL_BENCHMARK(unordered_map, find,         etl_flat) { return map_find(etl_unordered_flat_map); }
+ETL_BENCHMARK(unordered_map, find,         std)      { return map_find(std_unordered_map); }
+ETL_BENCHMARK(unordered_map, find_missing, etl)      { return map_find_missing(etl_unordered_map); }
+ETL_BENCHMARK(unordered_map, find_missing, etl_flat) { return map_find_missing(etl_unordered_flat_map); }
+ETL_BENCHMARK(unordered_map, find_missing, std)      { return map_find_missing(std_unordered_map); }
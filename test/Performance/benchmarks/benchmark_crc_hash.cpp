@@ -0,0 +1,173 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "benchmark.h"
+
+#include "etl/crc8_ccitt.h"
+#include "etl/crc16.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc64_ecma.h"
+#include "etl/fnv_1.h"
+#include "etl/murmur3.h"
+#include "etl/jenkins.h"
+#include "etl/pearson.h"
+#include "etl/xxhash.h"
+#include "etl/hash.h"
+#include "etl/string.h"
+
+#include <functional>
+#include <string>
+
+//*****************************************************************************
+// The operation count is the number of bytes, so 'ops/s' is bytes per second.
+//*****************************************************************************
+
+namespace
+{
+  const size_t Block_Size = 4096U;
+
+  //***************************************************************************
+  const uint8_t* block()
+  {
+    static uint8_t data[Block_Size];
+    static bool    initialised = false;
+
+    if (!initialised)
+    {
+      benchmark::random generator;
+
+      for (size_t i = 0U; i < Block_Size; ++i)
+      {
+        data[i] = static_cast<uint8_t>(generator());
+      }
+
+      initialised = true;
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  template <typename TCrc>
+  size_t checksum()
+  {
+    const uint8_t* p = block();
+
+    benchmark::do_not_optimise(TCrc(p, p + Block_Size).value());
+
+    return Block_Size;
+  }
+
+  //***************************************************************************
+  /// Hashes of short keys, as used by the unordered containers.
+  //***************************************************************************
+  const size_t Short_Key_Size = 16U;
+
+  template <typename THash>
+  size_t short_keys()
+  {
+    const uint8_t* p = block();
+
+    for (size_t i = 0U; i < Block_Size; i += Short_Key_Size)
+    {
+      benchmark::do_not_optimise(THash(p + i, p + i + Short_Key_Size).value());
+    }
+
+    return Block_Size;
+  }
+
+  //***************************************************************************
+  template <typename TString, typename THash>
+  size_t hash_function_short_keys()
+  {
+    const char* p    = reinterpret_cast<const char*>(block());
+    const THash hash = THash();
+
+    for (size_t i = 0U; i < Block_Size; i += Short_Key_Size)
+    {
+      benchmark::do_not_optimise(hash(TString(p + i, Short_Key_Size)));
+    }
+
+    return Block_Size;
+  }
+}
+
+//*****************************************************************************
+// CRC table sizes
+//*****************************************************************************
+ETL_BENCHMARK(crc8_ccitt, block_4096, t4)    { return checksum<etl::crc8_ccitt_t4>(); }
+ETL_BENCHMARK(crc8_ccitt, block_4096, t16)   { return checksum<etl::crc8_ccitt_t16>(); }
+ETL_BENCHMARK(crc8_ccitt, block_4096, t256)  { return checksum<etl::crc8_ccitt_t256>(); }
+ETL_BENCHMARK(crc8_ccitt, block_4096, t2048) { return checksum<etl::crc8_ccitt_t2048>(); }
+ETL_BENCHMARK(crc8_ccitt, block_4096, t4096) { return checksum<etl::crc8_ccitt_t4096>(); }
+
+ETL_BENCHMARK(crc16, block_4096, t4)    { return checksum<etl::crc16_t4>(); }
+ETL_BENCHMARK(crc16, block_4096, t16)   { return checksum<etl::crc16_t16>(); }
+ETL_BENCHMARK(crc16, block_4096, t256)  { return checksum<etl::crc16_t256>(); }
+ETL_BENCHMARK(crc16, block_4096, t2048) { return checksum<etl::crc16_t2048>(); }
+ETL_BENCHMARK(crc16, block_4096, t4096) { return checksum<etl::crc16_t4096>(); }
+
+ETL_BENCHMARK(crc32, block_4096, t4)    { return checksum<etl::crc32_t4>(); }
+ETL_BENCHMARK(crc32, block_4096, t16)   { return checksum<etl::crc32_t16>(); }
+ETL_BENCHMARK(crc32, block_4096, t256)  { return checksum<etl::crc32_t256>(); }
+ETL_BENCHMARK(crc32, block_4096, t2048) { return checksum<etl::crc32_t2048>(); }
+ETL_BENCHMARK(crc32, block_4096, t4096) { return checksum<etl::crc32_t4096>(); }
+
+ETL_BENCHMARK(crc32_c, block_4096, t4)    { return checksum<etl::crc32_c_t4>(); }
+ETL_BENCHMARK(crc32_c, block_4096, t16)   { return checksum<etl::crc32_c_t16>(); }
+ETL_BENCHMARK(crc32_c, block_4096, t256)  { return checksum<etl::crc32_c_t256>(); }
+ETL_BENCHMARK(crc32_c, block_4096, t2048) { return checksum<etl::crc32_c_t2048>(); }
+ETL_BENCHMARK(crc32_c, block_4096, t4096) { return checksum<etl::crc32_c_t4096>(); }
+
+ETL_BENCHMARK(crc64_ecma, block_4096, t4)    { return checksum<etl::crc64_ecma_t4>(); }
+ETL_BENCHMARK(crc64_ecma, block_4096, t16)   { return checksum<etl::crc64_ecma_t16>(); }
+ETL_BENCHMARK(crc64_ecma, block_4096, t256)  { return checksum<etl::crc64_ecma_t256>(); }
+ETL_BENCHMARK(crc64_ecma, block_4096, t2048) { return checksum<etl::crc64_ecma_t2048>(); }
+ETL_BENCHMARK(crc64_ecma, block_4096, t4096) { return checksum<etl::crc64_ecma_t4096>(); }
+
+//*****************************************************************************
+// Hashes
+//*****************************************************************************
+ETL_BENCHMARK(hash, block_4096, fnv_1a_32)  { return checksum<etl::fnv_1a_32>(); }
+ETL_BENCHMARK(hash, block_4096, fnv_1a_64)  { return checksum<etl::fnv_1a_64>(); }
+ETL_BENCHMARK(hash, block_4096, jenkins)    { return checksum<etl::jenkins>(); }
+ETL_BENCHMARK(hash, block_4096, murmur3_32) { return checksum<etl::murmur3<uint32_t> >(); }
+ETL_BENCHMARK(hash, block_4096, xxhash32)   { return checksum<etl::xxhash32>(); }
+ETL_BENCHMARK(hash, block_4096, xxhash64)   { return checksum<etl::xxhash64>(); }
+ETL_BENCHMARK(hash, block_4096, pearson_8)  { return checksum<etl::pearson<8> >(); }
+
+ETL_BENCHMARK(hash, short_keys, fnv_1a_32)  { return short_keys<etl::fnv_1a_32>(); }
+ETL_BENCHMARK(hash, short_keys, fnv_1a_64)  { return short_keys<etl::fnv_1a_64>(); }
+ETL_BENCHMARK(hash, short_keys, jenkins)    { return short_keys<etl::jenkins>(); }
+ETL_BENCHMARK(hash, short_keys, murmur3_32) { return short_keys<etl::murmur3<uint32_t> >(); }
+ETL_BENCHMARK(hash, short_keys, xxhash32)   { return short_keys<etl::xxhash32>(); }
+ETL_BENCHMARK(hash, short_keys, xxhash64)   { return short_keys<etl::xxhash64>(); }
+
+ETL_BENCHMARK(hash, string_keys, etl) { return hash_function_short_keys<etl::string<Short_Key_Size>, etl::hash<etl::string<Short_Key_Size> > >(); }
+ETL_BENCHMARK(hash, string_keys, std) { return hash_function_short_keys<std::string, std::hash<std::string> >(); }
@@ -0,0 +1,111 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "benchmark.h"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Yield to the OS once the backoff is exhausted.
+#define ETL_SPIN_YIELD() std::this_thread::yield()
+
+#include "etl/spin_mutex.h"
+
+namespace
+{
+  const size_t Thread_Count = 4U;
+  const size_t Increments   = 10000U;
+
+  //***************************************************************************
+  /// A plain test-and-set spin lock, as etl::mutex was before backoff.
+  //***************************************************************************
+  struct test_and_set_mutex
+  {
+    test_and_set_mutex()
+      : flag(0)
+    {
+    }
+
+    void lock()
+    {
+      while (__sync_lock_test_and_set(&flag, 1U))
+      {
+      }
+    }
+
+    void unlock()
+    {
+      __sync_lock_release(&flag);
+    }
+
+    char flag;
+  };
+
+  //***************************************************************************
+  /// Threads incrementing a shared counter under a lock, increments per second.
+  //***************************************************************************
+  template <typename TMutex>
+  size_t contended_increment()
+  {
+    TMutex   mutex;
+    uint32_t count = 0U;
+
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0U; t < Thread_Count; ++t)
+    {
+      threads.push_back(std::thread([&mutex, &count]()
+      {
+        for (size_t i = 0U; i < Increments; ++i)
+        {
+          mutex.lock();
+          ++count;
+          mutex.unlock();
+        }
+      }));
+    }
+
+    for (size_t t = 0U; t < Thread_Count; ++t)
+    {
+      threads[t].join();
+    }
+
+    benchmark::do_not_optimise(count);
+
+    return Thread_Count * Increments;
+  }
+}
+
+//*****************************************************************************
+// Contended locks.
+//*****************************************************************************
+ETL_BENCHMARK(mutex, contended, etl_spin_mutex)   { return contended_increment<etl::spin_mutex>(); }
+ETL_BENCHMARK(mutex, contended, etl_ticket_mutex) { return contended_increment<etl::ticket_mutex>(); }
+ETL_BENCHMARK(mutex, contended, test_and_set)     { return contended_increment<test_and_set_mutex>(); }
+ETL_BENCHMARK(mutex, contended, std)              { return contended_increment<std::mutex>(); }
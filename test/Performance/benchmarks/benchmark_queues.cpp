@@ -0,0 +1,331 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "benchmark.h"
+
+#include "etl/queue.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_mpmc_atomic.h"
+#include "etl/priority_queue.h"
+#include "etl/indexed_priority_queue.h"
+
+#include <queue>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+  const size_t Size      = 256U;
+  const size_t Transfers = 100000U;
+
+  //***************************************************************************
+  /// A std::queue guarded by a mutex, as the std equivalent of the lock free queues.
+  //***************************************************************************
+  class std_locked_queue
+  {
+  public:
+
+    bool push(int value)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      if (queue.size() == Size)
+      {
+        return false;
+      }
+
+      queue.push(value);
+      return true;
+    }
+
+    bool pop(int& value)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      if (queue.empty())
+      {
+        return false;
+      }
+
+      value = queue.front();
+      queue.pop();
+      return true;
+    }
+
+  private:
+
+    std::mutex      mutex;
+    std::queue<int> queue;
+  };
+
+  //***************************************************************************
+  /// Fills and empties a queue on one thread.
+  //***************************************************************************
+  template <typename TQueue>
+  size_t fill_drain(TQueue& queue)
+  {
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      queue.push(static_cast<int>(i));
+    }
+
+    int sum = 0;
+    int value = 0;
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      queue.pop(value);
+      sum += value;
+    }
+
+    benchmark::do_not_optimise(sum);
+
+    return Size * 2U;
+  }
+
+  //***************************************************************************
+  /// Passes values from a producer thread to a consumer thread.
+  //***************************************************************************
+  template <typename TQueue>
+  size_t transfer(TQueue& queue)
+  {
+    std::thread producer([&queue]()
+    {
+      for (size_t i = 0U; i < Transfers; ++i)
+      {
+        while (!queue.push(static_cast<int>(i)))
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    int sum = 0;
+    int value = 0;
+
+    for (size_t i = 0U; i < Transfers; ++i)
+    {
+      while (!queue.pop(value))
+      {
+        std::this_thread::yield();
+      }
+
+      sum += value;
+    }
+
+    producer.join();
+    benchmark::do_not_optimise(sum);
+
+    return Transfers;
+  }
+
+  //***************************************************************************
+  /// etl::queue with the same interface as the others.
+  //***************************************************************************
+  struct etl_queue_adaptor
+  {
+    bool push(int value)
+    {
+      queue.push(value);
+      return true;
+    }
+
+    bool pop(int& value)
+    {
+      value = queue.front();
+      queue.pop();
+      return true;
+    }
+
+    etl::queue<int, Size> queue;
+  };
+
+  //***************************************************************************
+  /// std::queue with the same interface as the others.
+  //***************************************************************************
+  struct std_queue_adaptor
+  {
+    bool push(int value)
+    {
+      queue.push(value);
+      return true;
+    }
+
+    bool pop(int& value)
+    {
+      value = queue.front();
+      queue.pop();
+      return true;
+    }
+
+    std::queue<int> queue;
+  };
+
+  //***************************************************************************
+  /// Timer heaps. The hold model pops the earliest expiry and pushes a new one.
+  //***************************************************************************
+  const size_t Timers = 4096U;
+  const size_t Holds  = 4096U;
+
+  typedef etl::greater<uint32_t> Earliest;
+
+  template <size_t Arity>
+  struct etl_timer_heap
+  {
+    void push(uint32_t expiry) { queue.push(expiry); }
+    uint32_t pop() { uint32_t expiry = queue.top(); queue.pop(); return expiry; }
+    void clear() { queue.clear(); }
+
+    etl::priority_queue<uint32_t, Timers, etl::vector<uint32_t, Timers>, Earliest, Arity> queue;
+  };
+
+  template <size_t Arity>
+  struct etl_indexed_timer_heap
+  {
+    void push(uint32_t expiry) { queue.push(expiry); }
+    uint32_t pop() { uint32_t expiry = queue.top(); queue.pop(); return expiry; }
+    void clear() { queue.clear(); }
+
+    etl::indexed_priority_queue<uint32_t, Timers, Earliest, Arity> queue;
+  };
+
+  struct std_timer_heap
+  {
+    void push(uint32_t expiry) { queue.push(expiry); }
+    uint32_t pop() { uint32_t expiry = queue.top(); queue.pop(); return expiry; }
+    void clear() { queue = std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t> >(); }
+
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t> > queue;
+  };
+
+  //***************************************************************************
+  template <typename THeap>
+  size_t hold(THeap& heap)
+  {
+    benchmark::random generator;
+
+    heap.clear();
+
+    for (size_t i = 0U; i < Timers; ++i)
+    {
+      heap.push(generator() % 100000U);
+    }
+
+    uint32_t sum = 0U;
+
+    for (size_t i = 0U; i < Holds; ++i)
+    {
+      const uint32_t expiry = heap.pop();
+      sum += expiry;
+      heap.push(expiry + (generator() % 100000U));
+    }
+
+    benchmark::do_not_optimise(sum);
+
+    return Holds;
+  }
+
+  //***************************************************************************
+  /// Rescheduling timers, by update or by erase and reinsert.
+  //***************************************************************************
+  typedef etl::indexed_priority_queue<uint32_t, Timers, Earliest, 4> Timer_Queue;
+
+  Timer_Queue::handle_type timer_handles[Timers];
+
+  template <bool Use_Update>
+  size_t reschedule(Timer_Queue& queue)
+  {
+    benchmark::random generator;
+
+    queue.clear();
+
+    for (size_t i = 0U; i < Timers; ++i)
+    {
+      timer_handles[i] = queue.push(generator() % 100000U);
+    }
+
+    for (size_t i = 0U; i < Holds; ++i)
+    {
+      Timer_Queue::handle_type& handle = timer_handles[generator() % Timers];
+      const uint32_t expiry = generator() % 100000U;
+
+      if (Use_Update)
+      {
+        queue.update(handle, expiry);
+      }
+      else
+      {
+        queue.erase(handle);
+        handle = queue.push(expiry);
+      }
+    }
+
+    benchmark::do_not_optimise(queue.top());
+
+    return Holds;
+  }
+
+  etl_timer_heap<2>         etl_timer_heap_2;
+  etl_timer_heap<4>         etl_timer_heap_4;
+  etl_indexed_timer_heap<4> etl_indexed_timer_heap_4;
+  std_timer_heap            std_timer_heap_2;
+  Timer_Queue               timer_queue;
+
+  etl_queue_adaptor                   etl_queue;
+  std_queue_adaptor                   std_queue;
+  etl::queue_spsc_atomic<int, Size>   etl_queue_spsc;
+  etl::queue_mpmc_atomic<int, Size>   etl_queue_mpmc;
+  std_locked_queue                    std_queue_locked;
+}
+
+//*****************************************************************************
+// Single threaded
+//*****************************************************************************
+ETL_BENCHMARK(queue, fill_drain, etl)             { return fill_drain(etl_queue); }
+ETL_BENCHMARK(queue, fill_drain, std)             { return fill_drain(std_queue); }
+ETL_BENCHMARK(queue, fill_drain, etl_spsc_atomic) { return fill_drain(etl_queue_spsc); }
+ETL_BENCHMARK(queue, fill_drain, etl_mpmc_atomic) { return fill_drain(etl_queue_mpmc); }
+ETL_BENCHMARK(queue, fill_drain, std_mutex)       { return fill_drain(std_queue_locked); }
+
+//*****************************************************************************
+// Producer and consumer threads
+//*****************************************************************************
+ETL_BENCHMARK(queue, transfer, etl_spsc_atomic) { return transfer(etl_queue_spsc); }
+ETL_BENCHMARK(queue, transfer, etl_mpmc_atomic) { return transfer(etl_queue_mpmc); }
+ETL_BENCHMARK(queue, transfer, std_mutex)       { return transfer(std_queue_locked); }
+
+//*****************************************************************************
+// Timer heaps, holds per second
+//*****************************************************************************
+ETL_BENCHMARK(priority_queue, hold, etl_binary)       { return hold(etl_timer_heap_2); }
+ETL_BENCHMARK(priority_queue, hold, etl_4_ary)        { return hold(etl_timer_heap_4); }
+ETL_BENCHMARK(priority_queue, hold, etl_indexed_4_ary) { return hold(etl_indexed_timer_heap_4); }
+ETL_BENCHMARK(priority_queue, hold, std)              { return hold(std_timer_heap_2); }
+
+ETL_BENCHMARK(priority_queue, reschedule, etl_indexed_update)         { return reschedule<true>(timer_queue); }
+ETL_BENCHMARK(priority_queue, reschedule, etl_indexed_erase_and_push) { return reschedule<false>(timer_queue); }
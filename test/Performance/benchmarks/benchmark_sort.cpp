@@ -0,0 +1,256 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+#include "etl/top_k.h"
+#include "etl/execution.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const uint32_t Size = 2000U;
+
+  //***************************************************************************
+  /// A record sorted by key, as a scan table would be.
+  //***************************************************************************
+  struct Record
+  {
+    uint32_t key;
+    uint32_t index;
+
+    bool operator <(const Record& other) const
+    {
+      return key < other.key;
+    }
+  };
+
+  //***************************************************************************
+  /// The unsorted records. Keys have some duplicates.
+  //***************************************************************************
+  const std::vector<Record>& unsorted()
+  {
+    static std::vector<Record> records;
+
+    if (records.empty())
+    {
+      benchmark::random generator;
+
+      for (uint32_t i = 0U; i < Size; ++i)
+      {
+        Record record = { generator() % (Size / 2U), i };
+        records.push_back(record);
+      }
+    }
+
+    return records;
+  }
+
+  std::vector<Record> records(Size);
+  Record              scratch[Size / 2U];
+
+  //***************************************************************************
+  template <typename TSort>
+  size_t sort_records(TSort sort)
+  {
+    const std::vector<Record>& source = unsorted();
+    std::copy(source.begin(), source.end(), records.begin());
+
+    sort(records.begin(), records.end());
+
+    benchmark::do_not_optimise(records.front().index);
+
+    return Size;
+  }
+
+  typedef std::vector<Record>::iterator Iterator;
+
+  void etl_intro_sort(Iterator first, Iterator last)         { etl::intro_sort(first, last); }
+  void etl_shell_sort(Iterator first, Iterator last)         { etl::shell_sort(first, last); }
+  void std_sort(Iterator first, Iterator last)               { std::sort(first, last); }
+  void etl_merge_sort(Iterator first, Iterator last)         { etl::merge_sort(first, last); }
+  void etl_merge_sort_scratch(Iterator first, Iterator last) { etl::merge_sort(first, last, scratch, scratch + (Size / 2U)); }
+  void etl_insertion_sort(Iterator first, Iterator last)     { etl::insertion_sort(first, last); }
+  void std_stable_sort(Iterator first, Iterator last)        { std::stable_sort(first, last); }
+
+  //***************************************************************************
+  /// uint32_t timestamps.
+  //***************************************************************************
+  const std::vector<uint32_t>& unsorted_timestamps()
+  {
+    static std::vector<uint32_t> timestamps;
+
+    if (timestamps.empty())
+    {
+      benchmark::random generator;
+
+      for (uint32_t i = 0U; i < Size; ++i)
+      {
+        timestamps.push_back(generator());
+      }
+    }
+
+    return timestamps;
+  }
+
+  std::vector<uint32_t> timestamps(Size);
+  uint32_t              timestamp_scratch[Size];
+  Record                record_scratch[Size];
+
+  //***************************************************************************
+  template <typename TSort>
+  size_t sort_timestamps(TSort sort)
+  {
+    const std::vector<uint32_t>& source = unsorted_timestamps();
+    std::copy(source.begin(), source.end(), timestamps.begin());
+
+    sort(timestamps.begin(), timestamps.end());
+
+    benchmark::do_not_optimise(timestamps.front());
+
+    return Size;
+  }
+
+  typedef std::vector<uint32_t>::iterator Timestamp_Iterator;
+
+  uint32_t record_key(const Record& record) { return record.key; }
+
+  void etl_radix_sort_timestamps(Timestamp_Iterator first, Timestamp_Iterator last)    { etl::radix_sort(first, last, timestamp_scratch, timestamp_scratch + Size); }
+  void etl_radix_sort_11_timestamps(Timestamp_Iterator first, Timestamp_Iterator last) { etl::radix_sort<11>(first, last, timestamp_scratch, timestamp_scratch + Size); }
+  void etl_intro_sort_timestamps(Timestamp_Iterator first, Timestamp_Iterator last)    { etl::intro_sort(first, last); }
+  void std_sort_timestamps(Timestamp_Iterator first, Timestamp_Iterator last)          { std::sort(first, last); }
+  void etl_radix_sort_records(Iterator first, Iterator last)                           { etl::radix_sort(first, last, record_scratch, record_scratch + Size, record_key); }
+
+  //***************************************************************************
+  /// Selection of the median, or the least Top_K, of the timestamps.
+  //***************************************************************************
+  const size_t Top_K = 16U;
+
+  void etl_nth_element_timestamps(Timestamp_Iterator first, Timestamp_Iterator last)  { etl::nth_element(first, first + (Size / 2U), last); }
+  void std_nth_element_timestamps(Timestamp_Iterator first, Timestamp_Iterator last)  { std::nth_element(first, first + (Size / 2U), last); }
+  void etl_partial_sort_timestamps(Timestamp_Iterator first, Timestamp_Iterator last) { etl::partial_sort(first, first + Top_K, last); }
+  void std_partial_sort_timestamps(Timestamp_Iterator first, Timestamp_Iterator last) { std::partial_sort(first, first + Top_K, last); }
+
+  void etl_top_k_timestamps(Timestamp_Iterator first, Timestamp_Iterator last)
+  {
+    etl::top_k<uint32_t, Top_K, etl::greater<uint32_t> > top;
+    top.push(first, last);
+    top.copy_sorted(first);
+  }
+
+  //***************************************************************************
+  /// A worker pool with a worker for each hardware thread but one.
+  //***************************************************************************
+  struct Workers
+  {
+    static size_t worker_count()
+    {
+      const unsigned threads = std::thread::hardware_concurrency();
+
+      return (threads > 1U) ? (threads - 1U) : 0U;
+    }
+
+    static void idle()
+    {
+      std::this_thread::yield();
+    }
+
+    Workers()
+      : pool(worker_count())
+    {
+      for (size_t i = 0U; i < pool.worker_count(); ++i)
+      {
+        threads.push_back(std::thread([this]() { pool.run(idle); }));
+      }
+    }
+
+    ~Workers()
+    {
+      pool.stop();
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+    }
+
+    etl::worker_pool         pool;
+    std::vector<std::thread> threads;
+  };
+
+  etl::worker_pool& workers()
+  {
+    static Workers instance;
+
+    return instance.pool;
+  }
+
+  void etl_parallel_sort_timestamps(Timestamp_Iterator first, Timestamp_Iterator last)
+  {
+    etl::sort(etl::execution::par(workers()), first, last);
+  }
+}
+
+//*****************************************************************************
+// Unstable sorts, records per second.
+//*****************************************************************************
+ETL_BENCHMARK(sort, unstable, etl_intro_sort) { return sort_records(etl_intro_sort); }
+ETL_BENCHMARK(sort, unstable, etl_shell_sort) { return sort_records(etl_shell_sort); }
+ETL_BENCHMARK(sort, unstable, std)            { return sort_records(std_sort); }
+
+//*****************************************************************************
+// Stable sorts, records per second.
+//*****************************************************************************
+ETL_BENCHMARK(sort, stable, etl_merge_sort)         { return sort_records(etl_merge_sort); }
+ETL_BENCHMARK(sort, stable, etl_merge_sort_scratch) { return sort_records(etl_merge_sort_scratch); }
+ETL_BENCHMARK(sort, stable, etl_insertion_sort)     { return sort_records(etl_insertion_sort); }
+ETL_BENCHMARK(sort, stable, std)                    { return sort_records(std_stable_sort); }
+
+//*****************************************************************************
+// Radix sort, compared with comparison sorts, keys per second.
+//*****************************************************************************
+ETL_BENCHMARK(sort, uint32_t, etl_radix_sort)    { return sort_timestamps(etl_radix_sort_timestamps); }
+ETL_BENCHMARK(sort, uint32_t, etl_radix_sort_11) { return sort_timestamps(etl_radix_sort_11_timestamps); }
+ETL_BENCHMARK(sort, uint32_t, etl_intro_sort)    { return sort_timestamps(etl_intro_sort_timestamps); }
+ETL_BENCHMARK(sort, uint32_t, std)               { return sort_timestamps(std_sort_timestamps); }
+ETL_BENCHMARK(sort, uint32_t, etl_parallel_sort) { return sort_timestamps(etl_parallel_sort_timestamps); }
+ETL_BENCHMARK(sort, stable,   etl_radix_sort)    { return sort_records(etl_radix_sort_records); }
+
+//*****************************************************************************
+// Selection, compared with a full sort, keys per second.
+//*****************************************************************************
+ETL_BENCHMARK(select, median, etl_nth_element) { return sort_timestamps(etl_nth_element_timestamps); }
+ETL_BENCHMARK(select, median, std_nth_element) { return sort_timestamps(std_nth_element_timestamps); }
+ETL_BENCHMARK(select, median, etl_intro_sort)  { return sort_timestamps(etl_intro_sort_timestamps); }
+ETL_BENCHMARK(select, top_16, etl_partial_sort) { return sort_timestamps(etl_partial_sort_timestamps); }
+ETL_BENCHMARK(select, top_16, etl_top_k)        { return sort_timestamps(etl_top_k_timestamps); }
+ETL_BENCHMARK(select, top_16, std_partial_sort) { return sort_timestamps(std_partial_sort_timestamps); }
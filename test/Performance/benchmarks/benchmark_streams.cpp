@@ -0,0 +1,474 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "benchmark.h"
+
+#include "etl/bit_stream.h"
+#include "etl/byte_stream.h"
+#include "etl/serial_schema.h"
+#include "etl/unaligned_type.h"
+#include "etl/byteswap.h"
+#include "etl/string.h"
+#include "etl/string_builder.h"
+
+namespace
+{
+  const size_t Fields = 1000U;
+
+  //***************************************************************************
+  /// The widths of the fields in a packed frame, between 1 and 16 bits.
+  //***************************************************************************
+  const unsigned char* widths()
+  {
+    static unsigned char values[Fields];
+    static bool          filled = false;
+
+    if (!filled)
+    {
+      benchmark::random generator;
+
+      for (size_t i = 0U; i < Fields; ++i)
+      {
+        values[i] = static_cast<unsigned char>((generator() % 16U) + 1U);
+      }
+
+      filled = true;
+    }
+
+    return values;
+  }
+
+  char buffer[Fields * 2U];
+
+  //***************************************************************************
+  size_t bit_stream_write(etl::endian endianness)
+  {
+    const unsigned char* w = widths();
+
+    etl::bit_stream_writer writer(buffer, sizeof(buffer), endianness);
+
+    for (size_t i = 0U; i < Fields; ++i)
+    {
+      writer.write_unchecked(static_cast<uint16_t>(i), w[i]);
+    }
+
+    benchmark::clobber_memory();
+
+    return Fields;
+  }
+
+  //***************************************************************************
+  size_t bit_stream_read(etl::endian endianness)
+  {
+    const unsigned char* w = widths();
+
+    etl::bit_stream_reader reader(buffer, sizeof(buffer), endianness);
+
+    uint32_t sum = 0U;
+
+    for (size_t i = 0U; i < Fields; ++i)
+    {
+      sum += reader.read_unchecked<uint16_t>(w[i]);
+    }
+
+    benchmark::do_not_optimise(sum);
+
+    return Fields;
+  }
+
+  uint32_t words[Fields];
+  char     byte_buffer[Fields * sizeof(uint32_t)];
+
+  //***************************************************************************
+  size_t byte_stream_write_each(etl::endian endianness)
+  {
+    etl::byte_stream_writer writer(byte_buffer, sizeof(byte_buffer), endianness);
+
+    for (size_t i = 0U; i < Fields; ++i)
+    {
+      writer.write(static_cast<uint32_t>(i));
+    }
+
+    benchmark::clobber_memory();
+
+    return sizeof(byte_buffer);
+  }
+
+  //***************************************************************************
+  size_t byte_stream_write_span(etl::endian endianness)
+  {
+    etl::byte_stream_writer writer(byte_buffer, sizeof(byte_buffer), endianness);
+
+    writer.write(etl::span<const uint32_t>(words));
+    benchmark::clobber_memory();
+
+    return sizeof(byte_buffer);
+  }
+
+  //***************************************************************************
+  size_t byte_stream_read_span(etl::endian endianness)
+  {
+    etl::byte_stream_reader reader(byte_buffer, sizeof(byte_buffer), endianness);
+
+    reader.read(etl::span<uint32_t>(words));
+    benchmark::clobber_memory();
+
+    return sizeof(byte_buffer);
+  }
+
+  //***************************************************************************
+  /// A message encoded by hand and through a schema.
+  //***************************************************************************
+  struct Message
+  {
+    uint16_t id;
+    uint32_t length;
+    uint8_t  flags;
+    uint32_t value;
+  };
+
+  typedef etl::serial_schema<Message,
+                             etl::serial_field<Message, uint16_t, &Message::id>,
+                             etl::serial_field<Message, uint32_t, &Message::length>,
+                             etl::serial_field<Message, uint8_t,  &Message::flags>,
+                             etl::serial_field<Message, uint32_t, &Message::value> > Message_Schema;
+
+  typedef etl::serial_schema<Message,
+                             etl::serial_field<Message, uint16_t, &Message::id,     12U>,
+                             etl::serial_field<Message, uint32_t, &Message::length, 20U>,
+                             etl::serial_field<Message, uint8_t,  &Message::flags,  3U>,
+                             etl::serial_field<Message, uint32_t, &Message::value,  29U> > Packed_Message_Schema;
+
+  const size_t Messages = Fields / 4U;
+
+  Message messages[Messages];
+  char    message_buffer[Messages * Message_Schema::Byte_Size];
+
+  //***************************************************************************
+  size_t message_write_by_hand()
+  {
+    etl::byte_stream_writer writer(message_buffer, sizeof(message_buffer), etl::endian::big);
+
+    for (size_t i = 0U; i < Messages; ++i)
+    {
+      writer.write(messages[i].id);
+      writer.write(messages[i].length);
+      writer.write(messages[i].flags);
+      writer.write(messages[i].value);
+    }
+
+    benchmark::clobber_memory();
+
+    return Messages;
+  }
+
+  //***************************************************************************
+  size_t message_write_schema()
+  {
+    etl::byte_stream_writer writer(message_buffer, sizeof(message_buffer), etl::endian::big);
+
+    for (size_t i = 0U; i < Messages; ++i)
+    {
+      Message_Schema::write(writer, messages[i]);
+    }
+
+    benchmark::clobber_memory();
+
+    return Messages;
+  }
+
+  //***************************************************************************
+  size_t packed_message_write_by_hand()
+  {
+    etl::bit_stream_writer writer(message_buffer, sizeof(message_buffer), etl::endian::big);
+
+    for (size_t i = 0U; i < Messages; ++i)
+    {
+      writer.write(messages[i].id,     12U);
+      writer.write(messages[i].length, 20U);
+      writer.write(messages[i].flags,  3U);
+      writer.write(messages[i].value,  29U);
+    }
+
+    benchmark::clobber_memory();
+
+    return Messages;
+  }
+
+  //***************************************************************************
+  size_t packed_message_write_schema()
+  {
+    etl::byte_stream_writer writer(message_buffer, sizeof(message_buffer), etl::endian::big);
+
+    for (size_t i = 0U; i < Messages; ++i)
+    {
+      Packed_Message_Schema::write(writer, messages[i]);
+    }
+
+    benchmark::clobber_memory();
+
+    return Messages;
+  }
+
+  //***************************************************************************
+  size_t message_read_by_hand()
+  {
+    etl::byte_stream_reader reader(message_buffer, sizeof(message_buffer), etl::endian::big);
+
+    for (size_t i = 0U; i < Messages; ++i)
+    {
+      messages[i].id     = reader.read<uint16_t>().value();
+      messages[i].length = reader.read<uint32_t>().value();
+      messages[i].flags  = reader.read<uint8_t>().value();
+      messages[i].value  = reader.read<uint32_t>().value();
+    }
+
+    benchmark::clobber_memory();
+
+    return Messages;
+  }
+
+  //***************************************************************************
+  size_t message_read_schema()
+  {
+    etl::byte_stream_reader reader(message_buffer, sizeof(message_buffer), etl::endian::big);
+
+    for (size_t i = 0U; i < Messages; ++i)
+    {
+      Message_Schema::read(reader, messages[i]);
+    }
+
+    benchmark::clobber_memory();
+
+    return Messages;
+  }
+
+  //***************************************************************************
+  /// A wire format header, read in place.
+  //***************************************************************************
+  template <typename TUint16, typename TUint32>
+  struct Wire_Header
+  {
+    TUint16 id;
+    TUint32 length;
+    uint8_t flags;
+    TUint32 value;
+  };
+
+  typedef Wire_Header<etl::be_uint16_t, etl::be_uint32_t> Big_Wire_Header;
+  typedef Wire_Header<etl::le_uint16_t, etl::le_uint32_t> Little_Wire_Header;
+
+  //***************************************************************************
+  template <typename THeader>
+  size_t wire_header_read()
+  {
+    const THeader* headers = reinterpret_cast<const THeader*>(message_buffer);
+    const size_t   count   = sizeof(message_buffer) / sizeof(THeader);
+
+    uint32_t sum = 0U;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      sum += headers[i].id + headers[i].length + headers[i].flags + headers[i].value;
+    }
+
+    benchmark::do_not_optimise(sum);
+
+    return count;
+  }
+
+  //***************************************************************************
+  template <typename THeader>
+  size_t wire_header_write()
+  {
+    THeader*     headers = reinterpret_cast<THeader*>(message_buffer);
+    const size_t count   = sizeof(message_buffer) / sizeof(THeader);
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      headers[i].id     = static_cast<uint16_t>(i);
+      headers[i].length = static_cast<uint32_t>(i * 3U);
+      headers[i].flags  = static_cast<uint8_t>(i);
+      headers[i].value  = static_cast<uint32_t>(i * 7U);
+    }
+
+    benchmark::clobber_memory();
+
+    return count;
+  }
+
+  //***************************************************************************
+  /// Samples from a big endian sensor, converted to host order.
+  //***************************************************************************
+  const size_t Samples = 1024U;
+
+  uint32_t samples[Samples];
+
+  //***************************************************************************
+  size_t samples_ntoh_each()
+  {
+    for (size_t i = 0U; i < Samples; ++i)
+    {
+      samples[i] = etl::ntoh(samples[i]);
+    }
+
+    benchmark::clobber_memory();
+
+    return Samples;
+  }
+
+  //***************************************************************************
+  size_t samples_ntoh_span()
+  {
+    etl::ntoh(etl::span<uint32_t>(samples));
+
+    benchmark::clobber_memory();
+
+    return Samples;
+  }
+
+  //***************************************************************************
+  /// Log lines built from several fragments.
+  //***************************************************************************
+  const size_t Log_Lines = 256U;
+
+  const char* const log_fragments[] = { "[", "12:34:56.789", "] ", "WARN", " ", "motor_controller", ": ", "over current on phase ", "B", "\n" };
+  const size_t      Log_Fragments   = sizeof(log_fragments) / sizeof(log_fragments[0]);
+
+  etl::string<128> log_line;
+
+  //***************************************************************************
+  size_t log_line_push_back()
+  {
+    for (size_t line = 0U; line < Log_Lines; ++line)
+    {
+      log_line.clear();
+
+      for (size_t i = 0U; i < Log_Fragments; ++i)
+      {
+        for (const char* p = log_fragments[i]; *p != 0; ++p)
+        {
+          log_line.push_back(*p);
+        }
+      }
+
+      benchmark::do_not_optimise(log_line.size());
+    }
+
+    return Log_Lines;
+  }
+
+  //***************************************************************************
+  size_t log_line_append()
+  {
+    for (size_t line = 0U; line < Log_Lines; ++line)
+    {
+      log_line.clear();
+
+      for (size_t i = 0U; i < Log_Fragments; ++i)
+      {
+        log_line.append(log_fragments[i]);
+      }
+
+      benchmark::do_not_optimise(log_line.size());
+    }
+
+    return Log_Lines;
+  }
+
+  //***************************************************************************
+  size_t log_line_builder()
+  {
+    for (size_t line = 0U; line < Log_Lines; ++line)
+    {
+      log_line.clear();
+
+      etl::string_builder builder(log_line);
+
+      for (size_t i = 0U; i < Log_Fragments; ++i)
+      {
+        builder.append(log_fragments[i]);
+      }
+
+      builder.commit();
+
+      benchmark::do_not_optimise(log_line.size());
+    }
+
+    return Log_Lines;
+  }
+}
+
+//*****************************************************************************
+// bit_stream, fields per second.
+//*****************************************************************************
+ETL_BENCHMARK(bit_stream, write, big)    { return bit_stream_write(etl::endian::big); }
+ETL_BENCHMARK(bit_stream, write, little) { return bit_stream_write(etl::endian::little); }
+ETL_BENCHMARK(bit_stream, read,  big)    { return bit_stream_read(etl::endian::big); }
+ETL_BENCHMARK(bit_stream, read,  little) { return bit_stream_read(etl::endian::little); }
+
+//*****************************************************************************
+// byte_stream, bytes per second.
+//*****************************************************************************
+ETL_BENCHMARK(byte_stream, write_each, big)    { return byte_stream_write_each(etl::endian::big); }
+ETL_BENCHMARK(byte_stream, write_each, little) { return byte_stream_write_each(etl::endian::little); }
+ETL_BENCHMARK(byte_stream, write_span, big)    { return byte_stream_write_span(etl::endian::big); }
+ETL_BENCHMARK(byte_stream, write_span, little) { return byte_stream_write_span(etl::endian::little); }
+ETL_BENCHMARK(byte_stream, read_span,  big)    { return byte_stream_read_span(etl::endian::big); }
+ETL_BENCHMARK(byte_stream, read_span,  little) { return byte_stream_read_span(etl::endian::little); }
+
+//*****************************************************************************
+// serial_schema, compared with the same fields coded by hand, messages per second.
+//*****************************************************************************
+ETL_BENCHMARK(serial_schema, write,        by_hand) { return message_write_by_hand(); }
+ETL_BENCHMARK(serial_schema, write,        schema)  { return message_write_schema(); }
+ETL_BENCHMARK(serial_schema, write_packed, by_hand) { return packed_message_write_by_hand(); }
+ETL_BENCHMARK(serial_schema, write_packed, schema)  { return packed_message_write_schema(); }
+ETL_BENCHMARK(serial_schema, read,         by_hand) { return message_read_by_hand(); }
+ETL_BENCHMARK(serial_schema, read,         schema)  { return message_read_schema(); }
+
+//*****************************************************************************
+// unaligned_type fields of a wire format header, headers per second.
+//*****************************************************************************
+ETL_BENCHMARK(unaligned_type, read,  big)    { return wire_header_read<Big_Wire_Header>(); }
+ETL_BENCHMARK(unaligned_type, read,  little) { return wire_header_read<Little_Wire_Header>(); }
+ETL_BENCHMARK(unaligned_type, write, big)    { return wire_header_write<Big_Wire_Header>(); }
+ETL_BENCHMARK(unaligned_type, write, little) { return wire_header_write<Little_Wire_Header>(); }
+
+//*****************************************************************************
+// Byte order conversion, samples per second.
+//*****************************************************************************
+ETL_BENCHMARK(byteswap, ntoh_uint32, each) { return samples_ntoh_each(); }
+ETL_BENCHMARK(byteswap, ntoh_uint32, span) { return samples_ntoh_span(); }
+
+//*****************************************************************************
+// string, log lines per second.
+//*****************************************************************************
+ETL_BENCHMARK(string, log_line, push_back) { return log_line_push_back(); }
+ETL_BENCHMARK(string, log_line, append)    { return log_line_append(); }
+ETL_BENCHMARK(string, log_line, builder)   { return log_line_builder(); }
@@ -0,0 +1,294 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//*****************************************************************************
+// Usage: etl_benchmarks [--filter=<text>] [--format=table|csv|json]
+//                       [--min-time=<ms>] [--output=<file>] [--list]
+//
+// --filter   Only runs benchmarks whose 'group/name/implementation' contains the text.
+// --format   The output format. 'csv' and 'json' are intended for tools. Default 'table'.
+// --min-time The minimum time to spend on each benchmark, in milliseconds. Default 200.
+// --output   Writes the results to a file instead of stdout.
+// --list     Lists the benchmarks without running them.
+//*****************************************************************************
+
+namespace benchmark
+{
+  //***************************************************************************
+  std::vector<entry>& registry()
+  {
+    static std::vector<entry> entries;
+    return entries;
+  }
+}
+
+namespace
+{
+  typedef std::chrono::steady_clock clock_type;
+
+  //***************************************************************************
+  std::string full_name(const benchmark::entry& e)
+  {
+    return std::string(e.group) + "/" + e.name + "/" + e.implementation;
+  }
+
+  //***************************************************************************
+  double percentile(std::vector<double>& samples, double fraction)
+  {
+    size_t index = static_cast<size_t>(fraction * static_cast<double>(samples.size() - 1U));
+    std::nth_element(samples.begin(), samples.begin() + static_cast<ptrdiff_t>(index), samples.end());
+
+    return samples[index];
+  }
+
+  //***************************************************************************
+  benchmark::result run(const benchmark::entry& e, double min_time_ns)
+  {
+    // Warm up the caches and branch predictors.
+    e.function();
+
+    std::vector<double> ns_per_op;
+    uint64_t operations = 0U;
+    double   total_ns   = 0.0;
+
+    while ((total_ns < min_time_ns) || (ns_per_op.size() < 5U))
+    {
+      clock_type::time_point start = clock_type::now();
+      size_t n = e.function();
+      clock_type::time_point stop = clock_type::now();
+
+      double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+
+      n = (n == 0U) ? 1U : n;
+      operations += n;
+      total_ns   += ns;
+      ns_per_op.push_back(ns / static_cast<double>(n));
+    }
+
+    benchmark::result r;
+
+    r.pentry           = &e;
+    r.batches          = ns_per_op.size();
+    r.operations       = operations;
+    r.ops_per_second   = (total_ns > 0.0) ? (static_cast<double>(operations) * 1e9) / total_ns : 0.0;
+    r.ns_per_op_max    = *std::max_element(ns_per_op.begin(), ns_per_op.end());
+    r.ns_per_op_p99    = percentile(ns_per_op, 0.99);
+    r.ns_per_op_median = percentile(ns_per_op, 0.5);
+
+    return r;
+  }
+
+  //***************************************************************************
+  void write_table(std::ostream& os, const std::vector<benchmark::result>& results)
+  {
+    char line[256];
+
+    std::snprintf(line, sizeof(line), "%-56s %14s %12s %12s %12s\n", "benchmark", "ops/s", "median ns", "p99 ns", "max ns");
+    os << line;
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const benchmark::result& r = results[i];
+
+      std::snprintf(line, sizeof(line), "%-56s %14.0f %12.2f %12.2f %12.2f\n",
+                    full_name(*r.pentry).c_str(), r.ops_per_second, r.ns_per_op_median, r.ns_per_op_p99, r.ns_per_op_max);
+      os << line;
+    }
+  }
+
+  //***************************************************************************
+  void write_csv(std::ostream& os, const std::vector<benchmark::result>& results)
+  {
+    os << "group,name,implementation,batches,operations,ops_per_second,ns_per_op_median,ns_per_op_p99,ns_per_op_max\n";
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const benchmark::result& r = results[i];
+
+      os << r.pentry->group << ',' << r.pentry->name << ',' << r.pentry->implementation << ','
+         << r.batches << ',' << r.operations << ',' << r.ops_per_second << ','
+         << r.ns_per_op_median << ',' << r.ns_per_op_p99 << ',' << r.ns_per_op_max << '\n';
+    }
+  }
+
+  //***************************************************************************
+  void write_json(std::ostream& os, const std::vector<benchmark::result>& results)
+  {
+    os << "{\n  \"benchmarks\": [\n";
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const benchmark::result& r = results[i];
+
+      os << "    { \"group\": \"" << r.pentry->group
+         << "\", \"name\": \"" << r.pentry->name
+         << "\", \"implementation\": \"" << r.pentry->implementation
+         << "\", \"batches\": " << r.batches
+         << ", \"operations\": " << r.operations
+         << ", \"ops_per_second\": " << r.ops_per_second
+         << ", \"ns_per_op_median\": " << r.ns_per_op_median
+         << ", \"ns_per_op_p99\": " << r.ns_per_op_p99
+         << ", \"ns_per_op_max\": " << r.ns_per_op_max
+         << " }" << ((i + 1U) < results.size() ? "," : "") << '\n';
+    }
+
+    os << "  ]\n}\n";
+  }
+
+  //***************************************************************************
+  bool get_option(const char* arg, const char* option, std::string& value)
+  {
+    size_t length = std::strlen(option);
+
+    if (std::strncmp(arg, option, length) == 0)
+    {
+      value = arg + length;
+      return true;
+    }
+
+    return false;
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  std::string filter;
+  std::string format   = "table";
+  std::string output;
+  std::string min_time = "200";
+  bool        list     = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (!get_option(argv[i], "--filter=",   filter)   &&
+        !get_option(argv[i], "--format=",   format)   &&
+        !get_option(argv[i], "--min-time=", min_time) &&
+        !get_option(argv[i], "--output=",   output))
+    {
+      if (std::strcmp(argv[i], "--list") == 0)
+      {
+        list = true;
+      }
+      else
+      {
+        std::cerr << "Unknown option '" << argv[i] << "'\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  if ((format != "table") && (format != "csv") && (format != "json"))
+  {
+    std::cerr << "Unknown format '" << format << "'\n";
+    return EXIT_FAILURE;
+  }
+
+  const double min_time_ns = std::atof(min_time.c_str()) * 1e6;
+
+  std::vector<benchmark::entry> entries = benchmark::registry();
+
+  // Keep the order stable across builds, with etl and std next to each other.
+  std::stable_sort(entries.begin(), entries.end(), [](const benchmark::entry& lhs, const benchmark::entry& rhs)
+  {
+    int c = std::strcmp(lhs.group, rhs.group);
+    return (c != 0) ? (c < 0) : (std::strcmp(lhs.name, rhs.name) < 0);
+  });
+
+  std::vector<benchmark::result> results;
+
+  for (size_t i = 0U; i < entries.size(); ++i)
+  {
+    if (full_name(entries[i]).find(filter) == std::string::npos)
+    {
+      continue;
+    }
+
+    if (list)
+    {
+      std::cout << full_name(entries[i]) << '\n';
+    }
+    else
+    {
+      std::cerr << "Running " << full_name(entries[i]) << '\n';
+      results.push_back(run(entries[i], min_time_ns));
+    }
+  }
+
+  if (list)
+  {
+    return EXIT_SUCCESS;
+  }
+
+  std::ostringstream oss;
+
+  if (format == "csv")
+  {
+    write_csv(oss, results);
+  }
+  else if (format == "json")
+  {
+    write_json(oss, results);
+  }
+  else
+  {
+    write_table(oss, results);
+  }
+
+  if (output.empty())
+  {
+    std::cout << oss.str();
+  }
+  else
+  {
+    std::ofstream file(output.c_str());
+
+    if (!file)
+    {
+      std::cerr << "Cannot open '" << output << "'\n";
+      return EXIT_FAILURE;
+    }
+
+    file << oss.str();
+  }
+
+  return EXIT_SUCCESS;
+}
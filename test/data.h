@@ -33,6 +33,7 @@ SOFTWARE.
 #include <utility>
 
 #include "etl/instance_count.h"
+#include "etl/type_traits.h"
 
 //*****************************************************************************
 // Default constructor.
@@ -281,4 +282,228 @@ std::ostream& operator << (std::ostream& s, const TestDataM<T>& rhs)
   return s;
 }
 
+//*****************************************************************************
+// Trivially relocatable, but not trivially copyable.
+// Owns its value through a pointer, so a bytewise copy to a new address
+// followed by forgetting the old one leaves exactly one owner.
+//*****************************************************************************
+template <typename T>
+class TestDataR
+{
+public:
+
+  TestDataR()
+    : p_value(new T())
+  {
+  }
+
+  explicit TestDataR(const T& value_)
+    : p_value(new T(value_))
+  {
+  }
+
+  TestDataR(const TestDataR& other)
+    : p_value(new T(*other.p_value))
+  {
+  }
+
+  ~TestDataR()
+  {
+    delete p_value;
+  }
+
+  TestDataR& operator =(const TestDataR& other)
+  {
+    *p_value = *other.p_value;
+
+    return *this;
+  }
+
+  const T& value() const
+  {
+    return *p_value;
+  }
+
+private:
+
+  T* p_value;
+};
+
+namespace etl
+{
+  template <typename T>
+  struct is_trivially_relocatable<TestDataR<T> > : public etl::true_type
+  {
+  };
+}
+
+template <typename T>
+bool operator == (const TestDataR<T>& lhs, const TestDataR<T>& rhs)
+{
+  return lhs.value() == rhs.value();
+}
+
+template <typename T>
+bool operator != (const TestDataR<T>& lhs, const TestDataR<T>& rhs)
+{
+  return lhs.value() != rhs.value();
+}
+
+template <typename T>
+std::ostream& operator << (std::ostream& s, const TestDataR<T>& rhs)
+{
+  s << rhs.value();
+  return s;
+}
+
+//*****************************************************************************
+// Counts the operations on TestDataC, CountingLess and CountingHash, so that
+// tests can assert upper bounds on complexity.
+//*****************************************************************************
+struct OperationCounts
+{
+  size_t constructions;
+  size_t copies;
+  size_t moves;
+  size_t destructions;
+  size_t comparisons;
+  size_t hashes;
+
+  void reset()
+  {
+    constructions = 0U;
+    copies        = 0U;
+    moves         = 0U;
+    destructions  = 0U;
+    comparisons   = 0U;
+    hashes        = 0U;
+  }
+
+  static OperationCounts& get()
+  {
+    static OperationCounts counts = { 0U, 0U, 0U, 0U, 0U, 0U };
+    return counts;
+  }
+};
+
+//*****************************************************************************
+// Counted.
+// Counts its constructions, copies, moves, destructions and comparisons.
+//*****************************************************************************
+template <typename T>
+class TestDataC
+{
+public:
+
+  TestDataC()
+    : value(T())
+  {
+    ++OperationCounts::get().constructions;
+  }
+
+  explicit TestDataC(const T& value_)
+    : value(value_)
+  {
+    ++OperationCounts::get().constructions;
+  }
+
+  TestDataC(const TestDataC& other)
+    : value(other.value)
+  {
+    ++OperationCounts::get().copies;
+  }
+
+  TestDataC(TestDataC&& other) noexcept
+    : value(std::move(other.value))
+  {
+    ++OperationCounts::get().moves;
+  }
+
+  ~TestDataC()
+  {
+    ++OperationCounts::get().destructions;
+  }
+
+  TestDataC& operator =(const TestDataC& other)
+  {
+    value = other.value;
+    ++OperationCounts::get().copies;
+
+    return *this;
+  }
+
+  TestDataC& operator =(TestDataC&& other) noexcept
+  {
+    value = std::move(other.value);
+    ++OperationCounts::get().moves;
+
+    return *this;
+  }
+
+  bool operator < (const TestDataC& other) const
+  {
+    ++OperationCounts::get().comparisons;
+    return value < other.value;
+  }
+
+  bool operator == (const TestDataC& other) const
+  {
+    ++OperationCounts::get().comparisons;
+    return value == other.value;
+  }
+
+  bool operator != (const TestDataC& other) const
+  {
+    return !(*this == other);
+  }
+
+  T value;
+};
+
+template <typename T>
+std::ostream& operator << (std::ostream& s, const TestDataC<T>& rhs)
+{
+  s << rhs.value;
+  return s;
+}
+
+//*****************************************************************************
+// A less than comparator that counts its calls.
+//*****************************************************************************
+template <typename T>
+struct CountingLess
+{
+  bool operator ()(const T& lhs, const T& rhs) const
+  {
+    ++OperationCounts::get().comparisons;
+    return lhs < rhs;
+  }
+};
+
+//*****************************************************************************
+// An equality comparator that counts its calls.
+//*****************************************************************************
+template <typename T>
+struct CountingEqual
+{
+  bool operator ()(const T& lhs, const T& rhs) const
+  {
+    ++OperationCounts::get().comparisons;
+    return lhs == rhs;
+  }
+};
+
+//*****************************************************************************
+// A hash for integral keys that counts its calls.
+//*****************************************************************************
+template <typename T>
+struct CountingHash
+{
+  size_t operator ()(const T& value) const
+  {
+    ++OperationCounts::get().hashes;
+    return static_cast<size_t>(value) * 2654435761U;
+  }
+};
+
 #endif
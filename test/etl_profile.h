@@ -38,6 +38,9 @@ SOFTWARE.
 #define ETL_IVECTOR_REPAIR_ENABLE
 #define ETL_IDEQUE_REPAIR_ENABLE
 #define ETL_ICIRCULAR_BUFFER_REPAIR_ENABLE
+#define ETL_ALLOCATION_STATISTICS_ENABLE
+#define ETL_CONTAINER_STATISTICS_ENABLE
+#define ETL_TRACE_ENABLE
 #define ETL_IN_UNIT_TEST
 //#define ETL_DEBUG_COUNT
 #define ETL_ARRAY_VIEW_IS_MUTABLE
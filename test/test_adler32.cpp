@@ -0,0 +1,127 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/checksum.h"
+
+namespace
+{
+  uint32_t reference_adler32(const std::vector<uint8_t>& data)
+  {
+    uint32_t a = 1UL;
+    uint32_t b = 0UL;
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      a = (a + data[i]) % 65521UL;
+      b = (b + a) % 65521UL;
+    }
+
+    return (b << 16U) | a;
+  }
+
+  SUITE(test_adler32)
+  {
+    //*************************************************************************
+    TEST(test_adler32_known_value)
+    {
+      std::string data("Wikipedia");
+
+      uint32_t sum = etl::adler32(data.begin(), data.end());
+
+      CHECK_EQUAL(0x11E60398UL, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_empty)
+    {
+      etl::adler32 checksum_calculator;
+
+      CHECK_EQUAL(1UL, checksum_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_add_values)
+    {
+      std::string data("Wikipedia");
+
+      etl::adler32 checksum_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        checksum_calculator.add(data[i]);
+      }
+
+      CHECK_EQUAL(0x11E60398UL, checksum_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_contiguous_range)
+    {
+      std::vector<uint8_t> data(6000U, 0xFFU);
+
+      for (size_t i = 0UL; i < data.size(); i += 7UL)
+      {
+        data[i] = uint8_t(i);
+      }
+
+      // Pointers add a block at a time.
+      for (size_t length = 0UL; length < 200UL; ++length)
+      {
+        std::vector<uint8_t> part(data.begin(), data.begin() + length);
+
+        CHECK_EQUAL(reference_adler32(part), uint32_t(etl::adler32(data.data(), data.data() + length)));
+      }
+
+      CHECK_EQUAL(reference_adler32(data), uint32_t(etl::adler32(data.data(), data.data() + data.size())));
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_split_ranges)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(i * 13U);
+      }
+
+      etl::adler32 checksum_calculator;
+
+      checksum_calculator.add(data.data(), data.data() + 333U);
+      checksum_calculator.add(data.data() + 333U, data.data() + data.size());
+
+      CHECK_EQUAL(reference_adler32(data), checksum_calculator.value());
+    }
+  };
+}
@@ -44,6 +44,7 @@ SOFTWARE.
 #include <numeric>
 #include <random>
 #include <memory>
+#include <limits>
 
 namespace
 {
@@ -224,6 +225,95 @@ namespace
       CHECK_EQUAL(std::distance(data.begin(), expected.second), std::distance(data.begin(), result.second));
     }
 
+    //*************************************************************************
+    // Pointers to integral values use the block kernels. They must give the
+    // same results as the generic versions, for every length and position.
+    template <typename T>
+    void check_block_kernels()
+    {
+      std::vector<T> values;
+
+      for (size_t i = 0U; i < 40U; ++i)
+      {
+        values.push_back(T((i * 7U) % 5U));
+      }
+
+      for (size_t length = 0U; length <= values.size(); ++length)
+      {
+        const T* first = values.data();
+        const T* last  = first + length;
+
+        CHECK(etl::min_element(first, last, etl::less<T>()) == etl::min_element(first, last));
+        CHECK(etl::max_element(first, last, etl::less<T>()) == etl::max_element(first, last));
+
+        std::pair<const T*, const T*> expected_minmax = etl::minmax_element(first, last, etl::less<T>());
+        std::pair<const T*, const T*> result_minmax   = etl::minmax_element(first, last);
+        CHECK(expected_minmax.first  == result_minmax.first);
+        CHECK(expected_minmax.second == result_minmax.second);
+
+        for (T value = 0; value < 6; ++value)
+        {
+          CHECK(std::find(first, last, value) == etl::find(first, last, value));
+          CHECK_EQUAL(std::count(first, last, value), etl::count(first, last, value));
+        }
+
+        for (size_t position = 0U; position <= length; ++position)
+        {
+          std::vector<T> other(first, last);
+
+          if (position < length)
+          {
+            other[position] = T(other[position] + 1);
+          }
+
+          const T* other_first = other.data();
+          const T* other_last  = other_first + length;
+
+          CHECK_EQUAL(position == length, etl::equal(first, last, other_first));
+          CHECK_EQUAL(position == length, etl::equal(first, last, other_first, other_last));
+
+          std::pair<const T*, const T*> mismatch = etl::mismatch(first, last, other_first);
+          CHECK_EQUAL(position, size_t(mismatch.first - first));
+          CHECK_EQUAL(position, size_t(mismatch.second - other_first));
+
+          mismatch = etl::mismatch(first, last, other_first, other_first + position);
+          CHECK_EQUAL(position, size_t(mismatch.first - first));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(block_kernels)
+    {
+      check_block_kernels<uint8_t>();
+      check_block_kernels<int16_t>();
+      check_block_kernels<int>();
+      check_block_kernels<uint64_t>();
+    }
+
+    //*************************************************************************
+    TEST(mismatch)
+    {
+      std::list<int> data1 = { 1, 2, 3, 4, 5 };
+      std::list<int> data2 = { 1, 2, 3, 9, 5, 6 };
+
+      std::pair<std::list<int>::iterator, std::list<int>::iterator> result = etl::mismatch(data1.begin(), data1.end(), data2.begin());
+      CHECK_EQUAL(4, *result.first);
+      CHECK_EQUAL(9, *result.second);
+
+      result = etl::mismatch(data1.begin(), data1.end(), data2.begin(), data2.end(), [](int a, int b) { return (a == b) || (b == 9); });
+      CHECK(result.first == data1.end());
+      CHECK_EQUAL(6, *result.second);
+
+      result = etl::mismatch(data1.begin(), data1.end(), data2.begin(), [](int a, int b) { return a != 3 || b != 3; });
+      CHECK_EQUAL(3, *result.first);
+
+      std::list<int> data3 = { 1, 2 };
+      result = etl::mismatch(data1.begin(), data1.end(), data3.begin(), data3.end());
+      CHECK_EQUAL(3, *result.first);
+      CHECK(result.second == data3.end());
+    }
+
     //*************************************************************************
     TEST(minmax)
     {
@@ -637,6 +727,98 @@ namespace
       }
     }
 
+    //*************************************************************************
+    // Sorted data with runs of duplicates, for every length.
+    TEST(branchless_lower_and_upper_bound)
+    {
+      for (size_t length = 0U; length < 70U; ++length)
+      {
+        std::vector<int> data;
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          data.push_back(int(i / 3U) * 2);
+        }
+
+        for (int key = -1; key <= int(length); ++key)
+        {
+          CHECK(std::lower_bound(data.begin(), data.end(), key) == etl::branchless_lower_bound(data.begin(), data.end(), key));
+          CHECK(std::upper_bound(data.begin(), data.end(), key) == etl::branchless_upper_bound(data.begin(), data.end(), key));
+
+          const int* first = data.data();
+          const int* last  = first + data.size();
+          CHECK(std::lower_bound(first, last, key) == etl::branchless_lower_bound(first, last, key));
+          CHECK(std::upper_bound(first, last, key) == etl::branchless_upper_bound(first, last, key));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(branchless_lower_bound_with_custom_comparison)
+    {
+      std::vector<int> data = { 9, 7, 7, 5, 3, 3, 3, 1 };
+
+      for (int key = 0; key < 11; ++key)
+      {
+        CHECK(std::lower_bound(data.begin(), data.end(), key, std::greater<int>()) == etl::branchless_lower_bound(data.begin(), data.end(), key, std::greater<int>()));
+        CHECK(std::upper_bound(data.begin(), data.end(), key, std::greater<int>()) == etl::branchless_upper_bound(data.begin(), data.end(), key, std::greater<int>()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(lower_bound_batch)
+    {
+      std::vector<int> data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.push_back((i / 2) * 3);
+      }
+
+      // More keys than a batch, and not a multiple of it.
+      std::list<int> keys;
+
+      for (int key = -2; key < 1505; key += 7)
+      {
+        keys.push_back(key);
+      }
+
+      std::vector<const int*> results(keys.size() + 1U, nullptr);
+
+      const int* first = data.data();
+      const int* last  = first + data.size();
+
+      std::vector<const int*>::iterator end = etl::lower_bound_batch(first, last, keys.begin(), keys.end(), results.begin());
+
+      CHECK(end == (results.end() - 1));
+      CHECK(results.back() == nullptr);
+
+      std::vector<const int*>::iterator result = results.begin();
+
+      for (std::list<int>::const_iterator key = keys.begin(); key != keys.end(); ++key, ++result)
+      {
+        CHECK(std::lower_bound(first, last, *key) == *result);
+      }
+    }
+
+    //*************************************************************************
+    TEST(lower_bound_batch_empty_ranges)
+    {
+      std::vector<int> data;
+      std::vector<int> keys = { 1, 2, 3 };
+      std::vector<std::vector<int>::iterator> results;
+
+      etl::lower_bound_batch(data.begin(), data.end(), keys.begin(), keys.end(), std::back_inserter(results), std::less<int>());
+
+      CHECK_EQUAL(3U, results.size());
+      CHECK(results[0] == data.end());
+      CHECK(results[2] == data.end());
+
+      results.clear();
+      etl::lower_bound_batch(keys.begin(), keys.end(), data.begin(), data.end(), std::back_inserter(results));
+      CHECK(results.empty());
+    }
+
     //*************************************************************************
     TEST(equal_range_random_iterator)
     {
@@ -2086,6 +2268,356 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    // Inputs that are hard for quicksort pivot selection, or easy for pdqsort.
+    std::vector<std::vector<int>> sort_patterns(size_t size)
+    {
+      std::vector<std::vector<int>> patterns;
+
+      std::vector<int> ascending(size);
+      std::iota(ascending.begin(), ascending.end(), 0);
+      patterns.push_back(ascending);
+
+      std::vector<int> descending(ascending.rbegin(), ascending.rend());
+      patterns.push_back(descending);
+
+      std::vector<int> random(ascending);
+      std::shuffle(random.begin(), random.end(), urng);
+      patterns.push_back(random);
+
+      std::vector<int> organ_pipe(size);
+      for (size_t i = 0U; i < size; ++i)
+      {
+        organ_pipe[i] = int((i < (size / 2U)) ? i : (size - i));
+      }
+      patterns.push_back(organ_pipe);
+
+      std::vector<int> sawtooth(size);
+      for (size_t i = 0U; i < size; ++i)
+      {
+        sawtooth[i] = int(i % 17U);
+      }
+      patterns.push_back(sawtooth);
+
+      std::vector<int> all_equal(size, 42);
+      patterns.push_back(all_equal);
+
+      std::vector<int> nearly_sorted(ascending);
+      for (size_t i = 0U; (i + 1U) < size; i += 97U)
+      {
+        std::swap(nearly_sorted[i], nearly_sorted[i + 1U]);
+      }
+      patterns.push_back(nearly_sorted);
+
+      return patterns;
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_patterns)
+    {
+      const size_t sizes[] = { 0U, 1U, 2U, 3U, 23U, 24U, 25U, 128U, 129U, 1000U, 5000U };
+
+      for (size_t size : sizes)
+      {
+        for (const std::vector<int>& pattern : sort_patterns(size))
+        {
+          std::vector<int> data1(pattern);
+          std::vector<int> data2(pattern);
+
+          std::sort(data1.begin(), data1.end());
+          etl::intro_sort(data2.begin(), data2.end());
+
+          CHECK(data1 == data2);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_greater)
+    {
+      for (const std::vector<int>& pattern : sort_patterns(1000U))
+      {
+        std::vector<int> data1(pattern);
+        std::vector<int> data2(pattern);
+
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::intro_sort(data2.begin(), data2.end(), std::greater<int>());
+
+        CHECK(data1 == data2);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_comparisons_are_n_log_n)
+    {
+      const size_t size = 4096U;
+
+      for (const std::vector<int>& pattern : sort_patterns(size))
+      {
+        std::vector<int> data(pattern);
+        size_t comparisons = 0U;
+
+        etl::intro_sort(data.begin(), data.end(), [&comparisons](int a, int b) { ++comparisons; return a < b; });
+
+        CHECK(std::is_sorted(data.begin(), data.end()));
+        CHECK(comparisons < (3U * size * 12U));
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_move_only)
+    {
+      std::vector<int> values(300);
+      std::iota(values.begin(), values.end(), 0);
+      std::shuffle(values.begin(), values.end(), urng);
+
+      std::vector<std::unique_ptr<int>> data;
+
+      for (int value : values)
+      {
+        data.push_back(std::unique_ptr<int>(new int(value)));
+      }
+
+      etl::intro_sort(data.begin(), data.end(), [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; });
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), *data[i]);
+      }
+    }
+
+    //*************************************************************************
+    // Values with few distinct keys, indexed in their original order.
+    std::vector<NDC> stable_sort_data(size_t size)
+    {
+      std::vector<NDC> data;
+
+      for (size_t i = 0U; i < size; ++i)
+      {
+        data.push_back(NDC(int(urng() % 10U), int(i)));
+      }
+
+      return data;
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_is_stable)
+    {
+      const size_t sizes[] = { 0U, 1U, 2U, 15U, 16U, 17U, 33U, 100U, 1000U, 3000U };
+
+      for (size_t size : sizes)
+      {
+        std::vector<NDC> initial_data = stable_sort_data(size);
+
+        std::vector<NDC> data1(initial_data);
+        std::vector<NDC> data2(initial_data);
+        std::vector<NDC> data3(initial_data);
+
+        std::stable_sort(data1.begin(), data1.end());
+        etl::merge_sort(data2.begin(), data2.end());
+        etl::merge_sort(data3.begin(), data3.end(), std::greater<NDC>());
+
+        CHECK(std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical));
+
+        std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+        CHECK(std::equal(data1.begin(), data1.end(), data3.begin(), NDC::are_identical));
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_with_buffer)
+    {
+      const size_t buffer_sizes[] = { 1U, 7U, 100U, 500U, 1000U };
+
+      std::vector<NDC> initial_data = stable_sort_data(1000U);
+
+      std::vector<NDC> expected(initial_data);
+      std::stable_sort(expected.begin(), expected.end());
+
+      for (size_t buffer_size : buffer_sizes)
+      {
+        std::vector<NDC> data(initial_data);
+        std::vector<NDC> buffer(buffer_size, NDC(0));
+
+        etl::merge_sort(data.begin(), data.end(), buffer.begin(), buffer.end());
+
+        CHECK(std::equal(expected.begin(), expected.end(), data.begin(), NDC::are_identical));
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_patterns)
+    {
+      for (const std::vector<int>& pattern : sort_patterns(1000U))
+      {
+        std::vector<int> data1(pattern);
+        std::vector<int> data2(pattern);
+
+        std::sort(data1.begin(), data1.end());
+        etl::merge_sort(data2.begin(), data2.end());
+
+        CHECK(data1 == data2);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_forward_and_bidirectional_iterators)
+    {
+      std::vector<NDC> initial_data = stable_sort_data(200U);
+
+      std::vector<NDC> expected(initial_data);
+      std::stable_sort(expected.begin(), expected.end());
+
+      std::list<NDC>         data1(initial_data.begin(), initial_data.end());
+      std::forward_list<NDC> data2(initial_data.begin(), initial_data.end());
+
+      etl::merge_sort(data1.begin(), data1.end());
+      etl::merge_sort(data2.begin(), data2.end());
+
+      CHECK(std::equal(expected.begin(), expected.end(), data1.begin(), NDC::are_identical));
+      CHECK(std::equal(expected.begin(), expected.end(), data2.begin(), NDC::are_identical));
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_move_only)
+    {
+      std::vector<int> values(200);
+      std::iota(values.begin(), values.end(), 0);
+      std::shuffle(values.begin(), values.end(), urng);
+
+      std::vector<std::unique_ptr<int>> data;
+
+      for (int value : values)
+      {
+        data.push_back(std::unique_ptr<int>(new int(value)));
+      }
+
+      std::vector<std::unique_ptr<int>> buffer(50);
+
+      etl::merge_sort(data.begin(), data.end(), buffer.begin(), buffer.end(), [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; });
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), *data[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_unsigned)
+    {
+      const size_t sizes[] = { 0U, 1U, 2U, 100U, 5000U };
+
+      for (size_t size : sizes)
+      {
+        std::vector<uint32_t> data1(size);
+        std::generate(data1.begin(), data1.end(), [] { return uint32_t(urng()); });
+        std::vector<uint32_t> data2(data1);
+        std::vector<uint32_t> data3(data1);
+        std::vector<uint32_t> scratch(size);
+
+        std::sort(data1.begin(), data1.end());
+        etl::radix_sort(data2.begin(), data2.end(), scratch.begin(), scratch.end());
+        etl::radix_sort<11>(data3.begin(), data3.end(), scratch.begin(), scratch.end());
+
+        CHECK(data1 == data2);
+        CHECK(data1 == data3);
+      }
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_narrow_and_constant_digits)
+    {
+      // The upper bytes are all the same, so their passes are skipped.
+      std::vector<uint16_t> data1(1000);
+      std::generate(data1.begin(), data1.end(), [] { return uint16_t(urng() % 200U); });
+      std::vector<uint16_t> data2(data1);
+      uint16_t scratch[1000];
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), scratch, scratch + 1000);
+
+      CHECK(data1 == data2);
+
+      std::vector<uint8_t> all_equal(50, 7U);
+      uint8_t scratch8[50];
+      etl::radix_sort(all_equal.begin(), all_equal.end(), scratch8, scratch8 + 50);
+      CHECK(std::all_of(all_equal.begin(), all_equal.end(), [](uint8_t v) { return v == 7U; }));
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_signed)
+    {
+      std::vector<int16_t> data1(2000);
+      std::generate(data1.begin(), data1.end(), [] { return int16_t(urng()); });
+      data1[0] = std::numeric_limits<int16_t>::min();
+      data1[1] = std::numeric_limits<int16_t>::max();
+      std::vector<int16_t> data2(data1);
+      std::vector<int16_t> scratch(data1.size());
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), scratch.begin(), scratch.end());
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_floating_point)
+    {
+      std::vector<double> data1 = { 3.5, -1.25, 0.0, -1000.0, 1e-300, -1e-300, 1e300, 42.0, -0.5, 7.0 };
+      std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data1.push_back(distribution(urng));
+      }
+
+      std::vector<double> data2(data1);
+      std::vector<double> scratch(data1.size());
+
+      std::vector<float> data3(data1.begin(), data1.end());
+      std::vector<float> data4(data3);
+      std::vector<float> scratch_float(data3.size());
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), scratch.begin(), scratch.end());
+
+      std::sort(data3.begin(), data3.end());
+      etl::radix_sort(data4.begin(), data4.end(), scratch_float.begin(), scratch_float.end());
+
+      CHECK(data1 == data2);
+      CHECK(data3 == data4);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_projection_is_stable)
+    {
+      std::vector<NDC> initial_data = stable_sort_data(1000U);
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+      std::vector<NDC> scratch(initial_data.size(), NDC(0));
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), scratch.begin(), scratch.end(), [](const NDC& ndc) { return ndc.value; });
+
+      CHECK(std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical));
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_small_scratch_falls_back)
+    {
+      std::vector<NDC> initial_data = stable_sort_data(500U);
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+      std::vector<NDC> scratch(10U, NDC(0));
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::radix_sort<11>(data2.begin(), data2.end(), scratch.begin(), scratch.end(), [](const NDC& ndc) { return ndc.value; });
+
+      CHECK(std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical));
+    }
+
     //*************************************************************************
     TEST(multimax)
     {
@@ -2384,5 +2916,98 @@ namespace
         data = initial;
       }
     }
+
+    //*************************************************************************
+    TEST(nth_element_patterns)
+    {
+      for (size_t size : { 17U, 100U, 1000U, 5000U })
+      {
+        for (const std::vector<int>& pattern : sort_patterns(size))
+        {
+          std::vector<int> sorted(pattern);
+          std::sort(sorted.begin(), sorted.end());
+
+          for (size_t n : { size_t(0U), size / 3U, size / 2U, size - 1U })
+          {
+            std::vector<int> data(pattern);
+            std::vector<int>::iterator nth = data.begin() + n;
+
+            etl::nth_element(data.begin(), nth, data.end());
+
+            CHECK_EQUAL(sorted[n], *nth);
+            CHECK(std::all_of(data.begin(), nth, [&](int value) { return !(*nth < value); }));
+            CHECK(std::all_of(nth, data.end(), [&](int value) { return !(value < *nth); }));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(partial_sort_patterns)
+    {
+      for (const std::vector<int>& pattern : sort_patterns(1000U))
+      {
+        for (size_t k : { 0U, 1U, 10U, 500U, 1000U })
+        {
+          std::vector<int> data1(pattern);
+          std::vector<int> data2(pattern);
+
+          std::partial_sort(data1.begin(), data1.begin() + k, data1.end());
+          etl::partial_sort(data2.begin(), data2.begin() + k, data2.end());
+
+          CHECK(std::equal(data1.begin(), data1.begin() + k, data2.begin()));
+
+          std::sort(data1.begin(), data1.end());
+          std::sort(data2.begin(), data2.end());
+          CHECK(data1 == data2);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(partial_sort_with_custom_comparison)
+    {
+      std::vector<int> data1(sort_patterns(200U)[2]);
+      std::vector<int> data2(data1);
+
+      std::partial_sort(data1.begin(), data1.begin() + 20, data1.end(), std::greater<int>());
+      etl::partial_sort(data2.begin(), data2.begin() + 20, data2.end(), std::greater<int>());
+
+      CHECK(std::equal(data1.begin(), data1.begin() + 20, data2.begin()));
+    }
+
+    //*************************************************************************
+    TEST(partial_sort_copy_smaller_destination)
+    {
+      const std::vector<int> data(sort_patterns(1000U)[2]);
+      const std::list<int>   input(data.begin(), data.end());
+
+      std::vector<int> output1(10U);
+      std::vector<int> output2(10U);
+
+      std::vector<int>::iterator end1 = std::partial_sort_copy(input.begin(), input.end(), output1.begin(), output1.end(), std::greater<int>());
+      std::vector<int>::iterator end2 = etl::partial_sort_copy(input.begin(), input.end(), output2.begin(), output2.end(), std::greater<int>());
+
+      CHECK(end2 == output2.end());
+      CHECK((end1 - output1.begin()) == (end2 - output2.begin()));
+      CHECK(output1 == output2);
+    }
+
+    //*************************************************************************
+    TEST(partial_sort_copy_larger_destination)
+    {
+      const std::vector<int> input = { 5, 3, 9, 1, 7 };
+
+      std::vector<int> output(8U, -1);
+
+      std::vector<int>::iterator end = etl::partial_sort_copy(input.begin(), input.end(), output.begin(), output.end());
+
+      CHECK_EQUAL(5, end - output.begin());
+
+      const std::vector<int> expected = { 1, 3, 5, 7, 9, -1, -1, -1 };
+      CHECK(output == expected);
+
+      CHECK(etl::partial_sort_copy(input.begin(), input.begin(), output.begin(), output.end()) == output.begin());
+    }
   };
 }
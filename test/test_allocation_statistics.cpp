@@ -0,0 +1,203 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/allocation_statistics.h"
+#include "etl/pool.h"
+#include "etl/variant_pool.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#if ETL_HAS_ALLOCATION_STATISTICS
+
+namespace
+{
+  uint32_t ticks = 0U;
+
+  uint32_t get_ticks()
+  {
+    return ticks;
+  }
+
+  SUITE(test_allocation_statistics)
+  {
+    //*************************************************************************
+    TEST(test_pool)
+    {
+      etl::pool<int, 4> pool;
+
+      const etl::allocation_statistics& statistics = pool.get_statistics();
+
+      CHECK_EQUAL(0U, statistics.size());
+      CHECK_EQUAL(0U, statistics.peak_size());
+      CHECK_EQUAL(0U, statistics.allocation_count());
+
+      int* p1 = pool.allocate();
+      int* p2 = pool.allocate();
+      int* p3 = pool.allocate();
+      pool.release(p2);
+      p2 = pool.allocate();
+      pool.release(p1);
+
+      CHECK_EQUAL(2U, statistics.size());
+      CHECK_EQUAL(3U, statistics.peak_size());
+      CHECK_EQUAL(4U, statistics.allocation_count());
+      CHECK_EQUAL(2U, statistics.release_count());
+      CHECK_EQUAL(0U, statistics.failure_count());
+
+      pool.release(p2);
+      pool.release(p3);
+      CHECK_EQUAL(0U, statistics.size());
+    }
+
+    //*************************************************************************
+    TEST(test_pool_failure)
+    {
+      etl::pool<int, 2> pool;
+
+      pool.allocate();
+      pool.allocate();
+
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+
+      CHECK_EQUAL(2U, pool.get_statistics().failure_count());
+      CHECK_EQUAL(2U, pool.get_statistics().peak_size());
+
+      pool.release_all();
+
+      CHECK_EQUAL(0U, pool.get_statistics().size());
+      CHECK_EQUAL(2U, pool.get_statistics().release_count());
+      CHECK_EQUAL(2U, pool.get_statistics().peak_size());
+    }
+
+    //*************************************************************************
+    TEST(test_reset)
+    {
+      etl::generic_pool<sizeof(int), alignof(int), 4> pool;
+
+      int* p1 = pool.allocate<int>();
+      int* p2 = pool.allocate<int>();
+      pool.release(p2);
+
+      pool.get_statistics().reset();
+
+      CHECK_EQUAL(1U, pool.get_statistics().size());
+      CHECK_EQUAL(1U, pool.get_statistics().peak_size());
+      CHECK_EQUAL(0U, pool.get_statistics().allocation_count());
+      CHECK_EQUAL(0U, pool.get_statistics().release_count());
+
+      pool.release(p1);
+    }
+
+    //*************************************************************************
+    TEST(test_variant_pool_via_ipool)
+    {
+      etl::variant_pool<3, char, int, double> pool;
+      etl::ipool& ipool = pool;
+
+      char*   p1 = pool.create<char>('a');
+      double* p2 = pool.create<double>(1.0);
+      pool.destroy(p1);
+
+      CHECK_EQUAL(1U, ipool.get_statistics().size());
+      CHECK_EQUAL(2U, ipool.get_statistics().peak_size());
+      CHECK_EQUAL(2U, ipool.get_statistics().allocation_count());
+
+      pool.destroy(p2);
+    }
+
+    //*************************************************************************
+    TEST(test_timestamps)
+    {
+      etl::pool<int, 2> pool;
+      etl::allocation_statistics& statistics = pool.get_statistics();
+
+      statistics.set_clock(etl::allocation_statistics::clock_type::create<get_ticks>());
+
+      ticks = 10U;
+      int* p1 = pool.allocate();
+      ticks = 20U;
+      int* p2 = pool.allocate();
+      ticks = 30U;
+      pool.release(p2);
+      p2 = pool.allocate();
+      ticks = 40U;
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+
+      CHECK_EQUAL(20U, statistics.peak_timestamp());
+      CHECK_EQUAL(30U, statistics.last_allocation_timestamp());
+      CHECK_EQUAL(40U, statistics.last_failure_timestamp());
+
+      statistics.clear_clock();
+      pool.release(p2);
+      p2 = pool.allocate();
+      CHECK_EQUAL(0U, statistics.last_allocation_timestamp());
+
+      pool.release(p1);
+      pool.release(p2);
+    }
+
+    //*************************************************************************
+    TEST(test_memory_block_allocator_with_successor)
+    {
+      etl::fixed_sized_memory_block_allocator<sizeof(int), alignof(int), 1> allocator1;
+      etl::fixed_sized_memory_block_allocator<sizeof(int), alignof(int), 2> allocator2;
+
+      allocator1.set_successor(allocator2);
+
+      void* p1 = allocator1.allocate(sizeof(int), alignof(int));
+      void* p2 = allocator1.allocate(sizeof(int), alignof(int));
+      void* p3 = allocator1.allocate(sizeof(int), alignof(int));
+      void* p4 = allocator1.allocate(sizeof(int), alignof(int));
+
+      CHECK(p3 != nullptr);
+      CHECK(p4 == nullptr);
+
+      CHECK_EQUAL(1U, allocator1.get_statistics().peak_size());
+      CHECK_EQUAL(1U, allocator1.get_statistics().allocation_count());
+      CHECK_EQUAL(3U, allocator1.get_statistics().failure_count());
+
+      CHECK_EQUAL(2U, allocator2.get_statistics().peak_size());
+      CHECK_EQUAL(2U, allocator2.get_statistics().allocation_count());
+      CHECK_EQUAL(1U, allocator2.get_statistics().failure_count());
+
+      allocator1.release(p2);
+      allocator1.release(p1);
+
+      CHECK_EQUAL(0U, allocator1.get_statistics().size());
+      CHECK_EQUAL(1U, allocator1.get_statistics().release_count());
+      CHECK_EQUAL(1U, allocator2.get_statistics().size());
+      CHECK_EQUAL(1U, allocator2.get_statistics().release_count());
+
+      allocator1.release(p3);
+    }
+  }
+}
+
+#endif
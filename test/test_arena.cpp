@@ -0,0 +1,234 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <string>
+
+#include "etl/arena.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+
+namespace
+{
+  struct Node
+  {
+    Node(int value_, Node* p_next_)
+      : value(value_)
+      , p_next(p_next_)
+    {
+    }
+
+    int   value;
+    Node* p_next;
+  };
+
+  struct Message1 : public etl::message<1>
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  bool is_aligned(const void* p, size_t alignment)
+  {
+    return (reinterpret_cast<uintptr_t>(p) % alignment) == 0U;
+  }
+
+  SUITE(test_arena)
+  {
+    //*************************************************************************
+    TEST(test_allocate_is_aligned_and_contiguous)
+    {
+      etl::arena<64U, 8U> arena;
+
+      CHECK_EQUAL(64U, arena.capacity());
+      CHECK(arena.empty());
+
+      char*     p1 = arena.allocate<char>();
+      uint32_t* p2 = arena.allocate<uint32_t>();
+      char*     p3 = arena.allocate<char>();
+      uint64_t* p4 = arena.allocate<uint64_t>();
+
+      CHECK(is_aligned(p2, alignof(uint32_t)));
+      CHECK(is_aligned(p4, alignof(uint64_t)));
+
+      CHECK_EQUAL(4, reinterpret_cast<char*>(p2) - p1);
+      CHECK_EQUAL(4, p3 - reinterpret_cast<char*>(p2));
+      CHECK_EQUAL(16U, reinterpret_cast<char*>(p4) - p1);
+      CHECK_EQUAL(24U, arena.size());
+      CHECK_EQUAL(40U, arena.available());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_array)
+    {
+      etl::arena<64U> arena;
+
+      int* p = arena.allocate<int>(10U);
+
+      CHECK(p != nullptr);
+      CHECK_EQUAL(10U * sizeof(int), arena.size());
+
+      CHECK_THROW(arena.allocate<int>(100U), etl::arena_no_allocation);
+      CHECK_THROW(arena.allocate<int>(size_t(-1)), etl::arena_no_allocation);
+      CHECK_EQUAL(10U * sizeof(int), arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_exhausted)
+    {
+      etl::arena<16U, 8U> arena;
+
+      CHECK(arena.allocate<uint64_t>() != nullptr);
+      CHECK(arena.allocate<uint64_t>() != nullptr);
+      CHECK_THROW(arena.allocate<char>(), etl::arena_no_allocation);
+
+      // The block allocator interface returns a null pointer.
+      CHECK(arena.allocate(1U, 1U) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_create_and_checkpoints)
+    {
+      etl::arena<256U> arena;
+
+      Node* p_list = arena.create<Node>(1, nullptr);
+
+      etl::iarena::checkpoint_type checkpoint = arena.checkpoint();
+
+      p_list = arena.create<Node>(2, p_list);
+      p_list = arena.create<Node>(3, p_list);
+
+      CHECK_EQUAL(3, p_list->value);
+      CHECK_EQUAL(2, p_list->p_next->value);
+      CHECK_EQUAL(1, p_list->p_next->p_next->value);
+      CHECK_EQUAL(3U * sizeof(Node), arena.size());
+      CHECK_EQUAL(3U * sizeof(Node), arena.peak_size());
+
+      arena.rewind(checkpoint);
+      CHECK_EQUAL(sizeof(Node), arena.size());
+      CHECK_EQUAL(3U * sizeof(Node), arena.peak_size());
+
+      CHECK_THROW(arena.rewind(arena.size() + 1U), etl::arena_invalid_checkpoint);
+
+      arena.reset();
+      CHECK(arena.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_scope)
+    {
+      etl::arena<256U> arena;
+
+      arena.allocate<int>();
+
+      {
+        etl::arena_scope scope(arena);
+
+        arena.allocate<int>(10U);
+        CHECK_EQUAL(11U * sizeof(int), arena.size());
+
+        {
+          etl::arena_scope inner(arena);
+
+          arena.allocate<int>(10U);
+          CHECK_EQUAL(21U * sizeof(int), arena.size());
+        }
+
+        CHECK_EQUAL(11U * sizeof(int), arena.size());
+      }
+
+      CHECK_EQUAL(sizeof(int), arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_arena_ext)
+    {
+      alignas(8) char buffer[32];
+
+      etl::arena_ext arena(buffer, sizeof(buffer));
+
+      CHECK_EQUAL(32U, arena.capacity());
+
+      uint64_t* p = arena.allocate<uint64_t>();
+
+      CHECK(reinterpret_cast<char*>(p) == &buffer[0]);
+      CHECK(arena.is_owner_of(p));
+      CHECK(!arena.is_owner_of(&p));
+    }
+
+    //*************************************************************************
+    TEST(test_as_successor)
+    {
+      etl::fixed_sized_memory_block_allocator<8U, 8U, 1U> allocator;
+      etl::arena<64U> arena;
+
+      allocator.set_successor(arena);
+
+      void* p1 = allocator.allocate(8U, 8U); // From the fixed sized allocator.
+      void* p2 = allocator.allocate(8U, 8U); // From the arena.
+      void* p3 = allocator.allocate(24U, 8U); // From the arena.
+
+      CHECK(allocator.is_owner_of(p1));
+      CHECK(!arena.is_owner_of(p1));
+      CHECK(arena.is_owner_of(p2));
+      CHECK(arena.is_owner_of(p3));
+
+      CHECK(allocator.release(p1));
+      CHECK(allocator.release(p2));
+      CHECK(allocator.release(p3));
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    TEST(test_message_pool)
+    {
+      etl::arena<256U> arena;
+      etl::atomic_counted_message_pool message_pool(arena);
+
+      {
+        etl::shared_message sm1(message_pool, Message1(1));
+        etl::shared_message sm2(message_pool, Message1(2));
+
+        CHECK_EQUAL(1, static_cast<Message1&>(sm1.get_message()).i);
+        CHECK_EQUAL(2, static_cast<Message1&>(sm2.get_message()).i);
+        CHECK(!arena.empty());
+      }
+
+      arena.reset();
+      CHECK(arena.empty());
+    }
+#endif
+  }
+}
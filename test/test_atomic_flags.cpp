@@ -0,0 +1,255 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/atomic_flags.h"
+
+#include <thread>
+#include <chrono>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::atomic_flags<uint8_t>        Flags;
+  typedef etl::atomic_flags<uint8_t, 0x0FU> MaskedFlags;
+
+  SUITE(test_atomic_flags)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Flags flags1;
+      Flags flags2(0x5AU);
+      MaskedFlags flags3(0x5AU);
+
+      CHECK_EQUAL(0x00U, flags1.value());
+      CHECK_EQUAL(0x5AU, flags2.value());
+      CHECK_EQUAL(0x0AU, flags3.value());
+      CHECK_EQUAL(0x0FU, MaskedFlags::ALL_SET);
+      CHECK_EQUAL(8U, MaskedFlags::NBITS);
+      CHECK(flags2.load() == etl::flags<uint8_t>(0x5AU));
+    }
+
+    //*************************************************************************
+    TEST(test_set_reset_flip)
+    {
+      MaskedFlags flags;
+
+      CHECK_EQUAL(0x00U, flags.set(0x13U));
+      CHECK_EQUAL(0x03U, flags.value());
+
+      CHECK_EQUAL(0x03U, flags.set(0x04U));
+      CHECK_EQUAL(0x07U, flags.reset(0x01U));
+      CHECK_EQUAL(0x06U, flags.value());
+
+      CHECK_EQUAL(0x06U, flags.flip(0xF3U));
+      CHECK_EQUAL(0x05U, flags.value());
+
+      CHECK_EQUAL(0x05U, flags.exchange(0xFFU));
+      CHECK_EQUAL(0x0FU, flags.value());
+
+      CHECK_EQUAL(0x0FU, flags.clear());
+      CHECK_EQUAL(0x00U, flags.value());
+
+      flags.store(0x39U);
+      CHECK_EQUAL(0x09U, flags.value());
+    }
+
+    //*************************************************************************
+    TEST(test_tests)
+    {
+      Flags flags(0x0CU);
+
+      CHECK(flags.test(0x04U));
+      CHECK(!flags.test(0x03U));
+      CHECK(flags.any_of(0x06U));
+      CHECK(!flags.all_of(0x06U));
+      CHECK(flags.all_of(0x0CU));
+      CHECK(flags.none_of(0x30U));
+      CHECK(!flags.none_of(0x08U));
+    }
+
+    //*************************************************************************
+    TEST(test_test_and_set_test_and_clear)
+    {
+      Flags flags(0x0CU);
+
+      CHECK_EQUAL(0x04U, flags.test_and_set(0x05U));
+      CHECK_EQUAL(0x0DU, flags.value());
+
+      CHECK_EQUAL(0x09U, flags.test_and_clear(0x0BU));
+      CHECK_EQUAL(0x04U, flags.value());
+
+      CHECK_EQUAL(0x00U, flags.test_and_clear(0x0BU));
+      CHECK_EQUAL(0x04U, flags.value());
+    }
+
+    //*************************************************************************
+    TEST(test_test_and_clear_claims_each_bit_once)
+    {
+      etl::atomic_flags<uint32_t> flags;
+      etl::atomic<uint32_t>       claimed(0U);
+      etl::atomic<int>            duplicates(0);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < 4; ++t)
+      {
+        threads.push_back(std::thread([&flags, &claimed, &duplicates]()
+        {
+          for (int i = 0; i < 1000; ++i)
+          {
+            const uint32_t bits = flags.test_and_clear(0xFFFFFFFFUL);
+
+            if ((claimed.fetch_or(bits) & bits) != 0U)
+            {
+              ++duplicates;
+            }
+          }
+        }));
+      }
+
+      for (int i = 0; i < 32; ++i)
+      {
+        flags.set(uint32_t(1UL << i));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      claimed.fetch_or(flags.test_and_clear(0xFFFFFFFFUL));
+
+      CHECK_EQUAL(0xFFFFFFFFUL, claimed.load());
+      CHECK_EQUAL(0, duplicates.load());
+    }
+
+#if ETL_HAS_ATOMIC_WAIT
+    //*************************************************************************
+    TEST(test_wait_already_set)
+    {
+      Flags flags(0x06U);
+
+      CHECK_EQUAL(0x02U, flags.wait_any(0x03U));
+      CHECK_EQUAL(0x06U, flags.wait_all(0x06U));
+      CHECK_EQUAL(0x06U, flags.value());
+
+      CHECK_EQUAL(0x04U, flags.wait_any_for(0x0CU, 0U, true));
+      CHECK_EQUAL(0x02U, flags.value());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_timeout)
+    {
+      Flags flags(0x01U);
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      CHECK_EQUAL(0x00U, flags.wait_any_for(0x06U, 20U));
+      CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+
+      CHECK_EQUAL(0x00U, flags.wait_all_for(0x03U, 0U, true));
+      CHECK_EQUAL(0x01U, flags.value());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_any_wakes)
+    {
+      Flags             flags;
+      etl::atomic<int>  result(-1);
+
+      std::thread waiter([&flags, &result]()
+      {
+        result.store(flags.wait_any(0x30U, true));
+      });
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      CHECK_EQUAL(-1, result.load());
+
+      // Not a bit that is waited for.
+      flags.set_and_notify(0x01U);
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      CHECK_EQUAL(-1, result.load());
+
+      flags.set_and_notify(0x20U);
+
+      waiter.join();
+      CHECK_EQUAL(0x20, result.load());
+      CHECK_EQUAL(0x01U, flags.value());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_all_wakes)
+    {
+      Flags             flags;
+      etl::atomic<int>  result(-1);
+
+      std::thread waiter([&flags, &result]()
+      {
+        result.store(flags.wait_all(0x05U));
+      });
+
+      flags.set_and_notify(0x01U);
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      CHECK_EQUAL(-1, result.load());
+
+      flags.set_and_notify(0x04U);
+
+      waiter.join();
+      CHECK_EQUAL(0x05, result.load());
+      CHECK_EQUAL(0x05U, flags.value());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_all_clear_on_exit_wakes_one_claimant)
+    {
+      Flags             flags;
+      etl::atomic<int>  woken(0);
+
+      std::thread waiter1([&flags, &woken]() { if (flags.wait_all_for(0x03U, 200U, true) == 0x03U) { ++woken; } });
+      std::thread waiter2([&flags, &woken]() { if (flags.wait_all_for(0x03U, 200U, true) == 0x03U) { ++woken; } });
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      flags.set_and_notify(0x03U);
+
+      waiter1.join();
+      waiter2.join();
+
+      CHECK_EQUAL(1, woken.load());
+      CHECK_EQUAL(0x00U, flags.value());
+    }
+#endif
+  }
+}
+
+#endif
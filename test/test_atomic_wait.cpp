@@ -0,0 +1,173 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/atomic_wait.h"
+
+#if ETL_USING_STL
+  #include "etl/atomic/atomic_wait_std.h"
+#endif
+
+#include <thread>
+#include <chrono>
+
+#if ETL_HAS_ATOMIC_WAIT
+
+namespace
+{
+  const uint32_t Round_Trips = 2000U;
+
+  //***************************************************************************
+  /// Passes a count back and forth between two threads with TPlatform.
+  //***************************************************************************
+  template <typename TPlatform>
+  bool ping_pong()
+  {
+    etl::atomic<uint32_t> count(0U);
+
+    std::thread other([&count]()
+    {
+      for (uint32_t i = 1U; i < (2U * Round_Trips); i += 2U)
+      {
+        etl::private_atomic_wait::wait_for<TPlatform>(count, i - 1U, etl::atomic_wait_forever, etl::memory_order_seq_cst);
+        count.store(i + 1U);
+        TPlatform::notify_all(&count);
+      }
+    });
+
+    bool ok = true;
+
+    for (uint32_t i = 0U; i < (2U * Round_Trips); i += 2U)
+    {
+      count.store(i + 1U);
+      TPlatform::notify_all(&count);
+      etl::private_atomic_wait::wait_for<TPlatform>(count, i + 1U, etl::atomic_wait_forever, etl::memory_order_seq_cst);
+
+      ok = ok && (count.load() == (i + 2U));
+    }
+
+    other.join();
+
+    return ok;
+  }
+
+  SUITE(test_atomic_wait)
+  {
+    //*************************************************************************
+    TEST(test_changed_value_does_not_wait)
+    {
+      etl::atomic<int> value(1);
+
+      etl::atomic_wait(value, 0);
+      CHECK(etl::atomic_wait_for(value, 0, 0U));
+      CHECK(etl::atomic_wait_for(value, 0, 1000U));
+    }
+
+    //*************************************************************************
+    TEST(test_timeout)
+    {
+      etl::atomic<uint32_t> value(0U);
+
+      const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      CHECK(!etl::atomic_wait_for(value, 0U, 20U));
+
+      CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+      CHECK(!etl::atomic_wait_for(value, 0U, 0U));
+    }
+
+    //*************************************************************************
+    TEST(test_notify_wakes_waiter)
+    {
+      etl::atomic<int>  value(0);
+      etl::atomic<bool> woken(false);
+
+      std::thread waiter([&value, &woken]()
+      {
+        etl::atomic_wait(value, 0);
+        woken.store(true);
+      });
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      CHECK(!woken.load());
+
+      value.store(1);
+      etl::atomic_notify_one(value);
+
+      waiter.join();
+      CHECK(woken.load());
+    }
+
+    //*************************************************************************
+    TEST(test_notify_wakes_all_waiters)
+    {
+      etl::atomic<int> value(0);
+      etl::atomic<int> woken(0);
+
+      std::thread waiter1([&value, &woken]() { etl::atomic_wait(value, 0); ++woken; });
+      std::thread waiter2([&value, &woken]() { etl::atomic_wait(value, 0); ++woken; });
+      std::thread waiter3([&value, &woken]() { if (etl::atomic_wait_for(value, 0, 10000U)) { ++woken; } });
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+      value.store(1);
+      etl::atomic_notify_all(value);
+
+      waiter1.join();
+      waiter2.join();
+      waiter3.join();
+
+      CHECK_EQUAL(3, woken.load());
+    }
+
+    //*************************************************************************
+    TEST(test_ping_pong)
+    {
+      CHECK(ping_pong<etl::private_atomic_wait::platform>());
+    }
+
+#if ETL_USING_STL
+    //*************************************************************************
+    TEST(test_ping_pong_std)
+    {
+      CHECK(ping_pong<etl::private_atomic_wait::atomic_wait_std>());
+    }
+
+    //*************************************************************************
+    TEST(test_timeout_std)
+    {
+      etl::atomic<uint32_t> value(0U);
+
+      CHECK(!etl::private_atomic_wait::wait_for<etl::private_atomic_wait::atomic_wait_std>(value, 0U, 10U, etl::memory_order_seq_cst));
+    }
+#endif
+  };
+}
+
+#endif
@@ -680,6 +680,203 @@ namespace
       CHECK_THROW((etl::base64::decode(encoded[10].data(), encoded[10].size(),
         decoded_output.data(), decoded_output.size())), etl::base64_overflow);
     }
+    //*************************************************************************
+    TEST(test_decode_invalid_character)
+    {
+      std::array<unsigned char, 16> decoded_output{ 0 };
+      const std::string input("QUJD#EVG");
+
+      CHECK_THROW((etl::base64::decode(input.data(), input.size(),
+        decoded_output.data(), decoded_output.size())), etl::base64_invalid_data);
+    }
+
+    //*************************************************************************
+    TEST(test_decode_without_padding)
+    {
+      std::array<unsigned char, 256> decoded_output;
+
+      for (size_t i = 0; i < 256; ++i)
+      {
+        decoded_output.fill(0);
+
+        std::string input(encoded[i]);
+        input.erase(std::find(input.begin(), input.end(), '='), input.end());
+
+        auto decoded_size = etl::base64::decode(input.data(), input.size(),
+          decoded_output.data(), decoded_output.size());
+
+        CHECK_EQUAL(i, decoded_size);
+        CHECK_ARRAY_EQUAL(input_data_unsigned_char.data(), decoded_output.data(), i);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_encoder_chunked)
+    {
+      for (size_t length = 0; length < 256; length += 7)
+      {
+        for (size_t chunk = 1; chunk <= 8; ++chunk)
+        {
+          std::array<char, 344U> encoded_output;
+          encoded_output.fill(0);
+
+          etl::base64_encoder encoder;
+          size_t size = 0;
+
+          for (size_t i = 0; i < length; i += chunk)
+          {
+            const size_t n = std::min(chunk, length - i);
+
+            CHECK(encoder.encode_size(n) <= (encoded_output.size() - size));
+            size += encoder.encode(input_data_unsigned_char.data() + i, n,
+                                   encoded_output.data() + size, encoded_output.size() - size);
+          }
+
+          const size_t finish_size = encoder.finish_size();
+          CHECK_EQUAL(finish_size, encoder.finish(encoded_output.data() + size, encoded_output.size() - size));
+          size += finish_size;
+
+          std::string expected(encoded[length]);
+          std::string actual(encoded_output.data(), size);
+
+          CHECK_EQUAL(expected, actual);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_encoder_span)
+    {
+      std::array<char, 16U> encoded_output;
+      encoded_output.fill(0);
+
+      etl::base64_encoder encoder;
+
+      etl::span<const unsigned char> input1(input_data_unsigned_char.data(), 4U);
+      etl::span<const unsigned char> input2(input_data_unsigned_char.data() + 4U, 6U);
+
+      size_t size = encoder.encode(input1, etl::span<char>(encoded_output.data(), encoded_output.size()));
+      CHECK_EQUAL(4U, size);
+
+      size += encoder.encode(input2, etl::span<char>(encoded_output.data() + size, encoded_output.size() - size));
+      CHECK_EQUAL(12U, size);
+
+      size += encoder.finish(etl::span<char>(encoded_output.data() + size, encoded_output.size() - size));
+      CHECK_EQUAL(16U, size);
+
+      CHECK_EQUAL(encoded[10], std::string(encoded_output.data(), size));
+    }
+
+    //*************************************************************************
+    TEST(test_encoder_overflow)
+    {
+      std::array<char, 3U> encoded_output;
+
+      etl::base64_encoder encoder;
+
+      CHECK_THROW((encoder.encode(input_data_unsigned_char.data(), 3U, encoded_output.data(), encoded_output.size())), etl::base64_overflow);
+
+      encoder.reset();
+      CHECK_EQUAL(0U, encoder.encode(input_data_unsigned_char.data(), 2U, encoded_output.data(), encoded_output.size()));
+      CHECK_THROW(encoder.finish(encoded_output.data(), encoded_output.size()), etl::base64_overflow);
+    }
+
+    //*************************************************************************
+    TEST(test_decoder_chunked)
+    {
+      for (size_t length = 0; length < 256; length += 5)
+      {
+        for (size_t chunk = 1; chunk <= 9; ++chunk)
+        {
+          std::array<int8_t, 256> decoded_output;
+          decoded_output.fill(0);
+
+          const std::string& input = encoded[length];
+
+          etl::base64_decoder decoder;
+          size_t size = 0;
+
+          for (size_t i = 0; i < input.size(); i += chunk)
+          {
+            const size_t n = std::min(chunk, input.size() - i);
+
+            CHECK(decoder.decode_size(n) <= (decoded_output.size() - size));
+            size += decoder.decode(input.data() + i, n,
+                                   decoded_output.data() + size, decoded_output.size() - size);
+          }
+
+          const size_t finish_size = decoder.finish_size();
+          CHECK_EQUAL(finish_size, decoder.finish(decoded_output.data() + size, decoded_output.size() - size));
+          size += finish_size;
+
+          CHECK_FALSE(decoder.error());
+          CHECK_EQUAL(length, size);
+          CHECK_ARRAY_EQUAL(input_data_int8_t.data(), decoded_output.data(), length);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_decoder_span)
+    {
+      std::array<unsigned char, 10U> decoded_output;
+      decoded_output.fill(0);
+
+      etl::base64_decoder decoder;
+
+      const std::string& input = encoded[10];
+
+      etl::span<const char> input1(input.data(), 6U);
+      etl::span<const char> input2(input.data() + 6U, input.size() - 6U);
+
+      size_t size = decoder.decode(input1, etl::span<unsigned char>(decoded_output.data(), decoded_output.size()));
+      CHECK_EQUAL(3U, size);
+
+      size += decoder.decode(input2, etl::span<unsigned char>(decoded_output.data() + size, decoded_output.size() - size));
+      CHECK_EQUAL(9U, size);
+
+      size += decoder.finish(etl::span<unsigned char>(decoded_output.data() + size, decoded_output.size() - size));
+      CHECK_EQUAL(10U, size);
+
+      CHECK_ARRAY_EQUAL(input_data_unsigned_char.data(), decoded_output.data(), 10U);
+    }
+
+    //*************************************************************************
+    TEST(test_decoder_invalid)
+    {
+      std::array<unsigned char, 16U> decoded_output;
+
+      etl::base64_decoder decoder;
+
+      // Invalid character.
+      CHECK_THROW(decoder.decode("QUJ*", 4U, decoded_output.data(), decoded_output.size()), etl::base64_invalid_data);
+      CHECK_TRUE(decoder.error());
+      CHECK_THROW(decoder.decode("QUJD", 4U, decoded_output.data(), decoded_output.size()), etl::base64_invalid_data);
+
+      // Data after padding.
+      decoder.reset();
+      CHECK_FALSE(decoder.error());
+      CHECK_THROW(decoder.decode("QQ==QUJD", 8U, decoded_output.data(), decoded_output.size()), etl::base64_invalid_data);
+
+      // Padding too early.
+      decoder.reset();
+      CHECK_THROW(decoder.decode("Q===", 4U, decoded_output.data(), decoded_output.size()), etl::base64_invalid_data);
+
+      // Truncated group.
+      decoder.reset();
+      CHECK_EQUAL(3U, decoder.decode("QUJDR", 5U, decoded_output.data(), decoded_output.size()));
+      CHECK_THROW(decoder.finish(decoded_output.data(), decoded_output.size()), etl::base64_invalid_data);
+    }
+
+    //*************************************************************************
+    TEST(test_decoder_overflow)
+    {
+      std::array<unsigned char, 2U> decoded_output;
+
+      etl::base64_decoder decoder;
+
+      CHECK_THROW(decoder.decode("QUJD", 4U, decoded_output.data(), decoded_output.size()), etl::base64_overflow);
+    }
   };
 }
 
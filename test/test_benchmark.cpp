@@ -0,0 +1,190 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/benchmark.h"
+#include "etl/crc32.h"
+
+#include <vector>
+#include <string>
+
+namespace
+{
+  //***************************************************************************
+  // A cycle counter driven by the benchmarks themselves.
+  //***************************************************************************
+  struct FakeCounter
+  {
+    static uint32_t read()
+    {
+      return now;
+    }
+
+    static uint32_t now;
+  };
+
+  uint32_t FakeCounter::now = 0U;
+
+  uint32_t call_count = 0U;
+
+  //***************************************************************************
+  // Costs 100, 110, ..., 190 cycles in turn.
+  //***************************************************************************
+  ETL_BENCHMARK(test_benchmark_variable_cost)
+  {
+    FakeCounter::now += 100U + ((call_count++ % 10U) * 10U);
+  }
+
+  ETL_BENCHMARK(test_benchmark_fixed_cost)
+  {
+    FakeCounter::now += 7U;
+    ++call_count;
+  }
+
+  uint8_t crc_data[256];
+
+  ETL_BENCHMARK(test_benchmark_crc32)
+  {
+    etl::benchmark_do_not_optimise(etl::crc32(crc_data, crc_data + sizeof(crc_data)).value());
+  }
+
+  std::vector<etl::benchmark_result> reported;
+
+  void report(const etl::benchmark_result& result)
+  {
+    reported.push_back(result);
+  }
+
+  SUITE(test_benchmark)
+  {
+    //*************************************************************************
+    TEST(test_registration)
+    {
+      const etl::benchmark* p = etl::benchmark::find("test_benchmark_variable_cost");
+
+      CHECK(p != ETL_NULLPTR);
+      CHECK(p->next() == etl::benchmark::find("test_benchmark_fixed_cost"));
+      CHECK(p->next()->next() == etl::benchmark::find("test_benchmark_crc32"));
+      CHECK(etl::benchmark::find("missing") == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      etl::benchmark_runner<FakeCounter, 10> runner(3U, 10U);
+
+      call_count = 0U;
+
+      etl::benchmark_result result = runner.run(*etl::benchmark::find("test_benchmark_variable_cost"));
+
+      CHECK_EQUAL(13U, call_count);
+      CHECK_EQUAL(0U,   runner.get_overhead());
+      CHECK_EQUAL(std::string("test_benchmark_variable_cost"), std::string(result.name));
+      CHECK_EQUAL(100U, result.min);
+      CHECK_EQUAL(150U, result.median);
+      CHECK_EQUAL(190U, result.max);
+      CHECK_EQUAL(10U,  result.samples);
+      CHECK_EQUAL(1U,   result.batch);
+    }
+
+    //*************************************************************************
+    TEST(test_batch)
+    {
+      etl::benchmark_runner<FakeCounter, 5> runner(0U, 5U, 4U);
+
+      call_count = 0U;
+
+      etl::benchmark_result result = runner.run(*etl::benchmark::find("test_benchmark_fixed_cost"));
+
+      CHECK_EQUAL(20U, call_count);
+      CHECK_EQUAL(7U,  result.min);
+      CHECK_EQUAL(7U,  result.max);
+      CHECK_EQUAL(4U,  result.batch);
+    }
+
+    //*************************************************************************
+    TEST(test_counter_wrap)
+    {
+      etl::benchmark_runner<FakeCounter, 8> runner(0U);
+
+      FakeCounter::now = 0xFFFFFFF0UL;
+
+      etl::benchmark_result result = runner.run(*etl::benchmark::find("test_benchmark_fixed_cost"));
+
+      CHECK_EQUAL(7U, result.min);
+      CHECK_EQUAL(7U, result.max);
+    }
+
+    //*************************************************************************
+    TEST(test_run_all_with_filter)
+    {
+      etl::benchmark_runner<FakeCounter, 4> runner;
+
+      reported.clear();
+      runner.set_reporter(etl::benchmark_runner<FakeCounter, 4>::reporter_type::create<report>());
+
+      CHECK_EQUAL(2U, runner.run_all("_cost"));
+      CHECK_EQUAL(2U, reported.size());
+      CHECK_EQUAL(std::string("test_benchmark_variable_cost"), std::string(reported[0].name));
+      CHECK_EQUAL(std::string("test_benchmark_fixed_cost"),    std::string(reported[1].name));
+      CHECK_EQUAL(7U, reported[1].median);
+
+      CHECK_EQUAL(0U, runner.run_all("no match"));
+    }
+
+#if ETL_HAS_CHRONO_CYCLE_COUNTER
+    //*************************************************************************
+    TEST(test_chrono_counter)
+    {
+      etl::benchmark_runner<etl::chrono_cycle_counter, 15> runner;
+
+      etl::benchmark_result result = runner.run(*etl::benchmark::find("test_benchmark_crc32"));
+
+      CHECK(result.min <= result.median);
+      CHECK(result.median <= result.max);
+      CHECK(result.max > 0U);
+    }
+#endif
+
+#if ETL_HAS_TSC_CYCLE_COUNTER
+    //*************************************************************************
+    TEST(test_tsc_counter)
+    {
+      etl::benchmark_runner<etl::tsc_cycle_counter, 15> runner(2U, 15U, 8U);
+
+      etl::benchmark_result result = runner.run(*etl::benchmark::find("test_benchmark_crc32"));
+
+      CHECK(result.min <= result.median);
+      CHECK(result.median <= result.max);
+      CHECK(result.median > 0U);
+    }
+#endif
+  }
+}
@@ -2456,6 +2456,30 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_count_leading_zeros_64_upper_word_clear)
+    {
+      // Values in [2^28, 2^32) have between 32 and 35 leading zeros.
+      const uint64_t values[] = { 0x10000000ULL, 0x1FFFFFFFULL, 0x20000000ULL, 0x3FFFFFFFULL,
+                                  0x395A0000ULL, 0x40000000ULL, 0x7FFFFFFFULL, 0x80000000ULL,
+                                  0xFFFFFFFFULL, 962201856ULL };
+
+      for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+      {
+        CHECK_EQUAL(int(test_leading_zeros(values[i])), int(etl::count_leading_zeros(values[i])));
+      }
+
+      for (uint64_t value = 0x10000000ULL; value < 0x100000000ULL; value += 0x0000FFF1ULL)
+      {
+        CHECK_EQUAL(int(test_leading_zeros(value)), int(etl::count_leading_zeros(value)));
+
+        if (test_leading_zeros(value) != etl::count_leading_zeros(value))
+        {
+          break;
+        }
+      }
+    }
+
 #if !defined(ETL_FORCE_NO_ADVANCED_CPP)
     //*************************************************************************
     TEST(test_count_leading_zeros_64_constexpr)
@@ -3000,6 +3024,125 @@ namespace
 
       CHECK_ARRAY_EQUAL(expected.data(), output.data(), expected.size());
     }
+
+    //*************************************************************************
+    TEST(test_pdep_pext)
+    {
+      CHECK_EQUAL(0x00U, etl::pdep(uint8_t(0x00U), uint8_t(0xF0U)));
+      CHECK_EQUAL(0xA0U, etl::pdep(uint8_t(0x0AU), uint8_t(0xF0U)));
+      CHECK_EQUAL(0x12U, etl::pdep(uint8_t(0x05U), uint8_t(0x1AU)));
+      CHECK_EQUAL(0x0AU, etl::pext(uint8_t(0xA5U), uint8_t(0xF0U)));
+      CHECK_EQUAL(0x05U, etl::pext(uint8_t(0x12U), uint8_t(0x1AU)));
+
+      CHECK_EQUAL(0x80000001UL, etl::pdep(uint32_t(0x3U), uint32_t(0x80000001UL)));
+      CHECK_EQUAL(0x3UL,        etl::pext(uint32_t(0xFFFFFFFFUL), uint32_t(0x80000001UL)));
+      CHECK_EQUAL(0x0UL,        etl::pdep(uint32_t(0xFFFFFFFFUL), uint32_t(0U)));
+
+      CHECK_EQUAL(0x8000000000000001ULL, etl::pdep(uint64_t(0x3U), uint64_t(0x8000000000000001ULL)));
+      CHECK_EQUAL(0xFFFFFFFFULL,         etl::pext(uint64_t(0xFFFFFFFFFFFFFFFFULL), uint64_t(0xF0F0F0F0F0F0F0F0ULL)));
+
+      // pext undoes pdep for the bits of the mask.
+      uint32_t seed = 1U;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        seed = (seed * 1664525U) + 1013904223U;
+        const uint32_t mask  = seed;
+        seed = (seed * 1664525U) + 1013904223U;
+        const uint32_t value = seed;
+
+        CHECK_EQUAL(value & mask, etl::pdep(etl::pext(value, mask), mask));
+      }
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_pdep_pext_constexpr)
+    {
+      constexpr uint16_t deposited = etl::pdep(uint16_t(0x00FFU), uint16_t(0xAAAAU));
+      constexpr uint16_t extracted = etl::pext(uint16_t(0xAAAAU), uint16_t(0xAAAAU));
+
+      CHECK_EQUAL(0xAAAAU, deposited);
+      CHECK_EQUAL(0x00FFU, extracted);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_morton_2d)
+    {
+      CHECK_EQUAL(0x00000000UL, etl::morton_encode2(uint32_t(0U), uint32_t(0U)));
+      CHECK_EQUAL(0x00000001UL, etl::morton_encode2(uint32_t(1U), uint32_t(0U)));
+      CHECK_EQUAL(0x00000002UL, etl::morton_encode2(uint32_t(0U), uint32_t(1U)));
+      CHECK_EQUAL(0x55555555UL, etl::morton_encode2(uint32_t(0xFFFFU), uint32_t(0U)));
+      CHECK_EQUAL(0xFFFFFFFFUL, etl::morton_encode2(uint32_t(0xFFFFU), uint32_t(0xFFFFU)));
+
+      // Every 16 bit code, against the bit deposit.
+      for (uint32_t code = 0U; code < 0x10000UL; ++code)
+      {
+        const uint16_t x = uint16_t(etl::pext(code, uint32_t(0x55555555UL)));
+        const uint16_t y = uint16_t(etl::pext(code, uint32_t(0xAAAAAAAAUL)));
+
+        CHECK_EQUAL(code, etl::morton_encode2(uint32_t(x), uint32_t(y)));
+
+        uint16_t dx = 0U;
+        uint16_t dy = 0U;
+        etl::morton_decode2(uint16_t(code), dx, dy);
+
+        CHECK_EQUAL(uint16_t(x & 0xFFU), dx);
+        CHECK_EQUAL(uint16_t(y & 0xFFU), dy);
+      }
+
+      uint64_t x = 0U;
+      uint64_t y = 0U;
+      const uint64_t code = etl::morton_encode2(uint64_t(0xDEADBEEFUL), uint64_t(0x12345678UL));
+
+      CHECK_EQUAL(etl::pdep(uint64_t(0xDEADBEEFUL), uint64_t(0x5555555555555555ULL)) | etl::pdep(uint64_t(0x12345678UL), uint64_t(0xAAAAAAAAAAAAAAAAULL)), code);
+
+      etl::morton_decode2(code, x, y);
+      CHECK_EQUAL(0xDEADBEEFULL, x);
+      CHECK_EQUAL(0x12345678ULL, y);
+    }
+
+    //*************************************************************************
+    TEST(test_morton_3d)
+    {
+      CHECK_EQUAL(0x1UL, etl::morton_encode3(uint32_t(1U), uint32_t(0U), uint32_t(0U)));
+      CHECK_EQUAL(0x2UL, etl::morton_encode3(uint32_t(0U), uint32_t(1U), uint32_t(0U)));
+      CHECK_EQUAL(0x4UL, etl::morton_encode3(uint32_t(0U), uint32_t(0U), uint32_t(1U)));
+      CHECK_EQUAL(0x3FFFFFFFUL, etl::morton_encode3(uint32_t(0x3FFU), uint32_t(0x3FFU), uint32_t(0x3FFU)));
+
+      for (uint32_t i = 0U; i < 0x400UL; i += 7U)
+      {
+        const uint32_t x = i;
+        const uint32_t y = 0x3FFU - i;
+        const uint32_t z = (i * 5U) & 0x3FFU;
+
+        const uint32_t code = etl::morton_encode3(x, y, z);
+
+        CHECK_EQUAL(etl::pdep(x, uint32_t(0x09249249UL)) | etl::pdep(y, uint32_t(0x12492492UL)) | etl::pdep(z, uint32_t(0x24924924UL)), code);
+
+        uint32_t dx = 0U;
+        uint32_t dy = 0U;
+        uint32_t dz = 0U;
+        etl::morton_decode3(code, dx, dy, dz);
+
+        CHECK_EQUAL(x, dx);
+        CHECK_EQUAL(y, dy);
+        CHECK_EQUAL(z, dz);
+      }
+
+      uint64_t x = 0U;
+      uint64_t y = 0U;
+      uint64_t z = 0U;
+      const uint64_t code = etl::morton_encode3(uint64_t(0x1FFFFFU), uint64_t(0x12345U), uint64_t(0x0U));
+
+      CHECK_EQUAL(etl::pdep(uint64_t(0x1FFFFFU), uint64_t(0x1249249249249249ULL)) | etl::pdep(uint64_t(0x12345U), uint64_t(0x2492492492492492ULL)), code);
+
+      etl::morton_decode3(code, x, y, z);
+      CHECK_EQUAL(0x1FFFFFULL, x);
+      CHECK_EQUAL(0x12345ULL, y);
+      CHECK_EQUAL(0x0ULL, z);
+    }
   };
 }
 
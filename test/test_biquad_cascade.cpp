@@ -0,0 +1,142 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/biquad_cascade.h"
+
+#include <array>
+
+namespace
+{
+  SUITE(test_biquad_cascade)
+  {
+    //*************************************************************************
+    TEST(test_double_matches_reference)
+    {
+      // A low pass and a high pass section.
+      const etl::biquad_coefficients<double> c[2] =
+      {
+        { 0.0675, 0.1349, 0.0675, -1.1430, 0.4128 },
+        { 0.6389, -1.2779, 0.6389, -1.1430, 0.4128 }
+      };
+
+      etl::biquad_cascade<double, 2U> filter(c);
+
+      double x1[2] = { 0.0, 0.0 };
+      double x2[2] = { 0.0, 0.0 };
+      double y1[2] = { 0.0, 0.0 };
+      double y2[2] = { 0.0, 0.0 };
+
+      for (int n = 0; n < 50; ++n)
+      {
+        double x = ((n % 7) < 3) ? 1.0 : -0.5;
+        const double result = filter.process(x);
+
+        for (size_t s = 0U; s < 2U; ++s)
+        {
+          const double y = (c[s].b0 * x) + (c[s].b1 * x1[s]) + (c[s].b2 * x2[s]) - (c[s].a1 * y1[s]) - (c[s].a2 * y2[s]);
+          x2[s] = x1[s];
+          x1[s] = x;
+          y2[s] = y1[s];
+          y1[s] = y;
+          x = y;
+        }
+
+        CHECK_CLOSE(x, result, 0.000001);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_q14)
+    {
+      // y = 0.5x + 0.5y[n-1] in Q14.
+      const etl::biquad_coefficients<int16_t> c[1] = { { 8192, 0, 0, -8192, 0 } };
+
+      etl::biquad_cascade<int16_t, 1U> filter(c);
+
+      CHECK_EQUAL(500, filter.process(1000));
+      CHECK_EQUAL(750, filter.process(1000));
+      CHECK_EQUAL(875, filter.process(1000));
+      CHECK_EQUAL(938, filter.process(1000));
+
+      filter.reset();
+      CHECK_EQUAL(500, filter(1000));
+    }
+
+    //*************************************************************************
+    TEST(test_q14_saturates)
+    {
+      // A gain of 1.9999 in Q14.
+      const etl::biquad_coefficients<int16_t> c[1] = { { 32767, 0, 0, 0, 0 } };
+
+      etl::biquad_cascade<int16_t, 1U> filter(c);
+
+      CHECK_EQUAL(32767,  filter.process(30000));
+      CHECK_EQUAL(-32768, filter.process(-30000));
+    }
+
+    //*************************************************************************
+    TEST(test_block_matches_single_samples)
+    {
+      const etl::biquad_coefficients<int32_t> c[3] =
+      {
+        { 72478720, 144957440, 72478720, -1227277107, 443242004 },
+        { 686012000, -1372024000, 686012000, -1227277107, 443242004 },
+        { 1073741824, 0, 0, 536870912, 0 }
+      };
+
+      std::array<int32_t, 41> input;
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        input[i] = (((int32_t(i) * 7919) % 2000) - 1000) * 100000;
+      }
+
+      etl::biquad_cascade<int32_t, 3U> single(c);
+      etl::biquad_cascade<int32_t, 3U> block(c);
+      etl::biquad_cascade<int32_t, 3U> in_place(c);
+
+      std::array<int32_t, 41> output;
+      std::array<int32_t, 41> inout = input;
+
+      // Two blocks, to check that the state carries over.
+      block.process(etl::span<const int32_t>(input.data(), 20U), etl::span<int32_t>(output.data(), 20U));
+      block.process(etl::span<const int32_t>(input.data() + 20U, 21U), etl::span<int32_t>(output.data() + 20U, 21U));
+      CHECK_EQUAL(input.size(), in_place.process(etl::span<const int32_t>(inout.data(), inout.size()), etl::span<int32_t>(inout.data(), inout.size())));
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        const int32_t expected = single.process(input[i]);
+        CHECK_EQUAL(expected, output[i]);
+        CHECK_EQUAL(expected, inout[i]);
+      }
+    }
+  };
+}
@@ -31,12 +31,28 @@ SOFTWARE.
 #include "etl/bit_stream.h"
 
 #include <array>
+#include <vector>
 #include <numeric>
 
 #include "etl/private/diagnostic_useless_cast_push.h"
 
 namespace
 {
+  //***********************************
+  // Appends bits to a buffer one at a time, least significant first.
+  void append_bits(std::vector<char>& buffer, size_t& position, uint64_t value, uint_least8_t nbits)
+  {
+    for (uint_least8_t i = 0U; i < nbits; ++i)
+    {
+      if (((value >> i) & 1U) != 0U)
+      {
+        buffer[position / 8U] |= static_cast<char>(0x80U >> (position % 8U));
+      }
+
+      ++position;
+    }
+  }
+
   //***********************************
   struct Object
   {
@@ -1192,6 +1208,64 @@ namespace
       CHECK_EQUAL(object2.i, result2.i);
       CHECK_EQUAL(object2.c, result2.c);
     }
+
+    //*************************************************************************
+    TEST(test_read_every_width_matches_bit_by_bit)
+    {
+      // 1 + 2 + ... + 64 bits fills the buffer exactly, so the end is read char by char.
+      std::vector<char> storage(260U, 0);
+      size_t   position = 0U;
+      uint64_t value    = 0x0123456789ABCDEFULL;
+
+      for (uint_least8_t nbits = 1U; nbits <= 64U; ++nbits)
+      {
+        value = (value * 6364136223846793005ULL) + 1442695040888963407ULL;
+        append_bits(storage, position, value, nbits);
+      }
+
+      etl::bit_stream_reader bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      value = 0x0123456789ABCDEFULL;
+
+      for (uint_least8_t nbits = 1U; nbits <= 64U; ++nbits)
+      {
+        value = (value * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+        const uint64_t mask = (nbits == 64U) ? ~0ULL : ((1ULL << nbits) - 1U);
+
+        etl::optional<uint64_t> result = bit_stream.read<uint64_t>(nbits);
+
+        CHECK(result.has_value());
+        CHECK_EQUAL(value & mask, result.value());
+      }
+
+      CHECK(!bit_stream.read<bool>().has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_read_span)
+    {
+      const int16_t values[] = { 1, -1, -1024, 1023, 0 };
+
+      std::vector<char> storage(7U, 0);
+      size_t position = 0U;
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        append_bits(storage, position, static_cast<uint16_t>(values[i]), 11U);
+      }
+
+      int16_t result[5];
+
+      etl::bit_stream_reader bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      CHECK(bit_stream.read(etl::span<int16_t>(result), 11U));
+      CHECK_ARRAY_EQUAL(values, result, 5U);
+
+      // Only one bit is left, and it is not consumed.
+      CHECK(!bit_stream.read(etl::span<int16_t>(result), 11U));
+      CHECK(bit_stream.read<bool>().has_value());
+    }
   };
 }
 
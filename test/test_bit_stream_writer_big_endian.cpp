@@ -38,6 +38,21 @@ SOFTWARE.
 
 namespace
 {
+  //***********************************
+  // Appends bits to a buffer one at a time, most significant first.
+  void append_bits(std::vector<char>& buffer, size_t& position, uint64_t value, uint_least8_t nbits)
+  {
+    for (uint_least8_t i = nbits; i > 0U; --i)
+    {
+      if (((value >> (i - 1U)) & 1U) != 0U)
+      {
+        buffer[position / 8U] |= static_cast<char>(0x80U >> (position % 8U));
+      }
+
+      ++position;
+    }
+  }
+
   //***********************************
   struct Object
   {
@@ -793,6 +808,55 @@ namespace
       CHECK_EQUAL((int)expected[10], (int)storage[10]);
       CHECK_EQUAL((int)expected[11], (int)storage[11]);
     }
+
+    //*************************************************************************
+    TEST(test_write_every_width_matches_bit_by_bit)
+    {
+      // 1 + 2 + ... + 64 bits fills the buffer exactly, so the end is written char by char.
+      std::vector<char> storage(260U, 0);
+      std::vector<char> expected(260U, 0);
+      size_t   position = 0U;
+      uint64_t value    = 0x0123456789ABCDEFULL;
+
+      etl::bit_stream_writer bit_stream(storage.data(), storage.size(), etl::endian::big);
+
+      for (uint_least8_t nbits = 1U; nbits <= 64U; ++nbits)
+      {
+        value = (value * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+        CHECK(bit_stream.write(value, nbits));
+        append_bits(expected, position, value, nbits);
+      }
+
+      CHECK(bit_stream.full());
+      CHECK_ARRAY_EQUAL(expected.data(), storage.data(), expected.size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_span)
+    {
+      const uint16_t values[] = { 0x001U, 0x7FFU, 0x2AAU, 0x555U, 0x000U };
+
+      std::vector<char> storage(7U, 0);
+      std::vector<char> expected(7U, 0);
+      size_t position = 0U;
+
+      etl::bit_stream_writer bit_stream(storage.data(), storage.size(), etl::endian::big);
+
+      CHECK(bit_stream.write(etl::span<const uint16_t>(values), 11U));
+      CHECK_EQUAL(55U, bit_stream.size_bits());
+
+      // There is not room for another five.
+      CHECK(!bit_stream.write(etl::span<const uint16_t>(values), 11U));
+      CHECK_EQUAL(55U, bit_stream.size_bits());
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        append_bits(expected, position, values[i], 11U);
+      }
+
+      CHECK_ARRAY_EQUAL(expected.data(), storage.data(), expected.size());
+    }
   };
 }
 
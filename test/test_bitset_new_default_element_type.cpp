@@ -31,6 +31,7 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <vector>
 
 #include "etl/private/bitset_new.h"
 #include "etl/string.h"
@@ -2074,6 +2075,181 @@ namespace
       CHECK_EQUAL(4U, bs4find_next_true1);
     }
 
+    //*************************************************************************
+    template <size_t Active_Bits, typename TElement>
+    bool shifts_match_std_bitset()
+    {
+      etl::bitset<Active_Bits, TElement> data;
+      std::bitset<Active_Bits>           compare;
+
+      for (size_t i = 0U; i < Active_Bits; ++i)
+      {
+        const bool state = ((i * 7U) % 3U) == 0U;
+        data.set(i, state);
+        compare.set(i, state);
+      }
+
+      for (size_t shift = 0U; shift <= (Active_Bits + 1U); ++shift)
+      {
+        etl::bitset<Active_Bits, TElement> left  = data << shift;
+        etl::bitset<Active_Bits, TElement> right = data >> shift;
+
+        std::bitset<Active_Bits> compare_left  = compare << shift;
+        std::bitset<Active_Bits> compare_right = compare >> shift;
+
+        if ((left.count() != compare_left.count()) || (right.count() != compare_right.count()))
+        {
+          return false;
+        }
+
+        for (size_t i = 0U; i < Active_Bits; ++i)
+        {
+          if ((left[i] != compare_left[i]) || (right[i] != compare_right[i]))
+          {
+            return false;
+          }
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    TEST(test_shifts_match_std_bitset)
+    {
+      CHECK((shifts_match_std_bitset<12,   uint8_t>()));
+      CHECK((shifts_match_std_bitset<64,   uint8_t>()));
+      CHECK((shifts_match_std_bitset<300,  uint8_t>()));
+      CHECK((shifts_match_std_bitset<129,  uint16_t>()));
+      CHECK((shifts_match_std_bitset<200,  uint32_t>()));
+      CHECK((shifts_match_std_bitset<1000, uint64_t>()));
+    }
+
+    //*************************************************************************
+    TEST(test_count_wide_buffer)
+    {
+      etl::bitset<1003> data;
+      size_t expected = 0U;
+
+      for (size_t i = 0U; i < 1003U; i += 3U)
+      {
+        data.set(i);
+        ++expected;
+      }
+
+      CHECK_EQUAL(expected, data.count());
+
+      data.set();
+      CHECK_EQUAL(1003U, data.count());
+    }
+
+    //*************************************************************************
+    TEST(test_set_bits)
+    {
+      etl::bitset<1000> bs;
+      std::vector<size_t> expected;
+
+      for (size_t i = 0U; i < 1000U; i += ((i % 7U) + 1U))
+      {
+        bs.set(i);
+        expected.push_back(i);
+      }
+
+      bs.set(999U);
+      expected.push_back(999U);
+
+      std::vector<size_t> actual;
+
+      for (etl::bitset<1000>::set_bit_iterator itr = bs.set_bits().begin(); itr != bs.set_bits().end(); ++itr)
+      {
+        actual.push_back(*itr);
+      }
+
+      CHECK(expected == actual);
+
+      std::vector<size_t> visited;
+      bs.for_each_set_bit([&visited](size_t position) { visited.push_back(position); });
+
+      CHECK(expected == visited);
+
+      etl::bitset<1000> empty;
+      CHECK(empty.set_bits().begin() == empty.set_bits().end());
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_matches_sequential_search)
+    {
+      etl::bitset<300> bs;
+
+      for (size_t i = 0U; i < 300U; i += ((i % 11U) + 1U))
+      {
+        bs.set(i);
+      }
+
+      for (size_t position = 0U; position < 310U; ++position)
+      {
+        size_t expected_true  = etl::bitset<>::npos;
+        size_t expected_false = etl::bitset<>::npos;
+
+        for (size_t i = position; i < 300U; ++i)
+        {
+          if (bs.test(i) && (expected_true == etl::bitset<>::npos))
+          {
+            expected_true = i;
+          }
+
+          if (!bs.test(i) && (expected_false == etl::bitset<>::npos))
+          {
+            expected_false = i;
+          }
+        }
+
+        CHECK_EQUAL(expected_true,  bs.find_next(true, position));
+        CHECK_EQUAL(expected_false, bs.find_next(false, position));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_rank_select)
+    {
+      etl::bitset<200> bs;
+
+      for (size_t i = 3U; i < 200U; i += 5U)
+      {
+        bs.set(i);
+      }
+
+      for (size_t position = 0U; position <= 210U; ++position)
+      {
+        size_t expected = 0U;
+
+        for (size_t i = 0U; (i < position) && (i < 200U); ++i)
+        {
+          expected += bs.test(i) ? 1U : 0U;
+        }
+
+        CHECK_EQUAL(expected, bs.rank(position));
+      }
+
+      const size_t count = bs.count();
+
+      for (size_t n = 0U; n < count; ++n)
+      {
+        const size_t position = bs.select(n);
+
+        CHECK_EQUAL(3U + (n * 5U), position);
+        CHECK_EQUAL(n, bs.rank(position));
+      }
+
+      CHECK_EQUAL(etl::bitset<>::npos, bs.select(count));
+
+      ETL_CONSTEXPR14 etl::bitset<16> bs2(ull(0x8421));
+      ETL_CONSTEXPR14 size_t rank8 = bs2.rank(8U);
+      ETL_CONSTEXPR14 size_t select2 = bs2.select(2U);
+      CHECK_EQUAL(2U, rank8);
+      CHECK_EQUAL(10U, select2);
+    }
+
     //*************************************************************************
     ETL_CONSTEXPR14 std::pair<etl::bitset<8>, etl::bitset<8>> test_swap_helper()
     {
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <vector>
 
 #include "etl/private/bitset_new.h"
 #include "etl/string.h"
@@ -2196,6 +2197,50 @@ namespace
       CHECK_EQUAL(4U, bs4find_next_true1);
     }
 
+    //*************************************************************************
+    TEST(test_shift_left_clears_unused_bits)
+    {
+      etl::bitset<12, uint16_t> data;
+      data.set();
+
+      data <<= 1U;
+      CHECK_EQUAL(11U, data.count());
+
+      etl::bitset<12, uint16_t> shifted = data << 4U;
+      CHECK_EQUAL(7U, shifted.count());
+    }
+
+    //*************************************************************************
+    TEST(test_set_bits_find_next_rank_select_64)
+    {
+      etl::bitset<64, uint64_t> bs(0x8000000100000101ULL);
+
+      std::vector<size_t> actual;
+
+      for (etl::bitset<64, uint64_t>::set_bit_range::iterator itr = bs.set_bits().begin(); itr != bs.set_bits().end(); ++itr)
+      {
+        actual.push_back(*itr);
+      }
+
+      std::vector<size_t> expected = { 0U, 8U, 32U, 63U };
+      CHECK(expected == actual);
+
+      CHECK_EQUAL(32U, bs.find_next(true, 9U));
+      CHECK_EQUAL(63U, bs.find_next(true, 33U));
+      CHECK_EQUAL(etl::bitset<>::npos, bs.find_next(false, 63U));
+      CHECK_EQUAL(62U, bs.find_next(false, 62U));
+
+      CHECK_EQUAL(2U, bs.rank(32U));
+      CHECK_EQUAL(3U, bs.rank(63U));
+      CHECK_EQUAL(4U, bs.rank(64U));
+      CHECK_EQUAL(63U, bs.select(3U));
+      CHECK_EQUAL(etl::bitset<>::npos, bs.select(4U));
+
+      size_t sum = 0U;
+      bs.for_each_set_bit([&sum](size_t position) { sum += position; });
+      CHECK_EQUAL(0U + 8U + 32U + 63U, sum);
+    }
+
     //*************************************************************************
     ETL_CONSTEXPR14 std::pair<etl::bitset<8, uint8_t>, etl::bitset<8, uint8_t>> test_swap_helper()
     {
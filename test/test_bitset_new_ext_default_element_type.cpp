@@ -31,6 +31,7 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <vector>
 
 #include "etl/private/bitset_new.h"
 #include "etl/string.h"
@@ -1773,6 +1774,35 @@ namespace
       CHECK_EQUAL(4U, bs4fnt1);
     }
 
+    //*************************************************************************
+    TEST(test_set_bits_rank_select)
+    {
+      etl::bitset_ext<100>::buffer_type buffer;
+      etl::bitset_ext<100> bs(buffer);
+
+      bs.set(1U);
+      bs.set(50U);
+      bs.set(99U);
+
+      std::vector<size_t> actual;
+
+      for (etl::bitset_ext<100>::set_bit_iterator itr = bs.set_bits().begin(); itr != bs.set_bits().end(); ++itr)
+      {
+        actual.push_back(*itr);
+      }
+
+      std::vector<size_t> expected = { 1U, 50U, 99U };
+      CHECK(expected == actual);
+
+      CHECK_EQUAL(1U, bs.rank(50U));
+      CHECK_EQUAL(3U, bs.rank(100U));
+      CHECK_EQUAL(99U, bs.select(2U));
+
+      size_t n = 0U;
+      bs.for_each_set_bit([&n](size_t) { ++n; });
+      CHECK_EQUAL(3U, n);
+    }
+
     //*************************************************************************
     TEST(test_swap)
     {
@@ -0,0 +1,153 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/blocking_queue.h"
+#include "etl/queue_spsc_atomic.h"
+
+#include <thread>
+#include <chrono>
+
+#if ETL_HAS_ATOMIC_WAIT
+
+namespace
+{
+  const uint32_t Values = 20000U;
+
+  typedef etl::blocking_queue<etl::queue_spsc_atomic<uint32_t, 8U> > Queue;
+
+  SUITE(test_blocking_queue)
+  {
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(8U, queue.capacity());
+
+      for (uint32_t i = 0U; i < 8U; ++i)
+      {
+        CHECK(queue.push(i));
+      }
+
+      CHECK(queue.full());
+      CHECK(!queue.push(8U));
+      CHECK_EQUAL(8U, queue.size());
+
+      uint32_t value = 0U;
+
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(0U, value);
+      CHECK(queue.pop_wait(value, 0U));
+      CHECK_EQUAL(1U, value);
+      CHECK(queue.pop_wait(value));
+      CHECK_EQUAL(2U, value);
+      CHECK_EQUAL(5U, queue.get_queue().size());
+    }
+
+    //*************************************************************************
+    TEST(test_pop_wait_times_out)
+    {
+      Queue queue;
+
+      uint32_t value = 99U;
+
+      const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      CHECK(!queue.pop_wait(value, 20U));
+      CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+      CHECK_EQUAL(99U, value);
+
+      CHECK(!queue.pop_wait(value, 0U));
+    }
+
+    //*************************************************************************
+    TEST(test_pop_wait_wakes_on_push)
+    {
+      Queue queue;
+
+      uint32_t value = 0U;
+
+      std::thread consumer([&queue, &value]()
+      {
+        queue.pop_wait(value);
+      });
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      queue.push(42U);
+
+      consumer.join();
+
+      CHECK_EQUAL(42U, value);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      Queue queue;
+
+      bool in_order = true;
+
+      std::thread consumer([&queue, &in_order]()
+      {
+        for (uint32_t i = 0U; i < Values; ++i)
+        {
+          uint32_t value = 0U;
+
+          if (!queue.pop_wait(value, 10000U) || (value != i))
+          {
+            in_order = false;
+          }
+        }
+      });
+
+      for (uint32_t i = 0U; i < Values; ++i)
+      {
+        while (!queue.push(i))
+        {
+          std::this_thread::yield();
+        }
+
+        // Let the consumer catch up and sleep now and then.
+        if ((i % 1000U) == 0U)
+        {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+      }
+
+      consumer.join();
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+  };
+}
+
+#endif
@@ -29,6 +29,7 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include <vector>
+#include <iterator>
 #include <string.h>
 
 #include "etl/bloom_filter.h"
@@ -260,6 +261,208 @@ namespace
 
       CHECK(!any_exist);
     }
+    //*************************************************************************
+    TEST(test_counting_bloom_filter)
+    {
+      typedef etl::counting_bloom_filter<1000, hash1_t, hash2_t, hash3_t> Bloom;
+      Bloom bloom;
+
+      CHECK_EQUAL(1024U, bloom.width());
+      CHECK_EQUAL(1024U, Bloom::WIDTH);
+      CHECK_EQUAL(0U, bloom.count());
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      CHECK(bloom.count() > 0U);
+      CHECK(bloom.usage() > 0U);
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        CHECK(bloom.exists(exist_text[i]));
+      }
+
+      for (size_t i = 0UL; i < not_exist_text.size(); ++i)
+      {
+        CHECK(!bloom.exists(not_exist_text[i]));
+        CHECK(!bloom.remove(not_exist_text[i]));
+      }
+
+      // Remove half of the keys.
+      for (size_t i = 0UL; i < exist_text.size(); i += 2U)
+      {
+        CHECK(bloom.remove(exist_text[i]));
+      }
+
+      for (size_t i = 1UL; i < exist_text.size(); i += 2U)
+      {
+        CHECK(bloom.exists(exist_text[i]));
+      }
+
+      // Remove the rest.
+      for (size_t i = 1UL; i < exist_text.size(); i += 2U)
+      {
+        CHECK(bloom.remove(exist_text[i]));
+      }
+
+      CHECK_EQUAL(0U, bloom.count());
+    }
+
+    //*************************************************************************
+    TEST(test_counting_bloom_filter_saturation)
+    {
+      etl::counting_bloom_filter<16, hash1_t> bloom;
+
+      for (size_t i = 0UL; i < 20U; ++i)
+      {
+        bloom.add("saturate");
+      }
+
+      CHECK_EQUAL(1U, bloom.saturated());
+
+      // A saturated counter is never decremented.
+      for (size_t i = 0UL; i < 20U; ++i)
+      {
+        bloom.remove("saturate");
+      }
+
+      CHECK(bloom.exists("saturate"));
+
+      bloom.clear();
+
+      CHECK_EQUAL(0U, bloom.saturated());
+      CHECK(!bloom.exists("saturate"));
+    }
+
+    //*************************************************************************
+    struct int_hash_t
+    {
+      typedef uint32_t argument_type;
+
+      size_t operator ()(argument_type value) const
+      {
+        return etl::fnv_1a_32(reinterpret_cast<const uint8_t*>(&value), reinterpret_cast<const uint8_t*>(&value) + sizeof(value));
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter)
+    {
+      etl::blocked_bloom_filter<4096, hash1_t> bloom;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        CHECK(bloom.exists(exist_text[i]));
+      }
+
+      for (size_t i = 0UL; i < not_exist_text.size(); ++i)
+      {
+        CHECK(!bloom.exists(not_exist_text[i]));
+      }
+
+      // K distinct bits per key, at most.
+      CHECK(bloom.count() <= (exist_text.size() * 8U));
+      CHECK(bloom.count() > 8U);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_width)
+    {
+      typedef etl::blocked_bloom_filter<1000, hash1_t> Bloom;
+      Bloom bloom;
+
+      CHECK_EQUAL(1024U, bloom.width());
+      CHECK_EQUAL(1024U, Bloom::WIDTH);
+      CHECK_EQUAL(2U, bloom.block_count());
+      CHECK_EQUAL(0U, bloom.count());
+      CHECK_EQUAL(0U, bloom.usage());
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_batch)
+    {
+      etl::blocked_bloom_filter<8192, int_hash_t, 6> bloom;
+
+      std::vector<uint32_t> added;
+      std::vector<uint32_t> tested;
+
+      for (uint32_t i = 0U; i < 500U; ++i)
+      {
+        added.push_back(i * 7919U);
+      }
+
+      for (uint32_t i = 0U; i < 1000U; ++i)
+      {
+        tested.push_back(i * 3U);
+      }
+
+      bloom.add(etl::span<const uint32_t>(added.data(), added.size()));
+
+      std::vector<bool> results;
+      bloom.exists(etl::span<const uint32_t>(tested.data(), tested.size()), std::back_inserter(results));
+
+      CHECK_EQUAL(tested.size(), results.size());
+
+      for (size_t i = 0UL; i < tested.size(); ++i)
+      {
+        CHECK_EQUAL(bloom.exists(tested[i]), bool(results[i]));
+      }
+
+      // No false negatives.
+      bool all_exist[500];
+      bool* p_end = bloom.exists(added.begin(), added.end(), all_exist);
+      CHECK(p_end == all_exist + 500);
+
+      for (size_t i = 0UL; i < added.size(); ++i)
+      {
+        CHECK(all_exist[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_false_positive_rate)
+    {
+      etl::blocked_bloom_filter<16384, int_hash_t> bloom;
+
+      for (uint32_t i = 0U; i < 1000U; ++i)
+      {
+        bloom.add(i);
+      }
+
+      size_t false_positives = 0U;
+
+      for (uint32_t i = 1000U; i < 11000U; ++i)
+      {
+        false_positives += bloom.exists(i) ? 1U : 0U;
+      }
+
+      // About 0.5% expected for 16 bits per key and K = 8.
+      CHECK(false_positives < 200U);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_clear)
+    {
+      etl::blocked_bloom_filter<512, hash1_t, 3> bloom;
+
+      bloom.add(exist_text.begin(), exist_text.end());
+      CHECK(bloom.count() > 0U);
+
+      bloom.clear();
+
+      CHECK_EQUAL(0U, bloom.count());
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        CHECK(!bloom.exists(exist_text[i]));
+      }
+    }
   };
 }
-
@@ -0,0 +1,346 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/broadcast_ring.h"
+
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_SEQLOCK
+
+namespace
+{
+  typedef etl::broadcast_ring<uint32_t, 4U, 3U> Ring;
+
+  const uint32_t Writes = 50000U;
+
+  //***************************************************************************
+  /// A ring with its counts starting just before they wrap.
+  //***************************************************************************
+  class WrapRing : public Ring
+  {
+  public:
+
+    WrapRing()
+      : Ring(UINT32_C(0xFFFFFFFF) - 5U)
+    {
+    }
+  };
+
+  SUITE(test_broadcast_ring)
+  {
+    //*************************************************************************
+    TEST(test_subscribe)
+    {
+      Ring ring;
+
+      CHECK_EQUAL(4U, ring.capacity());
+      CHECK_EQUAL(3U, ring.max_readers());
+
+      const Ring::reader_id r0 = ring.subscribe();
+      const Ring::reader_id r1 = ring.subscribe();
+      const Ring::reader_id r2 = ring.subscribe();
+
+      CHECK_EQUAL(0U, r0);
+      CHECK_EQUAL(1U, r1);
+      CHECK_EQUAL(2U, r2);
+      CHECK_EQUAL(Ring::No_Reader, ring.subscribe());
+
+      CHECK(ring.is_subscribed(r1));
+      ring.unsubscribe(r1);
+      CHECK(!ring.is_subscribed(r1));
+      CHECK(!ring.is_subscribed(Ring::No_Reader));
+
+      CHECK_EQUAL(r1, ring.subscribe());
+    }
+
+    //*************************************************************************
+    TEST(test_every_reader_sees_every_value)
+    {
+      Ring ring;
+
+      const Ring::reader_id r0 = ring.subscribe();
+      const Ring::reader_id r1 = ring.subscribe();
+
+      uint32_t value = 0U;
+      CHECK(!ring.pop(r0, value));
+      CHECK(ring.empty(r0));
+
+      ring.push(10U);
+      ring.push(11U);
+      ring.push(12U);
+
+      CHECK_EQUAL(3U, ring.size(r0));
+      CHECK_EQUAL(3U, ring.size(r1));
+
+      CHECK(ring.pop(r0, value));
+      CHECK_EQUAL(10U, value);
+      CHECK(ring.pop(r0, value));
+      CHECK_EQUAL(11U, value);
+      CHECK_EQUAL(1U, ring.size(r0));
+      CHECK_EQUAL(3U, ring.size(r1));
+
+      CHECK(ring.pop(r1, value));
+      CHECK_EQUAL(10U, value);
+
+      CHECK(ring.pop(r0, value));
+      CHECK_EQUAL(12U, value);
+      CHECK(!ring.pop(r0, value));
+
+      CHECK(ring.pop(r1, value));
+      CHECK_EQUAL(11U, value);
+      CHECK(ring.pop(r1, value));
+      CHECK_EQUAL(12U, value);
+      CHECK(!ring.pop(r1, value));
+
+      CHECK_EQUAL(0U, ring.lost(r0));
+      CHECK_EQUAL(0U, ring.lost(r1));
+    }
+
+    //*************************************************************************
+    TEST(test_late_subscriber)
+    {
+      Ring ring;
+
+      ring.push(1U);
+      ring.push(2U);
+
+      const Ring::reader_id r0 = ring.subscribe();
+
+      uint32_t value = 0U;
+      CHECK(!ring.pop(r0, value));
+
+      ring.push(3U);
+      CHECK(ring.pop(r0, value));
+      CHECK_EQUAL(3U, value);
+    }
+
+    //*************************************************************************
+    TEST(test_lagging_reader)
+    {
+      Ring ring;
+
+      const Ring::reader_id slow = ring.subscribe();
+      const Ring::reader_id fast = ring.subscribe();
+
+      uint32_t value = 0U;
+
+      // The writer never waits, even though the slow reader has read nothing.
+      for (uint32_t i = 0U; i < 7U; ++i)
+      {
+        ring.push(i);
+
+        CHECK(ring.pop(fast, value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK_EQUAL(4U, ring.size(slow));
+
+      // Skips to the oldest value that is not next to be overwritten.
+      CHECK(ring.pop(slow, value));
+      CHECK_EQUAL(4U, value);
+      CHECK_EQUAL(4U, ring.lost(slow));
+
+      CHECK(ring.pop(slow, value));
+      CHECK_EQUAL(5U, value);
+      CHECK(ring.pop(slow, value));
+      CHECK_EQUAL(6U, value);
+      CHECK(!ring.pop(slow, value));
+
+      CHECK_EQUAL(0U, ring.lost(fast));
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_many_laps)
+    {
+      etl::broadcast_ring<uint32_t, 8U, 1U> ring;
+
+      const size_t reader = ring.subscribe();
+
+      for (uint32_t i = 0U; i < 1000U; ++i)
+      {
+        ring.push(i);
+        ring.push(i + 1000000U);
+
+        uint32_t value = 0U;
+        CHECK(ring.pop(reader, value));
+        CHECK_EQUAL(i, value);
+        CHECK(ring.pop(reader, value));
+        CHECK_EQUAL(i + 1000000U, value);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_counts)
+    {
+      WrapRing ring;
+
+      const Ring::reader_id reader = ring.subscribe();
+
+      uint32_t value = 0U;
+      CHECK(!ring.pop(reader, value));
+
+      for (uint32_t i = 0U; i < 20U; ++i)
+      {
+        ring.push(i);
+
+        CHECK(ring.pop(reader, value));
+        CHECK_EQUAL(i, value);
+        CHECK(!ring.pop(reader, value));
+      }
+
+      CHECK_EQUAL(0U, ring.lost(reader));
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_counts_lagging_reader)
+    {
+      WrapRing ring;
+
+      const Ring::reader_id reader = ring.subscribe();
+
+      // Pushes across the wrap of the counts, overwriting the first six.
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        ring.push(i);
+      }
+
+      CHECK_EQUAL(4U, ring.size(reader));
+
+      uint32_t value = 0U;
+
+      // Skips to the oldest value that is not next to be overwritten.
+      for (uint32_t i = 7U; i < 10U; ++i)
+      {
+        CHECK(ring.pop(reader, value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(!ring.pop(reader, value));
+      CHECK_EQUAL(7U, ring.lost(reader));
+
+      ring.push(10U);
+
+      CHECK(ring.pop(reader, value));
+      CHECK_EQUAL(10U, value);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_reader)
+    {
+      Ring ring;
+
+      uint32_t value = 0U;
+
+      CHECK_THROW(ring.pop(0U, value),   etl::broadcast_ring_invalid_reader);
+      CHECK_THROW(ring.pop(Ring::No_Reader, value), etl::broadcast_ring_invalid_reader);
+      CHECK_THROW(ring.unsubscribe(1U),  etl::broadcast_ring_invalid_reader);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      etl::broadcast_ring<uint32_t, 64U, 2U> ring;
+
+      const size_t fast = ring.subscribe();
+      const size_t slow = ring.subscribe();
+
+      uint32_t fast_read = 0U;
+      uint32_t slow_read = 0U;
+      bool     ordered   = true;
+
+      std::thread fast_reader([&]()
+      {
+        uint32_t previous = 0U;
+        uint32_t value    = 0U;
+
+        while (previous != (Writes - 1U))
+        {
+          if (ring.pop(fast, value))
+          {
+            if ((fast_read != 0U) && (value <= previous))
+            {
+              ordered = false;
+            }
+
+            previous = value;
+            ++fast_read;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      std::thread slow_reader([&]()
+      {
+        uint32_t previous = 0U;
+        uint32_t value    = 0U;
+
+        while (previous != (Writes - 1U))
+        {
+          if (ring.pop(slow, value))
+          {
+            if ((slow_read != 0U) && (value <= previous))
+            {
+              ordered = false;
+            }
+
+            previous = value;
+            ++slow_read;
+
+            if ((slow_read % 16U) == 0U)
+            {
+              std::this_thread::yield();
+            }
+          }
+        }
+      });
+
+      for (uint32_t i = 0U; i < Writes; ++i)
+      {
+        ring.push(i);
+      }
+
+      fast_reader.join();
+      slow_reader.join();
+
+      CHECK(ordered);
+
+      // Every value is either read or counted as lost.
+      CHECK_EQUAL(Writes, fast_read + ring.lost(fast));
+      CHECK_EQUAL(Writes, slow_read + ring.lost(slow));
+    }
+  };
+}
+
+#endif
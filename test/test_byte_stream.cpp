@@ -1336,6 +1336,328 @@ namespace
         CHECK_EQUAL(expected[i], result[i]);
       }
     }
+    //*************************************************************************
+    TEST(write_read_uint16_t_span_range_big_and_little_endian)
+    {
+      const uint16_t put_data[] = { 0x0102U, 0x0304U, 0x0506U };
+
+      std::array<char, 6> big;
+      std::array<char, 6> little;
+
+      etl::byte_stream_writer big_writer(big.data(), big.size(), etl::endian::big);
+      etl::byte_stream_writer little_writer(little.data(), little.size(), etl::endian::little);
+
+      CHECK(big_writer.write(etl::span<const uint16_t>(put_data)));
+      CHECK(little_writer.write(etl::span<const uint16_t>(put_data)));
+
+      const char expected_big[]    = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+      const char expected_little[] = { 0x02, 0x01, 0x04, 0x03, 0x06, 0x05 };
+
+      CHECK_ARRAY_EQUAL(expected_big, big.data(), 6U);
+      CHECK_ARRAY_EQUAL(expected_little, little.data(), 6U);
+
+      uint16_t get_big[3];
+      uint16_t get_little[3];
+
+      etl::byte_stream_reader big_reader(big.data(), big.size(), etl::endian::big);
+      etl::byte_stream_reader little_reader(little.data(), little.size(), etl::endian::little);
+
+      CHECK(big_reader.read(etl::span<uint16_t>(get_big)).has_value());
+      CHECK(little_reader.read(etl::span<uint16_t>(get_little)).has_value());
+
+      CHECK_ARRAY_EQUAL(put_data, get_big, 3U);
+      CHECK_ARRAY_EQUAL(put_data, get_little, 3U);
+      CHECK(big_reader.empty());
+      CHECK(little_reader.empty());
+    }
+
+    //*************************************************************************
+    TEST(write_read_double_big_endian_bytes)
+    {
+      std::array<char, sizeof(double)> storage;
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big);
+      CHECK(writer.write(-2.0));
+
+      // The IEEE 754 representation of -2.0, most significant byte first.
+      const char expected[] = { char(0xC0), 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+      CHECK_ARRAY_EQUAL(expected, storage.data(), sizeof(double));
+
+      etl::byte_stream_reader reader(storage.data(), storage.size(), etl::endian::big);
+      CHECK_EQUAL(-2.0, reader.read<double>().value());
+    }
+
+    //*************************************************************************
+    TEST(write_reservation)
+    {
+      std::array<char, 8> storage;
+      std::vector<char> result;
+      size_t calls = 0U;
+
+      // The delegate refers to the lambda, so it must outlive the writer.
+      auto collect = [&](etl::byte_stream_writer::callback_parameter_type sp)
+                     {
+                       ++calls;
+                       std::copy(sp.begin(), sp.end(), std::back_inserter(result));
+                     };
+
+      etl::byte_stream_writer::callback_type callback(collect);
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big, callback);
+      CHECK(writer.write(uint8_t(0x01)));
+
+      {
+        etl::byte_stream_writer::reservation r(writer, 7U);
+
+        CHECK(r.is_valid());
+        CHECK_EQUAL(7U, r.capacity());
+
+        const uint16_t values[] = { 0x0405U, 0x0607U };
+
+        r.write_unchecked(true);
+        r.write_unchecked(int16_t(0x0203));
+        r.write_unchecked(etl::span<const uint16_t>(values));
+
+        CHECK_EQUAL(7U, r.size_bytes());
+        CHECK_EQUAL(0U, r.available_bytes());
+
+        // Not committed until the reservation is destroyed.
+        CHECK_EQUAL(1U, writer.size_bytes());
+        CHECK_EQUAL(1U, calls);
+      }
+
+      CHECK_EQUAL(8U, writer.size_bytes());
+      CHECK_EQUAL(2U, calls);
+
+      const char expected[] = { 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+      CHECK_EQUAL(8U, result.size());
+      CHECK_ARRAY_EQUAL(expected, result.data(), 8U);
+
+      writer.restart();
+      writer.write(uint32_t(0U));
+
+      {
+        etl::byte_stream_writer::reservation r(writer, 5U);
+
+        CHECK(!r.is_valid());
+        CHECK_EQUAL(0U, r.capacity());
+      }
+
+      CHECK_EQUAL(4U, writer.size_bytes());
+    }
+
+    //*************************************************************************
+    TEST(read_span_view)
+    {
+      const uint32_t put_data[] = { 0x01020304UL, 0x05060708UL, 0x090A0B0CUL };
+      uint32_t storage[4];
+
+      const etl::endian native = etl::endianness::value();
+      const etl::endian other  = (native == etl::endian::little) ? etl::endian::big : etl::endian::little;
+
+      etl::byte_stream_writer writer(storage, sizeof(storage), native);
+      CHECK(writer.write(etl::span<const uint32_t>(put_data)));
+      CHECK(writer.write(uint8_t(0xAA)));
+
+      etl::byte_stream_reader reader(storage, sizeof(storage), native);
+
+      CHECK(reader.is_span_readable<uint32_t>());
+
+      etl::optional<etl::span<const uint32_t> > view = reader.read_span<uint32_t>(2U);
+
+      CHECK(view.has_value());
+      CHECK(view.value().data() == storage);
+      CHECK_EQUAL(2U, view.value().size());
+      CHECK_EQUAL(put_data[0], view.value()[0]);
+      CHECK_EQUAL(put_data[1], view.value()[1]);
+
+      // Not enough left.
+      CHECK(!reader.read_span<uint32_t>(3U).has_value());
+
+      view = reader.read_span<uint32_t>(1U);
+      CHECK(view.has_value());
+      CHECK_EQUAL(put_data[2], view.value()[0]);
+
+      // Single bytes are always viewable.
+      etl::optional<etl::span<const uint8_t> > bytes = reader.read_span<uint8_t>(1U);
+      CHECK(bytes.has_value());
+      CHECK_EQUAL(0xAA, bytes.value()[0]);
+
+      // Misaligned.
+      CHECK(!reader.is_span_readable<uint16_t>());
+      CHECK(!reader.read_span<uint16_t>(1U).has_value());
+      CHECK_EQUAL(3U, reader.available_bytes());
+
+      // The other endianness must be copied.
+      etl::byte_stream_reader other_reader(storage, sizeof(storage), other);
+      CHECK(!other_reader.is_span_readable<uint32_t>());
+      CHECK(!other_reader.read_span<uint32_t>(1U).has_value());
+      CHECK_EQUAL(sizeof(storage), other_reader.available_bytes());
+    }
+
+    //*************************************************************************
+    TEST(write_varint_known_encodings)
+    {
+      char storage[32];
+      etl::byte_stream_writer writer(storage, sizeof(storage), etl::endian::big);
+
+      CHECK(writer.write_varint(uint32_t(0U)));
+      CHECK(writer.write_varint(uint32_t(127U)));
+      CHECK(writer.write_varint(uint32_t(300U)));
+      CHECK(writer.write_varint(int32_t(-1)));
+      CHECK(writer.write_varint(int32_t(1)));
+      CHECK(writer.write_varint(int32_t(-65)));
+      CHECK(writer.write_varint(etl::integral_limits<uint64_t>::max));
+
+      const uint8_t expected[] = { 0x00, 0x7F, 0xAC, 0x02, 0x01, 0x02, 0x81, 0x01,
+                                   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+
+      CHECK_EQUAL(sizeof(expected), writer.size_bytes());
+      CHECK_ARRAY_EQUAL(expected, reinterpret_cast<const uint8_t*>(storage), sizeof(expected));
+
+      CHECK_EQUAL(1U,  etl::varint_size(uint32_t(127U)));
+      CHECK_EQUAL(2U,  etl::varint_size(uint32_t(300U)));
+      CHECK_EQUAL(2U,  etl::varint_size(int32_t(-65)));
+      CHECK_EQUAL(10U, etl::varint_size(etl::integral_limits<uint64_t>::max));
+      CHECK_EQUAL(5U,  etl::varint_size(etl::integral_limits<int32_t>::min));
+    }
+
+    //*************************************************************************
+    TEST(write_read_varint_round_trip)
+    {
+      std::vector<int64_t> values;
+
+      for (int shift = 0; shift < 63; ++shift)
+      {
+        const int64_t value = int64_t(1) << shift;
+        values.push_back(value);
+        values.push_back(value - 1);
+        values.push_back(-value);
+        values.push_back(-value + 1);
+      }
+
+      values.push_back(etl::integral_limits<int64_t>::max);
+      values.push_back(etl::integral_limits<int64_t>::min);
+
+      std::vector<char> storage(values.size() * 20U);
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::little);
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        CHECK(writer.write_varint(values[i]));
+        CHECK(writer.write_varint(static_cast<uint64_t>(values[i])));
+      }
+
+      // The reader ends at the last varint, so the end uses the byte at a time decoder.
+      etl::byte_stream_reader reader(storage.data(), writer.size_bytes(), etl::endian::little);
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        etl::optional<int64_t>  signed_value   = reader.read_varint<int64_t>();
+        etl::optional<uint64_t> unsigned_value = reader.read_varint<uint64_t>();
+
+        CHECK(signed_value.has_value());
+        CHECK(unsigned_value.has_value());
+        CHECK_EQUAL(values[i], signed_value.value());
+        CHECK_EQUAL(static_cast<uint64_t>(values[i]), unsigned_value.value());
+      }
+
+      CHECK(reader.empty());
+    }
+
+    //*************************************************************************
+    TEST(write_read_varint_small_types)
+    {
+      char storage[64];
+      etl::byte_stream_writer writer(storage, sizeof(storage), etl::endian::little);
+
+      CHECK(writer.write_varint(int8_t(-128)));
+      CHECK(writer.write_varint(uint8_t(255U)));
+      CHECK(writer.write_varint(int16_t(-32768)));
+      CHECK(writer.write_varint(uint16_t(65535U)));
+      CHECK(writer.write_varint(int32_t(12345)));
+
+      etl::byte_stream_reader reader(storage, sizeof(storage), etl::endian::little);
+
+      CHECK_EQUAL(-128,   int(reader.read_varint<int8_t>().value()));
+      CHECK_EQUAL(255,    int(reader.read_varint<uint8_t>().value()));
+      CHECK_EQUAL(-32768, int(reader.read_varint<int16_t>().value()));
+      CHECK_EQUAL(65535,  int(reader.read_varint<uint16_t>().value()));
+      CHECK_EQUAL(12345,  reader.read_varint<int32_t>().value());
+    }
+
+    //*************************************************************************
+    TEST(read_varint_errors)
+    {
+      // 300 does not fit in a uint8_t.
+      const char too_large[] = { char(0xAC), char(0x02), 0, 0, 0, 0, 0, 0, 0, 0 };
+      etl::byte_stream_reader reader1(too_large, sizeof(too_large), etl::endian::little);
+
+      CHECK(!reader1.read_varint<uint8_t>().has_value());
+      CHECK_EQUAL(sizeof(too_large), reader1.available_bytes());
+      CHECK_EQUAL(300U, reader1.read_varint<uint16_t>().value());
+
+      // Truncated.
+      const char truncated[] = { char(0xAC), char(0x82) };
+      etl::byte_stream_reader reader2(truncated, sizeof(truncated), etl::endian::little);
+
+      CHECK(!reader2.read_varint<uint32_t>().has_value());
+      CHECK_EQUAL(sizeof(truncated), reader2.available_bytes());
+
+      // Longer than a uint32_t varint.
+      const char too_long[] = { char(0x80), char(0x80), char(0x80), char(0x80), char(0x80), char(0x01), 0, 0 };
+      etl::byte_stream_reader reader3(too_long, sizeof(too_long), etl::endian::little);
+
+      CHECK(!reader3.read_varint<uint32_t>().has_value());
+      CHECK_EQUAL(uint64_t(1) << 35U, reader3.read_varint<uint64_t>().value());
+
+      // Overflows 64 bits.
+      const char overflow[] = { char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF),
+                                char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0x02) };
+      etl::byte_stream_reader reader4(overflow, sizeof(overflow), etl::endian::little);
+
+      CHECK(!reader4.read_varint<uint64_t>().has_value());
+    }
+
+    //*************************************************************************
+    TEST(write_read_varint_range)
+    {
+      const int32_t values[] = { 0, -1, 1, 1000, -1000, 100000, etl::integral_limits<int32_t>::min, etl::integral_limits<int32_t>::max };
+      const size_t  count    = sizeof(values) / sizeof(values[0]);
+
+      size_t size = 0U;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        size += etl::varint_size(values[i]);
+      }
+
+      std::vector<char> storage(size);
+
+      // Too small, so nothing is written.
+      etl::byte_stream_writer small_writer(storage.data(), size - 1U, etl::endian::little);
+      CHECK(!small_writer.write_varint(etl::span<const int32_t>(values)));
+      CHECK(small_writer.empty());
+
+      etl::byte_stream_writer writer(storage.data(), size, etl::endian::little);
+      CHECK(writer.write_varint(etl::span<const int32_t>(values)));
+      CHECK(writer.full());
+
+      int32_t result[count];
+
+      // Too many values requested, so nothing is read.
+      int32_t too_many[count + 1U];
+      etl::byte_stream_reader reader(storage.data(), storage.size(), etl::endian::little);
+      CHECK(!reader.read_varint(etl::span<int32_t>(too_many)).has_value());
+      CHECK_EQUAL(size, reader.available_bytes());
+
+      etl::optional<etl::span<const int32_t> > output = reader.read_varint(etl::span<int32_t>(result));
+      CHECK(output.has_value());
+      CHECK_EQUAL(count, output.value().size());
+      CHECK_ARRAY_EQUAL(values, result, count);
+      CHECK(reader.empty());
+    }
+
     //*************************************************************************
     TEST(read_byte_stream_skip)
     {
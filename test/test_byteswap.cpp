@@ -0,0 +1,184 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/byteswap.h"
+
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  /// Fills with distinct values.
+  //***************************************************************************
+  template <typename T>
+  std::vector<T> make_values(size_t count)
+  {
+    std::vector<T> values;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      T value = T(0);
+
+      for (size_t b = 0U; b < sizeof(T); ++b)
+      {
+        value = T(value | (T((i * 31U) + (b * 7U) + 1U) & T(0x7F)) << (b * 8U));
+      }
+
+      values.push_back(value);
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  etl::span<T> as_span(std::vector<T>& values)
+  {
+    return values.empty() ? etl::span<T>() : etl::span<T>(values.data(), values.size());
+  }
+
+  //***************************************************************************
+  template <typename T>
+  etl::span<const T> as_span(const std::vector<T>& values)
+  {
+    return values.empty() ? etl::span<const T>() : etl::span<const T>(values.data(), values.size());
+  }
+
+  //***************************************************************************
+  /// Checks in place and copying swaps against reverse_bytes, for lengths
+  /// around the 16 byte blocks.
+  //***************************************************************************
+  template <typename T>
+  bool check_swaps()
+  {
+    const size_t lengths[] = { 0U, 1U, 2U, 3U, 7U, 8U, 9U, 16U, 17U, 31U, 33U, 100U };
+
+    for (size_t l = 0U; l < sizeof(lengths) / sizeof(lengths[0]); ++l)
+    {
+      const std::vector<T> original = make_values<T>(lengths[l]);
+
+      std::vector<T> in_place(original);
+      etl::byteswap(as_span(in_place));
+
+      std::vector<T> copied(original.size() + 1U, T(0));
+      const size_t count = etl::byteswap_copy(as_span(original), as_span(copied));
+
+      if (count != original.size())
+      {
+        return false;
+      }
+
+      for (size_t i = 0U; i < original.size(); ++i)
+      {
+        const T expected = etl::reverse_bytes(original[i]);
+
+        if ((in_place[i] != expected) || (copied[i] != expected))
+        {
+          return false;
+        }
+      }
+
+      // Nothing written past the values.
+      if (copied.back() != T(0))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_byteswap)
+  {
+    //*************************************************************************
+    TEST(test_byteswap_16)
+    {
+      CHECK(check_swaps<uint16_t>());
+      CHECK(check_swaps<int16_t>());
+    }
+
+    //*************************************************************************
+    TEST(test_byteswap_32)
+    {
+      CHECK(check_swaps<uint32_t>());
+      CHECK(check_swaps<int32_t>());
+    }
+
+    //*************************************************************************
+    TEST(test_byteswap_64)
+    {
+      CHECK(check_swaps<uint64_t>());
+      CHECK(check_swaps<int64_t>());
+    }
+
+    //*************************************************************************
+    TEST(test_byteswap_8)
+    {
+      uint8_t values[] = { 1, 2, 3 };
+      uint8_t copied[] = { 0, 0, 0 };
+
+      etl::byteswap(etl::span<uint8_t>(values));
+      CHECK_EQUAL(2U, etl::byteswap_copy(etl::span<uint8_t>(values, 2U), etl::span<uint8_t>(copied)));
+
+      CHECK_EQUAL(1, values[0]);
+      CHECK_EQUAL(3, values[2]);
+      CHECK_EQUAL(2, copied[1]);
+      CHECK_EQUAL(0, copied[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_byteswap_copy_short_destination)
+    {
+      const uint32_t values[] = { 0x01020304UL, 0x05060708UL, 0x090A0B0CUL };
+      uint32_t       copied[2] = { 0U, 0U };
+
+      CHECK_EQUAL(2U, etl::byteswap_copy(etl::span<const uint32_t>(values), etl::span<uint32_t>(copied)));
+      CHECK_EQUAL(0x04030201UL, copied[0]);
+      CHECK_EQUAL(0x08070605UL, copied[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_ntoh_hton)
+    {
+      // Big endian bytes, as received.
+      const unsigned char wire[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0 };
+
+      uint32_t values[2];
+      memcpy(values, wire, sizeof(wire));
+
+      etl::ntoh(etl::span<uint32_t>(values));
+      CHECK_EQUAL(0x12345678UL, values[0]);
+      CHECK_EQUAL(0x9ABCDEF0UL, values[1]);
+
+      etl::hton(etl::span<uint32_t>(values));
+      CHECK(memcmp(values, wire, sizeof(wire)) == 0);
+    }
+  };
+}
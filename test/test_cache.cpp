@@ -0,0 +1,436 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/cache.h"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef etl::icache<int, std::string>      ICache;
+  typedef etl::lru_cache<int, std::string, 4>   LruCache;
+  typedef etl::clock_cache<int, std::string, 4> ClockCache;
+  typedef etl::lfu_cache<int, std::string, 4>   LfuCache;
+  typedef ICache::key_value_type             KeyValue;
+
+  //***************************************************************************
+  /// A backing store that counts its reads and writes.
+  //***************************************************************************
+  struct Store
+  {
+    Store()
+      : reads(0)
+      , writes(0)
+    {
+    }
+
+    bool read(KeyValue& key_value)
+    {
+      ++reads;
+
+      std::map<int, std::string>::const_iterator itr = values.find(key_value.first);
+
+      if (itr == values.end())
+      {
+        return false;
+      }
+
+      key_value.second = itr->second;
+      return true;
+    }
+
+    void write(const KeyValue& key_value)
+    {
+      ++writes;
+      values[key_value.first] = key_value.second;
+    }
+
+    void attach(ICache& cache)
+    {
+      cache.set_read_function(ICache::read_function_type::create<Store, &Store::read>(*this));
+      cache.set_write_function(ICache::write_function_type::create<Store, &Store::write>(*this));
+    }
+
+    std::map<int, std::string> values;
+    int reads;
+    int writes;
+  };
+
+  //***************************************************************************
+  std::string to_s(int i)
+  {
+    return std::string(1, char('A' + (i % 26))) + std::string(size_t(i / 26), '+');
+  }
+
+  SUITE(test_cache)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      LruCache cache;
+
+      CHECK(cache.empty());
+      CHECK(!cache.full());
+      CHECK_EQUAL(0U, cache.size());
+      CHECK_EQUAL(4U, cache.max_size());
+      CHECK_EQUAL(4U, cache.capacity());
+      CHECK_EQUAL(4U, cache.available());
+      CHECK(cache.is_write_through());
+    }
+
+    //*************************************************************************
+    TEST(test_read_without_store)
+    {
+      LruCache cache;
+
+      CHECK(cache.read(1) == ETL_NULLPTR);
+
+      cache.write(1, "one");
+
+      const std::string* p = cache.read(1);
+      CHECK(p != ETL_NULLPTR);
+      CHECK_EQUAL(std::string("one"), *p);
+      CHECK(cache.contains(1));
+      CHECK(!cache.contains(2));
+    }
+
+    //*************************************************************************
+    TEST(test_read_through)
+    {
+      Store store;
+      store.values[1] = "one";
+      store.values[2] = "two";
+
+      LruCache cache;
+      store.attach(cache);
+
+      CHECK_EQUAL(std::string("one"), *cache.read(1));
+      CHECK_EQUAL(1, store.reads);
+
+      // A hit does not read the store.
+      CHECK_EQUAL(std::string("one"), *cache.read(1));
+      CHECK_EQUAL(1, store.reads);
+
+      // A key missing from the store is not cached.
+      CHECK(cache.read(3) == ETL_NULLPTR);
+      CHECK_EQUAL(2, store.reads);
+      CHECK(!cache.contains(3));
+      CHECK_EQUAL(1U, cache.size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_through)
+    {
+      Store store;
+      LruCache cache;
+      store.attach(cache);
+
+      cache.write(1, "one");
+      CHECK_EQUAL(1, store.writes);
+      CHECK_EQUAL(std::string("one"), store.values[1]);
+
+      cache.flush();
+      CHECK_EQUAL(1, store.writes);
+    }
+
+    //*************************************************************************
+    TEST(test_write_back)
+    {
+      Store store;
+      LruCache cache;
+      store.attach(cache);
+      cache.set_write_through(false);
+
+      cache.write(1, "one");
+      cache.write(1, "uno");
+      cache.write(2, "two");
+      CHECK_EQUAL(0, store.writes);
+
+      cache.flush();
+      CHECK_EQUAL(2, store.writes);
+      CHECK_EQUAL(std::string("uno"), store.values[1]);
+      CHECK_EQUAL(std::string("two"), store.values[2]);
+
+      // Clean values are not written again.
+      cache.flush();
+      CHECK_EQUAL(2, store.writes);
+    }
+
+    //*************************************************************************
+    TEST(test_write_back_on_eviction_and_erase)
+    {
+      Store store;
+      LruCache cache;
+      store.attach(cache);
+      cache.set_write_through(false);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        cache.write(i, to_s(i));
+      }
+
+      CHECK(cache.full());
+      CHECK_EQUAL(0, store.writes);
+
+      cache.write(4, to_s(4));
+      CHECK_EQUAL(1, store.writes);
+      CHECK_EQUAL(to_s(0), store.values[0]);
+      CHECK(!cache.contains(0));
+
+      CHECK(cache.erase(1));
+      CHECK(!cache.erase(1));
+      CHECK_EQUAL(2, store.writes);
+      CHECK_EQUAL(to_s(1), store.values[1]);
+      CHECK_EQUAL(3U, cache.size());
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_flushes)
+    {
+      Store store;
+
+      {
+        LruCache cache;
+        store.attach(cache);
+        cache.set_write_through(false);
+        cache.write(1, "one");
+        CHECK_EQUAL(0, store.writes);
+      }
+
+      CHECK_EQUAL(1, store.writes);
+      CHECK_EQUAL(std::string("one"), store.values[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Store store;
+      LruCache cache;
+      store.attach(cache);
+      cache.set_write_through(false);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        cache.write(i, to_s(i));
+      }
+
+      cache.clear();
+      CHECK(cache.empty());
+      CHECK_EQUAL(4, store.writes);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(!cache.contains(i));
+        cache.write(i + 10, to_s(i + 10));
+      }
+
+      CHECK(cache.full());
+    }
+
+    //*************************************************************************
+    TEST(test_lru_eviction)
+    {
+      LruCache cache;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        cache.write(i, to_s(i));
+      }
+
+      // Use 0 and 1, so 2 is the least recently used.
+      cache.read(0);
+      cache.read(1);
+
+      cache.write(4, to_s(4));
+      CHECK(!cache.contains(2));
+      CHECK(cache.contains(0));
+      CHECK(cache.contains(1));
+      CHECK(cache.contains(3));
+      CHECK(cache.contains(4));
+
+      cache.write(5, to_s(5));
+      CHECK(!cache.contains(3));
+    }
+
+    //*************************************************************************
+    TEST(test_lru_against_reference)
+    {
+      etl::lru_cache<int, std::string, 16> cache;
+      std::list<int> order; // Most recent first.
+
+      uint32_t seed = 12345U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const uint32_t r   = seed >> 16U;
+        const int      key = int(r % 40U);
+
+        std::list<int>::iterator itr = std::find(order.begin(), order.end(), key);
+
+        if ((r & 0x8000U) != 0U)
+        {
+          const std::string* p = cache.read(key);
+          CHECK_EQUAL(itr != order.end(), p != ETL_NULLPTR);
+
+          if (p != ETL_NULLPTR)
+          {
+            CHECK_EQUAL(to_s(key), *p);
+            order.erase(itr);
+            order.push_front(key);
+          }
+        }
+        else if ((r & 0x4000U) != 0U)
+        {
+          CHECK_EQUAL(itr != order.end(), cache.erase(key));
+
+          if (itr != order.end())
+          {
+            order.erase(itr);
+          }
+        }
+        else
+        {
+          cache.write(key, to_s(key));
+
+          if (itr != order.end())
+          {
+            order.erase(itr);
+          }
+          else if (order.size() == 16U)
+          {
+            order.pop_back();
+          }
+
+          order.push_front(key);
+        }
+
+        CHECK_EQUAL(order.size(), cache.size());
+      }
+
+      for (int key = 0; key < 40; ++key)
+      {
+        CHECK_EQUAL(std::find(order.begin(), order.end(), key) != order.end(), cache.contains(key));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_clock_eviction)
+    {
+      ClockCache cache;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        cache.write(i, to_s(i));
+      }
+
+      // 0 and 2 get a second chance.
+      cache.read(0);
+      cache.read(2);
+
+      cache.write(4, to_s(4));
+      CHECK(cache.contains(0));
+      CHECK(!cache.contains(1));
+      CHECK(cache.contains(2));
+      CHECK(cache.contains(3));
+
+      cache.write(5, to_s(5));
+      CHECK(!cache.contains(3));
+      CHECK(cache.contains(0));
+      CHECK(cache.contains(2));
+    }
+
+    //*************************************************************************
+    TEST(test_lfu_eviction)
+    {
+      LfuCache cache;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        cache.write(i, to_s(i));
+      }
+
+      cache.read(0);
+      cache.read(0);
+      cache.read(1);
+      cache.read(3);
+
+      // 2 is the least frequently used.
+      cache.write(4, to_s(4));
+      CHECK(!cache.contains(2));
+
+      // 4 has 1 use, so is next, even though it is the newest.
+      cache.write(5, to_s(5));
+      CHECK(!cache.contains(4));
+
+      // 1, 3 and 5 tie on 2 uses after a read of 5; 1 is the oldest.
+      cache.read(5);
+      cache.write(6, to_s(6));
+      CHECK(!cache.contains(1));
+      CHECK(cache.contains(0));
+      CHECK(cache.contains(3));
+      CHECK(cache.contains(5));
+      CHECK(cache.contains(6));
+    }
+
+    //*************************************************************************
+    TEST(test_policies_through_interface)
+    {
+      LruCache   lru;
+      ClockCache clock;
+      LfuCache   lfu;
+
+      ICache* caches[] = { &lru, &clock, &lfu };
+
+      for (size_t c = 0U; c < 3U; ++c)
+      {
+        ICache& cache = *caches[c];
+
+        for (int i = 0; i < 100; ++i)
+        {
+          cache.write(i, to_s(i));
+
+          const std::string* p = cache.read(i);
+          CHECK(p != ETL_NULLPTR);
+          CHECK_EQUAL(to_s(i), *p);
+          CHECK(cache.size() <= 4U);
+        }
+
+        CHECK(cache.full());
+        CHECK_EQUAL(0U, cache.available());
+        CHECK(cache.contains(99));
+      }
+    }
+  }
+}
@@ -0,0 +1,236 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/cache_aligned.h"
+#include "etl/atomic.h"
+#include "etl/array.h"
+
+#include <stdint.h>
+#include <string>
+
+namespace
+{
+  const size_t Line = etl::hardware_destructive_interference_size;
+
+  struct Counters
+  {
+    uint32_t hits;
+    uint32_t misses;
+  };
+
+  struct Large
+  {
+    char data[Line + 1U];
+  };
+
+  //***************************************************************************
+  bool is_line_aligned(const void* p)
+  {
+    return (reinterpret_cast<uintptr_t>(p) % Line) == 0U;
+  }
+
+  SUITE(test_cache_aligned)
+  {
+    //*************************************************************************
+    TEST(test_interference_size)
+    {
+      CHECK_EQUAL(size_t(ETL_CACHE_LINE_SIZE), etl::hardware_destructive_interference_size);
+      CHECK_EQUAL(size_t(ETL_CACHE_LINE_SIZE), etl::hardware_constructive_interference_size);
+      CHECK_EQUAL(size_t(ETL_CACHE_LINE_SIZE), etl::traits::cache_line_size);
+      CHECK_EQUAL(0U, Line & (Line - 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_cache_line_padded_size)
+    {
+      CHECK_EQUAL(0U,        (etl::cache_line_padded_size<0U>::value));
+      CHECK_EQUAL(Line,      (etl::cache_line_padded_size<1U>::value));
+      CHECK_EQUAL(Line,      (etl::cache_line_padded_size<Line>::value));
+      CHECK_EQUAL(2U * Line, (etl::cache_line_padded_size<Line + 1U>::value));
+      CHECK_EQUAL(16U,       (etl::cache_line_padded_size<5U, 16U>::value));
+      CHECK_EQUAL(32U,       (etl::cache_line_padded_size<17U, 16U>::value));
+    }
+
+    //*************************************************************************
+    TEST(test_padded_size)
+    {
+      CHECK_EQUAL(Line,       sizeof(etl::padded<uint32_t>));
+      CHECK_EQUAL(Line,       sizeof(etl::padded<Counters>));
+      CHECK_EQUAL(2U * Line,  sizeof(etl::padded<Large>));
+      CHECK_EQUAL(16U,        sizeof(etl::padded<uint8_t, 16U>));
+      CHECK_EQUAL(Line,       (etl::padded<uint32_t>::Padded_Size));
+
+      etl::padded<uint32_t> array[4];
+      CHECK_EQUAL(Line, size_t(reinterpret_cast<char*>(&array[1].get()) - reinterpret_cast<char*>(&array[0].get())));
+    }
+
+    //*************************************************************************
+    TEST(test_padded_construction_and_access)
+    {
+      etl::padded<uint32_t> zero;
+      CHECK_EQUAL(0U, zero.get());
+
+      etl::padded<uint32_t> value(42U);
+      CHECK_EQUAL(42U, *value);
+
+      value = 43U;
+      CHECK_EQUAL(43U, value.get());
+
+      ++*value;
+      CHECK_EQUAL(44U, value.get());
+
+      const etl::padded<uint32_t> copy(value);
+      CHECK_EQUAL(44U, *copy);
+
+      etl::padded<Counters> counters;
+      CHECK_EQUAL(0U, counters->hits);
+      CHECK_EQUAL(0U, counters->misses);
+
+      counters->hits = 3U;
+      CHECK_EQUAL(3U, counters.get().hits);
+    }
+
+    //*************************************************************************
+    TEST(test_padded_in_place)
+    {
+      etl::padded<std::string> text(etl::in_place_t(), 3U, 'a');
+      CHECK_EQUAL(std::string("aaa"), *text);
+      CHECK_EQUAL(3U, text->size());
+
+      std::string moved("moved");
+      etl::padded<std::string> other(std::move(moved));
+      CHECK_EQUAL(std::string("moved"), other.get());
+    }
+
+    //*************************************************************************
+    TEST(test_cache_aligned_layout)
+    {
+      CHECK_EQUAL(Line,      alignof(etl::cache_aligned<uint8_t>));
+      CHECK_EQUAL(Line,      sizeof(etl::cache_aligned<uint8_t>));
+      CHECK_EQUAL(2U * Line, sizeof(etl::cache_aligned<Large>));
+
+      etl::array<etl::cache_aligned<uint32_t>, 4> per_core;
+
+      for (size_t i = 0U; i < per_core.size(); ++i)
+      {
+        CHECK(is_line_aligned(&per_core[i].get()));
+        CHECK_EQUAL(0U, *per_core[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_cache_aligned_atomic)
+    {
+      struct Shared
+      {
+        etl::cache_aligned<etl::atomic<uint32_t> > write;
+        etl::cache_aligned<etl::atomic<uint32_t> > read;
+      };
+
+      Shared shared;
+
+      CHECK(is_line_aligned(&shared.write));
+      CHECK(is_line_aligned(&shared.read));
+      CHECK(size_t(reinterpret_cast<char*>(&shared.read) - reinterpret_cast<char*>(&shared.write)) >= Line);
+
+      shared.write->store(1U);
+      shared.read->fetch_add(2U);
+
+      CHECK_EQUAL(1U, shared.write->load());
+      CHECK_EQUAL(2U, shared.read->load());
+
+      etl::cache_aligned<etl::atomic<uint32_t> > initialised(etl::in_place_t(), 5U);
+      CHECK_EQUAL(5U, initialised->load());
+    }
+
+    //*************************************************************************
+    TEST(test_cache_aligned_value)
+    {
+      etl::cache_aligned<Counters> counters;
+      CHECK_EQUAL(0U, counters->hits);
+
+      Counters initial = { 1U, 2U };
+      etl::cache_aligned<Counters> copy(initial);
+      CHECK_EQUAL(1U, copy->hits);
+      CHECK_EQUAL(2U, (*copy).misses);
+
+      Counters next = { 3U, 4U };
+      copy = next;
+      CHECK_EQUAL(3U, copy.get().hits);
+    }
+
+    //*************************************************************************
+    TEST(test_cache_aligned_storage)
+    {
+      typedef etl::cache_aligned_storage<sizeof(Counters)>::type Storage;
+
+      CHECK_EQUAL(Line, alignof(Storage));
+      CHECK_EQUAL(Line, sizeof(Storage));
+      CHECK_EQUAL(2U * Line, sizeof(etl::cache_aligned_storage_t<Line + 1U>));
+
+      Storage storage;
+      Counters& counters = storage;
+      counters.hits = 7U;
+
+      CHECK(is_line_aligned(&counters));
+      CHECK_EQUAL(7U, storage.get_reference<Counters>().hits);
+    }
+
+    //*************************************************************************
+    TEST(test_cache_aligned_buffer)
+    {
+      typedef etl::cache_aligned_buffer<sizeof(Counters), 3U> Buffer;
+
+      CHECK_EQUAL(Line, alignof(Buffer));
+      CHECK_EQUAL(Line, Buffer::Alignment);
+
+      Buffer buffer;
+      Counters* p_counters = buffer;
+
+      CHECK(is_line_aligned(p_counters));
+    }
+
+    //*************************************************************************
+    TEST(test_padded_in_cache_aligned_buffer)
+    {
+      typedef etl::padded<Counters> Slot;
+
+      etl::cache_aligned_buffer<sizeof(Slot), 4U> buffer;
+      Slot* p_slots = buffer;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        ::new (&p_slots[i]) Slot();
+        CHECK(is_line_aligned(&p_slots[i]));
+        CHECK_EQUAL(0U, p_slots[i]->hits);
+      }
+    }
+  };
+}
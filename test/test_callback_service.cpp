@@ -329,5 +329,47 @@ namespace
       CHECK(!member2_called);
       CHECK(unhandled_called);
     }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_sparse_callback_service)
+    {
+      typedef etl::sparse_callback_service<2U, 100U, 3000U, 3001U> Sparse_Service;
+
+      Sparse_Service service;
+
+      service.register_callback<2U>(global_callback);
+      service.register_callback(3000U, object.callback);
+      service.register_callback(3001U, member_callback);
+      service.register_callback(101U, member_callback); // Not in the list.
+      service.register_unhandled_callback(unhandled_callback);
+
+      service.callback<2U>();
+      CHECK_EQUAL(2U, called_id);
+      CHECK(global_called);
+
+      service.callback(3000U);
+      CHECK_EQUAL(3000U, called_id);
+      CHECK(member1_called);
+
+      service.callback<3001U>();
+      CHECK_EQUAL(3001U, called_id);
+      CHECK(member2_called);
+
+      // Registered, but otherwise unhandled.
+      service.callback(100U);
+      CHECK_EQUAL(100U, called_id);
+      CHECK(unhandled_called);
+
+      for (size_t id = 0U; id < 3010U; ++id)
+      {
+        unhandled_called = false;
+        service.callback(id);
+
+        const bool handled = (id == 2U) || (id == 3000U) || (id == 3001U);
+        CHECK_EQUAL(!handled, unhandled_called);
+      }
+    }
+#endif
   };
 }
@@ -257,6 +257,60 @@ namespace
       CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
     }
 
+    //*************************************************************************
+    TEST(callback_timer_tickless)
+    {
+      etl::callback_timer<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback,        37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback, 23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_callback2,         11, etl::timer::mode::Repeating);
+
+      object.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      // Sleep until the next expiry, but wake late each time.
+      const uint32_t overshoot = 2U;
+
+      while (ticks <= 100U)
+      {
+        uint32_t step = timer_controller.time_to_next() + overshoot;
+
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 39, 76 };
+      std::vector<uint64_t> compare2 = { 24, 46, 71, 94 };
+      std::vector<uint64_t> compare3 = { 13, 24, 35, 46, 57, 68, 79, 90, 101 };
+
+      CHECK(object.tick_list.size() != 0);
+      CHECK(free_tick_list1.size() != 0);
+      CHECK(free_tick_list2.size() != 0);
+
+      CHECK_ARRAY_EQUAL(compare1.data(), object.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+
+      // Sleep through several periods. Every expiry is processed in the one call.
+      ticks += 110U;
+      timer_controller.tick(110U);
+
+      CHECK_EQUAL(5U,  object.tick_list.size());
+      CHECK_EQUAL(9U,  free_tick_list1.size());
+      CHECK_EQUAL(19U, free_tick_list2.size());
+      CHECK_EQUAL(9U,  timer_controller.time_to_next());
+    }
+
     //*************************************************************************
     TEST(callback_timer_repeating_bigger_step)
     {
@@ -43,6 +43,7 @@ namespace
     ScopedGuard()
     {
       ++guard_count;
+      ++entry_count;
     }
 
     ~ScopedGuard()
@@ -51,9 +52,11 @@ namespace
     }
 
     static int guard_count;
+    static int entry_count;
   };
 
   int ScopedGuard::guard_count = 0;
+  int ScopedGuard::entry_count = 0;
 
   //***************************************************************************
   struct TimerLogEntry
@@ -285,6 +288,62 @@ namespace
       CHECK_EQUAL(0U, ScopedGuard::guard_count);
     }
 
+    //*************************************************************************
+    TEST(callback_timer_interrupt_tickless)
+    {
+      etl::callback_timer_interrupt<3, ScopedGuard> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback,         37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback,  23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::Repeating);
+
+      object.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      // Sleep until the next expiry, but wake late each time.
+      const uint32_t overshoot = 2U;
+
+      while (ticks <= 100U)
+      {
+        uint32_t step = timer_controller.time_to_next() + overshoot;
+
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 39, 76 };
+      std::vector<uint64_t> compare2 = { 24, 46, 71, 94 };
+      std::vector<uint64_t> compare3 = { 13, 24, 35, 46, 57, 68, 79, 90, 101 };
+
+      CHECK(object.tick_list.size() != 0);
+      CHECK(free_tick_list1.size() != 0);
+      CHECK(free_tick_list2.size() != 0);
+
+      CHECK_ARRAY_EQUAL(compare1.data(), object.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+
+      // Sleep through several periods. Every expiry is processed in the one call.
+      ticks += 110U;
+      timer_controller.tick(110U);
+
+      CHECK_EQUAL(5U,  object.tick_list.size());
+      CHECK_EQUAL(9U,  free_tick_list1.size());
+      CHECK_EQUAL(19U, free_tick_list2.size());
+      CHECK_EQUAL(9U,  timer_controller.time_to_next());
+
+      CHECK_EQUAL(0U, ScopedGuard::guard_count);
+    }
+
     //*************************************************************************
     TEST(callback_timer_interrupt_repeating_bigger_step)
     {
@@ -388,6 +447,122 @@ namespace
       CHECK_EQUAL(0U, ScopedGuard::guard_count);
     }
 
+    //*************************************************************************
+    TEST(callback_timer_interrupt_repeating_post_stop_post_start)
+    {
+      etl::callback_timer_interrupt<3, ScopedGuard> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback,         37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback,  23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::Repeating);
+
+      object.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      ScopedGuard::entry_count = 0;
+
+      CHECK(!timer_controller.has_posted_commands());
+
+      CHECK(timer_controller.post_start(id3));
+      CHECK(timer_controller.post_start(id2));
+
+      CHECK(timer_controller.has_posted_commands());
+      CHECK(!timer_controller.has_active_timer());
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 1U;
+
+      while (ticks <= 100U)
+      {
+        if (ticks == 40)
+        {
+          timer_controller.post_start(id1);
+          timer_controller.post_stop(id2);
+        }
+
+        if (ticks == 80)
+        {
+          timer_controller.post_stop(id1);
+          timer_controller.post_start(id2);
+        }
+
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      // The same as callback_timer_interrupt_repeating_stop_start.
+      std::vector<uint64_t> compare1 = { 77 };
+      std::vector<uint64_t> compare2 = { 23 };
+      std::vector<uint64_t> compare3 = { 11, 22, 33, 44, 55, 66, 77, 88, 99 };
+
+      CHECK_ARRAY_EQUAL(compare1.data(), object.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+
+      CHECK(!timer_controller.has_posted_commands());
+
+      // Only the has_active_timer call took the guard.
+      CHECK_EQUAL(1, ScopedGuard::entry_count);
+      CHECK_EQUAL(0, ScopedGuard::guard_count);
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_interrupt_post_last_command_wins)
+    {
+      etl::callback_timer_interrupt<3, ScopedGuard> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(free_function_callback,  10, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback2, 10, etl::timer::mode::Single_Shot);
+
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      CHECK(!timer_controller.post_start(etl::timer::id::NO_TIMER));
+      CHECK(!timer_controller.post_stop(etl::timer::id::NO_TIMER));
+      CHECK(!timer_controller.post_start(2));
+
+      timer_controller.enable(true);
+
+      // id1 is started then stopped, id2 is started, stopped, then started immediately.
+      timer_controller.post_start(id1);
+      timer_controller.post_stop(id1);
+      timer_controller.post_start(id2);
+      timer_controller.post_stop(id2);
+      timer_controller.post_start(id2, etl::timer::start::Immediate);
+
+      ticks = 0;
+      timer_controller.tick(0U);
+
+      CHECK(free_tick_list1.empty());
+      CHECK_EQUAL(1U, free_tick_list2.size());
+      CHECK(!timer_controller.has_active_timer());
+
+      // Posted commands wait for an enabled tick.
+      timer_controller.enable(false);
+      timer_controller.post_start(id1);
+      CHECK(!timer_controller.tick(20U));
+      CHECK(timer_controller.has_posted_commands());
+
+      timer_controller.enable(true);
+      timer_controller.tick(5U);
+      CHECK_EQUAL(5U, timer_controller.time_to_next());
+
+      // A posted stop of a timer started directly.
+      timer_controller.start(id2);
+      timer_controller.post_stop(id2);
+      CHECK_EQUAL(5U, timer_controller.time_to_next());
+      timer_controller.tick(1U);
+      CHECK_EQUAL(4U, timer_controller.time_to_next());
+
+      timer_controller.tick(4U);
+      CHECK_EQUAL(1U, free_tick_list1.size());
+      CHECK_EQUAL(1U, free_tick_list2.size());
+    }
+
     //*************************************************************************
     TEST(callback_timer_interrupt_timer_starts_timer_small_step)
     {
@@ -52,12 +52,14 @@ namespace
   {
     Locks()
       : lock_count(0)
+      , lock_calls(0)
     {
     }
 
     void clear()
     {
       lock_count = 0;
+      lock_calls = 0;
     }
 
     bool try_lock()
@@ -69,6 +71,7 @@ namespace
     void lock()
     {
       ++lock_count;
+      ++lock_calls;
     }
 
     void unlock()
@@ -77,6 +80,7 @@ namespace
     }
 
     int lock_count;
+    int lock_calls;
   };
 
   Locks locks;
@@ -327,6 +331,67 @@ namespace
       CHECK_EQUAL(0U, locks.lock_count);
     }
 
+    //*************************************************************************
+    TEST(callback_timer_locked_tickless)
+    {
+      locks.clear();
+      try_lock_type try_lock = try_lock_type::create<Locks, locks, &Locks::try_lock>();
+      lock_type     lock     = lock_type::create<Locks, locks, &Locks::lock>();
+      unlock_type   unlock   = unlock_type::create<Locks, locks, &Locks::unlock>();
+
+      etl::callback_timer_locked<3> timer_controller(try_lock, lock, unlock);
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback,         37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback,  23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::Repeating);
+
+      object.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      // Sleep until the next expiry, but wake late each time.
+      const uint32_t overshoot = 2U;
+
+      while (ticks <= 100U)
+      {
+        uint32_t step = timer_controller.time_to_next() + overshoot;
+
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 39, 76 };
+      std::vector<uint64_t> compare2 = { 24, 46, 71, 94 };
+      std::vector<uint64_t> compare3 = { 13, 24, 35, 46, 57, 68, 79, 90, 101 };
+
+      CHECK(object.tick_list.size() != 0);
+      CHECK(free_tick_list1.size() != 0);
+      CHECK(free_tick_list2.size() != 0);
+
+      CHECK_ARRAY_EQUAL(compare1.data(), object.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+
+      // Sleep through several periods. Every expiry is processed in the one call.
+      ticks += 110U;
+      timer_controller.tick(110U);
+
+      CHECK_EQUAL(5U,  object.tick_list.size());
+      CHECK_EQUAL(9U,  free_tick_list1.size());
+      CHECK_EQUAL(19U, free_tick_list2.size());
+      CHECK_EQUAL(9U,  timer_controller.time_to_next());
+
+      CHECK_EQUAL(0U, locks.lock_count);
+    }
+
     //*************************************************************************
     TEST(callback_timer_locked_repeating_bigger_step)
     {
@@ -440,6 +505,101 @@ namespace
       CHECK_EQUAL(0U, locks.lock_count);
     }
 
+    //*************************************************************************
+    TEST(callback_timer_locked_repeating_post_stop_post_start)
+    {
+      locks.clear();
+      try_lock_type try_lock = try_lock_type::create<Locks, locks, &Locks::try_lock>();
+      lock_type lock         = lock_type::create<Locks, locks, &Locks::lock>();
+      unlock_type unlock     = unlock_type::create<Locks, locks, &Locks::unlock>();
+
+      etl::callback_timer_locked<3> timer_controller(try_lock, lock, unlock);
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback,         37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback,  23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::Repeating);
+
+      object.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      CHECK(timer_controller.post_start(id3));
+      CHECK(timer_controller.post_start(id2));
+      CHECK(timer_controller.has_posted_commands());
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 1U;
+
+      while (ticks <= 100U)
+      {
+        if (ticks == 40)
+        {
+          timer_controller.post_start(id1);
+          timer_controller.post_stop(id2);
+        }
+
+        if (ticks == 80)
+        {
+          timer_controller.post_stop(id1);
+          timer_controller.post_start(id2);
+        }
+
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      // The same as callback_timer_locked_repeating_stop_start.
+      std::vector<uint64_t> compare1 = { 77 };
+      std::vector<uint64_t> compare2 = { 23 };
+      std::vector<uint64_t> compare3 = { 11, 22, 33, 44, 55, 66, 77, 88, 99 };
+
+      CHECK_ARRAY_EQUAL(compare1.data(), object.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+
+      CHECK(!timer_controller.has_posted_commands());
+
+      // Only 'tick' took the lock, with 'try_lock'.
+      CHECK_EQUAL(0, locks.lock_calls);
+      CHECK_EQUAL(0, locks.lock_count);
+    }
+
+    //*************************************************************************
+    bool try_lock_fail()
+    {
+      return false;
+    }
+
+    TEST(callback_timer_locked_post_waits_for_lock)
+    {
+      locks.clear();
+      try_lock_type try_lock = try_lock_type::create<try_lock_fail>();
+      lock_type lock         = lock_type::create<Locks, locks, &Locks::lock>();
+      unlock_type unlock     = unlock_type::create<Locks, locks, &Locks::unlock>();
+
+      etl::callback_timer_locked<3> timer_controller(try_lock, lock, unlock);
+
+      etl::timer::id::type id1 = timer_controller.register_timer(free_function_callback, 10, etl::timer::mode::Single_Shot);
+
+      timer_controller.enable(true);
+      timer_controller.post_start(id1);
+
+      CHECK(!timer_controller.tick(1U));
+      CHECK(timer_controller.has_posted_commands());
+
+      try_lock = try_lock_type::create<Locks, locks, &Locks::try_lock>();
+      timer_controller.set_locks(try_lock, lock, unlock);
+
+      CHECK(timer_controller.tick(1U));
+      CHECK(!timer_controller.has_posted_commands());
+
+      // Started at the beginning of the tick, then counted down by it.
+      CHECK_EQUAL(9U, timer_controller.time_to_next());
+    }
+
     //*************************************************************************
     TEST(callback_timer_locked_timer_starts_timer_small_step)
     {
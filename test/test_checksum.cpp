@@ -181,6 +181,46 @@ namespace
       uint32_t hash3 = etl::checksum<uint32_t>(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(hash1), int(hash3));
     }
+
+    //*************************************************************************
+    TEST(test_checksum_add_contiguous_range_uint8_t)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 203UL; ++i)
+      {
+        data.push_back(uint8_t(i * 37U + 11U));
+      }
+
+      // Pointers add a block at a time, the vector iterators a byte at a time.
+      for (size_t offset = 0UL; offset < 9UL; ++offset)
+      {
+        uint8_t by_block = etl::checksum<uint8_t>(data.data() + offset, data.data() + data.size());
+        uint8_t by_byte  = etl::checksum<uint8_t>(data.begin() + offset, data.end());
+
+        CHECK_EQUAL(int(by_byte), int(by_block));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_checksum_add_contiguous_range_uint32_t)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 203UL; ++i)
+      {
+        data.push_back(uint8_t(i * 37U + 11U));
+      }
+
+      // Pointers add a block at a time, the vector iterators a byte at a time.
+      for (size_t offset = 0UL; offset < 9UL; ++offset)
+      {
+        uint32_t by_block = etl::checksum<uint32_t>(data.data() + offset, data.data() + data.size());
+        uint32_t by_byte  = etl::checksum<uint32_t>(data.begin() + offset, data.end());
+
+        CHECK_EQUAL(int(by_byte), int(by_block));
+      }
+    }
   };
 }
 
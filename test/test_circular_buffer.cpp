@@ -36,6 +36,8 @@
 #include <algorithm>
 #include <iterator>
 #include <vector>
+#include <deque>
+#include <numeric>
 #include <string>
 
 namespace
@@ -1064,5 +1066,223 @@ namespace
       CHECK(!is_equal);
     }
 
+  
+
+    //*************************************************************************
+    TEST(test_push_range_and_pop_n_trivially_copyable)
+    {
+      typedef etl::circular_buffer<int, SIZE> DataInt;
+
+      DataInt         data;
+      DataInt         other;
+      std::deque<int> compare;
+
+      int values[SIZE * 2U];
+      std::iota(values, values + (SIZE * 2U), 0);
+
+      uint32_t seed = 1U;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        seed = (seed * 1664525U) + 1013904223U;
+        const uint32_t r = seed >> 8;
+        const size_t   n = r % (SIZE * 2U);
+
+        switch ((r >> 8) % 3U)
+        {
+          case 0:
+          {
+            data.push(values, values + n);
+
+            for (size_t j = 0U; j < n; ++j)
+            {
+              compare.push_back(values[j]);
+            }
+            break;
+          }
+
+          case 1:
+          {
+            // Push from the two blocks of another wrapped circular buffer.
+            other.push(values + (n / 2U), values + n);
+
+            data.push(other.cbegin(), other.cend());
+            compare.insert(compare.end(), other.cbegin(), other.cend());
+            break;
+          }
+
+          default:
+          {
+            const size_t n_pop = etl::min(n, data.size());
+
+            data.pop(n_pop);
+            compare.erase(compare.begin(), compare.begin() + n_pop);
+            break;
+          }
+        }
+
+        while (compare.size() > SIZE)
+        {
+          compare.pop_front();
+        }
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_push_empty_range_trivially_copyable)
+    {
+      typedef etl::circular_buffer<int, SIZE> DataInt;
+
+      DataInt data;
+      data.push(1);
+      data.push(2);
+
+      // The range of an empty span.
+      const int* p = nullptr;
+
+      data.push(p, p);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, data.front());
+      CHECK_EQUAL(2, data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_array_one_array_two)
+    {
+      typedef etl::circular_buffer<int, SIZE> DataInt;
+
+      DataInt data;
+
+      CHECK(data.array_one().empty());
+      CHECK(data.array_two().empty());
+
+      for (int i = 0; i < 6; ++i)
+      {
+        data.push(i);
+      }
+
+      // Not wrapped.
+      CHECK_EQUAL(6U, data.array_one().size());
+      CHECK(data.array_two().empty());
+      CHECK(std::equal(data.begin(), data.end(), data.array_one().begin()));
+
+      for (int i = 6; i < 14; ++i)
+      {
+        data.push(i);
+      }
+
+      // Wrapped.
+      const DataInt& cdata = data;
+      etl::span<const int> one = cdata.array_one();
+      etl::span<const int> two = cdata.array_two();
+
+      CHECK_EQUAL(SIZE, one.size() + two.size());
+      CHECK(!two.empty());
+      CHECK(std::equal(one.begin(), one.end(), data.begin()));
+      CHECK(std::equal(two.begin(), two.end(), data.begin() + one.size()));
+      CHECK_EQUAL(4, one[0]);
+      CHECK_EQUAL(13, two[two.size() - 1U]);
+    }
+
+    //*************************************************************************
+    TEST(test_linearize_trivial)
+    {
+      typedef etl::circular_buffer<int, SIZE> DataInt;
+
+      // Every offset and fill level.
+      for (size_t offset = 0U; offset < SIZE + 1U; ++offset)
+      {
+        for (size_t n = 0U; n <= SIZE; ++n)
+        {
+          DataInt data;
+
+          for (size_t i = 0U; i < offset; ++i)
+          {
+            data.push(-1);
+            data.pop();
+          }
+
+          for (size_t i = 0U; i < n; ++i)
+          {
+            data.push(int(i));
+          }
+
+          etl::span<int> items = data.linearize();
+
+          CHECK_EQUAL(n, items.size());
+          CHECK(data.array_two().empty());
+          CHECK(std::equal(data.begin(), data.end(), items.begin()));
+
+          for (size_t i = 0U; i < n; ++i)
+          {
+            CHECK_EQUAL(int(i), items[i]);
+          }
+
+          // Still a working buffer.
+          data.push(100);
+          CHECK_EQUAL(100, data.back());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_linearize_non_trivial)
+    {
+      for (size_t offset = 0U; offset < SIZE + 1U; ++offset)
+      {
+        for (size_t n = 0U; n <= SIZE; ++n)
+        {
+          Data data;
+
+          for (size_t i = 0U; i < offset; ++i)
+          {
+            data.push(Ndc("x"));
+            data.pop();
+          }
+
+          Compare compare;
+
+          for (size_t i = 0U; i < n; ++i)
+          {
+            data.push(Ndc(std::to_string(i)));
+            compare.push_back(Ndc(std::to_string(i)));
+          }
+
+          etl::span<Ndc> items = data.linearize();
+
+          CHECK_EQUAL(n, items.size());
+          CHECK(data.array_two().empty());
+          CHECK(std::equal(compare.begin(), compare.end(), items.begin()));
+          CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_push_span)
+    {
+      typedef etl::circular_buffer<int, SIZE> DataInt;
+
+      int values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 };
+
+      DataInt data;
+      data.push(etl::span<const int>(values, 4U));
+      CHECK_EQUAL(4U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), values));
+
+      data.push(etl::span<const int>(values));
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(std::equal(data.begin(), data.end(), values + 4));
+
+      Data ndc;
+      Ndc  ndc_values[] = { Ndc("0"), Ndc("1"), Ndc("2") };
+      ndc.push(etl::span<const Ndc>(ndc_values));
+      CHECK_EQUAL(3U, ndc.size());
+      CHECK(std::equal(ndc.begin(), ndc.end(), ndc_values));
+    }
   };
 }
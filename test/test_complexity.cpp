@@ -0,0 +1,479 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/list.h"
+#include "etl/flat_map.h"
+#include "etl/flat_set.h"
+#include "etl/map.h"
+#include "etl/set.h"
+#include "etl/unordered_map.h"
+#include "etl/priority_queue.h"
+#include "etl/algorithm.h"
+
+#include "data.h"
+
+#include <vector>
+
+//*****************************************************************************
+// Asserts upper bounds on the operations performed by the containers and
+// algorithms, so that a change in complexity, or extra copies, fails a test.
+//*****************************************************************************
+
+namespace
+{
+  typedef TestDataC<int> Counted;
+
+  const size_t Size = 256U;
+
+  //***************************************************************************
+  // The smallest k such that 2^k >= n.
+  //***************************************************************************
+  size_t log2_ceil(size_t n)
+  {
+    size_t k = 0U;
+
+    while ((size_t(1U) << k) < n)
+    {
+      ++k;
+    }
+
+    return k;
+  }
+
+  //***************************************************************************
+  // A fixed sequence of distinct keys in [0, Size).
+  //***************************************************************************
+  std::vector<int> shuffled_keys()
+  {
+    std::vector<int> keys;
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      // 97 is coprime with Size, so this is a permutation.
+      keys.push_back(static_cast<int>((i * 97U) % Size));
+    }
+
+    return keys;
+  }
+
+  OperationCounts& counts()
+  {
+    return OperationCounts::get();
+  }
+
+  SUITE(test_complexity)
+  {
+    //*************************************************************************
+    TEST(test_vector_push_back_and_emplace_back)
+    {
+      etl::vector<Counted, Size> data;
+      Counted value(1);
+
+      counts().reset();
+
+      for (size_t i = 0U; i < Size / 2U; ++i)
+      {
+        data.push_back(value);
+      }
+
+      // One copy each, and no reallocation.
+      CHECK_EQUAL(Size / 2U, counts().copies);
+      CHECK_EQUAL(0U, counts().moves);
+
+      counts().reset();
+
+      for (size_t i = 0U; i < Size / 2U; ++i)
+      {
+        data.emplace_back(static_cast<int>(i));
+      }
+
+      CHECK_EQUAL(Size / 2U, counts().constructions);
+      CHECK_EQUAL(0U, counts().copies);
+      CHECK_EQUAL(0U, counts().moves);
+    }
+
+    //*************************************************************************
+    TEST(test_vector_insert_and_erase_at_front)
+    {
+      etl::vector<Counted, Size> data;
+
+      for (size_t i = 0U; i < Size - 1U; ++i)
+      {
+        data.emplace_back(static_cast<int>(i));
+      }
+
+      const size_t n = data.size();
+      Counted value(-1);
+
+      counts().reset();
+      data.insert(data.begin(), value);
+
+      // Each existing element is moved once, and the value copied once.
+      CHECK(counts().moves <= n);
+      CHECK(counts().copies <= 1U);
+      CHECK_EQUAL(0U, counts().comparisons);
+
+      counts().reset();
+      data.erase(data.begin());
+
+      CHECK(counts().moves <= n);
+      CHECK_EQUAL(0U, counts().copies);
+      CHECK_EQUAL(1U, counts().destructions);
+    }
+
+    //*************************************************************************
+    TEST(test_deque_push_does_not_move_elements)
+    {
+      etl::deque<Counted, Size> data;
+      Counted value(1);
+
+      counts().reset();
+
+      for (size_t i = 0U; i < Size / 2U; ++i)
+      {
+        data.push_back(value);
+        data.push_front(value);
+      }
+
+      CHECK_EQUAL(Size, counts().copies);
+      CHECK_EQUAL(0U, counts().moves);
+    }
+
+    //*************************************************************************
+    TEST(test_list_insert_and_sort)
+    {
+      etl::list<Counted, Size> data;
+      std::vector<int> keys = shuffled_keys();
+
+      counts().reset();
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        data.push_front(Counted(keys[i]));
+      }
+
+      // Nodes never move.
+      CHECK(counts().copies + counts().moves <= Size);
+
+      counts().reset();
+      data.sort();
+
+      CHECK(counts().comparisons <= Size * log2_ceil(Size));
+      CHECK_EQUAL(0U, counts().copies + counts().moves);
+    }
+
+    //*************************************************************************
+    TEST(test_flat_map_insert_and_find)
+    {
+      typedef etl::flat_map<int, Counted, Size, CountingLess<int> > Map;
+
+      Map data;
+      std::vector<int> keys = shuffled_keys();
+
+      for (size_t i = 0U; i < keys.size() - 1U; ++i)
+      {
+        data.insert(Map::value_type(keys[i], Counted(keys[i])));
+      }
+
+      // A binary search and equality tests, and the elements, which are
+      // referenced, never move.
+      counts().reset();
+      data.insert(Map::value_type(keys.back(), Counted(keys.back())));
+
+      CHECK(counts().comparisons <= log2_ceil(data.size()) + 3U);
+      CHECK(counts().copies + counts().moves <= 2U);
+
+      const size_t bound = log2_ceil(data.size() + 1U) + 2U;
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        counts().reset();
+        CHECK(data.find(keys[i]) != data.end());
+        CHECK(counts().comparisons <= bound);
+      }
+
+      counts().reset();
+      data.erase(keys[0]);
+
+      CHECK(counts().comparisons <= bound);
+      CHECK_EQUAL(0U, counts().copies + counts().moves);
+    }
+
+    //*************************************************************************
+    TEST(test_flat_set_insert)
+    {
+      typedef etl::flat_set<Counted, Size> Set;
+
+      Set data;
+      std::vector<int> keys = shuffled_keys();
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        const size_t bound = log2_ceil(data.size() + 1U) + 3U;
+
+        counts().reset();
+        data.insert(Counted(keys[i]));
+
+        CHECK(counts().comparisons <= bound);
+        CHECK(counts().copies + counts().moves <= 2U);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_map_and_set_insert_and_find)
+    {
+      typedef etl::map<int, int, Size, CountingLess<int> > Map;
+      typedef etl::set<int, Size, CountingLess<int> >      Set;
+
+      Map map;
+      Set set;
+      std::vector<int> keys = shuffled_keys();
+
+      // A red-black tree is at most 2.log2(n + 1) deep.
+      const size_t bound = 2U * (2U * log2_ceil(Size + 1U)) + 2U;
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        counts().reset();
+        map.insert(Map::value_type(keys[i], keys[i]));
+        CHECK(counts().comparisons <= bound);
+
+        counts().reset();
+        set.insert(keys[i]);
+        CHECK(counts().comparisons <= bound);
+      }
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        counts().reset();
+        CHECK(map.find(keys[i]) != map.end());
+        CHECK(counts().comparisons <= bound);
+
+        counts().reset();
+        CHECK(set.find(keys[i]) != set.end());
+        CHECK(counts().comparisons <= bound);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_map_insert_and_find)
+    {
+      typedef etl::unordered_map<int, int, Size, Size, CountingHash<int>, CountingEqual<int> > Map;
+
+      Map data;
+      std::vector<int> keys = shuffled_keys();
+
+      size_t total_comparisons = 0U;
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        counts().reset();
+        data.insert(Map::value_type(keys[i], keys[i]));
+
+        // One hash, whatever the size.
+        CHECK_EQUAL(1U, counts().hashes);
+        total_comparisons += counts().comparisons;
+      }
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        counts().reset();
+        CHECK(data.find(keys[i]) != data.end());
+
+        CHECK_EQUAL(1U, counts().hashes);
+        total_comparisons += counts().comparisons;
+      }
+
+      // Constant on average.
+      CHECK(total_comparisons <= 4U * Size);
+    }
+
+    //*************************************************************************
+    TEST(test_priority_queue_push_and_pop)
+    {
+      typedef etl::priority_queue<int, Size, etl::vector<int, Size>, CountingLess<int> > Queue;
+
+      Queue queue;
+      std::vector<int> keys = shuffled_keys();
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        counts().reset();
+        queue.push(keys[i]);
+        CHECK(counts().comparisons <= log2_ceil(queue.size()) + 1U);
+      }
+
+      while (!queue.empty())
+      {
+        const size_t bound = 2U * log2_ceil(queue.size()) + 1U;
+
+        counts().reset();
+        queue.pop();
+        CHECK(counts().comparisons <= bound);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_sort)
+    {
+      std::vector<int> keys = shuffled_keys();
+
+      counts().reset();
+      etl::sort(keys.begin(), keys.end(), CountingLess<int>());
+
+      CHECK(etl::is_sorted(keys.begin(), keys.end()));
+      CHECK(counts().comparisons <= 2U * Size * log2_ceil(Size));
+    }
+
+    //*************************************************************************
+    TEST(test_sort_sorted_and_reversed)
+    {
+      std::vector<int> keys;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        keys.push_back(static_cast<int>(i));
+      }
+
+      counts().reset();
+      etl::sort(keys.begin(), keys.end(), CountingLess<int>());
+      CHECK(counts().comparisons <= 2U * Size * log2_ceil(Size));
+
+      etl::reverse(keys.begin(), keys.end());
+
+      counts().reset();
+      etl::sort(keys.begin(), keys.end(), CountingLess<int>());
+      CHECK(counts().comparisons <= 2U * Size * log2_ceil(Size));
+    }
+
+    //*************************************************************************
+    TEST(test_stable_sort)
+    {
+      std::vector<int> keys = shuffled_keys();
+
+      counts().reset();
+      etl::stable_sort(keys.begin(), keys.end(), CountingLess<int>());
+
+      CHECK(etl::is_sorted(keys.begin(), keys.end()));
+      CHECK(counts().comparisons <= Size * log2_ceil(Size) * log2_ceil(Size));
+    }
+
+    //*************************************************************************
+    TEST(test_binary_searches)
+    {
+      std::vector<int> keys = shuffled_keys();
+      etl::sort(keys.begin(), keys.end());
+
+      const size_t bound = log2_ceil(Size) + 1U;
+
+      for (int key = -1; key <= static_cast<int>(Size); ++key)
+      {
+        counts().reset();
+        (void)etl::lower_bound(keys.begin(), keys.end(), key, CountingLess<int>());
+        CHECK(counts().comparisons <= bound);
+
+        counts().reset();
+        (void)etl::upper_bound(keys.begin(), keys.end(), key, CountingLess<int>());
+        CHECK(counts().comparisons <= bound);
+
+        counts().reset();
+        (void)etl::binary_search(keys.begin(), keys.end(), key, CountingLess<int>());
+        CHECK(counts().comparisons <= bound + 1U);
+
+        counts().reset();
+        (void)etl::equal_range(keys.begin(), keys.end(), key, CountingLess<int>());
+        CHECK(counts().comparisons <= (2U * bound) + 1U);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_heap_algorithms)
+    {
+      std::vector<int> keys = shuffled_keys();
+
+      counts().reset();
+      etl::make_heap(keys.begin(), keys.end(), CountingLess<int>());
+      CHECK(counts().comparisons <= 3U * Size);
+
+      counts().reset();
+      etl::pop_heap(keys.begin(), keys.end(), CountingLess<int>());
+      CHECK(counts().comparisons <= 2U * log2_ceil(Size));
+
+      counts().reset();
+      etl::push_heap(keys.begin(), keys.end(), CountingLess<int>());
+      CHECK(counts().comparisons <= log2_ceil(Size));
+    }
+
+    //*************************************************************************
+    TEST(test_linear_algorithms)
+    {
+      std::vector<int> keys = shuffled_keys();
+
+      counts().reset();
+      (void)etl::min_element(keys.begin(), keys.end(), CountingLess<int>());
+      CHECK(counts().comparisons <= Size - 1U);
+
+      counts().reset();
+      (void)etl::minmax_element(keys.begin(), keys.end(), CountingLess<int>());
+      // Two per element, as it finds the first maximum.
+      CHECK(counts().comparisons <= 2U * (Size - 1U));
+
+      counts().reset();
+      etl::nth_element(keys.begin(), keys.begin() + (Size / 2U), keys.end(), CountingLess<int>());
+      CHECK(counts().comparisons <= 8U * Size);
+
+      etl::sort(keys.begin(), keys.end());
+
+      counts().reset();
+      (void)etl::is_sorted(keys.begin(), keys.end(), CountingLess<int>());
+      CHECK(counts().comparisons <= Size - 1U);
+    }
+
+    //*************************************************************************
+    TEST(test_rotate_moves)
+    {
+      std::vector<Counted> data;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        data.push_back(Counted(static_cast<int>(i)));
+      }
+
+      counts().reset();
+      etl::rotate(data.begin(), data.begin() + 37, data.end());
+
+      CHECK_EQUAL(37, data[0].value);
+      CHECK(counts().moves + counts().copies <= 3U * Size);
+    }
+  }
+}
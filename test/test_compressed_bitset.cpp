@@ -0,0 +1,468 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <vector>
+#include <cstdlib>
+
+#include "etl/compressed_bitset.h"
+
+namespace
+{
+  typedef etl::compressed_bitset<8, 16, 2> Bitset;
+  typedef etl::compressed_bitset<8, 16, 4> Small;
+  typedef etl::compressed_bitset<8, 64, 8> Big;
+  typedef std::set<uint32_t>               Reference;
+
+  //***************************************************************************
+  struct collector
+  {
+    collector(std::vector<uint32_t>& values_)
+      : values(values_)
+    {
+    }
+
+    void operator ()(uint32_t value)
+    {
+      values.push_back(value);
+    }
+
+    std::vector<uint32_t>& values;
+  };
+
+  //***************************************************************************
+  std::vector<uint32_t> contents(const etl::icompressed_bitset& bitset)
+  {
+    std::vector<uint32_t> values;
+    bitset.for_each(collector(values));
+
+    return values;
+  }
+
+  //***************************************************************************
+  // Random values spread over a few chunks, dense enough in some to need bitmaps.
+  //***************************************************************************
+  uint32_t random_value(uint32_t n_keys, uint32_t spread)
+  {
+    const uint32_t key = static_cast<uint32_t>(rand()) % n_keys;
+
+    return (key << 16U) | ((static_cast<uint32_t>(rand()) % spread) * 3U);
+  }
+
+  SUITE(test_compressed_bitset)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Bitset bitset;
+
+      CHECK(bitset.empty());
+      CHECK_EQUAL(0U, bitset.count());
+      CHECK_EQUAL(0U, bitset.chunk_count());
+      CHECK_EQUAL(0U, bitset.bitmap_count());
+      CHECK_EQUAL(8U, bitset.max_chunks());
+      CHECK_EQUAL(2U, bitset.max_bitmaps());
+      CHECK_EQUAL(16U, bitset.array_capacity());
+      CHECK(!bitset.test(0U));
+    }
+
+    //*************************************************************************
+    TEST(test_set_test_reset)
+    {
+      Bitset bitset;
+
+      bitset.set(5U);
+      bitset.set(0x12345678UL);
+      bitset.set(0xFFFFFFFFUL);
+      bitset.set(5U);
+
+      CHECK_EQUAL(3U, bitset.count());
+      CHECK_EQUAL(3U, bitset.chunk_count());
+      CHECK(bitset.test(5U));
+      CHECK(bitset.test(0x12345678UL));
+      CHECK(bitset.test(0xFFFFFFFFUL));
+      CHECK(!bitset.test(6U));
+      CHECK(!bitset.test(0x12340005UL));
+
+      bitset.reset(0x12345678UL);
+      bitset.reset(0x12345679UL);
+
+      CHECK_EQUAL(2U, bitset.count());
+      CHECK_EQUAL(2U, bitset.chunk_count());
+      CHECK(!bitset.test(0x12345678UL));
+
+      bitset.clear();
+
+      CHECK(bitset.empty());
+      CHECK(!bitset.test(5U));
+    }
+
+    //*************************************************************************
+    TEST(test_array_converts_to_bitmap_and_back)
+    {
+      Bitset bitset;
+
+      for (uint32_t i = 0U; i < 16U; ++i)
+      {
+        bitset.set(0x10000UL + (i * 100U));
+      }
+
+      CHECK_EQUAL(0U, bitset.bitmap_count());
+
+      bitset.set(0x1FFFFUL);
+
+      CHECK_EQUAL(1U, bitset.bitmap_count());
+      CHECK_EQUAL(17U, bitset.count());
+      CHECK(bitset.test(0x1FFFFUL));
+      CHECK(bitset.test(0x10000UL + 1500U));
+      CHECK(!bitset.test(0x10000UL + 1501U));
+
+      // Converts back once at half of the array capacity.
+      for (uint32_t i = 0U; i < 8U; ++i)
+      {
+        bitset.reset(0x10000UL + (i * 100U));
+      }
+
+      CHECK_EQUAL(1U, bitset.bitmap_count());
+
+      bitset.reset(0x1FFFFUL);
+
+      CHECK_EQUAL(0U, bitset.bitmap_count());
+      CHECK_EQUAL(8U, bitset.count());
+
+      std::vector<uint32_t> expected;
+
+      for (uint32_t i = 8U; i < 16U; ++i)
+      {
+        expected.push_back(0x10000UL + (i * 100U));
+      }
+
+      std::vector<uint32_t> values = contents(bitset);
+      CHECK_ARRAY_EQUAL(expected.data(), values.data(), expected.size());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Bitset bitset;
+
+      for (uint32_t key = 0U; key < 8U; ++key)
+      {
+        bitset.set(key << 16U);
+      }
+
+      CHECK_THROW(bitset.set(8UL << 16U), etl::compressed_bitset_full);
+      CHECK(!bitset.test(8UL << 16U));
+
+      // Fill the bitmaps.
+      for (uint32_t key = 0U; key < 2U; ++key)
+      {
+        for (uint32_t i = 0U; i < 17U; ++i)
+        {
+          bitset.set((key << 16U) + i);
+        }
+      }
+
+      CHECK_EQUAL(2U, bitset.bitmap_count());
+
+      for (uint32_t i = 0U; i < 16U; ++i)
+      {
+        bitset.set((2UL << 16U) + i);
+      }
+
+      CHECK_THROW(bitset.set((2UL << 16U) + 16U), etl::compressed_bitset_full);
+      CHECK_EQUAL(17U + 17U + 16U + 5U, bitset.count());
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_is_ascending)
+    {
+      Big       bitset;
+      Reference reference;
+
+      srand(1U);
+
+      for (size_t i = 0U; i < 500U; ++i)
+      {
+        const uint32_t value = random_value(3U, 400U);
+        bitset.set(value);
+        reference.insert(value);
+      }
+
+      std::vector<uint32_t> expected(reference.begin(), reference.end());
+      std::vector<uint32_t> values = contents(bitset);
+
+      CHECK_EQUAL(expected.size(), bitset.count());
+      CHECK_EQUAL(expected.size(), values.size());
+      CHECK_ARRAY_EQUAL(expected.data(), values.data(), expected.size());
+    }
+
+    //*************************************************************************
+    TEST(test_random_set_reset_match_reference)
+    {
+      Small     bitset;
+      Reference reference;
+
+      srand(2U);
+
+      for (size_t i = 0U; i < 5000U; ++i)
+      {
+        const uint32_t value = random_value(4U, 40U);
+
+        if ((rand() % 3) == 0)
+        {
+          bitset.reset(value);
+          reference.erase(value);
+        }
+        else
+        {
+          bitset.set(value);
+          reference.insert(value);
+        }
+
+        CHECK_EQUAL(reference.count(value) != 0U, bitset.test(value));
+      }
+
+      std::vector<uint32_t> expected(reference.begin(), reference.end());
+      std::vector<uint32_t> values = contents(bitset);
+
+      CHECK_EQUAL(expected.size(), values.size());
+      CHECK_ARRAY_EQUAL(expected.data(), values.data(), expected.size());
+    }
+
+    //*************************************************************************
+    TEST(test_intersection_union_match_reference)
+    {
+      for (unsigned seed = 1U; seed < 20U; ++seed)
+      {
+        srand(seed);
+
+        Small     a;
+        Big       b;
+        Reference ra;
+        Reference rb;
+
+        const uint32_t spread_a = (seed % 2U) ? 10U : 300U;
+        const uint32_t spread_b = (seed % 3U) ? 200U : 20U;
+
+        for (size_t i = 0U; i < 100U; ++i)
+        {
+          uint32_t value = random_value(4U, spread_a);
+          a.set(value);
+          ra.insert(value);
+
+          for (size_t j = 0U; j < 4U; ++j)
+          {
+            value = random_value(5U, spread_b);
+            b.set(value);
+            rb.insert(value);
+          }
+        }
+
+        bool common = false;
+
+        for (Reference::const_iterator itr = ra.begin(); itr != ra.end(); ++itr)
+        {
+          common = common || (rb.count(*itr) != 0U);
+        }
+
+        CHECK_EQUAL(common, a.intersects(b));
+        CHECK_EQUAL(common, b.intersects(a));
+
+        // Intersection.
+        Small intersection(a);
+        intersection &= b;
+
+        std::vector<uint32_t> expected;
+
+        for (Reference::const_iterator itr = ra.begin(); itr != ra.end(); ++itr)
+        {
+          if (rb.count(*itr) != 0U)
+          {
+            expected.push_back(*itr);
+          }
+        }
+
+        std::vector<uint32_t> values = contents(intersection);
+        CHECK_EQUAL(expected.size(), values.size());
+        CHECK_ARRAY_EQUAL(expected.data(), values.data(), expected.size());
+        CHECK_EQUAL(expected.size(), intersection.count());
+
+        // Union.
+        Big united;
+        united = b;
+        united |= a;
+
+        Reference ru(ra);
+        ru.insert(rb.begin(), rb.end());
+        expected.assign(ru.begin(), ru.end());
+
+        values = contents(united);
+        CHECK_EQUAL(expected.size(), values.size());
+        CHECK_ARRAY_EQUAL(expected.data(), values.data(), expected.size());
+        CHECK_EQUAL(expected.size(), united.count());
+
+        // The inputs are unchanged.
+        CHECK_EQUAL(ra.size(), a.count());
+        CHECK_EQUAL(rb.size(), b.count());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_intersection_with_self_and_empty)
+    {
+      Bitset bitset;
+      Bitset empty;
+
+      bitset.set(1U);
+      bitset.set(0x20002UL);
+
+      bitset &= bitset;
+      bitset |= bitset;
+      CHECK_EQUAL(2U, bitset.count());
+
+      CHECK(!bitset.intersects(empty));
+
+      bitset &= empty;
+      CHECK(bitset.empty());
+      CHECK_EQUAL(0U, bitset.chunk_count());
+
+      // The released chunks are available again.
+      for (uint32_t key = 0U; key < 8U; ++key)
+      {
+        bitset.set(key << 16U);
+      }
+
+      CHECK_EQUAL(8U, bitset.count());
+    }
+
+    //*************************************************************************
+    TEST(test_intersection_with_larger_array_capacity)
+    {
+      Bitset a;
+      Big    b;
+
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        a.set(i);
+        a.set(0x50000UL + i);
+      }
+
+      for (uint32_t i = 0U; i < 50U; ++i)
+      {
+        b.set(i * 2U);
+        b.set(0x30000UL + i);
+      }
+
+      CHECK_EQUAL(2U, a.bitmap_count());
+      CHECK_EQUAL(0U, b.bitmap_count());
+      CHECK(a.intersects(b));
+
+      // Chunk 0 keeps more values than a's array capacity, so stays a bitmap.
+      // Chunk 5 is not in b, so it and its bitmap are released.
+      a &= b;
+
+      CHECK_EQUAL(50U, a.count());
+      CHECK_EQUAL(1U, a.chunk_count());
+      CHECK_EQUAL(1U, a.bitmap_count());
+      CHECK(a.test(98U));
+      CHECK(!a.test(99U));
+
+      a.reset(98U);
+      CHECK(!a.intersects(Big()));
+
+      Big c;
+      c.set(0x70000UL);
+      CHECK(!a.intersects(c));
+    }
+
+    //*************************************************************************
+    TEST(test_union_full)
+    {
+      Bitset a;
+      Big    b;
+
+      for (uint32_t key = 0U; key < 8U; ++key)
+      {
+        a.set(key << 16U);
+        b.set((key + 1U) << 16U);
+      }
+
+      CHECK_THROW(a |= b, etl::compressed_bitset_full);
+
+      // Needs three bitmaps.
+      Bitset c;
+      Big    d;
+
+      for (uint32_t key = 0U; key < 3U; ++key)
+      {
+        for (uint32_t i = 0U; i < 20U; ++i)
+        {
+          d.set((key << 16U) + i);
+        }
+      }
+
+      CHECK_THROW(c |= d, etl::compressed_bitset_full);
+      CHECK_EQUAL(2U, c.bitmap_count());
+
+      // The chunk that could not be filled is not kept.
+      CHECK_EQUAL(2U, c.chunk_count());
+      CHECK_EQUAL(40U, c.count());
+      CHECK(!c.test(2U << 16U));
+
+      // Its slot is free again.
+      c.set(3U << 16U);
+      CHECK_EQUAL(3U, c.chunk_count());
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      Bitset bitset;
+
+      for (uint32_t i = 0U; i < 40U; ++i)
+      {
+        bitset.set(i * 7U);
+      }
+
+      Bitset copy(bitset);
+
+      CHECK_EQUAL(bitset.count(), copy.count());
+      CHECK_EQUAL(1U, copy.bitmap_count());
+
+      std::vector<uint32_t> expected = contents(bitset);
+      std::vector<uint32_t> values   = contents(copy);
+      CHECK_ARRAY_EQUAL(expected.data(), values.data(), expected.size());
+
+      copy.reset(0U);
+      CHECK(bitset.test(0U));
+    }
+  }
+}
@@ -0,0 +1,284 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/compressed_series.h"
+
+#include <vector>
+#include <limits>
+#include <string.h>
+
+#if ETL_USING_64BIT_TYPES
+
+namespace
+{
+  //***************************************************************************
+  // Pseudo random numbers.
+  //***************************************************************************
+  uint32_t next_random(uint32_t& state)
+  {
+    state ^= state << 13U;
+    state ^= state >> 17U;
+    state ^= state << 5U;
+
+    return state;
+  }
+
+  //***************************************************************************
+  template <typename TSeries, typename T>
+  void check_series(const TSeries& series, const std::vector<uint32_t>& times, const std::vector<T>& values)
+  {
+    CHECK_EQUAL(times.size(), series.size());
+
+    size_t i = 0U;
+
+    for (typename TSeries::const_iterator itr = series.begin(); itr != series.end(); ++itr)
+    {
+      CHECK(i < times.size());
+
+      if (i < times.size())
+      {
+        CHECK_EQUAL(times[i], itr->time);
+        // Compare the bits, so that signed zeros and infinities are checked exactly.
+        CHECK(memcmp(&values[i], &itr->value, sizeof(T)) == 0);
+      }
+
+      ++i;
+    }
+
+    CHECK_EQUAL(times.size(), i);
+  }
+
+  SUITE(test_compressed_series)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::compressed_series<float, 256> series;
+
+      CHECK(series.empty());
+      CHECK_EQUAL(0U, series.size());
+      CHECK_EQUAL(0U, series.size_bytes());
+      CHECK(series.begin() == series.end());
+    }
+
+    //*************************************************************************
+    TEST(test_regular_floats)
+    {
+      etl::compressed_series<float, 1024> series;
+
+      std::vector<uint32_t> times;
+      std::vector<float>    values;
+
+      const float specials[] = { 0.0f, -0.0f, std::numeric_limits<float>::infinity(), -1.5f, 1.0e-30f, 3.0e30f };
+
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        const float value = (i < 6U) ? specials[i] : 20.0f + (float(i % 7U) * 0.1f);
+
+        series.push_back(1000U + (i * 10U), value);
+        times.push_back(1000U + (i * 10U));
+        values.push_back(value);
+      }
+
+      check_series(series, times, values);
+
+      CHECK_EQUAL(1990U, series.back().time);
+      CHECK_EQUAL(values.back(), series.back().value);
+    }
+
+    //*************************************************************************
+    TEST(test_irregular_timestamps)
+    {
+      etl::compressed_series<double, 4096> series;
+
+      std::vector<uint32_t> times;
+      std::vector<double>   values;
+
+      uint32_t state = 0x2468ACE1UL;
+      uint32_t time  = 0xFFFFFF00UL; // Wraps.
+
+      for (uint32_t i = 0U; i < 300U; ++i)
+      {
+        const uint32_t r = next_random(state);
+
+        switch (r % 5U)
+        {
+          case 0U: time += 1U;              break;
+          case 1U: time += (r >> 8U) % 100U;  break;
+          case 2U: time += (r >> 8U) % 3000U; break;
+          case 3U: time += r;                break;
+          default: time -= (r >> 8U) % 50U;   break;
+        }
+
+        const double value = double(int32_t(next_random(state))) / 1024.0;
+
+        series.push_back(time, value);
+        times.push_back(time);
+        values.push_back(value);
+      }
+
+      check_series(series, times, values);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_values)
+    {
+      etl::compressed_series<int16_t, 256> series16;
+      etl::compressed_series<int64_t, 512> series64;
+
+      std::vector<uint32_t> times;
+      std::vector<int16_t>  values16;
+      std::vector<int64_t>  values64;
+
+      uint32_t state = 0x13579BDFUL;
+
+      for (uint32_t i = 0U; i < 40U; ++i)
+      {
+        const int16_t value16 = int16_t(int16_t(next_random(state)) >> (i % 12U));
+        const int64_t value64 = (int64_t(next_random(state)) << 32U) - int64_t(i);
+
+        series16.push_back(i, value16);
+        series64.push_back(i, value64);
+        times.push_back(i);
+        values16.push_back(value16);
+        values64.push_back(value64);
+      }
+
+      check_series(series16, times, values16);
+      check_series(series64, times, values64);
+    }
+
+    //*************************************************************************
+    TEST(test_evicts_oldest_block)
+    {
+      typedef etl::compressed_series<float, 256, 32> Series;
+
+      Series series;
+
+      std::vector<uint32_t> times;
+      std::vector<float>    values;
+
+      uint32_t state = 0x0BADBEEFUL;
+
+      for (uint32_t i = 0U; i < 2000U; ++i)
+      {
+        const float value = float(next_random(state) % 1000U);
+
+        series.push_back(i * 100U, value);
+        times.push_back(i * 100U);
+        values.push_back(value);
+
+        CHECK(series.size_bytes() <= 256U);
+      }
+
+      CHECK_EQUAL(Series::Block_Count, series.block_count());
+      CHECK(series.size() < times.size());
+
+      // The newest samples are kept.
+      times.erase(times.begin(), times.end() - series.size());
+      values.erase(values.begin(), values.end() - series.size());
+
+      check_series(series, times, values);
+    }
+
+    //*************************************************************************
+    TEST(test_compression)
+    {
+      // A slowly changing temperature, sampled every second.
+      etl::compressed_series<float, 4096> series;
+
+      uint32_t state = 0x7654321UL;
+      int      tenths = 215;
+
+      for (uint32_t i = 0U; i < 50000U; ++i)
+      {
+        if ((next_random(state) % 16U) == 0U)
+        {
+          tenths += ((next_random(state) % 2U) == 0U) ? 1 : -1;
+        }
+
+        series.push_back(i * 1000U, float(tenths) / 10.0f);
+      }
+
+      // An etl::circular_buffer<float, 1024> has 4096 bytes of values, without the timestamps.
+      CHECK(series.size() > (7U * 1024U));
+      CHECK_EQUAL(49999000U, series.back().time);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::compressed_series<float, 256> series;
+
+      series.push_back(1U, 1.0f);
+      series.push_back(2U, 2.0f);
+      series.clear();
+
+      CHECK(series.empty());
+      CHECK(series.begin() == series.end());
+
+      etl::compressed_series<float, 256>::value_type sample = { 3U, 3.0f };
+      series.push_back(sample);
+
+      CHECK_EQUAL(1U, series.size());
+      CHECK_EQUAL(3U, series.begin()->time);
+      CHECK_EQUAL(3.0f, series.begin()->value);
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      etl::compressed_series<float, 256> series;
+
+      for (uint32_t i = 0U; i < 50U; ++i)
+      {
+        series.push_back(i, float(i));
+      }
+
+      etl::compressed_series<float, 256> copy(series);
+
+      series.clear();
+
+      uint32_t i = 0U;
+
+      for (etl::compressed_series<float, 256>::const_iterator itr = copy.begin(); itr != copy.end(); itr++)
+      {
+        CHECK_EQUAL(i, itr->time);
+        CHECK_EQUAL(float(i), (*itr).value);
+        ++i;
+      }
+
+      CHECK_EQUAL(50U, i);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,226 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/container_statistics.h"
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/queue.h"
+#include "etl/map.h"
+#include "etl/unordered_map.h"
+
+#if ETL_HAS_CONTAINER_STATISTICS
+
+namespace
+{
+  uint32_t ticks = 0U;
+
+  // Every read of the clock advances it by one tick.
+  uint32_t get_ticks()
+  {
+    return ticks++;
+  }
+
+  // Puts every key in the same bucket.
+  struct CollidingHash
+  {
+    size_t operator ()(int) const
+    {
+      return 0U;
+    }
+  };
+
+  typedef etl::container_statistics Statistics;
+
+  SUITE(test_container_statistics)
+  {
+    //*************************************************************************
+    TEST(test_vector)
+    {
+      etl::vector<int, 10> data;
+
+      const Statistics& statistics = data.get_statistics();
+
+      CHECK_EQUAL(0U, statistics.operation_count(Statistics::Insert));
+      CHECK_EQUAL(0U, statistics.peak_size());
+
+      data.push_back(1);
+      data.push_back(2);
+      data.emplace_back(3);
+      data.insert(data.begin(), 4);
+      data.pop_back();
+      data.erase(data.begin());
+
+      CHECK_EQUAL(4U, statistics.operation_count(Statistics::Insert));
+      CHECK_EQUAL(2U, statistics.operation_count(Statistics::Erase));
+      CHECK_EQUAL(0U, statistics.operation_count(Statistics::Find));
+      CHECK_EQUAL(2U, statistics.size());
+      CHECK_EQUAL(4U, statistics.peak_size());
+      CHECK_EQUAL(0U, statistics.total_probe_length());
+    }
+
+    //*************************************************************************
+    TEST(test_deque_and_queue)
+    {
+      etl::deque<int, 10> data;
+      etl::queue<int, 10> queue;
+
+      data.push_back(1);
+      data.push_front(2);
+      data.emplace_front(3);
+      data.pop_back();
+
+      queue.push(1);
+      queue.push(2);
+      queue.pop();
+
+      CHECK_EQUAL(3U, data.get_statistics().operation_count(Statistics::Insert));
+      CHECK_EQUAL(1U, data.get_statistics().operation_count(Statistics::Erase));
+      CHECK_EQUAL(3U, data.get_statistics().peak_size());
+
+      CHECK_EQUAL(2U, queue.get_statistics().operation_count(Statistics::Insert));
+      CHECK_EQUAL(1U, queue.get_statistics().operation_count(Statistics::Erase));
+      CHECK_EQUAL(1U, queue.get_statistics().size());
+      CHECK_EQUAL(2U, queue.get_statistics().peak_size());
+    }
+
+    //*************************************************************************
+    TEST(test_map)
+    {
+      etl::map<int, int, 10> data;
+      const etl::imap<int, int>& idata = data;
+
+      data.insert(etl::make_pair(1, 10));
+      data.insert(etl::make_pair(2, 20));
+      data.insert(etl::make_pair(3, 30));
+      data.find(2);
+      idata.find(4);
+      data.erase(1);
+
+      CHECK_EQUAL(3U, idata.get_statistics().operation_count(Statistics::Insert));
+      CHECK_EQUAL(2U, idata.get_statistics().operation_count(Statistics::Find));
+      CHECK_EQUAL(1U, idata.get_statistics().operation_count(Statistics::Erase));
+      CHECK_EQUAL(3U, idata.get_statistics().peak_size());
+      CHECK_EQUAL(2U, idata.get_statistics().size());
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_map_probe_lengths)
+    {
+      etl::unordered_map<int, int, 8, 8, CollidingHash> data;
+
+      const Statistics& statistics = data.get_statistics();
+
+      // Each insert compares the keys already in the chain.
+      data.insert(etl::make_pair(1, 10)); // 0
+      data.insert(etl::make_pair(2, 20)); // 1
+      data.insert(etl::make_pair(3, 30)); // 2
+      data.insert(etl::make_pair(4, 40)); // 3
+
+      data.find(4); // 4
+      data.find(9); // 4
+      data.erase(1); // 1
+
+      CHECK_EQUAL(4U, statistics.operation_count(Statistics::Insert));
+      CHECK_EQUAL(2U, statistics.operation_count(Statistics::Find));
+      CHECK_EQUAL(1U, statistics.operation_count(Statistics::Erase));
+
+      CHECK_EQUAL(1U, statistics.probe_count(0U));
+      CHECK_EQUAL(2U, statistics.probe_count(1U));
+      CHECK_EQUAL(1U, statistics.probe_count(2U));
+      CHECK_EQUAL(1U, statistics.probe_count(3U));
+      CHECK_EQUAL(2U, statistics.probe_count(4U));
+      CHECK_EQUAL(15U, statistics.total_probe_length());
+      CHECK_EQUAL(4U, statistics.max_probe_length());
+    }
+
+    //*************************************************************************
+    TEST(test_long_probes_share_the_last_bucket)
+    {
+      etl::unordered_map<int, int, 20, 8, CollidingHash> data;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data.insert(etl::make_pair(i, i));
+      }
+
+      const Statistics& statistics = data.get_statistics();
+
+      CHECK_EQUAL(20U - (Statistics::Probe_Buckets - 1U), statistics.probe_count(Statistics::Probe_Buckets - 1U));
+      CHECK_EQUAL(19U, statistics.max_probe_length());
+    }
+
+    //*************************************************************************
+    TEST(test_latency)
+    {
+      etl::vector<int, 10> data;
+      Statistics& statistics = data.get_statistics();
+
+      // Without a clock, nothing is timed.
+      data.push_back(1);
+      CHECK_EQUAL(0U, statistics.latency_count(Statistics::Insert, 0U));
+      CHECK_EQUAL(0U, statistics.latency_count(Statistics::Insert, 1U));
+
+      statistics.set_clock(Statistics::clock_type::create<get_ticks>());
+
+      // The clock is read at the start and end, so each operation takes one tick.
+      data.push_back(2);
+      data.push_back(3);
+      data.pop_back();
+
+      CHECK_EQUAL(2U, statistics.latency_count(Statistics::Insert, 1U));
+      CHECK_EQUAL(1U, statistics.latency_count(Statistics::Erase, 1U));
+      CHECK_EQUAL(0U, statistics.latency_count(Statistics::Find, 1U));
+
+      statistics.clear_clock();
+      data.push_back(4);
+      CHECK_EQUAL(2U, statistics.latency_count(Statistics::Insert, 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_reset)
+    {
+      etl::vector<int, 10> data;
+
+      data.push_back(1);
+      data.push_back(2);
+      data.push_back(3);
+      data.pop_back();
+
+      data.get_statistics().reset();
+
+      CHECK_EQUAL(0U, data.get_statistics().operation_count(Statistics::Insert));
+      CHECK_EQUAL(0U, data.get_statistics().operation_count(Statistics::Erase));
+      CHECK_EQUAL(2U, data.get_statistics().size());
+      CHECK_EQUAL(2U, data.get_statistics().peak_size());
+    }
+  }
+}
+
+#endif
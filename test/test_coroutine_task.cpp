@@ -0,0 +1,392 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/coroutine_task.h"
+#include "etl/scheduler.h"
+#include "etl/queue.h"
+
+#include <string>
+#include <vector>
+
+#if ETL_HAS_COROUTINE
+
+namespace
+{
+  typedef std::vector<std::string> Log;
+
+  typedef etl::coroutine_frame_pool<512, 4> Frames;
+
+  //***************************************************************************
+  etl::coroutine count_to(etl::ipool&, Log& log, int n)
+  {
+    for (int i = 1; i <= n; ++i)
+    {
+      log.push_back(std::to_string(i));
+      co_await etl::yield();
+    }
+  }
+
+  //***************************************************************************
+  etl::coroutine blink(etl::ipool&, Log& log, uint32_t period)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      log.push_back("on");
+      co_await etl::delay(period);
+      log.push_back("off");
+      co_await etl::delay(period);
+    }
+  }
+
+  //***************************************************************************
+  etl::coroutine consume(etl::ipool&, etl::iqueue<int>& queue, int& sum)
+  {
+    while (true)
+    {
+      const int value = co_await etl::await_pop(queue);
+
+      if (value == 0)
+      {
+        co_return;
+      }
+
+      sum += value;
+    }
+  }
+
+  //***************************************************************************
+  struct Counter
+  {
+    etl::coroutine run(etl::ipool&, int n)
+    {
+      while (count < n)
+      {
+        ++count;
+        co_await etl::yield();
+      }
+    }
+
+    int count = 0;
+  };
+
+  //***************************************************************************
+  /// Runs a scheduler with a tickless idle: time jumps to the next delay.
+  //***************************************************************************
+  template <typename TPolicy, size_t Size>
+  struct Runner
+  {
+    Runner()
+      : idle_callback(*this, &Runner::on_idle)
+      , now(0U)
+    {
+      scheduler.set_idle_callback(idle_callback);
+    }
+
+    void add(etl::coroutine_task& task)
+    {
+      tasks.push_back(&task);
+      scheduler.add_task(task);
+    }
+
+    void on_idle()
+    {
+      uint32_t next = etl::timer::interval::No_Active_Interval;
+
+      for (size_t i = 0U; i < tasks.size(); ++i)
+      {
+        next = etl::min(next, tasks[i]->time_to_next());
+      }
+
+      if (next == etl::timer::interval::No_Active_Interval)
+      {
+        scheduler.exit_scheduler();
+      }
+      else
+      {
+        now += next;
+
+        for (size_t i = 0U; i < tasks.size(); ++i)
+        {
+          tasks[i]->tick(next);
+        }
+      }
+    }
+
+    etl::scheduler<TPolicy, Size>       scheduler;
+    etl::function<Runner, void>         idle_callback;
+    std::vector<etl::coroutine_task*>   tasks;
+    uint32_t                            now;
+  };
+
+  SUITE(test_coroutine_task)
+  {
+    //*************************************************************************
+    TEST(test_frame_from_pool)
+    {
+      Frames frames;
+      Log    log;
+
+      etl::coroutine c = count_to(frames, log, 3);
+
+      CHECK_TRUE(c.is_valid());
+      CHECK_EQUAL(1U, frames.size());
+      CHECK_TRUE(log.empty());
+
+      {
+        etl::coroutine moved(etl::move(c));
+
+        CHECK_FALSE(c.is_valid());
+        CHECK_TRUE(moved.is_valid());
+      }
+
+      // Destroyed without running.
+      CHECK_EQUAL(0U, frames.size());
+      CHECK_TRUE(log.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_no_frame)
+    {
+      etl::coroutine_frame_pool<512, 1> frames;
+      etl::coroutine_frame_pool<16, 1>  small_frames;
+      Log                               log;
+
+      etl::coroutine c1 = count_to(frames, log, 3);
+      etl::coroutine c2 = count_to(frames, log, 3);
+      etl::coroutine c3 = count_to(small_frames, log, 3);
+
+      CHECK_TRUE(c1.is_valid());
+      CHECK_FALSE(c2.is_valid());
+      CHECK_FALSE(c3.is_valid());
+      CHECK_EQUAL(0U, small_frames.size());
+
+      etl::coroutine_task task(1);
+
+      CHECK_THROW(task.start(etl::move(c2)), etl::coroutine_task_no_frame);
+      CHECK_FALSE(task.is_active());
+    }
+
+    //*************************************************************************
+    TEST(test_run_to_completion)
+    {
+      Frames frames;
+      Log    log;
+
+      etl::coroutine_task task(1);
+
+      CHECK_EQUAL(0U, task.task_request_work());
+
+      CHECK_TRUE(task.start(count_to(frames, log, 3)));
+      CHECK_TRUE(task.is_active());
+
+      while (task.task_request_work() > 0U)
+      {
+        task.task_process_work();
+      }
+
+      Log expected = { "1", "2", "3" };
+
+      CHECK(expected == log);
+      CHECK_FALSE(task.is_active());
+      CHECK_EQUAL(0U, frames.size());
+    }
+
+    //*************************************************************************
+    TEST(test_interleaved_tasks)
+    {
+      Frames frames;
+      Log    log1;
+      Log    log2;
+
+      etl::coroutine_task task1(1);
+      etl::coroutine_task task2(2);
+
+      task1.start(count_to(frames, log1, 2));
+      task2.start(count_to(frames, log2, 3));
+
+      Runner<etl::scheduler_policy_sequential_single, 2> runner;
+      runner.add(task1);
+      runner.add(task2);
+      runner.scheduler.start();
+
+      Log expected1 = { "1", "2" };
+      Log expected2 = { "1", "2", "3" };
+
+      CHECK(expected1 == log1);
+      CHECK(expected2 == log2);
+      CHECK_EQUAL(0U, frames.size());
+    }
+
+    //*************************************************************************
+    TEST(test_delay)
+    {
+      Frames frames;
+      Log    log;
+
+      etl::coroutine_task task(1);
+      task.start(blink(frames, log, 100U));
+
+      CHECK_EQUAL(etl::timer::interval::No_Active_Interval, task.time_to_next());
+
+      task.task_process_work();
+
+      CHECK_TRUE(task.is_waiting());
+      CHECK_EQUAL(0U,   task.task_request_work());
+      CHECK_EQUAL(100U, task.time_to_next());
+
+      CHECK_FALSE(task.tick(40U));
+      CHECK_EQUAL(60U, task.time_to_next());
+      CHECK_TRUE(task.tick(70U));
+      CHECK_EQUAL(1U, task.task_request_work());
+
+      Runner<etl::scheduler_policy_highest_priority, 1> runner;
+      runner.add(task);
+      runner.scheduler.start();
+
+      Log expected = { "on", "off", "on", "off", "on", "off" };
+
+      CHECK(expected == log);
+      CHECK_EQUAL(500U, runner.now);
+      CHECK_FALSE(task.is_active());
+    }
+
+    //*************************************************************************
+    TEST(test_await_pop)
+    {
+      Frames              frames;
+      etl::queue<int, 4>  queue;
+      int                 sum = 0;
+
+      etl::coroutine_task task(1);
+      task.start(consume(frames, queue, sum));
+
+      task.task_process_work();
+      CHECK_TRUE(task.is_waiting());
+      CHECK_EQUAL(0U, task.task_request_work());
+
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(1U, task.task_request_work());
+
+      task.task_process_work();
+      CHECK_EQUAL(3, sum);
+      CHECK_TRUE(queue.empty());
+      CHECK_TRUE(task.is_waiting());
+
+      queue.push(10);
+      queue.push(0);
+
+      while (task.task_request_work() > 0U)
+      {
+        task.task_process_work();
+      }
+
+      CHECK_EQUAL(13, sum);
+      CHECK_FALSE(task.is_active());
+    }
+
+    //*************************************************************************
+    TEST(test_member_coroutine)
+    {
+      Frames  frames;
+      Counter counter;
+
+      etl::coroutine_task task(1);
+      task.start(counter.run(frames, 5));
+
+      while (task.task_request_work() > 0U)
+      {
+        task.task_process_work();
+      }
+
+      CHECK_EQUAL(5, counter.count);
+      CHECK_EQUAL(0U, frames.size());
+    }
+
+    //*************************************************************************
+    TEST(test_ready_bitmap_policy)
+    {
+      Frames frames;
+      Log    log1;
+      Log    log2;
+
+      etl::coroutine_task task1(1);
+      etl::coroutine_task task2(2);
+
+      task1.start(blink(frames, log1, 30U));
+      task2.start(blink(frames, log2, 20U));
+
+      Runner<etl::scheduler_policy_ready_bitmap, 2> runner;
+      runner.add(task1);
+      runner.add(task2);
+
+      etl::coroutine_task::ready_callback_type ready =
+        etl::coroutine_task::ready_callback_type::create<etl::scheduler_policy_ready_bitmap, &etl::scheduler_policy_ready_bitmap::set_task_ready>(runner.scheduler.get_policy());
+
+      task1.set_ready_callback(ready);
+      task2.set_ready_callback(ready);
+      runner.scheduler.start();
+
+      Log expected = { "on", "off", "on", "off", "on", "off" };
+
+      CHECK(expected == log1);
+      CHECK(expected == log2);
+      CHECK_EQUAL(180U, runner.now);
+    }
+
+    //*************************************************************************
+    TEST(test_stop)
+    {
+      Frames frames;
+      Log    log;
+
+      etl::coroutine_task task(1);
+      task.start(blink(frames, log, 10U));
+      task.task_process_work();
+
+      CHECK_EQUAL(1U, frames.size());
+
+      task.stop();
+
+      CHECK_FALSE(task.is_active());
+      CHECK_EQUAL(0U, frames.size());
+      CHECK_EQUAL(etl::timer::interval::No_Active_Interval, task.time_to_next());
+
+      // Restarting replaces the coroutine.
+      task.start(blink(frames, log, 10U));
+      task.start(count_to(frames, log, 1));
+
+      CHECK_EQUAL(1U, frames.size());
+    }
+  }
+}
+
+#endif
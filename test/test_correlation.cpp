@@ -280,5 +280,20 @@ namespace
       covariance_result = correlation3.get_covariance();
       CHECK_CLOSE(9.17, covariance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_double_correlation_add_span_and_merge)
+    {
+      etl::correlation<etl::correlation_type::Population, double> correlation1;
+      etl::correlation<etl::correlation_type::Population, double> correlation2;
+
+      correlation1.add(etl::span<const double>(input_d.data(), 5U), etl::span<const double>(input_d_inv.data(), 5U));
+      correlation2.add(etl::span<const double>(input_d.data() + 5U, 5U), etl::span<const double>(input_d_inv.data() + 5U, 5U));
+      correlation1.merge(correlation2);
+
+      CHECK_EQUAL(input_d.size(), correlation1.count());
+      CHECK_CLOSE(-1.0, correlation1.get_correlation(), 0.0001);
+      CHECK_CLOSE(-8.25, correlation1.get_covariance(), 0.0001);
+    }
   };
 }
@@ -238,5 +238,42 @@ namespace
       covariance_result = covariance3.get_covariance();
       CHECK_CLOSE(9.17, covariance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_char_covariance_add_span_and_merge)
+    {
+      etl::covariance<etl::covariance_type::Sample, char, int32_t> covariance1;
+      etl::covariance<etl::covariance_type::Sample, char, int32_t> covariance2;
+
+      covariance1.add(etl::span<const char>(input_c.data(), 6U), etl::span<const char>(input_c_inv.data(), 6U));
+      covariance2.add(etl::span<const char>(input_c.data() + 6U, 4U), etl::span<const char>(input_c_inv.data() + 6U, 4U));
+      covariance1.merge(covariance2);
+
+      CHECK_EQUAL(input_c.size(), covariance1.count());
+      CHECK_CLOSE(-9.17, covariance1.get_covariance(), 0.01);
+    }
+
+    //*************************************************************************
+    TEST(test_double_covariance_add_span_and_merge_large_offset)
+    {
+      std::array<double, 10> input_offset;
+      std::array<double, 10> input_offset_inv;
+
+      for (size_t i = 0U; i < input_offset.size(); ++i)
+      {
+        input_offset[i]     = 1.0e9 + input_d[i];
+        input_offset_inv[i] = 1.0e9 + input_d_inv[i];
+      }
+
+      etl::covariance<etl::covariance_type::Population, double> covariance1;
+      etl::covariance<etl::covariance_type::Population, double> covariance2;
+
+      covariance1.add(etl::span<const double>(input_offset.data(), 4U), etl::span<const double>(input_offset_inv.data(), 4U));
+      covariance2.add(input_offset.begin() + 4U, input_offset.end(), input_offset_inv.begin() + 4U);
+      covariance1.merge(covariance2);
+
+      CHECK_EQUAL(input_offset.size(), covariance1.count());
+      CHECK_CLOSE(-8.25, covariance1.get_covariance(), 0.0001);
+    }
   };
 }
@@ -258,6 +258,146 @@ namespace
       uint16_t crc3 = etl::crc16_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Table size 2048 (slice-by-8)
+    //*************************************************************************
+    TEST(test_crc16_2048)
+    {
+      std::string data("123456789");
+
+      uint16_t crc = etl::crc16_t2048(data.begin(), data.end());
+
+      CHECK_EQUAL(0xBB3DU, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_2048_add_range_pointer)
+    {
+      std::string data("123456789");
+
+      etl::crc16_t2048 crc_calculator;
+
+      crc_calculator.add(data.data(), data.data() + data.size());
+
+      uint16_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xBB3DU, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_2048_add_range_pointer_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 50UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        const uint8_t* p = data.data();
+
+        uint16_t expected = etl::crc16(p, p + length);
+        uint16_t crc      = etl::crc16_t2048(p, p + length);
+
+        CHECK_EQUAL(expected, crc);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_2048_add_values_then_range_pointer)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 40UL; ++i)
+      {
+        data.push_back(uint8_t((i * 59UL) + 3UL));
+      }
+
+      etl::crc16_t2048 crc_calculator;
+
+      crc_calculator.add(data[0]);
+      crc_calculator.add(data[1]);
+      crc_calculator.add(data[2]);
+      crc_calculator.add(data.data() + 3, data.data() + data.size());
+
+      uint16_t expected = etl::crc16(data.begin(), data.end());
+      uint16_t crc      = crc_calculator.value();
+
+      CHECK_EQUAL(expected, crc);
+    }
+
+    //*************************************************************************
+    // Table size 4096 (slice-by-16)
+    //*************************************************************************
+    TEST(test_crc16_4096)
+    {
+      std::string data("123456789");
+
+      uint16_t crc = etl::crc16_t4096(data.begin(), data.end());
+
+      CHECK_EQUAL(0xBB3DU, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_4096_add_range_pointer)
+    {
+      std::string data("123456789");
+
+      etl::crc16_t4096 crc_calculator;
+
+      crc_calculator.add(data.data(), data.data() + data.size());
+
+      uint16_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xBB3DU, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_4096_add_range_pointer_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 50UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        const uint8_t* p = data.data();
+
+        uint16_t expected = etl::crc16(p, p + length);
+        uint16_t crc      = etl::crc16_t4096(p, p + length);
+
+        CHECK_EQUAL(expected, crc);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_4096_add_values_then_range_pointer)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 40UL; ++i)
+      {
+        data.push_back(uint8_t((i * 59UL) + 3UL));
+      }
+
+      etl::crc16_t4096 crc_calculator;
+
+      crc_calculator.add(data[0]);
+      crc_calculator.add(data[1]);
+      crc_calculator.add(data[2]);
+      crc_calculator.add(data.data() + 3, data.data() + data.size());
+
+      uint16_t expected = etl::crc16(data.begin(), data.end());
+      uint16_t crc      = crc_calculator.value();
+
+      CHECK_EQUAL(expected, crc);
+    }
   };
 }
 
@@ -258,6 +258,172 @@ namespace
       uint32_t crc3 = etl::crc32_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Table size 2048 (slice-by-8)
+    //*************************************************************************
+    TEST(test_crc32_2048)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_t2048(data.begin(), data.end());
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_range_pointer)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t2048 crc_calculator;
+
+      crc_calculator.add(data.data(), data.data() + data.size());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_range_pointer_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 50UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        const uint8_t* p = data.data();
+
+        uint32_t expected = etl::crc32(p, p + length);
+        uint32_t crc      = etl::crc32_t2048(p, p + length);
+
+        CHECK_EQUAL(expected, crc);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_values_then_range_pointer)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 40UL; ++i)
+      {
+        data.push_back(uint8_t((i * 59UL) + 3UL));
+      }
+
+      etl::crc32_t2048 crc_calculator;
+
+      crc_calculator.add(data[0]);
+      crc_calculator.add(data[1]);
+      crc_calculator.add(data[2]);
+      crc_calculator.add(data.data() + 3, data.data() + data.size());
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+      uint32_t crc      = crc_calculator.value();
+
+      CHECK_EQUAL(expected, crc);
+    }
+
+    //*************************************************************************
+    // Table size 4096 (slice-by-16)
+    //*************************************************************************
+    TEST(test_crc32_4096)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_t4096(data.begin(), data.end());
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_range_pointer)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t4096 crc_calculator;
+
+      crc_calculator.add(data.data(), data.data() + data.size());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_range_pointer_all_lengths)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 50UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        const uint8_t* p = data.data();
+
+        uint32_t expected = etl::crc32(p, p + length);
+        uint32_t crc      = etl::crc32_t4096(p, p + length);
+
+        CHECK_EQUAL(expected, crc);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_values_then_range_pointer)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 40UL; ++i)
+      {
+        data.push_back(uint8_t((i * 59UL) + 3UL));
+      }
+
+      etl::crc32_t4096 crc_calculator;
+
+      crc_calculator.add(data[0]);
+      crc_calculator.add(data[1]);
+      crc_calculator.add(data[2]);
+      crc_calculator.add(data.data() + 3, data.data() + data.size());
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+      uint32_t crc      = crc_calculator.value();
+
+      CHECK_EQUAL(expected, crc);
+    }
+
+    //*************************************************************************
+    // Matches the table policy, whichever back end is selected
+    //*************************************************************************
+    TEST(test_crc32_matches_table_policy)
+    {
+      typedef etl::frame_check_sequence<etl::private_crc::crc_policy<etl::private_crc::crc32_parameters, 256U> > table_crc_t;
+
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 50UL; ++i)
+      {
+        data.push_back(uint8_t((i * 37UL) + 11UL));
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        const uint8_t* p = data.data();
+
+        uint32_t expected = table_crc_t(p, p + length).value();
+
+        CHECK_EQUAL(expected, uint32_t(etl::crc32(p, p + length)));
+        CHECK_EQUAL(expected, uint32_t(etl::crc32_t4(p, p + length)));
+        CHECK_EQUAL(expected, uint32_t(etl::crc32_t2048(p, p + length)));
+      }
+    }
   };
 }
 
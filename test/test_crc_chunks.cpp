@@ -0,0 +1,231 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <vector>
+#include <stdint.h>
+
+#include "etl/crc.h"
+
+namespace
+{
+  std::vector<uint8_t> make_data(size_t length)
+  {
+    std::vector<uint8_t> data;
+
+    for (size_t i = 0UL; i < length; ++i)
+    {
+      data.push_back(uint8_t((i * 37UL) + 11UL));
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  // Checks crc_combine for every split point of a block.
+  template <typename TCrc>
+  bool check_combine(size_t length)
+  {
+    std::vector<uint8_t> data = make_data(length);
+    const uint8_t* p = data.data();
+
+    typename TCrc::value_type expected = TCrc(p, p + length).value();
+
+    for (size_t split = 0UL; split <= length; ++split)
+    {
+      typename TCrc::value_type crc_a = TCrc(p, p + split).value();
+      typename TCrc::value_type crc_b = TCrc(p + split, p + length).value();
+
+      if (etl::crc_combine<TCrc>(crc_a, crc_b, length - split) != expected)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_crc_chunks)
+  {
+    //*************************************************************************
+    TEST(test_crc_combine_8_bit)
+    {
+      CHECK(check_combine<etl::crc8_ccitt>(40));
+      CHECK(check_combine<etl::crc8_rohc>(40));
+      CHECK(check_combine<etl::crc8_itu>(40));
+      CHECK(check_combine<etl::crc8_j1850>(40));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine_16_bit)
+    {
+      CHECK(check_combine<etl::crc16>(40));
+      CHECK(check_combine<etl::crc16_ccitt>(40));
+      CHECK(check_combine<etl::crc16_genibus>(40));
+      CHECK(check_combine<etl::crc16_x25>(40));
+      CHECK(check_combine<etl::crc16_dectr>(40));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine_32_bit)
+    {
+      CHECK(check_combine<etl::crc32>(40));
+      CHECK(check_combine<etl::crc32_c>(40));
+      CHECK(check_combine<etl::crc32_bzip2>(40));
+      CHECK(check_combine<etl::crc32_mpeg2>(40));
+      CHECK(check_combine<etl::crc32_posix>(40));
+      CHECK(check_combine<etl::crc32_t4>(40));
+      CHECK(check_combine<etl::crc32_t2048>(40));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine_64_bit)
+    {
+      CHECK(check_combine<etl::crc64_ecma>(40));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine_long_second_block)
+    {
+      std::vector<uint8_t> data = make_data(5000);
+      const uint8_t* p = data.data();
+
+      uint32_t expected = etl::crc32(p, p + data.size());
+      uint32_t crc_a    = etl::crc32(p, p + 3);
+      uint32_t crc_b    = etl::crc32(p + 3, p + data.size());
+
+      CHECK_EQUAL(expected, etl::crc32::combine(crc_a, crc_b, data.size() - 3));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_chunks_split)
+    {
+      std::vector<uint8_t> data = make_data(10);
+      const uint8_t* p = data.data();
+
+      etl::crc_chunks<etl::crc32, 4> chunks(p, p + data.size(), 4);
+
+      CHECK_EQUAL(4U, chunks.size());
+      CHECK_EQUAL(4U, chunks.max_size());
+
+      CHECK_EQUAL(3U, chunks.chunk_length(0));
+      CHECK_EQUAL(3U, chunks.chunk_length(1));
+      CHECK_EQUAL(2U, chunks.chunk_length(2));
+      CHECK_EQUAL(2U, chunks.chunk_length(3));
+
+      CHECK(chunks.chunk_begin(0) == p);
+      CHECK(chunks.chunk_end(0)   == chunks.chunk_begin(1));
+      CHECK(chunks.chunk_end(1)   == chunks.chunk_begin(2));
+      CHECK(chunks.chunk_end(2)   == chunks.chunk_begin(3));
+      CHECK(chunks.chunk_end(3)   == p + data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_crc_chunks_calculate)
+    {
+      std::vector<uint8_t> data = make_data(1000);
+      const uint8_t* p = data.data();
+
+      uint32_t expected = etl::crc32(p, p + data.size());
+
+      for (size_t n = 1UL; n <= 8UL; ++n)
+      {
+        etl::crc_chunks<etl::crc32, 8> chunks(p, p + data.size(), n);
+        chunks.calculate();
+
+        CHECK_EQUAL(expected, chunks.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc_chunks_set_out_of_order)
+    {
+      std::vector<uint8_t> data = make_data(1001);
+      const uint8_t* p = data.data();
+
+      uint16_t expected = etl::crc16_ccitt(p, p + data.size());
+
+      etl::crc_chunks<etl::crc16_ccitt, 5> chunks(p, p + data.size(), 5);
+
+      for (size_t i = chunks.size(); i != 0UL; --i)
+      {
+        const size_t index = i - 1UL;
+
+        chunks.set(index, etl::crc16_ccitt(chunks.chunk_begin(index), chunks.chunk_end(index)));
+      }
+
+      CHECK_EQUAL(expected, chunks.value());
+      CHECK_EQUAL(etl::crc16_ccitt(chunks.chunk_begin(2), chunks.chunk_end(2)).value(), chunks.get(2));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_chunks_more_chunks_than_bytes)
+    {
+      std::vector<uint8_t> data = make_data(3);
+      const uint8_t* p = data.data();
+
+      uint32_t expected = etl::crc32(p, p + data.size());
+
+      etl::crc_chunks<etl::crc32, 6> chunks(p, p + data.size(), 6);
+      chunks.calculate();
+
+      CHECK_EQUAL(0U, chunks.chunk_length(5));
+      CHECK_EQUAL(expected, chunks.value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc_chunks_empty_block)
+    {
+      std::vector<uint8_t> data = make_data(1);
+      const uint8_t* p = data.data();
+
+      etl::crc_chunks<etl::crc32, 2> chunks(p, p, 2);
+      chunks.calculate();
+
+      CHECK_EQUAL(etl::crc32().value(), chunks.value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc_chunks_errors)
+    {
+      std::vector<uint8_t> data = make_data(10);
+      const uint8_t* p = data.data();
+
+      etl::crc_chunks<etl::crc32, 4> chunks;
+
+      CHECK_THROW(chunks.assign(p, p + data.size(), 0), etl::crc_chunks_count);
+      CHECK_THROW(chunks.assign(p, p + data.size(), 5), etl::crc_chunks_count);
+
+      chunks.assign(p, p + data.size(), 2);
+
+      CHECK_THROW(chunks.set(2, 0U), etl::crc_chunks_index);
+      CHECK_THROW(chunks.calculate(2), etl::crc_chunks_index);
+    }
+  };
+}
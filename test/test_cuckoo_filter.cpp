@@ -0,0 +1,211 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <vector>
+
+#include "etl/cuckoo_filter.h"
+#include "etl/fnv_1.h"
+
+namespace
+{
+  struct hash_t
+  {
+    typedef uint32_t argument_type;
+
+    size_t operator ()(argument_type value) const
+    {
+      return etl::fnv_1a_32(reinterpret_cast<const uint8_t*>(&value), reinterpret_cast<const uint8_t*>(&value) + sizeof(value));
+    }
+  };
+
+  SUITE(test_cuckoo_filter)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      typedef etl::cuckoo_filter<uint8_t, 100, hash_t> Filter;
+      Filter filter;
+
+      CHECK_EQUAL(128, Filter::BUCKETS);
+      CHECK_EQUAL(512U, filter.capacity());
+      CHECK_EQUAL(0U, filter.size());
+      CHECK_EQUAL(0U, filter.usage());
+      CHECK(filter.empty());
+      CHECK(!filter.full());
+      CHECK(!filter.exists(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_add_exists_remove)
+    {
+      etl::cuckoo_filter<uint16_t, 64, hash_t> filter;
+
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        CHECK(filter.add(i * 13U));
+      }
+
+      CHECK_EQUAL(100U, filter.size());
+
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        CHECK(filter.exists(i * 13U));
+      }
+
+      for (uint32_t i = 0U; i < 100U; i += 2U)
+      {
+        CHECK(filter.remove(i * 13U));
+      }
+
+      CHECK_EQUAL(50U, filter.size());
+
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        if ((i % 2U) == 0U)
+        {
+          CHECK(!filter.exists(i * 13U));
+        }
+        else
+        {
+          CHECK(filter.exists(i * 13U));
+        }
+      }
+
+      CHECK(!filter.remove(1000001U));
+      CHECK_EQUAL(50U, filter.size());
+    }
+
+    //*************************************************************************
+    TEST(test_duplicates)
+    {
+      etl::cuckoo_filter<uint16_t, 16, hash_t> filter;
+
+      CHECK(filter.add(42U));
+      CHECK(filter.add(42U));
+      CHECK_EQUAL(2U, filter.size());
+
+      CHECK(filter.remove(42U));
+      CHECK(filter.exists(42U));
+      CHECK(filter.remove(42U));
+      CHECK(!filter.exists(42U));
+      CHECK(filter.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_fill)
+    {
+      typedef etl::cuckoo_filter<uint16_t, 64, hash_t> Filter;
+      Filter filter;
+
+      std::vector<uint32_t> added;
+
+      uint32_t key = 0U;
+
+      while (filter.add(key))
+      {
+        added.push_back(key);
+        key += 7U;
+
+        CHECK(added.size() <= Filter::CAPACITY);
+      }
+
+      CHECK(filter.full());
+      CHECK_EQUAL(added.size(), filter.size());
+
+      // A high load factor is reached before failing.
+      CHECK(filter.usage() > 85U);
+
+      // No false negatives, including the held aside fingerprint.
+      for (size_t i = 0UL; i < added.size(); ++i)
+      {
+        CHECK(filter.exists(added[i]));
+      }
+
+      // Removing makes room again.
+      for (size_t i = 0UL; i < added.size(); i += 2U)
+      {
+        CHECK(filter.remove(added[i]));
+      }
+
+      CHECK(!filter.full());
+
+      for (size_t i = 1UL; i < added.size(); i += 2U)
+      {
+        CHECK(filter.exists(added[i]));
+      }
+
+      CHECK(filter.add(added[0]));
+      CHECK(filter.exists(added[0]));
+    }
+
+    //*************************************************************************
+    TEST(test_false_positive_rate)
+    {
+      etl::cuckoo_filter<uint16_t, 256, hash_t> filter;
+
+      for (uint32_t i = 0U; i < 900U; ++i)
+      {
+        CHECK(filter.add(i));
+      }
+
+      size_t false_positives = 0U;
+
+      for (uint32_t i = 1000U; i < 21000U; ++i)
+      {
+        false_positives += filter.exists(i) ? 1U : 0U;
+      }
+
+      // About 0.01% expected for 16 bit fingerprints.
+      CHECK(false_positives < 20U);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::cuckoo_filter<uint8_t, 16, hash_t, 2> filter;
+
+      for (uint32_t i = 0U; i < 20U; ++i)
+      {
+        filter.add(i);
+      }
+
+      filter.clear();
+
+      CHECK(filter.empty());
+      CHECK(!filter.full());
+
+      for (uint32_t i = 0U; i < 20U; ++i)
+      {
+        CHECK(!filter.exists(i));
+      }
+    }
+  };
+}
@@ -875,5 +875,136 @@ namespace
       CHECK(key_state.add(false));
       CHECK(!key_state.is_set());
     }
+
+    //*************************************************************************
+    TEST(test_debounce_bank_types)
+    {
+      CHECK_EQUAL(1U, sizeof(etl::debounce_bank<8,  4>::mask_type));
+      CHECK_EQUAL(2U, sizeof(etl::debounce_bank<12, 4>::mask_type));
+      CHECK_EQUAL(4U, sizeof(etl::debounce_bank<32, 4>::mask_type));
+      CHECK_EQUAL(8U, sizeof(etl::debounce_bank<64, 4>::mask_type));
+
+      CHECK_EQUAL(12U, (etl::debounce_bank<12, 4>::Channels));
+      CHECK_EQUAL(4U,  (etl::debounce_bank<12, 4>::Samples));
+    }
+
+    //*************************************************************************
+    TEST(test_debounce_bank_nonbounce)
+    {
+      etl::debounce_bank<8, 4> bank;
+
+      CHECK_EQUAL(0U, bank.state());
+
+      // Channels 0 and 3 go high.
+      CHECK_EQUAL(0U, bank.add(0x09U));
+      CHECK_EQUAL(0U, bank.add(0x09U));
+      CHECK_EQUAL(0U, bank.add(0x09U));
+      CHECK_EQUAL(0U, bank.state());
+
+      CHECK_EQUAL(0x09U, bank.add(0x09U));
+      CHECK_EQUAL(0x09U, bank.state());
+      CHECK_EQUAL(0x09U, bank.changed());
+      CHECK_EQUAL(0x09U, bank.rising());
+      CHECK_EQUAL(0U,    bank.falling());
+      CHECK(bank.is_set(0U));
+      CHECK(!bank.is_set(1U));
+      CHECK(bank.has_changed(3U));
+
+      // No more changes while the inputs are stable.
+      CHECK_EQUAL(0U, bank.add(0x09U));
+      CHECK_EQUAL(0U, bank.changed());
+      CHECK(!bank.has_changed(3U));
+
+      // Channel 0 goes low, channel 7 goes high.
+      CHECK_EQUAL(0U, bank.add(0x88U));
+      CHECK_EQUAL(0U, bank.add(0x88U));
+      CHECK_EQUAL(0U, bank.add(0x88U));
+      CHECK_EQUAL(0x81U, bank.add(0x88U));
+      CHECK_EQUAL(0x88U, bank.state());
+      CHECK_EQUAL(0x80U, bank.rising());
+      CHECK_EQUAL(0x01U, bank.falling());
+    }
+
+    //*************************************************************************
+    TEST(test_debounce_bank_bounce)
+    {
+      etl::debounce_bank<16, 3> bank;
+
+      // Channel 0 bounces and restarts its count. Channel 1 is stable.
+      CHECK_EQUAL(0U, bank.add(0x0003U));
+      CHECK_EQUAL(0U, bank.add(0x0003U));
+      CHECK_EQUAL(0x0002U, bank.add(0x0002U));
+      CHECK_EQUAL(0U, bank.add(0x0003U));
+      CHECK_EQUAL(0U, bank.add(0x0003U));
+      CHECK_EQUAL(0x0001U, bank.add(0x0003U));
+      CHECK_EQUAL(0x0003U, bank.state());
+    }
+
+    //*************************************************************************
+    TEST(test_debounce_bank_initial_state_and_clear)
+    {
+      etl::debounce_bank<4, 2> bank(0xFFU);
+
+      // Only the channel bits are kept.
+      CHECK_EQUAL(0x0FU, bank.state());
+
+      CHECK_EQUAL(0U, bank.add(0x0EU));
+      CHECK_EQUAL(0x01U, bank.add(0x0EU));
+      CHECK_EQUAL(0x01U, bank.falling());
+
+      bank.clear(0x03U);
+      CHECK_EQUAL(0x03U, bank.state());
+      CHECK_EQUAL(0U, bank.changed());
+
+      // Samples above the channel count are ignored.
+      CHECK_EQUAL(0U, bank.add(0xF3U));
+      CHECK_EQUAL(0U, bank.add(0xF3U));
+    }
+
+    //*************************************************************************
+    TEST(test_debounce_bank_matches_debounce)
+    {
+      etl::debounce_bank<64, 5> bank;
+      etl::debounce<5> keys[64];
+
+      uint64_t noise = 0x123456789ABCDEF1ULL;
+      uint64_t level = 0U;
+
+      for (int tick = 0; tick < 2000; ++tick)
+      {
+        // Slowly changing levels, with bounce on top.
+        noise ^= noise << 13U;
+        noise ^= noise >> 7U;
+        noise ^= noise << 17U;
+
+        if ((tick % 37) == 0)
+        {
+          level ^= noise;
+        }
+
+        const uint64_t samples = level ^ (noise & (noise >> 3U) & (noise >> 5U));
+
+        const uint64_t changed = bank.add(samples);
+
+        for (size_t channel = 0U; channel < 64U; ++channel)
+        {
+          const bool sample = ((samples >> channel) & 1U) != 0U;
+
+          CHECK_EQUAL(keys[channel].add(sample), ((changed >> channel) & 1U) != 0U);
+          CHECK_EQUAL(keys[channel].is_set(),    bank.is_set(channel));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_debounce_bank_single_sample)
+    {
+      etl::debounce_bank<32, 1> bank;
+
+      CHECK_EQUAL(0x80000001UL, bank.add(0x80000001UL));
+      CHECK_EQUAL(0x80000001UL, bank.state());
+      CHECK_EQUAL(0x80000000UL, bank.add(0x00000001UL));
+      CHECK_EQUAL(0x00000001UL, bank.state());
+    }
   };
 }
@@ -331,6 +331,50 @@ namespace
       CHECK(!member2_called);
       CHECK(unhandled_called);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_sparse_delegate_service)
+    {
+      // CAN style ids.
+      using Sparse_Service = etl::sparse_delegate_service<0x010U, 0x123U, 0x7FFU>;
+
+      Sparse_Service service;
+
+      service.register_delegate<0x010U>(global_callback);
+      service.register_delegate(0x123U, object.callback);
+      service.register_delegate(0x124U, member_callback); // Not in the list.
+      service.register_unhandled_delegate(unhandled_callback);
+
+      service.call<0x010U>();
+      CHECK_EQUAL(0x010U, called_id);
+      CHECK(global_called);
+
+      service.call(0x123U);
+      CHECK_EQUAL(0x123U, called_id);
+      CHECK(member1_called);
+
+      // Registered, but otherwise unhandled.
+      service.call(0x7FFU);
+      CHECK_EQUAL(0x7FFU, called_id);
+      CHECK(unhandled_called);
+
+      unhandled_called = false;
+      service.call(0x124U);
+      CHECK_EQUAL(0x124U, called_id);
+      CHECK(unhandled_called);
+      CHECK(!member2_called);
+
+      // Below and above the ids.
+      unhandled_called = false;
+      service.call(0x000U);
+      CHECK(unhandled_called);
+
+      unhandled_called = false;
+      service.call(0x800U);
+      CHECK(unhandled_called);
+
+      CHECK(sizeof(Sparse_Service) < sizeof(etl::delegate_service<0x800U>));
+    }
   };
 }
 
@@ -0,0 +1,277 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <string>
+
+#include "etl/dense_flat_map.h"
+
+namespace
+{
+  typedef etl::dense_flat_map<int, std::string, 100> Data;
+  typedef etl::idense_flat_map<int, std::string>     IData;
+  typedef Data::value_type                           Pair;
+  typedef std::map<int, std::string>                 Compare_Data;
+
+  //*************************************************************************
+  std::vector<Pair> make_pairs(size_t n)
+  {
+    std::vector<Pair> pairs;
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      const int key = int((i * 37U) % 101U) * 2;
+      pairs.push_back(Pair(key, std::to_string(key)));
+    }
+
+    return pairs;
+  }
+
+  //*************************************************************************
+  bool is_same_as(const IData& data, const Compare_Data& compare)
+  {
+    if (data.size() != compare.size())
+    {
+      return false;
+    }
+
+    Compare_Data::const_iterator i_compare = compare.begin();
+
+    for (IData::const_iterator i_data = data.begin(); i_data != data.end(); ++i_data, ++i_compare)
+    {
+      if ((i_data->first != i_compare->first) || (i_data->second != i_compare->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_dense_flat_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(100U, data.max_size());
+      CHECK_EQUAL(100U, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_search_against_std_map)
+    {
+      std::vector<Pair> pairs = make_pairs(100U);
+
+      Data         data;
+      Compare_Data compare;
+
+      for (size_t i = 0U; i < pairs.size(); ++i)
+      {
+        ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(pairs[i]);
+        compare.insert(pairs[i]);
+
+        CHECK(result.second);
+        CHECK_EQUAL(pairs[i].first, result.first->first);
+        CHECK(is_same_as(data, compare));
+      }
+
+      CHECK(data.full());
+      CHECK(etl::is_sorted(data.key_data(), data.key_data() + data.size()));
+
+      const Data& cdata = data;
+
+      for (int key = -1; key < 203; ++key)
+      {
+        CHECK_EQUAL(compare.count(key), cdata.count(key));
+        CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(cdata.begin(), cdata.lower_bound(key)));
+        CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(cdata.begin(), cdata.upper_bound(key)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_duplicate)
+    {
+      Data data;
+
+      data.insert(Pair(1, "1"));
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(Pair(1, "one"));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(1U, data.size());
+      CHECK_EQUAL(std::string("1"), result.first.mapped());
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator)
+    {
+      Data data;
+
+      data[3] = "3";
+      data[1] = "1";
+      data[2] = "2";
+      data[1] = "one";
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string("one"), data[1]);
+      CHECK_EQUAL(std::string("2"),   data[2]);
+      CHECK_EQUAL(std::string("3"),   data[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data;
+      data.insert(Pair(1, "1"));
+
+      const Data& cdata = data;
+
+      data.at(1) = "one";
+      CHECK_EQUAL(std::string("one"), cdata.at(1));
+      CHECK_THROW(data.at(2), etl::dense_flat_map_out_of_bounds);
+      CHECK_THROW(cdata.at(2), etl::dense_flat_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      std::vector<Pair> pairs = make_pairs(100U);
+
+      Data data(pairs.begin(), pairs.end());
+
+      CHECK_THROW(data.insert(Pair(1, "1")), etl::dense_flat_map_full);
+      CHECK_THROW(data[1], etl::dense_flat_map_full);
+
+      // Existing keys can still be found.
+      CHECK_NO_THROW(data[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      std::vector<Pair> pairs = make_pairs(50U);
+
+      Data         data(pairs.begin(), pairs.end());
+      Compare_Data compare(pairs.begin(), pairs.end());
+
+      CHECK_EQUAL(1U, data.erase(pairs[10].first));
+      compare.erase(pairs[10].first);
+      CHECK_EQUAL(0U, data.erase(pairs[10].first));
+      CHECK(is_same_as(data, compare));
+
+      Data::iterator i_next = data.erase(data.begin() + 5);
+      compare.erase(std::next(compare.begin(), 5));
+      CHECK_EQUAL(std::next(compare.begin(), 5)->first, i_next->first);
+      CHECK(is_same_as(data, compare));
+
+      data.erase(data.begin() + 2, data.begin() + 12);
+      compare.erase(std::next(compare.begin(), 2), std::next(compare.begin(), 12));
+      CHECK(is_same_as(data, compare));
+
+      data.clear();
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      std::vector<Pair> pairs = make_pairs(20U);
+
+      Data         data(pairs.begin(), pairs.end());
+      Compare_Data compare(pairs.begin(), pairs.end());
+
+      Compare_Data::const_reverse_iterator i_compare = compare.rbegin();
+
+      for (Data::const_reverse_iterator i_data = data.crbegin(); i_data != data.crend(); ++i_data, ++i_compare)
+      {
+        CHECK_EQUAL(i_compare->first, (*i_data).first);
+      }
+
+      Data::iterator itr = data.begin();
+      itr[3].second = "changed";
+      CHECK_EQUAL(std::string("changed"), std::next(data.begin(), 3)->second);
+
+      CHECK_EQUAL(20, data.end() - data.begin());
+      CHECK(data.begin() < data.end());
+      CHECK((data.begin() + 4) == (4 + data.begin()));
+      CHECK((data.end() - 20) == data.begin());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_compare)
+    {
+      std::vector<Pair> pairs = make_pairs(20U);
+
+      Data data1(pairs.begin(), pairs.end());
+      Data data2(data1);
+      Data data3;
+
+      data3 = data1;
+
+      CHECK(data1 == data2);
+      CHECK(data1 == data3);
+
+      data3[0] = "changed";
+      CHECK(data1 != data3);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    TEST(test_move_and_emplace)
+    {
+      Data data1{ Pair(2, "2"), Pair(1, "1") };
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data1.emplace(3, 3U, 'x');
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("xxx"), result.first->second);
+
+      result = data1.emplace(3, 1U, 'y');
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("xxx"), result.first->second);
+
+      Data data2(std::move(data1));
+      CHECK(data1.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(std::string("1"), data2.at(1));
+
+      Data data3;
+      data3 = std::move(data2);
+      CHECK(data2.empty());
+      CHECK_EQUAL(3U, data3.size());
+    }
+#endif
+  }
+}
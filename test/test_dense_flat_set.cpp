@@ -0,0 +1,163 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <vector>
+#include <algorithm>
+
+#include "etl/dense_flat_set.h"
+
+namespace
+{
+  typedef etl::dense_flat_set<int, 100> Data;
+  typedef std::set<int>                 Compare_Data;
+
+  //*************************************************************************
+  std::vector<int> make_values(size_t n)
+  {
+    std::vector<int> values;
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      values.push_back(int((i * 37U) % 101U) * 2);
+    }
+
+    return values;
+  }
+
+  SUITE(test_dense_flat_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(100U, data.max_size());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_search_against_std_set)
+    {
+      std::vector<int> values = make_values(100U);
+
+      Data         data;
+      Compare_Data compare;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(values[i]);
+        compare.insert(values[i]);
+
+        CHECK(result.second);
+        CHECK_EQUAL(values[i], *result.first);
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      }
+
+      CHECK(data.full());
+      CHECK(!data.insert(values[0]).second);
+
+      for (int key = -1; key < 203; ++key)
+      {
+        CHECK_EQUAL(compare.count(key), data.count(key));
+        CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+        CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+      }
+
+      CHECK_THROW(data.insert(1), etl::dense_flat_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      std::vector<int> values = make_values(50U);
+
+      Data         data(values.begin(), values.end());
+      Compare_Data compare(values.begin(), values.end());
+
+      CHECK_EQUAL(1U, data.erase(values[10]));
+      compare.erase(values[10]);
+      CHECK_EQUAL(0U, data.erase(values[10]));
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+      Data::iterator i_next = data.erase(data.begin() + 5);
+      compare.erase(std::next(compare.begin(), 5));
+      CHECK_EQUAL(*std::next(compare.begin(), 5), *i_next);
+
+      data.erase(data.begin() + 2, data.begin() + 12);
+      compare.erase(std::next(compare.begin(), 2), std::next(compare.begin(), 12));
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_compare)
+    {
+      std::vector<int> values = make_values(20U);
+
+      Data data1(values.begin(), values.end());
+      Data data2(data1);
+      Data data3;
+
+      data3 = data1;
+
+      CHECK(data1 == data2);
+      CHECK(data1 == data3);
+
+      data3.erase(data3.begin());
+      CHECK(data1 != data3);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    TEST(test_move_and_emplace)
+    {
+      Data data1{ 3, 1, 2 };
+
+      CHECK(data1.emplace(4).second);
+      CHECK(!data1.emplace(1).second);
+
+      Data data2(std::move(data1));
+      CHECK(data1.empty());
+      CHECK_EQUAL(4U, data2.size());
+      CHECK_EQUAL(1, *data2.begin());
+
+      Data data3;
+      data3 = std::move(data2);
+      CHECK(data2.empty());
+      CHECK_EQUAL(4U, data3.size());
+    }
+#endif
+  }
+}
@@ -0,0 +1,284 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/epoch_reclaimer.h"
+#include "etl/pool.h"
+#include "etl/lock_free_memory_block_allocator.h"
+
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  const uint32_t Updates = 5000U;
+  const uint32_t Alive   = 0x600DF00DUL;
+  const uint32_t Dead    = 0xDEADDEADUL;
+
+  typedef etl::epoch_reclaimer<4U, 8U> Reclaimer;
+
+  //***************************************************************************
+  struct Node
+  {
+    Node(uint32_t value_)
+      : value(value_)
+      , check(Alive)
+    {
+    }
+
+    ~Node()
+    {
+      check = Dead;
+    }
+
+    uint32_t value;
+    uint32_t check;
+  };
+
+  typedef etl::lock_free_memory_block_allocator<sizeof(Node), alignof(Node), 32U> Allocator;
+
+  //***************************************************************************
+  /// Poisons the node as it is released, so a reader would see it.
+  //***************************************************************************
+  void destroy_node(void* p_context, void* p_object)
+  {
+    static_cast<Node*>(p_object)->~Node();
+    static_cast<Allocator*>(p_context)->release(p_object);
+  }
+
+  SUITE(test_epoch_reclaimer)
+  {
+    //*************************************************************************
+    TEST(test_register)
+    {
+      Reclaimer reclaimer;
+
+      std::vector<Reclaimer::thread_id> ids;
+
+      for (size_t i = 0U; i < Reclaimer::Max_Threads; ++i)
+      {
+        ids.push_back(reclaimer.register_thread());
+        CHECK_EQUAL(i, ids.back());
+        CHECK(reclaimer.is_registered(ids.back()));
+      }
+
+      CHECK_EQUAL(Reclaimer::No_Thread, reclaimer.register_thread());
+
+      reclaimer.unregister_thread(ids[1]);
+      CHECK(!reclaimer.is_registered(ids[1]));
+      CHECK_EQUAL(ids[1], reclaimer.register_thread());
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_thread)
+    {
+      Reclaimer reclaimer;
+
+      CHECK_THROW(reclaimer.enter(0U), etl::epoch_reclaimer_invalid_thread);
+      CHECK_THROW(reclaimer.unregister_thread(0U), etl::epoch_reclaimer_invalid_thread);
+      CHECK_THROW(reclaimer.reclaim(Reclaimer::No_Thread), etl::epoch_reclaimer_invalid_thread);
+    }
+
+    //*************************************************************************
+    TEST(test_reclaim_to_pool)
+    {
+      Reclaimer reclaimer;
+      etl::pool<Node, 4U> pool;
+
+      const Reclaimer::thread_id id = reclaimer.register_thread();
+
+      Node* p1 = pool.create(1U);
+      Node* p2 = pool.create(2U);
+
+      CHECK(reclaimer.retire(id, p1, pool));
+      CHECK(reclaimer.retire(id, p2, pool));
+      CHECK_EQUAL(2U, reclaimer.retired_count(id));
+
+      // Released once the epoch has advanced twice.
+      const uint32_t epoch = reclaimer.epoch();
+      CHECK_EQUAL(0U, reclaimer.reclaim(id));
+      CHECK_EQUAL(epoch + 1U, reclaimer.epoch());
+      CHECK_EQUAL(2U, pool.size());
+
+      CHECK_EQUAL(2U, reclaimer.reclaim(id));
+      CHECK_EQUAL(0U, pool.size());
+      CHECK_EQUAL(0U, reclaimer.retired_count(id));
+    }
+
+    //*************************************************************************
+    TEST(test_reclaim_to_allocator)
+    {
+      Reclaimer reclaimer;
+      etl::lock_free_memory_block_allocator<sizeof(Node), alignof(Node), 4U> allocator;
+
+      const Reclaimer::thread_id id = reclaimer.register_thread();
+
+      void* p = allocator.allocate(sizeof(Node), alignof(Node));
+      CHECK(p != ETL_NULLPTR);
+      CHECK(!allocator.empty());
+
+      CHECK(reclaimer.retire(id, p, allocator));
+      reclaimer.reclaim(id);
+      CHECK_EQUAL(1U, reclaimer.reclaim(id));
+      CHECK(allocator.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_thread_inside_holds_back_reclamation)
+    {
+      Reclaimer reclaimer;
+      etl::pool<Node, 8U> pool;
+
+      const Reclaimer::thread_id writer = reclaimer.register_thread();
+      const Reclaimer::thread_id reader = reclaimer.register_thread();
+
+      reclaimer.enter(reader);
+
+      CHECK(reclaimer.retire(writer, pool.create(1U), pool));
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK_EQUAL(0U, reclaimer.reclaim(writer));
+      }
+
+      reclaimer.exit(reader);
+
+      {
+        // Entering now does not protect the node retired earlier.
+        Reclaimer::guard guard(reclaimer, reader);
+
+        CHECK_EQUAL(1U, reclaimer.reclaim(writer));
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_retire_full)
+    {
+      Reclaimer reclaimer;
+      etl::pool<Node, 16U> pool;
+
+      const Reclaimer::thread_id writer = reclaimer.register_thread();
+      const Reclaimer::thread_id reader = reclaimer.register_thread();
+
+      reclaimer.enter(reader);
+
+      for (size_t i = 0U; i < Reclaimer::Max_Retired; ++i)
+      {
+        CHECK(reclaimer.retire(writer, pool.create(uint32_t(i)), pool));
+      }
+
+      Node* p = pool.create(99U);
+      CHECK(!reclaimer.retire(writer, p, pool));
+
+      reclaimer.exit(reader);
+
+      // A full list reclaims to make room.
+      reclaimer.reclaim(writer);
+      CHECK(reclaimer.retire(writer, p, pool));
+      CHECK_EQUAL(1U, reclaimer.retired_count(writer));
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      etl::epoch_reclaimer<4U, 16U> reclaimer;
+      Allocator allocator;
+
+      etl::atomic<Node*> current(::new (allocator.allocate(sizeof(Node), alignof(Node))) Node(0U));
+      etl::atomic<bool>  done(false);
+      etl::atomic<bool>  bad(false);
+
+      std::vector<std::thread> readers;
+
+      for (int r = 0; r < 3; ++r)
+      {
+        readers.push_back(std::thread([&reclaimer, &current, &done, &bad]()
+        {
+          const size_t id = reclaimer.register_thread();
+          uint32_t     last = 0U;
+
+          while (!done.load())
+          {
+            {
+              etl::epoch_reclaimer<4U, 16U>::guard guard(reclaimer, id);
+
+              const Node* p = current.load();
+
+              if ((p->check != Alive) || (p->value < last))
+              {
+                bad = true;
+              }
+
+              last = p->value;
+            }
+
+            std::this_thread::yield();
+          }
+
+          reclaimer.unregister_thread(id);
+        }));
+      }
+
+      const size_t id = reclaimer.register_thread();
+
+      for (uint32_t i = 1U; i <= Updates; ++i)
+      {
+        void* p_block = ETL_NULLPTR;
+
+        while ((p_block = allocator.allocate(sizeof(Node), alignof(Node))) == ETL_NULLPTR)
+        {
+          reclaimer.reclaim(id);
+          std::this_thread::yield();
+        }
+
+        Node* p_old = current.exchange(::new (p_block) Node(i));
+
+        while (!reclaimer.retire(id, p_old, destroy_node, &allocator))
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      done = true;
+
+      for (size_t r = 0U; r < readers.size(); ++r)
+      {
+        readers[r].join();
+      }
+
+      CHECK(!bad.load());
+    }
+  };
+}
+
+#endif
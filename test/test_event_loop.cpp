@@ -0,0 +1,324 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/event_loop.h"
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#if ETL_USING_CPP11 && ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::event_loop<4, 4> Loop;
+
+  //***************************************************************************
+  // A simulated clock and a wait that sleeps by advancing it.
+  //***************************************************************************
+  uint32_t              now = 0U;
+  std::vector<uint32_t> waits;
+  Loop*                 p_loop = ETL_NULLPTR;
+
+  uint32_t clock()
+  {
+    return now;
+  }
+
+  void wait(uint32_t timeout)
+  {
+    waits.push_back(timeout);
+
+    if (timeout == etl::timer::interval::No_Active_Interval)
+    {
+      // Nothing would ever wake us.
+      p_loop->stop();
+    }
+    else
+    {
+      now += timeout;
+    }
+  }
+
+  Loop::clock_type clock_hook = Loop::clock_type::create<clock>();
+  Loop::wait_type  wait_hook  = Loop::wait_type::create<wait>();
+
+  std::vector<int> calls;
+
+  void handler0() { calls.push_back(0); }
+  void handler1() { calls.push_back(1); }
+  void handler2() { calls.push_back(2); }
+
+  void timer_callback() { calls.push_back(100 + int(now)); }
+
+  //***************************************************************************
+  class Worker : public etl::task
+  {
+  public:
+
+    Worker()
+      : etl::task(0)
+      , work(0)
+      , processed(0)
+    {
+    }
+
+    uint32_t task_request_work() const override
+    {
+      return work;
+    }
+
+    void task_process_work() override
+    {
+      --work;
+      ++processed;
+    }
+
+    uint32_t work;
+    int      processed;
+  };
+
+  //***************************************************************************
+  struct SetupFixture
+  {
+    SetupFixture()
+    {
+      now = 0U;
+      waits.clear();
+      calls.clear();
+    }
+  };
+
+  SUITE(test_event_loop)
+  {
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_only_signalled_sources_are_dispatched)
+    {
+      Loop loop(clock_hook, wait_hook);
+
+      etl::event_loop_source_t id0 = loop.add_handler(Loop::handler_type::create<handler0>());
+      etl::event_loop_source_t id1 = loop.add_handler(Loop::handler_type::create<handler1>());
+      etl::event_loop_source_t id2 = loop.add_handler(Loop::handler_type::create<handler2>());
+
+      CHECK_EQUAL(0U, loop.dispatch());
+      CHECK(!loop.has_pending());
+
+      loop.signal(id2);
+      loop.signal(id0);
+      loop.signal(id2);
+
+      CHECK(loop.has_pending());
+      CHECK_EQUAL(2U, loop.dispatch());
+      CHECK(!loop.has_pending());
+
+      // In order of id, and repeated signals are merged.
+      std::vector<int> expected = { 0, 2 };
+      CHECK(expected == calls);
+
+      loop.signal(id1);
+      CHECK_EQUAL(1U, loop.dispatch());
+      CHECK_EQUAL(1, calls.back());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_sources_full_and_remove)
+    {
+      Loop loop(clock_hook, wait_hook);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(loop.add_handler(Loop::handler_type::create<handler0>()) != etl::event_loop_source_t(Loop::No_Source));
+      }
+
+      CHECK(loop.add_handler(Loop::handler_type::create<handler0>()) == etl::event_loop_source_t(Loop::No_Source));
+
+      loop.signal(2);
+      loop.remove(2);
+      CHECK(!loop.has_pending());
+
+      CHECK_EQUAL(2, int(loop.add_handler(Loop::handler_type::create<handler1>())));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_timers_follow_the_clock)
+    {
+      Loop loop(clock_hook, wait_hook);
+
+      etl::timer::id::type id = loop.timers().register_timer(timer_callback, 10U, etl::timer::mode::Repeating);
+      loop.timers().start(id);
+
+      CHECK_EQUAL(10U, loop.time_to_next());
+
+      now = 4U;
+      CHECK_EQUAL(6U, loop.time_to_next());
+
+      loop.dispatch();
+      CHECK(calls.empty());
+
+      now = 25U;
+      loop.dispatch();
+
+      std::vector<int> expected = { 125, 125 };
+      CHECK(expected == calls);
+      CHECK_EQUAL(5U, loop.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_run_sleeps_until_the_next_deadline)
+    {
+      Loop loop(clock_hook, wait_hook);
+      p_loop = &loop;
+
+      int count = 0;
+
+      auto stop_after_three = [&]()
+      {
+        if (++count == 3)
+        {
+          loop.timers().stop(0U);
+        }
+      };
+
+      etl::event_loop_source_t id = loop.add_handler(Loop::handler_type::create(stop_after_three));
+
+      auto signal_source = [&]() { loop.signal(id); };
+      etl::icallback_timer_wheel::callback_type callback = etl::icallback_timer_wheel::callback_type::create(signal_source);
+
+      etl::timer::id::type timer = loop.timers().register_timer(callback, 7U, etl::timer::mode::Repeating);
+      loop.timers().start(timer);
+
+      loop.run();
+
+      // Slept for each period, then forever once the timer stopped.
+      std::vector<uint32_t> expected = { 7U, 7U, 7U, etl::timer::interval::No_Active_Interval };
+      CHECK(expected == waits);
+      CHECK_EQUAL(3, count);
+      CHECK_EQUAL(21U, now);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_task_source)
+    {
+      Loop loop(clock_hook, wait_hook);
+
+      Worker worker;
+      etl::event_loop_source_t id = loop.add_task(worker);
+
+      // Nothing to do yet.
+      CHECK_EQUAL(0U, loop.dispatch());
+
+      worker.work = 2U;
+      loop.signal(id);
+
+      // One unit per dispatch, staying ready while there is more.
+      CHECK_EQUAL(1U, loop.dispatch());
+      CHECK(loop.has_pending());
+      CHECK_EQUAL(1U, loop.dispatch());
+      CHECK(!loop.has_pending());
+      CHECK_EQUAL(2, worker.processed);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_queue_from_another_thread)
+    {
+      // A wait that is woken by a counting semaphore.
+      std::mutex              mutex;
+      std::condition_variable condition;
+      int                     wakes = 0;
+
+      auto real_wait = [&](uint32_t timeout)
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        if (timeout == etl::timer::interval::No_Active_Interval)
+        {
+          condition.wait(lock, [&]() { return wakes > 0; });
+        }
+        else
+        {
+          condition.wait_for(lock, std::chrono::milliseconds(timeout), [&]() { return wakes > 0; });
+        }
+
+        if (wakes > 0)
+        {
+          --wakes;
+        }
+      };
+
+      auto real_wake = [&]()
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++wakes;
+        condition.notify_one();
+      };
+
+      Loop loop(Loop::clock_type(), Loop::wait_type::create(real_wait));
+      loop.set_wake(Loop::wake_type::create(real_wake));
+
+      const int Count = 1000;
+      int       received = 0;
+      int       total    = 0;
+
+      auto on_value = [&](const int& value)
+      {
+        total += value;
+
+        if (++received == Count)
+        {
+          loop.stop();
+        }
+      };
+
+      etl::event_loop_queue<int, 8> queue(loop, etl::event_loop_queue<int, 8>::handler_type::create(on_value));
+
+      std::thread producer([&]()
+      {
+        for (int i = 1; i <= Count; ++i)
+        {
+          while (!queue.push(i))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      loop.run();
+      producer.join();
+
+      CHECK_EQUAL(Count, received);
+      CHECK_EQUAL((Count * (Count + 1)) / 2, total);
+      CHECK(queue.empty());
+    }
+  }
+}
+
+#endif
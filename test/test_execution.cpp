@@ -0,0 +1,359 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/execution.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstring>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  void yield()
+  {
+    std::this_thread::yield();
+  }
+
+  //***************************************************************************
+  /// Runs a pool's workers on std::threads for the lifetime of the object.
+  //***************************************************************************
+  struct Workers
+  {
+    explicit Workers(size_t count)
+      : pool(count)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        threads.emplace_back([this]() { pool.run(yield); });
+      }
+    }
+
+    ~Workers()
+    {
+      pool.stop();
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+    }
+
+    etl::worker_pool         pool;
+    std::vector<std::thread> threads;
+  };
+
+  std::vector<int> make_data(size_t size)
+  {
+    std::vector<int> data(size);
+
+    uint32_t seed = 12345U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      data[i] = int(seed >> 8);
+    }
+
+    return data;
+  }
+
+  SUITE(test_execution)
+  {
+    //*************************************************************************
+    TEST(test_chunking)
+    {
+      etl::worker_pool pool(3U);
+
+      etl::execution::parallel_policy policy = etl::execution::par(pool);
+
+      CHECK_EQUAL(4U, pool.concurrency());
+      CHECK_FALSE(policy.is_deterministic_split());
+
+      // Four chunks per thread, each at least the minimum size.
+      CHECK_EQUAL(0U,     policy.chunk_count(0U));
+      CHECK_EQUAL(1U,     policy.chunk_count(100U));
+      CHECK_EQUAL(256U,   policy.chunk_size(100U));
+      CHECK_EQUAL(16U,    policy.chunk_count(100000U));
+      CHECK_EQUAL(6250U,  policy.chunk_size(100000U));
+
+      // Independent of the number of workers.
+      etl::execution::parallel_policy deterministic = policy.deterministic();
+      CHECK_TRUE(deterministic.is_deterministic_split());
+      CHECK_EQUAL(64U,   deterministic.chunk_count(100000U));
+      CHECK_EQUAL(1563U, deterministic.chunk_size(100000U));
+
+      // Fixed, but limited to Max_Chunks.
+      etl::execution::parallel_policy fixed = policy.with_chunk_size(10U);
+      CHECK_TRUE(fixed.is_deterministic_split());
+      CHECK_EQUAL(10U,  fixed.chunk_size(100U));
+      CHECK_EQUAL(10U,  fixed.chunk_count(100U));
+      CHECK_EQUAL(16U,  fixed.chunk_size(1000U));
+      CHECK_EQUAL(63U,  fixed.chunk_count(1000U));
+    }
+
+    //*************************************************************************
+    TEST(test_execute_without_workers)
+    {
+      etl::worker_pool pool(0U);
+
+      struct Context
+      {
+        static void execute(void* context, size_t chunk)
+        {
+          static_cast<std::vector<size_t>*>(context)->push_back(chunk);
+        }
+      };
+
+      std::vector<size_t> chunks;
+
+      pool.execute(Context::execute, &chunks, 5U);
+
+      std::vector<size_t> expected = { 0U, 1U, 2U, 3U, 4U };
+      CHECK(expected == chunks);
+
+      CHECK_FALSE(pool.process());
+    }
+
+    //*************************************************************************
+    TEST(test_execute_with_workers)
+    {
+      Workers workers(3U);
+
+      struct Context
+      {
+        static void execute(void* context, size_t chunk)
+        {
+          static_cast<std::atomic<size_t>*>(context)[chunk] += 1U;
+        }
+      };
+
+      for (int run = 0; run < 100; ++run)
+      {
+        std::atomic<size_t> counts[64];
+
+        for (size_t i = 0U; i < 64U; ++i)
+        {
+          counts[i] = 0U;
+        }
+
+        workers.pool.execute(Context::execute, counts, 64U);
+
+        for (size_t i = 0U; i < 64U; ++i)
+        {
+          CHECK_EQUAL(1U, counts[i].load());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_nested_execution)
+    {
+      Workers workers(2U);
+
+      etl::execution::parallel_policy policy = etl::execution::par(workers.pool).with_chunk_size(1U);
+
+      std::vector<std::vector<int>> rows(8U, std::vector<int>(100U, 0));
+
+      // The inner fills run on the thread that executes the outer chunk.
+      etl::for_each(policy, rows.begin(), rows.end(), [&policy](std::vector<int>& row)
+      {
+        etl::fill(policy, row.begin(), row.end(), 7);
+      });
+
+      for (size_t i = 0U; i < rows.size(); ++i)
+      {
+        CHECK_EQUAL(700, std::accumulate(rows[i].begin(), rows[i].end(), 0));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_for_each)
+    {
+      Workers workers(3U);
+
+      std::vector<int> data = make_data(10000U);
+      std::vector<int> expected = data;
+
+      std::for_each(expected.begin(), expected.end(), [](int& i) { i = i * 3 + 1; });
+      etl::for_each(etl::execution::par(workers.pool), data.begin(), data.end(), [](int& i) { i = i * 3 + 1; });
+
+      CHECK(expected == data);
+
+      std::vector<int> data2 = make_data(10000U);
+      etl::for_each(etl::execution::seq, data2.begin(), data2.end(), [](int& i) { i = i * 3 + 1; });
+
+      CHECK(expected == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_transform)
+    {
+      Workers workers(3U);
+
+      std::vector<int> data1 = make_data(10000U);
+      std::vector<int> data2 = make_data(20000U);
+      std::vector<int> expected(data1.size());
+      std::vector<int> output(data1.size());
+
+      std::transform(data1.begin(), data1.end(), expected.begin(), [](int i) { return i / 2; });
+      std::vector<int>::iterator result = etl::transform(etl::execution::par(workers.pool), data1.begin(), data1.end(), output.begin(), [](int i) { return i / 2; });
+
+      CHECK(expected == output);
+      CHECK(output.end() == result);
+
+      std::transform(data1.begin(), data1.end(), data2.begin(), expected.begin(), std::minus<int>());
+      result = etl::transform(etl::execution::par(workers.pool), data1.begin(), data1.end(), data2.begin(), output.begin(), std::minus<int>());
+
+      CHECK(expected == output);
+      CHECK(output.end() == result);
+
+      std::fill(output.begin(), output.end(), 0);
+      etl::transform(etl::execution::seq, data1.begin(), data1.end(), data2.begin(), output.begin(), std::minus<int>());
+
+      CHECK(expected == output);
+    }
+
+    //*************************************************************************
+    TEST(test_fill_and_copy)
+    {
+      Workers workers(3U);
+
+      std::vector<int> data(10001U, 0);
+      etl::fill(etl::execution::par(workers.pool), data.begin(), data.end(), 42);
+
+      CHECK(std::all_of(data.begin(), data.end(), [](int i) { return i == 42; }));
+
+      std::vector<int> source = make_data(10001U);
+      int* result = etl::copy(etl::execution::par(workers.pool), source.begin(), source.end(), data.data());
+
+      CHECK(source == data);
+      CHECK(data.data() + data.size() == result);
+    }
+
+    //*************************************************************************
+    TEST(test_sort)
+    {
+      Workers workers(3U);
+
+      const size_t sizes[] = { 0U, 1U, 255U, 256U, 1000U, 4097U, 100000U };
+
+      for (size_t s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); ++s)
+      {
+        std::vector<int> data     = make_data(sizes[s]);
+        std::vector<int> expected = data;
+
+        std::sort(expected.begin(), expected.end());
+        etl::sort(etl::execution::par(workers.pool), data.begin(), data.end());
+
+        CHECK(expected == data);
+
+        // Many duplicates, fixed small chunks, custom order.
+        for (size_t i = 0U; i < data.size(); ++i)
+        {
+          data[i] %= 17;
+        }
+
+        expected = data;
+
+        std::sort(expected.begin(), expected.end(), std::greater<int>());
+        etl::sort(etl::execution::par(workers.pool).with_chunk_size(100U), data.begin(), data.end(), std::greater<int>());
+
+        CHECK(expected == data);
+      }
+
+      std::vector<int> data     = make_data(1000U);
+      std::vector<int> expected = data;
+
+      std::sort(expected.begin(), expected.end());
+      etl::sort(etl::execution::seq, data.begin(), data.end());
+
+      CHECK(expected == data);
+    }
+
+    //*************************************************************************
+    TEST(test_reduce)
+    {
+      Workers workers(3U);
+
+      std::vector<int> data = make_data(100000U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] %= 1000;
+      }
+
+      const long long expected = std::accumulate(data.begin(), data.end(), 5LL);
+
+      CHECK_EQUAL(expected, etl::reduce(etl::execution::par(workers.pool), data.begin(), data.end(), 5LL));
+      CHECK_EQUAL(expected, etl::reduce(etl::execution::seq, data.begin(), data.end(), 5LL));
+      CHECK_EQUAL(5LL,      etl::reduce(etl::execution::par(workers.pool), data.begin(), data.begin(), 5LL));
+
+      const int maximum = etl::reduce(etl::execution::par(workers.pool), data.begin(), data.end(), 0, [](int a, int b) { return (a < b) ? b : a; });
+      CHECK_EQUAL(*std::max_element(data.begin(), data.end()), maximum);
+    }
+
+    //*************************************************************************
+    TEST(test_deterministic_reduce)
+    {
+      std::vector<double> data(50000U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = 1.0 / double(i + 1U);
+      }
+
+      // A floating point sum depends on the order of addition.
+      etl::worker_pool no_workers(0U);
+      const double expected = etl::reduce(etl::execution::par(no_workers).deterministic(), data.begin(), data.end(), 0.0);
+
+      for (size_t count = 1U; count < 5U; ++count)
+      {
+        Workers workers(count);
+
+        for (int run = 0; run < 10; ++run)
+        {
+          const double sum = etl::reduce(etl::execution::par(workers.pool).deterministic(), data.begin(), data.end(), 0.0);
+
+          // Bitwise equal.
+          CHECK_EQUAL(0, memcmp(&expected, &sum, sizeof(double)));
+        }
+      }
+    }
+  }
+}
+
+#endif
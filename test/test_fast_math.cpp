@@ -0,0 +1,242 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fast_math.h"
+
+#include <math.h>
+
+namespace
+{
+#if ETL_USING_CPP14
+  const double Pi = 3.14159265358979323846;
+#endif
+
+  SUITE(test_fast_math)
+  {
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_fast_sin_cos)
+    {
+      for (uint32_t angle = 0U; angle < 65536U; angle += 7U)
+      {
+        const double radians = (double(angle) / 65536.0) * 2.0 * Pi;
+
+        CHECK_CLOSE(32767.0 * sin(radians), double(etl::fast_sin(uint16_t(angle))), 2.0);
+        CHECK_CLOSE(32767.0 * cos(radians), double(etl::fast_cos(uint16_t(angle))), 2.0);
+      }
+
+      CHECK_EQUAL(0,      etl::fast_sin(0U));
+      CHECK_EQUAL(32767,  etl::fast_sin(16384U));
+      CHECK_EQUAL(0,      etl::fast_sin(32768U));
+      CHECK_EQUAL(-32767, etl::fast_sin(49152U));
+    }
+
+    //*************************************************************************
+    TEST(test_fast_atan2)
+    {
+      const int32_t radius[] = { 1, 100, 30000, 2000000000 };
+
+      for (size_t r = 0U; r < sizeof(radius) / sizeof(radius[0]); ++r)
+      {
+        for (uint32_t a = 0U; a < 65536U; a += 97U)
+        {
+          const double  radians = (double(a) / 65536.0) * 2.0 * Pi;
+          const int32_t x       = int32_t(lround(radius[r] * cos(radians)));
+          const int32_t y       = int32_t(lround(radius[r] * sin(radians)));
+
+          if ((x == 0) && (y == 0))
+          {
+            continue;
+          }
+
+          const double expected = (atan2(double(y), double(x)) / (2.0 * Pi)) * 65536.0;
+          const double actual   = double(etl::fast_atan2(y, x));
+
+          double difference = fmod(fabs(expected - actual), 65536.0);
+          difference = fmin(difference, 65536.0 - difference);
+
+          CHECK(difference <= 2.0);
+        }
+      }
+
+      CHECK_EQUAL(0U,     etl::fast_atan2(0, 0));
+      CHECK_EQUAL(0U,     etl::fast_atan2(0, 5));
+      CHECK_EQUAL(8192U,  etl::fast_atan2(5, 5));
+      CHECK_EQUAL(16384U, etl::fast_atan2(5, 0));
+      CHECK_EQUAL(32768U, etl::fast_atan2(0, -5));
+      CHECK_EQUAL(49152U, etl::fast_atan2(-5, 0));
+      CHECK_EQUAL(57344U, etl::fast_atan2(-5, 5));
+      CHECK_EQUAL(32768U, etl::fast_atan2(0, -2147483647 - 1));
+    }
+
+    //*************************************************************************
+    TEST(test_fast_sqrt)
+    {
+      for (uint32_t x = 0U; x < 100000U; ++x)
+      {
+        CHECK_CLOSE(sqrt(double(x)), double(etl::fast_sqrt(x)), 1.0);
+      }
+
+      for (uint64_t x = 100000U; x <= 0xFFFFFFFFULL; x += 65537U * 13U)
+      {
+        const double expected = sqrt(double(x));
+        CHECK_CLOSE(expected, double(etl::fast_sqrt(uint32_t(x))), fmax(1.0, expected * 2e-5));
+      }
+
+      CHECK_EQUAL(65535U, etl::fast_sqrt(0xFFFFFFFFUL));
+      CHECK_EQUAL(1U,     etl::fast_sqrt(1U));
+      CHECK_EQUAL(2U,     etl::fast_sqrt(4U));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_isqrt)
+    {
+      for (uint32_t x = 0U; x < 100000U; ++x)
+      {
+        const uint32_t root = etl::isqrt(x);
+
+        CHECK((root * root) <= x);
+        CHECK(((root + 1U) * (root + 1U)) > x);
+      }
+
+      for (uint64_t x = 100000U; x <= 0xFFFFFFFFULL; x += 65537U * 13U)
+      {
+        const uint64_t root = etl::isqrt(uint32_t(x));
+
+        CHECK((root * root) <= x);
+        CHECK(((root + 1U) * (root + 1U)) > x);
+      }
+
+      CHECK_EQUAL(15U,          etl::isqrt(uint8_t(255U)));
+      CHECK_EQUAL(255U,         etl::isqrt(uint16_t(65535U)));
+      CHECK_EQUAL(65535U,       etl::isqrt(0xFFFFFFFFUL));
+      CHECK_EQUAL(4294967295ULL, etl::isqrt(0xFFFFFFFFFFFFFFFFULL));
+      CHECK_EQUAL(3037000499ULL, etl::isqrt(9223372036854775807ULL));
+
+#if ETL_USING_CPP14
+      static_assert(etl::isqrt(1000000U) == 1000U, "isqrt is not constexpr");
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_ilog2)
+    {
+      CHECK_EQUAL(0, etl::ilog2(0U));
+      CHECK_EQUAL(0, etl::ilog2(1U));
+      CHECK_EQUAL(1, etl::ilog2(2U));
+      CHECK_EQUAL(1, etl::ilog2(3U));
+      CHECK_EQUAL(7, etl::ilog2(uint8_t(255U)));
+      CHECK_EQUAL(31, etl::ilog2(0xFFFFFFFFUL));
+      CHECK_EQUAL(63, etl::ilog2(0x8000000000000000ULL));
+
+      for (uint32_t x = 1U; x < 100000U; ++x)
+      {
+        CHECK_EQUAL(int(floor(log2(double(x)))), etl::ilog2(x));
+      }
+
+#if ETL_USING_CPP14
+      static_assert(etl::ilog2(1024U) == 10, "ilog2 is not constexpr");
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_ilog10)
+    {
+      CHECK_EQUAL(0, etl::ilog10(0U));
+
+      uint64_t power = 1U;
+
+      for (int exponent = 0; exponent < 20; ++exponent)
+      {
+        CHECK_EQUAL(exponent, etl::ilog10(power));
+
+        if (exponent != 0)
+        {
+          CHECK_EQUAL(exponent - 1, etl::ilog10(power - 1U));
+        }
+
+        if (exponent < 19)
+        {
+          CHECK_EQUAL(exponent, etl::ilog10(power * 9U));
+          power *= 10U;
+        }
+      }
+
+      for (uint32_t x = 1U; x < 100000U; ++x)
+      {
+        CHECK_EQUAL(int(floor(log10(double(x)) + 1e-9)), etl::ilog10(x));
+      }
+
+      CHECK_EQUAL(2,  etl::ilog10(uint8_t(255U)));
+      CHECK_EQUAL(4,  etl::ilog10(uint16_t(65535U)));
+      CHECK_EQUAL(9,  etl::ilog10(0xFFFFFFFFUL));
+      CHECK_EQUAL(19, etl::ilog10(0xFFFFFFFFFFFFFFFFULL));
+
+#if ETL_USING_CPP14
+      static_assert(etl::ilog10(12345U) == 4, "ilog10 is not constexpr");
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_reciprocal_q31)
+    {
+      for (int64_t value = -2147483648LL; value <= 2147483647LL; value += 104729LL)
+      {
+        if (value == 0)
+        {
+          continue;
+        }
+
+        int exponent = 0;
+        const int32_t mantissa = etl::reciprocal_q31(int32_t(value), exponent);
+
+        const double expected = 2147483648.0 / double(value);
+        const double actual   = (double(mantissa) / 2147483648.0) * pow(2.0, exponent);
+
+        CHECK(fabs(double(mantissa)) >= 1073741824.0);
+        CHECK(fabs(double(mantissa)) < 2147483648.0);
+        CHECK_CLOSE(expected, actual, fabs(expected) * 4e-9);
+      }
+
+      int exponent = 0;
+
+      CHECK_EQUAL(1073741824, etl::reciprocal_q31(1073741824, exponent)); // 1 / 0.5 = 0.5 * 2^2
+      CHECK_EQUAL(2, exponent);
+      CHECK_EQUAL(-1073741824, etl::reciprocal_q31(-2147483647 - 1, exponent)); // 1 / -1 = -0.5 * 2^1
+      CHECK_EQUAL(1, exponent);
+      CHECK_EQUAL(1073741824, etl::reciprocal_q31(1, exponent)); // 1 / 2^-31 = 0.5 * 2^32
+      CHECK_EQUAL(32, exponent);
+      CHECK_EQUAL(2147483647, etl::reciprocal_q31(0, exponent));
+      CHECK_EQUAL(31, exponent);
+    }
+  };
+}
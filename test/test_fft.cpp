@@ -0,0 +1,365 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fft.h"
+
+#include <cmath>
+#include <vector>
+#include <complex>
+
+#if ETL_USING_CPP14
+
+namespace
+{
+  typedef etl::fixed<0, 15> q15;
+  typedef etl::fixed<0, 31> q31;
+
+  //*************************************************************************
+  std::vector<std::complex<double>> dft(const std::vector<std::complex<double>>& x, bool inverse = false)
+  {
+    const size_t n = x.size();
+    const double pi = 3.14159265358979323846;
+
+    std::vector<std::complex<double>> result(n);
+
+    for (size_t k = 0U; k < n; ++k)
+    {
+      std::complex<double> sum = 0.0;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        const double angle = (inverse ? 2.0 : -2.0) * pi * double(i * k % n) / double(n);
+        sum += x[i] * std::complex<double>(std::cos(angle), std::sin(angle));
+      }
+
+      result[k] = inverse ? sum / double(n) : sum;
+    }
+
+    return result;
+  }
+
+  //*************************************************************************
+  std::vector<std::complex<double>> make_signal(size_t n, double amplitude)
+  {
+    std::vector<std::complex<double>> x(n);
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      // Pseudo random, with modulus less than amplitude.
+      const double re = std::sin(double(i) * 1.3 + 0.2);
+      const double im = std::cos(double(i) * 2.7 + 1.1);
+
+      x[i] = std::complex<double>(re, im) * (amplitude / std::sqrt(2.0));
+    }
+
+    return x;
+  }
+
+  //*************************************************************************
+  template <size_t N, typename T>
+  void check_float_transform(double tolerance)
+  {
+    const etl::fft<N, T> engine;
+
+    std::vector<std::complex<double>> x = make_signal(N, 1.0);
+    std::vector<std::complex<double>> expected = dft(x);
+
+    etl::fft_complex<T> data[N];
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      data[i] = etl::fft_complex<T>{ T(x[i].real()), T(x[i].imag()) };
+    }
+
+    engine.transform(data);
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      CHECK_CLOSE(expected[i].real(), double(data[i].real), tolerance);
+      CHECK_CLOSE(expected[i].imag(), double(data[i].imag), tolerance);
+    }
+
+    engine.inverse(data);
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      CHECK_CLOSE(x[i].real(), double(data[i].real), tolerance);
+      CHECK_CLOSE(x[i].imag(), double(data[i].imag), tolerance);
+    }
+  }
+
+  //*************************************************************************
+  template <size_t N, typename T>
+  void check_fixed_transform(double tolerance)
+  {
+    static constexpr etl::fft<N, T> engine;
+
+    std::vector<std::complex<double>> x = make_signal(N, 0.9);
+    std::vector<std::complex<double>> expected = dft(x);
+
+    etl::fft_complex<T> data[N];
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      data[i] = etl::fft_complex<T>{ T(x[i].real()), T(x[i].imag()) };
+    }
+
+    engine.transform(data);
+
+    // DFT / N
+    for (size_t i = 0U; i < N; ++i)
+    {
+      CHECK_CLOSE(expected[i].real() / N, data[i].real.template to_floating<double>(), tolerance);
+      CHECK_CLOSE(expected[i].imag() / N, data[i].imag.template to_floating<double>(), tolerance);
+    }
+
+    engine.inverse(data);
+
+    // x / N
+    for (size_t i = 0U; i < N; ++i)
+    {
+      CHECK_CLOSE(x[i].real() / N, data[i].real.template to_floating<double>(), tolerance);
+      CHECK_CLOSE(x[i].imag() / N, data[i].imag.template to_floating<double>(), tolerance);
+    }
+  }
+
+  //*************************************************************************
+  struct delayed_impulse_spectrum
+  {
+    etl::fft_complex<double> data[4];
+  };
+
+  constexpr delayed_impulse_spectrum make_delayed_impulse_spectrum()
+  {
+    delayed_impulse_spectrum value{};
+    etl::fft<4, double> engine;
+
+    value.data[1].real = 1.0;
+    engine.transform(value.data);
+
+    return value;
+  }
+
+  SUITE(test_fft)
+  {
+    //*************************************************************************
+    TEST(test_float_transforms)
+    {
+      check_float_transform<2,    double>(1e-9);
+      check_float_transform<4,    double>(1e-9);
+      check_float_transform<8,    double>(1e-9);
+      check_float_transform<32,   double>(1e-9);
+      check_float_transform<128,  double>(1e-9);
+      check_float_transform<512,  double>(1e-9);
+      check_float_transform<64,   float>(1e-3);
+      check_float_transform<256,  float>(1e-3);
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_transforms)
+    {
+      check_fixed_transform<8,   q15>(4.0 / 32768.0);
+      check_fixed_transform<64,  q15>(8.0 / 32768.0);
+      check_fixed_transform<128, q15>(8.0 / 32768.0);
+      check_fixed_transform<256, q31>(1e-8);
+    }
+
+    //*************************************************************************
+    TEST(test_impulse)
+    {
+      static constexpr etl::fft<16, float> engine;
+
+      etl::fft_complex<float> data[16] = {};
+      data[0].real = 1.0f;
+
+      engine.transform(data);
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        CHECK_CLOSE(1.0f, data[i].real, 1e-6f);
+        CHECK_CLOSE(0.0f, data[i].imag, 1e-6f);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_real_fft_float)
+    {
+      static constexpr etl::real_fft<64, double> engine;
+
+      double input[64];
+      std::vector<std::complex<double>> x(64);
+
+      for (size_t i = 0U; i < 64U; ++i)
+      {
+        input[i] = std::sin(double(i) * 0.7) + 0.25 * std::cos(double(i) * 3.1);
+        x[i]     = input[i];
+      }
+
+      std::vector<std::complex<double>> expected = dft(x);
+
+      etl::fft_complex<double> output[etl::real_fft<64, double>::OUTPUT_SIZE];
+
+      engine.transform(input, output);
+
+      for (size_t i = 0U; i < 33U; ++i)
+      {
+        CHECK_CLOSE(expected[i].real(), output[i].real, 1e-9);
+        CHECK_CLOSE(expected[i].imag(), output[i].imag, 1e-9);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_real_fft_fixed)
+    {
+      static constexpr etl::real_fft<128, q15> engine;
+
+      q15 input[128];
+      std::vector<std::complex<double>> x(128);
+
+      for (size_t i = 0U; i < 128U; ++i)
+      {
+        input[i] = q15(0.5 * std::sin(double(i) * 0.3) + 0.3 * std::cos(double(i) * 1.9));
+        x[i]     = input[i].to_floating<double>();
+      }
+
+      std::vector<std::complex<double>> expected = dft(x);
+
+      etl::fft_complex<q15> output[65];
+
+      engine.transform(input, output);
+
+      for (size_t i = 0U; i < 65U; ++i)
+      {
+        CHECK_CLOSE(expected[i].real() / 128.0, output[i].real.to_floating<double>(), 8.0 / 32768.0);
+        CHECK_CLOSE(expected[i].imag() / 128.0, output[i].imag.to_floating<double>(), 8.0 / 32768.0);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_circular_convolve_and_correlate)
+    {
+      const etl::fft<8, double> engine;
+
+      const double a[8] = { 1, 2, 3, 4, 0, 0, 0, 0 };
+      const double b[8] = { 1, -1, 0.5, 0, 0, 0, 0, 2 };
+
+      etl::fft_complex<double> ca[8];
+      etl::fft_complex<double> cb[8];
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        ca[i] = { a[i], 0.0 };
+        cb[i] = { b[i], 0.0 };
+      }
+
+      engine.circular_convolve(ca, cb);
+
+      for (size_t m = 0U; m < 8U; ++m)
+      {
+        double expected = 0.0;
+
+        for (size_t n = 0U; n < 8U; ++n)
+        {
+          expected += a[n] * b[(m + 8U - n) % 8U];
+        }
+
+        CHECK_CLOSE(expected, ca[m].real, 1e-9);
+        CHECK_CLOSE(0.0, ca[m].imag, 1e-9);
+      }
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        ca[i] = { a[i], 0.0 };
+        cb[i] = { b[i], 0.0 };
+      }
+
+      engine.circular_correlate(ca, cb);
+
+      for (size_t m = 0U; m < 8U; ++m)
+      {
+        double expected = 0.0;
+
+        for (size_t n = 0U; n < 8U; ++n)
+        {
+          expected += a[n] * b[(n + m) % 8U];
+        }
+
+        CHECK_CLOSE(expected, ca[m].real, 1e-9);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_block_convolver)
+    {
+      const float kernel[5] = { 0.5f, 0.25f, -0.125f, 1.0f, 0.0625f };
+
+      etl::fft_convolver<16, float> convolver(kernel, 5U);
+
+      std::vector<float> input(64);
+      std::vector<float> output(64);
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        input[i] = std::sin(float(i) * 0.45f);
+      }
+
+      for (size_t block = 0U; block < input.size(); block += etl::fft_convolver<16, float>::BLOCK_SIZE)
+      {
+        convolver.process(&input[block], &output[block]);
+      }
+
+      for (size_t i = 0U; i < output.size(); ++i)
+      {
+        float expected = 0.0f;
+
+        for (size_t k = 0U; (k < 5U) && (k <= i); ++k)
+        {
+          expected += kernel[k] * input[i - k];
+        }
+
+        CHECK_CLOSE(expected, output[i], 1e-5f);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_constexpr_transform)
+    {
+      constexpr delayed_impulse_spectrum r = make_delayed_impulse_spectrum();
+
+      // The transform of a delayed impulse is W^k.
+      static_assert((r.data[1].imag < -0.999999) && (r.data[1].imag > -1.000001), "Wrong value");
+
+      CHECK_CLOSE(-1.0, r.data[2].real, 1e-9);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,158 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fir_filter.h"
+
+#include <array>
+
+namespace
+{
+  SUITE(test_fir_filter)
+  {
+    //*************************************************************************
+    TEST(test_float_impulse_response)
+    {
+      const float h[4] = { 0.5f, 0.25f, -0.125f, 1.0f };
+
+      etl::fir_filter<float, 4U> filter(h);
+
+      CHECK_CLOSE(0.5f,    filter.process(1.0f), 0.00001f);
+      CHECK_CLOSE(0.25f,   filter.process(0.0f), 0.00001f);
+      CHECK_CLOSE(-0.125f, filter.process(0.0f), 0.00001f);
+      CHECK_CLOSE(1.0f,    filter.process(0.0f), 0.00001f);
+      CHECK_CLOSE(0.0f,    filter.process(0.0f), 0.00001f);
+    }
+
+    //*************************************************************************
+    TEST(test_double_moving_average)
+    {
+      const double h[4] = { 0.25, 0.25, 0.25, 0.25 };
+
+      etl::fir_filter<double, 4U> filter(h);
+
+      CHECK_CLOSE(1.0, filter(4.0), 0.00001);
+      CHECK_CLOSE(2.0, filter(4.0), 0.00001);
+      CHECK_CLOSE(3.0, filter(4.0), 0.00001);
+      CHECK_CLOSE(4.0, filter(4.0), 0.00001);
+      CHECK_CLOSE(3.0, filter(0.0), 0.00001);
+    }
+
+    //*************************************************************************
+    TEST(test_q15)
+    {
+      // 0.5, 0.25 in Q15.
+      const int16_t h[2] = { 16384, 8192 };
+
+      etl::fir_filter<int16_t, 2U> filter(h);
+
+      CHECK_EQUAL(5000, filter.process(10000));
+      CHECK_EQUAL(7500, filter.process(10000));
+      CHECK_EQUAL(2500, filter.process(0));
+
+      // Rounded half away from zero.
+      filter.reset();
+      CHECK_EQUAL(1,  filter.process(1));
+      filter.reset();
+      CHECK_EQUAL(-1, filter.process(-1));
+    }
+
+    //*************************************************************************
+    TEST(test_q15_saturates)
+    {
+      const int16_t h[2] = { 32767, 32767 };
+
+      etl::fir_filter<int16_t, 2U> filter(h);
+
+      filter.process(32767);
+      CHECK_EQUAL(32767, filter.process(32767));
+
+      filter.reset();
+      filter.process(-32768);
+      CHECK_EQUAL(-32768, filter.process(-32768));
+    }
+
+    //*************************************************************************
+    TEST(test_q31)
+    {
+      // 0.5 in Q31.
+      const int32_t h[1] = { 1073741824 };
+
+      etl::fir_filter<int32_t, 1U> filter(h);
+
+      CHECK_EQUAL(1000000000, filter.process(2000000000));
+    }
+
+    //*************************************************************************
+    TEST(test_block_matches_single_samples)
+    {
+      const int16_t h[5] = { 1000, -2000, 12000, -2000, 1000 };
+
+      std::array<int16_t, 37> input;
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        input[i] = int16_t((int(i) * 7919) % 20000 - 10000);
+      }
+
+      etl::fir_filter<int16_t, 5U> single(h);
+      etl::fir_filter<int16_t, 5U> block(h);
+      etl::fir_filter<int16_t, 5U> in_place(h);
+
+      std::array<int16_t, 37> output;
+      std::array<int16_t, 37> inout = input;
+
+      CHECK_EQUAL(input.size(), block.process(etl::span<const int16_t>(input.data(), input.size()), etl::span<int16_t>(output.data(), output.size())));
+      in_place.process(etl::span<const int16_t>(inout.data(), inout.size()), etl::span<int16_t>(inout.data(), inout.size()));
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        const int16_t expected = single.process(input[i]);
+        CHECK_EQUAL(expected, output[i]);
+        CHECK_EQUAL(expected, inout[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_block_shorter_output)
+    {
+      const float h[1] = { 2.0f };
+
+      etl::fir_filter<float, 1U> filter(h);
+
+      const float input[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+      float output[2];
+
+      CHECK_EQUAL(2U, filter.process(etl::span<const float>(input), etl::span<float>(output)));
+      CHECK_CLOSE(2.0f, output[0], 0.00001f);
+      CHECK_CLOSE(4.0f, output[1], 0.00001f);
+    }
+  };
+}
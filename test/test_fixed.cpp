@@ -0,0 +1,288 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fixed.h"
+
+#include <cmath>
+
+namespace
+{
+  typedef etl::fixed<15, 16>                                                         q15_16;
+  typedef etl::fixed<7, 8>                                                           q7_8;
+  typedef etl::fixed<7, 8, int16_t, etl::fixed_round_floor, etl::fixed_saturate>     q7_8_sat;
+  typedef etl::fixed<15, 16, int32_t, etl::fixed_round_half_even>                    q15_16_even;
+  typedef etl::fixed<15, 16, int32_t, etl::fixed_round_half_up>                      q15_16_half_up;
+  typedef etl::fixed<15, 16, int32_t, etl::fixed_round_zero>                         q15_16_zero;
+
+  SUITE(test_fixed)
+  {
+    //*************************************************************************
+    TEST(test_storage)
+    {
+      CHECK((etl::is_same<int32_t, q15_16::storage_type>::value));
+      CHECK((etl::is_same<int64_t, q15_16::wide_type>::value));
+      CHECK((etl::is_same<int16_t, q7_8::storage_type>::value));
+      CHECK((etl::is_same<int32_t, q7_8::wide_type>::value));
+      CHECK((etl::is_same<int8_t,  etl::fixed<3, 4>::storage_type>::value));
+
+      CHECK(etl::is_fixed<q7_8>::value);
+      CHECK(!etl::is_fixed<int>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_construction)
+    {
+      CHECK_EQUAL(0,       q15_16().raw());
+      CHECK_EQUAL(0x30000, q15_16(3).raw());
+      CHECK_EQUAL(-0x30000, q15_16(-3).raw());
+      CHECK_EQUAL(0x18000, q15_16(1.5).raw());
+      CHECK_EQUAL(-0x18000, q15_16(-1.5f).raw());
+      CHECK_EQUAL(123,     q15_16::from_raw(123).raw());
+
+      CHECK_EQUAL(0x7FFFFFFF, q15_16::max().raw());
+      CHECK_EQUAL(int32_t(0x80000000), q15_16::min().raw());
+      CHECK_EQUAL(1, q15_16::epsilon().raw());
+
+      CHECK_EQUAL(0x7FFF, q7_8::max().raw());
+    }
+
+    //*************************************************************************
+    TEST(test_conversion)
+    {
+      CHECK_CLOSE(1.25, q15_16(1.25).to_floating<double>(), 1e-9);
+      CHECK_CLOSE(-7.75f, q7_8(-7.75).to_floating<float>(), 1e-6f);
+
+      CHECK_EQUAL(2,  q15_16(2.75).to_integral<int>());
+      CHECK_EQUAL(-3, q15_16(-2.25).to_integral<int>());
+
+      CHECK_EQUAL(2,  q15_16_zero(2.75).to_integral<int>());
+      CHECK_EQUAL(-2, q15_16_zero(-2.75).to_integral<int>());
+
+      CHECK_EQUAL(3,  q15_16_half_up(2.5).to_integral<int>());
+      CHECK_EQUAL(-3, q15_16_half_up(-2.5).to_integral<int>());
+      CHECK_EQUAL(2,  q15_16_half_up(2.25).to_integral<int>());
+
+      CHECK_EQUAL(2,  q15_16_even(2.5).to_integral<int>());
+      CHECK_EQUAL(4,  q15_16_even(3.5).to_integral<int>());
+      CHECK_EQUAL(-2, q15_16_even(-2.5).to_integral<int>());
+      CHECK_EQUAL(-4, q15_16_even(-3.5).to_integral<int>());
+    }
+
+    //*************************************************************************
+    TEST(test_arithmetic)
+    {
+      const q15_16 a(3.5);
+      const q15_16 b(-1.25);
+
+      CHECK(q15_16(2.25)   == (a + b));
+      CHECK(q15_16(4.75)   == (a - b));
+      CHECK(q15_16(-4.375) == (a * b));
+      CHECK(q15_16(-2.8)   == (a / b));
+      CHECK(q15_16(-3.5)   == -a);
+      CHECK(a              == +a);
+
+      q15_16 c(1);
+      c += a;
+      c -= b;
+      c *= q15_16(2);
+      c /= q15_16(4);
+      CHECK(q15_16(2.875) == c);
+    }
+
+    //*************************************************************************
+    TEST(test_arithmetic_against_double)
+    {
+      for (int i = -200; i <= 200; i += 7)
+      {
+        for (int j = -150; j <= 150; j += 11)
+        {
+          if (j == 0)
+          {
+            continue;
+          }
+
+          const double x = i / 8.0;
+          const double y = j / 16.0;
+
+          const q15_16_half_up fx(x);
+          const q15_16_half_up fy(y);
+
+          CHECK_CLOSE(x + y, (fx + fy).to_floating<double>(), 1.0 / 65536.0);
+          CHECK_CLOSE(x - y, (fx - fy).to_floating<double>(), 1.0 / 65536.0);
+          CHECK_CLOSE(x * y, (fx * fy).to_floating<double>(), 0.5 / 65536.0);
+          CHECK_CLOSE(x / y, (fx / fy).to_floating<double>(), 0.5 / 65536.0);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_multiply_rounding)
+    {
+      const q15_16 tiny = q15_16::from_raw(1);
+      const q15_16 half(0.5);
+
+      CHECK_EQUAL(0, (tiny * half).raw());
+      CHECK_EQUAL(-1, (-tiny * half).raw());
+      CHECK_EQUAL(0, (q15_16_zero::from_raw(-1) * q15_16_zero(0.5)).raw());
+      CHECK_EQUAL(1, (q15_16_half_up::from_raw(1) * q15_16_half_up(0.5)).raw());
+      CHECK_EQUAL(0, (q15_16_even::from_raw(1) * q15_16_even(0.5)).raw());
+      CHECK_EQUAL(2, (q15_16_even::from_raw(3) * q15_16_even(0.5)).raw());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow)
+    {
+      CHECK(q7_8(-128) == (q7_8(127) + q7_8(1)));
+      CHECK(q7_8_sat::max() == (q7_8_sat(127) + q7_8_sat(1)));
+      CHECK(q7_8_sat::min() == (q7_8_sat(-127) - q7_8_sat(10)));
+      CHECK(q7_8_sat::max() == (q7_8_sat(100) * q7_8_sat(2)));
+      CHECK(q7_8_sat::max() == -q7_8_sat::min());
+      CHECK(q7_8_sat::max() == q7_8_sat(1000));
+
+      // Q3.4 held in 16 bits wraps at 8.
+      typedef etl::fixed<3, 4, int16_t> q3_4;
+      CHECK(q3_4(-8) == (q3_4(7) + q3_4(1)));
+    }
+
+    //*************************************************************************
+    TEST(test_comparison)
+    {
+      CHECK(q7_8(1) < q7_8(2));
+      CHECK(q7_8(2) <= q7_8(2));
+      CHECK(q7_8(3) > q7_8(2));
+      CHECK(q7_8(2) >= q7_8(2));
+      CHECK(q7_8(2) != q7_8(2.5));
+    }
+
+    //*************************************************************************
+    TEST(test_reciprocal)
+    {
+      const double divisors[] = { 3.0, -7.5, 0.125, 100.0, 1.0 / 65536.0, -0.3 };
+
+      for (size_t d = 0U; d < sizeof(divisors) / sizeof(divisors[0]); ++d)
+      {
+        const q15_16_half_up divisor(divisors[d]);
+        const etl::fixed_reciprocal<q15_16_half_up> divide(divisor);
+
+        for (int i = -100; i <= 100; i += 3)
+        {
+          const q15_16_half_up numerator(i / 32.0);
+          const q15_16_half_up expected = numerator / divisor;
+
+          // Skip results that do not fit.
+          if (std::fabs(numerator.to_floating<double>() / divisor.to_floating<double>()) < 30000.0)
+          {
+            CHECK(std::abs(expected.raw() - divide(numerator).raw()) <= 1);
+          }
+        }
+      }
+
+      const etl::fixed_reciprocal<q7_8> divide_by_3(q7_8(3));
+      CHECK_CLOSE(-2.0, divide_by_3(q7_8(-6)).to_floating<double>(), 1.0 / 256.0);
+    }
+
+    //*************************************************************************
+    TEST(test_to_string)
+    {
+      etl::string<20> str;
+
+      etl::to_string(q15_16(3.25), str, etl::format_spec().precision(2));
+      CHECK_EQUAL(std::string("3.25"), std::string(str.c_str()));
+
+      etl::to_string(q15_16(-3.25), str, etl::format_spec().precision(1));
+      CHECK_EQUAL(std::string("-3.3"), std::string(str.c_str()));
+
+      etl::to_string(q7_8(1.5), str);
+      CHECK_EQUAL(std::string("2"), std::string(str.c_str()));
+
+      etl::to_string(q15_16::from_raw(1), str, etl::format_spec().precision(6));
+      CHECK_EQUAL(std::string("0.000015"), std::string(str.c_str()));
+
+      etl::to_string(q7_8(-0.5), str, etl::format_spec().precision(3).width(8).right());
+      CHECK_EQUAL(std::string("  -0.500"), std::string(str.c_str()));
+
+      etl::to_string(q15_16(-0.001), str, etl::format_spec().precision(1));
+      CHECK_EQUAL(std::string("0.0"), std::string(str.c_str()));
+
+      etl::to_string(q7_8(-0.5), str, etl::format_spec().precision(3).width(8).right());
+      etl::to_string(q7_8(12), str, etl::format_spec().precision(1), true);
+      CHECK_EQUAL(std::string("  -0.50012.0"), std::string(str.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_to_arithmetic)
+    {
+      etl::to_arithmetic_result<q15_16> result1 = etl::to_arithmetic<q15_16>(etl::string_view("3.25"));
+      CHECK(result1.has_value());
+      CHECK(q15_16(3.25) == result1.value());
+
+      etl::to_arithmetic_result<q15_16> result2 = etl::to_arithmetic<q15_16>(etl::string_view("-0.1"));
+      CHECK(result2.has_value());
+      CHECK_EQUAL(-6554, result2.value().raw());
+
+      etl::to_arithmetic_result<q15_16> result3 = etl::to_arithmetic<q15_16>("+42", 3U);
+      CHECK(result3.has_value());
+      CHECK(q15_16(42) == result3.value());
+
+      etl::to_arithmetic_result<q15_16> result4 = etl::to_arithmetic<q15_16>(etl::string_view(".5"));
+      CHECK(q15_16(0.5) == result4.value());
+
+      CHECK(etl::to_arithmetic<q7_8>(etl::string_view("-128")).has_value());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<q7_8>(etl::string_view("128")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<q7_8>(etl::string_view("99999999999999999999")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<q7_8>(etl::string_view("1.2.3")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<q7_8>(etl::string_view("-")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<q7_8>(etl::string_view("1x")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<q7_8>(etl::string_view(".")).error());
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      constexpr q15_16 a(1.5);
+      constexpr q15_16 b(4);
+      constexpr q15_16 c = (a * b) / q15_16(2) - q15_16(1);
+
+      static_assert(c.raw() == 0x20000, "Wrong value");
+      static_assert(c.to_integral<int>() == 2, "Wrong value");
+      static_assert(a < b, "Wrong comparison");
+
+      constexpr etl::fixed_reciprocal<q15_16> divide_by_4(b);
+      static_assert(divide_by_4(b).raw() == 0x10000, "Wrong value");
+
+      static_assert(etl::to_arithmetic<q15_16>(etl::string_view("2.5")).value().raw() == 0x28000, "Wrong value");
+
+      CHECK_EQUAL(2, c.to_integral<int>());
+    }
+#endif
+  }
+}
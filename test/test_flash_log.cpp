@@ -0,0 +1,408 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/flash_log.h"
+
+#include <vector>
+#include <string>
+
+#if ETL_USING_CPP11
+
+namespace
+{
+  //***************************************************************************
+  // A NOR flash in RAM. Programming can only clear bits.
+  //***************************************************************************
+  class Flash
+  {
+  public:
+
+    Flash(uint32_t sector_size_, uint32_t sector_count_, uint32_t program_size_)
+      : memory(sector_size_ * sector_count_, 0xFFU)
+      , erase_counts(sector_count_, 0U)
+      , programs_left(-1)
+    {
+      device.read         = etl::flash_log_device::read_type::create<Flash, &Flash::read>(*this);
+      device.program      = etl::flash_log_device::program_type::create<Flash, &Flash::program>(*this);
+      device.erase        = etl::flash_log_device::erase_type::create<Flash, &Flash::erase>(*this);
+      device.sector_size  = sector_size_;
+      device.sector_count = sector_count_;
+      device.program_size = program_size_;
+    }
+
+    bool read(uint32_t address, etl::span<uint8_t> data)
+    {
+      if ((address + data.size()) > memory.size())
+      {
+        return false;
+      }
+
+      std::copy(memory.begin() + address, memory.begin() + address + data.size(), data.begin());
+
+      return true;
+    }
+
+    bool program(uint32_t address, etl::span<const uint8_t> data)
+    {
+      CHECK_EQUAL(0U, address % device.program_size);
+      CHECK_EQUAL(0U, data.size() % device.program_size);
+
+      size_t length = data.size();
+
+      if (programs_left == 0)
+      {
+        // Power fails half way through.
+        length /= 2U;
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        memory[address + i] &= data[i];
+      }
+
+      if (programs_left == 0)
+      {
+        return false;
+      }
+
+      if (programs_left > 0)
+      {
+        --programs_left;
+      }
+
+      return true;
+    }
+
+    bool erase(uint32_t sector)
+    {
+      std::fill(memory.begin() + sector * device.sector_size, memory.begin() + (sector + 1U) * device.sector_size, 0xFFU);
+      ++erase_counts[sector];
+
+      return true;
+    }
+
+    uint32_t total_erases() const
+    {
+      uint32_t total = 0U;
+
+      for (size_t i = 0U; i < erase_counts.size(); ++i)
+      {
+        total += erase_counts[i];
+      }
+
+      return total;
+    }
+
+    etl::flash_log_device device;
+    std::vector<uint8_t>  memory;
+    std::vector<uint32_t> erase_counts;
+    int                   programs_left;
+  };
+
+  typedef etl::flash_log<8> Log;
+
+  //***************************************************************************
+  bool write_string(etl::iflash_log& log, uint16_t key, const std::string& value)
+  {
+    return log.write(key, etl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(value.data()), value.size()));
+  }
+
+  //***************************************************************************
+  std::string read_string(const etl::iflash_log& log, uint16_t key)
+  {
+    uint8_t buffer[128];
+
+    size_t length = log.read(key, etl::span<uint8_t>(buffer, sizeof(buffer)));
+
+    return std::string(reinterpret_cast<const char*>(buffer), length);
+  }
+
+  SUITE(test_flash_log)
+  {
+    //*************************************************************************
+    TEST(test_write_and_read)
+    {
+      Flash flash(128U, 4U, 4U);
+      Log   log(flash.device);
+
+      CHECK(!log.is_mounted());
+      CHECK(log.mount());
+      CHECK(log.is_mounted());
+      CHECK(log.empty());
+      CHECK_EQUAL(3U, log.free_sectors());
+
+      CHECK(write_string(log, 1U, "alpha"));
+      CHECK(write_string(log, 2U, "beta"));
+      CHECK(write_string(log, 1U, "gamma"));
+      CHECK(log.write(3U, etl::span<const uint8_t>()));
+
+      CHECK_EQUAL(3U, log.size());
+      CHECK_EQUAL(std::string("gamma"), read_string(log, 1U));
+      CHECK_EQUAL(std::string("beta"),  read_string(log, 2U));
+      CHECK(log.contains(3U));
+      CHECK_EQUAL(0U, log.value_size(3U));
+      CHECK_EQUAL(5U, log.value_size(1U));
+      CHECK(!log.contains(4U));
+      CHECK_EQUAL(std::string(""), read_string(log, 4U));
+
+      // Short buffer.
+      uint8_t buffer[2];
+      CHECK_EQUAL(2U, log.read(1U, etl::span<uint8_t>(buffer, 2U)));
+      CHECK_EQUAL('g', buffer[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_mount_recovers_index)
+    {
+      Flash flash(128U, 4U, 4U);
+
+      {
+        Log log(flash.device);
+        CHECK(log.mount());
+
+        for (int i = 0; i < 20; ++i)
+        {
+          CHECK(write_string(log, static_cast<uint16_t>(i % 5), "value " + std::to_string(i)));
+        }
+
+        CHECK(log.remove(2U));
+        CHECK(log.remove(7U)); // Absent.
+      }
+
+      Log log(flash.device);
+      CHECK(log.mount());
+
+      CHECK_EQUAL(4U, log.size());
+      CHECK_EQUAL(std::string("value 15"), read_string(log, 0U));
+      CHECK_EQUAL(std::string("value 16"), read_string(log, 1U));
+      CHECK(!log.contains(2U));
+      CHECK_EQUAL(std::string("value 18"), read_string(log, 3U));
+      CHECK_EQUAL(std::string("value 19"), read_string(log, 4U));
+
+      // Writes continue after the last record.
+      CHECK(write_string(log, 2U, "back"));
+
+      Log log2(flash.device);
+      CHECK(log2.mount());
+      CHECK_EQUAL(std::string("back"), read_string(log2, 2U));
+      CHECK_EQUAL(5U, log2.size());
+    }
+
+    //*************************************************************************
+    TEST(test_compaction_reclaims_space)
+    {
+      Flash flash(128U, 4U, 8U);
+      Log   log(flash.device);
+      CHECK(log.mount());
+
+      // Far more data than the region holds, but few live keys.
+      for (int i = 0; i < 500; ++i)
+      {
+        CHECK(write_string(log, static_cast<uint16_t>(i % 3), "update " + std::to_string(i)));
+      }
+
+      CHECK_EQUAL(std::string("update 498"), read_string(log, 0U));
+      CHECK_EQUAL(std::string("update 499"), read_string(log, 1U));
+      CHECK_EQUAL(std::string("update 497"), read_string(log, 2U));
+
+      // Sectors are erased in turn.
+      for (size_t i = 0U; i < flash.erase_counts.size(); ++i)
+      {
+        CHECK(flash.erase_counts[i] > 10U);
+      }
+
+      Log log2(flash.device);
+      CHECK(log2.mount());
+      CHECK_EQUAL(3U, log2.size());
+      CHECK_EQUAL(std::string("update 498"), read_string(log2, 0U));
+      CHECK_EQUAL(std::string("update 497"), read_string(log2, 2U));
+    }
+
+    //*************************************************************************
+    TEST(test_tombstones_are_dropped_by_compaction)
+    {
+      Flash flash(128U, 3U, 4U);
+      Log   log(flash.device);
+      CHECK(log.mount());
+
+      for (int i = 0; i < 200; ++i)
+      {
+        const uint16_t key = static_cast<uint16_t>(i % 8);
+
+        CHECK(write_string(log, key, "x"));
+        CHECK(log.remove(key));
+      }
+
+      CHECK(log.empty());
+
+      Log log2(flash.device);
+      CHECK(log2.mount());
+      CHECK(log2.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_background_compaction)
+    {
+      Flash flash(64U, 4U, 4U);
+      Log   log(flash.device);
+      CHECK(log.mount());
+
+      int writes = 0;
+
+      while (!log.needs_compaction())
+      {
+        CHECK(write_string(log, 1U, "0123456789"));
+        ++writes;
+      }
+
+      CHECK_EQUAL(1U, log.free_sectors());
+
+      const uint32_t erases = flash.total_erases();
+
+      CHECK(log.compact());
+      CHECK_EQUAL(erases + 1U, flash.total_erases());
+      CHECK_EQUAL(2U, log.free_sectors());
+      CHECK(!log.needs_compaction());
+      CHECK_EQUAL(std::string("0123456789"), read_string(log, 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_torn_write_is_ignored)
+    {
+      Flash flash(128U, 4U, 4U);
+
+      {
+        Log log(flash.device);
+        CHECK(log.mount());
+        CHECK(write_string(log, 1U, "committed"));
+
+        // Power fails during the next record.
+        flash.programs_left = 0;
+        CHECK(!write_string(log, 1U, "torn record"));
+        flash.programs_left = -1;
+      }
+
+      Log log(flash.device);
+      CHECK(log.mount());
+      CHECK_EQUAL(std::string("committed"), read_string(log, 1U));
+
+      // The damaged sector is closed; writes go to the next.
+      const size_t free_sectors = log.free_sectors();
+      CHECK(write_string(log, 1U, "next"));
+      CHECK_EQUAL(free_sectors - 1U, log.free_sectors());
+
+      Log log2(flash.device);
+      CHECK(log2.mount());
+      CHECK_EQUAL(std::string("next"), read_string(log2, 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_full_of_live_records)
+    {
+      Flash flash(64U, 3U, 4U);
+      Log   log(flash.device);
+      CHECK(log.mount());
+
+      const std::string value(40U, 'v');
+
+      // One record per sector, one sector in reserve.
+      CHECK(write_string(log, 1U, value));
+      CHECK(write_string(log, 2U, value));
+      CHECK(!write_string(log, 3U, value));
+
+      CHECK(!log.contains(3U));
+      CHECK_EQUAL(value, read_string(log, 1U));
+      CHECK_EQUAL(value, read_string(log, 2U));
+
+      // A new copy does not fit either, but nothing is lost.
+      CHECK(!write_string(log, 1U, "new"));
+
+      Log log2(flash.device);
+      CHECK(log2.mount());
+      CHECK_EQUAL(2U, log2.size());
+      CHECK_EQUAL(value, read_string(log2, 1U));
+      CHECK_EQUAL(value, read_string(log2, 2U));
+    }
+
+    //*************************************************************************
+    TEST(test_two_sectors)
+    {
+      Flash flash(64U, 2U, 1U);
+      Log   log(flash.device);
+      CHECK(log.mount());
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK(write_string(log, static_cast<uint16_t>(i % 2), std::to_string(i)));
+      }
+
+      CHECK_EQUAL(std::string("98"), read_string(log, 0U));
+      CHECK_EQUAL(std::string("99"), read_string(log, 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_format)
+    {
+      Flash flash(128U, 4U, 4U);
+      Log   log(flash.device);
+      CHECK(log.mount());
+      CHECK(write_string(log, 1U, "one"));
+
+      CHECK(log.format());
+      CHECK(log.empty());
+
+      Log log2(flash.device);
+      CHECK(log2.mount());
+      CHECK(log2.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      Flash flash(64U, 3U, 4U);
+      etl::flash_log<2> log(flash.device);
+      CHECK(log.mount());
+
+      CHECK_THROW(write_string(log, 0xFFFFU, "x"), etl::flash_log_invalid_key);
+      CHECK_THROW(write_string(log, 1U, std::string(log.max_value_size() + 1U, 'x')), etl::flash_log_value_too_large);
+
+      CHECK(write_string(log, 1U, "a"));
+      CHECK(write_string(log, 2U, "b"));
+      CHECK_THROW(write_string(log, 3U, "c"), etl::flash_log_index_full);
+      CHECK(write_string(log, 2U, "c"));
+
+      Flash bad(64U, 1U, 4U);
+      CHECK_THROW(Log bad_log(bad.device), etl::flash_log_invalid_geometry);
+    }
+  }
+}
+
+#endif
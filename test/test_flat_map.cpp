@@ -867,6 +867,82 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_with_duplicates)
+    {
+      std::map<int, int> compare_data;
+      DataInt data;
+
+      data.insert(ElementInt(4, 40));
+      data.insert(ElementInt(1, 10));
+      compare_data.insert(ElementInt(4, 40));
+      compare_data.insert(ElementInt(1, 10));
+
+      // Existing keys and repeated keys keep the first value.
+      const ElementInt values[] = { ElementInt(7, 70), ElementInt(4, 41), ElementInt(0, 0), ElementInt(7, 71),
+                                    ElementInt(9, 90), ElementInt(2, 20), ElementInt(1, 11), ElementInt(5, 50),
+                                    ElementInt(3, 30), ElementInt(8, 80), ElementInt(6, 60), ElementInt(2, 21) };
+
+      data.insert(std::begin(values), std::end(values));
+      compare_data.insert(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_unique_range)
+    {
+      std::map<int, int> compare_data;
+      DataInt data;
+
+      data.insert(ElementInt(3, 30));
+      data.insert(ElementInt(6, 60));
+      compare_data.insert(ElementInt(3, 30));
+      compare_data.insert(ElementInt(6, 60));
+
+      const ElementInt values[] = { ElementInt(0, 0), ElementInt(2, 20), ElementInt(3, 31), ElementInt(5, 50), ElementInt(8, 80), ElementInt(9, 90) };
+
+      data.insert(etl::sorted_unique_t(), std::begin(values), std::end(values));
+      compare_data.insert(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      DataInt data2(etl::sorted_unique_t(), std::begin(values), std::end(values));
+      std::map<int, int> compare_data2(std::begin(values), std::end(values));
+      CHECK(std::equal(data2.begin(), data2.end(), compare_data2.begin()));
+
+#if ETL_HAS_INITIALIZER_LIST
+      DataInt data3(etl::sorted_unique_t(), { ElementInt(0, 0), ElementInt(2, 20), ElementInt(3, 31), ElementInt(5, 50), ElementInt(8, 80), ElementInt(9, 90) });
+      CHECK(data2 == data3);
+#endif
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_duplicates_when_full)
+    {
+      DataInt data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(ElementInt(i, i));
+      }
+
+      // Only existing keys, so the map does not overflow.
+      const ElementInt values[] = { ElementInt(9, 0), ElementInt(0, 0), ElementInt(5, 0), ElementInt(5, 1) };
+
+      CHECK_NO_THROW(data.insert(std::begin(values), std::end(values)));
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(9, data.at(9));
+
+      const ElementInt excess[] = { ElementInt(5, 0), ElementInt(10, 10) };
+
+      CHECK_THROW(data.insert(std::begin(excess), std::end(excess)), etl::flat_map_full);
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(!data.contains(10));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -620,6 +620,63 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_is_stable)
+    {
+      std::multimap<int, int> compare_data;
+      DataInt data;
+
+      data.insert(ElementInt(4, 40));
+      data.insert(ElementInt(1, 10));
+      compare_data.insert(ElementInt(4, 40));
+      compare_data.insert(ElementInt(1, 10));
+
+      // Equivalent keys keep their insertion order, after existing equivalent keys.
+      const ElementInt values[] = { ElementInt(7, 70), ElementInt(4, 41), ElementInt(0, 0), ElementInt(7, 71),
+                                    ElementInt(1, 11), ElementInt(2, 20), ElementInt(4, 42), ElementInt(2, 21) };
+
+      data.insert(std::begin(values), std::end(values));
+      compare_data.insert(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_equivalent_range)
+    {
+      std::multimap<int, int> compare_data;
+      DataInt data;
+
+      data.insert(ElementInt(3, 30));
+      data.insert(ElementInt(6, 60));
+      compare_data.insert(ElementInt(3, 30));
+      compare_data.insert(ElementInt(6, 60));
+
+      const ElementInt values[] = { ElementInt(0, 0), ElementInt(3, 31), ElementInt(3, 32), ElementInt(5, 50), ElementInt(8, 80) };
+
+      data.insert(etl::sorted_equivalent_t(), std::begin(values), std::end(values));
+      compare_data.insert(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      DataInt data2(etl::sorted_equivalent_t(), std::begin(values), std::end(values));
+      std::multimap<int, int> compare_data2(std::begin(values), std::end(values));
+      CHECK(std::equal(data2.begin(), data2.end(), compare_data2.begin()));
+
+      const ElementInt excess[] = { ElementInt(1, 0), ElementInt(2, 0), ElementInt(3, 0), ElementInt(4, 0), ElementInt(5, 0), ElementInt(6, 0) };
+
+      // The elements that fit are still merged in order.
+      CHECK_THROW(data.insert(std::begin(excess), std::end(excess)), etl::flat_multimap_full);
+      CHECK_EQUAL(SIZE, data.size());
+
+      for (DataInt::const_iterator itr = data.begin(); etl::next(itr) != data.end(); ++itr)
+      {
+        CHECK(itr->first <= etl::next(itr)->first);
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -608,6 +608,55 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted)
+    {
+      std::multiset<int> compare_data;
+      DataInt data;
+
+      data.insert(4);
+      data.insert(1);
+      compare_data.insert(4);
+      compare_data.insert(1);
+
+      const int values[] = { 7, 4, 0, 7, 1, 2, 4, 2 };
+
+      data.insert(std::begin(values), std::end(values));
+      compare_data.insert(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_equivalent_range)
+    {
+      std::multiset<int> compare_data;
+      DataInt data;
+
+      data.insert(3);
+      data.insert(6);
+      compare_data.insert(3);
+      compare_data.insert(6);
+
+      const int values[] = { 0, 3, 3, 5, 8 };
+
+      data.insert(etl::sorted_equivalent_t(), std::begin(values), std::end(values));
+      compare_data.insert(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      DataInt data2(etl::sorted_equivalent_t(), std::begin(values), std::end(values));
+      CHECK(std::equal(data2.begin(), data2.end(), std::begin(values)));
+
+      const int excess[] = { 6, 5, 4, 3, 2, 1 };
+
+      CHECK_THROW(data.insert(std::begin(excess), std::end(excess)), etl::flat_multiset_full);
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(etl::is_sorted(data.begin(), data.end()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_default_value)
     {
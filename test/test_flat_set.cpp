@@ -613,6 +613,76 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_with_duplicates)
+    {
+      std::set<int> compare_data;
+      DataInt data;
+
+      data.insert(4);
+      data.insert(1);
+      compare_data.insert(4);
+      compare_data.insert(1);
+
+      const int values[] = { 7, 4, 0, 7, 9, 2, 1, 5, 3, 8, 6, 2 };
+
+      data.insert(std::begin(values), std::end(values));
+      compare_data.insert(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_unique_range)
+    {
+      std::set<int> compare_data;
+      DataInt data;
+
+      data.insert(3);
+      data.insert(6);
+      compare_data.insert(3);
+      compare_data.insert(6);
+
+      const int values[] = { 0, 2, 3, 5, 8, 9 };
+
+      data.insert(etl::sorted_unique_t(), std::begin(values), std::end(values));
+      compare_data.insert(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      DataInt data2(etl::sorted_unique_t(), std::begin(values), std::end(values));
+      CHECK(std::equal(data2.begin(), data2.end(), std::begin(values)));
+
+#if ETL_HAS_INITIALIZER_LIST
+      DataInt data3(etl::sorted_unique_t(), { 0, 2, 3, 5, 8, 9 });
+      CHECK(data2 == data3);
+#endif
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_duplicates_when_full)
+    {
+      DataInt data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(i);
+      }
+
+      const int values[] = { 9, 0, 5, 5 };
+
+      CHECK_NO_THROW(data.insert(std::begin(values), std::end(values)));
+      CHECK_EQUAL(SIZE, data.size());
+
+      const int excess[] = { 5, 10 };
+
+      CHECK_THROW(data.insert(std::begin(excess), std::end(excess)), etl::flat_set_full);
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(!data.contains(10));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_insert_existing_value_when_full)
     {
@@ -0,0 +1,103 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/checksum.h"
+
+namespace
+{
+  uint16_t reference_fletcher16(const std::vector<uint8_t>& data)
+  {
+    uint16_t sum1 = 0U;
+    uint16_t sum2 = 0U;
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      sum1 = (sum1 + data[i]) % 255U;
+      sum2 = (sum2 + sum1) % 255U;
+    }
+
+    return uint16_t((sum2 << 8U) | sum1);
+  }
+
+  SUITE(test_fletcher16)
+  {
+    //*************************************************************************
+    TEST(test_fletcher16_known_values)
+    {
+      std::string data1("abcde");
+      std::string data2("abcdef");
+      std::string data3("abcdefgh");
+
+      CHECK_EQUAL(0xC8F0U, uint16_t(etl::fletcher16(data1.begin(), data1.end())));
+      CHECK_EQUAL(0x2057U, uint16_t(etl::fletcher16(data2.begin(), data2.end())));
+      CHECK_EQUAL(0x0627U, uint16_t(etl::fletcher16(data3.begin(), data3.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher16_add_values)
+    {
+      std::string data("abcdefgh");
+
+      etl::fletcher16 checksum_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        checksum_calculator.add(data[i]);
+      }
+
+      CHECK_EQUAL(0x0627U, checksum_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher16_contiguous_range)
+    {
+      std::vector<uint8_t> data(1000U, 0xFFU);
+
+      for (size_t i = 0UL; i < data.size(); i += 3UL)
+      {
+        data[i] = uint8_t(i);
+      }
+
+      // Pointers add a block at a time.
+      for (size_t length = 0UL; length < 200UL; ++length)
+      {
+        std::vector<uint8_t> part(data.begin(), data.begin() + length);
+
+        CHECK_EQUAL(reference_fletcher16(part), uint16_t(etl::fletcher16(data.data(), data.data() + length)));
+      }
+
+      CHECK_EQUAL(reference_fletcher16(data), uint16_t(etl::fletcher16(data.data(), data.data() + data.size())));
+    }
+  };
+}
@@ -0,0 +1,128 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/checksum.h"
+
+namespace
+{
+  uint32_t reference_fletcher32(const std::vector<uint8_t>& data)
+  {
+    uint32_t sum1 = 0UL;
+    uint32_t sum2 = 0UL;
+
+    for (size_t i = 0UL; i < data.size(); i += 2UL)
+    {
+      uint32_t word = data[i];
+
+      if ((i + 1UL) < data.size())
+      {
+        word |= uint32_t(data[i + 1UL]) << 8U;
+      }
+
+      sum1 = (sum1 + word) % 65535UL;
+      sum2 = (sum2 + sum1) % 65535UL;
+    }
+
+    return (sum2 << 16U) | sum1;
+  }
+
+  SUITE(test_fletcher32)
+  {
+    //*************************************************************************
+    TEST(test_fletcher32_known_values)
+    {
+      std::string data1("abcde");
+      std::string data2("abcdef");
+      std::string data3("abcdefgh");
+
+      CHECK_EQUAL(0xF04FC729UL, uint32_t(etl::fletcher32(data1.begin(), data1.end())));
+      CHECK_EQUAL(0x56502D2AUL, uint32_t(etl::fletcher32(data2.begin(), data2.end())));
+      CHECK_EQUAL(0xEBE19591UL, uint32_t(etl::fletcher32(data3.begin(), data3.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher32_add_values)
+    {
+      std::string data("abcde");
+
+      etl::fletcher32 checksum_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        checksum_calculator.add(data[i]);
+      }
+
+      CHECK_EQUAL(0xF04FC729UL, checksum_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher32_contiguous_range)
+    {
+      std::vector<uint8_t> data(1000U, 0xFFU);
+
+      for (size_t i = 0UL; i < data.size(); i += 3UL)
+      {
+        data[i] = uint8_t(i);
+      }
+
+      // Pointers add a block at a time.
+      for (size_t length = 0UL; length < 200UL; ++length)
+      {
+        std::vector<uint8_t> part(data.begin(), data.begin() + length);
+
+        CHECK_EQUAL(reference_fletcher32(part), uint32_t(etl::fletcher32(data.data(), data.data() + length)));
+      }
+
+      CHECK_EQUAL(reference_fletcher32(data), uint32_t(etl::fletcher32(data.data(), data.data() + data.size())));
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher32_split_at_odd_boundary)
+    {
+      std::vector<uint8_t> data(300U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(i * 7U);
+      }
+
+      etl::fletcher32 checksum_calculator;
+
+      checksum_calculator.add(data.data(), data.data() + 3U);
+      checksum_calculator.add(data.data() + 3U, data.data() + data.size());
+
+      CHECK_EQUAL(reference_fletcher32(data), checksum_calculator.value());
+    }
+  };
+}
@@ -318,6 +318,23 @@ namespace
       uint64_t hash3 = etl::fnv_1a_64(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(hash1), int(hash3));
     }
+    //*************************************************************************
+    TEST(test_fnv_add_range_pointer_blocks)
+    {
+      std::string data("123456789012345678901234567890123456789");
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        const char* p = data.data();
+
+        CHECK_EQUAL(uint32_t(etl::fnv_1_32(data.begin(),   data.begin() + length)), uint32_t(etl::fnv_1_32(p, p + length)));
+        CHECK_EQUAL(uint32_t(etl::fnv_1a_32(data.begin(),  data.begin() + length)), uint32_t(etl::fnv_1a_32(p, p + length)));
+        CHECK_EQUAL(uint64_t(etl::fnv_1_64(data.begin(),   data.begin() + length)), uint64_t(etl::fnv_1_64(p, p + length)));
+        CHECK_EQUAL(uint64_t(etl::fnv_1a_64(data.begin(),  data.begin() + length)), uint64_t(etl::fnv_1a_64(p, p + length)));
+      }
+
+      CHECK_EQUAL(0x24148816UL, uint32_t(etl::fnv_1_32(data.data(), data.data() + 9U)));
+    }
   };
 }
 
@@ -0,0 +1,236 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/format.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+
+#include <string>
+#include <iterator>
+
+namespace
+{
+  typedef etl::string<100> String;
+
+  SUITE(test_format)
+  {
+    //*************************************************************************
+    TEST(test_literal_text)
+    {
+      String s;
+
+      CHECK_EQUAL(std::string("Hello World"), std::string(etl::format(s, "Hello World").c_str()));
+      CHECK_EQUAL(std::string("{braces}"),    std::string(etl::format(s, "{{braces}}").c_str()));
+      CHECK_EQUAL(std::string(""),            std::string(etl::format(s, "").c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_integers)
+    {
+      String s;
+
+      CHECK(etl::format(s, "{}", 0) == "0");
+      CHECK(etl::format(s, "{}", 123) == "123");
+      CHECK(etl::format(s, "{}", -123) == "-123");
+      CHECK(etl::format(s, "{}", INT32_MIN) == "-2147483648");
+      CHECK(etl::format(s, "{}", UINT64_MAX) == "18446744073709551615");
+      CHECK(etl::format(s, "{}", INT64_MIN) == "-9223372036854775808");
+      CHECK(etl::format(s, "{}", static_cast<signed char>(-5)) == "-5");
+      CHECK(etl::format(s, "{}", static_cast<unsigned char>(200)) == "200");
+      CHECK(etl::format(s, "{:x} {:X} {:o} {:b} {:B}", 255, 255, 8, 5, 5) == "ff FF 10 101 101");
+      CHECK(etl::format(s, "{:#x} {:#X} {:#o} {:#b} {:#B}", 255, 255, 8, 5, 5) == "0xff 0XFF 010 0b101 0B101");
+      CHECK(etl::format(s, "{:#o}", 0) == "0");
+      CHECK(etl::format(s, "{:x}", -255) == "-ff");
+      CHECK(etl::format(s, "{:+} {:+} {: } {: } {:-}", 1, -1, 1, -1, 1) == "+1 -1  1 -1 1");
+      CHECK(etl::format(s, "{:c}", 65) == "A");
+    }
+
+    //*************************************************************************
+    TEST(test_width_fill_and_alignment)
+    {
+      String s;
+
+      CHECK(etl::format(s, "[{:6}]", 42) == "[    42]");
+      CHECK(etl::format(s, "[{:<6}]", 42) == "[42    ]");
+      CHECK(etl::format(s, "[{:^6}]", 42) == "[  42  ]");
+      CHECK(etl::format(s, "[{:^7}]", 42) == "[  42   ]");
+      CHECK(etl::format(s, "[{:*>6}]", 42) == "[****42]");
+      CHECK(etl::format(s, "[{:06}]", -42) == "[-00042]");
+      CHECK(etl::format(s, "[{:#010x}]", 255) == "[0x000000ff]");
+      CHECK(etl::format(s, "[{:<06}]", 42) == "[42    ]");
+      CHECK(etl::format(s, "[{:2}]", 12345) == "[12345]");
+      CHECK(etl::format(s, "[{:6}]", "ab") == "[ab    ]");
+      CHECK(etl::format(s, "[{:>6}]", "ab") == "[    ab]");
+      CHECK(etl::format(s, "[{:-^6}]", 'x') == "[--x---]");
+    }
+
+    //*************************************************************************
+    TEST(test_bool_and_char)
+    {
+      String s;
+
+      CHECK(etl::format(s, "{} {}", true, false) == "true false");
+      CHECK(etl::format(s, "{:s} {:d}", true, true) == "true 1");
+      CHECK(etl::format(s, "{:6}|", false) == "false |");
+      CHECK(etl::format(s, "{} {:c} {:d} {:x}", 'a', 'b', 'a', 'a') == "a b 97 61");
+    }
+
+    //*************************************************************************
+    TEST(test_strings)
+    {
+      String s;
+
+      const char* p = "pointer";
+      char array[] = "array";
+      etl::string<10> text("string");
+      etl::string_view view("view");
+
+      CHECK(etl::format(s, "{} {} {} {} {}", p, array, text, view, "literal") == "pointer array string view literal");
+      CHECK(etl::format(s, "{:.3}|{:5.2}|", "abcdef", view) == "abc|vi   |");
+      CHECK(etl::format(s, "{:s}", static_cast<const char*>(ETL_NULLPTR)) == "");
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      String s;
+
+      CHECK(etl::format(s, "{}", 0.1) == "0.1");
+      CHECK(etl::format(s, "{}", 1.5f) == "1.5");
+      CHECK(etl::format(s, "{}", -2.25) == "-2.25");
+      CHECK(etl::format(s, "{:f}", 1.5) == "1.500000");
+      CHECK(etl::format(s, "{:.2f}", 3.14159) == "3.14");
+      CHECK(etl::format(s, "{:+.1f}", 2.0) == "+2.0");
+      CHECK(etl::format(s, "{:08.2f}", -3.14159) == "-0003.14");
+      CHECK(etl::format(s, "{:>8.2f}", 3.14159) == "    3.14");
+      CHECK(etl::format(s, "{:<8.2f}|", 3.14159) == "3.14    |");
+    }
+
+    //*************************************************************************
+    TEST(test_pointers)
+    {
+      String s;
+
+      int value = 0;
+      const void* p = &value;
+
+      etl::string<32> expected;
+      etl::to_string(reinterpret_cast<uintptr_t>(p), expected, etl::format_spec().hex());
+      expected.insert(expected.begin(), 'x');
+      expected.insert(expected.begin(), '0');
+
+      CHECK(etl::format(s, "{}", p) == expected);
+      CHECK(etl::format(s, "{:p}", nullptr) == "0x0");
+      CHECK(etl::format(s, "[{:5}]", nullptr) == "[  0x0]");
+    }
+
+    //*************************************************************************
+    TEST(test_argument_indexes)
+    {
+      String s;
+
+      CHECK(etl::format(s, "{1} {0}", "World", "Hello") == "Hello World");
+      CHECK(etl::format(s, "{0}{0}", 1, 2) == "11");
+    }
+
+    //*************************************************************************
+    TEST(test_format_to_output_iterator)
+    {
+      std::string text;
+
+      std::back_insert_iterator<std::string> itr = etl::format_to(std::back_inserter(text), "{}-{:03}", "id", 7);
+      *itr = '!';
+
+      CHECK_EQUAL(std::string("id-007!"), text);
+
+      char buffer[16] = {};
+      char* p_end = etl::format_to(buffer, "{:x}", 0xBEEF);
+
+      CHECK_EQUAL(4, p_end - buffer);
+      CHECK_EQUAL(std::string("beef"), std::string(buffer));
+    }
+
+    //*************************************************************************
+    TEST(test_formatted_size)
+    {
+      CHECK_EQUAL(11U, etl::formatted_size("{} {:>5}", "abcde", 1));
+      CHECK_EQUAL(0U, etl::formatted_size(""));
+    }
+
+    //*************************************************************************
+    TEST(test_truncation)
+    {
+      etl::string<5> s;
+
+      etl::format(s, "{}", 1234567);
+
+      CHECK(s == "12345");
+      CHECK(s.is_truncated());
+    }
+
+#if !ETL_USING_CPP20
+    //*************************************************************************
+    // In C++20 these are compile time errors.
+    TEST(test_invalid_format_strings)
+    {
+      // Invalid format strings, constructed at run time.
+      const char* invalid[] = { "{", "}", "{:", "{0", "{}{}", "{1}", "{0}{}", "{:q}", "{:.}", "{:99999}", "{:.2}", "{:#}" };
+
+      for (size_t i = 0U; i < (sizeof(invalid) / sizeof(invalid[0])); ++i)
+      {
+        etl::string_view text(invalid[i]);
+
+        CHECK_THROW(etl::basic_format_string<double>{text}, etl::format_error);
+      }
+
+      CHECK_THROW(etl::basic_format_string<const char*>{etl::string_view("{:+}")}, etl::format_error);
+      CHECK_THROW(etl::basic_format_string<int>{etl::string_view("{:.2}")}, etl::format_error);
+      CHECK_THROW(etl::basic_format_string<bool>{etl::string_view("{:+s}")}, etl::format_error);
+      CHECK_THROW(etl::basic_format_string<const void*>{etl::string_view("{:x}")}, etl::format_error);
+    }
+#endif
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_constexpr_format_string)
+    {
+      static constexpr etl::format_string<int, const char*> fmt("{:>4}:{}");
+
+      static_assert(fmt.is_valid(), "Format string should be valid");
+      static_assert(fmt.get().size() == 8U, "Wrong format string length");
+
+      String s;
+
+      CHECK(etl::format(s, fmt, 12, "ab") == "  12:ab");
+    }
+#endif
+  }
+}
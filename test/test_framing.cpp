@@ -0,0 +1,375 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/framing.h"
+#include "etl/crc32.h"
+
+#include <vector>
+#include <cstdlib>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //***********************************
+  // Collects the decoded frames.
+  //***********************************
+  struct Frames
+  {
+    void add(etl::span<const uint8_t> frame)
+    {
+      frames.push_back(Bytes(frame.begin(), frame.end()));
+    }
+
+    std::vector<Bytes> frames;
+  };
+
+  typedef etl::private_framing::frame_decoder::callback_type Callback;
+
+  //***********************************
+  // Encodes a whole frame in chunks of chunk_size.
+  //***********************************
+  template <typename TEncoder>
+  Bytes encode(TEncoder& encoder, const Bytes& payload, size_t chunk_size)
+  {
+    Bytes output;
+
+    for (size_t i = 0U; i < payload.size(); i += chunk_size)
+    {
+      const size_t n = ((payload.size() - i) < chunk_size) ? (payload.size() - i) : chunk_size;
+
+      Bytes chunk(encoder.encode_size(n));
+      chunk.resize(encoder.encode(payload.data() + i, n, chunk.data(), chunk.size()));
+      output.insert(output.end(), chunk.begin(), chunk.end());
+    }
+
+    Bytes tail(encoder.finish_size());
+    tail.resize(encoder.finish(tail.data(), tail.size()));
+    output.insert(output.end(), tail.begin(), tail.end());
+
+    return output;
+  }
+
+  //***********************************
+  // Decodes in chunks of chunk_size.
+  //***********************************
+  template <typename TDecoder>
+  size_t decode(TDecoder& decoder, const Bytes& input, size_t chunk_size)
+  {
+    size_t frames = 0U;
+
+    for (size_t i = 0U; i < input.size(); i += chunk_size)
+    {
+      const size_t n = ((input.size() - i) < chunk_size) ? (input.size() - i) : chunk_size;
+
+      frames += decoder.decode(input.data() + i, n);
+    }
+
+    return frames;
+  }
+
+  //***********************************
+  Bytes make_payload(size_t length, unsigned seed)
+  {
+    Bytes payload(length);
+
+    srand(seed);
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+      // Plenty of the special bytes.
+      const int r = rand() % 8;
+      payload[i] = (r == 0) ? 0x00U : (r == 1) ? 0x7EU : (r == 2) ? 0x7DU : (r == 3) ? 0xC0U : (r == 4) ? 0xDBU : uint8_t(rand());
+    }
+
+    return payload;
+  }
+
+  //***********************************
+  Bytes range(int first, int last)
+  {
+    Bytes bytes;
+
+    for (int i = first; i <= last; ++i)
+    {
+      bytes.push_back(uint8_t(i));
+    }
+
+    return bytes;
+  }
+
+  //***********************************
+  Bytes concat(const Bytes& a, const Bytes& b)
+  {
+    Bytes result(a);
+    result.insert(result.end(), b.begin(), b.end());
+
+    return result;
+  }
+
+  SUITE(test_framing)
+  {
+    //*************************************************************************
+    TEST(test_cobs_encode_known_values)
+    {
+      etl::cobs_encoder encoder;
+
+      CHECK((Bytes{ 0x01, 0x01, 0x00 })                   == encode(encoder, Bytes{ 0x00 }, 1U));
+      CHECK((Bytes{ 0x01, 0x01, 0x01, 0x00 })             == encode(encoder, Bytes{ 0x00, 0x00 }, 1U));
+      CHECK((Bytes{ 0x01, 0x02, 0x11, 0x01, 0x00 })       == encode(encoder, Bytes{ 0x00, 0x11, 0x00 }, 2U));
+      CHECK((Bytes{ 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 }) == encode(encoder, Bytes{ 0x11, 0x22, 0x00, 0x33 }, 3U));
+      CHECK((Bytes{ 0x05, 0x11, 0x22, 0x33, 0x44, 0x00 }) == encode(encoder, Bytes{ 0x11, 0x22, 0x33, 0x44 }, 4U));
+      CHECK((Bytes{ 0x02, 0x11, 0x01, 0x01, 0x01, 0x00 }) == encode(encoder, Bytes{ 0x11, 0x00, 0x00, 0x00 }, 1U));
+      CHECK((Bytes{ 0x01, 0x00 })                         == encode(encoder, Bytes{}, 1U));
+
+      // 254 non-zero bytes.
+      CHECK(concat(concat(Bytes{ 0xFF }, range(1, 254)), Bytes{ 0x00 }) == encode(encoder, range(1, 254), 100U));
+
+      // A zero then 254 non-zero bytes.
+      CHECK(concat(concat(Bytes{ 0x01, 0xFF }, range(1, 254)), Bytes{ 0x00 }) == encode(encoder, concat(Bytes{ 0x00 }, range(1, 254)), 7U));
+
+      // 255 non-zero bytes.
+      CHECK(concat(concat(Bytes{ 0xFF }, range(1, 254)), Bytes{ 0x02, 0xFF, 0x00 }) == encode(encoder, range(1, 255), 255U));
+
+      // 254 non-zero bytes then a zero.
+      CHECK(concat(concat(Bytes{ 0xFF }, range(2, 255)), Bytes{ 0x01, 0x01, 0x00 }) == encode(encoder, concat(range(2, 255), Bytes{ 0x00 }), 1U));
+
+      // 253 non-zero bytes, a zero, then a non-zero byte.
+      CHECK(concat(concat(Bytes{ 0xFE }, range(3, 255)), Bytes{ 0x02, 0x01, 0x00 }) == encode(encoder, concat(range(3, 255), Bytes{ 0x00, 0x01 }), 50U));
+    }
+
+    //*************************************************************************
+    TEST(test_cobs_round_trip)
+    {
+      Frames frames;
+      etl::cobs_encoder encoder;
+      etl::cobs_decoder<1000U> decoder(Callback::create<Frames, &Frames::add>(frames));
+
+      std::vector<Bytes> payloads;
+      Bytes stream;
+
+      for (unsigned i = 0U; i < 50U; ++i)
+      {
+        payloads.push_back(make_payload((i * 37U) % 1000U, i));
+        stream = concat(stream, encode(encoder, payloads.back(), 1U + (i % 300U)));
+      }
+
+      for (size_t chunk_size = 1U; chunk_size < 600U; chunk_size += 97U)
+      {
+        frames.frames.clear();
+
+        CHECK_EQUAL(payloads.size(), decode(decoder, stream, chunk_size));
+        CHECK(payloads == frames.frames);
+        CHECK_EQUAL(0U, decoder.error_count());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_cobs_decode_errors)
+    {
+      Frames frames;
+      etl::cobs_decoder<4U> decoder(Callback::create<Frames, &Frames::add>(frames));
+
+      // A delimiter within a block, then a good frame.
+      Bytes stream{ 0x05, 0x11, 0x22, 0x00, 0x03, 0x11, 0x22, 0x00 };
+
+      CHECK_EQUAL(1U, decoder.decode(stream.data(), stream.size()));
+      CHECK_EQUAL(1U, decoder.error_count());
+      CHECK_EQUAL(1U, frames.frames.size());
+      CHECK((Bytes{ 0x11, 0x22 }) == frames.frames[0]);
+
+      // Too large, then a good frame. Extra delimiters are ignored.
+      stream = Bytes{ 0x06, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00 };
+
+      CHECK_EQUAL(1U, decoder.decode(stream.data(), stream.size()));
+      CHECK_EQUAL(2U, decoder.error_count());
+      CHECK_EQUAL(2U, frames.frames.size());
+      CHECK((Bytes{ 0x01 }) == frames.frames[1]);
+
+      decoder.reset();
+      CHECK_EQUAL(0U, decoder.error_count());
+    }
+
+    //*************************************************************************
+    TEST(test_cobs_encoder_overflow)
+    {
+      etl::cobs_encoder encoder;
+
+      const uint8_t input[] = { 0x01, 0x02, 0x03 };
+      uint8_t output[2];
+
+      CHECK_THROW(encoder.encode(input, 3U, output, 2U), etl::framing_overflow);
+    }
+
+    //*************************************************************************
+    TEST(test_slip_encode_known_values)
+    {
+      etl::slip_encoder encoder;
+
+      CHECK((Bytes{ 0xC0, 0xDB, 0xDC, 0xDB, 0xDD, 0x01, 0xC0 }) == encode(encoder, Bytes{ 0xC0, 0xDB, 0x01 }, 1U));
+      CHECK((Bytes{ 0xC0, 0x01, 0x02, 0xC0 })                   == encode(encoder, Bytes{ 0x01, 0x02 }, 2U));
+      CHECK((Bytes{ 0xC0, 0xC0 })                               == encode(encoder, Bytes{}, 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_slip_round_trip)
+    {
+      Frames frames;
+      etl::slip_encoder encoder;
+      etl::slip_decoder<1000U> decoder(Callback::create<Frames, &Frames::add>(frames));
+
+      std::vector<Bytes> payloads;
+      Bytes stream;
+
+      for (unsigned i = 0U; i < 50U; ++i)
+      {
+        payloads.push_back(make_payload(1U + ((i * 37U) % 999U), i));
+        stream = concat(stream, encode(encoder, payloads.back(), 1U + (i % 300U)));
+      }
+
+      for (size_t chunk_size = 1U; chunk_size < 600U; chunk_size += 97U)
+      {
+        frames.frames.clear();
+
+        CHECK_EQUAL(payloads.size(), decode(decoder, stream, chunk_size));
+        CHECK(payloads == frames.frames);
+        CHECK_EQUAL(0U, decoder.error_count());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_slip_decode_errors)
+    {
+      Frames frames;
+      etl::slip_decoder<4U> decoder(Callback::create<Frames, &Frames::add>(frames));
+
+      // An invalid escape, too large, then a good frame.
+      Bytes stream{ 0xC0, 0x01, 0xDB, 0x02, 0x03, 0xC0, 0x01, 0x02, 0x03, 0x04, 0x05, 0xC0, 0xDB, 0xDD, 0xC0 };
+
+      CHECK_EQUAL(1U, decoder.decode(stream.data(), stream.size()));
+      CHECK_EQUAL(2U, decoder.error_count());
+      CHECK_EQUAL(1U, frames.frames.size());
+      CHECK((Bytes{ 0xDB }) == frames.frames[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_hdlc_encode_known_values)
+    {
+      etl::hdlc_encoder<> encoder;
+
+      // The FCS of "123456789" is 0x906E.
+      Bytes payload = range('1', '9');
+      Bytes expected = concat(concat(Bytes{ 0x7E }, payload), Bytes{ 0x6E, 0x90, 0x7E });
+
+      CHECK(expected == encode(encoder, payload, 4U));
+
+      // Stuffing of the payload.
+      Bytes stuffed = encode(encoder, Bytes{ 0x7E, 0x7D, 0x01 }, 1U);
+
+      CHECK(stuffed.size() >= 7U);
+      CHECK((Bytes{ 0x7E, 0x7D, 0x5E, 0x7D, 0x5D, 0x01 }) == Bytes(stuffed.begin(), stuffed.begin() + 6));
+    }
+
+    //*************************************************************************
+    TEST(test_hdlc_round_trip)
+    {
+      Frames frames;
+      etl::hdlc_encoder<> encoder;
+      etl::hdlc_decoder<1000U> decoder(Callback::create<Frames, &Frames::add>(frames));
+
+      CHECK_EQUAL(1000U, decoder.max_frame_size());
+
+      std::vector<Bytes> payloads;
+      Bytes stream;
+
+      for (unsigned i = 0U; i < 50U; ++i)
+      {
+        payloads.push_back(make_payload((i * 37U) % 1001U, i));
+        stream = concat(stream, encode(encoder, payloads.back(), 1U + (i % 300U)));
+      }
+
+      for (size_t chunk_size = 1U; chunk_size < 600U; chunk_size += 97U)
+      {
+        frames.frames.clear();
+
+        CHECK_EQUAL(payloads.size(), decode(decoder, stream, chunk_size));
+        CHECK(payloads == frames.frames);
+        CHECK_EQUAL(0U, decoder.error_count());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_hdlc_crc32_round_trip)
+    {
+      Frames frames;
+      etl::hdlc_encoder<etl::crc32> encoder;
+      etl::hdlc_decoder<64U, etl::crc32> decoder(Callback::create<Frames, &Frames::add>(frames));
+
+      // The FCS of "123456789" is 0xCBF43926.
+      Bytes payload = range('1', '9');
+      Bytes stream  = encode(encoder, payload, 3U);
+
+      CHECK(concat(concat(Bytes{ 0x7E }, payload), Bytes{ 0x26, 0x39, 0xF4, 0xCB, 0x7E }) == stream);
+
+      CHECK_EQUAL(1U, decoder.decode(stream.data(), stream.size()));
+      CHECK(payload == frames.frames[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_hdlc_decode_errors)
+    {
+      Frames frames;
+      etl::hdlc_encoder<> encoder;
+      etl::hdlc_decoder<16U> decoder(Callback::create<Frames, &Frames::add>(frames));
+
+      Bytes good = encode(encoder, range('1', '9'), 9U);
+
+      // Bad FCS.
+      Bytes bad = good;
+      bad[3] ^= 0x01U;
+
+      // Aborted.
+      Bytes aborted{ 0x7E, 0x01, 0x02, 0x7D, 0x7E };
+
+      // Too large.
+      Bytes large = encode(encoder, range(1, 20), 20U);
+
+      // Too short for the FCS.
+      Bytes short_frame{ 0x7E, 0x01, 0x7E };
+
+      Bytes stream = concat(concat(concat(concat(bad, aborted), large), short_frame), good);
+
+      CHECK_EQUAL(1U, decoder.decode(stream.data(), stream.size()));
+      CHECK_EQUAL(4U, decoder.error_count());
+      CHECK_EQUAL(1U, frames.frames.size());
+      CHECK(range('1', '9') == frames.frames[0]);
+    }
+  };
+}
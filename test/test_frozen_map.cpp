@@ -0,0 +1,235 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/frozen_map.h"
+
+#include <set>
+
+#if ETL_USING_CPP11
+
+namespace
+{
+  enum class Command
+  {
+    Add,
+    Remove,
+    Clear,
+    List,
+    Unknown
+  };
+
+  typedef etl::frozen_map<int, int, 6> IntMap;
+
+#if ETL_USING_CPP14
+  //*************************************************************************
+  // A large table, generated at compile time.
+  //*************************************************************************
+  struct Elements
+  {
+    etl::pair<uint32_t, uint32_t> data[256];
+  };
+
+  constexpr Elements make_elements()
+  {
+    Elements elements{};
+
+    for (uint32_t i = 0U; i < 256U; ++i)
+    {
+      elements.data[i].first  = i * 7919U;
+      elements.data[i].second = i;
+    }
+
+    return elements;
+  }
+
+  constexpr Elements large_elements = make_elements();
+#endif
+
+  SUITE(test_frozen_map)
+  {
+    //*************************************************************************
+    TEST(test_find_int_keys)
+    {
+      const IntMap::value_type elements[] = { { 1, 10 }, { 2, 20 }, { 3, 30 }, { 100, 1000 }, { -5, -50 }, { 64, 640 } };
+
+      IntMap map(elements);
+
+      CHECK_EQUAL(6U, map.size());
+      CHECK(!map.empty());
+
+      for (const auto& element : elements)
+      {
+        IntMap::const_iterator itr = map.find(element.first);
+
+        CHECK(itr != map.end());
+        CHECK_EQUAL(element.first,  itr->first);
+        CHECK_EQUAL(element.second, itr->second);
+        CHECK_EQUAL(element.second, map.at(element.first));
+        CHECK(map.contains(element.first));
+        CHECK_EQUAL(1U, map.count(element.first));
+      }
+
+      CHECK(map.find(4) == map.end());
+      CHECK(!map.contains(0));
+      CHECK_EQUAL(0U, map.count(-1));
+    }
+
+    //*************************************************************************
+    TEST(test_iteration_visits_every_element_once)
+    {
+      const IntMap::value_type elements[] = { { 1, 10 }, { 2, 20 }, { 3, 30 }, { 4, 40 }, { 5, 50 }, { 6, 60 } };
+
+      IntMap map(elements);
+
+      std::set<int> keys;
+
+      for (IntMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+      {
+        CHECK_EQUAL(itr->first * 10, itr->second);
+        keys.insert(itr->first);
+      }
+
+      CHECK_EQUAL(6U, keys.size());
+    }
+
+    //*************************************************************************
+    TEST(test_at_missing_key)
+    {
+      const IntMap::value_type elements[] = { { 1, 10 }, { 2, 20 }, { 3, 30 }, { 4, 40 }, { 5, 50 }, { 6, 60 } };
+
+      IntMap map(elements);
+
+      CHECK_THROW(map.at(7), etl::frozen_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_duplicate_keys)
+    {
+      const IntMap::value_type elements[] = { { 1, 10 }, { 2, 20 }, { 3, 30 }, { 2, 40 }, { 5, 50 }, { 6, 60 } };
+
+      CHECK_THROW(IntMap map(elements), etl::frozen_map_build_failed);
+    }
+
+    //*************************************************************************
+    TEST(test_string_view_keys)
+    {
+      typedef etl::frozen_map<etl::string_view, Command, 4> CommandMap;
+
+      const CommandMap::value_type elements[] = { { etl::string_view("add"),    Command::Add },
+                                                  { etl::string_view("remove"), Command::Remove },
+                                                  { etl::string_view("clear"),  Command::Clear },
+                                                  { etl::string_view("list"),   Command::List } };
+
+      CommandMap commands(elements);
+
+      CHECK(commands.at(etl::string_view("add"))    == Command::Add);
+      CHECK(commands.at(etl::string_view("remove")) == Command::Remove);
+      CHECK(commands.at(etl::string_view("clear"))  == Command::Clear);
+      CHECK(commands.at(etl::string_view("list"))   == Command::List);
+
+      CHECK(!commands.contains(etl::string_view("ad")));
+      CHECK(!commands.contains(etl::string_view("lists")));
+      CHECK(!commands.contains(etl::string_view("")));
+    }
+
+    //*************************************************************************
+    TEST(test_enum_keys)
+    {
+      typedef etl::frozen_map<Command, const char*, 4> NameMap;
+
+      const NameMap::value_type elements[] = { { Command::Add, "add" }, { Command::Remove, "remove" }, { Command::Clear, "clear" }, { Command::List, "list" } };
+
+      NameMap names(elements);
+
+      CHECK_EQUAL(std::string("remove"), std::string(names.at(Command::Remove)));
+      CHECK(!names.contains(Command::Unknown));
+    }
+
+    //*************************************************************************
+    TEST(test_single_element)
+    {
+      const etl::frozen_map<int, int, 1>::value_type elements[] = { { 42, 1 } };
+
+      etl::frozen_map<int, int, 1> map(elements);
+
+      CHECK_EQUAL(1, map.at(42));
+      CHECK(!map.contains(41));
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      static constexpr auto map = etl::make_frozen_map<int, int>({ { 1, 10 }, { 2, 20 }, { 3, 30 }, { 100, 1000 } });
+
+      static_assert(map.size() == 4U, "Wrong size");
+      static_assert(map.at(1) == 10, "Wrong value");
+      static_assert(map.at(100) == 1000, "Wrong value");
+      static_assert(map.contains(3), "Missing key");
+      static_assert(!map.contains(4), "Unexpected key");
+
+      CHECK_EQUAL(20, map.at(2));
+    }
+
+    //*************************************************************************
+    TEST(test_constexpr_string_view_keys)
+    {
+      static constexpr etl::frozen_map<etl::string_view, Command, 3>::value_type elements[] = { { etl::string_view("add", 3U),    Command::Add },
+                                                                                               { etl::string_view("remove", 6U), Command::Remove },
+                                                                                               { etl::string_view("clear", 5U),  Command::Clear } };
+
+      static constexpr etl::frozen_map<etl::string_view, Command, 3> commands(elements);
+
+      static_assert(commands.at(etl::string_view("clear", 5U)) == Command::Clear, "Wrong value");
+      static_assert(!commands.contains(etl::string_view("list", 4U)), "Unexpected key");
+
+      CHECK(commands.at(etl::string_view("add", 3U)) == Command::Add);
+    }
+
+    //*************************************************************************
+    TEST(test_constexpr_large)
+    {
+      static constexpr etl::frozen_map<uint32_t, uint32_t, 256> map(large_elements.data);
+
+      static_assert(map.at(255U * 7919U) == 255U, "Wrong value");
+      static_assert(!map.contains(1U), "Unexpected key");
+
+      for (uint32_t i = 0U; i < 256U; ++i)
+      {
+        CHECK_EQUAL(i, map.at(i * 7919U));
+      }
+
+      CHECK(!map.contains(7918U));
+    }
+#endif
+  }
+}
+
+#endif
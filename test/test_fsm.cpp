@@ -29,6 +29,8 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include "etl/fsm.h"
+#include "etl/fsm_event_queue.h"
+#include "etl/message_packet.h"
 #include "etl/enum_type.h"
 #include "etl/container.h"
 #include "etl/packet.h"
@@ -36,6 +38,7 @@ SOFTWARE.
 
 #include <iostream>
 #include <limits>
+#include <vector>
 
 namespace
 {
@@ -362,6 +365,68 @@ namespace
 
   MotorControl motorControl;
 
+  //***************************************************************************
+  // A counter that sends itself messages from its handler, to test run to completion.
+  //***************************************************************************
+  const etl::message_router_id_t Counter_Id = 1;
+
+  struct CountDown : public etl::message<10>
+  {
+    explicit CountDown(int count_) : count(count_) {}
+
+    int count;
+  };
+
+  struct Other : public etl::message<11>
+  {
+  };
+
+  typedef etl::message_packet<CountDown> CounterPacket;
+
+  class Counter : public etl::fsm
+  {
+  public:
+
+    Counter()
+      : fsm(Counter_Id)
+      , depth(0)
+      , max_depth(0)
+    {
+    }
+
+    int depth;
+    int max_depth;
+    std::vector<int> handled;
+  };
+
+  class Counting : public etl::fsm_state<Counter, Counting, 0, CountDown>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const CountDown& message)
+    {
+      Counter& counter = get_fsm_context();
+
+      ++counter.depth;
+      counter.max_depth = (counter.depth > counter.max_depth) ? counter.depth : counter.max_depth;
+      counter.handled.push_back(message.count);
+
+      if (message.count > 0)
+      {
+        counter.receive(CountDown(message.count - 1));
+      }
+
+      --counter.depth;
+
+      return No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+  };
+
   SUITE(test_fsm_states)
   {
     //*************************************************************************
@@ -673,6 +738,105 @@ namespace
       CHECK_TRUE(motorControl.entered_state);
     }
 
+    //*************************************************************************
+    TEST(test_fsm_without_event_queue_recurses)
+    {
+      Counting counting;
+      etl::ifsm_state* states[] = { &counting };
+
+      Counter counter;
+      counter.set_states(states, 1U);
+      counter.start();
+
+      counter.receive(CountDown(3));
+
+      CHECK_EQUAL(4, counter.max_depth);
+      CHECK_EQUAL(4U, counter.handled.size());
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_event_queue_run_to_completion)
+    {
+      Counting counting;
+      etl::ifsm_state* states[] = { &counting };
+
+      etl::fsm_event_queue<CounterPacket, 2> events;
+
+      Counter counter;
+      counter.set_states(states, 1U);
+      counter.set_event_queue(events);
+      counter.start();
+
+      counter.receive(CountDown(3));
+
+      // Each message is handled after the previous one has completed.
+      CHECK_EQUAL(1, counter.max_depth);
+
+      std::vector<int> expected = { 3, 2, 1, 0 };
+      CHECK(expected == counter.handled);
+      CHECK(events.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_event_queue_post_and_process_queue)
+    {
+      Counting counting;
+      etl::ifsm_state* states[] = { &counting };
+
+      etl::fsm_event_queue_spsc_atomic<CounterPacket, 4> events;
+
+      Counter counter;
+      counter.set_states(states, 1U);
+
+      // No queue.
+      CHECK_FALSE(counter.post(CountDown(0)));
+
+      counter.set_event_queue(events);
+
+      CHECK(counter.post(CountDown(0)));
+      CHECK(counter.post(CountDown(1)));
+      CHECK_FALSE(counter.post(Other())); // Not held by the packet.
+
+      // Not started.
+      CHECK_EQUAL(0U, counter.process_queue());
+
+      counter.start();
+
+      // Only enqueued.
+      CHECK_EQUAL(0U, counter.handled.size());
+
+      // The second message queues another.
+      CHECK_EQUAL(2U, counter.process_queue(2U));
+      CHECK_EQUAL(1U, events.size());
+
+      CHECK_EQUAL(1U, counter.process_queue());
+      CHECK_EQUAL(0U, counter.process_queue());
+
+      std::vector<int> expected = { 0, 1, 0 };
+      CHECK(expected == counter.handled);
+      CHECK_EQUAL(1, counter.max_depth);
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_event_queue_full)
+    {
+      Counting counting;
+      etl::ifsm_state* states[] = { &counting };
+
+      etl::fsm_event_queue<CounterPacket, 1> events;
+
+      Counter counter;
+      counter.set_states(states, 1U);
+      counter.set_event_queue(events);
+      counter.start();
+
+      CHECK(counter.post(CountDown(1)));
+      CHECK_FALSE(counter.post(CountDown(1)));
+
+      // The handler cannot defer its message.
+      CHECK_THROW(counter.process_queue(), etl::fsm_event_queue_full);
+    }
+
     //*************************************************************************
     TEST(test_fsm_no_states_and_no_start)
     {
@@ -0,0 +1,264 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fsm_ct.h"
+
+#include <string>
+
+#if ETL_USING_CPP17
+
+namespace
+{
+  //***************************************************************************
+  // Events
+  struct EventId
+  {
+    enum
+    {
+      Start,
+      Stop,
+      Stopped,
+      Set_Speed,
+      Self_Transition,
+      Unsupported
+    };
+  };
+
+  struct Start          : public etl::message<EventId::Start> {};
+  struct Stop           : public etl::message<EventId::Stop> {};
+  struct Stopped        : public etl::message<EventId::Stopped> {};
+  struct SelfTransition : public etl::message<EventId::Self_Transition> {};
+  struct Unsupported    : public etl::message<EventId::Unsupported> {};
+
+  struct SetSpeed : public etl::message<EventId::Set_Speed>
+  {
+    explicit SetSpeed(int speed_) : speed(speed_) {}
+
+    int speed;
+  };
+
+  //***************************************************************************
+  // States
+  struct StateId
+  {
+    enum
+    {
+      Idle,
+      Running,
+      Winding_Down,
+      Locked,
+      Number_Of_States
+    };
+  };
+
+  //***************************************************************************
+  // The context, recording what happened.
+  //***************************************************************************
+  struct MotorControl
+  {
+    std::string log;
+    int         speed   = 0;
+    int         unknown = 0;
+    bool        lock    = false;
+  };
+
+  //***********************************
+  class Idle : public etl::fsm_ct_state<MotorControl, Idle, StateId::Idle, Start, SelfTransition>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Start&)          { get_fsm_context().log += "start,"; return StateId::Running; }
+    etl::fsm_state_id_t on_event(const SelfTransition&) { return Self_Transition; }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      ++get_fsm_context().unknown;
+      return No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_enter_state()
+    {
+      get_fsm_context().log += "+idle,";
+      return get_fsm_context().lock ? etl::fsm_state_id_t(StateId::Locked) : No_State_Change;
+    }
+
+    void on_exit_state() { get_fsm_context().log += "-idle,"; }
+  };
+
+  //***********************************
+  class Running : public etl::fsm_ct_state<MotorControl, Running, StateId::Running, Stop, SetSpeed>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Stop&)             { return StateId::Winding_Down; }
+    etl::fsm_state_id_t on_event(const SetSpeed& message) { get_fsm_context().speed = message.speed; return No_State_Change; }
+
+    etl::fsm_state_id_t on_enter_state() { get_fsm_context().log += "+running,"; return No_State_Change; }
+    void on_exit_state()                 { get_fsm_context().log += "-running,"; }
+  };
+
+  //***********************************
+  class WindingDown : public etl::fsm_ct_state<MotorControl, WindingDown, StateId::Winding_Down, Stopped>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Stopped&) { return StateId::Idle; }
+  };
+
+  //***********************************
+  // A state with no message handlers.
+  class Locked : public etl::fsm_ct_state<MotorControl, Locked, StateId::Locked>
+  {
+  };
+
+  typedef etl::fsm_ct<MotorControl, Idle, Running, WindingDown, Locked> MotorFsm;
+
+  SUITE(test_fsm_ct)
+  {
+    //*************************************************************************
+    TEST(test_fsm_ct)
+    {
+      MotorControl motor;
+      MotorFsm fsm(motor);
+
+      CHECK(!fsm.is_started());
+      CHECK_THROW(fsm.receive(Start()), etl::fsm_not_started);
+
+      fsm.start();
+      CHECK(fsm.is_started());
+      CHECK_EQUAL(StateId::Idle, fsm.get_state_id());
+
+      // Not handled by Idle.
+      fsm.receive(Stop());
+      CHECK_EQUAL(StateId::Idle, fsm.get_state_id());
+      CHECK_EQUAL(1, motor.unknown);
+
+      fsm.receive(Start());
+      CHECK_EQUAL(StateId::Running, fsm.get_state_id());
+
+      fsm.receive(SetSpeed(100));
+      CHECK_EQUAL(100, motor.speed);
+
+      fsm.receive(Stop());
+      CHECK_EQUAL(StateId::Winding_Down, fsm.get_state_id());
+
+      // Unknown to Winding Down, using the default handler.
+      fsm.receive(Start());
+      CHECK_EQUAL(StateId::Winding_Down, fsm.get_state_id());
+
+      fsm.receive(Stopped());
+      CHECK_EQUAL(StateId::Idle, fsm.get_state_id());
+
+      CHECK_EQUAL(std::string("+idle,start,-idle,+running,-running,+idle,"), motor.log);
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_ct_receive_imessage)
+    {
+      MotorControl motor;
+      MotorFsm fsm(motor);
+
+      fsm.start(false);
+
+      const Start    start;
+      const SetSpeed set_speed(50);
+      const Stop     stop;
+
+      const etl::imessage* messages[] = { &start, &set_speed, &stop };
+
+      for (const etl::imessage* p_message : messages)
+      {
+        fsm.receive(*p_message);
+      }
+
+      CHECK_EQUAL(StateId::Winding_Down, fsm.get_state_id());
+      CHECK_EQUAL(50, motor.speed);
+
+      // Not handled by Winding Down.
+      fsm.receive(static_cast<const etl::imessage&>(Unsupported()));
+      CHECK_EQUAL(StateId::Winding_Down, fsm.get_state_id());
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_ct_self_transition)
+    {
+      MotorControl motor;
+      MotorFsm fsm(motor);
+
+      fsm.start();
+      motor.log.clear();
+
+      fsm.receive(SelfTransition());
+
+      CHECK_EQUAL(StateId::Idle, fsm.get_state_id());
+      CHECK_EQUAL(std::string("-idle,+idle,"), motor.log);
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_ct_change_state_on_entry)
+    {
+      MotorControl motor;
+      motor.lock = true;
+
+      MotorFsm fsm(motor);
+
+      // Idle moves straight on to Locked.
+      fsm.start();
+      CHECK_EQUAL(StateId::Locked, fsm.get_state_id());
+
+      // Locked handles nothing.
+      fsm.receive(Start());
+      CHECK_EQUAL(StateId::Locked, fsm.get_state_id());
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_ct_reset)
+    {
+      MotorControl motor;
+      MotorFsm fsm(motor);
+
+      fsm.start();
+      fsm.receive(Start());
+      motor.log.clear();
+
+      fsm.reset(true);
+      CHECK(!fsm.is_started());
+      CHECK_EQUAL(std::string("-running,"), motor.log);
+
+      fsm.start(false);
+      CHECK_EQUAL(StateId::Idle, fsm.get_state_id());
+
+      CHECK_EQUAL(StateId::Running, fsm.get_state<Running>().get_state_id());
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,257 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/future.h"
+#include "etl/generic_pool.h"
+
+#include <string>
+
+#if ETL_USING_CPP11
+
+namespace
+{
+  // Large enough for the states of all of the types used.
+  typedef etl::generic_pool<sizeof(etl::private_future::state<std::string>),
+                            etl::alignment_of<etl::private_future::state<std::string>>::value,
+                            8> Pool;
+
+  SUITE(test_future)
+  {
+    //*************************************************************************
+    TEST(test_set_value_then_get)
+    {
+      etl::future_pool<int, 1> pool;
+
+      etl::promise<int> promise(pool);
+      etl::future<int>  future = promise.get_future();
+
+      CHECK(future.valid());
+      CHECK(!future.is_ready());
+      CHECK_THROW(future.get(), etl::future_not_ready);
+
+      promise.set_value(42);
+
+      CHECK(future.is_ready());
+      CHECK_EQUAL(42, future.get());
+      CHECK_THROW(promise.set_value(43), etl::future_already_satisfied);
+      CHECK_THROW(promise.get_future(), etl::future_already_retrieved);
+    }
+
+    //*************************************************************************
+    TEST(test_state_returned_to_pool)
+    {
+      etl::future_pool<std::string, 2> pool;
+
+      {
+        etl::promise<std::string> promise(pool);
+        CHECK_EQUAL(1U, pool.size());
+
+        etl::future<std::string> future = promise.get_future();
+        promise.set_value("hello");
+
+        etl::promise<std::string> moved(etl::move(promise));
+        CHECK(!promise.valid());
+        CHECK_EQUAL(1U, pool.size());
+
+        CHECK_EQUAL(std::string("hello"), future.get());
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+
+      {
+        // A broken promise leaves the future not ready, until it is released.
+        etl::future<std::string> future;
+
+        {
+          etl::promise<std::string> promise(pool);
+          future = promise.get_future();
+        }
+
+        CHECK(future.valid());
+        CHECK(!future.is_ready());
+        CHECK_EQUAL(1U, pool.size());
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_pool_exhausted)
+    {
+      etl::future_pool<int, 1> pool;
+
+      etl::promise<int> promise(pool);
+
+      CHECK_THROW(etl::promise<int> another(pool), etl::pool_no_allocation);
+    }
+
+    //*************************************************************************
+    TEST(test_then_chain_inline)
+    {
+      Pool pool;
+
+      etl::promise<int> promise(pool);
+
+      int called = 0;
+
+      etl::future<std::string> result = promise.get_future()
+                                               .then(pool, [&called](int& value) { ++called; return value * 2; })
+                                               .then(pool, [&called](int& value) { ++called; return std::to_string(value); });
+
+      CHECK_EQUAL(0, called);
+      CHECK(!result.is_ready());
+
+      promise.set_value(21);
+
+      CHECK_EQUAL(2, called);
+      CHECK(result.is_ready());
+      CHECK_EQUAL(std::string("42"), result.get());
+
+      // The intermediate states have been released.
+      CHECK_EQUAL(2U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_then_when_already_ready)
+    {
+      Pool pool;
+
+      etl::promise<int> promise(pool);
+      etl::future<int>  future = promise.get_future();
+
+      promise.set_value(5);
+
+      etl::future<int> result = future.then(pool, [](int& value) { return value + 1; });
+
+      CHECK(result.is_ready());
+      CHECK_EQUAL(6, result.get());
+      CHECK_THROW(future.then(pool, [](int& value) { return value; }), etl::future_continuation_exists);
+    }
+
+    //*************************************************************************
+    TEST(test_void_futures)
+    {
+      Pool pool;
+
+      etl::promise<void> promise(pool);
+
+      int value = 0;
+
+      etl::future<void> done = promise.get_future()
+                                      .then(pool, [&value]() { value = 1; return 10; })
+                                      .then(pool, [&value](int& i) { value += i; });
+
+      CHECK(!done.is_ready());
+
+      promise.set_value();
+
+      CHECK(done.is_ready());
+      CHECK_EQUAL(11, value);
+    }
+
+    //*************************************************************************
+    TEST(test_then_posted_to_executor)
+    {
+      Pool pool;
+
+      etl::future_queue_executor<4> executor;
+
+      etl::future<int> result;
+
+      {
+        etl::promise<int> promise(pool);
+
+        result = promise.get_future()
+                        .then(pool, executor, [](int& value) { return value * 3; });
+
+        promise.set_value(3);
+      }
+
+      // The continuation has been posted, not run.
+      CHECK(!result.is_ready());
+      CHECK_EQUAL(1U, executor.size());
+      CHECK_EQUAL(2U, pool.size());
+
+      CHECK_EQUAL(1U, executor.run());
+
+      CHECK(executor.empty());
+      CHECK(result.is_ready());
+      CHECK_EQUAL(9, result.get());
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_when_all)
+    {
+      Pool pool;
+
+      etl::promise<int> promises[3] = { etl::promise<int>(pool), etl::promise<int>(pool), etl::promise<int>(pool) };
+      etl::future<int>  futures[3]  = { promises[0].get_future(), promises[1].get_future(), promises[2].get_future() };
+
+      promises[1].set_value(2);
+
+      int sum = 0;
+
+      etl::future<void> all = etl::when_all(pool, futures).then(pool, [&]() { sum = futures[0].get() + futures[1].get() + futures[2].get(); });
+
+      CHECK(!all.is_ready());
+
+      promises[2].set_value(3);
+      CHECK(!all.is_ready());
+
+      promises[0].set_value(1);
+      CHECK(all.is_ready());
+      CHECK_EQUAL(6, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_when_any)
+    {
+      Pool pool;
+
+      etl::promise<int> promises[3] = { etl::promise<int>(pool), etl::promise<int>(pool), etl::promise<int>(pool) };
+      etl::future<int>  futures[3]  = { promises[0].get_future(), promises[1].get_future(), promises[2].get_future() };
+
+      etl::future<size_t> any = etl::when_any(pool, futures);
+
+      CHECK(!any.is_ready());
+
+      promises[2].set_value(30);
+      CHECK(any.is_ready());
+      CHECK_EQUAL(2U, any.get());
+
+      promises[0].set_value(10);
+      CHECK_EQUAL(2U, any.get());
+    }
+  }
+}
+
+#endif
@@ -32,9 +32,12 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <stdint.h>
 
 #include "etl/hash.h"
+#include "etl/array.h"
+#include "etl/optional.h"
 
 // for testing user-defined hash specializations
 namespace { class CustomType{}; }
@@ -177,7 +180,12 @@ namespace
 
       if (ETL_PLATFORM_64BIT)
       {
+#if defined(ETL_USE_XXHASH)
+        const float value = 1.2345f;
+        CHECK_EQUAL(etl::xxhash64_calculate(reinterpret_cast<const uint8_t*>(&value), sizeof(value)), hash);
+#else
         CHECK_EQUAL(9821047038287739023U, hash);
+#endif
       }
     }
 
@@ -309,6 +317,105 @@ namespace
         CHECK_TRUE(std::is_copy_assignable<custom_hasher>::value);
         CHECK_TRUE(std::is_move_assignable<custom_hasher>::value);
     }
+
+    //*************************************************************************
+    TEST(test_hash_combine)
+    {
+      size_t seed1 = 0U;
+      etl::hash_combine(seed1, 1);
+      etl::hash_combine(seed1, 2);
+
+      size_t seed2 = 0U;
+      etl::hash_combine(seed2, 2);
+      etl::hash_combine(seed2, 1);
+
+      size_t seed3 = 0U;
+      etl::hash_combine(seed3, 1);
+      etl::hash_combine(seed3, 2);
+
+      CHECK(seed1 != seed2);
+      CHECK_EQUAL(seed1, seed3);
+
+      // Equal fields do not cancel out.
+      size_t seed4 = 0U;
+      etl::hash_combine(seed4, 5);
+      etl::hash_combine(seed4, 5);
+
+      CHECK(seed4 != 0U);
+    }
+
+    //*************************************************************************
+    TEST(test_hash_values)
+    {
+      size_t seed = 0U;
+      etl::hash_combine(seed, 1);
+      etl::hash_combine(seed, 'a');
+      etl::hash_combine(seed, 2.5);
+
+      CHECK_EQUAL(seed, etl::hash_values(1, 'a', 2.5));
+      CHECK(etl::hash_values(1, 2) != etl::hash_values(2, 1));
+      CHECK_EQUAL(0U, etl::hash_values());
+    }
+
+    //*************************************************************************
+    TEST(test_hash_pair_distribution)
+    {
+      typedef etl::pair<uint16_t, uint16_t> key_t;
+
+      // The keys that XOR would map to only 64 values.
+      const size_t Keys    = 64U * 64U;
+      const size_t Buckets = 1024U;
+
+      std::vector<size_t> hashes;
+      std::vector<int>    bucket_load(Buckets, 0);
+
+      etl::hash<key_t> hasher;
+
+      for (uint16_t a = 0U; a < 64U; ++a)
+      {
+        for (uint16_t b = 0U; b < 64U; ++b)
+        {
+          const size_t h = hasher(key_t(a, b));
+          hashes.push_back(h);
+          ++bucket_load[h % Buckets];
+        }
+      }
+
+      std::sort(hashes.begin(), hashes.end());
+      CHECK(std::unique(hashes.begin(), hashes.end()) == hashes.end());
+
+      // An average of 4 per bucket.
+      const int max_load = *std::max_element(bucket_load.begin(), bucket_load.end());
+      CHECK(max_load <= 16);
+
+      CHECK_EQUAL(Keys, hashes.size());
+    }
+
+    //*************************************************************************
+    TEST(test_hash_array)
+    {
+      etl::array<int, 3> a1 = { 1, 2, 3 };
+      etl::array<int, 3> a2 = { 1, 2, 3 };
+      etl::array<int, 3> a3 = { 3, 2, 1 };
+
+      etl::hash<etl::array<int, 3> > hasher;
+
+      CHECK_EQUAL(hasher(a1), hasher(a2));
+      CHECK(hasher(a1) != hasher(a3));
+      CHECK_EQUAL(etl::hash_values(1, 2, 3), hasher(a1));
+    }
+
+    //*************************************************************************
+    TEST(test_hash_optional)
+    {
+      etl::optional<int> empty;
+      etl::optional<int> full(42);
+
+      etl::hash<etl::optional<int> > hasher;
+
+      CHECK_EQUAL(0U, hasher(empty));
+      CHECK_EQUAL(etl::hash<int>()(42), hasher(full));
+    }
   };
 }
 
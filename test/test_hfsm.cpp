@@ -29,6 +29,8 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include "etl/hfsm.h"
+#include "etl/fsm_event_queue.h"
+#include "etl/message_packet.h"
 #include "etl/enum_type.h"
 #include "etl/container.h"
 #include "etl/packet.h"
@@ -842,6 +844,33 @@ namespace
       CHECK_EQUAL(0, motorControl.unknownCount);
     }
 
+    //*************************************************************************
+    TEST(test_hfsm_event_queue)
+    {
+      etl::fsm_event_queue<etl::message_packet<Start, Stop>, 2> events;
+
+      motorControl.Initialise(stateList, ETL_OR_STD17::size(stateList));
+      motorControl.reset();
+      motorControl.ClearStatistics();
+      motorControl.set_event_queue(events);
+
+      // Start the FSM.
+      motorControl.start(false);
+
+      // Now in Idle state.
+      CHECK(motorControl.post(Start()));
+      CHECK_EQUAL(StateId::Idle, int(motorControl.get_state_id()));
+
+      CHECK_EQUAL(1U, motorControl.process_queue());
+
+      // Now in winding up state.
+      CHECK_EQUAL(StateId::Winding_Up, int(motorControl.get_state_id()));
+      CHECK_EQUAL(true, motorControl.isLampOn);
+      CHECK_EQUAL(1, motorControl.startCount);
+
+      motorControl.clear_event_queue();
+    }
+
     //*************************************************************************
     TEST(test_hfsm_supported)
     {
@@ -376,5 +376,81 @@ namespace
       isEqual = std::equal(output2.begin(), output2.end(), histogram.begin());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    TEST(test_int_offset_0_histogram_add_bulk)
+    {
+      IntOffset0Histogram histogram;
+
+      histogram.add_bulk(input1.begin(), input1.end());
+
+      bool isEqual = std::equal(output1.begin(), output1.end(), histogram.begin());
+      CHECK(isEqual);
+      CHECK_EQUAL(55U, histogram.count());
+
+      histogram.clear();
+
+      // Fewer keys than lanes.
+      histogram.add_bulk(input1.begin(), input1.begin() + 3);
+      CHECK_EQUAL(3, histogram[5]);
+      CHECK_EQUAL(3U, histogram.count());
+    }
+
+    //*************************************************************************
+    TEST(test_int_offset_minus_4_histogram_add_bulk)
+    {
+      IntOffsetminus4Histogram histogram;
+
+      histogram.add_bulk(input2.begin(), input2.end());
+
+      bool isEqual = std::equal(output1.begin(), output1.end(), histogram.begin());
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST(test_int_runtime_offset_minus_4_histogram_add_bulk)
+    {
+      IntRuntimeOffsetHistogram histogram(Start);
+
+      histogram.add_bulk(input2.begin(), input2.end());
+
+      bool isEqual = std::equal(output1.begin(), output1.end(), histogram.begin());
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST(test_int_histogram_merge)
+    {
+      IntOffsetminus4Histogram histogram1(input2.begin(), input2.begin() + 20);
+      IntOffsetminus4Histogram histogram2(input2.begin() + 20, input2.end());
+
+      histogram1.merge(histogram2);
+
+      bool isEqual = std::equal(output1.begin(), output1.end(), histogram1.begin());
+      CHECK(isEqual);
+
+      IntRuntimeOffsetHistogram histogram3(Start, input2.begin(), input2.begin() + 33);
+      IntRuntimeOffsetHistogram histogram4(Start, input2.begin() + 33, input2.end());
+
+      histogram3.merge(histogram4);
+
+      isEqual = std::equal(output1.begin(), output1.end(), histogram3.begin());
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST(test_string_histogram_merge)
+    {
+      StringHistogram histogram1(input3.begin(), input3.begin() + 30);
+      StringHistogram histogram2(input3.begin() + 30, input3.end());
+
+      histogram1.merge(histogram2);
+
+      CHECK_EQUAL(Size, histogram1.size());
+      CHECK_EQUAL(55U,  histogram1.count());
+
+      bool isEqual = std::equal(output2.begin(), output2.end(), histogram1.begin());
+      CHECK(isEqual);
+    }
   };
 }
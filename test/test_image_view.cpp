@@ -0,0 +1,280 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/image_view.h"
+
+#include <string>
+#include <utility>
+
+namespace
+{
+  struct Entry
+  {
+    uint16_t id;
+    uint16_t flags;
+    int32_t  value;
+  };
+
+  struct EntryCompare
+  {
+    bool operator ()(const Entry& lhs, const Entry& rhs) const
+    {
+      return lhs.id < rhs.id;
+    }
+  };
+
+  typedef etl::sorted_array_view<int32_t>              IntView;
+  typedef etl::sorted_array_view<Entry, EntryCompare>  EntryView;
+  typedef etl::flat_map_view<uint32_t, int16_t>        MapView;
+
+  // Aligned storage for images.
+  uint64_t storage[64];
+
+  etl::span<uint8_t> image_buffer()
+  {
+    return etl::span<uint8_t>(reinterpret_cast<uint8_t*>(storage), sizeof(storage));
+  }
+
+  SUITE(test_image_view)
+  {
+    //*************************************************************************
+    TEST(test_sorted_array_view)
+    {
+      int32_t values[] = { 7, -3, 12, 0, 7, 100 };
+
+      const size_t size = IntView::build(values, 6U, image_buffer());
+
+      CHECK_EQUAL(IntView::image_size(6U), size);
+      CHECK_EQUAL(sizeof(etl::image_header) + (6U * sizeof(int32_t)), size);
+
+      IntView view(storage, size);
+
+      CHECK(view.is_valid());
+      CHECK_EQUAL(6U, view.size());
+      CHECK(!view.empty());
+      CHECK_EQUAL(-3,  view[0]);
+      CHECK_EQUAL(100, view.at(5));
+      CHECK_THROW(view.at(6), etl::image_view_out_of_range);
+
+      // Zero copy.
+      CHECK(reinterpret_cast<const uint8_t*>(view.data()) == reinterpret_cast<const uint8_t*>(storage) + sizeof(etl::image_header));
+
+      CHECK(view.contains(12));
+      CHECK(!view.contains(8));
+      CHECK_EQUAL(2U, view.count(7));
+      CHECK(view.find(8) == view.end());
+      CHECK_EQUAL(0, *view.find(0));
+      CHECK_EQUAL(12, *view.upper_bound(7));
+      CHECK_EQUAL(7,  *view.lower_bound(1));
+    }
+
+    //*************************************************************************
+    TEST(test_sorted_array_view_of_structs)
+    {
+      Entry entries[] = { { 30U, 1U, -1 }, { 10U, 2U, 2 }, { 20U, 3U, 3 } };
+
+      const size_t size = EntryView::build(entries, 3U, image_buffer());
+
+      EntryView view(storage, size);
+      CHECK(view.is_valid());
+
+      Entry key = { 20U, 0U, 0 };
+      EntryView::const_iterator itr = view.find(key);
+
+      CHECK(itr != view.end());
+      CHECK_EQUAL(3U, itr->flags);
+      CHECK_EQUAL(3,  itr->value);
+    }
+
+    //*************************************************************************
+    TEST(test_flat_map_view)
+    {
+      MapView::value_type elements[] = { { 500U, 5 }, { 100U, 1 }, { 300U, 3 }, { 200U, 2 } };
+
+      const size_t size = MapView::build(elements, 4U, image_buffer());
+      CHECK_EQUAL(MapView::image_size(4U), size);
+
+      MapView view;
+      CHECK(!view.is_valid());
+      CHECK(view.open(storage, size));
+
+      CHECK_EQUAL(4U, view.size());
+      CHECK_EQUAL(1, view.at(100U));
+      CHECK_EQUAL(5, view.at(500U));
+      CHECK_THROW(view.at(400U), etl::image_view_out_of_range);
+      CHECK(view.contains(300U));
+      CHECK(!view.contains(0U));
+      CHECK_EQUAL(1U, view.count(200U));
+      CHECK_EQUAL(500U, view.lower_bound(301U)->first);
+      CHECK_EQUAL(300U, view.upper_bound(200U)->first);
+
+      uint32_t previous = 0U;
+
+      for (MapView::const_iterator itr = view.begin(); itr != view.end(); ++itr)
+      {
+        CHECK(itr->first > previous);
+        CHECK_EQUAL(static_cast<int16_t>(itr->first / 100U), itr->second);
+        previous = itr->first;
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_flat_map_build_duplicate_keys)
+    {
+      MapView::value_type elements[] = { { 1U, 1 }, { 2U, 2 }, { 1U, 3 } };
+
+      CHECK_EQUAL(0U, MapView::build(elements, 3U, image_buffer()));
+    }
+
+    //*************************************************************************
+    TEST(test_string_table_view)
+    {
+      const etl::string_view strings[] = { etl::string_view("zeta"), etl::string_view(""), etl::string_view("alpha"), etl::string_view("mu") };
+
+      const size_t size = etl::string_table_view::build(strings, 4U, image_buffer());
+      CHECK_EQUAL(etl::string_table_view::image_size(strings, 4U), size);
+
+      etl::string_table_view view(storage, size);
+
+      CHECK(view.is_valid());
+      CHECK(!view.is_sorted());
+      CHECK_EQUAL(4U, view.size());
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        CHECK(view[i] == strings[i]);
+        CHECK_EQUAL(i, view.find(strings[i]));
+      }
+
+      CHECK_EQUAL(std::string("alpha"), std::string(view.c_str(2U)));
+      CHECK_EQUAL(4U, view.find(etl::string_view("beta")));
+      CHECK(!view.contains(etl::string_view("alph")));
+      CHECK_THROW(view.at(4U), etl::image_view_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_sorted_string_table_view)
+    {
+      const etl::string_view strings[] = { etl::string_view("apple"), etl::string_view("banana"), etl::string_view("cherry"),
+                                           etl::string_view("date"),  etl::string_view("elder") };
+
+      const size_t size = etl::string_table_view::build(strings, 5U, image_buffer());
+
+      etl::string_table_view view(storage, size);
+
+      CHECK(view.is_valid());
+      CHECK(view.is_sorted());
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        CHECK_EQUAL(i, view.find(strings[i]));
+      }
+
+      CHECK_EQUAL(5U, view.find(etl::string_view("a")));
+      CHECK_EQUAL(5U, view.find(etl::string_view("blueberry")));
+      CHECK_EQUAL(5U, view.find(etl::string_view("fig")));
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_images)
+    {
+      int32_t values[] = { 1, 2, 3, 4 };
+
+      const size_t size = IntView::build(values, 4U, image_buffer());
+
+      uint8_t* p_image = reinterpret_cast<uint8_t*>(storage);
+
+      // Truncated.
+      CHECK(!IntView(storage, size - 1U).is_valid());
+      CHECK(!IntView(storage, 4U).is_valid());
+      CHECK(!IntView(ETL_NULLPTR, size).is_valid());
+
+      // Wrong kind and element type.
+      CHECK(!MapView(storage, size).is_valid());
+      CHECK(!etl::sorted_array_view<int16_t>(storage, size).is_valid());
+      CHECK(!etl::string_table_view(storage, size).is_valid());
+
+      // Corrupted payload.
+      p_image[size - 1U] ^= 0x01U;
+      CHECK(!IntView(storage, size).is_valid());
+      p_image[size - 1U] ^= 0x01U;
+      CHECK(IntView(storage, size).is_valid());
+
+      // Byte swapped magic.
+      etl::image_header header;
+      memcpy(&header, p_image, sizeof(header));
+      header.magic = ((header.magic & 0xFFU) << 24U) | ((header.magic & 0xFF00U) << 8U) | ((header.magic >> 8U) & 0xFF00U) | (header.magic >> 24U);
+      memcpy(p_image, &header, sizeof(header));
+      CHECK(!IntView(storage, size).is_valid());
+
+      // Too small to build.
+      CHECK_EQUAL(0U, IntView::build(values, 4U, etl::span<uint8_t>(p_image, size - 1U)));
+    }
+
+    //*************************************************************************
+    TEST(test_unsorted_payload_is_rejected)
+    {
+      int32_t values[] = { 1, 2, 3 };
+
+      size_t size = IntView::build(values, 3U, image_buffer());
+
+      // Swap two elements and fix up the CRC, as a faulty builder would.
+      int32_t* p_values = reinterpret_cast<int32_t*>(reinterpret_cast<uint8_t*>(storage) + sizeof(etl::image_header));
+      std::swap(p_values[0], p_values[2]);
+
+      etl::image_header header;
+      memcpy(&header, storage, sizeof(header));
+      header.crc = etl::crc32(reinterpret_cast<const uint8_t*>(p_values), reinterpret_cast<const uint8_t*>(p_values + 3)).value();
+      memcpy(storage, &header, sizeof(header));
+
+      CHECK(!IntView(storage, size).is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_empty_image)
+    {
+      const size_t size = IntView::build(ETL_NULLPTR, 0U, image_buffer());
+
+      IntView view(storage, size);
+
+      CHECK(view.is_valid());
+      CHECK(view.empty());
+      CHECK(!view.contains(1));
+
+      const size_t string_size = etl::string_table_view::build(ETL_NULLPTR, 0U, image_buffer());
+
+      etl::string_table_view strings(storage, string_size);
+      CHECK(strings.is_valid());
+      CHECK(strings.empty());
+      CHECK_EQUAL(0U, strings.find(etl::string_view("x")));
+    }
+  }
+}
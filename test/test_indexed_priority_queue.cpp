@@ -0,0 +1,347 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/indexed_priority_queue.h"
+
+#include <algorithm>
+#include <queue>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  /// A timer, ordered so that the earliest expiry is at the top.
+  //***************************************************************************
+  struct Timer
+  {
+    Timer()
+      : expiry(0U)
+      , id(0)
+    {
+    }
+
+    Timer(uint32_t expiry_, int id_)
+      : expiry(expiry_)
+      , id(id_)
+    {
+    }
+
+    uint32_t expiry;
+    int      id;
+  };
+
+  struct Later
+  {
+    bool operator()(const Timer& lhs, const Timer& rhs) const
+    {
+      return lhs.expiry > rhs.expiry;
+    }
+  };
+
+  typedef etl::indexed_priority_queue<int, 8>                 Queue;
+  typedef etl::indexed_priority_queue<Timer, 16, Later, 4>    Timer_Queue;
+
+  SUITE(test_indexed_priority_queue)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+      CHECK_EQUAL(0U, queue.size());
+      CHECK_EQUAL(8U, queue.max_size());
+      CHECK_EQUAL(8U, queue.capacity());
+      CHECK_EQUAL(8U, queue.available());
+      CHECK_EQUAL(Queue::No_Handle, queue.top_handle());
+      CHECK_EQUAL(1U, sizeof(Queue::handle_type));
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_order)
+    {
+      Queue queue;
+
+      int values[] = { 5, 1, 7, 3, 8, 2, 6, 4 };
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        Queue::handle_type handle = queue.push(values[i]);
+        CHECK(queue.contains(handle));
+        CHECK_EQUAL(values[i], queue.get(handle));
+      }
+
+      CHECK(queue.full());
+
+      for (int expected = 8; expected > 0; --expected)
+      {
+        CHECK_EQUAL(expected, queue.top());
+        CHECK_EQUAL(expected, queue.get(queue.top_handle()));
+        queue.pop();
+      }
+
+      CHECK(queue.empty());
+      queue.pop();
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_full)
+    {
+      Queue queue;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        queue.push(i);
+      }
+
+      CHECK_THROW(queue.push(9), etl::priority_queue_full);
+    }
+
+    //*************************************************************************
+    TEST(test_handles_are_stable)
+    {
+      Queue queue;
+
+      Queue::handle_type h1 = queue.push(10);
+      Queue::handle_type h2 = queue.push(20);
+      Queue::handle_type h3 = queue.push(30);
+
+      queue.pop();
+
+      CHECK(!queue.contains(h3));
+      CHECK_EQUAL(10, queue.get(h1));
+      CHECK_EQUAL(20, queue.get(h2));
+
+      Queue::handle_type h4 = queue.push(5);
+      CHECK(queue.contains(h4));
+      CHECK_EQUAL(5, queue.get(h4));
+      CHECK_EQUAL(10, queue.get(h1));
+      CHECK_EQUAL(20, queue.top());
+    }
+
+    //*************************************************************************
+    TEST(test_update_increase_and_decrease)
+    {
+      Queue queue;
+
+      Queue::handle_type h1 = queue.push(1);
+      Queue::handle_type h2 = queue.push(2);
+      Queue::handle_type h3 = queue.push(3);
+      queue.push(4);
+
+      queue.update(h1, 10);
+      CHECK_EQUAL(h1, queue.top_handle());
+
+      queue.get(h1) = 0;
+      queue.update(h1);
+      CHECK_EQUAL(4, queue.top());
+
+      queue.update(h3, 5);
+      CHECK_EQUAL(h3, queue.top_handle());
+
+      std::vector<int> sorted;
+
+      while (!queue.empty())
+      {
+        sorted.push_back(queue.top());
+        queue.pop();
+      }
+
+      CHECK_EQUAL(4U, sorted.size());
+      CHECK_EQUAL(5, sorted[0]);
+      CHECK_EQUAL(4, sorted[1]);
+      CHECK_EQUAL(2, sorted[2]);
+      CHECK_EQUAL(0, sorted[3]);
+
+      CHECK(!queue.contains(h2));
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Queue queue;
+
+      Queue::handle_type handles[8];
+
+      for (int i = 0; i < 8; ++i)
+      {
+        handles[i] = queue.push(i);
+      }
+
+      queue.erase(handles[7]);
+      queue.erase(handles[0]);
+      queue.erase(handles[4]);
+
+      CHECK_EQUAL(5U, queue.size());
+      CHECK(!queue.contains(handles[4]));
+
+      int expected[] = { 6, 5, 3, 2, 1 };
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        CHECK_EQUAL(expected[i], queue.top());
+        queue.pop();
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_handle)
+    {
+      Queue queue;
+
+      Queue::handle_type handle = queue.push(1);
+      queue.erase(handle);
+
+      CHECK(!queue.contains(handle));
+      CHECK(!queue.contains(Queue::No_Handle));
+      CHECK_THROW(queue.erase(handle), etl::priority_queue_invalid_handle);
+      CHECK_THROW(queue.update(handle), etl::priority_queue_invalid_handle);
+      CHECK_THROW(queue.update(Queue::No_Handle, 1), etl::priority_queue_invalid_handle);
+      CHECK_THROW(queue.get(handle), etl::priority_queue_invalid_handle);
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_multiset)
+    {
+      etl::indexed_priority_queue<int, 64, etl::less<int>, 3> queue;
+      std::multiset<int> compare;
+      std::vector<etl::indexed_priority_queue<int, 64, etl::less<int>, 3>::handle_type> handles;
+
+      uint32_t random = 1U;
+
+      for (size_t i = 0U; i < 2000U; ++i)
+      {
+        random = (random * 1103515245U) + 12345U;
+        const uint32_t operation = (random >> 16) % 4U;
+        const int      value     = int((random >> 4) % 100U);
+
+        if ((operation == 0U) && !queue.full())
+        {
+          handles.push_back(queue.push(value));
+          compare.insert(value);
+        }
+        else if ((operation == 1U) && !handles.empty())
+        {
+          const size_t index = value % handles.size();
+          compare.erase(compare.find(queue.get(handles[index])));
+          queue.update(handles[index], value);
+          compare.insert(value);
+        }
+        else if ((operation == 2U) && !handles.empty())
+        {
+          const size_t index = value % handles.size();
+          compare.erase(compare.find(queue.get(handles[index])));
+          queue.erase(handles[index]);
+          handles.erase(handles.begin() + index);
+        }
+        else if (!queue.empty())
+        {
+          CHECK_EQUAL(*compare.rbegin(), queue.top());
+          handles.erase(std::find(handles.begin(), handles.end(), queue.top_handle()));
+          compare.erase(--compare.end());
+          queue.pop();
+        }
+
+        CHECK_EQUAL(compare.size(), queue.size());
+
+        if (!queue.empty())
+        {
+          CHECK_EQUAL(*compare.rbegin(), queue.top());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_timers)
+    {
+      Timer_Queue timers;
+
+      Timer_Queue::handle_type t1 = timers.push(Timer(100U, 1));
+      Timer_Queue::handle_type t2 = timers.emplace(50U, 2);
+      Timer_Queue::handle_type t3 = timers.emplace(75U, 3);
+
+      CHECK_EQUAL(2, timers.top().id);
+
+      // Restart timer 2 later.
+      timers.get(t2).expiry = 200U;
+      timers.update(t2);
+      CHECK_EQUAL(3, timers.top().id);
+
+      // Cancel timer 3.
+      timers.erase(t3);
+      CHECK_EQUAL(1, timers.top().id);
+
+      Timer expired;
+      timers.pop_into(expired);
+      CHECK_EQUAL(1, expired.id);
+      CHECK(!timers.contains(t1));
+      CHECK_EQUAL(2, timers.top().id);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_keeps_handles)
+    {
+      etl::indexed_priority_queue<std::string, 8> queue;
+
+      etl::indexed_priority_queue<std::string, 8>::handle_type ha = queue.push("a");
+      etl::indexed_priority_queue<std::string, 8>::handle_type hc = queue.push("c");
+      queue.push("b");
+
+      etl::indexed_priority_queue<std::string, 8> copy(queue);
+
+      CHECK_EQUAL(3U, copy.size());
+      CHECK_EQUAL(std::string("a"), copy.get(ha));
+      CHECK_EQUAL(std::string("c"), copy.top());
+
+      copy.erase(hc);
+      CHECK_EQUAL(std::string("b"), copy.top());
+      CHECK_EQUAL(std::string("c"), queue.top());
+
+      etl::indexed_priority_queue<std::string, 8> assigned;
+      assigned.push("z");
+      assigned = queue;
+      CHECK_EQUAL(3U, assigned.size());
+      CHECK_EQUAL(std::string("c"), assigned.get(hc));
+
+      etl::indexed_priority_queue<std::string, 8> moved(std::move(assigned));
+      CHECK(assigned.empty());
+      CHECK_EQUAL(std::string("a"), moved.get(ha));
+      CHECK_EQUAL(std::string("c"), moved.top());
+
+      moved.clear();
+      CHECK(moved.empty());
+      CHECK(!moved.contains(ha));
+    }
+  };
+}
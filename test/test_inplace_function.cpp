@@ -0,0 +1,203 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/inplace_function.h"
+
+#include <string>
+
+namespace
+{
+  int free_function(int a, int b)
+  {
+    return a + b;
+  }
+
+  //*****************************************************************************
+  // Counts the live instances, to check that copies are destroyed.
+  //*****************************************************************************
+  struct Counted
+  {
+    static int instances;
+
+    Counted()                          { ++instances; }
+    Counted(const Counted&)            { ++instances; }
+    ~Counted()                         { --instances; }
+
+    int operator()(int a, int b) const { return a * b; }
+  };
+
+  int Counted::instances = 0;
+
+  typedef etl::inplace_function<int(int, int)> Function;
+
+  SUITE(test_inplace_function)
+  {
+    //*************************************************************************
+    TEST(test_default_is_empty)
+    {
+      Function f;
+      Function g(nullptr);
+
+      CHECK(!f.is_valid());
+      CHECK(!g);
+      CHECK(f == nullptr);
+      CHECK_THROW(f(1, 2), etl::inplace_function_uninitialised);
+      CHECK(!f.call_if(1, 2).has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_free_function)
+    {
+      Function f(free_function);
+
+      CHECK(f.is_valid());
+      CHECK(f != nullptr);
+      CHECK_EQUAL(3, f(1, 2));
+
+      int (*p_null)(int, int) = nullptr;
+      Function g(p_null);
+
+      CHECK(!g);
+    }
+
+    //*************************************************************************
+    TEST(test_capturing_lambda_outlives_scope)
+    {
+      Function f;
+
+      {
+        int offset = 10;
+        f = [offset](int a, int b) { return a + b + offset; };
+      }
+
+      CHECK_EQUAL(13, f(1, 2));
+      CHECK_EQUAL(13, f.call_if(1, 2).value());
+    }
+
+    //*************************************************************************
+    TEST(test_mutable_lambda)
+    {
+      int count = 0;
+
+      etl::inplace_function<int()> counter = [count]() mutable { return ++count; };
+
+      CHECK_EQUAL(1, counter());
+      CHECK_EQUAL(2, counter());
+
+      etl::inplace_function<int()> copy(counter);
+
+      CHECK_EQUAL(3, copy());
+      CHECK_EQUAL(3, counter());
+    }
+
+    //*************************************************************************
+    TEST(test_void_return)
+    {
+      int total = 0;
+
+      etl::inplace_function<void(int)> f = [&total](int value) { total += value; };
+
+      f(2);
+      CHECK(f.call_if(3));
+      CHECK_EQUAL(5, total);
+
+      f = nullptr;
+      CHECK(!f.call_if(3));
+      CHECK_EQUAL(5, total);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_move_and_lifetime)
+    {
+      Counted::instances = 0;
+
+      {
+        Function f = Counted();
+        CHECK_EQUAL(1, Counted::instances);
+
+        Function g(f);
+        CHECK_EQUAL(2, Counted::instances);
+        CHECK_EQUAL(6, g(2, 3));
+
+        Function h(etl::move(g));
+        CHECK_EQUAL(2, Counted::instances);
+        CHECK(!g);
+        CHECK_EQUAL(6, h(2, 3));
+
+        g = h;
+        CHECK_EQUAL(3, Counted::instances);
+
+        f = free_function;
+        CHECK_EQUAL(2, Counted::instances);
+        CHECK_EQUAL(5, f(2, 3));
+
+        f = etl::move(h);
+        CHECK_EQUAL(2, Counted::instances);
+        CHECK_EQUAL(6, f(2, 3));
+
+        f.clear();
+        CHECK_EQUAL(1, Counted::instances);
+      }
+
+      CHECK_EQUAL(0, Counted::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_swap)
+    {
+      Function f = [](int a, int b) { return a - b; };
+      Function g(free_function);
+
+      swap(f, g);
+
+      CHECK_EQUAL(5, f(3, 2));
+      CHECK_EQUAL(1, g(3, 2));
+
+      Function empty;
+      empty.swap(f);
+
+      CHECK(!f);
+      CHECK_EQUAL(5, empty(3, 2));
+    }
+
+    //*************************************************************************
+    TEST(test_capture_with_non_trivial_type)
+    {
+      std::string text("text");
+
+      etl::inplace_function<size_t(), sizeof(std::string) + sizeof(void*)> f = [text]() { return text.size(); };
+
+      text.clear();
+
+      CHECK_EQUAL(4U, f());
+    }
+  };
+}
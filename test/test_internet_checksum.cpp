@@ -0,0 +1,129 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <vector>
+#include <stdint.h>
+
+#include "etl/checksum.h"
+
+namespace
+{
+  uint16_t reference_internet_checksum(const std::vector<uint8_t>& data)
+  {
+    uint32_t sum = 0UL;
+
+    for (size_t i = 0UL; i < data.size(); i += 2UL)
+    {
+      uint32_t word = uint32_t(data[i]) << 8U;
+
+      if ((i + 1UL) < data.size())
+      {
+        word |= data[i + 1UL];
+      }
+
+      sum += word;
+      sum = (sum & 0xFFFFUL) + (sum >> 16U);
+    }
+
+    return uint16_t(~sum);
+  }
+
+  SUITE(test_internet_checksum)
+  {
+    //*************************************************************************
+    TEST(test_internet_checksum_rfc1071_example)
+    {
+      std::vector<uint8_t> data = { 0x00U, 0x01U, 0xF2U, 0x03U, 0xF4U, 0xF5U, 0xF6U, 0xF7U };
+
+      uint16_t sum = etl::internet_checksum(data.begin(), data.end());
+
+      CHECK_EQUAL(0x220DU, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_internet_checksum_ipv4_header)
+    {
+      std::vector<uint8_t> header = { 0x45U, 0x00U, 0x00U, 0x73U, 0x00U, 0x00U, 0x40U, 0x00U, 0x40U, 0x11U,
+                                      0x00U, 0x00U, 0xC0U, 0xA8U, 0x00U, 0x01U, 0xC0U, 0xA8U, 0x00U, 0xC7U };
+
+      uint16_t sum = etl::internet_checksum(header.data(), header.data() + header.size());
+
+      CHECK_EQUAL(0xB861U, sum);
+
+      // A header containing its checksum sums to zero.
+      header[10] = 0xB8U;
+      header[11] = 0x61U;
+
+      CHECK_EQUAL(0U, uint16_t(etl::internet_checksum(header.data(), header.data() + header.size())));
+    }
+
+    //*************************************************************************
+    TEST(test_internet_checksum_contiguous_range)
+    {
+      std::vector<uint8_t> data(1500U, 0xFFU);
+
+      for (size_t i = 0UL; i < data.size(); i += 3UL)
+      {
+        data[i] = uint8_t(i);
+      }
+
+      // Pointers add a block at a time.
+      for (size_t length = 0UL; length < 200UL; ++length)
+      {
+        std::vector<uint8_t> part(data.begin(), data.begin() + length);
+
+        CHECK_EQUAL(reference_internet_checksum(part), uint16_t(etl::internet_checksum(data.data(), data.data() + length)));
+      }
+
+      CHECK_EQUAL(reference_internet_checksum(data), uint16_t(etl::internet_checksum(data.data(), data.data() + data.size())));
+    }
+
+    //*************************************************************************
+    TEST(test_internet_checksum_split_at_odd_boundary)
+    {
+      std::vector<uint8_t> data(300U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(i * 7U + 200U);
+      }
+
+      for (size_t split = 1UL; split < 40UL; ++split)
+      {
+        etl::internet_checksum checksum_calculator;
+
+        checksum_calculator.add(data.data(), data.data() + split);
+        checksum_calculator.add(data.data() + split, data.data() + data.size());
+
+        CHECK_EQUAL(reference_internet_checksum(data), checksum_calculator.value());
+      }
+    }
+  };
+}
@@ -0,0 +1,302 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/interval_map.h"
+
+#include <vector>
+#include <cstdlib>
+
+namespace
+{
+  typedef etl::interval_map<int, char, 16U> Map;
+
+  struct range
+  {
+    range(int first_, int last_, char value_)
+      : first(first_)
+      , last(last_)
+      , value(value_)
+    {
+    }
+
+    bool operator ==(const range& other) const
+    {
+      return (first == other.first) && (last == other.last) && (value == other.value);
+    }
+
+    int  first;
+    int  last;
+    char value;
+  };
+
+  struct collect
+  {
+    collect(std::vector<range>& ranges_)
+      : ranges(ranges_)
+    {
+    }
+
+    void operator()(int first, int last, char value)
+    {
+      ranges.push_back(range(first, last, value));
+    }
+
+    std::vector<range>& ranges;
+  };
+
+  std::vector<range> ranges_of(const Map& map)
+  {
+    std::vector<range> ranges;
+    map.for_each(collect(ranges));
+    return ranges;
+  }
+
+  SUITE(test_interval_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Map map;
+
+      CHECK(map.empty());
+      CHECK_EQUAL(0U, map.size());
+      CHECK_EQUAL(16U, map.max_size());
+      CHECK(map.find(0) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_assign_find)
+    {
+      Map map;
+
+      CHECK(map.assign(10, 20, 'a'));
+      CHECK(map.assign(30, 40, 'b'));
+
+      CHECK(map.find(9) == nullptr);
+      CHECK_EQUAL('a', *map.find(10));
+      CHECK_EQUAL('a', *map.find(19));
+      CHECK(map.find(20) == nullptr);
+      CHECK(map.find(29) == nullptr);
+      CHECK_EQUAL('b', *map.find(30));
+      CHECK(map.find(40) == nullptr);
+      CHECK(map.contains(35));
+      CHECK(!map.contains(25));
+
+      // Empty ranges change nothing.
+      CHECK(map.assign(25, 25, 'c'));
+      CHECK(map.assign(26, 24, 'c'));
+      CHECK_EQUAL(2U, map.size());
+    }
+
+    //*************************************************************************
+    TEST(test_assign_splits)
+    {
+      Map map;
+
+      map.assign(0, 100, 'a');
+      map.assign(40, 60, 'b');
+
+      std::vector<range> expected = { range(0, 40, 'a'), range(40, 60, 'b'), range(60, 100, 'a') };
+      CHECK(ranges_of(map) == expected);
+
+      // Overlapping the ends of several ranges.
+      map.assign(30, 70, 'c');
+
+      expected = { range(0, 30, 'a'), range(30, 70, 'c'), range(70, 100, 'a') };
+      CHECK(ranges_of(map) == expected);
+
+      // Covering everything.
+      map.assign(-10, 110, 'd');
+
+      expected = { range(-10, 110, 'd') };
+      CHECK(ranges_of(map) == expected);
+    }
+
+    //*************************************************************************
+    TEST(test_assign_coalesces)
+    {
+      Map map;
+
+      map.assign(0, 10, 'a');
+      map.assign(20, 30, 'a');
+      map.assign(10, 20, 'a');
+
+      std::vector<range> expected = { range(0, 30, 'a') };
+      CHECK(ranges_of(map) == expected);
+
+      // Different values are not joined.
+      map.assign(30, 40, 'b');
+      map.assign(-10, 0, 'b');
+
+      expected = { range(-10, 0, 'b'), range(0, 30, 'a'), range(30, 40, 'b') };
+      CHECK(ranges_of(map) == expected);
+
+      // Reassigning the middle with the same value leaves one range.
+      map.assign(5, 25, 'a');
+      CHECK_EQUAL(3U, map.size());
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Map map;
+
+      map.assign(0, 100, 'a');
+
+      CHECK(map.erase(40, 60));
+
+      std::vector<range> expected = { range(0, 40, 'a'), range(60, 100, 'a') };
+      CHECK(ranges_of(map) == expected);
+
+      CHECK(map.erase(-5, 10));
+      CHECK(map.erase(90, 200));
+
+      expected = { range(10, 40, 'a'), range(60, 90, 'a') };
+      CHECK(ranges_of(map) == expected);
+
+      CHECK(map.erase(0, 1000));
+      CHECK(map.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_overlapping)
+    {
+      Map map;
+
+      map.assign(0, 10, 'a');
+      map.assign(10, 20, 'b');
+      map.assign(30, 40, 'c');
+
+      std::vector<range> ranges;
+
+      CHECK_EQUAL(2U, map.for_each_overlapping(5, 15, collect(ranges)));
+      std::vector<range> expected = { range(0, 10, 'a'), range(10, 20, 'b') };
+      CHECK(ranges == expected);
+
+      ranges.clear();
+      CHECK_EQUAL(0U, map.for_each_overlapping(20, 30, collect(ranges)));
+
+      ranges.clear();
+      CHECK_EQUAL(2U, map.for_each_overlapping(19, 31, collect(ranges)));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::interval_map<int, char, 2U> map;
+
+      CHECK(map.assign(0, 100, 'a'));
+      CHECK(map.full() == false);
+
+      // A split needs two more nodes.
+      CHECK_THROW(map.assign(40, 60, 'b'), etl::interval_map_full);
+
+      std::vector<range> expected = { range(0, 100, 'a') };
+      std::vector<range> ranges;
+      map.for_each(collect(ranges));
+      CHECK(ranges == expected);
+
+      // Replacing the end needs one.
+      CHECK(map.assign(60, 100, 'b'));
+      CHECK(map.full());
+
+      // Replacing a whole range needs none.
+      CHECK(map.assign(60, 100, 'c'));
+
+      CHECK_THROW(map.erase(10, 20), etl::interval_map_full);
+      CHECK(map.erase(50, 70));
+      CHECK_EQUAL('a', *map.find(49));
+      CHECK(map.find(50) == nullptr);
+      CHECK_EQUAL('c', *map.find(70));
+    }
+
+    //*************************************************************************
+    TEST(test_against_model)
+    {
+      etl::interval_map<int, char, 64U> map;
+
+      const int Range = 64;
+      char model[Range] = {};
+
+      srand(1234);
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        const int  first = rand() % Range;
+        const int  last  = first + (rand() % 12);
+        const char value = char(rand() % 4);
+        const int  end   = (last < Range) ? last : Range;
+
+        if (value == 0)
+        {
+          CHECK(map.erase(first, end));
+        }
+        else
+        {
+          CHECK(map.assign(first, end, value));
+        }
+
+        for (int k = first; k < end; ++k)
+        {
+          model[k] = value;
+        }
+
+        for (int k = 0; k < Range; ++k)
+        {
+          const char* p_value = map.find(k);
+
+          if (model[k] == 0)
+          {
+            CHECK(p_value == nullptr);
+          }
+          else
+          {
+            CHECK(p_value != nullptr);
+
+            if (p_value != nullptr)
+            {
+              CHECK_EQUAL(int(model[k]), int(*p_value));
+            }
+          }
+        }
+
+        // Neighbouring ranges with equal values are always joined.
+        std::vector<range> ranges;
+        map.for_each(collect(ranges));
+
+        for (size_t r = 1U; r < ranges.size(); ++r)
+        {
+          CHECK((ranges[r - 1U].last < ranges[r].first) || (ranges[r - 1U].value != ranges[r].value));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,266 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/interval_tree.h"
+
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+  typedef etl::interval_tree<int, int, 32U> Tree;
+
+  struct collect
+  {
+    collect(std::vector<int>& values_)
+      : values(values_)
+    {
+    }
+
+    void operator()(const Tree::interval& item)
+    {
+      values.push_back(item.value);
+    }
+
+    std::vector<int>& values;
+  };
+
+  SUITE(test_interval_tree)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Tree tree;
+
+      CHECK(tree.empty());
+      CHECK_EQUAL(0U, tree.size());
+      CHECK_EQUAL(32U, tree.max_size());
+      CHECK(!tree.contains(0));
+      CHECK(tree.begin() == tree.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_keeps_start_order)
+    {
+      Tree tree;
+
+      CHECK(tree.insert(30, 40, 1));
+      CHECK(tree.insert(10, 50, 2));
+      CHECK(tree.insert(20, 25, 3));
+      CHECK(tree.insert(10, 15, 4));
+
+      // Empty ranges are refused.
+      CHECK(!tree.insert(5, 5, 5));
+
+      CHECK_EQUAL(4U, tree.size());
+
+      std::vector<int> values;
+
+      for (Tree::const_iterator itr = tree.begin(); itr != tree.end(); ++itr)
+      {
+        values.push_back(itr->value);
+      }
+
+      std::vector<int> expected = { 2, 4, 3, 1 };
+      CHECK(values == expected);
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_containing)
+    {
+      Tree tree;
+
+      tree.insert(0, 100, 1);
+      tree.insert(10, 20, 2);
+      tree.insert(15, 30, 3);
+      tree.insert(50, 60, 4);
+      tree.insert(15, 16, 5);
+
+      std::vector<int> values;
+
+      CHECK_EQUAL(4U, tree.for_each_containing(15, collect(values)));
+      std::vector<int> expected1 = { 1, 2, 3, 5 };
+      CHECK(values == expected1);
+
+      values.clear();
+      CHECK_EQUAL(2U, tree.for_each_containing(20, collect(values)));
+      std::vector<int> expected2 = { 1, 3 };
+      CHECK(values == expected2);
+
+      values.clear();
+      CHECK_EQUAL(0U, tree.for_each_containing(100, collect(values)));
+      CHECK_EQUAL(0U, tree.for_each_containing(-1, collect(values)));
+
+      CHECK(tree.contains(55));
+      CHECK(!tree.contains(-5));
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_overlapping)
+    {
+      Tree tree;
+
+      tree.insert(0, 10, 1);
+      tree.insert(10, 20, 2);
+      tree.insert(5, 25, 3);
+      tree.insert(30, 40, 4);
+
+      std::vector<int> values;
+
+      CHECK_EQUAL(3U, tree.for_each_overlapping(8, 12, collect(values)));
+      std::vector<int> expected1 = { 1, 3, 2 };
+      CHECK(values == expected1);
+
+      values.clear();
+      CHECK_EQUAL(0U, tree.for_each_overlapping(25, 30, collect(values)));
+      CHECK_EQUAL(0U, tree.for_each_overlapping(12, 12, collect(values)));
+
+      CHECK(tree.overlaps(39, 50));
+      CHECK(!tree.overlaps(40, 50));
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Tree tree;
+
+      tree.insert(0, 10, 1);
+      tree.insert(0, 10, 2);
+      tree.insert(0, 20, 3);
+      tree.insert(5, 10, 4);
+
+      CHECK(!tree.erase(0, 10, 9));
+      CHECK(tree.erase(0, 10, 2));
+      CHECK_EQUAL(3U, tree.size());
+
+      CHECK_EQUAL(0U, tree.erase(0, 11));
+      CHECK_EQUAL(1U, tree.erase(0, 10));
+      CHECK_EQUAL(2U, tree.size());
+
+      std::vector<int> values;
+      tree.for_each_containing(7, collect(values));
+      std::vector<int> expected = { 3, 4 };
+      CHECK(values == expected);
+
+      // The subtree ends are updated.
+      CHECK(tree.erase(0, 20, 3));
+      CHECK(!tree.contains(15));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::interval_tree<int, int, 2U> tree;
+
+      CHECK(tree.insert(0, 1, 1));
+      CHECK(tree.insert(0, 1, 2));
+      CHECK(tree.full());
+      CHECK_THROW(tree.insert(0, 1, 3), etl::interval_tree_full);
+
+      tree.clear();
+      CHECK(tree.empty());
+      CHECK(tree.insert(0, 1, 3));
+    }
+
+    //*************************************************************************
+    TEST(test_against_model)
+    {
+      struct item
+      {
+        int first;
+        int last;
+        int value;
+      };
+
+      etl::interval_tree<int, int, 64U> tree;
+      std::vector<item> model;
+
+      srand(4321);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        if ((model.size() < 64U) && ((rand() % 3) != 0))
+        {
+          const int first = rand() % 100;
+          const int last  = first + 1 + (rand() % 30);
+          const item x = { first, last, i };
+
+          CHECK(tree.insert(first, last, i));
+          model.push_back(x);
+        }
+        else if (!model.empty())
+        {
+          const size_t index = size_t(rand()) % model.size();
+
+          CHECK(tree.erase(model[index].first, model[index].last, model[index].value));
+          model.erase(model.begin() + index);
+        }
+
+        CHECK_EQUAL(model.size(), tree.size());
+
+        const int key   = rand() % 130;
+        const int first = rand() % 130;
+        const int last  = first + (rand() % 10);
+
+        std::vector<int> expected_containing;
+        std::vector<int> expected_overlapping;
+
+        for (size_t m = 0U; m < model.size(); ++m)
+        {
+          if ((model[m].first <= key) && (key < model[m].last))
+          {
+            expected_containing.push_back(model[m].value);
+          }
+
+          if ((first < last) && (model[m].first < last) && (first < model[m].last))
+          {
+            expected_overlapping.push_back(model[m].value);
+          }
+        }
+
+        std::vector<int> containing;
+        std::vector<int> overlapping;
+
+        tree.for_each_containing(key, collect(containing));
+        tree.for_each_overlapping(first, last, collect(overlapping));
+
+        std::sort(expected_containing.begin(), expected_containing.end());
+        std::sort(expected_overlapping.begin(), expected_overlapping.end());
+        std::sort(containing.begin(), containing.end());
+        std::sort(overlapping.begin(), overlapping.end());
+
+        CHECK(containing == expected_containing);
+        CHECK(overlapping == expected_overlapping);
+      }
+    }
+  }
+}
@@ -0,0 +1,275 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/intrusive_map.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef etl::rb_tree_link<0> KeyLink;
+  typedef etl::rb_tree_link<1> NameLink;
+
+  //***************************************************************************
+  /// A value indexed by two maps at once.
+  //***************************************************************************
+  class Connection : public KeyLink, public NameLink
+  {
+  public:
+
+    Connection(int id_, const std::string& name_)
+      : id(id_)
+      , name(name_)
+    {
+    }
+
+    int         id;
+    std::string name;
+  };
+
+  struct IdOf
+  {
+    const int& operator()(const Connection& connection) const
+    {
+      return connection.id;
+    }
+  };
+
+  struct NameOf
+  {
+    const std::string& operator()(const Connection& connection) const
+    {
+      return connection.name;
+    }
+  };
+
+  typedef etl::intrusive_map<int, Connection, KeyLink, IdOf>           IdMap;
+  typedef etl::intrusive_map<std::string, Connection, NameLink, NameOf> NameMap;
+
+  SUITE(test_intrusive_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      IdMap map;
+
+      CHECK(map.empty());
+      CHECK_EQUAL(0U, map.size());
+      CHECK(map.begin() == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_find)
+    {
+      Connection c1(3, "three");
+      Connection c2(1, "one");
+      Connection c3(2, "two");
+
+      IdMap   ids;
+      NameMap names;
+
+      CHECK(ids.insert(c1).second);
+      CHECK(ids.insert(c2).second);
+      CHECK(ids.insert(c3).second);
+
+      CHECK(names.insert(c1).second);
+      CHECK(names.insert(c2).second);
+      CHECK(names.insert(c3).second);
+
+      CHECK_EQUAL(3U, ids.size());
+      CHECK_EQUAL(3U, names.size());
+
+      CHECK(&*ids.find(2) == &c3);
+      CHECK(ids.find(4) == ids.end());
+      CHECK(&*names.find("one") == &c2);
+      CHECK(names.find("four") == names.end());
+
+      // Ordered by key.
+      IdMap::const_iterator itr = ids.begin();
+      CHECK_EQUAL(1, itr->id);
+      ++itr;
+      CHECK_EQUAL(2, itr->id);
+      ++itr;
+      CHECK_EQUAL(3, itr->id);
+      ++itr;
+      CHECK(itr == ids.end());
+
+      NameMap::const_iterator nitr = names.begin();
+      CHECK_EQUAL(std::string("one"), nitr->name);
+      ++nitr;
+      CHECK_EQUAL(std::string("three"), nitr->name);
+      ++nitr;
+      CHECK_EQUAL(std::string("two"), nitr->name);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_duplicate_key)
+    {
+      Connection c1(1, "a");
+      Connection c2(1, "b");
+
+      IdMap map;
+
+      map.insert(c1);
+      ETL_OR_STD::pair<IdMap::iterator, bool> result = map.insert(c2);
+
+      CHECK(!result.second);
+      CHECK(&*result.first == &c1);
+      CHECK(!c2.KeyLink::is_linked());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_already_linked)
+    {
+      Connection c1(1, "a");
+
+      IdMap map1;
+      IdMap map2;
+
+      map1.insert(c1);
+
+      CHECK_THROW(map2.insert(c1), etl::intrusive_map_value_is_already_linked);
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Connection c1(1, "a");
+
+      IdMap map;
+      const IdMap& cmap = map;
+
+      map.insert(c1);
+
+      CHECK(&map.at(1) == &c1);
+      CHECK(&cmap.at(1) == &c1);
+      CHECK_THROW(map.at(2), etl::intrusive_map_out_of_bounds);
+      CHECK_THROW(cmap.at(2), etl::intrusive_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_bounds)
+    {
+      Connection c1(10, "a");
+      Connection c2(20, "b");
+      Connection c3(30, "c");
+
+      IdMap map;
+      map.insert(c1);
+      map.insert(c2);
+      map.insert(c3);
+
+      CHECK_EQUAL(20, map.lower_bound(15)->id);
+      CHECK_EQUAL(20, map.lower_bound(20)->id);
+      CHECK_EQUAL(30, map.upper_bound(20)->id);
+      CHECK(map.upper_bound(30) == map.end());
+      CHECK(map.contains(30));
+      CHECK(!map.contains(31));
+      CHECK_EQUAL(1U, map.count(10));
+      CHECK_EQUAL(0U, map.count(11));
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Connection c1(1, "a");
+      Connection c2(2, "b");
+      Connection c3(3, "c");
+
+      IdMap   ids;
+      NameMap names;
+
+      ids.insert(c1);   ids.insert(c2);   ids.insert(c3);
+      names.insert(c1); names.insert(c2); names.insert(c3);
+
+      // Erase by key.
+      CHECK_EQUAL(1U, ids.erase(2));
+      CHECK_EQUAL(0U, ids.erase(2));
+      CHECK(!c2.KeyLink::is_linked());
+      CHECK(c2.NameLink::is_linked());
+
+      // Erase the value directly.
+      names.erase(c2);
+      CHECK(!c2.NameLink::is_linked());
+      CHECK_EQUAL(2U, names.size());
+
+      // Erase by iterator.
+      IdMap::iterator itr = ids.erase(ids.begin());
+      CHECK_EQUAL(3, itr->id);
+      CHECK_EQUAL(1U, ids.size());
+
+      ids.clear();
+      names.clear();
+
+      CHECK(!c1.KeyLink::is_linked());
+      CHECK(!c3.KeyLink::is_linked());
+      CHECK(!c1.NameLink::is_linked());
+      CHECK(!c3.NameLink::is_linked());
+    }
+
+    //*************************************************************************
+    TEST(test_against_std_map)
+    {
+      std::vector<Connection> connections;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        connections.push_back(Connection((i * 37) % 200, "x"));
+      }
+
+      IdMap map(connections.begin(), connections.end());
+      std::map<int, const Connection*> compare;
+
+      for (size_t i = 0U; i < connections.size(); ++i)
+      {
+        compare[connections[i].id] = &connections[i];
+      }
+
+      for (int i = 0; i < 200; i += 3)
+      {
+        map.erase(i);
+        compare.erase(i);
+      }
+
+      CHECK_EQUAL(compare.size(), map.size());
+
+      std::map<int, const Connection*>::const_iterator citr = compare.begin();
+
+      for (IdMap::const_iterator itr = map.begin(); itr != map.end(); ++itr, ++citr)
+      {
+        CHECK_EQUAL(citr->first, itr->id);
+        CHECK(citr->second == &*itr);
+      }
+    }
+  }
+}
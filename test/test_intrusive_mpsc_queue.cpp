@@ -0,0 +1,264 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/intrusive_mpsc_queue.h"
+
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::atomic_forward_link<0> link0;
+  typedef etl::atomic_forward_link<1> link1;
+
+  //***************************************************************************
+  struct Event : public link0, public link1
+  {
+    Event()
+      : producer(0)
+      , sequence(0)
+    {
+    }
+
+    Event(int producer_, int sequence_)
+      : producer(producer_)
+      , sequence(sequence_)
+    {
+    }
+
+    int producer;
+    int sequence;
+  };
+
+  //***************************************************************************
+  void set_sequences(Event* events, size_t size)
+  {
+    for (size_t i = 0U; i < size; ++i)
+    {
+      events[i].sequence = static_cast<int>(i);
+    }
+  }
+
+  typedef etl::intrusive_mpsc_queue<Event, link0> Queue0;
+  typedef etl::intrusive_mpsc_queue<Event, link1> Queue1;
+
+  SUITE(test_intrusive_mpsc_queue)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Queue0 queue;
+
+      CHECK(queue.empty());
+      CHECK(queue.pop() == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_fifo)
+    {
+      Event events[5];
+      set_sequences(events, 5U);
+
+      Queue0 queue;
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        queue.push(events[i]);
+        CHECK(!queue.empty());
+      }
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        Event* p_event = queue.pop();
+
+        CHECK(p_event == &events[i]);
+      }
+
+      CHECK(queue.empty());
+      CHECK(queue.pop() == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_interleaved_push_pop)
+    {
+      Event events[3];
+      set_sequences(events, 3U);
+
+      Queue0 queue;
+
+      queue.push(events[0]);
+      CHECK(queue.pop() == &events[0]);
+      CHECK(queue.empty());
+
+      queue.push(events[1]);
+      queue.push(events[2]);
+      CHECK(queue.pop() == &events[1]);
+
+      // Re-push a popped value while another is still queued.
+      queue.push(events[0]);
+      CHECK(queue.pop() == &events[2]);
+      CHECK(queue.pop() == &events[0]);
+      CHECK(queue.pop() == ETL_NULLPTR);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_reuse_after_empty)
+    {
+      Event event(0, 0);
+
+      Queue0 queue;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        queue.push(event);
+        CHECK(queue.pop() == &event);
+        CHECK(queue.pop() == ETL_NULLPTR);
+        CHECK(queue.empty());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_links)
+    {
+      Event events[2];
+      set_sequences(events, 2U);
+
+      Queue0 queue0;
+      Queue1 queue1;
+
+      queue0.push(events[0]);
+      queue0.push(events[1]);
+      queue1.push(events[1]);
+      queue1.push(events[0]);
+
+      CHECK(queue0.pop() == &events[0]);
+      CHECK(queue1.pop() == &events[1]);
+      CHECK(queue0.pop() == &events[1]);
+      CHECK(queue1.pop() == &events[0]);
+      CHECK(queue0.empty());
+      CHECK(queue1.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_drain)
+    {
+      Event events[4];
+      set_sequences(events, 4U);
+
+      Queue0 queue;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        queue.push(events[i]);
+      }
+
+      int total = 0;
+
+      size_t count = queue.drain([&](Event& event) { total += event.sequence; });
+
+      CHECK_EQUAL(4U, count);
+      CHECK_EQUAL(6, total);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_producers)
+    {
+      const int Producers = 4;
+      const int Events    = 10000;
+
+      std::vector<Event> events(Producers * Events);
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        for (int s = 0; s < Events; ++s)
+        {
+          events[p * Events + s].producer = p;
+          events[p * Events + s].sequence = s;
+        }
+      }
+
+      Queue0 queue;
+
+      std::vector<std::thread> producers;
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        producers.push_back(std::thread([&, p]()
+        {
+          for (int s = 0; s < Events; ++s)
+          {
+            queue.push(events[p * Events + s]);
+          }
+        }));
+      }
+
+      // Each producer's events must arrive in the order that they were pushed.
+      std::vector<int> next(Producers, 0);
+      int received = 0;
+      bool in_order = true;
+
+      while (received < (Producers * Events))
+      {
+        Event* p_event = queue.pop();
+
+        if (p_event == ETL_NULLPTR)
+        {
+          std::this_thread::yield();
+        }
+        else
+        {
+          in_order = in_order && (p_event->sequence == next[p_event->producer]);
+          ++next[p_event->producer];
+          ++received;
+        }
+      }
+
+      for (size_t i = 0U; i < producers.size(); ++i)
+      {
+        producers[i].join();
+      }
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        CHECK_EQUAL(Events, next[p]);
+      }
+    }
+  }
+}
+
+#endif
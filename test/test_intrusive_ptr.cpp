@@ -0,0 +1,258 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/intrusive_ptr.h"
+#include "etl/pool.h"
+
+#include <string>
+
+namespace
+{
+  //***************************************************************************
+  struct Data
+  {
+    Data()
+      : value(0)
+    {
+      ++instances;
+    }
+
+    Data(int value_)
+      : value(value_)
+    {
+      ++instances;
+    }
+
+    ~Data()
+    {
+      --instances;
+    }
+
+    int value;
+
+    static int instances;
+  };
+
+  int Data::instances = 0;
+
+  typedef etl::reference_counted_object<Data, int32_t> CountedData;
+  typedef etl::intrusive_ptr<CountedData>              DataPtr;
+
+  SUITE(test_intrusive_ptr)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataPtr ptr;
+
+      CHECK(!ptr);
+      CHECK(ptr.get() == ETL_NULLPTR);
+      CHECK(ptr.get_pool() == ETL_NULLPTR);
+      CHECK_EQUAL(0, ptr.use_count());
+    }
+
+    //*************************************************************************
+    TEST(test_unpooled_object)
+    {
+      CountedData object(42);
+
+      {
+        DataPtr ptr1(&object);
+        CHECK_EQUAL(1, ptr1.use_count());
+        CHECK_EQUAL(42, ptr1->get_object().value);
+        CHECK_EQUAL(42, (*ptr1).get_object().value);
+
+        DataPtr ptr2(ptr1);
+        CHECK_EQUAL(2, object.get_reference_counter().get_reference_count());
+        CHECK(ptr1 == ptr2);
+      }
+
+      // The last release leaves an unpooled object alone.
+      CHECK_EQUAL(0, object.get_reference_counter().get_reference_count());
+      CHECK_EQUAL(42, object.get_object().value);
+    }
+
+    //*************************************************************************
+    TEST(test_pooled_object_returned_on_last_release)
+    {
+      Data::instances = 0;
+
+      etl::pool<CountedData, 4> pool;
+
+      {
+        DataPtr ptr1 = etl::make_intrusive<CountedData>(pool, 1);
+        CHECK_EQUAL(1U, pool.size());
+        CHECK_EQUAL(1, Data::instances);
+        CHECK(ptr1.get_pool() == &pool);
+
+        DataPtr ptr2 = etl::make_intrusive<CountedData>(pool, 2);
+        CHECK_EQUAL(2U, pool.size());
+
+        DataPtr ptr3(ptr1);
+        CHECK_EQUAL(2, ptr1.use_count());
+
+        // Releases object 2.
+        ptr2 = ptr3;
+        CHECK_EQUAL(1U, pool.size());
+        CHECK_EQUAL(1, Data::instances);
+        CHECK_EQUAL(3, ptr1.use_count());
+
+        ptr1.reset();
+        ptr3.reset();
+        CHECK_EQUAL(1U, pool.size());
+        CHECK_EQUAL(1, ptr2->get_object().value);
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+      CHECK_EQUAL(0, Data::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_move)
+    {
+      etl::pool<CountedData, 4> pool;
+
+      DataPtr ptr1 = etl::make_intrusive<CountedData>(pool, 1);
+      DataPtr ptr2(etl::move(ptr1));
+
+      CHECK(!ptr1);
+      CHECK_EQUAL(1, ptr2.use_count());
+
+      DataPtr ptr3;
+      ptr3 = etl::move(ptr2);
+
+      CHECK(!ptr2);
+      CHECK_EQUAL(1, ptr3.use_count());
+      CHECK_EQUAL(1U, pool.size());
+
+      ptr3 = DataPtr();
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_detach_and_adopt)
+    {
+      etl::pool<CountedData, 4> pool;
+
+      DataPtr ptr1 = etl::make_intrusive<CountedData>(pool, 1);
+
+      CountedData* p = ptr1.detach();
+
+      CHECK(!ptr1);
+      CHECK_EQUAL(1, p->get_reference_counter().get_reference_count());
+      CHECK_EQUAL(1U, pool.size());
+
+      // Adopt the reference that was detached.
+      DataPtr ptr2(p, pool, false);
+      CHECK_EQUAL(1, ptr2.use_count());
+
+      ptr2.reset();
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_swap)
+    {
+      etl::pool<CountedData, 4> pool;
+
+      DataPtr ptr1 = etl::make_intrusive<CountedData>(pool, 1);
+      DataPtr ptr2 = etl::make_intrusive<CountedData>(pool, 2);
+
+      swap(ptr1, ptr2);
+
+      CHECK_EQUAL(2, ptr1->get_object().value);
+      CHECK_EQUAL(1, ptr2->get_object().value);
+      CHECK(ptr1 != ptr2);
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    TEST(test_atomic_counter)
+    {
+      typedef etl::atomic_counted_object<Data> AtomicData;
+
+      etl::pool<AtomicData, 2> pool;
+
+      {
+        etl::intrusive_ptr<AtomicData> ptr1 = etl::make_intrusive<AtomicData>(pool, 5);
+        etl::intrusive_ptr<AtomicData> ptr2(ptr1);
+
+        CHECK_EQUAL(2, ptr2.use_count());
+        CHECK_EQUAL(5, ptr2->get_object().value);
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_pool_exhausted)
+    {
+      etl::pool<CountedData, 1> pool;
+
+      DataPtr ptr1 = etl::make_intrusive<CountedData>(pool, 1);
+
+      CHECK_THROW(etl::make_intrusive<CountedData>(pool, 2), etl::pool_no_allocation);
+    }
+
+    //*************************************************************************
+    TEST(test_pool_unique_ptr)
+    {
+      Data::instances = 0;
+
+      etl::pool<Data, 2> pool;
+
+      {
+        etl::pool_unique_ptr<Data> ptr1 = etl::make_pool_unique<Data>(pool, 3);
+
+        CHECK_EQUAL(3, ptr1->value);
+        CHECK_EQUAL(1U, pool.size());
+        CHECK(ptr1.get_deleter().p_pool == &pool);
+        CHECK_EQUAL(sizeof(Data*) + sizeof(etl::ipool*), sizeof(ptr1));
+
+        etl::pool_unique_ptr<Data> ptr2(etl::move(ptr1));
+
+        CHECK(!ptr1);
+        CHECK_EQUAL(1U, pool.size());
+
+        ptr2.reset();
+        CHECK_EQUAL(0U, pool.size());
+        CHECK_EQUAL(0, Data::instances);
+
+        ptr2 = etl::make_pool_unique<Data>(pool, 4);
+        CHECK_EQUAL(1U, pool.size());
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+      CHECK_EQUAL(0, Data::instances);
+    }
+  }
+}
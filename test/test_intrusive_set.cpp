@@ -0,0 +1,368 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/intrusive_set.h"
+
+#include <algorithm>
+#include <set>
+#include <vector>
+#include <iterator>
+#include <cstdlib>
+
+namespace
+{
+  typedef etl::rb_tree_link<0> SetLink;
+  typedef etl::forward_link<1> OtherLink;
+
+  //***************************************************************************
+  class Item : public SetLink, public OtherLink
+  {
+  public:
+
+    explicit Item(int value_ = 0)
+      : value(value_)
+    {
+    }
+
+    friend bool operator <(const Item& lhs, const Item& rhs)
+    {
+      return lhs.value < rhs.value;
+    }
+
+    int value;
+  };
+
+  typedef etl::intrusive_set<Item, SetLink> Set;
+
+  struct Greater
+  {
+    bool operator()(const Item& lhs, const Item& rhs) const
+    {
+      return lhs.value > rhs.value;
+    }
+  };
+
+  typedef etl::intrusive_set<Item, SetLink, Greater> GreaterSet;
+
+  //***************************************************************************
+  /// Checks the red-black properties and returns the black height.
+  /// Returns -1 if a property is violated.
+  //***************************************************************************
+  int black_height(const SetLink* p_link)
+  {
+    if (p_link == ETL_NULLPTR)
+    {
+      return 1;
+    }
+
+    if (p_link->etl_red && ((p_link->etl_left != ETL_NULLPTR && p_link->etl_left->etl_red) ||
+                            (p_link->etl_right != ETL_NULLPTR && p_link->etl_right->etl_red)))
+    {
+      return -1;
+    }
+
+    if ((p_link->etl_left  != ETL_NULLPTR && p_link->etl_left->etl_parent  != p_link) ||
+        (p_link->etl_right != ETL_NULLPTR && p_link->etl_right->etl_parent != p_link))
+    {
+      return -1;
+    }
+
+    int left  = black_height(p_link->etl_left);
+    int right = black_height(p_link->etl_right);
+
+    if ((left < 0) || (left != right))
+    {
+      return -1;
+    }
+
+    return left + (p_link->etl_red ? 0 : 1);
+  }
+
+  //***************************************************************************
+  bool is_valid_tree(Set& set)
+  {
+    if (set.empty())
+    {
+      return true;
+    }
+
+    // Climb to the root, whose parent is the header.
+    const SetLink* p_link = &*set.begin();
+
+    while (p_link->etl_parent->etl_parent != p_link)
+    {
+      p_link = p_link->etl_parent;
+    }
+
+    return !p_link->etl_red && (black_height(p_link) > 0);
+  }
+
+  SUITE(test_intrusive_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Set set;
+
+      CHECK(set.empty());
+      CHECK_EQUAL(0U, set.size());
+      CHECK(set.begin() == set.end());
+      CHECK(set.rbegin() == set.rend());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_is_ordered)
+    {
+      Item items[] = { Item(5), Item(3), Item(8), Item(1), Item(4), Item(7), Item(9), Item(2), Item(6), Item(0) };
+
+      Set set(std::begin(items), std::end(items));
+
+      CHECK_EQUAL(10U, set.size());
+      CHECK(is_valid_tree(set));
+
+      int expected = 0;
+
+      for (Set::iterator itr = set.begin(); itr != set.end(); ++itr)
+      {
+        CHECK_EQUAL(expected, itr->value);
+        ++expected;
+      }
+
+      for (Set::reverse_iterator itr = set.rbegin(); itr != set.rend(); ++itr)
+      {
+        --expected;
+        CHECK_EQUAL(expected, itr->value);
+      }
+
+      Set::iterator last = set.end();
+      --last;
+      CHECK_EQUAL(9, last->value);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_duplicate)
+    {
+      Item a(1);
+      Item b(1);
+
+      Set set;
+
+      ETL_OR_STD::pair<Set::iterator, bool> result = set.insert(a);
+      CHECK(result.second);
+      CHECK(&*result.first == &a);
+
+      result = set.insert(b);
+      CHECK(!result.second);
+      CHECK(&*result.first == &a);
+      CHECK(!b.SetLink::is_linked());
+      CHECK_EQUAL(1U, set.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_already_linked)
+    {
+      Item a(1);
+
+      Set set1;
+      Set set2;
+
+      set1.insert(a);
+      CHECK_THROW(set2.insert(a), etl::intrusive_set_value_is_already_linked);
+      CHECK(set2.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_bounds)
+    {
+      Item items[] = { Item(10), Item(20), Item(30), Item(40) };
+
+      Set set(std::begin(items), std::end(items));
+      const Set& cset = set;
+
+      CHECK(&*set.find(Item(30)) == &items[2]);
+      CHECK(set.find(Item(25)) == set.end());
+      CHECK(cset.find(Item(25)) == cset.end());
+
+      CHECK_EQUAL(20, set.lower_bound(Item(20))->value);
+      CHECK_EQUAL(30, set.lower_bound(Item(21))->value);
+      CHECK_EQUAL(30, set.upper_bound(Item(20))->value);
+      CHECK(set.upper_bound(Item(40)) == set.end());
+      CHECK(cset.lower_bound(Item(41)) == cset.end());
+
+      ETL_OR_STD::pair<Set::iterator, Set::iterator> range = set.equal_range(Item(20));
+      CHECK_EQUAL(20, range.first->value);
+      CHECK_EQUAL(30, range.second->value);
+
+      CHECK(set.contains(Item(10)));
+      CHECK(!set.contains(Item(11)));
+      CHECK_EQUAL(1U, set.count(Item(40)));
+      CHECK_EQUAL(0U, set.count(Item(0)));
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Item items[] = { Item(1), Item(2), Item(3), Item(4), Item(5) };
+
+      Set set(std::begin(items), std::end(items));
+
+      Set::iterator itr = set.erase(set.find(Item(3)));
+      CHECK_EQUAL(4, itr->value);
+      CHECK(!items[2].SetLink::is_linked());
+      CHECK(is_valid_tree(set));
+
+      CHECK_EQUAL(1U, set.erase(Item(1)));
+      CHECK_EQUAL(0U, set.erase(Item(1)));
+      CHECK(!items[0].SetLink::is_linked());
+      CHECK_EQUAL(3U, set.size());
+
+      itr = set.erase(set.begin(), set.end());
+      CHECK(itr == set.end());
+      CHECK(set.empty());
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        CHECK(!items[i].SetLink::is_linked());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_clear_unlinks)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      Set set(items.begin(), items.end());
+
+      CHECK_EQUAL(50U, set.size());
+
+      set.clear();
+
+      CHECK(set.empty());
+
+      for (size_t i = 0U; i < items.size(); ++i)
+      {
+        CHECK(!items[i].SetLink::is_linked());
+      }
+
+      // The values may be inserted again.
+      set.assign(items.begin(), items.end());
+      CHECK_EQUAL(50U, set.size());
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_unlinks)
+    {
+      Item a(1);
+      Item b(2);
+
+      {
+        Set set;
+        set.insert(a);
+        set.insert(b);
+        CHECK(a.SetLink::is_linked());
+      }
+
+      CHECK(!a.SetLink::is_linked());
+      CHECK(!b.SetLink::is_linked());
+    }
+
+    //*************************************************************************
+    TEST(test_compare)
+    {
+      Item items[] = { Item(2), Item(1), Item(3) };
+
+      GreaterSet set(std::begin(items), std::end(items));
+
+      GreaterSet::const_iterator itr = set.begin();
+      CHECK_EQUAL(3, itr->value);
+      ++itr;
+      CHECK_EQUAL(2, itr->value);
+      ++itr;
+      CHECK_EQUAL(1, itr->value);
+    }
+
+    //*************************************************************************
+    TEST(test_random_insert_erase_against_std_set)
+    {
+      const size_t N = 500U;
+
+      std::vector<Item> items;
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        items.push_back(Item(int(i)));
+      }
+
+      Set           set;
+      std::set<int> compare;
+
+      std::srand(1);
+
+      for (size_t loop = 0U; loop < 5000U; ++loop)
+      {
+        Item& item = items[size_t(std::rand()) % N];
+
+        if (item.SetLink::is_linked())
+        {
+          set.erase(item);
+          compare.erase(item.value);
+        }
+        else
+        {
+          set.insert(item);
+          compare.insert(item.value);
+        }
+
+        if ((loop % 100U) == 0U)
+        {
+          CHECK(is_valid_tree(set));
+        }
+      }
+
+      CHECK(is_valid_tree(set));
+      CHECK_EQUAL(compare.size(), set.size());
+
+      std::vector<int> values;
+
+      for (Set::const_iterator itr = set.cbegin(); itr != set.cend(); ++itr)
+      {
+        values.push_back(itr->value);
+      }
+
+      CHECK(std::equal(compare.begin(), compare.end(), values.begin()));
+    }
+  }
+}
@@ -0,0 +1,221 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/intrusive_unordered_set.h"
+
+#include <set>
+#include <vector>
+#include <iterator>
+
+namespace
+{
+  typedef etl::forward_link<0> HashLink;
+
+  //***************************************************************************
+  class Item : public HashLink
+  {
+  public:
+
+    explicit Item(int value_ = 0)
+      : value(value_)
+    {
+    }
+
+    friend bool operator ==(const Item& lhs, const Item& rhs)
+    {
+      return lhs.value == rhs.value;
+    }
+
+    int value;
+  };
+
+  struct ItemHash
+  {
+    size_t operator()(const Item& item) const
+    {
+      return static_cast<size_t>(item.value);
+    }
+  };
+
+  typedef etl::intrusive_unordered_set<Item, HashLink, 7, ItemHash> Set;
+
+  SUITE(test_intrusive_unordered_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Set set;
+
+      CHECK(set.empty());
+      CHECK_EQUAL(0U, set.size());
+      CHECK_EQUAL(7U, set.bucket_count());
+      CHECK(set.begin() == set.end());
+      CHECK(set.cbegin() == set.cend());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_find)
+    {
+      Item items[] = { Item(1), Item(8), Item(15), Item(2), Item(3) };
+
+      Set set(std::begin(items), std::end(items));
+
+      CHECK_EQUAL(5U, set.size());
+
+      // 1, 8 and 15 share a bucket.
+      CHECK_EQUAL(3U, set.bucket_size(1));
+      CHECK_EQUAL(1U, set.bucket_size(2));
+      CHECK_EQUAL(0U, set.bucket_size(0));
+
+      CHECK(&*set.find(Item(8)) == &items[1]);
+      CHECK(&*set.find(Item(15)) == &items[2]);
+      CHECK(set.find(Item(22)) == set.end());
+      CHECK(set.contains(Item(3)));
+      CHECK(!set.contains(Item(4)));
+      CHECK_EQUAL(1U, set.count(Item(1)));
+      CHECK_EQUAL(0U, set.count(Item(0)));
+    }
+
+    //*************************************************************************
+    TEST(test_iterate)
+    {
+      Item items[] = { Item(6), Item(13), Item(0), Item(3), Item(20) };
+
+      Set set(std::begin(items), std::end(items));
+
+      std::multiset<int> visited;
+
+      for (Set::const_iterator itr = set.begin(); itr != set.end(); ++itr)
+      {
+        visited.insert(itr->value);
+      }
+
+      std::multiset<int> expected;
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        expected.insert(items[i].value);
+      }
+
+      CHECK(visited == expected);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_duplicate)
+    {
+      Item a(4);
+      Item b(4);
+
+      Set set;
+
+      CHECK(set.insert(a).second);
+
+      ETL_OR_STD::pair<Set::iterator, bool> result = set.insert(b);
+
+      CHECK(!result.second);
+      CHECK(&*result.first == &a);
+      CHECK(!b.is_linked());
+      CHECK_EQUAL(1U, set.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_already_linked)
+    {
+      Item a(4);
+
+      Set set1;
+      Set set2;
+
+      set1.insert(a);
+
+      CHECK_THROW(set2.insert(a), etl::intrusive_unordered_set_value_is_already_linked);
+      CHECK(set2.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Item items[] = { Item(1), Item(8), Item(15), Item(2) };
+
+      Set set(std::begin(items), std::end(items));
+
+      // Erase from the middle of a chain.
+      CHECK_EQUAL(1U, set.erase(Item(8)));
+      CHECK_EQUAL(0U, set.erase(Item(8)));
+      CHECK(!items[1].is_linked());
+      CHECK(set.contains(Item(1)));
+      CHECK(set.contains(Item(15)));
+
+      // Erase by iterator.
+      set.erase(set.find(Item(15)));
+      CHECK(!items[2].is_linked());
+      CHECK_EQUAL(2U, set.size());
+
+      Set::iterator itr = set.erase(set.begin(), set.end());
+      CHECK(itr == set.end());
+      CHECK(set.empty());
+      CHECK(!items[0].is_linked());
+      CHECK(!items[3].is_linked());
+    }
+
+    //*************************************************************************
+    TEST(test_clear_and_destructor_unlink)
+    {
+      std::vector<Item> items;
+
+      for (int i = 0; i < 30; ++i)
+      {
+        items.push_back(Item(i));
+      }
+
+      {
+        Set set(items.begin(), items.end());
+        CHECK_EQUAL(30U, set.size());
+
+        set.clear();
+        CHECK(set.empty());
+
+        for (size_t i = 0U; i < items.size(); ++i)
+        {
+          CHECK(!items[i].is_linked());
+        }
+
+        set.assign(items.begin(), items.end());
+        CHECK_EQUAL(30U, set.size());
+      }
+
+      for (size_t i = 0U; i < items.size(); ++i)
+      {
+        CHECK(!items[i].is_linked());
+      }
+    }
+  }
+}
@@ -0,0 +1,225 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/iovec_array.h"
+#include "etl/buffer_descriptors.h"
+#include "etl/multi_span.h"
+#include "etl/byte_stream.h"
+
+#include <vector>
+#include <string>
+#include <string.h>
+
+namespace
+{
+  SUITE(test_iovec_array)
+  {
+    //*************************************************************************
+    std::string gather(const etl::iovec_array<8>& iov)
+    {
+      std::string result;
+
+      for (etl::iovec_array<8>::const_iterator itr = iov.begin(); itr != iov.end(); ++itr)
+      {
+        result.append(itr->data(), itr->size());
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::iovec_array<8> iov;
+
+      CHECK(iov.empty());
+      CHECK(!iov.full());
+      CHECK_EQUAL(0U, iov.size());
+      CHECK_EQUAL(0U, iov.size_bytes());
+      CHECK_EQUAL(8U, iov.max_size());
+      CHECK_EQUAL(8U, iov.available());
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_spans)
+    {
+      const char     header[]  = { 'H', 'D', 'R' };
+      const char     payload[] = { 'p', 'a', 'y', 'l', 'o', 'a', 'd' };
+      const uint16_t crc[]     = { 0x3231U };
+
+      etl::iovec_array<8> iov;
+
+      iov.push_back(etl::span<const char>(header));
+      iov.push_back(payload, sizeof(payload));
+      iov.push_back(etl::span<const char>());        // Empty buffers are not stored.
+      iov.push_back(etl::span<const uint16_t>(crc)); // Added as bytes.
+
+      CHECK_EQUAL(3U, iov.size());
+      CHECK_EQUAL(12U, iov.size_bytes());
+
+      // The buffers are referenced, not copied.
+      CHECK(iov[0].data() == header);
+      CHECK(iov[1].data() == payload);
+      CHECK(iov[2].data() == reinterpret_cast<const char*>(crc));
+
+      std::string expected("HDRpayload");
+      expected.append(reinterpret_cast<const char*>(crc), sizeof(crc));
+      CHECK_EQUAL(expected, gather(iov));
+
+      iov.pop_back();
+      CHECK_EQUAL(2U, iov.size());
+      CHECK_EQUAL(10U, iov.size_bytes());
+
+      iov.clear();
+      CHECK(iov.empty());
+      CHECK_EQUAL(0U, iov.size_bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_append_multi_span)
+    {
+      const char part1[] = { 'a', 'b' };
+      const char part2[] = { 'c' };
+
+      std::vector<etl::span<const char>> span_list =
+      {
+        etl::span<const char>(part1),
+        etl::span<const char>(),
+        etl::span<const char>(part2)
+      };
+
+      etl::multi_span<const char> ms(span_list);
+
+      etl::iovec_array<8> iov;
+      iov.push_back("<", 1U);
+      iov.append(ms);
+
+      CHECK_EQUAL(3U, iov.size());
+      CHECK_EQUAL(std::string("<abc"), gather(iov));
+    }
+
+    //*************************************************************************
+    TEST(test_append_byte_stream_writer)
+    {
+      char buffer[16];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+
+      writer.write(uint16_t(0x4142U));
+      writer.write(uint8_t(0x43U));
+
+      const char trailer[] = { '!' };
+
+      etl::iovec_array<8> iov;
+      iov.append(writer);
+      iov.push_back(etl::span<const char>(trailer));
+
+      CHECK_EQUAL(2U, iov.size());
+      CHECK_EQUAL(std::string("ABC!"), gather(iov));
+    }
+
+    //*************************************************************************
+    TEST(test_view_as_multi_span)
+    {
+      const char header[]  = { 'H', 'D' };
+      const char payload[] = { '1', '2', '3' };
+
+      etl::iovec_array<8> iov;
+      iov.push_back(etl::span<const char>(header));
+      iov.push_back(etl::span<const char>(payload));
+
+      etl::multi_span<const char> ms = iov.view();
+
+      CHECK_EQUAL(2U, ms.size_spans());
+      CHECK_EQUAL(5U, ms.size());
+
+      char flat[5];
+      CHECK_EQUAL(5U, ms.copy_to(etl::span<char>(flat)));
+      CHECK(memcmp("HD123", flat, 5U) == 0);
+    }
+
+    //*************************************************************************
+    TEST(test_scatter)
+    {
+      char header[2];
+      char payload[3];
+
+      etl::iovec_array<4, char> iov;
+      iov.push_back(etl::span<char>(header));
+      iov.push_back(etl::span<char>(payload));
+
+      const char received[] = { 'H', 'D', '1', '2', '3' };
+      CHECK_EQUAL(5U, iov.view().copy_from(etl::span<const char>(received)));
+
+      CHECK(memcmp("HD", header, 2U) == 0);
+      CHECK(memcmp("123", payload, 3U) == 0);
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_buffer_descriptors)
+    {
+      typedef etl::buffer_descriptors<char, 8U, 4U> BufferDescriptors;
+
+      char buffers[8U * 4U];
+      BufferDescriptors descriptors(buffers);
+
+      BufferDescriptors::descriptor header  = descriptors.allocate();
+      BufferDescriptors::descriptor payload = descriptors.allocate();
+
+      memcpy(header.data(), "HDR", 3U);
+      memcpy(payload.data(), "DATA", 4U);
+
+      etl::iovec_array<8> iov;
+      iov.push_back(header, 3U);
+      iov.push_back(payload, 4U);
+      iov.push_back(payload, 100U); // Limited to the buffer size.
+
+      CHECK_EQUAL(3U, iov.size());
+      CHECK_EQUAL(15U, iov.size_bytes());
+      CHECK(iov[0].data() == header.data());
+      CHECK_EQUAL(std::string("HDRDATA"), gather(iov).substr(0, 7));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      const char byte = 'x';
+
+      etl::iovec_array<2> iov;
+      iov.push_back(&byte, 1U);
+      iov.push_back(&byte, 1U);
+
+      CHECK(iov.full());
+      CHECK_THROW(iov.push_back(&byte, 1U), etl::iovec_array_full);
+      CHECK_EQUAL(2U, iov.size());
+      CHECK_EQUAL(2U, iov.size_bytes());
+    }
+  };
+}
@@ -155,6 +155,21 @@ namespace
 
       CHECK_THROW(j32.add(0), etl::hash_finalized);
     }
+    //*************************************************************************
+    TEST(test_jenkins_add_range_pointer_blocks)
+    {
+      std::string data("123456789012345678901234567890123456789");
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        const char* p = data.data();
+
+        uint32_t hash    = etl::jenkins(p, p + length);
+        uint32_t compare = jenkins(data.begin(), data.begin() + length);
+
+        CHECK_EQUAL(compare, hash);
+      }
+    }
   };
 }
 
@@ -0,0 +1,352 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/kway_merge.h"
+#include "etl/queue.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/vector.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+  typedef std::vector<int>::const_iterator            Iterator;
+  typedef etl::kway_merge_range<Iterator>             Range;
+
+  //*************************************************************************
+  struct Sample
+  {
+    int timestamp;
+    int source;
+  };
+
+  struct SampleLess
+  {
+    bool operator()(const Sample& lhs, const Sample& rhs) const
+    {
+      return lhs.timestamp < rhs.timestamp;
+    }
+  };
+
+  //*************************************************************************
+  struct CountingLess
+  {
+    bool operator()(int lhs, int rhs) const
+    {
+      ++count;
+      return lhs < rhs;
+    }
+
+    static size_t count;
+  };
+
+  size_t CountingLess::count = 0U;
+
+  //*************************************************************************
+  std::vector<int> make_run(int first, int step, size_t length)
+  {
+    std::vector<int> run;
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+      run.push_back(first + (int(i) * step));
+    }
+
+    return run;
+  }
+
+  SUITE(test_kway_merge)
+  {
+    //*************************************************************************
+    TEST(test_merge_ranges_with_pop)
+    {
+      std::vector<int> runs[5] = { make_run(0, 5, 20), make_run(1, 3, 30), make_run(2, 7, 10), make_run(-10, 1, 5), make_run(100, 1, 3) };
+
+      std::vector<int> expected;
+      Range ranges[5] = { Range(runs[0].begin(), runs[0].end()), Range(runs[1].begin(), runs[1].end()), Range(runs[2].begin(), runs[2].end()),
+                          Range(runs[3].begin(), runs[3].end()), Range(runs[4].begin(), runs[4].end()) };
+
+      etl::kway_merge<Range, 5> merge;
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        expected.insert(expected.end(), runs[i].begin(), runs[i].end());
+        merge.add(ranges[i]);
+      }
+
+      std::sort(expected.begin(), expected.end());
+
+      CHECK_EQUAL(5U, merge.size());
+      CHECK(merge.full());
+
+      std::vector<int> output;
+
+      while (!merge.empty())
+      {
+        output.push_back(merge.front());
+        merge.pop();
+      }
+
+      CHECK(expected == output);
+    }
+
+    //*************************************************************************
+    TEST(test_merge_ranges_batched)
+    {
+      std::vector<int> runs[3] = { make_run(0, 1, 50), make_run(1000, 1, 50), make_run(25, 2, 50) };
+
+      std::vector<int> expected;
+      etl::kway_merge<Range, 4> merge;
+      Range ranges[3] = { Range(runs[0].begin(), runs[0].end()), Range(runs[1].begin(), runs[1].end()), Range(runs[2].begin(), runs[2].end()) };
+
+      for (size_t i = 0U; i < 3U; ++i)
+      {
+        expected.insert(expected.end(), runs[i].begin(), runs[i].end());
+        merge.add(ranges[i]);
+      }
+
+      std::sort(expected.begin(), expected.end());
+
+      std::vector<int> output;
+      merge.merge(std::back_inserter(output));
+
+      CHECK(merge.empty());
+      CHECK(expected == output);
+    }
+
+    //*************************************************************************
+    TEST(test_merge_n)
+    {
+      std::vector<int> a = make_run(0, 2, 10);
+      std::vector<int> b = make_run(1, 2, 10);
+      Range ra(a.begin(), a.end());
+      Range rb(b.begin(), b.end());
+
+      etl::kway_merge<Range, 2> merge;
+      merge.add(ra);
+      merge.add(rb);
+
+      int output[20];
+
+      int* p = merge.merge(output, 7U);
+      CHECK_EQUAL(7, p - output);
+
+      p = merge.merge(p, 100U);
+      CHECK_EQUAL(20, p - output);
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK_EQUAL(i, output[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_stable)
+    {
+      const Sample s0[] = { { 1, 0 }, { 2, 0 }, { 2, 0 }, { 5, 0 } };
+      const Sample s1[] = { { 1, 1 }, { 2, 1 }, { 5, 1 } };
+      const Sample s2[] = { { 0, 2 }, { 2, 2 }, { 5, 2 } };
+
+      typedef etl::kway_merge_range<const Sample*> SampleRange;
+
+      SampleRange r0(s0, s0 + 4);
+      SampleRange r1(s1, s1 + 3);
+      SampleRange r2(s2, s2 + 3);
+
+      etl::kway_merge<SampleRange, 3, SampleLess> merge;
+      merge.add(r0);
+      merge.add(r1);
+      merge.add(r2);
+
+      std::vector<Sample> output;
+      merge.merge(std::back_inserter(output));
+
+      const int timestamps[] = { 0, 1, 1, 2, 2, 2, 2, 5, 5, 5 };
+      const int sources[]    = { 2, 0, 1, 0, 0, 1, 2, 0, 1, 2 };
+
+      CHECK_EQUAL(10U, output.size());
+
+      for (size_t i = 0U; i < output.size(); ++i)
+      {
+        CHECK_EQUAL(timestamps[i], output[i].timestamp);
+        CHECK_EQUAL(sources[i],    output[i].source);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_comparisons_per_element)
+    {
+      // Interleaved sources, so that every element needs the tree.
+      std::vector<int> runs[8];
+      std::vector<Range> ranges;
+      etl::kway_merge<Range, 8, CountingLess> merge;
+
+      ranges.reserve(8U);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        runs[i] = make_run(i, 8, 100);
+        ranges.push_back(Range(runs[i].begin(), runs[i].end()));
+        merge.add(ranges.back());
+      }
+
+      CountingLess::count = 0U;
+
+      int expected = 0;
+
+      while (!merge.empty())
+      {
+        CHECK_EQUAL(expected, merge.front());
+        ++expected;
+        merge.pop();
+      }
+
+      CHECK_EQUAL(800, expected);
+
+      // log2(8) per element.
+      CHECK(CountingLess::count <= (800U * 3U));
+    }
+
+    //*************************************************************************
+    TEST(test_batched_runs_save_comparisons)
+    {
+      // Long runs, one source at a time.
+      std::vector<int> runs[8];
+      std::vector<Range> ranges;
+      etl::kway_merge<Range, 8, CountingLess> merge;
+
+      ranges.reserve(8U);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        runs[i] = make_run(i * 100, 1, 100);
+        ranges.push_back(Range(runs[i].begin(), runs[i].end()));
+        merge.add(ranges.back());
+      }
+
+      CountingLess::count = 0U;
+
+      std::vector<int> output;
+      merge.merge(std::back_inserter(output));
+
+      CHECK_EQUAL(800U, output.size());
+      CHECK(std::is_sorted(output.begin(), output.end()));
+
+      // About one comparison per element, rather than three.
+      CHECK(CountingLess::count < (800U + (8U * 6U)));
+    }
+
+    //*************************************************************************
+    TEST(test_queues)
+    {
+      typedef etl::queue<int, 10> Queue;
+
+      Queue queues[3];
+
+      for (int i = 0; i < 10; ++i)
+      {
+        queues[i % 3].push(i);
+      }
+
+      etl::kway_merge<Queue, 3> merge;
+
+      for (size_t i = 0U; i < 3U; ++i)
+      {
+        merge.add(queues[i]);
+      }
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK_EQUAL(i, merge.front());
+        CHECK_EQUAL(size_t(i % 3), merge.front_source());
+        merge.pop();
+      }
+
+      CHECK(merge.empty());
+      CHECK_THROW(merge.front(), etl::kway_merge_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_refilled_queues)
+    {
+      typedef etl::queue_spsc_atomic<int, 8> Queue;
+
+      Queue q0;
+      Queue q1;
+
+      etl::kway_merge<Queue, 2> merge;
+      merge.add(q0);
+      merge.add(q1);
+
+      CHECK(merge.empty());
+
+      q0.push(3);
+      q0.push(4);
+      q1.push(1);
+      q1.push(5);
+
+      merge.rebuild();
+
+      etl::vector<int, 8> output;
+      merge.merge(etl::back_inserter(output));
+
+      CHECK_EQUAL(4U, output.size());
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(3, output[1]);
+      CHECK_EQUAL(4, output[2]);
+      CHECK_EQUAL(5, output[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_single_source_and_full)
+    {
+      std::vector<int> a = make_run(0, 1, 4);
+      Range ra(a.begin(), a.end());
+      Range rb(a.begin(), a.end());
+
+      etl::kway_merge<Range, 1> merge;
+      merge.add(ra);
+
+      CHECK_THROW(merge.add(rb), etl::kway_merge_full);
+
+      std::vector<int> output;
+      merge.merge(std::back_inserter(output));
+
+      CHECK(a == output);
+
+      merge.clear();
+      CHECK_EQUAL(0U, merge.size());
+      CHECK(merge.empty());
+    }
+  }
+}
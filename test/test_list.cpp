@@ -1371,6 +1371,70 @@ namespace
       CHECK(are_equal);
     }
 
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      using Data    = etl::list<int, 32>;
+      using Compare = std::list<int>;
+
+      for (int trial = 0; trial < 50; ++trial)
+      {
+        Data    data;
+        Compare compare;
+
+        // Churn the pool, so that the nodes are out of address order.
+        for (int i = 0; i < 32; ++i)
+        {
+          data.push_back((i * 7 + trial) % 32);
+          compare.push_back((i * 7 + trial) % 32);
+        }
+
+        data.remove_if([trial](int value) { return ((value + trial) % 3) == 0; });
+        compare.remove_if([trial](int value) { return ((value + trial) % 3) == 0; });
+
+        for (int i = 0; !data.full(); ++i)
+        {
+          data.push_back(100 + i);
+          compare.push_back(100 + i);
+        }
+
+        data.sort();
+        compare.sort();
+
+        if ((trial % 2) == 1)
+        {
+          data.reverse();
+          compare.reverse();
+        }
+
+        data.compact();
+
+        CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+        const int* p_previous = nullptr;
+
+        for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+        {
+          CHECK((p_previous == nullptr) || (p_previous < &*itr));
+          p_previous = &*itr;
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_compact_trivial)
+    {
+      etl::list<int, 4> data;
+
+      data.compact();
+      CHECK(data.empty());
+
+      data.push_front(1);
+      data.compact();
+      CHECK_EQUAL(1U, data.size());
+      CHECK_EQUAL(1, data.front());
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_reverse)
     {
@@ -0,0 +1,214 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/lock_free_memory_block_allocator.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <set>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  using Allocator16 = etl::lock_free_memory_block_allocator<sizeof(int16_t), alignof(int16_t), 4>;
+  using Allocator32 = etl::lock_free_memory_block_allocator<sizeof(int32_t), alignof(int32_t), 4>;
+
+  SUITE(test_lock_free_memory_block_allocator)
+  {
+    //*************************************************************************
+    TEST(test_allocator_no_successor_use_all_allocation)
+    {
+      Allocator16 allocator16;
+
+      CHECK_EQUAL(4U, allocator16.max_size());
+      CHECK_EQUAL(4U, allocator16.available());
+      CHECK(allocator16.empty());
+
+      int16_t* p1 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p2 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p3 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p4 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p5 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK(p4 != nullptr);
+      CHECK(p5 == nullptr);
+
+      CHECK(allocator16.full());
+      CHECK_EQUAL(4U, allocator16.size());
+
+      std::set<int16_t*> unique = { p1, p2, p3, p4 };
+      CHECK_EQUAL(4U, unique.size());
+
+      CHECK(allocator16.release(p1));
+      CHECK(allocator16.release(p2));
+      CHECK(allocator16.release(p3));
+      CHECK(allocator16.release(p4));
+      CHECK(!allocator16.release(p5));
+
+      CHECK(allocator16.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_reuses_released_blocks)
+    {
+      Allocator16 allocator16;
+
+      void* p1 = allocator16.allocate(sizeof(int16_t), alignof(int16_t));
+      CHECK(allocator16.release(p1));
+
+      void* p2 = allocator16.allocate(sizeof(int16_t), alignof(int16_t));
+      CHECK(p1 == p2);
+      CHECK(allocator16.release(p2));
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_rejects_unsuitable_requests)
+    {
+      Allocator16 allocator16;
+
+      CHECK(allocator16.allocate(sizeof(int32_t), alignof(int16_t)) == nullptr);
+      CHECK(allocator16.allocate(sizeof(int16_t), alignof(int32_t)) == nullptr);
+      CHECK(allocator16.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_is_owner_of)
+    {
+      Allocator16 allocator16;
+      int16_t     other;
+
+      char* p = static_cast<char*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+
+      CHECK(allocator16.is_owner_of(p));
+      CHECK(!allocator16.is_owner_of(p + 1));
+      CHECK(!allocator16.is_owner_of(&other));
+      CHECK(!allocator16.release(p + 1));
+      CHECK(!allocator16.release(&other));
+      CHECK(allocator16.release(p));
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_with_successor)
+    {
+      Allocator16 allocator16;
+      etl::fixed_sized_memory_block_allocator<sizeof(int32_t), alignof(int32_t), 4> allocator32;
+
+      allocator16.set_successor(allocator32);
+
+      void* p1 = allocator16.allocate(sizeof(int16_t), alignof(int16_t)); // Take from allocator16
+      void* p2 = allocator16.allocate(sizeof(int32_t), alignof(int32_t)); // Take from allocator32
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(allocator16.is_owner_of(p1));
+      CHECK(allocator32.is_owner_of(p2));
+      CHECK_EQUAL(1U, allocator16.size());
+
+      CHECK(allocator16.release(p1));
+      CHECK(allocator16.release(p2));
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_multiple_threads)
+    {
+      static const int Threads           = 4;
+      static const int Cycles_Per_Thread = 20000;
+
+      Allocator32 allocator32;
+
+      std::atomic<bool> start(false);
+      std::atomic<int>  errors(0);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < Threads; ++t)
+      {
+        threads.emplace_back([&allocator32, &start, &errors, t]()
+        {
+          while (!start.load());
+
+          for (int i = 0; i < Cycles_Per_Thread; ++i)
+          {
+            int32_t* p = static_cast<int32_t*>(allocator32.allocate(sizeof(int32_t), alignof(int32_t)));
+
+            if (p == nullptr)
+            {
+              std::this_thread::yield();
+              continue;
+            }
+
+            // No other thread may own the block while we hold it.
+            *p = t;
+            std::this_thread::yield();
+
+            if (*p != t)
+            {
+              ++errors;
+            }
+
+            if (!allocator32.release(p))
+            {
+              ++errors;
+            }
+          }
+        });
+      }
+
+      start.store(true);
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(0, errors.load());
+      CHECK(allocator32.empty());
+
+      // All of the blocks are free again.
+      std::set<void*> blocks;
+
+      for (size_t i = 0U; i < allocator32.max_size(); ++i)
+      {
+        blocks.insert(allocator32.allocate(sizeof(int32_t), alignof(int32_t)));
+      }
+
+      CHECK_EQUAL(4U, blocks.size());
+      CHECK(blocks.count(nullptr) == 0U);
+    }
+  }
+}
+
+#endif
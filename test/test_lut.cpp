@@ -0,0 +1,153 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/lut.h"
+
+#include <math.h>
+
+#if ETL_USING_CPP14
+
+namespace
+{
+  //*************************************************************************
+  struct square
+  {
+    static constexpr double lower = 0.0;
+    static constexpr double upper = 2.0;
+
+    constexpr double operator()(double x) const
+    {
+      return x * x;
+    }
+  };
+
+  //*************************************************************************
+  struct cube
+  {
+    static constexpr double lower = -1.0;
+    static constexpr double upper = 1.0;
+
+    constexpr double operator()(double x) const
+    {
+      return x * x * x;
+    }
+  };
+
+  //*************************************************************************
+  struct scaled_ramp
+  {
+    static constexpr double lower = 0.0;
+    static constexpr double upper = 10.0;
+
+    constexpr double operator()(double x) const
+    {
+      return (x * 10.25) - 40.0;
+    }
+  };
+
+  constexpr etl::lut<square, 21U> square_table;
+  constexpr etl::lut<cube, 17U, etl::lut_interpolation::Cubic> cube_table;
+  constexpr etl::lut<cube, 17U, etl::lut_interpolation::Linear> cube_linear_table;
+  constexpr etl::lut<square, 3U, etl::lut_interpolation::Nearest> square_nearest_table;
+  constexpr etl::lut<scaled_ramp, 11U, etl::lut_interpolation::Linear, int16_t> ramp_table;
+
+  // The tables are generated at compile time.
+  static_assert(square_table.size() == 21U, "Wrong size");
+  static_assert((square_table[20] > 3.999999) && (square_table[20] < 4.000001), "Wrong last entry");
+  static_assert(ramp_table[0] == -40, "Wrong first entry");
+  static_assert(ramp_table[1] == -30, "Rounded away from zero");
+  static_assert(ramp_table[2] == -20, "Rounded towards zero");
+
+  SUITE(test_lut)
+  {
+    //*************************************************************************
+    TEST(test_entries)
+    {
+      for (size_t i = 0U; i < square_table.size(); ++i)
+      {
+        const double x = square_table.input(i);
+
+        CHECK_CLOSE(double(i) * 0.1, x, 1e-12);
+        CHECK_CLOSE(x * x, square_table[i], 1e-12);
+        CHECK_CLOSE(x * x, square_table.data()[i], 1e-12);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_linear_interpolation)
+    {
+      for (double x = 0.0; x <= 2.0; x += 0.013)
+      {
+        // The error of linear interpolation of x^2 is at most step^2 / 4.
+        CHECK_CLOSE(x * x, square_table(x), 0.0025 + 1e-12);
+      }
+
+      // Clamped.
+      CHECK_CLOSE(0.0, square_table(-5.0), 0.0);
+      CHECK_CLOSE(4.0, square_table(5.0), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_cubic_interpolation)
+    {
+      double worst_cubic  = 0.0;
+      double worst_linear = 0.0;
+
+      for (double x = -1.0; x <= 1.0; x += 0.0107)
+      {
+        worst_cubic  = fmax(worst_cubic,  fabs((x * x * x) - cube_table(x)));
+        worst_linear = fmax(worst_linear, fabs((x * x * x) - cube_linear_table(x)));
+      }
+
+      CHECK(worst_cubic < 0.001);
+      CHECK(worst_cubic < (worst_linear / 8.0));
+    }
+
+    //*************************************************************************
+    TEST(test_nearest)
+    {
+      CHECK_CLOSE(0.0, square_nearest_table(0.4), 0.0);
+      CHECK_CLOSE(1.0, square_nearest_table(0.6), 0.0);
+      CHECK_CLOSE(1.0, square_nearest_table(1.4), 0.0);
+      CHECK_CLOSE(4.0, square_nearest_table(1.6), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_entries)
+    {
+      CHECK_EQUAL(-40, ramp_table[0]);
+      CHECK_EQUAL(63,  ramp_table[10]);
+      CHECK_CLOSE(-35.0, ramp_table(0.5), 1e-12);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,343 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/lz_compression.h"
+
+#include <vector>
+#include <string>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //***************************************************************************
+  // Log like text, with many repeats.
+  //***************************************************************************
+  Bytes make_log(size_t lines)
+  {
+    std::string text;
+
+    for (size_t i = 0U; i < lines; ++i)
+    {
+      text += "[INFO] sensor ";
+      text += char('0' + (i % 10U));
+      text += ": temperature=";
+      text += char('0' + ((i * 7U) % 10U));
+      text += char('0' + ((i * 3U) % 10U));
+      text += " status=ok\n";
+    }
+
+    return Bytes(text.begin(), text.end());
+  }
+
+  //***************************************************************************
+  // Pseudo random, incompressible bytes.
+  //***************************************************************************
+  Bytes make_noise(size_t size)
+  {
+    Bytes data(size);
+
+    uint32_t state = 0x12345678UL;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      state ^= state << 13U;
+      state ^= state >> 17U;
+      state ^= state << 5U;
+      data[i] = static_cast<uint8_t>(state);
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  Bytes round_trip(const Bytes& input, etl::span<uint32_t> hash_table, size_t window = etl::lz_max_window)
+  {
+    Bytes compressed(etl::lz_compress_bound(input.size()));
+
+    etl::optional<size_t> compressed_size = etl::lz_compress(input.data(), input.size(), compressed.data(), compressed.size(), hash_table, window);
+
+    CHECK(compressed_size.has_value());
+    compressed.resize(compressed_size.value());
+
+    Bytes output(input.size() + 16U);
+
+    etl::optional<size_t> output_size = etl::lz_decompress(compressed.data(), compressed.size(), output.data(), output.size());
+
+    CHECK(output_size.has_value());
+    output.resize(output_size.value());
+
+    return output;
+  }
+
+  SUITE(test_lz_compression)
+  {
+    //*************************************************************************
+    TEST(test_round_trip)
+    {
+      uint32_t hash_table[1024];
+
+      const Bytes inputs[] = { Bytes(),
+                               Bytes(1U, 'a'),
+                               Bytes(12U, 'b'),
+                               Bytes(13U, 'c'),
+                               Bytes(1000U, 'd'),
+                               make_log(1U),
+                               make_log(200U),
+                               make_noise(5U),
+                               make_noise(3000U) };
+
+      for (size_t i = 0U; i < (sizeof(inputs) / sizeof(inputs[0])); ++i)
+      {
+        CHECK(inputs[i] == round_trip(inputs[i], hash_table));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_compresses_logs)
+    {
+      uint32_t hash_table[4096];
+
+      const Bytes input = make_log(200U);
+
+      Bytes compressed(etl::lz_compress_bound(input.size()));
+
+      etl::optional<size_t> size = etl::lz_compress(input.data(), input.size(), compressed.data(), compressed.size(), hash_table);
+
+      CHECK(size.has_value());
+      CHECK(size.value() < (input.size() / 4U));
+    }
+
+    //*************************************************************************
+    TEST(test_incompressible_within_bound)
+    {
+      uint32_t hash_table[256];
+
+      for (size_t n = 0U; n < 2000U; n += 97U)
+      {
+        const Bytes input = make_noise(n);
+
+        Bytes compressed(etl::lz_compress_bound(n));
+
+        etl::optional<size_t> size = etl::lz_compress(input.data(), input.size(), compressed.data(), compressed.size(), hash_table);
+
+        CHECK(size.has_value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_output_too_small)
+    {
+      uint32_t hash_table[256];
+
+      const Bytes input = make_noise(500U);
+
+      Bytes compressed(400U);
+
+      CHECK(!etl::lz_compress(input.data(), input.size(), compressed.data(), compressed.size(), hash_table).has_value());
+
+      // Decompressing into too small an output.
+      compressed.resize(etl::lz_compress_bound(input.size()));
+      etl::optional<size_t> size = etl::lz_compress(input.data(), input.size(), compressed.data(), compressed.size(), hash_table);
+      CHECK(size.has_value());
+
+      Bytes output(input.size() - 1U);
+
+      CHECK(!etl::lz_decompress(compressed.data(), size.value(), output.data(), output.size()).has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_hash_table_not_power_of_2)
+    {
+      uint32_t hash_table[100];
+
+      const Bytes input = make_log(2U);
+
+      Bytes compressed(etl::lz_compress_bound(input.size()));
+
+      CHECK_THROW(etl::lz_compress(input.data(), input.size(), compressed.data(), compressed.size(), hash_table), etl::lz_compression_invalid_hash_table);
+    }
+
+    //*************************************************************************
+    TEST(test_window)
+    {
+      uint32_t hash_table[4096];
+
+      // A block of noise, repeated 1000 bytes later.
+      Bytes input = make_noise(1000U);
+      input.insert(input.end(), input.begin(), input.end());
+
+      Bytes compressed(etl::lz_compress_bound(input.size()));
+
+      etl::optional<size_t> wide   = etl::lz_compress(input.data(), input.size(), compressed.data(), compressed.size(), hash_table);
+      etl::optional<size_t> narrow = etl::lz_compress(input.data(), input.size(), compressed.data(), compressed.size(), hash_table, 512U);
+
+      CHECK(wide.has_value());
+      CHECK(narrow.has_value());
+      CHECK(wide.value() < 1100U);
+      CHECK(narrow.value() > 2000U);
+
+      CHECK(input == round_trip(input, hash_table, 512U));
+    }
+
+    //*************************************************************************
+    TEST(test_decompress_lz4_block)
+    {
+      // "abc", then a 10 byte match at offset 3, then the last literals "bcabc".
+      const uint8_t block[] = { 0x36, 'a', 'b', 'c', 0x03, 0x00, 0x50, 'b', 'c', 'a', 'b', 'c' };
+
+      uint8_t output[32];
+
+      etl::optional<size_t> size = etl::lz_decompress(etl::span<const uint8_t>(block), etl::span<uint8_t>(output));
+
+      CHECK(size.has_value());
+      CHECK_EQUAL(std::string("abcabcabcabcabcabc"), std::string(output, output + size.value()));
+    }
+
+    //*************************************************************************
+    TEST(test_decompress_malformed)
+    {
+      uint8_t output[32];
+
+      // The offset is before the start of the output.
+      const uint8_t bad_offset[] = { 0x30, 'a', 'b', 'c', 0x04, 0x00, 0x00 };
+      CHECK(!etl::lz_decompress(bad_offset, sizeof(bad_offset), output, sizeof(output)).has_value());
+
+      // A zero offset.
+      const uint8_t zero_offset[] = { 0x30, 'a', 'b', 'c', 0x00, 0x00, 0x00 };
+      CHECK(!etl::lz_decompress(zero_offset, sizeof(zero_offset), output, sizeof(output)).has_value());
+
+      // The literals run past the end of the input.
+      const uint8_t short_literals[] = { 0x50, 'a', 'b' };
+      CHECK(!etl::lz_decompress(short_literals, sizeof(short_literals), output, sizeof(output)).has_value());
+
+      // The length extension runs past the end of the input.
+      const uint8_t short_length[] = { 0xF0, 0xFF };
+      CHECK(!etl::lz_decompress(short_length, sizeof(short_length), output, sizeof(output)).has_value());
+
+      // A truncated offset.
+      const uint8_t short_offset[] = { 0x10, 'a', 0x01 };
+      CHECK(!etl::lz_decompress(short_offset, sizeof(short_offset), output, sizeof(output)).has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_compressor)
+    {
+      etl::lz_compressor<10> compressor;
+
+      const Bytes input = make_log(50U);
+
+      Bytes compressed(etl::lz_compress_bound(input.size()));
+
+      etl::optional<size_t> size = compressor.compress(etl::span<const uint8_t>(input.data(), input.size()),
+                                                       etl::span<uint8_t>(compressed.data(), compressed.size()));
+
+      CHECK(size.has_value());
+
+      Bytes output(input.size());
+
+      etl::optional<size_t> output_size = etl::lz_decompress(compressed.data(), size.value(), output.data(), output.size());
+
+      CHECK(output_size.has_value());
+      CHECK_EQUAL(input.size(), output_size.value());
+      CHECK(input == output);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    TEST(test_byte_stream_blocks)
+    {
+      etl::lz_compressor<> compressor;
+
+      const Bytes log   = make_log(100U);
+      const Bytes noise = make_noise(300U);
+
+      char storage[2000];
+      etl::byte_stream_writer writer(storage, sizeof(storage), etl::endian::little);
+
+      CHECK(compressor.compress(etl::span<const uint8_t>(log.data(), log.size()), writer));
+      CHECK(compressor.compress(etl::span<const uint8_t>(noise.data(), noise.size()), writer));
+
+      etl::byte_stream_reader reader(storage, writer.size_bytes(), etl::endian::little);
+
+      Bytes output(log.size());
+
+      etl::optional<size_t> size = etl::lz_decompress(reader, etl::span<uint8_t>(output.data(), output.size()));
+      CHECK(size.has_value());
+      CHECK(log == Bytes(output.begin(), output.begin() + size.value()));
+
+      size = etl::lz_decompress(reader, etl::span<uint8_t>(output.data(), output.size()));
+      CHECK(size.has_value());
+      CHECK(noise == Bytes(output.begin(), output.begin() + size.value()));
+
+      CHECK(reader.empty());
+      CHECK(!etl::lz_decompress(reader, etl::span<uint8_t>(output.data(), output.size())).has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_byte_stream_no_room)
+    {
+      uint32_t hash_table[256];
+
+      const Bytes noise = make_noise(300U);
+
+      char storage[200];
+      etl::byte_stream_writer writer(storage, sizeof(storage), etl::endian::little);
+
+      CHECK(!etl::lz_compress(etl::span<const uint8_t>(noise.data(), noise.size()), writer, hash_table));
+      CHECK_EQUAL(0U, writer.size_bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_byte_stream_output_too_small_restores_reader)
+    {
+      uint32_t hash_table[256];
+
+      const Bytes log = make_log(20U);
+
+      char storage[1000];
+      etl::byte_stream_writer writer(storage, sizeof(storage), etl::endian::little);
+
+      CHECK(etl::lz_compress(etl::span<const uint8_t>(log.data(), log.size()), writer, hash_table));
+
+      etl::byte_stream_reader reader(storage, writer.size_bytes(), etl::endian::little);
+
+      uint8_t small[10];
+      CHECK(!etl::lz_decompress(reader, etl::span<uint8_t>(small)).has_value());
+      CHECK_EQUAL(0U, reader.used_data().size());
+
+      Bytes output(log.size());
+      CHECK(etl::lz_decompress(reader, etl::span<uint8_t>(output.data(), output.size())).has_value());
+      CHECK(log == output);
+    }
+#endif
+  }
+}
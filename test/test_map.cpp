@@ -1622,6 +1622,124 @@ namespace
       CHECK(!data.contains(std::string("99")));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_sorted)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+
+      // Ascending by key_comp().
+      std::vector<std::string> keys;
+      keys.push_back("9");
+      keys.push_back("7");
+      keys.push_back("55");
+      keys.push_back("5");
+      keys.push_back("3");
+      keys.push_back("0");
+      std::sort(keys.begin(), keys.end(), data.key_comp());
+
+      std::vector<Data::iterator> found;
+      data.find_sorted(keys.begin(), keys.end(), std::back_inserter(found));
+
+      CHECK_EQUAL(keys.size(), found.size());
+
+      for (size_t i = 0UL; i < keys.size(); ++i)
+      {
+        CHECK(found[i] == data.find(keys[i]));
+      }
+
+      const Data& cdata = data;
+      std::vector<Data::const_iterator> cfound;
+      cdata.find_sorted(keys.begin(), keys.end(), std::back_inserter(cfound));
+
+      CHECK_EQUAL(keys.size(), cfound.size());
+
+      for (size_t i = 0UL; i < keys.size(); ++i)
+      {
+        CHECK(cfound[i] == cdata.find(keys[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_find_sorted_all_strides)
+    {
+      etl::map<int, int, 64> data;
+
+      for (int i = 0; i < 128; i += 2)
+      {
+        data.insert(std::make_pair(i, i * 10));
+      }
+
+      for (int start = -1; start < 4; ++start)
+      {
+        for (int stride = 1; stride < 40; ++stride)
+        {
+          std::vector<int> keys;
+
+          for (int key = start; key < 130; key += stride)
+          {
+            keys.push_back(key);
+            keys.push_back(key); // Duplicate keys are found again.
+          }
+
+          std::vector<etl::map<int, int, 64>::iterator> found;
+          data.find_sorted(keys.begin(), keys.end(), std::back_inserter(found));
+
+          CHECK_EQUAL(keys.size(), found.size());
+
+          for (size_t i = 0UL; i < keys.size(); ++i)
+          {
+            CHECK(found[i] == data.find(keys[i]));
+          }
+
+          CHECK_EQUAL(size_t(std::count_if(keys.begin(), keys.end(), [](int k) { return (k >= 0) && (k < 128) && ((k % 2) == 0); })),
+                      data.count_sorted(keys.begin(), keys.end()));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_intersect_and_difference_sorted)
+    {
+      etl::map<int, int, 64> data;
+
+      for (int i = 0; i < 30; i += 3)
+      {
+        data.insert(std::make_pair(i, i * 10));
+      }
+
+      std::vector<int> keys = { 0, 1, 2, 3, 9, 10, 27, 28, 40 };
+
+      std::vector<std::pair<int, int>> intersection;
+      data.intersect_sorted(keys.begin(), keys.end(), std::back_inserter(intersection));
+
+      std::vector<std::pair<int, int>> expected_intersection = { { 0, 0 }, { 3, 30 }, { 9, 90 }, { 27, 270 } };
+      CHECK(expected_intersection == intersection);
+
+      std::vector<int> difference;
+      data.difference_sorted(keys.begin(), keys.end(), std::back_inserter(difference));
+
+      std::vector<int> expected_difference = { 1, 2, 10, 28, 40 };
+      CHECK(expected_difference == difference);
+
+      CHECK_EQUAL(4U, data.count_sorted(keys.begin(), keys.end()));
+    }
+
+    //*************************************************************************
+    TEST(test_find_sorted_empty)
+    {
+      etl::map<int, int, 4> data;
+
+      std::vector<int> keys = { 1, 2 };
+      std::vector<etl::map<int, int, 4>::iterator> found;
+
+      data.find_sorted(keys.begin(), keys.end(), std::back_inserter(found));
+
+      CHECK_EQUAL(2U, found.size());
+      CHECK(found[0] == data.end());
+      CHECK(found[1] == data.end());
+      CHECK_EQUAL(0U, data.count_sorted(keys.begin(), keys.end()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_contains_with_transparent_comparator)
     {
@@ -0,0 +1,300 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/map.h"
+#include "etl/pool.h"
+
+#include <algorithm>
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+// Prints the memory used by, and the insert/erase throughput of, many maps
+// that each embed a pool compared with the same maps sharing one pool.
+#define BENCHMARK_TEST 0
+
+namespace
+{
+  const size_t SIZE = 8UL;
+
+  typedef etl::map_ext<int, int> Data;
+  typedef etl::map<int, int, SIZE> DataFixed;
+  typedef etl::pool<Data::pool_type, SIZE> Pool;
+
+  //*************************************************************************
+  Data::value_type make_value(int i)
+  {
+    return Data::value_type(i, i * 10);
+  }
+
+  //*************************************************************************
+  int key_of(const Data::value_type& value)
+  {
+    return value.first;
+  }
+
+  //*************************************************************************
+  std::vector<int> keys(const Data& data)
+  {
+    std::vector<int> result;
+
+    for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+    {
+      result.push_back(key_of(*itr));
+    }
+
+    std::sort(result.begin(), result.end());
+
+    return result;
+  }
+
+  SUITE(test_map_shared_pool)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Pool pool;
+      Data data(pool);
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(!data.full());
+      CHECK(&pool == &data.get_pool());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_between_instances)
+    {
+      Pool pool;
+      Data data1(pool);
+      Data data2(pool);
+
+      for (int i = 0; i < 3; ++i)
+      {
+        data1.insert(make_value(i));
+      }
+
+      for (int i = 10; i < 14; ++i)
+      {
+        data2.insert(make_value(i));
+      }
+
+      CHECK_EQUAL(3U, data1.size());
+      CHECK_EQUAL(4U, data2.size());
+      CHECK_EQUAL(7U, pool.size());
+      CHECK_EQUAL(1U, data1.available());
+      CHECK_EQUAL(1U, data2.available());
+
+      data1.erase(data1.begin());
+      CHECK_EQUAL(2U, data1.size());
+      CHECK_EQUAL(6U, pool.size());
+
+      // Clearing one instance leaves the nodes of the other in the pool.
+      data1.clear();
+      CHECK(data1.empty());
+      CHECK_EQUAL(4U, data2.size());
+      CHECK_EQUAL(4U, pool.size());
+
+      std::vector<int> expected;
+      expected.push_back(10);
+      expected.push_back(11);
+      expected.push_back(12);
+      expected.push_back(13);
+      CHECK(keys(data2) == expected);
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_releases_nodes)
+    {
+      Pool pool;
+      Data data1(pool);
+
+      data1.insert(make_value(1));
+
+      {
+        Data data2(pool);
+        data2.insert(make_value(2));
+        data2.insert(make_value(3));
+        CHECK_EQUAL(3U, pool.size());
+      }
+
+      CHECK_EQUAL(1U, pool.size());
+      CHECK_EQUAL(1U, data1.size());
+    }
+
+    //*************************************************************************
+    TEST(test_pool_exhausted)
+    {
+      Pool pool;
+      Data data1(pool);
+      Data data2(pool);
+
+      for (int i = 0; i < int(SIZE) - 1; ++i)
+      {
+        data1.insert(make_value(i));
+      }
+
+      data2.insert(make_value(100));
+
+      CHECK(data1.full());
+      CHECK(data2.full());
+      CHECK_THROW(data2.insert(make_value(101)), etl::exception);
+      CHECK_EQUAL(1U, data2.size());
+
+      data1.clear();
+      data2.insert(make_value(101));
+      CHECK_EQUAL(2U, data2.size());
+    }
+
+    //*************************************************************************
+    TEST(test_pool_exhausted_through_base)
+    {
+      Pool pool;
+      Data data1(pool);
+      Data data2(pool);
+
+      etl::imap<int, int>& base = data2;
+
+      for (int i = 0; i < int(SIZE) - 1; ++i)
+      {
+        data1.insert(make_value(i));
+      }
+
+      CHECK(!base.full());
+      CHECK_EQUAL(1U, base.available());
+
+      base.insert(make_value(100));
+
+      CHECK(base.full());
+      CHECK_EQUAL(0U, base.available());
+      CHECK_THROW(base.insert(make_value(101)), etl::map_full);
+      CHECK_EQUAL(1U, base.size());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Pool pool;
+      Data data(pool);
+
+      data.insert(make_value(1));
+      data.insert(make_value(2));
+
+      Data copy(data);
+      CHECK(&pool == &copy.get_pool());
+      CHECK(keys(copy) == keys(data));
+      CHECK_EQUAL(4U, pool.size());
+
+      Data moved(etl::move(copy));
+      CHECK(copy.empty());
+      CHECK(keys(moved) == keys(data));
+      CHECK_EQUAL(4U, pool.size());
+
+      Data assigned(pool);
+      assigned.insert(make_value(5));
+      assigned = data;
+      CHECK(keys(assigned) == keys(data));
+      CHECK_EQUAL(6U, pool.size());
+
+      assigned = etl::move(moved);
+      CHECK(moved.empty());
+      CHECK_EQUAL(4U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_memory_saving)
+    {
+      // An instance no longer embeds its own nodes.
+      CHECK(sizeof(Data) < sizeof(DataFixed));
+    }
+
+    //*************************************************************************
+#if BENCHMARK_TEST
+    template <typename TMap>
+    double churn(std::vector<TMap*>& maps)
+    {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      for (int pass = 0; pass < 1000; ++pass)
+      {
+        for (size_t m = 0U; m < maps.size(); ++m)
+        {
+          maps[m]->insert(typename TMap::value_type(pass, pass));
+
+          if (maps[m]->size() > 4U)
+          {
+            maps[m]->erase(maps[m]->begin());
+          }
+        }
+      }
+
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+      return (1000.0 * maps.size()) / elapsed.count();
+    }
+
+    TEST(test_benchmark)
+    {
+      static const size_t Sessions = 200U;
+      static const size_t Nodes    = 64U;
+
+      typedef etl::map<int, int, Nodes>                   Embedded;
+      typedef etl::map_ext<int, int>                      Shared;
+      typedef etl::pool<Shared::pool_type, Sessions * 8U> SharedPool;
+
+      std::vector<std::unique_ptr<Embedded>> embedded_storage;
+      std::vector<Embedded*>                 embedded;
+
+      std::unique_ptr<SharedPool>          pool(new SharedPool);
+      std::vector<std::unique_ptr<Shared>> shared_storage;
+      std::vector<Shared*>                 shared;
+
+      for (size_t i = 0U; i < Sessions; ++i)
+      {
+        embedded_storage.emplace_back(new Embedded);
+        embedded.push_back(embedded_storage.back().get());
+
+        shared_storage.emplace_back(new Shared(*pool));
+        shared.push_back(shared_storage.back().get());
+      }
+
+      std::cout << "map with embedded pools: " << (Sessions * sizeof(Embedded)) << " bytes, "
+                << churn(embedded) << " insert/erase per second" << std::endl;
+
+      std::cout << "map_ext with shared pool: " << ((Sessions * sizeof(Shared)) + sizeof(SharedPool)) << " bytes, "
+                << churn(shared) << " insert/erase per second" << std::endl;
+    }
+#endif
+  };
+}
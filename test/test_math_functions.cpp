@@ -38,6 +38,11 @@ SOFTWARE.
 #include "etl/gcd.h"
 #include "etl/lcm.h"
 
+#include <algorithm>
+#include <set>
+#include <vector>
+#include <stdint.h>
+
 namespace
 {
   int sqrt(int v)
@@ -460,6 +465,119 @@ namespace
       CHECK_EQUAL((combinations(14, 10)), (actual = etl::combinations<14, 10>::value));
     }
 
+    //*************************************************************************
+    TEST(test_combination_view)
+    {
+      typedef etl::combination_view<6, 3> View;
+
+      View view;
+      std::set<uint32_t> seen;
+      uint32_t previous = 0U;
+
+      for (View::const_iterator itr = view.begin(); itr != view.end(); ++itr)
+      {
+        uint32_t mask = *itr;
+
+        CHECK_EQUAL(3, etl::count_bits(mask));
+        CHECK(mask < (1U << 6U));
+        CHECK(mask > previous);
+
+        seen.insert(mask);
+        previous = mask;
+      }
+
+      CHECK_EQUAL(View::size(), seen.size());
+      CHECK_EQUAL(0x07U, View::first());
+      CHECK_EQUAL(0x38U, View::last());
+    }
+
+    //*************************************************************************
+    TEST(test_combination_view_edge_cases)
+    {
+      etl::combination_view<5, 0> none;
+      CHECK_EQUAL(1, std::distance(none.begin(), none.end()));
+      CHECK_EQUAL(0U, *none.begin());
+
+      etl::combination_view<5, 5> all;
+      CHECK_EQUAL(1, std::distance(all.begin(), all.end()));
+      CHECK_EQUAL(0x1FU, *all.begin());
+
+      etl::combination_view<64, 1> wide;
+      size_t count = 0U;
+      uint64_t expected = 1U;
+
+      for (etl::combination_view<64, 1>::const_iterator itr = wide.begin(); itr != wide.end(); ++itr)
+      {
+        CHECK_EQUAL(expected, *itr);
+        expected <<= 1U;
+        ++count;
+      }
+
+      CHECK_EQUAL(64U, count);
+
+      etl::combination_view<64, 63> high;
+      CHECK_EQUAL(64, std::distance(high.begin(), high.end()));
+      CHECK_EQUAL(~uint64_t(0U) >> 1U, *high.begin());
+      CHECK_EQUAL(~uint64_t(0U) << 1U, high.last());
+    }
+
+    //*************************************************************************
+    TEST(test_heap_permutation_one_swap_per_step)
+    {
+      int data[5] = { 0, 1, 2, 3, 4 };
+      std::set<std::vector<int> > seen;
+
+      seen.insert(std::vector<int>(data, data + 5));
+
+      etl::heap_permutation<5> generator;
+      int previous[5];
+
+      std::copy(data, data + 5, previous);
+
+      while (generator.next(data))
+      {
+        int differences = 0;
+
+        for (size_t i = 0U; i < 5U; ++i)
+        {
+          differences += (data[i] != previous[i]) ? 1 : 0;
+        }
+
+        CHECK_EQUAL(2, differences);
+
+        seen.insert(std::vector<int>(data, data + 5));
+        std::copy(data, data + 5, previous);
+      }
+
+      CHECK_EQUAL(120U, seen.size());
+    }
+
+    //*************************************************************************
+    TEST(test_permutation_view)
+    {
+      std::vector<char> data;
+      data.push_back('a');
+      data.push_back('b');
+      data.push_back('c');
+      data.push_back('d');
+
+      typedef etl::permutation_view<4, std::vector<char>::iterator> View;
+
+      View view = etl::make_permutation_view<4>(data.begin());
+      std::set<std::vector<char> > seen;
+
+      for (View::iterator itr = view.begin(); itr != view.end(); ++itr)
+      {
+        seen.insert(std::vector<char>(*itr, *itr + 4));
+      }
+
+      CHECK_EQUAL(View::size(), seen.size());
+      CHECK_EQUAL(24U, seen.size());
+
+      etl::permutation_view<1, char*> single(&data[0]);
+      CHECK_EQUAL(1, std::distance(single.begin(), single.end()));
+    }
+
     //*************************************************************************
     TEST(test_gdc_for_positive_integers)
     {
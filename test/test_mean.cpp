@@ -112,5 +112,19 @@ namespace
       mean_result = mean1.get_mean();
       CHECK_CLOSE(4.5, mean_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_double_mean_add_span_and_merge)
+    {
+      etl::mean<double> mean1;
+      etl::mean<double> mean2;
+
+      mean1.add(etl::span<const double>(input_d.data(), 7U));
+      mean2.add(etl::span<const double>(input_d.data() + 7U, 3U));
+      mean1.merge(mean2);
+
+      CHECK_EQUAL(input_d.size(), mean1.count());
+      CHECK_CLOSE(4.5, mean1.get_mean(), 0.0001);
+    }
   };
 }
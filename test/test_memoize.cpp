@@ -0,0 +1,239 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/memoize.h"
+
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  int square_calls = 0;
+
+  int square(int i)
+  {
+    ++square_calls;
+    return i * i;
+  }
+
+  std::string name_calls_text;
+
+  std::string name(const std::string& s)
+  {
+    name_calls_text += s;
+    return "<" + s + ">";
+  }
+
+  //***************************************************************************
+  /// Puts every key in the same set.
+  //***************************************************************************
+  struct SameHash
+  {
+    size_t operator ()(int) const
+    {
+      return 0U;
+    }
+  };
+
+  //***************************************************************************
+  struct StringHash
+  {
+    size_t operator ()(const std::string& s) const
+    {
+      return std::hash<std::string>()(s);
+    }
+  };
+
+  typedef etl::memoize<int(int), 16>                              DirectMapped;
+  typedef etl::memoize<int(int), 16, 2>                           TwoWay;
+  typedef etl::memoize<int(int), 2, 2, etl::null_mutex, SameHash> TwoWaySameSet;
+  typedef etl::memoize<int(int), 1>                               OneEntry;
+
+  SUITE(test_memoize)
+  {
+    //*************************************************************************
+    TEST(test_properties)
+    {
+      CHECK_EQUAL(16U, DirectMapped::SETS);
+      CHECK_EQUAL(1U,  DirectMapped::WAYS);
+      CHECK_EQUAL(8U,  TwoWay::SETS);
+      CHECK_EQUAL(2U,  TwoWay::WAYS);
+      CHECK_EQUAL(16U, TwoWay::CAPACITY);
+    }
+
+    //*************************************************************************
+    TEST(test_hits_and_misses)
+    {
+      square_calls = 0;
+
+      DirectMapped memo(DirectMapped::function_type::create<square>());
+
+      CHECK_EQUAL(9, memo(3));
+      CHECK_EQUAL(9, memo(3));
+      CHECK_EQUAL(16, memo(4));
+      CHECK_EQUAL(9, memo(3));
+
+      CHECK(memo.contains(3));
+      CHECK(memo.contains(4));
+      CHECK(!memo.contains(5));
+
+      CHECK_EQUAL(2, square_calls);
+      CHECK_EQUAL(2U, memo.hits());
+      CHECK_EQUAL(2U, memo.misses());
+
+      memo.clear();
+      CHECK(!memo.contains(3));
+      CHECK_EQUAL(9, memo(3));
+      CHECK_EQUAL(3, square_calls);
+    }
+
+    //*************************************************************************
+    TEST(test_direct_mapped_replaces)
+    {
+      square_calls = 0;
+
+      OneEntry memo(OneEntry::function_type::create<square>());
+
+      memo(2);
+      memo(3);
+      CHECK(!memo.contains(2));
+      CHECK(memo.contains(3));
+      memo(2);
+      CHECK_EQUAL(3, square_calls);
+    }
+
+    //*************************************************************************
+    TEST(test_two_way_replaces_least_recently_used)
+    {
+      square_calls = 0;
+
+      TwoWaySameSet memo(TwoWaySameSet::function_type::create<square>());
+
+      memo(1);
+      memo(2);
+      memo(1); // 2 is now the least recently used.
+      memo(3);
+
+      CHECK(memo.contains(1));
+      CHECK(!memo.contains(2));
+      CHECK(memo.contains(3));
+
+      memo(3);
+      memo(4);
+      CHECK(!memo.contains(1));
+      CHECK(memo.contains(3));
+      CHECK(memo.contains(4));
+      CHECK_EQUAL(4, square_calls);
+    }
+
+    //*************************************************************************
+    TEST(test_reference_argument)
+    {
+      typedef etl::memoize<std::string(const std::string&), 8, 2, etl::null_mutex, StringHash> Memo;
+
+      name_calls_text.clear();
+
+      Memo memo;
+      memo.set_function(Memo::function_type::create<name>());
+
+      CHECK_EQUAL(std::string("<a>"), memo(std::string("a")));
+      CHECK_EQUAL(std::string("<b>"), memo(std::string("b")));
+      CHECK_EQUAL(std::string("<a>"), memo(std::string("a")));
+      CHECK_EQUAL(std::string("ab"), name_calls_text);
+    }
+
+    //*************************************************************************
+    TEST(test_many_keys)
+    {
+      square_calls = 0;
+
+      TwoWay memo(TwoWay::function_type::create<square>());
+
+      for (int pass = 0; pass < 3; ++pass)
+      {
+        for (int i = 0; i < 100; ++i)
+        {
+          CHECK_EQUAL(i * i, memo(i));
+        }
+      }
+
+      CHECK_EQUAL(300U, memo.hits() + memo.misses());
+      CHECK_EQUAL(int(memo.misses()), square_calls);
+    }
+
+#if ETL_HAS_MUTEX && !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    int cube(int i)
+    {
+      return i * i * i;
+    }
+
+    TEST(test_threads)
+    {
+      typedef etl::memoize<int(int), 32, 2, etl::mutex> Memo;
+
+      Memo memo(Memo::function_type::create<cube>());
+
+      std::vector<std::thread> threads;
+      std::vector<int>         errors(4, 0);
+
+      for (int t = 0; t < 4; ++t)
+      {
+        threads.push_back(std::thread([&memo, &errors, t]()
+        {
+          for (int i = 0; i < 20000; ++i)
+          {
+            const int key = (i + t) % 40;
+
+            if (memo(key) != key * key * key)
+            {
+              ++errors[t];
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      for (size_t t = 0U; t < errors.size(); ++t)
+      {
+        CHECK_EQUAL(0, errors[t]);
+      }
+
+      CHECK_EQUAL(4U * 20000U, memo.hits() + memo.misses());
+    }
+#endif
+  }
+}
@@ -1529,5 +1529,49 @@ namespace
 
       CHECK_THROW(etl::destroy_object_at<Data>(pbuffer1), etl::alignment_error);
     }
+
+    //*************************************************************************
+    TEST(test_uninitialized_relocate_trivial_overlapping)
+    {
+      int data[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      int* result = etl::uninitialized_relocate(data + 2, data + 7, data + 4);
+      CHECK_EQUAL(data + 9, result);
+
+      int expected_up[] = { 2, 3, 4, 5, 6 };
+      CHECK(std::equal(expected_up, expected_up + 5, data + 4));
+
+      result = etl::uninitialized_relocate(data + 4, data + 9, data + 1);
+      CHECK_EQUAL(data + 6, result);
+      CHECK(std::equal(expected_up, expected_up + 5, data + 1));
+    }
+
+    //*************************************************************************
+    TEST(test_uninitialized_relocate_non_trivial_overlapping)
+    {
+      typedef TestDataNDC<std::string> Item;
+
+      const Item initial[] = { Item("0"), Item("1"), Item("2"), Item("3"), Item("4") };
+
+      alignas(Item) char buffer[sizeof(Item) * 8];
+      Item* p = reinterpret_cast<Item*>(buffer);
+
+      std::uninitialized_copy(initial, initial + 5, p);
+      const auto count = Item::get_instance_count();
+
+      // Up by 3, overlapping.
+      Item* result = etl::uninitialized_relocate(p, p + 5, p + 3);
+      CHECK_EQUAL(p + 8, result);
+      CHECK(std::equal(initial, initial + 5, p + 3));
+
+      // Back down by 2, overlapping.
+      result = etl::uninitialized_relocate(p + 3, p + 8, p + 1);
+      CHECK_EQUAL(p + 6, result);
+      CHECK(std::equal(initial, initial + 5, p + 1));
+
+      CHECK_EQUAL(count, Item::get_instance_count());
+
+      etl::destroy(p + 1, p + 6);
+    }
   };
 }
@@ -558,5 +558,155 @@ namespace
       CHECK_TRUE(broker.accepts(MESSAGE5));
       CHECK_TRUE(broker.accepts(MESSAGE6));
     }
+
+    //*************************************************************************
+    TEST(test_indexed_message_broker_send_messages_to_subscribers)
+    {
+      typedef etl::indexed_message_broker<6, 10> IndexedBroker;
+
+      IndexedBroker broker;
+      Router router1(1);
+      Router router2(2);
+      Router router3(3);
+
+      Subscription subscription1{ router1, { Message1::ID, Message2::ID, Message3::ID, Message4::ID } };
+      Subscription subscription2{ router2, { Message1::ID, Message2::ID } };
+      Subscription subscription3{ router2, { Message1::ID, Message3::ID, Message3::ID } };
+
+      CHECK_TRUE(broker.is_indexed());
+
+      broker.subscribe(subscription1);
+      broker.subscribe(subscription2);
+      broker.subscribe(subscription3); // Duplicate router. Replace the old subscription.
+      broker.subscribe(subscription1); // Do subscription1 again to see if it breaks.
+
+      CHECK_TRUE(broker.is_indexed());
+
+      broker.set_successor(router3);
+
+      broker.receive(Message1());
+      broker.receive(Message2());
+      broker.receive(Message3());
+      broker.receive(Message4());
+      broker.receive(Message5());
+      broker.receive(UnknownMessage());
+      broker.receive(2, Message1());
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(1, router3.message1_count);
+
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(0, router2.message2_count);
+      CHECK_EQUAL(1, router3.message2_count);
+
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(1, router2.message3_count);
+      CHECK_EQUAL(1, router3.message3_count);
+
+      CHECK_EQUAL(1, router1.message4_count);
+      CHECK_EQUAL(0, router2.message4_count);
+      CHECK_EQUAL(1, router3.message4_count);
+
+      CHECK_EQUAL(0, router1.message5_count);
+      CHECK_EQUAL(0, router2.message5_count);
+      CHECK_EQUAL(1, router3.message5_count);
+
+      CHECK_EQUAL(0, router1.message_unknown_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+      CHECK_EQUAL(1, router3.message_unknown_count);
+    }
+
+    //*************************************************************************
+    TEST(test_indexed_message_broker_unsubscribe_and_accepts)
+    {
+      etl::indexed_message_broker<6, 10> broker;
+      Router router1(1);
+      Router router2(2);
+
+      Subscription subscription1{ router1, { Message1::ID, Message3::ID } };
+      Subscription subscription2{ router2, { Message1::ID, Message2::ID, Message3::ID, Message4::ID } };
+
+      CHECK_FALSE(broker.accepts(MESSAGE1));
+
+      broker.subscribe(subscription1);
+      broker.subscribe(subscription2);
+
+      CHECK_TRUE(broker.accepts(MESSAGE1));
+      CHECK_TRUE(broker.accepts(MESSAGE2));
+      CHECK_TRUE(broker.accepts(MESSAGE3));
+      CHECK_TRUE(broker.accepts(MESSAGE4));
+      CHECK_FALSE(broker.accepts(MESSAGE5));
+
+      broker.unsubscribe(router2);
+
+      CHECK_TRUE(broker.accepts(MESSAGE1));
+      CHECK_FALSE(broker.accepts(MESSAGE2));
+      CHECK_TRUE(broker.accepts(MESSAGE3));
+      CHECK_FALSE(broker.accepts(MESSAGE4));
+
+      broker.receive(Message1());
+      broker.receive(Message2());
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(0, router2.message1_count);
+      CHECK_EQUAL(0, router2.message2_count);
+
+      broker.clear();
+
+      CHECK_TRUE(broker.empty());
+      CHECK_FALSE(broker.accepts(MESSAGE1));
+
+      broker.receive(Message1());
+      CHECK_EQUAL(1, router1.message1_count);
+    }
+
+    //*************************************************************************
+    TEST(test_indexed_message_broker_index_full)
+    {
+      etl::indexed_message_broker<2, 10> broker;
+      Router router1(1);
+      Router router2(2);
+
+      Subscription subscription1{ router1, { Message1::ID, Message2::ID } };
+      Subscription subscription2{ router2, { Message3::ID } };
+
+      broker.subscribe(subscription1);
+      CHECK_TRUE(broker.is_indexed());
+
+      // Too many different message ids.
+      CHECK_THROW(broker.subscribe(subscription2), etl::message_broker_index_full);
+      CHECK_FALSE(broker.is_indexed());
+
+      // Messages are still distributed.
+      broker.receive(Message1());
+      broker.receive(Message3());
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router2.message3_count);
+      CHECK_TRUE(broker.accepts(MESSAGE3));
+
+      // The index is used again when the subscriptions fit.
+      broker.unsubscribe(router2);
+      CHECK_TRUE(broker.is_indexed());
+
+      // Too many subscription entries.
+      etl::indexed_message_broker<4, 2> small_broker;
+      Subscription subscription3{ router2, { Message1::ID, Message2::ID, Message3::ID } };
+
+      CHECK_THROW(small_broker.subscribe(subscription3), etl::message_broker_index_full);
+      CHECK_FALSE(small_broker.is_indexed());
+
+      small_broker.receive(Message2());
+      CHECK_EQUAL(1, router2.message2_count);
+    }
+
+    //*************************************************************************
+    TEST(test_message_broker_is_not_indexed)
+    {
+      Broker broker;
+
+      CHECK_FALSE(broker.is_indexed());
+    }
   };
 }
@@ -33,6 +33,11 @@ SOFTWARE.
 #include "etl/queue.h"
 #include "etl/largest.h"
 #include "etl/packet.h"
+#include "etl/shared_message.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+
+#include <vector>
 
 //***************************************************************************
 // The set of messages.
@@ -255,6 +260,37 @@ namespace
     }
   };
 
+  //***************************************************************************
+  // Router that records the order of messages 6 and 7.
+  //***************************************************************************
+  class RouterD : public etl::message_router<RouterD, Message6, Message7>
+  {
+  public:
+
+    RouterD(etl::message_router_id_t id)
+      : message_router(id)
+    {
+    }
+
+    void on_receive(const Message6&)
+    {
+      received.push_back(MESSAGE6);
+    }
+
+    void on_receive(const Message7&)
+    {
+      received.push_back(MESSAGE7);
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    std::vector<etl::message_id_t> received;
+  };
+
+  typedef etl::atomic_counted_message_pool::pool_message_parameters<Message6, Message7> pool_message_parameters;
+
   //***************************************************************************
   template <size_t Size>
   class MessageBus : public etl::message_bus<Size>
@@ -1007,5 +1043,140 @@ namespace
       CHECK_TRUE(bus1.accepts(MESSAGE6));
       CHECK_FALSE(bus1.accepts(MESSAGE7));
     }
+
+    //*************************************************************************
+    TEST(queued_message_bus_defers_shared_messages)
+    {
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment, 4U> memory_allocator;
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      etl::queued_message_bus<2U, 4U> bus;
+      RouterD router1(ROUTER1);
+      RouterD router2(ROUTER2);
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      etl::shared_message sm(message_pool, Message6());
+      etl::send_message(bus, sm);
+      etl::send_message(bus, ROUTER2, etl::shared_message(message_pool, Message7()));
+
+      // Nothing is delivered until the queue is processed.
+      CHECK_EQUAL(2U, bus.queue_size());
+      CHECK_EQUAL(2U, sm.get_reference_count());
+      CHECK_TRUE(router1.received.empty());
+      CHECK_TRUE(router2.received.empty());
+
+      CHECK_EQUAL(2U, bus.process_queue());
+
+      CHECK_TRUE(bus.queue_empty());
+      CHECK_EQUAL(1U, sm.get_reference_count());
+      CHECK_EQUAL(1U, router1.received.size());
+      CHECK_EQUAL(2U, router2.received.size());
+      CHECK_EQUAL(MESSAGE6, router1.received[0]);
+      CHECK_EQUAL(MESSAGE6, router2.received[0]);
+      CHECK_EQUAL(MESSAGE7, router2.received[1]);
+    }
+
+    //*************************************************************************
+    TEST(queued_message_bus_delivers_unshared_messages_immediately)
+    {
+      etl::queued_message_bus<1U, 4U> bus;
+      RouterD router(ROUTER1);
+
+      bus.subscribe(router);
+
+      Message6 message6;
+      etl::send_message(bus, message6);
+
+      CHECK_TRUE(bus.queue_empty());
+      CHECK_EQUAL(1U, router.received.size());
+      CHECK_EQUAL(0U, bus.process_queue());
+    }
+
+    //*************************************************************************
+    TEST(queued_message_bus_process_in_batches)
+    {
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment, 4U> memory_allocator;
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      etl::queued_message_bus<1U, 4U> bus;
+      RouterD router(ROUTER1);
+
+      bus.subscribe(router);
+
+      etl::shared_message sm(message_pool, Message6());
+
+      CHECK_TRUE(bus.post(sm));
+      CHECK_TRUE(bus.post(sm));
+      CHECK_TRUE(bus.post(sm));
+
+      CHECK_EQUAL(2U, bus.process_queue(2U));
+      CHECK_EQUAL(1U, bus.queue_size());
+      CHECK_EQUAL(2U, router.received.size());
+
+      CHECK_EQUAL(1U, bus.process_queue(2U));
+      CHECK_EQUAL(0U, bus.queue_size());
+      CHECK_EQUAL(3U, router.received.size());
+    }
+
+    //*************************************************************************
+    TEST(queued_message_bus_priorities)
+    {
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment, 4U> memory_allocator;
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      etl::queued_message_bus<1U, 4U, 2U> bus;
+      RouterD router(ROUTER1);
+
+      bus.subscribe(router);
+
+      etl::shared_message sm6(message_pool, Message6());
+      etl::shared_message sm7(message_pool, Message7());
+
+      CHECK_TRUE(bus.post(sm6, 0U));
+      CHECK_TRUE(bus.post(sm6, 0U));
+      CHECK_TRUE(bus.post(ROUTER1, sm7, 1U));
+
+      CHECK_EQUAL(2U, bus.queue_size(0U));
+      CHECK_EQUAL(1U, bus.queue_size(1U));
+      CHECK_THROW(bus.post(sm6, 2U), etl::message_bus_invalid_priority);
+
+      CHECK_EQUAL(3U, bus.process_queue());
+
+      CHECK_EQUAL(3U, router.received.size());
+      CHECK_EQUAL(MESSAGE7, router.received[0]);
+      CHECK_EQUAL(MESSAGE6, router.received[1]);
+      CHECK_EQUAL(MESSAGE6, router.received[2]);
+    }
+
+    //*************************************************************************
+    TEST(queued_message_bus_queue_full)
+    {
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment, 4U> memory_allocator;
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      etl::queued_message_bus<1U, 2U> bus;
+      RouterD router(ROUTER1);
+
+      bus.subscribe(router);
+
+      etl::shared_message sm(message_pool, Message6());
+
+      CHECK_TRUE(bus.post(sm));
+      CHECK_TRUE(bus.post(sm));
+      CHECK_FALSE(bus.post(sm));
+      CHECK_THROW(etl::send_message(bus, sm), etl::message_bus_queue_full);
+
+      bus.clear_queue();
+      CHECK_TRUE(bus.queue_empty());
+      CHECK_EQUAL(1U, sm.get_reference_count());
+      CHECK_EQUAL(0U, bus.process_queue());
+      CHECK_TRUE(router.received.empty());
+    }
   };
 }
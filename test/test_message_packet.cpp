@@ -33,6 +33,7 @@ SOFTWARE.
 #if ETL_HAS_VIRTUAL_MESSAGES
 
 #include "etl/message_packet.h"
+#include "etl/queue_spsc_atomic.h"
 
 #include <string>
 
@@ -479,6 +480,63 @@ namespace
       obj.Push(packet1);
       obj.Push(packet2);
     }
+
+#if !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(message_packet_in_place_construction)
+    {
+      Packet packet(etl::in_place_type_t<Message1>(), 1);
+
+      CHECK(packet.is_valid());
+      CHECK_EQUAL(MESSAGE1, packet.get().get_message_id());
+      CHECK_EQUAL(1, static_cast<Message1&>(packet.get()).x);
+      CHECK(!static_cast<Message1&>(packet.get()).copied);
+      CHECK(!static_cast<Message1&>(packet.get()).moved);
+    }
+
+    //*************************************************************************
+    TEST(message_packet_emplace)
+    {
+      Packet packet;
+
+      Message1& message1 = packet.emplace<Message1>(1);
+
+      CHECK(packet.is_valid());
+      CHECK(&message1 == &packet.get());
+      CHECK_EQUAL(1, message1.x);
+      CHECK(!message1.copied);
+      CHECK(!message1.moved);
+
+      Message3& message3 = packet.emplace<Message3>("3");
+
+      CHECK(packet.is_valid());
+      CHECK_EQUAL(MESSAGE3, packet.get().get_message_id());
+      CHECK_EQUAL(std::string("3"), message3.x);
+    }
+
+    //*************************************************************************
+    TEST(message_packet_emplace_in_queue)
+    {
+      etl::queue_spsc_atomic<Packet, 4> queue;
+
+      CHECK(queue.emplace(etl::in_place_type_t<Message1>(), 1));
+      CHECK(queue.emplace(etl::in_place_type_t<Message2>(), 2.2));
+
+      Packet& packet1 = queue.front();
+      CHECK_EQUAL(MESSAGE1, packet1.get().get_message_id());
+      CHECK_EQUAL(1, static_cast<Message1&>(packet1.get()).x);
+      CHECK(!static_cast<Message1&>(packet1.get()).copied);
+      CHECK(!static_cast<Message1&>(packet1.get()).moved);
+      CHECK(queue.pop());
+
+      Packet& packet2 = queue.front();
+      CHECK_EQUAL(MESSAGE2, packet2.get().get_message_id());
+      CHECK_EQUAL(2.2, static_cast<Message2&>(packet2.get()).x);
+      CHECK(!static_cast<Message2&>(packet2.get()).copied);
+      CHECK(!static_cast<Message2&>(packet2.get()).moved);
+      CHECK(queue.pop());
+    }
+#endif
   };
 }
 
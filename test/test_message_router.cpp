@@ -253,6 +253,52 @@ namespace
     int sender_id;
   };
 
+  //***********************************
+  // Messages with sparse ids.
+  //***********************************
+  template <etl::message_id_t Id>
+  struct SparseMessage : public etl::message<Id>
+  {
+  };
+
+  typedef SparseMessage<10>  Sparse10;
+  typedef SparseMessage<100> Sparse100;
+  typedef SparseMessage<200> Sparse200;
+  typedef SparseMessage<250> Sparse250;
+  typedef SparseMessage<30>  Sparse30;
+  typedef SparseMessage<99>  Sparse99;
+
+  //***************************************************************************
+  // Router that handles messages with sparse ids, listed out of order.
+  //***************************************************************************
+  class SparseRouter : public etl::message_router<SparseRouter, Sparse200, Sparse10, Sparse250, Sparse100, Sparse30>
+  {
+  public:
+
+    SparseRouter()
+      : last_id(0)
+      , receive_count(0)
+      , message_unknown_count(0)
+    {
+    }
+
+    template <etl::message_id_t Id>
+    void on_receive(const SparseMessage<Id>&)
+    {
+      last_id = Id;
+      ++receive_count;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    int last_id;
+    int receive_count;
+    int message_unknown_count;
+  };
+
   etl::imessage_router* p_router;
 
   SUITE(test_message_router)
@@ -641,5 +687,88 @@ namespace
       CHECK_EQUAL(0, r1.message4_count);
       CHECK_EQUAL(0, r1.message_unknown_count);
     }
+
+    //*************************************************************************
+    TEST(message_router_sparse_ids)
+    {
+      SparseRouter router;
+
+      const etl::imessage& m10  = Sparse10();
+      const etl::imessage& m30  = Sparse30();
+      const etl::imessage& m99  = Sparse99();
+      const etl::imessage& m100 = Sparse100();
+      const etl::imessage& m200 = Sparse200();
+      const etl::imessage& m250 = Sparse250();
+
+      router.receive(m10);
+      CHECK_EQUAL(10, router.last_id);
+
+      router.receive(m250);
+      CHECK_EQUAL(250, router.last_id);
+
+      router.receive(m30);
+      CHECK_EQUAL(30, router.last_id);
+
+      router.receive(m200);
+      CHECK_EQUAL(200, router.last_id);
+
+      router.receive(m100);
+      CHECK_EQUAL(100, router.last_id);
+
+      router.receive(m99);
+      CHECK_EQUAL(100, router.last_id);
+
+      CHECK_EQUAL(5, router.receive_count);
+      CHECK_EQUAL(1, router.message_unknown_count);
+
+      CHECK(router.accepts(10));
+      CHECK(router.accepts(30));
+      CHECK(router.accepts(100));
+      CHECK(router.accepts(200));
+      CHECK(router.accepts(250));
+      CHECK(!router.accepts(0));
+      CHECK(!router.accepts(11));
+      CHECK(!router.accepts(99));
+      CHECK(!router.accepts(101));
+      CHECK(!router.accepts(255));
+    }
+
+    //*************************************************************************
+    TEST(message_router_sparse_ids_successor)
+    {
+      Router1      r1; // M1, M2, M3, M4, M5
+      SparseRouter sparse;
+
+      sparse.set_successor(r1);
+
+      etl::null_message_router null_router;
+      Message3 message3(null_router);
+
+      CHECK(sparse.accepts(MESSAGE3));
+      CHECK(sparse.accepts(200));
+      CHECK(!sparse.accepts(99));
+
+      sparse.receive(static_cast<const etl::imessage&>(message3));
+      CHECK_EQUAL(1, r1.message3_count);
+      CHECK_EQUAL(0, sparse.message_unknown_count);
+      CHECK_EQUAL(0, sparse.receive_count);
+    }
+
+#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(message_router_dispatch_table_selection)
+    {
+      typedef void (*handler_t)();
+
+      // Dense ids use a jump table, sparse ids a sorted search.
+      CHECK((etl::private_message_router::dispatch_table<handler_t, 1, 2, 3, 4, 5>::Is_Jump_Table));
+      CHECK((etl::private_message_router::dispatch_table<handler_t, 9, 2, 5>::Is_Jump_Table));
+      CHECK(!(etl::private_message_router::dispatch_table<handler_t, 200, 10, 250, 100, 30>::Is_Jump_Table));
+
+      CHECK_EQUAL(1U,  (etl::private_message_router::dispatch_table<handler_t, 5, 1, 3>::Min_Id));
+      CHECK_EQUAL(5U,  (etl::private_message_router::dispatch_table<handler_t, 5, 1, 3>::Max_Id));
+      CHECK_EQUAL(5U,  (etl::private_message_router::dispatch_table<handler_t, 5, 1, 3>::Range));
+    }
+#endif
   };
 }
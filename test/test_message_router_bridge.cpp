@@ -0,0 +1,265 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/message_router_bridge.h"
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/message_packet.h"
+#include "etl/queue_spsc_atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2,
+    MESSAGE3
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    BRIDGE  = 2
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+    explicit Message1(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+    explicit Message2(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  // Never crosses the bridge.
+  struct Message3 : public etl::message<MESSAGE3>
+  {
+  };
+
+  typedef etl::message_packet<Message1, Message2> Packet;
+  typedef etl::queue_spsc_atomic<Packet, 4>       Ring;
+  typedef etl::message_router_bridge<Packet>      Bridge;
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2, Message3>
+  {
+  public:
+
+    Router()
+      : message_router(ROUTER1)
+      , message1_count(0)
+      , message2_count(0)
+      , message3_count(0)
+      , last_value(0)
+    {
+    }
+
+    void on_receive(const Message1& msg)
+    {
+      ++message1_count;
+      last_value = msg.value;
+    }
+
+    void on_receive(const Message2& msg)
+    {
+      ++message2_count;
+      last_value = msg.value;
+    }
+
+    void on_receive(const Message3&)
+    {
+      ++message3_count;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int message1_count;
+    int message2_count;
+    int message3_count;
+    int last_value;
+  };
+
+  //***************************************************************************
+  // Stands in for the inter-processor interrupt.
+  struct Interrupt
+  {
+    Interrupt()
+      : count(0)
+    {
+    }
+
+    void raise()
+    {
+      ++count;
+    }
+
+    int count;
+  };
+
+  SUITE(test_message_router_bridge)
+  {
+    //*************************************************************************
+    TEST(test_forward_between_buses)
+    {
+      Ring a_to_b;
+      Ring b_to_a;
+
+      etl::message_bus<2> bus_a;
+      etl::message_bus<2> bus_b;
+
+      Router router_a;
+      Router router_b;
+
+      Interrupt interrupt_b;
+
+      Bridge bridge_a(BRIDGE, a_to_b, b_to_a, bus_a, Bridge::notify_type::create<Interrupt, &Interrupt::raise>(interrupt_b));
+      Bridge bridge_b(BRIDGE, b_to_a, a_to_b, bus_b);
+
+      bus_a.subscribe(router_a);
+      bus_a.subscribe(bridge_a);
+      bus_b.subscribe(router_b);
+      bus_b.subscribe(bridge_b);
+
+      bus_a.receive(Message1(1));
+      bus_a.receive(Message2(2));
+
+      CHECK_EQUAL(1, router_a.message1_count);
+      CHECK_EQUAL(1, router_a.message2_count);
+      CHECK_EQUAL(2U, a_to_b.size());
+      CHECK_EQUAL(2, interrupt_b.count);
+      CHECK_EQUAL(0, router_b.message1_count);
+
+      CHECK_EQUAL(2U, bridge_b.process());
+
+      CHECK_EQUAL(1, router_b.message1_count);
+      CHECK_EQUAL(1, router_b.message2_count);
+      CHECK_EQUAL(2, router_b.last_value);
+      CHECK(a_to_b.empty());
+
+      // Nothing was echoed back.
+      CHECK(b_to_a.empty());
+      CHECK_EQUAL(0U, bridge_a.process());
+      CHECK_EQUAL(1, router_a.message1_count);
+    }
+
+    //*************************************************************************
+    TEST(test_unbridged_messages_stay_local)
+    {
+      Ring a_to_b;
+      Ring b_to_a;
+
+      etl::message_bus<2> bus_a;
+      Router router_a;
+
+      Bridge bridge_a(BRIDGE, a_to_b, b_to_a, bus_a);
+
+      bus_a.subscribe(router_a);
+      bus_a.subscribe(bridge_a);
+
+      bus_a.receive(Message3());
+
+      CHECK_EQUAL(1, router_a.message3_count);
+      CHECK(a_to_b.empty());
+      CHECK(bridge_a.accepts(MESSAGE1));
+      CHECK(bridge_a.accepts(MESSAGE2));
+      CHECK(!bridge_a.accepts(MESSAGE3));
+    }
+
+    //*************************************************************************
+    TEST(test_full_ring_drops_and_counts)
+    {
+      Ring a_to_b;
+      Ring b_to_a;
+
+      Router router_b;
+      Interrupt interrupt_b;
+
+      Bridge bridge_a(BRIDGE, a_to_b, b_to_a, router_b);
+      bridge_a.set_notify(Bridge::notify_type::create<Interrupt, &Interrupt::raise>(interrupt_b));
+
+      for (int i = 0; i < 6; ++i)
+      {
+        bridge_a.receive(Message1(i));
+      }
+
+      CHECK_EQUAL(a_to_b.max_size(), a_to_b.size());
+      CHECK_EQUAL(6U - a_to_b.max_size(), bridge_a.dropped());
+      CHECK_EQUAL(int(a_to_b.max_size()), interrupt_b.count);
+
+      bridge_a.clear_dropped();
+      CHECK_EQUAL(0U, bridge_a.dropped());
+    }
+
+    //*************************************************************************
+    TEST(test_process_one)
+    {
+      Ring a_to_b;
+      Ring b_to_a;
+
+      Router router_a;
+      Router router_b;
+
+      Bridge bridge_a(BRIDGE, a_to_b, b_to_a, router_a);
+      Bridge bridge_b(BRIDGE, b_to_a, a_to_b, router_b);
+
+      bridge_a.receive(Message1(10));
+      bridge_a.receive(Message2(20));
+
+      CHECK(bridge_b.process_one());
+      CHECK_EQUAL(1, router_b.message1_count);
+      CHECK_EQUAL(10, router_b.last_value);
+      CHECK_EQUAL(0, router_b.message2_count);
+
+      CHECK(bridge_b.process_one());
+      CHECK_EQUAL(1, router_b.message2_count);
+      CHECK_EQUAL(20, router_b.last_value);
+
+      CHECK(!bridge_b.process_one());
+    }
+  }
+}
+
+#endif
@@ -392,5 +392,71 @@ namespace
       CHECK_EQUAL(ROUTER1, (*citr).get_message_router_id());
       CHECK_EQUAL(ROUTER1, citr->get_message_router_id());
     }
+
+    //*************************************************************************
+    TEST(test_dense_index_find)
+    {
+      // ROUTER1, ROUTER2 and ROUTER3 are in the dense index. ROUTER4 and ROUTER5 are not.
+      etl::imessage_router* routers[] = { &router1, &router2, &router4, &router5 };
+      etl::message_router_registry<5U, 32U> registry(std::begin(routers), std::end(routers));
+
+      CHECK_EQUAL(32U, registry.dense_index_size());
+
+      CHECK(&router1 == registry.find(ROUTER1));
+      CHECK(&router2 == registry.find(ROUTER2));
+      CHECK(nullptr  == registry.find(ROUTER3));
+      CHECK(&router4 == registry.find(ROUTER4));
+      CHECK(&router5 == registry.find(ROUTER5));
+      CHECK(nullptr  == registry.find(0));
+
+      registry.add(router3);
+      CHECK(&router3 == registry.find(ROUTER3));
+      CHECK(registry.contains(ROUTER3));
+
+      registry.remove(ROUTER1);
+      registry.remove(ROUTER4);
+      CHECK(nullptr  == registry.find(ROUTER1));
+      CHECK(nullptr  == registry.find(ROUTER4));
+      CHECK(!registry.contains(ROUTER1));
+      CHECK_EQUAL(3U, registry.size());
+    }
+
+    //*************************************************************************
+    TEST(test_dense_index_multiple_message_routers_with_same_id)
+    {
+      etl::imessage_router* routers[] = { &router2, &router2b, &router2c };
+      etl::message_router_registry<3U, 32U> registry(std::begin(routers), std::end(routers));
+
+      const etl::imessage_router_registry& cregistry = registry;
+
+      CHECK(&router2 == registry.find(ROUTER2));
+      CHECK(&router2 == cregistry.find(ROUTER2));
+      CHECK_EQUAL(3U, registry.count(ROUTER2));
+
+      registry.remove(ROUTER2);
+      CHECK(nullptr == registry.find(ROUTER2));
+      CHECK(registry.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_dense_index_copy_and_assignment)
+    {
+      etl::imessage_router* routers[] = { &router1, &router2b, &router2, &router4 };
+      etl::message_router_registry<4U, 32U> registry(std::begin(routers), std::end(routers));
+      etl::message_router_registry<4U, 32U> registry2(registry);
+      etl::message_router_registry<4U, 32U> registry3;
+
+      registry3.add(router3);
+      registry3 = registry;
+
+      CHECK(&router1  == registry2.find(ROUTER1));
+      CHECK(&router2b == registry2.find(ROUTER2));
+      CHECK(&router4  == registry2.find(ROUTER4));
+
+      CHECK(&router1  == registry3.find(ROUTER1));
+      CHECK(&router2b == registry3.find(ROUTER2));
+      CHECK(nullptr   == registry3.find(ROUTER3));
+      CHECK(&router4  == registry3.find(ROUTER4));
+    }
   };
 }
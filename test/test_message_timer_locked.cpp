@@ -338,6 +338,61 @@ namespace
       CHECK_EQUAL(0U, locks.lock_count);
     }
 
+    //*************************************************************************
+    TEST(message_timer_tickless)
+    {
+      locks.clear();
+      try_lock_type try_lock = try_lock_type::create<Locks, locks, &Locks::try_lock>();
+      lock_type     lock     = lock_type::create<Locks, locks, &Locks::lock>();
+      unlock_type   unlock   = unlock_type::create<Locks, locks, &Locks::unlock>();
+
+      etl::message_timer_locked<3> timer_controller(try_lock, lock, unlock);
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(message3, router1, 11, etl::timer::mode::Repeating);
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      // Sleep until the next expiry, but wake late each time.
+      const uint32_t overshoot = 2U;
+
+      while (ticks <= 100U)
+      {
+        uint32_t step = timer_controller.time_to_next() + overshoot;
+
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 39ULL, 76ULL };
+      std::vector<uint64_t> compare2 = { 24ULL, 46ULL, 71ULL, 94ULL };
+      std::vector<uint64_t> compare3 = { 13ULL, 24ULL, 35ULL, 46ULL, 57ULL, 68ULL, 79ULL, 90ULL, 101ULL };
+
+      CHECK_ARRAY_EQUAL(compare1.data(), router1.message1.data(), compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), router1.message2.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), router1.message3.data(), compare3.size());
+
+      // Sleep through several periods. Every expiry is processed in the one call.
+      ticks += 110U;
+      timer_controller.tick(110U);
+
+      CHECK_EQUAL(5U,  router1.message1.size());
+      CHECK_EQUAL(9U,  router1.message2.size());
+      CHECK_EQUAL(19U, router1.message3.size());
+      CHECK_EQUAL(9U,  timer_controller.time_to_next());
+
+      CHECK_EQUAL(0U, locks.lock_count);
+    }
+
     //*************************************************************************
     TEST(message_timer_repeating_bigger_step)
     {
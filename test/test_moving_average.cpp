@@ -0,0 +1,133 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <array>
+#include <algorithm>
+
+#include "etl/moving_average.h"
+
+namespace
+{
+  const size_t WINDOW_SIZE = 4UL;
+
+  SUITE(test_moving_average)
+  {
+    //*************************************************************************
+    TEST(integral_average_fills_window)
+    {
+      etl::moving_average<int, WINDOW_SIZE> ma;
+
+      CHECK(ma.empty());
+      CHECK_EQUAL(0, ma.value());
+
+      ma.add(4);
+      CHECK_EQUAL(4, ma.value());
+      CHECK_EQUAL(1U, ma.size());
+
+      ma.add(8);
+      CHECK_EQUAL(6, ma.value());
+
+      ma.add(-3);
+      ma.add(3);
+      CHECK(ma.full());
+      CHECK_EQUAL(12, ma.total());
+      CHECK_EQUAL(3, ma.value());
+    }
+
+    //*************************************************************************
+    TEST(integral_average_slides)
+    {
+      etl::moving_average<uint8_t, WINDOW_SIZE> ma;
+
+      std::array<uint8_t, 10> data = { 200, 200, 200, 200, 100, 100, 100, 100, 0, 40 };
+      std::array<uint8_t, 10> expected = { 200, 200, 200, 200, 175, 150, 125, 100, 75, 60 };
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        ma.add(data[i]);
+        CHECK_EQUAL(int(expected[i]), int(ma.value()));
+      }
+
+      CHECK_EQUAL(WINDOW_SIZE, ma.size());
+    }
+
+    //*************************************************************************
+    TEST(floating_point_average_matches_resum)
+    {
+      etl::moving_average<double, 7U> ma;
+      std::array<double, 100> data;
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = 1.0e6 + (double(i % 13U) * 0.1);
+        ma.add(data[i]);
+
+        const size_t first = (i >= 6U) ? i - 6U : 0U;
+        double sum = 0.0;
+
+        for (size_t j = first; j <= i; ++j)
+        {
+          sum += data[j];
+        }
+
+        CHECK_CLOSE(sum / double((i - first) + 1U), ma.value(), 0.00001);
+      }
+    }
+
+    //*************************************************************************
+    TEST(clear)
+    {
+      etl::moving_average<int, WINDOW_SIZE> ma;
+
+      ma.add(1);
+      ma.add(2);
+      ma.clear();
+
+      CHECK(ma.empty());
+      CHECK_EQUAL(0, ma.value());
+
+      ma.add(5);
+      CHECK_EQUAL(5, ma.value());
+    }
+
+    //*************************************************************************
+    TEST(iterator)
+    {
+      etl::moving_average<int, WINDOW_SIZE> ma;
+
+      std::array<int, 6> data = { 9, 1, 8, 2, 7, 3 };
+
+      std::copy(data.begin(), data.end(), ma.input());
+
+      CHECK_EQUAL(5, ma.value());
+    }
+  };
+}
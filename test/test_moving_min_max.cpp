@@ -0,0 +1,152 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <array>
+#include <algorithm>
+
+#include "etl/moving_min_max.h"
+
+namespace
+{
+  const size_t WINDOW_SIZE = 3UL;
+
+  std::array<int, 12> data = { 5, 3, 4, 8, 1, 1, 7, 6, 2, 9, 9, 0 };
+
+  //*************************************************************************
+  template <typename TCompare>
+  int brute_force(size_t i, size_t window)
+  {
+    const size_t first = (i >= (window - 1U)) ? i - (window - 1U) : 0U;
+    int result = data[first];
+
+    for (size_t j = first + 1U; j <= i; ++j)
+    {
+      if (TCompare()(data[j], result))
+      {
+        result = data[j];
+      }
+    }
+
+    return result;
+  }
+
+  SUITE(test_moving_min_max)
+  {
+    //*************************************************************************
+    TEST(moving_min)
+    {
+      etl::moving_min<int, WINDOW_SIZE> mm;
+
+      CHECK(mm.empty());
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        mm.add(data[i]);
+        CHECK_EQUAL(brute_force<std::less<int> >(i, WINDOW_SIZE), mm.value());
+      }
+
+      CHECK(mm.full());
+      CHECK_EQUAL(WINDOW_SIZE, mm.size());
+    }
+
+    //*************************************************************************
+    TEST(moving_max)
+    {
+      etl::moving_max<int, WINDOW_SIZE> mm;
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        mm.add(data[i]);
+        CHECK_EQUAL(brute_force<std::greater<int> >(i, WINDOW_SIZE), mm.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(window_of_one)
+    {
+      etl::moving_max<int, 1U> mm;
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        mm.add(data[i]);
+        CHECK_EQUAL(data[i], mm.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(monotonic_decreasing_input)
+    {
+      etl::moving_min<int, 5U> mm;
+
+      for (int i = 100; i > 0; --i)
+      {
+        mm.add(i);
+        CHECK_EQUAL(i, mm.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(monotonic_increasing_input)
+    {
+      etl::moving_min<int, 5U> mm;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        mm.add(i);
+        CHECK_EQUAL((i >= 4) ? i - 4 : 0, mm.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(clear)
+    {
+      etl::moving_max<int, WINDOW_SIZE> mm;
+
+      mm.add(10);
+      mm.clear();
+
+      CHECK(mm.empty());
+
+      mm.add(2);
+      CHECK_EQUAL(2, mm.value());
+    }
+
+    //*************************************************************************
+    TEST(iterator)
+    {
+      etl::moving_max<int, WINDOW_SIZE> mm;
+
+      std::copy(data.begin(), data.end(), mm.input());
+
+      CHECK_EQUAL(9, mm.value());
+    }
+  };
+}
@@ -0,0 +1,305 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/msgpack.h"
+
+#include <vector>
+#include <string>
+
+#if ETL_USING_64BIT_TYPES
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //***************************************************************************
+  // Encodes with a function and returns the bytes written.
+  //***************************************************************************
+  template <typename TFunction>
+  Bytes encode(TFunction function)
+  {
+    char storage[200];
+    etl::byte_stream_writer stream(storage, sizeof(storage), etl::endian::big);
+    etl::msgpack_writer writer(stream);
+
+    CHECK(function(writer));
+
+    return Bytes(storage, storage + stream.size_bytes());
+  }
+
+  template <typename T>
+  struct Write
+  {
+    explicit Write(T value_) : value(value_) {}
+
+    bool operator()(etl::msgpack_writer& writer) const
+    {
+      return writer.write(value);
+    }
+
+    T value;
+  };
+
+  template <typename T>
+  Bytes encode_value(T value)
+  {
+    return encode(Write<T>(value));
+  }
+
+  Bytes make_bytes(std::initializer_list<uint8_t> values)
+  {
+    return Bytes(values);
+  }
+
+  SUITE(test_msgpack)
+  {
+    //*************************************************************************
+    TEST(test_write_integers)
+    {
+      CHECK(make_bytes({ 0x00 })                                           == encode_value(0));
+      CHECK(make_bytes({ 0x7F })                                           == encode_value(127));
+      CHECK(make_bytes({ 0xCC, 0x80 })                                     == encode_value(128));
+      CHECK(make_bytes({ 0xCD, 0x01, 0x00 })                               == encode_value(256U));
+      CHECK(make_bytes({ 0xCE, 0x00, 0x01, 0x00, 0x00 })                   == encode_value(65536UL));
+      CHECK(make_bytes({ 0xCF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00 }) == encode_value(uint64_t(0x100000000ULL)));
+      CHECK(make_bytes({ 0xFF })                                           == encode_value(-1));
+      CHECK(make_bytes({ 0xE0 })                                           == encode_value(int8_t(-32)));
+      CHECK(make_bytes({ 0xD0, 0xDF })                                     == encode_value(-33));
+      CHECK(make_bytes({ 0xD1, 0xFF, 0x7F })                               == encode_value(int16_t(-129)));
+      CHECK(make_bytes({ 0xD2, 0xFF, 0xFF, 0x7F, 0xFF })                   == encode_value(-32769L));
+      CHECK(make_bytes({ 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF }) == encode_value(int64_t(-2147483649LL)));
+    }
+
+    //*************************************************************************
+    TEST(test_write_other_types)
+    {
+      CHECK(make_bytes({ 0xC3 })                               == encode_value(true));
+      CHECK(make_bytes({ 0xC2 })                               == encode_value(false));
+      CHECK(make_bytes({ 0xCA, 0x3F, 0xC0, 0x00, 0x00 })       == encode_value(1.5f));
+      CHECK(make_bytes({ 0xCB, 0x3F, 0xF8, 0, 0, 0, 0, 0, 0 }) == encode_value(1.5));
+      CHECK(make_bytes({ 0xA3, 'a', 'b', 'c' })                == encode_value("abc"));
+
+      const std::string long_string(40U, 'x');
+      Bytes expected = make_bytes({ 0xD9, 40U });
+      expected.insert(expected.end(), long_string.begin(), long_string.end());
+      CHECK(expected == encode_value(etl::string_view(long_string.data(), long_string.size())));
+
+      struct Nil
+      {
+        bool operator()(etl::msgpack_writer& writer) const { return writer.write_nil(); }
+      };
+
+      CHECK(make_bytes({ 0xC0 }) == encode(Nil()));
+    }
+
+    //*************************************************************************
+    TEST(test_write_containers)
+    {
+      struct Telemetry
+      {
+        bool operator()(etl::msgpack_writer& writer) const
+        {
+          const uint8_t raw[] = { 1, 2 };
+
+          return writer.write_map(2U) &&
+                 writer.write("id")   && writer.write(7) &&
+                 writer.write("raw")  && writer.write_binary(etl::span<const uint8_t>(raw)) &&
+                 writer.write_array(20U) &&
+                 writer.write_extension(-1, etl::span<const uint8_t>(raw));
+        }
+      };
+
+      CHECK(make_bytes({ 0x82, 0xA2, 'i', 'd', 0x07, 0xA3, 'r', 'a', 'w', 0xC4, 0x02, 0x01, 0x02, 0xDC, 0x00, 0x14, 0xD5, 0xFF, 0x01, 0x02 }) == encode(Telemetry()));
+    }
+
+    //*************************************************************************
+    TEST(test_no_room_writes_nothing)
+    {
+      char storage[4];
+      etl::byte_stream_writer stream(storage, sizeof(storage), etl::endian::big);
+      etl::msgpack_writer writer(stream);
+
+      CHECK(writer.write(int16_t(-1000)));
+      CHECK_EQUAL(3U, stream.size_bytes());
+
+      CHECK(!writer.write(1000));
+      CHECK(!writer.write("ab"));
+      CHECK_EQUAL(3U, stream.size_bytes());
+
+      CHECK(writer.write(true));
+      CHECK_EQUAL(4U, stream.size_bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip)
+    {
+      char storage[256];
+      etl::byte_stream_writer out(storage, sizeof(storage), etl::endian::big);
+      etl::msgpack_writer writer(out);
+
+      const uint8_t blob[] = { 0xDE, 0xAD, 0xBE, 0xEF };
+
+      CHECK(writer.write_map(3U));
+      CHECK(writer.write("temperature"));
+      CHECK(writer.write(21.5f));
+      CHECK(writer.write("samples"));
+      CHECK(writer.write_array(4U));
+      CHECK(writer.write(-100000));
+      CHECK(writer.write(uint64_t(0xFFFFFFFFFFFFFFFFULL)));
+      CHECK(writer.write(2.25));
+      CHECK(writer.write_nil());
+      CHECK(writer.write("blob"));
+      CHECK(writer.write_extension(5, etl::span<const uint8_t>(blob)));
+
+      etl::byte_stream_reader in(storage, out.size_bytes(), etl::endian::big);
+      etl::msgpack_reader reader(in);
+      etl::msgpack_item item;
+
+      CHECK(reader.read(item));
+      CHECK(item.type() == etl::msgpack_type::Map);
+      CHECK_EQUAL(3U, item.size());
+
+      CHECK(reader.read(item));
+      CHECK(item.type() == etl::msgpack_type::String);
+      CHECK(item.as_string() == etl::string_view("temperature"));
+      // A view of the stream, not a copy.
+      CHECK(item.as_string().data() == storage + 2);
+
+      CHECK(reader.read(item));
+      CHECK(item.type() == etl::msgpack_type::Float32);
+      CHECK_EQUAL(21.5f, item.as_float());
+      CHECK_EQUAL(21.5, item.as_double());
+
+      CHECK(reader.read(item));
+      CHECK(item.as_string() == etl::string_view("samples"));
+
+      CHECK(reader.read(item));
+      CHECK(item.type() == etl::msgpack_type::Array);
+      CHECK_EQUAL(4U, item.size());
+
+      CHECK(reader.read(item));
+      CHECK(item.type() == etl::msgpack_type::Signed_Integer);
+      CHECK(item.is_integer());
+      CHECK_EQUAL(-100000, item.as_int());
+
+      CHECK(reader.read(item));
+      CHECK(item.type() == etl::msgpack_type::Unsigned_Integer);
+      CHECK(item.as_uint() == 0xFFFFFFFFFFFFFFFFULL);
+
+      CHECK(reader.read(item));
+      CHECK(item.type() == etl::msgpack_type::Float64);
+      CHECK_EQUAL(2.25, item.as_double());
+
+      CHECK(reader.read(item));
+      CHECK(item.is_nil());
+
+      CHECK(reader.read(item));
+      CHECK(item.as_string() == etl::string_view("blob"));
+
+      CHECK(reader.read(item));
+      CHECK(item.type() == etl::msgpack_type::Extension);
+      CHECK_EQUAL(5, item.extension_type());
+      CHECK_EQUAL(4U, item.as_binary().size());
+      CHECK_EQUAL(0xEF, item.as_binary()[3]);
+
+      CHECK(reader.empty());
+      CHECK(!reader.read(item));
+    }
+
+    //*************************************************************************
+    TEST(test_skip)
+    {
+      // { "a": [1, [2, 3], { "b": nil }], "c": true }
+      const uint8_t data[] = { 0x82, 0xA1, 'a', 0x93, 0x01, 0x92, 0x02, 0x03, 0x81, 0xA1, 'b', 0xC0, 0xA1, 'c', 0xC3 };
+
+      etl::byte_stream_reader in(data, sizeof(data), etl::endian::big);
+      etl::msgpack_reader reader(in);
+      etl::msgpack_item item;
+
+      CHECK(reader.read(item)); // The map.
+      CHECK(reader.read(item)); // "a"
+      CHECK(reader.skip());     // The array.
+
+      CHECK(reader.read(item));
+      CHECK(item.as_string() == etl::string_view("c"));
+
+      CHECK(reader.read(item));
+      CHECK(item.type() == etl::msgpack_type::Boolean);
+      CHECK(item.as_bool());
+
+      CHECK(reader.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_truncated_and_invalid)
+    {
+      etl::msgpack_item item;
+
+      // A truncated string.
+      const uint8_t truncated_string[] = { 0xA5, 'a', 'b' };
+      etl::byte_stream_reader in1(truncated_string, sizeof(truncated_string), etl::endian::big);
+      etl::msgpack_reader reader1(in1);
+      CHECK(!reader1.read(item));
+      CHECK_EQUAL(0U, in1.used_data().size());
+
+      // A truncated integer.
+      const uint8_t truncated_integer[] = { 0xCE, 0x01, 0x02 };
+      etl::byte_stream_reader in2(truncated_integer, sizeof(truncated_integer), etl::endian::big);
+      etl::msgpack_reader reader2(in2);
+      CHECK(!reader2.read(item));
+      CHECK_EQUAL(0U, in2.used_data().size());
+
+      // The unused tag.
+      const uint8_t invalid[] = { 0xC1 };
+      etl::byte_stream_reader in3(invalid, sizeof(invalid), etl::endian::big);
+      etl::msgpack_reader reader3(in3);
+      CHECK(!reader3.read(item));
+
+      // An incomplete array is not skipped.
+      const uint8_t incomplete[] = { 0x93, 0x01, 0x02 };
+      etl::byte_stream_reader in4(incomplete, sizeof(incomplete), etl::endian::big);
+      etl::msgpack_reader reader4(in4);
+      CHECK(!reader4.skip());
+      CHECK_EQUAL(0U, in4.used_data().size());
+    }
+
+    //*************************************************************************
+    TEST(test_little_endian_stream)
+    {
+      char storage[8];
+      etl::byte_stream_writer stream(storage, sizeof(storage), etl::endian::little);
+
+      CHECK_THROW(etl::msgpack_writer writer(stream), etl::msgpack_endianness);
+    }
+  }
+}
+
+#endif
@@ -34,6 +34,7 @@ SOFTWARE.
 #include <array>
 #include <algorithm>
 #include <iterator>
+#include <numeric>
 
 #include "etl/integral_limits.h"
 
@@ -488,5 +489,316 @@ namespace
       CHECK(data     >= data);
       CHECK(!(lesser >= data));
     }
+    //*************************************************************************
+    TEST(test_row_major_layout)
+    {
+      typedef etl::multi_array_layout<int, etl::row_major_index<3, 4, 5>> Layout;
+
+      CHECK_EQUAL(3U,  Layout::Rank);
+      CHECK_EQUAL(60U, Layout::Size);
+      CHECK_EQUAL(60U, Layout::size());
+
+      Layout layout;
+
+      for (size_t i = 0U; i < 3U; ++i)
+      {
+        for (size_t j = 0U; j < 4U; ++j)
+        {
+          for (size_t k = 0U; k < 5U; ++k)
+          {
+            layout(i, j, k) = int((i * 100U) + (j * 10U) + k);
+          }
+        }
+      }
+
+      // The same order as the nested arrays.
+      CHECK_EQUAL(0,   layout.data()[0]);
+      CHECK_EQUAL(1,   layout.data()[1]);
+      CHECK_EQUAL(10,  layout.data()[5]);
+      CHECK_EQUAL(100, layout.data()[20]);
+      CHECK_EQUAL(234, layout.data()[59]);
+
+      const Layout& clayout = layout;
+      CHECK_EQUAL(123, clayout(1, 2, 3));
+    }
+
+    //*************************************************************************
+    TEST(test_z_order_layout_square)
+    {
+      typedef etl::z_order_index<8, 8> Index;
+      typedef etl::multi_array_layout<int, Index> Layout;
+
+      CHECK_EQUAL(2U,  Layout::Rank);
+      CHECK_EQUAL(64U, Layout::Size);
+
+      Layout layout;
+      layout.fill(-1);
+
+      for (size_t x = 0U; x < 8U; ++x)
+      {
+        for (size_t y = 0U; y < 8U; ++y)
+        {
+          CHECK_EQUAL(size_t(etl::morton_encode2(uint32_t(x), uint32_t(y))), Index::index(x, y));
+          layout(x, y) = int((x * 8U) + y);
+        }
+      }
+
+      // Each 2 x 2 block is contiguous.
+      CHECK_EQUAL(0,  layout.data()[0]);
+      CHECK_EQUAL(8,  layout.data()[1]);
+      CHECK_EQUAL(1,  layout.data()[2]);
+      CHECK_EQUAL(9,  layout.data()[3]);
+      CHECK_EQUAL(16, layout.data()[4]);
+
+      CHECK(std::find(layout.begin(), layout.end(), -1) == layout.end());
+    }
+
+    //*************************************************************************
+    TEST(test_z_order_layout_rectangular)
+    {
+      // 3 x 10 is padded to 4 x 16.
+      typedef etl::z_order_index<3, 10> Index;
+      typedef etl::multi_array_layout<int, Index> Layout;
+
+      CHECK_EQUAL(64U, Layout::Size);
+
+      Layout layout;
+      layout.fill(-1);
+
+      bool used[64] = {};
+
+      for (size_t x = 0U; x < 3U; ++x)
+      {
+        for (size_t y = 0U; y < 10U; ++y)
+        {
+          const size_t index = Index::index(x, y);
+
+          CHECK(index < 64U);
+          CHECK(!used[index]);
+          used[index] = true;
+
+          layout(x, y) = int((x * 10U) + y);
+        }
+      }
+
+      // The two bits of x interleave with the low bits of y, then the high bits of y follow.
+      CHECK_EQUAL(size_t(0x0FU), Index::index(3U, 3U));
+      CHECK_EQUAL(size_t(0x10U), Index::index(0U, 4U));
+      CHECK_EQUAL(size_t(0x20U), Index::index(0U, 8U));
+
+      CHECK_EQUAL(29, layout(2, 9));
+    }
+
+    //*************************************************************************
+    TEST(test_z_order_layout_3d)
+    {
+      typedef etl::z_order_index<4, 4, 4> Cube;
+      typedef etl::z_order_index<2, 4, 8> Box;
+
+      CHECK_EQUAL(64U, Cube::Size);
+      CHECK_EQUAL(64U, Box::Size);
+
+      bool used[64] = {};
+
+      for (size_t x = 0U; x < 4U; ++x)
+      {
+        for (size_t y = 0U; y < 4U; ++y)
+        {
+          for (size_t z = 0U; z < 4U; ++z)
+          {
+            CHECK_EQUAL(size_t(etl::morton_encode3(uint32_t(x), uint32_t(y), uint32_t(z))), Cube::index(x, y, z));
+          }
+        }
+      }
+
+      for (size_t x = 0U; x < 2U; ++x)
+      {
+        for (size_t y = 0U; y < 4U; ++y)
+        {
+          for (size_t z = 0U; z < 8U; ++z)
+          {
+            const size_t index = Box::index(x, y, z);
+
+            CHECK(index < 64U);
+            CHECK(!used[index]);
+            used[index] = true;
+          }
+        }
+      }
+
+      CHECK_EQUAL(size_t(0x07U), Box::index(1U, 1U, 1U));
+      CHECK_EQUAL(size_t(0x08U), Box::index(0U, 2U, 0U));
+      CHECK_EQUAL(size_t(0x10U), Box::index(0U, 0U, 2U));
+      CHECK_EQUAL(size_t(0x20U), Box::index(0U, 0U, 4U));
+
+      etl::multi_array_layout<double, Box> grid;
+      grid.fill(0.5);
+      grid(1, 3, 7) = 2.0;
+
+      CHECK_EQUAL(2.0, grid.data()[63]);
+    }
+
+    //*************************************************************************
+    TEST(test_row_of)
+    {
+      etl::multi_array<int, 3, 4> grid = {{ { 0, 1, 2, 3 }, { 4, 5, 6, 7 }, { 8, 9, 10, 11 } }};
+
+      etl::span<int, 4> row = etl::row_of(grid, 1U);
+
+      CHECK_EQUAL(4U, row.size());
+      CHECK_EQUAL(4, row[0]);
+      CHECK_EQUAL(7, row[3]);
+
+      row[2] = 60;
+      CHECK_EQUAL(60, grid[1][2]);
+
+      const etl::multi_array<int, 3, 4>& cgrid = grid;
+      etl::span<const int, 4> crow = etl::row_of(cgrid, 2U);
+      CHECK_EQUAL(8, crow.front());
+      CHECK_EQUAL(11, crow.back());
+    }
+
+    //*************************************************************************
+    TEST(test_column_of)
+    {
+      etl::multi_array<int, 3, 4> grid = {{ { 0, 1, 2, 3 }, { 4, 5, 6, 7 }, { 8, 9, 10, 11 } }};
+
+      etl::multi_array_column<int, 3, 4> column = etl::column_of(grid, 2U);
+
+      CHECK_EQUAL(3U, column.size());
+      CHECK_EQUAL(2, column.front());
+      CHECK_EQUAL(10, column.back());
+      CHECK_EQUAL(6, column[1]);
+
+      int expected[] = { 2, 6, 10 };
+      CHECK_ARRAY_EQUAL(expected, column.begin(), 3);
+      CHECK_EQUAL(3, column.end() - column.begin());
+      CHECK_EQUAL(10, column.begin()[2]);
+      CHECK(column.begin() < column.end());
+
+      std::fill(column.begin(), column.end(), -1);
+      CHECK_EQUAL(-1, grid[0][2]);
+      CHECK_EQUAL(-1, grid[2][2]);
+      CHECK_EQUAL(3, grid[0][3]);
+
+      const etl::multi_array<int, 3, 4>& cgrid = grid;
+      etl::multi_array_column<const int, 3, 4> ccolumn = etl::column_of(cgrid, 0U);
+      CHECK_EQUAL(12, std::accumulate(ccolumn.begin(), ccolumn.end(), 0));
+
+      std::reverse(column.begin(), column.end());
+      std::sort(column.begin(), column.end());
+      CHECK_EQUAL(-1, grid[1][2]);
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_tile)
+    {
+      etl::multi_array<int, 5, 7> grid;
+
+      for (size_t r = 0U; r < 5U; ++r)
+      {
+        for (size_t c = 0U; c < 7U; ++c)
+        {
+          grid[r][c] = int(r * 7U + c);
+        }
+      }
+
+      struct Visitor
+      {
+        void operator ()(int& value, size_t row, size_t col)
+        {
+          CHECK_EQUAL(int(row * 7U + col), value);
+          order[count++] = value;
+        }
+
+        int    order[35];
+        size_t count;
+      };
+
+      Visitor visitor = Visitor();
+      visitor = etl::for_each_tile<2U, 3U>(grid, visitor);
+
+      CHECK_EQUAL(35U, visitor.count);
+
+      // First 2 x 3 tile, then the next tile along the same rows.
+      int expected_start[] = { 0, 1, 2, 7, 8, 9, 3, 4, 5, 10, 11, 12, 6, 13, 14 };
+      CHECK_ARRAY_EQUAL(expected_start, visitor.order, 15);
+
+      // The last row is a partial tile.
+      int expected_end[] = { 28, 29, 30, 31, 32, 33, 34 };
+      CHECK_ARRAY_EQUAL(expected_end, visitor.order + 28, 7);
+
+      const etl::multi_array<int, 5, 7>& cgrid = grid;
+      int sum = 0;
+      etl::for_each_tile<4U>(cgrid, [&sum](const int& value, size_t, size_t) { sum += value; });
+      CHECK_EQUAL(595, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_transpose_out_of_place)
+    {
+      etl::multi_array<int, 11, 5> source;
+      etl::multi_array<int, 5, 11> destination;
+
+      for (size_t r = 0U; r < 11U; ++r)
+      {
+        for (size_t c = 0U; c < 5U; ++c)
+        {
+          source[r][c] = int(r * 100U + c);
+        }
+      }
+
+      etl::transpose(source, destination);
+
+      for (size_t r = 0U; r < 11U; ++r)
+      {
+        for (size_t c = 0U; c < 5U; ++c)
+        {
+          CHECK_EQUAL(source[r][c], destination[c][r]);
+        }
+      }
+
+      destination[0][0] = -1;
+      etl::transpose<3U>(source, destination);
+      CHECK_EQUAL(0, destination[0][0]);
+      CHECK_EQUAL(1004, destination[4][10]);
+    }
+
+    //*************************************************************************
+    TEST(test_transpose_in_place)
+    {
+      etl::multi_array<int, 10, 10> grid;
+
+      for (size_t r = 0U; r < 10U; ++r)
+      {
+        for (size_t c = 0U; c < 10U; ++c)
+        {
+          grid[r][c] = int(r * 10U + c);
+        }
+      }
+
+      // Tile sizes that divide, do not divide, and exceed the edge.
+      etl::transpose<3U>(grid);
+
+      for (size_t r = 0U; r < 10U; ++r)
+      {
+        for (size_t c = 0U; c < 10U; ++c)
+        {
+          CHECK_EQUAL(int(c * 10U + r), grid[r][c]);
+        }
+      }
+
+      etl::transpose<5U>(grid);
+      etl::transpose<16U>(grid);
+      etl::transpose(grid);
+
+      for (size_t r = 0U; r < 10U; ++r)
+      {
+        for (size_t c = 0U; c < 10U; ++c)
+        {
+          CHECK_EQUAL(int(r * 10U + c), grid[r][c]);
+        }
+      }
+    }
   };
 }
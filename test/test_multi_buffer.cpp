@@ -0,0 +1,261 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/multi_buffer.h"
+
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::double_buffer<int, 4>   Double;
+  typedef etl::multi_buffer<int, 3, 3> Triple;
+
+  //***************************************************************************
+  // Simulates the DMA writing a block.
+  //***************************************************************************
+  template <typename TBuffer>
+  void fill(TBuffer& buffer, size_t index, int value)
+  {
+    etl::span<int> block = buffer.block(index);
+
+    for (size_t i = 0U; i < block.size(); ++i)
+    {
+      block[i] = value;
+    }
+  }
+
+  std::vector<int> ready_values;
+  int              overrun_calls = 0;
+
+  void on_ready(etl::span<int> block)
+  {
+    ready_values.push_back(block[0]);
+  }
+
+  void on_overrun()
+  {
+    ++overrun_calls;
+  }
+
+  SUITE(test_multi_buffer)
+  {
+    //*************************************************************************
+    TEST(test_layout)
+    {
+      Double buffer;
+
+      CHECK_EQUAL(8U, buffer.size());
+      CHECK_EQUAL(8U * sizeof(int), buffer.size_bytes());
+      CHECK(buffer.block(0U).data() == buffer.data());
+      CHECK(buffer.block(1U).data() == buffer.data() + 4);
+      CHECK_EQUAL(4U, Double::Block_Size);
+      CHECK_EQUAL(2U, Double::Block_Count);
+
+      CHECK(buffer.acquire().empty());
+      CHECK_EQUAL(0U, buffer.ready_count());
+    }
+
+    //*************************************************************************
+    TEST(test_ping_pong)
+    {
+      Double buffer;
+
+      ready_values.clear();
+      buffer.set_ready_callback(Double::ready_callback_type::create<on_ready>());
+
+      for (int i = 0; i < 10; ++i)
+      {
+        const size_t half = size_t(i) % 2U;
+
+        fill(buffer, half, i);
+        (half == 0U) ? buffer.half_complete() : buffer.full_complete();
+
+        etl::span<int> block = buffer.acquire();
+
+        CHECK_EQUAL(4U, block.size());
+        CHECK(block.data() == buffer.block(half).data());
+        CHECK_EQUAL(i, block[3]);
+        CHECK(buffer.release());
+      }
+
+      CHECK_EQUAL(10U, ready_values.size());
+      CHECK_EQUAL(9, ready_values.back());
+      CHECK_EQUAL(0U, buffer.overrun_count());
+    }
+
+    //*************************************************************************
+    TEST(test_consumer_behind_within_capacity)
+    {
+      Triple buffer;
+
+      fill(buffer, 0U, 10);
+      buffer.block_complete();
+      fill(buffer, 1U, 11);
+      buffer.block_complete();
+
+      // Two ready, the producer is filling the third.
+      CHECK_EQUAL(2U, buffer.ready_count());
+      CHECK_EQUAL(0U, buffer.overrun_count());
+
+      CHECK_EQUAL(10, buffer.acquire()[0]);
+      CHECK(buffer.release());
+      CHECK_EQUAL(11, buffer.acquire()[0]);
+      CHECK(buffer.release());
+      CHECK(buffer.acquire().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_overrun_skips_overwritten_blocks)
+    {
+      Double buffer;
+
+      overrun_calls = 0;
+      buffer.set_overrun_callback(Double::overrun_callback_type::create<on_overrun>());
+
+      fill(buffer, 0U, 0);
+      buffer.half_complete();
+
+      // The consumer does not keep up.
+      fill(buffer, 1U, 1);
+      buffer.full_complete();
+      CHECK_EQUAL(1U, buffer.overrun_count());
+
+      fill(buffer, 0U, 2);
+      buffer.half_complete();
+      CHECK_EQUAL(2U, buffer.overrun_count());
+      CHECK_EQUAL(2, overrun_calls);
+
+      // The producer is filling block 1, so block 0 is the only intact one.
+      etl::span<int> block = buffer.acquire();
+      CHECK(block.data() == buffer.block(0U).data());
+      CHECK_EQUAL(2, block[0]);
+      CHECK(buffer.release());
+      CHECK(buffer.acquire().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_overwritten_while_held)
+    {
+      Double buffer;
+
+      buffer.half_complete();
+
+      etl::span<int> block = buffer.acquire();
+      CHECK(!block.empty());
+
+      buffer.full_complete();
+
+      // The producer has started on the block that is still held.
+      CHECK(!buffer.release());
+      CHECK_EQUAL(1U, buffer.overrun_count());
+    }
+
+    //*************************************************************************
+    TEST(test_missed_interrupt_resynchronises)
+    {
+      Triple buffer;
+
+      ready_values.clear();
+      buffer.set_ready_callback(Triple::ready_callback_type::create<on_ready>());
+
+      fill(buffer, 0U, 0);
+      fill(buffer, 1U, 1);
+
+      // The interrupt for block 0 was missed.
+      buffer.block_complete(1U);
+
+      CHECK_EQUAL(2U, buffer.ready_count());
+      CHECK_EQUAL(1, ready_values.back());
+      CHECK_EQUAL(0, buffer.acquire()[0]);
+      CHECK(buffer.release());
+      CHECK_EQUAL(1, buffer.acquire()[0]);
+      CHECK(buffer.release());
+
+      buffer.reset();
+      CHECK_EQUAL(0U, buffer.ready_count());
+      CHECK(buffer.acquire().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_producer)
+    {
+      typedef etl::multi_buffer<int, 16, 4> Buffer;
+
+      Buffer buffer;
+
+      const int Blocks = 20000;
+
+      std::thread producer([&]()
+      {
+        for (int i = 0; i < Blocks; ++i)
+        {
+          // Wait for room, as a well behaved stream would.
+          while (buffer.ready_count() >= (Buffer::Block_Count - 1U))
+          {
+            std::this_thread::yield();
+          }
+
+          fill(buffer, size_t(i) % Buffer::Block_Count, i);
+          buffer.block_complete();
+        }
+      });
+
+      int  expected = 0;
+      bool in_order = true;
+
+      while (expected < Blocks)
+      {
+        etl::span<int> block = buffer.acquire();
+
+        if (block.empty())
+        {
+          std::this_thread::yield();
+        }
+        else
+        {
+          in_order = in_order && (block[0] == expected) && (block[15] == expected);
+          in_order = buffer.release() && in_order;
+          ++expected;
+        }
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK_EQUAL(0U, buffer.overrun_count());
+    }
+  }
+}
+
+#endif
@@ -34,6 +34,8 @@ SOFTWARE.
 #include <iterator>
 #include <vector>
 #include <array>
+#include <algorithm>
+#include <string.h>
 
 namespace
 {
@@ -108,6 +110,26 @@ namespace
       CHECK_EQUAL(0U, ms_int.size());
     }
 
+    //*************************************************************************
+    TEST(test_size_follows_the_span_list)
+    {
+      std::vector<etl::span<const int>> span_list =
+      {
+        etl::span<const int>(data1),
+        etl::span<const int>()
+      };
+
+      etl::multi_span<const int> ms_int(span_list);
+
+      CHECK_EQUAL(4U, ms_int.size());
+
+      span_list[1] = etl::span<const int>(data2);
+
+      CHECK_EQUAL(7U, ms_int.size());
+      CHECK_EQUAL(7U * sizeof(int), ms_int.size_bytes());
+      CHECK_FALSE(ms_int.empty());
+    }
+
     //*************************************************************************
     TEST(test_iterator_copy_from_multi_span)
     {
@@ -205,5 +227,165 @@ namespace
       ++itr;
       CHECK(ETL_NULLPTR == itr.operator->());
     }
+
+    //*************************************************************************
+    TEST(test_iterator_equality_within_a_span)
+    {
+      std::vector<etl::span<const int>> span_list =
+      {
+        etl::span<const int>(data1),
+        etl::span<const int>(data2)
+      };
+
+      etl::multi_span<const int> ms_int(span_list);
+
+      etl::multi_span<const int>::iterator itr1 = ms_int.begin();
+      etl::multi_span<const int>::iterator itr2 = ms_int.begin();
+      ++itr2;
+
+      CHECK(itr1 != itr2);
+      ++itr1;
+      CHECK(itr1 == itr2);
+      CHECK_EQUAL(7, std::distance(ms_int.begin(), ms_int.end()));
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_segment)
+    {
+      std::vector<etl::span<const int>> span_list =
+      {
+        etl::span<const int>(data1),
+        etl::span<const int>(),      // Empty span.
+        etl::span<const int>(data2),
+        etl::span<const int>(data3)
+      };
+
+      etl::multi_span<const int> ms_int(span_list);
+
+      std::vector<size_t> sizes;
+
+      struct record_size
+      {
+        void operator()(etl::span<const int> segment)
+        {
+          p_sizes->push_back(segment.size());
+        }
+
+        std::vector<size_t>* p_sizes;
+      };
+
+      record_size function = { &sizes };
+      ms_int.for_each_segment(function);
+
+      std::vector<size_t> expected = { 4U, 3U, 1U };
+      CHECK(expected == sizes);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_to_bytes)
+    {
+      std::vector<etl::span<const int>> span_list =
+      {
+        etl::span<const int>(data1),
+        etl::span<const int>(),      // Empty span.
+        etl::span<const int>(data2),
+        etl::span<const int>(data3),
+        etl::span<const int>(data4)
+      };
+
+      etl::multi_span<const int> ms_int(span_list);
+
+      int  result[10] = {};
+      char bytes[sizeof(result)];
+
+      CHECK_EQUAL(sizeof(bytes), ms_int.copy_to(etl::span<char>(bytes)));
+
+      memcpy(result, bytes, sizeof(result));
+      CHECK(std::equal(ms_int.begin(), ms_int.end(), result));
+
+      // A destination that is too small.
+      unsigned char small[6 * sizeof(int)];
+      CHECK_EQUAL(sizeof(small), ms_int.copy_to(etl::span<unsigned char>(small)));
+      CHECK(memcmp(small, bytes, sizeof(small)) == 0);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_from_bytes)
+    {
+      std::fill(std::begin(data5), std::end(data5), 0);
+      std::fill(std::begin(data6), std::end(data6), 0);
+      std::fill(std::begin(data7), std::end(data7), 0);
+      std::fill(std::begin(data8), std::end(data8), 0);
+
+      std::vector<etl::span<int>> span_list =
+      {
+        etl::span<int>(data5),
+        etl::span<int>(data6),
+        etl::span<int>(),      // Empty span.
+        etl::span<int>(data7),
+        etl::span<int>(data8)
+      };
+
+      etl::multi_span<int> ms_int(span_list);
+
+      const int source[] = { 10, 11, 12, 13, 14, 15, 16, 17 };
+      const char* p_source = reinterpret_cast<const char*>(source);
+
+      CHECK_EQUAL(sizeof(source), ms_int.copy_from(etl::span<const char>(p_source, sizeof(source))));
+
+      std::vector<int> expected = { 10, 11, 12, 13, 14, 15, 16, 17, 0, 0 };
+      CHECK(std::equal(expected.begin(), expected.end(), ms_int.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_write_to_byte_stream)
+    {
+      const char header[]  = { 'H', 'D' };
+      const char payload[] = { '1', '2', '3' };
+      const char trailer[] = { 'T' };
+
+      std::vector<etl::span<const char>> span_list =
+      {
+        etl::span<const char>(header),
+        etl::span<const char>(payload),
+        etl::span<const char>(trailer)
+      };
+
+      etl::multi_span<const char> ms_char(span_list);
+
+      char buffer[8];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+
+      CHECK(ms_char.write_to(writer));
+      CHECK_EQUAL(6U, writer.size_bytes());
+      CHECK(memcmp("HD123T", buffer, 6U) == 0);
+
+      // Not enough room for a second copy.
+      CHECK(!ms_char.write_to(writer));
+      CHECK_EQUAL(6U, writer.size_bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_write_to_byte_stream_with_endianness)
+    {
+      const uint16_t values1[] = { 0x0102U, 0x0304U };
+      const uint16_t values2[] = { 0x0506U };
+
+      std::vector<etl::span<const uint16_t>> span_list =
+      {
+        etl::span<const uint16_t>(values1),
+        etl::span<const uint16_t>(values2)
+      };
+
+      etl::multi_span<const uint16_t> ms_u16(span_list);
+
+      char buffer[6];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+
+      CHECK(ms_u16.write_to(writer));
+
+      const char expected[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+      CHECK(memcmp(expected, buffer, sizeof(expected)) == 0);
+    }
   };
 }
@@ -39,6 +39,9 @@ SOFTWARE.
 #include <deque>
 #include <list>
 #include <array>
+#include <functional>
+#include <cmath>
+#include <cstdint>
 
 namespace
 {		
@@ -57,6 +60,161 @@ namespace
       CHECK(are_same);
     }
 
+    //*************************************************************************
+    TEST(test_reduce)
+    {
+      int data[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+      CHECK_EQUAL(55,      etl::reduce(std::begin(data), std::end(data), 0));
+      CHECK_EQUAL(65,      etl::reduce(std::begin(data), std::end(data), 10));
+      CHECK_EQUAL(3628800, etl::reduce(std::begin(data), std::end(data), 1, std::multiplies<int>()));
+      CHECK_EQUAL(10,      etl::reduce(std::begin(data), std::begin(data), 10));
+    }
+
+    //*************************************************************************
+    TEST(test_reduce_unrolled)
+    {
+      // Lengths either side of the unrolled blocks.
+      for (int length = 0; length < 11; ++length)
+      {
+        std::vector<int> data(length);
+        std::iota(data.begin(), data.end(), 1);
+
+        const int* first = data.data();
+        const int* last  = data.data() + data.size();
+
+        CHECK_EQUAL(std::accumulate(first, last, 5), etl::reduce(first, last, 5));
+        CHECK_EQUAL(std::accumulate(first, last, 5LL), etl::reduce(first, last, 5LL));
+
+        std::list<int> list(data.begin(), data.end());
+        CHECK_EQUAL(std::accumulate(first, last, 5), etl::reduce(list.begin(), list.end(), 5));
+      }
+
+      // Wider accumulator than the elements.
+      std::vector<uint8_t> bytes(1000, 255U);
+      CHECK_EQUAL(255000U, etl::reduce(bytes.data(), bytes.data() + bytes.size(), 0U));
+
+      std::vector<double> doubles(9, 0.5);
+      CHECK_CLOSE(5.5, etl::reduce(doubles.data(), doubles.data() + doubles.size(), 1.0), 1e-12);
+    }
+
+    //*************************************************************************
+    TEST(test_reduce_compensated)
+    {
+      // A large value followed by many that are each lost to rounding.
+      std::vector<float> data(10001, 1.0e-4F);
+      data[0] = 1.0e4F;
+
+      const float plain       = std::accumulate(data.begin(), data.end(), 0.0F);
+      const float compensated = etl::reduce_compensated(data.begin(), data.end(), 0.0F);
+
+      CHECK_CLOSE(10001.0F, compensated, 0.001F);
+      CHECK(std::fabs(plain - 10001.0F) > 0.5F);
+
+      // Cancellation.
+      const double values[] = { 1.0, 1.0e100, 1.0, -1.0e100 };
+      CHECK_EQUAL(2.0, etl::reduce_compensated(std::begin(values), std::end(values), 0.0));
+
+      CHECK_EQUAL(3.0, etl::reduce_compensated(std::begin(values), std::begin(values), 3.0));
+    }
+
+    //*************************************************************************
+    TEST(test_transform_reduce)
+    {
+      for (int length = 0; length < 11; ++length)
+      {
+        std::vector<int> a(length);
+        std::vector<int> b(length);
+        std::iota(a.begin(), a.end(), 1);
+        std::iota(b.begin(), b.end(), -3);
+
+        const int expected = std::inner_product(a.begin(), a.end(), b.begin(), 7);
+
+        CHECK_EQUAL(expected, etl::transform_reduce(a.data(), a.data() + a.size(), b.data(), 7));
+
+        std::list<int> list(a.begin(), a.end());
+        CHECK_EQUAL(expected, etl::transform_reduce(list.begin(), list.end(), b.begin(), 7));
+      }
+
+      const int a[] = { 1, 2, 3 };
+      const int b[] = { 4, 5, 6 };
+
+      // Binary, with the largest difference.
+      CHECK_EQUAL(3, etl::transform_reduce(std::begin(a), std::end(a), std::begin(b), 0,
+                                           [](int x, int y) { return std::max(x, y); },
+                                           [](int x, int y) { return y - x; }));
+
+      // Unary, with the sum of squares.
+      CHECK_EQUAL(14, etl::transform_reduce(std::begin(a), std::end(a), 0,
+                                            std::plus<int>(),
+                                            [](int x) { return x * x; }));
+    }
+
+    //*************************************************************************
+    TEST(test_inclusive_scan)
+    {
+      const int data[] = { 1, 2, 3, 4, 5 };
+      int output[5] = {};
+
+      int* end = etl::inclusive_scan(std::begin(data), std::end(data), output);
+      CHECK(end == std::end(output));
+      CHECK((std::vector<int>(output, output + 5) == std::vector<int>{ 1, 3, 6, 10, 15 }));
+
+      etl::inclusive_scan(std::begin(data), std::end(data), output, std::multiplies<int>());
+      CHECK((std::vector<int>(output, output + 5) == std::vector<int>{ 1, 2, 6, 24, 120 }));
+
+      etl::inclusive_scan(std::begin(data), std::end(data), output, std::plus<int>(), 100);
+      CHECK((std::vector<int>(output, output + 5) == std::vector<int>{ 101, 103, 106, 110, 115 }));
+
+      // In place.
+      int values[] = { 1, 1, 1, 1 };
+      etl::inclusive_scan(std::begin(values), std::end(values), std::begin(values));
+      CHECK((std::vector<int>(values, values + 4) == std::vector<int>{ 1, 2, 3, 4 }));
+
+      // Empty.
+      CHECK(etl::inclusive_scan(std::begin(data), std::begin(data), output) == output);
+      CHECK(etl::inclusive_scan(std::begin(data), std::begin(data), output, std::plus<int>()) == output);
+    }
+
+    //*************************************************************************
+    TEST(test_exclusive_scan)
+    {
+      const int data[] = { 1, 2, 3, 4, 5 };
+      int output[5] = {};
+
+      int* end = etl::exclusive_scan(std::begin(data), std::end(data), output, 0);
+      CHECK(end == std::end(output));
+      CHECK((std::vector<int>(output, output + 5) == std::vector<int>{ 0, 1, 3, 6, 10 }));
+
+      etl::exclusive_scan(std::begin(data), std::end(data), output, 1, std::multiplies<int>());
+      CHECK((std::vector<int>(output, output + 5) == std::vector<int>{ 1, 1, 2, 6, 24 }));
+
+      // In place, as for a histogram's cumulative distribution.
+      int histogram[] = { 3, 0, 2, 5 };
+      etl::exclusive_scan(std::begin(histogram), std::end(histogram), std::begin(histogram), 0);
+      CHECK((std::vector<int>(histogram, histogram + 4) == std::vector<int>{ 0, 3, 3, 5 }));
+    }
+
+    //*************************************************************************
+    TEST(test_scan_constexpr)
+    {
+#if ETL_USING_CPP14
+      struct helper
+      {
+        static constexpr int sum()
+        {
+          int data[] = { 1, 2, 3, 4, 5, 6 };
+          int output[6] = {};
+          etl::inclusive_scan(data, data + 6, output);
+          return output[5] + etl::reduce(data, data + 6, 0);
+        }
+      };
+
+      constexpr int result = helper::sum();
+      CHECK_EQUAL(42, result);
+#endif
+    }
+
     //*************************************************************************
     TEST(test_midpoint_signed_integral)
     {
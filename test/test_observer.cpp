@@ -29,6 +29,13 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include "etl/observer.h"
+#include "etl/span.h"
+
+#if ETL_HAS_ATOMIC
+  #include <thread>
+#endif
+
+#define REALTIME_TEST 0
 
 namespace
 {
@@ -486,6 +493,211 @@ namespace
       observable.clear_observers();
       CHECK_EQUAL(0UL, observable.number_of_observers());
     }
+
+    //*************************************************************************
+    TEST(test_notify_batch)
+    {
+      typedef etl::span<const Notification1> Batch;
+
+      // Takes the batch in one call.
+      class BatchObserver : public etl::observer<Notification1, Batch>
+      {
+      public:
+
+        BatchObserver() : single_count(0), batch_count(0), batch_size(0) {}
+
+        void notification(Notification1) { ++single_count; }
+        void notification(Batch batch)   { ++batch_count; batch_size += batch.size(); }
+
+        int    single_count;
+        int    batch_count;
+        size_t batch_size;
+      };
+
+      // Takes each notification in turn.
+      class SingleObserver : public etl::observer<Notification1>
+      {
+      public:
+
+        SingleObserver() : count(0) {}
+
+        void notification(Notification1) { ++count; }
+
+        int count;
+      };
+
+      class BatchObservable : public etl::observable<BatchObserver, 2>
+      {
+      };
+
+      class SingleObservable : public etl::observable<SingleObserver, 2>
+      {
+      };
+
+      const Notification1 notifications[3] = {};
+
+      BatchObservable batch_observable;
+      BatchObserver   batch_observer;
+      batch_observable.add_observer(batch_observer);
+      batch_observable.notify_observers(Batch(notifications));
+
+      CHECK_EQUAL(0, batch_observer.single_count);
+      CHECK_EQUAL(1, batch_observer.batch_count);
+      CHECK_EQUAL(3U, batch_observer.batch_size);
+
+      SingleObservable single_observable;
+      SingleObserver   single_observer1;
+      SingleObserver   single_observer2;
+      single_observable.add_observer(single_observer1);
+      single_observable.add_observer(single_observer2);
+      single_observable.disable_observer(single_observer2);
+      single_observable.notify_observers(Batch(notifications));
+
+      CHECK_EQUAL(3, single_observer1.count);
+      CHECK_EQUAL(0, single_observer2.count);
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    class CountingObserver : public etl::observer<int, etl::span<const int> >
+    {
+    public:
+
+      CountingObserver() : total(0) {}
+
+      void notification(int value)                 { total += value; }
+      void notification(etl::span<const int> batch) { for (size_t i = 0U; i < batch.size(); ++i) { total += batch[i]; } }
+
+      int total;
+    };
+
+    class AtomicObservable : public etl::observable_atomic<CountingObserver, 2>
+    {
+    };
+
+    //*************************************************************************
+    TEST(test_observable_atomic)
+    {
+      AtomicObservable observable;
+
+      CountingObserver observer1;
+      CountingObserver observer2;
+      CountingObserver observer3;
+
+      observable.add_observer(observer1);
+      observable.add_observer(observer2);
+      observable.add_observer(observer1);
+      CHECK_EQUAL(2UL, observable.number_of_observers());
+
+      CHECK_THROW(observable.add_observer(observer3), etl::observer_list_full);
+
+      observable.notify_observers(1);
+      CHECK_EQUAL(1, observer1.total);
+      CHECK_EQUAL(1, observer2.total);
+
+      observable.disable_observer(observer2);
+
+      const int values[3] = { 1, 2, 3 };
+      observable.notify_observers(etl::span<const int>(values));
+      CHECK_EQUAL(7, observer1.total);
+      CHECK_EQUAL(1, observer2.total);
+
+      observable.enable_observer(observer2);
+      CHECK(observable.remove_observer(observer1));
+      CHECK(!observable.remove_observer(observer1));
+      CHECK_EQUAL(1UL, observable.number_of_observers());
+
+      observable.notify_observers(10);
+      CHECK_EQUAL(7, observer1.total);
+      CHECK_EQUAL(11, observer2.total);
+
+      observable.synchronize();
+      observable.clear_observers();
+      CHECK_EQUAL(0UL, observable.number_of_observers());
+    }
+
+    //*************************************************************************
+    TEST(test_observable_atomic_change_from_notification)
+    {
+      class Remover : public etl::observer<int>
+      {
+      public:
+
+        Remover(etl::observable_atomic<Remover, 2>& observable_, bool remove_)
+          : observable(observable_)
+          , remove(remove_)
+          , count(0)
+        {
+        }
+
+        void notification(int)
+        {
+          ++count;
+
+          if (remove)
+          {
+            observable.remove_observer(*this);
+          }
+        }
+
+        etl::observable_atomic<Remover, 2>& observable;
+        bool remove;
+        int  count;
+      };
+
+      class Observable : public etl::observable_atomic<Remover, 2>
+      {
+      };
+
+      Observable observable;
+      Remover    remover1(observable, true);
+      Remover    remover2(observable, false);
+
+      observable.add_observer(remover1);
+      observable.add_observer(remover2);
+
+      // Both are notified from the list that was active when the notification started.
+      observable.notify_observers(1);
+      CHECK_EQUAL(1, remover1.count);
+      CHECK_EQUAL(1, remover2.count);
+      CHECK_EQUAL(1UL, observable.number_of_observers());
+
+      observable.notify_observers(1);
+      CHECK_EQUAL(1, remover1.count);
+      CHECK_EQUAL(2, remover2.count);
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    TEST(test_observable_atomic_multi_thread)
+    {
+      AtomicObservable observable;
+      CountingObserver observer1;
+      CountingObserver observer2;
+
+      observable.add_observer(observer1);
+
+      std::thread changer([&observable, &observer2]()
+      {
+        for (int i = 0; i < 10000; ++i)
+        {
+          observable.add_observer(observer2);
+          observable.remove_observer(observer2);
+        }
+      });
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        observable.notify_observers(1);
+      }
+
+      changer.join();
+
+      CHECK_EQUAL(10000, observer1.total);
+      CHECK_EQUAL(1UL, observable.number_of_observers());
+    }
+#endif
+#endif
   }
 }
 
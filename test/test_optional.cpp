@@ -33,12 +33,53 @@ SOFTWARE.
 #include <cstdint>
 
 #include "etl/optional.h"
+#include "etl/math.h"
+#include "etl/limits.h"
 #include "etl/vector.h"
 #include "data.h"
 
 typedef TestDataNDC<std::string> Data;
 typedef TestDataM<uint32_t>      DataM;
 
+//*************************************************************************
+// Types that declare a niche for etl::optional.
+//*************************************************************************
+enum class CommandId : uint32_t
+{
+  Start   = 1U,
+  Stop    = 2U,
+  Invalid = 0xFFFFFFFFU
+};
+
+struct Temperature
+{
+  float celsius;
+};
+
+namespace etl
+{
+  template <>
+  struct optional_niche<CommandId> : etl::optional_niche_value<CommandId, CommandId::Invalid>
+  {
+  };
+
+  template <>
+  struct optional_niche<Temperature>
+  {
+    static constexpr bool value = true;
+
+    static Temperature sentinel()
+    {
+      return Temperature{ etl::numeric_limits<float>::quiet_NaN() };
+    }
+
+    static bool is_sentinel(const Temperature& t)
+    {
+      return etl::is_nan(t.celsius);
+    }
+  };
+}
+
 std::ostream& operator << (std::ostream& os, const Data& data)
 {
   os << data.value;
@@ -882,6 +923,61 @@ namespace
     }
 #endif
 
+    //*************************************************************************
+    TEST(test_optional_niche)
+    {
+      CHECK_EQUAL(sizeof(CommandId), sizeof(etl::optional<CommandId>));
+      CHECK_EQUAL(sizeof(Temperature), sizeof(etl::optional<Temperature>));
+
+      etl::optional<CommandId> command;
+      CHECK(!command.has_value());
+
+      command = CommandId::Stop;
+      CHECK(command.has_value());
+      CHECK(CommandId::Stop == command.value());
+
+      etl::optional<CommandId> copy(command);
+      CHECK(copy.has_value());
+      CHECK(copy == command);
+
+      command.reset();
+      CHECK(!command.has_value());
+      CHECK(CommandId::Start == command.value_or(CommandId::Start));
+
+      command.emplace(CommandId::Start);
+      CHECK(CommandId::Start == *command);
+
+      command = etl::nullopt;
+      CHECK(!command);
+
+      // Storing the sentinel means empty.
+      command = CommandId::Invalid;
+      CHECK(!command.has_value());
+
+      etl::optional<Temperature> temperature;
+      CHECK(!temperature.has_value());
+
+      temperature = Temperature{ 21.5f };
+      CHECK(temperature.has_value());
+      CHECK_CLOSE(21.5f, temperature->celsius, 0.001f);
+
+      etl::optional<Temperature> other;
+      temperature.swap(other);
+      CHECK(!temperature.has_value());
+      CHECK(other.has_value());
+
+      temperature = other;
+      CHECK(temperature.has_value());
+      temperature = etl::nullopt;
+      CHECK(!temperature.has_value());
+
+      etl::optional<CommandId> commands[4];
+      commands[1] = CommandId::Start;
+      CHECK_EQUAL(4U * sizeof(CommandId), sizeof(commands));
+      CHECK(!commands[0].has_value());
+      CHECK(commands[1].has_value());
+    }
+
     //*************************************************************************
     TEST(test_optional_issue_819)
     {
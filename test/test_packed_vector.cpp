@@ -0,0 +1,287 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/packed_vector.h"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <cstdlib>
+
+namespace
+{
+  //***************************************************************************
+  /// Checks every element and the bulk conversions against a model, for
+  /// one width.
+  //***************************************************************************
+  template <size_t Bits>
+  void check_against_model()
+  {
+    const size_t Size = 100U;
+
+    etl::packed_array<Bits, Size> array;
+    std::vector<uint32_t>         model(Size, 0U);
+
+    const uint32_t mask = uint32_t(0xFFFFFFFFUL >> (32U - Bits));
+
+    for (size_t i = 0U; i < 1000U; ++i)
+    {
+      const size_t   index = size_t(rand()) % Size;
+      const uint32_t value = (uint32_t(rand()) << 16U) ^ uint32_t(rand());
+
+      array[index] = value;
+      model[index] = value & mask;
+    }
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      CHECK_EQUAL(model[i], uint32_t(array[i]));
+    }
+
+    // Unpack from every start position.
+    for (size_t first = 0U; first < Size; first += 7U)
+    {
+      uint32_t output[Size];
+      const size_t count = array.unpack(first, etl::span<uint32_t>(output, Size));
+
+      CHECK_EQUAL(Size - first, count);
+      CHECK(std::equal(output, output + count, model.begin() + first));
+    }
+
+    // Pack part way along, and check that the neighbours are untouched.
+    uint32_t input[13];
+
+    for (size_t i = 0U; i < 13U; ++i)
+    {
+      input[i] = ~uint32_t(i * 2654435761UL);
+      model[31U + i] = input[i] & mask;
+    }
+
+    CHECK_EQUAL(13U, array.pack(31U, etl::span<const uint32_t>(input, 13U)));
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      CHECK_EQUAL(model[i], uint32_t(array.get(i)));
+    }
+  }
+
+  SUITE(test_packed_vector)
+  {
+    //*************************************************************************
+    TEST(test_constants)
+    {
+      typedef etl::packed_array<3U, 100U>   Array3;
+      typedef etl::packed_vector<12U, 100U> Vector12;
+
+      CHECK_EQUAL(3U, Array3::BITS);
+      CHECK_EQUAL(7U, Array3::MAX_VALUE);
+      CHECK_EQUAL(10U, Array3::WORDS);
+      CHECK_EQUAL(12U, Vector12::BITS);
+      CHECK_EQUAL(4095U, Vector12::MAX_VALUE);
+      CHECK_EQUAL(38U, Vector12::WORDS);
+
+      CHECK((std::is_same<uint8_t,  Array3::value_type>::value));
+      CHECK((std::is_same<uint16_t, Vector12::value_type>::value));
+
+      CHECK(sizeof(Array3) <= (10U * sizeof(uint32_t)));
+    }
+
+    //*************************************************************************
+    TEST(test_array_widths)
+    {
+      srand(99);
+
+      check_against_model<1U>();
+      check_against_model<3U>();
+      check_against_model<5U>();
+      check_against_model<7U>();
+      check_against_model<8U>();
+      check_against_model<12U>();
+      check_against_model<16U>();
+      check_against_model<17U>();
+      check_against_model<31U>();
+      check_against_model<32U>();
+    }
+
+    //*************************************************************************
+    TEST(test_array_defaults_to_zero)
+    {
+      etl::packed_array<5U, 20U> array;
+
+      for (size_t i = 0U; i < array.size(); ++i)
+      {
+        CHECK_EQUAL(0U, array[i]);
+      }
+
+      array.fill(21U);
+
+      for (size_t i = 0U; i < array.size(); ++i)
+      {
+        CHECK_EQUAL(21U, array[i]);
+      }
+
+      CHECK_EQUAL(21U, array.front());
+      CHECK_EQUAL(21U, array.back());
+    }
+
+    //*************************************************************************
+    TEST(test_reference)
+    {
+      etl::packed_array<5U, 8U> array;
+
+      array[0] = 31U;
+      array[1] = array[0];
+      array[2] = 40U; // Truncated to 8.
+
+      CHECK_EQUAL(31U, array[0]);
+      CHECK_EQUAL(31U, array[1]);
+      CHECK_EQUAL(8U,  array[2]);
+
+      const etl::packed_array<5U, 8U>& carray = array;
+      CHECK_EQUAL(31U, carray[1]);
+
+      CHECK_THROW(array.at(8U), etl::packed_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      etl::packed_array<3U, 10U> array;
+
+      uint8_t n = 0U;
+
+      for (etl::packed_array<3U, 10U>::iterator itr = array.begin(); itr != array.end(); ++itr)
+      {
+        *itr = n++;
+      }
+
+      std::vector<int> values(array.cbegin(), array.cend());
+      std::vector<int> expected = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1 };
+      CHECK(values == expected);
+
+      CHECK_EQUAL(10, array.end() - array.begin());
+      CHECK_EQUAL(5U, array.begin()[5]);
+      CHECK_EQUAL(7U, *(array.cbegin() + 7));
+      CHECK(array.begin() < array.end());
+
+      etl::packed_array<3U, 10U>::const_iterator citr = array.begin();
+      CHECK(citr == array.begin());
+
+      // Works with the standard algorithms.
+      std::sort(array.begin(), array.begin() + 8);
+      CHECK_EQUAL(8, std::count(array.cbegin(), array.cend(), 1U) * 4);
+    }
+
+    //*************************************************************************
+    TEST(test_vector_push_pop)
+    {
+      etl::packed_vector<12U, 50U> vector;
+
+      CHECK(vector.empty());
+      CHECK_EQUAL(50U, vector.max_size());
+
+      for (uint32_t i = 0U; i < 50U; ++i)
+      {
+        vector.push_back(i * 80U);
+      }
+
+      CHECK(vector.full());
+      CHECK_THROW(vector.push_back(1U), etl::packed_vector_full);
+
+      for (uint32_t i = 0U; i < 50U; ++i)
+      {
+        CHECK_EQUAL(i * 80U, vector[i]);
+      }
+
+      vector.pop_back();
+      CHECK_EQUAL(49U, vector.size());
+      CHECK_EQUAL(48U * 80U, vector.back());
+
+      vector.clear();
+      CHECK_THROW(vector.pop_back(), etl::packed_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_vector_resize_assign)
+    {
+      etl::packed_vector<5U, 20U> vector(4U, 17U);
+
+      CHECK_EQUAL(4U, vector.size());
+      CHECK_EQUAL(17U, vector[3]);
+
+      vector.resize(10U, 3U);
+      CHECK_EQUAL(17U, vector[3]);
+      CHECK_EQUAL(3U, vector[4]);
+      CHECK_EQUAL(3U, vector[9]);
+
+      vector.resize(2U);
+      vector.resize(5U);
+      CHECK_EQUAL(0U, vector[4]);
+
+      vector.assign(20U, 30U);
+      CHECK(std::count(vector.begin(), vector.end(), 30U) == 20);
+
+      CHECK_THROW(vector.resize(21U), etl::packed_vector_full);
+    }
+
+    //*************************************************************************
+    TEST(test_vector_append_unpack)
+    {
+      etl::packed_vector<5U, 64U> vector;
+
+      std::vector<uint32_t> input(60U);
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        input[i] = uint32_t(i % 32U);
+      }
+
+      vector.push_back(9U);
+      vector.append(etl::span<const uint32_t>(input.data(), input.size()));
+
+      CHECK_EQUAL(61U, vector.size());
+      CHECK_EQUAL(9U, vector[0]);
+
+      uint32_t output[64];
+      CHECK_EQUAL(60U, vector.unpack(1U, etl::span<uint32_t>(output, 64U)));
+      CHECK(std::equal(input.begin(), input.end(), output));
+
+      // Does not fit.
+      CHECK_THROW(vector.append(etl::span<const uint32_t>(input.data(), 4U)), etl::packed_vector_full);
+      CHECK_EQUAL(61U, vector.size());
+
+      // Pack stops at the size.
+      CHECK_EQUAL(1U, vector.pack(60U, etl::span<const uint32_t>(input.data(), 4U)));
+      CHECK_EQUAL(0U, vector[60]);
+
+      CHECK_THROW(vector.unpack(62U, etl::span<uint32_t>(output, 1U)), etl::packed_vector_out_of_bounds);
+    }
+  }
+}
@@ -0,0 +1,248 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/packet_buffer.h"
+#include "etl/generic_pool.h"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+  // Blocks of 32 bytes, plus the block header.
+  const size_t Block_Bytes = 32U + (2U * sizeof(void*));
+
+  typedef etl::generic_pool<Block_Bytes, etl::alignment_of<void*>::value, 8> Pool;
+  typedef etl::packet_buffer<4>                                              Packet;
+
+  //***************************************************************************
+  std::vector<uint8_t> contents(const etl::ipacket_buffer& packet)
+  {
+    std::vector<uint8_t> bytes(packet.size());
+
+    packet.copy_to(etl::span<uint8_t>(bytes.data(), bytes.size()));
+
+    return bytes;
+  }
+
+  //***************************************************************************
+  void write(etl::span<uint8_t> space, uint8_t first)
+  {
+    for (size_t i = 0U; i < space.size(); ++i)
+    {
+      space[i] = uint8_t(first + i);
+    }
+  }
+
+  SUITE(test_packet_buffer)
+  {
+    //*************************************************************************
+    TEST(test_default)
+    {
+      Pool   pool;
+      Packet packet(pool);
+
+      CHECK(packet.empty());
+      CHECK_EQUAL(0U, packet.size());
+      CHECK_EQUAL(0U, packet.segment_count_used());
+      CHECK_EQUAL(4U, packet.max_segment_count());
+      CHECK_EQUAL(32U, packet.block_capacity());
+      CHECK_EQUAL(0U, packet.headroom());
+    }
+
+    //*************************************************************************
+    TEST(test_headers_prepended_in_headroom)
+    {
+      Pool pool;
+
+      {
+        Packet packet(pool);
+
+        CHECK(packet.reserve_headroom(12U));
+        CHECK_EQUAL(12U, packet.headroom());
+        CHECK_EQUAL(20U, packet.tailroom());
+
+        // Payload, then the headers of each layer down the stack.
+        write(packet.append(4U), 100U);
+        write(packet.prepend(4U), 20U);
+        write(packet.prepend(8U), 10U);
+
+        CHECK_EQUAL(1U, packet.segment_count_used());
+        CHECK_EQUAL(1U, pool.size());
+        CHECK_EQUAL(0U, packet.headroom());
+        CHECK_EQUAL(16U, packet.size());
+
+        std::vector<uint8_t> expected = { 10, 11, 12, 13, 14, 15, 16, 17, 20, 21, 22, 23, 100, 101, 102, 103 };
+        CHECK(expected == contents(packet));
+
+        // No headroom left, so the next header goes in a new block.
+        write(packet.prepend(2U), 1U);
+        CHECK_EQUAL(2U, packet.segment_count_used());
+        CHECK_EQUAL(2U, pool.size());
+        CHECK_EQUAL(30U, packet.headroom());
+        CHECK_EQUAL(1U, contents(packet)[0]);
+        CHECK_EQUAL(10U, contents(packet)[2]);
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_append_bytes_across_blocks)
+    {
+      Pool   pool;
+      Packet packet(pool);
+
+      std::vector<uint8_t> payload(70U);
+
+      for (size_t i = 0U; i < payload.size(); ++i)
+      {
+        payload[i] = uint8_t(i);
+      }
+
+      CHECK(packet.append(etl::span<const uint8_t>(payload.data(), payload.size())));
+
+      CHECK_EQUAL(70U, packet.size());
+      CHECK_EQUAL(3U, packet.segment_count_used());
+      CHECK_EQUAL(26U, packet.tailroom());
+      CHECK(payload == contents(packet));
+
+      // Out of segments.
+      std::vector<uint8_t> more(60U);
+      CHECK_THROW(packet.append(etl::span<const uint8_t>(more.data(), more.size())), etl::packet_buffer_full);
+    }
+
+    //*************************************************************************
+    TEST(test_shared_segments)
+    {
+      Pool pool;
+
+      Packet payload(pool);
+      write(payload.append(8U), 50U);
+
+      {
+        Packet frame1(pool);
+        write(frame1.prepend(2U), 1U);
+        CHECK(frame1.append(payload));
+
+        Packet frame2(payload);
+        write(frame2.prepend(3U), 7U);
+
+        CHECK_EQUAL(3U, pool.size());
+
+        // The shared block is not written by either, so appends go to new blocks.
+        CHECK_EQUAL(0U, payload.tailroom());
+        write(payload.append(1U), 99U);
+        CHECK_EQUAL(4U, pool.size());
+
+        std::vector<uint8_t> expected1 = { 1, 2, 50, 51, 52, 53, 54, 55, 56, 57 };
+        std::vector<uint8_t> expected2 = { 7, 8, 9, 50, 51, 52, 53, 54, 55, 56, 57 };
+        CHECK(expected1 == contents(frame1));
+        CHECK(expected2 == contents(frame2));
+        CHECK_EQUAL(9U, payload.size());
+      }
+
+      // The shared block is kept by the payload.
+      CHECK_EQUAL(2U, pool.size());
+
+      payload.clear();
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_trim)
+    {
+      Pool   pool;
+      Packet packet(pool);
+
+      write(packet.append(32U), 0U);
+      write(packet.append(8U), 32U);
+
+      packet.trim_front(4U);
+      CHECK_EQUAL(36U, packet.size());
+      CHECK_EQUAL(4U, contents(packet)[0]);
+
+      // Removes the first block entirely.
+      packet.trim_front(30U);
+      CHECK_EQUAL(1U, packet.segment_count_used());
+      CHECK_EQUAL(1U, pool.size());
+      CHECK_EQUAL(34U, contents(packet)[0]);
+
+      packet.trim_back(2U);
+      CHECK_EQUAL(4U, packet.size());
+      CHECK_EQUAL(37U, contents(packet).back());
+
+      // Trimming everything keeps the last exclusive block, for its headroom.
+      packet.trim_front(10U);
+      CHECK(packet.empty());
+      CHECK_EQUAL(1U, pool.size());
+      CHECK_EQUAL(6U, packet.headroom());
+    }
+
+    //*************************************************************************
+    TEST(test_gather)
+    {
+      Pool   pool;
+      Packet packet(pool);
+
+      CHECK(packet.reserve_headroom(8U));
+      write(packet.append(20U), 0U);
+      write(packet.append(20U), 20U);
+      write(packet.prepend(4U), 200U);
+
+      etl::iovec_array<4, const uint8_t> iov;
+      packet.gather(iov);
+
+      CHECK_EQUAL(2U, iov.size());
+      CHECK_EQUAL(44U, iov.size_bytes());
+      CHECK_EQUAL(24U, iov[0].size());
+      CHECK_EQUAL(200U, iov[0][0]);
+      CHECK_EQUAL(20U, iov[1].size());
+      CHECK_EQUAL(39U, iov[1][19]);
+
+      std::vector<uint8_t> copied(44U);
+      CHECK_EQUAL(10U, packet.copy_to(etl::span<uint8_t>(copied.data(), 10U), 34U));
+      CHECK_EQUAL(30U, copied[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_pool_exhausted_and_too_large)
+    {
+      etl::generic_pool<Block_Bytes, etl::alignment_of<void*>::value, 1> pool;
+
+      Packet packet(pool);
+
+      CHECK_THROW(packet.append(33U), etl::packet_buffer_too_large);
+      CHECK_EQUAL(32U, packet.append(32U).size());
+      CHECK_THROW(packet.append(1U), etl::pool_no_allocation);
+    }
+  }
+}
@@ -0,0 +1,192 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/pipeline.h"
+#include "etl/rescale.h"
+#include "etl/limiter.h"
+#include "etl/threshold.h"
+#include "etl/quantize.h"
+#include "etl/invert.h"
+#include "etl/scaled_rounding.h"
+
+#include <vector>
+#include <algorithm>
+
+#if ETL_USING_CPP11
+
+namespace
+{
+  typedef etl::rescale<int, int>  Rescale;
+  typedef etl::limiter<int>       Limiter;
+  typedef etl::quantize<int>      Quantize;
+  typedef etl::threshold<int>     Threshold;
+  typedef etl::invert<int>        Invert;
+
+  const int thresholds[]    = { 25, 50, 75 };
+  const int quantizations[] = { 0, 33, 66, 100 };
+
+  struct Twice
+  {
+    int operator ()(int value) const
+    {
+      return value * 2;
+    }
+  };
+
+  SUITE(test_pipeline)
+  {
+    //*************************************************************************
+    TEST(test_single_value_matches_composition)
+    {
+      Rescale  rescale(0, 4095, 0, 100);
+      Limiter  limiter(10, 90);
+      Quantize quantize(thresholds, quantizations, 4U);
+
+      etl::pipeline<Rescale, Limiter, Quantize> pipeline(rescale, limiter, quantize);
+
+      for (int i = 0; i < 4096; i += 7)
+      {
+        CHECK_EQUAL(quantize(limiter(rescale(i))), pipeline(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_process_span_matches_transform)
+    {
+      Rescale   rescale(0, 4095, 0, 100);
+      Limiter   limiter(10, 90);
+      Threshold threshold(50, 100, 0);
+
+      auto pipeline = etl::make_pipeline(rescale, limiter, threshold);
+
+      std::vector<int> input;
+
+      for (int i = 0; i < 4096; i += 13)
+      {
+        input.push_back(i);
+      }
+
+      std::vector<int> expected(input.size());
+      std::transform(input.begin(), input.end(), expected.begin(), rescale);
+      std::transform(expected.begin(), expected.end(), expected.begin(), limiter);
+      std::transform(expected.begin(), expected.end(), expected.begin(), threshold);
+
+      std::vector<int> output(input.size());
+
+      size_t count = pipeline.process(etl::span<const int>(input.data(), input.size()), etl::span<int>(output.data(), output.size()));
+
+      CHECK_EQUAL(input.size(), count);
+      CHECK(expected == output);
+    }
+
+    //*************************************************************************
+    TEST(test_process_span_shorter_output)
+    {
+      etl::pipeline<Twice> pipeline;
+
+      const int input[] = { 1, 2, 3, 4, 5 };
+      int output[]      = { 0, 0, 0, 0, 0 };
+
+      size_t count = pipeline.process(etl::span<const int>(input, 5U), etl::span<int>(output, 3U));
+
+      CHECK_EQUAL(3U, count);
+      CHECK_EQUAL(2, output[0]);
+      CHECK_EQUAL(4, output[1]);
+      CHECK_EQUAL(6, output[2]);
+      CHECK_EQUAL(0, output[3]);
+      CHECK_EQUAL(0, output[4]);
+    }
+
+    //*************************************************************************
+    TEST(test_process_span_in_place)
+    {
+      auto pipeline = etl::make_pipeline(Invert(0, 100), Twice());
+
+      int data[] = { 0, 10, 50, 100 };
+
+      size_t count = pipeline.process(etl::span<const int>(data), etl::span<int>(data));
+
+      CHECK_EQUAL(4U, count);
+      CHECK_EQUAL(200, data[0]);
+      CHECK_EQUAL(180, data[1]);
+      CHECK_EQUAL(100, data[2]);
+      CHECK_EQUAL(0,   data[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_type_changing_stages)
+    {
+      typedef etl::rescale<int, double> ToVolts;
+
+      auto pipeline = etl::make_pipeline(ToVolts(0, 4096, 0.0, 3.3), [](double volts) { return short(volts * 1000.0); });
+
+      static_assert(etl::is_same<short, decltype(pipeline)::result<int>::type>::value, "Wrong result type");
+
+      const int input[] = { 0, 2048, 4096 };
+      long output[3];
+
+      pipeline.process(etl::span<const int>(input), etl::span<long>(output));
+
+      CHECK_EQUAL(0L,    output[0]);
+      CHECK_EQUAL(1650L, output[1]);
+      CHECK_EQUAL(3300L, output[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_function_pointer_stage)
+    {
+      auto pipeline = etl::make_pipeline(Limiter(-100, 100), &etl::round_half_even_unscaled<10U, int>);
+
+      CHECK_EQUAL(1,  pipeline(14));
+      CHECK_EQUAL(2,  pipeline(15));
+      CHECK_EQUAL(2,  pipeline(25));
+      CHECK_EQUAL(4,  pipeline(35));
+      CHECK_EQUAL(10, pipeline(500));
+    }
+
+    //*************************************************************************
+    TEST(test_process_iterators)
+    {
+      auto pipeline = etl::make_pipeline(Limiter(0, 10), Twice());
+
+      const int input[] = { -5, 5, 15 };
+      std::vector<int> output;
+
+      pipeline.process(input, input + 3, std::back_inserter(output));
+
+      CHECK_EQUAL(3U, output.size());
+      CHECK_EQUAL(0,  output[0]);
+      CHECK_EQUAL(10, output[1]);
+      CHECK_EQUAL(20, output[2]);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,263 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "data.h"
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/pool_atomic.h"
+#include "etl/largest.h"
+
+#if ETL_HAS_ATOMIC
+
+typedef TestDataDC<std::string> Test_Data;
+
+namespace
+{
+  struct D2
+  {
+    D2(const std::string& a_, const std::string& b_)
+      : a(a_),
+      b(b_)
+    {
+    }
+
+    std::string a;
+    std::string b;
+  };
+
+  SUITE(test_pool_atomic)
+  {
+    //*************************************************************************
+    TEST(test_allocate)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      Test_Data* p1 = nullptr;
+      Test_Data* p2 = nullptr;
+      Test_Data* p3 = nullptr;
+      Test_Data* p4 = nullptr;
+
+      CHECK_NO_THROW(p1 = pool.allocate());
+      CHECK_NO_THROW(p2 = pool.allocate());
+      CHECK_NO_THROW(p3 = pool.allocate());
+      CHECK_NO_THROW(p4 = pool.allocate());
+
+      std::set<Test_Data*> unique = { p1, p2, p3, p4 };
+      CHECK_EQUAL(4U, unique.size());
+
+      CHECK(pool.full());
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+    }
+
+    //*************************************************************************
+    TEST(test_release)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+      Test_Data* p3 = pool.allocate();
+      Test_Data* p4 = pool.allocate();
+
+      CHECK_NO_THROW(pool.release(p2));
+      CHECK_NO_THROW(pool.release(p3));
+      CHECK_NO_THROW(pool.release(p1));
+      CHECK_NO_THROW(pool.release(p4));
+
+      CHECK_EQUAL(4U, pool.available());
+      CHECK(pool.empty());
+
+      CHECK_THROW(pool.release(p4), etl::pool_no_allocation);
+      CHECK_EQUAL(4U, pool.available());
+
+      Test_Data not_in_pool;
+
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+      Test_Data* p3 = pool.allocate();
+      Test_Data* p4 = pool.allocate();
+
+      CHECK_EQUAL(0U, pool.available());
+
+      pool.release(p2);
+      pool.release(p3);
+
+      CHECK_EQUAL(2U, pool.available());
+      CHECK_EQUAL(2U, pool.size());
+
+      Test_Data* p5 = pool.allocate();
+      Test_Data* p6 = pool.allocate();
+
+      CHECK(p5 != p1);
+      CHECK(p5 != p4);
+      CHECK(p6 != p1);
+      CHECK(p6 != p4);
+      CHECK(p5 != p6);
+
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_is_in_pool)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+      Test_Data not_in_pool;
+
+      Test_Data* p1 = pool.allocate();
+
+      CHECK(pool.is_in_pool(p1));
+      CHECK(!pool.is_in_pool(&not_in_pool));
+      CHECK(!pool.is_in_pool(reinterpret_cast<char*>(p1) + 1));
+    }
+
+    //*************************************************************************
+    TEST(test_type_error)
+    {
+      struct Object
+      {
+        uint64_t a;
+        uint64_t b;
+      };
+
+      etl::pool_atomic<uint32_t, 4> pool;
+
+      etl::ipool_atomic& ip = pool;
+
+      CHECK_THROW(ip.allocate<Object>(), etl::pool_element_size);
+    }
+
+    //*************************************************************************
+    TEST(test_generic_allocate)
+    {
+      typedef etl::largest<uint8_t, uint32_t, double, Test_Data> largest;
+
+      etl::generic_pool_atomic<largest::size, largest::alignment, 4> pool;
+
+      CHECK(pool.allocate<uint8_t>() != nullptr);
+      CHECK(pool.allocate<uint32_t>() != nullptr);
+      CHECK(pool.allocate<double>() != nullptr);
+      CHECK(pool.allocate<Test_Data>() != nullptr);
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::pool_atomic<D2, 4> pool;
+
+      D2* p = pool.create("1", "2");
+
+      CHECK_EQUAL(1U, pool.size());
+      CHECK_EQUAL(std::string("1"), p->a);
+      CHECK_EQUAL(std::string("2"), p->b);
+
+      pool.destroy<D2>(p);
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_threads)
+    {
+      static const int Threads           = 4;
+      static const int Cycles_Per_Thread = 20000;
+
+      etl::pool_atomic<int, 4> pool;
+
+      std::atomic<bool> start(false);
+      std::atomic<int>  errors(0);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < Threads; ++t)
+      {
+        threads.emplace_back([&pool, &start, &errors, t]()
+        {
+          while (!start.load());
+
+          for (int i = 0; i < Cycles_Per_Thread; ++i)
+          {
+            if (pool.full())
+            {
+              std::this_thread::yield();
+              continue;
+            }
+
+            int* p = nullptr;
+
+            try
+            {
+              p = pool.create(t);
+            }
+            catch (const etl::pool_no_allocation&)
+            {
+              continue;
+            }
+
+            // No other thread may own the item while we hold it.
+            std::this_thread::yield();
+
+            if (*p != t)
+            {
+              ++errors;
+            }
+
+            pool.release(p);
+          }
+        });
+      }
+
+      start.store(true);
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(0, errors.load());
+      CHECK(pool.empty());
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,328 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/pool_cache.h"
+#include "etl/pool.h"
+#include "etl/pool_atomic.h"
+
+namespace
+{
+  struct Item
+  {
+    Item(int a_, const std::string& b_)
+      : a(a_)
+      , b(b_)
+    {
+    }
+
+    int         a;
+    std::string b;
+  };
+
+  //***************************************************************************
+  // A cache that counts the accesses to the shared pool.
+  //***************************************************************************
+  template <size_t Size>
+  class CountingCache : public etl::pool_cache<etl::ipool, Size>
+  {
+  public:
+
+    CountingCache(etl::ipool& pool_)
+      : etl::pool_cache<etl::ipool, Size>(pool_)
+      , lock_count(0)
+      , locked(false)
+    {
+    }
+
+    ~CountingCache()
+    {
+      this->flush();
+    }
+
+    int  lock_count;
+    bool locked;
+
+  protected:
+
+    void lock() override
+    {
+      ++lock_count;
+      locked = true;
+    }
+
+    void unlock() override
+    {
+      locked = false;
+    }
+  };
+
+  SUITE(test_pool_cache)
+  {
+    //*************************************************************************
+    TEST(test_allocate_refills_in_batches)
+    {
+      etl::pool<int, 16> pool;
+      CountingCache<8> cache(pool);
+
+      CHECK_EQUAL(8U, cache.capacity());
+      CHECK(cache.empty());
+
+      int* p1 = cache.allocate<int>();
+
+      // A batch of 4 was taken from the pool, one of which was returned.
+      CHECK(p1 != nullptr);
+      CHECK_EQUAL(1, cache.lock_count);
+      CHECK_EQUAL(4U, pool.size());
+      CHECK_EQUAL(3U, cache.size());
+
+      int* p2 = cache.allocate<int>();
+      int* p3 = cache.allocate<int>();
+      int* p4 = cache.allocate<int>();
+
+      CHECK_EQUAL(1, cache.lock_count);
+      CHECK(cache.empty());
+
+      std::set<int*> unique = { p1, p2, p3, p4 };
+      CHECK_EQUAL(4U, unique.size());
+
+      int* p5 = cache.allocate<int>();
+      CHECK(p5 != nullptr);
+      CHECK_EQUAL(2, cache.lock_count);
+      CHECK_EQUAL(8U, pool.size());
+      CHECK(!cache.locked);
+    }
+
+    //*************************************************************************
+    TEST(test_release_flushes_in_batches)
+    {
+      etl::pool<int, 16> pool;
+      CountingCache<4> cache(pool);
+
+      std::vector<int*> items;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        items.push_back(pool.allocate());
+      }
+
+      for (size_t i = 0U; i < items.size(); ++i)
+      {
+        cache.release(items[i]);
+      }
+
+      // 10 releases into a cache of 4. Two batches of 2 were flushed, then 2 more.
+      CHECK_EQUAL(4U, cache.size());
+      CHECK_EQUAL(4U, pool.size());
+      CHECK_EQUAL(3, cache.lock_count);
+
+      cache.flush();
+
+      CHECK(cache.empty());
+      CHECK(pool.empty());
+      CHECK_EQUAL(4, cache.lock_count);
+    }
+
+    //*************************************************************************
+    TEST(test_release_and_allocate_stay_in_cache)
+    {
+      etl::pool<int, 16> pool;
+      CountingCache<4> cache(pool);
+
+      int* p1 = cache.allocate<int>();
+      int  count = cache.lock_count;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        cache.release(p1);
+        p1 = cache.allocate<int>();
+      }
+
+      CHECK_EQUAL(count, cache.lock_count);
+      cache.release(p1);
+    }
+
+    //*************************************************************************
+    TEST(test_exhausted_pool)
+    {
+      etl::pool<int, 2> pool;
+      etl::pool_cache<etl::ipool, 8> cache(pool);
+
+      int* p1 = cache.allocate<int>();
+      int* p2 = cache.allocate<int>();
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(pool.full());
+      CHECK_THROW(cache.allocate<int>(), etl::pool_no_allocation);
+
+      cache.release(p1);
+      cache.release(p2);
+
+      int not_in_pool;
+      CHECK_THROW(cache.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_exhausted_pool_is_unlocked)
+    {
+      etl::pool<int, 2> pool;
+      CountingCache<8> cache(pool);
+
+      int* p1 = cache.allocate<int>();
+      int* p2 = cache.allocate<int>();
+
+      CHECK_THROW(cache.allocate<int>(), etl::pool_no_allocation);
+      CHECK(!cache.locked);
+
+      cache.release(p1);
+      cache.release(p2);
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    TEST(test_refill_takes_what_an_atomic_pool_has)
+    {
+      etl::pool_atomic<int, 3> pool;
+      etl::pool_cache<etl::ipool_atomic, 8> cache(pool);
+
+      // A batch is 4, but the pool only has 3.
+      int* p1 = cache.allocate<int>();
+
+      CHECK(p1 != nullptr);
+      CHECK_EQUAL(2U, cache.size());
+      CHECK(pool.full());
+
+      int* p2 = cache.allocate<int>();
+      int* p3 = cache.allocate<int>();
+
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK_THROW(cache.allocate<int>(), etl::pool_no_allocation);
+
+      cache.release(p1);
+      cache.release(p2);
+      cache.release(p3);
+      cache.flush();
+
+      CHECK(pool.empty());
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::pool<Item, 4> pool;
+
+      {
+        etl::pool_cache<etl::ipool, 2> cache(pool);
+
+        Item* p = cache.create<Item>(1, "1");
+
+        CHECK_EQUAL(1, p->a);
+        CHECK_EQUAL(std::string("1"), p->b);
+
+        cache.destroy(p);
+
+        CHECK_EQUAL(1U, pool.size());
+        CHECK_EQUAL(1U, cache.size());
+
+        cache.flush();
+      }
+
+      CHECK(pool.empty());
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    TEST(test_per_thread_caches_over_atomic_pool)
+    {
+      static const int Threads           = 4;
+      static const int Cycles_Per_Thread = 20000;
+
+      etl::pool_atomic<int, 64> pool;
+
+      std::atomic<bool> start(false);
+      std::atomic<int>  errors(0);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < Threads; ++t)
+      {
+        threads.emplace_back([&pool, &start, &errors, t]()
+        {
+          etl::pool_cache<etl::ipool_atomic, 8> cache(pool);
+
+          while (!start.load());
+
+          int* held[4];
+
+          for (int i = 0; i < Cycles_Per_Thread; ++i)
+          {
+            for (int j = 0; j < 4; ++j)
+            {
+              held[j] = cache.create<int>(t);
+            }
+
+            std::this_thread::yield();
+
+            for (int j = 0; j < 4; ++j)
+            {
+              if (*held[j] != t)
+              {
+                ++errors;
+              }
+
+              cache.destroy(held[j]);
+            }
+          }
+
+          cache.flush();
+        });
+      }
+
+      start.store(true);
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(0, errors.load());
+      CHECK(pool.empty());
+    }
+#endif
+  }
+}
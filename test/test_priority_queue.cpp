@@ -34,6 +34,7 @@ SOFTWARE.
 #include "etl/math.h"
 #include <functional>
 #include <string>
+#include <vector>
 
 #include "data.h"
 
@@ -650,5 +651,76 @@ namespace
         priority_queue2.pop();
       }
     }
+
+    //*************************************************************************
+    template <size_t Arity>
+    void check_against_std(const std::vector<int>& operations)
+    {
+      etl::priority_queue<int, 64, etl::vector<int, 64>, etl::less<int>, Arity> queue;
+      std::priority_queue<int> compare_queue;
+
+      for (size_t i = 0U; i < operations.size(); ++i)
+      {
+        if (((operations[i] < 0) || queue.full()) && !compare_queue.empty())
+        {
+          CHECK_EQUAL(compare_queue.top(), queue.top());
+          compare_queue.pop();
+          queue.pop();
+        }
+        else if (operations[i] >= 0)
+        {
+          compare_queue.push(operations[i]);
+          queue.push(operations[i]);
+        }
+
+        CHECK_EQUAL(compare_queue.size(), queue.size());
+      }
+
+      while (!compare_queue.empty())
+      {
+        CHECK_EQUAL(compare_queue.top(), queue.top());
+        compare_queue.pop();
+        queue.pop();
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_arity)
+    {
+      std::vector<int> operations;
+
+      uint32_t random = 12345U;
+
+      for (size_t i = 0U; i < 400U; ++i)
+      {
+        random = (random * 1103515245U) + 12345U;
+        int value = int((random >> 16) % 50U);
+
+        operations.push_back(((random >> 8) % 3U) == 0U ? -1 : value);
+      }
+
+      check_against_std<2>(operations);
+      check_against_std<3>(operations);
+      check_against_std<4>(operations);
+      check_against_std<8>(operations);
+    }
+
+    //*************************************************************************
+    TEST(test_arity_assign)
+    {
+      int data[] = { 5, 1, 9, 3, 7, 2, 8, 6, 4, 0, 9, 1 };
+
+      etl::priority_queue<int, 16, etl::vector<int, 16>, etl::less<int>, 4> queue(data, data + 12);
+      std::priority_queue<int> compare_queue(data, data + 12);
+
+      CHECK_EQUAL(compare_queue.size(), queue.size());
+
+      while (!compare_queue.empty())
+      {
+        CHECK_EQUAL(compare_queue.top(), queue.top());
+        compare_queue.pop();
+        queue.pop();
+      }
+    }
   };
 }
@@ -0,0 +1,180 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/quantile_sketch.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  const double Accuracy = 0.01;
+
+  typedef etl::quantile_sketch<512U> Sketch;
+
+  //*************************************************************************
+  std::vector<double> make_latencies()
+  {
+    std::vector<double> latencies;
+
+    // A skewed spread of values over several orders of magnitude.
+    uint32_t value = 12345U;
+
+    for (size_t i = 0U; i < 5000U; ++i)
+    {
+      value = (value * 1103515245U) + 12345U;
+      const double x = double((value >> 8) % 1000U) + 1.0;
+      latencies.push_back((x * x) / 100.0 + 1.0);
+    }
+
+    return latencies;
+  }
+
+  //*************************************************************************
+  double exact_quantile(std::vector<double> values, double q)
+  {
+    std::sort(values.begin(), values.end());
+
+    return values[size_t(q * double(values.size() - 1U))];
+  }
+
+  SUITE(test_quantile_sketch)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      Sketch sketch(Accuracy, 1.0);
+
+      CHECK(sketch.empty());
+      CHECK_EQUAL(0U, sketch.count());
+      CHECK_CLOSE(0.0, sketch.quantile(0.5), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_quantiles_within_relative_accuracy)
+    {
+      std::vector<double> latencies = make_latencies();
+
+      Sketch sketch(Accuracy, 1.0);
+      sketch.add(latencies.begin(), latencies.end());
+
+      CHECK_EQUAL(latencies.size(), sketch.count());
+
+      const double qs[] = { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999 };
+
+      for (size_t i = 0U; i < sizeof(qs) / sizeof(qs[0]); ++i)
+      {
+        const double exact = exact_quantile(latencies, qs[i]);
+        CHECK_CLOSE(exact, sketch.quantile(qs[i]), exact * Accuracy);
+      }
+
+      CHECK_CLOSE(exact_quantile(latencies, 0.99), sketch.percentile(99.0), exact_quantile(latencies, 0.99) * Accuracy);
+      CHECK_CLOSE(*std::min_element(latencies.begin(), latencies.end()), sketch.quantile(0.0), 0.0);
+      CHECK_CLOSE(*std::max_element(latencies.begin(), latencies.end()), sketch.quantile(1.0), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      std::vector<double> latencies = make_latencies();
+
+      Sketch whole(Accuracy, 1.0);
+      Sketch half1(Accuracy, 1.0);
+      Sketch half2(Accuracy, 1.0);
+
+      whole.add(latencies.begin(), latencies.end());
+      half1.add(latencies.begin(), latencies.begin() + 1000);
+      half2.add(latencies.begin() + 1000, latencies.end());
+
+      half1.merge(half2);
+
+      CHECK_EQUAL(whole.count(), half1.count());
+      CHECK_CLOSE(whole.min(), half1.min(), 0.0);
+      CHECK_CLOSE(whole.max(), half1.max(), 0.0);
+
+      for (size_t i = 0U; i < Sketch::Bucket_Count; ++i)
+      {
+        CHECK_EQUAL(whole[i], half1[i]);
+      }
+
+      CHECK_CLOSE(whole.quantile(0.99), half1.quantile(0.99), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_merge_incompatible)
+    {
+      Sketch sketch1(Accuracy, 1.0);
+      Sketch sketch2(Accuracy, 10.0);
+      Sketch sketch3(0.02, 1.0);
+
+      CHECK_THROW(sketch1.merge(sketch2), etl::quantile_sketch_incompatible);
+      CHECK_THROW(sketch1.merge(sketch3), etl::quantile_sketch_incompatible);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_parameters)
+    {
+      CHECK_THROW(Sketch(0.0, 1.0), etl::quantile_sketch_invalid_parameter);
+      CHECK_THROW(Sketch(1.0, 1.0), etl::quantile_sketch_invalid_parameter);
+      CHECK_THROW(Sketch(0.01, 0.0), etl::quantile_sketch_invalid_parameter);
+    }
+
+    //*************************************************************************
+    TEST(test_out_of_range_values_are_clamped)
+    {
+      etl::quantile_sketch<16U> sketch(0.1, 1.0);
+
+      sketch.add(-5.0);
+      sketch.add(0.0);
+      sketch.add(0.5);
+      sketch.add(1.0e9);
+
+      CHECK_EQUAL(3U, sketch[0]);
+      CHECK_EQUAL(1U, sketch[15]);
+      CHECK_CLOSE(-5.0, sketch.quantile(0.0), 0.0);
+      CHECK_CLOSE(1.0e9, sketch.quantile(1.0), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Sketch sketch(Accuracy, 1.0);
+
+      sketch(10.0);
+      sketch.clear();
+
+      CHECK(sketch.empty());
+
+      sketch(20.0);
+      CHECK_CLOSE(20.0, sketch.quantile(0.5), 20.0 * Accuracy);
+    }
+  };
+}
@@ -0,0 +1,435 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+#include "etl/queue_mpmc_atomic.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_),
+        b(b_),
+        c(c_),
+        d(d_)
+    {
+    }
+
+    Data()
+      : a(0),
+        b(0),
+        c(0),
+        d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator ==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  using ItemM = TestDataM<int>;
+
+  SUITE(test_queue_mpmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+      CHECK_EQUAL(4U, queue.available());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(5));
+
+      // Queue full.
+      CHECK(!queue.push(6));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(6));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+#if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_move_push_pop)
+    {
+      etl::queue_mpmc_atomic<ItemM, 4> queue;
+
+      ItemM p1(1);
+      ItemM p2(2);
+      ItemM p3(3);
+      ItemM p4(4);
+
+      queue.push(std::move(p1));
+      queue.push(std::move(p2));
+      queue.push(std::move(p3));
+      queue.push(std::move(p4));
+
+      CHECK(!bool(p1));
+      CHECK(!bool(p2));
+      CHECK(!bool(p3));
+      CHECK(!bool(p4));
+
+      ItemM pr(0);
+
+      queue.pop(pr);
+      CHECK_EQUAL(1, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(2, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(3, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(4, pr.value);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      etl::queue_mpmc_atomic<Data, 5> queue;
+
+      queue.emplace();
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(5U, queue.size());
+      CHECK(!queue.emplace(1, 2, 3, 4));
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(0, 0, 0, 0));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK_EQUAL(0U, iqueue.size());
+
+      iqueue.push(1);
+      iqueue.push(2);
+      iqueue.push(3);
+      iqueue.push(4);
+      CHECK_EQUAL(4U, iqueue.size());
+
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, iqueue.size());
+
+      CHECK(!iqueue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_front_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+
+      CHECK_EQUAL(1, queue.front());
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK(queue.pop());
+      CHECK(queue.pop());
+
+      const etl::queue_mpmc_atomic<int, 4>& cqueue = queue;
+      CHECK_EQUAL(4, cqueue.front());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+      CHECK(queue.empty());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+
+      queue.clear();
+      CHECK(!queue.full());
+    }
+
+    //*************************************************************************
+    TEST(test_position_wrap_small_memory_model)
+    {
+      // Positions wrap at a multiple of the size, well within 255 operations.
+      etl::queue_mpmc_atomic<int, 7, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      int expected = 0;
+      int next     = 0;
+
+      for (int lap = 0; lap < 200; ++lap)
+      {
+        while (queue.push(next))
+        {
+          ++next;
+        }
+
+        CHECK_EQUAL(7U, queue.size());
+
+        int count = (lap % 7) + 1;
+
+        for (int i = 0; i < count; ++i)
+        {
+          int value;
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(expected, value);
+          ++expected;
+        }
+      }
+
+      int value;
+
+      while (queue.pop(value))
+      {
+        CHECK_EQUAL(expected, value);
+        ++expected;
+      }
+
+      CHECK_EQUAL(next, expected);
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers_multiple_consumers)
+    {
+      static const int Producers        = 4;
+      static const int Consumers        = 4;
+      static const int Items_Per_Thread = 20000;
+
+      etl::queue_mpmc_atomic<int, 16> queue;
+
+      std::atomic<bool> start(false);
+      std::vector<std::vector<int>> popped(Consumers);
+      std::atomic<int> remaining(Producers * Items_Per_Thread);
+
+      std::vector<std::thread> threads;
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        threads.emplace_back([&queue, &start, p]()
+        {
+          while (!start.load());
+
+          for (int i = 0; i < Items_Per_Thread; ++i)
+          {
+            while (!queue.push((p * Items_Per_Thread) + i))
+            {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+
+      for (int c = 0; c < Consumers; ++c)
+      {
+        threads.emplace_back([&queue, &start, &popped, &remaining, c]()
+        {
+          while (!start.load());
+
+          int value;
+
+          while (remaining.load() > 0)
+          {
+            if (queue.pop(value))
+            {
+              popped[c].push_back(value);
+              --remaining;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+
+      start.store(true);
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      std::vector<int> all;
+
+      for (int c = 0; c < Consumers; ++c)
+      {
+        // Values from any one producer must be seen in order by each consumer.
+        std::vector<int> last(Producers, -1);
+
+        for (size_t i = 0U; i < popped[c].size(); ++i)
+        {
+          int value    = popped[c][i];
+          int producer = value / Items_Per_Thread;
+          CHECK(value > last[producer]);
+          last[producer] = value;
+        }
+
+        all.insert(all.end(), popped[c].begin(), popped[c].end());
+      }
+
+      std::sort(all.begin(), all.end());
+
+      CHECK_EQUAL(size_t(Producers * Items_Per_Thread), all.size());
+
+      for (size_t i = 0U; i < all.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), all[i]);
+      }
+
+      CHECK(queue.empty());
+    }
+  };
+}
+
+#endif
@@ -31,6 +31,9 @@ SOFTWARE.
 #include <thread>
 #include <chrono>
 #include <vector>
+#include <list>
+#include <deque>
+#include <iostream>
 
 #include "etl/queue_spsc_atomic.h"
 
@@ -44,6 +47,10 @@ SOFTWARE.
 
 #define REALTIME_TEST 0
 
+// Prints the throughput of the queue between two threads.
+// Build with and without ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE to compare.
+#define BENCHMARK_TEST 0
+
 namespace
 {
   struct Data
@@ -394,6 +401,169 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_batch_push_pop)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      const int input[6] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0, 0, 0, 0, 0, 0 };
+
+
+      // Only four fit.
+      CHECK_EQUAL(4U, queue.push(input, 6U));
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.push(input, 6U));
+
+      CHECK_EQUAL(3U, queue.pop(output, 3U));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(3U, queue.push(input + 4, 2U) + queue.push(input, 1U));
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(4U, queue.pop(output, 6U));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+      CHECK_EQUAL(1, output[3]);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK_EQUAL(0U, queue.pop(output, 6U));
+    }
+
+    //*************************************************************************
+    TEST(test_batch_push_pop_range)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      std::list<int> input = { 1, 2, 3, 4, 5 };
+      std::vector<int> output(3U);
+
+      CHECK_EQUAL(4U, queue.push(input.begin(), input.end()));
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(3U, queue.pop(output.begin(), output.end()));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      output.assign(3U, 0);
+      CHECK_EQUAL(1U, queue.pop(output.begin(), output.end()));
+      CHECK_EQUAL(4, output[0]);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    template <typename TQueue>
+    void check_wrapping(TQueue& queue)
+    {
+      std::deque<int> compare;
+
+      int values[16];
+      int output[16];
+      int next_value = 0;
+
+      uint32_t seed = 1U;
+
+      // Enough operations for the small memory model counters to wrap many times.
+      for (int i = 0; i < 2000; ++i)
+      {
+        seed = (seed * 1664525U) + 1013904223U;
+        const uint32_t r = seed >> 8;
+        const size_t   n = r % 16U;
+
+        switch ((r >> 8) % 4U)
+        {
+          case 0:
+          {
+            bool pushed = queue.push(next_value);
+            CHECK_EQUAL(compare.size() < queue.capacity(), pushed);
+
+            if (pushed)
+            {
+              compare.push_back(next_value);
+            }
+
+            ++next_value;
+            break;
+          }
+
+          case 1:
+          {
+            for (size_t j = 0U; j < n; ++j)
+            {
+              values[j] = next_value++;
+            }
+
+            size_t n_pushed = queue.push(values, n);
+            CHECK_EQUAL(etl::min(n, queue.capacity() - compare.size()), n_pushed);
+            compare.insert(compare.end(), values, values + n_pushed);
+            break;
+          }
+
+          case 2:
+          {
+            int value;
+            bool popped = queue.pop(value);
+            CHECK_EQUAL(!compare.empty(), popped);
+
+            if (popped)
+            {
+              CHECK_EQUAL(compare.front(), value);
+              compare.pop_front();
+            }
+            break;
+          }
+
+          default:
+          {
+            size_t n_popped = queue.pop(output, n);
+            CHECK_EQUAL(etl::min(n, compare.size()), n_popped);
+            CHECK(std::equal(output, output + n_popped, compare.begin()));
+            compare.erase(compare.begin(), compare.begin() + n_popped);
+            break;
+          }
+        }
+
+        CHECK_EQUAL(compare.size(), queue.size());
+        CHECK_EQUAL(queue.capacity() - compare.size(), queue.available());
+        CHECK_EQUAL(compare.empty(), queue.empty());
+        CHECK_EQUAL(compare.size() == queue.capacity(), queue.full());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_power_of_two_capacity_wrapping)
+    {
+      etl::queue_spsc_atomic<int, 8, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      CHECK_EQUAL(8U, queue.capacity());
+      CHECK_EQUAL(8U, queue.max_size());
+
+      check_wrapping(queue);
+    }
+
+    //*************************************************************************
+    TEST(test_other_capacity_wrapping)
+    {
+      etl::queue_spsc_atomic<int, 7, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      CHECK_EQUAL(7U, queue.capacity());
+      CHECK_EQUAL(7U, queue.max_size());
+
+      check_wrapping(queue);
+    }
+
+    //*************************************************************************
+    TEST(test_power_of_two_capacity_storage)
+    {
+      // No slot is reserved when the capacity is a power of two.
+      CHECK_EQUAL(sizeof(etl::queue_spsc_atomic<int, 7>), sizeof(etl::queue_spsc_atomic<int, 8>));
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -456,6 +626,58 @@ namespace
       }
     }
 #endif
+
+    //*************************************************************************
+#if BENCHMARK_TEST
+    TEST(queue_throughput)
+    {
+      static const int Length = 10000000;
+
+      etl::queue_spsc_atomic<int, 256> bench_queue;
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      std::thread producer([&bench_queue]()
+      {
+        for (int i = 0; i < Length; ++i)
+        {
+          while (!bench_queue.push(i))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      int  value;
+      int  expected = 0;
+      bool in_order = true;
+
+      while (expected < Length)
+      {
+        if (bench_queue.pop(value))
+        {
+          in_order = in_order && (value == expected);
+          ++expected;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      producer.join();
+
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+      std::cout << "queue_spsc_atomic throughput: " << (Length / elapsed.count()) << " items/s";
+#if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE)
+      std::cout << " (cache line " << ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE << ")";
+#endif
+      std::cout << std::endl;
+
+      CHECK(in_order);
+    }
+#endif
   };
 }
 
@@ -34,6 +34,7 @@ SOFTWARE.
 #include <thread>
 #include <mutex>
 #include <vector>
+#include <list>
 
 #if defined(ETL_COMPILER_MICROSOFT)
 #include <Windows.h>
@@ -629,6 +630,89 @@ namespace
       CHECK(!access.called_unlock);
     }
 
+    //*************************************************************************
+    TEST(test_batch_push_pop)
+    {
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      const int input[6] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0, 0, 0, 0, 0, 0 };
+
+      access.clear();
+
+      // Only four fit.
+      CHECK_EQUAL(4U, queue.push(input, 6U));
+      CHECK(access.called_lock);
+      CHECK(access.called_unlock);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.push(input, 6U));
+
+      access.clear();
+      CHECK_EQUAL(3U, queue.pop(output, 3U));
+      CHECK(access.called_lock);
+      CHECK(access.called_unlock);
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(3U, queue.push(input + 4, 2U) + queue.push(input, 1U));
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(4U, queue.pop(output, 6U));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+      CHECK_EQUAL(1, output[3]);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK_EQUAL(0U, queue.pop(output, 6U));
+    }
+
+    //*************************************************************************
+    TEST(test_batch_push_pop_range)
+    {
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      std::list<int> input = { 1, 2, 3, 4, 5 };
+      std::vector<int> output(3U);
+
+      CHECK_EQUAL(4U, queue.push(input.begin(), input.end()));
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(3U, queue.pop(output.begin(), output.end()));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      output.assign(3U, 0);
+      CHECK_EQUAL(1U, queue.pop(output.begin(), output.end()));
+      CHECK_EQUAL(4, output[0]);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_batch_push_pop_from_unlocked)
+    {
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      const int input[4] = { 1, 2, 3, 4 };
+      int output[4] = { 0, 0, 0, 0 };
+
+      access.clear();
+
+      CHECK_EQUAL(4U, queue.push_from_unlocked(input, 4U));
+      CHECK_EQUAL(2U, queue.pop_from_unlocked(output, 2U));
+      CHECK_EQUAL(2U, queue.pop_from_unlocked(output + 2, output + 4));
+      CHECK(!access.called_lock);
+      CHECK(!access.called_unlock);
+
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+      CHECK_EQUAL(4, output[3]);
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
   #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -0,0 +1,461 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/radix_map.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef etl::radix_map<int, 16U, 64U> Map;
+
+  struct collect_values
+  {
+    collect_values(std::vector<int>& values_)
+      : values(values_)
+    {
+    }
+
+    void operator()(int value)
+    {
+      values.push_back(value);
+    }
+
+    std::vector<int>& values;
+  };
+
+  struct collect_keys
+  {
+    collect_keys(std::vector<std::string>& keys_)
+      : keys(keys_)
+    {
+    }
+
+    void operator()(etl::span<const uint8_t> key, int)
+    {
+      keys.push_back(std::string(key.begin(), key.end()));
+    }
+
+    std::vector<std::string>& keys;
+  };
+
+  //***************************************************************************
+  struct counted
+  {
+    counted(int value_ = 0)
+      : value(value_)
+    {
+      ++live;
+    }
+
+    counted(const counted& other)
+      : value(other.value)
+    {
+      ++live;
+    }
+
+    counted& operator =(const counted& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    ~counted()
+    {
+      --live;
+    }
+
+    int value;
+    static int live;
+  };
+
+  int counted::live = 0;
+
+  SUITE(test_radix_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Map map;
+
+      CHECK(map.empty());
+      CHECK_EQUAL(0U, map.size());
+      CHECK_EQUAL(0U, map.node_count());
+      CHECK_EQUAL(16U, map.max_nodes());
+      CHECK_EQUAL(64U, map.max_key_bytes());
+      CHECK(map.find("a") == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find)
+    {
+      Map map;
+
+      CHECK(map.insert("romane", 1));
+      CHECK(map.insert("romanus", 2));
+      CHECK(map.insert("romulus", 3));
+      CHECK(map.insert("rubens", 4));
+      CHECK(map.insert("ruber", 5));
+      CHECK(map.insert("rom", 6));
+      CHECK(map.insert("", 7));
+
+      CHECK_EQUAL(7U, map.size());
+
+      CHECK_EQUAL(1, *map.find("romane"));
+      CHECK_EQUAL(2, *map.find("romanus"));
+      CHECK_EQUAL(3, *map.find("romulus"));
+      CHECK_EQUAL(4, *map.find("rubens"));
+      CHECK_EQUAL(5, *map.find("ruber"));
+      CHECK_EQUAL(6, *map.find("rom"));
+      CHECK_EQUAL(7, *map.find(""));
+
+      CHECK(map.find("roman") == nullptr);
+      CHECK(map.find("r") == nullptr);
+      CHECK(map.find("romanes") == nullptr);
+      CHECK(map.find("x") == nullptr);
+      CHECK(!map.contains("rube"));
+      CHECK(map.contains("rubens"));
+
+      // Edges are shared, so the keys take fewer bytes than their total length.
+      CHECK(map.key_bytes() < (6U + 7U + 7U + 6U + 5U + 3U));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_existing_and_insert_or_assign)
+    {
+      Map map;
+
+      CHECK(map.insert("key", 1));
+      CHECK(!map.insert("key", 2));
+      CHECK_EQUAL(1, *map.find("key"));
+
+      CHECK(map.insert_or_assign("key", 3));
+      CHECK_EQUAL(3, *map.find("key"));
+      CHECK(map.insert_or_assign("keys", 4));
+      CHECK_EQUAL(2U, map.size());
+    }
+
+    //*************************************************************************
+    TEST(test_byte_keys)
+    {
+      Map map;
+
+      const uint8_t k1[] = { 0x00, 0xFF, 0x10 };
+      const uint8_t k2[] = { 0x00, 0xFF };
+      const uint8_t k3[] = { 0x00, 0x01 };
+
+      CHECK(map.insert(Map::key_type(k1), 1));
+      CHECK(map.insert(Map::key_type(k2), 2));
+      CHECK(map.insert(Map::key_type(k3), 3));
+
+      CHECK_EQUAL(1, *map.find(Map::key_type(k1)));
+      CHECK_EQUAL(2, *map.find(Map::key_type(k2)));
+      CHECK_EQUAL(3, *map.find(Map::key_type(k3)));
+      CHECK(map.find(Map::key_type(k1, 1U)) == nullptr);
+
+      // Children are visited in byte order.
+      std::vector<int> values;
+      map.for_each_prefixed(Map::key_type(k1, 1U), collect_values(values));
+
+      std::vector<int> expected = { 3, 2, 1 };
+      CHECK(values == expected);
+    }
+
+    //*************************************************************************
+    TEST(test_longest_prefix_match)
+    {
+      Map map;
+
+      map.insert("10", 1);
+      map.insert("10.1", 2);
+      map.insert("10.1.2", 3);
+      map.insert("192.168", 4);
+
+      size_t length = 99U;
+
+      CHECK_EQUAL(3, *map.longest_prefix_match("10.1.2.7", length));
+      CHECK_EQUAL(6U, length);
+
+      CHECK_EQUAL(2, *map.longest_prefix_match("10.1.3", length));
+      CHECK_EQUAL(4U, length);
+
+      CHECK_EQUAL(1, *map.longest_prefix_match("10.2", length));
+      CHECK_EQUAL(2U, length);
+
+      CHECK_EQUAL(1, *map.longest_prefix_match("10", length));
+      CHECK_EQUAL(2U, length);
+
+      CHECK(map.longest_prefix_match("1", length) == nullptr);
+      CHECK_EQUAL(0U, length);
+
+      CHECK(map.longest_prefix_match("192.16") == nullptr);
+      CHECK_EQUAL(4, *map.longest_prefix_match("192.168.0.1"));
+
+      // The empty key matches everything.
+      map.insert("", 0);
+      CHECK_EQUAL(0, *map.longest_prefix_match("8.8.8.8", length));
+      CHECK_EQUAL(0U, length);
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_prefixed)
+    {
+      Map map;
+
+      map.insert("car", 1);
+      map.insert("cart", 2);
+      map.insert("carbon", 3);
+      map.insert("cat", 4);
+      map.insert("dog", 5);
+
+      std::vector<int> values;
+      CHECK_EQUAL(3U, map.for_each_prefixed("car", collect_values(values)));
+      std::vector<int> expected1 = { 1, 3, 2 };
+      CHECK(values == expected1);
+
+      // The prefix ends part way along an edge.
+      values.clear();
+      CHECK_EQUAL(1U, map.for_each_prefixed("carb", collect_values(values)));
+      std::vector<int> expected2 = { 3 };
+      CHECK(values == expected2);
+
+      values.clear();
+      CHECK_EQUAL(0U, map.for_each_prefixed("cab", collect_values(values)));
+      CHECK(values.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_prefixed_with_keys)
+    {
+      Map map;
+
+      map.insert("car", 1);
+      map.insert("cart", 2);
+      map.insert("carbon", 3);
+      map.insert("cat", 4);
+      map.insert("dog", 5);
+
+      uint8_t buffer[8];
+      std::vector<std::string> keys;
+
+      CHECK_EQUAL(4U, map.for_each_prefixed("ca", etl::span<uint8_t>(buffer), collect_keys(keys)));
+      std::vector<std::string> expected1 = { "car", "carbon", "cart", "cat" };
+      CHECK(keys == expected1);
+
+      keys.clear();
+      CHECK_EQUAL(1U, map.for_each_prefixed("carb", etl::span<uint8_t>(buffer), collect_keys(keys)));
+      std::vector<std::string> expected2 = { "carbon" };
+      CHECK(keys == expected2);
+
+      keys.clear();
+      CHECK_EQUAL(5U, map.for_each_prefixed("", etl::span<uint8_t>(buffer), collect_keys(keys)));
+      std::vector<std::string> expected3 = { "car", "carbon", "cart", "cat", "dog" };
+      CHECK(keys == expected3);
+
+      // Keys that do not fit the buffer are skipped.
+      keys.clear();
+      CHECK_EQUAL(4U, map.for_each_prefixed("", etl::span<uint8_t>(buffer, 4U), collect_keys(keys)));
+      std::vector<std::string> expected4 = { "car", "cart", "cat", "dog" };
+      CHECK(keys == expected4);
+
+      keys.clear();
+      CHECK_EQUAL(0U, map.for_each_prefixed("cab", etl::span<uint8_t>(buffer), collect_keys(keys)));
+      CHECK(keys.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_merges_nodes)
+    {
+      Map map;
+
+      map.insert("test", 1);
+      map.insert("team", 2);
+      map.insert("tea", 3);
+
+      const size_t nodes = map.node_count();
+
+      CHECK(!map.erase("te"));
+      CHECK(!map.erase("teams"));
+
+      CHECK(map.erase("tea"));
+      CHECK(map.find("tea") == nullptr);
+      CHECK_EQUAL(2, *map.find("team"));
+      CHECK_EQUAL(1, *map.find("test"));
+
+      // "tea" and "m" are joined again.
+      CHECK(map.node_count() < nodes);
+
+      CHECK(map.erase("test"));
+      CHECK(map.erase("team"));
+      CHECK(map.empty());
+      CHECK_EQUAL(0U, map.node_count());
+      CHECK_EQUAL(0U, map.key_bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::radix_map<int, 3U, 64U> map;
+
+      CHECK(map.insert("a", 1));
+      CHECK(map.insert("b", 2));
+      CHECK(map.insert("c", 3));
+      CHECK(map.full());
+
+      // Needs a fourth node.
+      CHECK_THROW(map.insert("d", 4), etl::radix_map_full);
+      CHECK_EQUAL(3U, map.size());
+
+      // Needs no new node.
+      map.insert("", 0);
+      CHECK_EQUAL(4U, map.size());
+
+      CHECK(map.erase("b"));
+      CHECK(map.insert("d", 4));
+      CHECK_EQUAL(4, *map.find("d"));
+    }
+
+    //*************************************************************************
+    TEST(test_key_bytes_compaction)
+    {
+      etl::radix_map<int, 8U, 12U> map;
+
+      CHECK(map.insert("aaaa", 1));
+      CHECK(map.insert("bbbb", 2));
+      CHECK(map.insert("cccc", 3));
+
+      CHECK_THROW(map.insert("d", 4), etl::radix_map_full);
+      CHECK_EQUAL(3U, map.size());
+
+      // Leaves a gap at the front of the pool, which is reused.
+      CHECK(map.erase("aaaa"));
+      CHECK(map.insert("dddd", 4));
+      CHECK_EQUAL(12U, map.key_bytes());
+
+      CHECK_EQUAL(2, *map.find("bbbb"));
+      CHECK_EQUAL(3, *map.find("cccc"));
+      CHECK_EQUAL(4, *map.find("dddd"));
+
+      // Splits need no more bytes.
+      CHECK(map.insert("bb", 5));
+      CHECK_EQUAL(5, *map.find("bb"));
+      CHECK_EQUAL(2, *map.find("bbbb"));
+    }
+
+    //*************************************************************************
+    TEST(test_many_keys_with_churn)
+    {
+      etl::radix_map<int, 64U, 256U> map;
+
+      const char* const words[] = { "alpha", "alpine", "alp", "beta", "bet", "better", "gamma", "gam", "game", "delta", "del", "dell" };
+      const size_t n_words = sizeof(words) / sizeof(words[0]);
+
+      for (int round = 0; round < 20; ++round)
+      {
+        for (size_t i = 0U; i < n_words; ++i)
+        {
+          CHECK(map.insert(words[i], int(i) + round));
+        }
+
+        for (size_t i = 0U; i < n_words; ++i)
+        {
+          CHECK_EQUAL(int(i) + round, *map.find(words[i]));
+        }
+
+        // Erase in a different order each round.
+        for (size_t i = 0U; i < n_words; ++i)
+        {
+          CHECK(map.erase(words[(i * 5U + round) % n_words]));
+        }
+
+        CHECK(map.empty());
+        CHECK_EQUAL(0U, map.node_count());
+        CHECK_EQUAL(0U, map.key_bytes());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_values_are_destroyed)
+    {
+      counted::live = 0;
+
+      {
+        etl::radix_map<counted, 8U, 32U> map;
+
+        map.insert("one", counted(1));
+        map.insert("two", counted(2));
+        map.insert("three", counted(3));
+        CHECK_EQUAL(3, counted::live);
+
+        map.erase("two");
+        CHECK_EQUAL(2, counted::live);
+
+        map.insert_or_assign("one", counted(4));
+        CHECK_EQUAL(2, counted::live);
+        CHECK_EQUAL(4, map.find("one")->value);
+      }
+
+      CHECK_EQUAL(0, counted::live);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Map map;
+
+      map.insert("abc", 1);
+      map.insert("abd", 2);
+      map.clear();
+
+      CHECK(map.empty());
+      CHECK_EQUAL(0U, map.node_count());
+      CHECK_EQUAL(0U, map.key_bytes());
+      CHECK(map.find("abc") == nullptr);
+
+      CHECK(map.insert("abc", 3));
+      CHECK_EQUAL(3, *map.find("abc"));
+    }
+
+    //*************************************************************************
+    TEST(test_const_access)
+    {
+      Map map;
+      map.insert("key", 1);
+
+      const Map& cmap = map;
+
+      CHECK_EQUAL(1, *cmap.find("key"));
+      CHECK_EQUAL(1, *cmap.longest_prefix_match("keys"));
+      CHECK(cmap.contains("key"));
+    }
+  }
+}
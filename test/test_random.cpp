@@ -39,6 +39,32 @@ SOFTWARE.
 
 namespace
 {
+  //***************************************************************************
+  /// Checks that generate() gives the same sequence as operator().
+  //***************************************************************************
+  template <typename TGenerator>
+  bool generate_matches_sequence(uint32_t seed)
+  {
+    TGenerator r1(seed);
+    TGenerator r2(seed);
+
+    std::vector<uint32_t> expected(103);
+    std::vector<uint32_t> generated(103);
+
+    for (size_t i = 0UL; i < expected.size(); ++i)
+    {
+      expected[i] = r1();
+    }
+
+    // Uneven blocks.
+    r2.generate(etl::span<uint32_t>(generated.data(), 1U));
+    r2.generate(etl::span<uint32_t>(generated.data() + 1U, 10U));
+    r2.generate(etl::span<uint32_t>(generated.data() + 11U, 0U));
+    r2.generate(etl::span<uint32_t>(generated.data() + 11U, generated.size() - 11U));
+
+    return expected == generated;
+  }
+
   SUITE(test_random)
   {
     //*************************************************************************
@@ -412,5 +438,187 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_random_generate_matches_sequence)
+    {
+      CHECK(generate_matches_sequence<etl::random_xorshift>(1234U));
+      CHECK(generate_matches_sequence<etl::random_lcg>(1234U));
+      CHECK(generate_matches_sequence<etl::random_clcg>(1234U));
+      CHECK(generate_matches_sequence<etl::random_lsfr>(1234U));
+      CHECK(generate_matches_sequence<etl::random_mwc>(1234U));
+      CHECK(generate_matches_sequence<etl::random_pcg>(1234U));
+      CHECK(generate_matches_sequence<etl::random_hash<etl::crc32> >(1234U));
+      CHECK(generate_matches_sequence<etl::random_xoshiro128<1U> >(1234U));
+      CHECK(generate_matches_sequence<etl::random_xoshiro128<4U> >(1234U));
+      CHECK(generate_matches_sequence<etl::random_xoshiro128<8U> >(1234U));
+    }
+
+    //*************************************************************************
+    TEST(test_random_generate_through_base)
+    {
+      etl::random_xoshiro128<> r1(5678U);
+      etl::random_xoshiro128<> r2(5678U);
+      etl::random& base = r2;
+
+      uint32_t values[9];
+      base.generate(etl::span<uint32_t>(values));
+
+      for (size_t i = 0UL; i < 9U; ++i)
+      {
+        CHECK_EQUAL(r1(), values[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_xoshiro128_sequence)
+    {
+      etl::random_xoshiro128<4U> r(1234U);
+
+      std::vector<uint32_t> out1(10000);
+      r.generate(etl::span<uint32_t>(out1.data(), out1.size()));
+
+      // Each bit should be set in about half of the values.
+      for (uint32_t bit = 0U; bit < 32U; ++bit)
+      {
+        size_t count = 0U;
+
+        for (size_t i = 0UL; i < out1.size(); ++i)
+        {
+          count += (out1[i] >> bit) & 1U;
+        }
+
+        CHECK((count > 4800U) && (count < 5200U));
+      }
+
+      // The same seed gives the same sequence, a different seed a different one.
+      etl::random_xoshiro128<4U> r2(1234U);
+      etl::random_xoshiro128<4U> r3(1235U);
+
+      CHECK_EQUAL(out1[0], r2());
+      CHECK(out1[0] != r3());
+
+      std::vector<uint32_t> sorted(out1);
+      std::sort(sorted.begin(), sorted.end());
+      CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+    }
+
+    //*************************************************************************
+    TEST(test_random_xoshiro128_range)
+    {
+      etl::random_xoshiro128<8U> r;
+
+      uint32_t low  = 1234UL;
+      uint32_t high = 9876UL;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint32_t n = r.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_bounded)
+    {
+      etl::random_xoshiro128<> r(42U);
+
+      size_t counts[6] = { 0U, 0U, 0U, 0U, 0U, 0U };
+
+      for (int i = 0; i < 60000; ++i)
+      {
+        uint32_t n = etl::random_bounded(r, 6U);
+
+        CHECK(n < 6U);
+        ++counts[n % 6U];
+      }
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        CHECK((counts[i] > 9500U) && (counts[i] < 10500U));
+      }
+
+      // Full range.
+      CHECK_EQUAL(0xFFFFFFFFUL, uint32_t(r.range(0U, 0xFFFFFFFFUL) | 0xFFFFFFFFUL));
+
+      // A range of one value.
+      CHECK_EQUAL(7U, r.range(7U, 7U));
+      CHECK_EQUAL(0U, etl::random_bounded(r, 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_random_float_and_double)
+    {
+      etl::random_pcg r(42U);
+
+      double sum_f = 0.0;
+      double sum_d = 0.0;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        const float  f = etl::random_float(r);
+        const double d = etl::random_double(r);
+
+        CHECK((f >= 0.0f) && (f < 1.0f));
+        CHECK((d >= 0.0) && (d < 1.0));
+
+        sum_f += f;
+        sum_d += d;
+      }
+
+      CHECK_CLOSE(0.5, sum_f / 100000.0, 0.01);
+      CHECK_CLOSE(0.5, sum_d / 100000.0, 0.01);
+    }
+
+    //*************************************************************************
+    template <typename T>
+    void check_normal(T mean, T standard_deviation)
+    {
+      etl::random_xoshiro128<> r(1234U);
+      etl::random_normal<T> normal(mean, standard_deviation);
+
+      const int n = 200000;
+
+      double sum          = 0.0;
+      double sum_squares  = 0.0;
+      int    within_1     = 0;
+      int    beyond_tail  = 0;
+
+      for (int i = 0; i < n; ++i)
+      {
+        const double x = double(normal(r));
+        const double z = (x - double(mean)) / double(standard_deviation);
+
+        sum         += x;
+        sum_squares += x * x;
+
+        if ((z > -1.0) && (z < 1.0))
+        {
+          ++within_1;
+        }
+
+        if ((z > 3.5) || (z < -3.5))
+        {
+          ++beyond_tail;
+        }
+      }
+
+      const double sample_mean     = sum / n;
+      const double sample_variance = (sum_squares / n) - (sample_mean * sample_mean);
+
+      CHECK_CLOSE(double(mean), sample_mean, 0.02 * double(standard_deviation));
+      CHECK_CLOSE(double(standard_deviation), sqrt(sample_variance), 0.02 * double(standard_deviation));
+      CHECK_CLOSE(0.6827, double(within_1) / n, 0.01);
+
+      // The tail beyond 3.5 holds about 0.047% of samples.
+      CHECK((beyond_tail > 40) && (beyond_tail < 160));
+    }
+
+    TEST(test_random_normal)
+    {
+      check_normal<float>(0.0f, 1.0f);
+      check_normal<double>(10.0, 2.5);
+    }
   };
 }
@@ -0,0 +1,303 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/record_ring_spsc.h"
+
+#include <thread>
+
+#if ETL_HAS_ATOMIC && ETL_USING_CPP11
+
+namespace
+{
+  const uint32_t Records = 20000U;
+
+  typedef etl::record_ring_spsc<64> Ring;
+
+  //***************************************************************************
+  /// Fills a record with bytes derived from a seed.
+  //***************************************************************************
+  void fill(etl::span<uint8_t> record, uint32_t seed)
+  {
+    for (size_t i = 0U; i < record.size(); ++i)
+    {
+      record[i] = uint8_t(seed + i);
+    }
+  }
+
+  //***************************************************************************
+  /// Checks a record filled from a seed.
+  //***************************************************************************
+  bool check(etl::span<const uint8_t> record, uint32_t seed)
+  {
+    for (size_t i = 0U; i < record.size(); ++i)
+    {
+      if (record[i] != uint8_t(seed + i))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_record_ring_spsc)
+  {
+    //*************************************************************************
+    TEST(test_initial_state)
+    {
+      Ring ring;
+
+      CHECK(ring.empty());
+      CHECK_EQUAL(64U, ring.capacity());
+      CHECK_EQUAL(31U - Ring::Header_Size, ring.max_record_size());
+      CHECK_EQUAL(1U, Ring::Header_Size);
+      CHECK(ring.read_next().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_commit_read)
+    {
+      Ring ring;
+
+      etl::span<uint8_t> record = ring.reserve(5U);
+      CHECK_EQUAL(5U, record.size());
+      fill(record, 10U);
+
+      // Not visible until committed.
+      CHECK(ring.empty());
+      ring.commit();
+      CHECK(!ring.empty());
+
+      etl::span<const uint8_t> read = ring.read_next();
+      CHECK_EQUAL(5U, read.size());
+      CHECK(check(read, 10U));
+
+      // The same record until it is released.
+      CHECK(ring.read_next().data() == read.data());
+
+      ring.read_commit();
+      CHECK(ring.empty());
+      CHECK(ring.read_next().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_records_keep_their_boundaries)
+    {
+      Ring ring;
+
+      const uint8_t a[] = { 1 };
+      const uint8_t b[] = { 2, 3, 4 };
+      const uint8_t c[] = { 5, 6 };
+
+      CHECK(ring.write(etl::span<const uint8_t>(a)));
+      CHECK(ring.write(etl::span<const uint8_t>(b)));
+      CHECK(ring.write(etl::span<const uint8_t>(c)));
+
+      etl::span<const uint8_t> read = ring.read_next();
+      CHECK_EQUAL(1U, read.size());
+      CHECK_EQUAL(1, read[0]);
+      ring.read_commit();
+
+      read = ring.read_next();
+      CHECK_EQUAL(3U, read.size());
+      CHECK_ARRAY_EQUAL(b, read.data(), 3U);
+      ring.read_commit();
+
+      read = ring.read_next();
+      CHECK_EQUAL(2U, read.size());
+      CHECK_ARRAY_EQUAL(c, read.data(), 2U);
+      ring.read_commit();
+
+      CHECK(ring.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_commit_shorter)
+    {
+      Ring ring;
+
+      etl::span<uint8_t> record = ring.reserve(ring.max_record_size());
+      CHECK_EQUAL(ring.max_record_size(), record.size());
+      fill(record, 0U);
+      ring.commit(3U);
+
+      // The unused space is returned to the ring.
+      record = ring.reserve(ring.max_record_size());
+      CHECK_EQUAL(ring.max_record_size(), record.size());
+      fill(record, 7U);
+      ring.commit(4U);
+
+      etl::span<const uint8_t> read = ring.read_next();
+      CHECK_EQUAL(3U, read.size());
+      CHECK(check(read, 0U));
+      ring.read_commit();
+
+      read = ring.read_next();
+      CHECK_EQUAL(4U, read.size());
+      CHECK(check(read, 7U));
+      ring.read_commit();
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_lengths)
+    {
+      Ring ring;
+
+      CHECK(ring.reserve(0U).empty());
+      CHECK(ring.reserve(ring.max_record_size() + 1U).empty());
+      CHECK(!ring.write(etl::span<const uint8_t>()));
+
+      CHECK_THROW(ring.commit(), etl::bip_buffer_reserve_invalid);
+
+      ring.reserve(4U);
+      CHECK_THROW(ring.commit(5U), etl::bip_buffer_reserve_invalid);
+      CHECK_THROW(ring.commit(0U), etl::bip_buffer_reserve_invalid);
+
+      ring.commit(4U);
+      CHECK_THROW(ring.commit(), etl::bip_buffer_reserve_invalid);
+      CHECK_EQUAL(4U, ring.read_next().size());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Ring ring;
+
+      // 64 bytes hold six 9 byte records and 10 bytes to spare.
+      for (uint32_t i = 0U; i < 6U; ++i)
+      {
+        etl::span<uint8_t> record = ring.reserve(8U);
+        CHECK_EQUAL(8U, record.size());
+        fill(record, i);
+        ring.commit();
+      }
+
+      CHECK(ring.reserve(10U).empty());
+
+      etl::span<uint8_t> record = ring.reserve(9U);
+      CHECK_EQUAL(9U, record.size());
+      ring.commit();
+
+      CHECK(ring.reserve(1U).empty());
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      Ring ring;
+
+      // Each record is 21 bytes with its length, so the third does not fit at
+      // the end and wraps once the first has been read.
+      uint32_t written = 0U;
+      uint32_t read    = 0U;
+
+      for (int pass = 0; pass < 50; ++pass)
+      {
+        etl::span<uint8_t> record;
+
+        while (!(record = ring.reserve(20U)).empty())
+        {
+          fill(record, written++);
+          ring.commit();
+        }
+
+        etl::span<const uint8_t> next = ring.read_next();
+        CHECK_EQUAL(20U, next.size());
+        CHECK(check(next, read++));
+        ring.read_commit();
+      }
+
+      // The records are intact and in order.
+      while (!ring.empty())
+      {
+        etl::span<const uint8_t> next = ring.read_next();
+        CHECK_EQUAL(20U, next.size());
+        CHECK(check(next, read++));
+        ring.read_commit();
+      }
+
+      CHECK_EQUAL(written, read);
+      CHECK(written > 50U);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      etl::record_ring_spsc<256> ring;
+
+      bool bad = false;
+
+      std::thread consumer([&ring, &bad]()
+      {
+        uint32_t expected = 0U;
+
+        while (expected != Records)
+        {
+          etl::span<const uint8_t> record = ring.read_next();
+
+          if (record.empty())
+          {
+            std::this_thread::yield();
+          }
+          else
+          {
+            if ((record.size() != (1U + (expected % 40U))) || !check(record, expected))
+            {
+              bad = true;
+            }
+
+            ring.read_commit();
+            ++expected;
+          }
+        }
+      });
+
+      for (uint32_t i = 0U; i < Records; ++i)
+      {
+        etl::span<uint8_t> record;
+
+        while ((record = ring.reserve(60U)).empty())
+        {
+          std::this_thread::yield();
+        }
+
+        const size_t length = 1U + (i % 40U);
+        fill(record.first(length), i);
+        ring.commit(length);
+      }
+
+      consumer.join();
+
+      CHECK(!bad);
+    }
+  };
+}
+
+#endif
@@ -517,6 +517,30 @@ namespace
       CHECK(isEqual);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_unique_range)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      // Interleaved with the sorted range.
+      data.insert(initial_data[3]);
+      data.insert(initial_data[7]);
+      compare_data.insert(initial_data[3]);
+      compare_data.insert(initial_data[7]);
+
+      data.insert(etl::sorted_unique_t(), initial_data.begin(), initial_data.end());
+      compare_data.insert(initial_data.begin(), initial_data.end());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(data.full());
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_insert_range_excess)
     {
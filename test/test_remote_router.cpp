@@ -0,0 +1,366 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/remote_router.h"
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/byte_stream.h"
+
+#include <vector>
+
+namespace
+{
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2,
+    MESSAGE3
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    REMOTE  = 2
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+    explicit Message1(int32_t value_)
+      : value(value_)
+    {
+    }
+
+    int32_t value;
+  };
+
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+    Message2(uint8_t a_, uint16_t b_)
+      : a(a_)
+      , b(b_)
+    {
+    }
+
+    uint8_t  a;
+    uint16_t b;
+  };
+
+  // Stays on the local node.
+  struct Message3 : public etl::message<MESSAGE3>
+  {
+  };
+}
+
+namespace etl
+{
+  //***********************************
+  template <>
+  bool write<Message1>(etl::byte_stream_writer& stream, const Message1& msg)
+  {
+    return stream.write(msg.value);
+  }
+
+  //***********************************
+  template <>
+  etl::optional<Message1> read<Message1>(etl::byte_stream_reader& stream)
+  {
+    etl::optional<Message1> result;
+    etl::optional<int32_t>  value = stream.read<int32_t>();
+
+    if (value.has_value())
+    {
+      result.emplace(*value);
+    }
+
+    return result;
+  }
+
+  //***********************************
+  template <>
+  bool write<Message2>(etl::byte_stream_writer& stream, const Message2& msg)
+  {
+    return stream.write(msg.a) && stream.write(msg.b);
+  }
+
+  //***********************************
+  template <>
+  etl::optional<Message2> read<Message2>(etl::byte_stream_reader& stream)
+  {
+    etl::optional<Message2> result;
+    etl::optional<uint8_t>  a = stream.read<uint8_t>();
+    etl::optional<uint16_t> b = stream.read<uint16_t>();
+
+    if (a.has_value() && b.has_value())
+    {
+      result.emplace(*a, *b);
+    }
+
+    return result;
+  }
+}
+
+namespace
+{
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2, Message3>
+  {
+  public:
+
+    Router()
+      : message_router(ROUTER1)
+      , message1_count(0)
+      , message2_count(0)
+      , message3_count(0)
+      , value(0)
+    {
+    }
+
+    void on_receive(const Message1& msg)
+    {
+      ++message1_count;
+      value = msg.value;
+    }
+
+    void on_receive(const Message2& msg)
+    {
+      ++message2_count;
+      value = msg.a + msg.b;
+    }
+
+    void on_receive(const Message3&)
+    {
+      ++message3_count;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int     message1_count;
+    int     message2_count;
+    int     message3_count;
+    int32_t value;
+  };
+
+  //***************************************************************************
+  struct Transport
+  {
+    void send(etl::span<const char> frame)
+    {
+      frames.push_back(std::vector<char>(frame.begin(), frame.end()));
+    }
+
+    std::vector<std::vector<char> > frames;
+  };
+
+  typedef etl::remote_router<Transport, Message1, Message2> Remote;
+  typedef etl::remote_router_receiver<Message1, Message2>   Receiver;
+
+  etl::span<const char> as_span(const std::vector<char>& frame)
+  {
+    return etl::span<const char>(frame.data(), frame.size());
+  }
+
+  SUITE(test_remote_router)
+  {
+    //*************************************************************************
+    TEST(test_batched_round_trip)
+    {
+      char buffer[64];
+      Transport transport;
+
+      etl::message_bus<2> bus_a;
+      Router router_a;
+      Remote remote(REMOTE, transport, etl::span<char>(buffer), etl::endian::little);
+
+      bus_a.subscribe(router_a);
+      bus_a.subscribe(remote);
+
+      bus_a.receive(Message1(-123456));
+      bus_a.receive(Message2(1, 1000));
+      bus_a.receive(Message3());
+
+      CHECK_EQUAL(1, router_a.message1_count);
+      CHECK_EQUAL(1, router_a.message3_count);
+      CHECK_EQUAL(2U, remote.size());
+      CHECK(transport.frames.empty());
+
+      remote.flush();
+
+      CHECK_EQUAL(1U, transport.frames.size());
+      CHECK_EQUAL(0U, remote.size());
+      CHECK_EQUAL(0U, remote.size_bytes());
+
+      // Id, length and payload for each record.
+      size_t expected = (sizeof(etl::message_id_t) + 2U + 4U) + (sizeof(etl::message_id_t) + 2U + 3U);
+      CHECK_EQUAL(expected, transport.frames[0].size());
+
+      Router router_b;
+      Receiver receiver(router_b, etl::endian::little);
+
+      CHECK_EQUAL(2U, receiver.receive(as_span(transport.frames[0])));
+      CHECK_EQUAL(1, router_b.message1_count);
+      CHECK_EQUAL(1, router_b.message2_count);
+      CHECK_EQUAL(1001, router_b.value);
+      CHECK_EQUAL(0U, receiver.rejected());
+
+      // Nothing to send.
+      remote.flush();
+      CHECK_EQUAL(1U, transport.frames.size());
+    }
+
+    //*************************************************************************
+    TEST(test_flush_when_frame_is_full)
+    {
+      const size_t record_size = sizeof(etl::message_id_t) + 2U + 4U;
+
+      char buffer[2U * record_size + 1U];
+      Transport transport;
+
+      Remote remote(REMOTE, transport, etl::span<char>(buffer));
+
+      remote.receive(Message1(1));
+      remote.receive(Message1(2));
+      CHECK(transport.frames.empty());
+
+      remote.receive(Message1(3));
+      CHECK_EQUAL(1U, transport.frames.size());
+      CHECK_EQUAL(2U * record_size, transport.frames[0].size());
+      CHECK_EQUAL(1U, remote.size());
+
+      Router router;
+      Receiver receiver(router);
+
+      CHECK_EQUAL(2U, receiver.receive(as_span(transport.frames[0])));
+      CHECK_EQUAL(2, router.value);
+
+      remote.flush();
+      CHECK_EQUAL(1U, receiver.receive(as_span(transport.frames[1])));
+      CHECK_EQUAL(3, router.value);
+    }
+
+    //*************************************************************************
+    TEST(test_message_too_large_is_dropped)
+    {
+      char buffer[4];
+      Transport transport;
+
+      Remote remote(REMOTE, transport, etl::span<char>(buffer));
+
+      remote.receive(Message1(1));
+
+      CHECK_EQUAL(1U, remote.dropped());
+      CHECK_EQUAL(0U, remote.size());
+      CHECK_EQUAL(0U, remote.size_bytes());
+
+      remote.receive(Message2(1, 2));
+      CHECK_EQUAL(2U, remote.dropped());
+
+      remote.clear_dropped();
+      CHECK_EQUAL(0U, remote.dropped());
+    }
+
+    //*************************************************************************
+    TEST(test_receiver_skips_unknown_and_truncated_records)
+    {
+      char buffer[64];
+      Transport transport;
+
+      Remote remote(REMOTE, transport, etl::span<char>(buffer));
+
+      remote.receive(Message2(5, 6));
+      remote.receive(Message1(7));
+      remote.flush();
+
+      Router router;
+      etl::remote_router_receiver<Message1> receiver(router);
+
+      CHECK_EQUAL(1U, receiver.receive(as_span(transport.frames[0])));
+      CHECK_EQUAL(0, router.message2_count);
+      CHECK_EQUAL(1, router.message1_count);
+      CHECK_EQUAL(7, router.value);
+      CHECK_EQUAL(1U, receiver.rejected());
+
+      std::vector<char> truncated(transport.frames[0].begin(), transport.frames[0].end() - 1);
+      receiver.clear_rejected();
+
+      CHECK_EQUAL(0U, receiver.receive(as_span(truncated)));
+      CHECK_EQUAL(2U, receiver.rejected());
+    }
+
+    //*************************************************************************
+    TEST(test_no_echo)
+    {
+      char buffer[64];
+      Transport transport;
+
+      etl::message_bus<2> bus;
+      Router router;
+      Remote remote(REMOTE, transport, etl::span<char>(buffer));
+      Receiver receiver(bus);
+
+      remote.set_receiver(receiver);
+
+      bus.subscribe(router);
+      bus.subscribe(remote);
+
+      // A frame as sent by the other node.
+      char incoming_buffer[64];
+      Transport other;
+      Remote other_remote(REMOTE, other, etl::span<char>(incoming_buffer));
+      other_remote.receive(Message1(42));
+      other_remote.flush();
+
+      CHECK_EQUAL(1U, receiver.receive(as_span(other.frames[0])));
+      CHECK_EQUAL(1, router.message1_count);
+      CHECK_EQUAL(42, router.value);
+      CHECK_EQUAL(0U, remote.size());
+
+      // Local messages are still sent.
+      bus.receive(Message1(43));
+      CHECK_EQUAL(1U, remote.size());
+    }
+
+    //*************************************************************************
+    TEST(test_accepts)
+    {
+      char buffer[16];
+      Transport transport;
+
+      Remote remote(REMOTE, transport, etl::span<char>(buffer));
+
+      CHECK(remote.accepts(MESSAGE1));
+      CHECK(remote.accepts(MESSAGE2));
+      CHECK(!remote.accepts(MESSAGE3));
+      CHECK(remote.is_consumer());
+    }
+  }
+}
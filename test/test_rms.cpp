@@ -66,5 +66,19 @@ namespace
 
       CHECK_CLOSE(5.21, result, 0.05);
     }
+
+    //*************************************************************************
+    TEST(test_char_rms_add_span_and_merge)
+    {
+      etl::rms<char, int> rms1;
+      etl::rms<char, int> rms2;
+
+      rms1.add(etl::span<const char>(input_c.data(), 9U));
+      rms2.add(etl::span<const char>(input_c.data() + 9U, 9U));
+      rms1.merge(rms2);
+
+      CHECK_EQUAL(input_c.size(), rms1.count());
+      CHECK_CLOSE(5.21, rms1.get_rms(), 0.05);
+    }
   };
 }
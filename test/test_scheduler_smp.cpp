@@ -0,0 +1,277 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/scheduler_smp.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  //***************************************************************************
+  /// A task with a number of items of work.
+  /// Records overlapping calls to task_process_work.
+  //***************************************************************************
+  class Task : public etl::task
+  {
+  public:
+
+    Task(etl::task_priority_t priority, int work_)
+      : task(priority)
+      , work(work_)
+      , processed(0)
+      , busy(false)
+      , overlaps(0)
+    {
+    }
+
+    uint32_t task_request_work() const override
+    {
+      return uint32_t(work.load());
+    }
+
+    void task_process_work() override
+    {
+      if (busy.exchange(true))
+      {
+        ++overlaps;
+      }
+
+      --work;
+      ++processed;
+
+      busy.store(false);
+    }
+
+    std::atomic<int>  work;
+    std::atomic<int>  processed;
+    std::atomic<bool> busy;
+    std::atomic<int>  overlaps;
+  };
+
+  SUITE(test_scheduler_smp)
+  {
+    //*************************************************************************
+    TEST(test_deque)
+    {
+      etl::private_scheduler_smp::work_stealing_deque<4> deque;
+
+      uint32_t value = 99U;
+
+      CHECK_TRUE(deque.empty());
+      CHECK_FALSE(deque.pop(value));
+      CHECK_FALSE(deque.steal(value));
+
+      deque.push(1U);
+      deque.push(2U);
+      deque.push(3U);
+
+      // Owner LIFO, thieves FIFO.
+      CHECK_TRUE(deque.pop(value));
+      CHECK_EQUAL(3U, value);
+      CHECK_TRUE(deque.steal(value));
+      CHECK_EQUAL(1U, value);
+      CHECK_TRUE(deque.pop(value));
+      CHECK_EQUAL(2U, value);
+      CHECK_FALSE(deque.pop(value));
+      CHECK_TRUE(deque.empty());
+
+      // Wraps around the buffer.
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        deque.push(i);
+        deque.push(i + 100U);
+        CHECK_TRUE(deque.steal(value));
+        CHECK_EQUAL(i, value);
+        CHECK_TRUE(deque.pop(value));
+        CHECK_EQUAL(i + 100U, value);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_single_core_priority_order)
+    {
+      etl::scheduler_smp<4, 1> scheduler;
+
+      Task low(1, 2);
+      Task mid(2, 1);
+      Task high(3, 2);
+
+      scheduler.add_task(low);
+      scheduler.add_task(high);
+      scheduler.add_task(mid);
+
+      CHECK_TRUE(scheduler.process(0U));
+      CHECK_EQUAL(1, high.processed.load());
+      CHECK_TRUE(scheduler.process(0U));
+      CHECK_EQUAL(2, high.processed.load());
+      CHECK_TRUE(scheduler.process(0U));
+      CHECK_EQUAL(1, mid.processed.load());
+      CHECK_TRUE(scheduler.process(0U));
+      CHECK_TRUE(scheduler.process(0U));
+      CHECK_EQUAL(2, low.processed.load());
+      CHECK_FALSE(scheduler.process(0U));
+
+      // New work is found on the next poll.
+      mid.work = 1;
+      CHECK_TRUE(scheduler.process(0U));
+      CHECK_EQUAL(2, mid.processed.load());
+      CHECK_FALSE(scheduler.process(0U));
+    }
+
+    //*************************************************************************
+    TEST(test_steal)
+    {
+      etl::scheduler_smp<4, 2> scheduler;
+
+      // Priority order 4, 3, 2, 1: homes 0, 1, 0, 1.
+      Task t4(4, 3);
+      Task t3(3, 0);
+      Task t2(2, 3);
+      Task t1(1, 0);
+
+      scheduler.add_task(t1);
+      scheduler.add_task(t2);
+      scheduler.add_task(t3);
+      scheduler.add_task(t4);
+
+      CHECK_EQUAL(0U, scheduler.home_core(0U));
+      CHECK_EQUAL(1U, scheduler.home_core(1U));
+
+      // Core 0 queues t2 then t4, and processes t4.
+      CHECK_TRUE(scheduler.process(0U));
+      CHECK_EQUAL(1, t4.processed.load());
+
+      // Core 1 has no work of its own, so steals the oldest, t2.
+      CHECK_TRUE(scheduler.process(1U));
+      CHECK_EQUAL(1, t2.processed.load());
+
+      // t2 is now queued on core 1, and is not queued again by core 0.
+      CHECK_TRUE(scheduler.process(0U));
+      CHECK_EQUAL(2, t4.processed.load());
+      CHECK_TRUE(scheduler.process(1U));
+      CHECK_EQUAL(2, t2.processed.load());
+      CHECK_TRUE(scheduler.process(0U));
+      CHECK_TRUE(scheduler.process(1U));
+      CHECK_EQUAL(3, t4.processed.load());
+      CHECK_EQUAL(3, t2.processed.load());
+
+      CHECK_FALSE(scheduler.process(0U));
+      CHECK_FALSE(scheduler.process(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_cores)
+    {
+      const size_t Cores = 4U;
+      const size_t Tasks = 16U;
+
+      typedef etl::scheduler_smp<Tasks, Cores> Scheduler;
+
+      Scheduler scheduler;
+
+      std::vector<Task*> tasks;
+      std::atomic<int>   remaining(0);
+
+      for (size_t i = 0U; i < Tasks; ++i)
+      {
+        const int work = int(100U + (i * 37U) % 200U);
+        tasks.push_back(new Task(etl::task_priority_t(i), work));
+        remaining += work;
+        scheduler.add_task(*tasks.back());
+      }
+
+      const int total = remaining.load();
+
+      struct Idle
+      {
+        Idle(Scheduler& scheduler_, std::vector<Task*>& tasks_)
+          : scheduler(scheduler_)
+          , tasks(tasks_)
+        {
+        }
+
+        void on_idle()
+        {
+          int left = 0;
+
+          for (size_t i = 0U; i < tasks.size(); ++i)
+          {
+            left += tasks[i]->work.load();
+          }
+
+          if (left == 0)
+          {
+            scheduler.exit_scheduler();
+          }
+        }
+
+        Scheduler&          scheduler;
+        std::vector<Task*>& tasks;
+      };
+
+      Idle idle(scheduler, tasks);
+      etl::function<Idle, void> idle_callback(idle, &Idle::on_idle);
+      scheduler.set_idle_callback(idle_callback);
+
+      std::vector<std::thread> threads;
+
+      for (size_t core = 1U; core < Cores; ++core)
+      {
+        threads.emplace_back([&scheduler, core]() { scheduler.start_core(core); });
+      }
+
+      scheduler.start_core(0U);
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      int processed = 0;
+
+      for (size_t i = 0U; i < tasks.size(); ++i)
+      {
+        CHECK_EQUAL(0, tasks[i]->work.load());
+        CHECK_EQUAL(0, tasks[i]->overlaps.load());
+        processed += tasks[i]->processed.load();
+        delete tasks[i];
+      }
+
+      CHECK_EQUAL(total, processed);
+    }
+  }
+}
+
+#endif
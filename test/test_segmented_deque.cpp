@@ -0,0 +1,371 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <deque>
+#include <vector>
+#include <algorithm>
+
+#include "etl/segmented_deque.h"
+#include "etl/pool.h"
+
+#include "data.h"
+
+namespace
+{
+  static const size_t SIZE       = 40U;
+  static const size_t BLOCK_SIZE = 4U;
+
+  typedef etl::segmented_deque<int, SIZE, BLOCK_SIZE> Data;
+  typedef etl::isegmented_deque<int, BLOCK_SIZE>      IData;
+  typedef etl::pool<Data::block_type, 24>             Pool;
+  typedef std::deque<int>                             Compare_Data;
+
+  typedef TestDataNDC<std::string>                       NDC;
+  typedef etl::segmented_deque<NDC, SIZE, BLOCK_SIZE>  DataNDC;
+  typedef etl::pool<DataNDC::block_type, 24>           PoolNDC;
+
+  typedef TestDataM<int>                               ItemM;
+  typedef etl::segmented_deque<ItemM, SIZE, BLOCK_SIZE> DataM;
+  typedef etl::pool<DataM::block_type, 24>             PoolM;
+
+  SUITE(test_segmented_deque)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Pool pool;
+      Data data(pool);
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK_EQUAL(0U, data.blocks());
+      CHECK(data.begin() == data.end());
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_blocks_on_demand)
+    {
+      Pool pool;
+      Data data(pool);
+
+      data.push_back(1);
+      CHECK_EQUAL(1U, data.blocks());
+      CHECK_EQUAL(1U, pool.size());
+
+      data.push_back(2);
+      data.push_back(3);
+      data.push_back(4);
+      CHECK_EQUAL(1U, data.blocks());
+
+      data.push_back(5);
+      CHECK_EQUAL(2U, data.blocks());
+
+      data.push_front(0);
+      CHECK_EQUAL(3U, data.blocks());
+      CHECK_EQUAL(3U, pool.size());
+
+      data.pop_front();
+      CHECK_EQUAL(2U, data.blocks());
+
+      data.pop_back();
+      CHECK_EQUAL(1U, data.blocks());
+
+      data.clear();
+      CHECK_EQUAL(0U, data.blocks());
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_random_push_pop)
+    {
+      Pool         pool;
+      Data         data(pool);
+      Compare_Data compare;
+
+      uint32_t seed = 1U;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        seed = (seed * 1664525U) + 1013904223U;
+        const uint32_t r = seed >> 8;
+
+        switch (r % 4U)
+        {
+          case 0:
+          {
+            if (compare.size() < SIZE)
+            {
+              data.push_back(i);
+              compare.push_back(i);
+            }
+            break;
+          }
+
+          case 1:
+          {
+            if (compare.size() < SIZE)
+            {
+              data.push_front(i);
+              compare.push_front(i);
+            }
+            break;
+          }
+
+          case 2:
+          {
+            if (!compare.empty())
+            {
+              data.pop_back();
+              compare.pop_back();
+            }
+            break;
+          }
+
+          default:
+          {
+            if (!compare.empty())
+            {
+              data.pop_front();
+              compare.pop_front();
+            }
+            break;
+          }
+        }
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK_EQUAL(pool.size(), data.blocks());
+        CHECK(data.blocks() <= ((data.size() + (2U * BLOCK_SIZE) - 2U) / BLOCK_SIZE));
+
+        if (!compare.empty())
+        {
+          CHECK_EQUAL(compare.front(), data.front());
+          CHECK_EQUAL(compare.back(), data.back());
+        }
+      }
+
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_index_and_iterators)
+    {
+      Pool pool;
+      Data data(pool);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(i + 10);
+        data.push_front(9 - i);
+      }
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), data[i]);
+        CHECK_EQUAL(int(i), data.at(i));
+      }
+
+      Data::iterator itr = data.begin();
+      CHECK_EQUAL(20, data.end() - itr);
+      CHECK_EQUAL(5, *(itr + 5));
+      CHECK_EQUAL(7, itr[7]);
+
+      itr += 10;
+      CHECK_EQUAL(10, *itr);
+      --itr;
+      CHECK_EQUAL(9, *itr);
+
+      const Data& cdata = data;
+      Data::const_iterator citr = cdata.begin();
+      CHECK(std::equal(citr, cdata.end(), data.begin()));
+
+      std::vector<int> reversed(data.rbegin(), data.rend());
+      CHECK_EQUAL(19, reversed.front());
+      CHECK_EQUAL(0, reversed.back());
+
+      CHECK_THROW(data.at(20), etl::segmented_deque_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Pool pool;
+      Data data(pool);
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        data.push_back(int(i));
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+      CHECK_THROW(data.push_back(0), etl::segmented_deque_full);
+      CHECK_THROW(data.push_front(0), etl::segmented_deque_full);
+      CHECK_EQUAL(SIZE, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_pool)
+    {
+      etl::pool<Data::block_type, 3> pool;
+      Data data1(pool);
+      Data data2(pool);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data1.push_back(i);
+      }
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data2.push_back(i);
+      }
+
+      CHECK_EQUAL(3U, pool.size());
+
+      // The pool is exhausted.
+      CHECK_THROW(data2.push_back(4), etl::pool_no_allocation);
+      CHECK_THROW(data1.push_front(-1), etl::pool_no_allocation);
+      CHECK_EQUAL(4U, data2.size());
+      CHECK_EQUAL(8U, data1.size());
+      CHECK_EQUAL(0, data1.front());
+
+      data1.clear();
+      data2.push_back(4);
+      CHECK_EQUAL(5U, data2.size());
+      CHECK_EQUAL(4, data2.back());
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      Pool pool;
+      Data data(pool);
+      IData& idata = data;
+
+      idata.push_back(1);
+      idata.push_front(0);
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(0, idata.front());
+      CHECK_EQUAL(1, idata.back());
+      CHECK(&pool == &idata.get_pool());
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial)
+    {
+      PoolNDC pool;
+
+      {
+        DataNDC data(pool);
+
+        for (int i = 0; i < 15; ++i)
+        {
+          data.push_back(NDC(std::to_string(i)));
+          data.emplace_front(std::to_string(-i));
+        }
+
+        CHECK_EQUAL(std::string("-14"), data.front().value);
+        CHECK_EQUAL(std::string("14"), data.back().value);
+        CHECK(!data.full());
+
+        DataNDC copy(data);
+        CHECK(copy == data);
+
+        copy.pop_front();
+        CHECK(copy != data);
+
+        copy = data;
+        CHECK(copy == data);
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_move)
+    {
+      PoolM pool;
+      DataM data(pool);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.emplace_back(i);
+      }
+
+      size_t blocks = data.blocks();
+
+      DataM other(std::move(data));
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(0U, data.blocks());
+      CHECK_EQUAL(10U, other.size());
+      CHECK_EQUAL(blocks, other.blocks());
+      CHECK_EQUAL(blocks, pool.size());
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK_EQUAL(i, other[i].value);
+      }
+
+      DataM assigned(pool);
+      assigned.push_back(ItemM(100));
+      assigned = std::move(other);
+      CHECK_EQUAL(10U, assigned.size());
+      CHECK_EQUAL(0, assigned.front().value);
+      CHECK_EQUAL(blocks, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_constructors_and_assign)
+    {
+      Pool pool;
+
+      int values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      Data data1(values, values + 10, pool);
+      Data data2({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, pool);
+
+      CHECK(data1 == data2);
+      CHECK(std::equal(data1.begin(), data1.end(), values));
+
+      data2.assign(5U, 7);
+      CHECK_EQUAL(5U, data2.size());
+      CHECK_EQUAL(7, data2[4]);
+      CHECK(!(data2 < data1));
+      CHECK(data1 < data2);
+    }
+  };
+}
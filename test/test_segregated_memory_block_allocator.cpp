@@ -0,0 +1,214 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/segregated_memory_block_allocator.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#include <set>
+
+namespace
+{
+  // 4 x 16, 3 x 32, 2 x 64 and 1 x 128 byte blocks.
+  using Allocator = etl::segregated_memory_block_allocator<16U, 8U, 4U, 3U, 2U, 1U>;
+
+  SUITE(test_segregated_memory_block_allocator)
+  {
+    //*************************************************************************
+    TEST(test_size_classes)
+    {
+      Allocator allocator;
+
+      CHECK_EQUAL(4U, allocator.number_of_classes());
+
+      CHECK_EQUAL(16U,  allocator.block_size(0U));
+      CHECK_EQUAL(32U,  allocator.block_size(1U));
+      CHECK_EQUAL(64U,  allocator.block_size(2U));
+      CHECK_EQUAL(128U, allocator.block_size(3U));
+
+      CHECK_EQUAL(4U, allocator.max_size(0U));
+      CHECK_EQUAL(3U, allocator.max_size(1U));
+      CHECK_EQUAL(2U, allocator.max_size(2U));
+      CHECK_EQUAL(1U, allocator.max_size(3U));
+
+      CHECK_EQUAL(0U, allocator.class_index(0U));
+      CHECK_EQUAL(0U, allocator.class_index(1U));
+      CHECK_EQUAL(0U, allocator.class_index(16U));
+      CHECK_EQUAL(1U, allocator.class_index(17U));
+      CHECK_EQUAL(1U, allocator.class_index(32U));
+      CHECK_EQUAL(2U, allocator.class_index(33U));
+      CHECK_EQUAL(2U, allocator.class_index(64U));
+      CHECK_EQUAL(3U, allocator.class_index(65U));
+      CHECK_EQUAL(3U, allocator.class_index(128U));
+      CHECK_EQUAL(4U, allocator.class_index(129U));
+      CHECK_EQUAL(4U, allocator.class_index(100000U));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_from_matching_class)
+    {
+      Allocator allocator;
+
+      void* p16  = allocator.allocate(10U,  8U);
+      void* p32  = allocator.allocate(20U,  8U);
+      void* p64  = allocator.allocate(64U,  8U);
+      void* p128 = allocator.allocate(100U, 8U);
+
+      CHECK(p16  != nullptr);
+      CHECK(p32  != nullptr);
+      CHECK(p64  != nullptr);
+      CHECK(p128 != nullptr);
+
+      CHECK_EQUAL(1U, allocator.size(0U));
+      CHECK_EQUAL(1U, allocator.size(1U));
+      CHECK_EQUAL(1U, allocator.size(2U));
+      CHECK_EQUAL(1U, allocator.size(3U));
+
+      CHECK((reinterpret_cast<uintptr_t>(p16)  % 8U) == 0U);
+      CHECK((reinterpret_cast<uintptr_t>(p32)  % 8U) == 0U);
+      CHECK((reinterpret_cast<uintptr_t>(p64)  % 8U) == 0U);
+      CHECK((reinterpret_cast<uintptr_t>(p128) % 8U) == 0U);
+
+      CHECK(allocator.release(p16));
+      CHECK(allocator.release(p32));
+      CHECK(allocator.release(p64));
+      CHECK(allocator.release(p128));
+
+      CHECK_EQUAL(0U, allocator.size(0U));
+      CHECK_EQUAL(0U, allocator.size(1U));
+      CHECK_EQUAL(0U, allocator.size(2U));
+      CHECK_EQUAL(0U, allocator.size(3U));
+    }
+
+    //*************************************************************************
+    TEST(test_rejects_unsuitable_requests)
+    {
+      Allocator allocator;
+
+      CHECK(allocator.allocate(129U, 8U) == nullptr);
+      CHECK(allocator.allocate(8U, 16U) == nullptr);
+      CHECK_EQUAL(1U, allocator.failure_count());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_to_larger_class)
+    {
+      Allocator allocator;
+
+      std::set<void*> blocks;
+
+      // Fill class 2, then overflow to class 3.
+      blocks.insert(allocator.allocate(40U, 8U));
+      blocks.insert(allocator.allocate(40U, 8U));
+      blocks.insert(allocator.allocate(40U, 8U));
+
+      CHECK_EQUAL(3U, blocks.size());
+      CHECK(blocks.count(nullptr) == 0U);
+      CHECK_EQUAL(2U, allocator.size(2U));
+      CHECK_EQUAL(1U, allocator.size(3U));
+      CHECK_EQUAL(1U, allocator.overflow_count(2U));
+
+      // Nothing left for this size.
+      CHECK(allocator.allocate(40U, 8U) == nullptr);
+      CHECK_EQUAL(2U, allocator.overflow_count(2U));
+      CHECK_EQUAL(1U, allocator.overflow_count(3U));
+      CHECK_EQUAL(1U, allocator.failure_count());
+
+      // Smaller classes are unaffected.
+      CHECK(allocator.allocate(16U, 8U) != nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_reuse_and_peak)
+    {
+      Allocator allocator;
+
+      void* p1 = allocator.allocate(16U, 8U);
+      void* p2 = allocator.allocate(16U, 8U);
+      void* p3 = allocator.allocate(16U, 8U);
+
+      CHECK_EQUAL(3U, allocator.peak_size(0U));
+      CHECK_EQUAL(1U, allocator.available(0U));
+
+      CHECK(allocator.release(p2));
+      CHECK_EQUAL(2U, allocator.size(0U));
+      CHECK_EQUAL(3U, allocator.peak_size(0U));
+
+      void* p4 = allocator.allocate(16U, 8U);
+      CHECK(p4 == p2);
+
+      allocator.reset_statistics();
+      CHECK_EQUAL(3U, allocator.peak_size(0U));
+
+      CHECK(allocator.release(p1));
+      CHECK(allocator.release(p3));
+      CHECK(allocator.release(p4));
+
+      allocator.reset_statistics();
+      CHECK_EQUAL(0U, allocator.peak_size(0U));
+      CHECK_EQUAL(0U, allocator.failure_count());
+    }
+
+    //*************************************************************************
+    TEST(test_is_owner_of)
+    {
+      Allocator allocator;
+      int       other;
+
+      char* p16  = static_cast<char*>(allocator.allocate(16U,  8U));
+      char* p128 = static_cast<char*>(allocator.allocate(128U, 8U));
+
+      CHECK(allocator.is_owner_of(p16));
+      CHECK(allocator.is_owner_of(p128));
+      CHECK(!allocator.is_owner_of(p16 + 8));
+      CHECK(!allocator.is_owner_of(p128 + 64));
+      CHECK(!allocator.is_owner_of(&other));
+      CHECK(!allocator.release(p16 + 8));
+      CHECK(!allocator.release(&other));
+
+      CHECK(allocator.release(p16));
+      CHECK(allocator.release(p128));
+    }
+
+    //*************************************************************************
+    TEST(test_with_successor)
+    {
+      Allocator allocator;
+      etl::fixed_sized_memory_block_allocator<256U, 8U, 1U> allocator256;
+
+      allocator.set_successor(allocator256);
+
+      void* p = allocator.allocate(200U, 8U);
+
+      CHECK(p != nullptr);
+      CHECK(allocator256.is_owner_of(p));
+      CHECK(allocator.release(p));
+    }
+  }
+}
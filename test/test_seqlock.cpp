@@ -0,0 +1,170 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+
+// Yield to the OS once the backoff is exhausted, so that the tests make
+// progress when there are fewer cores than threads.
+#define ETL_SPIN_YIELD() std::this_thread::yield()
+
+#include "etl/seqlock.h"
+
+#if ETL_HAS_SEQLOCK
+
+namespace
+{
+  const size_t   Readers = 3U;
+  const uint32_t Writes  = 20000U;
+
+  //***************************************************************************
+  /// A snapshot whose fields are consistent only if written together.
+  /// The size is not a multiple of the word size.
+  //***************************************************************************
+  struct Snapshot
+  {
+    uint32_t sequence;
+    uint32_t doubled;
+    uint16_t low;
+    uint8_t  check;
+  };
+
+  Snapshot make_snapshot(uint32_t i)
+  {
+    Snapshot snapshot = { i, i * 2U, uint16_t(i), uint8_t(i ^ 0x5AU) };
+
+    return snapshot;
+  }
+
+  bool is_consistent(const Snapshot& snapshot)
+  {
+    return (snapshot.doubled == (snapshot.sequence * 2U)) &&
+           (snapshot.low     == uint16_t(snapshot.sequence)) &&
+           (snapshot.check   == uint8_t(snapshot.sequence ^ 0x5AU));
+  }
+
+  SUITE(test_seqlock)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::seqlock<Snapshot> lock;
+
+      const Snapshot snapshot = lock.read();
+
+      CHECK_EQUAL(0U, snapshot.sequence);
+      CHECK_EQUAL(0U, snapshot.doubled);
+      CHECK_EQUAL(0U, lock.sequence_count());
+    }
+
+    //*************************************************************************
+    TEST(test_write_read)
+    {
+      etl::seqlock<Snapshot> lock(make_snapshot(7U));
+
+      CHECK_EQUAL(7U, lock.read().sequence);
+
+      lock.write(make_snapshot(12345U));
+      CHECK_EQUAL(2U, lock.sequence_count());
+
+      Snapshot snapshot;
+      CHECK(lock.try_read(snapshot));
+      CHECK_EQUAL(12345U, snapshot.sequence);
+      CHECK(is_consistent(snapshot));
+
+      lock.write(make_snapshot(99U));
+      CHECK_EQUAL(4U, lock.sequence_count());
+      CHECK_EQUAL(99U, lock.read().sequence);
+    }
+
+    //*************************************************************************
+    TEST(test_scalar)
+    {
+      etl::seqlock<double> lock(1.5);
+
+      CHECK_CLOSE(1.5, lock.read(), 0.0);
+
+      lock.write(-2.25);
+      CHECK_CLOSE(-2.25, lock.read(), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      etl::seqlock<Snapshot> lock(make_snapshot(0U));
+
+      bool torn = false;
+
+      std::vector<std::thread> readers;
+
+      for (size_t r = 0U; r < Readers; ++r)
+      {
+        readers.push_back(std::thread([&lock, &torn]()
+        {
+          uint32_t last = 0U;
+
+          while (last != Writes)
+          {
+            const Snapshot snapshot = lock.read();
+
+            // Consistent, and never older than the last read.
+            if (!is_consistent(snapshot) || (snapshot.sequence < last))
+            {
+              torn = true;
+            }
+
+            last = snapshot.sequence;
+          }
+        }));
+      }
+
+      std::thread writer([&lock]()
+      {
+        for (uint32_t i = 1U; i <= Writes; ++i)
+        {
+          lock.write(make_snapshot(i));
+        }
+      });
+
+      writer.join();
+
+      for (size_t r = 0U; r < Readers; ++r)
+      {
+        readers[r].join();
+      }
+
+      CHECK(!torn);
+      CHECK_EQUAL(Writes * 2U, lock.sequence_count());
+    }
+  };
+}
+
+#endif
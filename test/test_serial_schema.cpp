@@ -0,0 +1,243 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/serial_schema.h"
+#include "etl/byte_stream.h"
+#include "etl/bit_stream.h"
+
+#include <vector>
+
+namespace
+{
+  //***********************************
+  struct Header
+  {
+    uint16_t id;
+    uint32_t length;
+    int8_t   flags;
+    double   value;
+  };
+
+  typedef etl::serial_schema<Header,
+                             etl::serial_field<Header, uint16_t, &Header::id>,
+                             etl::serial_field<Header, uint32_t, &Header::length>,
+                             etl::serial_field<Header, int8_t,   &Header::flags>,
+                             etl::serial_field<Header, double,   &Header::value>> Header_Schema;
+
+  //***********************************
+  struct Mixed
+  {
+    uint32_t address;
+    int32_t  offset;
+    uint16_t crc;
+  };
+
+  typedef etl::serial_schema<Mixed,
+                             etl::serial_field<Mixed, uint32_t, &Mixed::address, 24U>,
+                             etl::serial_field<Mixed, int32_t,  &Mixed::offset,  24U, etl::endian::little>,
+                             etl::serial_field<Mixed, uint16_t, &Mixed::crc,     16U, etl::endian::little>> Mixed_Schema;
+
+  //***********************************
+  struct Packed
+  {
+    uint8_t  version;
+    uint8_t  type;
+    uint16_t id;
+    bool     urgent;
+    int8_t   delta;
+    uint16_t crc;
+  };
+
+  typedef etl::serial_schema<Packed,
+                             etl::serial_field<Packed, uint8_t,  &Packed::version, 3U>,
+                             etl::serial_field<Packed, uint8_t,  &Packed::type,    5U>,
+                             etl::serial_field<Packed, uint16_t, &Packed::id,      12U>,
+                             etl::serial_field<Packed, bool,     &Packed::urgent,  1U>,
+                             etl::serial_field<Packed, int8_t,   &Packed::delta,   7U>,
+                             etl::serial_field<Packed, uint16_t, &Packed::crc,     16U, etl::endian::little>> Packed_Schema;
+
+  ETL_STATIC_ASSERT(Header_Schema::Bit_Size == 120U, "Wrong bit size");
+  ETL_STATIC_ASSERT(Header_Schema::Byte_Size == 15U, "Wrong byte size");
+  ETL_STATIC_ASSERT(Header_Schema::Is_Byte_Aligned, "Should be byte aligned");
+  ETL_STATIC_ASSERT(Mixed_Schema::Byte_Size == 8U, "Wrong byte size");
+  ETL_STATIC_ASSERT(Packed_Schema::Bit_Size == 44U, "Wrong bit size");
+  ETL_STATIC_ASSERT(Packed_Schema::Byte_Size == 6U, "Wrong byte size");
+  ETL_STATIC_ASSERT(!Packed_Schema::Is_Byte_Aligned, "Should not be byte aligned");
+
+  SUITE(test_serial_schema)
+  {
+    //*************************************************************************
+    TEST(test_byte_aligned_matches_byte_stream)
+    {
+      const Header header = { 0x1234U, 0x56789ABCUL, -2, 3.1415927 };
+
+      char expected[Header_Schema::Byte_Size];
+      etl::byte_stream_writer writer(expected, sizeof(expected), etl::endian::big);
+      writer.write_unchecked(header.id);
+      writer.write_unchecked(header.length);
+      writer.write_unchecked(header.flags);
+      writer.write_unchecked(header.value);
+
+      char actual[Header_Schema::Byte_Size];
+      Header_Schema::encode(header, actual);
+
+      CHECK_ARRAY_EQUAL(expected, actual, Header_Schema::Byte_Size);
+
+      Header decoded = { 0U, 0U, 0, 0.0 };
+      Header_Schema::decode(actual, decoded);
+
+      CHECK_EQUAL(header.id,     decoded.id);
+      CHECK_EQUAL(header.length, decoded.length);
+      CHECK_EQUAL(header.flags,  decoded.flags);
+      CHECK_CLOSE(header.value,  decoded.value, 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_partial_width_and_endianness)
+    {
+      const Mixed mixed = { 0x00ABCDEFUL, -2, 0x1234U };
+
+      char actual[Mixed_Schema::Byte_Size];
+      Mixed_Schema::encode(mixed, actual);
+
+      const unsigned char expected[] = { 0xABU, 0xCDU, 0xEFU, 0xFEU, 0xFFU, 0xFFU, 0x34U, 0x12U };
+
+      for (size_t i = 0U; i < sizeof(expected); ++i)
+      {
+        CHECK_EQUAL(int(expected[i]), int(static_cast<unsigned char>(actual[i])));
+      }
+
+      Mixed decoded = { 0U, 0, 0U };
+      Mixed_Schema::decode(actual, decoded);
+
+      CHECK_EQUAL(mixed.address, decoded.address);
+      CHECK_EQUAL(mixed.offset,  decoded.offset);
+      CHECK_EQUAL(mixed.crc,     decoded.crc);
+    }
+
+    //*************************************************************************
+    TEST(test_packed_matches_bit_stream)
+    {
+      const Packed packed = { 5U, 17U, 0xABCU, true, -3, 0x1234U };
+
+      char expected[Packed_Schema::Byte_Size] = { 0 };
+      etl::bit_stream_writer writer(expected, sizeof(expected), etl::endian::big);
+      writer.write_unchecked(packed.version, 3U);
+      writer.write_unchecked(packed.type,    5U);
+      writer.write_unchecked(packed.id,      12U);
+      writer.write_unchecked(packed.urgent);
+      writer.write_unchecked(packed.delta,   7U);
+      writer.write_unchecked(static_cast<uint16_t>(0x3412U), 16U);
+
+      char actual[Packed_Schema::Byte_Size];
+      Packed_Schema::encode(packed, actual);
+
+      CHECK_ARRAY_EQUAL(expected, actual, Packed_Schema::Byte_Size);
+
+      Packed decoded = { 0U, 0U, 0U, false, 0, 0U };
+      Packed_Schema::decode(actual, decoded);
+
+      CHECK_EQUAL(packed.version, decoded.version);
+      CHECK_EQUAL(packed.type,    decoded.type);
+      CHECK_EQUAL(packed.id,      decoded.id);
+      CHECK_EQUAL(packed.urgent,  decoded.urgent);
+      CHECK_EQUAL(packed.delta,   decoded.delta);
+      CHECK_EQUAL(packed.crc,     decoded.crc);
+    }
+
+    //*************************************************************************
+    TEST(test_write_read_byte_stream)
+    {
+      const Packed packed = { 2U, 9U, 0x123U, false, 63, 0xBEEFU };
+
+      std::vector<char> output;
+      int calls = 0;
+
+      // The delegate refers to the lambda, so it must outlive the writer.
+      auto collect = [&](etl::byte_stream_writer::callback_parameter_type sp)
+                     {
+                       ++calls;
+                       output.insert(output.end(), sp.begin(), sp.end());
+                     };
+
+      etl::byte_stream_writer::callback_type callback(collect);
+
+      char buffer[Packed_Schema::Byte_Size * 2U - 1U];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::big, callback);
+
+      CHECK_TRUE(Packed_Schema::write(writer, packed));
+      CHECK_EQUAL(1, calls);
+      CHECK_EQUAL(Packed_Schema::Byte_Size, writer.size_bytes());
+
+      // Not enough room for a second one.
+      CHECK_FALSE(Packed_Schema::write(writer, packed));
+      CHECK_EQUAL(1, calls);
+      CHECK_EQUAL(Packed_Schema::Byte_Size, writer.size_bytes());
+
+      char expected[Packed_Schema::Byte_Size];
+      Packed_Schema::encode(packed, expected);
+      CHECK_ARRAY_EQUAL(expected, output.data(), Packed_Schema::Byte_Size);
+
+      etl::byte_stream_reader reader(buffer, writer.size_bytes(), etl::endian::big);
+
+      Packed decoded = { 0U, 0U, 0U, true, 0, 0U };
+      CHECK_TRUE(Packed_Schema::read(reader, decoded));
+      CHECK_EQUAL(0U, reader.available_bytes());
+      CHECK_EQUAL(packed.id,    decoded.id);
+      CHECK_EQUAL(packed.delta, decoded.delta);
+      CHECK_EQUAL(packed.crc,   decoded.crc);
+      CHECK_FALSE(decoded.urgent);
+
+      // Nothing left to read.
+      CHECK_FALSE(Packed_Schema::read(reader, decoded));
+    }
+
+#if ETL_USING_CPP17
+    //*************************************************************************
+    TEST(test_serial_member)
+    {
+      typedef etl::serial_schema<Mixed,
+                                 etl::serial_member<&Mixed::address, 24U>,
+                                 etl::serial_member<&Mixed::offset, 24U, etl::endian::little>,
+                                 etl::serial_member<&Mixed::crc, 16U, etl::endian::little>> Schema;
+
+      const Mixed mixed = { 0x00123456UL, -100000, 0xCAFEU };
+
+      char expected[Mixed_Schema::Byte_Size];
+      Mixed_Schema::encode(mixed, expected);
+
+      char actual[Schema::Byte_Size];
+      Schema::encode(mixed, actual);
+
+      CHECK_ARRAY_EQUAL(expected, actual, Schema::Byte_Size);
+    }
+#endif
+  }
+}
@@ -1493,6 +1493,78 @@ namespace
       CHECK(!data.contains(99));
     }
 
+    //*************************************************************************
+    TEST(test_find_sorted)
+    {
+      Data data;
+
+      for (int i = 0; i < 20; i += 2)
+      {
+        data.insert(i);
+      }
+
+      for (int start = -1; start < 3; ++start)
+      {
+        for (int stride = 1; stride < 12; ++stride)
+        {
+          // Ascending by key_comp().
+          std::vector<int> keys;
+
+          for (int key = start; key < 22; key += stride)
+          {
+            keys.push_back(key);
+          }
+
+          std::sort(keys.begin(), keys.end(), data.key_comp());
+
+          std::vector<Data::iterator> found;
+          data.find_sorted(keys.begin(), keys.end(), std::back_inserter(found));
+
+          const Data& cdata = data;
+          std::vector<Data::const_iterator> cfound;
+          cdata.find_sorted(keys.begin(), keys.end(), std::back_inserter(cfound));
+
+          CHECK_EQUAL(keys.size(), found.size());
+          CHECK_EQUAL(keys.size(), cfound.size());
+
+          for (size_t i = 0UL; i < keys.size(); ++i)
+          {
+            CHECK(found[i] == data.find(keys[i]));
+            CHECK(cfound[i] == cdata.find(keys[i]));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_intersect_and_difference_sorted)
+    {
+      etl::set<int, 16> data;
+
+      for (int i = 0; i < 30; i += 3)
+      {
+        data.insert(i);
+      }
+
+      std::vector<int> keys = { 0, 1, 2, 3, 9, 10, 27, 28, 40 };
+
+      std::vector<int> intersection;
+      data.intersect_sorted(keys.begin(), keys.end(), std::back_inserter(intersection));
+
+      std::vector<int> expected_intersection;
+      std::set_intersection(keys.begin(), keys.end(), data.begin(), data.end(), std::back_inserter(expected_intersection));
+      CHECK(expected_intersection == intersection);
+
+      std::vector<int> difference;
+      data.difference_sorted(keys.begin(), keys.end(), std::back_inserter(difference));
+
+      std::vector<int> expected_difference;
+      std::set_difference(keys.begin(), keys.end(), data.begin(), data.end(), std::back_inserter(expected_difference));
+      CHECK(expected_difference == difference);
+
+      CHECK_EQUAL(expected_intersection.size(), data.count_sorted(keys.begin(), keys.end()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_contains_using_transparent_comparator)
     {
@@ -0,0 +1,298 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/sharded_cache.h"
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_MUTEX
+
+namespace
+{
+  typedef etl::sharded_cache<int, int, 16, 4> Cache;
+  typedef Cache::key_value_type               KeyValue;
+
+  //***************************************************************************
+  /// A backing store that holds key * 10 for keys below 1000.
+  //***************************************************************************
+  struct Store
+  {
+    Store()
+      : reads(0)
+      , writes(0)
+    {
+    }
+
+    bool read(KeyValue& key_value)
+    {
+      etl::lock_guard<etl::mutex> lock(access);
+      ++reads;
+
+      if (key_value.first >= 1000)
+      {
+        return false;
+      }
+
+      std::map<int, int>::const_iterator itr = values.find(key_value.first);
+      key_value.second = (itr == values.end()) ? key_value.first * 10 : itr->second;
+
+      return true;
+    }
+
+    void write(const KeyValue& key_value)
+    {
+      etl::lock_guard<etl::mutex> lock(access);
+      ++writes;
+      values[key_value.first] = key_value.second;
+    }
+
+    void attach(Cache& cache)
+    {
+      cache.set_read_function(Cache::read_function_type::create<Store, &Store::read>(*this));
+      cache.set_write_function(Cache::write_function_type::create<Store, &Store::write>(*this));
+    }
+
+    etl::mutex         access;
+    std::map<int, int> values;
+    int                reads;
+    int                writes;
+  };
+
+  SUITE(test_sharded_cache)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Cache cache;
+
+      CHECK_EQUAL(0U, cache.size());
+      CHECK_EQUAL(16U, cache.max_size());
+      CHECK_EQUAL(4U, Cache::SHARDS);
+      CHECK_EQUAL(4U, Cache::SHARD_SIZE);
+
+      Cache::statistics_type statistics = cache.statistics();
+      CHECK_EQUAL(0U, statistics.hits);
+      CHECK_EQUAL(0U, statistics.misses);
+      CHECK_EQUAL(0U, statistics.evictions);
+    }
+
+    //*************************************************************************
+    TEST(test_put_get)
+    {
+      Cache cache;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        cache.put(i, i * 2);
+      }
+
+      for (int i = 0; i < 8; ++i)
+      {
+        int value = 0;
+        CHECK(cache.contains(i));
+        CHECK(cache.get(i, value));
+        CHECK_EQUAL(i * 2, value);
+      }
+
+      int value = 0;
+      CHECK(!cache.get(100, value));
+
+      CHECK_EQUAL(8U, cache.statistics().hits);
+      CHECK_EQUAL(1U, cache.statistics().misses);
+
+      CHECK(cache.erase(3));
+      CHECK(!cache.contains(3));
+      CHECK(!cache.erase(3));
+    }
+
+    //*************************************************************************
+    TEST(test_read_through_and_statistics)
+    {
+      Store store;
+      Cache cache;
+      store.attach(cache);
+
+      int value = 0;
+      CHECK(cache.get(5, value));
+      CHECK_EQUAL(50, value);
+      CHECK(cache.get(5, value));
+      CHECK(!cache.get(2000, value));
+      CHECK_EQUAL(2, store.reads);
+
+      Cache::statistics_type statistics = cache.statistics();
+      CHECK_EQUAL(1U, statistics.hits);
+      CHECK_EQUAL(2U, statistics.misses);
+      CHECK_EQUAL(0U, statistics.evictions);
+
+      // Fill well past capacity, so every shard evicts.
+      for (int i = 0; i < 200; ++i)
+      {
+        cache.get(i, value);
+      }
+
+      CHECK_EQUAL(16U, cache.size());
+
+      statistics = cache.statistics();
+      // 200 distinct keys have been loaded, and 16 remain.
+      CHECK_EQUAL(200U - 16U, statistics.evictions);
+
+      uint32_t shard_evictions = 0U;
+
+      for (size_t s = 0U; s < Cache::SHARDS; ++s)
+      {
+        shard_evictions += cache.statistics(s).evictions;
+      }
+
+      CHECK_EQUAL(statistics.evictions, shard_evictions);
+
+      cache.reset_statistics();
+      CHECK_EQUAL(0U, cache.statistics().misses);
+    }
+
+    //*************************************************************************
+    TEST(test_write_back)
+    {
+      Store store;
+
+      {
+        Cache cache;
+        store.attach(cache);
+        cache.set_write_through(false);
+
+        cache.put(1, 11);
+        cache.put(2, 22);
+        CHECK_EQUAL(0, store.writes);
+
+        cache.flush();
+        CHECK_EQUAL(2, store.writes);
+
+        cache.put(3, 33);
+      }
+
+      // Destruction writes the rest.
+      CHECK_EQUAL(3, store.writes);
+      CHECK_EQUAL(33, store.values[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_get_many)
+    {
+      Store store;
+      Cache cache;
+      store.attach(cache);
+
+      const int keys[] = { 1, 2, 3, 1000, 4, 5, 2 };
+      int  values[7];
+      bool found[7];
+
+      CHECK_EQUAL(6U, cache.get_many(keys, values, found, 7U));
+
+      for (size_t i = 0U; i < 7U; ++i)
+      {
+        CHECK_EQUAL(keys[i] < 1000, found[i]);
+
+        if (found[i])
+        {
+          CHECK_EQUAL(keys[i] * 10, values[i]);
+        }
+      }
+
+      // The repeated key is a hit.
+      CHECK_EQUAL(1U, cache.statistics().hits);
+      CHECK_EQUAL(6U, cache.statistics().misses);
+    }
+
+    //*************************************************************************
+    TEST(test_shards_are_used)
+    {
+      Cache cache;
+      std::vector<int> per_shard(Cache::SHARDS, 0);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        ++per_shard[cache.shard_index(i)];
+      }
+
+      for (size_t s = 0U; s < Cache::SHARDS; ++s)
+      {
+        CHECK(per_shard[s] > 100);
+      }
+    }
+
+#if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      Store store;
+      etl::sharded_cache<int, int, 64, 8> cache;
+      cache.set_read_function(Cache::read_function_type::create<Store, &Store::read>(store));
+
+      std::vector<std::thread> threads;
+      std::vector<int>         errors(4, 0);
+
+      for (int t = 0; t < 4; ++t)
+      {
+        threads.push_back(std::thread([&cache, &errors, t]()
+        {
+          for (int i = 0; i < 20000; ++i)
+          {
+            const int key = (i * 7 + t) % 200;
+            int value = 0;
+
+            if (!cache.get(key, value) || (value != key * 10))
+            {
+              ++errors[t];
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      for (size_t t = 0U; t < errors.size(); ++t)
+      {
+        CHECK_EQUAL(0, errors[t]);
+      }
+
+      const etl::sharded_cache_statistics statistics = cache.statistics();
+      CHECK_EQUAL(4U * 20000U, statistics.hits + statistics.misses);
+      CHECK_EQUAL(int(statistics.misses), store.reads);
+    }
+#endif
+  }
+}
+
+#endif
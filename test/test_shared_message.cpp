@@ -36,6 +36,10 @@ SOFTWARE.
 #include "etl/fixed_sized_memory_block_allocator.h"
 #include "etl/reference_counted_message_pool.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace
 {
   constexpr etl::message_id_t MessageId1 = 1U;
@@ -383,5 +387,73 @@ namespace
 
       CHECK_THROW(message_pool.release(temp), etl::reference_counted_message_pool_release_failure);
     }
+
+    //*************************************************************************
+    TEST(test_lock_free_message_pool)
+    {
+      etl::lock_free_message_pool<2U, Message1, Message2> message_pool;
+
+      CHECK_EQUAL(2U, message_pool.max_size());
+      CHECK_EQUAL(0U, message_pool.size());
+
+      {
+        etl::shared_message sm1(message_pool, Message1(1));
+        etl::shared_message sm2(message_pool, Message2());
+        etl::shared_message sm3(sm1);
+
+        CHECK_EQUAL(2U, message_pool.size());
+        CHECK_EQUAL(0U, message_pool.available());
+        CHECK_EQUAL(2, sm1.get_reference_count());
+        CHECK_THROW(etl::shared_message(message_pool, Message1(2)), etl::reference_counted_message_pool_allocation_failure);
+      }
+
+      CHECK_EQUAL(0U, message_pool.size());
+      CHECK_EQUAL(2U, message_pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_lock_free_message_pool_multiple_threads)
+    {
+      static const int Threads           = 4;
+      static const int Cycles_Per_Thread = 10000;
+
+      etl::lock_free_message_pool<4U, Message1, Message2> message_pool;
+
+      std::atomic<bool> start(false);
+      std::atomic<int>  errors(0);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < Threads; ++t)
+      {
+        threads.emplace_back([&message_pool, &start, &errors, t]()
+        {
+          while (!start.load());
+
+          for (int i = 0; i < Cycles_Per_Thread; ++i)
+          {
+            etl::shared_message sm(message_pool, Message1(t));
+            etl::shared_message copy(sm);
+
+            std::this_thread::yield();
+
+            if (static_cast<const Message1&>(copy.get_message()).i != t)
+            {
+              ++errors;
+            }
+          }
+        });
+      }
+
+      start.store(true);
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(0, errors.load());
+      CHECK_EQUAL(0U, message_pool.size());
+    }
   }
 }
\ No newline at end of file
@@ -0,0 +1,170 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+
+// Yield to the OS once the backoff is exhausted, so that the tests make
+// progress when there are fewer cores than threads.
+#define ETL_SPIN_YIELD() std::this_thread::yield()
+
+#include "etl/shared_mutex.h"
+#include "etl/mutex.h"
+
+#if ETL_HAS_SHARED_MUTEX
+
+namespace
+{
+  SUITE(test_shared_mutex)
+  {
+    //*************************************************************************
+    TEST(test_exclusive)
+    {
+      etl::shared_mutex mutex;
+
+      CHECK(mutex.try_lock());
+      CHECK(!mutex.try_lock());
+      CHECK(!mutex.try_lock_shared());
+      mutex.unlock();
+
+      mutex.lock();
+      CHECK(!mutex.try_lock_shared());
+      mutex.unlock();
+
+      CHECK(mutex.try_lock_shared());
+      mutex.unlock_shared();
+    }
+
+    //*************************************************************************
+    TEST(test_shared)
+    {
+      etl::shared_mutex mutex;
+
+      CHECK(mutex.try_lock_shared());
+      CHECK(mutex.try_lock_shared());
+      mutex.lock_shared();
+
+      // Readers exclude writers.
+      CHECK(!mutex.try_lock());
+
+      mutex.unlock_shared();
+      mutex.unlock_shared();
+      CHECK(!mutex.try_lock());
+
+      mutex.unlock_shared();
+      CHECK(mutex.try_lock());
+      mutex.unlock();
+    }
+
+    //*************************************************************************
+    TEST(test_shared_lock_guard)
+    {
+      etl::shared_mutex mutex;
+
+      {
+        etl::shared_lock_guard<etl::shared_mutex> guard1(mutex);
+        etl::shared_lock_guard<etl::shared_mutex> guard2(mutex);
+        CHECK(!mutex.try_lock());
+      }
+
+      {
+        etl::lock_guard<etl::shared_mutex> guard(mutex);
+        CHECK(!mutex.try_lock_shared());
+      }
+
+      CHECK(mutex.try_lock());
+      mutex.unlock();
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      const size_t Readers = 3U;
+      const size_t Writes  = 5000U;
+
+      etl::shared_mutex mutex;
+
+      // The writer keeps both halves equal. Readers must never see them differ.
+      uint32_t first  = 0U;
+      uint32_t second = 0U;
+      bool     torn   = false;
+      bool     done   = false;
+
+      std::thread writer([&]()
+      {
+        for (uint32_t i = 1U; i <= Writes; ++i)
+        {
+          etl::lock_guard<etl::shared_mutex> guard(mutex);
+          first  = i;
+          second = i;
+        }
+
+        etl::lock_guard<etl::shared_mutex> guard(mutex);
+        done = true;
+      });
+
+      std::vector<std::thread> readers;
+
+      for (size_t r = 0U; r < Readers; ++r)
+      {
+        readers.push_back(std::thread([&]()
+        {
+          bool finished = false;
+
+          while (!finished)
+          {
+            mutex.lock_shared();
+
+            if (first != second)
+            {
+              torn = true;
+            }
+
+            finished = done;
+            mutex.unlock_shared();
+          }
+        }));
+      }
+
+      writer.join();
+
+      for (size_t r = 0U; r < Readers; ++r)
+      {
+        readers[r].join();
+      }
+
+      CHECK(!torn);
+      CHECK_EQUAL(Writes, first);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,399 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/slot_map.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "data.h"
+
+namespace
+{
+  typedef TestDataNDC<std::string> NDC;
+
+  typedef etl::slot_map<int, 10>   SlotMap;
+  typedef etl::slot_map<NDC, 10>   SlotMapNDC;
+  typedef etl::islot_map<int>      ISlotMap;
+  typedef etl::slot_map_handle     Handle;
+
+  SUITE(test_slot_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      SlotMap slot_map;
+
+      CHECK(slot_map.empty());
+      CHECK(!slot_map.full());
+      CHECK_EQUAL(0U, slot_map.size());
+      CHECK_EQUAL(10U, slot_map.max_size());
+      CHECK_EQUAL(10U, slot_map.capacity());
+      CHECK_EQUAL(10U, slot_map.available());
+      CHECK(slot_map.begin() == slot_map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_null_handle)
+    {
+      SlotMap slot_map;
+      slot_map.insert(1);
+
+      Handle handle;
+
+      CHECK(handle.is_null());
+      CHECK(!slot_map.contains(handle));
+      CHECK(slot_map.find(handle) == ETL_NULLPTR);
+      CHECK(!slot_map.erase(handle));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_find)
+    {
+      SlotMap slot_map;
+
+      Handle h1 = slot_map.insert(1);
+      Handle h2 = slot_map.insert(2);
+      Handle h3 = slot_map.emplace(3);
+
+      CHECK(!h1.is_null());
+      CHECK(h1 != h2);
+      CHECK(h2 != h3);
+      CHECK_EQUAL(3U, slot_map.size());
+
+      CHECK(slot_map.contains(h1));
+      CHECK_EQUAL(1, *slot_map.find(h1));
+      CHECK_EQUAL(2, slot_map[h2]);
+      CHECK_EQUAL(3, slot_map.at(h3));
+
+      const SlotMap& const_map = slot_map;
+      CHECK_EQUAL(2, *const_map.find(h2));
+      CHECK_EQUAL(3, const_map[h3]);
+    }
+
+    //*************************************************************************
+    TEST(test_values_are_dense)
+    {
+      SlotMap slot_map;
+
+      slot_map.insert(1);
+      slot_map.insert(2);
+      slot_map.insert(3);
+
+      CHECK_EQUAL(3, std::distance(slot_map.begin(), slot_map.end()));
+      CHECK(slot_map.data() == slot_map.begin());
+      CHECK_EQUAL(1, slot_map.data()[0]);
+      CHECK_EQUAL(2, slot_map.data()[1]);
+      CHECK_EQUAL(3, slot_map.data()[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_makes_handle_stale)
+    {
+      SlotMap slot_map;
+
+      Handle h1 = slot_map.insert(1);
+      Handle h2 = slot_map.insert(2);
+      Handle h3 = slot_map.insert(3);
+
+      CHECK(slot_map.erase(h1));
+      CHECK(!slot_map.erase(h1));
+
+      CHECK(!slot_map.contains(h1));
+      CHECK(slot_map.find(h1) == ETL_NULLPTR);
+      CHECK_THROW(slot_map.at(h1), etl::slot_map_invalid_handle);
+
+      // The last value was moved into the hole, its handle is still valid.
+      CHECK_EQUAL(2U, slot_map.size());
+      CHECK_EQUAL(3, slot_map.data()[0]);
+      CHECK_EQUAL(2, slot_map[h2]);
+      CHECK_EQUAL(3, slot_map[h3]);
+    }
+
+    //*************************************************************************
+    TEST(test_reused_slot_does_not_match_stale_handle)
+    {
+      SlotMap slot_map;
+
+      Handle h1 = slot_map.insert(1);
+      slot_map.erase(h1);
+
+      Handle h2 = slot_map.insert(2);
+
+      CHECK(h1 != h2);
+      CHECK(!slot_map.contains(h1));
+      CHECK(slot_map.contains(h2));
+      CHECK_EQUAL(2, slot_map[h2]);
+    }
+
+    //*************************************************************************
+    TEST(test_unissued_handle_is_not_valid)
+    {
+      SlotMap slot_map;
+
+      Handle h1 = slot_map.insert(1);
+
+      // Same generation, different slot index.
+      Handle forged(h1.value() + 1U);
+
+      CHECK(!slot_map.contains(forged));
+      CHECK(!slot_map.contains(Handle(0xFFFFFFFFUL)));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      SlotMap slot_map;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        slot_map.insert(i);
+      }
+
+      // Erase the odd values.
+      SlotMap::iterator itr = slot_map.begin();
+
+      while (itr != slot_map.end())
+      {
+        if ((*itr % 2) != 0)
+        {
+          itr = slot_map.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(3U, slot_map.size());
+
+      std::vector<int> values(slot_map.begin(), slot_map.end());
+      std::sort(values.begin(), values.end());
+
+      CHECK_EQUAL(0, values[0]);
+      CHECK_EQUAL(2, values[1]);
+      CHECK_EQUAL(4, values[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_get_handle)
+    {
+      SlotMap slot_map;
+
+      Handle h1 = slot_map.insert(1);
+      Handle h2 = slot_map.insert(2);
+      slot_map.erase(h1);
+
+      CHECK(slot_map.get_handle(slot_map.begin()) == h2);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      SlotMap slot_map;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        slot_map.insert(i);
+      }
+
+      CHECK(slot_map.full());
+      CHECK_EQUAL(0U, slot_map.available());
+      CHECK_THROW(slot_map.insert(10), etl::slot_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      SlotMap slot_map;
+
+      Handle h1 = slot_map.insert(1);
+      Handle h2 = slot_map.insert(2);
+
+      slot_map.clear();
+
+      CHECK(slot_map.empty());
+      CHECK(!slot_map.contains(h1));
+      CHECK(!slot_map.contains(h2));
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK(!slot_map.insert(i).is_null());
+      }
+
+      CHECK(!slot_map.contains(h1));
+      CHECK(!slot_map.contains(h2));
+    }
+
+    //*************************************************************************
+    TEST(test_destruction)
+    {
+      int current_count = NDC::get_instance_count();
+
+      {
+        SlotMapNDC slot_map;
+
+        Handle h1 = slot_map.emplace("1");
+        slot_map.emplace("2");
+        slot_map.emplace("3");
+
+        CHECK_EQUAL(current_count + 3, NDC::get_instance_count());
+
+        slot_map.erase(h1);
+        CHECK_EQUAL(current_count + 2, NDC::get_instance_count());
+      }
+
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_keeps_handles)
+    {
+      SlotMap slot_map;
+
+      Handle h1 = slot_map.insert(1);
+      Handle h2 = slot_map.insert(2);
+      Handle h3 = slot_map.insert(3);
+      slot_map.erase(h2);
+
+      SlotMap copy(slot_map);
+
+      CHECK_EQUAL(2U, copy.size());
+      CHECK_EQUAL(1, copy[h1]);
+      CHECK_EQUAL(3, copy[h3]);
+      CHECK(!copy.contains(h2));
+
+      SlotMap assigned;
+      assigned.insert(10);
+      assigned = slot_map;
+
+      CHECK_EQUAL(2U, assigned.size());
+      CHECK_EQUAL(1, assigned[h1]);
+      CHECK_EQUAL(3, assigned[h3]);
+
+      // The free lists are copied too.
+      Handle h4 = slot_map.insert(4);
+      Handle h5 = copy.insert(4);
+      CHECK(h4 == h5);
+    }
+
+    //*************************************************************************
+    TEST(test_move_keeps_handles)
+    {
+      etl::slot_map<std::unique_ptr<int>, 4> slot_map;
+
+      Handle h1 = slot_map.insert(std::unique_ptr<int>(new int(1)));
+      Handle h2 = slot_map.insert(std::unique_ptr<int>(new int(2)));
+
+      etl::slot_map<std::unique_ptr<int>, 4> moved(std::move(slot_map));
+
+      CHECK(slot_map.empty());
+      CHECK_EQUAL(1, *moved[h1]);
+      CHECK_EQUAL(2, *moved[h2]);
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      SlotMap slot_map;
+      ISlotMap& islot_map = slot_map;
+
+      Handle h1 = islot_map.insert(1);
+
+      CHECK_EQUAL(1, slot_map[h1]);
+      CHECK_EQUAL(10U, islot_map.max_size());
+    }
+
+    //*************************************************************************
+    TEST(test_churn_against_std_map)
+    {
+      etl::slot_map<int, 64> slot_map;
+      std::map<uint32_t, int> compare;
+      std::vector<Handle> stale;
+
+      uint32_t seed = 12345U;
+      int next_value = 0;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const uint32_t r = seed >> 16U;
+
+        if (((r % 3U) != 0U) && !slot_map.full())
+        {
+          Handle h = slot_map.insert(next_value);
+          compare[h.value()] = next_value;
+          ++next_value;
+        }
+        else if (!compare.empty())
+        {
+          std::map<uint32_t, int>::iterator itr = compare.begin();
+          std::advance(itr, r % compare.size());
+
+          Handle h(itr->first);
+          CHECK(slot_map.erase(h));
+          compare.erase(itr);
+          stale.push_back(h);
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), slot_map.size());
+
+      for (std::map<uint32_t, int>::const_iterator itr = compare.begin(); itr != compare.end(); ++itr)
+      {
+        const int* p = slot_map.find(Handle(itr->first));
+        CHECK(p != ETL_NULLPTR);
+        if (p != ETL_NULLPTR)
+        {
+          CHECK_EQUAL(itr->second, *p);
+        }
+      }
+
+      // No stale handle matches, unless its generation has wrapped around to a live handle.
+      for (size_t i = 0U; i < stale.size(); ++i)
+      {
+        if (compare.find(stale[i].value()) == compare.end())
+        {
+          CHECK(!slot_map.contains(stale[i]));
+        }
+      }
+
+      // Each live handle maps back from its value.
+      for (etl::slot_map<int, 64>::const_iterator itr = slot_map.begin(); itr != slot_map.end(); ++itr)
+      {
+        CHECK_EQUAL(*itr, compare[slot_map.get_handle(itr).value()]);
+      }
+    }
+  }
+}
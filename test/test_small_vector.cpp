@@ -0,0 +1,370 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "etl/small_vector.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#include "data.h"
+
+namespace
+{
+  typedef etl::small_vector<int, 4> Data;
+  typedef etl::ismall_vector<int>   IData;
+  typedef std::vector<int>          Compare_Data;
+
+  typedef TestDataM<int>              ItemM;
+  typedef etl::small_vector<ItemM, 2> DataM;
+
+  //***************************************************************************
+  /// Counts the blocks that are currently allocated.
+  //***************************************************************************
+  template <size_t Block_Size, size_t Alignment, size_t Size>
+  class CountingAllocator : public etl::fixed_sized_memory_block_allocator<Block_Size, Alignment, Size>
+  {
+  public:
+
+    typedef etl::fixed_sized_memory_block_allocator<Block_Size, Alignment, Size> base_t;
+
+    size_t size() const
+    {
+      return count;
+    }
+
+  protected:
+
+    void* allocate_block(size_t required_size, size_t required_alignment) override
+    {
+      void* p = base_t::allocate_block(required_size, required_alignment);
+
+      if (p != nullptr)
+      {
+        ++count;
+      }
+
+      return p;
+    }
+
+    bool release_block(const void* const pblock) override
+    {
+      bool released = base_t::release_block(pblock);
+
+      if (released)
+      {
+        --count;
+      }
+
+      return released;
+    }
+
+  private:
+
+    size_t count = 0U;
+  };
+
+  typedef CountingAllocator<sizeof(int) * 16U, alignof(int), 4>     Allocator;
+  typedef CountingAllocator<sizeof(ItemM) * 8U, alignof(ItemM), 2> AllocatorM;
+
+  SUITE(test_small_vector)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(4U, data.capacity());
+      CHECK_EQUAL(4U, data.inline_capacity());
+      CHECK(data.is_inline());
+      CHECK(data.get_allocator() == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_stays_inline)
+    {
+      Allocator allocator;
+      Data data(allocator);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK(data.is_inline());
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(0U, allocator.size());
+
+      Compare_Data compare = { 0, 1, 2, 3 };
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_spills_to_allocator)
+    {
+      Allocator allocator;
+      Data data(allocator);
+      Compare_Data compare;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(i);
+        compare.push_back(i);
+      }
+
+      CHECK(!data.is_inline());
+      CHECK_EQUAL(1U, allocator.size());
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(data.capacity() >= 10U);
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_own_element_while_spilling)
+    {
+      Allocator allocator;
+      Data data(allocator);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data.push_back(i + 10);
+      }
+
+      data.push_back(data[1]);
+
+      CHECK_EQUAL(5U, data.size());
+      CHECK_EQUAL(11, data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_full_without_allocator)
+    {
+      Data data;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK_THROW(data.push_back(4), etl::small_vector_full);
+      CHECK_EQUAL(4U, data.size());
+      CHECK(data.is_inline());
+    }
+
+    //*************************************************************************
+    TEST(test_full_when_allocator_exhausted)
+    {
+      Allocator allocator;
+      Data data(allocator);
+
+      CHECK_THROW(data.resize(17U), etl::small_vector_full);
+      CHECK(data.empty());
+      CHECK(data.is_inline());
+
+      data.resize(16U, 7);
+      CHECK_EQUAL(16U, data.size());
+      CHECK_EQUAL(16U, data.capacity());
+      CHECK_THROW(data.push_back(1), etl::small_vector_full);
+      CHECK_EQUAL(16U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_release_on_destruction)
+    {
+      Allocator allocator;
+
+      {
+        Data data(allocator);
+        data.resize(8U);
+        CHECK_EQUAL(1U, allocator.size());
+      }
+
+      CHECK_EQUAL(0U, allocator.size());
+    }
+
+    //*************************************************************************
+    TEST(test_shrink_to_fit_moves_inline)
+    {
+      Allocator allocator;
+      Data data(allocator);
+
+      data.assign(10U, 3);
+      CHECK(!data.is_inline());
+
+      data.erase(data.begin() + 2, data.end());
+      data.shrink_to_fit();
+
+      CHECK(data.is_inline());
+      CHECK_EQUAL(0U, allocator.size());
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(3, data[0]);
+      CHECK_EQUAL(3, data[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_reserve)
+    {
+      Allocator allocator;
+      Data data(allocator);
+
+      data.reserve(3U);
+      CHECK(data.is_inline());
+
+      data.reserve(12U);
+      CHECK(!data.is_inline());
+      CHECK_EQUAL(12U, data.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase)
+    {
+      Allocator allocator;
+      Data data(allocator);
+      Compare_Data compare;
+
+      for (int i = 0; i < 12; ++i)
+      {
+        size_t index = (size_t(i) * 7U) % (data.size() + 1U);
+        data.insert(data.begin() + index, i);
+        compare.insert(compare.begin() + index, i);
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+
+      data.erase(data.begin() + 3);
+      compare.erase(compare.begin() + 3);
+      data.erase(data.begin() + 1, data.begin() + 5);
+      compare.erase(compare.begin() + 1, compare.begin() + 5);
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data;
+      data.push_back(1);
+
+      CHECK_EQUAL(1, data.at(0));
+      CHECK_THROW(data.at(1), etl::small_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_back_empty)
+    {
+      Data data;
+
+      CHECK_THROW(data.pop_back(), etl::small_vector_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_constructor_and_assignment)
+    {
+      Allocator allocator;
+      Data data({ 1, 2, 3, 4, 5, 6 }, allocator);
+
+      Data copy(data);
+      CHECK(copy == data);
+      CHECK(copy.get_allocator() == &allocator);
+      CHECK_EQUAL(2U, allocator.size());
+
+      Data other(allocator);
+      other.push_back(9);
+      other = data;
+      CHECK(other == data);
+
+      IData& idata = other;
+      idata.assign(2U, 5);
+      CHECK(other != data);
+      CHECK(other > data);
+    }
+
+    //*************************************************************************
+    TEST(test_move_steals_block)
+    {
+      Allocator allocator;
+      Data data({ 1, 2, 3, 4, 5, 6 }, allocator);
+      const int* p = data.data();
+
+      Data moved(std::move(data));
+
+      CHECK_EQUAL(p, moved.data());
+      CHECK_EQUAL(6U, moved.size());
+      CHECK_EQUAL(1U, allocator.size());
+      CHECK(data.empty());
+      CHECK(data.is_inline());
+    }
+
+    //*************************************************************************
+    TEST(test_move_only_type)
+    {
+      AllocatorM allocator;
+
+      {
+        DataM data(allocator);
+
+        for (int i = 0; i < 5; ++i)
+        {
+          data.emplace_back(i);
+        }
+
+        data.insert(data.begin(), ItemM(-1));
+        data.push_back(ItemM(5));
+
+        CHECK_EQUAL(7U, data.size());
+        CHECK(!data.is_inline());
+
+        for (size_t i = 0U; i < data.size(); ++i)
+        {
+          CHECK(bool(data[i]));
+          CHECK_EQUAL(int(i) - 1, data[i].value);
+        }
+
+        DataM moved(std::move(data));
+        CHECK_EQUAL(7U, moved.size());
+        CHECK_EQUAL(7U, ItemM::get_instance_count());
+
+        moved.erase(moved.begin() + 2, moved.end());
+        moved.shrink_to_fit();
+        CHECK(moved.is_inline());
+        CHECK_EQUAL(2U, ItemM::get_instance_count());
+      }
+
+      CHECK_EQUAL(0U, ItemM::get_instance_count());
+      CHECK_EQUAL(0U, allocator.size());
+    }
+  };
+}
@@ -0,0 +1,221 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/soa_vector.h"
+
+#include <string>
+#include <numeric>
+
+namespace
+{
+  // Position, velocity and name columns.
+  typedef etl::soa_vector<8, float, float, std::string> Particles;
+
+  enum
+  {
+    Position,
+    Velocity,
+    Name
+  };
+
+  SUITE(test_soa_vector)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Particles particles;
+
+      CHECK(particles.empty());
+      CHECK(!particles.full());
+      CHECK_EQUAL(0U, particles.size());
+      CHECK_EQUAL(8U, particles.max_size());
+      CHECK_EQUAL(8U, particles.available());
+      CHECK_EQUAL(3U, Particles::Columns);
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_and_access)
+    {
+      Particles particles;
+
+      particles.push_back(1.0f, 0.5f, std::string("a"));
+      particles.push_back(2.0f, 1.5f, "b");
+
+      CHECK_EQUAL(2U, particles.size());
+
+      CHECK_EQUAL(1.0f, particles.get<Position>(0));
+      CHECK_EQUAL(1.5f, particles.get<Velocity>(1));
+      CHECK_EQUAL("b",  particles.get<Name>(1));
+
+      Particles::reference record = particles[0];
+      record.get<Position>() = 10.0f;
+      etl::get<Name>(record) = "c";
+
+      CHECK_EQUAL(10.0f, particles.get<Position>(0));
+      CHECK_EQUAL("c",   particles.get<Name>(0));
+
+      const Particles& cparticles = particles;
+      CHECK_EQUAL(0.5f, etl::get<Velocity>(cparticles.at(0)));
+
+      CHECK_THROW(particles.at(2), etl::soa_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_columns_are_contiguous)
+    {
+      Particles particles;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        particles.push_back(float(i), 1.0f, "");
+      }
+
+      // A per field kernel.
+      etl::span<float> positions  = particles.column<Position>();
+      etl::span<float> velocities = particles.column<Velocity>();
+
+      CHECK_EQUAL(5U, positions.size());
+      CHECK(positions.data() == particles.data<Position>());
+
+      for (size_t i = 0U; i < positions.size(); ++i)
+      {
+        positions[i] += velocities[i];
+      }
+
+      CHECK_EQUAL(15.0f, std::accumulate(positions.begin(), positions.end(), 0.0f));
+      CHECK_EQUAL(5.0f,  std::accumulate(velocities.begin(), velocities.end(), 0.0f));
+    }
+
+    //*************************************************************************
+    TEST(test_append)
+    {
+      const float       positions[3]  = { 1.0f, 2.0f, 3.0f };
+      const float       velocities[3] = { 4.0f, 5.0f, 6.0f };
+      const std::string names[3]      = { "x", "y", "z" };
+
+      Particles particles;
+      particles.push_back(0.0f, 0.0f, "o");
+      particles.append(3U, positions, velocities, names);
+
+      CHECK_EQUAL(4U, particles.size());
+      CHECK_EQUAL(3.0f, particles.get<Position>(3));
+      CHECK_EQUAL(6.0f, particles.get<Velocity>(3));
+      CHECK_EQUAL("z",  particles.get<Name>(3));
+
+      particles.append(3U, positions, velocities, names);
+      CHECK_EQUAL(7U, particles.size());
+
+      CHECK_THROW(particles.append(3U, positions, velocities, names), etl::soa_vector_full);
+      CHECK_EQUAL(7U, particles.size());
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Particles particles;
+
+      for (int i = 0; i < 6; ++i)
+      {
+        particles.push_back(float(i), float(-i), std::string(1, char('a' + i)));
+      }
+
+      particles.erase(1U);
+
+      CHECK_EQUAL(5U, particles.size());
+      CHECK_EQUAL(2.0f, particles.get<Position>(1));
+      CHECK_EQUAL("c",  particles.get<Name>(1));
+
+      // Erase "c", "d".
+      particles.erase(1U, 3U);
+
+      CHECK_EQUAL(3U, particles.size());
+      CHECK_EQUAL(0.0f,  particles.get<Position>(0));
+      CHECK_EQUAL(4.0f,  particles.get<Position>(1));
+      CHECK_EQUAL(-5.0f, particles.get<Velocity>(2));
+      CHECK_EQUAL("f",   particles.get<Name>(2));
+
+      CHECK_THROW(particles.erase(2U, 4U), etl::soa_vector_out_of_bounds);
+
+      particles.pop_back();
+      CHECK_EQUAL(2U, particles.size());
+      CHECK_EQUAL("e", particles.get<Name>(1));
+    }
+
+    //*************************************************************************
+    TEST(test_resize_and_clear)
+    {
+      Particles particles;
+
+      particles.push_back(1.0f, 2.0f, "a");
+      particles.resize(4U);
+
+      CHECK_EQUAL(4U, particles.size());
+      CHECK_EQUAL(1.0f, particles.get<Position>(0));
+      CHECK_EQUAL(0.0f, particles.get<Position>(3));
+      CHECK_EQUAL("",   particles.get<Name>(3));
+
+      particles.resize(1U);
+      CHECK_EQUAL(1U, particles.size());
+
+      CHECK_THROW(particles.resize(9U), etl::soa_vector_full);
+
+      particles.clear();
+      CHECK(particles.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Particles particles;
+      particles.push_back(1.0f, 2.0f, "a");
+      particles.push_back(3.0f, 4.0f, "b");
+
+      Particles copy(particles);
+      CHECK_EQUAL(2U, copy.size());
+      CHECK_EQUAL("b", copy.get<Name>(1));
+
+      Particles moved(etl::move(copy));
+      CHECK_EQUAL(2U, moved.size());
+      CHECK(copy.empty());
+      CHECK_EQUAL(3.0f, moved.get<Position>(1));
+
+      Particles assigned;
+      assigned.push_back(9.0f, 9.0f, "z");
+      assigned = particles;
+      CHECK_EQUAL(2U, assigned.size());
+      CHECK_EQUAL("a", assigned.get<Name>(0));
+
+      assigned = etl::move(moved);
+      CHECK_EQUAL(2U, assigned.size());
+      CHECK(moved.empty());
+    }
+  };
+}
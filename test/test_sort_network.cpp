@@ -0,0 +1,216 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/sort_network.h"
+#include "etl/functional.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  //*************************************************************************
+  // Checks that the network sorts every 0/1 input, which proves that it
+  // sorts every input (the 0-1 principle).
+  //*************************************************************************
+  template <size_t N>
+  bool sorts_all_zero_one_inputs()
+  {
+    for (uint32_t bits = 0U; bits < (uint32_t(1U) << N); ++bits)
+    {
+      int data[N];
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        data[i] = (bits >> i) & 1U;
+      }
+
+      etl::sort_network<N>(data);
+
+      if (!std::is_sorted(data, data + N))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  template <size_t N>
+  bool sorts_random_inputs()
+  {
+    uint32_t seed = 12345U;
+
+    for (int test = 0; test < 200; ++test)
+    {
+      int data[N];
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        data[i] = int((seed >> 16) % 50U) - 25;
+      }
+
+      std::vector<int> expected(data, data + N);
+      std::sort(expected.begin(), expected.end());
+
+      etl::sort_network<N>(data);
+
+      if (!std::equal(expected.begin(), expected.end(), data))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_sort_network)
+  {
+    //*************************************************************************
+    TEST(test_zero_one_principle)
+    {
+      CHECK(sorts_all_zero_one_inputs<2>());
+      CHECK(sorts_all_zero_one_inputs<3>());
+      CHECK(sorts_all_zero_one_inputs<4>());
+      CHECK(sorts_all_zero_one_inputs<5>());
+      CHECK(sorts_all_zero_one_inputs<6>());
+      CHECK(sorts_all_zero_one_inputs<7>());
+      CHECK(sorts_all_zero_one_inputs<8>());
+      CHECK(sorts_all_zero_one_inputs<9>());
+      CHECK(sorts_all_zero_one_inputs<10>());
+      CHECK(sorts_all_zero_one_inputs<11>());
+      CHECK(sorts_all_zero_one_inputs<12>());
+      CHECK(sorts_all_zero_one_inputs<13>());
+      CHECK(sorts_all_zero_one_inputs<14>());
+      CHECK(sorts_all_zero_one_inputs<15>());
+      CHECK(sorts_all_zero_one_inputs<16>());
+      CHECK(sorts_all_zero_one_inputs<17>());
+      CHECK(sorts_all_zero_one_inputs<20>());
+    }
+
+    //*************************************************************************
+    TEST(test_random_inputs)
+    {
+      CHECK(sorts_random_inputs<18>());
+      CHECK(sorts_random_inputs<21>());
+      CHECK(sorts_random_inputs<24>());
+      CHECK(sorts_random_inputs<25>());
+      CHECK(sorts_random_inputs<31>());
+      CHECK(sorts_random_inputs<32>());
+    }
+
+    //*************************************************************************
+    TEST(test_trivial_sizes)
+    {
+      int data[2] = { 2, 1 };
+
+      etl::sort_network<0>(data);
+      etl::sort_network<1>(data);
+
+      CHECK_EQUAL(2, data[0]);
+      CHECK_EQUAL(1, data[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_compare)
+    {
+      double data[7] = { 3.0, -1.5, 7.25, 0.0, 7.25, 2.0, -8.0 };
+      double expected[7] = { 7.25, 7.25, 3.0, 2.0, 0.0, -1.5, -8.0 };
+
+      etl::sort_network<7>(data, etl::greater<double>());
+
+      CHECK_ARRAY_EQUAL(expected, data, 7);
+    }
+
+    //*************************************************************************
+    TEST(test_non_arithmetic_type)
+    {
+      std::string data[6] = { "delta", "alpha", "foxtrot", "charlie", "echo", "bravo" };
+      std::string expected[6] = { "alpha", "bravo", "charlie", "delta", "echo", "foxtrot" };
+
+      etl::sort_network<6>(data);
+
+      CHECK_ARRAY_EQUAL(expected, data, 6);
+    }
+
+    //*************************************************************************
+    TEST(test_iterator)
+    {
+      std::vector<int> data;
+
+      for (int i = 0; i < 12; ++i)
+      {
+        data.push_back((i * 7) % 12);
+      }
+
+      // Sort the middle eight.
+      etl::sort_network<8>(data.begin() + 2);
+
+      CHECK(std::is_sorted(data.begin() + 2, data.begin() + 10));
+      CHECK_EQUAL(0,  data[0]);
+      CHECK_EQUAL(7,  data[1]);
+      CHECK_EQUAL(10, data[10]);
+      CHECK_EQUAL(5,  data[11]);
+    }
+
+    //*************************************************************************
+    TEST(test_median_of)
+    {
+      const int data5[5] = { 9, 1, 7, 3, 5 };
+      const int data7[7] = { 40, 10, 70, 20, 60, 30, 50 };
+      const int data8[8] = { 8, 7, 6, 5, 4, 3, 2, 1 };
+      const int data9[9] = { 1, 1, 1, 9, 9, 9, 5, 1, 9 };
+
+      CHECK_EQUAL(5,  etl::median_of<5>(data5));
+      CHECK_EQUAL(40, etl::median_of<7>(data7));
+      CHECK_EQUAL(4,  etl::median_of<8>(data8));
+      CHECK_EQUAL(5,  etl::median_of<9>(data9));
+      CHECK_EQUAL(7,  etl::median_of<1>(data8 + 1));
+
+      // The input is unchanged.
+      CHECK_EQUAL(9, data5[0]);
+      CHECK_EQUAL(1, data5[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_median_of_compare)
+    {
+      const int data[5] = { 9, 1, 7, 3, 5 };
+
+      CHECK_EQUAL(5, etl::median_of<5>(data, etl::greater<int>()));
+      CHECK_EQUAL(5, etl::median_of<4>(data + 1, etl::greater<int>()));
+    }
+  }
+}
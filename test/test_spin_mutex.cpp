@@ -0,0 +1,144 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+
+// Yield to the OS once the backoff is exhausted, so that the tests make
+// progress when there are fewer cores than threads.
+#define ETL_SPIN_YIELD() std::this_thread::yield()
+
+#include "etl/spin_mutex.h"
+#include "etl/mutex.h"
+
+#if ETL_HAS_SPIN_MUTEX
+
+namespace
+{
+  const size_t Thread_Count = 4U;
+  const size_t Increments   = 20000U;
+
+  //***************************************************************************
+  template <typename TMutex>
+  struct Shared
+  {
+    Shared()
+      : count(0U)
+    {
+    }
+
+    void increment()
+    {
+      for (size_t i = 0U; i < Increments; ++i)
+      {
+        etl::lock_guard<TMutex> guard(mutex);
+        ++count;
+      }
+    }
+
+    TMutex mutex;
+    size_t count;
+  };
+
+  //***************************************************************************
+  template <typename TMutex>
+  size_t count_with_threads()
+  {
+    Shared<TMutex> shared;
+
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0U; i < Thread_Count; ++i)
+    {
+      threads.push_back(std::thread(&Shared<TMutex>::increment, &shared));
+    }
+
+    for (size_t i = 0U; i < Thread_Count; ++i)
+    {
+      threads[i].join();
+    }
+
+    return shared.count;
+  }
+
+  SUITE(test_spin_mutex)
+  {
+    //*************************************************************************
+    TEST(test_spin_mutex_lock_unlock)
+    {
+      etl::spin_mutex mutex;
+
+      CHECK(mutex.try_lock());
+      CHECK(!mutex.try_lock());
+      mutex.unlock();
+
+      mutex.lock();
+      CHECK(!mutex.try_lock());
+      mutex.unlock();
+      CHECK(mutex.try_lock());
+      mutex.unlock();
+    }
+
+    //*************************************************************************
+    TEST(test_ticket_mutex_lock_unlock)
+    {
+      etl::ticket_mutex mutex;
+
+      CHECK(mutex.try_lock());
+      CHECK(!mutex.try_lock());
+      mutex.unlock();
+
+      for (int i = 0; i < 3; ++i)
+      {
+        mutex.lock();
+        CHECK(!mutex.try_lock());
+        mutex.unlock();
+      }
+
+      CHECK(mutex.try_lock());
+      mutex.unlock();
+    }
+
+    //*************************************************************************
+    TEST(test_spin_mutex_threads)
+    {
+      CHECK_EQUAL(Thread_Count * Increments, count_with_threads<etl::spin_mutex>());
+    }
+
+    //*************************************************************************
+    TEST(test_ticket_mutex_threads)
+    {
+      CHECK_EQUAL(Thread_Count * Increments, count_with_threads<etl::ticket_mutex>());
+    }
+  };
+}
+
+#endif
@@ -160,5 +160,20 @@ namespace
       variance_result = standard_deviation.get_variance();
       CHECK_CLOSE(9.17, variance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_double_standard_deviation_add_span_and_merge)
+    {
+      etl::standard_deviation<etl::standard_deviation_type::Sample, double> standard_deviation1;
+      etl::standard_deviation<etl::standard_deviation_type::Sample, double> standard_deviation2;
+
+      standard_deviation1.add(etl::span<const double>(input_d.data(), 5U));
+      standard_deviation2.add(etl::span<const double>(input_d.data() + 5U, 5U));
+      standard_deviation1.merge(standard_deviation2);
+
+      CHECK_EQUAL(input_d.size(), standard_deviation1.count());
+      CHECK_CLOSE(3.03, standard_deviation1.get_standard_deviation(), 0.01);
+      CHECK_CLOSE(9.17, standard_deviation1.get_variance(), 0.01);
+    }
   };
 }
@@ -35,6 +35,7 @@ SOFTWARE.
 
 #include <iterator>
 #include <iostream>
+#include <string>
 
 namespace
 {
@@ -240,6 +241,66 @@ namespace
                       3,
                       StateId::IDLE> motorControlStateChart;
 
+#if ETL_USING_CPP14
+  etl::state_chart_ct<MotorControl,
+                      motorControl,
+                      transitionTable,
+                      7,
+                      stateTable,
+                      3,
+                      StateId::IDLE,
+                      etl::state_chart_traits::indexed_lookup> motorControlIndexedStateChart;
+
+  //***************************************************************************
+  // Records the actions taken, to compare the lookups.
+  //***************************************************************************
+  struct Recorder
+  {
+    void A()      { log.push_back('A'); }
+    void B()      { log.push_back('B'); }
+    void C()      { log.push_back('C'); }
+    void D()      { log.push_back('D'); }
+    void Enter()  { log.push_back('+'); }
+    void Exit()   { log.push_back('-'); }
+    bool Fail()   { log.push_back('?'); return false; }
+
+    std::string log;
+  };
+
+  using recorder_transition = etl::state_chart_traits::transition<Recorder>;
+  using recorder_state      = etl::state_chart_traits::state<Recorder>;
+
+  // Transitions from any state interleaved with those from a state, with guards.
+  constexpr recorder_transition recorderTransitionTable[8] =
+  {
+    recorder_transition(1, 0, 1, &Recorder::A, &Recorder::Fail),
+    recorder_transition(   0, 2, &Recorder::B, &Recorder::Fail),
+    recorder_transition(1, 0, 1, &Recorder::C),
+    recorder_transition(   0, 0, &Recorder::D),
+    recorder_transition(2, 1, 1, &Recorder::A),
+    recorder_transition(   1, 2, &Recorder::B),
+    recorder_transition(0, 1, 3),
+    recorder_transition(3, 0, 1)
+  };
+
+  // A duplicate state, and a gap in the ids.
+  constexpr recorder_state recorderStateTable[4] =
+  {
+    recorder_state(1, &Recorder::Enter, &Recorder::Exit),
+    recorder_state(2, &Recorder::Enter, nullptr),
+    recorder_state(1, nullptr,          nullptr),
+    recorder_state(5, &Recorder::Enter, &Recorder::Exit)
+  };
+
+  Recorder linearRecorder;
+  Recorder indexedRecorder;
+
+  etl::state_chart_ct<Recorder, linearRecorder, recorderTransitionTable, 8, recorderStateTable, 4, 0> linearRecorderStateChart;
+
+  etl::state_chart_ct<Recorder, indexedRecorder, recorderTransitionTable, 8, recorderStateTable, 4, 0,
+                      etl::state_chart_traits::indexed_lookup> indexedRecorderStateChart;
+#endif
+
   SUITE(test_state_chart_compile_time)
   {
     //*************************************************************************
@@ -608,5 +669,63 @@ namespace
       motorControlStateChart.process_event(EventId::ABORT);
       CHECK_EQUAL(StateId::IDLE, int(motorControlStateChart.get_state_id()));
     }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_state_chart_indexed_lookup)
+    {
+      motorControl.ClearStatistics();
+      motorControl.guard = false;
+      motorControlIndexedStateChart.start();
+
+      CHECK_EQUAL(true, motorControl.entered_idle);
+
+      // Guard fails, so the next transition for Start from Idle is taken.
+      motorControlIndexedStateChart.process_event(EventId::START);
+      CHECK_EQUAL(StateId::IDLE, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(1, motorControl.null);
+
+      motorControl.guard = true;
+      motorControlIndexedStateChart.process_event(EventId::START);
+      CHECK_EQUAL(StateId::RUNNING, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(true, motorControl.isLampOn);
+
+      // Unhandled.
+      motorControlIndexedStateChart.process_event(EventId::STOPPED);
+      CHECK_EQUAL(StateId::RUNNING, int(motorControlIndexedStateChart.get_state_id()));
+
+      motorControlIndexedStateChart.process_event(EventId::SET_SPEED);
+      CHECK_EQUAL(1, motorControl.setSpeedCount);
+
+      motorControlIndexedStateChart.process_event(EventId::STOP);
+      CHECK_EQUAL(StateId::WINDING_DOWN, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(1, motorControl.windingDown);
+
+      // From any state.
+      motorControlIndexedStateChart.process_event(EventId::ABORT);
+      CHECK_EQUAL(StateId::IDLE, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(0, motorControl.windingDown);
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart_indexed_lookup_same_as_linear)
+    {
+      const etl::state_chart_traits::event_id_t events[] = { 0, 0, 1, 0, 1, 1, 0, 0, 0, 1, 1, 1 };
+
+      linearRecorderStateChart.start();
+      indexedRecorderStateChart.start();
+
+      for (size_t i = 0U; i < ETL_OR_STD17::size(events); ++i)
+      {
+        linearRecorderStateChart.process_event(events[i]);
+        indexedRecorderStateChart.process_event(events[i]);
+
+        CHECK_EQUAL(int(linearRecorderStateChart.get_state_id()), int(indexedRecorderStateChart.get_state_id()));
+      }
+
+      CHECK_EQUAL(std::string("?D?DB+?DB"), linearRecorder.log.substr(0, 9));
+      CHECK_EQUAL(linearRecorder.log, indexedRecorder.log);
+    }
+#endif
   };
 }
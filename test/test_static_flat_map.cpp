@@ -0,0 +1,173 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <string>
+
+#include "etl/static_flat_map.h"
+
+namespace
+{
+  typedef etl::static_flat_map<int, std::string, 100> Data;
+  typedef Data::value_type                            Pair;
+
+  //*************************************************************************
+  std::vector<Pair> make_pairs(size_t n)
+  {
+    std::vector<Pair> pairs;
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      const int key = int((i * 37U) % 101U) * 2;
+      pairs.push_back(Pair(key, std::to_string(key)));
+    }
+
+    return pairs;
+  }
+
+  SUITE(test_static_flat_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(100U, data.max_size());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(1) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_iteration_and_search_against_std_map)
+    {
+      for (size_t n = 1U; n <= 100U; ++n)
+      {
+        std::vector<Pair>          pairs = make_pairs(n);
+        std::map<int, std::string> compare(pairs.begin(), pairs.end());
+        Data                       data(pairs.begin(), pairs.end());
+
+        CHECK_EQUAL(compare.size(), data.size());
+
+        std::map<int, std::string>::const_iterator expected = compare.begin();
+
+        for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr, ++expected)
+        {
+          CHECK_EQUAL(expected->first,  itr->first);
+          CHECK_EQUAL(expected->second, itr->second);
+          CHECK_EQUAL(expected->first,  itr.key());
+          CHECK_EQUAL(expected->second, itr.mapped());
+        }
+
+        for (int key = -1; key <= 203; ++key)
+        {
+          CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+          CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+          CHECK_EQUAL(compare.count(key), data.count(key));
+
+          if (compare.count(key) == 1U)
+          {
+            CHECK_EQUAL(compare.at(key), data.at(key));
+            CHECK_EQUAL(key, (*data.find(key)).first);
+          }
+          else
+          {
+            CHECK(data.find(key) == data.end());
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_reverse_iteration)
+    {
+      Data data = { { 3, "3" }, { 1, "1" }, { 2, "2" } };
+
+      Data::const_reverse_iterator itr = data.rbegin();
+
+      CHECK_EQUAL(3, (*itr++).first);
+      CHECK_EQUAL(2, (*itr++).first);
+      CHECK_EQUAL(1, (*itr++).first);
+      CHECK(itr == data.rend());
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data = { { 3, "3" }, { 1, "1" }, { 2, "2" } };
+
+      data.at(2) = "two";
+
+      CHECK_EQUAL(std::string("two"), data.at(2));
+      CHECK_EQUAL(std::string("two"), data.find(2)->second);
+
+      const Data& cdata = data;
+
+      CHECK_EQUAL(std::string("3"), cdata.at(3));
+      CHECK_THROW(cdata.at(4), etl::static_flat_map_out_of_bounds);
+      CHECK_THROW(data.at(0),  etl::static_flat_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      std::vector<Pair> pairs = make_pairs(101U);
+
+      CHECK_THROW(Data(pairs.begin(), pairs.end()), etl::static_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_duplicate)
+    {
+      CHECK_THROW(Data({ { 1, "1" }, { 1, "one" } }), etl::static_flat_map_duplicate);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      static constexpr etl::static_flat_map<int, char, 8> data = { { 40, 'd' }, { 10, 'a' }, { 30, 'c' }, { 20, 'b' } };
+
+      static constexpr char at_30       = data.at(30);
+      static constexpr bool contains_35 = data.contains(35);
+      static constexpr int  lower_35    = data.lower_bound(35).key();
+      static constexpr char smallest    = data.begin().mapped();
+
+      CHECK_EQUAL('c', at_30);
+      CHECK(!contains_35);
+      CHECK_EQUAL(40, lower_35);
+      CHECK_EQUAL('a', smallest);
+    }
+#endif
+  }
+}
@@ -0,0 +1,183 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <string>
+
+#include "etl/static_flat_set.h"
+
+namespace
+{
+  typedef etl::static_flat_set<int, 100> Data;
+
+  //*************************************************************************
+  std::vector<int> make_keys(size_t n)
+  {
+    std::vector<int> keys;
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      keys.push_back(int((i * 37U) % 101U) * 2);
+    }
+
+    return keys;
+  }
+
+  SUITE(test_static_flat_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(100U, data.max_size());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(1) == data.end());
+      CHECK(data.lower_bound(1) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_iteration_and_search_against_std_set)
+    {
+      for (size_t n = 1U; n <= 100U; ++n)
+      {
+        std::vector<int> keys = make_keys(n);
+        std::set<int>    compare(keys.begin(), keys.end());
+        Data             data(keys.begin(), keys.end());
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(std::equal(compare.begin(),  compare.end(),  data.begin()));
+        CHECK(std::equal(compare.rbegin(), compare.rend(), data.rbegin()));
+
+        for (int key = -1; key <= 203; ++key)
+        {
+          std::set<int>::const_iterator expected_lower = compare.lower_bound(key);
+          std::set<int>::const_iterator expected_upper = compare.upper_bound(key);
+
+          Data::const_iterator lower = data.lower_bound(key);
+          Data::const_iterator upper = data.upper_bound(key);
+
+          CHECK_EQUAL(std::distance(compare.begin(), expected_lower), std::distance(data.begin(), lower));
+          CHECK_EQUAL(std::distance(compare.begin(), expected_upper), std::distance(data.begin(), upper));
+          CHECK_EQUAL(compare.count(key), data.count(key));
+          CHECK_EQUAL(compare.count(key) == 1U, data.contains(key));
+
+          if (compare.count(key) == 1U)
+          {
+            CHECK_EQUAL(key, *data.find(key));
+          }
+          else
+          {
+            CHECK(data.find(key) == data.end());
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_decrement_from_end)
+    {
+      Data data = { 5, 3, 9, 1, 7 };
+
+      Data::const_iterator itr = data.end();
+
+      CHECK_EQUAL(9, *--itr);
+      CHECK_EQUAL(7, *--itr);
+      CHECK_EQUAL(5, *--itr);
+      CHECK_EQUAL(3, *--itr);
+      CHECK_EQUAL(1, *--itr);
+      CHECK(itr == data.begin());
+    }
+
+    //*************************************************************************
+    TEST(test_equal_range)
+    {
+      Data data = { 5, 3, 9, 1, 7 };
+
+      ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> range = data.equal_range(5);
+
+      CHECK_EQUAL(5, *range.first);
+      CHECK_EQUAL(7, *range.second);
+
+      range = data.equal_range(6);
+
+      CHECK(range.first == range.second);
+      CHECK_EQUAL(7, *range.first);
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      etl::static_flat_set<std::string, 4> data = { "delta", "alpha", "charlie", "bravo" };
+
+      CHECK_EQUAL(std::string("alpha"), *data.begin());
+      CHECK(data.contains("charlie"));
+      CHECK(!data.contains("echo"));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      std::vector<int> keys = make_keys(101U);
+
+      CHECK_THROW(Data(keys.begin(), keys.end()), etl::static_flat_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_duplicate)
+    {
+      int keys[] = { 1, 2, 3, 2 };
+
+      CHECK_THROW(Data(keys, keys + 4), etl::static_flat_set_duplicate);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      static constexpr etl::static_flat_set<int, 8> data = { 40, 10, 30, 20, 50 };
+
+      static constexpr bool contains_30 = data.contains(30);
+      static constexpr bool contains_35 = data.contains(35);
+      static constexpr int  lower_35    = *data.lower_bound(35);
+      static constexpr int  smallest    = *data.begin();
+
+      CHECK(contains_30);
+      CHECK(!contains_35);
+      CHECK_EQUAL(40, lower_35);
+      CHECK_EQUAL(10, smallest);
+    }
+#endif
+  }
+}
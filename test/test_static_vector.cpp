@@ -0,0 +1,215 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <vector>
+#include <string>
+
+#include "etl/static_vector.h"
+#include "etl/string_view.h"
+
+namespace
+{
+  typedef etl::static_vector<int, 10>         Data;
+  typedef etl::static_vector<std::string, 10> DataS;
+
+#if ETL_USING_CPP14
+  //*************************************************************************
+  constexpr etl::static_vector<uint32_t, 64> make_squares()
+  {
+    etl::static_vector<uint32_t, 64> squares;
+
+    for (uint32_t i = 0U; i < 64U; ++i)
+    {
+      squares.push_back(i * i);
+    }
+
+    return squares;
+  }
+
+  constexpr etl::static_vector<uint32_t, 64> squares = make_squares();
+#endif
+
+  SUITE(test_static_vector)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(10U, data.max_size());
+      CHECK_EQUAL(10U, data.capacity());
+      CHECK_EQUAL(10U, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructors)
+    {
+      const int values[] = { 1, 2, 3, 4 };
+
+      Data data1(5U, 7);
+      Data data2(values, values + 4);
+      Data data3({ 1, 2, 3, 4 });
+
+      CHECK_EQUAL(5U, data1.size());
+      CHECK_EQUAL(7, data1.back());
+
+      CHECK_EQUAL(4U, data2.size());
+      CHECK_ARRAY_EQUAL(values, data2.data(), 4U);
+
+      CHECK(data2 == data3);
+      CHECK(data1 != data3);
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_pop_back)
+    {
+      DataS data;
+      std::vector<std::string> compare;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(std::to_string(i));
+        compare.push_back(std::to_string(i));
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.push_back("x"), etl::static_vector_full);
+      CHECK_ARRAY_EQUAL(compare.data(), data.data(), compare.size());
+
+      data.pop_back();
+      compare.pop_back();
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK_EQUAL(compare.back(), data.back());
+      CHECK_EQUAL(compare.front(), data.front());
+
+      data.clear();
+      CHECK_THROW(data.pop_back(), etl::static_vector_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_back)
+    {
+      DataS data;
+
+      CHECK_EQUAL(std::string("aaa"), data.emplace_back(3U, 'a'));
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase)
+    {
+      Data data({ 1, 2, 4 });
+
+      Data::iterator itr = data.insert(data.begin() + 2, 3);
+      CHECK_EQUAL(3, *itr);
+      CHECK(data == Data({ 1, 2, 3, 4 }));
+
+      itr = data.erase(data.begin());
+      CHECK_EQUAL(2, *itr);
+      CHECK(data == Data({ 2, 3, 4 }));
+
+      data.insert(data.end(), 5);
+      CHECK(data == Data({ 2, 3, 4, 5 }));
+    }
+
+    //*************************************************************************
+    TEST(test_resize)
+    {
+      Data data({ 1, 2, 3 });
+
+      data.resize(5U, 9);
+      CHECK(data == Data({ 1, 2, 3, 9, 9 }));
+
+      data.resize(2U);
+      CHECK(data == Data({ 1, 2 }));
+
+      data.resize(4U);
+      CHECK(data == Data({ 1, 2, 0, 0 }));
+
+      CHECK_THROW(data.resize(11U), etl::static_vector_full);
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data({ 1, 2, 3 });
+
+      CHECK_EQUAL(2, data.at(1U));
+      CHECK_THROW(data.at(3U), etl::static_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_reverse_iteration)
+    {
+      Data data({ 1, 2, 3 });
+      std::vector<int> compare(data.rbegin(), data.rend());
+
+      CHECK_EQUAL(3, compare[0]);
+      CHECK_EQUAL(1, compare[2]);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      static constexpr etl::static_vector<int, 10> data = { 1, 2, 3, 4 };
+
+      static_assert(data.size() == 4U, "Wrong size");
+      static_assert(data[2] == 3, "Wrong value");
+      static_assert(data.at(3) == 4, "Wrong value");
+      static_assert(data.back() == 4, "Wrong value");
+      static_assert(*(data.end() - 1) == 4, "Wrong value");
+
+      static_assert(squares.size() == 64U, "Wrong size");
+      static_assert(squares[63] == 63U * 63U, "Wrong value");
+
+      CHECK_EQUAL(1, data.front());
+      CHECK_EQUAL(49U, squares[7]);
+    }
+
+    //*************************************************************************
+    TEST(test_constexpr_string_table)
+    {
+      static constexpr etl::static_vector<etl::string_view, 4> names = { etl::string_view("zero", 4U), etl::string_view("one", 3U), etl::string_view("two", 3U) };
+
+      static_assert(names.size() == 3U, "Wrong size");
+      static_assert(names[1].size() == 3U, "Wrong value");
+
+      CHECK(names[2] == etl::string_view("two"));
+    }
+#endif
+  }
+}
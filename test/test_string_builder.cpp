@@ -0,0 +1,163 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/string_builder.h"
+#include "etl/to_string.h"
+#include "etl/string.h"
+#include "etl/wstring.h"
+
+#include <string>
+
+namespace
+{
+  SUITE(test_string_builder)
+  {
+    //*************************************************************************
+    TEST(test_append)
+    {
+      etl::string<21> text("Log:");
+      etl::string<4>  word("word");
+
+      {
+        etl::string_builder builder(text);
+
+        builder.push_back(' ');
+        builder.append("abc").append("defg", 2U).append(2U, '-');
+        builder.append(word);
+        builder.append(etl::string_view("XY"));
+
+        const char range[] = "123";
+        builder.append(range, range + 3);
+
+        CHECK(builder.view() == etl::string_view("Log: abcde--wordXY123"));
+        CHECK_EQUAL(0U, builder.available());
+        CHECK(!builder.is_truncated());
+      }
+
+      CHECK_EQUAL(std::string("Log: abcde--wordXY123"), std::string(text.c_str()));
+      CHECK_EQUAL(21U, text.size());
+    }
+
+    //*************************************************************************
+    TEST(test_stream_operators)
+    {
+      etl::string<20> text;
+      etl::string<5>  suffix("!");
+
+      etl::string_builder builder(text);
+
+      builder << "Hello" << ' ' << etl::string_view("World") << suffix;
+      builder.commit();
+
+      CHECK_EQUAL(std::string("Hello World!"), std::string(text.c_str()));
+      CHECK_EQUAL(12U, text.size());
+    }
+
+    //*************************************************************************
+    TEST(test_commit_is_deferred)
+    {
+      etl::string<20> text("abc");
+
+      etl::string_builder builder(text);
+      builder.append("def");
+
+      // Not yet committed.
+      CHECK_EQUAL(3U, text.size());
+      CHECK_EQUAL(6U, builder.size());
+
+      builder.commit();
+      CHECK_EQUAL(std::string("abcdef"), std::string(text.c_str()));
+
+      // Continue after a commit.
+      builder.append("gh");
+      builder.commit();
+      CHECK_EQUAL(std::string("abcdefgh"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_truncation)
+    {
+      etl::string<6> text;
+
+      {
+        etl::string_builder builder(text);
+
+        builder.append("abcd");
+        builder.append("efgh");
+        builder.push_back('i');
+        builder.append(3U, 'j');
+
+        CHECK(builder.is_truncated());
+        CHECK_EQUAL(6U, builder.size());
+      }
+
+      CHECK_EQUAL(std::string("abcdef"), std::string(text.c_str()));
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+      CHECK(text.is_truncated());
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_to_string_into_builder)
+    {
+      etl::string<30> text("Value=");
+      etl::string<30> expected("Value=");
+
+      {
+        etl::string_builder builder(text);
+
+        etl::to_string(-12345, builder);
+        builder << ", ";
+        etl::to_string(255, builder, etl::format_spec().hex().show_base(true));
+      }
+
+      etl::to_string(-12345, expected, true);
+      expected.append(", ");
+      etl::to_string(255, expected, etl::format_spec().hex().show_base(true), true);
+
+      CHECK_EQUAL(std::string(expected.c_str()), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_wide_builder)
+    {
+      etl::wstring<10> text(L"ab");
+
+      {
+        etl::wstring_builder builder(text);
+
+        builder << L"cd" << L'e';
+      }
+
+      CHECK(text == etl::wstring<10>(L"abcde"));
+    }
+  };
+}
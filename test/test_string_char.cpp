@@ -753,6 +753,47 @@ namespace
       CHECK_EQUAL(text.size(), NEW_SIZE);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_resize_and_overwrite)
+    {
+      Text text(STR("Hello"));
+
+      text.resize_and_overwrite(9U, [](value_t* p, size_t n)
+      {
+        CHECK_EQUAL(9U, n);
+        std::copy_n(STR(" World"), 6U, p + 5U);
+        return 11U - 2U;
+      });
+
+      CHECK_EQUAL(CompareText(STR("Hello Wor")), CompareText(text.c_str()));
+      CHECK_EQUAL(9U, text.size());
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+      CHECK(!text.is_truncated());
+#endif
+
+      // Shrink to what the operation reports.
+      text.resize_and_overwrite(SIZE, [](value_t*, size_t) { return 2U; });
+
+      CHECK_EQUAL(CompareText(STR("He")), CompareText(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_resize_and_overwrite_excess)
+    {
+      Text text;
+
+      text.resize_and_overwrite(SIZE + 5U, [](value_t* p, size_t n)
+      {
+        std::fill_n(p, n, STR('A'));
+        return n;
+      });
+
+      CHECK_EQUAL(CompareText(SIZE, STR('A')), CompareText(text.c_str()));
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+      CHECK(text.is_truncated());
+#endif
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_fill)
     {
@@ -4117,6 +4158,62 @@ namespace
 #include "etl/private/diagnostic_pop.h"
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_search_against_std)
+    {
+      // Small alphabets give many partial matches. Includes characters above 0x7F.
+      const value_t alphabet[] = { STR('a'), STR('b'), STR('.'), value_t(0xF0) };
+
+      etl::string<64> text;
+      CompareText     compare_text;
+
+      uint32_t seed = 1U;
+
+      for (int iteration = 0; iteration < 2000; ++iteration)
+      {
+        text.clear();
+        compare_text.clear();
+
+        const size_t length  = size_t(iteration % 41);
+        const size_t symbols = 2U + size_t(iteration % 3);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          const value_t c = alphabet[(seed >> 16U) % symbols];
+          text.push_back(c);
+          compare_text.push_back(c);
+        }
+
+        CompareText needle;
+
+        seed = (seed * 1103515245U) + 12345U;
+        const size_t needle_length = (seed >> 16U) % 7U;
+
+        for (size_t i = 0U; i < needle_length; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          needle.push_back(alphabet[(seed >> 16U) % symbols]);
+        }
+
+        const value_t c = needle.empty() ? alphabet[0] : needle[0];
+
+        CHECK_EQUAL(compare_text.rfind(needle.c_str()), text.rfind(needle.c_str()));
+        CHECK_EQUAL(compare_text.rfind(c), text.rfind(c));
+
+        for (size_t position = 0U; position <= (length + 1U); ++position)
+        {
+          CHECK_EQUAL(compare_text.find(needle.c_str(), position), text.find(needle.c_str(), position));
+          CHECK_EQUAL(compare_text.find(c, position), text.find(c, position));
+          CHECK_EQUAL(compare_text.find_first_of(needle.c_str(), position), text.find_first_of(needle.c_str(), position));
+          CHECK_EQUAL(compare_text.find_last_of(needle.c_str(), position), text.find_last_of(needle.c_str(), position));
+          CHECK_EQUAL(compare_text.find_first_not_of(needle.c_str(), position), text.find_first_not_of(needle.c_str(), position));
+          CHECK_EQUAL(compare_text.find_last_not_of(needle.c_str(), position), text.find_last_not_of(needle.c_str(), position));
+          CHECK_EQUAL(compare_text.find_last_of(c, position), text.find_last_of(c, position));
+        }
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_hash)
     {
@@ -0,0 +1,222 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/string_intern_pool.h"
+#include "etl/string.h"
+#include "etl/unordered_map.h"
+
+#include <string>
+
+namespace
+{
+  typedef etl::string_intern_pool<32U, 4U> Pool;
+
+  SUITE(test_string_intern_pool)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Pool pool;
+
+      CHECK(pool.empty());
+      CHECK(!pool.full());
+      CHECK_EQUAL(0U, pool.size());
+      CHECK_EQUAL(4U, pool.max_size());
+      CHECK_EQUAL(0U, pool.arena_size());
+      CHECK_EQUAL(32U, pool.arena_max_size());
+      CHECK_EQUAL(32U, pool.arena_available());
+    }
+
+    //*************************************************************************
+    TEST(test_intern_unique_and_repeated)
+    {
+      Pool pool;
+
+      Pool::handle h1 = pool.intern(etl::string_view("motor"));
+      Pool::handle h2 = pool.intern(etl::string_view("sensor"));
+
+      etl::string<32> text("motor");
+      Pool::handle h3 = pool.intern(text);
+
+      CHECK(h1.is_valid());
+      CHECK(h2.is_valid());
+      CHECK(h1 != h2);
+      CHECK(h1 == h3);
+      CHECK(h1 < h2);
+      CHECK_EQUAL(h1.hash(), h3.hash());
+
+      CHECK_EQUAL(2U, pool.size());
+      CHECK_EQUAL(11U, pool.arena_size());
+
+      CHECK(pool.view(h1) == etl::string_view("motor"));
+      CHECK(pool[h2] == etl::string_view("sensor"));
+      CHECK(pool.at(1U) == h2);
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_contains)
+    {
+      Pool pool;
+
+      Pool::handle h = pool.intern(etl::string_view("alpha"));
+
+      CHECK(pool.find(etl::string_view("alpha")) == h);
+      CHECK(!pool.find(etl::string_view("alph")).is_valid());
+      CHECK(!pool.find(etl::string_view("alphas")).is_valid());
+      CHECK(pool.contains(etl::string_view("alpha")));
+      CHECK(!pool.contains(etl::string_view("beta")));
+
+      // Finding does not add.
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty_string)
+    {
+      Pool pool;
+
+      Pool::handle h = pool.intern(etl::string_view(""));
+
+      CHECK(h.is_valid());
+      CHECK(pool.view(h).empty());
+      CHECK(pool.intern(etl::string_view()) == h);
+      CHECK_EQUAL(0U, pool.arena_size());
+    }
+
+    //*************************************************************************
+    TEST(test_full_strings)
+    {
+      Pool pool;
+
+      pool.intern(etl::string_view("a"));
+      pool.intern(etl::string_view("b"));
+      pool.intern(etl::string_view("c"));
+      pool.intern(etl::string_view("d"));
+
+      CHECK(pool.full());
+
+      // Existing strings may still be interned.
+      CHECK(pool.intern(etl::string_view("c")).is_valid());
+
+      CHECK_THROW(pool.intern(etl::string_view("e")), etl::string_intern_pool_full);
+    }
+
+    //*************************************************************************
+    TEST(test_full_arena)
+    {
+      etl::string_intern_pool<8U, 4U> pool;
+
+      pool.intern(etl::string_view("12345"));
+
+      CHECK_THROW(pool.intern(etl::string_view("6789")), etl::string_intern_pool_full);
+
+      CHECK(pool.intern(etl::string_view("678")).is_valid());
+      CHECK(pool.full());
+      CHECK_EQUAL(0U, pool.arena_available());
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_handle)
+    {
+      Pool pool;
+
+      CHECK(!Pool::handle().is_valid());
+      CHECK_THROW((void)pool.view(Pool::handle()), etl::string_intern_pool_invalid_handle);
+      CHECK_THROW((void)pool.at(0U), etl::string_intern_pool_invalid_handle);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Pool pool;
+
+      pool.intern(etl::string_view("one"));
+      pool.intern(etl::string_view("two"));
+
+      pool.clear();
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(0U, pool.arena_size());
+      CHECK(!pool.contains(etl::string_view("one")));
+
+      Pool::handle h = pool.intern(etl::string_view("three"));
+      CHECK_EQUAL(0U, h.index());
+      CHECK(pool.view(h) == etl::string_view("three"));
+    }
+
+    //*************************************************************************
+    TEST(test_many_strings)
+    {
+      etl::string_intern_pool<1024U, 100U> pool;
+
+      for (int pass = 0; pass < 2; ++pass)
+      {
+        for (int i = 0; i < 100; ++i)
+        {
+          std::string text = "id" + std::to_string(i);
+
+          etl::istring_intern_pool::handle h = pool.intern(etl::string_view(text.data(), text.size()));
+
+          CHECK_EQUAL(static_cast<uint32_t>(i), h.index());
+          CHECK(pool.view(h) == etl::string_view(text.data(), text.size()));
+        }
+      }
+
+      CHECK_EQUAL(100U, pool.size());
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_reference_to_base)
+    {
+      Pool pool;
+      etl::istring_intern_pool& ipool = pool;
+
+      etl::istring_intern_pool::handle h = ipool.intern(etl::string_view("route"));
+
+      CHECK(pool.find(etl::string_view("route")) == h);
+      CHECK(ipool.view(h) == etl::string_view("route"));
+    }
+
+    //*************************************************************************
+    TEST(test_handle_as_unordered_map_key)
+    {
+      Pool pool;
+
+      etl::unordered_map<Pool::handle, int, 4U> routes;
+
+      routes[pool.intern(etl::string_view("left"))]  = 1;
+      routes[pool.intern(etl::string_view("right"))] = 2;
+
+      CHECK_EQUAL(1, routes[pool.find(etl::string_view("left"))]);
+      CHECK_EQUAL(2, routes[pool.find(etl::string_view("right"))]);
+    }
+  };
+}
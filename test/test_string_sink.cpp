@@ -0,0 +1,193 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/string_sink.h"
+#include "etl/to_string.h"
+#include "etl/byte_stream.h"
+#include "etl/string.h"
+
+#include <string>
+#include <iterator>
+
+namespace
+{
+  SUITE(test_string_sink)
+  {
+    //*************************************************************************
+    TEST(test_span_sink)
+    {
+      char buffer[8];
+      etl::span_sink sink(etl::span<char>(buffer, 5U));
+
+      CHECK(sink.empty());
+      CHECK_EQUAL(5U, sink.capacity());
+
+      sink.push_back('a');
+      sink.append(2U, 'b');
+      const char text[] = "cd";
+      sink.append(text, text + 2);
+
+      CHECK(sink.view() == etl::string_view("abbcd"));
+      CHECK_EQUAL(0U, sink.available());
+      CHECK(!sink.is_truncated());
+
+      sink.push_back('e');
+      CHECK(sink.is_truncated());
+      CHECK_EQUAL(5U, sink.size());
+
+      sink.clear();
+      CHECK(sink.empty());
+      CHECK(!sink.is_truncated());
+
+      sink.append(6U, 'x');
+      CHECK(sink.view() == etl::string_view("xxxxx"));
+      CHECK(sink.is_truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_iterator_sink)
+    {
+      std::string text;
+      etl::basic_iterator_sink<std::back_insert_iterator<std::string> > sink = etl::make_iterator_sink(std::back_inserter(text), 4U);
+
+      sink.push_back('a');
+      sink.append(2U, 'b');
+      CHECK(!sink.is_truncated());
+
+      const char more[] = "cd";
+      sink.append(more, more + 2);
+
+      CHECK_EQUAL(std::string("abbc"), text);
+      CHECK_EQUAL(4U, sink.size());
+      CHECK_EQUAL(4U, sink.max_size());
+      CHECK(sink.is_truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_to_string_span_sink_matches_string)
+    {
+      char buffer[64];
+      etl::span_sink sink(buffer, sizeof(buffer));
+      etl::string<64> expected;
+
+      const etl::format_spec formats[] = { etl::format_spec(),
+                                           etl::format_spec().width(10).fill('*'),
+                                           etl::format_spec().width(10).left(),
+                                           etl::format_spec().hex().show_base(true).upper_case(true).width(12),
+                                           etl::format_spec().precision(3).width(12),
+                                           etl::format_spec().boolalpha(true).width(7) };
+
+      for (size_t i = 0U; i < (sizeof(formats) / sizeof(formats[0])); ++i)
+      {
+        const etl::format_spec& format = formats[i];
+
+        sink.clear();
+        etl::to_string(-12345, sink, format);
+        etl::to_string(-12345, expected, format);
+        CHECK(sink.view() == etl::string_view(expected.data(), expected.size()));
+
+        sink.clear();
+        etl::to_string(3.14159, sink, format);
+        etl::to_string(3.14159, expected, format);
+        CHECK(sink.view() == etl::string_view(expected.data(), expected.size()));
+
+        sink.clear();
+        etl::to_string(true, sink, format);
+        etl::to_string(true, expected, format);
+        CHECK(sink.view() == etl::string_view(expected.data(), expected.size()));
+
+        sink.clear();
+        etl::to_string(123456, 3U, sink, format);
+        etl::to_string(123456, 3U, expected, format);
+        CHECK(sink.view() == etl::string_view(expected.data(), expected.size()));
+
+        sink.clear();
+        etl::to_string(etl::string_view("text"), sink, format);
+        etl::to_string(etl::string_view("text"), expected, format);
+        CHECK(sink.view() == etl::string_view(expected.data(), expected.size()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_to_string_appends_to_sink)
+    {
+      char buffer[32];
+      etl::span_sink sink(buffer, sizeof(buffer));
+
+      etl::istring::value_type name[] = "id";
+      etl::string<4> text(name);
+
+      etl::to_string(text, sink);
+      sink.push_back('=');
+      etl::to_string(42, sink);
+      sink.push_back(',');
+      etl::to_string(1.5, sink, etl::format_spec().precision(2));
+
+      CHECK(sink.view() == etl::string_view("id=42,1.50"));
+    }
+
+    //*************************************************************************
+    TEST(test_to_string_sink_truncation)
+    {
+      char buffer[4];
+      etl::span_sink sink(buffer, sizeof(buffer));
+
+      etl::to_string(123456, sink);
+
+      CHECK(sink.view() == etl::string_view("1234"));
+      CHECK(sink.is_truncated());
+
+      std::string text;
+      etl::basic_iterator_sink<std::back_insert_iterator<std::string> > isink(std::back_inserter(text), 3U);
+
+      etl::to_string(42, isink, etl::format_spec().width(6).fill('.'));
+
+      CHECK_EQUAL(std::string("..."), text);
+      CHECK(isink.is_truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_to_string_byte_stream_writer)
+    {
+      char buffer[16];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+
+      writer.write(static_cast<uint8_t>('$'));
+
+      etl::span_sink sink(writer.free_data());
+      etl::to_string(0xBEEFU, sink, etl::format_spec().hex());
+      writer.skip<char>(sink.size());
+
+      CHECK_EQUAL(5U, writer.size_bytes());
+      CHECK(etl::string_view(buffer, writer.size_bytes()) == etl::string_view("$beef"));
+    }
+  }
+}
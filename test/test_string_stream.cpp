@@ -230,6 +230,20 @@ namespace
       CHECK_EQUAL(String(STR("0x1e240")), ss.str());
     }
 
+    //*************************************************************************
+    TEST(test_custom_inline_format_shortest)
+    {
+      String str;
+      Stream ss(str);
+
+      ss << etl::shortest << 0.1 << STR(" ") << 2.5e-10;
+      CHECK_EQUAL(String(STR("0.1 2.5e-10")), ss.str());
+
+      ss.str().clear();
+      ss << etl::noshortest << etl::setprecision(3) << 0.1;
+      CHECK_EQUAL(String(STR("0.100")), ss.str());
+    }
+
     //*************************************************************************
     TEST(test_custom_multi_inline_format)
     {
@@ -32,6 +32,8 @@ SOFTWARE.
 #include "etl/string_view.h"
 #include "etl/string_utilities.h"
 #include "etl/vector.h"
+#include "etl/map.h"
+#include "etl/unordered_map.h"
 
 #include <string>
 
@@ -1660,5 +1662,129 @@ namespace
 
       CHECK(text == expected);
     }
+
+    //*************************************************************************
+    TEST(test_iequals)
+    {
+      CHECK(etl::iequals(StringView(STR("Content-Length")), StringView(STR("content-length"))));
+      CHECK(etl::iequals(String(STR("CONTENT-LENGTH")), STR("content-length")));
+      CHECK(etl::iequals(STR("Host"), STR("hOST")));
+      CHECK(etl::iequals(StringView(), STR("")));
+
+      CHECK(!etl::iequals(StringView(STR("Content-Length")), StringView(STR("content-lengths"))));
+      CHECK(!etl::iequals(StringView(STR("Content-Length")), StringView(STR("content_length"))));
+
+      // '@' and '[' are either side of the upper case letters, '`' and '{' of the lower case.
+      CHECK(!etl::iequals(STR("@[`{"), STR("`{@[")));
+    }
+
+    //*************************************************************************
+    TEST(test_iequals_every_character_pair)
+    {
+      // Each pair is tested at every position of a string long enough to use the word at a time path.
+      for (int a = 0; a < 256; ++a)
+      {
+        for (int b = 0; b < 256; ++b)
+        {
+          const bool expected = ::tolower(a) == ::tolower(b);
+
+          char lhs[19] = "abcdefghIJKLMNOPqr";
+          char rhs[19] = "ABCDEFGHijklmnopQR";
+
+          const size_t position = size_t(a + b) % 18U;
+
+          lhs[position] = char(a);
+          rhs[position] = char(b);
+
+          if (etl::iequals(StringView(lhs, 18U), StringView(rhs, 18U)) != expected)
+          {
+            CHECK_EQUAL(expected, !expected);
+            return;
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_icompare)
+    {
+      CHECK_EQUAL(0, etl::icompare(STR("Accept"), STR("ACCEPT")));
+      CHECK(etl::icompare(STR("accept"), STR("Accept-Encoding")) < 0);
+      CHECK(etl::icompare(STR("Accept-Encoding"), STR("accept")) > 0);
+      CHECK(etl::icompare(STR("ABCDEFGHIJ"), STR("abcdefghik")) < 0);
+      CHECK(etl::icompare(STR("abcdefghik"), STR("ABCDEFGHIJ")) > 0);
+
+      // '_' is between the upper and lower case letters.
+      CHECK(etl::icompare(STR("A_"), STR("aa")) < 0);
+      CHECK(etl::icompare(STR("a_"), STR("AA")) < 0);
+    }
+
+    //*************************************************************************
+    TEST(test_ifind)
+    {
+      const StringView text(STR("GET /index.html HTTP/1.1\r\nHost: Example.COM\r\n"));
+
+      CHECK_EQUAL(26U, etl::ifind(text, STR("host:")));
+      CHECK_EQUAL(32U, etl::ifind(text, STR("EXAMPLE.com")));
+      CHECK_EQUAL(16U, etl::ifind(text, STR("http")));
+      CHECK_EQUAL(StringView::npos, etl::ifind(text, STR("http"), 17U));
+      CHECK_EQUAL(StringView::npos, etl::ifind(text, STR("example.org")));
+      CHECK_EQUAL(5U, etl::ifind(text, STR(""), 5U));
+      CHECK_EQUAL(StringView::npos, etl::ifind(text, STR(""), text.size() + 1U));
+      CHECK_EQUAL(StringView::npos, etl::ifind(STR("abc"), STR("abcd")));
+      CHECK_EQUAL(0U, etl::ifind(STR("abc"), STR("ABC")));
+
+      // Matches in every position around the word boundaries.
+      for (size_t i = 0U; i < 30U; ++i)
+      {
+        String haystack(30U, STR('x'));
+        haystack[i] = STR('Y');
+        CHECK_EQUAL(i, etl::ifind(haystack, STR("y")));
+
+        if (i < 29U)
+        {
+          haystack[i + 1U] = STR('z');
+          CHECK_EQUAL(i, etl::ifind(haystack, STR("yZ")));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_ihash)
+    {
+      CHECK_EQUAL(etl::ihash(STR("Content-Type")), etl::ihash(String(STR("CONTENT-TYPE"))));
+      CHECK_EQUAL(etl::ihash(StringView(STR("content-type"))), etl::ihash(STR("Content-TYPE")));
+      CHECK(etl::ihash(STR("Content-Type")) != etl::ihash(STR("Content-Typf")));
+    }
+
+    //*************************************************************************
+    TEST(test_case_insensitive_functors)
+    {
+      typedef etl::unordered_map<StringView, int, 8, 8, etl::case_insensitive_hash, etl::case_insensitive_equal_to> HeaderMap;
+
+      HeaderMap headers;
+      headers[StringView(STR("Content-Length"))] = 1;
+      headers[StringView(STR("Host"))]           = 2;
+      headers[StringView(STR("HOST"))]           = 3;
+
+      CHECK_EQUAL(2U, headers.size());
+      CHECK_EQUAL(3, headers[StringView(STR("host"))]);
+      CHECK(headers.find(StringView(STR("content-length"))) != headers.end());
+
+      etl::map<String, int, 4, etl::case_insensitive_less> ordered;
+      ordered[String(STR("beta"))]  = 2;
+      ordered[String(STR("ALPHA"))] = 1;
+      ordered[String(STR("Gamma"))] = 3;
+      ordered[String(STR("BETA"))]  = 4;
+
+      CHECK_EQUAL(3U, ordered.size());
+      CHECK(ordered.begin()->first == String(STR("ALPHA")));
+      CHECK_EQUAL(4, ordered[String(STR("Beta"))]);
+
+#if ETL_USING_CPP11
+      // Transparent lookup with a C string.
+      CHECK(ordered.find(STR("gamma")) != ordered.end());
+#endif
+    }
   };
 }
@@ -1632,5 +1632,22 @@ namespace
 
       CHECK(textview.end() == itr);
     }
+
+    //*************************************************************************
+    TEST(test_case_insensitive)
+    {
+      const StringView text(STR("Content-Type: Text/HTML"));
+
+      CHECK(etl::iequals(text, STR("content-type: text/html")));
+      CHECK(!etl::iequals(text, STR("content-type: text/htm")));
+      CHECK(etl::icompare(STR("ABC"), STR("abd")) < 0);
+      CHECK_EQUAL(14U, etl::ifind(text, STR("text/html")));
+      CHECK_EQUAL(StringView::npos, etl::ifind(text, STR("text/xml")));
+      CHECK_EQUAL(etl::ihash(text), etl::ihash(STR("CONTENT-TYPE: TEXT/HTML")));
+
+      // Only ASCII letters are folded.
+      CHECK(!etl::iequals(STR("Ł"), STR("ł")));
+      CHECK(!etl::iequals(STR("š"), STR("A")));
+    }
   };
 }
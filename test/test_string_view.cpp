@@ -813,6 +813,82 @@ namespace
       CHECK(View::npos == view.rfind(s4, 0, 11));
     }
 
+    //*************************************************************************
+    TEST(test_search_against_std)
+    {
+      // Small alphabets give many partial matches. Includes characters above 0x7F.
+      const char alphabet[] = { 'a', 'b', '.', char(0xF0) };
+
+      uint32_t seed = 1U;
+
+      for (int iteration = 0; iteration < 2000; ++iteration)
+      {
+        std::string text;
+        std::string needle;
+
+        const size_t length  = size_t(iteration % 41);
+        const size_t symbols = 2U + size_t(iteration % 3);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          text.push_back(alphabet[(seed >> 16U) % symbols]);
+        }
+
+        seed = (seed * 1103515245U) + 12345U;
+        const size_t needle_length = (seed >> 16U) % 7U;
+
+        for (size_t i = 0U; i < needle_length; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          needle.push_back(alphabet[(seed >> 16U) % symbols]);
+        }
+
+        const View view(text.data(), text.size());
+        const View needle_view(needle.data(), needle.size());
+        const char c = needle.empty() ? alphabet[0] : needle[0];
+
+        CHECK_EQUAL(text.rfind(needle), view.rfind(needle_view));
+        CHECK_EQUAL(text.rfind(c), view.rfind(c));
+
+        for (size_t position = 0U; position <= (length + 1U); ++position)
+        {
+          CHECK_EQUAL(text.find(needle, position), view.find(needle_view, position));
+          CHECK_EQUAL(text.find(c, position), view.find(c, position));
+          CHECK_EQUAL(text.find_first_of(needle, position), view.find_first_of(needle_view, position));
+          CHECK_EQUAL(text.find_last_of(needle, position), view.find_last_of(needle_view, position));
+          CHECK_EQUAL(text.find_first_not_of(needle, position), view.find_first_not_of(needle_view, position));
+          CHECK_EQUAL(text.find_last_not_of(needle, position), view.find_last_not_of(needle_view, position));
+        }
+      }
+
+      // Not found before the position.
+      const View abc("abcdef");
+      CHECK(View::npos == abc.rfind(View("x"), 3U));
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_constexpr_search)
+    {
+      constexpr View view("protocol: key=value; other=thing");
+
+      constexpr size_t find_char     = view.find('=');
+      constexpr size_t rfind_char    = view.rfind('=');
+      constexpr size_t find_text     = view.find(View("other"));
+      constexpr size_t rfind_text    = view.rfind(View("e"));
+      constexpr size_t first_of      = view.find_first_of(View(";="));
+      constexpr size_t last_not_of   = view.find_last_not_of(View("ghint"));
+
+      CHECK_EQUAL(13U, find_char);
+      CHECK_EQUAL(26U, rfind_char);
+      CHECK_EQUAL(21U, find_text);
+      CHECK_EQUAL(24U, rfind_text);
+      CHECK_EQUAL(13U, first_of);
+      CHECK_EQUAL(26U, last_not_of);
+    }
+#endif
+
     //*************************************************************************
     TEST(test_find_first_of)
     {
@@ -1060,6 +1136,23 @@ namespace
       CHECK(etl::hash<U32Text>()(u32text) == etl::hash<U32View>()(u32view));
     }
 
+    //*************************************************************************
+    TEST(test_transparent_hash)
+    {
+      etl::string<11>  text("Hello World");
+      etl::wstring<11> wtext(L"Hello World");
+
+      etl::string_view_hash  hasher;
+      etl::wstring_view_hash whasher;
+
+      CHECK_EQUAL(etl::hash<etl::string<11>>()(text), hasher(text));
+      CHECK_EQUAL(hasher(text), hasher(etl::string_view(text)));
+      CHECK_EQUAL(hasher(text), hasher("Hello World"));
+      CHECK_EQUAL(etl::hash<etl::wstring<11>>()(wtext), whasher(wtext));
+      CHECK_EQUAL(whasher(wtext), whasher(L"Hello World"));
+      CHECK(hasher(text) != hasher("Hello"));
+    }
+
     //*************************************************************************
     TEST(string_view_literal)
     {
@@ -34,6 +34,7 @@ SOFTWARE.
 
 #include "etl/task.h"
 #include "etl/scheduler.h"
+#include "etl/scheduler_statistics.h"
 #include "etl/container.h"
 
 typedef std::vector<std::string> WorkList_t;
@@ -149,6 +150,71 @@ private:
   Task* pTaskToAddTo;
 };
 
+//*****************************************************************************
+// A task for the ready bitmap policy, that counts the requests for work and
+// signals the policy when work is added to it.
+//*****************************************************************************
+class ReadyTask : public etl::task
+{
+public:
+
+  //*********************************************
+  ReadyTask(etl::task_priority_t priority_, const WorkList_t& work_, Common& common_)
+    : task(priority_)
+    , requests(0)
+    , work(work_)
+    , common(common_)
+    , workIndex(0U)
+    , addAtIndex(0U)
+    , workToAdd("")
+    , pTaskToAddTo(nullptr)
+    , pPolicy(nullptr)
+  {
+  }
+
+  //*********************************************
+  void WorkToAdd(size_t addAtIndex_, const std::string& workToAdd_, ReadyTask& taskToAddTo_, etl::scheduler_policy_ready_bitmap& policy_)
+  {
+    addAtIndex   = addAtIndex_;
+    workToAdd    = workToAdd_;
+    pTaskToAddTo = &taskToAddTo_;
+    pPolicy      = &policy_;
+  }
+
+  //*********************************************
+  virtual uint32_t task_request_work() const ETL_OVERRIDE
+  {
+    ++requests;
+
+    return uint32_t(work.size() - workIndex);
+  }
+
+  //*********************************************
+  virtual void task_process_work() ETL_OVERRIDE
+  {
+    common.workList.push_back(work[workIndex]);
+    ++workIndex;
+
+    if ((pTaskToAddTo != nullptr) && (workIndex == addAtIndex))
+    {
+      pTaskToAddTo->work.push_back(workToAdd);
+      pPolicy->set_task_ready(*pTaskToAddTo);
+    }
+  }
+
+  mutable int requests;
+
+private:
+
+  WorkList_t work;
+  Common& common;
+  size_t workIndex;
+  size_t addAtIndex;
+  std::string workToAdd;
+  ReadyTask* pTaskToAddTo;
+  etl::scheduler_policy_ready_bitmap* pPolicy;
+};
+
 Common common;
 
 WorkList_t work1 = { "T1W1", "T1W2", "T1W3" };
@@ -165,6 +231,48 @@ typedef etl::scheduler<etl::scheduler_policy_sequential_single,   sizeof(etl::ar
 typedef etl::scheduler<etl::scheduler_policy_sequential_multiple, sizeof(etl::array_size(taskList))> SchedulerSequentialMultiple;
 typedef etl::scheduler<etl::scheduler_policy_highest_priority,    sizeof(etl::array_size(taskList))> SchedulerHighestPriority;
 typedef etl::scheduler<etl::scheduler_policy_most_work,           sizeof(etl::array_size(taskList))> SchedulerMostWork;
+typedef etl::scheduler<etl::scheduler_policy_ready_bitmap,        sizeof(etl::array_size(taskList))> SchedulerReadyBitmap;
+
+//*****************************************************************************
+// A clock for the statistics policy, advanced by the timed tasks.
+//*****************************************************************************
+uint32_t fake_time = 0U;
+
+uint32_t fake_clock()
+{
+  return fake_time;
+}
+
+//*****************************************************************************
+class TimedTask : public etl::task
+{
+public:
+
+  //*********************************************
+  TimedTask(etl::task_priority_t priority_, int work_, uint32_t duration_)
+    : task(priority_)
+    , work(work_)
+    , duration(duration_)
+  {
+  }
+
+  //*********************************************
+  virtual uint32_t task_request_work() const ETL_OVERRIDE
+  {
+    return uint32_t(work);
+  }
+
+  //*********************************************
+  virtual void task_process_work() ETL_OVERRIDE
+  {
+    --work;
+    fake_time += duration;
+    duration  += 1U;
+  }
+
+  int      work;
+  uint32_t duration;
+};
 
 namespace
 {
@@ -287,5 +395,338 @@ namespace
       CHECK(expected == common.workList);
       CHECK(common.watchdog_called);
     }
+
+    //*************************************************************************
+    TEST(test_scheduler_ready_bitmap)
+    {
+      SchedulerReadyBitmap s;
+
+      ReadyTask readyTask1(1, work1, common);
+      ReadyTask readyTask2(2, work2, common);
+      ReadyTask readyTask3(3, work3, common);
+
+      readyTask2.WorkToAdd(2U, "T3W3", readyTask3, s.get_policy());
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task(readyTask1);
+      s.add_task(readyTask2);
+      s.add_task(readyTask3);
+      s.start(); // If 'start' returns then the idle callback was successfully called.
+
+      // The same order as the highest priority policy.
+      WorkList_t expected = { "T3W1", "T3W2", "T2W1", "T2W2", "T3W3", "T2W3", "T2W4", "T1W1", "T1W2", "T1W3" };
+
+      CHECK(expected == common.workList);
+      CHECK(common.watchdog_called);
+
+      // One request for each item of work, and one each time a ready task is found to have none.
+      CHECK_EQUAL(3 + 1, readyTask1.requests);
+      CHECK_EQUAL(4 + 1, readyTask2.requests);
+      CHECK_EQUAL(3 + 2, readyTask3.requests);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_ready_bitmap_many_tasks)
+    {
+      typedef etl::scheduler<etl::scheduler_policy_ready_bitmap, 64> Scheduler;
+
+      Scheduler s;
+
+      WorkList_t no_work;
+      WorkList_t one_work = { "W" };
+
+      std::vector<ReadyTask*> tasks;
+
+      for (int i = 0; i < 64; ++i)
+      {
+        tasks.push_back(new ReadyTask(etl::task_priority_t(i), ((i % 10) == 0) ? one_work : no_work, common));
+      }
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+
+      for (size_t i = 0U; i < tasks.size(); ++i)
+      {
+        s.add_task(*tasks[i]);
+      }
+
+      s.start();
+
+      // Tasks 60, 50, ... 0 have work. Each task is asked once when it has none.
+      CHECK_EQUAL(7U, common.workList.size());
+
+      int requests = 0;
+
+      for (size_t i = 0U; i < tasks.size(); ++i)
+      {
+        requests += tasks[i]->requests;
+        delete tasks[i];
+      }
+
+      CHECK_EQUAL(7 + 64, requests);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_ready_bitmap_ignores_unknown_task)
+    {
+      SchedulerReadyBitmap s;
+
+      ReadyTask readyTask1(1, work1, common);
+      ReadyTask other(2, work2, common);
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.add_task(readyTask1);
+      s.start();
+
+      CHECK_EQUAL(3U, common.workList.size());
+
+      s.get_policy().set_task_ready(other);
+      common.Clear();
+      s.start();
+
+      CHECK_EQUAL(0U, common.workList.size());
+      CHECK_EQUAL(0, other.requests);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_ready_bitmap_same_priority)
+    {
+      SchedulerReadyBitmap s;
+
+      WorkList_t no_work;
+
+      ReadyTask readyTask1(2, no_work, common);
+      ReadyTask readyTask2(2, no_work, common);
+      ReadyTask readyTask3(1, work1, common);
+
+      readyTask3.WorkToAdd(1U, "T2W1", readyTask2, s.get_policy());
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.add_task(readyTask1);
+      s.add_task(readyTask2);
+      s.add_task(readyTask3);
+      s.start();
+
+      // The second task of the priority is signalled, not the first.
+      WorkList_t expected = { "T1W1", "T2W1", "T1W2", "T1W3" };
+
+      CHECK(expected == common.workList);
+      CHECK_EQUAL(1, readyTask1.requests);
+      CHECK_EQUAL(3, readyTask2.requests);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_ready_bitmap_same_size_list)
+    {
+      etl::scheduler_policy_ready_bitmap policy;
+
+      ReadyTask readyTask1(2, work1, common);
+      ReadyTask readyTask2(1, work2, common);
+      ReadyTask readyTask3(2, work3, common);
+      ReadyTask readyTask4(1, work1, common);
+
+      etl::vector<etl::task*, 2> list1 = { &readyTask1, &readyTask2 };
+      etl::vector<etl::task*, 2> list2 = { &readyTask3, &readyTask4 };
+
+      common.Clear();
+
+      while (!policy.schedule_tasks(list1))
+      {
+      }
+
+      CHECK_EQUAL(7U, common.workList.size());
+
+      // The same number of tasks, but not the same tasks.
+      common.Clear();
+
+      while (!policy.schedule_tasks(list2))
+      {
+      }
+
+      WorkList_t expected = { "T3W1", "T3W2", "T1W1", "T1W2", "T1W3" };
+
+      CHECK(expected == common.workList);
+
+      // Signals now go to the new tasks.
+      common.Clear();
+      policy.set_task_ready(readyTask1);
+
+      CHECK(policy.schedule_tasks(list2));
+      CHECK_EQUAL(0U, common.workList.size());
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_ready_bitmap_too_many_tasks)
+    {
+      etl::scheduler_policy_ready_bitmap policy;
+
+      WorkList_t one_work = { "W" };
+
+      std::vector<ReadyTask*> tasks;
+      etl::vector<etl::task*, 65> task_list;
+
+      for (int i = 0; i < 65; ++i)
+      {
+        tasks.push_back(new ReadyTask(etl::task_priority_t(65 - i), one_work, common));
+        task_list.push_back(tasks.back());
+      }
+
+      common.Clear();
+
+      // Rejected once, when the list is bound.
+      CHECK_THROW(policy.schedule_tasks(task_list), etl::scheduler_too_many_tasks_exception);
+
+      while (!policy.schedule_tasks(task_list))
+      {
+      }
+
+      // The tasks after Max_Tasks are never called.
+      CHECK_EQUAL(64U, common.workList.size());
+      CHECK_EQUAL(0, tasks.back()->requests);
+
+      for (size_t i = 0U; i < tasks.size(); ++i)
+      {
+        delete tasks[i];
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_statistics)
+    {
+      typedef etl::scheduler_policy_statistics<etl::scheduler_policy_highest_priority, 3> Policy;
+
+      etl::scheduler<Policy, 3> s;
+
+      task1.Reset();
+      task2.Reset();
+      task3.Reset();
+
+      task2.WorkToAdd(2, "T3W3", task3);
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.add_task_list(taskList, ETL_OR_STD17::size(taskList));
+      s.start();
+
+      // The wrapped policy decides the order.
+      WorkList_t expected = { "T3W1", "T3W2", "T2W1", "T2W2", "T3W3", "T2W3", "T2W4", "T1W1", "T1W2", "T1W3" };
+
+      CHECK(expected == common.workList);
+
+      const Policy& policy = s.get_policy();
+
+      CHECK_EQUAL(3U, policy.get_task_statistics(task1)->invocations);
+      CHECK_EQUAL(4U, policy.get_task_statistics(task2)->invocations);
+      CHECK_EQUAL(3U, policy.get_task_statistics(task3)->invocations);
+
+      CHECK_EQUAL(11U, policy.get_cycles());
+      CHECK_EQUAL(1U,  policy.get_idle_cycles());
+
+      // No clock, so no times.
+      CHECK_EQUAL(0U, policy.get_task_statistics(task1)->total_time);
+      CHECK_EQUAL(0U, policy.get_busy_time());
+
+      Task other(0, work1, common);
+      CHECK(policy.get_task_statistics(other) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_statistics_timing)
+    {
+      typedef etl::scheduler_policy_statistics<etl::scheduler_policy_sequential_single, 3> Policy;
+
+      etl::scheduler<Policy, 3> s;
+
+      TimedTask fast(2, 3, 10U); // Takes 10, 11, 12, then 13
+      TimedTask slow(1, 1, 50U); // Takes 50
+
+      // On the first idle, waits for 17 and gives the fast task more work.
+      struct Idle
+      {
+        void callback()
+        {
+          if (++count == 1)
+          {
+            fake_time += 17U;
+            p_fast->work = 1;
+          }
+          else
+          {
+            p_scheduler->exit_scheduler();
+          }
+        }
+
+        int              count;
+        TimedTask*       p_fast;
+        etl::ischeduler* p_scheduler;
+      };
+
+      Idle idle = { 0, &fast, &s };
+      etl::function<Idle, void> idle_callback(idle, &Idle::callback);
+
+      fake_time = 0U;
+
+      s.get_policy().set_clock(Policy::clock_type::create<fake_clock>());
+      s.set_idle_callback(idle_callback);
+
+      s.add_task(fast);
+      s.add_task(slow);
+
+      // Cycle 1 runs both, cycles 2 and 3 run fast, cycle 4 is idle,
+      // cycle 5 runs fast, cycle 6 is idle.
+      s.start();
+
+      const Policy& policy = s.get_policy();
+
+      const etl::task_statistics* p_fast = policy.get_task_statistics(fast);
+      const etl::task_statistics* p_slow = policy.get_task_statistics(slow);
+
+      CHECK_EQUAL(4U,  p_fast->invocations);
+      CHECK_EQUAL(46U, p_fast->total_time);
+      CHECK_EQUAL(13U, p_fast->max_time);
+      CHECK_EQUAL(11U, p_fast->mean_time());
+
+      CHECK_EQUAL(1U,  p_slow->invocations);
+      CHECK_EQUAL(50U, p_slow->total_time);
+      CHECK_EQUAL(50U, p_slow->max_time);
+
+      CHECK_EQUAL(6U,  policy.get_cycles());
+      CHECK_EQUAL(2U,  policy.get_idle_cycles());
+      CHECK_EQUAL(96U, policy.get_busy_time());
+      CHECK_EQUAL(17U, policy.get_idle_time());
+      CHECK_CLOSE(17.0 / 113.0, policy.get_idle_ratio(), 1e-9);
+
+      // Statistics survive adding a task.
+      TimedTask late(0, 0, 1U);
+      etl::vector<etl::task*, 3> tasks;
+      tasks.push_back(&fast);
+      tasks.push_back(&slow);
+      tasks.push_back(&late);
+      s.get_policy().schedule_tasks(tasks);
+
+      CHECK_EQUAL(4U, policy.get_task_statistics(fast)->invocations);
+      CHECK_EQUAL(0U, policy.get_task_statistics(late)->invocations);
+      CHECK_EQUAL(7U, policy.get_cycles());
+
+      s.get_policy().clear_statistics();
+
+      CHECK_EQUAL(0U, policy.get_task_statistics(fast)->invocations);
+      CHECK_EQUAL(0U, policy.get_cycles());
+      CHECK_CLOSE(0.0, policy.get_idle_ratio(), 1e-9);
+    }
   };
 }
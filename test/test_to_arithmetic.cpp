@@ -32,6 +32,9 @@ SOFTWARE.
 #include <sstream>
 #include <iomanip>
 #include <limits>
+#include <random>
+#include <cstring>
+#include <cstdio>
 
 #include "etl/to_arithmetic.h"
 #include "etl/string.h"
@@ -61,6 +64,13 @@ namespace
 
   typedef etl::format_spec Format;
 
+  //*************************************************************************
+  template <typename T>
+  bool is_same_bits(T lhs, T rhs)
+  {
+    return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+  }
+
   SUITE(test_to_arithmetic)
   {
     //*************************************************************************
@@ -573,6 +583,71 @@ namespace
       CHECK(!etl::to_arithmetic<uint64_t>(uint64_overflow_max.c_str(), uint64_overflow_max.size(), etl::dec));
     }
 
+    //*************************************************************************
+    TEST(test_long_decimal_numerics)
+    {
+      // Lengths that exercise the eight digit blocks and the character by character remainder.
+      const Text digits(STR("1234567890123456789012345"));
+
+      for (size_t length = 1U; length <= digits.size(); ++length)
+      {
+        const Text text = digits.substr(0U, length);
+
+        const bool fits_uint32 = (length < 10U) || ((length == 10U) && (text <= Text(STR("4294967295"))));
+        const bool fits_uint64 = (length < 20U) || ((length == 20U) && (text <= Text(STR("18446744073709551615"))));
+
+        etl::to_arithmetic_result<uint32_t> result32 = etl::to_arithmetic<uint32_t>(text.c_str(), text.size(), etl::dec);
+        etl::to_arithmetic_result<uint64_t> result64 = etl::to_arithmetic<uint64_t>(text.c_str(), text.size(), etl::dec);
+
+        CHECK_EQUAL(fits_uint32, result32.has_value());
+        CHECK_EQUAL(fits_uint64, result64.has_value());
+
+        if (fits_uint32)
+        {
+          CHECK_EQUAL(uint32_t(std::stoul(text)), result32.value());
+        }
+        else
+        {
+          CHECK_EQUAL(etl::to_arithmetic_status::Overflow, result32.error());
+        }
+
+        if (fits_uint64)
+        {
+          CHECK_EQUAL(uint64_t(std::stoull(text)), result64.value());
+        }
+        else
+        {
+          CHECK_EQUAL(etl::to_arithmetic_status::Overflow, result64.error());
+        }
+      }
+
+      // Leading zeros do not overflow.
+      const Text leading_zeros(STR("-0000000000000000000000009223372036854775808"));
+      CHECK_EQUAL(std::numeric_limits<int64_t>::min(), etl::to_arithmetic<int64_t>(leading_zeros.c_str(), leading_zeros.size(), etl::dec).value());
+
+      // An invalid character anywhere in a long string.
+      const Text invalid_characters(STR("/:a .+-"));
+
+      for (size_t position = 0U; position < 16U; ++position)
+      {
+        for (size_t i = 0U; i < invalid_characters.size(); ++i)
+        {
+          Text text(STR("1111111111111111"));
+          text[position] = invalid_characters[i];
+
+          if ((position == 0U) && ((text[0] == STR('+')) || (text[0] == STR('-'))))
+          {
+            continue;
+          }
+
+          etl::to_arithmetic_result<uint64_t> result = etl::to_arithmetic<uint64_t>(text.c_str(), text.size(), etl::dec);
+
+          CHECK(!result.has_value());
+          CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, result.error());
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(test_invalid_hex_numerics)
     {
@@ -907,6 +982,192 @@ namespace
       CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<double>(text.c_str(), text.size()).error());
     }
 
+    //*************************************************************************
+    TEST(test_correctly_rounded_double)
+    {
+      const char* texts[] =
+      {
+        "0", "-0", "0.0e0", "1", "-1", "0.1", "0.3", "3.14159265358979323846", "1e23", "8.589973e9",
+        "9007199254740993",                           // Half way, rounds to even.
+        "9007199254740995",                           // Half way, rounds to even.
+        "9007199254740993.0000000000000000000000001", // Just above half way.
+        "2.2250738585072011e-308",                    // Largest subnormal.
+        "2.2250738585072014e-308",                    // Smallest normal.
+        "4.9406564584124654e-324",                    // Smallest subnormal.
+        "2.4703282292062327e-324",                    // Half of the smallest subnormal.
+        "2.4703282292062328e-324",
+        "1e-400",
+        "1.7976931348623157e308",                     // Largest.
+        "179769313486231570000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+        "0.000000000000000000000000000000000000000000001234567890123456789012345678901234567890",
+        "7.2057594037927933e16", "123456789012345678901234567890", "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124", "1.00000000000000011102230246251565404236316680908203126"
+      };
+
+      for (size_t i = 0U; i < (sizeof(texts) / sizeof(texts[0])); ++i)
+      {
+        const Text text(texts[i]);
+
+        etl::to_arithmetic_result<double> result = etl::to_arithmetic<double>(text.c_str(), text.size());
+
+        CHECK(result.has_value());
+        CHECK(is_same_bits(strtod(texts[i], nullptr), result.value()));
+      }
+
+      // Too large.
+      const Text too_large("1.7976931348623159e308");
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<double>(too_large.c_str(), too_large.size()).error());
+
+      // Random values.
+      std::mt19937_64 generator(12345);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const uint64_t bits = generator();
+        double expected;
+        std::memcpy(&expected, &bits, sizeof(expected));
+
+        if (std::isnan(expected) || std::isinf(expected))
+        {
+          continue;
+        }
+
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), (i & 1) ? "%.17g" : "%.15g", expected);
+        expected = strtod(buffer, nullptr);
+
+        const Text text(buffer);
+        etl::to_arithmetic_result<double> result = etl::to_arithmetic<double>(text.c_str(), text.size());
+
+        CHECK(result.has_value());
+        CHECK(is_same_bits(expected, result.value()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_correctly_rounded_double_half_way)
+    {
+      // Exactly half way between two doubles.
+      const char* texts[] =
+      {
+        "1.00000000000000033306690738754696212708950042724609375",
+        "1.00000000000000055511151231257827021181583404541015625",
+        "2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932649918180817996"
+        "1898982823477228588654633283551779698981993873980053909390631503565951557022639229085839244910518443"
+        "5931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927"
+        "8343384093519780155312465972635795746227664652728272200563740064854999770965994704540208281662262378"
+        "5739345073633900796776193057750674017632467360096895134053553745851666113422376667860416215968046191"
+        "4467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668"
+        "2350898633885879256283027559956575244555072551893136908362547791869486679949683240497058210285131854"
+        "51396213837722826145437693412532098591327667236328125e-324",
+        "7.41098468761869816264853189302332058547589703921487146638378523751013260905313127797949754542453988"
+        "5696948470431685765963899850655339096945981621940161728171894510697854671067917687257517734731555330"
+        "7795408549809608457500958111373034747658096871009590975442271004757307809711118935784838675653998783"
+        "5030152280559340465937397917907387238682993958184816601691220194564999312897984113620624844986787135"
+        "7218035220901702390328579173252022052897402080290685402160661237554998340267130003581248647904138574"
+        "3401875520901590172592547146296175134159774938718574737870961645638908718119841271673056017045493004"
+        "7052695901657637768849082679869725733665217655679410725087643375608460039849049721491174630855395563"
+        "54188641513168478436313080237596295773983001708984375e-324",
+        "1797693134862315807937289714053034150799341327100378269361737789804449682927647509466490179775872070"
+        "9633028641669288791094655554785194040263065748867150582068190890200070838367627385484581771153176447"
+        "5730270069855571366959622842914819860834936475292719074168444365510704342711559699508093042880177904"
+        "174497792",
+        "2.22507385850720113605740979670913197593481954635164564802342610972482222202107694551652952390813508"
+        "7914149158913039621106870086438694594645527657207407820621743379988141063267329253552286881372149012"
+        "9811224514518898490572223072852551331557550159143974763979834118019993239625482890171070818506906306"
+        "6665599493827577257201576306269066333264756530000924588831643303777979186961204949739037782970490505"
+        "1080609940730262937128958950003583799967207254304360284078895771796150945516748243471030702609144621"
+        "5722898802581825451803257070188608721131280795122334262883686223215037756666225039825343359745688844"
+        "2390026549819838548794829220689472168983109969836584681402285424333066033985088644580400103493397042"
+        "756718644338377048603786162277173854562306587467901408672332763671875e-308",
+        "9007199254740995"
+      };
+
+      for (size_t i = 0U; i < (sizeof(texts) / sizeof(texts[0])); ++i)
+      {
+        const Text half_way(texts[i]);
+        const Text::size_type e = half_way.find('e');
+        const Text mantissa = half_way.substr(0U, e);
+        const Text exponent = (e == Text::npos) ? Text() : half_way.substr(e);
+
+        // Just below, and just above beyond the significant digits that are kept.
+        Text below = mantissa;
+        below[below.size() - 1U] -= 1;
+        below += exponent;
+
+        Text above = mantissa;
+        above += (above.find('.') == Text::npos) ? "." : "";
+        above += Text(800U, '0') + "1" + exponent;
+
+        const Text variants[] = { half_way, below, above };
+
+        for (size_t j = 0U; j < 3U; ++j)
+        {
+          etl::to_arithmetic_result<double> result = etl::to_arithmetic<double>(variants[j].c_str(), variants[j].size());
+          const double expected = strtod(variants[j].c_str(), nullptr);
+
+          if (std::isinf(expected))
+          {
+            CHECK_EQUAL(etl::to_arithmetic_status::Overflow, result.error());
+          }
+          else
+          {
+            CHECK(result.has_value());
+            CHECK(is_same_bits(expected, result.value()));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_correctly_rounded_float)
+    {
+      const char* texts[] =
+      {
+        "0", "-0", "1", "0.1", "3.4028234e38", "1.17549435e-38", "1.4e-45", "7e-46", "16777217", "16777219",
+        "1.00000005960464477539062500000001", "0.000000000000000000000000000000000000000000001234567890123456789"
+      };
+
+      for (size_t i = 0U; i < (sizeof(texts) / sizeof(texts[0])); ++i)
+      {
+        const Text text(texts[i]);
+
+        etl::to_arithmetic_result<float> result = etl::to_arithmetic<float>(text.c_str(), text.size());
+
+        CHECK(result.has_value());
+        CHECK(is_same_bits(strtof(texts[i], nullptr), result.value()));
+      }
+
+      // Too large.
+      const Text too_large("3.4028236e38");
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<float>(too_large.c_str(), too_large.size()).error());
+
+      // Random values.
+      std::mt19937 generator(12345);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const uint32_t bits = generator();
+        float expected;
+        std::memcpy(&expected, &bits, sizeof(expected));
+
+        if (std::isnan(expected) || std::isinf(expected))
+        {
+          continue;
+        }
+
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), (i & 1) ? "%.9g" : "%.7g", expected);
+        expected = strtof(buffer, nullptr);
+
+        const Text text(buffer);
+        etl::to_arithmetic_result<float> result = etl::to_arithmetic<float>(text.c_str(), text.size());
+
+        CHECK(result.has_value());
+        CHECK(is_same_bits(expected, result.value()));
+      }
+    }
+
     //*************************************************************************
     TEST(test_valid_long_double)
     {
@@ -1038,6 +1299,13 @@ namespace
       constexpr int i = result.value();
 
       CHECK_EQUAL(123, i);
+
+      constexpr Text::const_pointer long_text{ STR("1234567890123456") };
+
+      constexpr etl::to_arithmetic_result<uint64_t> long_result = etl::to_arithmetic<uint64_t>(long_text, 16U, etl::radix::decimal);
+      constexpr uint64_t u = long_result.value();
+
+      CHECK_EQUAL(1234567890123456ULL, u);
     }
 #endif
   }
@@ -31,6 +31,9 @@ SOFTWARE.
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
 
 #include "etl/to_string.h"
 #include "etl/string.h"
@@ -43,6 +46,13 @@ namespace
 {
   typedef etl::format_spec Format;
 
+  //***************************************************************************
+  template <typename T>
+  bool is_same_value(T lhs, T rhs)
+  {
+    return !(lhs < rhs) && !(lhs > rhs);
+  }
+
   SUITE(test_to_string)
   {
     TEST(test_issue_314)
@@ -662,6 +672,115 @@ namespace
       CHECK_EQUAL(etl::string<20>(STR("-124.0000")).c_str(), result_i.c_str());
       CHECK_EQUAL(result_d.c_str(), result_i.c_str());
     }
+
+    //*************************************************************************
+    TEST(test_integral_bases_against_ostream)
+    {
+      etl::string<70> str;
+
+      uint64_t value = 1U;
+
+      // Values of every length, with digit pairs at every position.
+      for (int i = 0; i < 200; ++i)
+      {
+        value = (value * 7U) + uint64_t(i);
+
+        std::ostringstream dec;
+        dec << value;
+
+        std::ostringstream neg;
+        neg << -int64_t(value >> 1U);
+
+        std::ostringstream hex;
+        hex << std::hex << std::uppercase << std::showbase << value;
+
+        std::ostringstream oct;
+        oct << std::oct << value;
+
+        std::string bin;
+
+        for (uint64_t v = value; v != 0U; v >>= 1U)
+        {
+          bin.insert(bin.begin(), char('0' + (v & 1U)));
+        }
+
+        CHECK_EQUAL(dec.str(), etl::to_string(value, str).c_str());
+        CHECK_EQUAL(neg.str(), etl::to_string(-int64_t(value >> 1U), str).c_str());
+        CHECK_EQUAL(hex.str(), etl::to_string(value, str, Format().hex().upper_case(true).show_base(true)).c_str());
+        CHECK_EQUAL(oct.str(), etl::to_string(value, str, Format().base(8)).c_str());
+        CHECK_EQUAL(bin.c_str(), etl::to_string(value, str, Format().binary()).c_str());
+      }
+
+      // A base that is not a power of two.
+      CHECK_EQUAL("13", etl::to_string(uint32_t(15), str, Format().base(12)).c_str());
+      CHECK_EQUAL("0b101", etl::to_string(uint8_t(5), str, Format().binary().show_base(true)).c_str());
+      CHECK_EQUAL("0", etl::to_string(uint8_t(0), str, Format().hex().show_base(true)).c_str());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::string<40> str;
+
+      const Format format = Format().shortest(true);
+
+      CHECK_EQUAL("0",                   etl::to_string(0.0, str, format).c_str());
+      CHECK_EQUAL("0.1",                 etl::to_string(0.1, str, format).c_str());
+      CHECK_EQUAL("-0.1",                etl::to_string(-0.1, str, format).c_str());
+      CHECK_EQUAL("0.3",                 etl::to_string(0.3, str, format).c_str());
+      CHECK_EQUAL("1",                   etl::to_string(1.0, str, format).c_str());
+      CHECK_EQUAL("123.456",             etl::to_string(123.456, str, format).c_str());
+      CHECK_EQUAL("0.3333333333333333",  etl::to_string(1.0 / 3.0, str, format).c_str());
+      CHECK_EQUAL("1000000",             etl::to_string(1e6, str, format).c_str());
+      CHECK_EQUAL("1e+16",               etl::to_string(1e16, str, format).c_str());
+      CHECK_EQUAL("1.5e+300",            etl::to_string(1.5e300, str, format).c_str());
+      CHECK_EQUAL("0.00001",             etl::to_string(1e-5, str, format).c_str());
+      CHECK_EQUAL("1.25e-06",            etl::to_string(1.25e-6, str, format).c_str());
+      CHECK_EQUAL("1.7976931348623157e+308", etl::to_string(1.7976931348623157e308, str, format).c_str());
+      CHECK_EQUAL("1.25E-06",            etl::to_string(1.25e-6, str, Format().shortest(true).upper_case(true)).c_str());
+
+      CHECK_EQUAL("0.1",                 etl::to_string(0.1f, str, format).c_str());
+      CHECK_EQUAL("3.4028235e+38",       etl::to_string(3.4028235e38f, str, format).c_str());
+      CHECK_EQUAL("1234567",             etl::to_string(1234567.0f, str, format).c_str());
+      CHECK_EQUAL("1.2345678e+07",       etl::to_string(12345678.0f, str, format).c_str());
+
+      // The precision is ignored, the width is not.
+      CHECK_EQUAL("   2.5",              etl::to_string(2.5, str, Format().shortest(true).precision(6).width(6)).c_str());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_round_trip)
+    {
+      etl::string<40> str;
+
+      const Format format = Format().shortest(true);
+
+      uint64_t seed = 0x123456789ABCDEFULL;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        // Random bit patterns cover every exponent, including denormals.
+        seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+        double d;
+        memcpy(&d, &seed, sizeof(d));
+
+        float f;
+        const uint32_t seed32 = uint32_t(seed >> 32U);
+        memcpy(&f, &seed32, sizeof(f));
+
+        if (!std::isnan(d) && !std::isinf(d))
+        {
+          etl::to_string(d, str, format);
+          CHECK(is_same_value(strtod(str.c_str(), ETL_NULLPTR), d));
+        }
+
+        if (!std::isnan(f) && !std::isinf(f))
+        {
+          etl::to_string(f, str, format);
+          CHECK(is_same_value(strtof(str.c_str(), ETL_NULLPTR), f));
+        }
+      }
+    }
   };
 }
-
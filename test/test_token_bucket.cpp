@@ -0,0 +1,213 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/token_bucket.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+  SUITE(test_token_bucket)
+  {
+    //*************************************************************************
+    TEST(test_burst_then_rate)
+    {
+      // 5 tokens, earning 2 every 10 ticks.
+      etl::token_bucket bucket(5U, 2U, 10U, 1000U);
+
+      CHECK_EQUAL(5U, bucket.capacity());
+      CHECK_EQUAL(5U, bucket.available(1000U));
+
+      CHECK(bucket.try_acquire(1000U, 3U));
+      CHECK(bucket.try_acquire(1000U, 2U));
+      CHECK(!bucket.try_acquire(1000U));
+      CHECK_EQUAL(0U, bucket.available(1000U));
+
+      // One token every 5 ticks, with fractions carried over.
+      CHECK(!bucket.try_acquire(1004U));
+      CHECK(bucket.try_acquire(1005U));
+      CHECK(!bucket.try_acquire(1007U));
+      CHECK(bucket.try_acquire(1010U));
+
+      // Refills to the capacity, but no more.
+      CHECK_EQUAL(5U, bucket.available(5000U));
+      CHECK(!bucket.try_acquire(5000U, 6U));
+      CHECK(bucket.try_acquire(5000U, 5U));
+    }
+
+    //*************************************************************************
+    TEST(test_start_empty_and_time_until_available)
+    {
+      etl::token_bucket bucket(4U, 1U, 3U, 0U, false);
+
+      CHECK_EQUAL(0U, bucket.available(0U));
+      CHECK_EQUAL(3U, bucket.time_until_available(0U));
+      CHECK_EQUAL(6U, bucket.time_until_available(0U, 2U));
+      CHECK_EQUAL(5U, bucket.time_until_available(1U, 2U));
+      CHECK_EQUAL(UINT32_MAX, bucket.time_until_available(1U, 5U));
+
+      CHECK_EQUAL(0U, bucket.time_until_available(6U, 2U));
+      CHECK(bucket.try_acquire(6U, 2U));
+
+      bucket.reset(6U);
+      CHECK_EQUAL(4U, bucket.available(6U));
+    }
+
+    //*************************************************************************
+    TEST(test_timestamp_wrap_and_reversal)
+    {
+      etl::token_bucket bucket(2U, 1U, 10U, 0xFFFFFFF0UL, false);
+
+      // Earlier times earn nothing.
+      CHECK_EQUAL(0U, bucket.available(0xFFFFFF00UL));
+
+      // Across the wrap, 0x20 ticks later.
+      CHECK_EQUAL(2U, bucket.available(0x00000010UL));
+      CHECK(bucket.try_acquire(0x00000010UL, 2U));
+      CHECK(!bucket.try_acquire(0x00000019UL));
+      CHECK(bucket.try_acquire(0x0000001AUL));
+    }
+
+    //*************************************************************************
+    TEST(test_high_rate)
+    {
+      // 1000 tokens per tick.
+      etl::token_bucket bucket(100000U, 1000U, 1U, 0U, false);
+
+      CHECK(!bucket.try_acquire(0U));
+      CHECK_EQUAL(1000U, bucket.available(1U));
+      CHECK_EQUAL(100000U, bucket.available(0x7FFFFFFFUL));
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_rate)
+    {
+      CHECK_THROW(etl::token_bucket(0U, 1U, 1U, 0U), etl::token_bucket_invalid_rate);
+      CHECK_THROW(etl::token_bucket(1U, 0U, 1U, 0U), etl::token_bucket_invalid_rate);
+      CHECK_THROW(etl::token_bucket(1U, 1U, 0U, 0U), etl::token_bucket_invalid_rate);
+      CHECK_THROW(etl::token_bucket(0x10000U, 1U, 0x10000U, 0U), etl::token_bucket_invalid_rate);
+    }
+
+    //*************************************************************************
+    TEST(test_token_bucket_array)
+    {
+      etl::token_bucket_array<3> buckets(2U, 1U, 10U, 0U);
+
+      CHECK_EQUAL(3U, buckets.size());
+
+      CHECK(buckets.try_acquire(0U, 0U, 2U));
+      CHECK(!buckets.try_acquire(0U, 0U));
+
+      // The others are independent.
+      CHECK(buckets.try_acquire(1U, 0U));
+      CHECK_EQUAL(1U, buckets.available(1U, 0U));
+      CHECK_EQUAL(2U, buckets.available(2U, 0U));
+
+      CHECK_EQUAL(10U, buckets.time_until_available(0U, 0U));
+      CHECK(buckets.try_acquire(0U, 10U));
+
+      buckets.reset(0U, 10U);
+      CHECK_EQUAL(2U, buckets.available(0U, 10U));
+
+      buckets.reset_all(10U, false);
+      CHECK_EQUAL(0U, buckets.available(2U, 10U));
+    }
+
+    //*************************************************************************
+    TEST(test_leaky_bucket)
+    {
+      // Holds 3, draining 1 every 10 ticks.
+      etl::leaky_bucket bucket(3U, 1U, 10U, 0U);
+
+      CHECK(bucket.try_add(0U, 2U));
+      CHECK(bucket.try_add(0U));
+      CHECK(!bucket.try_add(0U));
+      CHECK_EQUAL(3U, bucket.level(0U));
+      CHECK_EQUAL(30U, bucket.time_until_empty(0U));
+
+      CHECK_EQUAL(3U, bucket.level(5U));
+      CHECK(!bucket.try_add(9U));
+      CHECK(bucket.try_add(10U));
+      CHECK(!bucket.try_add(15U));
+
+      CHECK_EQUAL(0U, bucket.level(100U));
+      CHECK_EQUAL(0U, bucket.time_until_empty(100U));
+    }
+
+#if ETL_HAS_ATOMIC && ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    TEST(test_atomic_token_bucket)
+    {
+      etl::atomic_token_bucket bucket(3U, 1U, 10U, 0U);
+
+      CHECK(bucket.try_acquire(0U, 3U));
+      CHECK(!bucket.try_acquire(5U));
+      CHECK(bucket.try_acquire(10U));
+      CHECK_EQUAL(0U, bucket.available(10U));
+      CHECK_EQUAL(3U, bucket.available(1000U));
+    }
+
+    //*************************************************************************
+    TEST(test_atomic_token_bucket_concurrent)
+    {
+      // No refill during the test, so exactly the capacity is handed out.
+      etl::atomic_token_bucket bucket(1000U, 1U, 1U, 0U);
+
+      etl::atomic<int> acquired(0);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < 4; ++t)
+      {
+        threads.push_back(std::thread([&]()
+        {
+          for (int i = 0; i < 500; ++i)
+          {
+            if (bucket.try_acquire(0U))
+            {
+              ++acquired;
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(1000, acquired.load());
+      CHECK_EQUAL(0U, bucket.available(0U));
+    }
+#endif
+  }
+}
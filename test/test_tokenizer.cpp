@@ -0,0 +1,216 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/tokenizer.h"
+#include "etl/string_view.h"
+#include "etl/string_utilities.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef std::vector<std::string> Tokens;
+
+  //***************************************************************************
+  Tokens tokens_of(const etl::tokenizer& tokenizer)
+  {
+    Tokens result;
+
+    for (etl::tokenizer::const_iterator itr = tokenizer.begin(); itr != tokenizer.end(); ++itr)
+    {
+      result.push_back(std::string(itr->data(), itr->size()));
+    }
+
+    return result;
+  }
+
+  SUITE(test_tokenizer)
+  {
+    //*************************************************************************
+    TEST(test_keep_empty_tokens)
+    {
+      etl::tokenizer tokenizer(",,,The,cat,sat,,on,the,mat,,,", ",");
+
+      Tokens expected = { "", "", "", "The", "cat", "sat", "", "on", "the", "mat", "", "", "" };
+
+      CHECK(expected == tokens_of(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_ignore_empty_tokens)
+    {
+      etl::tokenizer tokenizer(",,,The,cat,sat,,on,the,mat,,,", ",", true);
+
+      Tokens expected = { "The", "cat", "sat", "on", "the", "mat" };
+
+      CHECK(expected == tokens_of(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_delimiters)
+    {
+      etl::tokenizer tokenizer("The cat\tsat;on the\t\tmat", " \t;", true);
+
+      Tokens expected = { "The", "cat", "sat", "on", "the", "mat" };
+
+      CHECK(expected == tokens_of(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_empty_text)
+    {
+      etl::tokenizer keep("", ",");
+      etl::tokenizer ignore("", ",", true);
+
+      CHECK(Tokens(1U, "") == tokens_of(keep));
+      CHECK(ignore.begin() == ignore.end());
+    }
+
+    //*************************************************************************
+    TEST(test_only_delimiters)
+    {
+      etl::tokenizer keep(",,", ",");
+      etl::tokenizer ignore(",,", ",", true);
+
+      CHECK(Tokens(3U, "") == tokens_of(keep));
+      CHECK(ignore.begin() == ignore.end());
+    }
+
+    //*************************************************************************
+    TEST(test_no_delimiters)
+    {
+      etl::tokenizer tokenizer("The cat sat", ",");
+
+      Tokens expected = { "The cat sat" };
+
+      CHECK(expected == tokens_of(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_quoted_tokens)
+    {
+      etl::tokenizer tokenizer("1,\"The, cat\",\"\",sat \"on,the\" mat,\"unterminated,", ",", false, '"');
+
+      Tokens expected = { "1", "The, cat", "", "sat \"on,the\" mat", "\"unterminated," };
+
+      CHECK(expected == tokens_of(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_tokens_are_views_of_the_text)
+    {
+      const char* text = "ab,cd";
+      etl::tokenizer tokenizer(text, ",");
+
+      etl::tokenizer::const_iterator itr = tokenizer.begin();
+
+      CHECK(itr->data() == text);
+      CHECK_EQUAL(2U, itr->size());
+
+      etl::tokenizer::const_iterator previous = itr++;
+
+      CHECK(previous == tokenizer.begin());
+      CHECK(itr != previous);
+      CHECK((*itr).data() == text + 3);
+      CHECK_EQUAL(2U, (*itr).size());
+
+      ++itr;
+      CHECK(itr == tokenizer.end());
+    }
+
+    //*************************************************************************
+    TEST(test_same_as_get_token)
+    {
+      const char* text = " The  cat sat,on the;;mat. ";
+      const char* delimiters = " ,;.";
+
+      for (int ignore = 0; ignore < 2; ++ignore)
+      {
+        etl::tokenizer tokenizer(text, delimiters, ignore == 1);
+        etl::tokenizer::const_iterator itr = tokenizer.begin();
+
+        etl::string_view textview(text);
+        etl::optional<etl::string_view> token;
+
+        while ((token = etl::get_token(textview, delimiters, token, ignore == 1)))
+        {
+          CHECK(itr != tokenizer.end());
+          CHECK(token.value() == *itr);
+          ++itr;
+        }
+
+        CHECK(itr == tokenizer.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wide_characters)
+    {
+      etl::u16tokenizer tokenizer(u"一é丁丂é", u"丁é", true);
+
+      std::vector<std::u16string> tokens;
+
+      for (etl::u16tokenizer::const_iterator itr = tokenizer.begin(); itr != tokenizer.end(); ++itr)
+      {
+        tokens.push_back(std::u16string(itr->data(), itr->size()));
+      }
+
+      CHECK_EQUAL(2U, tokens.size());
+      CHECK(tokens[0] == u"一");
+      CHECK(tokens[1] == u"丂");
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    constexpr size_t count_tokens(const char* text, const char* delimiters)
+    {
+      etl::tokenizer tokenizer(text, delimiters, true);
+
+      size_t count = 0U;
+
+      for (auto itr = tokenizer.begin(); itr != tokenizer.end(); ++itr)
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    TEST(test_constexpr)
+    {
+      constexpr size_t count = count_tokens(",a,,b,c,", ",");
+
+      CHECK_EQUAL(3U, count);
+    }
+#endif
+  }
+}
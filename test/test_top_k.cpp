@@ -0,0 +1,178 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/top_k.h"
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <string>
+
+namespace
+{
+  //***************************************************************************
+  std::vector<int> make_data(size_t size)
+  {
+    std::vector<int> data;
+    uint32_t seed = 12345U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = seed * 1664525U + 1013904223U;
+      data.push_back(static_cast<int>(seed >> 20));
+    }
+
+    return data;
+  }
+
+  SUITE(test_top_k)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::top_k<int, 4> top;
+
+      CHECK(top.empty());
+      CHECK(!top.full());
+      CHECK_EQUAL(0U, top.size());
+      CHECK_EQUAL(4U, top.max_size());
+    }
+
+    //*************************************************************************
+    TEST(test_fewer_than_k)
+    {
+      etl::top_k<int, 4> top;
+
+      CHECK(top.push(2));
+      CHECK(top.push(7));
+      CHECK(top.push(5));
+
+      CHECK_EQUAL(3U, top.size());
+      CHECK(!top.full());
+      CHECK_EQUAL(2, top.threshold());
+
+      int output[4] = { 0, 0, 0, 0 };
+      int* end = top.copy_sorted(output);
+
+      CHECK_EQUAL(3, end - output);
+      CHECK_EQUAL(7, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(2, output[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_keeps_the_greatest)
+    {
+      const std::vector<int> data = make_data(1000U);
+
+      etl::top_k<int, 10> top;
+      top.push(data.begin(), data.end());
+
+      std::vector<int> expected(data);
+      std::sort(expected.begin(), expected.end(), std::greater<int>());
+      expected.resize(10U);
+
+      std::vector<int> output(10U);
+      top.copy_sorted(output.begin());
+
+      CHECK(top.full());
+      CHECK_EQUAL(expected.back(), top.threshold());
+      CHECK(expected == output);
+    }
+
+    //*************************************************************************
+    TEST(test_keeps_the_least_with_greater)
+    {
+      const std::vector<int> data = make_data(1000U);
+
+      etl::top_k<int, 10, etl::greater<int> > top;
+      top.push(data.begin(), data.end());
+
+      std::vector<int> expected(data);
+      std::sort(expected.begin(), expected.end());
+      expected.resize(10U);
+
+      std::vector<int> output(10U);
+      top.copy_sorted(output.begin());
+
+      CHECK(expected == output);
+    }
+
+    //*************************************************************************
+    TEST(test_push_rejected)
+    {
+      etl::top_k<int, 2> top;
+
+      top.push(5);
+      top.push(8);
+
+      CHECK(!top.push(3));
+      CHECK(!top.push(5));
+      CHECK(top.push(6));
+      CHECK_EQUAL(6, top.threshold());
+      CHECK_EQUAL(2U, top.size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_strings)
+    {
+      etl::top_k<std::string, 2> top;
+
+      std::string a("apple");
+      std::string c("cherry");
+
+      top.push(a);
+      top.push(std::string("banana"));
+      top.push(std::move(c));
+
+      std::string output[2];
+      top.copy_sorted(output);
+
+      CHECK_EQUAL(std::string("cherry"), output[0]);
+      CHECK_EQUAL(std::string("banana"), output[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::top_k<int, 3> top;
+
+      top.push(1);
+      top.push(2);
+      top.clear();
+
+      CHECK(top.empty());
+
+      top.push(4);
+      CHECK_EQUAL(4, top.threshold());
+    }
+  };
+}
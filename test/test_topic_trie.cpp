@@ -0,0 +1,310 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/topic_trie.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  typedef etl::topic_trie<int, 16, 8> Trie;
+
+  //***************************************************************************
+  struct Collector
+  {
+    Collector(std::vector<int>& matches_)
+      : matches(matches_)
+    {
+    }
+
+    void operator ()(int subscriber)
+    {
+      matches.push_back(subscriber);
+    }
+
+    std::vector<int>& matches;
+  };
+
+  //***************************************************************************
+  std::vector<int> match(const Trie& trie, const char* topic)
+  {
+    std::vector<int> matches;
+    trie.match(etl::string_view(topic), Collector(matches));
+    std::sort(matches.begin(), matches.end());
+
+    return matches;
+  }
+
+  //***************************************************************************
+  std::vector<int> list(int a = -1, int b = -1, int c = -1, int d = -1)
+  {
+    std::vector<int> result;
+
+    const int values[] = { a, b, c, d };
+
+    for (size_t i = 0U; i < 4U; ++i)
+    {
+      if (values[i] != -1)
+      {
+        result.push_back(values[i]);
+      }
+    }
+
+    std::sort(result.begin(), result.end());
+
+    return result;
+  }
+
+  SUITE(test_topic_trie)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Trie trie;
+
+      CHECK(trie.empty());
+      CHECK(!trie.full());
+      CHECK_EQUAL(0U, trie.size());
+      CHECK_EQUAL(8U, trie.max_size());
+      CHECK_EQUAL(0U, trie.node_count());
+      CHECK_EQUAL(16U, trie.max_nodes());
+      CHECK(!trie.has_match(etl::string_view("a/b")));
+    }
+
+    //*************************************************************************
+    TEST(test_exact_match)
+    {
+      Trie trie;
+
+      CHECK(trie.subscribe(etl::string_view("home/kitchen/temperature"), 1));
+      CHECK(trie.subscribe(etl::string_view("home/kitchen/humidity"), 2));
+      CHECK(trie.subscribe(etl::string_view("home/kitchen/temperature"), 3));
+
+      CHECK_EQUAL(3U, trie.size());
+      CHECK_EQUAL(4U, trie.node_count());
+
+      CHECK(list(1, 3) == match(trie, "home/kitchen/temperature"));
+      CHECK(list(2) == match(trie, "home/kitchen/humidity"));
+      CHECK(list() == match(trie, "home/kitchen"));
+      CHECK(list() == match(trie, "home/kitchen/temperature/max"));
+      CHECK(list() == match(trie, "home/Kitchen/temperature"));
+    }
+
+    //*************************************************************************
+    TEST(test_single_level_wildcard)
+    {
+      Trie trie;
+
+      trie.subscribe(etl::string_view("home/+/temperature"), 1);
+      trie.subscribe(etl::string_view("+/+"), 2);
+      trie.subscribe(etl::string_view("+"), 3);
+
+      CHECK(list(1) == match(trie, "home/kitchen/temperature"));
+      CHECK(list(1) == match(trie, "home//temperature"));
+      CHECK(list(2) == match(trie, "home/temperature"));
+      CHECK(list(2) == match(trie, "home/kitchen"));
+      CHECK(list(2) == match(trie, "/kitchen"));
+      CHECK(list(3) == match(trie, "home"));
+      CHECK(list(3) == match(trie, ""));
+    }
+
+    //*************************************************************************
+    TEST(test_multi_level_wildcard)
+    {
+      Trie trie;
+
+      trie.subscribe(etl::string_view("home/#"), 1);
+      trie.subscribe(etl::string_view("#"), 2);
+      trie.subscribe(etl::string_view("home/+/#"), 3);
+
+      CHECK(list(1, 2) == match(trie, "home"));
+      CHECK(list(1, 2, 3) == match(trie, "home/kitchen"));
+      CHECK(list(1, 2, 3) == match(trie, "home/kitchen/temperature/max"));
+      CHECK(list(2) == match(trie, "garden/shed"));
+    }
+
+    //*************************************************************************
+    TEST(test_system_topics)
+    {
+      Trie trie;
+
+      trie.subscribe(etl::string_view("#"), 1);
+      trie.subscribe(etl::string_view("+/broker/load"), 2);
+      trie.subscribe(etl::string_view("$SYS/#"), 3);
+      trie.subscribe(etl::string_view("$SYS/+/load"), 4);
+
+      CHECK(list(3, 4) == match(trie, "$SYS/broker/load"));
+      CHECK(list(1, 2) == match(trie, "SYS/broker/load"));
+    }
+
+    //*************************************************************************
+    TEST(test_one_subscriber_many_filters)
+    {
+      Trie trie;
+
+      trie.subscribe(etl::string_view("a/b"), 1);
+      trie.subscribe(etl::string_view("a/+"), 1);
+      trie.subscribe(etl::string_view("a/#"), 1);
+
+      // Called once for each matching filter.
+      CHECK(list(1, 1, 1) == match(trie, "a/b"));
+      std::vector<int> matches;
+      CHECK_EQUAL(3U, trie.match(etl::string_view("a/b"), Collector(matches)));
+    }
+
+    //*************************************************************************
+    TEST(test_subscribe_twice)
+    {
+      Trie trie;
+
+      CHECK(trie.subscribe(etl::string_view("a/b"), 1));
+      CHECK(trie.subscribe(etl::string_view("a/b"), 1));
+
+      CHECK_EQUAL(1U, trie.size());
+      CHECK(list(1) == match(trie, "a/b"));
+    }
+
+    //*************************************************************************
+    TEST(test_wildcards_in_topic_are_literal)
+    {
+      Trie trie;
+
+      trie.subscribe(etl::string_view("a/b"), 1);
+      trie.subscribe(etl::string_view("a/+"), 2);
+
+      CHECK(list(2) == match(trie, "a/+"));
+      CHECK(list(2) == match(trie, "a/#"));
+      CHECK(list() == match(trie, "+/b"));
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_filters)
+    {
+      CHECK(Trie::is_valid_filter(etl::string_view("a/+/#")));
+      CHECK(Trie::is_valid_filter(etl::string_view("#")));
+      CHECK(Trie::is_valid_filter(etl::string_view("/")));
+      CHECK(!Trie::is_valid_filter(etl::string_view("a/#/b")));
+      CHECK(!Trie::is_valid_filter(etl::string_view("a/b#")));
+      CHECK(!Trie::is_valid_filter(etl::string_view("a+/b")));
+      CHECK(!Trie::is_valid_filter(etl::string_view("##")));
+
+      Trie trie;
+
+      CHECK_THROW(trie.subscribe(etl::string_view("a/#/b"), 1), etl::topic_trie_invalid_filter);
+      CHECK(trie.empty());
+      CHECK_EQUAL(0U, trie.node_count());
+    }
+
+    //*************************************************************************
+    TEST(test_unsubscribe_prunes_nodes)
+    {
+      Trie trie;
+
+      trie.subscribe(etl::string_view("a/b/c"), 1);
+      trie.subscribe(etl::string_view("a/b/d"), 2);
+      trie.subscribe(etl::string_view("a/+/#"), 3);
+
+      CHECK_EQUAL(6U, trie.node_count());
+
+      CHECK(!trie.unsubscribe(etl::string_view("a/b/c"), 2));
+      CHECK(!trie.unsubscribe(etl::string_view("a/b"), 1));
+      CHECK(!trie.unsubscribe(etl::string_view("x/y/z"), 1));
+
+      CHECK(trie.unsubscribe(etl::string_view("a/b/c"), 1));
+      CHECK_EQUAL(5U, trie.node_count());
+      CHECK(list(3) == match(trie, "a/b/c"));
+
+      CHECK(trie.unsubscribe(etl::string_view("a/+/#"), 3));
+      CHECK_EQUAL(3U, trie.node_count());
+
+      CHECK(trie.unsubscribe(etl::string_view("a/b/d"), 2));
+      CHECK_EQUAL(0U, trie.node_count());
+      CHECK(trie.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_unsubscribe_all)
+    {
+      Trie trie;
+
+      trie.subscribe(etl::string_view("a/b"), 1);
+      trie.subscribe(etl::string_view("a/+"), 2);
+      trie.subscribe(etl::string_view("#"), 1);
+
+      CHECK_EQUAL(2U, trie.unsubscribe_all(1));
+      CHECK_EQUAL(1U, trie.size());
+      CHECK_EQUAL(2U, trie.node_count());
+      CHECK(list(2) == match(trie, "a/b"));
+
+      CHECK_EQUAL(0U, trie.unsubscribe_all(1));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::topic_trie<int, 4, 2> trie;
+
+      CHECK(trie.subscribe(etl::string_view("a/b/c"), 1));
+      CHECK(trie.subscribe(etl::string_view("a/b/c"), 2));
+      CHECK(trie.full());
+
+      CHECK_THROW(trie.subscribe(etl::string_view("a/b/c"), 3), etl::topic_trie_full);
+
+      trie.unsubscribe(etl::string_view("a/b/c"), 2);
+
+      // Only one node free. The partial path is released.
+      CHECK_THROW(trie.subscribe(etl::string_view("a/x/y"), 3), etl::topic_trie_full);
+      CHECK_EQUAL(3U, trie.node_count());
+
+      CHECK(trie.subscribe(etl::string_view("a/x"), 3));
+      CHECK_EQUAL(4U, trie.node_count());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Trie trie;
+
+      trie.subscribe(etl::string_view("a/b"), 1);
+      trie.subscribe(etl::string_view("c/#"), 2);
+
+      trie.clear();
+
+      CHECK(trie.empty());
+      CHECK_EQUAL(0U, trie.node_count());
+      CHECK(!trie.has_match(etl::string_view("a/b")));
+
+      CHECK(trie.subscribe(etl::string_view("a/b"), 1));
+      CHECK(trie.has_match(etl::string_view("a/b")));
+    }
+  };
+}
@@ -0,0 +1,386 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/trace.h"
+#include "etl/message_router.h"
+#include "etl/fsm.h"
+#include "etl/callback_timer.h"
+#include "etl/scheduler.h"
+
+#include <vector>
+
+#if ETL_HAS_TRACE
+
+namespace
+{
+  uint32_t ticks = 0U;
+
+  uint32_t get_ticks()
+  {
+    return ticks;
+  }
+
+  //***************************************************************************
+  // Two buffers, selected by the 'core' that is running.
+  //***************************************************************************
+  etl::trace_buffer<8> core_buffers[2];
+  size_t current_core = 0U;
+
+  etl::itrace_buffer* select_buffer()
+  {
+    return &core_buffers[current_core];
+  }
+
+  //***************************************************************************
+  // Reads all of the records in a buffer.
+  //***************************************************************************
+  std::vector<etl::trace_record> read_all(etl::itrace_buffer& buffer)
+  {
+    std::vector<etl::trace_record> records;
+    etl::trace_record record;
+
+    while (buffer.read(record))
+    {
+      records.push_back(record);
+    }
+
+    return records;
+  }
+
+  //***************************************************************************
+  // A router and an FSM.
+  //***************************************************************************
+  struct Go : public etl::message<7>
+  {
+  };
+
+  class Router : public etl::message_router<Router, Go>
+  {
+  public:
+
+    Router()
+      : message_router(3)
+    {
+    }
+
+    void on_receive(const Go&)
+    {
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+  };
+
+  class Machine : public etl::fsm
+  {
+  public:
+
+    Machine()
+      : fsm(5)
+    {
+    }
+  };
+
+  class First : public etl::fsm_state<Machine, First, 0, Go>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Go&)
+    {
+      return 1;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+  };
+
+  class Second : public etl::fsm_state<Machine, Second, 1, Go>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Go&)
+    {
+      return Self_Transition;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+  };
+
+  //***************************************************************************
+  // A task with one piece of work.
+  //***************************************************************************
+  class Task : public etl::task
+  {
+  public:
+
+    Task(etl::task_priority_t priority)
+      : task(priority)
+      , work(1U)
+    {
+    }
+
+    uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return work;
+    }
+
+    void task_process_work() ETL_OVERRIDE
+    {
+      work = 0U;
+    }
+
+    uint32_t work;
+  };
+
+  void timer_callback()
+  {
+  }
+
+  SUITE(test_trace)
+  {
+    //*************************************************************************
+    TEST(test_buffer_write_read_and_drop)
+    {
+      etl::trace_buffer<4> buffer;
+
+      etl::trace_record record = { 1U, etl::trace_id::User_Base, 10U };
+
+      size_t written = 0U;
+
+      for (int i = 0; i < 6; ++i)
+      {
+        record.payload = uint32_t(i);
+
+        if (buffer.write(record))
+        {
+          ++written;
+        }
+      }
+
+      CHECK(written < 6U);
+      CHECK_EQUAL(6U - written, buffer.dropped_count());
+
+      std::vector<etl::trace_record> records = read_all(buffer);
+
+      CHECK_EQUAL(written, records.size());
+
+      for (size_t i = 0U; i < records.size(); ++i)
+      {
+        CHECK_EQUAL(i, records[i].payload);
+      }
+
+      // Space is available again.
+      CHECK(buffer.write(record));
+    }
+
+    //*************************************************************************
+    TEST(test_buffer_bulk_read)
+    {
+      etl::trace_buffer<8> buffer;
+
+      for (uint32_t i = 0U; i < 5U; ++i)
+      {
+        etl::trace_record record = { i, etl::trace_id::User_Base, i * 10U };
+        buffer.write(record);
+      }
+
+      etl::trace_record records[3];
+
+      CHECK_EQUAL(3U, buffer.read(etl::span<etl::trace_record>(records)));
+      CHECK_EQUAL(0U,  records[0].payload);
+      CHECK_EQUAL(20U, records[2].payload);
+
+      CHECK_EQUAL(2U, buffer.read(etl::span<etl::trace_record>(records)));
+      CHECK_EQUAL(30U, records[0].payload);
+      CHECK_EQUAL(40U, records[1].payload);
+
+      CHECK_EQUAL(0U, buffer.read(etl::span<etl::trace_record>(records)));
+    }
+
+    //*************************************************************************
+    TEST(test_record_with_buffer_and_clock)
+    {
+      etl::trace_buffer<8> buffer;
+
+      // Nowhere to record.
+      ETL_TRACE(etl::trace_id::User_Base, 1U);
+
+      etl::trace::set_buffer(buffer);
+      ETL_TRACE(etl::trace_id::User_Base, 2U);
+
+      etl::trace::set_clock(etl::trace::clock_type::create<get_ticks>());
+      ticks = 100U;
+      ETL_TRACE(etl::trace_id::User_Base + 1U, 3U);
+
+      etl::trace::clear();
+      ETL_TRACE(etl::trace_id::User_Base, 4U);
+
+      std::vector<etl::trace_record> records = read_all(buffer);
+
+      CHECK_EQUAL(2U, records.size());
+      CHECK_EQUAL(0U,   records[0].timestamp);
+      CHECK_EQUAL(etl::trace_id::User_Base, records[0].event_id);
+      CHECK_EQUAL(2U,   records[0].payload);
+      CHECK_EQUAL(100U, records[1].timestamp);
+      CHECK_EQUAL(etl::trace_id::User_Base + 1U, records[1].event_id);
+      CHECK_EQUAL(3U,   records[1].payload);
+    }
+
+    //*************************************************************************
+    TEST(test_selector_per_core)
+    {
+      etl::trace::set_selector(etl::trace::selector_type::create<select_buffer>());
+
+      current_core = 0U;
+      ETL_TRACE(etl::trace_id::User_Base, 0U);
+      current_core = 1U;
+      ETL_TRACE(etl::trace_id::User_Base, 1U);
+      ETL_TRACE(etl::trace_id::User_Base, 2U);
+
+      etl::trace::clear();
+
+      CHECK_EQUAL(1U, read_all(core_buffers[0]).size());
+      CHECK_EQUAL(2U, read_all(core_buffers[1]).size());
+    }
+
+    //*************************************************************************
+    TEST(test_message_router_probe)
+    {
+      etl::trace_buffer<8> buffer;
+      etl::trace::set_buffer(buffer);
+
+      Router router;
+      router.receive(Go());
+
+      etl::trace::clear();
+
+      std::vector<etl::trace_record> records = read_all(buffer);
+
+      CHECK_EQUAL(1U, records.size());
+      CHECK_EQUAL(etl::trace_id::Message_Router_Receive, records[0].event_id);
+      CHECK_EQUAL(etl::trace_payload(3U, 7U), records[0].payload);
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_probe)
+    {
+      Machine machine;
+      First   first;
+      Second  second;
+      etl::ifsm_state* states[] = { &first, &second };
+
+      machine.set_states(states, 2U);
+      machine.start();
+
+      etl::trace_buffer<8> buffer;
+      etl::trace::set_buffer(buffer);
+
+      machine.receive(Go()); // First -> Second
+      machine.receive(Go()); // Second -> Second
+
+      etl::trace::clear();
+
+      std::vector<etl::trace_record> records = read_all(buffer);
+
+      std::vector<etl::trace_record> transitions;
+
+      for (size_t i = 0U; i < records.size(); ++i)
+      {
+        if (records[i].event_id == etl::trace_id::Fsm_Transition)
+        {
+          transitions.push_back(records[i]);
+        }
+      }
+
+      CHECK_EQUAL(2U, transitions.size());
+      CHECK_EQUAL(etl::trace_payload(5U, 1U), transitions[0].payload);
+      CHECK_EQUAL(etl::trace_payload(5U, 1U), transitions[1].payload);
+    }
+
+    //*************************************************************************
+    TEST(test_callback_timer_probe)
+    {
+      etl::callback_timer<2> timers;
+
+      etl::timer::id::type id = timers.register_timer(timer_callback, 10U, etl::timer::mode::Single_Shot);
+      timers.enable(true);
+      timers.start(id);
+
+      etl::trace_buffer<8> buffer;
+      etl::trace::set_buffer(buffer);
+
+      timers.tick(5U);
+      timers.tick(5U);
+
+      etl::trace::clear();
+
+      std::vector<etl::trace_record> records = read_all(buffer);
+
+      CHECK_EQUAL(1U, records.size());
+      CHECK_EQUAL(etl::trace_id::Callback_Timer_Tick, records[0].event_id);
+      CHECK_EQUAL(id, records[0].payload);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_dispatch_probe)
+    {
+      Task task1(1U);
+      Task task2(2U);
+
+      etl::vector<etl::task*, 2> tasks;
+      tasks.push_back(&task2);
+      tasks.push_back(&task1);
+
+      etl::trace_buffer<8> buffer;
+      etl::trace::set_buffer(buffer);
+
+      etl::scheduler_policy_sequential_single policy;
+      policy.schedule_tasks(tasks);
+      policy.schedule_tasks(tasks);
+
+      etl::trace::clear();
+
+      std::vector<etl::trace_record> records = read_all(buffer);
+
+      CHECK_EQUAL(2U, records.size());
+      CHECK_EQUAL(etl::trace_id::Scheduler_Dispatch, records[0].event_id);
+      CHECK_EQUAL(2U, records[0].payload);
+      CHECK_EQUAL(1U, records[1].payload);
+    }
+  }
+}
+
+#endif
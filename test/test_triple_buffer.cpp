@@ -0,0 +1,177 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/triple_buffer.h"
+
+#include <thread>
+#include <string>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  const uint32_t Writes = 100000U;
+
+  //***************************************************************************
+  /// A value whose fields are consistent only if written together.
+  //***************************************************************************
+  struct Sample
+  {
+    uint32_t sequence;
+    uint32_t squared;
+    uint8_t  check;
+  };
+
+  SUITE(test_triple_buffer)
+  {
+    //*************************************************************************
+    TEST(test_initial_state)
+    {
+      etl::triple_buffer<int> buffer(42);
+
+      CHECK(!buffer.has_update());
+      CHECK(!buffer.update());
+      CHECK_EQUAL(42, buffer.read_buffer());
+
+      int value = 0;
+      CHECK(!buffer.read(value));
+      CHECK_EQUAL(42, value);
+    }
+
+    //*************************************************************************
+    TEST(test_latest_value_wins)
+    {
+      etl::triple_buffer<int> buffer(0);
+
+      buffer.write(1);
+      CHECK(buffer.has_update());
+
+      buffer.write(2);
+      buffer.write(3);
+
+      // Only the latest value is seen.
+      CHECK(buffer.update());
+      CHECK_EQUAL(3, buffer.read_buffer());
+      CHECK(!buffer.has_update());
+      CHECK(!buffer.update());
+      CHECK_EQUAL(3, buffer.read_buffer());
+
+      buffer.write(4);
+      int value = 0;
+      CHECK(buffer.read(value));
+      CHECK_EQUAL(4, value);
+    }
+
+    //*************************************************************************
+    TEST(test_write_in_place)
+    {
+      etl::triple_buffer<Sample> buffer;
+
+      for (uint32_t i = 1U; i <= 10U; ++i)
+      {
+        Sample& sample = buffer.write_buffer();
+        sample.sequence = i;
+        sample.squared  = i * i;
+        sample.check    = uint8_t(i);
+        buffer.publish();
+
+        CHECK(buffer.update());
+        CHECK_EQUAL(i,     buffer.read_buffer().sequence);
+        CHECK_EQUAL(i * i, buffer.read_buffer().squared);
+
+        // The consumer's buffer is never the producer's.
+        CHECK(&buffer.read_buffer() != &buffer.write_buffer());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_move)
+    {
+      etl::triple_buffer<std::string> buffer;
+
+      std::string text("a string too long for the small string buffer");
+      buffer.write(std::move(text));
+
+      CHECK(buffer.update());
+      CHECK_EQUAL(std::string("a string too long for the small string buffer"), buffer.read_buffer());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      etl::triple_buffer<Sample> buffer;
+
+      bool torn = false;
+
+      std::thread consumer([&buffer, &torn]()
+      {
+        uint32_t last = 0U;
+
+        while (last != Writes)
+        {
+          if (buffer.update())
+          {
+            const Sample& sample = buffer.read_buffer();
+
+            // Complete, and newer than the last value taken.
+            if ((sample.squared != (sample.sequence * sample.sequence)) ||
+                (sample.check   != uint8_t(sample.sequence)) ||
+                (sample.sequence <= last))
+            {
+              torn = true;
+            }
+
+            last = sample.sequence;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      for (uint32_t i = 1U; i <= Writes; ++i)
+      {
+        Sample& sample = buffer.write_buffer();
+        sample.sequence = i;
+        sample.squared  = i * i;
+        sample.check    = uint8_t(i);
+        buffer.publish();
+      }
+
+      consumer.join();
+
+      CHECK(!torn);
+    }
+  };
+}
+
+#endif
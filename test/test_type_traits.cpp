@@ -34,12 +34,24 @@ SOFTWARE.
 namespace
 {
   struct TestData { };
+
+  struct Relocatable
+  {
+    Relocatable() : p(nullptr) {}
+    Relocatable(const Relocatable&) : p(nullptr) {}
+    ~Relocatable() {}
+
+    int* p;
+  };
 }
 
 namespace etl
 {
   template <>
   struct size_of<TestData> : integral_constant<size_t, 20U> {};
+
+  template <>
+  struct is_trivially_relocatable<Relocatable> : etl::true_type {};
 }
 
 namespace
@@ -1320,4 +1332,27 @@ namespace
     CHECK_FALSE(bool(etl::is_base_of_all<Base, D1, D2, D3, D4>::value));
 #endif
   }
+
+  //*************************************************************************
+  TEST(test_is_trivially_relocatable)
+  {
+#if ETL_USING_CPP17
+    CHECK_TRUE(etl::is_trivially_relocatable_v<int>);
+    CHECK_TRUE(etl::is_trivially_relocatable_v<int*>);
+#if ETL_USING_STL || defined(ETL_USE_TYPE_TRAITS_BUILTINS) || defined(ETL_USER_DEFINED_TYPE_TRAITS)
+    CHECK_TRUE(etl::is_trivially_relocatable_v<Object>);
+#endif
+    CHECK_TRUE(etl::is_trivially_relocatable_v<Relocatable>);
+    CHECK_FALSE(etl::is_trivially_relocatable_v<TestData* const&>);
+#else
+    CHECK_TRUE(etl::is_trivially_relocatable<int>::value);
+    CHECK_TRUE(etl::is_trivially_relocatable<int*>::value);
+#if ETL_USING_STL || defined(ETL_USE_TYPE_TRAITS_BUILTINS) || defined(ETL_USER_DEFINED_TYPE_TRAITS)
+    CHECK_TRUE(etl::is_trivially_relocatable<Object>::value);
+#endif
+    CHECK_TRUE(etl::is_trivially_relocatable<Relocatable>::value);
+    CHECK_FALSE(etl::is_trivially_relocatable<TestData* const&>::value);
+#endif
+    CHECK_FALSE(std::is_trivially_copyable<Relocatable>::value);
+  }
 }
@@ -0,0 +1,661 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "data.h"
+
+#include "etl/unordered_flat_map.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+
+namespace
+{
+  //*************************************************************************
+  // Forces every key into one of four home slots.
+  struct bad_hash
+  {
+    size_t operator()(int key) const
+    {
+      return size_t(key) % 4U;
+    }
+  };
+
+  //*************************************************************************
+  // Every key has the same home slot.
+  struct constant_hash
+  {
+    size_t operator()(int) const
+    {
+      return 5U;
+    }
+  };
+
+  //*************************************************************************
+  struct CustomHashFunction
+  {
+    CustomHashFunction(int id_ = 0)
+      : id(id_)
+    {
+    }
+
+    size_t operator ()(int e) const
+    {
+      return size_t(e);
+    }
+
+    int id;
+  };
+
+  //*************************************************************************
+  struct CustomKeyEq
+  {
+    CustomKeyEq(int id_ = 0)
+      : id(id_)
+    {
+    }
+
+    bool operator ()(int lhs, int rhs) const
+    {
+      return (lhs == rhs);
+    }
+
+    int id;
+  };
+
+  typedef TestDataNDC<std::string> NDC;
+  typedef TestDataM<int>           ItemM;
+
+  SUITE(test_unordered_flat_map)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::unordered_flat_map<int, std::string, SIZE>         Data;
+    typedef etl::iunordered_flat_map<int, std::string>              IData;
+    typedef etl::unordered_flat_map<int, NDC, SIZE, 16, bad_hash>   DataNDC;
+    typedef etl::unordered_flat_map<int, ItemM, SIZE>               DataM;
+    typedef std::unordered_map<int, std::string>                    Compare_Data;
+
+    //*************************************************************************
+    template <typename TMap1, typename TMap2>
+    bool Check_Same(const TMap1& map1, const TMap2& map2)
+    {
+      if (size_t(std::distance(map1.begin(), map1.end())) != map2.size())
+      {
+        return false;
+      }
+
+      for (typename TMap1::const_iterator itr = map1.begin(); itr != map1.end(); ++itr)
+      {
+        typename TMap2::const_iterator other = map2.find(itr->first);
+
+        if ((other == map2.end()) || !(other->second == itr->second))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    std::vector<std::pair<int, std::string>> initial_data =
+    {
+      { 0, "0" }, { 1, "1" }, { 2, "2" }, { 3, "3" }, { 4, "4" },
+      { 5, "5" }, { 6, "6" }, { 7, "7" }, { 8, "8" }, { 9, "9" }
+    };
+
+    std::vector<std::pair<int, std::string>> excess_data =
+    {
+      { 0, "0" }, { 1, "1" }, { 2, "2" }, { 3, "3" }, { 4, "4" },
+      { 5, "5" }, { 6, "6" }, { 7, "7" }, { 8, "8" }, { 9, "9" },
+      { 10, "10" }
+    };
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK_EQUAL(16U, data.bucket_count());
+      CHECK_EQUAL(16U, data.max_bucket_count());
+      CHECK(data.begin() == data.end());
+      CHECK(data.cbegin() == data.cend());
+    }
+
+    //*************************************************************************
+    TEST(test_default_slot_count)
+    {
+      CHECK_EQUAL(2U,   (etl::unordered_flat_map<int, int, 1>::MAX_BUCKETS));
+      CHECK_EQUAL(8U,   (etl::unordered_flat_map<int, int, 6>::MAX_BUCKETS));
+      CHECK_EQUAL(16U,  (etl::unordered_flat_map<int, int, 8>::MAX_BUCKETS));
+      CHECK_EQUAL(16U,  (etl::unordered_flat_map<int, int, 14>::MAX_BUCKETS));
+      CHECK_EQUAL(32U,  (etl::unordered_flat_map<int, int, 15>::MAX_BUCKETS));
+      CHECK_EQUAL(128U, (etl::unordered_flat_map<int, int, 100>::MAX_BUCKETS));
+    }
+
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST && !defined(ETL_TEMPLATE_DEDUCTION_GUIDE_TESTS_DISABLED)
+    //*************************************************************************
+    TEST(test_cpp17_deduced_constructor)
+    {
+      etl::unordered_flat_map data{ std::pair<int, std::string>{ 0, "0" }, std::pair<int, std::string>{ 1, "1" },
+                                    std::pair<int, std::string>{ 2, "2" } };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK_EQUAL("0", data[0]);
+      CHECK_EQUAL("1", data[1]);
+      CHECK_EQUAL("2", data[2]);
+    }
+#endif
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST(test_make_unordered_flat_map)
+    {
+      auto data = etl::make_unordered_flat_map<int, std::string>(std::pair<int, std::string>{ 0, "0" },
+                                                                 std::pair<int, std::string>{ 1, "1" },
+                                                                 std::pair<int, std::string>{ 2, "2" });
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK_EQUAL("0", data.at(0));
+      CHECK_EQUAL("1", data.at(1));
+      CHECK_EQUAL("2", data.at(2));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Compare_Data compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(data.full());
+      CHECK(Check_Same(data, compare_data));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move_constructor)
+    {
+      Data data1(initial_data.begin(), initial_data.end());
+      Data data2(data1);
+
+      CHECK(data1 == data2);
+
+      Data data3(std::move(data1));
+
+      CHECK(data2 == data3);
+    }
+
+    //*************************************************************************
+    TEST(test_move_elements)
+    {
+      DataM data1;
+      data1.insert(DataM::value_type(1, ItemM(1)));
+      data1.insert(DataM::value_type(2, ItemM(2)));
+      data1.insert(DataM::value_type(3, ItemM(3)));
+
+      DataM data2(std::move(data1));
+
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(1, data2.at(1).value);
+      CHECK_EQUAL(2, data2.at(2).value);
+      CHECK_EQUAL(3, data2.at(3).value);
+
+      DataM data3;
+      data3 = std::move(data2);
+
+      CHECK_EQUAL(3U, data3.size());
+      CHECK_EQUAL(1, data3.at(1).value);
+      CHECK_EQUAL(2, data3.at(2).value);
+      CHECK_EQUAL(3, data3.at(3).value);
+    }
+
+    //*************************************************************************
+    TEST(test_assignment)
+    {
+      Data data1(initial_data.begin(), initial_data.end());
+      Data data2;
+
+      data2 = data1;
+
+      CHECK(data1 == data2);
+
+      IData& idata = data2;
+      idata = idata;
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_index_read_write)
+    {
+      Data data(initial_data.begin(), initial_data.begin() + 5);
+
+      CHECK_EQUAL("3", data[3]);
+
+      data[3]  = "three";
+      data[20] = "twenty";
+
+      CHECK_EQUAL(6U, data.size());
+      CHECK_EQUAL("three",  data[3]);
+      CHECK_EQUAL("twenty", data[20]);
+      CHECK_EQUAL("",       data[21]);
+      CHECK_EQUAL(7U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      const Data& cdata = data;
+
+      CHECK_EQUAL("0", data.at(0));
+      CHECK_EQUAL("9", cdata.at(9));
+      CHECK_THROW(data.at(10), etl::unordered_flat_map_out_of_range);
+      CHECK_THROW(cdata.at(10), etl::unordered_flat_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value)
+    {
+      Data data;
+
+      std::pair<Data::iterator, bool> result = data.insert(Data::value_type(1, "1"));
+
+      CHECK(result.second);
+      CHECK_EQUAL(1, result.first->first);
+      CHECK_EQUAL("1", result.first->second);
+
+      // An existing key returns the existing element.
+      result = data.insert(Data::value_type(1, "one"));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(1, result.first->first);
+      CHECK_EQUAL("1", result.first->second);
+      CHECK_EQUAL(1U, data.size());
+
+      Data::iterator itr = data.insert(data.cbegin(), Data::value_type(2, "2"));
+
+      CHECK_EQUAL(2, itr->first);
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value_excess)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(Data::value_type(10, "10")), etl::unordered_flat_map_full);
+      CHECK_THROW(data[10], etl::unordered_flat_map_full);
+
+      // An existing key is not an error.
+      CHECK_NO_THROW(data.insert(Data::value_type(5, "5")));
+      CHECK_NO_THROW(data[5]);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_excess)
+    {
+      Data data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::unordered_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_non_default_constructible_values)
+    {
+      DataNDC data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(DataNDC::value_type(i, NDC(std::to_string(i))));
+      }
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK_EQUAL(std::to_string(i), data.at(i).value);
+      }
+
+      data.erase(4);
+      data.erase(0);
+
+      CHECK_EQUAL(8U, data.size());
+      CHECK(data.find(0) == data.end());
+      CHECK(data.find(4) == data.end());
+      CHECK_EQUAL("8", data.at(8).value);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(5));
+      CHECK_EQUAL(0U, data.erase(5));
+      CHECK_EQUAL(SIZE - 1U, data.size());
+      CHECK(data.find(5) == data.end());
+      CHECK_EQUAL(0U, data.count(5));
+      CHECK(!data.contains(5));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_while_iterating)
+    {
+      etl::unordered_flat_map<int, std::string, 20, 32, bad_hash> data;
+      Compare_Data compare_data;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data[i * 3] = std::to_string(i * 3);
+        compare_data[i * 3] = std::to_string(i * 3);
+      }
+
+      size_t visited = 0U;
+
+      // Erase the even keys.
+      for (auto itr = data.begin(); itr != data.end();)
+      {
+        ++visited;
+
+        if ((itr->first % 2) == 0)
+        {
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      for (auto itr = compare_data.begin(); itr != compare_data.end();)
+      {
+        if ((itr->first % 2) == 0)
+        {
+          itr = compare_data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(20U, visited);
+      CHECK_EQUAL(10U, data.size());
+      CHECK(Check_Same(data, compare_data));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+
+      Data::iterator first = data.begin();
+      std::advance(first, 2);
+      Data::iterator last = first;
+      std::advance(last, 5);
+
+      int next_key = last->first;
+
+      Data::iterator itr = data.erase(first, last);
+
+      CHECK_EQUAL(5U, data.size());
+      CHECK_EQUAL(next_key, itr->first);
+
+      itr = data.erase(data.begin(), data.end());
+
+      CHECK(data.empty());
+      CHECK(itr == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_equal_range)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      const Data& cdata = data;
+
+      CHECK_EQUAL("3", data.find(3)->second);
+      CHECK_EQUAL("4", cdata.find(4)->second);
+      CHECK(data.find(11) == data.end());
+      CHECK(cdata.find(11) == cdata.end());
+
+      std::pair<Data::iterator, Data::iterator> range = data.equal_range(5);
+
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(5, range.first->first);
+
+      std::pair<Data::const_iterator, Data::const_iterator> crange = cdata.equal_range(11);
+
+      CHECK(crange.first  == cdata.end());
+      CHECK(crange.second == cdata.end());
+    }
+
+    //*************************************************************************
+    TEST(test_equal)
+    {
+      Data data1(initial_data.begin(), initial_data.end());
+      Data data2(initial_data.rbegin(), initial_data.rend());
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+
+      data2[3] = "three";
+
+      CHECK(data1 != data2);
+
+      data2.erase(3);
+
+      CHECK(data1 != data2);
+    }
+
+    //*************************************************************************
+    TEST(test_hash_and_key_eq)
+    {
+      etl::unordered_flat_map<int, int, 5, 8, CustomHashFunction, CustomKeyEq> data1(CustomHashFunction(1), CustomKeyEq(2));
+
+      CHECK_EQUAL(1, data1.hash_function().id);
+      CHECK_EQUAL(2, data1.key_eq().id);
+
+      etl::unordered_flat_map<int, int, 5, 8, CustomHashFunction, CustomKeyEq> data2(data1);
+
+      CHECK_EQUAL(1, data2.hash_function().id);
+      CHECK_EQUAL(2, data2.key_eq().id);
+
+      etl::unordered_flat_map<int, int, 5, 8, CustomHashFunction, CustomKeyEq> data3;
+      data3 = data1;
+
+      CHECK_EQUAL(1, data3.hash_function().id);
+      CHECK_EQUAL(2, data3.key_eq().id);
+    }
+
+    //*************************************************************************
+    TEST(test_load_factor)
+    {
+      Data data(initial_data.begin(), initial_data.begin() + 4);
+
+      CHECK_CLOSE(0.25, data.load_factor(), 0.01);
+    }
+
+    //*************************************************************************
+    TEST(test_collisions_wrap_around)
+    {
+      // All keys start at slot 5 of 8, so the run wraps past the end.
+      etl::unordered_flat_map<int, int, 7, 8, constant_hash> data;
+
+      for (int i = 0; i < 7; ++i)
+      {
+        data[i] = i * 10;
+      }
+
+      for (int i = 0; i < 7; ++i)
+      {
+        CHECK_EQUAL(i * 10, data.at(i));
+      }
+
+      CHECK_EQUAL(7, std::distance(data.begin(), data.end()));
+
+      data.erase(0);
+      data.erase(3);
+
+      CHECK_EQUAL(5, std::distance(data.begin(), data.end()));
+
+      for (int i = 0; i < 7; ++i)
+      {
+        CHECK_EQUAL(((i == 0) || (i == 3)) ? 0U : 1U, data.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_probe_distance_limit)
+    {
+      // More colliding keys than the metadata byte can track.
+      etl::unordered_flat_map<int, int, 300, 512, constant_hash> data;
+
+      for (int i = 0; i < 255; ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK_EQUAL(255U, data.size());
+      CHECK_THROW(data[255], etl::unordered_flat_map_full);
+      CHECK_EQUAL(255U, data.size());
+      CHECK_EQUAL(254, data.at(254));
+    }
+
+    //*************************************************************************
+    TEST(test_random_compare_with_std)
+    {
+      typedef etl::unordered_flat_map<int, int, 100, 128, bad_hash> Map;
+      typedef std::unordered_map<int, int>                          Compare_Map;
+
+      Map         data;
+      Compare_Map compare_data;
+
+      std::mt19937 generator(12345U);
+      std::uniform_int_distribution<int> key(0, 199);
+      std::uniform_int_distribution<int> action(0, 2);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        int k = key(generator);
+
+        switch (action(generator))
+        {
+          case 0:
+          case 1:
+          {
+            if (!data.full() || data.contains(k))
+            {
+              data[k] = i;
+              compare_data[k] = i;
+            }
+            break;
+          }
+
+          default:
+          {
+            CHECK_EQUAL(compare_data.erase(k), data.erase(k));
+            break;
+          }
+        }
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+      }
+
+      CHECK(Check_Same(data, compare_data));
+      CHECK(Check_Same(compare_data, data));
+    }
+
+    //*************************************************************************
+    TEST(test_lookup_with_transparent_hash_and_key_equal)
+    {
+      using Key  = etl::string<16>;
+      using SView_Data = etl::unordered_flat_map<Key, int, 8, 16, etl::string_view_hash, etl::equal_to<>>;
+
+      SView_Data data;
+      const SView_Data& cdata = data;
+
+      data.insert(std::make_pair(Key("one"), 1));
+      data.insert(std::make_pair(Key("two"), 2));
+      data.insert(std::make_pair(Key("three"), 3));
+
+      const etl::string_view two("two");
+      const etl::string_view four("four");
+
+      CHECK(data.find(two) != data.end());
+      CHECK(cdata.find(two) != cdata.end());
+      CHECK(data.find(four) == data.end());
+      CHECK(data.find(two) == data.find(Key("two")));
+
+      CHECK_EQUAL(1U, data.count(two));
+      CHECK_EQUAL(0U, data.count(four));
+      CHECK(data.contains(two));
+      CHECK(!cdata.contains(four));
+
+      CHECK_EQUAL(1, std::distance(data.equal_range(two).first, data.equal_range(two).second));
+      CHECK_EQUAL(1, std::distance(cdata.equal_range(two).first, cdata.equal_range(two).second));
+      CHECK_EQUAL(0, std::distance(data.equal_range(four).first, data.equal_range(four).second));
+      CHECK_EQUAL(2, data.at(etl::string_view("two")));
+      CHECK_EQUAL(3, cdata.at(etl::string_view("three")));
+
+      CHECK_EQUAL(1U, data.erase(two));
+      CHECK_EQUAL(0U, data.erase(two));
+      CHECK(!data.contains(two));
+      CHECK_EQUAL(2U, data.size());
+    }
+  };
+}
@@ -44,6 +44,8 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_map.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
 #include "etl/hash.h"
 
 namespace
@@ -1207,5 +1209,102 @@ namespace
       CHECK_TRUE(map1 == map2a);
       CHECK_FALSE(map1 == map2b);
     }
+
+    //*************************************************************************
+    TEST(test_bucket_index_for_power_of_two_and_other_bucket_counts)
+    {
+      struct spread_hash
+      {
+        size_t operator()(uint32_t key) const
+        {
+          return size_t(key) * 2654435761UL;
+        }
+      };
+
+      using Data8 = etl::unordered_map<uint32_t, int, 16, 8, spread_hash>;
+      using Data5 = etl::unordered_map<uint32_t, int, 16, 5, spread_hash>;
+
+      Data8 data8;
+      Data5 data5;
+      spread_hash hasher;
+
+      for (uint32_t key = 0U; key < 100U; ++key)
+      {
+        CHECK_EQUAL(hasher(key) % 8U, data8.get_bucket_index(key));
+        CHECK_EQUAL(hasher(key) % 5U, data5.get_bucket_index(key));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_lookup_with_shared_buckets)
+    {
+      struct spread_hash
+      {
+        size_t operator()(uint32_t key) const
+        {
+          // Unique hashes that all share one bucket.
+          return size_t(key) * 4U;
+        }
+      };
+
+      using Data4 = etl::unordered_map<uint32_t, int, 16, 4, spread_hash>;
+
+      Data4 data;
+
+      for (uint32_t key = 0U; key < 16U; ++key)
+      {
+        data.insert(std::make_pair(key, int(key)));
+      }
+
+      for (uint32_t key = 0U; key < 16U; ++key)
+      {
+        CHECK_EQUAL(1U, data.count(key));
+        CHECK_EQUAL(data.at(key), int(key));
+      }
+
+      CHECK_EQUAL(0U, data.count(16U));
+      CHECK_EQUAL(1U, data.erase(7U));
+      CHECK_EQUAL(0U, data.erase(7U));
+      CHECK(data.find(7U) == data.end());
+      CHECK_EQUAL(15U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_lookup_with_transparent_hash_and_key_equal)
+    {
+      using Key  = etl::string<16>;
+      using SView_Data = etl::unordered_map<Key, int, 8, 8, etl::string_view_hash, etl::equal_to<>>;
+
+      SView_Data data;
+      const SView_Data& cdata = data;
+
+      data.insert(std::make_pair(Key("one"), 1));
+      data.insert(std::make_pair(Key("two"), 2));
+      data.insert(std::make_pair(Key("three"), 3));
+
+      const etl::string_view two("two");
+      const etl::string_view four("four");
+
+      CHECK(data.find(two) != data.end());
+      CHECK(cdata.find(two) != cdata.end());
+      CHECK(data.find(four) == data.end());
+      CHECK(data.find(two) == data.find(Key("two")));
+
+      CHECK_EQUAL(1U, data.count(two));
+      CHECK_EQUAL(0U, data.count(four));
+      CHECK(data.contains(two));
+      CHECK(!cdata.contains(four));
+
+      CHECK_EQUAL(1, std::distance(data.equal_range(two).first, data.equal_range(two).second));
+      CHECK_EQUAL(1, std::distance(cdata.equal_range(two).first, cdata.equal_range(two).second));
+      CHECK_EQUAL(0, std::distance(data.equal_range(four).first, data.equal_range(four).second));
+      CHECK_EQUAL(2, data.at(etl::string_view("two")));
+      CHECK_EQUAL(3, cdata.at(etl::string_view("three")));
+
+      CHECK_EQUAL(1U, data.erase(two));
+      CHECK_EQUAL(0U, data.erase(two));
+      CHECK(!data.contains(two));
+      CHECK_EQUAL(2U, data.size());
+    }
   };
 }
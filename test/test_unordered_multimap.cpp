@@ -42,6 +42,8 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_multimap.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
 
 namespace etl
 {
@@ -1068,5 +1070,42 @@ namespace
       CHECK_TRUE(map1 == map2a);
       CHECK_FALSE(map1 == map2b);
     }
+
+    //*************************************************************************
+    TEST(test_lookup_with_transparent_hash_and_key_equal)
+    {
+      using Key  = etl::string<16>;
+      using SView_Data = etl::unordered_multimap<Key, int, 8, 8, etl::string_view_hash, etl::equal_to<>>;
+
+      SView_Data data;
+      const SView_Data& cdata = data;
+
+      data.insert(std::make_pair(Key("one"), 1));
+      data.insert(std::make_pair(Key("two"), 2));
+      data.insert(std::make_pair(Key("two"), 22));
+      data.insert(std::make_pair(Key("three"), 3));
+
+      const etl::string_view two("two");
+      const etl::string_view four("four");
+
+      CHECK(data.find(two) != data.end());
+      CHECK(cdata.find(two) != cdata.end());
+      CHECK(data.find(four) == data.end());
+      CHECK(data.find(two) == data.find(Key("two")));
+
+      CHECK_EQUAL(2U, data.count(two));
+      CHECK_EQUAL(0U, data.count(four));
+      CHECK(data.contains(two));
+      CHECK(!cdata.contains(four));
+
+      CHECK_EQUAL(2, std::distance(data.equal_range(two).first, data.equal_range(two).second));
+      CHECK_EQUAL(2, std::distance(cdata.equal_range(two).first, cdata.equal_range(two).second));
+      CHECK_EQUAL(0, std::distance(data.equal_range(four).first, data.equal_range(four).second));
+
+      CHECK_EQUAL(2U, data.erase(two));
+      CHECK_EQUAL(0U, data.erase(two));
+      CHECK(!data.contains(two));
+      CHECK_EQUAL(2U, data.size());
+    }
   };
 }
@@ -41,6 +41,8 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_multiset.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
 #include "etl/checksum.h"
 
 namespace
@@ -943,5 +945,42 @@ namespace
       CHECK_TRUE(set1 == set2a);
       CHECK_FALSE(set1 == set2b);
     }
+
+    //*************************************************************************
+    TEST(test_lookup_with_transparent_hash_and_key_equal)
+    {
+      using Key  = etl::string<16>;
+      using SView_Data = etl::unordered_multiset<Key, 8, 8, etl::string_view_hash, etl::equal_to<>>;
+
+      SView_Data data;
+      const SView_Data& cdata = data;
+
+      data.insert(Key("one"));
+      data.insert(Key("two"));
+      data.insert(Key("two"));
+      data.insert(Key("three"));
+
+      const etl::string_view two("two");
+      const etl::string_view four("four");
+
+      CHECK(data.find(two) != data.end());
+      CHECK(cdata.find(two) != cdata.end());
+      CHECK(data.find(four) == data.end());
+      CHECK(data.find(two) == data.find(Key("two")));
+
+      CHECK_EQUAL(2U, data.count(two));
+      CHECK_EQUAL(0U, data.count(four));
+      CHECK(data.contains(two));
+      CHECK(!cdata.contains(four));
+
+      CHECK_EQUAL(2, std::distance(data.equal_range(two).first, data.equal_range(two).second));
+      CHECK_EQUAL(2, std::distance(cdata.equal_range(two).first, cdata.equal_range(two).second));
+      CHECK_EQUAL(0, std::distance(data.equal_range(four).first, data.equal_range(four).second));
+
+      CHECK_EQUAL(2U, data.erase(two));
+      CHECK_EQUAL(0U, data.erase(two));
+      CHECK(!data.contains(two));
+      CHECK_EQUAL(2U, data.size());
+    }
   };
 }
@@ -0,0 +1,385 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/unrolled_list.h"
+
+#include "data.h"
+
+#include <list>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  SUITE(test_unrolled_list)
+  {
+    typedef etl::unrolled_list<int, 20, 4>         DataInt;
+    typedef etl::iunrolled_list<int>               IDataInt;
+    typedef etl::unrolled_list<std::string, 40, 5> DataString;
+    typedef TestDataM<int>                         ItemM;
+    typedef etl::unrolled_list<ItemM, 20, 4>       DataM;
+
+    //*************************************************************************
+    template <typename TData, typename TCompare>
+    bool is_same_sequence(const TData& data, const TCompare& compare)
+    {
+      return (data.size() == compare.size()) &&
+             std::equal(data.begin(), data.end(), compare.begin()) &&
+             std::equal(data.rbegin(), data.rend(), compare.rbegin());
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataInt data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(20U, data.max_size());
+      CHECK_EQUAL(20U, data.available());
+      CHECK_EQUAL(4U, data.chunk_capacity());
+      CHECK_EQUAL(0U, data.chunk_count());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      std::vector<int> compare = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      DataInt data(compare.begin(), compare.end());
+
+      CHECK(is_same_sequence(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_size_value)
+    {
+      std::list<int> compare(10U, 7);
+
+      DataInt data(10U, 7);
+
+      CHECK(is_same_sequence(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      std::list<int> compare = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      DataInt data = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      CHECK(is_same_sequence(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_constructor_and_assignment)
+    {
+      DataString data = { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9" };
+
+      DataString copy(data);
+      CHECK(copy == data);
+
+      DataString other = { "A", "B" };
+      other = data;
+      CHECK(other == data);
+
+      other.push_back("X");
+      CHECK(other != data);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      DataM data;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(ItemM(i));
+      }
+
+      DataM moved(std::move(data));
+
+      CHECK(data.empty());
+      CHECK_EQUAL(10U, moved.size());
+
+      DataM other;
+      other.push_back(ItemM(99));
+      other = std::move(moved);
+
+      CHECK(moved.empty());
+      CHECK_EQUAL(10U, other.size());
+
+      int expected = 0;
+
+      for (DataM::const_iterator itr = other.begin(); itr != other.end(); ++itr)
+      {
+        CHECK(itr->valid);
+        CHECK_EQUAL(expected++, itr->value);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_front_back)
+    {
+      DataInt        data;
+      std::list<int> compare;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(i);
+        compare.push_back(i);
+        data.push_front(-i);
+        compare.push_front(-i);
+      }
+
+      CHECK(data.full());
+      CHECK(is_same_sequence(data, compare));
+      CHECK_EQUAL(compare.front(), data.front());
+      CHECK_EQUAL(compare.back(),  data.back());
+
+      while (!compare.empty())
+      {
+        data.pop_front();
+        compare.pop_front();
+        CHECK(is_same_sequence(data, compare));
+
+        if (!compare.empty())
+        {
+          data.pop_back();
+          compare.pop_back();
+          CHECK(is_same_sequence(data, compare));
+        }
+      }
+
+      CHECK_EQUAL(0U, data.chunk_count());
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      DataString               data;
+      std::list<std::string> compare;
+
+      data.emplace_back(3U, 'a');
+      compare.emplace_back(3U, 'a');
+      data.emplace_front(2U, 'b');
+      compare.emplace_front(2U, 'b');
+      data.emplace(++data.cbegin(), 4U, 'c');
+      compare.emplace(++compare.cbegin(), 4U, 'c');
+
+      CHECK(is_same_sequence(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_returns_iterator_to_new_element)
+    {
+      DataInt data = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+      // Insert into full chunks, forcing spills and splits.
+      for (int i = 0; i < 12; ++i)
+      {
+        DataInt::const_iterator position = data.cbegin();
+        std::advance(position, (i * 5) % data.size());
+
+        DataInt::iterator itr = data.insert(position, 100 + i);
+        CHECK_EQUAL(100 + i, *itr);
+      }
+
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_returns_iterator_to_next_element)
+    {
+      DataInt        data    = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+      std::list<int> compare = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+      // Erase every other element.
+      DataInt::iterator        itr = data.begin();
+      std::list<int>::iterator citr = compare.begin();
+
+      while (itr != data.end())
+      {
+        itr  = data.erase(itr);
+        citr = compare.erase(citr);
+
+        if (itr != data.end())
+        {
+          CHECK_EQUAL(*citr, *itr);
+          ++itr;
+          ++citr;
+        }
+      }
+
+      CHECK(is_same_sequence(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      DataInt        data    = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+      std::list<int> compare = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+      DataInt::iterator        first  = data.begin();
+      std::list<int>::iterator cfirst = compare.begin();
+      std::advance(first, 3);
+      std::advance(cfirst, 3);
+
+      DataInt::iterator        last  = first;
+      std::list<int>::iterator clast = cfirst;
+      std::advance(last, 9);
+      std::advance(clast, 9);
+
+      DataInt::iterator        itr  = data.erase(first, last);
+      std::list<int>::iterator citr = compare.erase(cfirst, clast);
+
+      CHECK_EQUAL(*citr, *itr);
+      CHECK(is_same_sequence(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_churn_against_std_list)
+    {
+      DataString             data;
+      std::list<std::string> compare;
+
+      uint32_t seed = 12345U;
+
+      for (int step = 0; step < 2000; ++step)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const uint32_t r = seed >> 8;
+
+        const bool do_insert = !data.full() && (data.empty() || ((r % 3U) != 0U) || (step > 1000 && (r % 5U) == 0U));
+
+        if (do_insert)
+        {
+          const size_t index = (r >> 4) % (data.size() + 1U);
+
+          DataString::iterator             itr  = data.begin();
+          std::list<std::string>::iterator citr = compare.begin();
+          std::advance(itr, index);
+          std::advance(citr, index);
+
+          const std::string value = std::to_string(step);
+          CHECK_EQUAL(value, *data.insert(itr, value));
+          compare.insert(citr, value);
+        }
+        else
+        {
+          const size_t index = (r >> 4) % data.size();
+
+          DataString::iterator             itr  = data.begin();
+          std::list<std::string>::iterator citr = compare.begin();
+          std::advance(itr, index);
+          std::advance(citr, index);
+
+          itr  = data.erase(itr);
+          citr = compare.erase(citr);
+
+          CHECK((itr == data.end()) == (citr == compare.end()));
+
+          if (citr != compare.end())
+          {
+            CHECK_EQUAL(*citr, *itr);
+          }
+        }
+
+        CHECK(is_same_sequence(data, compare));
+
+        // The chunks never drop below the fill bound.
+        CHECK(data.chunk_count() <= ((2U * (data.size() / (data.chunk_capacity() + 1U))) + 1U));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_destruction)
+    {
+      ItemM::reset_instance_count();
+
+      {
+        DataM data;
+
+        for (int i = 0; i < 20; ++i)
+        {
+          data.insert(data.begin(), ItemM(i));
+        }
+
+        for (int i = 0; i < 7; ++i)
+        {
+          data.erase(++data.begin());
+        }
+
+        CHECK_EQUAL(13, ItemM::get_instance_count());
+      }
+
+      CHECK_EQUAL(0, ItemM::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      DataInt data = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.chunk_count());
+
+      data.push_back(1);
+      CHECK_EQUAL(1, data.front());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      DataInt data(20U, 0);
+
+      CHECK(data.full());
+      CHECK_THROW(data.push_back(1), etl::unrolled_list_full);
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      DataInt   data = { 0, 1, 2, 3, 4, 5 };
+      IDataInt& idata = data;
+
+      idata.push_back(6);
+
+      CHECK_EQUAL(7U, idata.size());
+      CHECK_EQUAL(6, idata.back());
+    }
+  };
+}
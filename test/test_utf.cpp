@@ -0,0 +1,276 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/utf.h"
+#include "etl/string.h"
+#include "etl/u16string.h"
+#include "etl/u32string.h"
+
+#include <vector>
+#include <string>
+
+namespace
+{
+  //***************************************************************************
+  // All of the valid code points, with a step.
+  //***************************************************************************
+  std::vector<char32_t> make_code_points()
+  {
+    std::vector<char32_t> code_points;
+
+    for (uint32_t c = 0U; c <= 0x10FFFFUL; c += ((c < 0x1000U) ? 1U : 97U))
+    {
+      if ((c < 0xD800U) || (c > 0xDFFFU))
+      {
+        code_points.push_back(char32_t(c));
+      }
+    }
+
+    code_points.push_back(char32_t(0xFFFFU));
+    code_points.push_back(char32_t(0x10000UL));
+    code_points.push_back(char32_t(0x10FFFFUL));
+
+    return code_points;
+  }
+
+  SUITE(test_utf)
+  {
+    //*************************************************************************
+    TEST(test_validate)
+    {
+      const std::string valid[] = { "",
+                                    "plain ASCII text that is longer than sixteen bytes, to use the blocks",
+                                    "caf\xC3\xA9",
+                                    "\xE2\x82\xAC 10",
+                                    "\xF0\x9D\x84\x9E clef",
+                                    "\xEF\xBF\xBF",
+                                    "\xF4\x8F\xBF\xBF" };
+
+      for (size_t i = 0U; i < (sizeof(valid) / sizeof(valid[0])); ++i)
+      {
+        CHECK(etl::utf8_validate(valid[i].data(), valid[i].size()));
+      }
+
+      const std::string invalid[] = { "\x80",              // A lone continuation.
+                                      "\xC0\x80",          // Overlong.
+                                      "\xC1\xBF",          // Overlong.
+                                      "\xE0\x80\x80",      // Overlong.
+                                      "\xF0\x80\x80\x80",  // Overlong.
+                                      "\xED\xA0\x80",      // A surrogate.
+                                      "\xF4\x90\x80\x80",  // Beyond U+10FFFF.
+                                      "\xF5\x80\x80\x80",
+                                      "\xFF",
+                                      "\xE2\x82",          // Truncated.
+                                      "\xC3\x28" };        // A bad continuation.
+
+      for (size_t i = 0U; i < (sizeof(invalid) / sizeof(invalid[0])); ++i)
+      {
+        CHECK(!etl::utf8_validate(invalid[i].data(), invalid[i].size()));
+
+        // After a run of ASCII.
+        const std::string text = std::string(37U, 'a') + invalid[i];
+        CHECK(!etl::utf8_validate(etl::span<const char>(text.data(), text.size())));
+      }
+
+      CHECK(etl::utf8_validate(etl::string_view("text")));
+    }
+
+    //*************************************************************************
+    TEST(test_utf8_to_utf16_and_utf32)
+    {
+      const std::string text = "Temperature 21\xC2\xB0" "C \xE2\x82\xAC \xF0\x9D\x84\x9E end";
+
+      char16_t utf16[64];
+      etl::utf_result result = etl::utf8_to_utf16(text.data(), text.size(), utf16, 64U);
+
+      CHECK(result.ok());
+      CHECK_EQUAL(text.size(), result.read);
+      CHECK_EQUAL(25U, result.written);
+      CHECK(utf16[14] == char16_t(0x00B0));
+      CHECK(utf16[17] == char16_t(0x20AC));
+      CHECK(utf16[19] == char16_t(0xD834));
+      CHECK(utf16[20] == char16_t(0xDD1E));
+
+      char32_t utf32[64];
+      result = etl::utf8_to_utf32(etl::span<const char>(text.data(), text.size()), etl::span<char32_t>(utf32));
+
+      CHECK(result.ok());
+      CHECK_EQUAL(24U, result.written);
+      CHECK(utf32[19] == char32_t(0x1D11E));
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip_all_code_points)
+    {
+      const std::vector<char32_t> code_points = make_code_points();
+
+      std::vector<char>     utf8(code_points.size() * 4U);
+      std::vector<char16_t> utf16(code_points.size() * 2U);
+      std::vector<char>     utf8_again(utf8.size());
+      std::vector<char32_t> utf32(code_points.size());
+
+      etl::utf_result r1 = etl::utf32_to_utf8(code_points.data(), code_points.size(), utf8.data(), utf8.size());
+      CHECK(r1.ok());
+
+      CHECK(etl::utf8_validate(utf8.data(), r1.written));
+
+      etl::utf_result r2 = etl::utf8_to_utf16(utf8.data(), r1.written, utf16.data(), utf16.size());
+      CHECK(r2.ok());
+
+      etl::utf_result r3 = etl::utf16_to_utf8(utf16.data(), r2.written, utf8_again.data(), utf8_again.size());
+      CHECK(r3.ok());
+      CHECK_EQUAL(r1.written, r3.written);
+      CHECK(std::equal(utf8.begin(), utf8.begin() + r1.written, utf8_again.begin()));
+
+      etl::utf_result r4 = etl::utf8_to_utf32(utf8_again.data(), r3.written, utf32.data(), utf32.size());
+      CHECK(r4.ok());
+      CHECK_EQUAL(code_points.size(), r4.written);
+      CHECK(code_points == utf32);
+    }
+
+    //*************************************************************************
+    TEST(test_ascii_lengths)
+    {
+      for (size_t length = 0U; length < 70U; ++length)
+      {
+        std::string text;
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          text += char('!' + (i % 90U));
+        }
+
+        text += "\xC3\xA9";
+
+        char16_t utf16[80];
+        etl::utf_result r1 = etl::utf8_to_utf16(text.data(), text.size(), utf16, 80U);
+        CHECK(r1.ok());
+        CHECK_EQUAL(length + 1U, r1.written);
+        CHECK(utf16[length] == char16_t(0xE9));
+
+        char utf8[80];
+        etl::utf_result r2 = etl::utf16_to_utf8(utf16, r1.written, utf8, 80U);
+        CHECK(r2.ok());
+        CHECK_EQUAL(text, std::string(utf8, r2.written));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_positions)
+    {
+      const std::string text = std::string(20U, 'x') + "\xC3\xA9" + std::string(20U, 'y') + "\xED\xA0\x80" + "zz";
+
+      char32_t utf32[64];
+      etl::utf_result result = etl::utf8_to_utf32(text.data(), text.size(), utf32, 64U);
+
+      CHECK(result.status == etl::utf_status::Invalid_Sequence);
+      CHECK_EQUAL(42U, result.read);
+      CHECK_EQUAL(41U, result.written);
+
+      // A lone high surrogate, and a lone low surrogate.
+      const char16_t high[] = { 'a', char16_t(0xD800) };
+      const char16_t low[]  = { 'a', char16_t(0xDC00), 'b' };
+      char utf8[16];
+
+      result = etl::utf16_to_utf8(high, 2U, utf8, 16U);
+      CHECK(result.status == etl::utf_status::Invalid_Sequence);
+      CHECK_EQUAL(1U, result.read);
+
+      result = etl::utf16_to_utf8(low, 3U, utf8, 16U);
+      CHECK(result.status == etl::utf_status::Invalid_Sequence);
+      CHECK_EQUAL(1U, result.read);
+
+      // Beyond U+10FFFF, and a surrogate, in UTF-32.
+      const char32_t too_large[] = { char32_t(0x110000UL) };
+      const char32_t surrogate[] = { char32_t(0xDFFFU) };
+
+      CHECK(etl::utf32_to_utf8(too_large, 1U, utf8, 16U).status == etl::utf_status::Invalid_Sequence);
+      CHECK(etl::utf32_to_utf8(surrogate, 1U, utf8, 16U).status == etl::utf_status::Invalid_Sequence);
+    }
+
+    //*************************************************************************
+    TEST(test_output_full)
+    {
+      const std::string text = "abc\xE2\x82\xAC";
+
+      char16_t utf16[3];
+      etl::utf_result result = etl::utf8_to_utf16(text.data(), text.size(), utf16, 3U);
+
+      CHECK(result.status == etl::utf_status::Output_Full);
+      CHECK_EQUAL(3U, result.read);
+      CHECK_EQUAL(3U, result.written);
+
+      // A code point is never split.
+      const char16_t clef[] = { 'a', char16_t(0xD834), char16_t(0xDD1E) };
+      char utf8[4];
+
+      result = etl::utf16_to_utf8(clef, 3U, utf8, 4U);
+
+      CHECK(result.status == etl::utf_status::Output_Full);
+      CHECK_EQUAL(1U, result.read);
+      CHECK_EQUAL(1U, result.written);
+    }
+
+    //*************************************************************************
+    TEST(test_etl_strings)
+    {
+      etl::u16string<32> utf16;
+
+      etl::utf_result result = etl::utf8_to_utf16(etl::string_view("Set \xE2\x86\x92 21\xC2\xB0"), utf16);
+
+      CHECK(result.ok());
+      CHECK_EQUAL(9U, utf16.size());
+      CHECK(utf16[4] == char16_t(0x2192));
+
+      etl::string<32> utf8;
+
+      result = etl::utf16_to_utf8(etl::u16string_view(utf16.data(), utf16.size()), utf8);
+
+      CHECK(result.ok());
+      CHECK_EQUAL(std::string("Set \xE2\x86\x92 21\xC2\xB0"), std::string(utf8.data(), utf8.size()));
+
+      etl::u32string<32> utf32;
+      CHECK(etl::utf8_to_utf32(etl::string_view(utf8.data(), utf8.size()), utf32).ok());
+      CHECK_EQUAL(9U, utf32.size());
+
+      utf8.clear();
+      CHECK(etl::utf32_to_utf8(etl::u32string_view(utf32.data(), utf32.size()), utf8).ok());
+      CHECK_EQUAL(std::string("Set \xE2\x86\x92 21\xC2\xB0"), std::string(utf8.data(), utf8.size()));
+
+      // Too long for the string.
+      etl::u16string<4> small;
+      result = etl::utf8_to_utf16(etl::string_view("abcdef"), small);
+
+      CHECK(result.status == etl::utf_status::Output_Full);
+      CHECK_EQUAL(4U, small.size());
+    }
+  }
+}
@@ -142,5 +142,51 @@ namespace
       variance_result = variance1.get_variance();
       CHECK_CLOSE(9.17, variance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_char_variance_add_span_and_merge)
+    {
+      etl::variance<etl::variance_type::Sample, char, int32_t> variance1;
+      etl::variance<etl::variance_type::Sample, char, int32_t> variance2;
+
+      variance1.add(etl::span<const char>(input_c.data(), 4U));
+      variance2.add(etl::span<const char>(input_c.data() + 4U, input_c.size() - 4U));
+      variance1.merge(variance2);
+
+      CHECK_EQUAL(input_c.size(), variance1.count());
+      CHECK_CLOSE(9.17, variance1.get_variance(), 0.01);
+    }
+
+    //*************************************************************************
+    TEST(test_double_variance_add_span_and_merge)
+    {
+      etl::variance<etl::variance_type::Population, double> variance1;
+      etl::variance<etl::variance_type::Population, double> variance2;
+
+      variance1.add(etl::span<const double>(input_d.data(), 3U));
+      variance2.add(input_d.begin() + 3U, input_d.end());
+      variance1.merge(variance2);
+
+      CHECK_EQUAL(input_d.size(), variance1.count());
+      CHECK_CLOSE(8.25, variance1.get_variance(), 0.0001);
+    }
+
+    //*************************************************************************
+    TEST(test_double_variance_large_offset)
+    {
+      std::array<double, 10> input_offset;
+
+      for (size_t i = 0U; i < input_offset.size(); ++i)
+      {
+        input_offset[i] = 1.0e9 + input_d[i];
+      }
+
+      etl::variance<etl::variance_type::Population, double> variance1(input_offset.begin(), input_offset.end());
+      CHECK_CLOSE(8.25, variance1.get_variance(), 0.0001);
+
+      etl::variance<etl::variance_type::Population, double> variance2;
+      variance2.add(etl::span<const double>(input_offset.data(), input_offset.size()));
+      CHECK_CLOSE(8.25, variance2.get_variance(), 0.0001);
+    }
   };
 }
@@ -1277,6 +1277,50 @@ namespace
       CHECK_EQUAL("3", visitor.result_s);
     }
 
+    //*************************************************************************
+    template <int N>
+    struct Alternative
+    {
+      int value = N;
+    };
+
+    struct AlternativeFunctor
+    {
+      template <int N>
+      void operator()(Alternative<N>& alternative) { result = alternative.value; alternative.value += 100; }
+
+      template <int N>
+      void operator()(const Alternative<N>& alternative) { result = -alternative.value; }
+
+      int result = -1;
+    };
+
+    template <size_t... I>
+    using many_alternatives = etl::variant<Alternative<int(I)>...>;
+
+    TEST(test_variant_accept_functor_with_many_alternatives)
+    {
+      many_alternatives<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19> variant_etl;
+
+      AlternativeFunctor functor;
+
+      variant_etl.accept(functor);
+      CHECK_EQUAL(0, functor.result);
+
+      variant_etl = Alternative<11>();
+      variant_etl.accept(functor);
+      CHECK_EQUAL(11, functor.result);
+      CHECK_EQUAL(111, etl::get<Alternative<11>>(variant_etl).value);
+
+      variant_etl = Alternative<19>();
+      variant_etl.accept(functor);
+      CHECK_EQUAL(19, functor.result);
+
+      const auto& const_variant_etl = variant_etl;
+      const_variant_etl.accept(functor);
+      CHECK_EQUAL(-119, functor.result);
+    }
+
     //*************************************************************************
 #if ETL_USING_CPP17
     TEST(test_variant_accept_functor_with_overload)
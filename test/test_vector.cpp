@@ -35,8 +35,98 @@ SOFTWARE.
 
 #include "etl/vector.h"
 
+#include "data.h"
+
 namespace
 {
+  //***************************************************************************
+  // Applies random inserts and erases to a container and a std::vector, and
+  // checks that they stay the same.
+  //***************************************************************************
+  template <typename TItem, typename TData>
+  void check_random_insert_erase(TData& data)
+  {
+    std::vector<TItem> compare;
+    const TItem range[] = { TItem(100), TItem(101), TItem(102), TItem(103) };
+
+    uint32_t seed = 1U;
+
+    for (int i = 0; i < 2000; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      const uint32_t r      = seed >> 8;
+      const size_t   index  = r % (compare.size() + 1U);
+      const size_t   n      = 1U + ((r >> 4) % 4U);
+      const size_t   remain = data.max_size() - data.size();
+      const TItem    value(i);
+
+      switch ((r >> 8) % 6U)
+      {
+        case 0:
+        {
+          if (remain != 0U)
+          {
+            data.insert(data.begin() + index, value);
+            compare.insert(compare.begin() + index, value);
+          }
+          break;
+        }
+
+        case 1:
+        {
+          if (remain >= n)
+          {
+            data.insert(data.begin() + index, n, value);
+            compare.insert(compare.begin() + index, n, value);
+          }
+          break;
+        }
+
+        case 2:
+        {
+          if (remain >= n)
+          {
+            data.insert(data.begin() + index, range, range + n);
+            compare.insert(compare.begin() + index, range, range + n);
+          }
+          break;
+        }
+
+        case 3:
+        {
+          if (remain != 0U)
+          {
+            data.emplace(data.begin() + index, i);
+            compare.insert(compare.begin() + index, value);
+          }
+          break;
+        }
+
+        case 4:
+        {
+          if (index < compare.size())
+          {
+            data.erase(data.begin() + index);
+            compare.erase(compare.begin() + index);
+          }
+          break;
+        }
+
+        default:
+        {
+          const size_t last = etl::min(index + n, compare.size());
+
+          data.erase(data.begin() + index, data.begin() + last);
+          compare.erase(compare.begin() + index, compare.begin() + last);
+          break;
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+  }
+
   SUITE(test_vector)
   {
     static const size_t SIZE = 10;
@@ -1504,5 +1594,22 @@ namespace
 
       CHECK(std::equal(blank_data.begin(), blank_data.end(), data.begin()));
     }
+  
+
+    //*************************************************************************
+    TEST(test_random_insert_erase_trivially_copyable)
+    {
+      etl::vector<int, 40> data;
+
+      check_random_insert_erase<int>(data);
+    }
+
+    //*************************************************************************
+    TEST(test_random_insert_erase_trivially_relocatable)
+    {
+      etl::vector<TestDataR<int>, 40> data;
+
+      check_random_insert_erase<TestDataR<int> >(data);
+    }
   };
 }
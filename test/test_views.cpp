@@ -0,0 +1,285 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/views.h"
+#include "etl/vector.h"
+#include "etl/array.h"
+#include "etl/list.h"
+#include "etl/span.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  template <typename TRange>
+  std::vector<int> to_vector(const TRange& range)
+  {
+    std::vector<int> result;
+
+    for (auto itr = range.begin(); itr != range.end(); ++itr)
+    {
+      result.push_back(*itr);
+    }
+
+    return result;
+  }
+
+  bool is_even(int i)
+  {
+    return (i % 2) == 0;
+  }
+
+  SUITE(test_views)
+  {
+    //*************************************************************************
+    TEST(test_all)
+    {
+      int data[] = { 1, 2, 3 };
+
+      auto view = etl::views::all(data);
+
+      CHECK_EQUAL(3U, view.size());
+      CHECK(!view.empty());
+      CHECK_EQUAL(1, view.front());
+      CHECK((to_vector(view) == std::vector<int>{ 1, 2, 3 }));
+    }
+
+    //*************************************************************************
+    TEST(test_transform)
+    {
+      etl::vector<int, 5> data = { 1, 2, 3, 4, 5 };
+
+      auto view = data | etl::views::transform([](int i) { return i * 10; });
+
+      CHECK((to_vector(view) == std::vector<int>{ 10, 20, 30, 40, 50 }));
+
+      // Random access is kept.
+      CHECK_EQUAL(5, view.end() - view.begin());
+      CHECK_EQUAL(30, view.begin()[2]);
+      CHECK_EQUAL(40, *(view.begin() + 3));
+      CHECK_EQUAL(5U, view.size());
+
+      // Called directly.
+      auto view2 = etl::views::transform(data, [](int i) { return -i; });
+      CHECK((to_vector(view2) == std::vector<int>{ -1, -2, -3, -4, -5 }));
+    }
+
+    //*************************************************************************
+    TEST(test_transform_is_lazy)
+    {
+      etl::vector<int, 5> data = { 1, 2, 3, 4, 5 };
+      int calls = 0;
+
+      auto view = data | etl::views::transform([&calls](int i) { ++calls; return i; });
+
+      CHECK_EQUAL(0, calls);
+      CHECK_EQUAL(3, *(view.begin() + 2));
+      CHECK_EQUAL(1, calls);
+
+      // The data is read when the view is read.
+      data[2] = 33;
+      CHECK_EQUAL(33, *(view.begin() + 2));
+    }
+
+    //*************************************************************************
+    TEST(test_filter)
+    {
+      etl::list<int, 10> data = { 1, 2, 3, 4, 5, 6, 7 };
+
+      auto view = data | etl::views::filter(is_even);
+
+      CHECK((to_vector(view) == std::vector<int>{ 2, 4, 6 }));
+      CHECK_EQUAL(3U, view.size());
+
+      auto none = data | etl::views::filter([](int i) { return i > 10; });
+      CHECK(none.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_filter_writes_through)
+    {
+      int data[] = { 1, 2, 3, 4 };
+
+      for (int& i : data | etl::views::filter(is_even))
+      {
+        i = 0;
+      }
+
+      CHECK_EQUAL(1, data[0]);
+      CHECK_EQUAL(0, data[1]);
+      CHECK_EQUAL(3, data[2]);
+      CHECK_EQUAL(0, data[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_take)
+    {
+      int data[] = { 1, 2, 3, 4, 5 };
+
+      CHECK((to_vector(data | etl::views::take(3)) == std::vector<int>{ 1, 2, 3 }));
+      CHECK((to_vector(data | etl::views::take(10)) == std::vector<int>{ 1, 2, 3, 4, 5 }));
+      CHECK((data | etl::views::take(0)).empty());
+    }
+
+    //*************************************************************************
+    TEST(test_take_reads_no_further)
+    {
+      int data[] = { 2, 4, 5, 6, 8 };
+      int calls = 0;
+
+      auto even = [&calls](int i) { ++calls; return (i % 2) == 0; };
+
+      auto view = data | etl::views::filter(even) | etl::views::take(2);
+
+      CHECK((to_vector(view) == std::vector<int>{ 2, 4 }));
+
+      // The filter has not gone past the second element.
+      CHECK_EQUAL(2, calls);
+    }
+
+    //*************************************************************************
+    TEST(test_drop)
+    {
+      etl::array<int, 5> data = { 1, 2, 3, 4, 5 };
+
+      CHECK((to_vector(data | etl::views::drop(2)) == std::vector<int>{ 3, 4, 5 }));
+      CHECK((data | etl::views::drop(5)).empty());
+      CHECK((data | etl::views::drop(7)).empty());
+
+      etl::list<int, 5> list = { 1, 2, 3 };
+      CHECK((to_vector(list | etl::views::drop(1)) == std::vector<int>{ 2, 3 }));
+      CHECK((list | etl::views::drop(4)).empty());
+    }
+
+    //*************************************************************************
+    TEST(test_stride)
+    {
+      int data[] = { 0, 1, 2, 3, 4, 5, 6 };
+
+      CHECK((to_vector(data | etl::views::stride(3)) == std::vector<int>{ 0, 3, 6 }));
+      CHECK((to_vector(data | etl::views::stride(2)) == std::vector<int>{ 0, 2, 4, 6 }));
+      CHECK((to_vector(data | etl::views::stride(10)) == std::vector<int>{ 0 }));
+
+      etl::list<int, 10> list = { 0, 1, 2, 3, 4, 5 };
+      CHECK((to_vector(list | etl::views::stride(4)) == std::vector<int>{ 0, 4 }));
+    }
+
+    //*************************************************************************
+    TEST(test_chunk)
+    {
+      int data[] = { 1, 2, 3, 4, 5, 6, 7 };
+
+      std::vector<int> sums;
+      std::vector<size_t> sizes;
+
+      for (auto chunk : data | etl::views::chunk(3))
+      {
+        int sum = 0;
+
+        for (int i : chunk)
+        {
+          sum += i;
+        }
+
+        sums.push_back(sum);
+        sizes.push_back(chunk.size());
+      }
+
+      CHECK((sums == std::vector<int>{ 6, 15, 7 }));
+      CHECK((sizes == std::vector<size_t>{ 3U, 3U, 1U }));
+    }
+
+    //*************************************************************************
+    TEST(test_zip)
+    {
+      int  a[] = { 1, 2, 3, 4 };
+      char b[] = { 'a', 'b', 'c' };
+
+      std::vector<int>  ints;
+      std::vector<char> chars;
+
+      for (auto p : etl::views::zip(a, b))
+      {
+        ints.push_back(p.first);
+        chars.push_back(p.second);
+      }
+
+      CHECK((ints == std::vector<int>{ 1, 2, 3 }));
+      CHECK((chars == std::vector<char>{ 'a', 'b', 'c' }));
+
+      // The pairs hold references.
+      for (auto p : etl::views::zip(a, b))
+      {
+        p.first *= 10;
+      }
+
+      CHECK_EQUAL(30, a[2]);
+      CHECK_EQUAL(4,  a[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_chained)
+    {
+      etl::vector<int, 20> data;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data.push_back(i);
+      }
+
+      auto view = data
+                | etl::views::drop(1)
+                | etl::views::filter(is_even)
+                | etl::views::transform([](int i) { return i * i; })
+                | etl::views::take(4);
+
+      CHECK((to_vector(view) == std::vector<int>{ 4, 16, 36, 64 }));
+
+      // Works with the standard algorithms, which assign iterators.
+      auto largest = std::max_element(view.begin(), view.end());
+      CHECK_EQUAL(64, *largest);
+
+      CHECK_EQUAL(4, std::distance(view.begin(), view.end()));
+    }
+
+    //*************************************************************************
+    TEST(test_span)
+    {
+      int data[] = { 1, 2, 3, 4, 5, 6 };
+      etl::span<const int> span(data);
+
+      auto view = span | etl::views::stride(2) | etl::views::transform([](int i) { return i + 1; });
+
+      CHECK((to_vector(view) == std::vector<int>{ 2, 4, 6 }));
+    }
+  }
+}
@@ -0,0 +1,227 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <iterator>
+#include <string>
+#include <vector>
+#include <list>
+#include <stdint.h>
+
+#include "etl/xxhash.h"
+
+namespace
+{
+  //***************************************************************************
+  // Reference values from the xxHash reference implementation.
+  //***************************************************************************
+  struct Reference
+  {
+    const char* text;
+    uint32_t    xxh32;
+    uint64_t    xxh64;
+    uint32_t    xxh32_seeded;
+    uint64_t    xxh64_seeded;
+  };
+
+  const uint32_t Seed = 2654435761UL;
+
+  const Reference references[] =
+  {
+    { "",                                                     0x02CC5D05UL, 0xEF46DB3751D8E999ULL, 0x36B78AE7UL, 0xAC75FDA2929B17EFULL },
+    { "a",                                                    0x550D7456UL, 0xD24EC4F1A98C6E5BULL, 0x9E1633E4UL, 0x393DA8B78992279BULL },
+    { "abc",                                                  0x32D153FFUL, 0x44BC2CF5AD770999ULL, 0xA1AE7709UL, 0x1318DF30094A85FDULL },
+    { "Nobody inspects the spammish repetition",              0xE2293B2FUL, 0xFBCEA83C8A378BF1ULL, 0xC9E89E68UL, 0x56DB22DD5B051147ULL },
+    { "0123456789abcdef0123456789abcdef0123456789abcdef0123", 0x19A82A65UL, 0x40BCE807F4ED7267ULL, 0xDE8DB925UL, 0x5A959AFF79AA8419ULL }
+  };
+
+  const size_t Reference_Count = sizeof(references) / sizeof(references[0]);
+
+  SUITE(test_xxhash)
+  {
+    //*************************************************************************
+    TEST(test_xxhash32_calculate)
+    {
+      for (size_t i = 0U; i < Reference_Count; ++i)
+      {
+        std::string data(references[i].text);
+
+        CHECK_EQUAL(references[i].xxh32,        etl::xxhash32_calculate(data.data(), data.size()));
+        CHECK_EQUAL(references[i].xxh32_seeded, etl::xxhash32_calculate(data.data(), data.size(), Seed));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_calculate)
+    {
+      for (size_t i = 0U; i < Reference_Count; ++i)
+      {
+        std::string data(references[i].text);
+
+        CHECK_EQUAL(references[i].xxh64,        etl::xxhash64_calculate(data.data(), data.size()));
+        CHECK_EQUAL(references[i].xxh64_seeded, etl::xxhash64_calculate(data.data(), data.size(), Seed));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_constructor)
+    {
+      for (size_t i = 0U; i < Reference_Count; ++i)
+      {
+        std::string data(references[i].text);
+
+        uint32_t hash        = etl::xxhash32(data.data(), data.data() + data.size());
+        uint32_t hash_seeded = etl::xxhash32(data.data(), data.data() + data.size(), Seed);
+
+        CHECK_EQUAL(references[i].xxh32,        hash);
+        CHECK_EQUAL(references[i].xxh32_seeded, hash_seeded);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_constructor)
+    {
+      for (size_t i = 0U; i < Reference_Count; ++i)
+      {
+        std::string data(references[i].text);
+
+        uint64_t hash        = etl::xxhash64(data.data(), data.data() + data.size());
+        uint64_t hash_seeded = etl::xxhash64(data.data(), data.data() + data.size(), Seed);
+
+        CHECK_EQUAL(references[i].xxh64,        hash);
+        CHECK_EQUAL(references[i].xxh64_seeded, hash_seeded);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash_add_values)
+    {
+      for (size_t i = 0U; i < Reference_Count; ++i)
+      {
+        std::string data(references[i].text);
+
+        etl::xxhash32 xxhash32_calculator;
+        etl::xxhash64 xxhash64_calculator(Seed);
+
+        for (size_t j = 0U; j < data.size(); ++j)
+        {
+          xxhash32_calculator.add(static_cast<uint8_t>(data[j]));
+          xxhash64_calculator.add(static_cast<uint8_t>(data[j]));
+        }
+
+        CHECK_EQUAL(references[i].xxh32,        xxhash32_calculator.value());
+        CHECK_EQUAL(references[i].xxh64_seeded, xxhash64_calculator.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash_add_range_non_pointer_iterator)
+    {
+      for (size_t i = 0U; i < Reference_Count; ++i)
+      {
+        std::string data(references[i].text);
+        std::list<char> list(data.begin(), data.end());
+
+        etl::xxhash32 xxhash32_calculator;
+        etl::xxhash64 xxhash64_calculator;
+
+        xxhash32_calculator.add(list.begin(), list.end());
+        xxhash64_calculator.add(list.begin(), list.end());
+
+        CHECK_EQUAL(references[i].xxh32, xxhash32_calculator.value());
+        CHECK_EQUAL(references[i].xxh64, xxhash64_calculator.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash_add_range_in_chunks)
+    {
+      std::vector<uint8_t> data(200U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = static_cast<uint8_t>((i * 131U) + 7U);
+      }
+
+      for (size_t length = 0U; length <= data.size(); length += 3U)
+      {
+        const uint32_t expected32 = etl::xxhash32_calculate(data.data(), length, Seed);
+        const uint64_t expected64 = etl::xxhash64_calculate(data.data(), length, Seed);
+
+        for (size_t chunk = 1U; chunk <= 40U; chunk += 13U)
+        {
+          etl::xxhash32 xxhash32_calculator(Seed);
+          etl::xxhash64 xxhash64_calculator(Seed);
+
+          for (size_t i = 0U; i < length; i += chunk)
+          {
+            const size_t n = std::min(chunk, length - i);
+
+            xxhash32_calculator.add(data.data() + i, data.data() + i + n);
+            xxhash64_calculator.add(data.data() + i, data.data() + i + n);
+          }
+
+          CHECK_EQUAL(expected32, xxhash32_calculator.value());
+          CHECK_EQUAL(expected64, xxhash64_calculator.value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash_value_then_add)
+    {
+      std::string data(references[3].text);
+
+      etl::xxhash64 xxhash64_calculator;
+
+      xxhash64_calculator.add(data.data(), data.data() + 10U);
+      CHECK_EQUAL(etl::xxhash64_calculate(data.data(), 10U), xxhash64_calculator.value());
+
+      xxhash64_calculator.add(data.data() + 10U, data.data() + data.size());
+      CHECK_EQUAL(references[3].xxh64, xxhash64_calculator.value());
+
+      xxhash64_calculator.reset();
+      CHECK_EQUAL(references[0].xxh64, xxhash64_calculator.value());
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_xxhash_constexpr)
+    {
+      constexpr char text[] = "Nobody inspects the spammish repetition";
+
+      constexpr uint32_t hash32 = etl::xxhash32_calculate(text, sizeof(text) - 1U);
+      constexpr uint64_t hash64 = etl::xxhash64_calculate(text, sizeof(text) - 1U, Seed);
+
+      CHECK_EQUAL(references[3].xxh32,        hash32);
+      CHECK_EQUAL(references[3].xxh64_seeded, hash64);
+    }
+#endif
+  };
+}